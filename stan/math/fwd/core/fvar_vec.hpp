@@ -0,0 +1,390 @@
+#ifndef STAN_MATH_FWD_CORE_FVAR_VEC_HPP
+#define STAN_MATH_FWD_CORE_FVAR_VEC_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/digamma.hpp>
+#include <stan/math/prim/fun/inv_logit.hpp>
+#include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/trigamma.hpp>
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace stan {
+namespace math {
+
+/**
+ * Forward mode automatic differentiation variable with a value and K
+ * tangents, that is, the directional derivatives in K directions.
+ * Each operation propagates all K tangents at once. The tangents are
+ * stored in a fixed size Eigen array such that the tangent arithmetic
+ * is vectorized with SIMD instructions where available.
+ *
+ * A single evaluation of a function with fvar_vec arguments computes
+ * K columns of its Jacobian, see jacobian_vec.
+ *
+ * Only the arithmetic operators, comparisons and the elementary
+ * functions declared with this class are defined for fvar_vec.
+ *
+ * @tparam K number of tangents
+ */
+template <int K>
+struct fvar_vec {
+  using tangent_t = Eigen::Array<double, K, 1>;
+
+  /**
+   * The value of this variable.
+   */
+  double val_;
+
+  /**
+   * The tangents of this variable.
+   */
+  tangent_t d_;
+
+  /**
+   * Return the value of this variable.
+   *
+   * @return value of this variable
+   */
+  double val() const { return val_; }
+
+  /**
+   * Return the tangents of this variable.
+   *
+   * @return tangents of this variable
+   */
+  const tangent_t& tangent() const { return d_; }
+
+  /**
+   * Construct a forward variable with zero value and tangents.
+   */
+  fvar_vec() : val_(0), d_(tangent_t::Zero()) {}
+
+  /**
+   * Construct a constant forward variable with the specified value
+   * and zero tangents.
+   *
+   * @tparam V arithmetic type of the value
+   * @param[in] v value
+   */
+  template <typename V, typename = require_arithmetic_t<V>>
+  fvar_vec(V v) : val_(v), d_(tangent_t::Zero()) {}  // NOLINT
+
+  /**
+   * Construct a forward variable with the specified value and
+   * tangents.
+   *
+   * @tparam D type of the tangent expression
+   * @param[in] v value
+   * @param[in] d tangents
+   */
+  template <typename D>
+  fvar_vec(double v, const Eigen::ArrayBase<D>& d) : val_(v), d_(d) {}
+
+  inline fvar_vec& operator+=(const fvar_vec& x) {
+    val_ += x.val_;
+    d_ += x.d_;
+    return *this;
+  }
+
+  inline fvar_vec& operator+=(double x) {
+    val_ += x;
+    return *this;
+  }
+
+  inline fvar_vec& operator-=(const fvar_vec& x) {
+    val_ -= x.val_;
+    d_ -= x.d_;
+    return *this;
+  }
+
+  inline fvar_vec& operator-=(double x) {
+    val_ -= x;
+    return *this;
+  }
+
+  inline fvar_vec& operator*=(const fvar_vec& x) {
+    d_ = d_ * x.val_ + val_ * x.d_;
+    val_ *= x.val_;
+    return *this;
+  }
+
+  inline fvar_vec& operator*=(double x) {
+    val_ *= x;
+    d_ *= x;
+    return *this;
+  }
+
+  inline fvar_vec& operator/=(const fvar_vec& x) {
+    d_ = (d_ * x.val_ - val_ * x.d_) / (x.val_ * x.val_);
+    val_ /= x.val_;
+    return *this;
+  }
+
+  inline fvar_vec& operator/=(double x) {
+    val_ /= x;
+    d_ /= x;
+    return *this;
+  }
+
+  /**
+   * Write the value and tangents of the variable to the stream.
+   *
+   * @param[in, out] os stream to write to
+   * @param[in] v variable to write
+   * @return reference to the stream
+   */
+  friend std::ostream& operator<<(std::ostream& os, const fvar_vec& v) {
+    return os << v.val_ << ":[" << v.d_.transpose() << "]";
+  }
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+template <int K>
+inline fvar_vec<K> operator+(const fvar_vec<K>& x) {
+  return x;
+}
+
+template <int K>
+inline fvar_vec<K> operator-(const fvar_vec<K>& x) {
+  return fvar_vec<K>(-x.val_, -x.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator+(const fvar_vec<K>& x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x.val_ + y.val_, x.d_ + y.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator+(const fvar_vec<K>& x, double y) {
+  return fvar_vec<K>(x.val_ + y, x.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator+(double x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x + y.val_, y.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator-(const fvar_vec<K>& x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x.val_ - y.val_, x.d_ - y.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator-(const fvar_vec<K>& x, double y) {
+  return fvar_vec<K>(x.val_ - y, x.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator-(double x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x - y.val_, -y.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator*(const fvar_vec<K>& x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x.val_ * y.val_, x.d_ * y.val_ + x.val_ * y.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator*(const fvar_vec<K>& x, double y) {
+  return fvar_vec<K>(x.val_ * y, x.d_ * y);
+}
+
+template <int K>
+inline fvar_vec<K> operator*(double x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x * y.val_, x * y.d_);
+}
+
+template <int K>
+inline fvar_vec<K> operator/(const fvar_vec<K>& x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x.val_ / y.val_,
+                     (x.d_ * y.val_ - x.val_ * y.d_) / (y.val_ * y.val_));
+}
+
+template <int K>
+inline fvar_vec<K> operator/(const fvar_vec<K>& x, double y) {
+  return fvar_vec<K>(x.val_ / y, x.d_ / y);
+}
+
+template <int K>
+inline fvar_vec<K> operator/(double x, const fvar_vec<K>& y) {
+  return fvar_vec<K>(x / y.val_, -x * y.d_ / (y.val_ * y.val_));
+}
+
+// comparisons only consider the values
+#define STAN_FVAR_VEC_COMPARISON(OP)                                   \
+  template <int K>                                                     \
+  inline bool operator OP(const fvar_vec<K>& x, const fvar_vec<K>& y) { \
+    return x.val_ OP y.val_;                                           \
+  }                                                                    \
+  template <int K>                                                     \
+  inline bool operator OP(const fvar_vec<K>& x, double y) {            \
+    return x.val_ OP y;                                                \
+  }                                                                    \
+  template <int K>                                                     \
+  inline bool operator OP(double x, const fvar_vec<K>& y) {            \
+    return x OP y.val_;                                                \
+  }
+
+STAN_FVAR_VEC_COMPARISON(<)
+STAN_FVAR_VEC_COMPARISON(<=)
+STAN_FVAR_VEC_COMPARISON(>)
+STAN_FVAR_VEC_COMPARISON(>=)
+STAN_FVAR_VEC_COMPARISON(==)
+STAN_FVAR_VEC_COMPARISON(!=)
+
+#undef STAN_FVAR_VEC_COMPARISON
+
+template <int K>
+inline double value_of(const fvar_vec<K>& x) {
+  return x.val_;
+}
+
+template <int K>
+inline fvar_vec<K> exp(const fvar_vec<K>& x) {
+  const double exp_x = std::exp(x.val_);
+  return fvar_vec<K>(exp_x, x.d_ * exp_x);
+}
+
+template <int K>
+inline fvar_vec<K> expm1(const fvar_vec<K>& x) {
+  return fvar_vec<K>(std::expm1(x.val_), x.d_ * std::exp(x.val_));
+}
+
+template <int K>
+inline fvar_vec<K> log(const fvar_vec<K>& x) {
+  if (x.val_ < 0.0) {
+    return fvar_vec<K>(NOT_A_NUMBER, fvar_vec<K>::tangent_t::Constant(
+                                         NOT_A_NUMBER));
+  }
+  return fvar_vec<K>(std::log(x.val_), x.d_ / x.val_);
+}
+
+template <int K>
+inline fvar_vec<K> log1p(const fvar_vec<K>& x) {
+  return fvar_vec<K>(std::log1p(x.val_), x.d_ / (1 + x.val_));
+}
+
+template <int K>
+inline fvar_vec<K> sqrt(const fvar_vec<K>& x) {
+  const double sqrt_x = std::sqrt(x.val_);
+  return fvar_vec<K>(sqrt_x, x.d_ * (0.5 / sqrt_x));
+}
+
+template <int K>
+inline fvar_vec<K> square(const fvar_vec<K>& x) {
+  return fvar_vec<K>(x.val_ * x.val_, x.d_ * (2 * x.val_));
+}
+
+template <int K>
+inline fvar_vec<K> inv(const fvar_vec<K>& x) {
+  return fvar_vec<K>(1 / x.val_, x.d_ * (-1 / (x.val_ * x.val_)));
+}
+
+template <int K>
+inline fvar_vec<K> pow(const fvar_vec<K>& x, double y) {
+  // x^0 is constant, so its tangent is zero even at x = 0
+  const double dpow_dx = y == 0 ? 0 : y * std::pow(x.val_, y - 1);
+  return fvar_vec<K>(std::pow(x.val_, y), x.d_ * dpow_dx);
+}
+
+template <int K>
+inline fvar_vec<K> pow(double x, const fvar_vec<K>& y) {
+  const double pow_x = std::pow(x, y.val_);
+  return fvar_vec<K>(pow_x, y.d_ * (std::log(x) * pow_x));
+}
+
+template <int K>
+inline fvar_vec<K> pow(const fvar_vec<K>& x, const fvar_vec<K>& y) {
+  const double pow_x = std::pow(x.val_, y.val_);
+  const double dpow_dx
+      = y.val_ == 0 ? 0 : y.val_ * std::pow(x.val_, y.val_ - 1);
+  // x^y log(x) tends to zero as x goes to zero for y > 0
+  const double dpow_dy = pow_x == 0 ? 0 : pow_x * std::log(x.val_);
+  return fvar_vec<K>(pow_x, x.d_ * dpow_dx + y.d_ * dpow_dy);
+}
+
+template <int K>
+inline fvar_vec<K> sin(const fvar_vec<K>& x) {
+  return fvar_vec<K>(std::sin(x.val_), x.d_ * std::cos(x.val_));
+}
+
+template <int K>
+inline fvar_vec<K> cos(const fvar_vec<K>& x) {
+  return fvar_vec<K>(std::cos(x.val_), x.d_ * -std::sin(x.val_));
+}
+
+template <int K>
+inline fvar_vec<K> tanh(const fvar_vec<K>& x) {
+  const double tanh_x = std::tanh(x.val_);
+  return fvar_vec<K>(tanh_x, x.d_ * (1 - tanh_x * tanh_x));
+}
+
+template <int K>
+inline fvar_vec<K> fabs(const fvar_vec<K>& x) {
+  if (x.val_ > 0) {
+    return x;
+  } else if (x.val_ < 0) {
+    return -x;
+  } else if (x.val_ == 0) {
+    return fvar_vec<K>(0);
+  }
+  return fvar_vec<K>(NOT_A_NUMBER,
+                     fvar_vec<K>::tangent_t::Constant(NOT_A_NUMBER));
+}
+
+template <int K>
+inline fvar_vec<K> inv_logit(const fvar_vec<K>& x) {
+  const double inv_logit_x = inv_logit(x.val_);
+  return fvar_vec<K>(inv_logit_x, x.d_ * (inv_logit_x * (1 - inv_logit_x)));
+}
+
+template <int K>
+inline fvar_vec<K> lgamma(const fvar_vec<K>& x) {
+  return fvar_vec<K>(lgamma(x.val_), x.d_ * digamma(x.val_));
+}
+
+template <int K>
+inline fvar_vec<K> digamma(const fvar_vec<K>& x) {
+  return fvar_vec<K>(digamma(x.val_), x.d_ * trigamma(x.val_));
+}
+
+}  // namespace math
+}  // namespace stan
+
+namespace Eigen {
+
+/**
+ * Numerical traits template override for Eigen for automatic
+ * differentiation variables with vector tangents.
+ */
+template <int K>
+struct NumTraits<stan::math::fvar_vec<K>>
+    : GenericNumTraits<stan::math::fvar_vec<K>> {
+  enum {
+    RequireInitialization = 1,
+    ReadCost = (K + 1) * NumTraits<double>::ReadCost,
+    AddCost = (K + 1) * NumTraits<double>::AddCost,
+    MulCost = (2 * K + 1) * NumTraits<double>::MulCost
+              + K * NumTraits<double>::AddCost
+  };
+
+  static int digits10() { return std::numeric_limits<double>::digits10; }
+};
+
+template <int K, typename BinaryOp>
+struct ScalarBinaryOpTraits<stan::math::fvar_vec<K>, double, BinaryOp> {
+  using ReturnType = stan::math::fvar_vec<K>;
+};
+
+template <int K, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, stan::math::fvar_vec<K>, BinaryOp> {
+  using ReturnType = stan::math::fvar_vec<K>;
+};
+
+}  // namespace Eigen
+#endif
@@ -4,5 +4,7 @@
 #include <stan/math/fwd/functor/gradient.hpp>
 #include <stan/math/fwd/functor/hessian.hpp>
 #include <stan/math/fwd/functor/jacobian.hpp>
+#include <stan/math/fwd/functor/jacobian_vec.hpp>
+#include <stan/math/fwd/functor/sparse_jacobian.hpp>
 
 #endif
@@ -0,0 +1,67 @@
+#ifndef STAN_MATH_FWD_FUNCTOR_JACOBIAN_VEC_HPP
+#define STAN_MATH_FWD_FUNCTOR_JACOBIAN_VEC_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+
+namespace stan {
+namespace math {
+
+/**
+ * Calculate the value and the Jacobian of the specified function at
+ * the specified argument with forward mode automatic differentiation,
+ * computing K columns of the Jacobian per evaluation of the function
+ * with vector tangent variables.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix\<fvar_vec\<K\>, Eigen::Dynamic, 1\>
+ * operator()(const Eigen::Matrix\<fvar_vec\<K\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar_vec</code>.
+ *
+ * @tparam K number of Jacobian columns per evaluation
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[out] fx function applied to argument
+ * @param[out] J Jacobian of function at argument
+ */
+template <int K, typename F>
+void jacobian_vec(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                  Eigen::Matrix<double, Eigen::Dynamic, 1>& fx,
+                  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& J) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  const int N = x.size();
+  Matrix<fvar_vec<K>, Dynamic, 1> x_fvar(N);
+  // the function is evaluated even for a zero size argument
+  for (int start = 0; start == 0 || start < N; start += K) {
+    const int end = std::min(start + K, N);
+    for (int k = 0; k < N; ++k) {
+      x_fvar(k) = fvar_vec<K>(x(k));
+    }
+    for (int k = start; k < end; ++k) {
+      x_fvar(k).d_(k - start) = 1;
+    }
+    Matrix<fvar_vec<K>, Dynamic, 1> fx_fvar = f(x_fvar);
+    if (start == 0) {
+      fx.resize(fx_fvar.size());
+      J.resize(fx_fvar.size(), N);
+      for (int m = 0; m < fx_fvar.size(); ++m) {
+        fx(m) = fx_fvar(m).val_;
+      }
+    }
+    for (int m = 0; m < fx_fvar.size(); ++m) {
+      J.row(m).segment(start, end - start)
+          = fx_fvar(m).d_.head(end - start).transpose();
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
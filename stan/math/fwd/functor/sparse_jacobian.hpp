@@ -0,0 +1,90 @@
+#ifndef STAN_MATH_FWD_FUNCTOR_SPARSE_JACOBIAN_HPP
+#define STAN_MATH_FWD_FUNCTOR_SPARSE_JACOBIAN_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/functor/sparse_column_coloring.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Calculate the value and the sparse Jacobian of the specified
+ * function at the specified argument with forward mode automatic
+ * differentiation, given the sparsity pattern of the Jacobian.
+ *
+ * <p>The columns of the pattern are colored such that columns of the
+ * same color have no nonzero in a common row. The function is then
+ * evaluated once per color with the sum of the unit directions of all
+ * columns of that color as tangent, and the entries of these columns
+ * are read off the directional derivative. This needs as many
+ * evaluations as colors instead of one per column.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix\<fvar\<double\>, Eigen::Dynamic, 1\>
+ * operator()(const Eigen::Matrix\<fvar\<double\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * Entries of the Jacobian outside of the pattern must be zero,
+ * otherwise the returned entries are wrong.
+ *
+ * @tparam F type of function
+ * @tparam T type of the pattern entries, only the structure is used
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] pattern sparsity pattern of the Jacobian
+ * @param[out] fx function applied to argument
+ * @param[out] J Jacobian of function at argument with the structure of
+ * the pattern
+ * @throw std::invalid_argument if the number of columns of the
+ * pattern does not match the size of the argument or its number of
+ * rows does not match the size of the function value
+ */
+template <typename F, typename T>
+void sparse_jacobian(const F& f,
+                     const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                     const Eigen::SparseMatrix<T>& pattern,
+                     Eigen::Matrix<double, Eigen::Dynamic, 1>& fx,
+                     Eigen::SparseMatrix<double>& J) {
+  static const char* function = "sparse_jacobian";
+  check_size_match(function, "columns of sparsity pattern", pattern.cols(),
+                   "size of argument", x.size());
+
+  const std::vector<int> colors = internal::sparse_column_coloring(pattern);
+  const int num_colors
+      = colors.empty() ? 1
+                       : *std::max_element(colors.begin(), colors.end()) + 1;
+
+  Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1> x_fvar(x.size());
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> compressed;
+  for (int c = 0; c < num_colors; ++c) {
+    for (int k = 0; k < x.size(); ++k) {
+      x_fvar(k) = fvar<double>(x(k), colors[k] == c);
+    }
+    Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1> fx_fvar = f(x_fvar);
+    if (c == 0) {
+      check_size_match(function, "rows of sparsity pattern", pattern.rows(),
+                       "size of function value", fx_fvar.size());
+      fx = fx_fvar.val();
+      compressed.resize(fx_fvar.size(), num_colors);
+    }
+    compressed.col(c) = fx_fvar.d();
+  }
+
+  J = pattern.template cast<double>();
+  J.makeCompressed();
+  for (int j = 0; j < J.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(J, j); it; ++it) {
+      it.valueRef() = compressed(it.row(), colors[j]);
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -9,6 +9,8 @@
 #include <stan/math/mix/functor/gradient_dot_vector.hpp>
 #include <stan/math/mix/functor/hessian.hpp>
 #include <stan/math/mix/functor/hessian_times_vector.hpp>
+#include <stan/math/mix/functor/parallel_hessian.hpp>
 #include <stan/math/mix/functor/partial_derivative.hpp>
+#include <stan/math/mix/functor/sparse_hessian.hpp>
 
 #endif
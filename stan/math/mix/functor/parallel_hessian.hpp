@@ -0,0 +1,102 @@
+#ifndef STAN_MATH_MIX_FUNCTOR_PARALLEL_HESSIAN_HPP
+#define STAN_MATH_MIX_FUNCTOR_PARALLEL_HESSIAN_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/rev/core.hpp>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <stdexcept>
+
+namespace stan {
+namespace math {
+
+/**
+ * Calculate the value, the gradient, and the Hessian of the specified
+ * function at the specified argument like <code>hessian</code>, but
+ * with the N forward and reverse passes distributed over the TBB
+ * thread pool if STAN_THREADS is defined.
+ *
+ * <p>Row i of the Hessian is the reverse mode gradient of the
+ * directional derivative of the function in direction of the i-th
+ * unit vector. Each row is calculated with an own nested reverse mode
+ * pass on the AD tape of the executing thread and written to a
+ * disjoint row of H, such that the rows are independent.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * fvar\<var\>
+ * operator()(const
+ * Eigen::Matrix\<fvar\<var\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar</code> and
+ * <code>var</code>. The functor is called concurrently from several
+ * threads and must hence be safe to call concurrently.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument
+ * @param[in] grainsize number of rows below which a range of rows is
+ * not split further for parallel execution
+ * @throw std::domain_error if the grainsize is not positive
+ */
+template <typename F>
+void parallel_hessian(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x, double& fx,
+    Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& H,
+    int grainsize = 1) {
+  check_positive("parallel_hessian", "grainsize", grainsize);
+  H.resize(x.size(), x.size());
+  grad.resize(x.size());
+
+  // need to compute fx even with size = 0
+  if (x.size() == 0) {
+    fx = f(x);
+    return;
+  }
+
+  auto hessian_rows = [&](const tbb::blocked_range<int>& r) -> void {
+    for (int i = r.begin(); i < r.end(); ++i) {
+      start_nested();
+      try {
+        Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(x.size());
+        for (int j = 0; j < x.size(); ++j) {
+          x_fvar(j) = fvar<var>(x(j), i == j);
+        }
+        fvar<var> fx_fvar = f(x_fvar);
+        grad(i) = fx_fvar.d_.val();
+        if (i == 0) {
+          fx = fx_fvar.val_.val();
+        }
+        stan::math::grad(fx_fvar.d_.vi_);
+        for (int j = 0; j < x.size(); ++j) {
+          H(i, j) = x_fvar(j).val_.adj();
+        }
+      } catch (const std::exception& e) {
+        recover_memory_nested();
+        throw;
+      }
+      recover_memory_nested();
+    }
+  };
+
+  const tbb::blocked_range<int> rows(0, x.size(), grainsize);
+#ifdef STAN_THREADS
+  tbb::parallel_for(rows, hessian_rows);
+#else
+  hessian_rows(rows);
+#endif
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
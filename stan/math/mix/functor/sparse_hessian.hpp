@@ -0,0 +1,116 @@
+#ifndef STAN_MATH_MIX_FUNCTOR_SPARSE_HESSIAN_HPP
+#define STAN_MATH_MIX_FUNCTOR_SPARSE_HESSIAN_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/functor/sparse_column_coloring.hpp>
+#include <stan/math/rev/core.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Calculate the value, the gradient, and the sparse Hessian of the
+ * specified function at the specified argument, given the sparsity
+ * pattern of the Hessian.
+ *
+ * <p>The columns of the pattern are colored such that columns of the
+ * same color have no nonzero in a common row. For each color one
+ * forward pass in <code>fvar\<var\></code> with the sum of the unit
+ * directions of all columns of that color as tangent and one reverse
+ * sweep calculate the product of the Hessian with that direction, from
+ * which the entries of these columns are read off. This needs as many
+ * passes as colors instead of one per argument, plus one reverse
+ * sweep for the gradient.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * fvar\<var\>
+ * operator()(const
+ * Eigen::Matrix\<fvar\<var\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for <code>fvar</code> and
+ * <code>var</code>. The pattern must include the diagonal entries and
+ * entries of the Hessian outside of the pattern must be zero,
+ * otherwise the returned entries are wrong.
+ *
+ * @tparam F type of function
+ * @tparam T type of the pattern entries, only the structure is used
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[in] pattern sparsity pattern of the Hessian
+ * @param[out] fx function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument with the structure of
+ * the pattern
+ * @throw std::invalid_argument if the pattern is not square of the
+ * size of the argument
+ */
+template <typename F, typename T>
+void sparse_hessian(const F& f,
+                    const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                    const Eigen::SparseMatrix<T>& pattern, double& fx,
+                    Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+                    Eigen::SparseMatrix<double>& H) {
+  static const char* function = "sparse_hessian";
+  check_size_match(function, "rows of sparsity pattern", pattern.rows(),
+                   "size of argument", x.size());
+  check_size_match(function, "columns of sparsity pattern", pattern.cols(),
+                   "size of argument", x.size());
+  grad.resize(x.size());
+  H = pattern.template cast<double>();
+  H.makeCompressed();
+
+  // need to compute fx even with size = 0
+  if (x.size() == 0) {
+    fx = f(x);
+    return;
+  }
+
+  const std::vector<int> colors = internal::sparse_column_coloring(pattern);
+  const int num_colors = *std::max_element(colors.begin(), colors.end()) + 1;
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> compressed(x.size(),
+                                                                   num_colors);
+  try {
+    for (int c = 0; c < num_colors; ++c) {
+      start_nested();
+      Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(x.size());
+      for (int k = 0; k < x.size(); ++k) {
+        x_fvar(k) = fvar<var>(x(k), colors[k] == c);
+      }
+      fvar<var> fx_fvar = f(x_fvar);
+      stan::math::grad(fx_fvar.d_.vi_);
+      for (int k = 0; k < x.size(); ++k) {
+        compressed(k, c) = x_fvar(k).val_.adj();
+      }
+      if (c == 0) {
+        fx = fx_fvar.val_.val();
+        set_zero_all_adjoints_nested();
+        stan::math::grad(fx_fvar.val_.vi_);
+        for (int k = 0; k < x.size(); ++k) {
+          grad(k) = x_fvar(k).val_.adj();
+        }
+      }
+      recover_memory_nested();
+    }
+  } catch (const std::exception& e) {
+    recover_memory_nested();
+    throw;
+  }
+
+  for (int j = 0; j < H.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(H, j); it; ++it) {
+      it.valueRef() = compressed(it.row(), colors[j]);
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -3,10 +3,12 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/batch_kernels.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/erf.hpp>
 #include <stan/math/prim/fun/erfc.hpp>
-#include <stan/math/prim/fun/Phi.hpp>
+#include <boost/math/tools/rational.hpp>
 
 namespace stan {
 namespace math {
@@ -62,11 +64,147 @@ struct Phi_fun {
  * @param x container
  * @return Unit normal CDF of each value in x.
  */
-template <typename T>
+template <typename T, require_not_eigen_vt<std::is_arithmetic, T>* = nullptr>
 inline auto Phi(const T& x) {
   return apply_scalar_unary<Phi_fun, T>::apply(x);
 }
 
+namespace internal {
+
+/**
+ * Return the unit normal cumulative distribution function applied to the
+ * specified argument, which must be less than
+ * <code>2.5 * sqrt(2)</code> in absolute value.
+ *
+ * This is a batch kernel for <code>apply_batch_unary()</code> with the
+ * rational approximations of Boost's <code>erf()</code> and
+ * <code>erfc()</code> on [0, 0.5), [0.5, 1.5) and [1.5, 2.5). As in the
+ * scalar function for this range, the result is computed as
+ * <code>0.5 * (1 + erf(x / sqrt(2)))</code>, so it agrees with the
+ * scalar function up to the rounding of the error function.
+ *
+ * @param x argument
+ * @return unit normal CDF applied to x
+ */
+STAN_MATH_BATCH_INLINE double Phi_batch(double x) {
+  using boost::math::tools::evaluate_polynomial;
+  // erf(t) = t * (Y + R(t^2)) for t in [0, 0.5)
+  static const double P_0[]
+      = {0.0834305892146531832907, -0.338165134459360935041,
+         -0.0509990735146777432841, -0.00772758345802133288487,
+         -0.000322780120964605683831};
+  static const double Q_0[]
+      = {1.0, 0.455004033050794024546, 0.0875222600142252549554,
+         0.00858571925074406212772, 0.000370900071787748000569};
+  static const double Y_0 = 1.044948577880859375;
+  // erfc(t) = exp(-t^2) / t * (Y + R(t - 0.5)) for t in [0.5, 1.5)
+  static const double P_1[]
+      = {-0.098090592216281240205, 0.178114665841120341155,
+         0.191003695796775433986,  0.0888900368967884466578,
+         0.0195049001251218801359, 0.00180424538297014223957};
+  static const double Q_1[]
+      = {1.0,
+         1.84759070983002217845,
+         1.42628004845511324508,
+         0.578052804889902404909,
+         0.12385097467900864233,
+         0.0113385233577001411017,
+         0.337511472483094676155e-5};
+  static const double Y_1 = 0.405935764312744140625;
+  // erfc(t) = exp(-t^2) / t * (Y + R(t - 1.5)) for t in [1.5, 2.5)
+  static const double P_2[]
+      = {-0.0243500476207698441272, 0.0386540375035707201728,
+         0.04394818964209516296,    0.0175679436311802092299,
+         0.00323962406290842133584, 0.000235839115596880717416};
+  static const double Q_2[]
+      = {1.0,
+         1.53991494948552447182,
+         0.982403709157920235114,
+         0.325732924782444448493,
+         0.0563921837420478160373,
+         0.00410369723978904575884};
+  static const double Y_2 = 0.50672817230224609375;
+
+  const double t = INV_SQRT_TWO * x;
+  const double a = batch_abs(t);
+  const double a_sq = a * a;
+  const double erf_small
+      = t * (Y_0 + evaluate_polynomial(P_0, a_sq)
+                       / evaluate_polynomial(Q_0, a_sq));
+
+  const double r_1 = Y_1
+                     + evaluate_polynomial(P_1, a - 0.5)
+                           / evaluate_polynomial(Q_1, a - 0.5);
+  const double r_2 = Y_2
+                     + evaluate_polynomial(P_2, a - 1.5)
+                           / evaluate_polynomial(Q_2, a - 1.5);
+  // exp(-a^2) corrected for the rounding error of a^2, which is found by
+  // splitting a into its high 26 bits and the rest. The error is below
+  // the precision of a^2, so exp(-error) is 1 - error.
+  const double a_hi
+      = batch_bits_double(batch_double_bits(a) & 0xfffffffff8000000ULL);
+  const double a_lo = a - a_hi;
+  const double a_sq_err = ((a_hi * a_hi - a_sq) + 2 * a_hi * a_lo)
+                          + a_lo * a_lo;
+  const double erfc_a = batch_if_less(a, 1.5, r_1, r_2)
+                        * (batch_exp(-a_sq) * (1.0 - a_sq_err) / a);
+  const double erf_a = 1.0 - erfc_a;
+  const double erf_t = batch_if_less(
+      a, 0.5, erf_small, batch_if_less(t, 0.0, -erf_a, erf_a));
+  return 0.5 * (1.0 + erf_t);
+}
+
+}  // namespace internal
+
+/**
+ * Version of Phi() that accepts Eigen arrays or array expressions of
+ * arithmetic scalars. If AVX instructions are enabled, the values for
+ * arguments less than <code>2.5 * sqrt(2)</code> in absolute value are
+ * computed by a batch kernel, which the compiler can vectorize and which
+ * agrees with the scalar function to within a couple of ulp of 1, and
+ * the other values by the scalar function. With narrower vectors the
+ * kernel, which evaluates three rational approximations for every
+ * argument, is not faster than the scalar function, which is used for
+ * all values.
+ *
+ * @tparam Derived derived type of x
+ * @param x array or array expression
+ * @return unit normal CDF of each value in x
+ * @throw std::domain_error if any value is NaN
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto Phi(const Derived& x) {
+  const auto& x_ref = x.derived().eval();
+  check_not_nan("Phi", "x", x_ref);
+  auto scalar_Phi = [](double x) { return Phi(x); };
+#ifdef __AVX__
+  return apply_batch_unary(
+      x_ref, [](double x) { return internal::Phi_batch(x); },
+      [](double x) { return (x > -2.5 * SQRT_TWO) & (x < 2.5 * SQRT_TWO); },
+      scalar_Phi);
+#else
+  return x_ref.template cast<double>().unaryExpr(scalar_Phi).eval();
+#endif
+}
+
+/**
+ * Version of Phi() that accepts Eigen matrices or matrix expressions of
+ * arithmetic scalars.
+ *
+ * @tparam Derived derived type of x
+ * @param x matrix or matrix expression
+ * @return unit normal CDF of each value in x
+ * @throw std::domain_error if any value is NaN
+ */
+template <typename Derived,
+          require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto Phi(const Eigen::MatrixBase<Derived>& x) {
+  return Phi(x.derived().array()).matrix().eval();
+}
+
 }  // namespace math
 }  // namespace stan
 
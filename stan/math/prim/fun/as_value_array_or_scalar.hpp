@@ -0,0 +1,71 @@
+#ifndef STAN_MATH_PRIM_FUN_AS_VALUE_ARRAY_OR_SCALAR_HPP
+#define STAN_MATH_PRIM_FUN_AS_VALUE_ARRAY_OR_SCALAR_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Returns the value of the specified scalar as a double.
+ *
+ * @tparam T type of the scalar
+ * @param x scalar
+ * @return value of the scalar
+ */
+template <typename T, require_stan_scalar_t<T>* = nullptr>
+inline double as_value_array_or_scalar(const T& x) {
+  return value_of(x);
+}
+
+/**
+ * Returns a std::vector or an Eigen vector of doubles as an Eigen
+ * array without copying it.
+ *
+ * @tparam T type of the vector
+ * @param x vector
+ * @return array view of the vector
+ */
+template <typename T, require_vector_vt<std::is_floating_point, T>* = nullptr>
+inline auto as_value_array_or_scalar(const T& x) {
+  return as_array_or_scalar(x);
+}
+
+/**
+ * Returns a std::vector or an Eigen vector of integers as an Eigen array
+ * expression of doubles.
+ *
+ * @tparam T type of the vector
+ * @param x vector
+ * @return array expression of the values as doubles
+ */
+template <typename T, require_vector_vt<std::is_integral, T>* = nullptr>
+inline auto as_value_array_or_scalar(const T& x) {
+  return as_array_or_scalar(x).template cast<double>();
+}
+
+/**
+ * Returns the values of a std::vector or an Eigen vector of reverse mode
+ * autodiff variables as an Eigen array.
+ *
+ * @tparam T type of the vector
+ * @param x vector
+ * @return array of the values of the vector
+ */
+template <typename T, require_vector_vt<is_var, T>* = nullptr>
+inline Eigen::Array<double, Eigen::Dynamic, 1> as_value_array_or_scalar(
+    const T& x) {
+  Eigen::Array<double, Eigen::Dynamic, 1> x_val(x.size());
+  for (int i = 0; i < x_val.size(); ++i) {
+    x_val(i) = value_of(x[i]);
+  }
+  return x_val;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef STAN_MATH_PRIM_FUN_BATCH_KERNELS_HPP
+#define STAN_MATH_PRIM_FUN_BATCH_KERNELS_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+/**
+ * Batch kernels must be inlined into the loops which apply them to
+ * arrays, otherwise these loops can not be vectorized.
+ */
+#ifdef __GNUC__
+#define STAN_MATH_BATCH_INLINE inline __attribute__((always_inline))
+#else
+#define STAN_MATH_BATCH_INLINE inline
+#endif
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Reinterpret the bits of a double as an unsigned 64 bit integer.
+ *
+ * @param x argument
+ * @return bits of the argument
+ */
+STAN_MATH_BATCH_INLINE std::uint64_t batch_double_bits(double x) {
+  std::uint64_t bits;
+  std::memcpy(&bits, &x, sizeof(double));
+  return bits;
+}
+
+/**
+ * Reinterpret an unsigned 64 bit integer as a double.
+ *
+ * @param bits bits of a double
+ * @return double with the given bits
+ */
+STAN_MATH_BATCH_INLINE double batch_bits_double(std::uint64_t bits) {
+  double x;
+  std::memcpy(&x, &bits, sizeof(double));
+  return x;
+}
+
+/**
+ * Return <code>a</code> if <code>x</code> is less than <code>y</code> and
+ * <code>b</code> otherwise.
+ *
+ * The comparison is done on the sign bit of <code>x - y</code>, which
+ * the compiler can vectorize without if-conversion of floating point
+ * comparisons. The result is unspecified if <code>x - y</code> is NaN.
+ *
+ * @param x first value to compare
+ * @param y second value to compare
+ * @param a value returned if x < y
+ * @param b value returned otherwise
+ * @return a if x < y and b otherwise
+ */
+STAN_MATH_BATCH_INLINE double batch_if_less(double x, double y, double a,
+                                            double b) {
+  const std::uint64_t mask = 0 - (batch_double_bits(x - y) >> 63);
+  return batch_bits_double((batch_double_bits(a) & mask)
+                           | (batch_double_bits(b) & ~mask));
+}
+
+/**
+ * Return the absolute value of the argument.
+ *
+ * @param x argument
+ * @return absolute value of the argument
+ */
+STAN_MATH_BATCH_INLINE double batch_abs(double x) {
+  return batch_bits_double(batch_double_bits(x) & 0x7fffffffffffffffULL);
+}
+
+/**
+ * Return the natural logarithm of the argument.
+ *
+ * The argument must be a positive, finite and normal double; the result
+ * for other arguments is unspecified. Within this domain the result is
+ * within one ulp of <code>std::log()</code>.
+ *
+ * This is the algorithm of fdlibm, with the argument reduction done by
+ * integer operations on the bits of the argument instead of branches,
+ * so that loops calling it can be vectorized by the compiler. It is the
+ * building block of the batch kernels of the special functions, which
+ * are applied to whole arrays by <code>apply_batch_unary()</code>.
+ *
+ * @param x argument
+ * @return natural logarithm of the argument
+ */
+STAN_MATH_BATCH_INLINE double batch_log(double x) {
+  static const std::uint64_t sqrt_half_bits = 0x3fe6a09e667f3bcdULL;
+  static const std::uint64_t one_bits = 0x3ff0000000000000ULL;
+  static const std::uint64_t mantissa_mask = 0x000fffffffffffffULL;
+  static const std::uint64_t two_52_bits = 0x4330000000000000ULL;
+  // Shift the mantissa into [sqrt(1/2), sqrt(2)) and adjust the exponent.
+  const std::uint64_t bits
+      = batch_double_bits(x) + (one_bits - sqrt_half_bits);
+  const double m = batch_bits_double((bits & mantissa_mask) + sqrt_half_bits);
+  const double k = batch_bits_double((bits >> 52) | two_52_bits)
+                   - (4503599627370496.0 + 1023.0);
+  const double f = m - 1.0;
+  const double s = f / (2.0 + f);
+  const double z = s * s;
+  const double w = z * z;
+  const double t1
+      = w
+        * (3.999999999940941908e-01
+           + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+  const double t2
+      = z
+        * (6.666666666666735130e-01
+           + w
+                 * (2.857142874366239149e-01
+                    + w
+                          * (1.818357216161805012e-01
+                             + w * 1.479819860511658591e-01)));
+  const double hfsq = 0.5 * f * f;
+  return k * 6.93147180369123816490e-01
+         - ((hfsq - (s * (hfsq + t1 + t2) + k * 1.90821492927058770002e-10))
+            - f);
+}
+
+/**
+ * Return the natural logarithm of one plus the argument.
+ *
+ * The argument must be finite and greater than
+ * <code>-1 + 2^-1022</code>; the result for other arguments is
+ * unspecified. The rounding error of <code>1 + x</code> is corrected
+ * so that the result is accurate for arguments close to zero.
+ *
+ * @param x argument
+ * @return natural logarithm of one plus the argument
+ */
+STAN_MATH_BATCH_INLINE double batch_log1p(double x) {
+  const double w = 1.0 + x;
+  return batch_log(w) - ((w - 1.0) - x) / w;
+}
+
+/**
+ * Return the exponential of the argument.
+ *
+ * Results that would be smaller than <code>2^-1021</code> are flushed
+ * to zero and results that would overflow are infinite. Otherwise the
+ * result is within one ulp of <code>std::exp()</code>. The result for
+ * NaN arguments is unspecified.
+ *
+ * This is the algorithm of fdlibm, with the rounding of the exponent
+ * and the final scaling done by integer operations on the bits of
+ * doubles instead of branches, so that loops calling it can be
+ * vectorized by the compiler.
+ *
+ * @param x argument
+ * @return exponential of the argument
+ */
+STAN_MATH_BATCH_INLINE double batch_exp(double x) {
+  static const double lower = -707.7032713517042;
+  static const double upper = 709.782712893384;
+  static const double round_shift = 6755399441055744.0;
+  static const std::uint64_t round_shift_bits = 0x4338000000000000ULL;
+  const double x_clamped
+      = batch_if_less(x, lower, lower, batch_if_less(upper, x, upper, x));
+  // Round x / log(2) to the nearest integer k, which ends up in the low
+  // bits of k_shifted.
+  const double k_shifted
+      = x_clamped * 1.44269504088896338700e+00 + round_shift;
+  const double k = k_shifted - round_shift;
+  const double hi = x_clamped - k * 6.93147180369123816490e-01;
+  const double lo = k * 1.90821492927058770002e-10;
+  const double r = hi - lo;
+  const double t = r * r;
+  const double p
+      = 1.66666666666666019037e-01
+        + t
+              * (-2.77777777770155933842e-03
+                 + t
+                       * (6.61375632143793436117e-05
+                          + t
+                                * (-1.65339022054652515390e-06
+                                   + t * 4.13813679705723846039e-08)));
+  const double c = r - t * p;
+  const double y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+  // 2^(k - 1), which is a normal double for k in [-1021, 1024]
+  const double scale = batch_bits_double(
+      (batch_double_bits(k_shifted) - round_shift_bits + 1022) << 52);
+  const double result = 2.0 * (y * scale);
+  return batch_if_less(
+      x, lower, 0.0,
+      batch_if_less(upper, x, std::numeric_limits<double>::infinity(),
+                    result));
+}
+
+/**
+ * Return the sine of the argument, which must be in
+ * <code>[-pi / 4, pi / 4]</code>; the result for other arguments is
+ * unspecified. Within this domain the result is within one ulp of
+ * <code>std::sin()</code>.
+ *
+ * This is the polynomial of fdlibm's kernel sine, without the argument
+ * reduction, which callers do on their own.
+ *
+ * @param x argument
+ * @return sine of the argument
+ */
+STAN_MATH_BATCH_INLINE double batch_sin_kernel(double x) {
+  const double z = x * x;
+  const double r
+      = 8.33333333332248946124e-03
+        + z
+              * (-1.98412698298579493134e-04
+                 + z
+                       * (2.75573137070700676789e-06
+                          + z
+                                * (-2.50507602534068634195e-08
+                                   + z * 1.58969099521155010221e-10)));
+  return x + z * x * (-1.66666666666666324348e-01 + z * r);
+}
+
+/**
+ * Return the cosine of the argument, which must be in
+ * <code>[-pi / 4, pi / 4]</code>; the result for other arguments is
+ * unspecified. Within this domain the result is within one ulp of
+ * <code>std::cos()</code>.
+ *
+ * This is the polynomial of fdlibm's kernel cosine, without the argument
+ * reduction, which callers do on their own.
+ *
+ * @param x argument
+ * @return cosine of the argument
+ */
+STAN_MATH_BATCH_INLINE double batch_cos_kernel(double x) {
+  const double z = x * x;
+  const double p
+      = 2.48015872894767294178e-05
+        + z
+              * (-2.75573143513906633035e-07
+                 + z
+                       * (2.08757232129817482790e-09
+                          + z * -1.13596475577881948265e-11));
+  const double r
+      = z
+        * (4.16666666666666019037e-02
+           + z * (-1.38888888888741095749e-03 + z * p));
+  const double hz = 0.5 * z;
+  const double w = 1.0 - hz;
+  // 1 - hz rounded to w, plus the rounding error of w
+  return w + (((1.0 - w) - hz) + z * r);
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
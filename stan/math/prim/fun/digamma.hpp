@@ -2,8 +2,12 @@
 #define STAN_MATH_PRIM_FUN_DIGAMMA_HPP
 
 #include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/batch_kernels.hpp>
 #include <stan/math/prim/fun/boost_policy.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/tools/rational.hpp>
 
 namespace stan {
 namespace math {
@@ -62,6 +66,39 @@ struct digamma_fun {
   }
 };
 
+namespace internal {
+
+/**
+ * Return the derivative of the log gamma function applied to the
+ * specified argument, which must be a finite double not less than 10.
+ *
+ * This is a batch kernel for <code>apply_batch_unary()</code> with the
+ * asymptotic series Boost's <code>digamma()</code> uses for these
+ * arguments.
+ *
+ * @param x argument
+ * @return derivative of the log gamma function applied to x
+ */
+STAN_MATH_BATCH_INLINE double digamma_asymptotic_batch(double x) {
+  using boost::math::tools::evaluate_polynomial;
+  static const double P[]
+      = {0.083333333333333333333333333333333333333333333333333,
+         -0.0083333333333333333333333333333333333333333333333333,
+         0.003968253968253968253968253968253968253968253968254,
+         -0.0041666666666666666666666666666666666666666666666667,
+         0.0075757575757575757575757575757575757575757575757576,
+         -0.021092796092796092796092796092796092796092796092796,
+         0.083333333333333333333333333333333333333333333333333,
+         -0.44325980392156862745098039215686274509803921568627};
+  const double w = x - 1.0;
+  const double inv_w = 1.0 / w;
+  const double inv_w_sq = inv_w * inv_w;
+  return batch_log(w) + 0.5 * inv_w
+         - inv_w_sq * evaluate_polynomial(P, inv_w_sq);
+}
+
+}  // namespace internal
+
 /**
  * Vectorized version of digamma().
  *
@@ -70,11 +107,46 @@ struct digamma_fun {
  * @return Digamma function applied to each value in x.
  * @throw std::domain_error if any value is a negative integer or 0
  */
-template <typename T>
+template <typename T, require_not_eigen_vt<std::is_arithmetic, T>* = nullptr>
 inline auto digamma(const T& x) {
   return apply_scalar_unary<digamma_fun, T>::apply(x);
 }
 
+/**
+ * Version of digamma() that accepts Eigen arrays or array expressions of
+ * arithmetic scalars. The values for finite arguments of at least 10 are
+ * computed by a batch kernel, which the compiler can vectorize, and the
+ * other values by the scalar function.
+ *
+ * @tparam Derived derived type of x
+ * @param x array or array expression
+ * @return Digamma function applied to each value in x.
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto digamma(const Derived& x) {
+  return apply_batch_unary(
+      x, [](double x) { return internal::digamma_asymptotic_batch(x); },
+      [](double x) { return (x >= 10.0) & (x < INFTY); },
+      [](double x) { return digamma(x); });
+}
+
+/**
+ * Version of digamma() that accepts Eigen matrices or matrix expressions
+ * of arithmetic scalars.
+ *
+ * @tparam Derived derived type of x
+ * @param x matrix or matrix expression
+ * @return Digamma function applied to each value in x.
+ */
+template <typename Derived,
+          require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto digamma(const Eigen::MatrixBase<Derived>& x) {
+  return digamma(x.derived().array()).matrix().eval();
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -0,0 +1,77 @@
+#ifndef STAN_MATH_PRIM_FUN_DISCRETE_INVERSION_TABLE_HPP
+#define STAN_MATH_PRIM_FUN_DISCRETE_INVERSION_TABLE_HPP
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Table for drawing from a discrete distribution on 0, ..., K - 1 by
+ * inversion of its cumulative distribution function.
+ *
+ * The search for the inverse starts at a guide table entry indexed by
+ * the uniform variate, as suggested by Chen and Asau (1974), On
+ * generating random variates from an empirical distribution, AIIE
+ * Transactions 6(2). With a guide table as long as the table of
+ * probabilities the expected number of comparisons is below two for
+ * any distribution, so a draw costs a uniform variate and a few loads,
+ * while sequential inversion takes a number of steps that grows with
+ * the mean.
+ *
+ * The probabilities must sum to at most one up to rounding; the mass
+ * above their sum is assigned to K - 1, so the probabilities should
+ * include all but a negligible tail of the distribution.
+ */
+class discrete_inversion_table {
+ public:
+  /**
+   * Construct the table for the specified probabilities.
+   *
+   * @param pmf probabilities of 0, ..., K - 1, K > 0
+   */
+  explicit discrete_inversion_table(const std::vector<double>& pmf)
+      : cdf_(pmf.size()), guide_(pmf.size()) {
+    double sum = 0;
+    for (std::size_t k = 0; k < pmf.size(); ++k) {
+      sum += pmf[k];
+      cdf_[k] = sum;
+    }
+    cdf_.back() = std::numeric_limits<double>::infinity();
+    const std::size_t M = guide_.size();
+    std::size_t k = 0;
+    for (std::size_t m = 0; m < M; ++m) {
+      while (cdf_[k] <= static_cast<double>(m) / M) {
+        ++k;
+      }
+      guide_[m] = k;
+    }
+  }
+
+  /**
+   * Return the smallest k whose cumulative probability exceeds the
+   * specified uniform variate.
+   *
+   * @param u uniform variate in [0, 1)
+   * @return variate of the discrete distribution
+   */
+  int operator()(double u) const {
+    std::size_t k = guide_[static_cast<std::size_t>(u * guide_.size())];
+    while (u >= cdf_[k]) {
+      ++k;
+    }
+    return k;
+  }
+
+ private:
+  std::vector<double> cdf_;
+  std::vector<std::size_t> guide_;
+};
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -62,6 +62,20 @@ inline auto exp(const Eigen::MatrixBase<Derived>& x) {
   return x.derived().array().exp().matrix().eval();
 }
 
+/**
+ * Version of exp() that accepts Eigen Array or array expressions.
+ * @tparam Derived derived type of x
+ * @param x Array or array expression
+ * @return Elementwise application of exponentiation to the argument.
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto exp(const Derived& x) {
+  return x.exp().eval();
+}
+
 }  // namespace math
 }  // namespace stan
 
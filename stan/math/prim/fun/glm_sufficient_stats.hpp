@@ -0,0 +1,117 @@
+#ifndef STAN_MATH_PRIM_FUN_GLM_SUFFICIENT_STATS_HPP
+#define STAN_MATH_PRIM_FUN_GLM_SUFFICIENT_STATS_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Sufficient statistics of the data of a linear regression with
+ * constant intercept and scale.
+ *
+ * When the dependent variables <code>y</code> and the design matrix
+ * <code>x</code> are data, the log density of a Gaussian linear regression
+ * depends on them only through the quantities stored here:
+ *
+ * ~~~
+ * N, x' * x, x' * y, y' * y, x' * 1 and y' * 1
+ * ~~~
+ *
+ * Computing them takes O(N K^2) operations, but it is done once per data
+ * set. Afterwards each evaluation of
+ * <code>normal_id_glm_lpdf(stats, alpha, beta, sigma)</code> and its
+ * gradient takes O(K^2) operations regardless of the number of instances.
+ *
+ * Typical usage is to construct the object once, e.g. in transformed
+ * data, and pass it to every log density evaluation:
+ *
+ * ~~~
+ * glm_sufficient_stats stats(y, x);
+ * ...
+ * lp += normal_id_glm_lpdf(stats, alpha, beta, sigma);
+ * ~~~
+ */
+class glm_sufficient_stats {
+ public:
+  /**
+   * Construct the sufficient statistics of the given data.
+   *
+   * @tparam T_y type of the vector of dependent variables
+   * @tparam T_x type of the design matrix
+   * @param y vector of dependent variables
+   * @param x design matrix, with one row per element of y
+   * @throw std::domain_error if y or x is not finite.
+   * @throw std::invalid_argument if the number of rows of x does not match
+   * the size of y.
+   */
+  template <typename T_y, typename T_x, require_eigen_t<T_x>* = nullptr,
+            require_all_arithmetic_t<scalar_type_t<T_y>,
+                                     scalar_type_t<T_x>>* = nullptr>
+  glm_sufficient_stats(const T_y& y, const T_x& x) {
+    static const char* function = "glm_sufficient_stats";
+    check_consistent_size(function, "Vector of dependent variables", y,
+                          x.rows());
+    check_finite(function, "Vector of dependent variables", y);
+    check_finite(function, "Matrix of independent variables", x);
+    const Eigen::VectorXd y_val = as_column_vector_or_scalar(y);
+    const Eigen::MatrixXd x_val = x;
+    N_ = x_val.rows();
+    xtx_ = Eigen::MatrixXd::Zero(x_val.cols(), x_val.cols());
+    xtx_.selfadjointView<Eigen::Lower>().rankUpdate(x_val.transpose());
+    xtx_.triangularView<Eigen::StrictlyUpper>() = xtx_.transpose();
+    xty_ = x_val.transpose() * y_val;
+    x_sum_ = x_val.colwise().sum().transpose();
+    yty_ = y_val.squaredNorm();
+    y_sum_ = y_val.sum();
+  }
+
+  /**
+   * Return the number of instances.
+   */
+  inline size_t instances() const { return N_; }
+
+  /**
+   * Return the number of attributes, i.e. columns of the design matrix.
+   */
+  inline size_t attributes() const { return xty_.size(); }
+
+  /**
+   * Return x' * x.
+   */
+  inline const Eigen::MatrixXd& xtx() const { return xtx_; }
+
+  /**
+   * Return x' * y.
+   */
+  inline const Eigen::VectorXd& xty() const { return xty_; }
+
+  /**
+   * Return the column sums of x.
+   */
+  inline const Eigen::VectorXd& x_sum() const { return x_sum_; }
+
+  /**
+   * Return y' * y.
+   */
+  inline double yty() const { return yty_; }
+
+  /**
+   * Return the sum of y.
+   */
+  inline double y_sum() const { return y_sum_; }
+
+ private:
+  size_t N_;
+  Eigen::MatrixXd xtx_;
+  Eigen::VectorXd xty_;
+  Eigen::VectorXd x_sum_;
+  double yty_;
+  double y_sum_;
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -2,10 +2,13 @@
 #define STAN_MATH_PRIM_FUN_GRAD_REG_INC_BETA_HPP
 
 #include <stan/math/prim/meta.hpp>
-#include <stan/math/prim/fun/grad_inc_beta.hpp>
 #include <stan/math/prim/fun/inc_beta.hpp>
-#include <stan/math/prim/fun/beta.hpp>
+#include <stan/math/prim/fun/inc_beta_cf_grad.hpp>
+#include <stan/math/prim/fun/inv.hpp>
+#include <stan/math/prim/fun/is_any_nan.hpp>
+#include <stan/math/prim/fun/log1m.hpp>
 #include <cmath>
+#include <limits>
 
 namespace stan {
 namespace math {
@@ -16,6 +19,10 @@ namespace math {
  * <code>ibeta(a, b, z)</code>, with respect to the arguments
  * <code>a</code> and <code>b</code>.
  *
+ * Both gradients are computed from a single evaluation of the
+ * continued fraction of the incomplete beta function and its
+ * derivatives, see internal::inc_beta_cf_grad().
+ *
  * @tparam T type of arguments
  * @param[out] g1 partial derivative of <code>ibeta(a, b, z)</code>
  * with respect to <code>a</code>
@@ -27,19 +34,41 @@ namespace math {
  * @param[in] digammaA the value of <code>digamma(a)</code>
  * @param[in] digammaB the value of <code>digamma(b)</code>
  * @param[in] digammaSum the value of <code>digamma(a + b)</code>
- * @param[in] betaAB the value of <code>beta(a, b)</code>
+ * @param[in] betaAB the value of <code>beta(a, b)</code>, which is not
+ * needed by the continued fraction
  */
 template <typename T>
 void grad_reg_inc_beta(T& g1, T& g2, const T& a, const T& b, const T& z,
                        const T& digammaA, const T& digammaB,
                        const T& digammaSum, const T& betaAB) {
-  using std::exp;
-  T dBda = 0;
-  T dBdb = 0;
-  grad_inc_beta(dBda, dBdb, a, b, z);
-  T b1 = beta(a, b) * inc_beta(a, b, z);
-  g1 = (dBda - b1 * (digammaA - digammaSum)) / betaAB;
-  g2 = (dBdb - b1 * (digammaB - digammaSum)) / betaAB;
+  using std::log;
+
+  if (is_any_nan(a, b, z)) {
+    g1 = std::numeric_limits<double>::quiet_NaN();
+    g2 = std::numeric_limits<double>::quiet_NaN();
+    return;
+  }
+  if (z == 0 || z == 1) {
+    g1 = 0;
+    g2 = 0;
+    return;
+  }
+
+  T F;
+  T dF_da;
+  T dF_db;
+  if (z * (a + b + 2) < a + 1) {
+    internal::inc_beta_cf_grad(a, b, z, F, dF_da, dF_db);
+    const T I = inc_beta(a, b, z);
+    g1 = I * (log(z) - inv(a) - digammaA + digammaSum + dF_da / F);
+    g2 = I * (log1m(z) - digammaB + digammaSum + dF_db / F);
+    return;
+  }
+  const T one_minus_z = 1 - z;
+  internal::inc_beta_cf_grad(b, a, one_minus_z, F, dF_db, dF_da);
+  const T J = inc_beta(b, a, one_minus_z);
+  g1 = -J * (log(z) - digammaA + digammaSum + dF_da / F);
+  g2 = -J * (log1m(z) - inv(b) - digammaB + digammaSum + dF_db / F);
 }
 
 }  // namespace math
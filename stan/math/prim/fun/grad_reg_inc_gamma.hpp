@@ -4,24 +4,195 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
-#include <stan/math/prim/fun/gamma_p.hpp>
-#include <stan/math/prim/fun/gamma_q.hpp>
 #include <stan/math/prim/fun/is_any_nan.hpp>
 #include <stan/math/prim/fun/is_inf.hpp>
-#include <stan/math/prim/fun/is_nan.hpp>
-#include <stan/math/prim/fun/multiply_log.hpp>
+#include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Returns the derivative of the lower regularized incomplete gamma
+ * function P(a, z) with respect to a, computed from the series
+ *
+   \f[
+   P(a, z) = \frac{z^a e^{-z}}{\Gamma(a + 1)} \sum_{n=0}^\infty t_n, \qquad
+   t_n = \prod_{j=1}^n \frac{z}{a + j},
+   \f]
+ *
+ * which gives
+ *
+   \f[
+   \frac{\partial}{\partial a} P(a, z) = \frac{z^a e^{-z}}{\Gamma(a + 1)}
+   \sum_{n=0}^\infty t_n \left(\log z - \psi(a + n + 1)\right).
+   \f]
+ *
+ * All terms of the series have the same sign once
+ * <code>a + n + 1 > z</code> and both \f$t_n\f$ and \f$\psi(a + n +
+ * 1)\f$ are updated by a recurrence, so each term costs a division and
+ * no special function evaluations. The series converges quickly for
+ * <code>z < a + 1</code>.
+ *
+ * @tparam T1 type of the shape parameter
+ * @tparam T2 type of the location parameter
+ * @param a shape parameter, a > 0
+ * @param z location, z > 0
+ * @param log_z value of log(z)
+ * @param lgamma_a_plus_1 value of lgamma(a + 1)
+ * @param digamma_a_plus_1 value of digamma(a + 1)
+ * @param precision relative precision at which the series is truncated
+ * @param max_steps maximum number of terms
+ * @return derivative of P(a, z) with respect to a
+ * @throw std::domain_error if the series did not converge within
+ * max_steps terms
+ */
+template <typename T1, typename T2>
+return_type_t<T1, T2> grad_reg_lower_inc_gamma_series(
+    const T1& a, const T2& z, const T2& log_z, const T1& lgamma_a_plus_1,
+    const T1& digamma_a_plus_1, double precision, int max_steps) {
+  using std::exp;
+  using TP = return_type_t<T1, T2>;
+
+  // The truncation error is relative to the sum of the t_n, while the
+  // derivative can suffer cancellation, so never truncate early.
+  precision = std::min(precision, 1e-14);
+  TP term = 1.0;
+  TP sum_terms = 1.0;
+  T1 digamma_a_plus_n_plus_1 = digamma_a_plus_1;
+  TP S = log_z - digamma_a_plus_1;
+  for (int n = 1; n <= max_steps; ++n) {
+    const T1 a_plus_n = a + n;
+    term *= z / a_plus_n;
+    digamma_a_plus_n_plus_1 += 1.0 / a_plus_n;
+    sum_terms += term;
+    S += term * (log_z - digamma_a_plus_n_plus_1);
+    // The terms decrease at least geometrically with this ratio once it
+    // is below one, which bounds the remainder of the series.
+    const double ratio = value_of_rec(z) / (value_of_rec(a_plus_n) + 1);
+    if (ratio < 1
+        && value_of_rec(term) * ratio
+               <= precision * (1 - ratio) * value_of_rec(sum_terms)) {
+      return exp(a * log_z - z - lgamma_a_plus_1) * S;
+    }
+  }
+  throw_domain_error("grad_reg_lower_inc_gamma", "k (internal counter)",
+                     max_steps, "exceeded ",
+                     " iterations, gamma function gradient did not converge.");
+  return INFTY;
+}
+
+/**
+ * Returns the derivative of the upper regularized incomplete gamma
+ * function Q(a, z) with respect to a, computed from Legendre's continued
+ * fraction
+ *
+   \f[
+   Q(a, z) = \frac{z^a e^{-z}}{\Gamma(a)} \, F(a, z), \qquad
+   F(a, z) = \cfrac{1}{z + 1 - a - \cfrac{1 \cdot (1 - a)}{z + 3 - a -
+   \cfrac{2 \cdot (2 - a)}{z + 5 - a - \cdots}}},
+   \f]
+ *
+ * (http://dlmf.nist.gov/8.9#E2) which gives
+ *
+   \f[
+   \frac{\partial}{\partial a} Q(a, z) = \frac{z^a e^{-z}}{\Gamma(a)}
+   \left(F(a, z) (\log z - \psi(a))
+         + \frac{\partial}{\partial a} F(a, z)\right).
+   \f]
+ *
+ * The convergents of F and their derivatives with respect to a are
+ * computed together by the forward recurrence, which is rescaled at each
+ * step. The continued fraction converges quickly for
+ * <code>z >= a + 1</code>.
+ *
+ * @tparam T1 type of the shape parameter
+ * @tparam T2 type of the location parameter
+ * @param a shape parameter, a > 0
+ * @param z location, z > 0
+ * @param log_z value of log(z)
+ * @param lgamma_a value of lgamma(a)
+ * @param digamma_a value of digamma(a)
+ * @param precision relative precision at which the continued fraction
+ * is truncated
+ * @param max_steps maximum number of convergents
+ * @return derivative of Q(a, z) with respect to a
+ * @throw std::domain_error if the continued fraction did not converge
+ * within max_steps convergents
+ */
+template <typename T1, typename T2>
+return_type_t<T1, T2> grad_reg_inc_gamma_cf(const T1& a, const T2& z,
+                                            const T2& log_z,
+                                            const T1& lgamma_a,
+                                            const T1& digamma_a,
+                                            double precision, int max_steps) {
+  using std::exp;
+  using std::fabs;
+  using TP = return_type_t<T1, T2>;
+
+  // Each convergent is cheap, so converge to near machine precision even
+  // if the caller asked for less.
+  precision = std::min(precision, 1e-14);
+  // Numerators and denominators of the last two convergents and their
+  // derivatives with respect to a, scaled so that the last denominator
+  // is one.
+  TP A_prev = 1.0;
+  TP A = 0.0;
+  TP B_prev = 0.0;
+  TP dA_prev = 0.0;
+  TP dA = 0.0;
+  TP dB_prev = 0.0;
+  TP dB = 0.0;
+  TP F = 0.0;
+  TP dF = 0.0;
+  for (int n = 1; n <= max_steps; ++n) {
+    const TP b_n = z + (2 * n - 1) - a;
+    const T1 a_n = n == 1 ? T1(1.0) : T1(-(n - 1) * ((n - 1) - a));
+    const double da_n = n - 1;
+    const TP A_next = b_n * A + a_n * A_prev;
+    const TP B_next = b_n + a_n * B_prev;
+    const TP dA_next = b_n * dA - A + a_n * dA_prev + da_n * A_prev;
+    const TP dB_next = b_n * dB - 1.0 + a_n * dB_prev + da_n * B_prev;
+    const TP scale = 1.0 / B_next;
+    A_prev = A * scale;
+    B_prev = scale;
+    dA_prev = dA * scale;
+    dB_prev = dB * scale;
+    A = A_next * scale;
+    dA = dA_next * scale;
+    dB = dB_next * scale;
+    const TP F_next = A;
+    const TP dF_next = dA - A * dB;
+    if (n > 1 && fabs(F_next - F) <= precision * fabs(F_next)
+        && fabs(dF_next - dF) <= precision * (fabs(dF_next) + fabs(F_next))) {
+      return exp(a * log_z - z - lgamma_a)
+             * (F_next * (log_z - digamma_a) + dF_next);
+    }
+    F = F_next;
+    dF = dF_next;
+  }
+  throw_domain_error("grad_reg_inc_gamma", "k (internal counter)", max_steps,
+                     "exceeded ",
+                     " iterations, gamma function gradient did not converge.");
+  return INFTY;
+}
+
+}  // namespace internal
+
 /**
  * Gradient of the regularized incomplete gamma functions igamma(a, z)
  *
- * For small z, the gradient is computed via the series expansion;
- * for large z, the series is numerically inaccurate due to cancellation
- * and the asymptotic expansion is used.
+ * For z < a + 1, the gradient is computed from the series for the lower
+ * regularized incomplete gamma function, all of whose terms have the
+ * same sign for large n; otherwise it is computed from the continued
+ * fraction for the upper one. Both converge in a number of steps that
+ * grows with the square root of a in the worst case, z close to a, and
+ * each step only takes a few arithmetic operations.
  *
  * @tparam T1 type of the shape parameter
  * @tparam T2 type of the location parameter
@@ -29,87 +200,37 @@ namespace math {
  * @param z location z >= 0
  * @param g stan::math::tgamma(a) (precomputed value)
  * @param dig boost::math::digamma(a) (precomputed value)
- * @param precision required precision; applies to series expansion only
+ * @param precision required relative precision
  * @param max_steps number of steps to take.
  * @throw throws std::domain_error if not converged after max_steps
- *   or increment overflows to inf.
  *
- * For the asymptotic expansion, the gradient is given by:
-   \f[
-   \begin{array}{rcl}
-   \Gamma(a, z) & = & z^{a-1}e^{-z} \sum_{k=0}^N \frac{(a-1)_k}{z^k} \qquad , z
- \gg a\\
-   Q(a, z) & = & \frac{z^{a-1}e^{-z}}{\Gamma(a)} \sum_{k=0}^N
- \frac{(a-1)_k}{z^k}\\
-   (a)_k & = & (a)_{k-1}(a-k)\\
-   \frac{d}{da} (a)_k & = & (a)_{k-1} + (a-k)\frac{d}{da} (a)_{k-1}\\
-   \frac{d}{da}Q(a, z) & = & (log(z) - \psi(a)) Q(a, z)\\
-   && + \frac{z^{a-1}e^{-z}}{\Gamma(a)} \sum_{k=0}^N \left(\frac{d}{da}
- (a-1)_k\right) \frac{1}{z^k} \end{array} \f]
+ * The series and continued fraction are described in
+ * internal::grad_reg_lower_inc_gamma_series() and
+ * internal::grad_reg_inc_gamma_cf().
  */
 template <typename T1, typename T2>
 return_type_t<T1, T2> grad_reg_inc_gamma(T1 a, T2 z, T1 g, T1 dig,
-                                         double precision = 1e-6,
+                                         double precision = 1e-10,
                                          int max_steps = 1e5) {
-  using std::exp;
-  using std::fabs;
   using std::log;
   using TP = return_type_t<T1, T2>;
 
   if (is_any_nan(a, z, g, dig)) {
     return std::numeric_limits<TP>::quiet_NaN();
   }
+  if (z == 0) {
+    return 0.0;
+  }
 
-  T2 l = log(z);
-  if (z >= a && z >= 8) {
-    // asymptotic expansion http://dlmf.nist.gov/8.11#E2
-    TP S = 0;
-    T1 a_minus_one_minus_k = a - 1;
-    T1 fac = a_minus_one_minus_k;  // falling_factorial(a-1, k)
-    T1 dfac = 1;                   // d/da[falling_factorial(a-1, k)]
-    T2 zpow = z;                   // z ** k
-    TP delta = dfac / zpow;
-
-    for (int k = 1; k < 10; ++k) {
-      a_minus_one_minus_k -= 1;
-
-      S += delta;
-
-      zpow *= z;
-      dfac = a_minus_one_minus_k * dfac + fac;
-      fac *= a_minus_one_minus_k;
-      delta = dfac / zpow;
-
-      if (is_inf(delta)) {
-        throw_domain_error("grad_reg_inc_gamma", "is not converging", "", "");
-      }
-    }
-
-    return gamma_q(a, z) * (l - dig) + exp(-z + (a - 1) * l) * S / g;
-  } else {
-    // gradient of series expansion http://dlmf.nist.gov/8.7#E3
-    TP S = 0;
-    TP log_s = 0.0;
-    double s_sign = 1.0;
-    T2 log_z = log(z);
-    TP log_delta = log_s - multiply_log(2, a);
-    for (int k = 1; k <= max_steps; ++k) {
-      S += s_sign >= 0.0 ? exp(log_delta) : -exp(log_delta);
-      log_s += log_z - log(k);
-      s_sign = -s_sign;
-      log_delta = log_s - multiply_log(2, k + a);
-      if (is_inf(log_delta)) {
-        throw_domain_error("grad_reg_inc_gamma", "is not converging", "", "");
-      }
-      if (log_delta <= log(precision)) {
-        return gamma_p(a, z) * (dig - l) + exp(a * l) * S / g;
-      }
-    }
-    throw_domain_error(
-        "grad_reg_inc_gamma", "k (internal counter)", max_steps, "exceeded ",
-        " iterations, gamma function gradient did not converge.");
-    return INFTY;
+  const T2 log_z = log(z);
+  const T1 lgamma_a = is_inf(value_of_rec(g)) ? lgamma(a) : T1(log(g));
+  if (z < a + 1) {
+    return -internal::grad_reg_lower_inc_gamma_series(
+        a, z, log_z, T1(lgamma_a + log(a)), T1(dig + 1.0 / a), precision,
+        max_steps);
   }
+  return internal::grad_reg_inc_gamma_cf(a, z, log_z, lgamma_a, dig,
+                                         precision, max_steps);
 }
 
 }  // namespace math
@@ -0,0 +1,174 @@
+#ifndef STAN_MATH_PRIM_FUN_INC_BETA_CF_GRAD_HPP
+#define STAN_MATH_PRIM_FUN_INC_BETA_CF_GRAD_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <cmath>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Runs the recurrence of inc_beta_cf_grad() for at most max_steps
+ * convergents, or for exactly max_steps convergents if
+ * test_convergence is false, and returns the number of convergents.
+ *
+ * @tparam T type of the arguments
+ * @throw std::domain_error if test_convergence is true and the
+ * continued fraction did not converge within max_steps convergents
+ */
+template <typename T>
+int inc_beta_cf_grad_steps(const T& p, const T& q, const T& x, T& F,
+                           T& dF_dp, T& dF_dq, double precision,
+                           int max_steps, bool test_convergence) {
+  using std::fabs;
+
+  // Numerators and denominators of the last two convergents and their
+  // derivatives, scaled so that the last denominator is one.
+  T A_prev = 0.0;
+  T A = 1.0;
+  T B_prev = 1.0;
+  T dA_dp_prev = 0.0;
+  T dA_dp = 0.0;
+  T dB_dp_prev = 0.0;
+  T dB_dp = 0.0;
+  T dA_dq_prev = 0.0;
+  T dA_dq = 0.0;
+  T dB_dq_prev = 0.0;
+  T dB_dq = 0.0;
+  F = 1.0;
+  dF_dp = 0.0;
+  dF_dq = 0.0;
+  for (int n = 1; n <= max_steps; ++n) {
+    const int m = n / 2;
+    T d;
+    T dd_dp;
+    T dd_dq;
+    if (n % 2 == 1) {
+      const T denom = (p + 2 * m) * (p + 2 * m + 1);
+      d = -(p + m) * (p + q + m) * x / denom;
+      dd_dp = d
+              * (1.0 / (p + m) + 1.0 / (p + q + m) - 1.0 / (p + 2 * m)
+                 - 1.0 / (p + 2 * m + 1));
+      dd_dq = -(p + m) * x / denom;
+    } else {
+      const T denom = (p + 2 * m - 1) * (p + 2 * m);
+      d = m * (q - m) * x / denom;
+      dd_dp = -d * (1.0 / (p + 2 * m - 1) + 1.0 / (p + 2 * m));
+      dd_dq = m * x / denom;
+    }
+    const T A_next = A + d * A_prev;
+    const T B_next = 1.0 + d * B_prev;
+    const T dA_dp_next = dA_dp + d * dA_dp_prev + dd_dp * A_prev;
+    const T dB_dp_next = dB_dp + d * dB_dp_prev + dd_dp * B_prev;
+    const T dA_dq_next = dA_dq + d * dA_dq_prev + dd_dq * A_prev;
+    const T dB_dq_next = dB_dq + d * dB_dq_prev + dd_dq * B_prev;
+    const T scale = 1.0 / B_next;
+    A_prev = A * scale;
+    B_prev = scale;
+    dA_dp_prev = dA_dp * scale;
+    dB_dp_prev = dB_dp * scale;
+    dA_dq_prev = dA_dq * scale;
+    dB_dq_prev = dB_dq * scale;
+    A = A_next * scale;
+    dA_dp = dA_dp_next * scale;
+    dB_dp = dB_dp_next * scale;
+    dA_dq = dA_dq_next * scale;
+    dB_dq = dB_dq_next * scale;
+
+    const T F_next = A;
+    const T dF_dp_next = dA_dp - A * dB_dp;
+    const T dF_dq_next = dA_dq - A * dB_dq;
+    const bool converged
+        = test_convergence
+          && fabs(value_of_rec(F_next - F)) <= precision * fabs(value_of_rec(A))
+          && fabs(value_of_rec(dF_dp_next - dF_dp))
+                 <= precision * fabs(value_of_rec(dF_dp_next))
+          && fabs(value_of_rec(dF_dq_next - dF_dq))
+                 <= precision * fabs(value_of_rec(dF_dq_next));
+    F = F_next;
+    dF_dp = dF_dp_next;
+    dF_dq = dF_dq_next;
+    if (converged) {
+      return n;
+    }
+  }
+  if (!test_convergence) {
+    return max_steps;
+  }
+  throw_domain_error("inc_beta_cf_grad", "did not converge within", max_steps,
+                     "", " iterations");
+  return max_steps;
+}
+
+/**
+ * Computes the continued fraction of the regularized incomplete beta
+ * function and its partial derivatives with respect to both shape
+ * parameters. The regularized incomplete beta function is
+ *
+   \f[
+   I_x(p, q) = \frac{x^p (1 - x)^q}{p B(p, q)} \, F(p, q, x), \qquad
+   F(p, q, x) = \cfrac{1}{1 + \cfrac{d_1}{1 + \cfrac{d_2}{1 + \cdots}}}
+   \f]
+ *
+ * with
+ *
+   \f[
+   d_{2m+1} = -\frac{(p + m)(p + q + m) x}{(p + 2m)(p + 2m + 1)}, \qquad
+   d_{2m} = \frac{m (q - m) x}{(p + 2m - 1)(p + 2m)}
+   \f]
+ *
+ * (http://dlmf.nist.gov/8.17#E22). The continued fraction converges
+ * quickly for <code>x < (p + 1) / (p + q + 2)</code>; the symmetry
+ * \f$I_x(p, q) = 1 - I_{1-x}(q, p)\f$ covers the other values of x.
+ *
+ * The convergents and their derivatives with respect to p and q are
+ * computed together by the forward recurrence, which is rescaled at each
+ * step, as suggested by Boik and Robison-Cox (1998), Derivatives of the
+ * incomplete beta function, Journal of Statistical Software 3(1).
+ *
+ * For autodiff types the number of convergents is first found on the
+ * values of the arguments, so the recurrence on the autodiff types
+ * runs only as many steps as it needs to converge.
+ *
+ * @tparam T type of the arguments
+ * @param[in] p first shape parameter, p > 0
+ * @param[in] q second shape parameter, q > 0
+ * @param[in] x upper bound of the integral, 0 < x < 1
+ * @param[out] F value of the continued fraction
+ * @param[out] dF_dp partial derivative of the continued fraction with
+ * respect to p
+ * @param[out] dF_dq partial derivative of the continued fraction with
+ * respect to q
+ * @param[in] precision relative precision at which the continued
+ * fraction is truncated
+ * @param[in] max_steps maximum number of convergents
+ * @throw std::domain_error if the continued fraction did not converge
+ * within max_steps convergents
+ */
+template <typename T>
+void inc_beta_cf_grad(const T& p, const T& q, const T& x, T& F, T& dF_dp,
+                      T& dF_dq, double precision = 1e-14,
+                      int max_steps = 1e5) {
+  if (std::is_arithmetic<T>::value) {
+    inc_beta_cf_grad_steps(p, q, x, F, dF_dp, dF_dq, precision, max_steps,
+                           true);
+    return;
+  }
+  double F_dbl;
+  double dF_dp_dbl;
+  double dF_dq_dbl;
+  const int num_steps = inc_beta_cf_grad_steps(
+      value_of_rec(p), value_of_rec(q), value_of_rec(x), F_dbl, dF_dp_dbl,
+      dF_dq_dbl, precision, max_steps, true);
+  inc_beta_cf_grad_steps(p, q, x, F, dF_dp, dF_dq, precision, num_steps,
+                         false);
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -2,7 +2,9 @@
 #define STAN_MATH_PRIM_FUN_INV_LOGIT_HPP
 
 #include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/batch_kernels.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <cmath>
 
 namespace stan {
@@ -78,11 +80,68 @@ struct inv_logit_fun {
  * @param x container
  * @return Inverse logit applied to each value in x.
  */
-template <typename T>
+template <typename T, require_not_eigen_vt<std::is_arithmetic, T>* = nullptr>
 inline auto inv_logit(const T& x) {
   return apply_scalar_unary<inv_logit_fun, T>::apply(x);
 }
 
+namespace internal {
+
+/**
+ * Return the inverse logit function applied to the specified argument,
+ * which must not be less than -700 or NaN.
+ *
+ * This is a batch kernel for <code>apply_batch_unary()</code>. As in the
+ * scalar function, the exponential of a negative number is used for
+ * either sign of the argument, so that the result neither overflows nor
+ * loses its relative accuracy in the lower tail.
+ *
+ * @param x argument
+ * @return inverse logit of x
+ */
+STAN_MATH_BATCH_INLINE double inv_logit_batch(double x) {
+  const double exp_neg_abs_x = batch_exp(-batch_abs(x));
+  const double inv_1p_exp = 1.0 / (1.0 + exp_neg_abs_x);
+  return batch_if_less(x, 0.0, exp_neg_abs_x * inv_1p_exp, inv_1p_exp);
+}
+
+}  // namespace internal
+
+/**
+ * Version of inv_logit() that accepts Eigen arrays or array expressions
+ * of arithmetic scalars. The values for arguments not less than -700 are
+ * computed by a batch kernel, which the compiler can vectorize, and the
+ * other values by the scalar function.
+ *
+ * @tparam Derived derived type of x
+ * @param x array or array expression
+ * @return Inverse logit applied to each value in x.
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto inv_logit(const Derived& x) {
+  return apply_batch_unary(
+      x, [](double x) { return internal::inv_logit_batch(x); },
+      [](double x) { return x >= -700.0; },
+      [](double x) { return inv_logit(x); });
+}
+
+/**
+ * Version of inv_logit() that accepts Eigen matrices or matrix
+ * expressions of arithmetic scalars.
+ *
+ * @tparam Derived derived type of x
+ * @param x matrix or matrix expression
+ * @return Inverse logit applied to each value in x.
+ */
+template <typename Derived,
+          require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto inv_logit(const Eigen::MatrixBase<Derived>& x) {
+  return inv_logit(x.derived().array()).matrix().eval();
+}
+
 // TODO(Tadej): Eigen is introducing their implementation logistic() of this
 // in 3.4. Use that once we switch to Eigen 3.4
 
@@ -29,6 +29,8 @@
 #include <limits>
 #endif
 #include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/batch_kernels.hpp>
+#include <stan/math/prim/fun/constants.hpp>
 
 namespace stan {
 namespace math {
@@ -104,6 +106,43 @@ struct lgamma_fun {
   }
 };
 
+namespace internal {
+
+/**
+ * Return the natural logarithm of the gamma function applied to the
+ * specified argument, which must be a finite double not less than 15,
+ * by the Stirling series.
+ *
+ * This is a batch kernel for <code>apply_batch_unary()</code>. The
+ * series is truncated after the term in <code>x^-13</code>, which is
+ * below the rounding error of the result for these arguments.
+ *
+ * @param x argument
+ * @param log_x natural logarithm of x
+ * @return natural logarithm of the gamma function applied to x
+ */
+STAN_MATH_BATCH_INLINE double lgamma_stirling_batch(double x, double log_x) {
+  const double inv_x = 1.0 / x;
+  const double inv_x_sq = inv_x * inv_x;
+  const double stirling_series
+      = inv_x
+        * (1.0 / 12
+           + inv_x_sq
+                 * (-1.0 / 360
+                    + inv_x_sq
+                          * (1.0 / 1260
+                             + inv_x_sq
+                                   * (-1.0 / 1680
+                                      + inv_x_sq
+                                            * (1.0 / 1188
+                                               + inv_x_sq
+                                                     * (-691.0 / 360360
+                                                        + inv_x_sq / 156))))));
+  return (x - 0.5) * log_x - x + HALF_LOG_TWO_PI + stirling_series;
+}
+
+}  // namespace internal
+
 /**
  * Vectorized version of lgamma().
  *
@@ -113,11 +152,49 @@ struct lgamma_fun {
  *         applied to each value in x.
  * @throw std::domain_error if any value is a negative integer or 0.
  */
-template <typename T>
+template <typename T, require_not_eigen_vt<std::is_arithmetic, T>* = nullptr>
 inline auto lgamma(const T& x) {
   return apply_scalar_unary<lgamma_fun, T>::apply(x);
 }
 
+/**
+ * Version of lgamma() that accepts Eigen arrays or array expressions of
+ * arithmetic scalars. The values for finite arguments of at least 15 are
+ * computed by a batch kernel, which the compiler can vectorize, and the
+ * other values by the scalar function.
+ *
+ * @tparam Derived derived type of x
+ * @param x array or array expression
+ * @return Natural log of the gamma function applied to each value in x.
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto lgamma(const Derived& x) {
+  return apply_batch_unary(
+      x,
+      [](double x) {
+        return internal::lgamma_stirling_batch(x, internal::batch_log(x));
+      },
+      [](double x) { return (x >= 15.0) & (x < INFTY); },
+      [](double x) { return lgamma(x); });
+}
+
+/**
+ * Version of lgamma() that accepts Eigen matrices or matrix expressions
+ * of arithmetic scalars.
+ *
+ * @tparam Derived derived type of x
+ * @param x matrix or matrix expression
+ * @return Natural log of the gamma function applied to each value in x.
+ */
+template <typename Derived,
+          require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto lgamma(const Eigen::MatrixBase<Derived>& x) {
+  return lgamma(x.derived().array()).matrix().eval();
+}
+
 }  // namespace math
 }  // namespace stan
 
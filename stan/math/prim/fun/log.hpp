@@ -63,6 +63,21 @@ inline auto log(const Eigen::MatrixBase<Derived>& x) {
   return x.derived().array().log().matrix().eval();
 }
 
+/**
+ * Version of log() that accepts Eigen Array or array expressions.
+ *
+ * @tparam Derived derived type of x
+ * @param x Array or array expression
+ * @return Elementwise application of natural log to the argument.
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto log(const Derived& x) {
+  return x.log().eval();
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
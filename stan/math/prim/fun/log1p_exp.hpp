@@ -2,6 +2,8 @@
 #define STAN_MATH_PRIM_FUN_LOG1P_EXP_HPP
 
 #include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/batch_kernels.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/log1p.hpp>
 #include <cmath>
 
@@ -69,11 +71,65 @@ struct log1p_exp_fun {
  * @param x container
  * @return Natural log of (1 + exp()) applied to each value in x.
  */
-template <typename T>
+template <typename T, require_not_eigen_vt<std::is_arithmetic, T>* = nullptr>
 inline auto log1p_exp(const T& x) {
   return apply_scalar_unary<log1p_exp_fun, T>::apply(x);
 }
 
+namespace internal {
+
+/**
+ * Return the natural logarithm of one plus the exponential of the
+ * specified argument, which must not be less than -700 or NaN.
+ *
+ * This is a batch kernel for <code>apply_batch_unary()</code>, with the
+ * same underflow-avoiding form as the scalar function.
+ *
+ * @param x argument
+ * @return natural logarithm of one plus the exponential of x
+ */
+STAN_MATH_BATCH_INLINE double log1p_exp_batch(double x) {
+  return batch_if_less(x, 0.0, 0.0, x)
+         + batch_log1p(batch_exp(-batch_abs(x)));
+}
+
+}  // namespace internal
+
+/**
+ * Version of log1p_exp() that accepts Eigen arrays or array expressions
+ * of arithmetic scalars. The values for arguments not less than -700 are
+ * computed by a batch kernel, which the compiler can vectorize, and the
+ * other values by the scalar function.
+ *
+ * @tparam Derived derived type of x
+ * @param x array or array expression
+ * @return Natural log of (1 + exp()) applied to each value in x.
+ */
+template <
+    typename Derived,
+    require_t<std::is_base_of<Eigen::ArrayBase<Derived>, Derived>>* = nullptr,
+    require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto log1p_exp(const Derived& x) {
+  return apply_batch_unary(
+      x, [](double x) { return internal::log1p_exp_batch(x); },
+      [](double x) { return x >= -700.0; },
+      [](double x) { return log1p_exp(x); });
+}
+
+/**
+ * Version of log1p_exp() that accepts Eigen matrices or matrix
+ * expressions of arithmetic scalars.
+ *
+ * @tparam Derived derived type of x
+ * @param x matrix or matrix expression
+ * @return Natural log of (1 + exp()) applied to each value in x.
+ */
+template <typename Derived,
+          require_eigen_vt<std::is_arithmetic, Derived>* = nullptr>
+inline auto log1p_exp(const Eigen::MatrixBase<Derived>& x) {
+  return log1p_exp(x.derived().array()).matrix().eval();
+}
+
 }  // namespace math
 }  // namespace stan
 
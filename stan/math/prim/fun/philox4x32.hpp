@@ -0,0 +1,253 @@
+#ifndef STAN_MATH_PRIM_FUN_PHILOX4X32_HPP
+#define STAN_MATH_PRIM_FUN_PHILOX4X32_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Returns the four 32 bit outputs of the Philox4x32-10 bijection for
+ * the specified counter and key, see Salmon, Moraes, Dror and Shaw
+ * (2011), Parallel random numbers: as easy as 1, 2, 3, Proceedings of
+ * the International Conference for High Performance Computing,
+ * Networking, Storage and Analysis.
+ *
+ * The function has no branches and no state, so loops over counters can
+ * be vectorized by the compiler.
+ *
+ * @param c0 lowest word of the counter
+ * @param c1 second word of the counter
+ * @param c2 third word of the counter
+ * @param c3 highest word of the counter
+ * @param k0 lower word of the key
+ * @param k1 upper word of the key
+ * @return four pseudo-random words
+ */
+inline std::array<std::uint32_t, 4> philox4x32_10(std::uint32_t c0,
+                                                  std::uint32_t c1,
+                                                  std::uint32_t c2,
+                                                  std::uint32_t c3,
+                                                  std::uint32_t k0,
+                                                  std::uint32_t k1) {
+  static const std::uint32_t M0 = 0xD2511F53;
+  static const std::uint32_t M1 = 0xCD9E8D57;
+  static const std::uint32_t W0 = 0x9E3779B9;
+  static const std::uint32_t W1 = 0xBB67AE85;
+  for (int round = 0; round < 10; ++round) {
+    const std::uint64_t p0 = static_cast<std::uint64_t>(M0) * c0;
+    const std::uint64_t p1 = static_cast<std::uint64_t>(M1) * c2;
+    const std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32);
+    const std::uint32_t lo0 = static_cast<std::uint32_t>(p0);
+    const std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32);
+    const std::uint32_t lo1 = static_cast<std::uint32_t>(p1);
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += W0;
+    k1 += W1;
+  }
+  return {c0, c1, c2, c3};
+}
+
+/**
+ * Returns a double in [0, 1) with 53 random bits taken from the two
+ * specified words.
+ *
+ * @param hi word providing the upper 27 bits
+ * @param lo word providing the lower 26 bits
+ * @return uniform variate in [0, 1)
+ */
+inline double philox_to_unit_interval(std::uint32_t hi, std::uint32_t lo) {
+  // the bits fit in a signed integer, whose conversion to double is a
+  // single instruction, unlike that of an unsigned one
+  const std::int64_t bits = (static_cast<std::int64_t>(hi >> 5) << 26)
+                            | static_cast<std::int64_t>(lo >> 6);
+  return static_cast<double>(bits) * (1.0 / 9007199254740992.0);
+}
+
+}  // namespace internal
+
+/**
+ * Counter-based pseudo-random number engine using the Philox4x32-10
+ * bijection.
+ *
+ * The engine is determined by a 64 bit key, built from a seed and a
+ * stream number, and a 128 bit counter. The lower half of the counter
+ * is the index of the current block of four outputs in the stream and
+ * the upper half is the substream number, which is zero for the engine
+ * constructed from a seed and stream. Engines with different seeds,
+ * streams or substreams produce independent sequences, so each thread
+ * or chain can use its own stream and draws do not depend on the order
+ * in which threads run.
+ *
+ * As any block of outputs can be computed directly from its index, the
+ * engine can skip ahead in constant time and the bulk generators, such
+ * as normal_bulk_rng(), fill vectors of draws by evaluating many blocks
+ * independently of each other.
+ *
+ * The engine satisfies the requirements of a uniform random bit
+ * generator, so it can be used with all of the <code>_rng</code>
+ * functions in place of <code>boost::ecuyer1988</code>.
+ */
+class philox4x32 {
+ public:
+  using result_type = std::uint32_t;
+
+  /**
+   * Construct an engine for the specified seed and stream, positioned
+   * at the start of substream zero.
+   *
+   * @param seed seed
+   * @param stream stream number, for example the thread or chain id
+   */
+  explicit philox4x32(std::uint32_t seed = 0, std::uint32_t stream = 0) {
+    this->seed(seed, stream);
+  }
+
+  /**
+   * Reset the engine to the start of substream zero of the specified
+   * seed and stream.
+   *
+   * @param seed seed
+   * @param stream stream number
+   */
+  void seed(std::uint32_t seed, std::uint32_t stream = 0) {
+    key_ = {seed, stream};
+    block_ = 0;
+    substream_ = 0;
+    buffer_ = {};
+    next_ = 4;
+  }
+
+  static constexpr result_type min() { return 0; }
+
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /**
+   * Return the next 32 bit output of the engine.
+   *
+   * @return pseudo-random word
+   */
+  result_type operator()() {
+    if (next_ == 4) {
+      buffer_ = block(block_++);
+      next_ = 0;
+    }
+    return buffer_[next_++];
+  }
+
+  /**
+   * Advance the engine by the specified number of outputs in constant
+   * time.
+   *
+   * @param z number of outputs to skip
+   */
+  void discard(unsigned long long z) {
+    const unsigned long long buffered = 4 - next_;
+    if (z <= buffered) {
+      next_ += z;
+      return;
+    }
+    z -= buffered;
+    block_ += z / 4;
+    next_ = 4;
+    if (z % 4 != 0) {
+      buffer_ = block(block_++);
+      next_ = z % 4;
+    }
+  }
+
+  /**
+   * Return the four outputs of the block with the specified index in the
+   * current substream without changing the state of the engine.
+   *
+   * @param index block index
+   * @return four pseudo-random words
+   */
+  std::array<std::uint32_t, 4> block(std::uint64_t index) const {
+    return internal::philox4x32_10(
+        static_cast<std::uint32_t>(index),
+        static_cast<std::uint32_t>(index >> 32),
+        static_cast<std::uint32_t>(substream_),
+        static_cast<std::uint32_t>(substream_ >> 32), key_[0], key_[1]);
+  }
+
+  /**
+   * Reserve the specified number of blocks of the current substream and
+   * return the index of the first one. The engine continues after the
+   * reserved blocks and any outputs left from the current block are
+   * dropped.
+   *
+   * @param n number of blocks
+   * @return index of the first reserved block
+   */
+  std::uint64_t reserve_blocks(std::uint64_t n) {
+    const std::uint64_t first = block_;
+    block_ += n;
+    next_ = 4;
+    return first;
+  }
+
+  /**
+   * Return an engine with the same key positioned at the start of the
+   * specified substream. Substreams of an engine that is itself in a
+   * nonzero substream are not independent of other substreams, so only
+   * take substreams of engines in substream zero.
+   *
+   * @param index substream number, nonzero
+   * @return engine for the substream
+   */
+  philox4x32 substream(std::uint64_t index) const {
+    philox4x32 sub(key_[0], key_[1]);
+    sub.substream_ = index;
+    return sub;
+  }
+
+  friend bool operator==(const philox4x32& x, const philox4x32& y) {
+    if (x.key_ != y.key_ || x.substream_ != y.substream_) {
+      return false;
+    }
+    // compare positions in outputs, as a fully used buffer is equivalent
+    // to an empty buffer for the next block
+    return 4 * x.block_ + x.next_ == 4 * y.block_ + y.next_;
+  }
+
+  friend bool operator!=(const philox4x32& x, const philox4x32& y) {
+    return !(x == y);
+  }
+
+ private:
+  std::array<std::uint32_t, 2> key_;
+  std::uint64_t block_;
+  std::uint64_t substream_;
+  std::array<std::uint32_t, 4> buffer_;
+  unsigned int next_;
+};
+
+namespace internal {
+
+/**
+ * Returns a uniform variate in [0, 1) with 53 random bits from the next
+ * two outputs of the generator.
+ *
+ * @param rng random number generator
+ * @return uniform variate in [0, 1)
+ */
+inline double philox_unit_interval(philox4x32& rng) {
+  const std::uint32_t hi = rng();
+  const std::uint32_t lo = rng();
+  return philox_to_unit_interval(hi, lo);
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -1,6 +1,7 @@
 #ifndef STAN_MATH_PRIM_FUNCTOR_HPP
 #define STAN_MATH_PRIM_FUNCTOR_HPP
 
+#include <stan/math/prim/functor/bulk_rng_draws.hpp>
 #include <stan/math/prim/functor/coupled_ode_observer.hpp>
 #include <stan/math/prim/functor/coupled_ode_system.hpp>
 #include <stan/math/prim/functor/finite_diff_gradient.hpp>
@@ -14,8 +15,13 @@
 #include <stan/math/prim/functor/map_rect_combine.hpp>
 #include <stan/math/prim/functor/map_rect_concurrent.hpp>
 #include <stan/math/prim/functor/map_rect_reduce.hpp>
+#include <stan/math/prim/functor/map_rect_sum.hpp>
 #include <stan/math/prim/functor/mpi_cluster.hpp>
 #include <stan/math/prim/functor/mpi_command.hpp>
 #include <stan/math/prim/functor/mpi_distributed_apply.hpp>
+#include <stan/math/prim/functor/ode_rhs_inplace.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
+#include <stan/math/prim/functor/reduce_sum.hpp>
+#include <stan/math/prim/functor/sparse_column_coloring.hpp>
 
 #endif
@@ -0,0 +1,104 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_BULK_RNG_DRAWS_HPP
+#define STAN_MATH_PRIM_FUNCTOR_BULK_RNG_DRAWS_HPP
+
+#include <stan/math/prim/fun/philox4x32.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Number of consecutive draws of a bulk random number generator that
+ * share a substream of the generator. This is a constant rather than a
+ * configurable value, as the draws depend on it.
+ */
+constexpr std::size_t BULK_RNG_SUBSTREAM_SIZE = 1024;
+
+/**
+ * Calls the functor for each of the draws 0, ..., N - 1 of a bulk random
+ * number generator as
+ *
+ * <code>f(n, substream)</code>
+ *
+ * where <code>substream</code> is a philox4x32 engine the functor draws
+ * from. Each run of BULK_RNG_SUBSTREAM_SIZE consecutive draws uses its
+ * own substream, numbered after a block reserved in the stream of the
+ * generator, and the generator is advanced past the reserved blocks.
+ *
+ * Runs of draws are evaluated in parallel chunks by
+ * <code>parallel_chunks()</code> if STAN_THREADS is defined and N is
+ * large, and in a plain loop otherwise. As the partition into
+ * substreams only depends on N, the draws are the same whether or not
+ * STAN_THREADS is defined and do not depend on the number of threads.
+ *
+ * @tparam F type of the functor
+ * @param N number of draws
+ * @param rng random number generator, in substream zero
+ * @param f functor
+ */
+template <typename F>
+inline void bulk_rng_draws(std::size_t N, philox4x32& rng, const F& f) {
+  const std::size_t num_substreams
+      = (N + BULK_RNG_SUBSTREAM_SIZE - 1) / BULK_RNG_SUBSTREAM_SIZE;
+  const std::uint64_t first_block = rng.reserve_blocks(num_substreams);
+  const std::size_t num_chunks
+      = std::min(num_substreams, num_parallel_chunks(N));
+  auto draw_substreams = [&](std::size_t, std::size_t start, std::size_t end) {
+    for (std::size_t s = start; s < end; ++s) {
+      philox4x32 substream = rng.substream(first_block + s + 1);
+      const std::size_t n_end = std::min(N, (s + 1) * BULK_RNG_SUBSTREAM_SIZE);
+      for (std::size_t n = s * BULK_RNG_SUBSTREAM_SIZE; n < n_end; ++n) {
+        f(n, substream);
+      }
+    }
+  };
+  if (num_chunks == 1) {
+    draw_substreams(0, 0, num_substreams);
+    return;
+  }
+  parallel_chunks(num_substreams, num_chunks, draw_substreams);
+}
+
+/**
+ * Calls the functor for each of the blocks first_block, ...,
+ * first_block + N - 1 of the generator, which the caller reserved, as
+ *
+ * <code>f(b, words)</code>
+ *
+ * where <code>b</code> is the offset of the block from first_block and
+ * <code>words</code> holds its four outputs. The blocks are evaluated
+ * in parallel chunks by <code>parallel_chunks()</code> if STAN_THREADS
+ * is defined and N is large, and in a plain loop otherwise. The words of
+ * each block only depend on its index, so the result does not depend on
+ * the number of threads.
+ *
+ * @tparam F type of the functor
+ * @param first_block index of the first block
+ * @param N number of blocks
+ * @param rng random number generator
+ * @param f functor
+ */
+template <typename F>
+inline void bulk_rng_blocks(std::uint64_t first_block, std::size_t N,
+                            const philox4x32& rng, const F& f) {
+  const std::size_t num_chunks = num_parallel_chunks(N);
+  auto draw_blocks = [&](std::size_t, std::size_t start, std::size_t end) {
+    for (std::size_t b = start; b < end; ++b) {
+      f(b, rng.block(first_block + b));
+    }
+  };
+  if (num_chunks == 1) {
+    draw_blocks(0, 0, N);
+    return;
+  }
+  parallel_chunks(N, num_chunks, draw_blocks);
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_PRIM_FUNCTOR_COUPLED_ODE_SYSTEM_HPP
 
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/functor/ode_rhs_inplace.hpp>
 #include <ostream>
 #include <vector>
 
@@ -36,6 +37,10 @@ struct coupled_ode_system {};
  * are no sensitivity parameters and the size of the coupled ode
  * system is the size of the base ode system.
  *
+ * If the functor provides the allocation free overload detected by
+ * <code>has_ode_rhs_inplace</code>, the derivatives are written
+ * directly into the output buffer of the solver.
+ *
  * @tparam F base ode system functor. Must provide
  *   <code>operator()(double t, std::vector<double> y,
  *   std::vector<double> theta, std::vector<double> x,
@@ -94,9 +99,9 @@ class coupled_ode_system<F, double, double> {
    */
   void operator()(const std::vector<double>& y, std::vector<double>& dy_dt,
                   double t) const {
-    dy_dt = f_(t, y, theta_dbl_, x_, x_int_, msgs_);
-    check_size_match("coupled_ode_system", "y", y.size(), "dy_dt",
-                     dy_dt.size());
+    dy_dt.resize(y.size());
+    ode_rhs_inplace("coupled_ode_system", f_, t, y.data(), y.size(),
+                    theta_dbl_, x_, x_int_, msgs_, dy_dt.data());
   }
 
   /**
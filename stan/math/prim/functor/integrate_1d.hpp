@@ -4,16 +4,170 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <boost/math/quadrature/exp_sinh.hpp>
 #include <boost/math/quadrature/sinh_sinh.hpp>
 #include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
 #include <functional>
+#include <type_traits>
 #include <ostream>
 #include <vector>
 
 namespace stan {
 namespace math {
+namespace internal {
+/**
+ * Value of a vector valued integrand. It provides the arithmetic the
+ * Boost double exponential quadratures need for their result type so
+ * that several integrals can be computed together on a shared set of
+ * nodes. The maximum norm, which unlike the Euclidean norm cannot
+ * overflow for finite components, takes the place of the absolute
+ * value, so that the error estimate and the norm of the integral, and
+ * with them the stopping criterion, refer to the whole vector.
+ *
+ * A value constructed from a scalar has size zero and is the zero
+ * vector of any size; Boost only uses this for zero initialization.
+ */
+class integrand_vector {
+ public:
+  Eigen::VectorXd v_;
+
+  integrand_vector(double zero = 0.0) {}  // NOLINT(runtime/explicit)
+
+  explicit integrand_vector(const Eigen::VectorXd& v) : v_(v) {}
+
+  integrand_vector& operator+=(const integrand_vector& y) {
+    if (v_.size() == 0) {
+      v_ = y.v_;
+    } else if (y.v_.size() != 0) {
+      v_ += y.v_;
+    }
+    return *this;
+  }
+
+  integrand_vector& operator-=(const integrand_vector& y) {
+    if (v_.size() == 0) {
+      v_ = -y.v_;
+    } else if (y.v_.size() != 0) {
+      v_ -= y.v_;
+    }
+    return *this;
+  }
+
+  integrand_vector& operator*=(double c) {
+    v_ *= c;
+    return *this;
+  }
+
+  integrand_vector operator-() const { return integrand_vector(-v_); }
+
+  friend integrand_vector operator+(integrand_vector x,
+                                    const integrand_vector& y) {
+    return x += y;
+  }
+
+  friend integrand_vector operator-(integrand_vector x,
+                                    const integrand_vector& y) {
+    return x -= y;
+  }
+
+  friend integrand_vector operator*(integrand_vector x, double c) {
+    return x *= c;
+  }
+
+  friend integrand_vector operator*(double c, integrand_vector x) {
+    return x *= c;
+  }
+
+  friend double abs(const integrand_vector& x) {
+    return x.v_.size() == 0 ? 0.0 : x.v_.lpNorm<Eigen::Infinity>();
+  }
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const integrand_vector& x) {
+    return os << x.v_.transpose();
+  }
+};
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+namespace boost {
+namespace math {
+/**
+ * The Boost quadratures check that the integral is finite.
+ */
+template <>
+inline bool(isfinite)(stan::math::internal::integrand_vector x) {
+  return x.v_.allFinite();
+}
+}  // namespace math
+}  // namespace boost
+
+namespace stan {
+namespace math {
+namespace internal {
+/**
+ * Return a copy of the integrator of type Integrator shared by all calls
+ * to integrate(). The Boost double exponential integrators precompute
+ * tables of abscissas and weights on construction and extend them
+ * lazily when more refinement levels are needed. Copies share these
+ * tables, so the shared instance spares every integration the table
+ * set up. Boost grows the tables thread safely, unless it has no
+ * atomics, in which case every thread gets its own instance.
+ *
+ * @tparam Integrator type of Boost integrator
+ * @return integrator sharing its tables with all other calls
+ */
+template <typename Integrator>
+inline Integrator shared_integrator() {
+#ifdef BOOST_MATH_NO_ATOMIC_INT
+  static thread_local const Integrator integrator;
+#else
+  static const Integrator integrator;
+#endif
+  return integrator;
+}
+
+/**
+ * Integrate f(x, xc) over the finite interval (a, b) with tanh-sinh
+ * quadrature. This is Boost's mapping of (a, b) onto (-1, 1), which
+ * is done here so that the result type of f is preserved.
+ *
+ * @tparam F type of f
+ * @param integrator tanh-sinh integrator
+ * @param f the function to be integrated
+ * @param a lower limit of integration
+ * @param b upper limit of integration
+ * @param relative_tolerance target relative tolerance
+ * @param[out] error error estimate
+ * @param[out] L1 estimate of the norm of the integral
+ * @param[out] levels number of refinement levels used
+ * @return numeric integral of function f
+ */
+template <typename F>
+inline auto integrate_tanh_sinh(
+    boost::math::quadrature::tanh_sinh<double>& integrator, const F& f,
+    double a, double b, double relative_tolerance, double* error, double* L1,
+    size_t* levels) {
+  using result_t = std::decay_t<decltype(f(0.0, 0.0))>;
+  auto u = [&](double z, double zc) -> result_t {
+    if (z < 0) {
+      return f((a - b) * zc / 2 + a, (b - a) * zc / 2);
+    } else {
+      return f((a - b) * zc / 2 + b, (b - a) * zc / 2);
+    }
+  };
+  double diff = (b - a) / 2;
+  result_t Q = diff * integrator.integrate(u, relative_tolerance, error, L1,
+                                           levels);
+  *L1 *= diff;
+  return Q;
+}
+}  // namespace internal
+
 /**
  * Integrate a single variable function f from a to b to within a specified
  * relative tolerance. This function assumes a is less than b.
@@ -21,7 +175,10 @@ namespace math {
  * The signature for f should be:
  *   double f(double x, double xc)
  *
- * It should return the value of the function evaluated at x.
+ * It should return the value of the function evaluated at x. Instead of
+ * double, f may return an <code>internal::integrand_vector</code> in
+ * which case all of its components are integrated together and the
+ * relative tolerance applies to the norm of the vector.
  *
  * Depending on whether or not a is finite or negative infinity and b is finite
  * or positive infinity, a different version of the 1d quadrature algorithm from
@@ -48,21 +205,24 @@ namespace math {
  * @return numeric integral of function f
  */
 template <typename F>
-inline double integrate(const F& f, double a, double b,
-                        double relative_tolerance) {
+inline auto integrate(const F& f, double a, double b,
+                      double relative_tolerance) {
+  using result_t = std::decay_t<decltype(f(0.0, 0.0))>;
   double error1 = 0.0;
   double error2 = 0.0;
   double L1 = 0.0;
   double L2 = 0.0;
   bool used_two_integrals = false;
   size_t levels;
-  double Q = 0.0;
+  result_t Q = 0.0;
   if (std::isinf(a) && std::isinf(b)) {
     auto f_wrap = [&](double x) { return f(x, NOT_A_NUMBER); };
-    boost::math::quadrature::sinh_sinh<double> integrator;
+    auto integrator = internal::shared_integrator<
+        boost::math::quadrature::sinh_sinh<double>>();
     Q = integrator.integrate(f_wrap, relative_tolerance, &error1, &L1, &levels);
   } else if (std::isinf(a)) {
-    boost::math::quadrature::exp_sinh<double> integrator;
+    auto integrator = internal::shared_integrator<
+        boost::math::quadrature::exp_sinh<double>>();
     /**
      * If the integral crosses zero, break it into two (advice from the Boost
      * implementation:
@@ -73,44 +233,54 @@ inline double integrate(const F& f, double a, double b,
       Q = integrator.integrate(f_wrap, relative_tolerance, &error1, &L1,
                                &levels);
     } else {
-      boost::math::quadrature::tanh_sinh<double> integrator_right;
+      auto integrator_right = internal::shared_integrator<
+          boost::math::quadrature::tanh_sinh<double>>();
       auto f_wrap = [&](double x) { return f(-x, NOT_A_NUMBER); };
+      auto f_wrap_right = [&](double x, double xc) { return f_wrap(x); };
       Q = integrator.integrate(f_wrap, relative_tolerance, &error1, &L1,
                                &levels)
-          + integrator_right.integrate(f_wrap, -b, 0, relative_tolerance,
-                                       &error2, &L2, &levels);
+          + internal::integrate_tanh_sinh(integrator_right, f_wrap_right, -b,
+                                          0, relative_tolerance, &error2, &L2,
+                                          &levels);
       used_two_integrals = true;
     }
   } else if (std::isinf(b)) {
-    boost::math::quadrature::exp_sinh<double> integrator;
+    auto integrator = internal::shared_integrator<
+        boost::math::quadrature::exp_sinh<double>>();
     if (a >= 0.0) {
       auto f_wrap = [&](double x) { return f(x + a, NOT_A_NUMBER); };
       Q = integrator.integrate(f_wrap, relative_tolerance, &error1, &L1,
                                &levels);
     } else {
-      boost::math::quadrature::tanh_sinh<double> integrator_right;
+      auto integrator_right = internal::shared_integrator<
+          boost::math::quadrature::tanh_sinh<double>>();
       auto f_wrap = [&](double x) { return f(x, NOT_A_NUMBER); };
+      auto f_wrap_right = [&](double x, double xc) { return f_wrap(x); };
       Q = integrator.integrate(f_wrap, relative_tolerance, &error1, &L1,
                                &levels)
-          + integrator_right.integrate(f_wrap, a, 0, relative_tolerance,
-                                       &error2, &L2, &levels);
+          + internal::integrate_tanh_sinh(integrator_right, f_wrap_right, a, 0,
+                                          relative_tolerance, &error2, &L2,
+                                          &levels);
       used_two_integrals = true;
     }
   } else {
     auto f_wrap = [&](double x, double xc) { return f(x, xc); };
-    boost::math::quadrature::tanh_sinh<double> integrator;
+    auto integrator = internal::shared_integrator<
+        boost::math::quadrature::tanh_sinh<double>>();
     if (a < 0.0 && b > 0.0) {
-      Q = integrator.integrate(f_wrap, a, 0.0, relative_tolerance, &error1, &L1,
-                               &levels)
-          + integrator.integrate(f_wrap, 0.0, b, relative_tolerance, &error2,
-                                 &L2, &levels);
+      Q = internal::integrate_tanh_sinh(integrator, f_wrap, a, 0.0,
+                                        relative_tolerance, &error1, &L1,
+                                        &levels)
+          + internal::integrate_tanh_sinh(integrator, f_wrap, 0.0, b,
+                                          relative_tolerance, &error2, &L2,
+                                          &levels);
       used_two_integrals = true;
     } else {
-      Q = integrator.integrate(f_wrap, a, b, relative_tolerance, &error1, &L1,
-                               &levels);
+      Q = internal::integrate_tanh_sinh(integrator, f_wrap, a, b,
+                                        relative_tolerance, &error1, &L1,
+                                        &levels);
     }
   }
-
   static const char* function = "integrate";
   if (used_two_integrals) {
     if (error1 > relative_tolerance * L1) {
@@ -43,6 +43,12 @@ namespace math {
  * method</a> as implemented in Boost's <code>
  * boost::numeric::odeint::runge_kutta_dopri5</code> integrator.
  *
+ * If all of the initial state and the parameters are data and the
+ * functor provides the in-place overload described by
+ * <code>has_ode_rhs_inplace</code>, the right hand side is evaluated
+ * directly into the stepper's preallocated derivative buffer such
+ * that no heap allocations occur per step.
+ *
  * @tparam F type of ODE system function.
  * @tparam T1 type of scalars for initial values.
  * @tparam T2 type of scalars for parameters.
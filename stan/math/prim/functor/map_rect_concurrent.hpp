@@ -2,13 +2,161 @@
 #define STAN_MATH_PRIM_FUNCTOR_MAP_RECT_CONCURRENT_HPP
 
 #include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
+
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
 #include <vector>
 
 namespace stan {
 namespace math {
+
+/**
+ * Partitioning strategy used by the threaded map_rect to split the
+ * jobs into chunks for the TBB scheduler. The values correspond to
+ * the <code>tbb::auto_partitioner</code>,
+ * <code>tbb::simple_partitioner</code>,
+ * <code>tbb::static_partitioner</code> and
+ * <code>tbb::affinity_partitioner</code>.
+ */
+enum class map_rect_partitioner { automatic, simple, static_split, affinity };
+
+/**
+ * Settings of the threaded map_rect for one call site.
+ *
+ * The grainsize is the number of jobs per chunk below which chunks
+ * are not split further. If job costs are given, the jobs are grouped
+ * into consecutive chunks of about equal cost, each of about the cost
+ * of grainsize jobs of average cost, and the chunks are scheduled
+ * instead of the jobs. Job costs are relative; only their ratios
+ * matter. They are ignored if their number does not match the number
+ * of jobs.
+ *
+ * The affinity partitioner is kept per call site and thread, such
+ * that repeated calls replay the previous mapping of chunks to worker
+ * threads.
+ */
+struct map_rect_concurrent_settings {
+  map_rect_partitioner partitioner_ = map_rect_partitioner::automatic;
+  int grainsize_ = 1;
+  std::vector<double> job_costs_;
+};
+
+/**
+ * Return the settings of the threaded map_rect for the call site with
+ * the given call id and functor. The settings are shared by all
+ * threads and must not be changed while the call site executes.
+ *
+ * @tparam call_id call id of the map_rect call site
+ * @tparam F functor of the map_rect call site
+ */
+template <int call_id, typename F>
+inline map_rect_concurrent_settings& map_rect_settings() {
+  static map_rect_concurrent_settings settings;
+  return settings;
+}
+
 namespace internal {
 
+/**
+ * Return the boundaries of consecutive chunks of jobs of about equal
+ * cost. Chunk c holds the jobs [bounds[c], bounds[c + 1]).
+ *
+ * @param job_costs non-negative cost of each job
+ * @param grainsize number of average cost jobs per chunk
+ * @return chunk boundaries, starting at 0 and ending at the number of
+ * jobs
+ */
+inline std::vector<std::size_t> map_rect_cost_chunks(
+    const std::vector<double>& job_costs, std::size_t grainsize) {
+  const std::size_t num_jobs = job_costs.size();
+  double total_cost = 0;
+  for (double cost : job_costs) {
+    total_cost += cost;
+  }
+  const double chunk_cost = total_cost * grainsize / num_jobs;
+
+  std::vector<std::size_t> bounds(1, 0);
+  double cost = 0;
+  for (std::size_t i = 0; i < num_jobs; ++i) {
+    cost += job_costs[i];
+    if (cost >= chunk_cost) {
+      bounds.push_back(i + 1);
+      cost = 0;
+    }
+  }
+  if (bounds.back() != num_jobs) {
+    bounds.push_back(num_jobs);
+  }
+  return bounds;
+}
+
+/**
+ * Run execute_chunk(start, end) over the job range [0, num_jobs) in
+ * chunks as given by the settings. The chunks run in parallel on the
+ * TBB thread pool if STAN_THREADS is defined and serially otherwise.
+ *
+ * @tparam ExecuteChunk type of the chunk body
+ * @param settings settings of the call site
+ * @param affinity affinity partitioner of the call site
+ * @param num_jobs number of jobs
+ * @param execute_chunk body run on each chunk
+ * @throw std::domain_error if the grainsize is not positive or a job cost is
+ * negative or not finite
+ */
+template <typename ExecuteChunk>
+inline void map_rect_parallel_for(const map_rect_concurrent_settings& settings,
+                                  tbb::affinity_partitioner& affinity,
+                                  std::size_t num_jobs,
+                                  const ExecuteChunk& execute_chunk) {
+  static const char* function = "map_rect";
+  check_positive(function, "grainsize", settings.grainsize_);
+  const bool use_costs = settings.job_costs_.size() == num_jobs;
+  if (use_costs) {
+    check_nonnegative(function, "job costs", settings.job_costs_);
+    check_finite(function, "job costs", settings.job_costs_);
+  }
+
+#ifdef STAN_THREADS
+  std::vector<std::size_t> bounds;
+  std::size_t num_chunks = num_jobs;
+  std::size_t grainsize = settings.grainsize_;
+  if (use_costs) {
+    bounds = map_rect_cost_chunks(settings.job_costs_, settings.grainsize_);
+    num_chunks = bounds.size() - 1;
+    grainsize = 1;
+  }
+  auto body = [&](const tbb::blocked_range<std::size_t>& r) -> void {
+    if (use_costs) {
+      execute_chunk(bounds[r.begin()], bounds[r.end()]);
+    } else {
+      execute_chunk(r.begin(), r.end());
+    }
+  };
+  const tbb::blocked_range<std::size_t> range(0, num_chunks, grainsize);
+
+  switch (settings.partitioner_) {
+    case map_rect_partitioner::simple:
+      tbb::parallel_for(range, body, tbb::simple_partitioner());
+      break;
+    case map_rect_partitioner::static_split:
+      tbb::parallel_for(range, body, tbb::static_partitioner());
+      break;
+    case map_rect_partitioner::affinity:
+      tbb::parallel_for(range, body, affinity);
+      break;
+    default:
+      tbb::parallel_for(range, body, tbb::auto_partitioner());
+  }
+#else
+  execute_chunk(0, num_jobs);
+#endif
+}
+
 template <int call_id, typename F, typename T_shared_param,
           typename T_job_param>
 Eigen::Matrix<return_type_t<T_shared_param, T_job_param>, Eigen::Dynamic, 1>
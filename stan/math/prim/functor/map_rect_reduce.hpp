@@ -36,6 +36,24 @@ namespace internal {
 template <typename F, typename T_shared_param, typename T_job_param>
 class map_rect_reduce {};
 
+/**
+ * Type of the user functor of a reduce step or functor of map_rect,
+ * which is used to look up the settings of the call site. For any
+ * other type it is the type itself.
+ *
+ * @tparam ReduceF type of the reduce step or functor
+ */
+template <typename ReduceF>
+struct map_rect_reduce_functor {
+  using type = ReduceF;
+};
+
+template <typename F, typename T_shared_param, typename T_job_param>
+struct map_rect_reduce_functor<
+    map_rect_reduce<F, T_shared_param, T_job_param>> {
+  using type = typename map_rect_reduce_functor<F>::type;
+};
+
 template <typename F>
 class map_rect_reduce<F, double, double> {
  public:
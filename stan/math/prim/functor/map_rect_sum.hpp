@@ -0,0 +1,106 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_MAP_RECT_SUM_HPP
+#define STAN_MATH_PRIM_FUNCTOR_MAP_RECT_SUM_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/functor/map_rect.hpp>
+#include <stan/math/prim/functor/map_rect_reduce.hpp>
+
+#include <vector>
+
+/**
+ * Registers a map_rect_sum call site with the given call id and
+ * functor, see STAN_REGISTER_MAP_RECT.
+ */
+#define STAN_REGISTER_MAP_RECT_SUM(CALLID, FUNCTOR) \
+  STAN_REGISTER_MAP_RECT(                          \
+      CALLID, stan::math::internal::map_rect_sum_functor<FUNCTOR>)
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Functor which returns the sum of the outputs of the user functor F
+ * as a vector of size one. Used as map_rect functor, the reduce step
+ * of each job computes the gradient of the summed outputs in a single
+ * reverse sweep and returns a single column.
+ *
+ * @tparam F user functor
+ */
+template <typename F>
+struct map_rect_sum_functor {
+  template <typename T1, typename T2>
+  Eigen::Matrix<return_type_t<T1, T2>, Eigen::Dynamic, 1> operator()(
+      const Eigen::Matrix<T1, Eigen::Dynamic, 1>& shared_params,
+      const Eigen::Matrix<T2, Eigen::Dynamic, 1>& job_params,
+      const std::vector<double>& x_r, const std::vector<int>& x_i,
+      std::ostream* msgs = nullptr) const {
+    Eigen::Matrix<return_type_t<T1, T2>, Eigen::Dynamic, 1> out(1);
+    out(0) = sum(F()(shared_params, job_params, x_r, x_i, msgs));
+    return out;
+  }
+};
+
+/**
+ * The settings of a map_rect_sum call site are the settings of its
+ * user functor.
+ */
+template <typename F>
+struct map_rect_reduce_functor<map_rect_sum_functor<F>> {
+  using type = F;
+};
+
+}  // namespace internal
+
+/**
+ * Return the sum of the outputs of each job of a map_rect call. That
+ * is, for N jobs the output of this function is
+ *
+ * [
+ * sum(f(shared_params, job_params[1], x_r[1], x_i[1])),
+ * ...,
+ * sum(f(shared_params, job_params[N], x_r[N], x_i[N])) ]'.
+ *
+ * The outputs of each job are summed before the gradients are
+ * computed, which is the typical use of map_rect to calculate a log
+ * density. Each job then requires a single reverse sweep of its
+ * nested AD graph and contributes a single output holding the
+ * gradient with respect to the shared and its job specific
+ * parameters. For S shared parameters and K outputs per job this
+ * reduces the storage for the gradients of each job from K * S to S
+ * elements.
+ *
+ * The conventions of map_rect apply. The call site must be registered
+ * with the STAN_REGISTER_MAP_RECT_SUM macro and uses the settings
+ * map_rect_settings<call_id, F>().
+ *
+ * @tparam call_id label for the functor/data combination
+ * @tparam F functor which is applied to all jobs
+ * @tparam T_shared_param type of shared parameters
+ * @tparam T_job_param type of job specific parameters
+ * @param shared_params shared parameter vector passed as first
+ * argument to functor for all jobs
+ * @param job_params array of job specific parameter vectors
+ * @param x_r array of real arrays for each job
+ * @param x_i array of int arrays for each job
+ * @param msgs output stream for messages
+ * @return sums of the outputs of all jobs
+ */
+template <int call_id, typename F, typename T_shared_param,
+          typename T_job_param>
+Eigen::Matrix<return_type_t<T_shared_param, T_job_param>, Eigen::Dynamic, 1>
+map_rect_sum(
+    const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+    const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+        job_params,
+    const std::vector<std::vector<double>>& x_r,
+    const std::vector<std::vector<int>>& x_i, std::ostream* msgs = nullptr) {
+  return map_rect<call_id, internal::map_rect_sum_functor<F>>(
+      shared_params, job_params, x_r, x_i, msgs);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
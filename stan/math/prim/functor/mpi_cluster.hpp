@@ -128,7 +128,12 @@ struct mpi_cluster {
   boost::mpi::communicator world_;
   std::size_t const rank_ = world_.rank();
 
+#ifdef STAN_THREADS
+  // the TBB worker threads of each process never call into MPI
+  mpi_cluster() : env(boost::mpi::threading::funneled) {}
+#else
   mpi_cluster() {}
+#endif
 
   ~mpi_cluster() {
     // the destructor will ensure that the childs are being
@@ -6,18 +6,53 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/functor/mpi_cluster.hpp>
 #include <stan/math/prim/functor/mpi_distributed_apply.hpp>
+#include <stan/math/prim/functor/map_rect_concurrent.hpp>
+#include <stan/math/prim/functor/map_rect_reduce.hpp>
 #include <stan/math/prim/fun/to_array_1d.hpp>
 #include <stan/math/prim/fun/dims.hpp>
 
+#include <boost/mpi/exception.hpp>
+#include <mpi.h>
+
 #include <mutex>
 #include <algorithm>
 #include <vector>
 #include <type_traits>
 #include <functional>
+#include <utility>
 
 namespace stan {
 namespace math {
 
+/**
+ * Settings of a map_rect call site which only apply to its MPI
+ * evaluation.
+ *
+ * The number of pipeline rounds splits the local jobs of every
+ * process into that many rounds. The parameters of the rounds are
+ * scattered and their results gathered with non-blocking collectives,
+ * such that communication overlaps with the evaluation of other
+ * rounds. The number of rounds is read on the root when the call site
+ * is first evaluated and must be positive. A single round uses
+ * blocking collectives.
+ */
+struct map_rect_mpi_settings {
+  int pipeline_rounds_ = 1;
+};
+
+/**
+ * Return the MPI settings of the map_rect call site with the given
+ * call id and functor.
+ *
+ * @tparam call_id call id of the map_rect call site
+ * @tparam F functor of the map_rect call site
+ */
+template <int call_id, typename F>
+inline map_rect_mpi_settings& map_rect_mpi_call_settings() {
+  static map_rect_mpi_settings settings;
+  return settings;
+}
+
 namespace internal {
 
 /**
@@ -117,14 +152,22 @@ bool mpi_parallel_call_cache<call_id, member, T>::is_valid_ = false;
  *    of size W in N/W chunks (the remainder is allocated to node 1
  *    onwards which ensures that the root node 0 has one job less).
  * 5. Once the parameters and static data is distributed, the reduce
- *    operation is applied per defined job. Each job is allowed to
- *    return a different number of outputs such that the resulting
- *    data structure is a ragged array. The ragged array structure
+ *    operation is applied per defined job. The local jobs of each
+ *    process are evaluated on its TBB thread pool if STAN_THREADS is
+ *    defined, partitioned according to the map_rect settings of the
+ *    call site in that process. Each job is allowed to return a
+ *    different number of outputs such that the resulting data
+ *    structure is a ragged array. The ragged array structure
  *    becomes known to mpi_parallel_call during the first evaluation
  *    and must not change for future calls.
  * 6. Finally the local results are gathered on the root node over MPI
  *    and given on the root node to the combine functor along
- *    with the ragged array data structure.
+ *    with the ragged array data structure. Once the ragged array
+ *    structure is cached, calls with more than one MPI pipeline
+ *    round in the map_rect settings of the call site on the root
+ *    split the local jobs into rounds whose job parameters and
+ *    results are transferred with non-blocking collectives while
+ *    other rounds are evaluated.
  *
  * The MPI cluster resource is aquired with construction of
  * mpi_parallel_call and is freed once the mpi_parallel_call goes out
@@ -177,6 +220,8 @@ class mpi_parallel_call {
       = internal::mpi_parallel_call_cache<call_id, 3, std::vector<int>>;
   using cache_chunks
       = internal::mpi_parallel_call_cache<call_id, 4, std::vector<int>>;
+  using cache_rounds
+      = internal::mpi_parallel_call_cache<call_id, 5, std::vector<int>>;
 
   // # of outputs for given call_id+ReduceF+CombineF case
   static int num_outputs_per_job_;
@@ -186,6 +231,11 @@ class mpi_parallel_call {
   vector_d local_shared_params_dbl_;
   matrix_d local_job_params_dbl_;
 
+  // job parameters of all jobs on the root, which are scattered round
+  // by round when the call is pipelined
+  matrix_d job_params_dbl_;
+  bool pipelined_ = false;
+
  public:
   /**
    * Initiates a parallel MPI call on the root. The constructor
@@ -217,6 +267,11 @@ class mpi_parallel_call {
     check_matching_sizes("mpi_parallel_call", "job parameters", job_params,
                          "integer data", x_i);
 
+    if (!cache_rounds::is_valid()) {
+      check_positive("mpi_parallel_call", "MPI pipeline rounds",
+                     mpi_settings().pipeline_rounds_);
+    }
+
     if (cache_chunks::is_valid()) {
       int cached_num_jobs = sum(cache_chunks::data());
       check_size_match("mpi_parallel_call", "cached number of jobs",
@@ -233,12 +288,12 @@ class mpi_parallel_call {
     const size_type num_job_params = num_jobs == 0 ? 0 : job_dims[1];
 
     const vector_d shared_params_dbl = value_of(shared_params);
-    matrix_d job_params_dbl(num_job_params, num_jobs);
+    job_params_dbl_.resize(num_job_params, num_jobs);
 
     for (int j = 0; j < num_jobs; ++j)
-      job_params_dbl.col(j) = value_of(job_params[j]);
+      job_params_dbl_.col(j) = value_of(job_params[j]);
 
-    setup_call(shared_params_dbl, job_params_dbl, x_r, x_i);
+    setup_call(shared_params_dbl, job_params_dbl_, x_r, x_i);
   }
 
   // called on remote sites
@@ -267,6 +322,10 @@ class mpi_parallel_call {
    * results.
    */
   result_t reduce_combine() {
+    if (pipelined_) {
+      return reduce_combine_pipelined();
+    }
+
     const std::vector<int>& job_chunks = cache_chunks::data();
     const int num_jobs = sum(job_chunks);
 
@@ -275,45 +334,63 @@ class mpi_parallel_call {
     const int num_local_jobs = local_job_params_dbl_.cols();
     int local_outputs_per_job = num_local_jobs == 0 ? 0 : num_outputs_per_job_;
     matrix_d local_output(
-        local_outputs_per_job == -1 ? 0 : local_outputs_per_job,
-        num_local_jobs);
+        local_outputs_per_job == -1 ? 0 : local_outputs_per_job, 0);
     std::vector<int> local_f_out(num_local_jobs, -1);
 
     typename cache_x_r::cache_t& local_x_r = cache_x_r::data();
     typename cache_x_i::cache_t& local_x_i = cache_x_i::data();
 
-    // check if we know already output sizes
-    if (cache_f_out::is_valid()) {
+    // once the output sizes are known the jobs write their results
+    // directly into the local output, otherwise the results are
+    // assembled after all local jobs are done
+    const bool sizes_known
+        = cache_f_out::is_valid() && local_outputs_per_job != -1;
+    std::vector<int> local_offsets(num_local_jobs + 1, 0);
+    std::vector<matrix_d> local_job_output;
+    if (sizes_known) {
       typename cache_f_out::cache_t& f_out = cache_f_out::data();
-      const int num_outputs
-          = std::accumulate(f_out.begin() + first_job,
-                            f_out.begin() + first_job + num_local_jobs, 0);
-      local_output.resize(Eigen::NoChange, num_outputs);
+      for (int i = 0; i < num_local_jobs; ++i) {
+        local_offsets[i + 1] = local_offsets[i] + f_out[first_job + i];
+      }
+      local_output.resize(Eigen::NoChange, local_offsets[num_local_jobs]);
+    } else {
+      local_job_output.resize(num_local_jobs);
     }
 
-    int local_ok = 1;
-    try {
-      for (int i = 0, offset = 0; i < num_local_jobs;
-           offset += local_f_out[i], ++i) {
-        const matrix_d job_output
+    auto execute_chunk = [&](std::size_t start, std::size_t end) -> void {
+      for (std::size_t i = start; i != end; ++i) {
+        matrix_d job_output
             = ReduceF()(local_shared_params_dbl_, local_job_params_dbl_.col(i),
                         local_x_r[i], local_x_i[i], 0);
         local_f_out[i] = job_output.cols();
-
-        if (local_outputs_per_job == -1) {
-          local_outputs_per_job = job_output.rows();
-          // changing rows, but leave column size as is
-          local_output.conservativeResize(local_outputs_per_job,
-                                          Eigen::NoChange);
+        if (!sizes_known) {
+          local_job_output[i] = std::move(job_output);
+        } else if (job_output.rows() != local_output.rows()) {
+          throw std::domain_error("Output size changed.");
+        } else if (local_f_out[i] == local_offsets[i + 1] - local_offsets[i]) {
+          // a changed number of outputs is flagged below
+          local_output.middleCols(local_offsets[i], local_f_out[i])
+              = job_output;
         }
+      }
+    };
 
-        if (local_output.cols() < offset + local_f_out[i])
-          // leave row size, but change columns size
-          local_output.conservativeResize(Eigen::NoChange,
-                                          2 * (offset + local_f_out[i]));
-
-        local_output.block(0, offset, local_output.rows(), local_f_out[i])
-            = job_output;
+    int local_ok = 1;
+    try {
+      execute_local_jobs(num_jobs, first_job, 0, num_local_jobs,
+                         execute_chunk);
+
+      if (!sizes_known && num_local_jobs > 0) {
+        local_outputs_per_job = local_job_output[0].rows();
+        local_output.resize(local_outputs_per_job, sum(local_f_out));
+        for (int i = 0, offset = 0; i < num_local_jobs;
+             offset += local_f_out[i], ++i) {
+          if (local_job_output[i].rows() != local_outputs_per_job) {
+            throw std::domain_error("Output size changed.");
+          }
+          local_output.middleCols(offset, local_f_out[i])
+              = local_job_output[i];
+        }
       }
     } catch (const std::exception& e) {
       // see note 1 above for an explanation why we do not rethrow
@@ -375,6 +452,15 @@ class mpi_parallel_call {
       }
     }
 
+    // the local output must match the cached sizes for the gather
+    if (local_ok == 0) {
+      local_output.setZero(num_outputs_per_job_,
+                           std::accumulate(world_f_out.begin() + first_job,
+                                           world_f_out.begin() + first_job
+                                               + num_local_jobs,
+                                           0));
+    }
+
     const std::size_t size_world_f_out = sum(world_f_out);
     matrix_d world_result(num_outputs_per_job_, size_world_f_out);
 
@@ -404,6 +490,181 @@ class mpi_parallel_call {
   }
 
  private:
+  /**
+   * Return the map_rect settings of the call site in this process,
+   * which control the partitioning of the local jobs.
+   */
+  static const map_rect_concurrent_settings& settings() {
+    using F = typename internal::map_rect_reduce_functor<ReduceF>::type;
+    return map_rect_settings<call_id, F>();
+  }
+
+  /**
+   * Return the MPI settings of the call site, which are only read on
+   * the root.
+   */
+  static const map_rect_mpi_settings& mpi_settings() {
+    using F = typename internal::map_rect_reduce_functor<ReduceF>::type;
+    return map_rect_mpi_call_settings<call_id, F>();
+  }
+
+  /**
+   * Evaluates the local jobs [begin, end) of this process on its TBB
+   * thread pool using the settings of the map_rect call site. Job
+   * costs given for all jobs are restricted to the evaluated jobs.
+   *
+   * @tparam ExecuteChunk type of the chunk body
+   * @param num_jobs total number of jobs
+   * @param first_job index of the first local job in all jobs
+   * @param begin first local job to evaluate
+   * @param end one past the last local job to evaluate
+   * @param execute_chunk body run on chunks of local jobs
+   */
+  template <typename ExecuteChunk>
+  void execute_local_jobs(int num_jobs, int first_job, int begin, int end,
+                          const ExecuteChunk& execute_chunk) {
+    map_rect_concurrent_settings local_settings = settings();
+    const std::vector<double>& job_costs = local_settings.job_costs_;
+    if (job_costs.size() == static_cast<std::size_t>(num_jobs)) {
+      local_settings.job_costs_
+          = std::vector<double>(job_costs.begin() + first_job + begin,
+                                job_costs.begin() + first_job + end);
+    }
+    static thread_local tbb::affinity_partitioner affinity;
+    internal::map_rect_parallel_for(
+        local_settings, affinity, end - begin,
+        [&](std::size_t start, std::size_t stop) -> void {
+          execute_chunk(begin + start, begin + stop);
+        });
+  }
+
+  /**
+   * Pipelined variant of reduce_combine which is used once the output
+   * sizes are cached and more than one pipeline round is requested.
+   * The local jobs of every process are split into rounds. The job
+   * parameters of all rounds are scattered with non-blocking
+   * collectives upfront and the results of each round are gathered
+   * with a non-blocking collective as soon as the round is
+   * evaluated. Hence the transfer of the parameters of later rounds
+   * and of the results of earlier rounds overlaps with the evaluation
+   * of the current round. All collectives are issued in the same order
+   * on all processes and only from the thread calling reduce_combine.
+   */
+  result_t reduce_combine_pipelined() {
+    const std::vector<int>& job_chunks = cache_chunks::data();
+    const int num_jobs = sum(job_chunks);
+    const int num_rounds = cache_rounds::data()[0];
+    const int num_job_params = local_job_params_dbl_.rows();
+    const int num_local_jobs = local_job_params_dbl_.cols();
+    const int rows = num_outputs_per_job_;
+
+    typename cache_x_r::cache_t& local_x_r = cache_x_r::data();
+    typename cache_x_i::cache_t& local_x_i = cache_x_i::data();
+    typename cache_f_out::cache_t& world_f_out = cache_f_out::data();
+
+    std::vector<int> world_offsets(num_jobs + 1, 0);
+    for (int i = 0; i < num_jobs; ++i) {
+      world_offsets[i + 1] = world_offsets[i] + world_f_out[i];
+    }
+    std::vector<int> first_jobs(world_size_ + 1, 0);
+    for (std::size_t q = 0; q != world_size_; ++q) {
+      first_jobs[q + 1] = first_jobs[q] + job_chunks[q];
+    }
+    const int first_job = first_jobs[rank_];
+
+    // round r of process q holds the jobs [round_begin(q, r),
+    // round_begin(q, r + 1)), where the first rounds take the remainder
+    auto round_begin = [&](std::size_t q, int r) -> int {
+      return first_jobs[q] + (job_chunks[q] / num_rounds) * r
+             + std::min(r, job_chunks[q] % num_rounds);
+    };
+
+    MPI_Comm comm = world_;
+    std::vector<MPI_Request> scatter_requests(num_rounds);
+    std::vector<MPI_Request> gather_requests(num_rounds);
+    std::vector<int> counts(world_size_);
+    std::vector<int> displs(world_size_);
+
+    for (int r = 0; r < num_rounds; ++r) {
+      for (std::size_t q = 0; q != world_size_; ++q) {
+        counts[q]
+            = num_job_params * (round_begin(q, r + 1) - round_begin(q, r));
+        displs[q] = num_job_params * round_begin(q, r);
+      }
+      BOOST_MPI_CHECK_RESULT(
+          MPI_Iscatterv,
+          (job_params_dbl_.data(), counts.data(), displs.data(), MPI_DOUBLE,
+           local_job_params_dbl_.data()
+               + num_job_params * (round_begin(rank_, r) - first_job),
+           counts[rank_], MPI_DOUBLE, 0, comm, &scatter_requests[r]));
+    }
+
+    matrix_d local_output = matrix_d::Zero(
+        rows, world_offsets[first_job + num_local_jobs]
+                  - world_offsets[first_job]);
+    matrix_d world_result(rows, rank_ == 0 ? world_offsets[num_jobs] : 0);
+
+    auto execute_chunk = [&](std::size_t start, std::size_t end) -> void {
+      for (std::size_t i = start; i != end; ++i) {
+        matrix_d job_output
+            = ReduceF()(local_shared_params_dbl_, local_job_params_dbl_.col(i),
+                        local_x_r[i], local_x_i[i], 0);
+        if (job_output.rows() != rows
+            || job_output.cols() != world_f_out[first_job + i]) {
+          throw std::domain_error("Output size changed.");
+        }
+        local_output.middleCols(
+            world_offsets[first_job + i] - world_offsets[first_job],
+            job_output.cols())
+            = job_output;
+      }
+    };
+
+    int local_ok = 1;
+    for (int r = 0; r < num_rounds; ++r) {
+      BOOST_MPI_CHECK_RESULT(MPI_Wait,
+                             (&scatter_requests[r], MPI_STATUS_IGNORE));
+      const int begin = round_begin(rank_, r) - first_job;
+      const int end = round_begin(rank_, r + 1) - first_job;
+      if (local_ok == 1) {
+        try {
+          execute_local_jobs(num_jobs, first_job, begin, end, execute_chunk);
+        } catch (const std::exception& e) {
+          // see note 1 above, the remaining rounds are still gathered
+          local_ok = 0;
+        }
+      }
+
+      for (std::size_t q = 0; q != world_size_; ++q) {
+        counts[q] = rows
+                    * (world_offsets[round_begin(q, r + 1)]
+                       - world_offsets[round_begin(q, r)]);
+        displs[q] = rows * world_offsets[round_begin(q, r)];
+      }
+      BOOST_MPI_CHECK_RESULT(
+          MPI_Igatherv,
+          (local_output.data()
+               + rows * (world_offsets[first_job + begin]
+                         - world_offsets[first_job]),
+           counts[rank_], MPI_DOUBLE, world_result.data(), counts.data(),
+           displs.data(), MPI_DOUBLE, 0, comm, &gather_requests[r]));
+    }
+    BOOST_MPI_CHECK_RESULT(MPI_Waitall, (num_rounds, gather_requests.data(),
+                                         MPI_STATUSES_IGNORE));
+
+    // let root know if all went fine everywhere
+    int cluster_status = 0;
+    boost::mpi::reduce(world_, local_ok, cluster_status, std::plus<int>(), 0);
+
+    if (rank_ != 0)
+      return result_t();
+
+    if (cluster_status != static_cast<int>(world_size_))
+      throw std::domain_error("Error during MPI evaluation.");
+
+    return combine_(world_result, world_f_out);
+  }
+
   /**
    * Performs a cached scatter of a 2D array (nested std::vector). On the
    * first call the data on the root is scattered to all workers and
@@ -567,9 +828,26 @@ class mpi_parallel_call {
                   const std::vector<std::vector<int>>& x_i) {
     std::vector<int> job_chunks = mpi_map_chunks(job_params.cols(), 1);
     broadcast_array_1d_cached<cache_chunks>(job_chunks);
+    const std::vector<int>& rounds
+        = broadcast_array_1d_cached<cache_rounds>(
+            {mpi_settings().pipeline_rounds_});
 
     local_shared_params_dbl_ = broadcast_vector<-1>(shared_params);
-    local_job_params_dbl_ = scatter_matrix<-2>(job_params);
+
+    // the first evaluation determines the output sizes and is never
+    // pipelined. Pipelined calls scatter the job parameters in rounds
+    // during reduce_combine.
+    pipelined_ = rounds[0] > 1 && cache_f_out::is_valid()
+                 && num_outputs_per_job_ != -1;
+    if (pipelined_) {
+      using meta_cache
+          = internal::mpi_parallel_call_cache<call_id, -2,
+                                              std::vector<size_type>>;
+      local_job_params_dbl_.resize(meta_cache::data()[0],
+                                   cache_chunks::data()[rank_]);
+    } else {
+      local_job_params_dbl_ = scatter_matrix<-2>(job_params);
+    }
 
     // distribute const data if not yet cached
     scatter_array_2d_cached<cache_x_r>(x_r);
@@ -0,0 +1,100 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_ODE_RHS_INPLACE_HPP
+#define STAN_MATH_PRIM_FUNCTOR_ODE_RHS_INPLACE_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+template <typename F>
+using ode_rhs_inplace_t = decltype(std::declval<const F&>()(
+    std::declval<double>(),
+    std::declval<const Eigen::Map<const Eigen::VectorXd>&>(),
+    std::declval<const std::vector<double>&>(),
+    std::declval<const std::vector<double>&>(),
+    std::declval<const std::vector<int>&>(), std::declval<std::ostream*>(),
+    std::declval<Eigen::Map<Eigen::VectorXd>&>()));
+}  // namespace internal
+
+/**
+ * Checks whether the ODE functor <code>F</code> provides, in addition
+ * to the usual <code>std::vector</code> returning signature, an
+ * allocation free overload for the double only case of the form
+ *
+ * <code>void operator()(double t,
+ *   const Eigen::Map<const Eigen::VectorXd>& y,
+ *   const std::vector<double>& theta, const std::vector<double>& x,
+ *   const std::vector<int>& x_int, std::ostream* msgs,
+ *   Eigen::Map<Eigen::VectorXd>& dy_dt) const</code>
+ *
+ * which writes the time derivative into the preallocated
+ * <code>dy_dt</code>.
+ *
+ * @tparam F type of ODE system functor
+ */
+template <typename F>
+struct has_ode_rhs_inplace
+    : bool_constant<is_detected<F, internal::ode_rhs_inplace_t>::value> {};
+
+/**
+ * Evaluates the ODE right hand side for known states and parameters
+ * writing the result into the preallocated array <code>dy_dt</code>.
+ *
+ * If the functor provides the in-place overload (see
+ * <code>has_ode_rhs_inplace</code>), the state and output are mapped
+ * without copies and no heap allocation takes place. Otherwise the
+ * state is copied into a <code>std::vector<double></code> and the
+ * vector returned by the functor is copied into <code>dy_dt</code>.
+ *
+ * @tparam F type of ODE system functor
+ * @param[in] function name of the calling function for error messages
+ * @param[in] f ODE system functor
+ * @param[in] t time
+ * @param[in] y state of size <code>N</code>
+ * @param[in] N size of the ODE system
+ * @param[in] theta parameters
+ * @param[in] x real data
+ * @param[in] x_int integer data
+ * @param[in, out] msgs stream for messages
+ * @param[out] dy_dt time derivative of size <code>N</code>
+ * @throw exception if the functor does not return N derivatives
+ */
+template <typename F,
+          std::enable_if_t<has_ode_rhs_inplace<F>::value>* = nullptr>
+inline void ode_rhs_inplace(const char* function, const F& f, double t,
+                            const double* y, size_t N,
+                            const std::vector<double>& theta,
+                            const std::vector<double>& x,
+                            const std::vector<int>& x_int, std::ostream* msgs,
+                            double* dy_dt) {
+  const Eigen::Map<const Eigen::VectorXd> y_map(y, N);
+  Eigen::Map<Eigen::VectorXd> dy_dt_map(dy_dt, N);
+  f(t, y_map, theta, x, x_int, msgs, dy_dt_map);
+}
+
+template <typename F,
+          std::enable_if_t<!has_ode_rhs_inplace<F>::value>* = nullptr>
+inline void ode_rhs_inplace(const char* function, const F& f, double t,
+                            const double* y, size_t N,
+                            const std::vector<double>& theta,
+                            const std::vector<double>& x,
+                            const std::vector<int>& x_int, std::ostream* msgs,
+                            double* dy_dt) {
+  const std::vector<double> y_vec(y, y + N);
+  const std::vector<double> dy_dt_vec = f(t, y_vec, theta, x, x_int, msgs);
+  check_size_match(function, "dz_dt", dy_dt_vec.size(), "states", N);
+  std::copy(dy_dt_vec.begin(), dy_dt_vec.end(), dy_dt);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
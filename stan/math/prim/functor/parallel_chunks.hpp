@@ -0,0 +1,113 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_PARALLEL_CHUNKS_HPP
+#define STAN_MATH_PRIM_FUNCTOR_PARALLEL_CHUNKS_HPP
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Minimum number of elements of a vectorized density or GLM for which
+ * its evaluation is split into chunks that run in parallel on the TBB
+ * thread pool. Only used if STAN_THREADS is defined.
+ */
+#ifndef STAN_MATH_PARALLEL_DENSITY_MIN_SIZE
+#define STAN_MATH_PARALLEL_DENSITY_MIN_SIZE 65536
+#endif
+
+/**
+ * Number of elements of a vectorized density or GLM evaluated in each
+ * chunk once the minimum size for parallel evaluation is reached.
+ */
+#ifndef STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE
+#define STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE 16384
+#endif
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Returns the number of chunks the evaluation of a density over the
+ * specified number of elements is split into. This is one unless
+ * STAN_THREADS is defined and the number of elements is at least
+ * STAN_MATH_PARALLEL_DENSITY_MIN_SIZE.
+ *
+ * The number of chunks depends only on the number of elements and not
+ * on the number of threads, so the result of a density, which sums the
+ * contributions of the chunks in order, does not depend on the thread
+ * pool either.
+ *
+ * @param N number of elements
+ * @return number of chunks
+ */
+inline std::size_t num_parallel_chunks(std::size_t N) {
+#ifdef STAN_THREADS
+  if (N >= STAN_MATH_PARALLEL_DENSITY_MIN_SIZE) {
+    return (N + STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE - 1)
+           / STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE;
+  }
+#endif
+  return 1;
+}
+
+/**
+ * Returns the number of chunks the evaluation of a density with partials
+ * of the specified type over the specified number of elements is split
+ * into. Chunks must not create autodiff variables, so this is one if the
+ * partials are not arithmetic, e.g. in forward mode.
+ *
+ * @tparam T_partials type of the partials
+ * @param N number of elements
+ * @return number of chunks
+ */
+template <typename T_partials>
+inline std::size_t num_parallel_chunks(std::size_t N) {
+  return std::is_arithmetic<T_partials>::value ? num_parallel_chunks(N) : 1;
+}
+
+/**
+ * Calls the functor on each of the chunks of the elements 0, ..., N - 1
+ * as
+ *
+ * <code>f(chunk, start, end)</code>
+ *
+ * where <code>chunk</code> is the index of the chunk and the chunk holds
+ * the elements with indices in the half open range [start, end). The
+ * chunks have nearly equal size and are evaluated in parallel on the TBB
+ * thread pool if STAN_THREADS is defined and serially otherwise.
+ *
+ * The functor must only write to disjoint parts of shared state for
+ * different chunks and must not create autodiff variables.
+ *
+ * @tparam F type of the functor
+ * @param N number of elements
+ * @param num_chunks number of chunks, usually from
+ * <code>num_parallel_chunks(N)</code>
+ * @param f functor
+ */
+template <typename F>
+inline void parallel_chunks(std::size_t N, std::size_t num_chunks,
+                            const F& f) {
+  auto chunk_begin
+      = [N, num_chunks](std::size_t chunk) { return chunk * N / num_chunks; };
+  auto run_chunks = [&](const tbb::blocked_range<std::size_t>& r) {
+    for (std::size_t chunk = r.begin(); chunk < r.end(); ++chunk) {
+      f(chunk, chunk_begin(chunk), chunk_begin(chunk + 1));
+    }
+  };
+  const tbb::blocked_range<std::size_t> chunks(0, num_chunks, 1);
+#ifdef STAN_THREADS
+  if (num_chunks > 1) {
+    tbb::parallel_for(chunks, run_chunks);
+    return;
+  }
+#endif
+  run_chunks(chunks);
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
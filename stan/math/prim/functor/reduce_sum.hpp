@@ -0,0 +1,185 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_REDUCE_SUM_HPP
+#define STAN_MATH_PRIM_FUNCTOR_REDUCE_SUM_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+
+#include <functional>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Implementation of <code>reduce_sum</code>, specialized on the
+ * return type. The enable argument selects between the
+ * specializations.
+ *
+ * @tparam ReduceFunction type of the partial sum functor
+ * @tparam Enable used to select the specialization
+ * @tparam ReturnType return type of the sum
+ * @tparam Vec type of the sliced argument
+ * @tparam Args types of the shared arguments
+ */
+template <typename ReduceFunction, typename Enable, typename ReturnType,
+          typename Vec, typename... Args>
+struct reduce_sum_impl;
+
+/**
+ * Metaprogram which is true if the type is a reverse mode autodiff
+ * variable or a forward mode autodiff variable with reverse mode
+ * values, such as <code>fvar<var></code>.
+ *
+ * @tparam T type to check
+ */
+template <typename T, typename = void>
+struct reduce_sum_has_var : is_var<std::decay_t<T>> {};
+
+template <typename T>
+struct reduce_sum_has_var<T, require_fvar_t<T>>
+    : reduce_sum_has_var<partials_type_t<std::decay_t<T>>> {};
+
+/**
+ * Implementation of <code>reduce_sum</code> for sums which do not
+ * involve reverse mode autodiff variables, which are arithmetic types
+ * and forward mode variables such as <code>fvar<double></code>. The
+ * partial sums are independent of each other such that they are
+ * evaluated on the TBB thread pool if STAN_THREADS is defined and
+ * serially otherwise.
+ *
+ * @tparam ReduceFunction type of the partial sum functor
+ * @tparam ReturnType return type of the sum
+ * @tparam Vec type of the sliced argument
+ * @tparam Args types of the shared arguments
+ */
+template <typename ReduceFunction, typename ReturnType, typename Vec,
+          typename... Args>
+struct reduce_sum_impl<
+    ReduceFunction, std::enable_if_t<!reduce_sum_has_var<ReturnType>::value>,
+    ReturnType, Vec, Args...> {
+  /**
+   * Return the sum of the partial sums over all slices of the
+   * sliced argument.
+   *
+   * @param vmapped sliced argument
+   * @param grainsize suggested number of terms per slice
+   * @param msgs stream for messages of the partial sum functor
+   * @param args shared arguments
+   * @return sum of the terms
+   */
+  ReturnType operator()(const Vec& vmapped, int grainsize, std::ostream* msgs,
+                        const Args&... args) const {
+    const std::size_t num_terms = vmapped.size();
+
+    auto partial_sum = [&](const tbb::blocked_range<std::size_t>& r,
+                           ReturnType sum) -> ReturnType {
+      if (r.empty()) {
+        return sum;
+      }
+      Vec sub_slice(vmapped.begin() + r.begin(), vmapped.begin() + r.end());
+      return sum
+             + ReduceFunction()(sub_slice, r.begin(), r.end(), msgs, args...);
+    };
+
+#ifdef STAN_THREADS
+    return tbb::parallel_reduce(
+        tbb::blocked_range<std::size_t>(0, num_terms, grainsize),
+        ReturnType(0), partial_sum, std::plus<ReturnType>());
+#else
+    return partial_sum(tbb::blocked_range<std::size_t>(0, num_terms),
+                       ReturnType(0));
+#endif
+  }
+};
+
+/**
+ * Implementation of <code>reduce_sum</code> for forward mode variables
+ * with reverse mode values, such as <code>fvar<var></code>. The
+ * partial sums create reverse mode variables, which must be on the
+ * tape of the calling thread for the gradients of the caller to see
+ * them, such that the terms are summed serially in one slice.
+ *
+ * @tparam ReduceFunction type of the partial sum functor
+ * @tparam ReturnType return type of the sum
+ * @tparam Vec type of the sliced argument
+ * @tparam Args types of the shared arguments
+ */
+template <typename ReduceFunction, typename ReturnType, typename Vec,
+          typename... Args>
+struct reduce_sum_impl<ReduceFunction,
+                       std::enable_if_t<reduce_sum_has_var<ReturnType>::value
+                                        && !is_var<ReturnType>::value>,
+                       ReturnType, Vec, Args...> {
+  /**
+   * Return the sum of all terms of the sliced argument.
+   *
+   * @param vmapped sliced argument
+   * @param grainsize suggested number of terms per slice, not used
+   * @param msgs stream for messages of the partial sum functor
+   * @param args shared arguments
+   * @return sum of the terms
+   */
+  ReturnType operator()(const Vec& vmapped, int grainsize, std::ostream* msgs,
+                        const Args&... args) const {
+    if (vmapped.empty()) {
+      return ReturnType(0);
+    }
+    return ReduceFunction()(vmapped, 0, vmapped.size(), msgs, args...);
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Return the sum of the terms of a log density or any other sum by
+ * evaluating a user supplied partial sum functor on slices of the
+ * sliced argument. If STAN_THREADS is defined the slices are
+ * evaluated in parallel on the TBB thread pool.
+ *
+ * The partial sum functor must be default constructible and is called
+ * as
+ *
+ * <code>ReduceFunction()(sub_slice, start, end, msgs, args...)</code>
+ *
+ * where <code>sub_slice</code> holds the elements of the sliced
+ * argument with indices in the half open range [start, end), such
+ * that the element <code>sub_slice[i]</code> is the element
+ * <code>vmapped[start + i]</code>. The functor returns the sum of the
+ * terms of the slice. The shared arguments are passed to every call
+ * unchanged.
+ *
+ * The result does not depend on how the terms are sliced, up to
+ * floating point rounding of the sum. Sums of forward mode variables
+ * with reverse mode values, such as <code>fvar<var></code>, are
+ * always evaluated serially.
+ *
+ * @tparam ReduceFunction type of the partial sum functor
+ * @tparam T type of the elements of the sliced argument
+ * @tparam Args types of the shared arguments
+ * @param vmapped sliced argument
+ * @param grainsize suggested number of terms per slice
+ * @param msgs stream for messages of the partial sum functor
+ * @param args shared arguments
+ * @return sum of the terms
+ * @throw std::domain_error if grainsize is not positive
+ */
+template <typename ReduceFunction, typename T, typename... Args>
+inline auto reduce_sum(const std::vector<T>& vmapped, int grainsize,
+                       std::ostream* msgs, const Args&... args) {
+  using return_t = return_type_t<std::vector<T>, Args...>;
+  check_positive("reduce_sum", "grainsize", grainsize);
+  return internal::reduce_sum_impl<ReduceFunction, void, return_t,
+                                   std::vector<T>, Args...>()(
+      vmapped, grainsize, msgs, args...);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_SPARSE_COLUMN_COLORING_HPP
+#define STAN_MATH_PRIM_FUNCTOR_SPARSE_COLUMN_COLORING_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Return a coloring of the columns of a sparsity pattern such that no
+ * two columns with a nonzero in the same row share a color. The sum
+ * of the unit directions of all columns of one color is a compressed
+ * direction from which the entries of all columns of that color can
+ * be read off directly, such that a Jacobian or Hessian with the
+ * given pattern is recovered from one directional derivative per
+ * color.
+ *
+ * The columns are colored greedily in their order with the smallest
+ * admissible color.
+ *
+ * @tparam T type of the pattern entries, only the structure is used
+ * @param pattern sparsity pattern
+ * @return color of each column, starting at 0
+ */
+template <typename T>
+std::vector<int> sparse_column_coloring(const Eigen::SparseMatrix<T>& pattern) {
+  const int rows = pattern.rows();
+  const int cols = pattern.cols();
+
+  // columns with a nonzero in each row
+  std::vector<std::vector<int>> row_cols(rows);
+  for (int j = 0; j < cols; ++j) {
+    for (typename Eigen::SparseMatrix<T>::InnerIterator it(pattern, j); it;
+         ++it) {
+      row_cols[it.row()].push_back(j);
+    }
+  }
+
+  std::vector<int> colors(cols, -1);
+  // forbidden[c] == j if color c is used by a neighbor of column j
+  std::vector<int> forbidden;
+  for (int j = 0; j < cols; ++j) {
+    for (typename Eigen::SparseMatrix<T>::InnerIterator it(pattern, j); it;
+         ++it) {
+      for (int k : row_cols[it.row()]) {
+        if (colors[k] >= 0) {
+          forbidden[colors[k]] = j;
+        }
+      }
+    }
+    int color = 0;
+    while (color < static_cast<int>(forbidden.size())
+           && forbidden[color] == j) {
+      ++color;
+    }
+    if (color == static_cast<int>(forbidden.size())) {
+      forbidden.push_back(-1);
+    }
+    colors[j] = color;
+  }
+  return colors;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
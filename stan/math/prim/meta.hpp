@@ -3,6 +3,7 @@
 
 #include <stan/math/prim/meta/ad_promotable.hpp>
 #include <stan/math/prim/meta/append_return_type.hpp>
+#include <stan/math/prim/meta/apply_batch_unary.hpp>
 #include <stan/math/prim/meta/apply_scalar_unary.hpp>
 #include <stan/math/prim/meta/apply_vector_unary.hpp>
 #include <stan/math/prim/meta/as_array_or_scalar.hpp>
@@ -27,6 +28,7 @@
 #include <stan/math/prim/meta/is_var_or_arithmetic.hpp>
 #include <stan/math/prim/meta/is_vector.hpp>
 #include <stan/math/prim/meta/is_vector_like.hpp>
+#include <stan/math/prim/meta/is_vectorizable_density.hpp>
 #include <stan/math/prim/meta/likely.hpp>
 #include <stan/math/prim/meta/max_size.hpp>
 #include <stan/math/prim/meta/max_size_mvt.hpp>
@@ -41,6 +43,7 @@
 #include <stan/math/prim/meta/scalar_seq_view.hpp>
 #include <stan/math/prim/meta/scalar_type.hpp>
 #include <stan/math/prim/meta/scalar_type_pre.hpp>
+#include <stan/math/prim/meta/segment_or_scalar.hpp>
 #include <stan/math/prim/meta/size.hpp>
 #include <stan/math/prim/meta/size_mvt.hpp>
 #include <stan/math/prim/meta/seq_view.hpp>
@@ -0,0 +1,72 @@
+#ifndef STAN_MATH_PRIM_META_APPLY_BATCH_UNARY_HPP
+#define STAN_MATH_PRIM_META_APPLY_BATCH_UNARY_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+
+namespace stan {
+namespace math {
+
+/**
+ * Applies a batch kernel of a unary function to each coefficient of an
+ * Eigen array of arithmetic scalars.
+ *
+ * The kernel is called in loops over blocks of contiguous values of the
+ * argument. Batch kernels avoid branches and calls to library functions,
+ * so these loops can be vectorized by the compiler. A kernel is only
+ * required to be accurate on its domain; the coefficients outside of it
+ * are recomputed by the scalar fallback in a second pass over the block,
+ * which is skipped if all of them are in the domain. Blocks without any
+ * coefficient in the domain skip the kernel, so arrays outside of it
+ * cost little more than the scalar function.
+ *
+ * @tparam Derived derived type of the argument
+ * @tparam Kernel type of the batch kernel
+ * @tparam InDomain type of the predicate for the domain of the kernel
+ * @tparam Fallback type of the scalar function
+ * @param x argument
+ * @param kernel batch kernel, callable with a double
+ * @param in_domain predicate, callable with a double, which returns true
+ * if the kernel is accurate for the argument
+ * @param fallback scalar function, callable with a double
+ * @return array of doubles with the function applied to each coefficient
+ */
+template <typename Derived, typename Kernel, typename InDomain,
+          typename Fallback>
+inline Eigen::Array<double, Derived::RowsAtCompileTime,
+                    Derived::ColsAtCompileTime>
+apply_batch_unary(const Eigen::ArrayBase<Derived>& x, const Kernel& kernel,
+                  const InDomain& in_domain, const Fallback& fallback) {
+  using array_t = Eigen::Array<double, Derived::RowsAtCompileTime,
+                               Derived::ColsAtCompileTime>;
+  const array_t x_val = x.derived().template cast<double>();
+  array_t result(x_val.rows(), x_val.cols());
+  const double* x_data = x_val.data();
+  double* result_data = result.data();
+  const Eigen::Index size = x_val.size();
+  const Eigen::Index block_size = 64;
+  for (Eigen::Index start = 0; start < size; start += block_size) {
+    const Eigen::Index end = std::min(start + block_size, size);
+    Eigen::Index num_in_domain = 0;
+    for (Eigen::Index i = start; i < end; ++i) {
+      num_in_domain += in_domain(x_data[i]);
+    }
+    if (num_in_domain > 0) {
+      for (Eigen::Index i = start; i < end; ++i) {
+        result_data[i] = kernel(x_data[i]);
+      }
+    }
+    if (num_in_domain < end - start) {
+      for (Eigen::Index i = start; i < end; ++i) {
+        if (num_in_domain == 0 || !in_domain(x_data[i])) {
+          result_data[i] = fallback(x_data[i]);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
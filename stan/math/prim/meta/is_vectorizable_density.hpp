@@ -0,0 +1,57 @@
+#ifndef STAN_MATH_PRIM_META_IS_VECTORIZABLE_DENSITY_HPP
+#define STAN_MATH_PRIM_META_IS_VECTORIZABLE_DENSITY_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/meta/bool_constant.hpp>
+#include <stan/math/prim/meta/conjunction.hpp>
+#include <stan/math/prim/meta/disjunction.hpp>
+#include <stan/math/prim/meta/is_var_or_arithmetic.hpp>
+#include <stan/math/prim/meta/is_vector.hpp>
+#include <stan/math/prim/meta/require_generics.hpp>
+#include <stan/math/prim/meta/value_type.hpp>
+#include <type_traits>
+
+namespace stan {
+
+/** \ingroup type_trait
+ * Checks whether the type is a scalar, a <code>std::vector</code> or an
+ * Eigen column vector with <code>var</code> or arithmetic scalars. The
+ * values of such an argument of a univariate density can be processed
+ * as a contiguous Eigen array and its partials can be assigned as a
+ * whole to the edge of <code>operands_and_partials</code>.
+ *
+ * @tparam T type to check
+ */
+template <typename T>
+struct is_vectorizable_density_arg
+    : bool_constant<(is_stan_scalar<T>::value || is_std_vector<T>::value
+                     || is_eigen_col_vector<T>::value)
+                    && is_stan_scalar<value_type_t<T>>::value
+                    && is_var_or_arithmetic<T>::value> {};
+
+/** \ingroup type_trait
+ * Extends std::true_type if all arguments of a univariate density
+ * satisfy <code>is_vectorizable_density_arg</code>, such that the
+ * density can be calculated with Eigen array expressions in place of a
+ * loop over the scalars.
+ *
+ * @tparam T types of the arguments of the density
+ */
+template <typename... T>
+using is_vectorizable_density
+    = math::conjunction<is_vectorizable_density_arg<std::decay_t<T>>...>;
+
+/** \ingroup type_trait
+ * Type of a value which depends on arguments of the specified types
+ * in a vectorized density, <code>Eigen::ArrayXd</code> if any of the
+ * types is a vector and <code>double</code> otherwise.
+ *
+ * @tparam T types of the arguments the value depends on
+ */
+template <typename... T>
+using value_array_or_scalar_t
+    = std::conditional_t<math::disjunction<is_vector<T>...>::value,
+                         Eigen::ArrayXd, double>;
+
+}  // namespace stan
+#endif
@@ -197,6 +197,55 @@ class ops_partials_edge<ViewElt, std::vector<std::vector<Op>>> {
   double dx() const { return 0; }                      // used for fvars
   int size() const { return 0; }
 };
+
+/** \ingroup type_trait
+ * Assigns the partials of a vector operand calculated as an Eigen array
+ * by a vectorized density to its edge.
+ *
+ * @tparam Op type of the operand
+ * @tparam Edge type of the edge of the operand
+ * @tparam Derived type of the array of partials
+ * @param edge edge of the operand
+ * @param partials partials with respect to the elements of the operand
+ */
+template <typename Op, typename Edge, typename Derived,
+          require_vector_t<Op>* = nullptr>
+inline void set_vectorized_partials(Edge& edge,
+                                    const Eigen::ArrayBase<Derived>& partials) {
+  edge.partials_ = partials.matrix();
+}
+
+/** \ingroup type_trait
+ * Assigns the sum of the partials with respect to a scalar operand,
+ * which is broadcast over the elements of the vector arguments of a
+ * vectorized density, to its edge.
+ *
+ * @tparam Op type of the operand
+ * @tparam Edge type of the edge of the operand
+ * @tparam Derived type of the array of partials
+ * @param edge edge of the operand
+ * @param partials partials for each element the operand is broadcast to
+ */
+template <typename Op, typename Edge, typename Derived,
+          require_not_vector_t<Op>* = nullptr>
+inline void set_vectorized_partials(Edge& edge,
+                                    const Eigen::ArrayBase<Derived>& partials) {
+  edge.partials_[0] = partials.sum();
+}
+
+/** \ingroup type_trait
+ * Assigns the partial with respect to a scalar operand of a vectorized
+ * density with scalar arguments only to its edge.
+ *
+ * @tparam Op type of the operand
+ * @tparam Edge type of the edge of the operand
+ * @param edge edge of the operand
+ * @param partial partial with respect to the operand
+ */
+template <typename Op, typename Edge, require_not_vector_t<Op>* = nullptr>
+inline void set_vectorized_partials(Edge& edge, double partial) {
+  edge.partials_[0] = partial;
+}
 }  // namespace internal
 }  // namespace math
 }  // namespace stan
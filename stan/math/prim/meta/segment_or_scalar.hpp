@@ -0,0 +1,44 @@
+#ifndef STAN_MATH_PRIM_META_SEGMENT_OR_SCALAR_HPP
+#define STAN_MATH_PRIM_META_SEGMENT_OR_SCALAR_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/meta/require_generics.hpp>
+
+namespace stan {
+namespace math {
+
+/** \ingroup type_trait
+ * Returns the specified scalar, which is broadcast to every segment of
+ * the vector arguments it is combined with.
+ *
+ * @tparam T type of the scalar
+ * @param x scalar
+ * @return the scalar
+ */
+template <typename T, require_stan_scalar_t<T>* = nullptr>
+inline T& segment_or_scalar(T& x, size_t /* start */, size_t /* n */) {
+  return x;
+}
+
+/** \ingroup type_trait
+ * Returns the segment of an Eigen column vector or array starting at the
+ * specified index. The segment can be assigned to if the argument is
+ * not const. It is returned as a block of rows rather than as an
+ * <code>Eigen::VectorBlock</code>, which <code>is_eigen</code> does not
+ * recognize, so that it can be passed to the vectorized functions.
+ *
+ * @tparam T type of the vector or array, or an expression of it
+ * @param x vector or array
+ * @param start index of the first element of the segment
+ * @param n number of elements in the segment
+ * @return segment of x
+ */
+template <typename T, require_eigen_t<T>* = nullptr>
+inline auto segment_or_scalar(T& x, size_t start, size_t n) {
+  return x.middleRows(start, n);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -35,15 +35,18 @@
 #include <stan/math/prim/prob/beta_proportion_lccdf.hpp>
 #include <stan/math/prim/prob/beta_proportion_lcdf.hpp>
 #include <stan/math/prim/prob/beta_proportion_log.hpp>
+#include <stan/math/prim/prob/beta_proportion_logit_glm_lpdf.hpp>
 #include <stan/math/prim/prob/beta_proportion_lpdf.hpp>
 #include <stan/math/prim/prob/beta_proportion_rng.hpp>
 #include <stan/math/prim/prob/beta_rng.hpp>
+#include <stan/math/prim/prob/binomial_bulk_rng.hpp>
 #include <stan/math/prim/prob/binomial_ccdf_log.hpp>
 #include <stan/math/prim/prob/binomial_cdf.hpp>
 #include <stan/math/prim/prob/binomial_cdf_log.hpp>
 #include <stan/math/prim/prob/binomial_lccdf.hpp>
 #include <stan/math/prim/prob/binomial_lcdf.hpp>
 #include <stan/math/prim/prob/binomial_log.hpp>
+#include <stan/math/prim/prob/binomial_logit_glm_lpmf.hpp>
 #include <stan/math/prim/prob/binomial_logit_log.hpp>
 #include <stan/math/prim/prob/binomial_logit_lpmf.hpp>
 #include <stan/math/prim/prob/binomial_lpmf.hpp>
@@ -107,12 +110,14 @@
 #include <stan/math/prim/prob/frechet_log.hpp>
 #include <stan/math/prim/prob/frechet_lpdf.hpp>
 #include <stan/math/prim/prob/frechet_rng.hpp>
+#include <stan/math/prim/prob/gamma_bulk_rng.hpp>
 #include <stan/math/prim/prob/gamma_ccdf_log.hpp>
 #include <stan/math/prim/prob/gamma_cdf.hpp>
 #include <stan/math/prim/prob/gamma_cdf_log.hpp>
 #include <stan/math/prim/prob/gamma_lccdf.hpp>
 #include <stan/math/prim/prob/gamma_lcdf.hpp>
 #include <stan/math/prim/prob/gamma_log.hpp>
+#include <stan/math/prim/prob/gamma_log_glm_lpdf.hpp>
 #include <stan/math/prim/prob/gamma_lpdf.hpp>
 #include <stan/math/prim/prob/gamma_rng.hpp>
 #include <stan/math/prim/prob/gaussian_dlm_obs_log.hpp>
@@ -167,6 +172,7 @@
 #include <stan/math/prim/prob/lognormal_ccdf_log.hpp>
 #include <stan/math/prim/prob/lognormal_cdf.hpp>
 #include <stan/math/prim/prob/lognormal_cdf_log.hpp>
+#include <stan/math/prim/prob/lognormal_id_glm_lpdf.hpp>
 #include <stan/math/prim/prob/lognormal_lccdf.hpp>
 #include <stan/math/prim/prob/lognormal_lcdf.hpp>
 #include <stan/math/prim/prob/lognormal_log.hpp>
@@ -215,6 +221,7 @@
 #include <stan/math/prim/prob/neg_binomial_log.hpp>
 #include <stan/math/prim/prob/neg_binomial_lpmf.hpp>
 #include <stan/math/prim/prob/neg_binomial_rng.hpp>
+#include <stan/math/prim/prob/normal_bulk_rng.hpp>
 #include <stan/math/prim/prob/normal_ccdf_log.hpp>
 #include <stan/math/prim/prob/normal_cdf.hpp>
 #include <stan/math/prim/prob/normal_cdf_log.hpp>
@@ -250,6 +257,7 @@
 #include <stan/math/prim/prob/pareto_type_2_log.hpp>
 #include <stan/math/prim/prob/pareto_type_2_lpdf.hpp>
 #include <stan/math/prim/prob/pareto_type_2_rng.hpp>
+#include <stan/math/prim/prob/poisson_bulk_rng.hpp>
 #include <stan/math/prim/prob/poisson_ccdf_log.hpp>
 #include <stan/math/prim/prob/poisson_cdf.hpp>
 #include <stan/math/prim/prob/poisson_cdf_log.hpp>
@@ -298,11 +306,13 @@
 #include <stan/math/prim/prob/student_t_ccdf_log.hpp>
 #include <stan/math/prim/prob/student_t_cdf.hpp>
 #include <stan/math/prim/prob/student_t_cdf_log.hpp>
+#include <stan/math/prim/prob/student_t_id_glm_lpdf.hpp>
 #include <stan/math/prim/prob/student_t_lccdf.hpp>
 #include <stan/math/prim/prob/student_t_lcdf.hpp>
 #include <stan/math/prim/prob/student_t_log.hpp>
 #include <stan/math/prim/prob/student_t_lpdf.hpp>
 #include <stan/math/prim/prob/student_t_rng.hpp>
+#include <stan/math/prim/prob/uniform_bulk_rng.hpp>
 #include <stan/math/prim/prob/uniform_ccdf_log.hpp>
 #include <stan/math/prim/prob/uniform_cdf.hpp>
 #include <stan/math/prim/prob/uniform_cdf_log.hpp>
@@ -6,8 +6,11 @@
 #include <stan/math/prim/fun/constants.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -81,7 +84,6 @@ return_type_t<T_x_scalar, T_alpha, T_beta> bernoulli_logit_glm_lpmf(
     return 0;
   }
 
-  T_partials_return logp(0);
   const auto &x_val = value_of_rec(x);
   const auto &y_val = value_of_rec(y);
   const auto &beta_val = value_of_rec(beta);
@@ -92,28 +94,68 @@ return_type_t<T_x_scalar, T_alpha, T_beta> bernoulli_logit_glm_lpmf(
   const auto &alpha_val_vec = as_column_vector_or_scalar(alpha_val);
 
   T_y_val signs = 2 * as_array_or_scalar(y_val_vec) - 1;
+  const auto &signs_arr = as_array_or_scalar(signs);
+  const auto &alpha_arr = as_array_or_scalar(alpha_val_vec);
 
-  Array<T_partials_return, Dynamic, 1> ytheta(N_instances);
+  T_ytheta_tmp ytheta_tmp(0);
   if (T_x_rows == 1) {
-    T_ytheta_tmp ytheta_tmp
-        = forward_as<T_ytheta_tmp>((x_val * beta_val_vec)(0, 0));
-    ytheta = as_array_or_scalar(signs)
-             * (ytheta_tmp + as_array_or_scalar(alpha_val_vec));
-  } else {
-    ytheta = (x_val * beta_val_vec).array();
-    ytheta = as_array_or_scalar(signs)
-             * (ytheta + as_array_or_scalar(alpha_val_vec));
+    ytheta_tmp = forward_as<T_ytheta_tmp>((x_val * beta_val_vec)(0, 0));
   }
 
   // Compute the log-density and handle extreme values gracefully
   // using Taylor approximations.
   // And compute the derivatives wrt theta.
   static const double cutoff = 20.0;
-  Eigen::Array<T_partials_return, Dynamic, 1> exp_m_ytheta = exp(-ytheta);
-  logp += sum(
-      (ytheta > cutoff)
-          .select(-exp_m_ytheta,
-                  (ytheta < -cutoff).select(ytheta, -log1p(exp_m_ytheta))));
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Array<T_partials_return, Dynamic, 1> ytheta(N_instances);
+  Matrix<T_partials_return, Dynamic, 1> theta_derivative;
+  if (!is_constant_all<T_beta, T_x_scalar, T_alpha>::value) {
+    theta_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto &signs_chunk = segment_or_scalar(signs_arr, start, n);
+        auto ytheta_chunk = ytheta.segment(start, n);
+        if (T_x_rows == 1) {
+          ytheta_chunk
+              = signs_chunk
+                * (ytheta_tmp + segment_or_scalar(alpha_arr, start, n));
+        } else {
+          ytheta_chunk = (x_val.middleRows(start, n) * beta_val_vec).array();
+          ytheta_chunk
+              = signs_chunk
+                * (ytheta_chunk + segment_or_scalar(alpha_arr, start, n));
+        }
+        const Array<T_partials_return, Dynamic, 1> exp_m_ytheta
+            = exp(-ytheta_chunk);
+        logp_chunks[chunk] = sum(
+            (ytheta_chunk > cutoff)
+                .select(-exp_m_ytheta, (ytheta_chunk < -cutoff)
+                                           .select(ytheta_chunk,
+                                                   -log1p(exp_m_ytheta))));
+        if (!is_constant_all<T_beta, T_x_scalar, T_alpha>::value) {
+          theta_derivative.segment(start, n)
+              = (ytheta_chunk > cutoff)
+                    .select(-exp_m_ytheta,
+                            (ytheta_chunk < -cutoff)
+                                .select(signs_chunk, signs_chunk * exp_m_ytheta
+                                                         / (exp_m_ytheta + 1)))
+                    .matrix();
+          if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+            beta_derivative_chunks.col(chunk)
+                = x_val.middleRows(start, n).transpose()
+                  * theta_derivative.segment(start, n);
+          }
+        }
+      });
+  T_partials_return logp = sum(logp_chunks);
 
   if (!std::isfinite(logp)) {
     check_finite(function, "Weight vector", beta);
@@ -126,20 +168,13 @@ return_type_t<T_x_scalar, T_alpha, T_beta> bernoulli_logit_glm_lpmf(
       ops_partials(x, alpha, beta);
   // Compute the necessary derivatives.
   if (!is_constant_all<T_beta, T_x_scalar, T_alpha>::value) {
-    Matrix<T_partials_return, Dynamic, 1> theta_derivative
-        = (ytheta > cutoff)
-              .select(-exp_m_ytheta,
-                      (ytheta < -cutoff)
-                          .select(as_array_or_scalar(signs),
-                                  as_array_or_scalar(signs) * exp_m_ytheta
-                                      / (exp_m_ytheta + 1)));
     if (!is_constant_all<T_beta>::value) {
       if (T_x_rows == 1) {
         ops_partials.edge3_.partials_
             = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
                 theta_derivative.sum() * x_val);
       } else {
-        ops_partials.edge3_.partials_ = x_val.transpose() * theta_derivative;
+        ops_partials.edge3_.partials_ = beta_derivative_chunks.rowwise().sum();
       }
     }
     if (!is_constant_all<T_x_scalar>::value) {
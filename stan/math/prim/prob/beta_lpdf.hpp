@@ -3,59 +3,45 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_array_or_scalar.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/log1m.hpp>
 #include <stan/math/prim/fun/multiply_log.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
 /** \ingroup prob_dists
- * The log of the beta density for the specified scalar(s) given the specified
- * sample size(s). y, alpha, or beta can each either be scalar or a vector.
- * Any vector inputs must be the same length.
- *
- * <p> The result log probability is defined to be the sum of
- * the log probabilities for each observation/alpha/beta triple.
- *
- * Prior sample sizes, alpha and beta, must be greater than 0.
+ * Calculates the log of the beta density and its partials with a
+ * loop over the scalars of the arguments.
  *
- * @param y (Sequence of) scalar(s).
- * @param alpha (Sequence of) prior sample size(s).
- * @param beta (Sequence of) prior sample size(s).
- * @return The log of the product of densities.
- * @tparam T_y Type of scalar outcome.
- * @tparam T_scale_succ Type of prior scale for successes.
- * @tparam T_scale_fail Type of prior scale for failures.
+ * @tparam T_y type of scalar outcome
+ * @tparam T_scale_succ type of prior scale for successes
+ * @tparam T_scale_fail type of prior scale for failures
+ * @param y (sequence of) scalar(s) in [0, 1]
+ * @param alpha (sequence of) prior sample size(s)
+ * @param beta (sequence of) prior sample size(s)
+ * @return log of the product of the densities
  */
 template <bool propto, typename T_y, typename T_scale_succ,
-          typename T_scale_fail>
-return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf(
+          typename T_scale_fail,
+          require_not_t<is_vectorizable_density<T_y, T_scale_succ,
+                                                T_scale_fail>>* = nullptr>
+inline return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf_impl(
     const T_y& y, const T_scale_succ& alpha, const T_scale_fail& beta) {
-  static const char* function = "beta_lpdf";
-
   using T_partials_return = partials_return_t<T_y, T_scale_succ, T_scale_fail>;
   using std::log;
-  check_positive_finite(function, "First shape parameter", alpha);
-  check_positive_finite(function, "Second shape parameter", beta);
-  check_not_nan(function, "Random variable", y);
-  check_consistent_sizes(function, "Random variable", y,
-                         "First shape parameter", alpha,
-                         "Second shape parameter", beta);
-  check_nonnegative(function, "Random variable", y);
-  check_less_or_equal(function, "Random variable", y, 1);
-
-  if (size_zero(y, alpha, beta)) {
-    return 0;
-  }
-  if (!include_summand<propto, T_y, T_scale_succ, T_scale_fail>::value) {
-    return 0;
-  }
 
   T_partials_return logp(0);
   scalar_seq_view<T_y> y_vec(y);
@@ -63,13 +49,6 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf(
   scalar_seq_view<T_scale_fail> beta_vec(beta);
   size_t N = max_size(y, alpha, beta);
 
-  for (size_t n = 0; n < N; n++) {
-    const T_partials_return y_dbl = value_of(y_vec[n]);
-    if (y_dbl < 0 || y_dbl > 1) {
-      return LOG_ZERO;
-    }
-  }
-
   operands_and_partials<T_y, T_scale_succ, T_scale_fail> ops_partials(y, alpha,
                                                                       beta);
 
@@ -176,6 +155,161 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf(
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * Calculates the log of the beta density and its partials with
+ * Eigen array expressions over all elements of the arguments.
+ *
+ * @tparam T_y type of scalar outcome
+ * @tparam T_scale_succ type of prior scale for successes
+ * @tparam T_scale_fail type of prior scale for failures
+ * @param y (sequence of) scalar(s) in [0, 1]
+ * @param alpha (sequence of) prior sample size(s)
+ * @param beta (sequence of) prior sample size(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_scale_succ,
+          typename T_scale_fail,
+          require_t<is_vectorizable_density<T_y, T_scale_succ,
+                                            T_scale_fail>>* = nullptr>
+inline return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf_impl(
+    const T_y& y, const T_scale_succ& alpha, const T_scale_fail& beta) {
+  using std::log;
+
+  const auto& y_val = as_value_array_or_scalar(y);
+  const auto& alpha_val = as_value_array_or_scalar(alpha);
+  const auto& beta_val = as_value_array_or_scalar(beta);
+  const size_t N = max_size(y, alpha, beta);
+
+  using T_partials_array
+      = value_array_or_scalar_t<T_y, T_scale_succ, T_scale_fail>;
+
+  T_partials_array y_deriv = T_partials_array();
+  T_partials_array alpha_deriv = T_partials_array();
+  T_partials_array beta_deriv = T_partials_array();
+  if (!is_constant_all<T_y>::value) {
+    y_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_scale_succ>::value) {
+    alpha_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_scale_fail>::value) {
+    beta_deriv = T_partials_array(N);
+  }
+
+  const size_t num_chunks = num_parallel_chunks(N);
+  std::vector<double> logp_chunks(num_chunks);
+  parallel_chunks(N, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+    const size_t n = end - start;
+    const auto& y_chunk = segment_or_scalar(y_val, start, n);
+    const auto& alpha_chunk = segment_or_scalar(alpha_val, start, n);
+    const auto& beta_chunk = segment_or_scalar(beta_val, start, n);
+    const value_array_or_scalar_t<T_y> log_y = log(y_chunk);
+    const value_array_or_scalar_t<T_y> log1m_y = log1m(y_chunk);
+
+    double logp_chunk = 0.0;
+    if (include_summand<propto, T_scale_succ, T_scale_fail>::value) {
+      logp_chunk += sum(lgamma(alpha_chunk + beta_chunk)) * n
+                    / max_size(alpha_chunk, beta_chunk);
+    }
+    if (include_summand<propto, T_scale_succ>::value) {
+      logp_chunk -= sum(lgamma(alpha_chunk)) * n / size(alpha_chunk);
+    }
+    if (include_summand<propto, T_scale_fail>::value) {
+      logp_chunk -= sum(lgamma(beta_chunk)) * n / size(beta_chunk);
+    }
+    if (include_summand<propto, T_y, T_scale_succ>::value) {
+      logp_chunk += sum((alpha_chunk - 1.0) * log_y) * n
+                    / max_size(y_chunk, alpha_chunk);
+    }
+    if (include_summand<propto, T_y, T_scale_fail>::value) {
+      logp_chunk += sum((beta_chunk - 1.0) * log1m_y) * n
+                    / max_size(y_chunk, beta_chunk);
+    }
+    logp_chunks[chunk] = logp_chunk;
+
+    if (!is_constant_all<T_y>::value) {
+      segment_or_scalar(y_deriv, start, n)
+          = (alpha_chunk - 1) / y_chunk + (beta_chunk - 1) / (y_chunk - 1);
+    }
+    if (!is_constant_all<T_scale_succ, T_scale_fail>::value) {
+      const value_array_or_scalar_t<T_scale_succ, T_scale_fail>
+          digamma_alpha_beta = digamma(alpha_chunk + beta_chunk);
+      if (!is_constant_all<T_scale_succ>::value) {
+        segment_or_scalar(alpha_deriv, start, n)
+            = log_y + digamma_alpha_beta - digamma(alpha_chunk);
+      }
+      if (!is_constant_all<T_scale_fail>::value) {
+        segment_or_scalar(beta_deriv, start, n)
+            = log1m_y + digamma_alpha_beta - digamma(beta_chunk);
+      }
+    }
+  });
+
+  operands_and_partials<T_y, T_scale_succ, T_scale_fail> ops_partials(y, alpha,
+                                                                      beta);
+  if (!is_constant_all<T_y>::value) {
+    set_vectorized_partials<T_y>(ops_partials.edge1_, y_deriv);
+  }
+  if (!is_constant_all<T_scale_succ>::value) {
+    set_vectorized_partials<T_scale_succ>(ops_partials.edge2_, alpha_deriv);
+  }
+  if (!is_constant_all<T_scale_fail>::value) {
+    set_vectorized_partials<T_scale_fail>(ops_partials.edge3_, beta_deriv);
+  }
+  return ops_partials.build(sum(logp_chunks));
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * The log of the beta density for the specified scalar(s) given the specified
+ * sample size(s). y, alpha, or beta can each either be scalar or a vector.
+ * Any vector inputs must be the same length.
+ *
+ * <p> The result log probability is defined to be the sum of
+ * the log probabilities for each observation/alpha/beta triple.
+ *
+ * Prior sample sizes, alpha and beta, must be greater than 0.
+ *
+ * @param y (Sequence of) scalar(s).
+ * @param alpha (Sequence of) prior sample size(s).
+ * @param beta (Sequence of) prior sample size(s).
+ * @return The log of the product of densities.
+ * @tparam T_y Type of scalar outcome.
+ * @tparam T_scale_succ Type of prior scale for successes.
+ * @tparam T_scale_fail Type of prior scale for failures.
+ */
+template <bool propto, typename T_y, typename T_scale_succ,
+          typename T_scale_fail>
+return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf(
+    const T_y& y, const T_scale_succ& alpha, const T_scale_fail& beta) {
+  static const char* function = "beta_lpdf";
+  check_positive_finite(function, "First shape parameter", alpha);
+  check_positive_finite(function, "Second shape parameter", beta);
+  check_not_nan(function, "Random variable", y);
+  check_consistent_sizes(function, "Random variable", y,
+                         "First shape parameter", alpha,
+                         "Second shape parameter", beta);
+  check_nonnegative(function, "Random variable", y);
+  check_less_or_equal(function, "Random variable", y, 1);
+
+  if (size_zero(y, alpha, beta)) {
+    return 0;
+  }
+  if (!include_summand<propto, T_y, T_scale_succ, T_scale_fail>::value) {
+    return 0;
+  }
+
+  scalar_seq_view<T_y> y_vec(y);
+  for (size_t n = 0; n < size(y); n++) {
+    if (value_of(y_vec[n]) < 0 || value_of(y_vec[n]) > 1) {
+      return LOG_ZERO;
+    }
+  }
+
+  return internal::beta_lpdf_impl<propto>(y, alpha, beta);
+}
+
 template <typename T_y, typename T_scale_succ, typename T_scale_fail>
 inline return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lpdf(
     const T_y& y, const T_scale_succ& alpha, const T_scale_fail& beta) {
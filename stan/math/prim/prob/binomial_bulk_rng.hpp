@@ -0,0 +1,118 @@
+#ifndef STAN_MATH_PRIM_PROB_BINOMIAL_BULK_RNG_HPP
+#define STAN_MATH_PRIM_PROB_BINOMIAL_BULK_RNG_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/discrete_inversion_table.hpp>
+#include <stan/math/prim/fun/philox4x32.hpp>
+#include <stan/math/prim/functor/bulk_rng_draws.hpp>
+#include <boost/random/binomial_distribution.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Returns the probabilities of 0, 1, ..., K of a binomial distribution,
+ * where K is the population size or the first value above the mean
+ * whose probability is below 1e-18, whichever is smaller. After the
+ * mean the probabilities decrease faster than geometrically with ratio
+ * below mean / (mean + 1), so the mass left out is below the mean times
+ * 1e-18.
+ *
+ * @param N population size
+ * @param theta chance of success, 0 <= theta < 1
+ * @return probabilities of 0, ..., K
+ */
+inline std::vector<double> binomial_pmf_head(int N, double theta) {
+  std::vector<double> pmf;
+  const double odds = theta / (1 - theta);
+  double p = std::exp(N * std::log1p(-theta));
+  pmf.push_back(p);
+  for (int k = 0; k < N && (k <= N * theta || p >= 1e-18);) {
+    p *= (N - k) * odds;
+    ++k;
+    p /= k;
+    pmf.push_back(p);
+  }
+  return pmf;
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * Return the specified number of binomial random variates for the given
+ * population size and chance of success using the specified
+ * counter-based random number generator.
+ *
+ * For a scalar population size and chance of success with fewer than
+ * 100 expected successes or failures the variates are drawn by
+ * inversion with an internal::discrete_inversion_table, which takes a
+ * single uniform variate and a few comparisons per variate instead of
+ * the setup and the steps of inversion or rejection for each variate.
+ * Otherwise they are drawn by inversion or rejection with the Boost
+ * binomial distribution. Each run of consecutive variates uses its own
+ * substream of the generator, so runs are independent of each other and
+ * are drawn in parallel chunks if STAN_THREADS is defined and the number
+ * of variates is large. The result only depends on the state of the
+ * generator and not on the number of threads. The generator is advanced
+ * past the blocks reserved for the substreams.
+ *
+ * N and theta can each be a scalar or a one-dimensional container of
+ * size n_draws.
+ *
+ * @tparam T_N type of population size parameter
+ * @tparam T_theta type of chance of success parameter
+ * @param N (Sequence of) population size parameter(s)
+ * @param theta (Sequence of) chance of success parameter(s)
+ * @param n_draws number of variates
+ * @param rng random number generator
+ * @return binomial random variates
+ * @throw std::domain_error if N is negative or theta is not a valid
+ * probability
+ * @throw std::invalid_argument if non-scalar arguments are not of size
+ * n_draws
+ */
+template <typename T_N, typename T_theta>
+inline std::vector<int> binomial_bulk_rng(const T_N& N, const T_theta& theta,
+                                          std::size_t n_draws,
+                                          philox4x32& rng) {
+  using boost::binomial_distribution;
+  static const char* function = "binomial_bulk_rng";
+
+  check_nonnegative(function, "Population size parameter", N);
+  check_bounded(function, "Probability parameter", theta, 0.0, 1.0);
+  check_consistent_size(function, "Population size parameter", N, n_draws);
+  check_consistent_size(function, "Probability parameter", theta, n_draws);
+
+  scalar_seq_view<T_N> N_vec(N);
+  scalar_seq_view<T_theta> theta_vec(theta);
+  std::vector<int> output(n_draws);
+  if (!is_vector<T_N>::value && !is_vector<T_theta>::value) {
+    // count the rarer outcome, so the table is short
+    const int N_int = N_vec[0];
+    const bool count_failures = theta_vec[0] > 0.5;
+    const double theta_rare = count_failures ? 1 - theta_vec[0] : theta_vec[0];
+    if (N_int * theta_rare < 100) {
+      const internal::discrete_inversion_table table(
+          internal::binomial_pmf_head(N_int, theta_rare));
+      internal::bulk_rng_draws(
+          n_draws, rng, [&](std::size_t n, philox4x32& sub) {
+            const int k = table(internal::philox_unit_interval(sub));
+            output[n] = count_failures ? N_int - k : k;
+          });
+      return output;
+    }
+  }
+  internal::bulk_rng_draws(n_draws, rng, [&](std::size_t n, philox4x32& sub) {
+    output[n] = binomial_distribution<>(N_vec[n], theta_vec[n])(sub);
+  });
+  return output;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
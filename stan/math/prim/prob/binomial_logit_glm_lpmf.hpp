@@ -0,0 +1,212 @@
+#ifndef STAN_MATH_PRIM_PROB_BINOMIAL_LOGIT_GLM_LPMF_HPP
+#define STAN_MATH_PRIM_PROB_BINOMIAL_LOGIT_GLM_LPMF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/binomial_coefficient_log.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/** \ingroup multivar_dists
+ * Returns the log PMF of the Generalized Linear Model (GLM)
+ * with Binomial distribution and logit link function.
+ * The idea is that binomial_logit_glm_lpmf(n, N, x, alpha, beta) should
+ * compute a more efficient version of
+ * binomial_logit_lpmf(n, N, alpha + x * beta) by using analytically
+ * simplified gradients.
+ * If containers are supplied, returns the log sum of the probabilities.
+ * @tparam T_n type of integer vector of successes;
+ * this can also be a single integer value;
+ * @tparam T_N type of integer vector of population sizes;
+ * this can also be a single integer value;
+ * @tparam T_x_scalar type of a scalar in the matrix of independent variables
+ * (features)
+ * @tparam T_x_rows compile-time number of rows of `x`. It can be either
+ * `Eigen::Dynamic` or 1.
+ * @tparam T_alpha type of the intercept(s);
+ * this can be a vector (of the same length as n) of intercepts or a single
+ * value (for models with constant intercept);
+ * @tparam T_beta type of the weight vector;
+ * this can also be a single value;
+ * @param n successes scalar or vector parameter. If it is a scalar it will be
+ * broadcast - used for all instances.
+ * @param N population size scalar or vector parameter. If it is a scalar it
+ * will be broadcast - used for all instances.
+ * @param x design matrix or row vector. If it is a row vector it will be
+ * broadcast - used for all instances.
+ * @param alpha intercept (in log odds)
+ * @param beta weight vector
+ * @return log probability or log sum of probabilities
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if N is negative or n is not in [0, N].
+ * @throw std::invalid_argument if container sizes mismatch.
+ */
+template <bool propto, typename T_n, typename T_N, typename T_x_scalar,
+          int T_x_rows, typename T_alpha, typename T_beta>
+return_type_t<T_x_scalar, T_alpha, T_beta> binomial_logit_glm_lpmf(
+    const T_n &n, const T_N &N,
+    const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic> &x,
+    const T_alpha &alpha, const T_beta &beta) {
+  static const char *function = "binomial_logit_glm_lpmf";
+
+  using Eigen::Array;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using Eigen::exp;
+  using Eigen::log1p;
+
+  using T_partials_return
+      = partials_return_t<T_n, T_N, T_x_scalar, T_alpha, T_beta>;
+  using T_theta_tmp =
+      typename std::conditional_t<T_x_rows == 1, T_partials_return,
+                                  Array<T_partials_return, Dynamic, 1>>;
+
+  const size_t N_instances = T_x_rows == 1 ? max_size(n, N) : x.rows();
+  const size_t N_attributes = x.cols();
+
+  check_consistent_size(function, "Successes variable", n, N_instances);
+  check_consistent_size(function, "Population size parameter", N,
+                        N_instances);
+  check_consistent_size(function, "Weight vector", beta, N_attributes);
+  check_consistent_size(function, "Vector of intercepts", alpha, N_instances);
+  check_bounded(function, "Successes variable", n, 0, N);
+  check_nonnegative(function, "Population size parameter", N);
+
+  if (size_zero(n, N)) {
+    return 0;
+  }
+
+  if (!include_summand<propto, T_x_scalar, T_alpha, T_beta>::value) {
+    return 0;
+  }
+
+  const auto &x_val = value_of_rec(x);
+  const auto &n_val = value_of_rec(n);
+  const auto &N_val = value_of_rec(N);
+  const auto &beta_val = value_of_rec(beta);
+  const auto &alpha_val = value_of_rec(alpha);
+
+  const auto &n_val_vec = as_column_vector_or_scalar(n_val);
+  const auto &N_val_vec = as_column_vector_or_scalar(N_val);
+  const auto &beta_val_vec = as_column_vector_or_scalar(beta_val);
+  const auto &alpha_val_vec = as_column_vector_or_scalar(alpha_val);
+
+  const auto &n_arr = as_array_or_scalar(n_val_vec);
+  const auto &N_arr = as_array_or_scalar(N_val_vec);
+  const auto &alpha_arr = as_array_or_scalar(alpha_val_vec);
+
+  T_theta_tmp theta_tmp(0);
+  if (T_x_rows == 1) {
+    theta_tmp = forward_as<T_theta_tmp>((x_val * beta_val_vec)(0, 0));
+  }
+
+  scalar_seq_view<T_n> n_vec(n);
+  scalar_seq_view<T_N> N_vec(N);
+
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Array<T_partials_return, Dynamic, 1> theta(N_instances);
+  Matrix<T_partials_return, Dynamic, 1> theta_derivative;
+  if (!is_constant_all<T_beta, T_x_scalar, T_alpha>::value) {
+    theta_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t len = end - start;
+        const auto &n_chunk = segment_or_scalar(n_arr, start, len);
+        const auto &N_chunk = segment_or_scalar(N_arr, start, len);
+        auto theta_chunk = theta.segment(start, len);
+        if (T_x_rows == 1) {
+          theta_chunk = theta_tmp + segment_or_scalar(alpha_arr, start, len);
+        } else {
+          theta_chunk = (x_val.middleRows(start, len) * beta_val_vec).array();
+          theta_chunk += segment_or_scalar(alpha_arr, start, len);
+        }
+
+        // log(inv_logit(theta)), computed without overflow for large |theta|
+        const Array<T_partials_return, Dynamic, 1> log_inv_logit_theta
+            = theta_chunk.min(0.0) - log1p(exp(-theta_chunk.abs()));
+
+        // n * log(inv_logit(theta)) + (N - n) * log(1 - inv_logit(theta))
+        logp_chunks[chunk] = sum(N_chunk * log_inv_logit_theta
+                                 - (N_chunk - n_chunk) * theta_chunk);
+        if (include_summand<propto>::value) {
+          for (size_t i = start; i < end; ++i) {
+            logp_chunks[chunk] += binomial_coefficient_log(N_vec[i], n_vec[i]);
+          }
+        }
+
+        if (!is_constant_all<T_beta, T_x_scalar, T_alpha>::value) {
+          theta_derivative.segment(start, len)
+              = (n_chunk - N_chunk * exp(log_inv_logit_theta)).matrix();
+          if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+            beta_derivative_chunks.col(chunk)
+                = x_val.middleRows(start, len).transpose()
+                  * theta_derivative.segment(start, len);
+          }
+        }
+      });
+  T_partials_return logp = sum(logp_chunks);
+
+  if (!std::isfinite(logp)) {
+    check_finite(function, "Weight vector", beta);
+    check_finite(function, "Intercept", alpha);
+    check_finite(function, "Matrix of independent variables", theta);
+  }
+
+  operands_and_partials<Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>,
+                        T_alpha, T_beta>
+      ops_partials(x, alpha, beta);
+  // Compute the necessary derivatives.
+  if (!is_constant_all<T_beta>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge3_.partials_
+          = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
+              theta_derivative.sum() * x_val);
+    } else {
+      ops_partials.edge3_.partials_ = beta_derivative_chunks.rowwise().sum();
+    }
+  }
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge1_.partials_
+          = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
+              beta_val_vec * theta_derivative.sum());
+    } else {
+      ops_partials.edge1_.partials_
+          = (beta_val_vec * theta_derivative.transpose()).transpose();
+    }
+  }
+  if (!is_constant_all<T_alpha>::value) {
+    if (is_vector<T_alpha>::value) {
+      ops_partials.edge2_.partials_ = std::move(theta_derivative);
+    } else {
+      ops_partials.edge2_.partials_[0] = sum(theta_derivative);
+    }
+  }
+  return ops_partials.build(logp);
+}
+
+template <typename T_n, typename T_N, typename T_x, typename T_alpha,
+          typename T_beta>
+inline return_type_t<T_x, T_alpha, T_beta> binomial_logit_glm_lpmf(
+    const T_n &n, const T_N &N, const T_x &x, const T_alpha &alpha,
+    const T_beta &beta) {
+  return binomial_logit_glm_lpmf<false>(n, N, x, alpha, beta);
+}
+}  // namespace math
+}  // namespace stan
+#endif
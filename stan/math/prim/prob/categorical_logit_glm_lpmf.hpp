@@ -4,8 +4,11 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <Eigen/Core>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -77,32 +80,99 @@ categorical_logit_glm_lpmf(
 
   const auto& alpha_val_vec = as_column_vector_or_scalar(alpha_val).transpose();
 
-  Array<T_partials_return, T_x_rows, Dynamic> lin
-      = (x_val * beta_val).rowwise() + alpha_val_vec;
-  Array<T_partials_return, T_x_rows, 1> lin_max
-      = lin.rowwise().maxCoeff();  // This is used to prevent overflow when
-                                   // calculating softmax/log_sum_exp and
-                                   // similar expressions
-  Array<T_partials_return, T_x_rows, Dynamic> exp_lin
-      = exp(lin.colwise() - lin_max);
-  Array<T_partials_return, T_x_rows, 1> inv_sum_exp_lin
-      = 1 / exp_lin.rowwise().sum();
-
-  T_partials_return logp = log(inv_sum_exp_lin).sum() - lin_max.sum();
-  if (T_x_rows == 1) {
-    logp *= N_instances;
-  }
   scalar_seq_view<T_y> y_seq(y);
-  for (int i = 0; i < N_instances; i++) {
-    if (T_x_rows == 1) {
-      logp += lin(0, y_seq[i] - 1);
-    } else {
-      logp += lin(i, y_seq[i] - 1);
-    }
+
+  // If x is a row vector, all instances share the same linear predictor,
+  // so it is evaluated in a single chunk.
+  const size_t num_chunks
+      = T_x_rows == 1
+            ? 1
+            : internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Array<T_partials_return, T_x_rows, Dynamic> x_derivative;
+  if (!is_constant_all<T_x_scalar>::value) {
+    x_derivative.resize(x.rows(), N_attributes);
+  }
+  Matrix<T_partials_return, Dynamic, Dynamic> alpha_derivative_chunks;
+  if (!is_constant_all<T_alpha_scalar>::value) {
+    alpha_derivative_chunks.resize(N_classes, num_chunks);
   }
-  // TODO(Tadej) maybe we can replace previous block with the following line
-  // when we have newer Eigen  T_partials_return logp =
-  // lin(Eigen::all,y-1).sum() + log(inv_sum_exp_lin).sum() - lin_max.sum();
+  std::vector<Matrix<T_partials_return, Dynamic, Dynamic>>
+      beta_derivative_chunks;
+  if (!is_constant_all<T_beta_scalar>::value) {
+    beta_derivative_chunks.resize(num_chunks);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        // rows of x belonging to this chunk
+        const size_t x_start = T_x_rows == 1 ? 0 : start;
+        const size_t x_rows = T_x_rows == 1 ? 1 : n;
+        const auto& x_chunk = x_val.block(x_start, 0, x_rows, N_attributes);
+
+        Array<T_partials_return, T_x_rows, Dynamic> lin
+            = (x_chunk * beta_val).rowwise() + alpha_val_vec;
+        Array<T_partials_return, T_x_rows, 1> lin_max
+            = lin.rowwise().maxCoeff();  // This is used to prevent overflow
+                                         // when calculating
+                                         // softmax/log_sum_exp and similar
+                                         // expressions
+        Array<T_partials_return, T_x_rows, Dynamic> exp_lin
+            = exp(lin.colwise() - lin_max);
+        Array<T_partials_return, T_x_rows, 1> inv_sum_exp_lin
+            = 1 / exp_lin.rowwise().sum();
+
+        logp_chunks[chunk] = log(inv_sum_exp_lin).sum() - lin_max.sum();
+        if (T_x_rows == 1) {
+          logp_chunks[chunk] *= n;
+        }
+        for (size_t i = start; i < end; i++) {
+          logp_chunks[chunk]
+              += lin(T_x_rows == 1 ? 0 : i - start, y_seq[i] - 1);
+        }
+
+        if (!is_constant_all<T_x_scalar>::value) {
+          Array<double, T_x_rows, Dynamic> beta_y(x_rows, N_attributes);
+          if (T_x_rows == 1) {
+            beta_y = beta_val.col(y_seq[start] - 1).transpose();
+            for (size_t i = start + 1; i < end; i++) {
+              beta_y += beta_val.col(y_seq[i] - 1).transpose().array();
+            }
+          } else {
+            for (size_t i = start; i < end; i++) {
+              beta_y.row(i - start) = beta_val.col(y_seq[i] - 1);
+            }
+          }
+          x_derivative.middleRows(x_start, x_rows)
+              = beta_y
+                - (exp_lin.matrix() * beta_val.transpose()).array().colwise()
+                      * inv_sum_exp_lin * (T_x_rows == 1 ? n : 1);
+        }
+        if (!is_constant_all<T_alpha_scalar, T_beta_scalar>::value) {
+          Array<T_partials_return, T_x_rows, Dynamic> neg_softmax_lin
+              = exp_lin.colwise() * -inv_sum_exp_lin;
+          if (T_x_rows == 1) {
+            neg_softmax_lin *= n;
+          }
+          if (!is_constant_all<T_alpha_scalar>::value) {
+            alpha_derivative_chunks.col(chunk)
+                = neg_softmax_lin.colwise().sum().transpose();
+            for (size_t i = start; i < end; i++) {
+              alpha_derivative_chunks(y_seq[i] - 1, chunk) += 1;
+            }
+          }
+          if (!is_constant_all<T_beta_scalar>::value) {
+            Matrix<T_partials_return, Dynamic, Dynamic>& beta_derivative
+                = beta_derivative_chunks[chunk];
+            beta_derivative = x_chunk.transpose() * neg_softmax_lin.matrix();
+            for (size_t i = start; i < end; i++) {
+              beta_derivative.col(y_seq[i] - 1)
+                  += x_chunk.row(T_x_rows == 1 ? 0 : i - start).transpose();
+            }
+          }
+        }
+      });
+  T_partials_return logp = sum(logp_chunks);
 
   if (!std::isfinite(logp)) {
     check_finite(function, "Weight vector", beta);
@@ -117,66 +187,16 @@ categorical_logit_glm_lpmf(
       ops_partials(x, alpha, beta);
 
   if (!is_constant_all<T_x_scalar>::value) {
-    if (T_x_rows == 1) {
-      Array<double, 1, Dynamic> beta_y = beta_val.col(y_seq[0] - 1);
-      for (int i = 1; i < N_instances; i++) {
-        beta_y += beta_val.col(y_seq[i] - 1).array();
-      }
-      ops_partials.edge1_.partials_
-          = beta_y
-            - (exp_lin.matrix() * beta_val.transpose()).array().colwise()
-                  * inv_sum_exp_lin * N_instances;
-    } else {
-      Array<double, Dynamic, Dynamic> beta_y(N_instances, N_attributes);
-      for (int i = 0; i < N_instances; i++) {
-        beta_y.row(i) = beta_val.col(y_seq[i] - 1);
-      }
-      ops_partials.edge1_.partials_
-          = beta_y
-            - (exp_lin.matrix() * beta_val.transpose()).array().colwise()
-                  * inv_sum_exp_lin;
-      // TODO(Tadej) maybe we can replace previous block with the following line
-      // when we have newer Eigen  ops_partials.edge1_.partials_ = beta_val(y -
-      // 1, all) - (exp_lin.matrix() * beta.transpose()).colwise() *
-      // inv_sum_exp_lin;
-    }
+    ops_partials.edge1_.partials_ = std::move(x_derivative);
   }
-  if (!is_constant_all<T_alpha_scalar, T_beta_scalar>::value) {
-    Array<T_partials_return, T_x_rows, Dynamic> neg_softmax_lin
-        = exp_lin.colwise() * -inv_sum_exp_lin;
-    if (!is_constant_all<T_alpha_scalar>::value) {
-      if (T_x_rows == 1) {
-        ops_partials.edge2_.partials_
-            = neg_softmax_lin.colwise().sum() * N_instances;
-      } else {
-        ops_partials.edge2_.partials_ = neg_softmax_lin.colwise().sum();
-      }
-      for (int i = 0; i < N_instances; i++) {
-        ops_partials.edge2_.partials_[y_seq[i] - 1] += 1;
-      }
-    }
-    if (!is_constant_all<T_beta_scalar>::value) {
-      Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative;
-      if (T_x_rows == 1) {
-        beta_derivative
-            = x_val.transpose() * neg_softmax_lin.matrix() * N_instances;
-      } else {
-        beta_derivative = x_val.transpose() * neg_softmax_lin.matrix();
-      }
-
-      for (int i = 0; i < N_instances; i++) {
-        if (T_x_rows == 1) {
-          beta_derivative.col(y_seq[i] - 1) += x_val;
-        } else {
-          beta_derivative.col(y_seq[i] - 1) += x_val.row(i);
-        }
-      }
-      // TODO(Tadej) maybe we can replace previous loop with the following line
-      // when we have newer Eigen  ops_partials.edge3_.partials_(Eigen::all, y -
-      // 1) += x_val.colwise.sum().transpose();
-
-      ops_partials.edge3_.partials_ = std::move(beta_derivative);
+  if (!is_constant_all<T_alpha_scalar>::value) {
+    ops_partials.edge2_.partials_ = alpha_derivative_chunks.rowwise().sum();
+  }
+  if (!is_constant_all<T_beta_scalar>::value) {
+    for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+      beta_derivative_chunks[0] += beta_derivative_chunks[chunk];
     }
+    ops_partials.edge3_.partials_ = std::move(beta_derivative_chunks[0]);
   }
   return ops_partials.build(logp);
 }
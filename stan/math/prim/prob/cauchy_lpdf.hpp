@@ -3,54 +3,43 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_array_or_scalar.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/constants.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/log1p.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
 /** \ingroup prob_dists
- * The log of the Cauchy density for the specified scalar(s) given
- * the specified location parameter(s) and scale parameter(s). y,
- * mu, or sigma can each either be scalar a vector.  Any vector
- * inputs must be the same length.
- *
- * <p> The result log probability is defined to be the sum of
- * the log probabilities for each observation/mu/sigma triple.
+ * Calculates the log of the Cauchy density and its partials with a
+ * loop over the scalars of the arguments.
  *
- * @param y (Sequence of) scalar(s).
- * @param mu (Sequence of) location(s).
- * @param sigma (Sequence of) scale(s).
- * @return The log of the product of densities.
- * @tparam T_y Type of scalar outcome.
- * @tparam T_loc Type of location.
- * @tparam T_scale Type of scale.
+ * @tparam T_y type of scalar or vector
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
  */
-template <bool propto, typename T_y, typename T_loc, typename T_scale>
-return_type_t<T_y, T_loc, T_scale> cauchy_lpdf(const T_y& y, const T_loc& mu,
-                                               const T_scale& sigma) {
-  static const char* function = "cauchy_lpdf";
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_not_t<
+              is_vectorizable_density<T_y, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_loc, T_scale> cauchy_lpdf_impl(
+    const T_y& y, const T_loc& mu, const T_scale& sigma) {
   using T_partials_return = partials_return_t<T_y, T_loc, T_scale>;
 
-  if (size_zero(y, mu, sigma)) {
-    return 0.0;
-  }
-
   T_partials_return logp(0.0);
 
-  check_not_nan(function, "Random variable", y);
-  check_finite(function, "Location parameter", mu);
-  check_positive_finite(function, "Scale parameter", sigma);
-  check_consistent_sizes(function, "Random variable", y, "Location parameter",
-                         mu, "Scale parameter", sigma);
-
-  if (!include_summand<propto, T_y, T_loc, T_scale>::value) {
-    return 0.0;
-  }
-
   using std::log;
 
   scalar_seq_view<T_y> y_vec(y);
@@ -109,6 +98,129 @@ return_type_t<T_y, T_loc, T_scale> cauchy_lpdf(const T_y& y, const T_loc& mu,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * Calculates the log of the Cauchy density and its partials with
+ * Eigen array expressions over all elements of the arguments.
+ *
+ * @tparam T_y type of scalar or vector
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_t<is_vectorizable_density<T_y, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_loc, T_scale> cauchy_lpdf_impl(
+    const T_y& y, const T_loc& mu, const T_scale& sigma) {
+  using std::log;
+
+  const auto& y_val = as_value_array_or_scalar(y);
+  const auto& mu_val = as_value_array_or_scalar(mu);
+  const auto& sigma_val = as_value_array_or_scalar(sigma);
+  const size_t N = max_size(y, mu, sigma);
+
+  using T_partials_array = value_array_or_scalar_t<T_y, T_loc, T_scale>;
+
+  const value_array_or_scalar_t<T_scale> inv_sigma = 1.0 / sigma_val;
+  const value_array_or_scalar_t<T_scale> sigma_squared = sigma_val * sigma_val;
+  T_partials_array mu_deriv = T_partials_array();
+  T_partials_array sigma_deriv = T_partials_array();
+  if (!is_constant_all<T_y, T_loc>::value) {
+    mu_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    sigma_deriv = T_partials_array(N);
+  }
+
+  const size_t num_chunks = num_parallel_chunks(N);
+  std::vector<double> logp_chunks(num_chunks);
+  parallel_chunks(N, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+    const size_t n = end - start;
+    const auto& inv_sigma_chunk = segment_or_scalar(inv_sigma, start, n);
+    const auto& sigma_squared_chunk
+        = segment_or_scalar(sigma_squared, start, n);
+    const value_array_or_scalar_t<T_y, T_loc> y_minus_mu
+        = segment_or_scalar(y_val, start, n)
+          - segment_or_scalar(mu_val, start, n);
+    const value_array_or_scalar_t<T_y, T_loc> y_minus_mu_squared
+        = y_minus_mu * y_minus_mu;
+    logp_chunks[chunk] = -sum(
+        log1p(y_minus_mu_squared * inv_sigma_chunk * inv_sigma_chunk));
+    if (!is_constant_all<T_y, T_loc>::value) {
+      segment_or_scalar(mu_deriv, start, n)
+          = 2 * y_minus_mu / (sigma_squared_chunk + y_minus_mu_squared);
+    }
+    if (!is_constant_all<T_scale>::value) {
+      segment_or_scalar(sigma_deriv, start, n)
+          = (y_minus_mu_squared - sigma_squared_chunk) * inv_sigma_chunk
+            / (sigma_squared_chunk + y_minus_mu_squared);
+    }
+  });
+
+  double logp = sum(logp_chunks);
+  if (include_summand<propto>::value) {
+    logp -= LOG_PI * N;
+  }
+  if (include_summand<propto, T_scale>::value) {
+    logp -= sum(log(sigma_val)) * N / size(sigma);
+  }
+
+  operands_and_partials<T_y, T_loc, T_scale> ops_partials(y, mu, sigma);
+  if (!is_constant_all<T_y>::value) {
+    set_vectorized_partials<T_y>(ops_partials.edge1_, -mu_deriv);
+  }
+  if (!is_constant_all<T_loc>::value) {
+    set_vectorized_partials<T_loc>(ops_partials.edge2_, mu_deriv);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    set_vectorized_partials<T_scale>(ops_partials.edge3_, sigma_deriv);
+  }
+  return ops_partials.build(logp);
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * The log of the Cauchy density for the specified scalar(s) given
+ * the specified location parameter(s) and scale parameter(s). y,
+ * mu, or sigma can each either be scalar a vector.  Any vector
+ * inputs must be the same length.
+ *
+ * <p> The result log probability is defined to be the sum of
+ * the log probabilities for each observation/mu/sigma triple.
+ *
+ * @param y (Sequence of) scalar(s).
+ * @param mu (Sequence of) location(s).
+ * @param sigma (Sequence of) scale(s).
+ * @return The log of the product of densities.
+ * @tparam T_y Type of scalar outcome.
+ * @tparam T_loc Type of location.
+ * @tparam T_scale Type of scale.
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale>
+return_type_t<T_y, T_loc, T_scale> cauchy_lpdf(const T_y& y, const T_loc& mu,
+                                               const T_scale& sigma) {
+  static const char* function = "cauchy_lpdf";
+
+  if (size_zero(y, mu, sigma)) {
+    return 0.0;
+  }
+
+  check_not_nan(function, "Random variable", y);
+  check_finite(function, "Location parameter", mu);
+  check_positive_finite(function, "Scale parameter", sigma);
+  check_consistent_sizes(function, "Random variable", y, "Location parameter",
+                         mu, "Scale parameter", sigma);
+
+  if (!include_summand<propto, T_y, T_loc, T_scale>::value) {
+    return 0.0;
+  }
+
+  return internal::cauchy_lpdf_impl<propto>(y, mu, sigma);
+}
+
 template <typename T_y, typename T_loc, typename T_scale>
 inline return_type_t<T_y, T_loc, T_scale> cauchy_lpdf(const T_y& y,
                                                       const T_loc& mu,
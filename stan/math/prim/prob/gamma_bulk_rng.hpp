@@ -0,0 +1,110 @@
+#ifndef STAN_MATH_PRIM_PROB_GAMMA_BULK_RNG_HPP
+#define STAN_MATH_PRIM_PROB_GAMMA_BULK_RNG_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/philox4x32.hpp>
+#include <stan/math/prim/functor/bulk_rng_draws.hpp>
+#include <boost/random/gamma_distribution.hpp>
+#include <boost/random/normal_distribution.hpp>
+#include <cmath>
+#include <cstddef>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Returns a gamma variate with the specified shape, which must be at
+ * least one, and unit scale drawn from the generator by the method of
+ * Marsaglia and Tsang (2000), A simple method for generating gamma
+ * variables, ACM Transactions on Mathematical Software 26(3).
+ *
+ * Each attempt takes a normal and a uniform variate and is accepted with
+ * probability above 0.95, mostly by a squeeze test which needs no
+ * logarithm.
+ *
+ * @param alpha shape parameter, alpha >= 1
+ * @param rng random number generator
+ * @return gamma variate
+ */
+inline double marsaglia_tsang_gamma(double alpha, philox4x32& rng) {
+  boost::random::normal_distribution<> std_normal;
+  const double d = alpha - 1.0 / 3.0;
+  const double c = 1 / std::sqrt(9 * d);
+  while (true) {
+    double x;
+    double v;
+    do {
+      x = std_normal(rng);
+      v = 1 + c * x;
+    } while (v <= 0);
+    v = v * v * v;
+    const double u = philox_unit_interval(rng);
+    const double x_sq = x * x;
+    if (u < 1 - 0.0331 * x_sq * x_sq
+        || std::log(u) < 0.5 * x_sq + d * (1 - v + std::log(v))) {
+      return d * v;
+    }
+  }
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * Return a vector of the specified number of gamma random variates for
+ * the given shape and inverse scale using the specified counter-based
+ * random number generator.
+ *
+ * The gamma variates are drawn by rejection from substreams of the
+ * generator, using internal::marsaglia_tsang_gamma() for shapes of at
+ * least one and the Boost gamma distribution, which is faster for
+ * smaller shapes, otherwise. Each run of consecutive variates uses its
+ * own substream, so runs are independent of each other and are drawn in
+ * parallel chunks if STAN_THREADS is defined and the number of variates
+ * is large. The result only depends on the state of the generator and
+ * not on the number of threads. The generator is advanced past the
+ * blocks reserved for the substreams.
+ *
+ * alpha and beta can each be a scalar or a one-dimensional container of
+ * size n_draws.
+ *
+ * @tparam T_shape type of shape parameter
+ * @tparam T_inv type of inverse scale parameter
+ * @param alpha (Sequence of) positive shape parameter(s)
+ * @param beta (Sequence of) positive inverse scale parameter(s)
+ * @param n_draws number of variates
+ * @param rng random number generator
+ * @return vector of gamma random variates
+ * @throw std::domain_error if alpha or beta are nonpositive
+ * @throw std::invalid_argument if non-scalar arguments are not of size
+ * n_draws
+ */
+template <typename T_shape, typename T_inv>
+inline Eigen::VectorXd gamma_bulk_rng(const T_shape& alpha,
+                                      const T_inv& beta, std::size_t n_draws,
+                                      philox4x32& rng) {
+  static const char* function = "gamma_bulk_rng";
+
+  check_positive_finite(function, "Shape parameter", alpha);
+  check_positive_finite(function, "Inverse scale parameter", beta);
+  check_consistent_size(function, "Shape parameter", alpha, n_draws);
+  check_consistent_size(function, "Inverse scale parameter", beta, n_draws);
+
+  scalar_seq_view<T_shape> alpha_vec(alpha);
+  scalar_seq_view<T_inv> beta_vec(beta);
+  Eigen::VectorXd output(n_draws);
+  internal::bulk_rng_draws(n_draws, rng, [&](std::size_t n, philox4x32& sub) {
+    const double alpha_n = alpha_vec[n];
+    const double gamma_n
+        = alpha_n < 1 ? boost::random::gamma_distribution<>(alpha_n)(sub)
+                      : internal::marsaglia_tsang_gamma(alpha_n, sub);
+    output.coeffRef(n) = gamma_n / beta_vec[n];
+  });
+  return output;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,265 @@
+#ifndef STAN_MATH_PRIM_PROB_GAMMA_LOG_GLM_LPDF_HPP
+#define STAN_MATH_PRIM_PROB_GAMMA_LOG_GLM_LPDF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/digamma.hpp>
+#include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/multiply_log.hpp>
+#include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/** \ingroup multivar_dists
+ * Returns the log PDF of the Generalized Linear Model (GLM)
+ * with Gamma distribution and log link function.
+ * The linear predictor is the log of the mean of the Gamma distribution,
+ * such that the rate of each instance is shape / exp(alpha + x * beta).
+ * The idea is that gamma_log_glm_lpdf(y, x, alpha, beta, shape) should
+ * compute a more efficient version of
+ * gamma_lpdf(y, shape, shape * exp(-(alpha + x * beta))) by using
+ * analytically simplified gradients.
+ * If containers are supplied, returns the log sum of the probabilities.
+ * @tparam T_y type of vector of dependent variables (labels);
+ * this can also be a single value;
+ * @tparam T_x_scalar type of a scalar in the matrix of independent variables
+ * (features)
+ * @tparam T_x_rows compile-time number of rows of `x`. It can be either
+ * `Eigen::Dynamic` or 1.
+ * @tparam T_alpha type of the intercept(s);
+ * this can be a vector (of the same length as y) of intercepts or a single
+ * value (for models with constant intercept);
+ * @tparam T_beta type of the weight vector;
+ * this can also be a single value;
+ * @tparam T_shape type of the (positive) shape(s);
+ * this can be a vector (of the same length as y) or a scalar.
+ * @param y positive scalar or vector of dependent variables. If it is a
+ * scalar it will be broadcast - used for all instances.
+ * @param x design matrix or row vector. If it is a row vector it will be
+ * broadcast - used for all instances.
+ * @param alpha intercept (on the log scale)
+ * @param beta weight vector
+ * @param shape (vector of) shape parameter(s)
+ * @return log probability or log sum of probabilities
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if y or the shape is not positive and finite.
+ * @throw std::invalid_argument if container sizes mismatch.
+ */
+template <bool propto, typename T_y, typename T_x_scalar, int T_x_rows,
+          typename T_alpha, typename T_beta, typename T_shape>
+return_type_t<T_y, T_x_scalar, T_alpha, T_beta, T_shape> gamma_log_glm_lpdf(
+    const T_y &y, const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic> &x,
+    const T_alpha &alpha, const T_beta &beta, const T_shape &shape) {
+  static const char *function = "gamma_log_glm_lpdf";
+
+  using Eigen::Array;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using Eigen::exp;
+
+  using T_partials_return
+      = partials_return_t<T_y, T_x_scalar, T_alpha, T_beta, T_shape>;
+  using T_theta_tmp =
+      typename std::conditional_t<T_x_rows == 1, T_partials_return,
+                                  Array<T_partials_return, Dynamic, 1>>;
+
+  const size_t N_instances = T_x_rows == 1 ? size(y) : x.rows();
+  const size_t N_attributes = x.cols();
+
+  check_consistent_size(function, "Vector of dependent variables", y,
+                        N_instances);
+  check_consistent_size(function, "Weight vector", beta, N_attributes);
+  check_consistent_size(function, "Vector of shape parameters", shape,
+                        N_instances);
+  check_consistent_size(function, "Vector of intercepts", alpha, N_instances);
+  check_positive_finite(function, "Vector of dependent variables", y);
+  check_positive_finite(function, "Shape parameter", shape);
+
+  if (size_zero(y, shape)) {
+    return 0;
+  }
+
+  if (!include_summand<propto, T_y, T_x_scalar, T_alpha, T_beta,
+                       T_shape>::value) {
+    return 0;
+  }
+
+  T_partials_return logp(0);
+  const auto &x_val = value_of_rec(x);
+  const auto &y_val = value_of_rec(y);
+  const auto &beta_val = value_of_rec(beta);
+  const auto &alpha_val = value_of_rec(alpha);
+  const auto &shape_val = value_of_rec(shape);
+
+  const auto &y_val_vec = as_column_vector_or_scalar(y_val);
+  const auto &beta_val_vec = as_column_vector_or_scalar(beta_val);
+  const auto &alpha_val_vec = as_column_vector_or_scalar(alpha_val);
+  const auto &shape_val_vec = as_column_vector_or_scalar(shape_val);
+
+  const auto &y_arr = as_array_or_scalar(y_val_vec);
+  const auto &shape_arr = as_array_or_scalar(shape_val_vec);
+
+  const auto &alpha_arr = as_array_or_scalar(alpha_val_vec);
+  scalar_seq_view<decltype(shape_val)> shape_vec(shape_val);
+
+  T_theta_tmp theta_tmp(0);
+  if (T_x_rows == 1) {
+    theta_tmp = forward_as<T_theta_tmp>((x_val * beta_val_vec)(0, 0));
+  }
+
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Array<T_partials_return, Dynamic, 1> theta(N_instances);
+  Matrix<T_partials_return, Dynamic, 1> theta_derivative;
+  if (!is_constant_all<T_x_scalar, T_beta, T_alpha>::value) {
+    theta_derivative.resize(N_instances);
+  }
+  Array<T_partials_return, Dynamic, 1> y_derivative;
+  if (!is_constant_all<T_y>::value) {
+    y_derivative.resize(N_instances);
+  }
+  Array<T_partials_return, Dynamic, 1> shape_derivative;
+  if (!is_constant_all<T_shape>::value) {
+    shape_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto &y_chunk = segment_or_scalar(y_arr, start, n);
+        const auto &shape_chunk = segment_or_scalar(shape_arr, start, n);
+        auto theta_chunk = theta.segment(start, n);
+        if (T_x_rows == 1) {
+          theta_chunk = theta_tmp + segment_or_scalar(alpha_arr, start, n);
+        } else {
+          theta_chunk = (x_val.middleRows(start, n) * beta_val_vec).array();
+          theta_chunk += segment_or_scalar(alpha_arr, start, n);
+        }
+        // y divided by the mean of each instance
+        const Array<T_partials_return, Dynamic, 1> y_over_mu
+            = y_chunk * exp(-theta_chunk);
+
+        if (include_summand<propto, T_shape>::value
+            && is_vector<T_shape>::value) {
+          for (size_t i = start; i < end; ++i) {
+            logp_chunks[chunk] += multiply_log(shape_vec[i], shape_vec[i])
+                                  - lgamma(shape_vec[i]);
+          }
+        }
+        if (include_summand<propto, T_y, T_shape>::value
+            && (is_vector<T_y>::value || is_vector<T_shape>::value)) {
+          logp_chunks[chunk] += sum((shape_chunk - 1) * log(y_chunk));
+        }
+        logp_chunks[chunk] -= sum(shape_chunk * (theta_chunk + y_over_mu));
+
+        if (!is_constant_all<T_x_scalar, T_beta, T_alpha>::value) {
+          theta_derivative.segment(start, n)
+              = (shape_chunk * (y_over_mu - 1)).matrix();
+          if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+            beta_derivative_chunks.col(chunk)
+                = x_val.middleRows(start, n).transpose()
+                  * theta_derivative.segment(start, n);
+          }
+        }
+        if (!is_constant_all<T_y>::value) {
+          y_derivative.segment(start, n)
+              = ((shape_chunk - 1) - shape_chunk * y_over_mu) / y_chunk;
+        }
+        if (!is_constant_all<T_shape>::value) {
+          shape_derivative.segment(start, n)
+              = log(y_chunk) - theta_chunk - y_over_mu;
+          if (is_vector<T_shape>::value) {
+            shape_derivative.segment(start, n)
+                += 1 + log(shape_chunk) - digamma(shape_chunk);
+          }
+        }
+      });
+  check_finite(function, "Matrix of independent variables", theta);
+
+  // Compute the log-density.
+  logp += sum(logp_chunks);
+  if (include_summand<propto, T_shape>::value && !is_vector<T_shape>::value) {
+    logp += N_instances
+            * (multiply_log(forward_as<double>(shape_val),
+                            forward_as<double>(shape_val))
+               - lgamma(forward_as<double>(shape_val)));
+  }
+  if (include_summand<propto, T_y, T_shape>::value && !is_vector<T_y>::value
+      && !is_vector<T_shape>::value) {
+    logp += N_instances * (forward_as<double>(shape_val) - 1)
+            * log(forward_as<double>(y_val));
+  }
+
+  // Compute the necessary derivatives.
+  operands_and_partials<T_y, Eigen::Matrix<T_x_scalar, T_x_rows, Dynamic>,
+                        T_alpha, T_beta, T_shape>
+      ops_partials(y, x, alpha, beta, shape);
+  if (!is_constant_all<T_beta>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge4_.partials_
+          = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
+              theta_derivative.sum() * x_val);
+    } else {
+      ops_partials.edge4_.partials_
+          = beta_derivative_chunks.rowwise().sum().transpose();
+    }
+  }
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge2_.partials_
+          = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
+              beta_val_vec * theta_derivative.sum());
+    } else {
+      ops_partials.edge2_.partials_
+          = (beta_val_vec * theta_derivative.transpose()).transpose();
+    }
+  }
+  if (!is_constant_all<T_alpha>::value) {
+    if (is_vector<T_alpha>::value) {
+      ops_partials.edge3_.partials_ = std::move(theta_derivative);
+    } else {
+      ops_partials.edge3_.partials_[0] = sum(theta_derivative);
+    }
+  }
+  if (!is_constant_all<T_y>::value) {
+    if (is_vector<T_y>::value) {
+      ops_partials.edge1_.partials_ = y_derivative;
+    } else {
+      ops_partials.edge1_.partials_[0] = sum(y_derivative);
+    }
+  }
+  if (!is_constant_all<T_shape>::value) {
+    if (is_vector<T_shape>::value) {
+      ops_partials.edge5_.partials_ = shape_derivative;
+    } else {
+      ops_partials.edge5_.partials_[0]
+          = N_instances
+                * (1 + log(forward_as<double>(shape_val))
+                   - digamma(forward_as<double>(shape_val)))
+            + sum(shape_derivative);
+    }
+  }
+  return ops_partials.build(logp);
+}
+
+template <typename T_y, typename T_x, typename T_alpha, typename T_beta,
+          typename T_shape>
+inline return_type_t<T_y, T_x, T_alpha, T_beta, T_shape> gamma_log_glm_lpdf(
+    const T_y &y, const T_x &x, const T_alpha &alpha, const T_beta &beta,
+    const T_shape &shape) {
+  return gamma_log_glm_lpdf<false>(y, x, alpha, beta, shape);
+}
+}  // namespace math
+}  // namespace stan
+#endif
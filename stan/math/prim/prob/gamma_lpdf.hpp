@@ -3,73 +3,49 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_array_or_scalar.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
 /** \ingroup prob_dists
- * The log of a gamma density for y with the specified
- * shape and inverse scale parameters.
- * Shape and inverse scale parameters must be greater than 0.
- * y must be greater than or equal to 0.
+ * Calculates the log of the gamma density and its partials with a
+ * loop over the scalars of the arguments.
  *
- \f{eqnarray*}{
- y &\sim& \mbox{\sf{Gamma}}(\alpha, \beta) \\
- \log (p (y \, |\, \alpha, \beta) ) &=& \log \left(
- \frac{\beta^\alpha}{\Gamma(\alpha)} y^{\alpha - 1} \exp^{- \beta y} \right) \\
- &=& \alpha \log(\beta) - \log(\Gamma(\alpha)) + (\alpha - 1) \log(y) - \beta
- y\\ & & \mathrm{where} \; y > 0 \f}
- * @param y A scalar variable.
- * @param alpha Shape parameter.
- * @param beta Inverse scale parameter.
- * @throw std::domain_error if alpha is not greater than 0.
- * @throw std::domain_error if beta is not greater than 0.
- * @throw std::domain_error if y is not greater than or equal to 0.
- * @tparam T_y Type of scalar.
- * @tparam T_shape Type of shape.
- * @tparam T_inv_scale Type of inverse scale.
+ * @tparam T_y type of scalar
+ * @tparam T_shape type of shape
+ * @tparam T_inv_scale type of inverse scale
+ * @param y (sequence of) nonnegative scalar(s)
+ * @param alpha (sequence of) shape parameter(s)
+ * @param beta (sequence of) inverse scale parameter(s)
+ * @return log of the product of the densities
  */
-template <bool propto, typename T_y, typename T_shape, typename T_inv_scale>
-return_type_t<T_y, T_shape, T_inv_scale> gamma_lpdf(const T_y& y,
-                                                    const T_shape& alpha,
-                                                    const T_inv_scale& beta) {
-  static const char* function = "gamma_lpdf";
+template <bool propto, typename T_y, typename T_shape, typename T_inv_scale,
+          require_not_t<
+              is_vectorizable_density<T_y, T_shape, T_inv_scale>>* = nullptr>
+inline return_type_t<T_y, T_shape, T_inv_scale> gamma_lpdf_impl(
+    const T_y& y, const T_shape& alpha, const T_inv_scale& beta) {
   using T_partials_return = partials_return_t<T_y, T_shape, T_inv_scale>;
 
-  if (size_zero(y, alpha, beta)) {
-    return 0.0;
-  }
-
   T_partials_return logp(0.0);
 
-  check_not_nan(function, "Random variable", y);
-  check_positive_finite(function, "Shape parameter", alpha);
-  check_positive_finite(function, "Inverse scale parameter", beta);
-  check_consistent_sizes(function, "Random variable", y, "Shape parameter",
-                         alpha, "Inverse scale parameter", beta);
-
-  if (!include_summand<propto, T_y, T_shape, T_inv_scale>::value) {
-    return 0.0;
-  }
-
   scalar_seq_view<T_y> y_vec(y);
   scalar_seq_view<T_shape> alpha_vec(alpha);
   scalar_seq_view<T_inv_scale> beta_vec(beta);
 
-  for (size_t n = 0; n < size(y); n++) {
-    const T_partials_return y_dbl = value_of(y_vec[n]);
-    if (y_dbl < 0) {
-      return LOG_ZERO;
-    }
-  }
-
   size_t N = max_size(y, alpha, beta);
   operands_and_partials<T_y, T_shape, T_inv_scale> ops_partials(y, alpha, beta);
 
@@ -141,6 +117,176 @@ return_type_t<T_y, T_shape, T_inv_scale> gamma_lpdf(const T_y& y,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * Returns the logarithm of a positive scalar and zero for zero, which is
+ * how the gamma density treats the logarithm of a zero variate.
+ *
+ * @param y nonnegative scalar
+ * @return log(y) if y is positive and zero otherwise
+ */
+inline double gamma_lpdf_log_y(double y) { return y > 0 ? std::log(y) : 0; }
+
+/** \ingroup prob_dists
+ * Returns the logarithms of the positive elements of an array and zero
+ * for the elements which are zero.
+ *
+ * @tparam T type of the array expression
+ * @param y array of nonnegative scalars
+ * @return array with log(y) for positive elements of y and zero otherwise
+ */
+template <typename T, require_eigen_t<T>* = nullptr>
+inline Eigen::ArrayXd gamma_lpdf_log_y(const T& y) {
+  return (y > 0).select(y.log(), 0.0);
+}
+
+/** \ingroup prob_dists
+ * Calculates the log of the gamma density and its partials with
+ * Eigen array expressions over all elements of the arguments.
+ *
+ * @tparam T_y type of scalar
+ * @tparam T_shape type of shape
+ * @tparam T_inv_scale type of inverse scale
+ * @param y (sequence of) nonnegative scalar(s)
+ * @param alpha (sequence of) shape parameter(s)
+ * @param beta (sequence of) inverse scale parameter(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_shape, typename T_inv_scale,
+          require_t<
+              is_vectorizable_density<T_y, T_shape, T_inv_scale>>* = nullptr>
+inline return_type_t<T_y, T_shape, T_inv_scale> gamma_lpdf_impl(
+    const T_y& y, const T_shape& alpha, const T_inv_scale& beta) {
+  using std::log;
+
+  const auto& y_val = as_value_array_or_scalar(y);
+  const auto& alpha_val = as_value_array_or_scalar(alpha);
+  const auto& beta_val = as_value_array_or_scalar(beta);
+  const size_t N = max_size(y, alpha, beta);
+
+  using T_partials_array = value_array_or_scalar_t<T_y, T_shape, T_inv_scale>;
+
+  T_partials_array y_deriv = T_partials_array();
+  T_partials_array alpha_deriv = T_partials_array();
+  T_partials_array beta_deriv = T_partials_array();
+  if (!is_constant_all<T_y>::value) {
+    y_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_shape>::value) {
+    alpha_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_inv_scale>::value) {
+    beta_deriv = T_partials_array(N);
+  }
+
+  const size_t num_chunks = num_parallel_chunks(N);
+  std::vector<double> logp_chunks(num_chunks);
+  parallel_chunks(N, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+    const size_t n = end - start;
+    const auto& y_chunk = segment_or_scalar(y_val, start, n);
+    const auto& alpha_chunk = segment_or_scalar(alpha_val, start, n);
+    const auto& beta_chunk = segment_or_scalar(beta_val, start, n);
+    const value_array_or_scalar_t<T_y> log_y = gamma_lpdf_log_y(y_chunk);
+    const value_array_or_scalar_t<T_inv_scale> log_beta = log(beta_chunk);
+
+    double logp_chunk = 0.0;
+    if (include_summand<propto, T_shape>::value) {
+      logp_chunk -= sum(lgamma(alpha_chunk)) * n / size(alpha_chunk);
+    }
+    if (include_summand<propto, T_shape, T_inv_scale>::value) {
+      logp_chunk += sum(alpha_chunk * log_beta) * n
+                    / max_size(alpha_chunk, beta_chunk);
+    }
+    if (include_summand<propto, T_y, T_shape>::value) {
+      logp_chunk += sum((alpha_chunk - 1.0) * log_y) * n
+                    / max_size(y_chunk, alpha_chunk);
+    }
+    if (include_summand<propto, T_y, T_inv_scale>::value) {
+      logp_chunk
+          -= sum(beta_chunk * y_chunk) * n / max_size(y_chunk, beta_chunk);
+    }
+    logp_chunks[chunk] = logp_chunk;
+
+    if (!is_constant_all<T_y>::value) {
+      segment_or_scalar(y_deriv, start, n)
+          = (alpha_chunk - 1) / y_chunk - beta_chunk;
+    }
+    if (!is_constant_all<T_shape>::value) {
+      segment_or_scalar(alpha_deriv, start, n)
+          = -digamma(alpha_chunk) + log_beta + log_y;
+    }
+    if (!is_constant_all<T_inv_scale>::value) {
+      segment_or_scalar(beta_deriv, start, n)
+          = alpha_chunk / beta_chunk - y_chunk;
+    }
+  });
+
+  operands_and_partials<T_y, T_shape, T_inv_scale> ops_partials(y, alpha, beta);
+  if (!is_constant_all<T_y>::value) {
+    set_vectorized_partials<T_y>(ops_partials.edge1_, y_deriv);
+  }
+  if (!is_constant_all<T_shape>::value) {
+    set_vectorized_partials<T_shape>(ops_partials.edge2_, alpha_deriv);
+  }
+  if (!is_constant_all<T_inv_scale>::value) {
+    set_vectorized_partials<T_inv_scale>(ops_partials.edge3_, beta_deriv);
+  }
+  return ops_partials.build(sum(logp_chunks));
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * The log of a gamma density for y with the specified
+ * shape and inverse scale parameters.
+ * Shape and inverse scale parameters must be greater than 0.
+ * y must be greater than or equal to 0.
+ *
+ \f{eqnarray*}{
+ y &\sim& \mbox{\sf{Gamma}}(\alpha, \beta) \\
+ \log (p (y \, |\, \alpha, \beta) ) &=& \log \left(
+ \frac{\beta^\alpha}{\Gamma(\alpha)} y^{\alpha - 1} \exp^{- \beta y} \right) \\
+ &=& \alpha \log(\beta) - \log(\Gamma(\alpha)) + (\alpha - 1) \log(y) - \beta
+ y\\ & & \mathrm{where} \; y > 0 \f}
+ * @param y A scalar variable.
+ * @param alpha Shape parameter.
+ * @param beta Inverse scale parameter.
+ * @throw std::domain_error if alpha is not greater than 0.
+ * @throw std::domain_error if beta is not greater than 0.
+ * @throw std::domain_error if y is not greater than or equal to 0.
+ * @tparam T_y Type of scalar.
+ * @tparam T_shape Type of shape.
+ * @tparam T_inv_scale Type of inverse scale.
+ */
+template <bool propto, typename T_y, typename T_shape, typename T_inv_scale>
+return_type_t<T_y, T_shape, T_inv_scale> gamma_lpdf(const T_y& y,
+                                                    const T_shape& alpha,
+                                                    const T_inv_scale& beta) {
+  static const char* function = "gamma_lpdf";
+
+  if (size_zero(y, alpha, beta)) {
+    return 0.0;
+  }
+
+  check_not_nan(function, "Random variable", y);
+  check_positive_finite(function, "Shape parameter", alpha);
+  check_positive_finite(function, "Inverse scale parameter", beta);
+  check_consistent_sizes(function, "Random variable", y, "Shape parameter",
+                         alpha, "Inverse scale parameter", beta);
+
+  if (!include_summand<propto, T_y, T_shape, T_inv_scale>::value) {
+    return 0.0;
+  }
+
+  scalar_seq_view<T_y> y_vec(y);
+  for (size_t n = 0; n < size(y); n++) {
+    if (value_of(y_vec[n]) < 0) {
+      return LOG_ZERO;
+    }
+  }
+
+  return internal::gamma_lpdf_impl<propto>(y, alpha, beta);
+}
+
 template <typename T_y, typename T_shape, typename T_inv_scale>
 inline return_type_t<T_y, T_shape, T_inv_scale> gamma_lpdf(
     const T_y& y, const T_shape& alpha, const T_inv_scale& beta) {
@@ -3,9 +3,9 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/log.hpp>
-#include <stan/math/prim/fun/make_nu.hpp>
-#include <stan/math/prim/fun/multiply.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/prob/lkj_corr_log.hpp>
 
 namespace stan {
@@ -13,14 +13,34 @@ namespace math {
 
 // LKJ_Corr(L|eta) [ L Cholesky factor of correlation matrix
 //                  eta > 0; eta == 1 <-> uniform]
+/** \ingroup multivar_dists
+ * The log of the LKJ density for the specified Cholesky factor of a
+ * correlation matrix given the specified shape parameter.
+ *
+ * <p>The density only depends on the diagonal of the Cholesky factor,
+ * such that the value and the partials with respect to the diagonal
+ * and the shape parameter are calculated in closed form and stored on
+ * a single node of the expression graph.
+ *
+ * @tparam propto if true, terms which do not depend on parameters
+ * are dropped
+ * @tparam T_covar scalar type of the Cholesky factor
+ * @tparam T_shape type of the shape parameter
+ * @param L Cholesky factor of a correlation matrix
+ * @param eta shape parameter
+ * @return log of the LKJ density
+ * @throw std::domain_error if eta is not positive or L is not lower
+ * triangular
+ */
 template <bool propto, typename T_covar, typename T_shape>
 return_type_t<T_covar, T_shape> lkj_corr_cholesky_lpdf(
     const Eigen::Matrix<T_covar, Eigen::Dynamic, Eigen::Dynamic>& L,
     const T_shape& eta) {
   static const char* function = "lkj_corr_cholesky_lpdf";
+  using T_partials_return = partials_return_t<T_covar, T_shape>;
+  using matrix_partials_t
+      = Eigen::Matrix<T_partials_return, Eigen::Dynamic, Eigen::Dynamic>;
 
-  using lp_ret = return_type_t<T_covar, T_shape>;
-  lp_ret lp(0.0);
   check_positive(function, "Shape parameter", eta);
   check_lower_triangular(function, "Random variable", L);
 
@@ -29,26 +49,48 @@ return_type_t<T_covar, T_shape> lkj_corr_cholesky_lpdf(
     return 0.0;
   }
 
+  operands_and_partials<Eigen::Matrix<T_covar, Eigen::Dynamic, Eigen::Dynamic>,
+                        T_shape>
+      ops_partials(L, eta);
+  T_partials_return lp(0.0);
+  const T_partials_return eta_dbl = value_of(eta);
+  const int Km1 = K - 1;
+
   if (include_summand<propto, T_shape>::value) {
-    lp += do_lkj_constant(eta, K);
+    lp += do_lkj_constant(eta_dbl, K);
+    if (!is_constant_all<T_shape>::value) {
+      T_partials_return d_constant = Km1 * digamma(eta_dbl + 0.5 * Km1);
+      for (int k = 1; k <= Km1; k++) {
+        d_constant -= digamma(eta_dbl + 0.5 * (Km1 - k));
+      }
+      ops_partials.edge2_.partials_[0] += d_constant;
+    }
   }
   if (include_summand<propto, T_covar, T_shape>::value) {
-    const int Km1 = K - 1;
-    Eigen::Matrix<T_covar, Eigen::Dynamic, 1> log_diagonals
-        = log(L.diagonal().tail(Km1).array());
-    Eigen::Matrix<lp_ret, Eigen::Dynamic, 1> values(Km1);
+    matrix_partials_t L_deriv;
+    if (!is_constant_all<T_covar>::value) {
+      L_deriv = matrix_partials_t::Zero(K, K);
+    }
+    T_partials_return sum_log_diagonals(0.0);
     for (int k = 0; k < Km1; k++) {
-      values(k) = (Km1 - k - 1) * log_diagonals(k);
+      const T_partials_return L_kk = value_of(L(k + 1, k + 1));
+      const T_partials_return log_L_kk = log(L_kk);
+      const T_partials_return exponent = Km1 - k - 3 + 2.0 * eta_dbl;
+      lp += exponent * log_L_kk;
+      sum_log_diagonals += log_L_kk;
+      if (!is_constant_all<T_covar>::value) {
+        L_deriv(k + 1, k + 1) = exponent / L_kk;
+      }
+    }
+    if (!is_constant_all<T_covar>::value) {
+      ops_partials.edge1_.partials_ += L_deriv;
     }
-    if (eta == 1.0 && is_constant_all<scalar_type<T_shape>>::value) {
-      lp += sum(values);
-      return (lp);
+    if (!is_constant_all<T_shape>::value) {
+      ops_partials.edge2_.partials_[0] += 2.0 * sum_log_diagonals;
     }
-    values += multiply(2.0 * eta - 2.0, log_diagonals);
-    lp += sum(values);
   }
 
-  return lp;
+  return ops_partials.build(lp);
 }
 
 template <typename T_covar, typename T_shape>
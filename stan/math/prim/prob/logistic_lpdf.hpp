@@ -3,40 +3,46 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_array_or_scalar.hpp>
+#include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/log1p.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
 
-// Logistic(y|mu, sigma)    [sigma > 0]
-template <bool propto, typename T_y, typename T_loc, typename T_scale>
-return_type_t<T_y, T_loc, T_scale> logistic_lpdf(const T_y& y, const T_loc& mu,
-                                                 const T_scale& sigma) {
-  static const char* function = "logistic_lpdf";
+namespace internal {
+
+/** \ingroup prob_dists
+ * Calculates the log of the logistic density and its partials with a
+ * loop over the scalars of the arguments.
+ *
+ * @tparam T_y type of scalar or vector
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_not_t<
+              is_vectorizable_density<T_y, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_loc, T_scale> logistic_lpdf_impl(
+    const T_y& y, const T_loc& mu, const T_scale& sigma) {
   using T_partials_return = partials_return_t<T_y, T_loc, T_scale>;
 
   using std::exp;
   using std::log;
 
-  if (size_zero(y, mu, sigma)) {
-    return 0.0;
-  }
-
   T_partials_return logp(0.0);
 
-  check_finite(function, "Random variable", y);
-  check_finite(function, "Location parameter", mu);
-  check_positive_finite(function, "Scale parameter", sigma);
-  check_consistent_sizes(function, "Random variable", y, "Location parameter",
-                         mu, "Scale parameter", sigma);
-
-  if (!include_summand<propto, T_y, T_loc, T_scale>::value) {
-    return 0.0;
-  }
-
   operands_and_partials<T_y, T_loc, T_scale> ops_partials(y, mu, sigma);
 
   scalar_seq_view<T_y> y_vec(y);
@@ -110,6 +116,113 @@ return_type_t<T_y, T_loc, T_scale> logistic_lpdf(const T_y& y, const T_loc& mu,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * Calculates the log of the logistic density and its partials with
+ * Eigen array expressions over all elements of the arguments.
+ *
+ * @tparam T_y type of scalar or vector
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_t<is_vectorizable_density<T_y, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_loc, T_scale> logistic_lpdf_impl(
+    const T_y& y, const T_loc& mu, const T_scale& sigma) {
+  using std::exp;
+  using std::log;
+
+  const auto& y_val = as_value_array_or_scalar(y);
+  const auto& mu_val = as_value_array_or_scalar(mu);
+  const auto& sigma_val = as_value_array_or_scalar(sigma);
+  const size_t N = max_size(y, mu, sigma);
+
+  using T_partials_array = value_array_or_scalar_t<T_y, T_loc, T_scale>;
+
+  const value_array_or_scalar_t<T_scale> inv_sigma = 1.0 / sigma_val;
+  T_partials_array y_deriv = T_partials_array();
+  T_partials_array sigma_deriv = T_partials_array();
+  if (!is_constant_all<T_y, T_loc>::value) {
+    y_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    sigma_deriv = T_partials_array(N);
+  }
+
+  const size_t num_chunks = num_parallel_chunks(N);
+  std::vector<double> logp_chunks(num_chunks);
+  parallel_chunks(N, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+    const size_t n = end - start;
+    const auto& inv_sigma_chunk = segment_or_scalar(inv_sigma, start, n);
+    const T_partials_array y_minus_mu_div_sigma
+        = (segment_or_scalar(y_val, start, n)
+           - segment_or_scalar(mu_val, start, n))
+          * inv_sigma_chunk;
+    logp_chunks[chunk] = -sum(y_minus_mu_div_sigma)
+                         - 2.0 * sum(log1p(exp(-y_minus_mu_div_sigma)));
+    if (!is_constant_all<T_y, T_loc, T_scale>::value) {
+      const T_partials_array inv_1p_exp_y_minus_mu_div_sigma
+          = 1.0 / (1.0 + exp(y_minus_mu_div_sigma));
+      if (!is_constant_all<T_y, T_loc>::value) {
+        segment_or_scalar(y_deriv, start, n)
+            = (2.0 * inv_1p_exp_y_minus_mu_div_sigma - 1.0) * inv_sigma_chunk;
+      }
+      if (!is_constant_all<T_scale>::value) {
+        segment_or_scalar(sigma_deriv, start, n)
+            = ((1.0 - 2.0 * inv_1p_exp_y_minus_mu_div_sigma)
+                   * y_minus_mu_div_sigma
+               - 1.0)
+              * inv_sigma_chunk;
+      }
+    }
+  });
+
+  double logp = sum(logp_chunks);
+  if (include_summand<propto, T_scale>::value) {
+    logp -= sum(log(sigma_val)) * N / size(sigma);
+  }
+
+  operands_and_partials<T_y, T_loc, T_scale> ops_partials(y, mu, sigma);
+  if (!is_constant_all<T_y>::value) {
+    set_vectorized_partials<T_y>(ops_partials.edge1_, y_deriv);
+  }
+  if (!is_constant_all<T_loc>::value) {
+    set_vectorized_partials<T_loc>(ops_partials.edge2_, -y_deriv);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    set_vectorized_partials<T_scale>(ops_partials.edge3_, sigma_deriv);
+  }
+  return ops_partials.build(logp);
+}
+
+}  // namespace internal
+
+// Logistic(y|mu, sigma)    [sigma > 0]
+template <bool propto, typename T_y, typename T_loc, typename T_scale>
+return_type_t<T_y, T_loc, T_scale> logistic_lpdf(const T_y& y, const T_loc& mu,
+                                                 const T_scale& sigma) {
+  static const char* function = "logistic_lpdf";
+
+  if (size_zero(y, mu, sigma)) {
+    return 0.0;
+  }
+
+  check_finite(function, "Random variable", y);
+  check_finite(function, "Location parameter", mu);
+  check_positive_finite(function, "Scale parameter", sigma);
+  check_consistent_sizes(function, "Random variable", y, "Location parameter",
+                         mu, "Scale parameter", sigma);
+
+  if (!include_summand<propto, T_y, T_loc, T_scale>::value) {
+    return 0.0;
+  }
+
+  return internal::logistic_lpdf_impl<propto>(y, mu, sigma);
+}
+
 template <typename T_y, typename T_loc, typename T_scale>
 inline return_type_t<T_y, T_loc, T_scale> logistic_lpdf(const T_y& y,
                                                         const T_loc& mu,
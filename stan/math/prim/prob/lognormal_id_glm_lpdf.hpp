@@ -0,0 +1,267 @@
+#ifndef STAN_MATH_PRIM_PROB_LOGNORMAL_ID_GLM_LPDF_HPP
+#define STAN_MATH_PRIM_PROB_LOGNORMAL_ID_GLM_LPDF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/** \ingroup multivar_dists
+ * Returns the log PDF of the Generalized Linear Model (GLM)
+ * with lognormal distribution and id link function for the log location.
+ * If containers are supplied, returns the log sum of the probabilities.
+ * The idea is that lognormal_id_glm_lpdf(y, x, alpha, beta, sigma) should
+ * compute a more efficient version of
+ * lognormal_lpdf(y, alpha + x * beta, sigma) by using analytically
+ * simplified gradients.
+ * @tparam T_y type of vector of dependent variables (labels);
+ * @tparam T_x_scalar type of a scalar in the matrix of independent variables
+ * (features)
+ * @tparam T_x_rows compile-time number of rows of `x`. It can be either
+ * `Eigen::Dynamic` or 1.
+ * @tparam T_alpha type of the intercept(s);
+ * this can be a vector (of the same length as y) of intercepts or a single
+ * value (for models with constant intercept);
+ * @tparam T_beta type of the weight vector;
+ * this can also be a single value;
+ * @tparam T_scale type of the (positive) scale(s);
+ * this can be a vector (of the same length as y, for heteroskedasticity)
+ * or a scalar.
+ * @param y positive scalar or vector of dependent variables. If it is a
+ * scalar it will be broadcast - used for all instances.
+ * @param x design matrix or row vector. If it is a row vector it will be
+ * broadcast - used for all instances.
+ * @param alpha intercept (on the log scale)
+ * @param beta weight vector
+ * @param sigma (Sequence of) scale parameters for the lognormal
+ * distribution.
+ * @return log probability or log sum of probabilities
+ * @throw std::domain_error if x, beta or alpha is infinite.
+ * @throw std::domain_error if y or the scale is not positive and finite.
+ * @throw std::invalid_argument if container sizes mismatch.
+ */
+template <bool propto, typename T_y, typename T_x_scalar, int T_x_rows,
+          typename T_alpha, typename T_beta, typename T_scale>
+return_type_t<T_y, T_x_scalar, T_alpha, T_beta, T_scale> lognormal_id_glm_lpdf(
+    const T_y &y, const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic> &x,
+    const T_alpha &alpha, const T_beta &beta, const T_scale &sigma) {
+  using Eigen::Array;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+
+  using T_partials_return
+      = partials_return_t<T_y, T_x_scalar, T_alpha, T_beta, T_scale>;
+  using T_scale_val = typename std::conditional_t<
+      is_vector<T_scale>::value,
+      Eigen::Array<partials_return_t<T_scale>, -1, 1>,
+      partials_return_t<T_scale>>;
+  using T_y_val = typename std::conditional_t<
+      is_vector<T_y>::value, Eigen::Array<partials_return_t<T_y>, -1, 1>,
+      partials_return_t<T_y>>;
+  using T_y_scaled_tmp =
+      typename std::conditional_t<T_x_rows == 1, T_partials_return,
+                                  Array<T_partials_return, Dynamic, 1>>;
+
+  static const char *function = "lognormal_id_glm_lpdf";
+
+  const size_t N_instances = T_x_rows == 1 ? size(y) : x.rows();
+  const size_t N_attributes = x.cols();
+
+  check_consistent_size(function, "Vector of dependent variables", y,
+                        N_instances);
+  check_consistent_size(function, "Weight vector", beta, N_attributes);
+  check_consistent_size(function, "Vector of scale parameters", sigma,
+                        N_instances);
+  check_consistent_size(function, "Vector of intercepts", alpha, N_instances);
+  check_positive_finite(function, "Vector of dependent variables", y);
+  check_positive_finite(function, "Scale vector", sigma);
+
+  if (size_zero(y, sigma)) {
+    return 0;
+  }
+
+  if (!include_summand<propto, T_y, T_x_scalar, T_alpha, T_beta,
+                       T_scale>::value) {
+    return 0;
+  }
+
+  const auto &x_val = value_of_rec(x);
+  const auto &beta_val = value_of_rec(beta);
+  const auto &alpha_val = value_of_rec(alpha);
+  const auto &sigma_val = value_of_rec(sigma);
+  const auto &y_val = value_of_rec(y);
+
+  const auto &beta_val_vec = as_column_vector_or_scalar(beta_val);
+  const auto &alpha_val_vec = as_column_vector_or_scalar(alpha_val);
+  const auto &sigma_val_vec = as_column_vector_or_scalar(sigma_val);
+  const auto &y_val_vec = as_column_vector_or_scalar(y_val);
+
+  T_scale_val inv_sigma = 1 / as_array_or_scalar(sigma_val_vec);
+  const auto &y_arr = as_array_or_scalar(y_val_vec);
+  const auto &alpha_arr = as_array_or_scalar(alpha_val_vec);
+
+  T_y_scaled_tmp y_scaled_tmp(0);
+  if (T_x_rows == 1) {
+    y_scaled_tmp = forward_as<T_y_scaled_tmp>((x_val * beta_val_vec)(0, 0));
+  }
+
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> y_scaled_sq_sum_chunks(num_chunks);
+  std::vector<T_partials_return> log_y_sum_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Matrix<T_partials_return, Dynamic, 1> mu_derivative;
+  if (!is_constant_all<T_y, T_x_scalar, T_beta, T_alpha>::value) {
+    mu_derivative.resize(N_instances);
+  }
+  Array<T_partials_return, Dynamic, 1> y_derivative;
+  if (!is_constant_all<T_y>::value && is_vector<T_y>::value) {
+    y_derivative.resize(N_instances);
+  }
+  Array<T_partials_return, Dynamic, 1> sigma_derivative;
+  if (!is_constant_all<T_scale>::value && is_vector<T_scale>::value) {
+    sigma_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto &y_chunk = segment_or_scalar(y_arr, start, n);
+        const auto &inv_sigma_chunk = segment_or_scalar(inv_sigma, start, n);
+        const T_y_val log_y = log(y_chunk);
+        Array<T_partials_return, Dynamic, 1> y_scaled(n);
+        if (T_x_rows == 1) {
+          y_scaled = (log_y - y_scaled_tmp
+                      - segment_or_scalar(alpha_arr, start, n))
+                     * inv_sigma_chunk;
+        } else {
+          y_scaled = x_val.middleRows(start, n) * beta_val_vec;
+          y_scaled = (log_y - y_scaled - segment_or_scalar(alpha_arr, start, n))
+                     * inv_sigma_chunk;
+        }
+        const Array<T_partials_return, Dynamic, 1> y_scaled_sq
+            = y_scaled * y_scaled;
+        y_scaled_sq_sum_chunks[chunk] = sum(y_scaled_sq);
+        if (is_vector<T_y>::value) {
+          log_y_sum_chunks[chunk] = sum(log_y);
+        }
+        if (!is_constant_all<T_y, T_x_scalar, T_beta, T_alpha>::value) {
+          mu_derivative.segment(start, n)
+              = (inv_sigma_chunk * y_scaled).matrix();
+          if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+            beta_derivative_chunks.col(chunk)
+                = x_val.middleRows(start, n).transpose()
+                  * mu_derivative.segment(start, n);
+          }
+          if (!is_constant_all<T_y>::value && is_vector<T_y>::value) {
+            y_derivative.segment(start, n)
+                = -(1 + mu_derivative.segment(start, n).array()) / y_chunk;
+          }
+        }
+        if (!is_constant_all<T_scale>::value && is_vector<T_scale>::value) {
+          sigma_derivative.segment(start, n)
+              = (y_scaled_sq - 1) * inv_sigma_chunk;
+        }
+      });
+  double y_scaled_sq_sum = sum(y_scaled_sq_sum_chunks);
+
+  operands_and_partials<T_y, Matrix<T_x_scalar, T_x_rows, Dynamic>, T_alpha,
+                        T_beta, T_scale>
+      ops_partials(y, x, alpha, beta, sigma);
+
+  if (!is_constant_all<T_y>::value) {
+    if (is_vector<T_y>::value) {
+      ops_partials.edge1_.partials_ = y_derivative;
+    } else {
+      ops_partials.edge1_.partials_[0]
+          = -(N_instances + mu_derivative.sum()) / forward_as<double>(y_val);
+    }
+  }
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge2_.partials_
+          = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
+              beta_val_vec * sum(mu_derivative));
+    } else {
+      ops_partials.edge2_.partials_
+          = (beta_val_vec * mu_derivative.transpose()).transpose();
+    }
+  }
+  if (!is_constant_all<T_beta>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge4_.partials_
+          = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
+              mu_derivative.sum() * x_val);
+    } else {
+      ops_partials.edge4_.partials_
+          = beta_derivative_chunks.rowwise().sum().transpose();
+    }
+  }
+  if (!is_constant_all<T_alpha>::value) {
+    if (is_vector<T_alpha>::value) {
+      ops_partials.edge3_.partials_ = mu_derivative;
+    } else {
+      ops_partials.edge3_.partials_[0] = sum(mu_derivative);
+    }
+  }
+  if (!is_constant_all<T_scale>::value) {
+    if (is_vector<T_scale>::value) {
+      ops_partials.edge5_.partials_ = sigma_derivative;
+    } else {
+      ops_partials.edge5_.partials_[0]
+          = (y_scaled_sq_sum - N_instances) * forward_as<double>(inv_sigma);
+    }
+  }
+
+  if (!std::isfinite(y_scaled_sq_sum)) {
+    check_finite(function, "Weight vector", beta);
+    check_finite(function, "Intercept", alpha);
+    // if all other checks passed, next will only fail if x is not finite
+    check_finite(function, "Matrix of independent variables", y_scaled_sq_sum);
+  }
+
+  // Compute log probability.
+  T_partials_return logp(0.0);
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N_instances;
+  }
+  if (include_summand<propto, T_scale>::value) {
+    if (is_vector<T_scale>::value) {
+      logp -= sum(log(sigma_val_vec));
+    } else {
+      logp -= N_instances * log(forward_as<double>(sigma_val));
+    }
+  }
+  if (include_summand<propto, T_y>::value) {
+    if (is_vector<T_y>::value) {
+      logp -= sum(log_y_sum_chunks);
+    } else {
+      logp -= N_instances * log(forward_as<double>(y_val));
+    }
+  }
+  logp -= 0.5 * y_scaled_sq_sum;
+
+  return ops_partials.build(logp);
+}
+
+template <typename T_y, typename T_x, typename T_alpha, typename T_beta,
+          typename T_scale>
+inline return_type_t<T_y, T_x, T_alpha, T_beta, T_scale> lognormal_id_glm_lpdf(
+    const T_y &y, const T_x &x, const T_alpha &alpha, const T_beta &beta,
+    const T_scale &sigma) {
+  return lognormal_id_glm_lpdf<false>(y, x, alpha, beta, sigma);
+}
+}  // namespace math
+}  // namespace stan
+#endif
@@ -6,9 +6,9 @@
 #include <stan/math/prim/fun/constants.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
-#include <stan/math/prim/fun/multiply_log.hpp>
 #include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <vector>
 #include <cmath>
 
@@ -101,7 +101,6 @@ neg_binomial_2_log_glm_lpmf(
     return 0;
   }
 
-  T_partials_return logp(0);
   const auto& x_val = value_of_rec(x);
   const auto& y_val = value_of_rec(y);
   const auto& beta_val = value_of_rec(beta);
@@ -114,108 +113,129 @@ neg_binomial_2_log_glm_lpmf(
   const auto& phi_val_vec = as_column_vector_or_scalar(phi_val);
 
   const auto& y_arr = as_array_or_scalar(y_val_vec);
+  const auto& alpha_arr = as_array_or_scalar(alpha_val_vec);
   const auto& phi_arr = as_array_or_scalar(phi_val_vec);
 
-  Array<T_partials_return, Dynamic, 1> theta(N_instances);
+  T_theta_tmp theta_tmp(0);
   if (T_x_rows == 1) {
-    T_theta_tmp theta_tmp
-        = forward_as<T_theta_tmp>((x_val * beta_val_vec)(0, 0));
-    theta = theta_tmp + as_array_or_scalar(alpha_val_vec);
-  } else {
-    theta = (x_val * beta_val_vec).array();
-    theta += as_array_or_scalar(alpha_val_vec);
+    theta_tmp = forward_as<T_theta_tmp>((x_val * beta_val_vec)(0, 0));
+  }
+
+  // The sums over the elements of a chunk are scaled up by the number of
+  // elements a scalar y or phi is broadcast to.
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Array<T_partials_return, Dynamic, 1> theta(N_instances);
+  Matrix<T_partials_return, Dynamic, 1> theta_derivative;
+  if (!is_constant_all<T_x_scalar, T_beta, T_alpha>::value) {
+    theta_derivative.resize(N_instances);
   }
+  Array<T_partials_return, Dynamic, 1> phi_derivative;
+  if (!is_constant_all<T_precision>::value) {
+    phi_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto& y_chunk = segment_or_scalar(y_arr, start, n);
+        const auto& phi_chunk = segment_or_scalar(phi_arr, start, n);
+        auto theta_chunk = theta.segment(start, n);
+        if (T_x_rows == 1) {
+          theta_chunk = theta_tmp + segment_or_scalar(alpha_arr, start, n);
+        } else {
+          theta_chunk = (x_val.middleRows(start, n) * beta_val_vec).array();
+          theta_chunk += segment_or_scalar(alpha_arr, start, n);
+        }
+        const T_precision_val log_phi = log(phi_chunk);
+        const Array<T_partials_return, Dynamic, 1> logsumexp_theta_logphi
+            = (theta_chunk > log_phi)
+                  .select(theta_chunk + log1p(exp(log_phi - theta_chunk)),
+                          log_phi + log1p(exp(theta_chunk - log_phi)));
+        const T_sum_val y_plus_phi = y_chunk + phi_chunk;
+
+        // Compute the log-density.
+        T_partials_return logp_chunk(0);
+        if (include_summand<propto>::value) {
+          logp_chunk -= sum(lgamma(y_chunk + 1)) * n / size(y_chunk);
+        }
+        if (include_summand<propto, T_precision>::value) {
+          logp_chunk += sum(phi_chunk * log_phi - lgamma(phi_chunk)) * n
+                        / size(phi_chunk);
+        }
+        logp_chunk -= sum(y_plus_phi * logsumexp_theta_logphi);
+        if (include_summand<propto, T_x_scalar, T_alpha, T_beta>::value) {
+          logp_chunk += sum(y_chunk * theta_chunk);
+        }
+        if (include_summand<propto, T_precision>::value) {
+          logp_chunk += sum(lgamma(y_plus_phi)) * n / size(y_plus_phi);
+        }
+        logp_chunks[chunk] = logp_chunk;
+
+        // Compute the necessary derivatives.
+        if (!is_constant_all<T_x_scalar, T_beta, T_alpha,
+                             T_precision>::value) {
+          const Array<T_partials_return, Dynamic, 1> theta_exp
+              = theta_chunk.exp();
+          if (!is_constant_all<T_x_scalar, T_beta, T_alpha>::value) {
+            theta_derivative.segment(start, n)
+                = (y_chunk - theta_exp * y_plus_phi / (theta_exp + phi_chunk))
+                      .matrix();
+            if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+              beta_derivative_chunks.col(chunk)
+                  = x_val.middleRows(start, n).transpose()
+                    * theta_derivative.segment(start, n);
+            }
+          }
+          if (!is_constant_all<T_precision>::value) {
+            phi_derivative.segment(start, n)
+                = 1 - y_plus_phi / (theta_exp + phi_chunk) + log_phi
+                  - logsumexp_theta_logphi + digamma(y_plus_phi)
+                  - digamma(phi_chunk);
+          }
+        }
+      });
   check_finite(function, "Matrix of independent variables", theta);
-  T_precision_val log_phi = log(phi_arr);
-  Array<T_partials_return, Dynamic, 1> logsumexp_theta_logphi
-      = (theta > log_phi)
-            .select(theta + log1p(exp(log_phi - theta)),
-                    log_phi + log1p(exp(theta - log_phi)));
-
-  T_sum_val y_plus_phi = y_arr + phi_arr;
-
-  // Compute the log-density.
-  if (include_summand<propto>::value) {
-    if (is_vector<T_y>::value) {
-      logp -= sum(lgamma(y_arr + 1));
+  T_partials_return logp = sum(logp_chunks);
+
+  operands_and_partials<Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>,
+                        T_alpha, T_beta, T_precision>
+      ops_partials(x, alpha, beta, phi);
+  if (!is_constant_all<T_beta>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge3_.partials_
+          = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
+              theta_derivative.sum() * x_val);
     } else {
-      logp -= sum(lgamma(y_arr + 1)) * N_instances;
+      ops_partials.edge3_.partials_ = beta_derivative_chunks.rowwise().sum();
     }
   }
-  if (include_summand<propto, T_precision>::value) {
-    if (is_vector<T_precision>::value) {
-      scalar_seq_view<decltype(phi_val)> phi_vec(phi_val);
-      for (size_t n = 0; n < N_instances; ++n) {
-        logp += multiply_log(phi_vec[n], phi_vec[n]) - lgamma(phi_vec[n]);
-      }
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge1_.partials_
+          = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
+              beta_val_vec * theta_derivative.sum());
     } else {
-      logp += N_instances
-              * (multiply_log(forward_as<double>(phi_val),
-                              forward_as<double>(phi_val))
-                 - lgamma(forward_as<double>(phi_val)));
+      ops_partials.edge1_.partials_
+          = (beta_val_vec * theta_derivative.transpose()).transpose();
     }
   }
-  logp -= sum(y_plus_phi * logsumexp_theta_logphi);
-
-  if (include_summand<propto, T_x_scalar, T_alpha, T_beta>::value) {
-    logp += sum(y_arr * theta);
-  }
-  if (include_summand<propto, T_precision>::value) {
-    if (is_vector<T_y>::value || is_vector<T_precision>::value) {
-      logp += sum(lgamma(y_plus_phi));
+  if (!is_constant_all<T_alpha>::value) {
+    if (is_vector<T_alpha>::value) {
+      ops_partials.edge2_.partials_ = std::move(theta_derivative);
     } else {
-      logp += sum(lgamma(y_plus_phi)) * N_instances;
+      ops_partials.edge2_.partials_[0] = sum(theta_derivative);
     }
   }
-
-  // Compute the necessary derivatives.
-  operands_and_partials<Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>,
-                        T_alpha, T_beta, T_precision>
-      ops_partials(x, alpha, beta, phi);
-  if (!is_constant_all<T_x_scalar, T_beta, T_alpha, T_precision>::value) {
-    Array<T_partials_return, Dynamic, 1> theta_exp = theta.exp();
-    if (!is_constant_all<T_x_scalar, T_beta, T_alpha>::value) {
-      Matrix<T_partials_return, Dynamic, 1> theta_derivative
-          = y_arr - theta_exp * y_plus_phi / (theta_exp + phi_arr);
-      if (!is_constant_all<T_beta>::value) {
-        if (T_x_rows == 1) {
-          ops_partials.edge3_.partials_
-              = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
-                  theta_derivative.sum() * x_val);
-        } else {
-          ops_partials.edge3_.partials_ = x_val.transpose() * theta_derivative;
-        }
-      }
-      if (!is_constant_all<T_x_scalar>::value) {
-        if (T_x_rows == 1) {
-          ops_partials.edge1_.partials_
-              = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
-                  beta_val_vec * theta_derivative.sum());
-        } else {
-          ops_partials.edge1_.partials_
-              = (beta_val_vec * theta_derivative.transpose()).transpose();
-        }
-      }
-      if (!is_constant_all<T_alpha>::value) {
-        if (is_vector<T_alpha>::value) {
-          ops_partials.edge2_.partials_ = std::move(theta_derivative);
-        } else {
-          ops_partials.edge2_.partials_[0] = sum(theta_derivative);
-        }
-      }
-    }
-    if (!is_constant_all<T_precision>::value) {
-      if (is_vector<T_precision>::value) {
-        ops_partials.edge4_.partials_
-            = 1 - y_plus_phi / (theta_exp + phi_arr) + log_phi
-              - logsumexp_theta_logphi + digamma(y_plus_phi) - digamma(phi_arr);
-      } else {
-        ops_partials.edge4_.partials_[0]
-            = N_instances
-              + sum(-y_plus_phi / (theta_exp + phi_arr) + log_phi
-                    - logsumexp_theta_logphi + digamma(y_plus_phi)
-                    - digamma(phi_arr));
-      }
+  if (!is_constant_all<T_precision>::value) {
+    if (is_vector<T_precision>::value) {
+      ops_partials.edge4_.partials_ = phi_derivative;
+    } else {
+      ops_partials.edge4_.partials_[0] = sum(phi_derivative);
     }
   }
   return ops_partials.build(logp);
@@ -0,0 +1,122 @@
+#ifndef STAN_MATH_PRIM_PROB_NORMAL_BULK_RNG_HPP
+#define STAN_MATH_PRIM_PROB_NORMAL_BULK_RNG_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/batch_kernels.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/philox4x32.hpp>
+#include <stan/math/prim/functor/bulk_rng_draws.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Computes two independent standard normal variates from the four words
+ * of a block of a philox4x32 generator by the Box-Muller transform.
+ *
+ * The first two words give the radius and the last two the angle, each
+ * from a uniform variate with 53 random bits. The angle is split into a
+ * number of quarter turns and a remainder in [-pi / 4, pi / 4), whose
+ * sine and cosine are evaluated by the batch kernels and then rotated by
+ * the quarter turns, so there are no branches and no calls to the
+ * trigonometric functions of the standard library.
+ *
+ * @param words outputs of a block of the generator
+ * @param[out] z0 first standard normal variate
+ * @param[out] z1 second standard normal variate
+ */
+inline void philox_box_muller(const std::array<std::uint32_t, 4>& words,
+                              double& z0, double& z1) {
+  // 1 - u is in (0, 1], so its logarithm is finite
+  const double u = philox_to_unit_interval(words[0], words[1]);
+  const double r = std::sqrt(-2.0 * batch_log(1.0 - u));
+  const double t = 4.0 * philox_to_unit_interval(words[2], words[3]);
+  const std::int64_t quarter_turns = static_cast<std::int64_t>(t);
+  const double x = 0.5 * pi() * ((t - quarter_turns) - 0.5);
+  const double cos_x = batch_cos_kernel(x);
+  const double sin_x = batch_sin_kernel(x);
+  // an odd number of quarter turns maps (cos_x, sin_x) to
+  // (-sin_x, cos_x) and two quarter turns flip the signs
+  const double odd = quarter_turns & 1;
+  const double signed_r = (1 - (quarter_turns & 2)) * r;
+  z0 = signed_r * (cos_x - odd * (cos_x + sin_x));
+  z1 = signed_r * (sin_x + odd * (cos_x - sin_x));
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * Return a vector of the specified number of normal random variates for
+ * the given location and scale using the specified counter-based random
+ * number generator.
+ *
+ * Each pair of variates is computed from one block of the generator by
+ * the Box-Muller transform in internal::philox_box_muller(), so the
+ * blocks are evaluated independently of each other, without rejection
+ * steps and, if STAN_THREADS is defined and the vector is large, in
+ * parallel chunks. The result only depends on the state of the generator
+ * and not on the number of threads. The generator is advanced past the
+ * blocks it used.
+ *
+ * mu and sigma can each be a scalar or a one-dimensional container of
+ * size n_draws.
+ *
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param mu (Sequence of) location parameter(s)
+ * @param sigma (Sequence of) positive scale parameter(s)
+ * @param n_draws number of variates
+ * @param rng random number generator
+ * @return vector of normal random variates
+ * @throw std::domain_error if mu is infinite or sigma is nonpositive
+ * @throw std::invalid_argument if non-scalar arguments are not of size
+ * n_draws
+ */
+template <typename T_loc, typename T_scale>
+inline Eigen::VectorXd normal_bulk_rng(const T_loc& mu, const T_scale& sigma,
+                                       std::size_t n_draws,
+                                       philox4x32& rng) {
+  static const char* function = "normal_bulk_rng";
+
+  check_finite(function, "Location parameter", mu);
+  check_positive_finite(function, "Scale parameter", sigma);
+  check_consistent_size(function, "Location parameter", mu, n_draws);
+  check_consistent_size(function, "Scale parameter", sigma, n_draws);
+
+  scalar_seq_view<T_loc> mu_vec(mu);
+  scalar_seq_view<T_scale> sigma_vec(sigma);
+  Eigen::VectorXd output(n_draws);
+  const std::size_t num_pairs = n_draws / 2;
+  const std::uint64_t first_block = rng.reserve_blocks(n_draws - num_pairs);
+
+  auto draw = [&](std::size_t n, double z) {
+    output.coeffRef(n) = mu_vec[n] + sigma_vec[n] * z;
+  };
+  internal::bulk_rng_blocks(
+      first_block, num_pairs, rng,
+      [&](std::size_t b, const std::array<std::uint32_t, 4>& words) {
+        double z0;
+        double z1;
+        internal::philox_box_muller(words, z0, z1);
+        draw(2 * b, z0);
+        draw(2 * b + 1, z1);
+      });
+  if (n_draws % 2 != 0) {
+    double z0;
+    double z1;
+    internal::philox_box_muller(rng.block(first_block + num_pairs), z0, z1);
+    draw(n_draws - 1, z0);
+  }
+  return output;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -4,11 +4,14 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/glm_sufficient_stats.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -100,76 +103,109 @@ return_type_t<T_y, T_x_scalar, T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
   const auto &y_val_vec = as_column_vector_or_scalar(y_val);
 
   T_scale_val inv_sigma = 1 / as_array_or_scalar(sigma_val_vec);
+  const auto &y_arr = as_array_or_scalar(y_val_vec);
+  const auto &alpha_arr = as_array_or_scalar(alpha_val_vec);
 
-  // the most efficient way to calculate this depends on template parameters
-  double y_scaled_sq_sum;
+  T_y_scaled_tmp y_scaled_tmp(0);
+  if (T_x_rows == 1) {
+    y_scaled_tmp = forward_as<T_y_scaled_tmp>((x_val * beta_val_vec)(0, 0));
+  }
 
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> y_scaled_sq_sum_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
   Array<T_partials_return, Dynamic, 1> y_scaled(N_instances);
-  if (T_x_rows == 1) {
-    T_y_scaled_tmp y_scaled_tmp
-        = forward_as<T_y_scaled_tmp>((x_val * beta_val_vec)(0, 0));
-    y_scaled = (as_array_or_scalar(y_val_vec) - y_scaled_tmp
-                - as_array_or_scalar(alpha_val_vec))
-               * inv_sigma;
-  } else {
-    y_scaled = x_val * beta_val_vec;
-    y_scaled = (as_array_or_scalar(y_val_vec) - y_scaled
-                - as_array_or_scalar(alpha_val_vec))
-               * inv_sigma;
+  Matrix<T_partials_return, Dynamic, 1> mu_derivative;
+  if (!is_constant_all<T_y, T_x_scalar, T_beta, T_alpha>::value) {
+    mu_derivative.resize(N_instances);
   }
+  Array<T_partials_return, Dynamic, 1> sigma_derivative;
+  if (!is_constant_all<T_scale>::value && is_vector<T_scale>::value) {
+    sigma_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto &inv_sigma_chunk = segment_or_scalar(inv_sigma, start, n);
+        auto y_scaled_chunk = y_scaled.segment(start, n);
+        if (T_x_rows == 1) {
+          y_scaled_chunk = (segment_or_scalar(y_arr, start, n) - y_scaled_tmp
+                            - segment_or_scalar(alpha_arr, start, n))
+                           * inv_sigma_chunk;
+        } else {
+          y_scaled_chunk = (x_val.middleRows(start, n) * beta_val_vec).array();
+          y_scaled_chunk = (segment_or_scalar(y_arr, start, n) - y_scaled_chunk
+                            - segment_or_scalar(alpha_arr, start, n))
+                           * inv_sigma_chunk;
+        }
+        const Array<T_partials_return, Dynamic, 1> y_scaled_sq
+            = y_scaled_chunk * y_scaled_chunk;
+        y_scaled_sq_sum_chunks[chunk] = sum(y_scaled_sq);
+        if (!is_constant_all<T_y, T_x_scalar, T_beta, T_alpha>::value) {
+          mu_derivative.segment(start, n)
+              = (inv_sigma_chunk * y_scaled_chunk).matrix();
+          if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+            beta_derivative_chunks.col(chunk)
+                = x_val.middleRows(start, n).transpose()
+                  * mu_derivative.segment(start, n);
+          }
+        }
+        if (!is_constant_all<T_scale>::value && is_vector<T_scale>::value) {
+          sigma_derivative.segment(start, n)
+              = (y_scaled_sq - 1) * inv_sigma_chunk;
+        }
+      });
+  double y_scaled_sq_sum = sum(y_scaled_sq_sum_chunks);
 
   operands_and_partials<T_y, Matrix<T_x_scalar, T_x_rows, Dynamic>, T_alpha,
                         T_beta, T_scale>
       ops_partials(y, x, alpha, beta, sigma);
 
-  if (!(is_constant_all<T_y, T_x_scalar, T_beta, T_alpha>::value)) {
-    Matrix<T_partials_return, Dynamic, 1> mu_derivative = inv_sigma * y_scaled;
-    if (!is_constant_all<T_y>::value) {
-      if (is_vector<T_y>::value) {
-        ops_partials.edge1_.partials_ = -mu_derivative;
-      } else {
-        ops_partials.edge1_.partials_[0] = -mu_derivative.sum();
-      }
+  if (!is_constant_all<T_y>::value) {
+    if (is_vector<T_y>::value) {
+      ops_partials.edge1_.partials_ = -mu_derivative;
+    } else {
+      ops_partials.edge1_.partials_[0] = -mu_derivative.sum();
     }
-    if (!is_constant_all<T_x_scalar>::value) {
-      if (T_x_rows == 1) {
-        ops_partials.edge2_.partials_
-            = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
-                beta_val_vec * sum(mu_derivative));
-      } else {
-        ops_partials.edge2_.partials_
-            = (beta_val_vec * mu_derivative.transpose()).transpose();
-      }
+  }
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge2_.partials_
+          = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
+              beta_val_vec * sum(mu_derivative));
+    } else {
+      ops_partials.edge2_.partials_
+          = (beta_val_vec * mu_derivative.transpose()).transpose();
     }
-    if (!is_constant_all<T_beta>::value) {
-      if (T_x_rows == 1) {
-        ops_partials.edge4_.partials_
-            = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
-                mu_derivative.sum() * x_val);
-      } else {
-        ops_partials.edge4_.partials_ = mu_derivative.transpose() * x_val;
-      }
+  }
+  if (!is_constant_all<T_beta>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge4_.partials_
+          = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
+              mu_derivative.sum() * x_val);
+    } else {
+      ops_partials.edge4_.partials_
+          = beta_derivative_chunks.rowwise().sum().transpose();
     }
-    if (!is_constant_all<T_alpha>::value) {
-      if (is_vector<T_alpha>::value) {
-        ops_partials.edge3_.partials_ = mu_derivative;
-      } else {
-        ops_partials.edge3_.partials_[0] = sum(mu_derivative);
-      }
+  }
+  if (!is_constant_all<T_alpha>::value) {
+    if (is_vector<T_alpha>::value) {
+      ops_partials.edge3_.partials_ = mu_derivative;
+    } else {
+      ops_partials.edge3_.partials_[0] = sum(mu_derivative);
     }
-    if (!is_constant_all<T_scale>::value) {
-      if (is_vector<T_scale>::value) {
-        Array<T_partials_return, Dynamic, 1> y_scaled_sq = y_scaled * y_scaled;
-        y_scaled_sq_sum = sum(y_scaled_sq);
-        ops_partials.edge5_.partials_ = (y_scaled_sq - 1) * inv_sigma;
-      } else {
-        y_scaled_sq_sum = sum(y_scaled * y_scaled);
-        ops_partials.edge5_.partials_[0]
-            = (y_scaled_sq_sum - N_instances) * forward_as<double>(inv_sigma);
-      }
+  }
+  if (!is_constant_all<T_scale>::value) {
+    if (is_vector<T_scale>::value) {
+      ops_partials.edge5_.partials_ = sigma_derivative;
+    } else {
+      ops_partials.edge5_.partials_[0]
+          = (y_scaled_sq_sum - N_instances) * forward_as<double>(inv_sigma);
     }
-  } else {
-    y_scaled_sq_sum = sum(y_scaled * y_scaled);
   }
 
   if (!std::isfinite(y_scaled_sq_sum)) {
@@ -204,6 +240,115 @@ inline return_type_t<T_y, T_x, T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
     const T_scale &sigma) {
   return normal_id_glm_lpdf<false>(y, x, alpha, beta, sigma);
 }
+
+/** \ingroup multivar_dists
+ * Returns the log PDF of the Generalized Linear Model (GLM)
+ * with Normal distribution and id link function, for data summarized by
+ * their sufficient statistics.
+ * The result equals normal_id_glm_lpdf(y, x, alpha, beta, sigma) for the
+ * y and x the statistics were computed from, but it and its gradient are
+ * computed in O(K^2) operations, where K is the number of attributes,
+ * independently of the number of instances.
+ *
+ * The sum of squared residuals is computed by expanding the square, so
+ * when the residuals are much smaller than y it loses relative precision
+ * compared to the O(N K) version.
+ *
+ * @tparam T_alpha type of the intercept; must be a scalar
+ * @tparam T_beta type of the weight vector;
+ * this can also be a single value;
+ * @tparam T_scale type of the (positive) scale; must be a scalar
+ * @param stats sufficient statistics of the dependent variables and the
+ * design matrix
+ * @param alpha intercept
+ * @param beta weight vector
+ * @param sigma scale parameter for the normal distribution
+ * @return log sum of probabilities
+ * @throw std::domain_error if beta or alpha is infinite.
+ * @throw std::domain_error if the scale is not positive and finite.
+ * @throw std::invalid_argument if the size of beta does not match the
+ * number of attributes.
+ */
+template <bool propto, typename T_alpha, typename T_beta, typename T_scale,
+          require_all_stan_scalar_t<T_alpha, T_scale>* = nullptr>
+return_type_t<T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
+    const glm_sufficient_stats &stats, const T_alpha &alpha,
+    const T_beta &beta, const T_scale &sigma) {
+  using Eigen::VectorXd;
+  static const char *function = "normal_id_glm_lpdf";
+
+  const size_t N_instances = stats.instances();
+  const size_t N_attributes = stats.attributes();
+
+  check_consistent_size(function, "Weight vector", beta, N_attributes);
+  check_finite(function, "Intercept", alpha);
+  check_finite(function, "Weight vector", beta);
+  check_positive_finite(function, "Scale vector", sigma);
+
+  if (N_instances == 0) {
+    return 0;
+  }
+
+  if (!include_summand<propto, T_alpha, T_beta, T_scale>::value) {
+    return 0;
+  }
+
+  const double alpha_val = value_of_rec(alpha);
+  const double sigma_val = value_of_rec(sigma);
+  const double inv_sigma_sq = 1 / (sigma_val * sigma_val);
+  VectorXd beta_val(N_attributes);
+  scalar_seq_view<T_beta> beta_vec(beta);
+  for (size_t k = 0; k < N_attributes; ++k) {
+    beta_val[k] = value_of_rec(beta_vec[k]);
+  }
+
+  const VectorXd xtx_beta = stats.xtx() * beta_val;
+  const double x_sum_beta = stats.x_sum().dot(beta_val);
+  // sum of (y - alpha - x * beta)^2, expanded in terms of the statistics
+  double sq_residual_sum
+      = stats.yty() - 2 * alpha_val * stats.y_sum()
+        - 2 * stats.xty().dot(beta_val)
+        + alpha_val * (N_instances * alpha_val + 2 * x_sum_beta)
+        + beta_val.dot(xtx_beta);
+  // guard against rounding below zero for near perfect fits
+  if (sq_residual_sum < 0) {
+    sq_residual_sum = 0;
+  }
+
+  operands_and_partials<T_alpha, T_beta, T_scale> ops_partials(alpha, beta,
+                                                               sigma);
+  if (!is_constant_all<T_alpha>::value) {
+    ops_partials.edge1_.partials_[0]
+        = (stats.y_sum() - N_instances * alpha_val - x_sum_beta)
+          * inv_sigma_sq;
+  }
+  if (!is_constant_all<T_beta>::value) {
+    ops_partials.edge2_.partials_
+        = (stats.xty() - alpha_val * stats.x_sum() - xtx_beta) * inv_sigma_sq;
+  }
+  if (!is_constant_all<T_scale>::value) {
+    ops_partials.edge3_.partials_[0]
+        = (sq_residual_sum * inv_sigma_sq - N_instances) / sigma_val;
+  }
+
+  double logp(0.0);
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N_instances;
+  }
+  if (include_summand<propto, T_scale>::value) {
+    logp -= N_instances * std::log(sigma_val);
+  }
+  logp -= 0.5 * sq_residual_sum * inv_sigma_sq;
+
+  return ops_partials.build(logp);
+}
+
+template <typename T_alpha, typename T_beta, typename T_scale>
+inline return_type_t<T_alpha, T_beta, T_scale> normal_id_glm_lpdf(
+    const glm_sufficient_stats &stats, const T_alpha &alpha,
+    const T_beta &beta, const T_scale &sigma) {
+  return normal_id_glm_lpdf<false>(stats, alpha, beta, sigma);
+}
 }  // namespace math
 }  // namespace stan
 #endif
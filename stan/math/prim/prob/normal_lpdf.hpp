@@ -3,57 +3,43 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_array_or_scalar.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
 /** \ingroup prob_dists
- * The log of the normal density for the specified scalar(s) given
- * the specified mean(s) and deviation(s). y, mu, or sigma can
- * each be either a scalar or a vector. Any vector inputs
- * must be the same length.
+ * Calculates the log of the normal density and its partials with a
+ * loop over the scalars of the arguments.
  *
- * <p>The result log probability is defined to be the sum of the
- * log probabilities for each observation/mean/deviation triple.
- * @tparam T_y Underlying type of scalar in sequence.
- * @tparam T_loc Type of location parameter.
- * @tparam T_scale Type of scale parameter.
- * @param y (Sequence of) scalar(s).
- * @param mu (Sequence of) location parameter(s)
- * for the normal distribution.
- * @param sigma (Sequence of) scale parameters for the normal
- * distribution.
- * @return The log of the product of the densities.
- * @throw std::domain_error if the scale is not positive.
+ * @tparam T_y type of scalar or vector
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
  */
-template <bool propto, typename T_y, typename T_loc, typename T_scale>
-inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
-                                                      const T_loc& mu,
-                                                      const T_scale& sigma) {
-  static const char* function = "normal_lpdf";
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_not_t<
+              is_vectorizable_density<T_y, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_loc, T_scale> normal_lpdf_impl(
+    const T_y& y, const T_loc& mu, const T_scale& sigma) {
   using T_partials_return = partials_return_t<T_y, T_loc, T_scale>;
-
   using std::log;
 
-  if (size_zero(y, mu, sigma)) {
-    return 0.0;
-  }
-
   T_partials_return logp(0.0);
 
-  check_not_nan(function, "Random variable", y);
-  check_finite(function, "Location parameter", mu);
-  check_positive(function, "Scale parameter", sigma);
-  check_consistent_sizes(function, "Random variable", y, "Location parameter",
-                         mu, "Scale parameter", sigma);
-  if (!include_summand<propto, T_y, T_loc, T_scale>::value) {
-    return 0.0;
-  }
-
   operands_and_partials<T_y, T_loc, T_scale> ops_partials(y, mu, sigma);
 
   scalar_seq_view<T_y> y_vec(y);
@@ -106,6 +92,123 @@ inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * Calculates the log of the normal density and its partials with
+ * Eigen array expressions over all elements of the arguments.
+ *
+ * @tparam T_y type of scalar or vector
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale,
+          require_t<is_vectorizable_density<T_y, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_loc, T_scale> normal_lpdf_impl(
+    const T_y& y, const T_loc& mu, const T_scale& sigma) {
+  using std::log;
+  using T_diff = value_array_or_scalar_t<T_y, T_loc, T_scale>;
+
+  const auto& y_val = as_value_array_or_scalar(y);
+  const auto& mu_val = as_value_array_or_scalar(mu);
+  const auto& sigma_val = as_value_array_or_scalar(sigma);
+  const size_t N = max_size(y, mu, sigma);
+
+  const value_array_or_scalar_t<T_scale> inv_sigma = 1.0 / sigma_val;
+  T_diff scaled_diff = T_diff();
+  T_diff sigma_derivative = T_diff();
+  if (!is_constant_all<T_y, T_loc>::value) {
+    scaled_diff = T_diff(N);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    sigma_derivative = T_diff(N);
+  }
+
+  const size_t num_chunks = num_parallel_chunks(N);
+  std::vector<double> logp_chunks(num_chunks);
+  parallel_chunks(N, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+    const size_t n = end - start;
+    const auto& inv_sigma_chunk = segment_or_scalar(inv_sigma, start, n);
+    const T_diff y_scaled = (segment_or_scalar(y_val, start, n)
+                             - segment_or_scalar(mu_val, start, n))
+                            * inv_sigma_chunk;
+    const T_diff y_scaled_sq = y_scaled * y_scaled;
+    logp_chunks[chunk] = -0.5 * sum(y_scaled_sq);
+    if (!is_constant_all<T_y, T_loc>::value) {
+      segment_or_scalar(scaled_diff, start, n) = inv_sigma_chunk * y_scaled;
+    }
+    if (!is_constant_all<T_scale>::value) {
+      segment_or_scalar(sigma_derivative, start, n)
+          = inv_sigma_chunk * y_scaled_sq - inv_sigma_chunk;
+    }
+  });
+
+  double logp = sum(logp_chunks);
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N;
+  }
+  if (include_summand<propto, T_scale>::value) {
+    logp -= sum(log(sigma_val)) * N / size(sigma);
+  }
+
+  operands_and_partials<T_y, T_loc, T_scale> ops_partials(y, mu, sigma);
+  if (!is_constant_all<T_y>::value) {
+    set_vectorized_partials<T_y>(ops_partials.edge1_, -scaled_diff);
+  }
+  if (!is_constant_all<T_loc>::value) {
+    set_vectorized_partials<T_loc>(ops_partials.edge2_, scaled_diff);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    set_vectorized_partials<T_scale>(ops_partials.edge3_, sigma_derivative);
+  }
+  return ops_partials.build(logp);
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * The log of the normal density for the specified scalar(s) given
+ * the specified mean(s) and deviation(s). y, mu, or sigma can
+ * each be either a scalar or a vector. Any vector inputs
+ * must be the same length.
+ *
+ * <p>The result log probability is defined to be the sum of the
+ * log probabilities for each observation/mean/deviation triple.
+ * @tparam T_y Underlying type of scalar in sequence.
+ * @tparam T_loc Type of location parameter.
+ * @tparam T_scale Type of scale parameter.
+ * @param y (Sequence of) scalar(s).
+ * @param mu (Sequence of) location parameter(s)
+ * for the normal distribution.
+ * @param sigma (Sequence of) scale parameters for the normal
+ * distribution.
+ * @return The log of the product of the densities.
+ * @throw std::domain_error if the scale is not positive.
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_scale>
+inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
+                                                      const T_loc& mu,
+                                                      const T_scale& sigma) {
+  static const char* function = "normal_lpdf";
+
+  if (size_zero(y, mu, sigma)) {
+    return 0.0;
+  }
+
+  check_not_nan(function, "Random variable", y);
+  check_finite(function, "Location parameter", mu);
+  check_positive(function, "Scale parameter", sigma);
+  check_consistent_sizes(function, "Random variable", y, "Location parameter",
+                         mu, "Scale parameter", sigma);
+  if (!include_summand<propto, T_y, T_loc, T_scale>::value) {
+    return 0.0;
+  }
+
+  return internal::normal_lpdf_impl<propto>(y, mu, sigma);
+}
+
 template <typename T_y, typename T_loc, typename T_scale>
 inline return_type_t<T_y, T_loc, T_scale> normal_lpdf(const T_y& y,
                                                       const T_loc& mu,
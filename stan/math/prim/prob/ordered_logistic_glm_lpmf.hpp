@@ -5,8 +5,11 @@
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/log1m_exp.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -47,14 +50,11 @@ ordered_logistic_glm_lpmf(
   using Eigen::Array;
   using Eigen::Dynamic;
   using Eigen::Matrix;
-  using Eigen::VectorXd;
   using std::exp;
   using std::isfinite;
 
   using T_partials_return
       = partials_return_t<T_y, T_x_scalar, T_beta_scalar, T_cuts_scalar>;
-  typedef typename std::conditional_t<T_x_rows == 1, double, VectorXd>
-      T_location;
 
   static const char* function = "ordered_logistic_glm_lpmf";
 
@@ -103,90 +103,137 @@ ordered_logistic_glm_lpmf(
     }
   }
 
-  T_location location = x_val * beta_val_vec;
-  if (!isfinite(sum(location))) {
-    check_finite(function, "Weight vector", beta);
-    check_finite(function, "Matrix of independent variables", x);
+  double location_tmp = 0;
+  if (T_x_rows == 1) {
+    location_tmp = (x_val * beta_val_vec)(0, 0);
   }
 
-  Array<double, Dynamic, 1> cut2 = as_array_or_scalar(location) - cuts_y2;
-  Array<double, Dynamic, 1> cut1 = as_array_or_scalar(location) - cuts_y1;
-
-  // Not immediately evaluating next two expressions benefits performance
-  auto m_log_1p_exp_cut1
-      = (cut1 > 0.0).select(-cut1, 0) - (-cut1.abs()).exp().log1p();
-  auto m_log_1p_exp_m_cut2
-      = (cut2 <= 0.0).select(cut2, 0) - (-cut2.abs()).exp().log1p();
-
-  T_partials_return logp(0);
-  if (is_vector<T_y>::value) {
-    Eigen::Map<const Eigen::Matrix<int, Eigen::Dynamic, 1>> y_vec(&y_seq[0],
-                                                                  y_seq.size());
-    logp = y_vec.cwiseEqual(1)
-               .select(m_log_1p_exp_cut1,
-                       y_vec.cwiseEqual(N_classes).select(
-                           m_log_1p_exp_m_cut2,
-                           m_log_1p_exp_m_cut2 + log1m_exp(cut1 - cut2).array()
-                               + m_log_1p_exp_cut1))
-               .sum();
-  } else {
-    if (y_seq[0] == 1) {
-      logp = m_log_1p_exp_cut1.sum();
-    } else if (y_seq[0] == N_classes) {
-      logp = m_log_1p_exp_m_cut2.sum();
-    } else {
-      logp = (m_log_1p_exp_m_cut2 + log1m_exp(cut1 - cut2).array()
-              + m_log_1p_exp_cut1)
-                 .sum();
-    }
+  // The cut-point derivatives are accumulated after the chunks.
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<double, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta_scalar>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
   }
-
-  operands_and_partials<Matrix<T_x_scalar, T_x_rows, Dynamic>,
-                        Eigen::Matrix<T_beta_scalar, Eigen::Dynamic, 1>,
-                        Eigen::Matrix<T_cuts_scalar, Eigen::Dynamic, 1>>
-      ops_partials(x, beta, cuts);
+  Array<double, Dynamic, 1> location(N_instances);
+  Array<double, Dynamic, 1> d1, d2;
   if (!is_constant_all<T_x_scalar, T_beta_scalar, T_cuts_scalar>::value) {
-    Array<double, Dynamic, 1> exp_m_cut1 = exp(-cut1);
-    Array<double, Dynamic, 1> exp_m_cut2 = exp(-cut2);
-    Array<double, Dynamic, 1> exp_cuts_diff = exp(cuts_y2 - cuts_y1);
-    Array<double, Dynamic, 1> d1
-        = (cut2 > 0).select(exp_m_cut2 / (1 + exp_m_cut2), 1 / (1 + exp(cut2)))
-          - exp_cuts_diff / (exp_cuts_diff - 1);
-    Array<double, Dynamic, 1> d2
-        = 1 / (1 - exp_cuts_diff)
-          - (cut1 > 0).select(exp_m_cut1 / (1 + exp_m_cut1),
-                              1 / (1 + exp(cut1)));
-    if (!is_constant_all<T_x_scalar, T_beta_scalar>::value) {
-      Matrix<double, 1, Dynamic> location_derivative = d1 - d2;
-      if (!is_constant_all<T_x_scalar>::value) {
+    d1.resize(N_instances);
+    d2.resize(N_instances);
+  }
+  Matrix<double, 1, Dynamic> location_derivative;
+  if (!is_constant_all<T_x_scalar, T_beta_scalar>::value) {
+    location_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        auto location_chunk = location.segment(start, n);
         if (T_x_rows == 1) {
-          ops_partials.edge1_.partials_
-              = beta_val_vec * location_derivative.sum();
+          location_chunk = location_tmp;
         } else {
-          ops_partials.edge1_.partials_
-              = (beta_val_vec * location_derivative).transpose();
+          location_chunk
+              = (x_val.middleRows(start, n) * beta_val_vec).array();
         }
-      }
-      if (!is_constant_all<T_beta_scalar>::value) {
-        if (T_x_rows == 1) {
-          ops_partials.edge2_.partials_
-              = (location_derivative * x_val.replicate(N_instances, 1))
-                    .transpose();
+        const auto cuts_y1_chunk = cuts_y1.segment(start, n);
+        const auto cuts_y2_chunk = cuts_y2.segment(start, n);
+        Array<double, Dynamic, 1> cut2 = location_chunk - cuts_y2_chunk;
+        Array<double, Dynamic, 1> cut1 = location_chunk - cuts_y1_chunk;
+
+        // Not immediately evaluating next two expressions benefits
+        // performance
+        auto m_log_1p_exp_cut1
+            = (cut1 > 0.0).select(-cut1, 0) - (-cut1.abs()).exp().log1p();
+        auto m_log_1p_exp_m_cut2
+            = (cut2 <= 0.0).select(cut2, 0) - (-cut2.abs()).exp().log1p();
+
+        if (is_vector<T_y>::value) {
+          Eigen::Map<const Eigen::Matrix<int, Eigen::Dynamic, 1>> y_vec(
+              &y_seq[start], n);
+          logp_chunks[chunk]
+              = y_vec.cwiseEqual(1)
+                    .select(m_log_1p_exp_cut1,
+                            y_vec.cwiseEqual(N_classes).select(
+                                m_log_1p_exp_m_cut2,
+                                m_log_1p_exp_m_cut2
+                                    + log1m_exp(cut1 - cut2).array()
+                                    + m_log_1p_exp_cut1))
+                    .sum();
         } else {
-          ops_partials.edge2_.partials_
-              = (location_derivative * x_val).transpose();
-        }
-      }
-    }
-    if (!is_constant_all<T_cuts_scalar>::value) {
-      for (int i = 0; i < N_instances; i++) {
-        int c = y_seq[i];
-        if (c != N_classes) {
-          ops_partials.edge3_.partials_[c - 1] += d2[i];
+          if (y_seq[0] == 1) {
+            logp_chunks[chunk] = m_log_1p_exp_cut1.sum();
+          } else if (y_seq[0] == N_classes) {
+            logp_chunks[chunk] = m_log_1p_exp_m_cut2.sum();
+          } else {
+            logp_chunks[chunk] = (m_log_1p_exp_m_cut2
+                                  + log1m_exp(cut1 - cut2).array()
+                                  + m_log_1p_exp_cut1)
+                                     .sum();
+          }
         }
-        if (c != 1) {
-          ops_partials.edge3_.partials_[c - 2] -= d1[i];
+
+        if (!is_constant_all<T_x_scalar, T_beta_scalar,
+                             T_cuts_scalar>::value) {
+          Array<double, Dynamic, 1> exp_m_cut1 = exp(-cut1);
+          Array<double, Dynamic, 1> exp_m_cut2 = exp(-cut2);
+          Array<double, Dynamic, 1> exp_cuts_diff
+              = exp(cuts_y2_chunk - cuts_y1_chunk);
+          d1.segment(start, n)
+              = (cut2 > 0).select(exp_m_cut2 / (1 + exp_m_cut2),
+                                  1 / (1 + exp(cut2)))
+                - exp_cuts_diff / (exp_cuts_diff - 1);
+          d2.segment(start, n)
+              = 1 / (1 - exp_cuts_diff)
+                - (cut1 > 0).select(exp_m_cut1 / (1 + exp_m_cut1),
+                                    1 / (1 + exp(cut1)));
+          if (!is_constant_all<T_x_scalar, T_beta_scalar>::value) {
+            location_derivative.segment(start, n)
+                = d1.segment(start, n) - d2.segment(start, n);
+            if (!is_constant_all<T_beta_scalar>::value && T_x_rows != 1) {
+              beta_derivative_chunks.col(chunk)
+                  = (location_derivative.segment(start, n)
+                     * x_val.middleRows(start, n))
+                        .transpose();
+            }
+          }
         }
+      });
+  if (!isfinite(sum(location))) {
+    check_finite(function, "Weight vector", beta);
+    check_finite(function, "Matrix of independent variables", x);
+  }
+  T_partials_return logp = sum(logp_chunks);
+
+  operands_and_partials<Matrix<T_x_scalar, T_x_rows, Dynamic>,
+                        Eigen::Matrix<T_beta_scalar, Eigen::Dynamic, 1>,
+                        Eigen::Matrix<T_cuts_scalar, Eigen::Dynamic, 1>>
+      ops_partials(x, beta, cuts);
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge1_.partials_ = beta_val_vec * location_derivative.sum();
+    } else {
+      ops_partials.edge1_.partials_
+          = (beta_val_vec * location_derivative).transpose();
+    }
+  }
+  if (!is_constant_all<T_beta_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge2_.partials_
+          = (location_derivative.sum() * x_val).transpose();
+    } else {
+      ops_partials.edge2_.partials_
+          = beta_derivative_chunks.rowwise().sum();
+    }
+  }
+  if (!is_constant_all<T_cuts_scalar>::value) {
+    for (int i = 0; i < N_instances; i++) {
+      int c = y_seq[i];
+      if (c != N_classes) {
+        ops_partials.edge3_.partials_[c - 1] += d2[i];
+      }
+      if (c != 1) {
+        ops_partials.edge3_.partials_[c - 2] -= d1[i];
       }
     }
   }
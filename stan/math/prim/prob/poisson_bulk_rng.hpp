@@ -0,0 +1,102 @@
+#ifndef STAN_MATH_PRIM_PROB_POISSON_BULK_RNG_HPP
+#define STAN_MATH_PRIM_PROB_POISSON_BULK_RNG_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/discrete_inversion_table.hpp>
+#include <stan/math/prim/fun/philox4x32.hpp>
+#include <stan/math/prim/functor/bulk_rng_draws.hpp>
+#include <boost/random/poisson_distribution.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Returns the probabilities of 0, 1, ..., K of a Poisson distribution,
+ * where K is the first value above the rate whose probability is below
+ * 1e-18. The probabilities decrease faster than geometrically with
+ * ratio rate / (K + 1) after K, so the mass left out is below the rate
+ * times 1e-18.
+ *
+ * @param lambda rate, 0 < lambda < 100
+ * @return probabilities of 0, ..., K
+ */
+inline std::vector<double> poisson_pmf_head(double lambda) {
+  std::vector<double> pmf;
+  double p = std::exp(-lambda);
+  pmf.push_back(p);
+  for (int k = 0; k <= lambda || p >= 1e-18;) {
+    ++k;
+    p *= lambda / k;
+    pmf.push_back(p);
+  }
+  return pmf;
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * Return the specified number of Poisson random variates for the given
+ * rate using the specified counter-based random number generator.
+ *
+ * For a scalar rate below 100 the variates are drawn by inversion with
+ * an internal::discrete_inversion_table, which takes a single uniform
+ * variate and a few comparisons per variate instead of the setup and
+ * the steps of inversion or rejection for each variate. Otherwise they
+ * are drawn by inversion or rejection with the Boost Poisson
+ * distribution. Each run of consecutive variates uses its own substream
+ * of the generator, so runs are independent of each other and are drawn
+ * in parallel chunks if STAN_THREADS is defined and the number of
+ * variates is large. The result only depends on the state of the
+ * generator and not on the number of threads. The generator is advanced
+ * past the blocks reserved for the substreams.
+ *
+ * lambda can be a scalar or a one-dimensional container of size n_draws.
+ *
+ * @tparam T_rate type of rate parameter
+ * @param lambda (Sequence of) rate parameter(s)
+ * @param n_draws number of variates
+ * @param rng random number generator
+ * @return Poisson random variates
+ * @throw std::domain_error if lambda is nonpositive or too large
+ * @throw std::invalid_argument if lambda is a container not of size
+ * n_draws
+ */
+template <typename T_rate>
+inline std::vector<int> poisson_bulk_rng(const T_rate& lambda,
+                                         std::size_t n_draws,
+                                         philox4x32& rng) {
+  using boost::random::poisson_distribution;
+  static const char* function = "poisson_bulk_rng";
+
+  check_not_nan(function, "Rate parameter", lambda);
+  check_positive(function, "Rate parameter", lambda);
+  check_less(function, "Rate parameter", lambda, POISSON_MAX_RATE);
+  check_consistent_size(function, "Rate parameter", lambda, n_draws);
+
+  scalar_seq_view<T_rate> lambda_vec(lambda);
+  std::vector<int> output(n_draws);
+  if (!is_vector<T_rate>::value && lambda_vec[0] < 100) {
+    const internal::discrete_inversion_table table(
+        internal::poisson_pmf_head(lambda_vec[0]));
+    internal::bulk_rng_draws(n_draws, rng,
+                             [&](std::size_t n, philox4x32& sub) {
+                               output[n] = table(
+                                   internal::philox_unit_interval(sub));
+                             });
+    return output;
+  }
+  internal::bulk_rng_draws(n_draws, rng, [&](std::size_t n, philox4x32& sub) {
+    output[n] = poisson_distribution<>(lambda_vec[n])(sub);
+  });
+  return output;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
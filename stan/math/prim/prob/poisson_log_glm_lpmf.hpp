@@ -7,7 +7,10 @@
 #include <stan/math/prim/fun/lgamma.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <type_traits>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -78,8 +81,6 @@ return_type_t<T_x_scalar, T_alpha, T_beta> poisson_log_glm_lpmf(
     return 0;
   }
 
-  T_partials_return logp(0);
-
   const auto& x_val = value_of_rec(x);
   const auto& y_val = value_of_rec(y);
   const auto& beta_val = value_of_rec(beta);
@@ -89,35 +90,59 @@ return_type_t<T_x_scalar, T_alpha, T_beta> poisson_log_glm_lpmf(
   const auto& beta_val_vec = as_column_vector_or_scalar(beta_val);
   const auto& alpha_val_vec = as_column_vector_or_scalar(alpha_val);
 
-  Array<T_partials_return, Dynamic, 1> theta(N_instances);
+  const auto& y_arr = as_array_or_scalar(y_val_vec);
+  const auto& alpha_arr = as_array_or_scalar(alpha_val_vec);
+
+  T_theta_tmp theta_tmp(0);
   if (T_x_rows == 1) {
-    T_theta_tmp theta_tmp
-        = forward_as<T_theta_tmp>((x_val * beta_val_vec)(0, 0));
-    theta = theta_tmp + as_array_or_scalar(alpha_val_vec);
-  } else {
-    theta = x_val * beta_val_vec;
-    theta += as_array_or_scalar(alpha_val_vec);
+    theta_tmp = forward_as<T_theta_tmp>((x_val * beta_val_vec)(0, 0));
   }
 
-  Matrix<T_partials_return, Dynamic, 1> theta_derivative
-      = as_array_or_scalar(y_val_vec) - exp(theta.array());
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Array<T_partials_return, Dynamic, 1> theta(N_instances);
+  Matrix<T_partials_return, Dynamic, 1> theta_derivative(N_instances);
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto& y_chunk = segment_or_scalar(y_arr, start, n);
+        auto theta_chunk = theta.segment(start, n);
+        if (T_x_rows == 1) {
+          theta_chunk = theta_tmp + segment_or_scalar(alpha_arr, start, n);
+        } else {
+          theta_chunk = (x_val.middleRows(start, n) * beta_val_vec).array();
+          theta_chunk += segment_or_scalar(alpha_arr, start, n);
+        }
+        const Array<T_partials_return, Dynamic, 1> exp_theta
+            = exp(theta_chunk);
+        theta_derivative.segment(start, n) = (y_chunk - exp_theta).matrix();
+        logp_chunks[chunk] = (y_chunk * theta_chunk - exp_theta).sum();
+        if (include_summand<propto>::value && is_vector<T_y>::value) {
+          logp_chunks[chunk] -= sum(lgamma(y_chunk + 1));
+        }
+        if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+          beta_derivative_chunks.col(chunk)
+              = x_val.middleRows(start, n).transpose()
+                * theta_derivative.segment(start, n);
+        }
+      });
+
   double theta_derivative_sum = sum(theta_derivative);
   if (!std::isfinite(theta_derivative_sum)) {
     check_finite(function, "Weight vector", beta);
     check_finite(function, "Intercept", alpha);
     check_finite(function, "Matrix of independent variables", theta);
   }
-  if (include_summand<propto>::value) {
-    if (is_vector<T_y>::value) {
-      logp -= sum(lgamma(as_array_or_scalar(y_val_vec) + 1));
-    } else {
-      logp -= lgamma(forward_as<double>(y_val) + 1);
-    }
+  T_partials_return logp = sum(logp_chunks);
+  if (include_summand<propto>::value && !is_vector<T_y>::value) {
+    logp -= lgamma(forward_as<double>(y_val) + 1);
   }
 
-  logp += sum(as_array_or_scalar(y_val_vec) * theta.array()
-              - exp(theta.array()));
-
   operands_and_partials<Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic>,
                         T_alpha, T_beta>
       ops_partials(x, alpha, beta);
@@ -128,7 +153,7 @@ return_type_t<T_x_scalar, T_alpha, T_beta> poisson_log_glm_lpmf(
           = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
               theta_derivative.sum() * x_val);
     } else {
-      ops_partials.edge3_.partials_ = x_val.transpose() * theta_derivative;
+      ops_partials.edge3_.partials_ = beta_derivative_chunks.rowwise().sum();
     }
   }
   if (!is_constant_all<T_x_scalar>::value) {
@@ -0,0 +1,307 @@
+#ifndef STAN_MATH_PRIM_PROB_STUDENT_T_ID_GLM_LPDF_HPP
+#define STAN_MATH_PRIM_PROB_STUDENT_T_ID_GLM_LPDF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/digamma.hpp>
+#include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/size_zero.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/** \ingroup multivar_dists
+ * Returns the log PDF of the Generalized Linear Model (GLM)
+ * with Student-t distribution and id link function, known as robust
+ * regression.
+ * If containers are supplied, returns the log sum of the probabilities.
+ * The idea is that student_t_id_glm_lpdf(y, x, alpha, beta, nu, sigma)
+ * should compute a more efficient version of
+ * student_t_lpdf(y, nu, alpha + x * beta, sigma) by using analytically
+ * simplified gradients.
+ *
+ * The dependent variables are data. Together with the matrix of
+ * independent variables, the intercept, the weights, the degrees of
+ * freedom and the scale, they would exceed the five operands a single
+ * <code>operands_and_partials</code> node can hold.
+ *
+ * @tparam T_y type of vector of dependent variables (labels);
+ * this can also be a single value; it must not be an autodiff type
+ * @tparam T_x_scalar type of a scalar in the matrix of independent variables
+ * (features)
+ * @tparam T_x_rows compile-time number of rows of `x`. It can be either
+ * `Eigen::Dynamic` or 1.
+ * @tparam T_alpha type of the intercept(s);
+ * this can be a vector (of the same length as y) of intercepts or a single
+ * value (for models with constant intercept);
+ * @tparam T_beta type of the weight vector;
+ * this can also be a single value;
+ * @tparam T_dof type of the (positive) degrees of freedom;
+ * this can be a vector (of the same length as y) or a scalar.
+ * @tparam T_scale type of the (positive) scale(s);
+ * this can be a vector (of the same length as y, for heteroskedasticity)
+ * or a scalar.
+ * @param y scalar or vector of dependent variables. If it is a scalar it will
+ * be broadcast - used for all instances.
+ * @param x design matrix or row vector. If it is a row vector it will be
+ * broadcast - used for all instances.
+ * @param alpha intercept
+ * @param beta weight vector
+ * @param nu (Sequence of) degrees of freedom parameters.
+ * @param sigma (Sequence of) scale parameters.
+ * @return log probability or log sum of probabilities
+ * @throw std::domain_error if x, beta, alpha or y is infinite.
+ * @throw std::domain_error if the degrees of freedom or the scale is not
+ * positive and finite.
+ * @throw std::invalid_argument if container sizes mismatch.
+ */
+template <bool propto, typename T_y, typename T_x_scalar, int T_x_rows,
+          typename T_alpha, typename T_beta, typename T_dof, typename T_scale,
+          require_t<is_constant_all<T_y>>* = nullptr>
+return_type_t<T_x_scalar, T_alpha, T_beta, T_dof, T_scale>
+student_t_id_glm_lpdf(
+    const T_y &y, const Eigen::Matrix<T_x_scalar, T_x_rows, Eigen::Dynamic> &x,
+    const T_alpha &alpha, const T_beta &beta, const T_dof &nu,
+    const T_scale &sigma) {
+  static const char *function = "student_t_id_glm_lpdf";
+
+  using Eigen::Array;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using Eigen::log1p;
+
+  using T_partials_return
+      = partials_return_t<T_y, T_x_scalar, T_alpha, T_beta, T_dof, T_scale>;
+  using T_scale_val = typename std::conditional_t<
+      is_vector<T_scale>::value,
+      Eigen::Array<partials_return_t<T_scale>, -1, 1>,
+      partials_return_t<T_scale>>;
+  using T_y_scaled_tmp =
+      typename std::conditional_t<T_x_rows == 1, T_partials_return,
+                                  Array<T_partials_return, Dynamic, 1>>;
+
+  const size_t N_instances = T_x_rows == 1 ? size(y) : x.rows();
+  const size_t N_attributes = x.cols();
+
+  check_consistent_size(function, "Vector of dependent variables", y,
+                        N_instances);
+  check_consistent_size(function, "Weight vector", beta, N_attributes);
+  check_consistent_size(function, "Vector of degrees of freedom parameters",
+                        nu, N_instances);
+  check_consistent_size(function, "Vector of scale parameters", sigma,
+                        N_instances);
+  check_consistent_size(function, "Vector of intercepts", alpha, N_instances);
+  check_positive_finite(function, "Degrees of freedom parameter", nu);
+  check_positive_finite(function, "Scale vector", sigma);
+
+  if (size_zero(y, nu, sigma)) {
+    return 0;
+  }
+
+  if (!include_summand<propto, T_x_scalar, T_alpha, T_beta, T_dof,
+                       T_scale>::value) {
+    return 0;
+  }
+
+  const auto &x_val = value_of_rec(x);
+  const auto &beta_val = value_of_rec(beta);
+  const auto &alpha_val = value_of_rec(alpha);
+  const auto &nu_val = value_of_rec(nu);
+  const auto &sigma_val = value_of_rec(sigma);
+  const auto &y_val = value_of_rec(y);
+
+  const auto &beta_val_vec = as_column_vector_or_scalar(beta_val);
+  const auto &alpha_val_vec = as_column_vector_or_scalar(alpha_val);
+  const auto &nu_val_vec = as_column_vector_or_scalar(nu_val);
+  const auto &sigma_val_vec = as_column_vector_or_scalar(sigma_val);
+  const auto &y_val_vec = as_column_vector_or_scalar(y_val);
+
+  const auto &y_arr = as_array_or_scalar(y_val_vec);
+  const auto &alpha_arr = as_array_or_scalar(alpha_val_vec);
+  const auto &nu_arr = as_array_or_scalar(nu_val_vec);
+  T_scale_val inv_sigma = 1 / as_array_or_scalar(sigma_val_vec);
+
+  T_y_scaled_tmp y_scaled_tmp(0);
+  if (T_x_rows == 1) {
+    y_scaled_tmp = forward_as<T_y_scaled_tmp>((x_val * beta_val_vec)(0, 0));
+  }
+
+  const size_t num_chunks
+      = internal::num_parallel_chunks<T_partials_return>(N_instances);
+  std::vector<T_partials_return> logp_chunks(num_chunks);
+  Matrix<T_partials_return, Dynamic, Dynamic> beta_derivative_chunks;
+  if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+    beta_derivative_chunks.resize(N_attributes, num_chunks);
+  }
+  Array<T_partials_return, Dynamic, 1> y_scaled(N_instances);
+  Matrix<T_partials_return, Dynamic, 1> mu_derivative;
+  if (!is_constant_all<T_x_scalar, T_alpha, T_beta>::value) {
+    mu_derivative.resize(N_instances);
+  }
+  Array<T_partials_return, Dynamic, 1> nu_derivative;
+  if (!is_constant_all<T_dof>::value) {
+    nu_derivative.resize(N_instances);
+  }
+  Array<T_partials_return, Dynamic, 1> sigma_derivative;
+  if (!is_constant_all<T_scale>::value) {
+    sigma_derivative.resize(N_instances);
+  }
+  internal::parallel_chunks(
+      N_instances, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+        const size_t n = end - start;
+        const auto &nu_chunk = segment_or_scalar(nu_arr, start, n);
+        const auto &inv_sigma_chunk = segment_or_scalar(inv_sigma, start, n);
+        auto y_scaled_chunk = y_scaled.segment(start, n);
+        if (T_x_rows == 1) {
+          y_scaled_chunk = (segment_or_scalar(y_arr, start, n) - y_scaled_tmp
+                            - segment_or_scalar(alpha_arr, start, n))
+                           * inv_sigma_chunk;
+        } else {
+          y_scaled_chunk = (x_val.middleRows(start, n) * beta_val_vec).array();
+          y_scaled_chunk = (segment_or_scalar(y_arr, start, n) - y_scaled_chunk
+                            - segment_or_scalar(alpha_arr, start, n))
+                           * inv_sigma_chunk;
+        }
+        const Array<T_partials_return, Dynamic, 1> y_scaled_sq
+            = y_scaled_chunk * y_scaled_chunk;
+        const Array<T_partials_return, Dynamic, 1> log1p_y_scaled_sq_over_nu
+            = log1p(y_scaled_sq / nu_chunk);
+        logp_chunks[chunk]
+            = -0.5 * sum((nu_chunk + 1) * log1p_y_scaled_sq_over_nu);
+        if (include_summand<propto, T_dof>::value && is_vector<T_dof>::value) {
+          logp_chunks[chunk] += sum(lgamma(0.5 * (nu_chunk + 1))
+                                    - lgamma(0.5 * nu_chunk)
+                                    - 0.5 * log(nu_chunk));
+        }
+
+        if (!is_constant_all<T_x_scalar, T_alpha, T_beta, T_dof,
+                             T_scale>::value) {
+          // weight of each instance in the scale mixture representation
+          const Array<T_partials_return, Dynamic, 1> weight
+              = (nu_chunk + 1) / (nu_chunk + y_scaled_sq);
+          if (!is_constant_all<T_x_scalar, T_alpha, T_beta>::value) {
+            mu_derivative.segment(start, n)
+                = (weight * y_scaled_chunk * inv_sigma_chunk).matrix();
+            if (!is_constant_all<T_beta>::value && T_x_rows != 1) {
+              beta_derivative_chunks.col(chunk)
+                  = x_val.middleRows(start, n).transpose()
+                    * mu_derivative.segment(start, n);
+            }
+          }
+          if (!is_constant_all<T_dof>::value) {
+            nu_derivative.segment(start, n)
+                = 0.5
+                  * (weight * y_scaled_sq / nu_chunk
+                     - log1p_y_scaled_sq_over_nu);
+            if (is_vector<T_dof>::value) {
+              nu_derivative.segment(start, n)
+                  += 0.5
+                     * (digamma(0.5 * (nu_chunk + 1)) - digamma(0.5 * nu_chunk)
+                        - 1 / nu_chunk);
+            }
+          }
+          if (!is_constant_all<T_scale>::value) {
+            sigma_derivative.segment(start, n)
+                = (weight * y_scaled_sq - 1) * inv_sigma_chunk;
+          }
+        }
+      });
+  T_partials_return logp = sum(logp_chunks);
+
+  if (!std::isfinite(logp)) {
+    check_finite(function, "Vector of dependent variables", y);
+    check_finite(function, "Weight vector", beta);
+    check_finite(function, "Intercept", alpha);
+    check_finite(function, "Matrix of independent variables", y_scaled);
+  }
+
+  // Compute log probability.
+  if (include_summand<propto>::value) {
+    logp -= LOG_SQRT_PI * N_instances;
+  }
+  if (include_summand<propto, T_dof>::value && !is_vector<T_dof>::value) {
+    const double nu_dbl = forward_as<double>(nu_val);
+    logp += N_instances
+            * (lgamma(0.5 * (nu_dbl + 1)) - lgamma(0.5 * nu_dbl)
+               - 0.5 * log(nu_dbl));
+  }
+  if (include_summand<propto, T_scale>::value) {
+    if (is_vector<T_scale>::value) {
+      logp -= sum(log(sigma_val_vec));
+    } else {
+      logp -= N_instances * log(forward_as<double>(sigma_val));
+    }
+  }
+
+  operands_and_partials<Matrix<T_x_scalar, T_x_rows, Dynamic>, T_alpha,
+                        T_beta, T_dof, T_scale>
+      ops_partials(x, alpha, beta, nu, sigma);
+
+  if (!is_constant_all<T_x_scalar>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge1_.partials_
+          = forward_as<Array<T_partials_return, Dynamic, T_x_rows>>(
+              beta_val_vec * sum(mu_derivative));
+    } else {
+      ops_partials.edge1_.partials_
+          = (beta_val_vec * mu_derivative.transpose()).transpose();
+    }
+  }
+  if (!is_constant_all<T_beta>::value) {
+    if (T_x_rows == 1) {
+      ops_partials.edge3_.partials_
+          = forward_as<Matrix<T_partials_return, 1, Dynamic>>(
+              mu_derivative.sum() * x_val);
+    } else {
+      ops_partials.edge3_.partials_
+          = beta_derivative_chunks.rowwise().sum().transpose();
+    }
+  }
+  if (!is_constant_all<T_alpha>::value) {
+    if (is_vector<T_alpha>::value) {
+      ops_partials.edge2_.partials_ = std::move(mu_derivative);
+    } else {
+      ops_partials.edge2_.partials_[0] = sum(mu_derivative);
+    }
+  }
+  if (!is_constant_all<T_dof>::value) {
+    if (is_vector<T_dof>::value) {
+      ops_partials.edge4_.partials_ = nu_derivative;
+    } else {
+      const double nu_dbl = forward_as<double>(nu_val);
+      ops_partials.edge4_.partials_[0]
+          = 0.5 * N_instances
+                * (digamma(0.5 * (nu_dbl + 1)) - digamma(0.5 * nu_dbl)
+                   - 1 / nu_dbl)
+            + sum(nu_derivative);
+    }
+  }
+  if (!is_constant_all<T_scale>::value) {
+    if (is_vector<T_scale>::value) {
+      ops_partials.edge5_.partials_ = sigma_derivative;
+    } else {
+      ops_partials.edge5_.partials_[0] = sum(sigma_derivative);
+    }
+  }
+
+  return ops_partials.build(logp);
+}
+
+template <typename T_y, typename T_x, typename T_alpha, typename T_beta,
+          typename T_dof, typename T_scale>
+inline return_type_t<T_x, T_alpha, T_beta, T_dof, T_scale>
+student_t_id_glm_lpdf(const T_y &y, const T_x &x, const T_alpha &alpha,
+                      const T_beta &beta, const T_dof &nu,
+                      const T_scale &sigma) {
+  return student_t_id_glm_lpdf<false>(y, x, alpha, beta, nu, sigma);
+}
+}  // namespace math
+}  // namespace stan
+#endif
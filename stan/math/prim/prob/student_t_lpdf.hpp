@@ -3,73 +3,49 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_array_or_scalar.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
 #include <stan/math/prim/fun/constants.hpp>
 #include <stan/math/prim/fun/square.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
+#include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/log1p.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
+#include <stan/math/prim/functor/parallel_chunks.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
 /** \ingroup prob_dists
- * The log of the Student-t density for the given y, nu, mean, and
- * scale parameter.  The scale parameter must be greater
- * than 0.
- *
- * \f{eqnarray*}{
- y &\sim& t_{\nu} (\mu, \sigma^2) \\
- \log (p (y \, |\, \nu, \mu, \sigma) ) &=& \log \left( \frac{\Gamma((\nu + 1)
- /2)}
- {\Gamma(\nu/2)\sqrt{\nu \pi} \sigma} \left( 1 + \frac{1}{\nu} (\frac{y -
- \mu}{\sigma})^2 \right)^{-(\nu + 1)/2} \right) \\
- &=& \log( \Gamma( (\nu+1)/2 )) - \log (\Gamma (\nu/2) - \frac{1}{2} \log(\nu
- \pi) - \log(\sigma)
- -\frac{\nu + 1}{2} \log (1 + \frac{1}{\nu} (\frac{y - \mu}{\sigma})^2)
- \f}
+ * Calculates the log of the Student-t density and its partials with a
+ * loop over the scalars of the arguments.
  *
- * @param y A scalar variable.
- * @param nu Degrees of freedom.
- * @param mu The mean of the Student-t distribution.
- * @param sigma The scale parameter of the Student-t distribution.
- * @return The log of the Student-t density at y.
- * @throw std::domain_error if sigma is not greater than 0.
- * @throw std::domain_error if nu is not greater than 0.
- * @tparam T_y Type of scalar.
- * @tparam T_dof Type of degrees of freedom.
- * @tparam T_loc Type of location.
- * @tparam T_scale Type of scale.
+ * @tparam T_y type of scalar or vector
+ * @tparam T_dof type of degrees of freedom parameter
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param nu (sequence of) degrees of freedom parameter(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
  */
 template <bool propto, typename T_y, typename T_dof, typename T_loc,
-          typename T_scale>
-return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lpdf(const T_y& y,
-                                                         const T_dof& nu,
-                                                         const T_loc& mu,
-                                                         const T_scale& sigma) {
-  static const char* function = "student_t_lpdf";
+          typename T_scale,
+          require_not_t<
+              is_vectorizable_density<T_y, T_dof, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lpdf_impl(
+    const T_y& y, const T_dof& nu, const T_loc& mu, const T_scale& sigma) {
   using T_partials_return = partials_return_t<T_y, T_dof, T_loc, T_scale>;
 
-  if (size_zero(y, nu, mu, sigma)) {
-    return 0.0;
-  }
-
   T_partials_return logp(0.0);
 
-  check_not_nan(function, "Random variable", y);
-  check_positive_finite(function, "Degrees of freedom parameter", nu);
-  check_finite(function, "Location parameter", mu);
-  check_positive_finite(function, "Scale parameter", sigma);
-  check_consistent_sizes(function, "Random variable", y,
-                         "Degrees of freedom parameter", nu,
-                         "Location parameter", mu, "Scale parameter", sigma);
-
-  if (!include_summand<propto, T_y, T_dof, T_loc, T_scale>::value) {
-    return 0.0;
-  }
-
   scalar_seq_view<T_y> y_vec(y);
   scalar_seq_view<T_dof> nu_vec(nu);
   scalar_seq_view<T_loc> mu_vec(mu);
@@ -192,6 +168,175 @@ return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lpdf(const T_y& y,
   return ops_partials.build(logp);
 }
 
+/** \ingroup prob_dists
+ * Calculates the log of the Student-t density and its partials with
+ * Eigen array expressions over all elements of the arguments.
+ *
+ * @tparam T_y type of scalar or vector
+ * @tparam T_dof type of degrees of freedom parameter
+ * @tparam T_loc type of location parameter
+ * @tparam T_scale type of scale parameter
+ * @param y (sequence of) scalar(s)
+ * @param nu (sequence of) degrees of freedom parameter(s)
+ * @param mu (sequence of) location parameter(s)
+ * @param sigma (sequence of) scale parameter(s)
+ * @return log of the product of the densities
+ */
+template <bool propto, typename T_y, typename T_dof, typename T_loc,
+          typename T_scale,
+          require_t<
+              is_vectorizable_density<T_y, T_dof, T_loc, T_scale>>* = nullptr>
+inline return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lpdf_impl(
+    const T_y& y, const T_dof& nu, const T_loc& mu, const T_scale& sigma) {
+  using std::log;
+
+  const auto& y_val = as_value_array_or_scalar(y);
+  const auto& nu_val = as_value_array_or_scalar(nu);
+  const auto& mu_val = as_value_array_or_scalar(mu);
+  const auto& sigma_val = as_value_array_or_scalar(sigma);
+  const size_t N = max_size(y, nu, mu, sigma);
+
+  using T_partials_array
+      = value_array_or_scalar_t<T_y, T_dof, T_loc, T_scale>;
+
+  T_partials_array mu_deriv = T_partials_array();
+  T_partials_array nu_deriv = T_partials_array();
+  T_partials_array sigma_deriv = T_partials_array();
+  if (!is_constant_all<T_y, T_loc>::value) {
+    mu_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_dof>::value) {
+    nu_deriv = T_partials_array(N);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    sigma_deriv = T_partials_array(N);
+  }
+
+  const size_t num_chunks = num_parallel_chunks(N);
+  std::vector<double> logp_chunks(num_chunks);
+  parallel_chunks(N, num_chunks, [&](size_t chunk, size_t start, size_t end) {
+    const size_t n = end - start;
+    const auto& nu_chunk = segment_or_scalar(nu_val, start, n);
+    const auto& sigma_chunk = segment_or_scalar(sigma_val, start, n);
+    const value_array_or_scalar_t<T_dof> half_nu = 0.5 * nu_chunk;
+    const value_array_or_scalar_t<T_y, T_loc, T_scale> y_scaled
+        = (segment_or_scalar(y_val, start, n)
+           - segment_or_scalar(mu_val, start, n))
+          / sigma_chunk;
+    const T_partials_array square_y_scaled_over_nu
+        = y_scaled * y_scaled / nu_chunk;
+    const T_partials_array log1p_exp = log1p(square_y_scaled_over_nu);
+
+    logp_chunks[chunk] = -sum((half_nu + 0.5) * log1p_exp);
+    if (include_summand<propto, T_dof>::value) {
+      logp_chunks[chunk]
+          += sum(lgamma(half_nu + 0.5) - lgamma(half_nu) - 0.5 * log(nu_chunk))
+             * n / size(nu_chunk);
+    }
+    if (!is_constant_all<T_y, T_loc>::value) {
+      segment_or_scalar(mu_deriv, start, n)
+          = (nu_chunk + 1) * y_scaled
+            / (sigma_chunk * nu_chunk * (1 + square_y_scaled_over_nu));
+    }
+    if (!is_constant_all<T_dof>::value) {
+      const value_array_or_scalar_t<T_dof> digamma_diff
+          = digamma(half_nu + 0.5) - digamma(half_nu) - 1.0 / nu_chunk;
+      segment_or_scalar(nu_deriv, start, n)
+          = 0.5 * (digamma_diff - log1p_exp)
+            + (half_nu + 0.5) * square_y_scaled_over_nu
+                  / ((1 + square_y_scaled_over_nu) * nu_chunk);
+    }
+    if (!is_constant_all<T_scale>::value) {
+      segment_or_scalar(sigma_deriv, start, n)
+          = ((nu_chunk + 1) * square_y_scaled_over_nu
+                 / (1 + square_y_scaled_over_nu)
+             - 1)
+            / sigma_chunk;
+    }
+  });
+
+  double logp = sum(logp_chunks);
+  if (include_summand<propto>::value) {
+    logp -= LOG_SQRT_PI * N;
+  }
+  if (include_summand<propto, T_scale>::value) {
+    logp -= sum(log(sigma_val)) * N / size(sigma);
+  }
+
+  operands_and_partials<T_y, T_dof, T_loc, T_scale> ops_partials(y, nu, mu,
+                                                                 sigma);
+  if (!is_constant_all<T_y>::value) {
+    set_vectorized_partials<T_y>(ops_partials.edge1_, -mu_deriv);
+  }
+  if (!is_constant_all<T_dof>::value) {
+    set_vectorized_partials<T_dof>(ops_partials.edge2_, nu_deriv);
+  }
+  if (!is_constant_all<T_loc>::value) {
+    set_vectorized_partials<T_loc>(ops_partials.edge3_, mu_deriv);
+  }
+  if (!is_constant_all<T_scale>::value) {
+    set_vectorized_partials<T_scale>(ops_partials.edge4_, sigma_deriv);
+  }
+  return ops_partials.build(logp);
+}
+
+}  // namespace internal
+
+/** \ingroup prob_dists
+ * The log of the Student-t density for the given y, nu, mean, and
+ * scale parameter.  The scale parameter must be greater
+ * than 0.
+ *
+ * \f{eqnarray*}{
+ y &\sim& t_{\nu} (\mu, \sigma^2) \\
+ \log (p (y \, |\, \nu, \mu, \sigma) ) &=& \log \left( \frac{\Gamma((\nu + 1)
+ /2)}
+ {\Gamma(\nu/2)\sqrt{\nu \pi} \sigma} \left( 1 + \frac{1}{\nu} (\frac{y -
+ \mu}{\sigma})^2 \right)^{-(\nu + 1)/2} \right) \\
+ &=& \log( \Gamma( (\nu+1)/2 )) - \log (\Gamma (\nu/2) - \frac{1}{2} \log(\nu
+ \pi) - \log(\sigma)
+ -\frac{\nu + 1}{2} \log (1 + \frac{1}{\nu} (\frac{y - \mu}{\sigma})^2)
+ \f}
+ *
+ * @param y A scalar variable.
+ * @param nu Degrees of freedom.
+ * @param mu The mean of the Student-t distribution.
+ * @param sigma The scale parameter of the Student-t distribution.
+ * @return The log of the Student-t density at y.
+ * @throw std::domain_error if sigma is not greater than 0.
+ * @throw std::domain_error if nu is not greater than 0.
+ * @tparam T_y Type of scalar.
+ * @tparam T_dof Type of degrees of freedom.
+ * @tparam T_loc Type of location.
+ * @tparam T_scale Type of scale.
+ */
+template <bool propto, typename T_y, typename T_dof, typename T_loc,
+          typename T_scale>
+return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lpdf(const T_y& y,
+                                                         const T_dof& nu,
+                                                         const T_loc& mu,
+                                                         const T_scale& sigma) {
+  static const char* function = "student_t_lpdf";
+
+  if (size_zero(y, nu, mu, sigma)) {
+    return 0.0;
+  }
+
+  check_not_nan(function, "Random variable", y);
+  check_positive_finite(function, "Degrees of freedom parameter", nu);
+  check_finite(function, "Location parameter", mu);
+  check_positive_finite(function, "Scale parameter", sigma);
+  check_consistent_sizes(function, "Random variable", y,
+                         "Degrees of freedom parameter", nu,
+                         "Location parameter", mu, "Scale parameter", sigma);
+
+  if (!include_summand<propto, T_y, T_dof, T_loc, T_scale>::value) {
+    return 0.0;
+  }
+
+  return internal::student_t_lpdf_impl<propto>(y, nu, mu, sigma);
+}
+
 template <typename T_y, typename T_dof, typename T_loc, typename T_scale>
 inline return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lpdf(
     const T_y& y, const T_dof& nu, const T_loc& mu, const T_scale& sigma) {
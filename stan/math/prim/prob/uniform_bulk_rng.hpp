@@ -0,0 +1,82 @@
+#ifndef STAN_MATH_PRIM_PROB_UNIFORM_BULK_RNG_HPP
+#define STAN_MATH_PRIM_PROB_UNIFORM_BULK_RNG_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/philox4x32.hpp>
+#include <stan/math/prim/functor/bulk_rng_draws.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace stan {
+namespace math {
+
+/** \ingroup prob_dists
+ * Return a vector of the specified number of uniform random variates for
+ * the given lower and upper bounds using the specified counter-based
+ * random number generator.
+ *
+ * Each pair of variates is computed from one block of the generator, so
+ * the blocks are evaluated independently of each other and, if
+ * STAN_THREADS is defined and the vector is large, in parallel chunks.
+ * The result only depends on the state of the generator and not on the
+ * number of threads. The generator is advanced past the blocks it used.
+ *
+ * alpha and beta can each be a scalar or a one-dimensional container of
+ * size n_draws.
+ *
+ * @tparam T_alpha type of lower bound parameter
+ * @tparam T_beta type of upper bound parameter
+ * @param alpha (Sequence of) lower bound parameter(s)
+ * @param beta (Sequence of) upper bound parameter(s)
+ * @param n_draws number of variates
+ * @param rng random number generator
+ * @return vector of uniform random variates
+ * @throw std::domain_error if alpha or beta are non-finite or beta is not
+ * greater than alpha
+ * @throw std::invalid_argument if non-scalar arguments are not of size
+ * n_draws
+ */
+template <typename T_alpha, typename T_beta>
+inline Eigen::VectorXd uniform_bulk_rng(const T_alpha& alpha,
+                                        const T_beta& beta,
+                                        std::size_t n_draws,
+                                        philox4x32& rng) {
+  static const char* function = "uniform_bulk_rng";
+
+  check_finite(function, "Lower bound parameter", alpha);
+  check_finite(function, "Upper bound parameter", beta);
+  check_consistent_size(function, "Lower bound parameter", alpha, n_draws);
+  check_consistent_size(function, "Upper bound parameter", beta, n_draws);
+  check_greater(function, "Upper bound parameter", beta, alpha);
+
+  scalar_seq_view<T_alpha> alpha_vec(alpha);
+  scalar_seq_view<T_beta> beta_vec(beta);
+  Eigen::VectorXd output(n_draws);
+  const std::size_t num_pairs = n_draws / 2;
+  const std::uint64_t first_block = rng.reserve_blocks(n_draws - num_pairs);
+
+  auto draw = [&](std::size_t n, std::uint32_t hi, std::uint32_t lo) {
+    const double alpha_dbl = alpha_vec[n];
+    output.coeffRef(n) = alpha_dbl
+                         + (beta_vec[n] - alpha_dbl)
+                               * internal::philox_to_unit_interval(hi, lo);
+  };
+  internal::bulk_rng_blocks(
+      first_block, num_pairs, rng,
+      [&](std::size_t b, const std::array<std::uint32_t, 4>& words) {
+        draw(2 * b, words[0], words[1]);
+        draw(2 * b + 1, words[2], words[3]);
+      });
+  if (n_draws % 2 != 0) {
+    const auto words = rng.block(first_block + num_pairs);
+    draw(n_draws - 1, words[0], words[1]);
+  }
+  return output;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -24,24 +24,21 @@ namespace math {
  *
  * <p>This function does not recover any memory from the computation.
  *
+ * <p>The stack is traversed by index rather than by iterator such
+ * that a <code>chain()</code> method may itself run nested autodiff,
+ * which pushes onto (and possibly reallocates) the stack before
+ * recovering it again.
+ *
  * @param vi Variable implementation for root of partial
  * derivative propagation.
  */
 static void grad(vari* vi) {
-  // simple reference implementation (intended as doc):
-  //   vi->init_dependent();
-  //   size_t end = var_stack_.size();
-  //   size_t begin = empty_nested() ? 0 : end - nested_size();
-  //   for (size_t i = end; --i > begin; )
-  //     var_stack_[i]->chain();
-
-  using it_t = std::vector<vari*>::reverse_iterator;
   vi->init_dependent();
-  it_t begin = ChainableStack::instance_->var_stack_.rbegin();
-  it_t end = empty_nested() ? ChainableStack::instance_->var_stack_.rend()
-                            : begin + nested_size();
-  for (it_t it = begin; it < end; ++it) {
-    (*it)->chain();
+  std::vector<vari*>& var_stack = ChainableStack::instance_->var_stack_;
+  size_t end = var_stack.size();
+  size_t begin = empty_nested() ? 0 : end - nested_size();
+  for (size_t i = end; i-- > begin;) {
+    var_stack[i]->chain();
   }
 }
 
@@ -0,0 +1,208 @@
+#ifndef STAN_MATH_REV_FUN_CHOLESKY_CORR_CONSTRAIN_HPP
+#define STAN_MATH_REV_FUN_CHOLESKY_CORR_CONSTRAIN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/adj_jac_apply.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/log1m.hpp>
+#include <stan/math/prim/fun/square.hpp>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the Cholesky factor of a correlation matrix given the
+ * canonical partial correlations in the strictly lower triangle of
+ * z. Row i of the factor is built as L(i, j) = z(i, j) * w(i, j), where
+ * w(i, j) is the square root of one minus the sum of squares of the
+ * preceding entries of the row, and L(i, i) = w(i, i). The factors w
+ * are written to the lower triangle of w for the reverse pass.
+ *
+ * @param z canonical partial correlations in the strictly lower
+ * triangle
+ * @param[out] w scaling factors of the entries of the Cholesky factor
+ * @return Cholesky factor of a correlation matrix
+ */
+inline Eigen::MatrixXd cholesky_corr_from_cpcs(
+    const Eigen::Map<Eigen::MatrixXd>& z, Eigen::Map<Eigen::MatrixXd>& w) {
+  const int K = z.rows();
+  Eigen::MatrixXd L = Eigen::MatrixXd::Zero(K, K);
+  if (K == 0) {
+    return L;
+  }
+  w(0, 0) = 1.0;
+  L(0, 0) = 1.0;
+  for (int i = 1; i < K; ++i) {
+    double sum_sqs = 0.0;
+    for (int j = 0; j < i; ++j) {
+      w(i, j) = std::sqrt(1.0 - sum_sqs);
+      L(i, j) = z(i, j) * w(i, j);
+      sum_sqs += square(L(i, j));
+    }
+    w(i, i) = std::sqrt(1.0 - sum_sqs);
+    L(i, i) = w(i, i);
+  }
+  return L;
+}
+
+/**
+ * Return the adjoints of the canonical partial correlations given the
+ * adjoints of the lower triangle of the Cholesky factor built by
+ * <code>cholesky_corr_from_cpcs</code>. Each row is traversed in
+ * reverse, carrying the adjoint of the running sum of squares.
+ *
+ * @param adj_L adjoints of the Cholesky factor
+ * @param z canonical partial correlations
+ * @param w scaling factors from the forward pass
+ * @return adjoints of z in the strictly lower triangle
+ */
+inline Eigen::MatrixXd cholesky_corr_from_cpcs_adj(
+    const Eigen::MatrixXd& adj_L, const Eigen::Map<Eigen::MatrixXd>& z,
+    const Eigen::Map<Eigen::MatrixXd>& w) {
+  const int K = z.rows();
+  Eigen::MatrixXd adj_z = Eigen::MatrixXd::Zero(K, K);
+  for (int i = 1; i < K; ++i) {
+    double adj_sum_sqs = -0.5 * adj_L(i, i) / w(i, i);
+    for (int j = i - 1; j >= 0; --j) {
+      const double adj_L_ij
+          = adj_L(i, j) + 2.0 * z(i, j) * w(i, j) * adj_sum_sqs;
+      adj_z(i, j) = adj_L_ij * w(i, j);
+      adj_sum_sqs -= 0.5 * adj_L_ij * z(i, j) / w(i, j);
+    }
+  }
+  return adj_z;
+}
+
+class cholesky_corr_constrain_op {
+  int K_;
+  double* z_;
+  double* w_;
+
+ public:
+  /**
+   * Return the Cholesky factor of the correlation matrix of the
+   * specified dimensionality derived from the specified free vector.
+   *
+   * @tparam size Number of arguments
+   * @param needs_adj Boolean indicators of if adjoints of arguments will be
+   * needed
+   * @param y Free vector of size K choose 2
+   * @param K Dimensionality of the returned Cholesky factor
+   * @return Cholesky factor of a correlation matrix
+   */
+  template <std::size_t size>
+  Eigen::MatrixXd operator()(const std::array<bool, size>& needs_adj,
+                             const Eigen::VectorXd& y, int K) {
+    K_ = K;
+    z_ = ChainableStack::instance_->memalloc_.alloc_array<double>(K * K);
+    w_ = ChainableStack::instance_->memalloc_.alloc_array<double>(K * K);
+    Eigen::Map<Eigen::MatrixXd> z(z_, K, K);
+    Eigen::Map<Eigen::MatrixXd> w(w_, K, K);
+    z.setZero();
+    w.setZero();
+    int k = 0;
+    for (int i = 1; i < K; ++i) {
+      for (int j = 0; j < i; ++j) {
+        z(i, j) = std::tanh(y(k++));
+      }
+    }
+    return cholesky_corr_from_cpcs(z, w);
+  }
+
+  /**
+   * Compute the product of the transpose of the adjoint matrix and the
+   * Jacobian of the cholesky_corr_constrain operator.
+   *
+   * @tparam size Number of adjoints to return
+   * @param needs_adj Boolean indicators of if adjoints of arguments will be
+   * needed
+   * @param adj Eigen::MatrixXd of adjoints of the Cholesky factor
+   * @return Eigen::VectorXd of adjoints of the free vector
+   */
+  template <std::size_t size>
+  auto multiply_adjoint_jacobian(const std::array<bool, size>& needs_adj,
+                                 const Eigen::MatrixXd& adj) const {
+    const Eigen::Map<Eigen::MatrixXd> z(z_, K_, K_);
+    const Eigen::Map<Eigen::MatrixXd> w(w_, K_, K_);
+    const Eigen::MatrixXd adj_z = cholesky_corr_from_cpcs_adj(adj, z, w);
+    Eigen::VectorXd adj_y((K_ * (K_ - 1)) / 2);
+    int k = 0;
+    for (int i = 1; i < K_; ++i) {
+      for (int j = 0; j < i; ++j) {
+        adj_y(k++) = adj_z(i, j) * (1.0 - square(z(i, j)));
+      }
+    }
+    return std::make_tuple(adj_y, int());
+  }
+};
+}  // namespace internal
+
+/**
+ * Return the Cholesky factor of the correlation matrix of the
+ * specified dimensionality derived from the specified free vector.
+ * The entries of the factor and their Jacobian with respect to the
+ * free vector are calculated in closed form and stored on a single
+ * node of the expression graph.
+ *
+ * @param y Free vector of size K choose 2
+ * @param K Dimensionality of the returned Cholesky factor
+ * @return Cholesky factor of a correlation matrix
+ * @throw std::invalid_argument if the size of y is not K choose 2
+ */
+inline Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>
+cholesky_corr_constrain(const Eigen::Matrix<var, Eigen::Dynamic, 1>& y,
+                        int K) {
+  int k_choose_2 = (K * (K - 1)) / 2;
+  check_size_match("cholesky_corr_constrain", "y.size()", y.size(),
+                   "k_choose_2", k_choose_2);
+  return adj_jac_apply<internal::cholesky_corr_constrain_op>(y, K);
+}
+
+/**
+ * Return the Cholesky factor of the correlation matrix of the
+ * specified dimensionality derived from the specified free vector and
+ * increment the specified log probability by the log absolute
+ * Jacobian determinant of the transform.
+ *
+ * <p>The log Jacobian determinant is a weighted sum of
+ * log(1 - z^2) over the canonical partial correlations z, such that
+ * it is added to the log probability as one node with precomputed
+ * gradients.
+ *
+ * @param y Free vector of size K choose 2
+ * @param K Dimensionality of the returned Cholesky factor
+ * @param lp Log probability reference to increment
+ * @return Cholesky factor of a correlation matrix
+ * @throw std::invalid_argument if the size of y is not K choose 2
+ */
+inline Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>
+cholesky_corr_constrain(const Eigen::Matrix<var, Eigen::Dynamic, 1>& y, int K,
+                        var& lp) {
+  int k_choose_2 = (K * (K - 1)) / 2;
+  check_size_match("cholesky_corr_constrain", "y.size()", y.size(),
+                   "k_choose_2", k_choose_2);
+  std::vector<var> operands(y.data(), y.data() + y.size());
+  std::vector<double> gradients(k_choose_2);
+  double log_jacobian = 0.0;
+  int k = 0;
+  for (int i = 1; i < K; ++i) {
+    for (int j = 0; j < i; ++j) {
+      const double z = std::tanh(y(k).val());
+      const double weight = 1.0 + 0.5 * (i - 1 - j);
+      log_jacobian += weight * log1m(square(z));
+      gradients[k++] = -2.0 * weight * z;
+    }
+  }
+  lp += precomputed_gradients(log_jacobian, operands, gradients);
+  return adj_jac_apply<internal::cholesky_corr_constrain_op>(y, K);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,154 @@
+#ifndef STAN_MATH_REV_FUN_CORR_MATRIX_CONSTRAIN_HPP
+#define STAN_MATH_REV_FUN_CORR_MATRIX_CONSTRAIN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/cholesky_corr_constrain.hpp>
+#include <stan/math/rev/functor/adj_jac_apply.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/log1m.hpp>
+#include <stan/math/prim/fun/square.hpp>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+class corr_matrix_constrain_op {
+  int K_;
+  double* z_;
+  double* w_;
+
+ public:
+  /**
+   * Return the correlation matrix of the specified dimensionality
+   * derived from the specified vector of unconstrained partial
+   * correlations, which are stored column by column as in
+   * <code>read_corr_L</code>.
+   *
+   * @tparam size Number of arguments
+   * @param needs_adj Boolean indicators of if adjoints of arguments will be
+   * needed
+   * @param x Vector of unconstrained partial correlations
+   * @param K Dimensionality of the returned correlation matrix
+   * @return Correlation matrix
+   */
+  template <std::size_t size>
+  Eigen::MatrixXd operator()(const std::array<bool, size>& needs_adj,
+                             const Eigen::VectorXd& x, int K) {
+    K_ = K;
+    z_ = ChainableStack::instance_->memalloc_.alloc_array<double>(K * K);
+    w_ = ChainableStack::instance_->memalloc_.alloc_array<double>(K * K);
+    Eigen::Map<Eigen::MatrixXd> z(z_, K, K);
+    Eigen::Map<Eigen::MatrixXd> w(w_, K, K);
+    z.setZero();
+    w.setZero();
+    int k = 0;
+    for (int j = 0; j < K - 1; ++j) {
+      for (int i = j + 1; i < K; ++i) {
+        z(i, j) = std::tanh(x(k++));
+      }
+    }
+    const Eigen::MatrixXd L = cholesky_corr_from_cpcs(z, w);
+    return L.triangularView<Eigen::Lower>() * L.transpose();
+  }
+
+  /**
+   * Compute the product of the transpose of the adjoint matrix and the
+   * Jacobian of the corr_matrix_constrain operator.
+   *
+   * @tparam size Number of adjoints to return
+   * @param needs_adj Boolean indicators of if adjoints of arguments will be
+   * needed
+   * @param adj Eigen::MatrixXd of adjoints of the correlation matrix
+   * @return Eigen::VectorXd of adjoints of the unconstrained partial
+   * correlations
+   */
+  template <std::size_t size>
+  auto multiply_adjoint_jacobian(const std::array<bool, size>& needs_adj,
+                                 const Eigen::MatrixXd& adj) const {
+    const Eigen::Map<Eigen::MatrixXd> z(z_, K_, K_);
+    const Eigen::Map<Eigen::MatrixXd> w(w_, K_, K_);
+    Eigen::MatrixXd L = z.cwiseProduct(w);
+    L.diagonal() = w.diagonal();
+    const Eigen::MatrixXd adj_L = (adj + adj.transpose()) * L;
+    const Eigen::MatrixXd adj_z = cholesky_corr_from_cpcs_adj(adj_L, z, w);
+    Eigen::VectorXd adj_x((K_ * (K_ - 1)) / 2);
+    int k = 0;
+    for (int j = 0; j < K_ - 1; ++j) {
+      for (int i = j + 1; i < K_; ++i) {
+        adj_x(k++) = adj_z(i, j) * (1.0 - square(z(i, j)));
+      }
+    }
+    return std::make_tuple(adj_x, int());
+  }
+};
+}  // namespace internal
+
+/**
+ * Return the correlation matrix of the specified dimensionality
+ * derived from the specified vector of unconstrained partial
+ * correlations. The correlation matrix and its Jacobian with respect
+ * to the free vector are calculated in closed form and stored on a
+ * single node of the expression graph.
+ *
+ * @param x Vector of unconstrained partial correlations
+ * @param k Dimensionality of the returned correlation matrix
+ * @return Correlation matrix
+ * @throw std::invalid_argument if the size of x is not k choose 2
+ */
+inline Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> corr_matrix_constrain(
+    const Eigen::Matrix<var, Eigen::Dynamic, 1>& x, Eigen::Index k) {
+  Eigen::Index k_choose_2 = (k * (k - 1)) / 2;
+  check_size_match("cov_matrix_constrain", "x.size()", x.size(), "k_choose_2",
+                   k_choose_2);
+  return adj_jac_apply<internal::corr_matrix_constrain_op>(
+      x, static_cast<int>(k));
+}
+
+/**
+ * Return the correlation matrix of the specified dimensionality
+ * derived from the specified vector of unconstrained partial
+ * correlations and increment the specified log probability by the log
+ * absolute Jacobian determinant of the transform.
+ *
+ * <p>The partial correlation z in column j contributes
+ * (1 + (k - j - 2) / 2) log(1 - z^2) to the log Jacobian
+ * determinant, which is added to the log probability as one node with
+ * precomputed gradients.
+ *
+ * @param x Vector of unconstrained partial correlations
+ * @param k Dimensionality of the returned correlation matrix
+ * @param lp Log probability reference to increment
+ * @return Correlation matrix
+ * @throw std::invalid_argument if the size of x is not k choose 2
+ */
+inline Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> corr_matrix_constrain(
+    const Eigen::Matrix<var, Eigen::Dynamic, 1>& x, Eigen::Index k,
+    var& lp) {
+  Eigen::Index k_choose_2 = (k * (k - 1)) / 2;
+  check_size_match("cov_matrix_constrain", "x.size()", x.size(), "k_choose_2",
+                   k_choose_2);
+  std::vector<var> operands(x.data(), x.data() + x.size());
+  std::vector<double> gradients(k_choose_2);
+  double log_jacobian = 0.0;
+  Eigen::Index pos = 0;
+  for (Eigen::Index j = 0; j < k - 1; ++j) {
+    const double weight = 1.0 + 0.5 * (k - j - 2);
+    for (Eigen::Index i = j + 1; i < k; ++i) {
+      const double z = std::tanh(x(pos).val());
+      log_jacobian += weight * log1m(square(z));
+      gradients[pos++] = -2.0 * weight * z;
+    }
+  }
+  lp += precomputed_gradients(log_jacobian, operands, gradients);
+  return adj_jac_apply<internal::corr_matrix_constrain_op>(
+      x, static_cast<int>(k));
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -5,9 +5,9 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
+#include <stan/math/rev/functor/algebra_solver_powell.hpp>
 #include <stan/math/rev/functor/kinsol_data.hpp>
 #include <stan/math/prim/err.hpp>
-#include <stan/math/prim/fun/mdivide_left.hpp>
 #include <stan/math/prim/fun/to_array_1d.hpp>
 #include <stan/math/prim/fun/to_vector.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
@@ -129,25 +129,52 @@ struct KinsolFixedPointEnv {
 };
 
 /*
- * Calculate Jacobian Jxy(Jacobian of unkonwn x w.r.t. the * param y)
- * given the solution. Specifically, for
+ * Residual of the fixed point problem
  *
  *  x - f(x, y) = 0
  *
- * we have (Jpq = Jacobian matrix dq/dq)
+ * in the form of an algebraic system, so that the implicit function
+ * theorem adjoint of the algebraic solvers applies.
  *
- * Jxy - Jfx * Jxy = Jfy
+ * @tparam F RHS functor type
+ */
+template <typename F>
+struct FixedPointResidual {
+  /** RHS functor */
+  F f_;
+
+  template <typename T0, typename T1>
+  inline Eigen::Matrix<stan::return_type_t<T0, T1>, -1, 1> operator()(
+      const Eigen::Matrix<T0, -1, 1>& x, const Eigen::Matrix<T1, -1, 1>& y,
+      const std::vector<double>& x_r, const std::vector<int>& x_i,
+      std::ostream* msgs) const {
+    Eigen::Matrix<stan::return_type_t<T0, T1>, -1, 1> res
+        = f_(x, y, x_r, x_i, msgs);
+    for (int i = 0; i < x.size(); ++i) {
+      res(i) = x(i) - res(i);
+    }
+    return res;
+  }
+};
+
+/*
+ * Propagate the adjoints of the unknown x to the param y given
+ * the solution. Specifically, for
+ *
+ *  x - f(x, y) = 0
  *
- * therefore Jxy can be solved from system
+ * we have (Jpq = Jacobian matrix dp/dq)
  *
  * (I - Jfx) * Jxy = Jfy
  *
- * Jfx and Jfy are obtained through one AD evaluation of f
- * w.r.t combined vector [x, y].
+ * Rather than solving for the dense Jxy, only (I - Jfx) is formed
+ * and factored; the reverse pass solves (I - Jfx)^T eta = adj(x) and
+ * adds eta^T Jfy to adj(y) with a single nested sweep of f w.r.t y,
+ * see @c algebra_solver_vari.
  */
 struct FixedPointADJac {
   /*
-   * Calculate Jacobian Jxy.
+   * Create the solution vars of the fixed point problem.
    *
    * @tparam F RHS functor type
    * @param x fixed point solution
@@ -158,36 +185,22 @@ struct FixedPointADJac {
   inline Eigen::Matrix<stan::math::var, -1, 1> operator()(
       const Eigen::VectorXd& x, const Eigen::Matrix<stan::math::var, -1, 1>& y,
       KinsolFixedPointEnv<F>& env) {
-    using stan::math::precomputed_gradients;
-    using stan::math::to_array_1d;
     using stan::math::var;
+    using Fr = FixedPointResidual<F>;
+    using Fs = system_functor<Fr, double, double, true>;
+    using Fy = system_functor<Fr, double, double, false>;
+    using Fx = hybrj_functor_solver<Fs, Fr, double, double>;
 
-    auto g = [&env](const Eigen::Matrix<var, -1, 1>& par_) {
-      Eigen::Matrix<var, -1, 1> x_(par_.head(env.N_));
-      Eigen::Matrix<var, -1, 1> y_(par_.tail(env.M_));
-      return env.f_(x_, y_, env.x_r_, env.x_i_, env.msgs_);
-    };
+    Fr fr{env.f_};
+    Fs fs(fr, x, env.y_, env.x_r_, env.x_i_, env.msgs_);
+    Fx fx(fs, fr, x, env.y_, env.x_r_, env.x_i_, env.msgs_);
+    Fy fy(fr, x, env.y_, env.x_r_, env.x_i_, env.msgs_);
+    auto* vi = new algebra_solver_vari<Fy, Fr, var, Fx>(
+        fy, fr, x, y, env.x_r_, env.x_i_, x, fx, env.msgs_);
 
-    Eigen::VectorXd theta(x.size() + y.size());
-    for (int i = 0; i < env.N_; ++i) {
-      theta(i) = x(i);
-    }
-    for (int i = 0; i < env.M_; ++i) {
-      theta(i + env.N_) = env.y_(i);
-    }
-    Eigen::Matrix<double, -1, 1> fx;
-    Eigen::Matrix<double, -1, -1> J_theta;
-    stan::math::jacobian(g, theta, fx, J_theta);
-    Eigen::MatrixXd A(J_theta.block(0, 0, env.N_, env.N_));
-    Eigen::MatrixXd b(J_theta.block(0, env.N_, env.N_, env.M_));
-    A = Eigen::MatrixXd::Identity(env.N_, env.N_) - A;
-    Eigen::MatrixXd Jxy = A.colPivHouseholderQr().solve(b);
-    std::vector<double> gradients(env.M_);
     Eigen::Matrix<var, -1, 1> x_sol(env.N_);
-    std::vector<stan::math::var> yv(to_array_1d(y));
     for (int i = 0; i < env.N_; ++i) {
-      gradients = to_array_1d(Eigen::VectorXd(Jxy.row(i)));
-      x_sol[i] = precomputed_gradients(x(i), yv, gradients);
+      x_sol(i) = var(vi->theta_[i]);
     }
     return x_sol;
   }
@@ -4,6 +4,7 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
 #include <stan/math/rev/functor/algebra_solver_powell.hpp>
+#include <stan/math/rev/functor/algebra_solver_warm_start.hpp>
 #include <stan/math/rev/functor/kinsol_solve.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/mdivide_left.hpp>
@@ -42,6 +43,10 @@ namespace math {
  *            longer making significant progress (i.e. is stuck)
  * @param[in] function_tolerance determines whether roots are acceptable.
  * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in] warm_start_id if non-negative, opt in to warm starting from
+ *            the last converged solution of the call site identified by
+ *            the type of f and this id on the calling thread, see
+ *            <code>algebra_solver_warm_start</code>.
  *  * @throw <code>std::invalid_argument</code> if x has size zero.
  * @throw <code>std::invalid_argument</code> if x has non-finite elements.
  * @throw <code>std::invalid_argument</code> if y has non-finite elements.
@@ -61,7 +66,8 @@ Eigen::VectorXd algebra_solver_newton(
     const Eigen::VectorXd& y, const std::vector<double>& dat,
     const std::vector<int>& dat_int, std::ostream* msgs = nullptr,
     double scaling_step_size = 1e-3, double function_tolerance = 1e-6,
-    long int max_num_steps = 200) {  // NOLINT(runtime/int)
+    long int max_num_steps = 200,  // NOLINT(runtime/int)
+    int warm_start_id = -1) {
   algebra_solver_check(x, y, dat, dat_int, function_tolerance, max_num_steps);
   check_nonnegative("algebra_solver", "scaling_step_size", scaling_step_size);
 
@@ -69,8 +75,35 @@ Eigen::VectorXd algebra_solver_newton(
                        value_of(f(x, y, dat, dat_int, msgs)),
                        "the vector of unknowns, x,", x);
 
-  return kinsol_solve(f, value_of(x), y, dat, dat_int, 0, scaling_step_size,
-                      function_tolerance, max_num_steps);
+  if (warm_start_id < 0) {
+    return kinsol_solve(f, value_of(x), y, dat, dat_int, 0, scaling_step_size,
+                        function_tolerance, max_num_steps);
+  }
+
+  // Start from the last converged solution of this call site, reusing
+  // its KINSOL workspace, and fall back to the user supplied guess if
+  // that fails.
+  auto& warm_start = algebra_solver_warm_start<F>::get(warm_start_id);
+  kinsol_workspace* workspace = warm_start.workspace(x.size());
+  Eigen::VectorXd theta_dbl;
+  if (warm_start.x_.size() == x.size()) {
+    try {
+      theta_dbl = kinsol_solve(f, warm_start.x_, y, dat, dat_int, 0,
+                               scaling_step_size, function_tolerance,
+                               max_num_steps, 1, kinsol_J_f(), 10,
+                               KIN_LINESEARCH, workspace);
+    } catch (const std::exception& e) {
+      theta_dbl.resize(0);
+    }
+  }
+  if (theta_dbl.size() == 0) {
+    theta_dbl = kinsol_solve(f, value_of(x), y, dat, dat_int, 0,
+                             scaling_step_size, function_tolerance,
+                             max_num_steps, 1, kinsol_J_f(), 10,
+                             KIN_LINESEARCH, workspace);
+  }
+  warm_start.x_ = theta_dbl;
+  return theta_dbl;
 }
 
 /**
@@ -104,6 +137,10 @@ Eigen::VectorXd algebra_solver_newton(
  *            longer making significant progress (i.e. is stuck)
  * @param[in] function_tolerance determines whether roots are acceptable.
  * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in] warm_start_id if non-negative, opt in to warm starting from
+ *            the last converged solution of the call site identified by
+ *            the type of f and this id on the calling thread, see
+ *            <code>algebra_solver_warm_start</code>.
  * @return theta Vector of solutions to the system of equations.
  * @throw <code>std::invalid_argument</code> if x has size zero.
  * @throw <code>std::invalid_argument</code> if x has non-finite elements.
@@ -125,11 +162,11 @@ Eigen::Matrix<T2, Eigen::Dynamic, 1> algebra_solver_newton(
     const std::vector<double>& dat, const std::vector<int>& dat_int,
     std::ostream* msgs = nullptr, double scaling_step_size = 1e-3,
     double function_tolerance = 1e-6,
-    long int max_num_steps = 200) {  // NOLINT(runtime/int)
-
+    long int max_num_steps = 200,  // NOLINT(runtime/int)
+    int warm_start_id = -1) {
   Eigen::VectorXd theta_dbl = algebra_solver_newton(
       f, x, value_of(y), dat, dat_int, msgs, scaling_step_size,
-      function_tolerance, max_num_steps);
+      function_tolerance, max_num_steps, warm_start_id);
 
   typedef system_functor<F, double, double, false> Fy;
   typedef system_functor<F, double, double, true> Fs;
@@ -137,8 +174,9 @@ Eigen::Matrix<T2, Eigen::Dynamic, 1> algebra_solver_newton(
   Fx fx(Fs(), f, value_of(x), value_of(y), dat, dat_int, msgs);
 
   // Construct vari
+  Fy fy(f, theta_dbl, value_of(y), dat, dat_int, msgs);
   algebra_solver_vari<Fy, F, T2, Fx>* vi0
-      = new algebra_solver_vari<Fy, F, T2, Fx>(Fy(), f, value_of(x), y, dat,
+      = new algebra_solver_vari<Fy, F, T2, Fx>(fy, f, value_of(x), y, dat,
                                                dat_int, theta_dbl, fx, msgs);
   Eigen::Matrix<var, Eigen::Dynamic, 1> theta(x.size());
   theta(0) = var(vi0->theta_[0]);
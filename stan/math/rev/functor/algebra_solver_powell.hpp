@@ -4,9 +4,10 @@
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
+#include <stan/math/rev/functor/algebra_solver_warm_start.hpp>
 #include <stan/math/prim/err.hpp>
-#include <stan/math/prim/fun/mdivide_left.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <unsupported/Eigen/NonLinearOptimization>
 #include <iostream>
 #include <string>
@@ -15,11 +16,39 @@
 namespace stan {
 namespace math {
 
+namespace internal {
 /**
- * The vari class for the algebraic solver. We compute the  Jacobian of
- * the solutions with respect to the parameters using the implicit
- * function theorem. The call to Jacobian() occurs outside the call to
- * chain() -- this prevents malloc issues.
+ * Holds the data needed in the reverse pass of the algebraic solver
+ * and is freed along with the autodiff arena: the system functor
+ * with respect to the parameters, which keeps copies of the solution,
+ * the parameter values and the data, and the factorization of the
+ * transposed Jacobian of the system with respect to the unknowns.
+ *
+ * @tparam Fy system functor with the parameters as independent variable
+ */
+template <typename Fy>
+class algebra_solver_alloc : public chainable_alloc {
+ public:
+  algebra_solver_alloc(const Fy& fy, const Eigen::MatrixXd& Jf_x)
+      : fy_(fy), Jf_x_T_lu_(Jf_x.transpose()) {}
+
+  Fy fy_;
+  Eigen::PartialPivLU<Eigen::MatrixXd> Jf_x_T_lu_;
+};
+}  // namespace internal
+
+/**
+ * The vari class for the algebraic solver. We propagate the adjoints
+ * of the solutions to the parameters using the implicit function
+ * theorem without forming the Jacobian of the solutions with respect
+ * to the parameters. Upon construction, only the Jacobian of the
+ * system with respect to the unknowns, Jf_x, is computed and
+ * factored. In chain() we solve Jf_x^T eta = -adj once and add the
+ * vector-Jacobian product eta^T Jf_y, obtained from a single nested
+ * reverse sweep of the system with respect to the parameters.
+ *
+ * The functor <code>fs</code> must evaluate the system at the
+ * solution with the parameters as independent variable.
  */
 template <typename Fs, typename F, typename T, typename Fx>
 struct algebra_solver_vari : public vari {
@@ -31,8 +60,8 @@ struct algebra_solver_vari : public vari {
   int x_size_;
   /** vector of solution */
   vari** theta_;
-  /** Jacobian of the solution w.r.t parameters */
-  double* Jx_y_;
+  /** system functor and factored Jacobian w.r.t. the unknowns */
+  internal::algebra_solver_alloc<Fs>* alloc_;
 
   algebra_solver_vari(const Fs& fs, const F& f, const Eigen::VectorXd& x,
                       const Eigen::Matrix<T, Eigen::Dynamic, 1>& y,
@@ -46,10 +75,8 @@ struct algebra_solver_vari : public vari {
         x_size_(x.size()),
         theta_(
             ChainableStack::instance_->memalloc_.alloc_array<vari*>(x_size_)),
-        Jx_y_(ChainableStack::instance_->memalloc_.alloc_array<double>(
-            x_size_ * y_size_)) {
-    using Eigen::Map;
-    using Eigen::MatrixXd;
+        alloc_(new internal::algebra_solver_alloc<Fs>(
+            fs, fx.get_jacobian(theta_dbl))) {
     for (int i = 0; i < y.size(); ++i) {
       y_[i] = y(i).vi_;
     }
@@ -58,25 +85,89 @@ struct algebra_solver_vari : public vari {
     for (int i = 1; i < x.size(); ++i) {
       theta_[i] = new vari(theta_dbl(i), false);
     }
-
-    // Compute the Jacobian and store in array, using the
-    // implicit function theorem, i.e. Jx_y = Jf_y / Jf_x
-    using f_y = hybrj_functor_solver<Fs, F, double, double>;
-    Map<MatrixXd>(&Jx_y_[0], x_size_, y_size_)
-        = -mdivide_left(fx.get_jacobian(theta_dbl),
-                        f_y(fs, f, theta_dbl, value_of(y), dat, dat_int, msgs)
-                            .get_jacobian(value_of(y)));
   }
 
   void chain() {
-    for (int j = 0; j < y_size_; j++) {
+    Eigen::VectorXd theta_adj(x_size_);
+    for (int i = 0; i < x_size_; i++) {
+      theta_adj(i) = theta_[i]->adj_;
+    }
+    Eigen::VectorXd eta = -alloc_->Jf_x_T_lu_.solve(theta_adj);
+
+    try {
+      start_nested();
+      Eigen::Matrix<var, Eigen::Dynamic, 1> y_nested = alloc_->fy_.y_;
+      Eigen::Matrix<var, Eigen::Dynamic, 1> fy = alloc_->fy_(y_nested);
+      var eta_fy = 0;
       for (int i = 0; i < x_size_; i++) {
-        y_[j]->adj_ += theta_[i]->adj_ * Jx_y_[j * x_size_ + i];
+        eta_fy += eta(i) * fy(i);
       }
+      eta_fy.grad();
+      for (int j = 0; j < y_size_; j++) {
+        y_[j]->adj_ += y_nested(j).adj();
+      }
+    } catch (const std::exception& e) {
+      recover_memory_nested();
+      throw;
     }
+    recover_memory_nested();
   }
 };
 
+namespace internal {
+/**
+ * Run Powell's dogleg solver from the given starting point and check
+ * that it converged to a root.
+ *
+ * @tparam Fx type of the functor passed to Eigen's solver
+ * @param[in] fx functor passed to Eigen's solver
+ * @param[in] x starting point
+ * @param[in] relative_tolerance determines the convergence criteria
+ *            for the solution.
+ * @param[in] function_tolerance determines whether roots are acceptable.
+ * @param[in] max_num_steps  maximum number of function evaluations.
+ * @return solution of the algebraic system
+ * @throw <code>boost::math::evaluation_error</code> if solver exceeds
+ * max_num_steps or if the norm of the solution exceeds the function
+ * tolerance.
+ */
+template <typename Fx>
+Eigen::VectorXd algebra_solver_powell_solve(
+    Fx& fx, const Eigen::VectorXd& x, double relative_tolerance,
+    double function_tolerance,
+    long int max_num_steps) {  // NOLINT(runtime/int)
+  Eigen::HybridNonLinearSolver<Fx> solver(fx);
+
+  // Compute theta_dbl
+  Eigen::VectorXd theta_dbl = x;
+  solver.parameters.xtol = relative_tolerance;
+  solver.parameters.maxfev = max_num_steps;
+  solver.solve(theta_dbl);
+
+  // Check if the max number of steps has been exceeded
+  if (solver.nfev >= max_num_steps) {
+    std::ostringstream message;
+    message << "algebra_solver: max number of iterations: " << max_num_steps
+            << " exceeded.";
+    throw boost::math::evaluation_error(message.str());
+  }
+
+  // Check solution is a root
+  double system_norm = fx.get_value(theta_dbl).stableNorm();
+  if (system_norm > function_tolerance) {
+    std::ostringstream message2;
+    message2 << "algebra_solver: the norm of the algebraic function is: "
+             << system_norm << " but should be lower than the function "
+             << "tolerance: " << function_tolerance << ". Consider "
+             << "decreasing the relative tolerance and increasing the "
+             << "max_num_steps.";
+    throw boost::math::evaluation_error(message2.str());
+  }
+
+  return theta_dbl;
+}
+}  // namespace internal
+
 /**
  * Return the solution to the specified system of algebraic
  * equations given an initial guess, and parameters and data,
@@ -107,6 +198,10 @@ struct algebra_solver_vari : public vari {
  *            for the solution.
  * @param[in] function_tolerance determines whether roots are acceptable.
  * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in] warm_start_id if non-negative, opt in to warm starting from
+ *            the last converged solution of the call site identified by
+ *            the type of f and this id on the calling thread, see
+ *            <code>algebra_solver_warm_start</code>.
  * @return theta Vector of solutions to the system of equations.
  * @throw <code>std::invalid_argument</code> if x has size zero.
  * @throw <code>std::invalid_argument</code> if x has non-finite elements.
@@ -130,7 +225,8 @@ Eigen::VectorXd algebra_solver_powell(
     const Eigen::VectorXd& y, const std::vector<double>& dat,
     const std::vector<int>& dat_int, std::ostream* msgs = nullptr,
     double relative_tolerance = 1e-10, double function_tolerance = 1e-6,
-    long int max_num_steps = 1e+3) {  // NOLINT(runtime/int)
+    long int max_num_steps = 1e+3,  // NOLINT(runtime/int)
+    int warm_start_id = -1) {
   algebra_solver_check(x, y, dat, dat_int, function_tolerance, max_num_steps);
   check_nonnegative("alegbra_solver", "relative_tolerance", relative_tolerance);
   // if (relative_tolerance < 0)
@@ -142,39 +238,38 @@ Eigen::VectorXd algebra_solver_powell(
   using Fs = system_functor<F, double, double, true>;
   using Fx = hybrj_functor_solver<Fs, F, double, double>;
   Fx fx(Fs(), f, value_of(x), y, dat, dat_int, msgs);
-  Eigen::HybridNonLinearSolver<Fx> solver(fx);
 
   // Check dimension unknowns equals dimension of system output
   check_matching_sizes("algebra_solver", "the algebraic system's output",
                        fx.get_value(value_of(x)), "the vector of unknowns, x,",
                        x);
 
-  // Compute theta_dbl
-  Eigen::VectorXd theta_dbl = value_of(x);
-  solver.parameters.xtol = relative_tolerance;
-  solver.parameters.maxfev = max_num_steps;
-  solver.solve(theta_dbl);
-
-  // Check if the max number of steps has been exceeded
-  if (solver.nfev >= max_num_steps) {
-    std::ostringstream message;
-    message << "algebra_solver: max number of iterations: " << max_num_steps
-            << " exceeded.";
-    throw boost::math::evaluation_error(message.str());
+  if (warm_start_id < 0) {
+    return internal::algebra_solver_powell_solve(fx, value_of(x),
+                                                 relative_tolerance,
+                                                 function_tolerance,
+                                                 max_num_steps);
   }
 
-  // Check solution is a root
-  double system_norm = fx.get_value(theta_dbl).stableNorm();
-  if (system_norm > function_tolerance) {
-    std::ostringstream message2;
-    message2 << "algebra_solver: the norm of the algebraic function is: "
-             << system_norm << " but should be lower than the function "
-             << "tolerance: " << function_tolerance << ". Consider "
-             << "decreasing the relative tolerance and increasing the "
-             << "max_num_steps.";
-    throw boost::math::evaluation_error(message2.str());
+  // Start from the last converged solution of this call site and fall
+  // back to the user supplied guess if that fails.
+  auto& warm_start = algebra_solver_warm_start<F>::get(warm_start_id);
+  Eigen::VectorXd theta_dbl;
+  if (warm_start.x_.size() == x.size()) {
+    try {
+      theta_dbl = internal::algebra_solver_powell_solve(
+          fx, warm_start.x_, relative_tolerance, function_tolerance,
+          max_num_steps);
+    } catch (const std::exception& e) {
+      theta_dbl.resize(0);
+    }
   }
-
+  if (theta_dbl.size() == 0) {
+    theta_dbl = internal::algebra_solver_powell_solve(
+        fx, value_of(x), relative_tolerance, function_tolerance,
+        max_num_steps);
+  }
+  warm_start.x_ = theta_dbl;
   return theta_dbl;
 }
 
@@ -207,6 +302,10 @@ Eigen::VectorXd algebra_solver_powell(
  *            for the solution.
  * @param[in] function_tolerance determines whether roots are acceptable.
  * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in] warm_start_id if non-negative, opt in to warm starting from
+ *            the last converged solution of the call site identified by
+ *            the type of f and this id on the calling thread, see
+ *            <code>algebra_solver_warm_start</code>.
  * @return theta Vector of solutions to the system of equations.
  * @throw <code>std::invalid_argument</code> if x has size zero.
  * @throw <code>std::invalid_argument</code> if x has non-finite elements.
@@ -232,10 +331,11 @@ Eigen::Matrix<T2, Eigen::Dynamic, 1> algebra_solver_powell(
     const std::vector<double>& dat, const std::vector<int>& dat_int,
     std::ostream* msgs = nullptr, double relative_tolerance = 1e-10,
     double function_tolerance = 1e-6,
-    long int max_num_steps = 1e+3) {  // NOLINT(runtime/int)
+    long int max_num_steps = 1e+3,  // NOLINT(runtime/int)
+    int warm_start_id = -1) {
   Eigen::VectorXd theta_dbl = algebra_solver_powell(
       f, x, value_of(y), dat, dat_int, 0, relative_tolerance,
-      function_tolerance, max_num_steps);
+      function_tolerance, max_num_steps, warm_start_id);
 
   using Fy = system_functor<F, double, double, false>;
 
@@ -247,8 +347,9 @@ Eigen::Matrix<T2, Eigen::Dynamic, 1> algebra_solver_powell(
   Fx fx(Fs(), f, value_of(x), value_of(y), dat, dat_int, msgs);
 
   // Construct vari
+  Fy fy(f, theta_dbl, value_of(y), dat, dat_int, msgs);
   algebra_solver_vari<Fy, F, T2, Fx>* vi0
-      = new algebra_solver_vari<Fy, F, T2, Fx>(Fy(), f, value_of(x), y, dat,
+      = new algebra_solver_vari<Fy, F, T2, Fx>(fy, f, value_of(x), y, dat,
                                                dat_int, theta_dbl, fx, msgs);
   Eigen::Matrix<var, Eigen::Dynamic, 1> theta(x.size());
   theta(0) = var(vi0->theta_[0]);
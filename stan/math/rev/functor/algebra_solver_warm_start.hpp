@@ -0,0 +1,72 @@
+#ifndef STAN_MATH_REV_FUNCTOR_ALGEBRA_SOLVER_WARM_START_HPP
+#define STAN_MATH_REV_FUNCTOR_ALGEBRA_SOLVER_WARM_START_HPP
+
+#include <stan/math/rev/functor/kinsol_data.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <map>
+#include <memory>
+
+namespace stan {
+namespace math {
+
+/**
+ * Opt-in cache used to warm start repeated solves of the same
+ * algebraic system, such as the solves in consecutive leapfrog steps
+ * which see nearby parameter values. For each call site the cache
+ * keeps the last converged solution, which seeds the next solve in
+ * place of the user supplied guess, and the KINSOL workspace, which
+ * spares the Newton solver the set up of KINSOL.
+ *
+ * A call site is identified by the type of the algebraic system
+ * functor together with a non-negative integer id chosen by the
+ * caller. The cache is local to each thread.
+ *
+ * @tparam F type of algebraic system functor
+ */
+template <typename F>
+class algebra_solver_warm_start {
+ public:
+  struct entry {
+    /** last converged solution, empty if there is none */
+    Eigen::VectorXd x_;
+    /** KINSOL workspace of the last Newton solve */
+    std::unique_ptr<kinsol_workspace> workspace_;
+
+    /**
+     * Return the KINSOL workspace for a system of size N, creating it
+     * if needed.
+     *
+     * @param N size of the algebraic system
+     */
+    kinsol_workspace* workspace(size_t N) {
+      if (!workspace_ || workspace_->N_ != N) {
+        workspace_.reset(new kinsol_workspace(N));
+      }
+      return workspace_.get();
+    }
+  };
+
+  /**
+   * Return the cache entry of the call site with the given id on the
+   * calling thread.
+   *
+   * @param id call site id
+   */
+  static entry& get(int id) { return cache()[id]; }
+
+  /**
+   * Remove all entries of the calling thread.
+   */
+  static void clear() { cache().clear(); }
+
+ private:
+  static std::map<int, entry>& cache() {
+    static thread_local std::map<int, entry> cache_;
+    return cache_;
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+
+#endif
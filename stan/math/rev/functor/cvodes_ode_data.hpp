@@ -4,6 +4,7 @@
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/functor/coupled_ode_system.hpp>
 #include <stan/math/prim/functor/coupled_ode_system.hpp>
+#include <stan/math/prim/functor/ode_rhs_inplace.hpp>
 #include <cvodes/cvodes.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunlinsol/sunlinsol_dense.h>
@@ -144,15 +145,12 @@ class cvodes_ode_data {
  private:
   /**
    * Calculates the ODE RHS, dy_dt, using the user-supplied functor at
-   * the given time t and state y.
+   * the given time t and state y. Functors providing the in-place
+   * overload write directly into the CVODES state derivative.
    */
   inline void rhs(double t, const double y[], double dy_dt[]) const {
-    const std::vector<double> y_vec(y, y + N_);
-    const std::vector<double>& dy_dt_vec
-        = f_(t, y_vec, theta_dbl_, x_, x_int_, msgs_);
-    check_size_match("cvodes_ode_data", "dz_dt", dy_dt_vec.size(), "states",
-                     N_);
-    std::move(dy_dt_vec.begin(), dy_dt_vec.end(), dy_dt);
+    ode_rhs_inplace("cvodes_ode_data", f_, t, y, N_, theta_dbl_, x_, x_int_,
+                    msgs_, dy_dt);
   }
 
   /**
@@ -0,0 +1,568 @@
+#ifndef STAN_MATH_REV_FUNCTOR_IDAS_ADJOINT_SYSTEM_HPP
+#define STAN_MATH_REV_FUNCTOR_IDAS_ADJOINT_SYSTEM_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/typedefs.hpp>
+#include <stan/math/rev/functor/idas_system.hpp>
+#include <stan/math/rev/functor/jacobian.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/typedefs.hpp>
+#include <idas/idas.h>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <nvector/nvector_serial.h>
+#include <ostream>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Copies of the DAE functor, initial conditions, parameter values and
+ * data. The backward sweep of the adjoint method runs during the
+ * reverse pass, long after the arguments of the user call went out of
+ * scope, while <code>idas_system</code> only holds references. This
+ * struct is therefore a base of <code>idas_adjoint_system</code>
+ * preceding <code>idas_system</code> such that it is constructed
+ * first.
+ *
+ * @tparam F type of functor for DAE residual
+ */
+template <typename F>
+struct idas_adjoint_data {
+  const F f_dat_;
+  const std::vector<double> yy0_dat_;
+  const std::vector<double> yp0_dat_;
+  const std::vector<double> theta_dat_;
+  const std::vector<double> x_r_dat_;
+  const std::vector<int> x_i_dat_;
+
+  idas_adjoint_data(const F& f, const std::vector<double>& yy0,
+                    const std::vector<double>& yp0,
+                    const std::vector<double>& theta,
+                    const std::vector<double>& x_r,
+                    const std::vector<int>& x_i)
+      : f_dat_(f),
+        yy0_dat_(yy0),
+        yp0_dat_(yp0),
+        theta_dat_(theta),
+        x_r_dat_(x_r),
+        x_i_dat_(x_i) {}
+};
+}  // namespace internal
+
+/**
+ * IDAS DAE system with adjoint sensitivity calculation.
+ *
+ * The forward problem is solved once with checkpointing
+ * (<code>IDAAdjInit</code>/<code>IDASolveF</code>) and the solution
+ * is stored at the output times. For given adjoints \f$a_i\f$ of
+ * the solution at the output times \f$t_i\f$ the gradient of
+ * \f$\sum_i a_i^T y(t_i)\f$ with respect to the parameters is
+ * obtained from a single backward solve (<code>IDASolveB</code>) of
+ * the adjoint DAE
+ * \f[
+ *   F_{y'}^T \lambda' - F_y^T \lambda = 0
+ * \f]
+ * together with the quadrature \f$\lambda^T F_\theta\f$. At each
+ * output time the adjoint jumps by the contribution of \f$a_i\f$,
+ * where contributions of algebraic components are mapped through the
+ * algebraic equations. The residual Jacobians only enter through
+ * vector-Jacobian products, such that the cost of the backward solve
+ * does not grow with the number of parameters.
+ *
+ * The DAE must be semi-explicit of index one, i.e. the residual is
+ * linear in \f$y'\f$ with a constant coefficient matrix.
+ *
+ * Instances are allocated with <code>new</code> and freed along with
+ * the autodiff arena.
+ *
+ * @tparam F type of functor for DAE residual
+ */
+template <typename F>
+class idas_adjoint_system : private internal::idas_adjoint_data<F>,
+                            public idas_system<F, double, double, double>,
+                            public chainable_alloc {
+  using data_t = internal::idas_adjoint_data<F>;
+  using system_t = idas_system<F, double, double, double>;
+
+  const double rtol_;
+  const double atol_;
+  const int64_t max_num_steps_;
+  double t0_;
+  std::vector<double> ts_;
+  Eigen::MatrixXd yy_ts_;  // forward solution at ts
+  Eigen::MatrixXd yp_ts_;  // forward solution derivative at ts
+  Eigen::MatrixXd jac_yp_;  // constant Jacobian of residual wrt yp
+  std::vector<int> diff_eq_;
+  std::vector<int> alg_eq_;
+  std::vector<int> diff_var_;
+  std::vector<int> alg_var_;
+  SUNMatrix A_;
+  SUNLinearSolver LS_;
+  N_Vector nv_yyB_;
+  N_Vector nv_ypB_;
+  N_Vector nv_qB_;
+  SUNMatrix AB_;
+  SUNLinearSolver LSB_;
+  int which_b_;
+  bool backward_init_;
+
+ public:
+  /**
+   * Number of integration steps between two checkpoints of the
+   * forward solution.
+   */
+  static constexpr int IDAS_CHECKPOINT_STEPS = 100;
+
+  /**
+   * Construct IDAS DAE adjoint system from initial condition and
+   * parameters.
+   *
+   * @param[in] f DAE residual functor
+   * @param[in] yy0 initial condition
+   * @param[in] yp0 initial condition for derivatives
+   * @param[in] theta values of the parameters of the base DAE
+   * @param[in] x_r continuous data vector for the DAE
+   * @param[in] x_i integer data vector for the DAE
+   * @param[in] msgs stream to which messages are printed
+   * @param[in] rtol relative tolerance
+   * @param[in] atol absolute tolerance
+   * @param[in] max_num_steps max nb. of times steps
+   */
+  idas_adjoint_system(const F& f, const std::vector<double>& yy0,
+                      const std::vector<double>& yp0,
+                      const std::vector<double>& theta,
+                      const std::vector<double>& x_r,
+                      const std::vector<int>& x_i, std::ostream* msgs,
+                      double rtol, double atol, int64_t max_num_steps)
+      : data_t(f, yy0, yp0, theta, x_r, x_i),
+        system_t(this->f_dat_, std::vector<int>(yy0.size(), 0),
+                 this->yy0_dat_, this->yp0_dat_, this->theta_dat_,
+                 this->x_r_dat_, this->x_i_dat_, msgs),
+        rtol_(rtol),
+        atol_(atol),
+        max_num_steps_(max_num_steps),
+        t0_(0),
+        A_(SUNDenseMatrix(this->N_, this->N_)),
+        LS_(SUNDenseLinearSolver(this->nv_yy_, A_)),
+        nv_yyB_(N_VNew_Serial(this->N_)),
+        nv_ypB_(N_VNew_Serial(this->N_)),
+        nv_qB_(N_VNew_Serial(this->M_)),
+        AB_(SUNDenseMatrix(this->N_, this->N_)),
+        LSB_(SUNDenseLinearSolver(nv_yyB_, AB_)),
+        which_b_(0),
+        backward_init_(false) {}
+
+  /**
+   * Destructor to deallocate IDAS backward problem workspace.
+   */
+  ~idas_adjoint_system() {
+    SUNLinSolFree(LSB_);
+    SUNMatDestroy(AB_);
+    SUNLinSolFree(LS_);
+    SUNMatDestroy(A_);
+    N_VDestroy_Serial(nv_yyB_);
+    N_VDestroy_Serial(nv_ypB_);
+    N_VDestroy_Serial(nv_qB_);
+  }
+
+  /**
+   * Solve the forward problem with checkpointing and store the
+   * solution at the output times for the backward problem.
+   *
+   * @param[in] t0 initial time
+   * @param[in] ts times of the desired solutions, in strictly
+   * increasing order, all greater than the initial time
+   * @return a vector of states, each state being a vector of the
+   * same size as the state variable, corresponding to a time in ts.
+   */
+  std::vector<std::vector<double> > forward(double t0,
+                                            const std::vector<double>& ts) {
+    static const char* caller = "idas_adjoint_system";
+    const size_t N = this->N_;
+    t0_ = t0;
+    ts_ = ts;
+
+    init_jacobian_yp();
+    check_size_match(caller, "differential equations", diff_eq_.size(),
+                     "differential states", diff_var_.size());
+
+    void* mem = this->mem_;
+    CHECK_IDAS_CALL(
+        IDASetUserData(mem, static_cast<void*>(static_cast<system_t*>(this))));
+    CHECK_IDAS_CALL(
+        IDAInit(mem, this->residual(), t0, this->nv_yy_, this->nv_yp_));
+    CHECK_IDAS_CALL(IDASetLinearSolver(mem, LS_, A_));
+    CHECK_IDAS_CALL(IDASStolerances(mem, rtol_, atol_));
+    CHECK_IDAS_CALL(IDASetMaxNumSteps(mem, max_num_steps_));
+    CHECK_IDAS_CALL(IDAAdjInit(mem, IDAS_CHECKPOINT_STEPS, IDA_HERMITE));
+
+    std::vector<std::vector<double> > res_yy(ts.size());
+    yy_ts_.resize(N, ts.size());
+    yp_ts_.resize(N, ts.size());
+    double t1 = t0;
+    int ncheck;
+    for (size_t i = 0; i < ts.size(); ++i) {
+      CHECK_IDAS_CALL(IDASolveF(mem, ts[i], &t1, this->nv_yy_, this->nv_yp_,
+                                IDA_NORMAL, &ncheck));
+      res_yy[i] = this->yy_val_;
+      yy_ts_.col(i)
+          = Eigen::Map<const Eigen::VectorXd>(this->yy_val_.data(), N);
+      yp_ts_.col(i)
+          = Eigen::Map<const Eigen::VectorXd>(this->yp_val_.data(), N);
+    }
+    return res_yy;
+  }
+
+  /**
+   * Solve the backward problem for the given adjoints of the
+   * solution at the output times.
+   *
+   * @param[in] adj_ts adjoints of the solution, one column per
+   * output time
+   * @param[out] theta_adj gradient of the weighted solution with
+   * respect to the parameters
+   */
+  void backward(const Eigen::MatrixXd& adj_ts, Eigen::VectorXd& theta_adj) {
+    using Eigen::MatrixXd;
+    using Eigen::VectorXd;
+    const size_t N = this->N_;
+    const size_t nd = diff_eq_.size();
+    void* mem = this->mem_;
+
+    Eigen::Map<VectorXd> yyB(NV_DATA_S(nv_yyB_), N);
+    Eigen::Map<VectorXd> qB(NV_DATA_S(nv_qB_), this->M_);
+    VectorXd mu(N);
+    VectorXd mu_theta(this->M_);
+    theta_adj = VectorXd::Zero(this->M_);
+    yyB.setZero();
+
+    for (size_t i = ts_.size(); i-- > 0;) {
+      const double t = ts_[i];
+      const MatrixXd jac_yy = jacobian_yy(t, yy_ts_.col(i), yp_ts_.col(i));
+
+      // jump of the adjoint: a = F_yp^T d + F_y^T mu with mu only
+      // acting on the algebraic equations
+      MatrixXd C(N, N);
+      for (size_t k = 0; k < nd; ++k) {
+        C.col(k) = jac_yp_.row(diff_eq_[k]).transpose();
+      }
+      for (size_t k = 0; k < alg_eq_.size(); ++k) {
+        C.col(nd + k) = jac_yy.row(alg_eq_[k]).transpose();
+      }
+      const VectorXd z = C.colPivHouseholderQr().solve(adj_ts.col(i));
+      for (size_t k = 0; k < nd; ++k) {
+        yyB(diff_eq_[k]) += z(k);
+      }
+      if (!alg_eq_.empty()) {
+        mu.setZero();
+        for (size_t k = 0; k < alg_eq_.size(); ++k) {
+          mu(alg_eq_[k]) = z(nd + k);
+        }
+        vjp_theta(t, yy_ts_.col(i).data(), yp_ts_.col(i).data(), mu.data(),
+                  mu_theta.data());
+        theta_adj -= mu_theta;
+      }
+
+      consistent_adjoint(jac_yy);
+      qB.setZero();
+      if (!backward_init_) {
+        init_backward(t);
+      } else {
+        CHECK_IDAS_CALL(IDAReInitB(mem, which_b_, t, nv_yyB_, nv_ypB_));
+        CHECK_IDAS_CALL(IDAQuadReInitB(mem, which_b_, nv_qB_));
+      }
+
+      const double t_prev = i == 0 ? t0_ : ts_[i - 1];
+      double t_ret;
+      CHECK_IDAS_CALL(IDASolveB(mem, t_prev, IDA_NORMAL));
+      CHECK_IDAS_CALL(IDAGetB(mem, which_b_, &t_ret, nv_yyB_, nv_ypB_));
+      CHECK_IDAS_CALL(IDAGetQuadB(mem, which_b_, &t_ret, nv_qB_));
+      theta_adj += qB;
+    }
+  }
+
+  /**
+   * Implements the function of type IDAResFnB which is the
+   * residual of the adjoint DAE.
+   */
+  static int residual_adjoint(double t, N_Vector yy, N_Vector yp,
+                              N_Vector yyB, N_Vector ypB, N_Vector rrB,
+                              void* user_data) {
+    auto dae = static_cast<idas_adjoint_system*>(user_data);
+    const size_t N = dae->N_;
+    Eigen::Map<Eigen::VectorXd> rr(NV_DATA_S(rrB), N);
+    dae->vjp_yy(t, NV_DATA_S(yy), NV_DATA_S(yp), NV_DATA_S(yyB), rr.data());
+    rr = dae->jac_yp_.transpose()
+             * Eigen::Map<const Eigen::VectorXd>(NV_DATA_S(ypB), N)
+         - rr;
+    return 0;
+  }
+
+  /**
+   * Implements the function of type IDAQuadRhsFnB which is the
+   * integrand of the parameter gradient.
+   */
+  static int quadrature_adjoint(double t, N_Vector yy, N_Vector yp,
+                                N_Vector yyB, N_Vector ypB, N_Vector rhsQB,
+                                void* user_data) {
+    auto dae = static_cast<idas_adjoint_system*>(user_data);
+    dae->vjp_theta(t, NV_DATA_S(yy), NV_DATA_S(yp), NV_DATA_S(yyB),
+                   NV_DATA_S(rhsQB));
+    return 0;
+  }
+
+ private:
+  /**
+   * Create and initialize the backward problem at time t.
+   */
+  void init_backward(double t) {
+    void* mem = this->mem_;
+    CHECK_IDAS_CALL(IDACreateB(mem, &which_b_));
+    CHECK_IDAS_CALL(IDAInitB(mem, which_b_, residual_adjoint, t, nv_yyB_,
+                             nv_ypB_));
+    CHECK_IDAS_CALL(IDASetUserDataB(mem, which_b_, static_cast<void*>(this)));
+    CHECK_IDAS_CALL(IDASStolerancesB(mem, which_b_, rtol_, atol_));
+    CHECK_IDAS_CALL(IDASetMaxNumStepsB(mem, which_b_, max_num_steps_));
+    CHECK_IDAS_CALL(IDASetLinearSolverB(mem, which_b_, LSB_, AB_));
+    CHECK_IDAS_CALL(IDAQuadInitB(mem, which_b_, quadrature_adjoint, nv_qB_));
+    CHECK_IDAS_CALL(IDAQuadSStolerancesB(mem, which_b_, rtol_, atol_));
+    CHECK_IDAS_CALL(IDASetQuadErrConB(mem, which_b_, SUNTRUE));
+    backward_init_ = true;
+  }
+
+  /**
+   * Evaluate the constant Jacobian of the residual with respect to
+   * the derivatives and classify equations and states into
+   * differential and algebraic ones.
+   */
+  void init_jacobian_yp() {
+    const size_t N = this->N_;
+    const std::vector<double> yy(this->yy0_dat_);
+    const double t0 = t0_;
+    auto f_yp = [&](const vector_v& x) -> vector_v {
+      std::vector<var> yp(x.data(), x.data() + N);
+      auto eval = this->f_(t0, yy, yp, this->theta_, this->x_r_, this->x_i_,
+                           this->msgs_);
+      return Eigen::Map<vector_v>(eval.data(), N);
+    };
+    Eigen::VectorXd f_val;
+    jacobian(f_yp,
+             Eigen::Map<const Eigen::VectorXd>(this->yp0_dat_.data(), N),
+             f_val, jac_yp_);
+    for (size_t i = 0; i < N; ++i) {
+      (jac_yp_.row(i).isZero(0) ? alg_eq_ : diff_eq_).push_back(i);
+      (jac_yp_.col(i).isZero(0) ? alg_var_ : diff_var_).push_back(i);
+    }
+  }
+
+  /**
+   * Return the Jacobian of the residual with respect to the states.
+   */
+  Eigen::MatrixXd jacobian_yy(double t, const Eigen::VectorXd& yy,
+                              const Eigen::VectorXd& yp) {
+    const size_t N = this->N_;
+    const std::vector<double> yp_vec(yp.data(), yp.data() + N);
+    auto f_yy = [&](const vector_v& x) -> vector_v {
+      std::vector<var> yy_var(x.data(), x.data() + N);
+      auto eval = this->f_(t, yy_var, yp_vec, this->theta_, this->x_r_,
+                           this->x_i_, this->msgs_);
+      return Eigen::Map<vector_v>(eval.data(), N);
+    };
+    Eigen::VectorXd f_val;
+    Eigen::MatrixXd J;
+    jacobian(f_yy, yy, f_val, J);
+    return J;
+  }
+
+  /**
+   * Set the algebraic components of the adjoint and the derivatives
+   * of its differential components consistent with the adjoint DAE,
+   * given the differential components of the adjoint.
+   */
+  void consistent_adjoint(const Eigen::MatrixXd& jac_yy) {
+    using Eigen::MatrixXd;
+    using Eigen::VectorXd;
+    const size_t N = this->N_;
+    const size_t nd = diff_eq_.size();
+    const size_t na = alg_eq_.size();
+    Eigen::Map<VectorXd> yyB(NV_DATA_S(nv_yyB_), N);
+    Eigen::Map<VectorXd> ypB(NV_DATA_S(nv_ypB_), N);
+
+    if (na > 0) {
+      MatrixXd J_aa(na, na);
+      MatrixXd J_da(nd, na);
+      VectorXd lambda_d(nd);
+      for (size_t k = 0; k < na; ++k) {
+        for (size_t l = 0; l < na; ++l) {
+          J_aa(k, l) = jac_yy(alg_eq_[k], alg_var_[l]);
+        }
+      }
+      for (size_t k = 0; k < nd; ++k) {
+        lambda_d(k) = yyB(diff_eq_[k]);
+        for (size_t l = 0; l < na; ++l) {
+          J_da(k, l) = jac_yy(diff_eq_[k], alg_var_[l]);
+        }
+      }
+      const VectorXd lambda_a = J_aa.transpose().partialPivLu().solve(
+          -J_da.transpose() * lambda_d);
+      for (size_t k = 0; k < na; ++k) {
+        yyB(alg_eq_[k]) = lambda_a(k);
+      }
+    }
+
+    const VectorXd rhs = jac_yy.transpose() * yyB;
+    MatrixXd J_dd(nd, nd);
+    VectorXd rhs_d(nd);
+    for (size_t k = 0; k < nd; ++k) {
+      rhs_d(k) = rhs(diff_var_[k]);
+      for (size_t l = 0; l < nd; ++l) {
+        J_dd(k, l) = jac_yp_(diff_eq_[k], diff_var_[l]);
+      }
+    }
+    const VectorXd lambda_dp = J_dd.transpose().partialPivLu().solve(rhs_d);
+    ypB.setZero();
+    for (size_t k = 0; k < nd; ++k) {
+      ypB(diff_eq_[k]) = lambda_dp(k);
+    }
+  }
+
+  /**
+   * Calculate the vector-Jacobian product w^T F_y using nested
+   * reverse mode.
+   */
+  void vjp_yy(double t, const double* yy, const double* yp, const double* w,
+              double* out) {
+    const size_t N = this->N_;
+    const std::vector<double> yp_vec(yp, yp + N);
+    try {
+      start_nested();
+      std::vector<var> yy_var(yy, yy + N);
+      std::vector<var> res = this->f_(t, yy_var, yp_vec, this->theta_,
+                                      this->x_r_, this->x_i_, this->msgs_);
+      check_size_match("idas_adjoint_system", "residual", res.size(),
+                       "states", N);
+      var w_res = 0;
+      for (size_t i = 0; i < N; ++i) {
+        w_res += w[i] * res[i];
+      }
+      w_res.grad();
+      for (size_t i = 0; i < N; ++i) {
+        out[i] = yy_var[i].adj();
+      }
+    } catch (const std::exception& e) {
+      recover_memory_nested();
+      throw;
+    }
+    recover_memory_nested();
+  }
+
+  /**
+   * Calculate the vector-Jacobian product w^T F_theta using nested
+   * reverse mode.
+   */
+  void vjp_theta(double t, const double* yy, const double* yp,
+                 const double* w, double* out) {
+    const size_t N = this->N_;
+    const size_t M = this->M_;
+    const std::vector<double> yy_vec(yy, yy + N);
+    const std::vector<double> yp_vec(yp, yp + N);
+    try {
+      start_nested();
+      std::vector<var> theta_var(this->theta_.begin(), this->theta_.end());
+      std::vector<var> res = this->f_(t, yy_vec, yp_vec, theta_var,
+                                      this->x_r_, this->x_i_, this->msgs_);
+      check_size_match("idas_adjoint_system", "residual", res.size(),
+                       "states", N);
+      var w_res = 0;
+      for (size_t i = 0; i < N; ++i) {
+        w_res += w[i] * res[i];
+      }
+      w_res.grad();
+      for (size_t m = 0; m < M; ++m) {
+        out[m] = theta_var[m].adj();
+      }
+    } catch (const std::exception& e) {
+      recover_memory_nested();
+      throw;
+    }
+    recover_memory_nested();
+  }
+};
+
+/**
+ * The vari class for the solution of a DAE with adjoint
+ * sensitivities. The first state at the first output time is this
+ * vari, all other states are non-chaining varis. On
+ * <code>chain()</code> the adjoints of all states are collected and
+ * propagated to the parameters with a single backward solve.
+ *
+ * @tparam F type of functor for DAE residual
+ */
+template <typename F>
+class idas_adjoint_vari : public vari {
+  idas_adjoint_system<F>* dae_;
+  const size_t N_;
+  const size_t M_;
+  const size_t K_;
+  vari** theta_;
+
+ public:
+  /** states at the output times, stored output time by output time */
+  vari** yy_;
+
+  /**
+   * Construct the vari of the DAE solution.
+   *
+   * @param[in] dae adjoint DAE system after the forward solve
+   * @param[in] theta parameters of the DAE
+   * @param[in] yy solution of the forward solve
+   */
+  idas_adjoint_vari(idas_adjoint_system<F>* dae,
+                    const std::vector<var>& theta,
+                    const std::vector<std::vector<double> >& yy)
+      : vari(yy[0][0]),
+        dae_(dae),
+        N_(yy[0].size()),
+        M_(theta.size()),
+        K_(yy.size()),
+        theta_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(M_)),
+        yy_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(N_
+                                                                    * K_)) {
+    for (size_t m = 0; m < M_; ++m) {
+      theta_[m] = theta[m].vi_;
+    }
+    yy_[0] = this;
+    for (size_t k = 0; k < K_; ++k) {
+      for (size_t n = (k == 0 ? 1 : 0); n < N_; ++n) {
+        yy_[k * N_ + n] = new vari(yy[k][n], false);
+      }
+    }
+  }
+
+  void chain() {
+    Eigen::MatrixXd adj_ts(N_, K_);
+    for (size_t k = 0; k < K_; ++k) {
+      for (size_t n = 0; n < N_; ++n) {
+        adj_ts(n, k) = yy_[k * N_ + n]->adj_;
+      }
+    }
+    if ((adj_ts.array() == 0.0).all()) {
+      return;
+    }
+    Eigen::VectorXd theta_adj;
+    dae_->backward(adj_ts, theta_adj);
+    for (size_t m = 0; m < M_; ++m) {
+      theta_[m]->adj_ += theta_adj(m);
+    }
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -7,6 +7,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/functor/integrate_1d.hpp>
 #include <type_traits>
@@ -20,22 +21,23 @@ namespace stan {
 namespace math {
 
 /**
- * Calculate first derivative of f(x, param, std::ostream&)
- * with respect to the nth parameter. Uses nested reverse mode autodiff
+ * Calculate the value of f(x, xc, param, x_r, x_i, std::ostream*) and
+ * its first derivatives with respect to all parameters with one nested
+ * reverse mode autodiff sweep.
  *
  * Gradients that evaluate to NaN are set to zero if the function itself
  * evaluates to zero. If the function is not zero and the gradient evaluates to
  * NaN, a std::domain_error is thrown
  *
  * @tparam F type of f
+ * @return vector holding the value of f followed by its gradient
  */
 template <typename F>
-inline double gradient_of_f(const F &f, const double &x, const double &xc,
-                            const std::vector<double> &theta_vals,
-                            const std::vector<double> &x_r,
-                            const std::vector<int> &x_i, size_t n,
-                            std::ostream *msgs) {
-  double gradient = 0.0;
+inline Eigen::VectorXd value_and_gradient_of_f(
+    const F &f, const double &x, const double &xc,
+    const std::vector<double> &theta_vals, const std::vector<double> &x_r,
+    const std::vector<int> &x_i, std::ostream *msgs) {
+  Eigen::VectorXd fx_grad(theta_vals.size() + 1);
   start_nested();
   std::vector<var> theta_var(theta_vals.size());
   try {
@@ -44,14 +46,18 @@ inline double gradient_of_f(const F &f, const double &x, const double &xc,
     }
     var fx = f(x, xc, theta_var, x_r, x_i, msgs);
     fx.grad();
-    gradient = theta_var[n].adj();
-    if (is_nan(gradient)) {
-      if (fx.val() == 0) {
-        gradient = 0;
-      } else {
-        throw_domain_error("gradient_of_f", "The gradient of f", n,
-                           "is nan for parameter ", "");
+    fx_grad(0) = fx.val();
+    for (size_t n = 0; n < theta_vals.size(); ++n) {
+      double gradient = theta_var[n].adj();
+      if (is_nan(gradient)) {
+        if (fx.val() == 0) {
+          gradient = 0;
+        } else {
+          throw_domain_error("gradient_of_f", "The gradient of f", n,
+                             "is nan for parameter ", "");
+        }
       }
+      fx_grad(n + 1) = gradient;
     }
   } catch (const std::exception &e) {
     recover_memory_nested();
@@ -59,7 +65,25 @@ inline double gradient_of_f(const F &f, const double &x, const double &xc,
   }
   recover_memory_nested();
 
-  return gradient;
+  return fx_grad;
+}
+
+/**
+ * Calculate first derivative of f(x, param, std::ostream&)
+ * with respect to the nth parameter. Uses nested reverse mode autodiff
+ *
+ * The whole gradient is computed by value_and_gradient_of_f, so a NaN
+ * gradient with respect to any parameter throws if f is not zero.
+ *
+ * @tparam F type of f
+ */
+template <typename F>
+inline double gradient_of_f(const F &f, const double &x, const double &xc,
+                            const std::vector<double> &theta_vals,
+                            const std::vector<double> &x_r,
+                            const std::vector<int> &x_i, size_t n,
+                            std::ostream *msgs) {
+  return value_and_gradient_of_f(f, x, xc, theta_vals, x_r, x_i, msgs)(n + 1);
 }
 
 /**
@@ -97,6 +121,11 @@ inline double gradient_of_f(const F &f, const double &x, const double &xc,
  * split into two. In this case, each integral is separately integrated to the
  * given relative_tolerance.
  *
+ * If theta holds vars, the integral and its gradients with respect to
+ * theta are computed in a single quadrature of the vector valued integrand
+ * holding f and its gradient. The termination criterion then uses the
+ * maximum norm of this vector in place of the absolute value.
+ *
  * Gradients of f that evaluate to NaN when the function evaluates to zero are
  * set to zero themselves. This is due to the autodiff easily overflowing to NaN
  * when evaluating gradients near the maximum and minimum floating point values
@@ -133,26 +162,35 @@ inline return_type_t<T_a, T_b, T_theta> integrate_1d(
     }
     return var(0.0);
   } else {
-    double integral = integrate(
-        std::bind<double>(f, std::placeholders::_1, std::placeholders::_2,
-                          value_of(theta), x_r, x_i, msgs),
-        value_of(a), value_of(b), relative_tolerance);
-
     size_t N_theta_vars = is_var<T_theta>::value ? theta.size() : 0;
+    double integral = 0.0;
     std::vector<double> dintegral_dtheta(N_theta_vars);
     std::vector<var> theta_concat(N_theta_vars);
 
     if (N_theta_vars > 0) {
+      // Integrate the value and all gradients together on one set of
+      // nodes, so f is evaluated and differentiated once per node.
       std::vector<double> theta_vals = value_of(theta);
-
+      auto value_and_gradient = [&](double x, double xc) {
+        return internal::integrand_vector(value_and_gradient_of_f(
+            f, x, xc, theta_vals, x_r, x_i, msgs));
+      };
+      internal::integrand_vector Q = integrate(
+          value_and_gradient, value_of(a), value_of(b), relative_tolerance);
+      if (Q.v_.size() > 0) {
+        integral = Q.v_(0);
+        for (size_t n = 0; n < N_theta_vars; ++n) {
+          dintegral_dtheta[n] = Q.v_(n + 1);
+        }
+      }
       for (size_t n = 0; n < N_theta_vars; ++n) {
-        dintegral_dtheta[n] = integrate(
-            std::bind<double>(gradient_of_f<F>, f, std::placeholders::_1,
-                              std::placeholders::_2, theta_vals, x_r, x_i, n,
-                              msgs),
-            value_of(a), value_of(b), relative_tolerance);
         theta_concat[n] = theta[n];
       }
+    } else {
+      integral = integrate(
+          std::bind<double>(f, std::placeholders::_1, std::placeholders::_2,
+                            value_of(theta), x_r, x_i, msgs),
+          value_of(a), value_of(b), relative_tolerance);
     }
 
     if (!is_inf(a) && is_var<T_a>::value) {
@@ -2,6 +2,8 @@
 #define STAN_MATH_REV_FUNCTOR_INTEGRATOR_DAE_HPP
 
 #include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/idas_adjoint_system.hpp>
 #include <stan/math/rev/functor/idas_forward_system.hpp>
 #include <stan/math/rev/functor/idas_integrator.hpp>
 #include <ostream>
@@ -56,6 +58,117 @@ std::vector<std::vector<Tpar> > integrate_dae(
   return solver.integrate(dae, t0, ts);
 }
 
+/**
+ * Return the solutions for a semi-explicit DAE system with residual
+ * specified by functor F, given the specified consistent initial
+ * state yy0 and yp0, using adjoint sensitivities for the gradients
+ * with respect to the parameters.
+ *
+ * As opposed to <code>integrate_dae</code>, which solves N * M
+ * forward sensitivity equations, the forward problem is solved once
+ * with checkpointing and the gradients are obtained during the
+ * reverse pass from a single backward solve of the adjoint DAE,
+ * such that the cost of the gradient does not grow with the number
+ * of parameters. The residual must be linear in the derivatives with
+ * a constant coefficient matrix and of index one.
+ *
+ * This overload is for data only parameters, in which case no
+ * sensitivities are required and <code>integrate_dae</code> is
+ * called.
+ *
+ * @tparam F type of DAE residual functor
+ *
+ * @param[in] f functor for the base ordinary differential equation
+ * @param[in] yy0 initial state
+ * @param[in] yp0 initial derivative state
+ * @param[in] t0 initial time
+ * @param[in] ts times of the desired solutions, in strictly
+ * increasing order, all greater than the initial time
+ * @param[in] theta parameters
+ * @param[in] x_r real data
+ * @param[in] x_i int data
+ * @param[in] rtol relative tolerance passed to IDAS, requred <10^-3
+ * @param[in] atol absolute tolerance passed to IDAS, problem-dependent
+ * @param[in] max_num_steps maximal number of admissable steps
+ * between time-points
+ * @param[in] msgs message
+ * @return a vector of states, each state being a vector of the
+ * same size as the state variable, corresponding to a time in ts.
+ */
+template <typename F>
+std::vector<std::vector<double> > integrate_dae_adjoint(
+    const F& f, const std::vector<double>& yy0, const std::vector<double>& yp0,
+    double t0, const std::vector<double>& ts, const std::vector<double>& theta,
+    const std::vector<double>& x_r, const std::vector<int>& x_i,
+    const double rtol, const double atol,
+    const int64_t max_num_steps = idas_integrator::IDAS_MAX_STEPS,
+    std::ostream* msgs = nullptr) {
+  return integrate_dae(f, yy0, yp0, t0, ts, theta, x_r, x_i, rtol, atol,
+                       max_num_steps, msgs);
+}
+
+/**
+ * Return the solutions for a semi-explicit DAE system with residual
+ * specified by functor F, given the specified consistent initial
+ * state yy0 and yp0, using adjoint sensitivities for the gradients
+ * with respect to the parameters.
+ *
+ * The forward problem is solved with checkpointing when this function
+ * is called and the backward problem is solved once per reverse
+ * pass, see <code>idas_adjoint_system</code>.
+ *
+ * @tparam F type of DAE residual functor
+ *
+ * @param[in] f functor for the base ordinary differential equation
+ * @param[in] yy0 initial state
+ * @param[in] yp0 initial derivative state
+ * @param[in] t0 initial time
+ * @param[in] ts times of the desired solutions, in strictly
+ * increasing order, all greater than the initial time
+ * @param[in] theta parameters
+ * @param[in] x_r real data
+ * @param[in] x_i int data
+ * @param[in] rtol relative tolerance passed to IDAS, requred <10^-3
+ * @param[in] atol absolute tolerance passed to IDAS, problem-dependent
+ * @param[in] max_num_steps maximal number of admissable steps
+ * between time-points
+ * @param[in] msgs message
+ * @return a vector of states, each state being a vector of the
+ * same size as the state variable, corresponding to a time in ts.
+ */
+template <typename F>
+std::vector<std::vector<var> > integrate_dae_adjoint(
+    const F& f, const std::vector<double>& yy0, const std::vector<double>& yp0,
+    double t0, const std::vector<double>& ts, const std::vector<var>& theta,
+    const std::vector<double>& x_r, const std::vector<int>& x_i,
+    const double rtol, const double atol,
+    const int64_t max_num_steps = idas_integrator::IDAS_MAX_STEPS,
+    std::ostream* msgs = nullptr) {
+  static const char* caller = "idas_integrator";
+  // validates the tolerances and the number of steps
+  idas_integrator solver(rtol, atol, max_num_steps);
+  check_finite(caller, "initial time", t0);
+  check_finite(caller, "times", ts);
+  check_ordered(caller, "times", ts);
+  check_nonzero_size(caller, "times", ts);
+  check_less(caller, "initial time", t0, ts.front());
+
+  auto dae = new idas_adjoint_system<F>(f, yy0, yp0, value_of(theta), x_r,
+                                        x_i, msgs, rtol, atol, max_num_steps);
+  dae->check_ic_consistency(t0, atol);
+  std::vector<std::vector<double> > yy_dbl = dae->forward(t0, ts);
+
+  auto vi = new idas_adjoint_vari<F>(dae, theta, yy_dbl);
+  const size_t N = yy0.size();
+  std::vector<std::vector<var> > yy(ts.size(), std::vector<var>(N));
+  for (size_t k = 0; k < ts.size(); ++k) {
+    for (size_t n = 0; n < N; ++n) {
+      yy[k][n] = var(vi->yy_[k * N + n]);
+    }
+  }
+  return yy;
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/functor/algebra_system.hpp>
 #include <stan/math/rev/functor/jacobian.hpp>
+#include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/to_array_1d.hpp>
 #include <stan/math/prim/fun/to_vector.hpp>
 #include <kinsol/kinsol.h>
@@ -39,6 +40,69 @@ struct kinsol_J_f {
   }
 };
 
+/**
+ * KINSOL workspace: the solver memory block, the dense Jacobian and
+ * the linear solver for a system of a given size. The workspace is
+ * independent of the system data and can be kept alive across calls to
+ * <code>kinsol_solve</code> so that repeated solves of the same
+ * system skip the set up of KINSOL.
+ */
+class kinsol_workspace {
+ public:
+  const size_t N_;
+  N_Vector nv_x_;
+  N_Vector scaling_;
+  SUNMatrix J_;
+  SUNLinearSolver LS_;
+  void* kinsol_memory_;
+  /** system function KINSOL was initialized with, if any */
+  KINSysFn sys_fn_;
+
+  explicit kinsol_workspace(size_t N)
+      : N_(N),
+        nv_x_(N_VNew_Serial(N_)),
+        scaling_(N_VNew_Serial(N_)),
+        J_(SUNDenseMatrix(N_, N_)),
+        LS_(SUNLinSol_Dense(nv_x_, J_)),
+        kinsol_memory_(KINCreate()),
+        sys_fn_(nullptr) {
+    N_VConst_Serial(1.0, scaling_);  // no scaling
+  }
+
+  kinsol_workspace(const kinsol_workspace&) = delete;
+  kinsol_workspace& operator=(const kinsol_workspace&) = delete;
+
+  ~kinsol_workspace() {
+    N_VDestroy_Serial(nv_x_);
+    N_VDestroy_Serial(scaling_);
+    SUNLinSolFree(LS_);
+    SUNMatDestroy(J_);
+    KINFree(&kinsol_memory_);
+  }
+
+  /**
+   * Initialize KINSOL with the system function and attach the linear
+   * solver, unless this has already been done for the same system
+   * function.
+   *
+   * @param sys_fn system function passed to KINSOL
+   */
+  void init(KINSysFn sys_fn) {
+    if (sys_fn_ == sys_fn) {
+      return;
+    }
+    if (sys_fn_ != nullptr) {
+      KINFree(&kinsol_memory_);
+      kinsol_memory_ = KINCreate();
+      sys_fn_ = nullptr;
+    }
+    check_flag_sundials(KINInit(kinsol_memory_, sys_fn, nv_x_), "KINInit");
+    check_flag_sundials(KINSetLinearSolver(kinsol_memory_, LS_, J_),
+                        "KINSetLinearSolver");
+    sys_fn_ = sys_fn;
+  }
+};
+
 /**
  * KINSOL algebraic system data holder.
  * Based on cvodes_ode_data.
@@ -61,11 +125,6 @@ class kinsol_system_data {
   typedef kinsol_system_data<F1, F2> system_data;
 
  public:
-  N_Vector nv_x_;
-  SUNMatrix J_;
-  SUNLinearSolver LS_;
-  void* kinsol_memory_;
-
   /* Constructor */
   kinsol_system_data(const F1& f, const F2& J_f, const Eigen::VectorXd& x,
                      const Eigen::VectorXd& y, const std::vector<double>& dat,
@@ -77,18 +136,7 @@ class kinsol_system_data {
         N_(x.size()),
         dat_(dat),
         dat_int_(dat_int),
-        msgs_(msgs),
-        nv_x_(N_VMake_Serial(N_, &to_array_1d(x_)[0])),
-        J_(SUNDenseMatrix(N_, N_)),
-        LS_(SUNLinSol_Dense(nv_x_, J_)),
-        kinsol_memory_(KINCreate()) {}
-
-  ~kinsol_system_data() {
-    N_VDestroy_Serial(nv_x_);
-    SUNLinSolFree(LS_);
-    SUNMatDestroy(J_);
-    KINFree(&kinsol_memory_);
-  }
+        msgs_(msgs) {}
 
   /* Implements the user-defined function passed to KINSOL. */
   static int kinsol_f_system(N_Vector x, N_Vector f, void* user_data) {
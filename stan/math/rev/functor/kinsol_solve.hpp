@@ -10,6 +10,7 @@
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunlinsol/sunlinsol_dense.h>
 #include <nvector/nvector_serial.h>
+#include <memory>
 #include <vector>
 
 namespace stan {
@@ -47,6 +48,9 @@ namespace math {
  *            If equal to 1, the algorithm computes exact Newton steps.
  * @param[in] global_line_search does the solver use a global line search?
  *            If equal to KIN_NONE, no, if KIN_LINESEARCH, yes.
+ * @param[in, out] workspace KINSOL workspace to reuse from a previous
+ *            solve of the same system. If null or of a different size,
+ *            a workspace local to this call is used.
  * @return x_solution Vector of solutions to the system of equations.
  * @throw <code>std::invalid_argument</code> if Kinsol returns a negative
  *        flag when setting up the solver.
@@ -61,30 +65,28 @@ Eigen::VectorXd kinsol_solve(
     double function_tolerance = 1e-6,
     long int max_num_steps = 200,  // NOLINT(runtime/int)
     bool custom_jacobian = 1, const F2& J_f = kinsol_J_f(),
-    int steps_eval_jacobian = 10, int global_line_search = KIN_LINESEARCH) {
+    int steps_eval_jacobian = 10, int global_line_search = KIN_LINESEARCH,
+    kinsol_workspace* workspace = nullptr) {
   int N = x.size();
   typedef kinsol_system_data<F1, F2> system_data;
   system_data kinsol_data(f, J_f, x, y, dat, dat_int, msgs);
 
-  check_flag_sundials(KINInit(kinsol_data.kinsol_memory_,
-                              &system_data::kinsol_f_system, kinsol_data.nv_x_),
-                      "KINInit");
+  std::unique_ptr<kinsol_workspace> local_workspace;
+  if (workspace == nullptr || workspace->N_ != static_cast<size_t>(N)) {
+    local_workspace.reset(new kinsol_workspace(N));
+    workspace = local_workspace.get();
+  }
+  workspace->init(&system_data::kinsol_f_system);
+  void* kinsol_memory = workspace->kinsol_memory_;
 
-  N_Vector scaling = N_VNew_Serial(N);
-  N_VConst_Serial(1.0, scaling);  // no scaling
-
-  check_flag_sundials(
-      KINSetNumMaxIters(kinsol_data.kinsol_memory_, max_num_steps),
-      "KINSetNumMaxIters");
-  check_flag_sundials(
-      KINSetFuncNormTol(kinsol_data.kinsol_memory_, function_tolerance),
-      "KINSetFuncNormTol");
-  check_flag_sundials(
-      KINSetScaledStepTol(kinsol_data.kinsol_memory_, scaling_step_tol),
-      "KINSetScaledStepTol");
-  check_flag_sundials(
-      KINSetMaxSetupCalls(kinsol_data.kinsol_memory_, steps_eval_jacobian),
-      "KINSetMaxSetupCalls");
+  check_flag_sundials(KINSetNumMaxIters(kinsol_memory, max_num_steps),
+                      "KINSetNumMaxIters");
+  check_flag_sundials(KINSetFuncNormTol(kinsol_memory, function_tolerance),
+                      "KINSetFuncNormTol");
+  check_flag_sundials(KINSetScaledStepTol(kinsol_memory, scaling_step_tol),
+                      "KINSetScaledStepTol");
+  check_flag_sundials(KINSetMaxSetupCalls(kinsol_memory, steps_eval_jacobian),
+                      "KINSetMaxSetupCalls");
 
   // CHECK
   // The default value is 1000 * ||u_0||_D where ||u_0|| is the initial guess.
@@ -92,37 +94,36 @@ Eigen::VectorXd kinsol_solve(
   // If the norm is non-zero, use kinsol's default (accessed with 0),
   // else use the dimension of x -- CHECK - find optimal length.
   double max_newton_step = (x.norm() == 0) ? x.size() : 0;
+  check_flag_sundials(KINSetMaxNewtonStep(kinsol_memory, max_newton_step),
+                      "KINSetMaxNewtonStep");
   check_flag_sundials(
-      KINSetMaxNewtonStep(kinsol_data.kinsol_memory_, max_newton_step),
-      "KINSetMaxNewtonStep");
-  check_flag_sundials(KINSetUserData(kinsol_data.kinsol_memory_,
-                                     static_cast<void*>(&kinsol_data)),
-                      "KINSetUserData");
-
-  // construct Linear solver
-  check_flag_sundials(KINSetLinearSolver(kinsol_data.kinsol_memory_,
-                                         kinsol_data.LS_, kinsol_data.J_),
-                      "KINSetLinearSolver");
+      KINSetUserData(kinsol_memory, static_cast<void*>(&kinsol_data)),
+      "KINSetUserData");
 
-  if (custom_jacobian)
-    check_flag_sundials(
-        KINSetJacFn(kinsol_data.kinsol_memory_, &system_data::kinsol_jacobian),
-        "KINSetJacFn");
+  // a null Jacobian function selects KINSOL's difference quotient
+  check_flag_sundials(
+      KINSetJacFn(kinsol_memory,
+                  custom_jacobian ? &system_data::kinsol_jacobian : nullptr),
+      "KINSetJacFn");
 
   N_Vector nv_x = N_VNew_Serial(N);
   for (int i = 0; i < N; i++)
     NV_Ith_S(nv_x, i) = x(i);
 
-  check_flag_kinsol(KINSol(kinsol_data.kinsol_memory_, nv_x, global_line_search,
-                           scaling, scaling),
-                    max_num_steps);
+  try {
+    check_flag_kinsol(KINSol(kinsol_memory, nv_x, global_line_search,
+                             workspace->scaling_, workspace->scaling_),
+                      max_num_steps);
+  } catch (const std::exception& e) {
+    N_VDestroy(nv_x);
+    throw;
+  }
 
   Eigen::VectorXd x_solution(N);
   for (int i = 0; i < N; i++)
     x_solution(i) = NV_Ith_S(nv_x, i);
 
   N_VDestroy(nv_x);
-  N_VDestroy(scaling);
 
   return x_solution;
 }
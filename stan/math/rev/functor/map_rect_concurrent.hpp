@@ -5,19 +5,198 @@
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/functor/map_rect_concurrent.hpp>
 #include <stan/math/prim/functor/map_rect_reduce.hpp>
-#include <stan/math/prim/functor/map_rect_combine.hpp>
-#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core.hpp>
 
-#include <tbb/parallel_for.h>
-#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace stan {
 namespace math {
 namespace internal {
 
+/**
+ * Arena owned storage of the outputs of the reduce step of all jobs,
+ * which is released together with the AD tape. Column j of the output
+ * of job i holds the value of the job's output j followed by its
+ * gradient with respect to the shared and the job specific
+ * parameters, as far as these are vars.
+ */
+class map_rect_job_outputs : public chainable_alloc {
+ public:
+  std::vector<matrix_d> job_output_;
+  /** output n is an output of job i if offsets_[i] <= n < offsets_[i + 1] */
+  std::vector<int> offsets_;
+
+  map_rect_job_outputs(std::vector<matrix_d>&& job_output,
+                       std::vector<int>&& offsets)
+      : job_output_(std::move(job_output)), offsets_(std::move(offsets)) {}
+};
+
+/**
+ * Vari of all outputs of a map_rect call. The gradients are read in
+ * place from the outputs of the reduce step, such that neither a
+ * combined copy of the outputs nor one vari with its own gradient
+ * storage per output is needed. The first output is this vari, all
+ * further outputs are non-chaining varis whose adjoints are
+ * propagated by the chain method of this vari.
+ *
+ * @tparam T_shared_param type of the shared parameters
+ * @tparam T_job_param type of the job specific parameters
+ */
+template <typename T_shared_param, typename T_job_param>
+class map_rect_vari : public vari {
+ public:
+  const int num_shared_;
+  const int num_job_;
+  const int num_jobs_;
+  const int num_outputs_;
+  vari** shared_varis_;
+  vari** job_varis_;
+  vari** output_varis_;
+  map_rect_job_outputs* outputs_;
+
+  /**
+   * Construct the vari of all outputs of a map_rect call.
+   *
+   * @param shared_params shared parameters
+   * @param job_params job specific parameters
+   * @param outputs outputs of the reduce step of all jobs, which must
+   * contain at least one output
+   */
+  map_rect_vari(
+      const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+      const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+          job_params,
+      map_rect_job_outputs* outputs)
+      : vari(first_value(outputs)),
+        num_shared_(is_var<T_shared_param>::value ? shared_params.size() : 0),
+        num_job_(is_var<T_job_param>::value ? job_params[0].size() : 0),
+        num_jobs_(job_params.size()),
+        num_outputs_(outputs->offsets_.back()),
+        shared_varis_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+                num_shared_)),
+        job_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            num_jobs_ * num_job_)),
+        output_varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+            num_outputs_)),
+        outputs_(outputs) {
+    for (int k = 0; k < num_shared_; ++k) {
+      shared_varis_[k] = vari_of(shared_params(k));
+    }
+    for (int i = 0; i < num_jobs_; ++i) {
+      for (int k = 0; k < num_job_; ++k) {
+        job_varis_[i * num_job_ + k] = vari_of(job_params[i](k));
+      }
+    }
+    int n = 0;
+    for (int i = 0; i < num_jobs_; ++i) {
+      const matrix_d& job = outputs_->job_output_[i];
+      for (int j = 0; j < job.cols(); ++j, ++n) {
+        output_varis_[n] = n == 0 ? this : new vari(job(0, j), false);
+      }
+    }
+  }
+
+  void chain() {
+    Eigen::VectorXd shared_adj = Eigen::VectorXd::Zero(num_shared_);
+    for (int i = 0; i < num_jobs_; ++i) {
+      const matrix_d& job = outputs_->job_output_[i];
+      const int offset = outputs_->offsets_[i];
+      const int num_job_outputs = job.cols();
+      if (num_job_outputs == 0) {
+        continue;
+      }
+      Eigen::VectorXd output_adj(num_job_outputs);
+      for (int j = 0; j < num_job_outputs; ++j) {
+        output_adj(j) = output_varis_[offset + j]->adj_;
+      }
+      if (num_shared_ > 0) {
+        shared_adj.noalias() += job.middleRows(1, num_shared_) * output_adj;
+      }
+      if (num_job_ > 0) {
+        Eigen::VectorXd job_adj
+            = job.middleRows(1 + num_shared_, num_job_) * output_adj;
+        for (int k = 0; k < num_job_; ++k) {
+          job_varis_[i * num_job_ + k]->adj_ += job_adj(k);
+        }
+      }
+    }
+    for (int k = 0; k < num_shared_; ++k) {
+      shared_varis_[k]->adj_ += shared_adj(k);
+    }
+  }
+
+ private:
+  static double first_value(const map_rect_job_outputs* outputs) {
+    for (const auto& job : outputs->job_output_) {
+      if (job.cols() > 0) {
+        return job(0, 0);
+      }
+    }
+    return 0;
+  }
+
+  static vari* vari_of(const var& x) { return x.vi_; }
+  static vari* vari_of(double x) { return nullptr; }
+};
+
+/**
+ * Return the outputs of a map_rect call without vars.
+ *
+ * @param shared_params shared parameters
+ * @param job_params job specific parameters
+ * @param job_output outputs of the reduce step of all jobs
+ * @param offsets offsets of the outputs of each job in the result
+ */
+inline vector_d map_rect_assemble(const vector_d& shared_params,
+                                  const std::vector<vector_d>& job_params,
+                                  std::vector<matrix_d>&& job_output,
+                                  std::vector<int>&& offsets) {
+  vector_d out(offsets.back());
+  for (std::size_t i = 0; i < job_output.size(); ++i) {
+    out.segment(offsets[i], job_output[i].cols())
+        = job_output[i].row(0).transpose();
+  }
+  return out;
+}
+
+/**
+ * Return the outputs of a map_rect call with vars, which all are
+ * outputs of a single <code>map_rect_vari</code>.
+ *
+ * @tparam T_shared_param type of the shared parameters
+ * @tparam T_job_param type of the job specific parameters
+ * @param shared_params shared parameters
+ * @param job_params job specific parameters
+ * @param job_output outputs of the reduce step of all jobs
+ * @param offsets offsets of the outputs of each job in the result
+ */
+template <typename T_shared_param, typename T_job_param,
+          require_any_var_t<T_shared_param, T_job_param>...>
+inline vector_v map_rect_assemble(
+    const Eigen::Matrix<T_shared_param, Eigen::Dynamic, 1>& shared_params,
+    const std::vector<Eigen::Matrix<T_job_param, Eigen::Dynamic, 1>>&
+        job_params,
+    std::vector<matrix_d>&& job_output, std::vector<int>&& offsets) {
+  const int num_outputs = offsets.back();
+  vector_v out(num_outputs);
+  if (num_outputs == 0) {
+    return out;
+  }
+  auto outputs
+      = new map_rect_job_outputs(std::move(job_output), std::move(offsets));
+  auto vi = new map_rect_vari<T_shared_param, T_job_param>(shared_params,
+                                                           job_params, outputs);
+  for (int n = 0; n < num_outputs; ++n) {
+    out(n) = var(vi->output_varis_[n]);
+  }
+  return out;
+}
+
 template <int call_id, typename F, typename T_shared_param,
           typename T_job_param>
 Eigen::Matrix<return_type_t<T_shared_param, T_job_param>, Eigen::Dynamic, 1>
@@ -28,45 +207,29 @@ map_rect_concurrent(
     const std::vector<std::vector<double>>& x_r,
     const std::vector<std::vector<int>>& x_i, std::ostream* msgs) {
   using ReduceF = map_rect_reduce<F, T_shared_param, T_job_param>;
-  using CombineF = map_rect_combine<F, T_shared_param, T_job_param>;
+  using settings_F = typename map_rect_reduce_functor<F>::type;
 
   const int num_jobs = job_params.size();
   const vector_d shared_params_dbl = value_of(shared_params);
   std::vector<matrix_d> job_output(num_jobs);
-  std::vector<int> world_f_out(num_jobs, 0);
 
   auto execute_chunk = [&](std::size_t start, std::size_t end) -> void {
     for (std::size_t i = start; i != end; ++i) {
       job_output[i] = ReduceF()(shared_params_dbl, value_of(job_params[i]),
                                 x_r[i], x_i[i], msgs);
-      world_f_out[i] = job_output[i].cols();
     }
   };
 
-#ifdef STAN_THREADS
-  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_jobs),
-                    [&](const tbb::blocked_range<size_t>& r) {
-                      execute_chunk(r.begin(), r.end());
-                    });
-#else
-  execute_chunk(0, num_jobs);
-#endif
-
-  // collect results
-  const int num_world_output
-      = std::accumulate(world_f_out.begin(), world_f_out.end(), 0);
-  matrix_d world_output(job_output[0].rows(), num_world_output);
-
-  int offset = 0;
-  for (const auto& job : job_output) {
-    const int num_job_outputs = job.cols();
-
-    world_output.block(0, offset, world_output.rows(), num_job_outputs) = job;
+  static thread_local tbb::affinity_partitioner affinity;
+  map_rect_parallel_for(map_rect_settings<call_id, settings_F>(), affinity,
+                        num_jobs, execute_chunk);
 
-    offset += num_job_outputs;
+  std::vector<int> offsets(num_jobs + 1, 0);
+  for (int i = 0; i < num_jobs; ++i) {
+    offsets[i + 1] = offsets[i] + job_output[i].cols();
   }
-  CombineF combine(shared_params, job_params);
-  return combine(world_output, world_f_out);
+  return map_rect_assemble(shared_params, job_params, std::move(job_output),
+                           std::move(offsets));
 }
 
 }  // namespace internal
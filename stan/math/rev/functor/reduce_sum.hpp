@@ -0,0 +1,381 @@
+#ifndef STAN_MATH_REV_FUNCTOR_REDUCE_SUM_HPP
+#define STAN_MATH_REV_FUNCTOR_REDUCE_SUM_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/adj_jac_apply.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/functor/reduce_sum.hpp>
+
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
+#include <ostream>
+#include <tuple>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Return the number of vars in the argument.
+ *
+ * @tparam T arithmetic type
+ */
+template <typename T, require_arithmetic_t<T>...>
+inline size_t count_vars_impl(const T& x) {
+  return 0;
+}
+
+inline size_t count_vars_impl(const var& x) { return 1; }
+
+template <typename T, int R, int C>
+inline size_t count_vars_impl(const Eigen::Matrix<T, R, C>& x);
+
+template <typename T>
+inline size_t count_vars_impl(const std::vector<T>& x) {
+  if (!is_var<scalar_type_t<T>>::value) {
+    return 0;
+  }
+  size_t count = 0;
+  for (const auto& x_i : x) {
+    count += count_vars_impl(x_i);
+  }
+  return count;
+}
+
+template <typename T, int R, int C>
+inline size_t count_vars_impl(const Eigen::Matrix<T, R, C>& x) {
+  return is_var<T>::value ? x.size() : 0;
+}
+
+/**
+ * Return the total number of vars in the arguments, which may be
+ * arithmetic types, vars, Eigen matrices of those and std::vectors
+ * of any of these.
+ */
+inline size_t count_vars() { return 0; }
+
+template <typename T, typename... Pargs>
+inline size_t count_vars(const T& x, const Pargs&... args) {
+  return count_vars_impl(x) + count_vars(args...);
+}
+
+/**
+ * Store the varis of the argument starting at dest and return the
+ * position after the last stored vari.
+ *
+ * @tparam T type without vars
+ */
+template <typename T, require_not_same_st<T, var>...>
+inline vari** save_varis_impl(vari** dest, const T& x) {
+  return dest;
+}
+
+inline vari** save_varis_impl(vari** dest, const var& x) {
+  *dest = x.vi_;
+  return dest + 1;
+}
+
+template <int R, int C>
+inline vari** save_varis_impl(vari** dest, const Eigen::Matrix<var, R, C>& x);
+
+template <typename T, require_same_st<T, var>...>
+inline vari** save_varis_impl(vari** dest, const std::vector<T>& x) {
+  for (const auto& x_i : x) {
+    dest = save_varis_impl(dest, x_i);
+  }
+  return dest;
+}
+
+template <int R, int C>
+inline vari** save_varis_impl(vari** dest, const Eigen::Matrix<var, R, C>& x) {
+  for (int i = 0; i < x.size(); ++i) {
+    dest[i] = x(i).vi_;
+  }
+  return dest + x.size();
+}
+
+/**
+ * Store the varis of the arguments in the order counted by
+ * <code>count_vars</code> starting at dest and return the position
+ * after the last stored vari.
+ */
+inline vari** save_varis(vari** dest) { return dest; }
+
+template <typename T, typename... Pargs>
+inline vari** save_varis(vari** dest, const T& x, const Pargs&... args) {
+  return save_varis(save_varis_impl(dest, x), args...);
+}
+
+/**
+ * Add the adjoints of the vars of the argument to the array starting
+ * at dest and return the position after the last updated element.
+ *
+ * @tparam T type without vars
+ */
+template <typename T, require_not_same_st<T, var>...>
+inline double* accumulate_adjoints_impl(double* dest, const T& x) {
+  return dest;
+}
+
+inline double* accumulate_adjoints_impl(double* dest, const var& x) {
+  *dest += x.adj();
+  return dest + 1;
+}
+
+template <int R, int C>
+inline double* accumulate_adjoints_impl(double* dest,
+                                        const Eigen::Matrix<var, R, C>& x);
+
+template <typename T, require_same_st<T, var>...>
+inline double* accumulate_adjoints_impl(double* dest, const std::vector<T>& x) {
+  for (const auto& x_i : x) {
+    dest = accumulate_adjoints_impl(dest, x_i);
+  }
+  return dest;
+}
+
+template <int R, int C>
+inline double* accumulate_adjoints_impl(double* dest,
+                                        const Eigen::Matrix<var, R, C>& x) {
+  for (int i = 0; i < x.size(); ++i) {
+    dest[i] += x(i).adj();
+  }
+  return dest + x.size();
+}
+
+/**
+ * Add the adjoints of the vars of the arguments in the order counted
+ * by <code>count_vars</code> to the array starting at dest.
+ */
+inline double* accumulate_adjoints(double* dest) { return dest; }
+
+template <typename T, typename... Pargs>
+inline double* accumulate_adjoints(double* dest, const T& x,
+                                   const Pargs&... args) {
+  return accumulate_adjoints(accumulate_adjoints_impl(dest, x), args...);
+}
+
+/**
+ * Return a copy of the argument in which every var is replaced by a
+ * new var with the same value on the current (nested) tape. Arguments
+ * without vars are returned by reference.
+ *
+ * @tparam T type without vars
+ */
+template <typename T, require_not_same_st<T, var>...>
+inline const T& deep_copy_vars(const T& x) {
+  return x;
+}
+
+inline var deep_copy_vars(const var& x) {
+  return var(new vari(x.val(), false));
+}
+
+template <int R, int C>
+inline Eigen::Matrix<var, R, C> deep_copy_vars(
+    const Eigen::Matrix<var, R, C>& x);
+
+template <typename T, require_same_st<T, var>...>
+inline std::vector<T> deep_copy_vars(const std::vector<T>& x) {
+  std::vector<T> copy;
+  copy.reserve(x.size());
+  for (const auto& x_i : x) {
+    copy.emplace_back(deep_copy_vars(x_i));
+  }
+  return copy;
+}
+
+template <int R, int C>
+inline Eigen::Matrix<var, R, C> deep_copy_vars(
+    const Eigen::Matrix<var, R, C>& x) {
+  Eigen::Matrix<var, R, C> copy(x.rows(), x.cols());
+  for (int i = 0; i < x.size(); ++i) {
+    copy(i) = deep_copy_vars(x(i));
+  }
+  return copy;
+}
+
+/**
+ * Implementation of <code>reduce_sum</code> for reverse mode.
+ *
+ * Every slice is evaluated on a nested tape of the thread which runs
+ * it. The vars of the slice and of the shared arguments are deep
+ * copied onto the nested tape, the partial sum is evaluated and its
+ * gradient propagated, after which only the value and the adjoints of
+ * the copies are kept and the nested tape is recovered. Hence no
+ * per-term Jacobian is stored; the gradient of the sum with respect
+ * to each operand is accumulated directly, such that the outer tape
+ * receives a single vari whose operands are all vars of the sliced
+ * and shared arguments.
+ *
+ * @tparam ReduceFunction type of the partial sum functor
+ * @tparam Vec type of the sliced argument
+ * @tparam Args types of the shared arguments
+ */
+template <typename ReduceFunction, typename ReturnType, typename Vec,
+          typename... Args>
+struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
+                       Vec, Args...> {
+  /**
+   * TBB body which evaluates the partial sums of slices and
+   * accumulates their values and gradients. The adjoints of the sliced
+   * argument are written to disjoint positions of a shared array,
+   * while the value and the adjoints of the shared arguments are
+   * accumulated per body and combined in <code>join</code>.
+   */
+  struct recursive_reducer {
+    const Vec& vmapped_;
+    const std::vector<size_t>& sliced_offsets_;
+    double* sliced_partials_;
+    size_t num_vars_shared_terms_;
+    std::ostream* msgs_;
+    std::tuple<const Args&...> args_tuple_;
+    double sum_{0.0};
+    Eigen::VectorXd args_adjoints_;
+
+    recursive_reducer(const Vec& vmapped,
+                      const std::vector<size_t>& sliced_offsets,
+                      double* sliced_partials, size_t num_vars_shared_terms,
+                      std::ostream* msgs, const Args&... args)
+        : vmapped_(vmapped),
+          sliced_offsets_(sliced_offsets),
+          sliced_partials_(sliced_partials),
+          num_vars_shared_terms_(num_vars_shared_terms),
+          msgs_(msgs),
+          args_tuple_(args...),
+          args_adjoints_(Eigen::VectorXd::Zero(num_vars_shared_terms)) {}
+
+    recursive_reducer(recursive_reducer& other, tbb::split)
+        : vmapped_(other.vmapped_),
+          sliced_offsets_(other.sliced_offsets_),
+          sliced_partials_(other.sliced_partials_),
+          num_vars_shared_terms_(other.num_vars_shared_terms_),
+          msgs_(other.msgs_),
+          args_tuple_(other.args_tuple_),
+          args_adjoints_(Eigen::VectorXd::Zero(other.num_vars_shared_terms_)) {
+    }
+
+    /**
+     * Evaluate the partial sum of the terms in the range on a nested
+     * tape and accumulate its value and gradient.
+     *
+     * @param r range of terms
+     */
+    void operator()(const tbb::blocked_range<size_t>& r) {
+      if (r.empty()) {
+        return;
+      }
+      start_nested();
+      try {
+        Vec sub_slice;
+        sub_slice.reserve(r.size());
+        for (size_t i = r.begin(); i < r.end(); ++i) {
+          sub_slice.emplace_back(deep_copy_vars(vmapped_[i]));
+        }
+
+        auto args_copy = stan::math::internal::apply(
+            [](const Args&... args) {
+              return std::tuple<decltype(deep_copy_vars(args))...>(
+                  deep_copy_vars(args)...);
+            },
+            args_tuple_);
+
+        var sub_sum = stan::math::internal::apply(
+            [&](const auto&... args) {
+              return ReduceFunction()(sub_slice, r.begin(), r.end(), msgs_,
+                                      args...);
+            },
+            args_copy);
+        sub_sum.grad();
+        sum_ += sub_sum.val();
+
+        for (size_t i = r.begin(); i < r.end(); ++i) {
+          accumulate_adjoints_impl(sliced_partials_ + sliced_offsets_[i],
+                                   sub_slice[i - r.begin()]);
+        }
+        stan::math::internal::apply(
+            [&](const auto&... args) {
+              accumulate_adjoints(args_adjoints_.data(), args...);
+              return 0;
+            },
+            args_copy);
+      } catch (const std::exception& e) {
+        recover_memory_nested();
+        throw;
+      }
+      recover_memory_nested();
+    }
+
+    /**
+     * Add the value and the shared argument adjoints accumulated by
+     * another body.
+     *
+     * @param rhs body to combine with this one
+     */
+    void join(const recursive_reducer& rhs) {
+      sum_ += rhs.sum_;
+      args_adjoints_ += rhs.args_adjoints_;
+    }
+  };
+
+  /**
+   * Return the sum of the partial sums over all slices of the
+   * sliced argument as a var which depends on all vars of the sliced
+   * and the shared arguments.
+   *
+   * @param vmapped sliced argument
+   * @param grainsize suggested number of terms per slice
+   * @param msgs stream for messages of the partial sum functor
+   * @param args shared arguments
+   * @return sum of the terms
+   */
+  var operator()(const Vec& vmapped, int grainsize, std::ostream* msgs,
+                 const Args&... args) const {
+    const size_t num_terms = vmapped.size();
+    if (num_terms == 0) {
+      return var(0.0);
+    }
+
+    std::vector<size_t> sliced_offsets(num_terms + 1, 0);
+    for (size_t i = 0; i < num_terms; ++i) {
+      sliced_offsets[i + 1] = sliced_offsets[i] + count_vars(vmapped[i]);
+    }
+    const size_t num_vars_sliced_terms = sliced_offsets[num_terms];
+    const size_t num_vars_shared_terms = count_vars(args...);
+    const size_t num_vars = num_vars_sliced_terms + num_vars_shared_terms;
+
+    vari** varis
+        = ChainableStack::instance_->memalloc_.alloc_array<vari*>(num_vars);
+    double* partials
+        = ChainableStack::instance_->memalloc_.alloc_array<double>(num_vars);
+    std::fill(partials, partials + num_vars_sliced_terms, 0.0);
+
+    recursive_reducer worker(vmapped, sliced_offsets, partials,
+                             num_vars_shared_terms, msgs, args...);
+
+#ifdef STAN_THREADS
+    tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, num_terms, grainsize), worker);
+#else
+    worker(tbb::blocked_range<size_t>(0, num_terms));
+#endif
+
+    save_varis(varis, vmapped, args...);
+    std::copy(worker.args_adjoints_.data(),
+              worker.args_adjoints_.data() + num_vars_shared_terms,
+              partials + num_vars_sliced_terms);
+
+    return var(new precomputed_gradients_vari(worker.sum_, num_vars, varis,
+                                              partials));
+  }
+};
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,222 @@
+// Times the shape gradients of the regularized incomplete gamma and beta
+// functions and the gradients of gamma_lcdf and beta_lcdf, which use them,
+// on batches of the size of censored survival data sets.
+//
+// Build from the root of the repository with
+//
+//   g++ -std=c++1y -O3 -D_REENTRANT -pthread -I . -I lib/eigen_3.3.3 \
+//     -I lib/boost_1.72.0 -I lib/sundials_5.1.0/include \
+//     -I lib/tbb_2019_U8/include \
+//     test/performance/inc_gamma_beta_grad_benchmark.cpp \
+//     -o inc_gamma_beta_grad_benchmark -L lib/tbb -ltbb \
+//     -Wl,-rpath,"$(pwd)/lib/tbb"
+//
+// and run it as
+//
+//   ./inc_gamma_beta_grad_benchmark [N]
+//
+// where N is the number of elements per batch (default 1000000). It only
+// uses functions whose signatures did not change when the gradients were
+// rewritten, so the same file builds against earlier versions of the
+// library to compare with them.
+//
+// For each case it prints the time per element, the number of results
+// that are not finite or threw and a checksum of the finite results.
+
+#include <stan/math.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct batch_result {
+  double seconds;
+  int failed;
+  double checksum;
+};
+
+template <typename F>
+batch_result time_batch(std::size_t N, const F& f) {
+  batch_result result{0, 0, 0};
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t n = 0; n < N; ++n) {
+    try {
+      double g = f(n);
+      if (std::isfinite(g)) {
+        result.checksum += g;
+      } else {
+        ++result.failed;
+      }
+    } catch (const std::exception& e) {
+      ++result.failed;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  result.seconds = std::chrono::duration<double>(end - start).count();
+  return result;
+}
+
+void report(const std::string& name, std::size_t N,
+            const batch_result& result) {
+  std::cout << std::left << std::setw(44) << name << std::right
+            << std::setw(10) << std::fixed << std::setprecision(1)
+            << 1e9 * result.seconds / N << " ns/element" << std::setw(10)
+            << result.failed << " failed   checksum "
+            << std::scientific << std::setprecision(10) << result.checksum
+            << std::endl;
+}
+
+// shapes uniform on [lower, upper] and arguments around the mean
+struct gamma_batch {
+  std::vector<double> a, z, tgamma_a, digamma_a;
+
+  gamma_batch(std::size_t N, double lower, double upper, std::mt19937& rng)
+      : a(N), z(N), tgamma_a(N), digamma_a(N) {
+    std::uniform_real_distribution<double> unif(0, 1);
+    for (std::size_t n = 0; n < N; ++n) {
+      a[n] = lower + (upper - lower) * unif(rng);
+      z[n] = a[n] * (0.5 + unif(rng));
+      tgamma_a[n] = stan::math::tgamma(a[n]);
+      digamma_a[n] = stan::math::digamma(a[n]);
+    }
+  }
+};
+
+struct beta_batch {
+  std::vector<double> a, b, z, digamma_a, digamma_b, digamma_ab, beta_ab;
+
+  beta_batch(std::size_t N, double lower, double upper, std::mt19937& rng)
+      : a(N), b(N), z(N), digamma_a(N), digamma_b(N), digamma_ab(N),
+        beta_ab(N) {
+    std::uniform_real_distribution<double> unif(0, 1);
+    for (std::size_t n = 0; n < N; ++n) {
+      a[n] = lower + (upper - lower) * unif(rng);
+      b[n] = lower + (upper - lower) * unif(rng);
+      z[n] = std::fmin(a[n] / (a[n] + b[n]) * (0.5 + unif(rng)), 0.999);
+      digamma_a[n] = stan::math::digamma(a[n]);
+      digamma_b[n] = stan::math::digamma(b[n]);
+      digamma_ab[n] = stan::math::digamma(a[n] + b[n]);
+      beta_ab[n] = stan::math::beta(a[n], b[n]);
+    }
+  }
+};
+
+void bench_gamma(const std::string& range, const gamma_batch& x) {
+  const std::size_t N = x.a.size();
+  report("grad_reg_inc_gamma " + range, N, time_batch(N, [&](std::size_t n) {
+           return stan::math::grad_reg_inc_gamma(x.a[n], x.z[n], x.tgamma_a[n],
+                                                 x.digamma_a[n]);
+         }));
+  report("grad_reg_lower_inc_gamma " + range, N,
+         time_batch(N, [&](std::size_t n) {
+           return stan::math::grad_reg_lower_inc_gamma(x.a[n], x.z[n]);
+         }));
+}
+
+void bench_beta(const std::string& range, const beta_batch& x) {
+  const std::size_t N = x.a.size();
+  report("grad_reg_inc_beta " + range, N, time_batch(N, [&](std::size_t n) {
+           double g1 = 0;
+           double g2 = 0;
+           stan::math::grad_reg_inc_beta(g1, g2, x.a[n], x.b[n], x.z[n],
+                                         x.digamma_a[n], x.digamma_b[n],
+                                         x.digamma_ab[n], x.beta_ab[n]);
+           return g1 + g2;
+         }));
+  report("inc_beta_dda " + range, N, time_batch(N, [&](std::size_t n) {
+           return stan::math::inc_beta_dda(x.a[n], x.b[n], x.z[n],
+                                           x.digamma_a[n], x.digamma_ab[n]);
+         }));
+  report("inc_beta_ddb " + range, N, time_batch(N, [&](std::size_t n) {
+           return stan::math::inc_beta_ddb(x.a[n], x.b[n], x.z[n],
+                                           x.digamma_b[n], x.digamma_ab[n]);
+         }));
+}
+
+// one gradient of the sum of the log CDFs of a censored data set with
+// per-row shape parameters
+void bench_gamma_lcdf(const std::string& range, const gamma_batch& x) {
+  using stan::math::var;
+  std::vector<var> alpha(x.a.begin(), x.a.end());
+  auto start = std::chrono::steady_clock::now();
+  try {
+    var lp = stan::math::gamma_lcdf(x.z, alpha, 1.0);
+    lp.grad();
+  } catch (const std::exception& e) {
+    std::cout << "gamma_lcdf gradient " << range << " threw: " << e.what()
+              << std::endl;
+    stan::math::recover_memory();
+    return;
+  }
+  auto end = std::chrono::steady_clock::now();
+  batch_result result{std::chrono::duration<double>(end - start).count(), 0,
+                      0};
+  for (const var& alpha_n : alpha) {
+    if (std::isfinite(alpha_n.adj())) {
+      result.checksum += alpha_n.adj();
+    } else {
+      ++result.failed;
+    }
+  }
+  report("gamma_lcdf gradient " + range, alpha.size(), result);
+  stan::math::recover_memory();
+}
+
+void bench_beta_lcdf(const std::string& range, const beta_batch& x) {
+  using stan::math::var;
+  std::vector<var> alpha(x.a.begin(), x.a.end());
+  std::vector<var> beta(x.b.begin(), x.b.end());
+  auto start = std::chrono::steady_clock::now();
+  try {
+    var lp = stan::math::beta_lcdf(x.z, alpha, beta);
+    lp.grad();
+  } catch (const std::exception& e) {
+    std::cout << "beta_lcdf gradient " << range << " threw: " << e.what()
+              << std::endl;
+    stan::math::recover_memory();
+    return;
+  }
+  auto end = std::chrono::steady_clock::now();
+  batch_result result{std::chrono::duration<double>(end - start).count(), 0,
+                      0};
+  for (std::size_t n = 0; n < alpha.size(); ++n) {
+    double g = alpha[n].adj() + beta[n].adj();
+    if (std::isfinite(g)) {
+      result.checksum += g;
+    } else {
+      ++result.failed;
+    }
+  }
+  report("beta_lcdf gradient " + range, alpha.size(), result);
+  stan::math::recover_memory();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::size_t N
+      = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  std::mt19937 rng(1234);
+
+  gamma_batch gamma_small(N, 0.5, 10, rng);
+  gamma_batch gamma_large(N, 10, 150, rng);
+  bench_gamma("a in [0.5, 10]", gamma_small);
+  bench_gamma("a in [10, 150]", gamma_large);
+
+  beta_batch beta_small(N, 1, 10, rng);
+  beta_batch beta_large(N, 10, 300, rng);
+  bench_beta("a, b in [1, 10]", beta_small);
+  bench_beta("a, b in [10, 300]", beta_large);
+
+  bench_gamma_lcdf("a in [0.5, 10]", gamma_small);
+  bench_gamma_lcdf("a in [10, 150]", gamma_large);
+  bench_beta_lcdf("a, b in [1, 10]", beta_small);
+  bench_beta_lcdf("a, b in [10, 300]", beta_large);
+  return 0;
+}
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<double>, empty, empty, empty> type_fd_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_8;
+typedef boost::mpl::vector<double, fvar<double>, double, empty, empty, empty> type_fd_9;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_10;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_11;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, empty, empty, empty> type_fd_12;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_13;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_14;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_15;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_16;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_17;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_18;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_19;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<double>, empty, empty, empty> type_fd_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, double, empty, empty, empty> type_fd_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty, empty, empty> type_fd_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty, empty, empty> type_fd_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_80;
+typedef boost::mpl::vector<fvar<double>, double, double, empty, empty, empty> type_fd_81;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<double>, empty, empty, empty> type_fd_82;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_83;
+typedef boost::mpl::vector<fvar<double>, double, fvar<double>, empty, empty, empty> type_fd_84;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_85;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_86;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, empty, empty, empty> type_fd_87;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fd_88;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_89;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_90;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_91;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_92;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_93;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_94;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_95;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_96;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_97;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_98;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, double, empty, empty, empty> type_fd_99;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_0> AgradDistributionsBeta_fd_0;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_1> AgradDistributionsBeta_fd_1;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_2> AgradDistributionsBeta_fd_2;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_3> AgradDistributionsBeta_fd_3;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_4> AgradDistributionsBeta_fd_4;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_5> AgradDistributionsBeta_fd_5;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_6> AgradDistributionsBeta_fd_6;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_7> AgradDistributionsBeta_fd_7;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_8> AgradDistributionsBeta_fd_8;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_9> AgradDistributionsBeta_fd_9;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_10> AgradDistributionsBeta_fd_10;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_11> AgradDistributionsBeta_fd_11;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_12> AgradDistributionsBeta_fd_12;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_13> AgradDistributionsBeta_fd_13;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_14> AgradDistributionsBeta_fd_14;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_15> AgradDistributionsBeta_fd_15;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_16> AgradDistributionsBeta_fd_16;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_17> AgradDistributionsBeta_fd_17;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_18> AgradDistributionsBeta_fd_18;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_19> AgradDistributionsBeta_fd_19;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_20> AgradDistributionsBeta_fd_20;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_21> AgradDistributionsBeta_fd_21;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_22> AgradDistributionsBeta_fd_22;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_23> AgradDistributionsBeta_fd_23;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_24> AgradDistributionsBeta_fd_24;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_25> AgradDistributionsBeta_fd_25;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_26> AgradDistributionsBeta_fd_26;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_27> AgradDistributionsBeta_fd_27;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_28> AgradDistributionsBeta_fd_28;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_29> AgradDistributionsBeta_fd_29;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_30> AgradDistributionsBeta_fd_30;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_31> AgradDistributionsBeta_fd_31;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_32> AgradDistributionsBeta_fd_32;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_33> AgradDistributionsBeta_fd_33;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_34> AgradDistributionsBeta_fd_34;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_35> AgradDistributionsBeta_fd_35;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_36> AgradDistributionsBeta_fd_36;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_37> AgradDistributionsBeta_fd_37;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_38> AgradDistributionsBeta_fd_38;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_39> AgradDistributionsBeta_fd_39;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_40> AgradDistributionsBeta_fd_40;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_41> AgradDistributionsBeta_fd_41;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_42> AgradDistributionsBeta_fd_42;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_43> AgradDistributionsBeta_fd_43;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_44> AgradDistributionsBeta_fd_44;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_45> AgradDistributionsBeta_fd_45;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_46> AgradDistributionsBeta_fd_46;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_47> AgradDistributionsBeta_fd_47;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_48> AgradDistributionsBeta_fd_48;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_49> AgradDistributionsBeta_fd_49;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_50> AgradDistributionsBeta_fd_50;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_51> AgradDistributionsBeta_fd_51;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_52> AgradDistributionsBeta_fd_52;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_53> AgradDistributionsBeta_fd_53;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_54> AgradDistributionsBeta_fd_54;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_55> AgradDistributionsBeta_fd_55;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_56> AgradDistributionsBeta_fd_56;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_57> AgradDistributionsBeta_fd_57;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_58> AgradDistributionsBeta_fd_58;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_59> AgradDistributionsBeta_fd_59;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_60> AgradDistributionsBeta_fd_60;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_61> AgradDistributionsBeta_fd_61;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_62> AgradDistributionsBeta_fd_62;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_63> AgradDistributionsBeta_fd_63;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_64> AgradDistributionsBeta_fd_64;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_65> AgradDistributionsBeta_fd_65;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_66> AgradDistributionsBeta_fd_66;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_67> AgradDistributionsBeta_fd_67;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_68> AgradDistributionsBeta_fd_68;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_69> AgradDistributionsBeta_fd_69;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_70> AgradDistributionsBeta_fd_70;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_71> AgradDistributionsBeta_fd_71;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_72> AgradDistributionsBeta_fd_72;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_73> AgradDistributionsBeta_fd_73;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_74> AgradDistributionsBeta_fd_74;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_75> AgradDistributionsBeta_fd_75;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_76> AgradDistributionsBeta_fd_76;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_77> AgradDistributionsBeta_fd_77;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_78> AgradDistributionsBeta_fd_78;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_79> AgradDistributionsBeta_fd_79;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_80> AgradDistributionsBeta_fd_80;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_81> AgradDistributionsBeta_fd_81;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_82> AgradDistributionsBeta_fd_82;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_83> AgradDistributionsBeta_fd_83;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_84> AgradDistributionsBeta_fd_84;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_85> AgradDistributionsBeta_fd_85;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_86> AgradDistributionsBeta_fd_86;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_87> AgradDistributionsBeta_fd_87;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_88> AgradDistributionsBeta_fd_88;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_89> AgradDistributionsBeta_fd_89;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_90> AgradDistributionsBeta_fd_90;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_91> AgradDistributionsBeta_fd_91;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_92> AgradDistributionsBeta_fd_92;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_93> AgradDistributionsBeta_fd_93;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_94> AgradDistributionsBeta_fd_94;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_95> AgradDistributionsBeta_fd_95;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_96> AgradDistributionsBeta_fd_96;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_97> AgradDistributionsBeta_fd_97;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_98> AgradDistributionsBeta_fd_98;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_99> AgradDistributionsBeta_fd_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_0, AgradDistributionTestFixture, AgradDistributionsBeta_fd_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_1, AgradDistributionTestFixture, AgradDistributionsBeta_fd_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_2, AgradDistributionTestFixture, AgradDistributionsBeta_fd_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_3, AgradDistributionTestFixture, AgradDistributionsBeta_fd_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_4, AgradDistributionTestFixture, AgradDistributionsBeta_fd_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_5, AgradDistributionTestFixture, AgradDistributionsBeta_fd_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_6, AgradDistributionTestFixture, AgradDistributionsBeta_fd_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_7, AgradDistributionTestFixture, AgradDistributionsBeta_fd_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_8, AgradDistributionTestFixture, AgradDistributionsBeta_fd_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_9, AgradDistributionTestFixture, AgradDistributionsBeta_fd_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_10, AgradDistributionTestFixture, AgradDistributionsBeta_fd_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_11, AgradDistributionTestFixture, AgradDistributionsBeta_fd_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_12, AgradDistributionTestFixture, AgradDistributionsBeta_fd_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_13, AgradDistributionTestFixture, AgradDistributionsBeta_fd_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_14, AgradDistributionTestFixture, AgradDistributionsBeta_fd_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_15, AgradDistributionTestFixture, AgradDistributionsBeta_fd_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_16, AgradDistributionTestFixture, AgradDistributionsBeta_fd_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_17, AgradDistributionTestFixture, AgradDistributionsBeta_fd_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_18, AgradDistributionTestFixture, AgradDistributionsBeta_fd_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_19, AgradDistributionTestFixture, AgradDistributionsBeta_fd_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_20, AgradDistributionTestFixture, AgradDistributionsBeta_fd_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_21, AgradDistributionTestFixture, AgradDistributionsBeta_fd_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_22, AgradDistributionTestFixture, AgradDistributionsBeta_fd_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_23, AgradDistributionTestFixture, AgradDistributionsBeta_fd_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_24, AgradDistributionTestFixture, AgradDistributionsBeta_fd_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_25, AgradDistributionTestFixture, AgradDistributionsBeta_fd_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_26, AgradDistributionTestFixture, AgradDistributionsBeta_fd_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_27, AgradDistributionTestFixture, AgradDistributionsBeta_fd_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_28, AgradDistributionTestFixture, AgradDistributionsBeta_fd_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_29, AgradDistributionTestFixture, AgradDistributionsBeta_fd_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_30, AgradDistributionTestFixture, AgradDistributionsBeta_fd_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_31, AgradDistributionTestFixture, AgradDistributionsBeta_fd_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_32, AgradDistributionTestFixture, AgradDistributionsBeta_fd_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_33, AgradDistributionTestFixture, AgradDistributionsBeta_fd_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_34, AgradDistributionTestFixture, AgradDistributionsBeta_fd_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_35, AgradDistributionTestFixture, AgradDistributionsBeta_fd_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_36, AgradDistributionTestFixture, AgradDistributionsBeta_fd_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_37, AgradDistributionTestFixture, AgradDistributionsBeta_fd_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_38, AgradDistributionTestFixture, AgradDistributionsBeta_fd_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_39, AgradDistributionTestFixture, AgradDistributionsBeta_fd_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_40, AgradDistributionTestFixture, AgradDistributionsBeta_fd_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_41, AgradDistributionTestFixture, AgradDistributionsBeta_fd_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_42, AgradDistributionTestFixture, AgradDistributionsBeta_fd_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_43, AgradDistributionTestFixture, AgradDistributionsBeta_fd_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_44, AgradDistributionTestFixture, AgradDistributionsBeta_fd_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_45, AgradDistributionTestFixture, AgradDistributionsBeta_fd_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_46, AgradDistributionTestFixture, AgradDistributionsBeta_fd_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_47, AgradDistributionTestFixture, AgradDistributionsBeta_fd_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_48, AgradDistributionTestFixture, AgradDistributionsBeta_fd_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_49, AgradDistributionTestFixture, AgradDistributionsBeta_fd_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_50, AgradDistributionTestFixture, AgradDistributionsBeta_fd_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_51, AgradDistributionTestFixture, AgradDistributionsBeta_fd_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_52, AgradDistributionTestFixture, AgradDistributionsBeta_fd_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_53, AgradDistributionTestFixture, AgradDistributionsBeta_fd_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_54, AgradDistributionTestFixture, AgradDistributionsBeta_fd_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_55, AgradDistributionTestFixture, AgradDistributionsBeta_fd_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_56, AgradDistributionTestFixture, AgradDistributionsBeta_fd_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_57, AgradDistributionTestFixture, AgradDistributionsBeta_fd_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_58, AgradDistributionTestFixture, AgradDistributionsBeta_fd_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_59, AgradDistributionTestFixture, AgradDistributionsBeta_fd_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_60, AgradDistributionTestFixture, AgradDistributionsBeta_fd_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_61, AgradDistributionTestFixture, AgradDistributionsBeta_fd_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_62, AgradDistributionTestFixture, AgradDistributionsBeta_fd_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_63, AgradDistributionTestFixture, AgradDistributionsBeta_fd_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_64, AgradDistributionTestFixture, AgradDistributionsBeta_fd_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_65, AgradDistributionTestFixture, AgradDistributionsBeta_fd_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_66, AgradDistributionTestFixture, AgradDistributionsBeta_fd_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_67, AgradDistributionTestFixture, AgradDistributionsBeta_fd_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_68, AgradDistributionTestFixture, AgradDistributionsBeta_fd_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_69, AgradDistributionTestFixture, AgradDistributionsBeta_fd_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_70, AgradDistributionTestFixture, AgradDistributionsBeta_fd_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_71, AgradDistributionTestFixture, AgradDistributionsBeta_fd_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_72, AgradDistributionTestFixture, AgradDistributionsBeta_fd_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_73, AgradDistributionTestFixture, AgradDistributionsBeta_fd_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_74, AgradDistributionTestFixture, AgradDistributionsBeta_fd_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_75, AgradDistributionTestFixture, AgradDistributionsBeta_fd_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_76, AgradDistributionTestFixture, AgradDistributionsBeta_fd_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_77, AgradDistributionTestFixture, AgradDistributionsBeta_fd_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_78, AgradDistributionTestFixture, AgradDistributionsBeta_fd_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_79, AgradDistributionTestFixture, AgradDistributionsBeta_fd_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_80, AgradDistributionTestFixture, AgradDistributionsBeta_fd_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_81, AgradDistributionTestFixture, AgradDistributionsBeta_fd_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_82, AgradDistributionTestFixture, AgradDistributionsBeta_fd_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_83, AgradDistributionTestFixture, AgradDistributionsBeta_fd_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_84, AgradDistributionTestFixture, AgradDistributionsBeta_fd_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_85, AgradDistributionTestFixture, AgradDistributionsBeta_fd_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_86, AgradDistributionTestFixture, AgradDistributionsBeta_fd_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_87, AgradDistributionTestFixture, AgradDistributionsBeta_fd_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_88, AgradDistributionTestFixture, AgradDistributionsBeta_fd_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_89, AgradDistributionTestFixture, AgradDistributionsBeta_fd_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_90, AgradDistributionTestFixture, AgradDistributionsBeta_fd_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_91, AgradDistributionTestFixture, AgradDistributionsBeta_fd_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_92, AgradDistributionTestFixture, AgradDistributionsBeta_fd_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_93, AgradDistributionTestFixture, AgradDistributionsBeta_fd_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_94, AgradDistributionTestFixture, AgradDistributionsBeta_fd_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_95, AgradDistributionTestFixture, AgradDistributionsBeta_fd_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_96, AgradDistributionTestFixture, AgradDistributionsBeta_fd_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_97, AgradDistributionTestFixture, AgradDistributionsBeta_fd_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_98, AgradDistributionTestFixture, AgradDistributionsBeta_fd_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_99, AgradDistributionTestFixture, AgradDistributionsBeta_fd_99);
+
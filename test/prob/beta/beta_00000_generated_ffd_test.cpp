@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_8;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_9;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_10;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_11;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_12;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_13;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_14;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_15;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_16;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_17;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_18;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_19;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_80;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, double, empty, empty, empty> type_ffd_81;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, empty, empty, empty> type_ffd_82;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_83;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_84;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_85;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_86;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, double, empty, empty, empty> type_ffd_87;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffd_88;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_89;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_90;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_91;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_92;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_93;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_94;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_95;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_96;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_97;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_98;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_99;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_0> AgradDistributionsBeta_ffd_0;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_1> AgradDistributionsBeta_ffd_1;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_2> AgradDistributionsBeta_ffd_2;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_3> AgradDistributionsBeta_ffd_3;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_4> AgradDistributionsBeta_ffd_4;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_5> AgradDistributionsBeta_ffd_5;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_6> AgradDistributionsBeta_ffd_6;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_7> AgradDistributionsBeta_ffd_7;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_8> AgradDistributionsBeta_ffd_8;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_9> AgradDistributionsBeta_ffd_9;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_10> AgradDistributionsBeta_ffd_10;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_11> AgradDistributionsBeta_ffd_11;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_12> AgradDistributionsBeta_ffd_12;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_13> AgradDistributionsBeta_ffd_13;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_14> AgradDistributionsBeta_ffd_14;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_15> AgradDistributionsBeta_ffd_15;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_16> AgradDistributionsBeta_ffd_16;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_17> AgradDistributionsBeta_ffd_17;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_18> AgradDistributionsBeta_ffd_18;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_19> AgradDistributionsBeta_ffd_19;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_20> AgradDistributionsBeta_ffd_20;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_21> AgradDistributionsBeta_ffd_21;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_22> AgradDistributionsBeta_ffd_22;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_23> AgradDistributionsBeta_ffd_23;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_24> AgradDistributionsBeta_ffd_24;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_25> AgradDistributionsBeta_ffd_25;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_26> AgradDistributionsBeta_ffd_26;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_27> AgradDistributionsBeta_ffd_27;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_28> AgradDistributionsBeta_ffd_28;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_29> AgradDistributionsBeta_ffd_29;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_30> AgradDistributionsBeta_ffd_30;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_31> AgradDistributionsBeta_ffd_31;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_32> AgradDistributionsBeta_ffd_32;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_33> AgradDistributionsBeta_ffd_33;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_34> AgradDistributionsBeta_ffd_34;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_35> AgradDistributionsBeta_ffd_35;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_36> AgradDistributionsBeta_ffd_36;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_37> AgradDistributionsBeta_ffd_37;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_38> AgradDistributionsBeta_ffd_38;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_39> AgradDistributionsBeta_ffd_39;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_40> AgradDistributionsBeta_ffd_40;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_41> AgradDistributionsBeta_ffd_41;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_42> AgradDistributionsBeta_ffd_42;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_43> AgradDistributionsBeta_ffd_43;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_44> AgradDistributionsBeta_ffd_44;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_45> AgradDistributionsBeta_ffd_45;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_46> AgradDistributionsBeta_ffd_46;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_47> AgradDistributionsBeta_ffd_47;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_48> AgradDistributionsBeta_ffd_48;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_49> AgradDistributionsBeta_ffd_49;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_50> AgradDistributionsBeta_ffd_50;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_51> AgradDistributionsBeta_ffd_51;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_52> AgradDistributionsBeta_ffd_52;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_53> AgradDistributionsBeta_ffd_53;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_54> AgradDistributionsBeta_ffd_54;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_55> AgradDistributionsBeta_ffd_55;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_56> AgradDistributionsBeta_ffd_56;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_57> AgradDistributionsBeta_ffd_57;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_58> AgradDistributionsBeta_ffd_58;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_59> AgradDistributionsBeta_ffd_59;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_60> AgradDistributionsBeta_ffd_60;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_61> AgradDistributionsBeta_ffd_61;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_62> AgradDistributionsBeta_ffd_62;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_63> AgradDistributionsBeta_ffd_63;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_64> AgradDistributionsBeta_ffd_64;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_65> AgradDistributionsBeta_ffd_65;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_66> AgradDistributionsBeta_ffd_66;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_67> AgradDistributionsBeta_ffd_67;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_68> AgradDistributionsBeta_ffd_68;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_69> AgradDistributionsBeta_ffd_69;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_70> AgradDistributionsBeta_ffd_70;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_71> AgradDistributionsBeta_ffd_71;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_72> AgradDistributionsBeta_ffd_72;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_73> AgradDistributionsBeta_ffd_73;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_74> AgradDistributionsBeta_ffd_74;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_75> AgradDistributionsBeta_ffd_75;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_76> AgradDistributionsBeta_ffd_76;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_77> AgradDistributionsBeta_ffd_77;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_78> AgradDistributionsBeta_ffd_78;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_79> AgradDistributionsBeta_ffd_79;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_80> AgradDistributionsBeta_ffd_80;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_81> AgradDistributionsBeta_ffd_81;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_82> AgradDistributionsBeta_ffd_82;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_83> AgradDistributionsBeta_ffd_83;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_84> AgradDistributionsBeta_ffd_84;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_85> AgradDistributionsBeta_ffd_85;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_86> AgradDistributionsBeta_ffd_86;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_87> AgradDistributionsBeta_ffd_87;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_88> AgradDistributionsBeta_ffd_88;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_89> AgradDistributionsBeta_ffd_89;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_90> AgradDistributionsBeta_ffd_90;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_91> AgradDistributionsBeta_ffd_91;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_92> AgradDistributionsBeta_ffd_92;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_93> AgradDistributionsBeta_ffd_93;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_94> AgradDistributionsBeta_ffd_94;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_95> AgradDistributionsBeta_ffd_95;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_96> AgradDistributionsBeta_ffd_96;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_97> AgradDistributionsBeta_ffd_97;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_98> AgradDistributionsBeta_ffd_98;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_99> AgradDistributionsBeta_ffd_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_0, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_1, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_2, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_3, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_4, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_5, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_6, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_7, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_8, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_9, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_10, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_11, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_12, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_13, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_14, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_15, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_16, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_17, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_18, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_19, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_20, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_21, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_22, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_23, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_24, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_25, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_26, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_27, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_28, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_29, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_30, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_31, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_32, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_33, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_34, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_35, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_36, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_37, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_38, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_39, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_40, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_41, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_42, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_43, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_44, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_45, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_46, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_47, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_48, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_49, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_50, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_51, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_52, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_53, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_54, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_55, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_56, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_57, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_58, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_59, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_60, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_61, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_62, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_63, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_64, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_65, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_66, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_67, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_68, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_69, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_70, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_71, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_72, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_73, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_74, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_75, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_76, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_77, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_78, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_79, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_80, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_81, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_82, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_83, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_84, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_85, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_86, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_87, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_88, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_89, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_90, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_91, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_92, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_93, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_94, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_95, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_96, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_97, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_98, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_99, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_0> AgradDistributionsBeta_ffv_0;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_1> AgradDistributionsBeta_ffv_1;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_2> AgradDistributionsBeta_ffv_2;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_3> AgradDistributionsBeta_ffv_3;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_4> AgradDistributionsBeta_ffv_4;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_5> AgradDistributionsBeta_ffv_5;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_6> AgradDistributionsBeta_ffv_6;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_7> AgradDistributionsBeta_ffv_7;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_8> AgradDistributionsBeta_ffv_8;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_9> AgradDistributionsBeta_ffv_9;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_10> AgradDistributionsBeta_ffv_10;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_11> AgradDistributionsBeta_ffv_11;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_12> AgradDistributionsBeta_ffv_12;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_13> AgradDistributionsBeta_ffv_13;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_14> AgradDistributionsBeta_ffv_14;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_15> AgradDistributionsBeta_ffv_15;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_16> AgradDistributionsBeta_ffv_16;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_17> AgradDistributionsBeta_ffv_17;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_18> AgradDistributionsBeta_ffv_18;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_19> AgradDistributionsBeta_ffv_19;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_20> AgradDistributionsBeta_ffv_20;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_21> AgradDistributionsBeta_ffv_21;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_22> AgradDistributionsBeta_ffv_22;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_23> AgradDistributionsBeta_ffv_23;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_24> AgradDistributionsBeta_ffv_24;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_25> AgradDistributionsBeta_ffv_25;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_26> AgradDistributionsBeta_ffv_26;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_27> AgradDistributionsBeta_ffv_27;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_28> AgradDistributionsBeta_ffv_28;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_29> AgradDistributionsBeta_ffv_29;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_30> AgradDistributionsBeta_ffv_30;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_31> AgradDistributionsBeta_ffv_31;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_32> AgradDistributionsBeta_ffv_32;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_33> AgradDistributionsBeta_ffv_33;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_34> AgradDistributionsBeta_ffv_34;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_35> AgradDistributionsBeta_ffv_35;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_36> AgradDistributionsBeta_ffv_36;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_37> AgradDistributionsBeta_ffv_37;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_38> AgradDistributionsBeta_ffv_38;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_39> AgradDistributionsBeta_ffv_39;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_40> AgradDistributionsBeta_ffv_40;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_41> AgradDistributionsBeta_ffv_41;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_42> AgradDistributionsBeta_ffv_42;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_43> AgradDistributionsBeta_ffv_43;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_44> AgradDistributionsBeta_ffv_44;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_45> AgradDistributionsBeta_ffv_45;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_46> AgradDistributionsBeta_ffv_46;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_47> AgradDistributionsBeta_ffv_47;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_48> AgradDistributionsBeta_ffv_48;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_49> AgradDistributionsBeta_ffv_49;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_50> AgradDistributionsBeta_ffv_50;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_51> AgradDistributionsBeta_ffv_51;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_52> AgradDistributionsBeta_ffv_52;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_53> AgradDistributionsBeta_ffv_53;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_54> AgradDistributionsBeta_ffv_54;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_55> AgradDistributionsBeta_ffv_55;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_56> AgradDistributionsBeta_ffv_56;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_57> AgradDistributionsBeta_ffv_57;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_58> AgradDistributionsBeta_ffv_58;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_59> AgradDistributionsBeta_ffv_59;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_60> AgradDistributionsBeta_ffv_60;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_61> AgradDistributionsBeta_ffv_61;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_62> AgradDistributionsBeta_ffv_62;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_63> AgradDistributionsBeta_ffv_63;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_64> AgradDistributionsBeta_ffv_64;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_65> AgradDistributionsBeta_ffv_65;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_66> AgradDistributionsBeta_ffv_66;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_67> AgradDistributionsBeta_ffv_67;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_68> AgradDistributionsBeta_ffv_68;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_69> AgradDistributionsBeta_ffv_69;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_70> AgradDistributionsBeta_ffv_70;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_71> AgradDistributionsBeta_ffv_71;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_72> AgradDistributionsBeta_ffv_72;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_73> AgradDistributionsBeta_ffv_73;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_74> AgradDistributionsBeta_ffv_74;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_75> AgradDistributionsBeta_ffv_75;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_76> AgradDistributionsBeta_ffv_76;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_77> AgradDistributionsBeta_ffv_77;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_78> AgradDistributionsBeta_ffv_78;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_79> AgradDistributionsBeta_ffv_79;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_80> AgradDistributionsBeta_ffv_80;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_81> AgradDistributionsBeta_ffv_81;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_82> AgradDistributionsBeta_ffv_82;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_83> AgradDistributionsBeta_ffv_83;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_84> AgradDistributionsBeta_ffv_84;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_85> AgradDistributionsBeta_ffv_85;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_86> AgradDistributionsBeta_ffv_86;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_87> AgradDistributionsBeta_ffv_87;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_88> AgradDistributionsBeta_ffv_88;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_89> AgradDistributionsBeta_ffv_89;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_90> AgradDistributionsBeta_ffv_90;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_91> AgradDistributionsBeta_ffv_91;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_92> AgradDistributionsBeta_ffv_92;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_93> AgradDistributionsBeta_ffv_93;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_94> AgradDistributionsBeta_ffv_94;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_95> AgradDistributionsBeta_ffv_95;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_96> AgradDistributionsBeta_ffv_96;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_97> AgradDistributionsBeta_ffv_97;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_98> AgradDistributionsBeta_ffv_98;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_99> AgradDistributionsBeta_ffv_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_0, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_1, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_2, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_3, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_4, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_5, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_6, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_7, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_8, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_9, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_10, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_11, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_12, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_13, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_14, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_15, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_16, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_17, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_18, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_19, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_20, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_21, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_22, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_23, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_24, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_25, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_26, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_27, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_28, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_29, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_30, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_31, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_32, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_33, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_34, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_35, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_36, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_37, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_38, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_39, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_40, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_41, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_42, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_43, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_44, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_45, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_46, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_47, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_48, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_49, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_50, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_51, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_52, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_53, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_54, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_55, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_56, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_57, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_58, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_59, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_60, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_61, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_62, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_63, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_64, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_65, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_66, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_67, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_68, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_69, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_70, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_71, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_72, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_73, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_74, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_75, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_76, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_77, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_78, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_79, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_80, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_81, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_82, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_83, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_84, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_85, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_86, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_87, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_88, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_89, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_90, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_91, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_92, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_93, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_94, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_95, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_96, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_97, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_98, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_99, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_99);
+
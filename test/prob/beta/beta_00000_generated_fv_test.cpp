@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<var>, empty, empty, empty> type_fv_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_8;
+typedef boost::mpl::vector<double, fvar<var>, double, empty, empty, empty> type_fv_9;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_10;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_11;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, empty, empty, empty> type_fv_12;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_13;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_14;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_15;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_16;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_17;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_18;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_19;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, empty, empty, empty> type_fv_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, empty, empty, empty> type_fv_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty, empty, empty> type_fv_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty, empty, empty> type_fv_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_80;
+typedef boost::mpl::vector<fvar<var>, double, double, empty, empty, empty> type_fv_81;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, empty, empty, empty> type_fv_82;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_83;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, empty, empty, empty> type_fv_84;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_85;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_86;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, double, empty, empty, empty> type_fv_87;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fv_88;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_89;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_90;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_91;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_92;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_93;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_94;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_95;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_96;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_97;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_98;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, double, empty, empty, empty> type_fv_99;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_0> AgradDistributionsBeta_fv_0;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_1> AgradDistributionsBeta_fv_1;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_2> AgradDistributionsBeta_fv_2;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_3> AgradDistributionsBeta_fv_3;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_4> AgradDistributionsBeta_fv_4;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_5> AgradDistributionsBeta_fv_5;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_6> AgradDistributionsBeta_fv_6;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_7> AgradDistributionsBeta_fv_7;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_8> AgradDistributionsBeta_fv_8;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_9> AgradDistributionsBeta_fv_9;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_10> AgradDistributionsBeta_fv_10;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_11> AgradDistributionsBeta_fv_11;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_12> AgradDistributionsBeta_fv_12;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_13> AgradDistributionsBeta_fv_13;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_14> AgradDistributionsBeta_fv_14;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_15> AgradDistributionsBeta_fv_15;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_16> AgradDistributionsBeta_fv_16;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_17> AgradDistributionsBeta_fv_17;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_18> AgradDistributionsBeta_fv_18;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_19> AgradDistributionsBeta_fv_19;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_20> AgradDistributionsBeta_fv_20;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_21> AgradDistributionsBeta_fv_21;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_22> AgradDistributionsBeta_fv_22;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_23> AgradDistributionsBeta_fv_23;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_24> AgradDistributionsBeta_fv_24;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_25> AgradDistributionsBeta_fv_25;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_26> AgradDistributionsBeta_fv_26;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_27> AgradDistributionsBeta_fv_27;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_28> AgradDistributionsBeta_fv_28;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_29> AgradDistributionsBeta_fv_29;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_30> AgradDistributionsBeta_fv_30;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_31> AgradDistributionsBeta_fv_31;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_32> AgradDistributionsBeta_fv_32;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_33> AgradDistributionsBeta_fv_33;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_34> AgradDistributionsBeta_fv_34;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_35> AgradDistributionsBeta_fv_35;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_36> AgradDistributionsBeta_fv_36;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_37> AgradDistributionsBeta_fv_37;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_38> AgradDistributionsBeta_fv_38;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_39> AgradDistributionsBeta_fv_39;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_40> AgradDistributionsBeta_fv_40;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_41> AgradDistributionsBeta_fv_41;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_42> AgradDistributionsBeta_fv_42;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_43> AgradDistributionsBeta_fv_43;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_44> AgradDistributionsBeta_fv_44;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_45> AgradDistributionsBeta_fv_45;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_46> AgradDistributionsBeta_fv_46;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_47> AgradDistributionsBeta_fv_47;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_48> AgradDistributionsBeta_fv_48;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_49> AgradDistributionsBeta_fv_49;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_50> AgradDistributionsBeta_fv_50;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_51> AgradDistributionsBeta_fv_51;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_52> AgradDistributionsBeta_fv_52;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_53> AgradDistributionsBeta_fv_53;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_54> AgradDistributionsBeta_fv_54;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_55> AgradDistributionsBeta_fv_55;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_56> AgradDistributionsBeta_fv_56;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_57> AgradDistributionsBeta_fv_57;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_58> AgradDistributionsBeta_fv_58;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_59> AgradDistributionsBeta_fv_59;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_60> AgradDistributionsBeta_fv_60;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_61> AgradDistributionsBeta_fv_61;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_62> AgradDistributionsBeta_fv_62;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_63> AgradDistributionsBeta_fv_63;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_64> AgradDistributionsBeta_fv_64;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_65> AgradDistributionsBeta_fv_65;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_66> AgradDistributionsBeta_fv_66;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_67> AgradDistributionsBeta_fv_67;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_68> AgradDistributionsBeta_fv_68;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_69> AgradDistributionsBeta_fv_69;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_70> AgradDistributionsBeta_fv_70;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_71> AgradDistributionsBeta_fv_71;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_72> AgradDistributionsBeta_fv_72;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_73> AgradDistributionsBeta_fv_73;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_74> AgradDistributionsBeta_fv_74;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_75> AgradDistributionsBeta_fv_75;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_76> AgradDistributionsBeta_fv_76;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_77> AgradDistributionsBeta_fv_77;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_78> AgradDistributionsBeta_fv_78;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_79> AgradDistributionsBeta_fv_79;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_80> AgradDistributionsBeta_fv_80;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_81> AgradDistributionsBeta_fv_81;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_82> AgradDistributionsBeta_fv_82;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_83> AgradDistributionsBeta_fv_83;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_84> AgradDistributionsBeta_fv_84;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_85> AgradDistributionsBeta_fv_85;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_86> AgradDistributionsBeta_fv_86;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_87> AgradDistributionsBeta_fv_87;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_88> AgradDistributionsBeta_fv_88;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_89> AgradDistributionsBeta_fv_89;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_90> AgradDistributionsBeta_fv_90;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_91> AgradDistributionsBeta_fv_91;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_92> AgradDistributionsBeta_fv_92;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_93> AgradDistributionsBeta_fv_93;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_94> AgradDistributionsBeta_fv_94;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_95> AgradDistributionsBeta_fv_95;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_96> AgradDistributionsBeta_fv_96;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_97> AgradDistributionsBeta_fv_97;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_98> AgradDistributionsBeta_fv_98;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_99> AgradDistributionsBeta_fv_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_0, AgradDistributionTestFixture, AgradDistributionsBeta_fv_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_1, AgradDistributionTestFixture, AgradDistributionsBeta_fv_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_2, AgradDistributionTestFixture, AgradDistributionsBeta_fv_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_3, AgradDistributionTestFixture, AgradDistributionsBeta_fv_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_4, AgradDistributionTestFixture, AgradDistributionsBeta_fv_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_5, AgradDistributionTestFixture, AgradDistributionsBeta_fv_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_6, AgradDistributionTestFixture, AgradDistributionsBeta_fv_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_7, AgradDistributionTestFixture, AgradDistributionsBeta_fv_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_8, AgradDistributionTestFixture, AgradDistributionsBeta_fv_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_9, AgradDistributionTestFixture, AgradDistributionsBeta_fv_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_10, AgradDistributionTestFixture, AgradDistributionsBeta_fv_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_11, AgradDistributionTestFixture, AgradDistributionsBeta_fv_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_12, AgradDistributionTestFixture, AgradDistributionsBeta_fv_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_13, AgradDistributionTestFixture, AgradDistributionsBeta_fv_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_14, AgradDistributionTestFixture, AgradDistributionsBeta_fv_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_15, AgradDistributionTestFixture, AgradDistributionsBeta_fv_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_16, AgradDistributionTestFixture, AgradDistributionsBeta_fv_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_17, AgradDistributionTestFixture, AgradDistributionsBeta_fv_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_18, AgradDistributionTestFixture, AgradDistributionsBeta_fv_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_19, AgradDistributionTestFixture, AgradDistributionsBeta_fv_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_20, AgradDistributionTestFixture, AgradDistributionsBeta_fv_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_21, AgradDistributionTestFixture, AgradDistributionsBeta_fv_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_22, AgradDistributionTestFixture, AgradDistributionsBeta_fv_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_23, AgradDistributionTestFixture, AgradDistributionsBeta_fv_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_24, AgradDistributionTestFixture, AgradDistributionsBeta_fv_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_25, AgradDistributionTestFixture, AgradDistributionsBeta_fv_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_26, AgradDistributionTestFixture, AgradDistributionsBeta_fv_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_27, AgradDistributionTestFixture, AgradDistributionsBeta_fv_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_28, AgradDistributionTestFixture, AgradDistributionsBeta_fv_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_29, AgradDistributionTestFixture, AgradDistributionsBeta_fv_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_30, AgradDistributionTestFixture, AgradDistributionsBeta_fv_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_31, AgradDistributionTestFixture, AgradDistributionsBeta_fv_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_32, AgradDistributionTestFixture, AgradDistributionsBeta_fv_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_33, AgradDistributionTestFixture, AgradDistributionsBeta_fv_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_34, AgradDistributionTestFixture, AgradDistributionsBeta_fv_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_35, AgradDistributionTestFixture, AgradDistributionsBeta_fv_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_36, AgradDistributionTestFixture, AgradDistributionsBeta_fv_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_37, AgradDistributionTestFixture, AgradDistributionsBeta_fv_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_38, AgradDistributionTestFixture, AgradDistributionsBeta_fv_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_39, AgradDistributionTestFixture, AgradDistributionsBeta_fv_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_40, AgradDistributionTestFixture, AgradDistributionsBeta_fv_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_41, AgradDistributionTestFixture, AgradDistributionsBeta_fv_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_42, AgradDistributionTestFixture, AgradDistributionsBeta_fv_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_43, AgradDistributionTestFixture, AgradDistributionsBeta_fv_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_44, AgradDistributionTestFixture, AgradDistributionsBeta_fv_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_45, AgradDistributionTestFixture, AgradDistributionsBeta_fv_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_46, AgradDistributionTestFixture, AgradDistributionsBeta_fv_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_47, AgradDistributionTestFixture, AgradDistributionsBeta_fv_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_48, AgradDistributionTestFixture, AgradDistributionsBeta_fv_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_49, AgradDistributionTestFixture, AgradDistributionsBeta_fv_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_50, AgradDistributionTestFixture, AgradDistributionsBeta_fv_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_51, AgradDistributionTestFixture, AgradDistributionsBeta_fv_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_52, AgradDistributionTestFixture, AgradDistributionsBeta_fv_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_53, AgradDistributionTestFixture, AgradDistributionsBeta_fv_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_54, AgradDistributionTestFixture, AgradDistributionsBeta_fv_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_55, AgradDistributionTestFixture, AgradDistributionsBeta_fv_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_56, AgradDistributionTestFixture, AgradDistributionsBeta_fv_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_57, AgradDistributionTestFixture, AgradDistributionsBeta_fv_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_58, AgradDistributionTestFixture, AgradDistributionsBeta_fv_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_59, AgradDistributionTestFixture, AgradDistributionsBeta_fv_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_60, AgradDistributionTestFixture, AgradDistributionsBeta_fv_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_61, AgradDistributionTestFixture, AgradDistributionsBeta_fv_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_62, AgradDistributionTestFixture, AgradDistributionsBeta_fv_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_63, AgradDistributionTestFixture, AgradDistributionsBeta_fv_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_64, AgradDistributionTestFixture, AgradDistributionsBeta_fv_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_65, AgradDistributionTestFixture, AgradDistributionsBeta_fv_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_66, AgradDistributionTestFixture, AgradDistributionsBeta_fv_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_67, AgradDistributionTestFixture, AgradDistributionsBeta_fv_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_68, AgradDistributionTestFixture, AgradDistributionsBeta_fv_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_69, AgradDistributionTestFixture, AgradDistributionsBeta_fv_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_70, AgradDistributionTestFixture, AgradDistributionsBeta_fv_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_71, AgradDistributionTestFixture, AgradDistributionsBeta_fv_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_72, AgradDistributionTestFixture, AgradDistributionsBeta_fv_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_73, AgradDistributionTestFixture, AgradDistributionsBeta_fv_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_74, AgradDistributionTestFixture, AgradDistributionsBeta_fv_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_75, AgradDistributionTestFixture, AgradDistributionsBeta_fv_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_76, AgradDistributionTestFixture, AgradDistributionsBeta_fv_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_77, AgradDistributionTestFixture, AgradDistributionsBeta_fv_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_78, AgradDistributionTestFixture, AgradDistributionsBeta_fv_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_79, AgradDistributionTestFixture, AgradDistributionsBeta_fv_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_80, AgradDistributionTestFixture, AgradDistributionsBeta_fv_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_81, AgradDistributionTestFixture, AgradDistributionsBeta_fv_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_82, AgradDistributionTestFixture, AgradDistributionsBeta_fv_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_83, AgradDistributionTestFixture, AgradDistributionsBeta_fv_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_84, AgradDistributionTestFixture, AgradDistributionsBeta_fv_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_85, AgradDistributionTestFixture, AgradDistributionsBeta_fv_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_86, AgradDistributionTestFixture, AgradDistributionsBeta_fv_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_87, AgradDistributionTestFixture, AgradDistributionsBeta_fv_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_88, AgradDistributionTestFixture, AgradDistributionsBeta_fv_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_89, AgradDistributionTestFixture, AgradDistributionsBeta_fv_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_90, AgradDistributionTestFixture, AgradDistributionsBeta_fv_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_91, AgradDistributionTestFixture, AgradDistributionsBeta_fv_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_92, AgradDistributionTestFixture, AgradDistributionsBeta_fv_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_93, AgradDistributionTestFixture, AgradDistributionsBeta_fv_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_94, AgradDistributionTestFixture, AgradDistributionsBeta_fv_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_95, AgradDistributionTestFixture, AgradDistributionsBeta_fv_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_96, AgradDistributionTestFixture, AgradDistributionsBeta_fv_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_97, AgradDistributionTestFixture, AgradDistributionsBeta_fv_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_98, AgradDistributionTestFixture, AgradDistributionsBeta_fv_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_99, AgradDistributionTestFixture, AgradDistributionsBeta_fv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, empty, empty, empty> type_v_0;
+typedef boost::mpl::vector<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef boost::mpl::vector<double, double, var, empty, empty, empty> type_v_3;
+typedef boost::mpl::vector<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef boost::mpl::vector<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef boost::mpl::vector<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef boost::mpl::vector<double, var, double, empty, empty, empty> type_v_18;
+typedef boost::mpl::vector<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef boost::mpl::vector<double, var, var, empty, empty, empty> type_v_21;
+typedef boost::mpl::vector<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef boost::mpl::vector<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef boost::mpl::vector<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef boost::mpl::vector<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef boost::mpl::vector<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef boost::mpl::vector<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef boost::mpl::vector<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_0> AgradDistributionsBeta_v_0;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_1> AgradDistributionsBeta_v_1;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_2> AgradDistributionsBeta_v_2;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_3> AgradDistributionsBeta_v_3;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_4> AgradDistributionsBeta_v_4;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_5> AgradDistributionsBeta_v_5;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_6> AgradDistributionsBeta_v_6;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_7> AgradDistributionsBeta_v_7;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_8> AgradDistributionsBeta_v_8;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_9> AgradDistributionsBeta_v_9;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_10> AgradDistributionsBeta_v_10;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_11> AgradDistributionsBeta_v_11;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_12> AgradDistributionsBeta_v_12;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_13> AgradDistributionsBeta_v_13;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_14> AgradDistributionsBeta_v_14;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_15> AgradDistributionsBeta_v_15;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_16> AgradDistributionsBeta_v_16;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_17> AgradDistributionsBeta_v_17;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_18> AgradDistributionsBeta_v_18;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_19> AgradDistributionsBeta_v_19;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_20> AgradDistributionsBeta_v_20;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_21> AgradDistributionsBeta_v_21;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_22> AgradDistributionsBeta_v_22;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_23> AgradDistributionsBeta_v_23;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_24> AgradDistributionsBeta_v_24;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_25> AgradDistributionsBeta_v_25;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_26> AgradDistributionsBeta_v_26;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_27> AgradDistributionsBeta_v_27;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_28> AgradDistributionsBeta_v_28;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_29> AgradDistributionsBeta_v_29;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_30> AgradDistributionsBeta_v_30;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_31> AgradDistributionsBeta_v_31;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_32> AgradDistributionsBeta_v_32;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_33> AgradDistributionsBeta_v_33;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_34> AgradDistributionsBeta_v_34;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_35> AgradDistributionsBeta_v_35;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_36> AgradDistributionsBeta_v_36;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_37> AgradDistributionsBeta_v_37;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_38> AgradDistributionsBeta_v_38;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_39> AgradDistributionsBeta_v_39;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_40> AgradDistributionsBeta_v_40;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_41> AgradDistributionsBeta_v_41;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_42> AgradDistributionsBeta_v_42;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_43> AgradDistributionsBeta_v_43;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_44> AgradDistributionsBeta_v_44;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_45> AgradDistributionsBeta_v_45;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_46> AgradDistributionsBeta_v_46;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_47> AgradDistributionsBeta_v_47;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_48> AgradDistributionsBeta_v_48;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_49> AgradDistributionsBeta_v_49;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_50> AgradDistributionsBeta_v_50;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_51> AgradDistributionsBeta_v_51;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_52> AgradDistributionsBeta_v_52;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_53> AgradDistributionsBeta_v_53;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_54> AgradDistributionsBeta_v_54;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_55> AgradDistributionsBeta_v_55;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_56> AgradDistributionsBeta_v_56;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_57> AgradDistributionsBeta_v_57;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_58> AgradDistributionsBeta_v_58;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_59> AgradDistributionsBeta_v_59;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_60> AgradDistributionsBeta_v_60;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_61> AgradDistributionsBeta_v_61;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_62> AgradDistributionsBeta_v_62;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_63> AgradDistributionsBeta_v_63;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_64> AgradDistributionsBeta_v_64;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_65> AgradDistributionsBeta_v_65;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_66> AgradDistributionsBeta_v_66;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_67> AgradDistributionsBeta_v_67;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_68> AgradDistributionsBeta_v_68;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_69> AgradDistributionsBeta_v_69;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_70> AgradDistributionsBeta_v_70;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_71> AgradDistributionsBeta_v_71;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_72> AgradDistributionsBeta_v_72;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_73> AgradDistributionsBeta_v_73;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_74> AgradDistributionsBeta_v_74;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_75> AgradDistributionsBeta_v_75;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_76> AgradDistributionsBeta_v_76;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_77> AgradDistributionsBeta_v_77;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_78> AgradDistributionsBeta_v_78;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_79> AgradDistributionsBeta_v_79;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_80> AgradDistributionsBeta_v_80;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_81> AgradDistributionsBeta_v_81;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_82> AgradDistributionsBeta_v_82;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_83> AgradDistributionsBeta_v_83;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_84> AgradDistributionsBeta_v_84;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_85> AgradDistributionsBeta_v_85;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_86> AgradDistributionsBeta_v_86;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_87> AgradDistributionsBeta_v_87;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_88> AgradDistributionsBeta_v_88;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_89> AgradDistributionsBeta_v_89;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_90> AgradDistributionsBeta_v_90;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_91> AgradDistributionsBeta_v_91;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_92> AgradDistributionsBeta_v_92;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_93> AgradDistributionsBeta_v_93;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_94> AgradDistributionsBeta_v_94;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_95> AgradDistributionsBeta_v_95;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_96> AgradDistributionsBeta_v_96;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_97> AgradDistributionsBeta_v_97;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_98> AgradDistributionsBeta_v_98;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_99> AgradDistributionsBeta_v_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_0, AgradDistributionTestFixture, AgradDistributionsBeta_v_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_1, AgradDistributionTestFixture, AgradDistributionsBeta_v_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_2, AgradDistributionTestFixture, AgradDistributionsBeta_v_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_3, AgradDistributionTestFixture, AgradDistributionsBeta_v_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_4, AgradDistributionTestFixture, AgradDistributionsBeta_v_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_5, AgradDistributionTestFixture, AgradDistributionsBeta_v_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_6, AgradDistributionTestFixture, AgradDistributionsBeta_v_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_7, AgradDistributionTestFixture, AgradDistributionsBeta_v_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_8, AgradDistributionTestFixture, AgradDistributionsBeta_v_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_9, AgradDistributionTestFixture, AgradDistributionsBeta_v_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_10, AgradDistributionTestFixture, AgradDistributionsBeta_v_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_11, AgradDistributionTestFixture, AgradDistributionsBeta_v_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_12, AgradDistributionTestFixture, AgradDistributionsBeta_v_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_13, AgradDistributionTestFixture, AgradDistributionsBeta_v_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_14, AgradDistributionTestFixture, AgradDistributionsBeta_v_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_15, AgradDistributionTestFixture, AgradDistributionsBeta_v_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_16, AgradDistributionTestFixture, AgradDistributionsBeta_v_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_17, AgradDistributionTestFixture, AgradDistributionsBeta_v_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_18, AgradDistributionTestFixture, AgradDistributionsBeta_v_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_19, AgradDistributionTestFixture, AgradDistributionsBeta_v_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_20, AgradDistributionTestFixture, AgradDistributionsBeta_v_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_21, AgradDistributionTestFixture, AgradDistributionsBeta_v_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_22, AgradDistributionTestFixture, AgradDistributionsBeta_v_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_23, AgradDistributionTestFixture, AgradDistributionsBeta_v_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_24, AgradDistributionTestFixture, AgradDistributionsBeta_v_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_25, AgradDistributionTestFixture, AgradDistributionsBeta_v_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_26, AgradDistributionTestFixture, AgradDistributionsBeta_v_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_27, AgradDistributionTestFixture, AgradDistributionsBeta_v_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_28, AgradDistributionTestFixture, AgradDistributionsBeta_v_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_29, AgradDistributionTestFixture, AgradDistributionsBeta_v_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_30, AgradDistributionTestFixture, AgradDistributionsBeta_v_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_31, AgradDistributionTestFixture, AgradDistributionsBeta_v_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_32, AgradDistributionTestFixture, AgradDistributionsBeta_v_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_33, AgradDistributionTestFixture, AgradDistributionsBeta_v_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_34, AgradDistributionTestFixture, AgradDistributionsBeta_v_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_35, AgradDistributionTestFixture, AgradDistributionsBeta_v_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_36, AgradDistributionTestFixture, AgradDistributionsBeta_v_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_37, AgradDistributionTestFixture, AgradDistributionsBeta_v_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_38, AgradDistributionTestFixture, AgradDistributionsBeta_v_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_39, AgradDistributionTestFixture, AgradDistributionsBeta_v_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_40, AgradDistributionTestFixture, AgradDistributionsBeta_v_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_41, AgradDistributionTestFixture, AgradDistributionsBeta_v_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_42, AgradDistributionTestFixture, AgradDistributionsBeta_v_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_43, AgradDistributionTestFixture, AgradDistributionsBeta_v_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_44, AgradDistributionTestFixture, AgradDistributionsBeta_v_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_45, AgradDistributionTestFixture, AgradDistributionsBeta_v_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_46, AgradDistributionTestFixture, AgradDistributionsBeta_v_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_47, AgradDistributionTestFixture, AgradDistributionsBeta_v_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_48, AgradDistributionTestFixture, AgradDistributionsBeta_v_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_49, AgradDistributionTestFixture, AgradDistributionsBeta_v_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_50, AgradDistributionTestFixture, AgradDistributionsBeta_v_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_51, AgradDistributionTestFixture, AgradDistributionsBeta_v_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_52, AgradDistributionTestFixture, AgradDistributionsBeta_v_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_53, AgradDistributionTestFixture, AgradDistributionsBeta_v_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_54, AgradDistributionTestFixture, AgradDistributionsBeta_v_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_55, AgradDistributionTestFixture, AgradDistributionsBeta_v_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_56, AgradDistributionTestFixture, AgradDistributionsBeta_v_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_57, AgradDistributionTestFixture, AgradDistributionsBeta_v_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_58, AgradDistributionTestFixture, AgradDistributionsBeta_v_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_59, AgradDistributionTestFixture, AgradDistributionsBeta_v_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_60, AgradDistributionTestFixture, AgradDistributionsBeta_v_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_61, AgradDistributionTestFixture, AgradDistributionsBeta_v_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_62, AgradDistributionTestFixture, AgradDistributionsBeta_v_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_63, AgradDistributionTestFixture, AgradDistributionsBeta_v_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_64, AgradDistributionTestFixture, AgradDistributionsBeta_v_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_65, AgradDistributionTestFixture, AgradDistributionsBeta_v_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_66, AgradDistributionTestFixture, AgradDistributionsBeta_v_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_67, AgradDistributionTestFixture, AgradDistributionsBeta_v_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_68, AgradDistributionTestFixture, AgradDistributionsBeta_v_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_69, AgradDistributionTestFixture, AgradDistributionsBeta_v_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_70, AgradDistributionTestFixture, AgradDistributionsBeta_v_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_71, AgradDistributionTestFixture, AgradDistributionsBeta_v_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_72, AgradDistributionTestFixture, AgradDistributionsBeta_v_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_73, AgradDistributionTestFixture, AgradDistributionsBeta_v_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_74, AgradDistributionTestFixture, AgradDistributionsBeta_v_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_75, AgradDistributionTestFixture, AgradDistributionsBeta_v_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_76, AgradDistributionTestFixture, AgradDistributionsBeta_v_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_77, AgradDistributionTestFixture, AgradDistributionsBeta_v_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_78, AgradDistributionTestFixture, AgradDistributionsBeta_v_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_79, AgradDistributionTestFixture, AgradDistributionsBeta_v_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_80, AgradDistributionTestFixture, AgradDistributionsBeta_v_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_81, AgradDistributionTestFixture, AgradDistributionsBeta_v_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_82, AgradDistributionTestFixture, AgradDistributionsBeta_v_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_83, AgradDistributionTestFixture, AgradDistributionsBeta_v_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_84, AgradDistributionTestFixture, AgradDistributionsBeta_v_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_85, AgradDistributionTestFixture, AgradDistributionsBeta_v_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_86, AgradDistributionTestFixture, AgradDistributionsBeta_v_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_87, AgradDistributionTestFixture, AgradDistributionsBeta_v_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_88, AgradDistributionTestFixture, AgradDistributionsBeta_v_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_89, AgradDistributionTestFixture, AgradDistributionsBeta_v_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_90, AgradDistributionTestFixture, AgradDistributionsBeta_v_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_91, AgradDistributionTestFixture, AgradDistributionsBeta_v_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_92, AgradDistributionTestFixture, AgradDistributionsBeta_v_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_93, AgradDistributionTestFixture, AgradDistributionsBeta_v_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_94, AgradDistributionTestFixture, AgradDistributionsBeta_v_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_95, AgradDistributionTestFixture, AgradDistributionsBeta_v_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_96, AgradDistributionTestFixture, AgradDistributionsBeta_v_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_97, AgradDistributionTestFixture, AgradDistributionsBeta_v_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_98, AgradDistributionTestFixture, AgradDistributionsBeta_v_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_99, AgradDistributionTestFixture, AgradDistributionsBeta_v_99);
+
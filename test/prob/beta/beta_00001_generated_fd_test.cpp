@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<fvar<double>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_100;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_101;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_102;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_103;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_104;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_105;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_106;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_107;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_108;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_109;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_110;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_111;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_112;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_113;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_114;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_115;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_116;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, empty, empty, empty> type_fd_117;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, empty, empty, empty> type_fd_118;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_119;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, fvar<double>, empty, empty, empty> type_fd_120;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_121;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_122;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, empty, empty, empty> type_fd_123;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fd_124;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_125;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_126;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_127;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_128;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_129;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_130;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_131;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_132;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_133;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_134;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, double, empty, empty, empty> type_fd_135;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_136;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_137;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_138;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_139;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_140;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_141;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_142;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_143;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_144;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_145;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_146;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_147;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_148;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_149;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_150;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_151;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_fd_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_fd_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty, empty, empty> type_fd_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_fd_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fd_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty, empty, empty> type_fd_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_188;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_100> AgradDistributionsBeta_fd_100;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_101> AgradDistributionsBeta_fd_101;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_102> AgradDistributionsBeta_fd_102;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_103> AgradDistributionsBeta_fd_103;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_104> AgradDistributionsBeta_fd_104;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_105> AgradDistributionsBeta_fd_105;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_106> AgradDistributionsBeta_fd_106;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_107> AgradDistributionsBeta_fd_107;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_108> AgradDistributionsBeta_fd_108;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_109> AgradDistributionsBeta_fd_109;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_110> AgradDistributionsBeta_fd_110;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_111> AgradDistributionsBeta_fd_111;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_112> AgradDistributionsBeta_fd_112;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_113> AgradDistributionsBeta_fd_113;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_114> AgradDistributionsBeta_fd_114;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_115> AgradDistributionsBeta_fd_115;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_116> AgradDistributionsBeta_fd_116;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_117> AgradDistributionsBeta_fd_117;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_118> AgradDistributionsBeta_fd_118;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_119> AgradDistributionsBeta_fd_119;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_120> AgradDistributionsBeta_fd_120;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_121> AgradDistributionsBeta_fd_121;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_122> AgradDistributionsBeta_fd_122;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_123> AgradDistributionsBeta_fd_123;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_124> AgradDistributionsBeta_fd_124;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_125> AgradDistributionsBeta_fd_125;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_126> AgradDistributionsBeta_fd_126;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_127> AgradDistributionsBeta_fd_127;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_128> AgradDistributionsBeta_fd_128;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_129> AgradDistributionsBeta_fd_129;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_130> AgradDistributionsBeta_fd_130;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_131> AgradDistributionsBeta_fd_131;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_132> AgradDistributionsBeta_fd_132;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_133> AgradDistributionsBeta_fd_133;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_134> AgradDistributionsBeta_fd_134;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_135> AgradDistributionsBeta_fd_135;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_136> AgradDistributionsBeta_fd_136;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_137> AgradDistributionsBeta_fd_137;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_138> AgradDistributionsBeta_fd_138;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_139> AgradDistributionsBeta_fd_139;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_140> AgradDistributionsBeta_fd_140;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_141> AgradDistributionsBeta_fd_141;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_142> AgradDistributionsBeta_fd_142;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_143> AgradDistributionsBeta_fd_143;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_144> AgradDistributionsBeta_fd_144;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_145> AgradDistributionsBeta_fd_145;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_146> AgradDistributionsBeta_fd_146;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_147> AgradDistributionsBeta_fd_147;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_148> AgradDistributionsBeta_fd_148;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_149> AgradDistributionsBeta_fd_149;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_150> AgradDistributionsBeta_fd_150;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_151> AgradDistributionsBeta_fd_151;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_152> AgradDistributionsBeta_fd_152;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_153> AgradDistributionsBeta_fd_153;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_154> AgradDistributionsBeta_fd_154;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_155> AgradDistributionsBeta_fd_155;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_156> AgradDistributionsBeta_fd_156;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_157> AgradDistributionsBeta_fd_157;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_158> AgradDistributionsBeta_fd_158;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_159> AgradDistributionsBeta_fd_159;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_160> AgradDistributionsBeta_fd_160;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_161> AgradDistributionsBeta_fd_161;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_162> AgradDistributionsBeta_fd_162;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_163> AgradDistributionsBeta_fd_163;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_164> AgradDistributionsBeta_fd_164;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_165> AgradDistributionsBeta_fd_165;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_166> AgradDistributionsBeta_fd_166;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_167> AgradDistributionsBeta_fd_167;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_168> AgradDistributionsBeta_fd_168;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_169> AgradDistributionsBeta_fd_169;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_170> AgradDistributionsBeta_fd_170;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_171> AgradDistributionsBeta_fd_171;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_172> AgradDistributionsBeta_fd_172;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_173> AgradDistributionsBeta_fd_173;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_174> AgradDistributionsBeta_fd_174;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_175> AgradDistributionsBeta_fd_175;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_176> AgradDistributionsBeta_fd_176;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_177> AgradDistributionsBeta_fd_177;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_178> AgradDistributionsBeta_fd_178;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_179> AgradDistributionsBeta_fd_179;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_180> AgradDistributionsBeta_fd_180;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_181> AgradDistributionsBeta_fd_181;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_182> AgradDistributionsBeta_fd_182;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_183> AgradDistributionsBeta_fd_183;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_184> AgradDistributionsBeta_fd_184;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_185> AgradDistributionsBeta_fd_185;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_186> AgradDistributionsBeta_fd_186;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_187> AgradDistributionsBeta_fd_187;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fd_188> AgradDistributionsBeta_fd_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_100, AgradDistributionTestFixture, AgradDistributionsBeta_fd_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_101, AgradDistributionTestFixture, AgradDistributionsBeta_fd_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_102, AgradDistributionTestFixture, AgradDistributionsBeta_fd_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_103, AgradDistributionTestFixture, AgradDistributionsBeta_fd_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_104, AgradDistributionTestFixture, AgradDistributionsBeta_fd_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_105, AgradDistributionTestFixture, AgradDistributionsBeta_fd_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_106, AgradDistributionTestFixture, AgradDistributionsBeta_fd_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_107, AgradDistributionTestFixture, AgradDistributionsBeta_fd_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_108, AgradDistributionTestFixture, AgradDistributionsBeta_fd_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_109, AgradDistributionTestFixture, AgradDistributionsBeta_fd_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_110, AgradDistributionTestFixture, AgradDistributionsBeta_fd_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_111, AgradDistributionTestFixture, AgradDistributionsBeta_fd_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_112, AgradDistributionTestFixture, AgradDistributionsBeta_fd_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_113, AgradDistributionTestFixture, AgradDistributionsBeta_fd_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_114, AgradDistributionTestFixture, AgradDistributionsBeta_fd_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_115, AgradDistributionTestFixture, AgradDistributionsBeta_fd_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_116, AgradDistributionTestFixture, AgradDistributionsBeta_fd_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_117, AgradDistributionTestFixture, AgradDistributionsBeta_fd_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_118, AgradDistributionTestFixture, AgradDistributionsBeta_fd_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_119, AgradDistributionTestFixture, AgradDistributionsBeta_fd_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_120, AgradDistributionTestFixture, AgradDistributionsBeta_fd_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_121, AgradDistributionTestFixture, AgradDistributionsBeta_fd_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_122, AgradDistributionTestFixture, AgradDistributionsBeta_fd_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_123, AgradDistributionTestFixture, AgradDistributionsBeta_fd_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_124, AgradDistributionTestFixture, AgradDistributionsBeta_fd_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_125, AgradDistributionTestFixture, AgradDistributionsBeta_fd_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_126, AgradDistributionTestFixture, AgradDistributionsBeta_fd_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_127, AgradDistributionTestFixture, AgradDistributionsBeta_fd_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_128, AgradDistributionTestFixture, AgradDistributionsBeta_fd_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_129, AgradDistributionTestFixture, AgradDistributionsBeta_fd_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_130, AgradDistributionTestFixture, AgradDistributionsBeta_fd_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_131, AgradDistributionTestFixture, AgradDistributionsBeta_fd_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_132, AgradDistributionTestFixture, AgradDistributionsBeta_fd_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_133, AgradDistributionTestFixture, AgradDistributionsBeta_fd_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_134, AgradDistributionTestFixture, AgradDistributionsBeta_fd_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_135, AgradDistributionTestFixture, AgradDistributionsBeta_fd_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_136, AgradDistributionTestFixture, AgradDistributionsBeta_fd_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_137, AgradDistributionTestFixture, AgradDistributionsBeta_fd_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_138, AgradDistributionTestFixture, AgradDistributionsBeta_fd_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_139, AgradDistributionTestFixture, AgradDistributionsBeta_fd_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_140, AgradDistributionTestFixture, AgradDistributionsBeta_fd_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_141, AgradDistributionTestFixture, AgradDistributionsBeta_fd_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_142, AgradDistributionTestFixture, AgradDistributionsBeta_fd_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_143, AgradDistributionTestFixture, AgradDistributionsBeta_fd_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_144, AgradDistributionTestFixture, AgradDistributionsBeta_fd_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_145, AgradDistributionTestFixture, AgradDistributionsBeta_fd_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_146, AgradDistributionTestFixture, AgradDistributionsBeta_fd_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_147, AgradDistributionTestFixture, AgradDistributionsBeta_fd_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_148, AgradDistributionTestFixture, AgradDistributionsBeta_fd_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_149, AgradDistributionTestFixture, AgradDistributionsBeta_fd_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_150, AgradDistributionTestFixture, AgradDistributionsBeta_fd_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_151, AgradDistributionTestFixture, AgradDistributionsBeta_fd_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_152, AgradDistributionTestFixture, AgradDistributionsBeta_fd_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_153, AgradDistributionTestFixture, AgradDistributionsBeta_fd_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_154, AgradDistributionTestFixture, AgradDistributionsBeta_fd_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_155, AgradDistributionTestFixture, AgradDistributionsBeta_fd_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_156, AgradDistributionTestFixture, AgradDistributionsBeta_fd_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_157, AgradDistributionTestFixture, AgradDistributionsBeta_fd_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_158, AgradDistributionTestFixture, AgradDistributionsBeta_fd_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_159, AgradDistributionTestFixture, AgradDistributionsBeta_fd_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_160, AgradDistributionTestFixture, AgradDistributionsBeta_fd_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_161, AgradDistributionTestFixture, AgradDistributionsBeta_fd_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_162, AgradDistributionTestFixture, AgradDistributionsBeta_fd_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_163, AgradDistributionTestFixture, AgradDistributionsBeta_fd_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_164, AgradDistributionTestFixture, AgradDistributionsBeta_fd_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_165, AgradDistributionTestFixture, AgradDistributionsBeta_fd_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_166, AgradDistributionTestFixture, AgradDistributionsBeta_fd_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_167, AgradDistributionTestFixture, AgradDistributionsBeta_fd_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_168, AgradDistributionTestFixture, AgradDistributionsBeta_fd_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_169, AgradDistributionTestFixture, AgradDistributionsBeta_fd_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_170, AgradDistributionTestFixture, AgradDistributionsBeta_fd_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_171, AgradDistributionTestFixture, AgradDistributionsBeta_fd_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_172, AgradDistributionTestFixture, AgradDistributionsBeta_fd_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_173, AgradDistributionTestFixture, AgradDistributionsBeta_fd_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_174, AgradDistributionTestFixture, AgradDistributionsBeta_fd_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_175, AgradDistributionTestFixture, AgradDistributionsBeta_fd_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_176, AgradDistributionTestFixture, AgradDistributionsBeta_fd_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_177, AgradDistributionTestFixture, AgradDistributionsBeta_fd_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_178, AgradDistributionTestFixture, AgradDistributionsBeta_fd_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_179, AgradDistributionTestFixture, AgradDistributionsBeta_fd_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_180, AgradDistributionTestFixture, AgradDistributionsBeta_fd_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_181, AgradDistributionTestFixture, AgradDistributionsBeta_fd_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_182, AgradDistributionTestFixture, AgradDistributionsBeta_fd_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_183, AgradDistributionTestFixture, AgradDistributionsBeta_fd_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_184, AgradDistributionTestFixture, AgradDistributionsBeta_fd_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_185, AgradDistributionTestFixture, AgradDistributionsBeta_fd_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_186, AgradDistributionTestFixture, AgradDistributionsBeta_fd_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_187, AgradDistributionTestFixture, AgradDistributionsBeta_fd_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fd_188, AgradDistributionTestFixture, AgradDistributionsBeta_fd_188);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_100;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_101;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_102;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_103;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_104;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_105;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_106;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_107;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_108;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_109;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_110;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_111;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_112;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_113;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_114;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_115;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_116;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, double, empty, empty, empty> type_ffd_117;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty, empty, empty> type_ffd_118;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_119;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_120;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_121;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_122;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty, empty, empty> type_ffd_123;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffd_124;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_125;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_126;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_127;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_128;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_129;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_130;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_131;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_132;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_133;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_134;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_135;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_136;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_137;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_138;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_139;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_140;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_141;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_142;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_143;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_144;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_145;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_146;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_147;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_148;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_149;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_150;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_151;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffd_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffd_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffd_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffd_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_188;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_100> AgradDistributionsBeta_ffd_100;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_101> AgradDistributionsBeta_ffd_101;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_102> AgradDistributionsBeta_ffd_102;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_103> AgradDistributionsBeta_ffd_103;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_104> AgradDistributionsBeta_ffd_104;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_105> AgradDistributionsBeta_ffd_105;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_106> AgradDistributionsBeta_ffd_106;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_107> AgradDistributionsBeta_ffd_107;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_108> AgradDistributionsBeta_ffd_108;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_109> AgradDistributionsBeta_ffd_109;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_110> AgradDistributionsBeta_ffd_110;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_111> AgradDistributionsBeta_ffd_111;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_112> AgradDistributionsBeta_ffd_112;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_113> AgradDistributionsBeta_ffd_113;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_114> AgradDistributionsBeta_ffd_114;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_115> AgradDistributionsBeta_ffd_115;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_116> AgradDistributionsBeta_ffd_116;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_117> AgradDistributionsBeta_ffd_117;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_118> AgradDistributionsBeta_ffd_118;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_119> AgradDistributionsBeta_ffd_119;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_120> AgradDistributionsBeta_ffd_120;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_121> AgradDistributionsBeta_ffd_121;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_122> AgradDistributionsBeta_ffd_122;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_123> AgradDistributionsBeta_ffd_123;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_124> AgradDistributionsBeta_ffd_124;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_125> AgradDistributionsBeta_ffd_125;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_126> AgradDistributionsBeta_ffd_126;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_127> AgradDistributionsBeta_ffd_127;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_128> AgradDistributionsBeta_ffd_128;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_129> AgradDistributionsBeta_ffd_129;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_130> AgradDistributionsBeta_ffd_130;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_131> AgradDistributionsBeta_ffd_131;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_132> AgradDistributionsBeta_ffd_132;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_133> AgradDistributionsBeta_ffd_133;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_134> AgradDistributionsBeta_ffd_134;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_135> AgradDistributionsBeta_ffd_135;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_136> AgradDistributionsBeta_ffd_136;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_137> AgradDistributionsBeta_ffd_137;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_138> AgradDistributionsBeta_ffd_138;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_139> AgradDistributionsBeta_ffd_139;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_140> AgradDistributionsBeta_ffd_140;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_141> AgradDistributionsBeta_ffd_141;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_142> AgradDistributionsBeta_ffd_142;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_143> AgradDistributionsBeta_ffd_143;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_144> AgradDistributionsBeta_ffd_144;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_145> AgradDistributionsBeta_ffd_145;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_146> AgradDistributionsBeta_ffd_146;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_147> AgradDistributionsBeta_ffd_147;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_148> AgradDistributionsBeta_ffd_148;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_149> AgradDistributionsBeta_ffd_149;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_150> AgradDistributionsBeta_ffd_150;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_151> AgradDistributionsBeta_ffd_151;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_152> AgradDistributionsBeta_ffd_152;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_153> AgradDistributionsBeta_ffd_153;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_154> AgradDistributionsBeta_ffd_154;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_155> AgradDistributionsBeta_ffd_155;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_156> AgradDistributionsBeta_ffd_156;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_157> AgradDistributionsBeta_ffd_157;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_158> AgradDistributionsBeta_ffd_158;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_159> AgradDistributionsBeta_ffd_159;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_160> AgradDistributionsBeta_ffd_160;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_161> AgradDistributionsBeta_ffd_161;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_162> AgradDistributionsBeta_ffd_162;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_163> AgradDistributionsBeta_ffd_163;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_164> AgradDistributionsBeta_ffd_164;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_165> AgradDistributionsBeta_ffd_165;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_166> AgradDistributionsBeta_ffd_166;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_167> AgradDistributionsBeta_ffd_167;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_168> AgradDistributionsBeta_ffd_168;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_169> AgradDistributionsBeta_ffd_169;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_170> AgradDistributionsBeta_ffd_170;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_171> AgradDistributionsBeta_ffd_171;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_172> AgradDistributionsBeta_ffd_172;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_173> AgradDistributionsBeta_ffd_173;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_174> AgradDistributionsBeta_ffd_174;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_175> AgradDistributionsBeta_ffd_175;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_176> AgradDistributionsBeta_ffd_176;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_177> AgradDistributionsBeta_ffd_177;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_178> AgradDistributionsBeta_ffd_178;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_179> AgradDistributionsBeta_ffd_179;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_180> AgradDistributionsBeta_ffd_180;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_181> AgradDistributionsBeta_ffd_181;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_182> AgradDistributionsBeta_ffd_182;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_183> AgradDistributionsBeta_ffd_183;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_184> AgradDistributionsBeta_ffd_184;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_185> AgradDistributionsBeta_ffd_185;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_186> AgradDistributionsBeta_ffd_186;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_187> AgradDistributionsBeta_ffd_187;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffd_188> AgradDistributionsBeta_ffd_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_100, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_101, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_102, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_103, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_104, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_105, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_106, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_107, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_108, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_109, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_110, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_111, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_112, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_113, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_114, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_115, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_116, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_117, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_118, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_119, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_120, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_121, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_122, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_123, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_124, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_125, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_126, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_127, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_128, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_129, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_130, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_131, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_132, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_133, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_134, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_135, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_136, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_137, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_138, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_139, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_140, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_141, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_142, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_143, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_144, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_145, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_146, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_147, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_148, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_149, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_150, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_151, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_152, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_153, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_154, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_155, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_156, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_157, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_158, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_159, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_160, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_161, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_162, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_163, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_164, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_165, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_166, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_167, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_168, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_169, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_170, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_171, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_172, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_173, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_174, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_175, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_176, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_177, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_178, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_179, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_180, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_181, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_182, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_183, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_184, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_185, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_186, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_187, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffd_188, AgradDistributionTestFixture, AgradDistributionsBeta_ffd_188);
+
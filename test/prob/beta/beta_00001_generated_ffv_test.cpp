@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_100> AgradDistributionsBeta_ffv_100;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_101> AgradDistributionsBeta_ffv_101;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_102> AgradDistributionsBeta_ffv_102;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_103> AgradDistributionsBeta_ffv_103;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_104> AgradDistributionsBeta_ffv_104;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_105> AgradDistributionsBeta_ffv_105;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_106> AgradDistributionsBeta_ffv_106;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_107> AgradDistributionsBeta_ffv_107;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_108> AgradDistributionsBeta_ffv_108;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_109> AgradDistributionsBeta_ffv_109;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_110> AgradDistributionsBeta_ffv_110;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_111> AgradDistributionsBeta_ffv_111;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_112> AgradDistributionsBeta_ffv_112;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_113> AgradDistributionsBeta_ffv_113;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_114> AgradDistributionsBeta_ffv_114;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_115> AgradDistributionsBeta_ffv_115;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_116> AgradDistributionsBeta_ffv_116;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_117> AgradDistributionsBeta_ffv_117;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_118> AgradDistributionsBeta_ffv_118;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_119> AgradDistributionsBeta_ffv_119;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_120> AgradDistributionsBeta_ffv_120;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_121> AgradDistributionsBeta_ffv_121;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_122> AgradDistributionsBeta_ffv_122;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_123> AgradDistributionsBeta_ffv_123;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_124> AgradDistributionsBeta_ffv_124;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_125> AgradDistributionsBeta_ffv_125;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_126> AgradDistributionsBeta_ffv_126;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_127> AgradDistributionsBeta_ffv_127;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_128> AgradDistributionsBeta_ffv_128;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_129> AgradDistributionsBeta_ffv_129;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_130> AgradDistributionsBeta_ffv_130;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_131> AgradDistributionsBeta_ffv_131;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_132> AgradDistributionsBeta_ffv_132;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_133> AgradDistributionsBeta_ffv_133;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_134> AgradDistributionsBeta_ffv_134;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_135> AgradDistributionsBeta_ffv_135;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_136> AgradDistributionsBeta_ffv_136;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_137> AgradDistributionsBeta_ffv_137;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_138> AgradDistributionsBeta_ffv_138;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_139> AgradDistributionsBeta_ffv_139;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_140> AgradDistributionsBeta_ffv_140;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_141> AgradDistributionsBeta_ffv_141;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_142> AgradDistributionsBeta_ffv_142;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_143> AgradDistributionsBeta_ffv_143;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_144> AgradDistributionsBeta_ffv_144;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_145> AgradDistributionsBeta_ffv_145;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_146> AgradDistributionsBeta_ffv_146;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_147> AgradDistributionsBeta_ffv_147;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_148> AgradDistributionsBeta_ffv_148;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_149> AgradDistributionsBeta_ffv_149;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_150> AgradDistributionsBeta_ffv_150;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_151> AgradDistributionsBeta_ffv_151;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_152> AgradDistributionsBeta_ffv_152;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_153> AgradDistributionsBeta_ffv_153;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_154> AgradDistributionsBeta_ffv_154;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_155> AgradDistributionsBeta_ffv_155;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_156> AgradDistributionsBeta_ffv_156;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_157> AgradDistributionsBeta_ffv_157;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_158> AgradDistributionsBeta_ffv_158;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_159> AgradDistributionsBeta_ffv_159;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_160> AgradDistributionsBeta_ffv_160;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_161> AgradDistributionsBeta_ffv_161;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_162> AgradDistributionsBeta_ffv_162;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_163> AgradDistributionsBeta_ffv_163;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_164> AgradDistributionsBeta_ffv_164;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_165> AgradDistributionsBeta_ffv_165;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_166> AgradDistributionsBeta_ffv_166;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_167> AgradDistributionsBeta_ffv_167;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_168> AgradDistributionsBeta_ffv_168;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_169> AgradDistributionsBeta_ffv_169;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_170> AgradDistributionsBeta_ffv_170;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_171> AgradDistributionsBeta_ffv_171;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_172> AgradDistributionsBeta_ffv_172;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_173> AgradDistributionsBeta_ffv_173;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_174> AgradDistributionsBeta_ffv_174;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_175> AgradDistributionsBeta_ffv_175;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_176> AgradDistributionsBeta_ffv_176;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_177> AgradDistributionsBeta_ffv_177;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_178> AgradDistributionsBeta_ffv_178;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_179> AgradDistributionsBeta_ffv_179;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_180> AgradDistributionsBeta_ffv_180;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_181> AgradDistributionsBeta_ffv_181;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_182> AgradDistributionsBeta_ffv_182;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_183> AgradDistributionsBeta_ffv_183;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_184> AgradDistributionsBeta_ffv_184;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_185> AgradDistributionsBeta_ffv_185;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_186> AgradDistributionsBeta_ffv_186;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_187> AgradDistributionsBeta_ffv_187;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_ffv_188> AgradDistributionsBeta_ffv_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_100, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_101, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_102, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_103, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_104, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_105, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_106, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_107, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_108, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_109, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_110, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_111, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_112, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_113, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_114, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_115, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_116, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_117, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_118, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_119, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_120, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_121, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_122, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_123, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_124, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_125, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_126, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_127, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_128, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_129, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_130, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_131, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_132, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_133, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_134, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_135, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_136, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_137, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_138, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_139, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_140, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_141, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_142, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_143, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_144, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_145, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_146, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_147, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_148, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_149, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_150, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_151, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_152, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_153, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_154, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_155, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_156, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_157, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_158, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_159, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_160, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_161, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_162, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_163, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_164, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_165, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_166, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_167, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_168, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_169, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_170, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_171, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_172, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_173, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_174, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_175, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_176, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_177, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_178, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_179, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_180, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_181, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_182, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_183, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_184, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_185, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_186, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_187, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_ffv_188, AgradDistributionTestFixture, AgradDistributionsBeta_ffv_188);
+
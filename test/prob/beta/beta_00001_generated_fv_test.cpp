@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_100;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_101;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_102;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_103;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_104;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_105;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_106;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_107;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_108;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_109;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_110;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_111;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_112;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_113;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_114;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_115;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_116;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, empty, empty, empty> type_fv_117;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, empty, empty, empty> type_fv_118;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_119;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, fvar<var>, empty, empty, empty> type_fv_120;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_121;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_122;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, double, empty, empty, empty> type_fv_123;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fv_124;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_125;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_126;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_127;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_128;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_129;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_130;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_131;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_132;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_133;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_134;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, empty, empty, empty> type_fv_135;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_136;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_137;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_138;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_139;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_140;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_141;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_142;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_143;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_144;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_145;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_146;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_147;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_148;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_149;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_150;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_151;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_fv_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_fv_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty, empty, empty> type_fv_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_fv_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fv_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty, empty, empty> type_fv_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_188;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_100> AgradDistributionsBeta_fv_100;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_101> AgradDistributionsBeta_fv_101;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_102> AgradDistributionsBeta_fv_102;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_103> AgradDistributionsBeta_fv_103;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_104> AgradDistributionsBeta_fv_104;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_105> AgradDistributionsBeta_fv_105;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_106> AgradDistributionsBeta_fv_106;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_107> AgradDistributionsBeta_fv_107;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_108> AgradDistributionsBeta_fv_108;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_109> AgradDistributionsBeta_fv_109;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_110> AgradDistributionsBeta_fv_110;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_111> AgradDistributionsBeta_fv_111;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_112> AgradDistributionsBeta_fv_112;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_113> AgradDistributionsBeta_fv_113;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_114> AgradDistributionsBeta_fv_114;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_115> AgradDistributionsBeta_fv_115;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_116> AgradDistributionsBeta_fv_116;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_117> AgradDistributionsBeta_fv_117;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_118> AgradDistributionsBeta_fv_118;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_119> AgradDistributionsBeta_fv_119;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_120> AgradDistributionsBeta_fv_120;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_121> AgradDistributionsBeta_fv_121;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_122> AgradDistributionsBeta_fv_122;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_123> AgradDistributionsBeta_fv_123;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_124> AgradDistributionsBeta_fv_124;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_125> AgradDistributionsBeta_fv_125;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_126> AgradDistributionsBeta_fv_126;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_127> AgradDistributionsBeta_fv_127;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_128> AgradDistributionsBeta_fv_128;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_129> AgradDistributionsBeta_fv_129;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_130> AgradDistributionsBeta_fv_130;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_131> AgradDistributionsBeta_fv_131;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_132> AgradDistributionsBeta_fv_132;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_133> AgradDistributionsBeta_fv_133;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_134> AgradDistributionsBeta_fv_134;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_135> AgradDistributionsBeta_fv_135;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_136> AgradDistributionsBeta_fv_136;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_137> AgradDistributionsBeta_fv_137;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_138> AgradDistributionsBeta_fv_138;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_139> AgradDistributionsBeta_fv_139;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_140> AgradDistributionsBeta_fv_140;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_141> AgradDistributionsBeta_fv_141;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_142> AgradDistributionsBeta_fv_142;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_143> AgradDistributionsBeta_fv_143;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_144> AgradDistributionsBeta_fv_144;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_145> AgradDistributionsBeta_fv_145;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_146> AgradDistributionsBeta_fv_146;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_147> AgradDistributionsBeta_fv_147;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_148> AgradDistributionsBeta_fv_148;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_149> AgradDistributionsBeta_fv_149;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_150> AgradDistributionsBeta_fv_150;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_151> AgradDistributionsBeta_fv_151;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_152> AgradDistributionsBeta_fv_152;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_153> AgradDistributionsBeta_fv_153;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_154> AgradDistributionsBeta_fv_154;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_155> AgradDistributionsBeta_fv_155;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_156> AgradDistributionsBeta_fv_156;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_157> AgradDistributionsBeta_fv_157;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_158> AgradDistributionsBeta_fv_158;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_159> AgradDistributionsBeta_fv_159;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_160> AgradDistributionsBeta_fv_160;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_161> AgradDistributionsBeta_fv_161;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_162> AgradDistributionsBeta_fv_162;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_163> AgradDistributionsBeta_fv_163;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_164> AgradDistributionsBeta_fv_164;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_165> AgradDistributionsBeta_fv_165;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_166> AgradDistributionsBeta_fv_166;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_167> AgradDistributionsBeta_fv_167;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_168> AgradDistributionsBeta_fv_168;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_169> AgradDistributionsBeta_fv_169;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_170> AgradDistributionsBeta_fv_170;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_171> AgradDistributionsBeta_fv_171;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_172> AgradDistributionsBeta_fv_172;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_173> AgradDistributionsBeta_fv_173;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_174> AgradDistributionsBeta_fv_174;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_175> AgradDistributionsBeta_fv_175;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_176> AgradDistributionsBeta_fv_176;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_177> AgradDistributionsBeta_fv_177;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_178> AgradDistributionsBeta_fv_178;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_179> AgradDistributionsBeta_fv_179;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_180> AgradDistributionsBeta_fv_180;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_181> AgradDistributionsBeta_fv_181;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_182> AgradDistributionsBeta_fv_182;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_183> AgradDistributionsBeta_fv_183;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_184> AgradDistributionsBeta_fv_184;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_185> AgradDistributionsBeta_fv_185;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_186> AgradDistributionsBeta_fv_186;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_187> AgradDistributionsBeta_fv_187;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_fv_188> AgradDistributionsBeta_fv_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_100, AgradDistributionTestFixture, AgradDistributionsBeta_fv_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_101, AgradDistributionTestFixture, AgradDistributionsBeta_fv_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_102, AgradDistributionTestFixture, AgradDistributionsBeta_fv_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_103, AgradDistributionTestFixture, AgradDistributionsBeta_fv_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_104, AgradDistributionTestFixture, AgradDistributionsBeta_fv_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_105, AgradDistributionTestFixture, AgradDistributionsBeta_fv_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_106, AgradDistributionTestFixture, AgradDistributionsBeta_fv_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_107, AgradDistributionTestFixture, AgradDistributionsBeta_fv_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_108, AgradDistributionTestFixture, AgradDistributionsBeta_fv_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_109, AgradDistributionTestFixture, AgradDistributionsBeta_fv_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_110, AgradDistributionTestFixture, AgradDistributionsBeta_fv_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_111, AgradDistributionTestFixture, AgradDistributionsBeta_fv_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_112, AgradDistributionTestFixture, AgradDistributionsBeta_fv_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_113, AgradDistributionTestFixture, AgradDistributionsBeta_fv_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_114, AgradDistributionTestFixture, AgradDistributionsBeta_fv_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_115, AgradDistributionTestFixture, AgradDistributionsBeta_fv_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_116, AgradDistributionTestFixture, AgradDistributionsBeta_fv_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_117, AgradDistributionTestFixture, AgradDistributionsBeta_fv_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_118, AgradDistributionTestFixture, AgradDistributionsBeta_fv_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_119, AgradDistributionTestFixture, AgradDistributionsBeta_fv_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_120, AgradDistributionTestFixture, AgradDistributionsBeta_fv_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_121, AgradDistributionTestFixture, AgradDistributionsBeta_fv_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_122, AgradDistributionTestFixture, AgradDistributionsBeta_fv_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_123, AgradDistributionTestFixture, AgradDistributionsBeta_fv_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_124, AgradDistributionTestFixture, AgradDistributionsBeta_fv_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_125, AgradDistributionTestFixture, AgradDistributionsBeta_fv_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_126, AgradDistributionTestFixture, AgradDistributionsBeta_fv_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_127, AgradDistributionTestFixture, AgradDistributionsBeta_fv_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_128, AgradDistributionTestFixture, AgradDistributionsBeta_fv_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_129, AgradDistributionTestFixture, AgradDistributionsBeta_fv_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_130, AgradDistributionTestFixture, AgradDistributionsBeta_fv_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_131, AgradDistributionTestFixture, AgradDistributionsBeta_fv_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_132, AgradDistributionTestFixture, AgradDistributionsBeta_fv_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_133, AgradDistributionTestFixture, AgradDistributionsBeta_fv_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_134, AgradDistributionTestFixture, AgradDistributionsBeta_fv_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_135, AgradDistributionTestFixture, AgradDistributionsBeta_fv_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_136, AgradDistributionTestFixture, AgradDistributionsBeta_fv_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_137, AgradDistributionTestFixture, AgradDistributionsBeta_fv_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_138, AgradDistributionTestFixture, AgradDistributionsBeta_fv_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_139, AgradDistributionTestFixture, AgradDistributionsBeta_fv_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_140, AgradDistributionTestFixture, AgradDistributionsBeta_fv_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_141, AgradDistributionTestFixture, AgradDistributionsBeta_fv_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_142, AgradDistributionTestFixture, AgradDistributionsBeta_fv_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_143, AgradDistributionTestFixture, AgradDistributionsBeta_fv_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_144, AgradDistributionTestFixture, AgradDistributionsBeta_fv_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_145, AgradDistributionTestFixture, AgradDistributionsBeta_fv_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_146, AgradDistributionTestFixture, AgradDistributionsBeta_fv_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_147, AgradDistributionTestFixture, AgradDistributionsBeta_fv_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_148, AgradDistributionTestFixture, AgradDistributionsBeta_fv_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_149, AgradDistributionTestFixture, AgradDistributionsBeta_fv_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_150, AgradDistributionTestFixture, AgradDistributionsBeta_fv_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_151, AgradDistributionTestFixture, AgradDistributionsBeta_fv_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_152, AgradDistributionTestFixture, AgradDistributionsBeta_fv_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_153, AgradDistributionTestFixture, AgradDistributionsBeta_fv_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_154, AgradDistributionTestFixture, AgradDistributionsBeta_fv_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_155, AgradDistributionTestFixture, AgradDistributionsBeta_fv_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_156, AgradDistributionTestFixture, AgradDistributionsBeta_fv_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_157, AgradDistributionTestFixture, AgradDistributionsBeta_fv_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_158, AgradDistributionTestFixture, AgradDistributionsBeta_fv_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_159, AgradDistributionTestFixture, AgradDistributionsBeta_fv_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_160, AgradDistributionTestFixture, AgradDistributionsBeta_fv_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_161, AgradDistributionTestFixture, AgradDistributionsBeta_fv_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_162, AgradDistributionTestFixture, AgradDistributionsBeta_fv_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_163, AgradDistributionTestFixture, AgradDistributionsBeta_fv_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_164, AgradDistributionTestFixture, AgradDistributionsBeta_fv_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_165, AgradDistributionTestFixture, AgradDistributionsBeta_fv_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_166, AgradDistributionTestFixture, AgradDistributionsBeta_fv_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_167, AgradDistributionTestFixture, AgradDistributionsBeta_fv_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_168, AgradDistributionTestFixture, AgradDistributionsBeta_fv_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_169, AgradDistributionTestFixture, AgradDistributionsBeta_fv_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_170, AgradDistributionTestFixture, AgradDistributionsBeta_fv_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_171, AgradDistributionTestFixture, AgradDistributionsBeta_fv_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_172, AgradDistributionTestFixture, AgradDistributionsBeta_fv_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_173, AgradDistributionTestFixture, AgradDistributionsBeta_fv_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_174, AgradDistributionTestFixture, AgradDistributionsBeta_fv_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_175, AgradDistributionTestFixture, AgradDistributionsBeta_fv_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_176, AgradDistributionTestFixture, AgradDistributionsBeta_fv_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_177, AgradDistributionTestFixture, AgradDistributionsBeta_fv_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_178, AgradDistributionTestFixture, AgradDistributionsBeta_fv_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_179, AgradDistributionTestFixture, AgradDistributionsBeta_fv_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_180, AgradDistributionTestFixture, AgradDistributionsBeta_fv_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_181, AgradDistributionTestFixture, AgradDistributionsBeta_fv_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_182, AgradDistributionTestFixture, AgradDistributionsBeta_fv_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_183, AgradDistributionTestFixture, AgradDistributionsBeta_fv_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_184, AgradDistributionTestFixture, AgradDistributionsBeta_fv_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_185, AgradDistributionTestFixture, AgradDistributionsBeta_fv_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_186, AgradDistributionTestFixture, AgradDistributionsBeta_fv_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_187, AgradDistributionTestFixture, AgradDistributionsBeta_fv_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_fv_188, AgradDistributionTestFixture, AgradDistributionsBeta_fv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef boost::mpl::vector<var, double, double, empty, empty, empty> type_v_108;
+typedef boost::mpl::vector<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef boost::mpl::vector<var, double, var, empty, empty, empty> type_v_111;
+typedef boost::mpl::vector<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef boost::mpl::vector<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef boost::mpl::vector<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef boost::mpl::vector<var, var, double, empty, empty, empty> type_v_126;
+typedef boost::mpl::vector<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef boost::mpl::vector<var, var, var, empty, empty, empty> type_v_129;
+typedef boost::mpl::vector<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef boost::mpl::vector<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef boost::mpl::vector<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef boost::mpl::vector<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef boost::mpl::vector<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef boost::mpl::vector<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef boost::mpl::vector<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef boost::mpl::vector<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef boost::mpl::vector<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef boost::mpl::vector<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef boost::mpl::vector<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef boost::mpl::vector<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef boost::mpl::vector<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef boost::mpl::vector<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef boost::mpl::vector<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef boost::mpl::vector<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef boost::mpl::vector<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef boost::mpl::vector<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef boost::mpl::vector<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef boost::mpl::vector<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef boost::mpl::vector<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_100> AgradDistributionsBeta_v_100;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_101> AgradDistributionsBeta_v_101;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_102> AgradDistributionsBeta_v_102;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_103> AgradDistributionsBeta_v_103;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_104> AgradDistributionsBeta_v_104;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_105> AgradDistributionsBeta_v_105;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_106> AgradDistributionsBeta_v_106;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_107> AgradDistributionsBeta_v_107;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_108> AgradDistributionsBeta_v_108;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_109> AgradDistributionsBeta_v_109;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_110> AgradDistributionsBeta_v_110;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_111> AgradDistributionsBeta_v_111;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_112> AgradDistributionsBeta_v_112;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_113> AgradDistributionsBeta_v_113;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_114> AgradDistributionsBeta_v_114;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_115> AgradDistributionsBeta_v_115;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_116> AgradDistributionsBeta_v_116;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_117> AgradDistributionsBeta_v_117;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_118> AgradDistributionsBeta_v_118;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_119> AgradDistributionsBeta_v_119;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_120> AgradDistributionsBeta_v_120;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_121> AgradDistributionsBeta_v_121;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_122> AgradDistributionsBeta_v_122;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_123> AgradDistributionsBeta_v_123;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_124> AgradDistributionsBeta_v_124;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_125> AgradDistributionsBeta_v_125;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_126> AgradDistributionsBeta_v_126;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_127> AgradDistributionsBeta_v_127;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_128> AgradDistributionsBeta_v_128;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_129> AgradDistributionsBeta_v_129;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_130> AgradDistributionsBeta_v_130;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_131> AgradDistributionsBeta_v_131;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_132> AgradDistributionsBeta_v_132;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_133> AgradDistributionsBeta_v_133;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_134> AgradDistributionsBeta_v_134;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_135> AgradDistributionsBeta_v_135;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_136> AgradDistributionsBeta_v_136;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_137> AgradDistributionsBeta_v_137;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_138> AgradDistributionsBeta_v_138;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_139> AgradDistributionsBeta_v_139;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_140> AgradDistributionsBeta_v_140;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_141> AgradDistributionsBeta_v_141;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_142> AgradDistributionsBeta_v_142;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_143> AgradDistributionsBeta_v_143;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_144> AgradDistributionsBeta_v_144;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_145> AgradDistributionsBeta_v_145;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_146> AgradDistributionsBeta_v_146;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_147> AgradDistributionsBeta_v_147;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_148> AgradDistributionsBeta_v_148;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_149> AgradDistributionsBeta_v_149;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_150> AgradDistributionsBeta_v_150;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_151> AgradDistributionsBeta_v_151;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_152> AgradDistributionsBeta_v_152;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_153> AgradDistributionsBeta_v_153;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_154> AgradDistributionsBeta_v_154;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_155> AgradDistributionsBeta_v_155;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_156> AgradDistributionsBeta_v_156;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_157> AgradDistributionsBeta_v_157;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_158> AgradDistributionsBeta_v_158;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_159> AgradDistributionsBeta_v_159;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_160> AgradDistributionsBeta_v_160;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_161> AgradDistributionsBeta_v_161;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_162> AgradDistributionsBeta_v_162;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_163> AgradDistributionsBeta_v_163;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_164> AgradDistributionsBeta_v_164;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_165> AgradDistributionsBeta_v_165;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_166> AgradDistributionsBeta_v_166;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_167> AgradDistributionsBeta_v_167;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_168> AgradDistributionsBeta_v_168;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_169> AgradDistributionsBeta_v_169;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_170> AgradDistributionsBeta_v_170;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_171> AgradDistributionsBeta_v_171;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_172> AgradDistributionsBeta_v_172;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_173> AgradDistributionsBeta_v_173;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_174> AgradDistributionsBeta_v_174;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_175> AgradDistributionsBeta_v_175;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_176> AgradDistributionsBeta_v_176;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_177> AgradDistributionsBeta_v_177;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_178> AgradDistributionsBeta_v_178;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_179> AgradDistributionsBeta_v_179;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_180> AgradDistributionsBeta_v_180;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_181> AgradDistributionsBeta_v_181;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_182> AgradDistributionsBeta_v_182;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_183> AgradDistributionsBeta_v_183;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_184> AgradDistributionsBeta_v_184;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_185> AgradDistributionsBeta_v_185;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_186> AgradDistributionsBeta_v_186;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_187> AgradDistributionsBeta_v_187;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_188> AgradDistributionsBeta_v_188;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_189> AgradDistributionsBeta_v_189;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_190> AgradDistributionsBeta_v_190;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_191> AgradDistributionsBeta_v_191;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_192> AgradDistributionsBeta_v_192;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_193> AgradDistributionsBeta_v_193;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_194> AgradDistributionsBeta_v_194;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_195> AgradDistributionsBeta_v_195;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_196> AgradDistributionsBeta_v_196;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_197> AgradDistributionsBeta_v_197;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_198> AgradDistributionsBeta_v_198;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_199> AgradDistributionsBeta_v_199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_100, AgradDistributionTestFixture, AgradDistributionsBeta_v_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_101, AgradDistributionTestFixture, AgradDistributionsBeta_v_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_102, AgradDistributionTestFixture, AgradDistributionsBeta_v_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_103, AgradDistributionTestFixture, AgradDistributionsBeta_v_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_104, AgradDistributionTestFixture, AgradDistributionsBeta_v_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_105, AgradDistributionTestFixture, AgradDistributionsBeta_v_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_106, AgradDistributionTestFixture, AgradDistributionsBeta_v_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_107, AgradDistributionTestFixture, AgradDistributionsBeta_v_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_108, AgradDistributionTestFixture, AgradDistributionsBeta_v_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_109, AgradDistributionTestFixture, AgradDistributionsBeta_v_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_110, AgradDistributionTestFixture, AgradDistributionsBeta_v_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_111, AgradDistributionTestFixture, AgradDistributionsBeta_v_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_112, AgradDistributionTestFixture, AgradDistributionsBeta_v_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_113, AgradDistributionTestFixture, AgradDistributionsBeta_v_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_114, AgradDistributionTestFixture, AgradDistributionsBeta_v_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_115, AgradDistributionTestFixture, AgradDistributionsBeta_v_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_116, AgradDistributionTestFixture, AgradDistributionsBeta_v_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_117, AgradDistributionTestFixture, AgradDistributionsBeta_v_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_118, AgradDistributionTestFixture, AgradDistributionsBeta_v_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_119, AgradDistributionTestFixture, AgradDistributionsBeta_v_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_120, AgradDistributionTestFixture, AgradDistributionsBeta_v_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_121, AgradDistributionTestFixture, AgradDistributionsBeta_v_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_122, AgradDistributionTestFixture, AgradDistributionsBeta_v_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_123, AgradDistributionTestFixture, AgradDistributionsBeta_v_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_124, AgradDistributionTestFixture, AgradDistributionsBeta_v_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_125, AgradDistributionTestFixture, AgradDistributionsBeta_v_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_126, AgradDistributionTestFixture, AgradDistributionsBeta_v_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_127, AgradDistributionTestFixture, AgradDistributionsBeta_v_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_128, AgradDistributionTestFixture, AgradDistributionsBeta_v_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_129, AgradDistributionTestFixture, AgradDistributionsBeta_v_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_130, AgradDistributionTestFixture, AgradDistributionsBeta_v_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_131, AgradDistributionTestFixture, AgradDistributionsBeta_v_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_132, AgradDistributionTestFixture, AgradDistributionsBeta_v_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_133, AgradDistributionTestFixture, AgradDistributionsBeta_v_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_134, AgradDistributionTestFixture, AgradDistributionsBeta_v_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_135, AgradDistributionTestFixture, AgradDistributionsBeta_v_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_136, AgradDistributionTestFixture, AgradDistributionsBeta_v_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_137, AgradDistributionTestFixture, AgradDistributionsBeta_v_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_138, AgradDistributionTestFixture, AgradDistributionsBeta_v_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_139, AgradDistributionTestFixture, AgradDistributionsBeta_v_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_140, AgradDistributionTestFixture, AgradDistributionsBeta_v_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_141, AgradDistributionTestFixture, AgradDistributionsBeta_v_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_142, AgradDistributionTestFixture, AgradDistributionsBeta_v_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_143, AgradDistributionTestFixture, AgradDistributionsBeta_v_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_144, AgradDistributionTestFixture, AgradDistributionsBeta_v_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_145, AgradDistributionTestFixture, AgradDistributionsBeta_v_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_146, AgradDistributionTestFixture, AgradDistributionsBeta_v_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_147, AgradDistributionTestFixture, AgradDistributionsBeta_v_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_148, AgradDistributionTestFixture, AgradDistributionsBeta_v_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_149, AgradDistributionTestFixture, AgradDistributionsBeta_v_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_150, AgradDistributionTestFixture, AgradDistributionsBeta_v_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_151, AgradDistributionTestFixture, AgradDistributionsBeta_v_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_152, AgradDistributionTestFixture, AgradDistributionsBeta_v_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_153, AgradDistributionTestFixture, AgradDistributionsBeta_v_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_154, AgradDistributionTestFixture, AgradDistributionsBeta_v_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_155, AgradDistributionTestFixture, AgradDistributionsBeta_v_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_156, AgradDistributionTestFixture, AgradDistributionsBeta_v_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_157, AgradDistributionTestFixture, AgradDistributionsBeta_v_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_158, AgradDistributionTestFixture, AgradDistributionsBeta_v_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_159, AgradDistributionTestFixture, AgradDistributionsBeta_v_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_160, AgradDistributionTestFixture, AgradDistributionsBeta_v_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_161, AgradDistributionTestFixture, AgradDistributionsBeta_v_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_162, AgradDistributionTestFixture, AgradDistributionsBeta_v_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_163, AgradDistributionTestFixture, AgradDistributionsBeta_v_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_164, AgradDistributionTestFixture, AgradDistributionsBeta_v_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_165, AgradDistributionTestFixture, AgradDistributionsBeta_v_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_166, AgradDistributionTestFixture, AgradDistributionsBeta_v_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_167, AgradDistributionTestFixture, AgradDistributionsBeta_v_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_168, AgradDistributionTestFixture, AgradDistributionsBeta_v_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_169, AgradDistributionTestFixture, AgradDistributionsBeta_v_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_170, AgradDistributionTestFixture, AgradDistributionsBeta_v_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_171, AgradDistributionTestFixture, AgradDistributionsBeta_v_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_172, AgradDistributionTestFixture, AgradDistributionsBeta_v_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_173, AgradDistributionTestFixture, AgradDistributionsBeta_v_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_174, AgradDistributionTestFixture, AgradDistributionsBeta_v_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_175, AgradDistributionTestFixture, AgradDistributionsBeta_v_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_176, AgradDistributionTestFixture, AgradDistributionsBeta_v_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_177, AgradDistributionTestFixture, AgradDistributionsBeta_v_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_178, AgradDistributionTestFixture, AgradDistributionsBeta_v_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_179, AgradDistributionTestFixture, AgradDistributionsBeta_v_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_180, AgradDistributionTestFixture, AgradDistributionsBeta_v_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_181, AgradDistributionTestFixture, AgradDistributionsBeta_v_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_182, AgradDistributionTestFixture, AgradDistributionsBeta_v_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_183, AgradDistributionTestFixture, AgradDistributionsBeta_v_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_184, AgradDistributionTestFixture, AgradDistributionsBeta_v_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_185, AgradDistributionTestFixture, AgradDistributionsBeta_v_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_186, AgradDistributionTestFixture, AgradDistributionsBeta_v_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_187, AgradDistributionTestFixture, AgradDistributionsBeta_v_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_188, AgradDistributionTestFixture, AgradDistributionsBeta_v_188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_189, AgradDistributionTestFixture, AgradDistributionsBeta_v_189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_190, AgradDistributionTestFixture, AgradDistributionsBeta_v_190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_191, AgradDistributionTestFixture, AgradDistributionsBeta_v_191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_192, AgradDistributionTestFixture, AgradDistributionsBeta_v_192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_193, AgradDistributionTestFixture, AgradDistributionsBeta_v_193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_194, AgradDistributionTestFixture, AgradDistributionsBeta_v_194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_195, AgradDistributionTestFixture, AgradDistributionsBeta_v_195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_196, AgradDistributionTestFixture, AgradDistributionsBeta_v_196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_197, AgradDistributionTestFixture, AgradDistributionsBeta_v_197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_198, AgradDistributionTestFixture, AgradDistributionsBeta_v_198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_199, AgradDistributionTestFixture, AgradDistributionsBeta_v_199);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_200> AgradDistributionsBeta_v_200;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_201> AgradDistributionsBeta_v_201;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_202> AgradDistributionsBeta_v_202;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_203> AgradDistributionsBeta_v_203;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_204> AgradDistributionsBeta_v_204;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_205> AgradDistributionsBeta_v_205;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_206> AgradDistributionsBeta_v_206;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_207> AgradDistributionsBeta_v_207;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_208> AgradDistributionsBeta_v_208;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_209> AgradDistributionsBeta_v_209;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_210> AgradDistributionsBeta_v_210;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_211> AgradDistributionsBeta_v_211;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_212> AgradDistributionsBeta_v_212;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_213> AgradDistributionsBeta_v_213;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_214> AgradDistributionsBeta_v_214;
+typedef boost::mpl::vector<AgradDistributionsBeta, type_v_215> AgradDistributionsBeta_v_215;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_200, AgradDistributionTestFixture, AgradDistributionsBeta_v_200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_201, AgradDistributionTestFixture, AgradDistributionsBeta_v_201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_202, AgradDistributionTestFixture, AgradDistributionsBeta_v_202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_203, AgradDistributionTestFixture, AgradDistributionsBeta_v_203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_204, AgradDistributionTestFixture, AgradDistributionsBeta_v_204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_205, AgradDistributionTestFixture, AgradDistributionsBeta_v_205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_206, AgradDistributionTestFixture, AgradDistributionsBeta_v_206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_207, AgradDistributionTestFixture, AgradDistributionsBeta_v_207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_208, AgradDistributionTestFixture, AgradDistributionsBeta_v_208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_209, AgradDistributionTestFixture, AgradDistributionsBeta_v_209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_210, AgradDistributionTestFixture, AgradDistributionsBeta_v_210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_211, AgradDistributionTestFixture, AgradDistributionsBeta_v_211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_212, AgradDistributionTestFixture, AgradDistributionsBeta_v_212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_213, AgradDistributionTestFixture, AgradDistributionsBeta_v_213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_214, AgradDistributionTestFixture, AgradDistributionsBeta_v_214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsBeta_v_215, AgradDistributionTestFixture, AgradDistributionsBeta_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<double>, empty, empty, empty> type_fd_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_8;
+typedef boost::mpl::vector<double, fvar<double>, double, empty, empty, empty> type_fd_9;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_10;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_11;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, empty, empty, empty> type_fd_12;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_13;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_14;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_15;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_16;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_17;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_18;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_19;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<double>, empty, empty, empty> type_fd_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, double, empty, empty, empty> type_fd_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty, empty, empty> type_fd_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty, empty, empty> type_fd_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_80;
+typedef boost::mpl::vector<fvar<double>, double, double, empty, empty, empty> type_fd_81;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<double>, empty, empty, empty> type_fd_82;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_83;
+typedef boost::mpl::vector<fvar<double>, double, fvar<double>, empty, empty, empty> type_fd_84;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_85;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_86;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, empty, empty, empty> type_fd_87;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fd_88;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_89;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_90;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_91;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_92;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_93;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_94;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_95;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_96;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_97;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_98;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, double, empty, empty, empty> type_fd_99;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_0> AgradDistributionsGamma_fd_0;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_1> AgradDistributionsGamma_fd_1;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_2> AgradDistributionsGamma_fd_2;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_3> AgradDistributionsGamma_fd_3;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_4> AgradDistributionsGamma_fd_4;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_5> AgradDistributionsGamma_fd_5;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_6> AgradDistributionsGamma_fd_6;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_7> AgradDistributionsGamma_fd_7;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_8> AgradDistributionsGamma_fd_8;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_9> AgradDistributionsGamma_fd_9;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_10> AgradDistributionsGamma_fd_10;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_11> AgradDistributionsGamma_fd_11;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_12> AgradDistributionsGamma_fd_12;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_13> AgradDistributionsGamma_fd_13;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_14> AgradDistributionsGamma_fd_14;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_15> AgradDistributionsGamma_fd_15;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_16> AgradDistributionsGamma_fd_16;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_17> AgradDistributionsGamma_fd_17;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_18> AgradDistributionsGamma_fd_18;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_19> AgradDistributionsGamma_fd_19;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_20> AgradDistributionsGamma_fd_20;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_21> AgradDistributionsGamma_fd_21;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_22> AgradDistributionsGamma_fd_22;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_23> AgradDistributionsGamma_fd_23;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_24> AgradDistributionsGamma_fd_24;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_25> AgradDistributionsGamma_fd_25;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_26> AgradDistributionsGamma_fd_26;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_27> AgradDistributionsGamma_fd_27;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_28> AgradDistributionsGamma_fd_28;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_29> AgradDistributionsGamma_fd_29;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_30> AgradDistributionsGamma_fd_30;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_31> AgradDistributionsGamma_fd_31;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_32> AgradDistributionsGamma_fd_32;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_33> AgradDistributionsGamma_fd_33;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_34> AgradDistributionsGamma_fd_34;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_35> AgradDistributionsGamma_fd_35;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_36> AgradDistributionsGamma_fd_36;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_37> AgradDistributionsGamma_fd_37;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_38> AgradDistributionsGamma_fd_38;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_39> AgradDistributionsGamma_fd_39;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_40> AgradDistributionsGamma_fd_40;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_41> AgradDistributionsGamma_fd_41;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_42> AgradDistributionsGamma_fd_42;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_43> AgradDistributionsGamma_fd_43;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_44> AgradDistributionsGamma_fd_44;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_45> AgradDistributionsGamma_fd_45;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_46> AgradDistributionsGamma_fd_46;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_47> AgradDistributionsGamma_fd_47;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_48> AgradDistributionsGamma_fd_48;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_49> AgradDistributionsGamma_fd_49;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_50> AgradDistributionsGamma_fd_50;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_51> AgradDistributionsGamma_fd_51;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_52> AgradDistributionsGamma_fd_52;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_53> AgradDistributionsGamma_fd_53;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_54> AgradDistributionsGamma_fd_54;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_55> AgradDistributionsGamma_fd_55;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_56> AgradDistributionsGamma_fd_56;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_57> AgradDistributionsGamma_fd_57;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_58> AgradDistributionsGamma_fd_58;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_59> AgradDistributionsGamma_fd_59;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_60> AgradDistributionsGamma_fd_60;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_61> AgradDistributionsGamma_fd_61;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_62> AgradDistributionsGamma_fd_62;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_63> AgradDistributionsGamma_fd_63;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_64> AgradDistributionsGamma_fd_64;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_65> AgradDistributionsGamma_fd_65;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_66> AgradDistributionsGamma_fd_66;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_67> AgradDistributionsGamma_fd_67;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_68> AgradDistributionsGamma_fd_68;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_69> AgradDistributionsGamma_fd_69;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_70> AgradDistributionsGamma_fd_70;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_71> AgradDistributionsGamma_fd_71;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_72> AgradDistributionsGamma_fd_72;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_73> AgradDistributionsGamma_fd_73;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_74> AgradDistributionsGamma_fd_74;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_75> AgradDistributionsGamma_fd_75;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_76> AgradDistributionsGamma_fd_76;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_77> AgradDistributionsGamma_fd_77;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_78> AgradDistributionsGamma_fd_78;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_79> AgradDistributionsGamma_fd_79;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_80> AgradDistributionsGamma_fd_80;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_81> AgradDistributionsGamma_fd_81;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_82> AgradDistributionsGamma_fd_82;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_83> AgradDistributionsGamma_fd_83;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_84> AgradDistributionsGamma_fd_84;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_85> AgradDistributionsGamma_fd_85;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_86> AgradDistributionsGamma_fd_86;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_87> AgradDistributionsGamma_fd_87;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_88> AgradDistributionsGamma_fd_88;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_89> AgradDistributionsGamma_fd_89;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_90> AgradDistributionsGamma_fd_90;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_91> AgradDistributionsGamma_fd_91;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_92> AgradDistributionsGamma_fd_92;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_93> AgradDistributionsGamma_fd_93;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_94> AgradDistributionsGamma_fd_94;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_95> AgradDistributionsGamma_fd_95;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_96> AgradDistributionsGamma_fd_96;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_97> AgradDistributionsGamma_fd_97;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_98> AgradDistributionsGamma_fd_98;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_99> AgradDistributionsGamma_fd_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_0, AgradDistributionTestFixture, AgradDistributionsGamma_fd_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_1, AgradDistributionTestFixture, AgradDistributionsGamma_fd_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_2, AgradDistributionTestFixture, AgradDistributionsGamma_fd_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_3, AgradDistributionTestFixture, AgradDistributionsGamma_fd_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_4, AgradDistributionTestFixture, AgradDistributionsGamma_fd_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_5, AgradDistributionTestFixture, AgradDistributionsGamma_fd_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_6, AgradDistributionTestFixture, AgradDistributionsGamma_fd_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_7, AgradDistributionTestFixture, AgradDistributionsGamma_fd_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_8, AgradDistributionTestFixture, AgradDistributionsGamma_fd_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_9, AgradDistributionTestFixture, AgradDistributionsGamma_fd_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_10, AgradDistributionTestFixture, AgradDistributionsGamma_fd_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_11, AgradDistributionTestFixture, AgradDistributionsGamma_fd_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_12, AgradDistributionTestFixture, AgradDistributionsGamma_fd_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_13, AgradDistributionTestFixture, AgradDistributionsGamma_fd_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_14, AgradDistributionTestFixture, AgradDistributionsGamma_fd_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_15, AgradDistributionTestFixture, AgradDistributionsGamma_fd_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_16, AgradDistributionTestFixture, AgradDistributionsGamma_fd_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_17, AgradDistributionTestFixture, AgradDistributionsGamma_fd_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_18, AgradDistributionTestFixture, AgradDistributionsGamma_fd_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_19, AgradDistributionTestFixture, AgradDistributionsGamma_fd_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_20, AgradDistributionTestFixture, AgradDistributionsGamma_fd_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_21, AgradDistributionTestFixture, AgradDistributionsGamma_fd_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_22, AgradDistributionTestFixture, AgradDistributionsGamma_fd_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_23, AgradDistributionTestFixture, AgradDistributionsGamma_fd_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_24, AgradDistributionTestFixture, AgradDistributionsGamma_fd_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_25, AgradDistributionTestFixture, AgradDistributionsGamma_fd_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_26, AgradDistributionTestFixture, AgradDistributionsGamma_fd_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_27, AgradDistributionTestFixture, AgradDistributionsGamma_fd_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_28, AgradDistributionTestFixture, AgradDistributionsGamma_fd_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_29, AgradDistributionTestFixture, AgradDistributionsGamma_fd_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_30, AgradDistributionTestFixture, AgradDistributionsGamma_fd_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_31, AgradDistributionTestFixture, AgradDistributionsGamma_fd_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_32, AgradDistributionTestFixture, AgradDistributionsGamma_fd_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_33, AgradDistributionTestFixture, AgradDistributionsGamma_fd_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_34, AgradDistributionTestFixture, AgradDistributionsGamma_fd_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_35, AgradDistributionTestFixture, AgradDistributionsGamma_fd_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_36, AgradDistributionTestFixture, AgradDistributionsGamma_fd_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_37, AgradDistributionTestFixture, AgradDistributionsGamma_fd_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_38, AgradDistributionTestFixture, AgradDistributionsGamma_fd_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_39, AgradDistributionTestFixture, AgradDistributionsGamma_fd_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_40, AgradDistributionTestFixture, AgradDistributionsGamma_fd_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_41, AgradDistributionTestFixture, AgradDistributionsGamma_fd_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_42, AgradDistributionTestFixture, AgradDistributionsGamma_fd_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_43, AgradDistributionTestFixture, AgradDistributionsGamma_fd_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_44, AgradDistributionTestFixture, AgradDistributionsGamma_fd_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_45, AgradDistributionTestFixture, AgradDistributionsGamma_fd_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_46, AgradDistributionTestFixture, AgradDistributionsGamma_fd_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_47, AgradDistributionTestFixture, AgradDistributionsGamma_fd_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_48, AgradDistributionTestFixture, AgradDistributionsGamma_fd_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_49, AgradDistributionTestFixture, AgradDistributionsGamma_fd_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_50, AgradDistributionTestFixture, AgradDistributionsGamma_fd_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_51, AgradDistributionTestFixture, AgradDistributionsGamma_fd_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_52, AgradDistributionTestFixture, AgradDistributionsGamma_fd_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_53, AgradDistributionTestFixture, AgradDistributionsGamma_fd_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_54, AgradDistributionTestFixture, AgradDistributionsGamma_fd_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_55, AgradDistributionTestFixture, AgradDistributionsGamma_fd_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_56, AgradDistributionTestFixture, AgradDistributionsGamma_fd_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_57, AgradDistributionTestFixture, AgradDistributionsGamma_fd_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_58, AgradDistributionTestFixture, AgradDistributionsGamma_fd_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_59, AgradDistributionTestFixture, AgradDistributionsGamma_fd_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_60, AgradDistributionTestFixture, AgradDistributionsGamma_fd_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_61, AgradDistributionTestFixture, AgradDistributionsGamma_fd_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_62, AgradDistributionTestFixture, AgradDistributionsGamma_fd_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_63, AgradDistributionTestFixture, AgradDistributionsGamma_fd_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_64, AgradDistributionTestFixture, AgradDistributionsGamma_fd_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_65, AgradDistributionTestFixture, AgradDistributionsGamma_fd_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_66, AgradDistributionTestFixture, AgradDistributionsGamma_fd_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_67, AgradDistributionTestFixture, AgradDistributionsGamma_fd_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_68, AgradDistributionTestFixture, AgradDistributionsGamma_fd_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_69, AgradDistributionTestFixture, AgradDistributionsGamma_fd_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_70, AgradDistributionTestFixture, AgradDistributionsGamma_fd_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_71, AgradDistributionTestFixture, AgradDistributionsGamma_fd_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_72, AgradDistributionTestFixture, AgradDistributionsGamma_fd_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_73, AgradDistributionTestFixture, AgradDistributionsGamma_fd_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_74, AgradDistributionTestFixture, AgradDistributionsGamma_fd_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_75, AgradDistributionTestFixture, AgradDistributionsGamma_fd_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_76, AgradDistributionTestFixture, AgradDistributionsGamma_fd_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_77, AgradDistributionTestFixture, AgradDistributionsGamma_fd_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_78, AgradDistributionTestFixture, AgradDistributionsGamma_fd_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_79, AgradDistributionTestFixture, AgradDistributionsGamma_fd_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_80, AgradDistributionTestFixture, AgradDistributionsGamma_fd_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_81, AgradDistributionTestFixture, AgradDistributionsGamma_fd_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_82, AgradDistributionTestFixture, AgradDistributionsGamma_fd_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_83, AgradDistributionTestFixture, AgradDistributionsGamma_fd_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_84, AgradDistributionTestFixture, AgradDistributionsGamma_fd_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_85, AgradDistributionTestFixture, AgradDistributionsGamma_fd_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_86, AgradDistributionTestFixture, AgradDistributionsGamma_fd_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_87, AgradDistributionTestFixture, AgradDistributionsGamma_fd_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_88, AgradDistributionTestFixture, AgradDistributionsGamma_fd_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_89, AgradDistributionTestFixture, AgradDistributionsGamma_fd_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_90, AgradDistributionTestFixture, AgradDistributionsGamma_fd_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_91, AgradDistributionTestFixture, AgradDistributionsGamma_fd_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_92, AgradDistributionTestFixture, AgradDistributionsGamma_fd_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_93, AgradDistributionTestFixture, AgradDistributionsGamma_fd_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_94, AgradDistributionTestFixture, AgradDistributionsGamma_fd_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_95, AgradDistributionTestFixture, AgradDistributionsGamma_fd_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_96, AgradDistributionTestFixture, AgradDistributionsGamma_fd_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_97, AgradDistributionTestFixture, AgradDistributionsGamma_fd_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_98, AgradDistributionTestFixture, AgradDistributionsGamma_fd_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_99, AgradDistributionTestFixture, AgradDistributionsGamma_fd_99);
+
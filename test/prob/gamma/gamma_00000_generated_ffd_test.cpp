@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_8;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_9;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_10;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_11;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_12;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_13;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_14;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_15;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_16;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_17;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_18;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_19;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_80;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, double, empty, empty, empty> type_ffd_81;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, empty, empty, empty> type_ffd_82;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_83;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_84;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_85;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_86;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, double, empty, empty, empty> type_ffd_87;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffd_88;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_89;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_90;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_91;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_92;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_93;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_94;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_95;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_96;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_97;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_98;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_99;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_0> AgradDistributionsGamma_ffd_0;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_1> AgradDistributionsGamma_ffd_1;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_2> AgradDistributionsGamma_ffd_2;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_3> AgradDistributionsGamma_ffd_3;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_4> AgradDistributionsGamma_ffd_4;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_5> AgradDistributionsGamma_ffd_5;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_6> AgradDistributionsGamma_ffd_6;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_7> AgradDistributionsGamma_ffd_7;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_8> AgradDistributionsGamma_ffd_8;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_9> AgradDistributionsGamma_ffd_9;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_10> AgradDistributionsGamma_ffd_10;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_11> AgradDistributionsGamma_ffd_11;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_12> AgradDistributionsGamma_ffd_12;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_13> AgradDistributionsGamma_ffd_13;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_14> AgradDistributionsGamma_ffd_14;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_15> AgradDistributionsGamma_ffd_15;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_16> AgradDistributionsGamma_ffd_16;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_17> AgradDistributionsGamma_ffd_17;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_18> AgradDistributionsGamma_ffd_18;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_19> AgradDistributionsGamma_ffd_19;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_20> AgradDistributionsGamma_ffd_20;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_21> AgradDistributionsGamma_ffd_21;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_22> AgradDistributionsGamma_ffd_22;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_23> AgradDistributionsGamma_ffd_23;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_24> AgradDistributionsGamma_ffd_24;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_25> AgradDistributionsGamma_ffd_25;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_26> AgradDistributionsGamma_ffd_26;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_27> AgradDistributionsGamma_ffd_27;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_28> AgradDistributionsGamma_ffd_28;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_29> AgradDistributionsGamma_ffd_29;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_30> AgradDistributionsGamma_ffd_30;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_31> AgradDistributionsGamma_ffd_31;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_32> AgradDistributionsGamma_ffd_32;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_33> AgradDistributionsGamma_ffd_33;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_34> AgradDistributionsGamma_ffd_34;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_35> AgradDistributionsGamma_ffd_35;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_36> AgradDistributionsGamma_ffd_36;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_37> AgradDistributionsGamma_ffd_37;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_38> AgradDistributionsGamma_ffd_38;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_39> AgradDistributionsGamma_ffd_39;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_40> AgradDistributionsGamma_ffd_40;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_41> AgradDistributionsGamma_ffd_41;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_42> AgradDistributionsGamma_ffd_42;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_43> AgradDistributionsGamma_ffd_43;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_44> AgradDistributionsGamma_ffd_44;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_45> AgradDistributionsGamma_ffd_45;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_46> AgradDistributionsGamma_ffd_46;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_47> AgradDistributionsGamma_ffd_47;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_48> AgradDistributionsGamma_ffd_48;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_49> AgradDistributionsGamma_ffd_49;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_50> AgradDistributionsGamma_ffd_50;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_51> AgradDistributionsGamma_ffd_51;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_52> AgradDistributionsGamma_ffd_52;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_53> AgradDistributionsGamma_ffd_53;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_54> AgradDistributionsGamma_ffd_54;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_55> AgradDistributionsGamma_ffd_55;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_56> AgradDistributionsGamma_ffd_56;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_57> AgradDistributionsGamma_ffd_57;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_58> AgradDistributionsGamma_ffd_58;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_59> AgradDistributionsGamma_ffd_59;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_60> AgradDistributionsGamma_ffd_60;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_61> AgradDistributionsGamma_ffd_61;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_62> AgradDistributionsGamma_ffd_62;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_63> AgradDistributionsGamma_ffd_63;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_64> AgradDistributionsGamma_ffd_64;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_65> AgradDistributionsGamma_ffd_65;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_66> AgradDistributionsGamma_ffd_66;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_67> AgradDistributionsGamma_ffd_67;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_68> AgradDistributionsGamma_ffd_68;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_69> AgradDistributionsGamma_ffd_69;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_70> AgradDistributionsGamma_ffd_70;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_71> AgradDistributionsGamma_ffd_71;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_72> AgradDistributionsGamma_ffd_72;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_73> AgradDistributionsGamma_ffd_73;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_74> AgradDistributionsGamma_ffd_74;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_75> AgradDistributionsGamma_ffd_75;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_76> AgradDistributionsGamma_ffd_76;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_77> AgradDistributionsGamma_ffd_77;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_78> AgradDistributionsGamma_ffd_78;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_79> AgradDistributionsGamma_ffd_79;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_80> AgradDistributionsGamma_ffd_80;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_81> AgradDistributionsGamma_ffd_81;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_82> AgradDistributionsGamma_ffd_82;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_83> AgradDistributionsGamma_ffd_83;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_84> AgradDistributionsGamma_ffd_84;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_85> AgradDistributionsGamma_ffd_85;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_86> AgradDistributionsGamma_ffd_86;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_87> AgradDistributionsGamma_ffd_87;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_88> AgradDistributionsGamma_ffd_88;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_89> AgradDistributionsGamma_ffd_89;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_90> AgradDistributionsGamma_ffd_90;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_91> AgradDistributionsGamma_ffd_91;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_92> AgradDistributionsGamma_ffd_92;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_93> AgradDistributionsGamma_ffd_93;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_94> AgradDistributionsGamma_ffd_94;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_95> AgradDistributionsGamma_ffd_95;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_96> AgradDistributionsGamma_ffd_96;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_97> AgradDistributionsGamma_ffd_97;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_98> AgradDistributionsGamma_ffd_98;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_99> AgradDistributionsGamma_ffd_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_0, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_1, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_2, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_3, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_4, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_5, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_6, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_7, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_8, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_9, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_10, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_11, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_12, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_13, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_14, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_15, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_16, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_17, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_18, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_19, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_20, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_21, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_22, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_23, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_24, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_25, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_26, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_27, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_28, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_29, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_30, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_31, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_32, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_33, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_34, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_35, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_36, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_37, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_38, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_39, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_40, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_41, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_42, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_43, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_44, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_45, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_46, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_47, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_48, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_49, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_50, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_51, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_52, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_53, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_54, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_55, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_56, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_57, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_58, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_59, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_60, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_61, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_62, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_63, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_64, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_65, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_66, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_67, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_68, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_69, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_70, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_71, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_72, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_73, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_74, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_75, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_76, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_77, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_78, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_79, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_80, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_81, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_82, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_83, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_84, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_85, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_86, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_87, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_88, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_89, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_90, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_91, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_92, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_93, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_94, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_95, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_96, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_97, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_98, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_99, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_99);
+
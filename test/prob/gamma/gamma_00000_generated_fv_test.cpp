@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<var>, empty, empty, empty> type_fv_0;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_2;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_3;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_4;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_5;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_6;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_7;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_8;
+typedef boost::mpl::vector<double, fvar<var>, double, empty, empty, empty> type_fv_9;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_10;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_11;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, empty, empty, empty> type_fv_12;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_13;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_14;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_15;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_16;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_17;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_18;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_19;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_20;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_21;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_22;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_23;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_24;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_25;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_26;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, empty, empty, empty> type_fv_27;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_28;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_29;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_30;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_31;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_32;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_33;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_34;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_35;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, empty, empty, empty> type_fv_36;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_37;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_38;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_39;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_40;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_53;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty, empty, empty> type_fv_54;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_55;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_56;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_57;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_58;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_59;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_60;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_61;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_62;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty, empty, empty> type_fv_63;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_64;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_65;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_66;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_67;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_68;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_69;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_70;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_80;
+typedef boost::mpl::vector<fvar<var>, double, double, empty, empty, empty> type_fv_81;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, empty, empty, empty> type_fv_82;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_83;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, empty, empty, empty> type_fv_84;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_85;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_86;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, double, empty, empty, empty> type_fv_87;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fv_88;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_89;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_90;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_91;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_92;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_93;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_94;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_95;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_96;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_97;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_98;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, double, empty, empty, empty> type_fv_99;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_0> AgradDistributionsGamma_fv_0;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_1> AgradDistributionsGamma_fv_1;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_2> AgradDistributionsGamma_fv_2;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_3> AgradDistributionsGamma_fv_3;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_4> AgradDistributionsGamma_fv_4;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_5> AgradDistributionsGamma_fv_5;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_6> AgradDistributionsGamma_fv_6;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_7> AgradDistributionsGamma_fv_7;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_8> AgradDistributionsGamma_fv_8;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_9> AgradDistributionsGamma_fv_9;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_10> AgradDistributionsGamma_fv_10;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_11> AgradDistributionsGamma_fv_11;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_12> AgradDistributionsGamma_fv_12;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_13> AgradDistributionsGamma_fv_13;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_14> AgradDistributionsGamma_fv_14;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_15> AgradDistributionsGamma_fv_15;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_16> AgradDistributionsGamma_fv_16;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_17> AgradDistributionsGamma_fv_17;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_18> AgradDistributionsGamma_fv_18;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_19> AgradDistributionsGamma_fv_19;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_20> AgradDistributionsGamma_fv_20;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_21> AgradDistributionsGamma_fv_21;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_22> AgradDistributionsGamma_fv_22;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_23> AgradDistributionsGamma_fv_23;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_24> AgradDistributionsGamma_fv_24;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_25> AgradDistributionsGamma_fv_25;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_26> AgradDistributionsGamma_fv_26;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_27> AgradDistributionsGamma_fv_27;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_28> AgradDistributionsGamma_fv_28;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_29> AgradDistributionsGamma_fv_29;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_30> AgradDistributionsGamma_fv_30;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_31> AgradDistributionsGamma_fv_31;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_32> AgradDistributionsGamma_fv_32;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_33> AgradDistributionsGamma_fv_33;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_34> AgradDistributionsGamma_fv_34;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_35> AgradDistributionsGamma_fv_35;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_36> AgradDistributionsGamma_fv_36;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_37> AgradDistributionsGamma_fv_37;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_38> AgradDistributionsGamma_fv_38;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_39> AgradDistributionsGamma_fv_39;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_40> AgradDistributionsGamma_fv_40;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_41> AgradDistributionsGamma_fv_41;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_42> AgradDistributionsGamma_fv_42;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_43> AgradDistributionsGamma_fv_43;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_44> AgradDistributionsGamma_fv_44;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_45> AgradDistributionsGamma_fv_45;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_46> AgradDistributionsGamma_fv_46;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_47> AgradDistributionsGamma_fv_47;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_48> AgradDistributionsGamma_fv_48;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_49> AgradDistributionsGamma_fv_49;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_50> AgradDistributionsGamma_fv_50;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_51> AgradDistributionsGamma_fv_51;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_52> AgradDistributionsGamma_fv_52;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_53> AgradDistributionsGamma_fv_53;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_54> AgradDistributionsGamma_fv_54;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_55> AgradDistributionsGamma_fv_55;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_56> AgradDistributionsGamma_fv_56;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_57> AgradDistributionsGamma_fv_57;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_58> AgradDistributionsGamma_fv_58;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_59> AgradDistributionsGamma_fv_59;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_60> AgradDistributionsGamma_fv_60;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_61> AgradDistributionsGamma_fv_61;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_62> AgradDistributionsGamma_fv_62;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_63> AgradDistributionsGamma_fv_63;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_64> AgradDistributionsGamma_fv_64;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_65> AgradDistributionsGamma_fv_65;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_66> AgradDistributionsGamma_fv_66;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_67> AgradDistributionsGamma_fv_67;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_68> AgradDistributionsGamma_fv_68;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_69> AgradDistributionsGamma_fv_69;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_70> AgradDistributionsGamma_fv_70;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_71> AgradDistributionsGamma_fv_71;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_72> AgradDistributionsGamma_fv_72;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_73> AgradDistributionsGamma_fv_73;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_74> AgradDistributionsGamma_fv_74;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_75> AgradDistributionsGamma_fv_75;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_76> AgradDistributionsGamma_fv_76;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_77> AgradDistributionsGamma_fv_77;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_78> AgradDistributionsGamma_fv_78;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_79> AgradDistributionsGamma_fv_79;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_80> AgradDistributionsGamma_fv_80;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_81> AgradDistributionsGamma_fv_81;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_82> AgradDistributionsGamma_fv_82;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_83> AgradDistributionsGamma_fv_83;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_84> AgradDistributionsGamma_fv_84;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_85> AgradDistributionsGamma_fv_85;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_86> AgradDistributionsGamma_fv_86;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_87> AgradDistributionsGamma_fv_87;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_88> AgradDistributionsGamma_fv_88;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_89> AgradDistributionsGamma_fv_89;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_90> AgradDistributionsGamma_fv_90;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_91> AgradDistributionsGamma_fv_91;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_92> AgradDistributionsGamma_fv_92;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_93> AgradDistributionsGamma_fv_93;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_94> AgradDistributionsGamma_fv_94;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_95> AgradDistributionsGamma_fv_95;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_96> AgradDistributionsGamma_fv_96;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_97> AgradDistributionsGamma_fv_97;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_98> AgradDistributionsGamma_fv_98;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_99> AgradDistributionsGamma_fv_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_0, AgradDistributionTestFixture, AgradDistributionsGamma_fv_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_1, AgradDistributionTestFixture, AgradDistributionsGamma_fv_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_2, AgradDistributionTestFixture, AgradDistributionsGamma_fv_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_3, AgradDistributionTestFixture, AgradDistributionsGamma_fv_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_4, AgradDistributionTestFixture, AgradDistributionsGamma_fv_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_5, AgradDistributionTestFixture, AgradDistributionsGamma_fv_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_6, AgradDistributionTestFixture, AgradDistributionsGamma_fv_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_7, AgradDistributionTestFixture, AgradDistributionsGamma_fv_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_8, AgradDistributionTestFixture, AgradDistributionsGamma_fv_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_9, AgradDistributionTestFixture, AgradDistributionsGamma_fv_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_10, AgradDistributionTestFixture, AgradDistributionsGamma_fv_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_11, AgradDistributionTestFixture, AgradDistributionsGamma_fv_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_12, AgradDistributionTestFixture, AgradDistributionsGamma_fv_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_13, AgradDistributionTestFixture, AgradDistributionsGamma_fv_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_14, AgradDistributionTestFixture, AgradDistributionsGamma_fv_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_15, AgradDistributionTestFixture, AgradDistributionsGamma_fv_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_16, AgradDistributionTestFixture, AgradDistributionsGamma_fv_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_17, AgradDistributionTestFixture, AgradDistributionsGamma_fv_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_18, AgradDistributionTestFixture, AgradDistributionsGamma_fv_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_19, AgradDistributionTestFixture, AgradDistributionsGamma_fv_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_20, AgradDistributionTestFixture, AgradDistributionsGamma_fv_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_21, AgradDistributionTestFixture, AgradDistributionsGamma_fv_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_22, AgradDistributionTestFixture, AgradDistributionsGamma_fv_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_23, AgradDistributionTestFixture, AgradDistributionsGamma_fv_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_24, AgradDistributionTestFixture, AgradDistributionsGamma_fv_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_25, AgradDistributionTestFixture, AgradDistributionsGamma_fv_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_26, AgradDistributionTestFixture, AgradDistributionsGamma_fv_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_27, AgradDistributionTestFixture, AgradDistributionsGamma_fv_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_28, AgradDistributionTestFixture, AgradDistributionsGamma_fv_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_29, AgradDistributionTestFixture, AgradDistributionsGamma_fv_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_30, AgradDistributionTestFixture, AgradDistributionsGamma_fv_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_31, AgradDistributionTestFixture, AgradDistributionsGamma_fv_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_32, AgradDistributionTestFixture, AgradDistributionsGamma_fv_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_33, AgradDistributionTestFixture, AgradDistributionsGamma_fv_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_34, AgradDistributionTestFixture, AgradDistributionsGamma_fv_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_35, AgradDistributionTestFixture, AgradDistributionsGamma_fv_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_36, AgradDistributionTestFixture, AgradDistributionsGamma_fv_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_37, AgradDistributionTestFixture, AgradDistributionsGamma_fv_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_38, AgradDistributionTestFixture, AgradDistributionsGamma_fv_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_39, AgradDistributionTestFixture, AgradDistributionsGamma_fv_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_40, AgradDistributionTestFixture, AgradDistributionsGamma_fv_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_41, AgradDistributionTestFixture, AgradDistributionsGamma_fv_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_42, AgradDistributionTestFixture, AgradDistributionsGamma_fv_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_43, AgradDistributionTestFixture, AgradDistributionsGamma_fv_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_44, AgradDistributionTestFixture, AgradDistributionsGamma_fv_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_45, AgradDistributionTestFixture, AgradDistributionsGamma_fv_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_46, AgradDistributionTestFixture, AgradDistributionsGamma_fv_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_47, AgradDistributionTestFixture, AgradDistributionsGamma_fv_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_48, AgradDistributionTestFixture, AgradDistributionsGamma_fv_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_49, AgradDistributionTestFixture, AgradDistributionsGamma_fv_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_50, AgradDistributionTestFixture, AgradDistributionsGamma_fv_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_51, AgradDistributionTestFixture, AgradDistributionsGamma_fv_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_52, AgradDistributionTestFixture, AgradDistributionsGamma_fv_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_53, AgradDistributionTestFixture, AgradDistributionsGamma_fv_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_54, AgradDistributionTestFixture, AgradDistributionsGamma_fv_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_55, AgradDistributionTestFixture, AgradDistributionsGamma_fv_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_56, AgradDistributionTestFixture, AgradDistributionsGamma_fv_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_57, AgradDistributionTestFixture, AgradDistributionsGamma_fv_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_58, AgradDistributionTestFixture, AgradDistributionsGamma_fv_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_59, AgradDistributionTestFixture, AgradDistributionsGamma_fv_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_60, AgradDistributionTestFixture, AgradDistributionsGamma_fv_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_61, AgradDistributionTestFixture, AgradDistributionsGamma_fv_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_62, AgradDistributionTestFixture, AgradDistributionsGamma_fv_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_63, AgradDistributionTestFixture, AgradDistributionsGamma_fv_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_64, AgradDistributionTestFixture, AgradDistributionsGamma_fv_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_65, AgradDistributionTestFixture, AgradDistributionsGamma_fv_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_66, AgradDistributionTestFixture, AgradDistributionsGamma_fv_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_67, AgradDistributionTestFixture, AgradDistributionsGamma_fv_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_68, AgradDistributionTestFixture, AgradDistributionsGamma_fv_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_69, AgradDistributionTestFixture, AgradDistributionsGamma_fv_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_70, AgradDistributionTestFixture, AgradDistributionsGamma_fv_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_71, AgradDistributionTestFixture, AgradDistributionsGamma_fv_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_72, AgradDistributionTestFixture, AgradDistributionsGamma_fv_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_73, AgradDistributionTestFixture, AgradDistributionsGamma_fv_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_74, AgradDistributionTestFixture, AgradDistributionsGamma_fv_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_75, AgradDistributionTestFixture, AgradDistributionsGamma_fv_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_76, AgradDistributionTestFixture, AgradDistributionsGamma_fv_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_77, AgradDistributionTestFixture, AgradDistributionsGamma_fv_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_78, AgradDistributionTestFixture, AgradDistributionsGamma_fv_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_79, AgradDistributionTestFixture, AgradDistributionsGamma_fv_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_80, AgradDistributionTestFixture, AgradDistributionsGamma_fv_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_81, AgradDistributionTestFixture, AgradDistributionsGamma_fv_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_82, AgradDistributionTestFixture, AgradDistributionsGamma_fv_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_83, AgradDistributionTestFixture, AgradDistributionsGamma_fv_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_84, AgradDistributionTestFixture, AgradDistributionsGamma_fv_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_85, AgradDistributionTestFixture, AgradDistributionsGamma_fv_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_86, AgradDistributionTestFixture, AgradDistributionsGamma_fv_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_87, AgradDistributionTestFixture, AgradDistributionsGamma_fv_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_88, AgradDistributionTestFixture, AgradDistributionsGamma_fv_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_89, AgradDistributionTestFixture, AgradDistributionsGamma_fv_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_90, AgradDistributionTestFixture, AgradDistributionsGamma_fv_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_91, AgradDistributionTestFixture, AgradDistributionsGamma_fv_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_92, AgradDistributionTestFixture, AgradDistributionsGamma_fv_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_93, AgradDistributionTestFixture, AgradDistributionsGamma_fv_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_94, AgradDistributionTestFixture, AgradDistributionsGamma_fv_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_95, AgradDistributionTestFixture, AgradDistributionsGamma_fv_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_96, AgradDistributionTestFixture, AgradDistributionsGamma_fv_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_97, AgradDistributionTestFixture, AgradDistributionsGamma_fv_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_98, AgradDistributionTestFixture, AgradDistributionsGamma_fv_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_99, AgradDistributionTestFixture, AgradDistributionsGamma_fv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, empty, empty, empty> type_v_0;
+typedef boost::mpl::vector<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef boost::mpl::vector<double, double, var, empty, empty, empty> type_v_3;
+typedef boost::mpl::vector<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef boost::mpl::vector<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef boost::mpl::vector<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef boost::mpl::vector<double, var, double, empty, empty, empty> type_v_18;
+typedef boost::mpl::vector<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef boost::mpl::vector<double, var, var, empty, empty, empty> type_v_21;
+typedef boost::mpl::vector<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef boost::mpl::vector<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef boost::mpl::vector<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef boost::mpl::vector<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef boost::mpl::vector<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef boost::mpl::vector<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef boost::mpl::vector<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef boost::mpl::vector<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_0> AgradDistributionsGamma_v_0;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_1> AgradDistributionsGamma_v_1;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_2> AgradDistributionsGamma_v_2;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_3> AgradDistributionsGamma_v_3;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_4> AgradDistributionsGamma_v_4;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_5> AgradDistributionsGamma_v_5;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_6> AgradDistributionsGamma_v_6;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_7> AgradDistributionsGamma_v_7;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_8> AgradDistributionsGamma_v_8;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_9> AgradDistributionsGamma_v_9;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_10> AgradDistributionsGamma_v_10;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_11> AgradDistributionsGamma_v_11;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_12> AgradDistributionsGamma_v_12;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_13> AgradDistributionsGamma_v_13;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_14> AgradDistributionsGamma_v_14;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_15> AgradDistributionsGamma_v_15;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_16> AgradDistributionsGamma_v_16;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_17> AgradDistributionsGamma_v_17;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_18> AgradDistributionsGamma_v_18;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_19> AgradDistributionsGamma_v_19;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_20> AgradDistributionsGamma_v_20;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_21> AgradDistributionsGamma_v_21;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_22> AgradDistributionsGamma_v_22;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_23> AgradDistributionsGamma_v_23;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_24> AgradDistributionsGamma_v_24;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_25> AgradDistributionsGamma_v_25;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_26> AgradDistributionsGamma_v_26;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_27> AgradDistributionsGamma_v_27;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_28> AgradDistributionsGamma_v_28;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_29> AgradDistributionsGamma_v_29;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_30> AgradDistributionsGamma_v_30;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_31> AgradDistributionsGamma_v_31;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_32> AgradDistributionsGamma_v_32;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_33> AgradDistributionsGamma_v_33;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_34> AgradDistributionsGamma_v_34;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_35> AgradDistributionsGamma_v_35;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_36> AgradDistributionsGamma_v_36;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_37> AgradDistributionsGamma_v_37;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_38> AgradDistributionsGamma_v_38;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_39> AgradDistributionsGamma_v_39;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_40> AgradDistributionsGamma_v_40;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_41> AgradDistributionsGamma_v_41;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_42> AgradDistributionsGamma_v_42;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_43> AgradDistributionsGamma_v_43;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_44> AgradDistributionsGamma_v_44;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_45> AgradDistributionsGamma_v_45;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_46> AgradDistributionsGamma_v_46;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_47> AgradDistributionsGamma_v_47;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_48> AgradDistributionsGamma_v_48;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_49> AgradDistributionsGamma_v_49;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_50> AgradDistributionsGamma_v_50;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_51> AgradDistributionsGamma_v_51;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_52> AgradDistributionsGamma_v_52;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_53> AgradDistributionsGamma_v_53;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_54> AgradDistributionsGamma_v_54;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_55> AgradDistributionsGamma_v_55;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_56> AgradDistributionsGamma_v_56;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_57> AgradDistributionsGamma_v_57;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_58> AgradDistributionsGamma_v_58;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_59> AgradDistributionsGamma_v_59;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_60> AgradDistributionsGamma_v_60;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_61> AgradDistributionsGamma_v_61;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_62> AgradDistributionsGamma_v_62;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_63> AgradDistributionsGamma_v_63;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_64> AgradDistributionsGamma_v_64;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_65> AgradDistributionsGamma_v_65;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_66> AgradDistributionsGamma_v_66;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_67> AgradDistributionsGamma_v_67;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_68> AgradDistributionsGamma_v_68;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_69> AgradDistributionsGamma_v_69;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_70> AgradDistributionsGamma_v_70;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_71> AgradDistributionsGamma_v_71;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_72> AgradDistributionsGamma_v_72;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_73> AgradDistributionsGamma_v_73;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_74> AgradDistributionsGamma_v_74;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_75> AgradDistributionsGamma_v_75;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_76> AgradDistributionsGamma_v_76;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_77> AgradDistributionsGamma_v_77;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_78> AgradDistributionsGamma_v_78;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_79> AgradDistributionsGamma_v_79;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_80> AgradDistributionsGamma_v_80;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_81> AgradDistributionsGamma_v_81;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_82> AgradDistributionsGamma_v_82;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_83> AgradDistributionsGamma_v_83;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_84> AgradDistributionsGamma_v_84;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_85> AgradDistributionsGamma_v_85;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_86> AgradDistributionsGamma_v_86;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_87> AgradDistributionsGamma_v_87;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_88> AgradDistributionsGamma_v_88;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_89> AgradDistributionsGamma_v_89;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_90> AgradDistributionsGamma_v_90;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_91> AgradDistributionsGamma_v_91;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_92> AgradDistributionsGamma_v_92;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_93> AgradDistributionsGamma_v_93;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_94> AgradDistributionsGamma_v_94;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_95> AgradDistributionsGamma_v_95;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_96> AgradDistributionsGamma_v_96;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_97> AgradDistributionsGamma_v_97;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_98> AgradDistributionsGamma_v_98;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_v_99> AgradDistributionsGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_0, AgradDistributionTestFixture, AgradDistributionsGamma_v_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_1, AgradDistributionTestFixture, AgradDistributionsGamma_v_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_2, AgradDistributionTestFixture, AgradDistributionsGamma_v_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_3, AgradDistributionTestFixture, AgradDistributionsGamma_v_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_4, AgradDistributionTestFixture, AgradDistributionsGamma_v_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_5, AgradDistributionTestFixture, AgradDistributionsGamma_v_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_6, AgradDistributionTestFixture, AgradDistributionsGamma_v_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_7, AgradDistributionTestFixture, AgradDistributionsGamma_v_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_8, AgradDistributionTestFixture, AgradDistributionsGamma_v_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_9, AgradDistributionTestFixture, AgradDistributionsGamma_v_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_10, AgradDistributionTestFixture, AgradDistributionsGamma_v_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_11, AgradDistributionTestFixture, AgradDistributionsGamma_v_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_12, AgradDistributionTestFixture, AgradDistributionsGamma_v_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_13, AgradDistributionTestFixture, AgradDistributionsGamma_v_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_14, AgradDistributionTestFixture, AgradDistributionsGamma_v_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_15, AgradDistributionTestFixture, AgradDistributionsGamma_v_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_16, AgradDistributionTestFixture, AgradDistributionsGamma_v_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_17, AgradDistributionTestFixture, AgradDistributionsGamma_v_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_18, AgradDistributionTestFixture, AgradDistributionsGamma_v_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_19, AgradDistributionTestFixture, AgradDistributionsGamma_v_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_20, AgradDistributionTestFixture, AgradDistributionsGamma_v_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_21, AgradDistributionTestFixture, AgradDistributionsGamma_v_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_22, AgradDistributionTestFixture, AgradDistributionsGamma_v_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_23, AgradDistributionTestFixture, AgradDistributionsGamma_v_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_24, AgradDistributionTestFixture, AgradDistributionsGamma_v_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_25, AgradDistributionTestFixture, AgradDistributionsGamma_v_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_26, AgradDistributionTestFixture, AgradDistributionsGamma_v_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_27, AgradDistributionTestFixture, AgradDistributionsGamma_v_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_28, AgradDistributionTestFixture, AgradDistributionsGamma_v_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_29, AgradDistributionTestFixture, AgradDistributionsGamma_v_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_30, AgradDistributionTestFixture, AgradDistributionsGamma_v_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_31, AgradDistributionTestFixture, AgradDistributionsGamma_v_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_32, AgradDistributionTestFixture, AgradDistributionsGamma_v_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_33, AgradDistributionTestFixture, AgradDistributionsGamma_v_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_34, AgradDistributionTestFixture, AgradDistributionsGamma_v_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_35, AgradDistributionTestFixture, AgradDistributionsGamma_v_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_36, AgradDistributionTestFixture, AgradDistributionsGamma_v_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_37, AgradDistributionTestFixture, AgradDistributionsGamma_v_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_38, AgradDistributionTestFixture, AgradDistributionsGamma_v_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_39, AgradDistributionTestFixture, AgradDistributionsGamma_v_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_40, AgradDistributionTestFixture, AgradDistributionsGamma_v_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_41, AgradDistributionTestFixture, AgradDistributionsGamma_v_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_42, AgradDistributionTestFixture, AgradDistributionsGamma_v_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_43, AgradDistributionTestFixture, AgradDistributionsGamma_v_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_44, AgradDistributionTestFixture, AgradDistributionsGamma_v_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_45, AgradDistributionTestFixture, AgradDistributionsGamma_v_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_46, AgradDistributionTestFixture, AgradDistributionsGamma_v_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_47, AgradDistributionTestFixture, AgradDistributionsGamma_v_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_48, AgradDistributionTestFixture, AgradDistributionsGamma_v_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_49, AgradDistributionTestFixture, AgradDistributionsGamma_v_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_50, AgradDistributionTestFixture, AgradDistributionsGamma_v_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_51, AgradDistributionTestFixture, AgradDistributionsGamma_v_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_52, AgradDistributionTestFixture, AgradDistributionsGamma_v_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_53, AgradDistributionTestFixture, AgradDistributionsGamma_v_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_54, AgradDistributionTestFixture, AgradDistributionsGamma_v_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_55, AgradDistributionTestFixture, AgradDistributionsGamma_v_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_56, AgradDistributionTestFixture, AgradDistributionsGamma_v_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_57, AgradDistributionTestFixture, AgradDistributionsGamma_v_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_58, AgradDistributionTestFixture, AgradDistributionsGamma_v_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_59, AgradDistributionTestFixture, AgradDistributionsGamma_v_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_60, AgradDistributionTestFixture, AgradDistributionsGamma_v_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_61, AgradDistributionTestFixture, AgradDistributionsGamma_v_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_62, AgradDistributionTestFixture, AgradDistributionsGamma_v_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_63, AgradDistributionTestFixture, AgradDistributionsGamma_v_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_64, AgradDistributionTestFixture, AgradDistributionsGamma_v_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_65, AgradDistributionTestFixture, AgradDistributionsGamma_v_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_66, AgradDistributionTestFixture, AgradDistributionsGamma_v_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_67, AgradDistributionTestFixture, AgradDistributionsGamma_v_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_68, AgradDistributionTestFixture, AgradDistributionsGamma_v_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_69, AgradDistributionTestFixture, AgradDistributionsGamma_v_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_70, AgradDistributionTestFixture, AgradDistributionsGamma_v_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_71, AgradDistributionTestFixture, AgradDistributionsGamma_v_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_72, AgradDistributionTestFixture, AgradDistributionsGamma_v_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_73, AgradDistributionTestFixture, AgradDistributionsGamma_v_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_74, AgradDistributionTestFixture, AgradDistributionsGamma_v_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_75, AgradDistributionTestFixture, AgradDistributionsGamma_v_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_76, AgradDistributionTestFixture, AgradDistributionsGamma_v_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_77, AgradDistributionTestFixture, AgradDistributionsGamma_v_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_78, AgradDistributionTestFixture, AgradDistributionsGamma_v_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_79, AgradDistributionTestFixture, AgradDistributionsGamma_v_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_80, AgradDistributionTestFixture, AgradDistributionsGamma_v_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_81, AgradDistributionTestFixture, AgradDistributionsGamma_v_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_82, AgradDistributionTestFixture, AgradDistributionsGamma_v_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_83, AgradDistributionTestFixture, AgradDistributionsGamma_v_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_84, AgradDistributionTestFixture, AgradDistributionsGamma_v_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_85, AgradDistributionTestFixture, AgradDistributionsGamma_v_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_86, AgradDistributionTestFixture, AgradDistributionsGamma_v_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_87, AgradDistributionTestFixture, AgradDistributionsGamma_v_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_88, AgradDistributionTestFixture, AgradDistributionsGamma_v_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_89, AgradDistributionTestFixture, AgradDistributionsGamma_v_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_90, AgradDistributionTestFixture, AgradDistributionsGamma_v_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_91, AgradDistributionTestFixture, AgradDistributionsGamma_v_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_92, AgradDistributionTestFixture, AgradDistributionsGamma_v_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_93, AgradDistributionTestFixture, AgradDistributionsGamma_v_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_94, AgradDistributionTestFixture, AgradDistributionsGamma_v_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_95, AgradDistributionTestFixture, AgradDistributionsGamma_v_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_96, AgradDistributionTestFixture, AgradDistributionsGamma_v_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_97, AgradDistributionTestFixture, AgradDistributionsGamma_v_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_98, AgradDistributionTestFixture, AgradDistributionsGamma_v_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_v_99, AgradDistributionTestFixture, AgradDistributionsGamma_v_99);
+
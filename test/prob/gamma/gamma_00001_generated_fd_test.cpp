@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<fvar<double>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_100;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_101;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_102;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_103;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_104;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_105;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_106;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_107;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_108;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_109;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_110;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_111;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_112;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_113;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_114;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_115;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_116;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, empty, empty, empty> type_fd_117;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, empty, empty, empty> type_fd_118;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_119;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, fvar<double>, empty, empty, empty> type_fd_120;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_121;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_122;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, empty, empty, empty> type_fd_123;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fd_124;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_125;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_126;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_127;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_128;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_129;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_130;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_131;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_132;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_133;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_134;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, double, empty, empty, empty> type_fd_135;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_136;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_137;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_138;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_139;
+typedef boost::mpl::vector<std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_140;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_141;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_142;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_143;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_144;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_145;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_146;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_147;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_148;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_149;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_150;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_151;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_fd_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_fd_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty, empty, empty> type_fd_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty, empty, empty> type_fd_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_fd_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fd_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty, empty, empty> type_fd_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty, empty, empty> type_fd_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty, empty, empty> type_fd_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty, empty, empty> type_fd_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty, empty, empty> type_fd_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty, empty, empty> type_fd_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty, empty, empty> type_fd_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty, empty, empty> type_fd_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty, empty, empty> type_fd_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fd_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fd_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty, empty, empty> type_fd_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty, empty, empty> type_fd_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty, empty, empty> type_fd_188;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_100> AgradDistributionsGamma_fd_100;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_101> AgradDistributionsGamma_fd_101;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_102> AgradDistributionsGamma_fd_102;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_103> AgradDistributionsGamma_fd_103;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_104> AgradDistributionsGamma_fd_104;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_105> AgradDistributionsGamma_fd_105;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_106> AgradDistributionsGamma_fd_106;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_107> AgradDistributionsGamma_fd_107;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_108> AgradDistributionsGamma_fd_108;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_109> AgradDistributionsGamma_fd_109;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_110> AgradDistributionsGamma_fd_110;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_111> AgradDistributionsGamma_fd_111;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_112> AgradDistributionsGamma_fd_112;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_113> AgradDistributionsGamma_fd_113;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_114> AgradDistributionsGamma_fd_114;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_115> AgradDistributionsGamma_fd_115;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_116> AgradDistributionsGamma_fd_116;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_117> AgradDistributionsGamma_fd_117;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_118> AgradDistributionsGamma_fd_118;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_119> AgradDistributionsGamma_fd_119;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_120> AgradDistributionsGamma_fd_120;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_121> AgradDistributionsGamma_fd_121;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_122> AgradDistributionsGamma_fd_122;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_123> AgradDistributionsGamma_fd_123;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_124> AgradDistributionsGamma_fd_124;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_125> AgradDistributionsGamma_fd_125;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_126> AgradDistributionsGamma_fd_126;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_127> AgradDistributionsGamma_fd_127;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_128> AgradDistributionsGamma_fd_128;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_129> AgradDistributionsGamma_fd_129;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_130> AgradDistributionsGamma_fd_130;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_131> AgradDistributionsGamma_fd_131;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_132> AgradDistributionsGamma_fd_132;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_133> AgradDistributionsGamma_fd_133;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_134> AgradDistributionsGamma_fd_134;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_135> AgradDistributionsGamma_fd_135;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_136> AgradDistributionsGamma_fd_136;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_137> AgradDistributionsGamma_fd_137;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_138> AgradDistributionsGamma_fd_138;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_139> AgradDistributionsGamma_fd_139;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_140> AgradDistributionsGamma_fd_140;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_141> AgradDistributionsGamma_fd_141;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_142> AgradDistributionsGamma_fd_142;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_143> AgradDistributionsGamma_fd_143;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_144> AgradDistributionsGamma_fd_144;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_145> AgradDistributionsGamma_fd_145;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_146> AgradDistributionsGamma_fd_146;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_147> AgradDistributionsGamma_fd_147;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_148> AgradDistributionsGamma_fd_148;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_149> AgradDistributionsGamma_fd_149;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_150> AgradDistributionsGamma_fd_150;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_151> AgradDistributionsGamma_fd_151;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_152> AgradDistributionsGamma_fd_152;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_153> AgradDistributionsGamma_fd_153;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_154> AgradDistributionsGamma_fd_154;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_155> AgradDistributionsGamma_fd_155;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_156> AgradDistributionsGamma_fd_156;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_157> AgradDistributionsGamma_fd_157;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_158> AgradDistributionsGamma_fd_158;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_159> AgradDistributionsGamma_fd_159;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_160> AgradDistributionsGamma_fd_160;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_161> AgradDistributionsGamma_fd_161;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_162> AgradDistributionsGamma_fd_162;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_163> AgradDistributionsGamma_fd_163;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_164> AgradDistributionsGamma_fd_164;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_165> AgradDistributionsGamma_fd_165;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_166> AgradDistributionsGamma_fd_166;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_167> AgradDistributionsGamma_fd_167;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_168> AgradDistributionsGamma_fd_168;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_169> AgradDistributionsGamma_fd_169;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_170> AgradDistributionsGamma_fd_170;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_171> AgradDistributionsGamma_fd_171;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_172> AgradDistributionsGamma_fd_172;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_173> AgradDistributionsGamma_fd_173;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_174> AgradDistributionsGamma_fd_174;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_175> AgradDistributionsGamma_fd_175;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_176> AgradDistributionsGamma_fd_176;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_177> AgradDistributionsGamma_fd_177;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_178> AgradDistributionsGamma_fd_178;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_179> AgradDistributionsGamma_fd_179;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_180> AgradDistributionsGamma_fd_180;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_181> AgradDistributionsGamma_fd_181;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_182> AgradDistributionsGamma_fd_182;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_183> AgradDistributionsGamma_fd_183;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_184> AgradDistributionsGamma_fd_184;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_185> AgradDistributionsGamma_fd_185;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_186> AgradDistributionsGamma_fd_186;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_187> AgradDistributionsGamma_fd_187;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fd_188> AgradDistributionsGamma_fd_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_100, AgradDistributionTestFixture, AgradDistributionsGamma_fd_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_101, AgradDistributionTestFixture, AgradDistributionsGamma_fd_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_102, AgradDistributionTestFixture, AgradDistributionsGamma_fd_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_103, AgradDistributionTestFixture, AgradDistributionsGamma_fd_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_104, AgradDistributionTestFixture, AgradDistributionsGamma_fd_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_105, AgradDistributionTestFixture, AgradDistributionsGamma_fd_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_106, AgradDistributionTestFixture, AgradDistributionsGamma_fd_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_107, AgradDistributionTestFixture, AgradDistributionsGamma_fd_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_108, AgradDistributionTestFixture, AgradDistributionsGamma_fd_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_109, AgradDistributionTestFixture, AgradDistributionsGamma_fd_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_110, AgradDistributionTestFixture, AgradDistributionsGamma_fd_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_111, AgradDistributionTestFixture, AgradDistributionsGamma_fd_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_112, AgradDistributionTestFixture, AgradDistributionsGamma_fd_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_113, AgradDistributionTestFixture, AgradDistributionsGamma_fd_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_114, AgradDistributionTestFixture, AgradDistributionsGamma_fd_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_115, AgradDistributionTestFixture, AgradDistributionsGamma_fd_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_116, AgradDistributionTestFixture, AgradDistributionsGamma_fd_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_117, AgradDistributionTestFixture, AgradDistributionsGamma_fd_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_118, AgradDistributionTestFixture, AgradDistributionsGamma_fd_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_119, AgradDistributionTestFixture, AgradDistributionsGamma_fd_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_120, AgradDistributionTestFixture, AgradDistributionsGamma_fd_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_121, AgradDistributionTestFixture, AgradDistributionsGamma_fd_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_122, AgradDistributionTestFixture, AgradDistributionsGamma_fd_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_123, AgradDistributionTestFixture, AgradDistributionsGamma_fd_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_124, AgradDistributionTestFixture, AgradDistributionsGamma_fd_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_125, AgradDistributionTestFixture, AgradDistributionsGamma_fd_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_126, AgradDistributionTestFixture, AgradDistributionsGamma_fd_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_127, AgradDistributionTestFixture, AgradDistributionsGamma_fd_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_128, AgradDistributionTestFixture, AgradDistributionsGamma_fd_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_129, AgradDistributionTestFixture, AgradDistributionsGamma_fd_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_130, AgradDistributionTestFixture, AgradDistributionsGamma_fd_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_131, AgradDistributionTestFixture, AgradDistributionsGamma_fd_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_132, AgradDistributionTestFixture, AgradDistributionsGamma_fd_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_133, AgradDistributionTestFixture, AgradDistributionsGamma_fd_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_134, AgradDistributionTestFixture, AgradDistributionsGamma_fd_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_135, AgradDistributionTestFixture, AgradDistributionsGamma_fd_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_136, AgradDistributionTestFixture, AgradDistributionsGamma_fd_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_137, AgradDistributionTestFixture, AgradDistributionsGamma_fd_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_138, AgradDistributionTestFixture, AgradDistributionsGamma_fd_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_139, AgradDistributionTestFixture, AgradDistributionsGamma_fd_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_140, AgradDistributionTestFixture, AgradDistributionsGamma_fd_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_141, AgradDistributionTestFixture, AgradDistributionsGamma_fd_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_142, AgradDistributionTestFixture, AgradDistributionsGamma_fd_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_143, AgradDistributionTestFixture, AgradDistributionsGamma_fd_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_144, AgradDistributionTestFixture, AgradDistributionsGamma_fd_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_145, AgradDistributionTestFixture, AgradDistributionsGamma_fd_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_146, AgradDistributionTestFixture, AgradDistributionsGamma_fd_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_147, AgradDistributionTestFixture, AgradDistributionsGamma_fd_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_148, AgradDistributionTestFixture, AgradDistributionsGamma_fd_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_149, AgradDistributionTestFixture, AgradDistributionsGamma_fd_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_150, AgradDistributionTestFixture, AgradDistributionsGamma_fd_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_151, AgradDistributionTestFixture, AgradDistributionsGamma_fd_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_152, AgradDistributionTestFixture, AgradDistributionsGamma_fd_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_153, AgradDistributionTestFixture, AgradDistributionsGamma_fd_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_154, AgradDistributionTestFixture, AgradDistributionsGamma_fd_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_155, AgradDistributionTestFixture, AgradDistributionsGamma_fd_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_156, AgradDistributionTestFixture, AgradDistributionsGamma_fd_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_157, AgradDistributionTestFixture, AgradDistributionsGamma_fd_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_158, AgradDistributionTestFixture, AgradDistributionsGamma_fd_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_159, AgradDistributionTestFixture, AgradDistributionsGamma_fd_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_160, AgradDistributionTestFixture, AgradDistributionsGamma_fd_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_161, AgradDistributionTestFixture, AgradDistributionsGamma_fd_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_162, AgradDistributionTestFixture, AgradDistributionsGamma_fd_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_163, AgradDistributionTestFixture, AgradDistributionsGamma_fd_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_164, AgradDistributionTestFixture, AgradDistributionsGamma_fd_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_165, AgradDistributionTestFixture, AgradDistributionsGamma_fd_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_166, AgradDistributionTestFixture, AgradDistributionsGamma_fd_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_167, AgradDistributionTestFixture, AgradDistributionsGamma_fd_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_168, AgradDistributionTestFixture, AgradDistributionsGamma_fd_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_169, AgradDistributionTestFixture, AgradDistributionsGamma_fd_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_170, AgradDistributionTestFixture, AgradDistributionsGamma_fd_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_171, AgradDistributionTestFixture, AgradDistributionsGamma_fd_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_172, AgradDistributionTestFixture, AgradDistributionsGamma_fd_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_173, AgradDistributionTestFixture, AgradDistributionsGamma_fd_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_174, AgradDistributionTestFixture, AgradDistributionsGamma_fd_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_175, AgradDistributionTestFixture, AgradDistributionsGamma_fd_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_176, AgradDistributionTestFixture, AgradDistributionsGamma_fd_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_177, AgradDistributionTestFixture, AgradDistributionsGamma_fd_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_178, AgradDistributionTestFixture, AgradDistributionsGamma_fd_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_179, AgradDistributionTestFixture, AgradDistributionsGamma_fd_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_180, AgradDistributionTestFixture, AgradDistributionsGamma_fd_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_181, AgradDistributionTestFixture, AgradDistributionsGamma_fd_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_182, AgradDistributionTestFixture, AgradDistributionsGamma_fd_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_183, AgradDistributionTestFixture, AgradDistributionsGamma_fd_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_184, AgradDistributionTestFixture, AgradDistributionsGamma_fd_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_185, AgradDistributionTestFixture, AgradDistributionsGamma_fd_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_186, AgradDistributionTestFixture, AgradDistributionsGamma_fd_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_187, AgradDistributionTestFixture, AgradDistributionsGamma_fd_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fd_188, AgradDistributionTestFixture, AgradDistributionsGamma_fd_188);
+
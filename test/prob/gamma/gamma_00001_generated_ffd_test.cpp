@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_100;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_101;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_102;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_103;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_104;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_105;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_106;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_107;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_108;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_109;
+typedef boost::mpl::vector<fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_110;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_111;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_112;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_113;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_114;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_115;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_116;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, double, empty, empty, empty> type_ffd_117;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty, empty, empty> type_ffd_118;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_119;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_120;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_121;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_122;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty, empty, empty> type_ffd_123;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffd_124;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_125;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_126;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_127;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_128;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_129;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_130;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_131;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_132;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_133;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_134;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_135;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_136;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_137;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_138;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_139;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_140;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_141;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_142;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_143;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_144;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_145;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_146;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_147;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_148;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_149;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_150;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_151;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffd_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffd_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty, empty, empty> type_ffd_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffd_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffd_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty, empty, empty> type_ffd_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty, empty, empty> type_ffd_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty, empty, empty> type_ffd_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty, empty, empty> type_ffd_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty, empty, empty> type_ffd_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty, empty, empty> type_ffd_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty, empty, empty> type_ffd_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffd_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffd_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty, empty, empty> type_ffd_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty, empty, empty> type_ffd_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffd_188;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_100> AgradDistributionsGamma_ffd_100;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_101> AgradDistributionsGamma_ffd_101;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_102> AgradDistributionsGamma_ffd_102;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_103> AgradDistributionsGamma_ffd_103;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_104> AgradDistributionsGamma_ffd_104;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_105> AgradDistributionsGamma_ffd_105;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_106> AgradDistributionsGamma_ffd_106;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_107> AgradDistributionsGamma_ffd_107;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_108> AgradDistributionsGamma_ffd_108;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_109> AgradDistributionsGamma_ffd_109;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_110> AgradDistributionsGamma_ffd_110;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_111> AgradDistributionsGamma_ffd_111;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_112> AgradDistributionsGamma_ffd_112;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_113> AgradDistributionsGamma_ffd_113;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_114> AgradDistributionsGamma_ffd_114;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_115> AgradDistributionsGamma_ffd_115;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_116> AgradDistributionsGamma_ffd_116;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_117> AgradDistributionsGamma_ffd_117;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_118> AgradDistributionsGamma_ffd_118;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_119> AgradDistributionsGamma_ffd_119;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_120> AgradDistributionsGamma_ffd_120;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_121> AgradDistributionsGamma_ffd_121;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_122> AgradDistributionsGamma_ffd_122;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_123> AgradDistributionsGamma_ffd_123;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_124> AgradDistributionsGamma_ffd_124;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_125> AgradDistributionsGamma_ffd_125;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_126> AgradDistributionsGamma_ffd_126;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_127> AgradDistributionsGamma_ffd_127;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_128> AgradDistributionsGamma_ffd_128;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_129> AgradDistributionsGamma_ffd_129;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_130> AgradDistributionsGamma_ffd_130;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_131> AgradDistributionsGamma_ffd_131;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_132> AgradDistributionsGamma_ffd_132;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_133> AgradDistributionsGamma_ffd_133;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_134> AgradDistributionsGamma_ffd_134;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_135> AgradDistributionsGamma_ffd_135;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_136> AgradDistributionsGamma_ffd_136;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_137> AgradDistributionsGamma_ffd_137;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_138> AgradDistributionsGamma_ffd_138;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_139> AgradDistributionsGamma_ffd_139;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_140> AgradDistributionsGamma_ffd_140;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_141> AgradDistributionsGamma_ffd_141;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_142> AgradDistributionsGamma_ffd_142;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_143> AgradDistributionsGamma_ffd_143;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_144> AgradDistributionsGamma_ffd_144;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_145> AgradDistributionsGamma_ffd_145;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_146> AgradDistributionsGamma_ffd_146;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_147> AgradDistributionsGamma_ffd_147;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_148> AgradDistributionsGamma_ffd_148;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_149> AgradDistributionsGamma_ffd_149;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_150> AgradDistributionsGamma_ffd_150;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_151> AgradDistributionsGamma_ffd_151;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_152> AgradDistributionsGamma_ffd_152;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_153> AgradDistributionsGamma_ffd_153;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_154> AgradDistributionsGamma_ffd_154;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_155> AgradDistributionsGamma_ffd_155;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_156> AgradDistributionsGamma_ffd_156;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_157> AgradDistributionsGamma_ffd_157;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_158> AgradDistributionsGamma_ffd_158;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_159> AgradDistributionsGamma_ffd_159;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_160> AgradDistributionsGamma_ffd_160;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_161> AgradDistributionsGamma_ffd_161;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_162> AgradDistributionsGamma_ffd_162;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_163> AgradDistributionsGamma_ffd_163;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_164> AgradDistributionsGamma_ffd_164;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_165> AgradDistributionsGamma_ffd_165;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_166> AgradDistributionsGamma_ffd_166;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_167> AgradDistributionsGamma_ffd_167;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_168> AgradDistributionsGamma_ffd_168;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_169> AgradDistributionsGamma_ffd_169;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_170> AgradDistributionsGamma_ffd_170;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_171> AgradDistributionsGamma_ffd_171;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_172> AgradDistributionsGamma_ffd_172;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_173> AgradDistributionsGamma_ffd_173;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_174> AgradDistributionsGamma_ffd_174;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_175> AgradDistributionsGamma_ffd_175;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_176> AgradDistributionsGamma_ffd_176;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_177> AgradDistributionsGamma_ffd_177;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_178> AgradDistributionsGamma_ffd_178;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_179> AgradDistributionsGamma_ffd_179;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_180> AgradDistributionsGamma_ffd_180;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_181> AgradDistributionsGamma_ffd_181;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_182> AgradDistributionsGamma_ffd_182;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_183> AgradDistributionsGamma_ffd_183;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_184> AgradDistributionsGamma_ffd_184;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_185> AgradDistributionsGamma_ffd_185;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_186> AgradDistributionsGamma_ffd_186;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_187> AgradDistributionsGamma_ffd_187;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffd_188> AgradDistributionsGamma_ffd_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_100, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_101, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_102, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_103, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_104, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_105, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_106, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_107, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_108, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_109, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_110, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_111, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_112, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_113, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_114, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_115, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_116, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_117, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_118, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_119, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_120, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_121, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_122, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_123, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_124, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_125, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_126, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_127, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_128, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_129, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_130, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_131, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_132, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_133, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_134, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_135, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_136, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_137, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_138, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_139, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_140, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_141, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_142, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_143, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_144, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_145, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_146, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_147, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_148, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_149, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_150, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_151, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_152, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_153, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_154, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_155, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_156, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_157, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_158, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_159, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_160, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_161, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_162, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_163, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_164, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_165, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_166, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_167, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_168, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_169, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_170, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_171, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_172, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_173, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_174, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_175, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_176, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_177, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_178, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_179, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_180, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_181, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_182, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_183, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_184, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_185, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_186, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_187, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffd_188, AgradDistributionTestFixture, AgradDistributionsGamma_ffd_188);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef boost::mpl::vector<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef boost::mpl::vector<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef boost::mpl::vector<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_100> AgradDistributionsGamma_ffv_100;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_101> AgradDistributionsGamma_ffv_101;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_102> AgradDistributionsGamma_ffv_102;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_103> AgradDistributionsGamma_ffv_103;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_104> AgradDistributionsGamma_ffv_104;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_105> AgradDistributionsGamma_ffv_105;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_106> AgradDistributionsGamma_ffv_106;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_107> AgradDistributionsGamma_ffv_107;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_108> AgradDistributionsGamma_ffv_108;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_109> AgradDistributionsGamma_ffv_109;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_110> AgradDistributionsGamma_ffv_110;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_111> AgradDistributionsGamma_ffv_111;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_112> AgradDistributionsGamma_ffv_112;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_113> AgradDistributionsGamma_ffv_113;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_114> AgradDistributionsGamma_ffv_114;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_115> AgradDistributionsGamma_ffv_115;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_116> AgradDistributionsGamma_ffv_116;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_117> AgradDistributionsGamma_ffv_117;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_118> AgradDistributionsGamma_ffv_118;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_119> AgradDistributionsGamma_ffv_119;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_120> AgradDistributionsGamma_ffv_120;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_121> AgradDistributionsGamma_ffv_121;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_122> AgradDistributionsGamma_ffv_122;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_123> AgradDistributionsGamma_ffv_123;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_124> AgradDistributionsGamma_ffv_124;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_125> AgradDistributionsGamma_ffv_125;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_126> AgradDistributionsGamma_ffv_126;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_127> AgradDistributionsGamma_ffv_127;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_128> AgradDistributionsGamma_ffv_128;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_129> AgradDistributionsGamma_ffv_129;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_130> AgradDistributionsGamma_ffv_130;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_131> AgradDistributionsGamma_ffv_131;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_132> AgradDistributionsGamma_ffv_132;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_133> AgradDistributionsGamma_ffv_133;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_134> AgradDistributionsGamma_ffv_134;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_135> AgradDistributionsGamma_ffv_135;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_136> AgradDistributionsGamma_ffv_136;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_137> AgradDistributionsGamma_ffv_137;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_138> AgradDistributionsGamma_ffv_138;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_139> AgradDistributionsGamma_ffv_139;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_140> AgradDistributionsGamma_ffv_140;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_141> AgradDistributionsGamma_ffv_141;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_142> AgradDistributionsGamma_ffv_142;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_143> AgradDistributionsGamma_ffv_143;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_144> AgradDistributionsGamma_ffv_144;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_145> AgradDistributionsGamma_ffv_145;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_146> AgradDistributionsGamma_ffv_146;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_147> AgradDistributionsGamma_ffv_147;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_148> AgradDistributionsGamma_ffv_148;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_149> AgradDistributionsGamma_ffv_149;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_150> AgradDistributionsGamma_ffv_150;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_151> AgradDistributionsGamma_ffv_151;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_152> AgradDistributionsGamma_ffv_152;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_153> AgradDistributionsGamma_ffv_153;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_154> AgradDistributionsGamma_ffv_154;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_155> AgradDistributionsGamma_ffv_155;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_156> AgradDistributionsGamma_ffv_156;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_157> AgradDistributionsGamma_ffv_157;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_158> AgradDistributionsGamma_ffv_158;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_159> AgradDistributionsGamma_ffv_159;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_160> AgradDistributionsGamma_ffv_160;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_161> AgradDistributionsGamma_ffv_161;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_162> AgradDistributionsGamma_ffv_162;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_163> AgradDistributionsGamma_ffv_163;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_164> AgradDistributionsGamma_ffv_164;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_165> AgradDistributionsGamma_ffv_165;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_166> AgradDistributionsGamma_ffv_166;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_167> AgradDistributionsGamma_ffv_167;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_168> AgradDistributionsGamma_ffv_168;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_169> AgradDistributionsGamma_ffv_169;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_170> AgradDistributionsGamma_ffv_170;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_171> AgradDistributionsGamma_ffv_171;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_172> AgradDistributionsGamma_ffv_172;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_173> AgradDistributionsGamma_ffv_173;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_174> AgradDistributionsGamma_ffv_174;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_175> AgradDistributionsGamma_ffv_175;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_176> AgradDistributionsGamma_ffv_176;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_177> AgradDistributionsGamma_ffv_177;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_178> AgradDistributionsGamma_ffv_178;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_179> AgradDistributionsGamma_ffv_179;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_180> AgradDistributionsGamma_ffv_180;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_181> AgradDistributionsGamma_ffv_181;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_182> AgradDistributionsGamma_ffv_182;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_183> AgradDistributionsGamma_ffv_183;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_184> AgradDistributionsGamma_ffv_184;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_185> AgradDistributionsGamma_ffv_185;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_186> AgradDistributionsGamma_ffv_186;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_187> AgradDistributionsGamma_ffv_187;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_ffv_188> AgradDistributionsGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_100, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_101, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_102, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_103, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_104, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_105, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_106, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_107, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_108, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_109, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_110, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_111, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_112, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_113, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_114, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_115, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_116, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_117, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_118, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_119, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_120, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_121, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_122, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_123, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_124, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_125, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_126, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_127, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_128, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_129, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_130, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_131, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_132, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_133, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_134, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_135, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_136, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_137, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_138, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_139, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_140, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_141, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_142, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_143, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_144, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_145, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_146, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_147, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_148, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_149, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_150, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_151, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_152, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_153, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_154, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_155, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_156, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_157, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_158, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_159, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_160, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_161, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_162, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_163, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_164, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_165, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_166, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_167, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_168, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_169, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_170, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_171, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_172, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_173, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_174, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_175, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_176, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_177, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_178, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_179, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_180, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_181, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_182, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_183, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_184, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_185, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_186, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_187, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_ffv_188, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_188);
+
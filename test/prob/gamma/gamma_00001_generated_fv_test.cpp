@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_100;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_101;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_102;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_103;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_104;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_105;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_106;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_107;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_108;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_109;
+typedef boost::mpl::vector<fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_110;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_111;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_112;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_113;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_114;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_115;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_116;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, empty, empty, empty> type_fv_117;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, empty, empty, empty> type_fv_118;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_119;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, fvar<var>, empty, empty, empty> type_fv_120;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_121;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_122;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, double, empty, empty, empty> type_fv_123;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fv_124;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_125;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_126;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_127;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_128;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_129;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_130;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_131;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_132;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_133;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_134;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, empty, empty, empty> type_fv_135;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_136;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_137;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_138;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_139;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_140;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_141;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_142;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_143;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_144;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_145;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_146;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_147;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_148;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_149;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_150;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_151;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_fv_153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_fv_154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty, empty, empty> type_fv_156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty, empty, empty> type_fv_157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_fv_159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_fv_160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty, empty, empty> type_fv_162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty, empty, empty> type_fv_163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty, empty, empty> type_fv_171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty, empty, empty> type_fv_172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty, empty, empty> type_fv_174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty, empty, empty> type_fv_175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty, empty, empty> type_fv_177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty, empty, empty> type_fv_178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty, empty, empty> type_fv_180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty, empty, empty> type_fv_181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty, empty, empty> type_fv_183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_fv_184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty, empty, empty> type_fv_186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty, empty, empty> type_fv_187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty, empty, empty> type_fv_188;
+
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_100> AgradDistributionsGamma_fv_100;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_101> AgradDistributionsGamma_fv_101;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_102> AgradDistributionsGamma_fv_102;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_103> AgradDistributionsGamma_fv_103;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_104> AgradDistributionsGamma_fv_104;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_105> AgradDistributionsGamma_fv_105;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_106> AgradDistributionsGamma_fv_106;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_107> AgradDistributionsGamma_fv_107;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_108> AgradDistributionsGamma_fv_108;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_109> AgradDistributionsGamma_fv_109;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_110> AgradDistributionsGamma_fv_110;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_111> AgradDistributionsGamma_fv_111;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_112> AgradDistributionsGamma_fv_112;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_113> AgradDistributionsGamma_fv_113;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_114> AgradDistributionsGamma_fv_114;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_115> AgradDistributionsGamma_fv_115;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_116> AgradDistributionsGamma_fv_116;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_117> AgradDistributionsGamma_fv_117;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_118> AgradDistributionsGamma_fv_118;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_119> AgradDistributionsGamma_fv_119;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_120> AgradDistributionsGamma_fv_120;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_121> AgradDistributionsGamma_fv_121;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_122> AgradDistributionsGamma_fv_122;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_123> AgradDistributionsGamma_fv_123;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_124> AgradDistributionsGamma_fv_124;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_125> AgradDistributionsGamma_fv_125;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_126> AgradDistributionsGamma_fv_126;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_127> AgradDistributionsGamma_fv_127;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_128> AgradDistributionsGamma_fv_128;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_129> AgradDistributionsGamma_fv_129;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_130> AgradDistributionsGamma_fv_130;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_131> AgradDistributionsGamma_fv_131;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_132> AgradDistributionsGamma_fv_132;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_133> AgradDistributionsGamma_fv_133;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_134> AgradDistributionsGamma_fv_134;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_135> AgradDistributionsGamma_fv_135;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_136> AgradDistributionsGamma_fv_136;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_137> AgradDistributionsGamma_fv_137;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_138> AgradDistributionsGamma_fv_138;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_139> AgradDistributionsGamma_fv_139;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_140> AgradDistributionsGamma_fv_140;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_141> AgradDistributionsGamma_fv_141;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_142> AgradDistributionsGamma_fv_142;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_143> AgradDistributionsGamma_fv_143;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_144> AgradDistributionsGamma_fv_144;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_145> AgradDistributionsGamma_fv_145;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_146> AgradDistributionsGamma_fv_146;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_147> AgradDistributionsGamma_fv_147;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_148> AgradDistributionsGamma_fv_148;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_149> AgradDistributionsGamma_fv_149;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_150> AgradDistributionsGamma_fv_150;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_151> AgradDistributionsGamma_fv_151;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_152> AgradDistributionsGamma_fv_152;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_153> AgradDistributionsGamma_fv_153;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_154> AgradDistributionsGamma_fv_154;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_155> AgradDistributionsGamma_fv_155;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_156> AgradDistributionsGamma_fv_156;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_157> AgradDistributionsGamma_fv_157;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_158> AgradDistributionsGamma_fv_158;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_159> AgradDistributionsGamma_fv_159;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_160> AgradDistributionsGamma_fv_160;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_161> AgradDistributionsGamma_fv_161;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_162> AgradDistributionsGamma_fv_162;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_163> AgradDistributionsGamma_fv_163;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_164> AgradDistributionsGamma_fv_164;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_165> AgradDistributionsGamma_fv_165;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_166> AgradDistributionsGamma_fv_166;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_167> AgradDistributionsGamma_fv_167;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_168> AgradDistributionsGamma_fv_168;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_169> AgradDistributionsGamma_fv_169;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_170> AgradDistributionsGamma_fv_170;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_171> AgradDistributionsGamma_fv_171;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_172> AgradDistributionsGamma_fv_172;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_173> AgradDistributionsGamma_fv_173;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_174> AgradDistributionsGamma_fv_174;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_175> AgradDistributionsGamma_fv_175;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_176> AgradDistributionsGamma_fv_176;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_177> AgradDistributionsGamma_fv_177;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_178> AgradDistributionsGamma_fv_178;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_179> AgradDistributionsGamma_fv_179;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_180> AgradDistributionsGamma_fv_180;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_181> AgradDistributionsGamma_fv_181;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_182> AgradDistributionsGamma_fv_182;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_183> AgradDistributionsGamma_fv_183;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_184> AgradDistributionsGamma_fv_184;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_185> AgradDistributionsGamma_fv_185;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_186> AgradDistributionsGamma_fv_186;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_187> AgradDistributionsGamma_fv_187;
+typedef boost::mpl::vector<AgradDistributionsGamma, type_fv_188> AgradDistributionsGamma_fv_188;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_100, AgradDistributionTestFixture, AgradDistributionsGamma_fv_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_101, AgradDistributionTestFixture, AgradDistributionsGamma_fv_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_102, AgradDistributionTestFixture, AgradDistributionsGamma_fv_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_103, AgradDistributionTestFixture, AgradDistributionsGamma_fv_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_104, AgradDistributionTestFixture, AgradDistributionsGamma_fv_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_105, AgradDistributionTestFixture, AgradDistributionsGamma_fv_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_106, AgradDistributionTestFixture, AgradDistributionsGamma_fv_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_107, AgradDistributionTestFixture, AgradDistributionsGamma_fv_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_108, AgradDistributionTestFixture, AgradDistributionsGamma_fv_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_109, AgradDistributionTestFixture, AgradDistributionsGamma_fv_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_110, AgradDistributionTestFixture, AgradDistributionsGamma_fv_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_111, AgradDistributionTestFixture, AgradDistributionsGamma_fv_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_112, AgradDistributionTestFixture, AgradDistributionsGamma_fv_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_113, AgradDistributionTestFixture, AgradDistributionsGamma_fv_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_114, AgradDistributionTestFixture, AgradDistributionsGamma_fv_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_115, AgradDistributionTestFixture, AgradDistributionsGamma_fv_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_116, AgradDistributionTestFixture, AgradDistributionsGamma_fv_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_117, AgradDistributionTestFixture, AgradDistributionsGamma_fv_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_118, AgradDistributionTestFixture, AgradDistributionsGamma_fv_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_119, AgradDistributionTestFixture, AgradDistributionsGamma_fv_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_120, AgradDistributionTestFixture, AgradDistributionsGamma_fv_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_121, AgradDistributionTestFixture, AgradDistributionsGamma_fv_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_122, AgradDistributionTestFixture, AgradDistributionsGamma_fv_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_123, AgradDistributionTestFixture, AgradDistributionsGamma_fv_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_124, AgradDistributionTestFixture, AgradDistributionsGamma_fv_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_125, AgradDistributionTestFixture, AgradDistributionsGamma_fv_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_126, AgradDistributionTestFixture, AgradDistributionsGamma_fv_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_127, AgradDistributionTestFixture, AgradDistributionsGamma_fv_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_128, AgradDistributionTestFixture, AgradDistributionsGamma_fv_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_129, AgradDistributionTestFixture, AgradDistributionsGamma_fv_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_130, AgradDistributionTestFixture, AgradDistributionsGamma_fv_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_131, AgradDistributionTestFixture, AgradDistributionsGamma_fv_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_132, AgradDistributionTestFixture, AgradDistributionsGamma_fv_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_133, AgradDistributionTestFixture, AgradDistributionsGamma_fv_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_134, AgradDistributionTestFixture, AgradDistributionsGamma_fv_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_135, AgradDistributionTestFixture, AgradDistributionsGamma_fv_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_136, AgradDistributionTestFixture, AgradDistributionsGamma_fv_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_137, AgradDistributionTestFixture, AgradDistributionsGamma_fv_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_138, AgradDistributionTestFixture, AgradDistributionsGamma_fv_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_139, AgradDistributionTestFixture, AgradDistributionsGamma_fv_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_140, AgradDistributionTestFixture, AgradDistributionsGamma_fv_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_141, AgradDistributionTestFixture, AgradDistributionsGamma_fv_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_142, AgradDistributionTestFixture, AgradDistributionsGamma_fv_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_143, AgradDistributionTestFixture, AgradDistributionsGamma_fv_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_144, AgradDistributionTestFixture, AgradDistributionsGamma_fv_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_145, AgradDistributionTestFixture, AgradDistributionsGamma_fv_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_146, AgradDistributionTestFixture, AgradDistributionsGamma_fv_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_147, AgradDistributionTestFixture, AgradDistributionsGamma_fv_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_148, AgradDistributionTestFixture, AgradDistributionsGamma_fv_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_149, AgradDistributionTestFixture, AgradDistributionsGamma_fv_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_150, AgradDistributionTestFixture, AgradDistributionsGamma_fv_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_151, AgradDistributionTestFixture, AgradDistributionsGamma_fv_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_152, AgradDistributionTestFixture, AgradDistributionsGamma_fv_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_153, AgradDistributionTestFixture, AgradDistributionsGamma_fv_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_154, AgradDistributionTestFixture, AgradDistributionsGamma_fv_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_155, AgradDistributionTestFixture, AgradDistributionsGamma_fv_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_156, AgradDistributionTestFixture, AgradDistributionsGamma_fv_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_157, AgradDistributionTestFixture, AgradDistributionsGamma_fv_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_158, AgradDistributionTestFixture, AgradDistributionsGamma_fv_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_159, AgradDistributionTestFixture, AgradDistributionsGamma_fv_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_160, AgradDistributionTestFixture, AgradDistributionsGamma_fv_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_161, AgradDistributionTestFixture, AgradDistributionsGamma_fv_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_162, AgradDistributionTestFixture, AgradDistributionsGamma_fv_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_163, AgradDistributionTestFixture, AgradDistributionsGamma_fv_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_164, AgradDistributionTestFixture, AgradDistributionsGamma_fv_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_165, AgradDistributionTestFixture, AgradDistributionsGamma_fv_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_166, AgradDistributionTestFixture, AgradDistributionsGamma_fv_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_167, AgradDistributionTestFixture, AgradDistributionsGamma_fv_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_168, AgradDistributionTestFixture, AgradDistributionsGamma_fv_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_169, AgradDistributionTestFixture, AgradDistributionsGamma_fv_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_170, AgradDistributionTestFixture, AgradDistributionsGamma_fv_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_171, AgradDistributionTestFixture, AgradDistributionsGamma_fv_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_172, AgradDistributionTestFixture, AgradDistributionsGamma_fv_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_173, AgradDistributionTestFixture, AgradDistributionsGamma_fv_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_174, AgradDistributionTestFixture, AgradDistributionsGamma_fv_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_175, AgradDistributionTestFixture, AgradDistributionsGamma_fv_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_176, AgradDistributionTestFixture, AgradDistributionsGamma_fv_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_177, AgradDistributionTestFixture, AgradDistributionsGamma_fv_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_178, AgradDistributionTestFixture, AgradDistributionsGamma_fv_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_179, AgradDistributionTestFixture, AgradDistributionsGamma_fv_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_180, AgradDistributionTestFixture, AgradDistributionsGamma_fv_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_181, AgradDistributionTestFixture, AgradDistributionsGamma_fv_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_182, AgradDistributionTestFixture, AgradDistributionsGamma_fv_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_183, AgradDistributionTestFixture, AgradDistributionsGamma_fv_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_184, AgradDistributionTestFixture, AgradDistributionsGamma_fv_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_185, AgradDistributionTestFixture, AgradDistributionsGamma_fv_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_186, AgradDistributionTestFixture, AgradDistributionsGamma_fv_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_187, AgradDistributionTestFixture, AgradDistributionsGamma_fv_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionsGamma_fv_188, AgradDistributionTestFixture, AgradDistributionsGamma_fv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, double, fvar<double>, empty> type_fd_0;
+typedef boost::mpl::vector<double, double, double, double, std::vector<fvar<double>>, empty> type_fd_1;
+typedef boost::mpl::vector<double, double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, fvar<double>, empty> type_fd_3;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_8;
+typedef boost::mpl::vector<double, double, double, fvar<double>, double, empty> type_fd_9;
+typedef boost::mpl::vector<double, double, double, fvar<double>, std::vector<double>, empty> type_fd_10;
+typedef boost::mpl::vector<double, double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_11;
+typedef boost::mpl::vector<double, double, double, fvar<double>, fvar<double>, empty> type_fd_12;
+typedef boost::mpl::vector<double, double, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_13;
+typedef boost::mpl::vector<double, double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_14;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<double>>, double, empty> type_fd_15;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_16;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_17;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_18;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_19;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_20;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_21;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_22;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_23;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_24;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_25;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_26;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, fvar<double>, empty> type_fd_27;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_28;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_29;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_30;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_31;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_32;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_33;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_34;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_35;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<double>, double, empty> type_fd_36;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_37;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_38;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_39;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_40;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_41;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_42;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_43;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_44;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_45;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_46;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_47;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_48;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_49;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_50;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_51;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_52;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_53;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_54;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_55;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_56;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_57;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_58;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_59;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_60;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_61;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_62;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_63;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_64;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_65;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_66;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_67;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_68;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_69;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_70;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_71;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_72;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_73;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_74;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_75;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_76;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_77;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_78;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_79;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_80;
+typedef boost::mpl::vector<double, double, fvar<double>, double, double, empty> type_fd_81;
+typedef boost::mpl::vector<double, double, fvar<double>, double, std::vector<double>, empty> type_fd_82;
+typedef boost::mpl::vector<double, double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_83;
+typedef boost::mpl::vector<double, double, fvar<double>, double, fvar<double>, empty> type_fd_84;
+typedef boost::mpl::vector<double, double, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_85;
+typedef boost::mpl::vector<double, double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_86;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<double>, double, empty> type_fd_87;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_88;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_89;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_90;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_91;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_92;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_93;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_94;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_95;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_96;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_97;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_98;
+typedef boost::mpl::vector<double, double, fvar<double>, fvar<double>, double, empty> type_fd_99;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_0> AgradDistributionWiener_fd_0;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1> AgradDistributionWiener_fd_1;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2> AgradDistributionWiener_fd_2;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3> AgradDistributionWiener_fd_3;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4> AgradDistributionWiener_fd_4;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5> AgradDistributionWiener_fd_5;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6> AgradDistributionWiener_fd_6;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7> AgradDistributionWiener_fd_7;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_8> AgradDistributionWiener_fd_8;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_9> AgradDistributionWiener_fd_9;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_10> AgradDistributionWiener_fd_10;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_11> AgradDistributionWiener_fd_11;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_12> AgradDistributionWiener_fd_12;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_13> AgradDistributionWiener_fd_13;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_14> AgradDistributionWiener_fd_14;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_15> AgradDistributionWiener_fd_15;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_16> AgradDistributionWiener_fd_16;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_17> AgradDistributionWiener_fd_17;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_18> AgradDistributionWiener_fd_18;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_19> AgradDistributionWiener_fd_19;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_20> AgradDistributionWiener_fd_20;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_21> AgradDistributionWiener_fd_21;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_22> AgradDistributionWiener_fd_22;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_23> AgradDistributionWiener_fd_23;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_24> AgradDistributionWiener_fd_24;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_25> AgradDistributionWiener_fd_25;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_26> AgradDistributionWiener_fd_26;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_27> AgradDistributionWiener_fd_27;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_28> AgradDistributionWiener_fd_28;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_29> AgradDistributionWiener_fd_29;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_30> AgradDistributionWiener_fd_30;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_31> AgradDistributionWiener_fd_31;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_32> AgradDistributionWiener_fd_32;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_33> AgradDistributionWiener_fd_33;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_34> AgradDistributionWiener_fd_34;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_35> AgradDistributionWiener_fd_35;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_36> AgradDistributionWiener_fd_36;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_37> AgradDistributionWiener_fd_37;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_38> AgradDistributionWiener_fd_38;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_39> AgradDistributionWiener_fd_39;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_40> AgradDistributionWiener_fd_40;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_41> AgradDistributionWiener_fd_41;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_42> AgradDistributionWiener_fd_42;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_43> AgradDistributionWiener_fd_43;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_44> AgradDistributionWiener_fd_44;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_45> AgradDistributionWiener_fd_45;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_46> AgradDistributionWiener_fd_46;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_47> AgradDistributionWiener_fd_47;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_48> AgradDistributionWiener_fd_48;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_49> AgradDistributionWiener_fd_49;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_50> AgradDistributionWiener_fd_50;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_51> AgradDistributionWiener_fd_51;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_52> AgradDistributionWiener_fd_52;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_53> AgradDistributionWiener_fd_53;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_54> AgradDistributionWiener_fd_54;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_55> AgradDistributionWiener_fd_55;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_56> AgradDistributionWiener_fd_56;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_57> AgradDistributionWiener_fd_57;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_58> AgradDistributionWiener_fd_58;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_59> AgradDistributionWiener_fd_59;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_60> AgradDistributionWiener_fd_60;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_61> AgradDistributionWiener_fd_61;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_62> AgradDistributionWiener_fd_62;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_63> AgradDistributionWiener_fd_63;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_64> AgradDistributionWiener_fd_64;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_65> AgradDistributionWiener_fd_65;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_66> AgradDistributionWiener_fd_66;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_67> AgradDistributionWiener_fd_67;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_68> AgradDistributionWiener_fd_68;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_69> AgradDistributionWiener_fd_69;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_70> AgradDistributionWiener_fd_70;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_71> AgradDistributionWiener_fd_71;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_72> AgradDistributionWiener_fd_72;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_73> AgradDistributionWiener_fd_73;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_74> AgradDistributionWiener_fd_74;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_75> AgradDistributionWiener_fd_75;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_76> AgradDistributionWiener_fd_76;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_77> AgradDistributionWiener_fd_77;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_78> AgradDistributionWiener_fd_78;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_79> AgradDistributionWiener_fd_79;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_80> AgradDistributionWiener_fd_80;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_81> AgradDistributionWiener_fd_81;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_82> AgradDistributionWiener_fd_82;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_83> AgradDistributionWiener_fd_83;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_84> AgradDistributionWiener_fd_84;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_85> AgradDistributionWiener_fd_85;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_86> AgradDistributionWiener_fd_86;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_87> AgradDistributionWiener_fd_87;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_88> AgradDistributionWiener_fd_88;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_89> AgradDistributionWiener_fd_89;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_90> AgradDistributionWiener_fd_90;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_91> AgradDistributionWiener_fd_91;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_92> AgradDistributionWiener_fd_92;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_93> AgradDistributionWiener_fd_93;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_94> AgradDistributionWiener_fd_94;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_95> AgradDistributionWiener_fd_95;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_96> AgradDistributionWiener_fd_96;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_97> AgradDistributionWiener_fd_97;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_98> AgradDistributionWiener_fd_98;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_99> AgradDistributionWiener_fd_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_0, AgradDistributionTestFixture, AgradDistributionWiener_fd_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1, AgradDistributionTestFixture, AgradDistributionWiener_fd_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2, AgradDistributionTestFixture, AgradDistributionWiener_fd_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3, AgradDistributionTestFixture, AgradDistributionWiener_fd_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4, AgradDistributionTestFixture, AgradDistributionWiener_fd_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5, AgradDistributionTestFixture, AgradDistributionWiener_fd_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6, AgradDistributionTestFixture, AgradDistributionWiener_fd_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7, AgradDistributionTestFixture, AgradDistributionWiener_fd_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_8, AgradDistributionTestFixture, AgradDistributionWiener_fd_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_9, AgradDistributionTestFixture, AgradDistributionWiener_fd_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_10, AgradDistributionTestFixture, AgradDistributionWiener_fd_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_11, AgradDistributionTestFixture, AgradDistributionWiener_fd_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_12, AgradDistributionTestFixture, AgradDistributionWiener_fd_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_13, AgradDistributionTestFixture, AgradDistributionWiener_fd_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_14, AgradDistributionTestFixture, AgradDistributionWiener_fd_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_15, AgradDistributionTestFixture, AgradDistributionWiener_fd_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_16, AgradDistributionTestFixture, AgradDistributionWiener_fd_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_17, AgradDistributionTestFixture, AgradDistributionWiener_fd_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_18, AgradDistributionTestFixture, AgradDistributionWiener_fd_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_19, AgradDistributionTestFixture, AgradDistributionWiener_fd_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_20, AgradDistributionTestFixture, AgradDistributionWiener_fd_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_21, AgradDistributionTestFixture, AgradDistributionWiener_fd_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_22, AgradDistributionTestFixture, AgradDistributionWiener_fd_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_23, AgradDistributionTestFixture, AgradDistributionWiener_fd_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_24, AgradDistributionTestFixture, AgradDistributionWiener_fd_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_25, AgradDistributionTestFixture, AgradDistributionWiener_fd_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_26, AgradDistributionTestFixture, AgradDistributionWiener_fd_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_27, AgradDistributionTestFixture, AgradDistributionWiener_fd_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_28, AgradDistributionTestFixture, AgradDistributionWiener_fd_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_29, AgradDistributionTestFixture, AgradDistributionWiener_fd_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_30, AgradDistributionTestFixture, AgradDistributionWiener_fd_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_31, AgradDistributionTestFixture, AgradDistributionWiener_fd_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_32, AgradDistributionTestFixture, AgradDistributionWiener_fd_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_33, AgradDistributionTestFixture, AgradDistributionWiener_fd_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_34, AgradDistributionTestFixture, AgradDistributionWiener_fd_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_35, AgradDistributionTestFixture, AgradDistributionWiener_fd_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_36, AgradDistributionTestFixture, AgradDistributionWiener_fd_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_37, AgradDistributionTestFixture, AgradDistributionWiener_fd_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_38, AgradDistributionTestFixture, AgradDistributionWiener_fd_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_39, AgradDistributionTestFixture, AgradDistributionWiener_fd_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_40, AgradDistributionTestFixture, AgradDistributionWiener_fd_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_41, AgradDistributionTestFixture, AgradDistributionWiener_fd_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_42, AgradDistributionTestFixture, AgradDistributionWiener_fd_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_43, AgradDistributionTestFixture, AgradDistributionWiener_fd_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_44, AgradDistributionTestFixture, AgradDistributionWiener_fd_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_45, AgradDistributionTestFixture, AgradDistributionWiener_fd_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_46, AgradDistributionTestFixture, AgradDistributionWiener_fd_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_47, AgradDistributionTestFixture, AgradDistributionWiener_fd_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_48, AgradDistributionTestFixture, AgradDistributionWiener_fd_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_49, AgradDistributionTestFixture, AgradDistributionWiener_fd_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_50, AgradDistributionTestFixture, AgradDistributionWiener_fd_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_51, AgradDistributionTestFixture, AgradDistributionWiener_fd_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_52, AgradDistributionTestFixture, AgradDistributionWiener_fd_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_53, AgradDistributionTestFixture, AgradDistributionWiener_fd_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_54, AgradDistributionTestFixture, AgradDistributionWiener_fd_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_55, AgradDistributionTestFixture, AgradDistributionWiener_fd_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_56, AgradDistributionTestFixture, AgradDistributionWiener_fd_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_57, AgradDistributionTestFixture, AgradDistributionWiener_fd_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_58, AgradDistributionTestFixture, AgradDistributionWiener_fd_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_59, AgradDistributionTestFixture, AgradDistributionWiener_fd_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_60, AgradDistributionTestFixture, AgradDistributionWiener_fd_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_61, AgradDistributionTestFixture, AgradDistributionWiener_fd_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_62, AgradDistributionTestFixture, AgradDistributionWiener_fd_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_63, AgradDistributionTestFixture, AgradDistributionWiener_fd_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_64, AgradDistributionTestFixture, AgradDistributionWiener_fd_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_65, AgradDistributionTestFixture, AgradDistributionWiener_fd_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_66, AgradDistributionTestFixture, AgradDistributionWiener_fd_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_67, AgradDistributionTestFixture, AgradDistributionWiener_fd_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_68, AgradDistributionTestFixture, AgradDistributionWiener_fd_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_69, AgradDistributionTestFixture, AgradDistributionWiener_fd_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_70, AgradDistributionTestFixture, AgradDistributionWiener_fd_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_71, AgradDistributionTestFixture, AgradDistributionWiener_fd_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_72, AgradDistributionTestFixture, AgradDistributionWiener_fd_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_73, AgradDistributionTestFixture, AgradDistributionWiener_fd_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_74, AgradDistributionTestFixture, AgradDistributionWiener_fd_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_75, AgradDistributionTestFixture, AgradDistributionWiener_fd_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_76, AgradDistributionTestFixture, AgradDistributionWiener_fd_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_77, AgradDistributionTestFixture, AgradDistributionWiener_fd_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_78, AgradDistributionTestFixture, AgradDistributionWiener_fd_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_79, AgradDistributionTestFixture, AgradDistributionWiener_fd_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_80, AgradDistributionTestFixture, AgradDistributionWiener_fd_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_81, AgradDistributionTestFixture, AgradDistributionWiener_fd_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_82, AgradDistributionTestFixture, AgradDistributionWiener_fd_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_83, AgradDistributionTestFixture, AgradDistributionWiener_fd_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_84, AgradDistributionTestFixture, AgradDistributionWiener_fd_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_85, AgradDistributionTestFixture, AgradDistributionWiener_fd_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_86, AgradDistributionTestFixture, AgradDistributionWiener_fd_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_87, AgradDistributionTestFixture, AgradDistributionWiener_fd_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_88, AgradDistributionTestFixture, AgradDistributionWiener_fd_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_89, AgradDistributionTestFixture, AgradDistributionWiener_fd_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_90, AgradDistributionTestFixture, AgradDistributionWiener_fd_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_91, AgradDistributionTestFixture, AgradDistributionWiener_fd_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_92, AgradDistributionTestFixture, AgradDistributionWiener_fd_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_93, AgradDistributionTestFixture, AgradDistributionWiener_fd_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_94, AgradDistributionTestFixture, AgradDistributionWiener_fd_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_95, AgradDistributionTestFixture, AgradDistributionWiener_fd_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_96, AgradDistributionTestFixture, AgradDistributionWiener_fd_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_97, AgradDistributionTestFixture, AgradDistributionWiener_fd_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_98, AgradDistributionTestFixture, AgradDistributionWiener_fd_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_99, AgradDistributionTestFixture, AgradDistributionWiener_fd_99);
+
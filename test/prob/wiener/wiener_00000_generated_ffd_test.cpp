@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, double, fvar<fvar<double> >, empty> type_ffd_0;
+typedef boost::mpl::vector<double, double, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1;
+typedef boost::mpl::vector<double, double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_3;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_6;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_8;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<double> >, double, empty> type_ffd_9;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_10;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_11;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_12;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_13;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_14;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_15;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_16;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_17;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_18;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_19;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_20;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_21;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_22;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_23;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_24;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_25;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_26;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_27;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_28;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_29;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_30;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_31;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_32;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_33;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_34;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_35;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_36;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_37;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_38;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_39;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_40;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_41;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_42;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_43;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_44;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_45;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_46;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_47;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_48;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_49;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_50;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_51;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_52;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_53;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_54;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_55;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_56;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_57;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_58;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_59;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_60;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_61;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_62;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_63;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_64;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_65;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_66;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_67;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_68;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_69;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_70;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_71;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_72;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_73;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_74;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_75;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_76;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_77;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_78;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_79;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_80;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, double, double, empty> type_ffd_81;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_82;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_83;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_84;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_85;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_86;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_87;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_88;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_89;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_90;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_91;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_92;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_93;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_94;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_95;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_96;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_97;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_98;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_99;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_0> AgradDistributionWiener_ffd_0;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1> AgradDistributionWiener_ffd_1;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2> AgradDistributionWiener_ffd_2;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3> AgradDistributionWiener_ffd_3;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4> AgradDistributionWiener_ffd_4;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5> AgradDistributionWiener_ffd_5;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6> AgradDistributionWiener_ffd_6;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7> AgradDistributionWiener_ffd_7;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_8> AgradDistributionWiener_ffd_8;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_9> AgradDistributionWiener_ffd_9;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_10> AgradDistributionWiener_ffd_10;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_11> AgradDistributionWiener_ffd_11;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_12> AgradDistributionWiener_ffd_12;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_13> AgradDistributionWiener_ffd_13;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_14> AgradDistributionWiener_ffd_14;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_15> AgradDistributionWiener_ffd_15;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_16> AgradDistributionWiener_ffd_16;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_17> AgradDistributionWiener_ffd_17;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_18> AgradDistributionWiener_ffd_18;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_19> AgradDistributionWiener_ffd_19;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_20> AgradDistributionWiener_ffd_20;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_21> AgradDistributionWiener_ffd_21;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_22> AgradDistributionWiener_ffd_22;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_23> AgradDistributionWiener_ffd_23;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_24> AgradDistributionWiener_ffd_24;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_25> AgradDistributionWiener_ffd_25;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_26> AgradDistributionWiener_ffd_26;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_27> AgradDistributionWiener_ffd_27;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_28> AgradDistributionWiener_ffd_28;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_29> AgradDistributionWiener_ffd_29;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_30> AgradDistributionWiener_ffd_30;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_31> AgradDistributionWiener_ffd_31;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_32> AgradDistributionWiener_ffd_32;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_33> AgradDistributionWiener_ffd_33;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_34> AgradDistributionWiener_ffd_34;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_35> AgradDistributionWiener_ffd_35;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_36> AgradDistributionWiener_ffd_36;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_37> AgradDistributionWiener_ffd_37;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_38> AgradDistributionWiener_ffd_38;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_39> AgradDistributionWiener_ffd_39;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_40> AgradDistributionWiener_ffd_40;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_41> AgradDistributionWiener_ffd_41;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_42> AgradDistributionWiener_ffd_42;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_43> AgradDistributionWiener_ffd_43;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_44> AgradDistributionWiener_ffd_44;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_45> AgradDistributionWiener_ffd_45;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_46> AgradDistributionWiener_ffd_46;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_47> AgradDistributionWiener_ffd_47;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_48> AgradDistributionWiener_ffd_48;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_49> AgradDistributionWiener_ffd_49;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_50> AgradDistributionWiener_ffd_50;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_51> AgradDistributionWiener_ffd_51;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_52> AgradDistributionWiener_ffd_52;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_53> AgradDistributionWiener_ffd_53;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_54> AgradDistributionWiener_ffd_54;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_55> AgradDistributionWiener_ffd_55;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_56> AgradDistributionWiener_ffd_56;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_57> AgradDistributionWiener_ffd_57;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_58> AgradDistributionWiener_ffd_58;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_59> AgradDistributionWiener_ffd_59;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_60> AgradDistributionWiener_ffd_60;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_61> AgradDistributionWiener_ffd_61;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_62> AgradDistributionWiener_ffd_62;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_63> AgradDistributionWiener_ffd_63;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_64> AgradDistributionWiener_ffd_64;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_65> AgradDistributionWiener_ffd_65;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_66> AgradDistributionWiener_ffd_66;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_67> AgradDistributionWiener_ffd_67;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_68> AgradDistributionWiener_ffd_68;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_69> AgradDistributionWiener_ffd_69;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_70> AgradDistributionWiener_ffd_70;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_71> AgradDistributionWiener_ffd_71;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_72> AgradDistributionWiener_ffd_72;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_73> AgradDistributionWiener_ffd_73;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_74> AgradDistributionWiener_ffd_74;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_75> AgradDistributionWiener_ffd_75;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_76> AgradDistributionWiener_ffd_76;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_77> AgradDistributionWiener_ffd_77;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_78> AgradDistributionWiener_ffd_78;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_79> AgradDistributionWiener_ffd_79;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_80> AgradDistributionWiener_ffd_80;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_81> AgradDistributionWiener_ffd_81;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_82> AgradDistributionWiener_ffd_82;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_83> AgradDistributionWiener_ffd_83;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_84> AgradDistributionWiener_ffd_84;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_85> AgradDistributionWiener_ffd_85;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_86> AgradDistributionWiener_ffd_86;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_87> AgradDistributionWiener_ffd_87;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_88> AgradDistributionWiener_ffd_88;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_89> AgradDistributionWiener_ffd_89;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_90> AgradDistributionWiener_ffd_90;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_91> AgradDistributionWiener_ffd_91;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_92> AgradDistributionWiener_ffd_92;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_93> AgradDistributionWiener_ffd_93;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_94> AgradDistributionWiener_ffd_94;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_95> AgradDistributionWiener_ffd_95;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_96> AgradDistributionWiener_ffd_96;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_97> AgradDistributionWiener_ffd_97;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_98> AgradDistributionWiener_ffd_98;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_99> AgradDistributionWiener_ffd_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_0, AgradDistributionTestFixture, AgradDistributionWiener_ffd_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_8, AgradDistributionTestFixture, AgradDistributionWiener_ffd_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_9, AgradDistributionTestFixture, AgradDistributionWiener_ffd_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_10, AgradDistributionTestFixture, AgradDistributionWiener_ffd_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_11, AgradDistributionTestFixture, AgradDistributionWiener_ffd_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_12, AgradDistributionTestFixture, AgradDistributionWiener_ffd_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_13, AgradDistributionTestFixture, AgradDistributionWiener_ffd_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_14, AgradDistributionTestFixture, AgradDistributionWiener_ffd_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_15, AgradDistributionTestFixture, AgradDistributionWiener_ffd_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_16, AgradDistributionTestFixture, AgradDistributionWiener_ffd_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_17, AgradDistributionTestFixture, AgradDistributionWiener_ffd_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_18, AgradDistributionTestFixture, AgradDistributionWiener_ffd_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_19, AgradDistributionTestFixture, AgradDistributionWiener_ffd_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_20, AgradDistributionTestFixture, AgradDistributionWiener_ffd_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_21, AgradDistributionTestFixture, AgradDistributionWiener_ffd_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_22, AgradDistributionTestFixture, AgradDistributionWiener_ffd_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_23, AgradDistributionTestFixture, AgradDistributionWiener_ffd_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_24, AgradDistributionTestFixture, AgradDistributionWiener_ffd_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_25, AgradDistributionTestFixture, AgradDistributionWiener_ffd_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_26, AgradDistributionTestFixture, AgradDistributionWiener_ffd_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_27, AgradDistributionTestFixture, AgradDistributionWiener_ffd_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_28, AgradDistributionTestFixture, AgradDistributionWiener_ffd_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_29, AgradDistributionTestFixture, AgradDistributionWiener_ffd_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_30, AgradDistributionTestFixture, AgradDistributionWiener_ffd_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_31, AgradDistributionTestFixture, AgradDistributionWiener_ffd_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_32, AgradDistributionTestFixture, AgradDistributionWiener_ffd_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_33, AgradDistributionTestFixture, AgradDistributionWiener_ffd_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_34, AgradDistributionTestFixture, AgradDistributionWiener_ffd_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_35, AgradDistributionTestFixture, AgradDistributionWiener_ffd_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_36, AgradDistributionTestFixture, AgradDistributionWiener_ffd_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_37, AgradDistributionTestFixture, AgradDistributionWiener_ffd_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_38, AgradDistributionTestFixture, AgradDistributionWiener_ffd_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_39, AgradDistributionTestFixture, AgradDistributionWiener_ffd_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_40, AgradDistributionTestFixture, AgradDistributionWiener_ffd_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_41, AgradDistributionTestFixture, AgradDistributionWiener_ffd_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_42, AgradDistributionTestFixture, AgradDistributionWiener_ffd_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_43, AgradDistributionTestFixture, AgradDistributionWiener_ffd_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_44, AgradDistributionTestFixture, AgradDistributionWiener_ffd_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_45, AgradDistributionTestFixture, AgradDistributionWiener_ffd_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_46, AgradDistributionTestFixture, AgradDistributionWiener_ffd_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_47, AgradDistributionTestFixture, AgradDistributionWiener_ffd_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_48, AgradDistributionTestFixture, AgradDistributionWiener_ffd_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_49, AgradDistributionTestFixture, AgradDistributionWiener_ffd_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_50, AgradDistributionTestFixture, AgradDistributionWiener_ffd_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_51, AgradDistributionTestFixture, AgradDistributionWiener_ffd_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_52, AgradDistributionTestFixture, AgradDistributionWiener_ffd_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_53, AgradDistributionTestFixture, AgradDistributionWiener_ffd_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_54, AgradDistributionTestFixture, AgradDistributionWiener_ffd_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_55, AgradDistributionTestFixture, AgradDistributionWiener_ffd_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_56, AgradDistributionTestFixture, AgradDistributionWiener_ffd_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_57, AgradDistributionTestFixture, AgradDistributionWiener_ffd_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_58, AgradDistributionTestFixture, AgradDistributionWiener_ffd_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_59, AgradDistributionTestFixture, AgradDistributionWiener_ffd_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_60, AgradDistributionTestFixture, AgradDistributionWiener_ffd_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_61, AgradDistributionTestFixture, AgradDistributionWiener_ffd_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_62, AgradDistributionTestFixture, AgradDistributionWiener_ffd_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_63, AgradDistributionTestFixture, AgradDistributionWiener_ffd_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_64, AgradDistributionTestFixture, AgradDistributionWiener_ffd_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_65, AgradDistributionTestFixture, AgradDistributionWiener_ffd_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_66, AgradDistributionTestFixture, AgradDistributionWiener_ffd_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_67, AgradDistributionTestFixture, AgradDistributionWiener_ffd_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_68, AgradDistributionTestFixture, AgradDistributionWiener_ffd_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_69, AgradDistributionTestFixture, AgradDistributionWiener_ffd_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_70, AgradDistributionTestFixture, AgradDistributionWiener_ffd_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_71, AgradDistributionTestFixture, AgradDistributionWiener_ffd_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_72, AgradDistributionTestFixture, AgradDistributionWiener_ffd_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_73, AgradDistributionTestFixture, AgradDistributionWiener_ffd_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_74, AgradDistributionTestFixture, AgradDistributionWiener_ffd_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_75, AgradDistributionTestFixture, AgradDistributionWiener_ffd_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_76, AgradDistributionTestFixture, AgradDistributionWiener_ffd_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_77, AgradDistributionTestFixture, AgradDistributionWiener_ffd_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_78, AgradDistributionTestFixture, AgradDistributionWiener_ffd_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_79, AgradDistributionTestFixture, AgradDistributionWiener_ffd_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_80, AgradDistributionTestFixture, AgradDistributionWiener_ffd_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_81, AgradDistributionTestFixture, AgradDistributionWiener_ffd_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_82, AgradDistributionTestFixture, AgradDistributionWiener_ffd_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_83, AgradDistributionTestFixture, AgradDistributionWiener_ffd_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_84, AgradDistributionTestFixture, AgradDistributionWiener_ffd_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_85, AgradDistributionTestFixture, AgradDistributionWiener_ffd_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_86, AgradDistributionTestFixture, AgradDistributionWiener_ffd_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_87, AgradDistributionTestFixture, AgradDistributionWiener_ffd_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_88, AgradDistributionTestFixture, AgradDistributionWiener_ffd_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_89, AgradDistributionTestFixture, AgradDistributionWiener_ffd_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_90, AgradDistributionTestFixture, AgradDistributionWiener_ffd_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_91, AgradDistributionTestFixture, AgradDistributionWiener_ffd_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_92, AgradDistributionTestFixture, AgradDistributionWiener_ffd_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_93, AgradDistributionTestFixture, AgradDistributionWiener_ffd_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_94, AgradDistributionTestFixture, AgradDistributionWiener_ffd_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_95, AgradDistributionTestFixture, AgradDistributionWiener_ffd_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_96, AgradDistributionTestFixture, AgradDistributionWiener_ffd_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_97, AgradDistributionTestFixture, AgradDistributionWiener_ffd_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_98, AgradDistributionTestFixture, AgradDistributionWiener_ffd_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_99, AgradDistributionTestFixture, AgradDistributionWiener_ffd_99);
+
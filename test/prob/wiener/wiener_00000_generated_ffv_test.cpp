@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, double, fvar<fvar<var> >, empty> type_ffv_0;
+typedef boost::mpl::vector<double, double, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1;
+typedef boost::mpl::vector<double, double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_4;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_8;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<var> >, double, empty> type_ffv_9;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_10;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_11;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_12;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_13;
+typedef boost::mpl::vector<double, double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_14;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_15;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_16;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_17;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_18;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_19;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_20;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_21;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_22;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_23;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_24;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_25;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_26;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_27;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_28;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_29;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_30;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_31;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_32;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_33;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_34;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_35;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_36;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_37;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_38;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_39;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_40;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_41;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_42;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_43;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_44;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_45;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_46;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_47;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_48;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_49;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_50;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_51;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_52;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_53;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_54;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_55;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_56;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_57;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_58;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_59;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_60;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_61;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_62;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_63;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_64;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_65;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_66;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_67;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_68;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_69;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_70;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_71;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_72;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_73;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_74;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_75;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_76;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_77;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_78;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_79;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_80;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, double, double, empty> type_ffv_81;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_82;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_83;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_84;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_85;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_86;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_87;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_88;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_89;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_90;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_91;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_92;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_93;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_94;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_95;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_96;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_97;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_98;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_99;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_0> AgradDistributionWiener_ffv_0;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1> AgradDistributionWiener_ffv_1;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2> AgradDistributionWiener_ffv_2;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3> AgradDistributionWiener_ffv_3;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_4> AgradDistributionWiener_ffv_4;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5> AgradDistributionWiener_ffv_5;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6> AgradDistributionWiener_ffv_6;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7> AgradDistributionWiener_ffv_7;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_8> AgradDistributionWiener_ffv_8;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_9> AgradDistributionWiener_ffv_9;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_10> AgradDistributionWiener_ffv_10;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_11> AgradDistributionWiener_ffv_11;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_12> AgradDistributionWiener_ffv_12;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_13> AgradDistributionWiener_ffv_13;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_14> AgradDistributionWiener_ffv_14;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_15> AgradDistributionWiener_ffv_15;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_16> AgradDistributionWiener_ffv_16;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_17> AgradDistributionWiener_ffv_17;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_18> AgradDistributionWiener_ffv_18;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_19> AgradDistributionWiener_ffv_19;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_20> AgradDistributionWiener_ffv_20;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_21> AgradDistributionWiener_ffv_21;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_22> AgradDistributionWiener_ffv_22;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_23> AgradDistributionWiener_ffv_23;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_24> AgradDistributionWiener_ffv_24;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_25> AgradDistributionWiener_ffv_25;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_26> AgradDistributionWiener_ffv_26;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_27> AgradDistributionWiener_ffv_27;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_28> AgradDistributionWiener_ffv_28;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_29> AgradDistributionWiener_ffv_29;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_30> AgradDistributionWiener_ffv_30;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_31> AgradDistributionWiener_ffv_31;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_32> AgradDistributionWiener_ffv_32;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_33> AgradDistributionWiener_ffv_33;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_34> AgradDistributionWiener_ffv_34;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_35> AgradDistributionWiener_ffv_35;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_36> AgradDistributionWiener_ffv_36;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_37> AgradDistributionWiener_ffv_37;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_38> AgradDistributionWiener_ffv_38;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_39> AgradDistributionWiener_ffv_39;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_40> AgradDistributionWiener_ffv_40;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_41> AgradDistributionWiener_ffv_41;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_42> AgradDistributionWiener_ffv_42;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_43> AgradDistributionWiener_ffv_43;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_44> AgradDistributionWiener_ffv_44;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_45> AgradDistributionWiener_ffv_45;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_46> AgradDistributionWiener_ffv_46;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_47> AgradDistributionWiener_ffv_47;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_48> AgradDistributionWiener_ffv_48;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_49> AgradDistributionWiener_ffv_49;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_50> AgradDistributionWiener_ffv_50;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_51> AgradDistributionWiener_ffv_51;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_52> AgradDistributionWiener_ffv_52;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_53> AgradDistributionWiener_ffv_53;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_54> AgradDistributionWiener_ffv_54;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_55> AgradDistributionWiener_ffv_55;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_56> AgradDistributionWiener_ffv_56;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_57> AgradDistributionWiener_ffv_57;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_58> AgradDistributionWiener_ffv_58;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_59> AgradDistributionWiener_ffv_59;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_60> AgradDistributionWiener_ffv_60;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_61> AgradDistributionWiener_ffv_61;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_62> AgradDistributionWiener_ffv_62;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_63> AgradDistributionWiener_ffv_63;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_64> AgradDistributionWiener_ffv_64;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_65> AgradDistributionWiener_ffv_65;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_66> AgradDistributionWiener_ffv_66;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_67> AgradDistributionWiener_ffv_67;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_68> AgradDistributionWiener_ffv_68;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_69> AgradDistributionWiener_ffv_69;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_70> AgradDistributionWiener_ffv_70;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_71> AgradDistributionWiener_ffv_71;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_72> AgradDistributionWiener_ffv_72;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_73> AgradDistributionWiener_ffv_73;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_74> AgradDistributionWiener_ffv_74;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_75> AgradDistributionWiener_ffv_75;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_76> AgradDistributionWiener_ffv_76;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_77> AgradDistributionWiener_ffv_77;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_78> AgradDistributionWiener_ffv_78;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_79> AgradDistributionWiener_ffv_79;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_80> AgradDistributionWiener_ffv_80;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_81> AgradDistributionWiener_ffv_81;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_82> AgradDistributionWiener_ffv_82;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_83> AgradDistributionWiener_ffv_83;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_84> AgradDistributionWiener_ffv_84;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_85> AgradDistributionWiener_ffv_85;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_86> AgradDistributionWiener_ffv_86;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_87> AgradDistributionWiener_ffv_87;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_88> AgradDistributionWiener_ffv_88;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_89> AgradDistributionWiener_ffv_89;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_90> AgradDistributionWiener_ffv_90;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_91> AgradDistributionWiener_ffv_91;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_92> AgradDistributionWiener_ffv_92;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_93> AgradDistributionWiener_ffv_93;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_94> AgradDistributionWiener_ffv_94;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_95> AgradDistributionWiener_ffv_95;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_96> AgradDistributionWiener_ffv_96;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_97> AgradDistributionWiener_ffv_97;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_98> AgradDistributionWiener_ffv_98;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_99> AgradDistributionWiener_ffv_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_0, AgradDistributionTestFixture, AgradDistributionWiener_ffv_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_4, AgradDistributionTestFixture, AgradDistributionWiener_ffv_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_8, AgradDistributionTestFixture, AgradDistributionWiener_ffv_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_9, AgradDistributionTestFixture, AgradDistributionWiener_ffv_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_10, AgradDistributionTestFixture, AgradDistributionWiener_ffv_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_11, AgradDistributionTestFixture, AgradDistributionWiener_ffv_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_12, AgradDistributionTestFixture, AgradDistributionWiener_ffv_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_13, AgradDistributionTestFixture, AgradDistributionWiener_ffv_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_14, AgradDistributionTestFixture, AgradDistributionWiener_ffv_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_15, AgradDistributionTestFixture, AgradDistributionWiener_ffv_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_16, AgradDistributionTestFixture, AgradDistributionWiener_ffv_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_17, AgradDistributionTestFixture, AgradDistributionWiener_ffv_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_18, AgradDistributionTestFixture, AgradDistributionWiener_ffv_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_19, AgradDistributionTestFixture, AgradDistributionWiener_ffv_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_20, AgradDistributionTestFixture, AgradDistributionWiener_ffv_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_21, AgradDistributionTestFixture, AgradDistributionWiener_ffv_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_22, AgradDistributionTestFixture, AgradDistributionWiener_ffv_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_23, AgradDistributionTestFixture, AgradDistributionWiener_ffv_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_24, AgradDistributionTestFixture, AgradDistributionWiener_ffv_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_25, AgradDistributionTestFixture, AgradDistributionWiener_ffv_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_26, AgradDistributionTestFixture, AgradDistributionWiener_ffv_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_27, AgradDistributionTestFixture, AgradDistributionWiener_ffv_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_28, AgradDistributionTestFixture, AgradDistributionWiener_ffv_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_29, AgradDistributionTestFixture, AgradDistributionWiener_ffv_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_30, AgradDistributionTestFixture, AgradDistributionWiener_ffv_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_31, AgradDistributionTestFixture, AgradDistributionWiener_ffv_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_32, AgradDistributionTestFixture, AgradDistributionWiener_ffv_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_33, AgradDistributionTestFixture, AgradDistributionWiener_ffv_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_34, AgradDistributionTestFixture, AgradDistributionWiener_ffv_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_35, AgradDistributionTestFixture, AgradDistributionWiener_ffv_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_36, AgradDistributionTestFixture, AgradDistributionWiener_ffv_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_37, AgradDistributionTestFixture, AgradDistributionWiener_ffv_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_38, AgradDistributionTestFixture, AgradDistributionWiener_ffv_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_39, AgradDistributionTestFixture, AgradDistributionWiener_ffv_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_40, AgradDistributionTestFixture, AgradDistributionWiener_ffv_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_41, AgradDistributionTestFixture, AgradDistributionWiener_ffv_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_42, AgradDistributionTestFixture, AgradDistributionWiener_ffv_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_43, AgradDistributionTestFixture, AgradDistributionWiener_ffv_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_44, AgradDistributionTestFixture, AgradDistributionWiener_ffv_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_45, AgradDistributionTestFixture, AgradDistributionWiener_ffv_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_46, AgradDistributionTestFixture, AgradDistributionWiener_ffv_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_47, AgradDistributionTestFixture, AgradDistributionWiener_ffv_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_48, AgradDistributionTestFixture, AgradDistributionWiener_ffv_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_49, AgradDistributionTestFixture, AgradDistributionWiener_ffv_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_50, AgradDistributionTestFixture, AgradDistributionWiener_ffv_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_51, AgradDistributionTestFixture, AgradDistributionWiener_ffv_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_52, AgradDistributionTestFixture, AgradDistributionWiener_ffv_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_53, AgradDistributionTestFixture, AgradDistributionWiener_ffv_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_54, AgradDistributionTestFixture, AgradDistributionWiener_ffv_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_55, AgradDistributionTestFixture, AgradDistributionWiener_ffv_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_56, AgradDistributionTestFixture, AgradDistributionWiener_ffv_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_57, AgradDistributionTestFixture, AgradDistributionWiener_ffv_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_58, AgradDistributionTestFixture, AgradDistributionWiener_ffv_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_59, AgradDistributionTestFixture, AgradDistributionWiener_ffv_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_60, AgradDistributionTestFixture, AgradDistributionWiener_ffv_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_61, AgradDistributionTestFixture, AgradDistributionWiener_ffv_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_62, AgradDistributionTestFixture, AgradDistributionWiener_ffv_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_63, AgradDistributionTestFixture, AgradDistributionWiener_ffv_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_64, AgradDistributionTestFixture, AgradDistributionWiener_ffv_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_65, AgradDistributionTestFixture, AgradDistributionWiener_ffv_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_66, AgradDistributionTestFixture, AgradDistributionWiener_ffv_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_67, AgradDistributionTestFixture, AgradDistributionWiener_ffv_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_68, AgradDistributionTestFixture, AgradDistributionWiener_ffv_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_69, AgradDistributionTestFixture, AgradDistributionWiener_ffv_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_70, AgradDistributionTestFixture, AgradDistributionWiener_ffv_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_71, AgradDistributionTestFixture, AgradDistributionWiener_ffv_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_72, AgradDistributionTestFixture, AgradDistributionWiener_ffv_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_73, AgradDistributionTestFixture, AgradDistributionWiener_ffv_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_74, AgradDistributionTestFixture, AgradDistributionWiener_ffv_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_75, AgradDistributionTestFixture, AgradDistributionWiener_ffv_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_76, AgradDistributionTestFixture, AgradDistributionWiener_ffv_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_77, AgradDistributionTestFixture, AgradDistributionWiener_ffv_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_78, AgradDistributionTestFixture, AgradDistributionWiener_ffv_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_79, AgradDistributionTestFixture, AgradDistributionWiener_ffv_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_80, AgradDistributionTestFixture, AgradDistributionWiener_ffv_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_81, AgradDistributionTestFixture, AgradDistributionWiener_ffv_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_82, AgradDistributionTestFixture, AgradDistributionWiener_ffv_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_83, AgradDistributionTestFixture, AgradDistributionWiener_ffv_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_84, AgradDistributionTestFixture, AgradDistributionWiener_ffv_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_85, AgradDistributionTestFixture, AgradDistributionWiener_ffv_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_86, AgradDistributionTestFixture, AgradDistributionWiener_ffv_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_87, AgradDistributionTestFixture, AgradDistributionWiener_ffv_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_88, AgradDistributionTestFixture, AgradDistributionWiener_ffv_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_89, AgradDistributionTestFixture, AgradDistributionWiener_ffv_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_90, AgradDistributionTestFixture, AgradDistributionWiener_ffv_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_91, AgradDistributionTestFixture, AgradDistributionWiener_ffv_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_92, AgradDistributionTestFixture, AgradDistributionWiener_ffv_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_93, AgradDistributionTestFixture, AgradDistributionWiener_ffv_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_94, AgradDistributionTestFixture, AgradDistributionWiener_ffv_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_95, AgradDistributionTestFixture, AgradDistributionWiener_ffv_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_96, AgradDistributionTestFixture, AgradDistributionWiener_ffv_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_97, AgradDistributionTestFixture, AgradDistributionWiener_ffv_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_98, AgradDistributionTestFixture, AgradDistributionWiener_ffv_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_99, AgradDistributionTestFixture, AgradDistributionWiener_ffv_99);
+
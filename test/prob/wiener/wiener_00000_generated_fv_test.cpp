@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, double, fvar<var>, empty> type_fv_0;
+typedef boost::mpl::vector<double, double, double, double, std::vector<fvar<var>>, empty> type_fv_1;
+typedef boost::mpl::vector<double, double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, fvar<var>, empty> type_fv_3;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_8;
+typedef boost::mpl::vector<double, double, double, fvar<var>, double, empty> type_fv_9;
+typedef boost::mpl::vector<double, double, double, fvar<var>, std::vector<double>, empty> type_fv_10;
+typedef boost::mpl::vector<double, double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_11;
+typedef boost::mpl::vector<double, double, double, fvar<var>, fvar<var>, empty> type_fv_12;
+typedef boost::mpl::vector<double, double, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_13;
+typedef boost::mpl::vector<double, double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_14;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<var>>, double, empty> type_fv_15;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_16;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_17;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_18;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_19;
+typedef boost::mpl::vector<double, double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_20;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_21;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_22;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_23;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_24;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_25;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_26;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, fvar<var>, empty> type_fv_27;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_28;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_29;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_30;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_31;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_32;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_33;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_34;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_35;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<var>, double, empty> type_fv_36;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_37;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_38;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_39;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_40;
+typedef boost::mpl::vector<double, double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_41;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_42;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_43;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_44;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_45;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_46;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_47;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_48;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_49;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_50;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_51;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_52;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_53;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_54;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_55;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_56;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_57;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_58;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_59;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_60;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_61;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_62;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_63;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_64;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_65;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_66;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_67;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_68;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_69;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_70;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_71;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_72;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_73;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_74;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_75;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_76;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_77;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_78;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_79;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_80;
+typedef boost::mpl::vector<double, double, fvar<var>, double, double, empty> type_fv_81;
+typedef boost::mpl::vector<double, double, fvar<var>, double, std::vector<double>, empty> type_fv_82;
+typedef boost::mpl::vector<double, double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_83;
+typedef boost::mpl::vector<double, double, fvar<var>, double, fvar<var>, empty> type_fv_84;
+typedef boost::mpl::vector<double, double, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_85;
+typedef boost::mpl::vector<double, double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_86;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<double>, double, empty> type_fv_87;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_88;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_89;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_90;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_91;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_92;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_93;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_94;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_95;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_96;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_97;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_98;
+typedef boost::mpl::vector<double, double, fvar<var>, fvar<var>, double, empty> type_fv_99;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_0> AgradDistributionWiener_fv_0;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1> AgradDistributionWiener_fv_1;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2> AgradDistributionWiener_fv_2;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3> AgradDistributionWiener_fv_3;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4> AgradDistributionWiener_fv_4;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5> AgradDistributionWiener_fv_5;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6> AgradDistributionWiener_fv_6;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7> AgradDistributionWiener_fv_7;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_8> AgradDistributionWiener_fv_8;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_9> AgradDistributionWiener_fv_9;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_10> AgradDistributionWiener_fv_10;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_11> AgradDistributionWiener_fv_11;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_12> AgradDistributionWiener_fv_12;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_13> AgradDistributionWiener_fv_13;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_14> AgradDistributionWiener_fv_14;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_15> AgradDistributionWiener_fv_15;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_16> AgradDistributionWiener_fv_16;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_17> AgradDistributionWiener_fv_17;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_18> AgradDistributionWiener_fv_18;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_19> AgradDistributionWiener_fv_19;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_20> AgradDistributionWiener_fv_20;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_21> AgradDistributionWiener_fv_21;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_22> AgradDistributionWiener_fv_22;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_23> AgradDistributionWiener_fv_23;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_24> AgradDistributionWiener_fv_24;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_25> AgradDistributionWiener_fv_25;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_26> AgradDistributionWiener_fv_26;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_27> AgradDistributionWiener_fv_27;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_28> AgradDistributionWiener_fv_28;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_29> AgradDistributionWiener_fv_29;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_30> AgradDistributionWiener_fv_30;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_31> AgradDistributionWiener_fv_31;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_32> AgradDistributionWiener_fv_32;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_33> AgradDistributionWiener_fv_33;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_34> AgradDistributionWiener_fv_34;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_35> AgradDistributionWiener_fv_35;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_36> AgradDistributionWiener_fv_36;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_37> AgradDistributionWiener_fv_37;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_38> AgradDistributionWiener_fv_38;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_39> AgradDistributionWiener_fv_39;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_40> AgradDistributionWiener_fv_40;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_41> AgradDistributionWiener_fv_41;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_42> AgradDistributionWiener_fv_42;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_43> AgradDistributionWiener_fv_43;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_44> AgradDistributionWiener_fv_44;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_45> AgradDistributionWiener_fv_45;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_46> AgradDistributionWiener_fv_46;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_47> AgradDistributionWiener_fv_47;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_48> AgradDistributionWiener_fv_48;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_49> AgradDistributionWiener_fv_49;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_50> AgradDistributionWiener_fv_50;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_51> AgradDistributionWiener_fv_51;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_52> AgradDistributionWiener_fv_52;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_53> AgradDistributionWiener_fv_53;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_54> AgradDistributionWiener_fv_54;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_55> AgradDistributionWiener_fv_55;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_56> AgradDistributionWiener_fv_56;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_57> AgradDistributionWiener_fv_57;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_58> AgradDistributionWiener_fv_58;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_59> AgradDistributionWiener_fv_59;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_60> AgradDistributionWiener_fv_60;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_61> AgradDistributionWiener_fv_61;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_62> AgradDistributionWiener_fv_62;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_63> AgradDistributionWiener_fv_63;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_64> AgradDistributionWiener_fv_64;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_65> AgradDistributionWiener_fv_65;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_66> AgradDistributionWiener_fv_66;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_67> AgradDistributionWiener_fv_67;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_68> AgradDistributionWiener_fv_68;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_69> AgradDistributionWiener_fv_69;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_70> AgradDistributionWiener_fv_70;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_71> AgradDistributionWiener_fv_71;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_72> AgradDistributionWiener_fv_72;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_73> AgradDistributionWiener_fv_73;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_74> AgradDistributionWiener_fv_74;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_75> AgradDistributionWiener_fv_75;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_76> AgradDistributionWiener_fv_76;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_77> AgradDistributionWiener_fv_77;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_78> AgradDistributionWiener_fv_78;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_79> AgradDistributionWiener_fv_79;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_80> AgradDistributionWiener_fv_80;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_81> AgradDistributionWiener_fv_81;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_82> AgradDistributionWiener_fv_82;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_83> AgradDistributionWiener_fv_83;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_84> AgradDistributionWiener_fv_84;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_85> AgradDistributionWiener_fv_85;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_86> AgradDistributionWiener_fv_86;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_87> AgradDistributionWiener_fv_87;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_88> AgradDistributionWiener_fv_88;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_89> AgradDistributionWiener_fv_89;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_90> AgradDistributionWiener_fv_90;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_91> AgradDistributionWiener_fv_91;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_92> AgradDistributionWiener_fv_92;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_93> AgradDistributionWiener_fv_93;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_94> AgradDistributionWiener_fv_94;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_95> AgradDistributionWiener_fv_95;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_96> AgradDistributionWiener_fv_96;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_97> AgradDistributionWiener_fv_97;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_98> AgradDistributionWiener_fv_98;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_99> AgradDistributionWiener_fv_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_0, AgradDistributionTestFixture, AgradDistributionWiener_fv_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1, AgradDistributionTestFixture, AgradDistributionWiener_fv_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2, AgradDistributionTestFixture, AgradDistributionWiener_fv_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3, AgradDistributionTestFixture, AgradDistributionWiener_fv_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4, AgradDistributionTestFixture, AgradDistributionWiener_fv_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5, AgradDistributionTestFixture, AgradDistributionWiener_fv_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6, AgradDistributionTestFixture, AgradDistributionWiener_fv_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7, AgradDistributionTestFixture, AgradDistributionWiener_fv_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_8, AgradDistributionTestFixture, AgradDistributionWiener_fv_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_9, AgradDistributionTestFixture, AgradDistributionWiener_fv_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_10, AgradDistributionTestFixture, AgradDistributionWiener_fv_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_11, AgradDistributionTestFixture, AgradDistributionWiener_fv_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_12, AgradDistributionTestFixture, AgradDistributionWiener_fv_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_13, AgradDistributionTestFixture, AgradDistributionWiener_fv_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_14, AgradDistributionTestFixture, AgradDistributionWiener_fv_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_15, AgradDistributionTestFixture, AgradDistributionWiener_fv_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_16, AgradDistributionTestFixture, AgradDistributionWiener_fv_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_17, AgradDistributionTestFixture, AgradDistributionWiener_fv_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_18, AgradDistributionTestFixture, AgradDistributionWiener_fv_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_19, AgradDistributionTestFixture, AgradDistributionWiener_fv_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_20, AgradDistributionTestFixture, AgradDistributionWiener_fv_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_21, AgradDistributionTestFixture, AgradDistributionWiener_fv_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_22, AgradDistributionTestFixture, AgradDistributionWiener_fv_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_23, AgradDistributionTestFixture, AgradDistributionWiener_fv_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_24, AgradDistributionTestFixture, AgradDistributionWiener_fv_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_25, AgradDistributionTestFixture, AgradDistributionWiener_fv_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_26, AgradDistributionTestFixture, AgradDistributionWiener_fv_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_27, AgradDistributionTestFixture, AgradDistributionWiener_fv_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_28, AgradDistributionTestFixture, AgradDistributionWiener_fv_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_29, AgradDistributionTestFixture, AgradDistributionWiener_fv_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_30, AgradDistributionTestFixture, AgradDistributionWiener_fv_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_31, AgradDistributionTestFixture, AgradDistributionWiener_fv_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_32, AgradDistributionTestFixture, AgradDistributionWiener_fv_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_33, AgradDistributionTestFixture, AgradDistributionWiener_fv_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_34, AgradDistributionTestFixture, AgradDistributionWiener_fv_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_35, AgradDistributionTestFixture, AgradDistributionWiener_fv_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_36, AgradDistributionTestFixture, AgradDistributionWiener_fv_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_37, AgradDistributionTestFixture, AgradDistributionWiener_fv_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_38, AgradDistributionTestFixture, AgradDistributionWiener_fv_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_39, AgradDistributionTestFixture, AgradDistributionWiener_fv_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_40, AgradDistributionTestFixture, AgradDistributionWiener_fv_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_41, AgradDistributionTestFixture, AgradDistributionWiener_fv_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_42, AgradDistributionTestFixture, AgradDistributionWiener_fv_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_43, AgradDistributionTestFixture, AgradDistributionWiener_fv_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_44, AgradDistributionTestFixture, AgradDistributionWiener_fv_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_45, AgradDistributionTestFixture, AgradDistributionWiener_fv_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_46, AgradDistributionTestFixture, AgradDistributionWiener_fv_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_47, AgradDistributionTestFixture, AgradDistributionWiener_fv_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_48, AgradDistributionTestFixture, AgradDistributionWiener_fv_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_49, AgradDistributionTestFixture, AgradDistributionWiener_fv_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_50, AgradDistributionTestFixture, AgradDistributionWiener_fv_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_51, AgradDistributionTestFixture, AgradDistributionWiener_fv_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_52, AgradDistributionTestFixture, AgradDistributionWiener_fv_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_53, AgradDistributionTestFixture, AgradDistributionWiener_fv_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_54, AgradDistributionTestFixture, AgradDistributionWiener_fv_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_55, AgradDistributionTestFixture, AgradDistributionWiener_fv_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_56, AgradDistributionTestFixture, AgradDistributionWiener_fv_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_57, AgradDistributionTestFixture, AgradDistributionWiener_fv_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_58, AgradDistributionTestFixture, AgradDistributionWiener_fv_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_59, AgradDistributionTestFixture, AgradDistributionWiener_fv_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_60, AgradDistributionTestFixture, AgradDistributionWiener_fv_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_61, AgradDistributionTestFixture, AgradDistributionWiener_fv_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_62, AgradDistributionTestFixture, AgradDistributionWiener_fv_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_63, AgradDistributionTestFixture, AgradDistributionWiener_fv_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_64, AgradDistributionTestFixture, AgradDistributionWiener_fv_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_65, AgradDistributionTestFixture, AgradDistributionWiener_fv_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_66, AgradDistributionTestFixture, AgradDistributionWiener_fv_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_67, AgradDistributionTestFixture, AgradDistributionWiener_fv_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_68, AgradDistributionTestFixture, AgradDistributionWiener_fv_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_69, AgradDistributionTestFixture, AgradDistributionWiener_fv_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_70, AgradDistributionTestFixture, AgradDistributionWiener_fv_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_71, AgradDistributionTestFixture, AgradDistributionWiener_fv_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_72, AgradDistributionTestFixture, AgradDistributionWiener_fv_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_73, AgradDistributionTestFixture, AgradDistributionWiener_fv_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_74, AgradDistributionTestFixture, AgradDistributionWiener_fv_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_75, AgradDistributionTestFixture, AgradDistributionWiener_fv_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_76, AgradDistributionTestFixture, AgradDistributionWiener_fv_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_77, AgradDistributionTestFixture, AgradDistributionWiener_fv_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_78, AgradDistributionTestFixture, AgradDistributionWiener_fv_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_79, AgradDistributionTestFixture, AgradDistributionWiener_fv_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_80, AgradDistributionTestFixture, AgradDistributionWiener_fv_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_81, AgradDistributionTestFixture, AgradDistributionWiener_fv_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_82, AgradDistributionTestFixture, AgradDistributionWiener_fv_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_83, AgradDistributionTestFixture, AgradDistributionWiener_fv_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_84, AgradDistributionTestFixture, AgradDistributionWiener_fv_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_85, AgradDistributionTestFixture, AgradDistributionWiener_fv_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_86, AgradDistributionTestFixture, AgradDistributionWiener_fv_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_87, AgradDistributionTestFixture, AgradDistributionWiener_fv_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_88, AgradDistributionTestFixture, AgradDistributionWiener_fv_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_89, AgradDistributionTestFixture, AgradDistributionWiener_fv_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_90, AgradDistributionTestFixture, AgradDistributionWiener_fv_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_91, AgradDistributionTestFixture, AgradDistributionWiener_fv_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_92, AgradDistributionTestFixture, AgradDistributionWiener_fv_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_93, AgradDistributionTestFixture, AgradDistributionWiener_fv_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_94, AgradDistributionTestFixture, AgradDistributionWiener_fv_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_95, AgradDistributionTestFixture, AgradDistributionWiener_fv_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_96, AgradDistributionTestFixture, AgradDistributionWiener_fv_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_97, AgradDistributionTestFixture, AgradDistributionWiener_fv_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_98, AgradDistributionTestFixture, AgradDistributionWiener_fv_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_99, AgradDistributionTestFixture, AgradDistributionWiener_fv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, double, double, double, empty> type_v_0;
+typedef boost::mpl::vector<double, double, double, double, std::vector<double>, empty> type_v_1;
+typedef boost::mpl::vector<double, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2;
+typedef boost::mpl::vector<double, double, double, double, var, empty> type_v_3;
+typedef boost::mpl::vector<double, double, double, double, std::vector<var>, empty> type_v_4;
+typedef boost::mpl::vector<double, double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, double, empty> type_v_6;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, std::vector<double>, empty> type_v_7;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_8;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, var, empty> type_v_9;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, std::vector<var>, empty> type_v_10;
+typedef boost::mpl::vector<double, double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_11;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_12;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_13;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_14;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_15;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_16;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_17;
+typedef boost::mpl::vector<double, double, double, var, double, empty> type_v_18;
+typedef boost::mpl::vector<double, double, double, var, std::vector<double>, empty> type_v_19;
+typedef boost::mpl::vector<double, double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_20;
+typedef boost::mpl::vector<double, double, double, var, var, empty> type_v_21;
+typedef boost::mpl::vector<double, double, double, var, std::vector<var>, empty> type_v_22;
+typedef boost::mpl::vector<double, double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_23;
+typedef boost::mpl::vector<double, double, double, std::vector<var>, double, empty> type_v_24;
+typedef boost::mpl::vector<double, double, double, std::vector<var>, std::vector<double>, empty> type_v_25;
+typedef boost::mpl::vector<double, double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_26;
+typedef boost::mpl::vector<double, double, double, std::vector<var>, var, empty> type_v_27;
+typedef boost::mpl::vector<double, double, double, std::vector<var>, std::vector<var>, empty> type_v_28;
+typedef boost::mpl::vector<double, double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_29;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_30;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_31;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_32;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_33;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_34;
+typedef boost::mpl::vector<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_35;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, double, empty> type_v_36;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, std::vector<double>, empty> type_v_37;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_38;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, var, empty> type_v_39;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, std::vector<var>, empty> type_v_40;
+typedef boost::mpl::vector<double, double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_41;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, double, empty> type_v_42;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_43;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_44;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, var, empty> type_v_45;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_46;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_47;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_48;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_49;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_50;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_51;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_52;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_53;
+typedef boost::mpl::vector<double, double, std::vector<double>, var, double, empty> type_v_54;
+typedef boost::mpl::vector<double, double, std::vector<double>, var, std::vector<double>, empty> type_v_55;
+typedef boost::mpl::vector<double, double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_56;
+typedef boost::mpl::vector<double, double, std::vector<double>, var, var, empty> type_v_57;
+typedef boost::mpl::vector<double, double, std::vector<double>, var, std::vector<var>, empty> type_v_58;
+typedef boost::mpl::vector<double, double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_59;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<var>, double, empty> type_v_60;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_61;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_62;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<var>, var, empty> type_v_63;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_64;
+typedef boost::mpl::vector<double, double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_65;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_66;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_67;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_68;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_69;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_70;
+typedef boost::mpl::vector<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_71;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_72;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_73;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_74;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_75;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_76;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_77;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_78;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_79;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_80;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_81;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_82;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_83;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_84;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_85;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_86;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_87;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_88;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_89;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_90;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_91;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_92;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_93;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_94;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_95;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_96;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_97;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_98;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_99;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_0> AgradDistributionWiener_v_0;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1> AgradDistributionWiener_v_1;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2> AgradDistributionWiener_v_2;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3> AgradDistributionWiener_v_3;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4> AgradDistributionWiener_v_4;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5> AgradDistributionWiener_v_5;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6> AgradDistributionWiener_v_6;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7> AgradDistributionWiener_v_7;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_8> AgradDistributionWiener_v_8;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_9> AgradDistributionWiener_v_9;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_10> AgradDistributionWiener_v_10;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_11> AgradDistributionWiener_v_11;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_12> AgradDistributionWiener_v_12;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_13> AgradDistributionWiener_v_13;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_14> AgradDistributionWiener_v_14;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_15> AgradDistributionWiener_v_15;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_16> AgradDistributionWiener_v_16;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_17> AgradDistributionWiener_v_17;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_18> AgradDistributionWiener_v_18;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_19> AgradDistributionWiener_v_19;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_20> AgradDistributionWiener_v_20;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_21> AgradDistributionWiener_v_21;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_22> AgradDistributionWiener_v_22;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_23> AgradDistributionWiener_v_23;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_24> AgradDistributionWiener_v_24;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_25> AgradDistributionWiener_v_25;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_26> AgradDistributionWiener_v_26;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_27> AgradDistributionWiener_v_27;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_28> AgradDistributionWiener_v_28;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_29> AgradDistributionWiener_v_29;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_30> AgradDistributionWiener_v_30;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_31> AgradDistributionWiener_v_31;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_32> AgradDistributionWiener_v_32;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_33> AgradDistributionWiener_v_33;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_34> AgradDistributionWiener_v_34;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_35> AgradDistributionWiener_v_35;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_36> AgradDistributionWiener_v_36;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_37> AgradDistributionWiener_v_37;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_38> AgradDistributionWiener_v_38;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_39> AgradDistributionWiener_v_39;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_40> AgradDistributionWiener_v_40;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_41> AgradDistributionWiener_v_41;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_42> AgradDistributionWiener_v_42;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_43> AgradDistributionWiener_v_43;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_44> AgradDistributionWiener_v_44;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_45> AgradDistributionWiener_v_45;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_46> AgradDistributionWiener_v_46;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_47> AgradDistributionWiener_v_47;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_48> AgradDistributionWiener_v_48;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_49> AgradDistributionWiener_v_49;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_50> AgradDistributionWiener_v_50;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_51> AgradDistributionWiener_v_51;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_52> AgradDistributionWiener_v_52;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_53> AgradDistributionWiener_v_53;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_54> AgradDistributionWiener_v_54;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_55> AgradDistributionWiener_v_55;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_56> AgradDistributionWiener_v_56;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_57> AgradDistributionWiener_v_57;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_58> AgradDistributionWiener_v_58;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_59> AgradDistributionWiener_v_59;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_60> AgradDistributionWiener_v_60;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_61> AgradDistributionWiener_v_61;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_62> AgradDistributionWiener_v_62;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_63> AgradDistributionWiener_v_63;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_64> AgradDistributionWiener_v_64;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_65> AgradDistributionWiener_v_65;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_66> AgradDistributionWiener_v_66;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_67> AgradDistributionWiener_v_67;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_68> AgradDistributionWiener_v_68;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_69> AgradDistributionWiener_v_69;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_70> AgradDistributionWiener_v_70;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_71> AgradDistributionWiener_v_71;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_72> AgradDistributionWiener_v_72;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_73> AgradDistributionWiener_v_73;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_74> AgradDistributionWiener_v_74;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_75> AgradDistributionWiener_v_75;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_76> AgradDistributionWiener_v_76;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_77> AgradDistributionWiener_v_77;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_78> AgradDistributionWiener_v_78;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_79> AgradDistributionWiener_v_79;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_80> AgradDistributionWiener_v_80;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_81> AgradDistributionWiener_v_81;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_82> AgradDistributionWiener_v_82;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_83> AgradDistributionWiener_v_83;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_84> AgradDistributionWiener_v_84;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_85> AgradDistributionWiener_v_85;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_86> AgradDistributionWiener_v_86;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_87> AgradDistributionWiener_v_87;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_88> AgradDistributionWiener_v_88;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_89> AgradDistributionWiener_v_89;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_90> AgradDistributionWiener_v_90;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_91> AgradDistributionWiener_v_91;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_92> AgradDistributionWiener_v_92;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_93> AgradDistributionWiener_v_93;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_94> AgradDistributionWiener_v_94;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_95> AgradDistributionWiener_v_95;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_96> AgradDistributionWiener_v_96;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_97> AgradDistributionWiener_v_97;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_98> AgradDistributionWiener_v_98;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_99> AgradDistributionWiener_v_99;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_0, AgradDistributionTestFixture, AgradDistributionWiener_v_0);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1, AgradDistributionTestFixture, AgradDistributionWiener_v_1);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2, AgradDistributionTestFixture, AgradDistributionWiener_v_2);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3, AgradDistributionTestFixture, AgradDistributionWiener_v_3);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4, AgradDistributionTestFixture, AgradDistributionWiener_v_4);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5, AgradDistributionTestFixture, AgradDistributionWiener_v_5);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6, AgradDistributionTestFixture, AgradDistributionWiener_v_6);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7, AgradDistributionTestFixture, AgradDistributionWiener_v_7);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_8, AgradDistributionTestFixture, AgradDistributionWiener_v_8);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_9, AgradDistributionTestFixture, AgradDistributionWiener_v_9);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_10, AgradDistributionTestFixture, AgradDistributionWiener_v_10);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_11, AgradDistributionTestFixture, AgradDistributionWiener_v_11);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_12, AgradDistributionTestFixture, AgradDistributionWiener_v_12);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_13, AgradDistributionTestFixture, AgradDistributionWiener_v_13);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_14, AgradDistributionTestFixture, AgradDistributionWiener_v_14);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_15, AgradDistributionTestFixture, AgradDistributionWiener_v_15);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_16, AgradDistributionTestFixture, AgradDistributionWiener_v_16);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_17, AgradDistributionTestFixture, AgradDistributionWiener_v_17);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_18, AgradDistributionTestFixture, AgradDistributionWiener_v_18);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_19, AgradDistributionTestFixture, AgradDistributionWiener_v_19);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_20, AgradDistributionTestFixture, AgradDistributionWiener_v_20);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_21, AgradDistributionTestFixture, AgradDistributionWiener_v_21);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_22, AgradDistributionTestFixture, AgradDistributionWiener_v_22);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_23, AgradDistributionTestFixture, AgradDistributionWiener_v_23);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_24, AgradDistributionTestFixture, AgradDistributionWiener_v_24);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_25, AgradDistributionTestFixture, AgradDistributionWiener_v_25);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_26, AgradDistributionTestFixture, AgradDistributionWiener_v_26);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_27, AgradDistributionTestFixture, AgradDistributionWiener_v_27);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_28, AgradDistributionTestFixture, AgradDistributionWiener_v_28);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_29, AgradDistributionTestFixture, AgradDistributionWiener_v_29);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_30, AgradDistributionTestFixture, AgradDistributionWiener_v_30);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_31, AgradDistributionTestFixture, AgradDistributionWiener_v_31);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_32, AgradDistributionTestFixture, AgradDistributionWiener_v_32);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_33, AgradDistributionTestFixture, AgradDistributionWiener_v_33);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_34, AgradDistributionTestFixture, AgradDistributionWiener_v_34);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_35, AgradDistributionTestFixture, AgradDistributionWiener_v_35);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_36, AgradDistributionTestFixture, AgradDistributionWiener_v_36);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_37, AgradDistributionTestFixture, AgradDistributionWiener_v_37);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_38, AgradDistributionTestFixture, AgradDistributionWiener_v_38);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_39, AgradDistributionTestFixture, AgradDistributionWiener_v_39);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_40, AgradDistributionTestFixture, AgradDistributionWiener_v_40);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_41, AgradDistributionTestFixture, AgradDistributionWiener_v_41);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_42, AgradDistributionTestFixture, AgradDistributionWiener_v_42);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_43, AgradDistributionTestFixture, AgradDistributionWiener_v_43);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_44, AgradDistributionTestFixture, AgradDistributionWiener_v_44);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_45, AgradDistributionTestFixture, AgradDistributionWiener_v_45);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_46, AgradDistributionTestFixture, AgradDistributionWiener_v_46);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_47, AgradDistributionTestFixture, AgradDistributionWiener_v_47);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_48, AgradDistributionTestFixture, AgradDistributionWiener_v_48);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_49, AgradDistributionTestFixture, AgradDistributionWiener_v_49);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_50, AgradDistributionTestFixture, AgradDistributionWiener_v_50);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_51, AgradDistributionTestFixture, AgradDistributionWiener_v_51);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_52, AgradDistributionTestFixture, AgradDistributionWiener_v_52);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_53, AgradDistributionTestFixture, AgradDistributionWiener_v_53);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_54, AgradDistributionTestFixture, AgradDistributionWiener_v_54);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_55, AgradDistributionTestFixture, AgradDistributionWiener_v_55);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_56, AgradDistributionTestFixture, AgradDistributionWiener_v_56);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_57, AgradDistributionTestFixture, AgradDistributionWiener_v_57);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_58, AgradDistributionTestFixture, AgradDistributionWiener_v_58);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_59, AgradDistributionTestFixture, AgradDistributionWiener_v_59);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_60, AgradDistributionTestFixture, AgradDistributionWiener_v_60);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_61, AgradDistributionTestFixture, AgradDistributionWiener_v_61);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_62, AgradDistributionTestFixture, AgradDistributionWiener_v_62);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_63, AgradDistributionTestFixture, AgradDistributionWiener_v_63);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_64, AgradDistributionTestFixture, AgradDistributionWiener_v_64);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_65, AgradDistributionTestFixture, AgradDistributionWiener_v_65);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_66, AgradDistributionTestFixture, AgradDistributionWiener_v_66);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_67, AgradDistributionTestFixture, AgradDistributionWiener_v_67);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_68, AgradDistributionTestFixture, AgradDistributionWiener_v_68);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_69, AgradDistributionTestFixture, AgradDistributionWiener_v_69);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_70, AgradDistributionTestFixture, AgradDistributionWiener_v_70);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_71, AgradDistributionTestFixture, AgradDistributionWiener_v_71);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_72, AgradDistributionTestFixture, AgradDistributionWiener_v_72);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_73, AgradDistributionTestFixture, AgradDistributionWiener_v_73);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_74, AgradDistributionTestFixture, AgradDistributionWiener_v_74);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_75, AgradDistributionTestFixture, AgradDistributionWiener_v_75);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_76, AgradDistributionTestFixture, AgradDistributionWiener_v_76);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_77, AgradDistributionTestFixture, AgradDistributionWiener_v_77);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_78, AgradDistributionTestFixture, AgradDistributionWiener_v_78);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_79, AgradDistributionTestFixture, AgradDistributionWiener_v_79);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_80, AgradDistributionTestFixture, AgradDistributionWiener_v_80);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_81, AgradDistributionTestFixture, AgradDistributionWiener_v_81);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_82, AgradDistributionTestFixture, AgradDistributionWiener_v_82);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_83, AgradDistributionTestFixture, AgradDistributionWiener_v_83);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_84, AgradDistributionTestFixture, AgradDistributionWiener_v_84);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_85, AgradDistributionTestFixture, AgradDistributionWiener_v_85);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_86, AgradDistributionTestFixture, AgradDistributionWiener_v_86);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_87, AgradDistributionTestFixture, AgradDistributionWiener_v_87);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_88, AgradDistributionTestFixture, AgradDistributionWiener_v_88);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_89, AgradDistributionTestFixture, AgradDistributionWiener_v_89);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_90, AgradDistributionTestFixture, AgradDistributionWiener_v_90);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_91, AgradDistributionTestFixture, AgradDistributionWiener_v_91);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_92, AgradDistributionTestFixture, AgradDistributionWiener_v_92);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_93, AgradDistributionTestFixture, AgradDistributionWiener_v_93);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_94, AgradDistributionTestFixture, AgradDistributionWiener_v_94);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_95, AgradDistributionTestFixture, AgradDistributionWiener_v_95);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_96, AgradDistributionTestFixture, AgradDistributionWiener_v_96);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_97, AgradDistributionTestFixture, AgradDistributionWiener_v_97);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_98, AgradDistributionTestFixture, AgradDistributionWiener_v_98);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_99, AgradDistributionTestFixture, AgradDistributionWiener_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_100;
+typedef boost::mpl::vector<double, double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_101;
+typedef boost::mpl::vector<double, double, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_102;
+typedef boost::mpl::vector<double, double, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_103;
+typedef boost::mpl::vector<double, double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_104;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_105;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_106;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_107;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_108;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_109;
+typedef boost::mpl::vector<double, double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_110;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_111;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_112;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_113;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_114;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_115;
+typedef boost::mpl::vector<double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_116;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, double, double, empty> type_fd_117;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_118;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_119;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_120;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_121;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_122;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_123;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_124;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_125;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_126;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_127;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_128;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_129;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_130;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_131;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_132;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_133;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_134;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_135;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_136;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_137;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_138;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_139;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_140;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_141;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_142;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_143;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_144;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_145;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_146;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_147;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_148;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_149;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_150;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_151;
+typedef boost::mpl::vector<double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_152;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_153;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_154;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_155;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_156;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_157;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_158;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_159;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_160;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_161;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_162;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_163;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_164;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_165;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_166;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_167;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_168;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_169;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_170;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_171;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_172;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_173;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_174;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_175;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_176;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_177;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_178;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_179;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_180;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_181;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_182;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_183;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_184;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_185;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_186;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_187;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_188;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, fvar<double>, empty> type_fd_189;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, std::vector<fvar<double>>, empty> type_fd_190;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_191;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, fvar<double>, empty> type_fd_192;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_193;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_194;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_195;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_196;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_197;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<double>, double, empty> type_fd_198;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<double>, std::vector<double>, empty> type_fd_199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_100> AgradDistributionWiener_fd_100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_101> AgradDistributionWiener_fd_101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_102> AgradDistributionWiener_fd_102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_103> AgradDistributionWiener_fd_103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_104> AgradDistributionWiener_fd_104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_105> AgradDistributionWiener_fd_105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_106> AgradDistributionWiener_fd_106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_107> AgradDistributionWiener_fd_107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_108> AgradDistributionWiener_fd_108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_109> AgradDistributionWiener_fd_109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_110> AgradDistributionWiener_fd_110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_111> AgradDistributionWiener_fd_111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_112> AgradDistributionWiener_fd_112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_113> AgradDistributionWiener_fd_113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_114> AgradDistributionWiener_fd_114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_115> AgradDistributionWiener_fd_115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_116> AgradDistributionWiener_fd_116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_117> AgradDistributionWiener_fd_117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_118> AgradDistributionWiener_fd_118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_119> AgradDistributionWiener_fd_119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_120> AgradDistributionWiener_fd_120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_121> AgradDistributionWiener_fd_121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_122> AgradDistributionWiener_fd_122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_123> AgradDistributionWiener_fd_123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_124> AgradDistributionWiener_fd_124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_125> AgradDistributionWiener_fd_125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_126> AgradDistributionWiener_fd_126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_127> AgradDistributionWiener_fd_127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_128> AgradDistributionWiener_fd_128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_129> AgradDistributionWiener_fd_129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_130> AgradDistributionWiener_fd_130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_131> AgradDistributionWiener_fd_131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_132> AgradDistributionWiener_fd_132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_133> AgradDistributionWiener_fd_133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_134> AgradDistributionWiener_fd_134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_135> AgradDistributionWiener_fd_135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_136> AgradDistributionWiener_fd_136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_137> AgradDistributionWiener_fd_137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_138> AgradDistributionWiener_fd_138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_139> AgradDistributionWiener_fd_139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_140> AgradDistributionWiener_fd_140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_141> AgradDistributionWiener_fd_141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_142> AgradDistributionWiener_fd_142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_143> AgradDistributionWiener_fd_143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_144> AgradDistributionWiener_fd_144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_145> AgradDistributionWiener_fd_145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_146> AgradDistributionWiener_fd_146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_147> AgradDistributionWiener_fd_147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_148> AgradDistributionWiener_fd_148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_149> AgradDistributionWiener_fd_149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_150> AgradDistributionWiener_fd_150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_151> AgradDistributionWiener_fd_151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_152> AgradDistributionWiener_fd_152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_153> AgradDistributionWiener_fd_153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_154> AgradDistributionWiener_fd_154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_155> AgradDistributionWiener_fd_155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_156> AgradDistributionWiener_fd_156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_157> AgradDistributionWiener_fd_157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_158> AgradDistributionWiener_fd_158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_159> AgradDistributionWiener_fd_159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_160> AgradDistributionWiener_fd_160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_161> AgradDistributionWiener_fd_161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_162> AgradDistributionWiener_fd_162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_163> AgradDistributionWiener_fd_163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_164> AgradDistributionWiener_fd_164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_165> AgradDistributionWiener_fd_165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_166> AgradDistributionWiener_fd_166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_167> AgradDistributionWiener_fd_167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_168> AgradDistributionWiener_fd_168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_169> AgradDistributionWiener_fd_169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_170> AgradDistributionWiener_fd_170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_171> AgradDistributionWiener_fd_171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_172> AgradDistributionWiener_fd_172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_173> AgradDistributionWiener_fd_173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_174> AgradDistributionWiener_fd_174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_175> AgradDistributionWiener_fd_175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_176> AgradDistributionWiener_fd_176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_177> AgradDistributionWiener_fd_177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_178> AgradDistributionWiener_fd_178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_179> AgradDistributionWiener_fd_179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_180> AgradDistributionWiener_fd_180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_181> AgradDistributionWiener_fd_181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_182> AgradDistributionWiener_fd_182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_183> AgradDistributionWiener_fd_183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_184> AgradDistributionWiener_fd_184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_185> AgradDistributionWiener_fd_185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_186> AgradDistributionWiener_fd_186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_187> AgradDistributionWiener_fd_187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_188> AgradDistributionWiener_fd_188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_189> AgradDistributionWiener_fd_189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_190> AgradDistributionWiener_fd_190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_191> AgradDistributionWiener_fd_191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_192> AgradDistributionWiener_fd_192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_193> AgradDistributionWiener_fd_193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_194> AgradDistributionWiener_fd_194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_195> AgradDistributionWiener_fd_195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_196> AgradDistributionWiener_fd_196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_197> AgradDistributionWiener_fd_197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_198> AgradDistributionWiener_fd_198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_199> AgradDistributionWiener_fd_199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_100, AgradDistributionTestFixture, AgradDistributionWiener_fd_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_101, AgradDistributionTestFixture, AgradDistributionWiener_fd_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_102, AgradDistributionTestFixture, AgradDistributionWiener_fd_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_103, AgradDistributionTestFixture, AgradDistributionWiener_fd_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_104, AgradDistributionTestFixture, AgradDistributionWiener_fd_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_105, AgradDistributionTestFixture, AgradDistributionWiener_fd_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_106, AgradDistributionTestFixture, AgradDistributionWiener_fd_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_107, AgradDistributionTestFixture, AgradDistributionWiener_fd_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_108, AgradDistributionTestFixture, AgradDistributionWiener_fd_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_109, AgradDistributionTestFixture, AgradDistributionWiener_fd_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_110, AgradDistributionTestFixture, AgradDistributionWiener_fd_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_111, AgradDistributionTestFixture, AgradDistributionWiener_fd_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_112, AgradDistributionTestFixture, AgradDistributionWiener_fd_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_113, AgradDistributionTestFixture, AgradDistributionWiener_fd_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_114, AgradDistributionTestFixture, AgradDistributionWiener_fd_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_115, AgradDistributionTestFixture, AgradDistributionWiener_fd_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_116, AgradDistributionTestFixture, AgradDistributionWiener_fd_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_117, AgradDistributionTestFixture, AgradDistributionWiener_fd_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_118, AgradDistributionTestFixture, AgradDistributionWiener_fd_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_119, AgradDistributionTestFixture, AgradDistributionWiener_fd_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_120, AgradDistributionTestFixture, AgradDistributionWiener_fd_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_121, AgradDistributionTestFixture, AgradDistributionWiener_fd_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_122, AgradDistributionTestFixture, AgradDistributionWiener_fd_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_123, AgradDistributionTestFixture, AgradDistributionWiener_fd_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_124, AgradDistributionTestFixture, AgradDistributionWiener_fd_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_125, AgradDistributionTestFixture, AgradDistributionWiener_fd_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_126, AgradDistributionTestFixture, AgradDistributionWiener_fd_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_127, AgradDistributionTestFixture, AgradDistributionWiener_fd_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_128, AgradDistributionTestFixture, AgradDistributionWiener_fd_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_129, AgradDistributionTestFixture, AgradDistributionWiener_fd_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_130, AgradDistributionTestFixture, AgradDistributionWiener_fd_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_131, AgradDistributionTestFixture, AgradDistributionWiener_fd_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_132, AgradDistributionTestFixture, AgradDistributionWiener_fd_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_133, AgradDistributionTestFixture, AgradDistributionWiener_fd_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_134, AgradDistributionTestFixture, AgradDistributionWiener_fd_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_135, AgradDistributionTestFixture, AgradDistributionWiener_fd_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_136, AgradDistributionTestFixture, AgradDistributionWiener_fd_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_137, AgradDistributionTestFixture, AgradDistributionWiener_fd_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_138, AgradDistributionTestFixture, AgradDistributionWiener_fd_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_139, AgradDistributionTestFixture, AgradDistributionWiener_fd_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_140, AgradDistributionTestFixture, AgradDistributionWiener_fd_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_141, AgradDistributionTestFixture, AgradDistributionWiener_fd_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_142, AgradDistributionTestFixture, AgradDistributionWiener_fd_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_143, AgradDistributionTestFixture, AgradDistributionWiener_fd_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_144, AgradDistributionTestFixture, AgradDistributionWiener_fd_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_145, AgradDistributionTestFixture, AgradDistributionWiener_fd_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_146, AgradDistributionTestFixture, AgradDistributionWiener_fd_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_147, AgradDistributionTestFixture, AgradDistributionWiener_fd_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_148, AgradDistributionTestFixture, AgradDistributionWiener_fd_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_149, AgradDistributionTestFixture, AgradDistributionWiener_fd_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_150, AgradDistributionTestFixture, AgradDistributionWiener_fd_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_151, AgradDistributionTestFixture, AgradDistributionWiener_fd_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_152, AgradDistributionTestFixture, AgradDistributionWiener_fd_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_153, AgradDistributionTestFixture, AgradDistributionWiener_fd_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_154, AgradDistributionTestFixture, AgradDistributionWiener_fd_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_155, AgradDistributionTestFixture, AgradDistributionWiener_fd_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_156, AgradDistributionTestFixture, AgradDistributionWiener_fd_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_157, AgradDistributionTestFixture, AgradDistributionWiener_fd_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_158, AgradDistributionTestFixture, AgradDistributionWiener_fd_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_159, AgradDistributionTestFixture, AgradDistributionWiener_fd_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_160, AgradDistributionTestFixture, AgradDistributionWiener_fd_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_161, AgradDistributionTestFixture, AgradDistributionWiener_fd_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_162, AgradDistributionTestFixture, AgradDistributionWiener_fd_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_163, AgradDistributionTestFixture, AgradDistributionWiener_fd_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_164, AgradDistributionTestFixture, AgradDistributionWiener_fd_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_165, AgradDistributionTestFixture, AgradDistributionWiener_fd_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_166, AgradDistributionTestFixture, AgradDistributionWiener_fd_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_167, AgradDistributionTestFixture, AgradDistributionWiener_fd_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_168, AgradDistributionTestFixture, AgradDistributionWiener_fd_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_169, AgradDistributionTestFixture, AgradDistributionWiener_fd_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_170, AgradDistributionTestFixture, AgradDistributionWiener_fd_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_171, AgradDistributionTestFixture, AgradDistributionWiener_fd_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_172, AgradDistributionTestFixture, AgradDistributionWiener_fd_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_173, AgradDistributionTestFixture, AgradDistributionWiener_fd_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_174, AgradDistributionTestFixture, AgradDistributionWiener_fd_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_175, AgradDistributionTestFixture, AgradDistributionWiener_fd_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_176, AgradDistributionTestFixture, AgradDistributionWiener_fd_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_177, AgradDistributionTestFixture, AgradDistributionWiener_fd_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_178, AgradDistributionTestFixture, AgradDistributionWiener_fd_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_179, AgradDistributionTestFixture, AgradDistributionWiener_fd_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_180, AgradDistributionTestFixture, AgradDistributionWiener_fd_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_181, AgradDistributionTestFixture, AgradDistributionWiener_fd_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_182, AgradDistributionTestFixture, AgradDistributionWiener_fd_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_183, AgradDistributionTestFixture, AgradDistributionWiener_fd_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_184, AgradDistributionTestFixture, AgradDistributionWiener_fd_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_185, AgradDistributionTestFixture, AgradDistributionWiener_fd_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_186, AgradDistributionTestFixture, AgradDistributionWiener_fd_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_187, AgradDistributionTestFixture, AgradDistributionWiener_fd_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_188, AgradDistributionTestFixture, AgradDistributionWiener_fd_188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_189, AgradDistributionTestFixture, AgradDistributionWiener_fd_189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_190, AgradDistributionTestFixture, AgradDistributionWiener_fd_190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_191, AgradDistributionTestFixture, AgradDistributionWiener_fd_191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_192, AgradDistributionTestFixture, AgradDistributionWiener_fd_192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_193, AgradDistributionTestFixture, AgradDistributionWiener_fd_193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_194, AgradDistributionTestFixture, AgradDistributionWiener_fd_194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_195, AgradDistributionTestFixture, AgradDistributionWiener_fd_195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_196, AgradDistributionTestFixture, AgradDistributionWiener_fd_196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_197, AgradDistributionTestFixture, AgradDistributionWiener_fd_197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_198, AgradDistributionTestFixture, AgradDistributionWiener_fd_198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_199, AgradDistributionTestFixture, AgradDistributionWiener_fd_199);
+
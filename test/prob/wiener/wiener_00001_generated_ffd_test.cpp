@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_100;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_101;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_102;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_103;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_104;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_105;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_106;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_107;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_108;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_109;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_110;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_111;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_112;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_113;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_114;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_115;
+typedef boost::mpl::vector<double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_116;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_117;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_118;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_119;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_120;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_121;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_122;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_123;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_124;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_125;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_126;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_127;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_128;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_129;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_130;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_131;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_132;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_133;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_134;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_135;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_136;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_137;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_138;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_139;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_140;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_141;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_142;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_143;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_144;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_145;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_146;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_147;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_148;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_149;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_150;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_151;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_152;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_153;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_154;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_155;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_156;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_157;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_158;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_159;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_160;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_161;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_162;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_163;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_164;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_165;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_166;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_167;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_168;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_169;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_170;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_171;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_172;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_173;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_174;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_175;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_176;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_177;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_178;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_179;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_180;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_181;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_182;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_183;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_184;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_185;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_186;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_187;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_188;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, fvar<fvar<double> >, empty> type_ffd_189;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_190;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_191;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_192;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_193;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_194;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_195;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_196;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_197;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<double> >, double, empty> type_ffd_198;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_100> AgradDistributionWiener_ffd_100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_101> AgradDistributionWiener_ffd_101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_102> AgradDistributionWiener_ffd_102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_103> AgradDistributionWiener_ffd_103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_104> AgradDistributionWiener_ffd_104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_105> AgradDistributionWiener_ffd_105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_106> AgradDistributionWiener_ffd_106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_107> AgradDistributionWiener_ffd_107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_108> AgradDistributionWiener_ffd_108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_109> AgradDistributionWiener_ffd_109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_110> AgradDistributionWiener_ffd_110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_111> AgradDistributionWiener_ffd_111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_112> AgradDistributionWiener_ffd_112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_113> AgradDistributionWiener_ffd_113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_114> AgradDistributionWiener_ffd_114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_115> AgradDistributionWiener_ffd_115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_116> AgradDistributionWiener_ffd_116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_117> AgradDistributionWiener_ffd_117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_118> AgradDistributionWiener_ffd_118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_119> AgradDistributionWiener_ffd_119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_120> AgradDistributionWiener_ffd_120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_121> AgradDistributionWiener_ffd_121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_122> AgradDistributionWiener_ffd_122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_123> AgradDistributionWiener_ffd_123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_124> AgradDistributionWiener_ffd_124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_125> AgradDistributionWiener_ffd_125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_126> AgradDistributionWiener_ffd_126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_127> AgradDistributionWiener_ffd_127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_128> AgradDistributionWiener_ffd_128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_129> AgradDistributionWiener_ffd_129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_130> AgradDistributionWiener_ffd_130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_131> AgradDistributionWiener_ffd_131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_132> AgradDistributionWiener_ffd_132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_133> AgradDistributionWiener_ffd_133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_134> AgradDistributionWiener_ffd_134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_135> AgradDistributionWiener_ffd_135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_136> AgradDistributionWiener_ffd_136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_137> AgradDistributionWiener_ffd_137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_138> AgradDistributionWiener_ffd_138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_139> AgradDistributionWiener_ffd_139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_140> AgradDistributionWiener_ffd_140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_141> AgradDistributionWiener_ffd_141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_142> AgradDistributionWiener_ffd_142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_143> AgradDistributionWiener_ffd_143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_144> AgradDistributionWiener_ffd_144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_145> AgradDistributionWiener_ffd_145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_146> AgradDistributionWiener_ffd_146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_147> AgradDistributionWiener_ffd_147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_148> AgradDistributionWiener_ffd_148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_149> AgradDistributionWiener_ffd_149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_150> AgradDistributionWiener_ffd_150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_151> AgradDistributionWiener_ffd_151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_152> AgradDistributionWiener_ffd_152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_153> AgradDistributionWiener_ffd_153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_154> AgradDistributionWiener_ffd_154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_155> AgradDistributionWiener_ffd_155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_156> AgradDistributionWiener_ffd_156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_157> AgradDistributionWiener_ffd_157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_158> AgradDistributionWiener_ffd_158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_159> AgradDistributionWiener_ffd_159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_160> AgradDistributionWiener_ffd_160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_161> AgradDistributionWiener_ffd_161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_162> AgradDistributionWiener_ffd_162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_163> AgradDistributionWiener_ffd_163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_164> AgradDistributionWiener_ffd_164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_165> AgradDistributionWiener_ffd_165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_166> AgradDistributionWiener_ffd_166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_167> AgradDistributionWiener_ffd_167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_168> AgradDistributionWiener_ffd_168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_169> AgradDistributionWiener_ffd_169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_170> AgradDistributionWiener_ffd_170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_171> AgradDistributionWiener_ffd_171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_172> AgradDistributionWiener_ffd_172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_173> AgradDistributionWiener_ffd_173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_174> AgradDistributionWiener_ffd_174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_175> AgradDistributionWiener_ffd_175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_176> AgradDistributionWiener_ffd_176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_177> AgradDistributionWiener_ffd_177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_178> AgradDistributionWiener_ffd_178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_179> AgradDistributionWiener_ffd_179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_180> AgradDistributionWiener_ffd_180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_181> AgradDistributionWiener_ffd_181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_182> AgradDistributionWiener_ffd_182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_183> AgradDistributionWiener_ffd_183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_184> AgradDistributionWiener_ffd_184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_185> AgradDistributionWiener_ffd_185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_186> AgradDistributionWiener_ffd_186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_187> AgradDistributionWiener_ffd_187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_188> AgradDistributionWiener_ffd_188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_189> AgradDistributionWiener_ffd_189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_190> AgradDistributionWiener_ffd_190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_191> AgradDistributionWiener_ffd_191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_192> AgradDistributionWiener_ffd_192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_193> AgradDistributionWiener_ffd_193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_194> AgradDistributionWiener_ffd_194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_195> AgradDistributionWiener_ffd_195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_196> AgradDistributionWiener_ffd_196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_197> AgradDistributionWiener_ffd_197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_198> AgradDistributionWiener_ffd_198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_199> AgradDistributionWiener_ffd_199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_100, AgradDistributionTestFixture, AgradDistributionWiener_ffd_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_101, AgradDistributionTestFixture, AgradDistributionWiener_ffd_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_102, AgradDistributionTestFixture, AgradDistributionWiener_ffd_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_103, AgradDistributionTestFixture, AgradDistributionWiener_ffd_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_104, AgradDistributionTestFixture, AgradDistributionWiener_ffd_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_105, AgradDistributionTestFixture, AgradDistributionWiener_ffd_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_106, AgradDistributionTestFixture, AgradDistributionWiener_ffd_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_107, AgradDistributionTestFixture, AgradDistributionWiener_ffd_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_108, AgradDistributionTestFixture, AgradDistributionWiener_ffd_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_109, AgradDistributionTestFixture, AgradDistributionWiener_ffd_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_110, AgradDistributionTestFixture, AgradDistributionWiener_ffd_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_111, AgradDistributionTestFixture, AgradDistributionWiener_ffd_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_112, AgradDistributionTestFixture, AgradDistributionWiener_ffd_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_113, AgradDistributionTestFixture, AgradDistributionWiener_ffd_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_114, AgradDistributionTestFixture, AgradDistributionWiener_ffd_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_115, AgradDistributionTestFixture, AgradDistributionWiener_ffd_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_116, AgradDistributionTestFixture, AgradDistributionWiener_ffd_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_117, AgradDistributionTestFixture, AgradDistributionWiener_ffd_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_118, AgradDistributionTestFixture, AgradDistributionWiener_ffd_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_119, AgradDistributionTestFixture, AgradDistributionWiener_ffd_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_120, AgradDistributionTestFixture, AgradDistributionWiener_ffd_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_121, AgradDistributionTestFixture, AgradDistributionWiener_ffd_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_122, AgradDistributionTestFixture, AgradDistributionWiener_ffd_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_123, AgradDistributionTestFixture, AgradDistributionWiener_ffd_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_124, AgradDistributionTestFixture, AgradDistributionWiener_ffd_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_125, AgradDistributionTestFixture, AgradDistributionWiener_ffd_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_126, AgradDistributionTestFixture, AgradDistributionWiener_ffd_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_127, AgradDistributionTestFixture, AgradDistributionWiener_ffd_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_128, AgradDistributionTestFixture, AgradDistributionWiener_ffd_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_129, AgradDistributionTestFixture, AgradDistributionWiener_ffd_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_130, AgradDistributionTestFixture, AgradDistributionWiener_ffd_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_131, AgradDistributionTestFixture, AgradDistributionWiener_ffd_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_132, AgradDistributionTestFixture, AgradDistributionWiener_ffd_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_133, AgradDistributionTestFixture, AgradDistributionWiener_ffd_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_134, AgradDistributionTestFixture, AgradDistributionWiener_ffd_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_135, AgradDistributionTestFixture, AgradDistributionWiener_ffd_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_136, AgradDistributionTestFixture, AgradDistributionWiener_ffd_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_137, AgradDistributionTestFixture, AgradDistributionWiener_ffd_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_138, AgradDistributionTestFixture, AgradDistributionWiener_ffd_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_139, AgradDistributionTestFixture, AgradDistributionWiener_ffd_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_140, AgradDistributionTestFixture, AgradDistributionWiener_ffd_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_141, AgradDistributionTestFixture, AgradDistributionWiener_ffd_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_142, AgradDistributionTestFixture, AgradDistributionWiener_ffd_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_143, AgradDistributionTestFixture, AgradDistributionWiener_ffd_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_144, AgradDistributionTestFixture, AgradDistributionWiener_ffd_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_145, AgradDistributionTestFixture, AgradDistributionWiener_ffd_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_146, AgradDistributionTestFixture, AgradDistributionWiener_ffd_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_147, AgradDistributionTestFixture, AgradDistributionWiener_ffd_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_148, AgradDistributionTestFixture, AgradDistributionWiener_ffd_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_149, AgradDistributionTestFixture, AgradDistributionWiener_ffd_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_150, AgradDistributionTestFixture, AgradDistributionWiener_ffd_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_151, AgradDistributionTestFixture, AgradDistributionWiener_ffd_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_152, AgradDistributionTestFixture, AgradDistributionWiener_ffd_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_153, AgradDistributionTestFixture, AgradDistributionWiener_ffd_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_154, AgradDistributionTestFixture, AgradDistributionWiener_ffd_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_155, AgradDistributionTestFixture, AgradDistributionWiener_ffd_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_156, AgradDistributionTestFixture, AgradDistributionWiener_ffd_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_157, AgradDistributionTestFixture, AgradDistributionWiener_ffd_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_158, AgradDistributionTestFixture, AgradDistributionWiener_ffd_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_159, AgradDistributionTestFixture, AgradDistributionWiener_ffd_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_160, AgradDistributionTestFixture, AgradDistributionWiener_ffd_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_161, AgradDistributionTestFixture, AgradDistributionWiener_ffd_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_162, AgradDistributionTestFixture, AgradDistributionWiener_ffd_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_163, AgradDistributionTestFixture, AgradDistributionWiener_ffd_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_164, AgradDistributionTestFixture, AgradDistributionWiener_ffd_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_165, AgradDistributionTestFixture, AgradDistributionWiener_ffd_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_166, AgradDistributionTestFixture, AgradDistributionWiener_ffd_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_167, AgradDistributionTestFixture, AgradDistributionWiener_ffd_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_168, AgradDistributionTestFixture, AgradDistributionWiener_ffd_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_169, AgradDistributionTestFixture, AgradDistributionWiener_ffd_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_170, AgradDistributionTestFixture, AgradDistributionWiener_ffd_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_171, AgradDistributionTestFixture, AgradDistributionWiener_ffd_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_172, AgradDistributionTestFixture, AgradDistributionWiener_ffd_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_173, AgradDistributionTestFixture, AgradDistributionWiener_ffd_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_174, AgradDistributionTestFixture, AgradDistributionWiener_ffd_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_175, AgradDistributionTestFixture, AgradDistributionWiener_ffd_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_176, AgradDistributionTestFixture, AgradDistributionWiener_ffd_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_177, AgradDistributionTestFixture, AgradDistributionWiener_ffd_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_178, AgradDistributionTestFixture, AgradDistributionWiener_ffd_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_179, AgradDistributionTestFixture, AgradDistributionWiener_ffd_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_180, AgradDistributionTestFixture, AgradDistributionWiener_ffd_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_181, AgradDistributionTestFixture, AgradDistributionWiener_ffd_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_182, AgradDistributionTestFixture, AgradDistributionWiener_ffd_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_183, AgradDistributionTestFixture, AgradDistributionWiener_ffd_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_184, AgradDistributionTestFixture, AgradDistributionWiener_ffd_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_185, AgradDistributionTestFixture, AgradDistributionWiener_ffd_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_186, AgradDistributionTestFixture, AgradDistributionWiener_ffd_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_187, AgradDistributionTestFixture, AgradDistributionWiener_ffd_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_188, AgradDistributionTestFixture, AgradDistributionWiener_ffd_188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_189, AgradDistributionTestFixture, AgradDistributionWiener_ffd_189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_190, AgradDistributionTestFixture, AgradDistributionWiener_ffd_190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_191, AgradDistributionTestFixture, AgradDistributionWiener_ffd_191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_192, AgradDistributionTestFixture, AgradDistributionWiener_ffd_192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_193, AgradDistributionTestFixture, AgradDistributionWiener_ffd_193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_194, AgradDistributionTestFixture, AgradDistributionWiener_ffd_194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_195, AgradDistributionTestFixture, AgradDistributionWiener_ffd_195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_196, AgradDistributionTestFixture, AgradDistributionWiener_ffd_196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_197, AgradDistributionTestFixture, AgradDistributionWiener_ffd_197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_198, AgradDistributionTestFixture, AgradDistributionWiener_ffd_198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_199, AgradDistributionTestFixture, AgradDistributionWiener_ffd_199);
+
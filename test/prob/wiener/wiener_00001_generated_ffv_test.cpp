@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_100;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_101;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_102;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_103;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_104;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_105;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_106;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_107;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_108;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_109;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_110;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_111;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_112;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_113;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_114;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_115;
+typedef boost::mpl::vector<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_116;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_117;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_118;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_119;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_120;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_121;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_122;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_123;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_124;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_125;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_126;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_127;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_128;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_129;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_130;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_131;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_132;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_133;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_134;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_135;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_136;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_137;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_138;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_139;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_140;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_141;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_142;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_143;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_144;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_145;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_146;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_147;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_148;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_149;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_150;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_151;
+typedef boost::mpl::vector<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_152;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_153;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_154;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_155;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_156;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_157;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_158;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_159;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_160;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_161;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_162;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_163;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_164;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_165;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_166;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_167;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_168;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_169;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_170;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_171;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_172;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_173;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_174;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_175;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_176;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_177;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_178;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_179;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_180;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_181;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_182;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_183;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_184;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_185;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_186;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_187;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_188;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, fvar<fvar<var> >, empty> type_ffv_189;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_190;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_191;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_192;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_193;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_194;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_195;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_196;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_197;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<var> >, double, empty> type_ffv_198;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_100> AgradDistributionWiener_ffv_100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_101> AgradDistributionWiener_ffv_101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_102> AgradDistributionWiener_ffv_102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_103> AgradDistributionWiener_ffv_103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_104> AgradDistributionWiener_ffv_104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_105> AgradDistributionWiener_ffv_105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_106> AgradDistributionWiener_ffv_106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_107> AgradDistributionWiener_ffv_107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_108> AgradDistributionWiener_ffv_108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_109> AgradDistributionWiener_ffv_109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_110> AgradDistributionWiener_ffv_110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_111> AgradDistributionWiener_ffv_111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_112> AgradDistributionWiener_ffv_112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_113> AgradDistributionWiener_ffv_113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_114> AgradDistributionWiener_ffv_114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_115> AgradDistributionWiener_ffv_115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_116> AgradDistributionWiener_ffv_116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_117> AgradDistributionWiener_ffv_117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_118> AgradDistributionWiener_ffv_118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_119> AgradDistributionWiener_ffv_119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_120> AgradDistributionWiener_ffv_120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_121> AgradDistributionWiener_ffv_121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_122> AgradDistributionWiener_ffv_122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_123> AgradDistributionWiener_ffv_123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_124> AgradDistributionWiener_ffv_124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_125> AgradDistributionWiener_ffv_125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_126> AgradDistributionWiener_ffv_126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_127> AgradDistributionWiener_ffv_127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_128> AgradDistributionWiener_ffv_128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_129> AgradDistributionWiener_ffv_129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_130> AgradDistributionWiener_ffv_130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_131> AgradDistributionWiener_ffv_131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_132> AgradDistributionWiener_ffv_132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_133> AgradDistributionWiener_ffv_133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_134> AgradDistributionWiener_ffv_134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_135> AgradDistributionWiener_ffv_135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_136> AgradDistributionWiener_ffv_136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_137> AgradDistributionWiener_ffv_137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_138> AgradDistributionWiener_ffv_138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_139> AgradDistributionWiener_ffv_139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_140> AgradDistributionWiener_ffv_140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_141> AgradDistributionWiener_ffv_141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_142> AgradDistributionWiener_ffv_142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_143> AgradDistributionWiener_ffv_143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_144> AgradDistributionWiener_ffv_144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_145> AgradDistributionWiener_ffv_145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_146> AgradDistributionWiener_ffv_146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_147> AgradDistributionWiener_ffv_147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_148> AgradDistributionWiener_ffv_148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_149> AgradDistributionWiener_ffv_149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_150> AgradDistributionWiener_ffv_150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_151> AgradDistributionWiener_ffv_151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_152> AgradDistributionWiener_ffv_152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_153> AgradDistributionWiener_ffv_153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_154> AgradDistributionWiener_ffv_154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_155> AgradDistributionWiener_ffv_155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_156> AgradDistributionWiener_ffv_156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_157> AgradDistributionWiener_ffv_157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_158> AgradDistributionWiener_ffv_158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_159> AgradDistributionWiener_ffv_159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_160> AgradDistributionWiener_ffv_160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_161> AgradDistributionWiener_ffv_161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_162> AgradDistributionWiener_ffv_162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_163> AgradDistributionWiener_ffv_163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_164> AgradDistributionWiener_ffv_164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_165> AgradDistributionWiener_ffv_165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_166> AgradDistributionWiener_ffv_166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_167> AgradDistributionWiener_ffv_167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_168> AgradDistributionWiener_ffv_168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_169> AgradDistributionWiener_ffv_169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_170> AgradDistributionWiener_ffv_170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_171> AgradDistributionWiener_ffv_171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_172> AgradDistributionWiener_ffv_172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_173> AgradDistributionWiener_ffv_173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_174> AgradDistributionWiener_ffv_174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_175> AgradDistributionWiener_ffv_175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_176> AgradDistributionWiener_ffv_176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_177> AgradDistributionWiener_ffv_177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_178> AgradDistributionWiener_ffv_178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_179> AgradDistributionWiener_ffv_179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_180> AgradDistributionWiener_ffv_180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_181> AgradDistributionWiener_ffv_181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_182> AgradDistributionWiener_ffv_182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_183> AgradDistributionWiener_ffv_183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_184> AgradDistributionWiener_ffv_184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_185> AgradDistributionWiener_ffv_185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_186> AgradDistributionWiener_ffv_186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_187> AgradDistributionWiener_ffv_187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_188> AgradDistributionWiener_ffv_188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_189> AgradDistributionWiener_ffv_189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_190> AgradDistributionWiener_ffv_190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_191> AgradDistributionWiener_ffv_191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_192> AgradDistributionWiener_ffv_192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_193> AgradDistributionWiener_ffv_193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_194> AgradDistributionWiener_ffv_194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_195> AgradDistributionWiener_ffv_195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_196> AgradDistributionWiener_ffv_196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_197> AgradDistributionWiener_ffv_197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_198> AgradDistributionWiener_ffv_198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_199> AgradDistributionWiener_ffv_199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_100, AgradDistributionTestFixture, AgradDistributionWiener_ffv_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_101, AgradDistributionTestFixture, AgradDistributionWiener_ffv_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_102, AgradDistributionTestFixture, AgradDistributionWiener_ffv_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_103, AgradDistributionTestFixture, AgradDistributionWiener_ffv_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_104, AgradDistributionTestFixture, AgradDistributionWiener_ffv_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_105, AgradDistributionTestFixture, AgradDistributionWiener_ffv_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_106, AgradDistributionTestFixture, AgradDistributionWiener_ffv_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_107, AgradDistributionTestFixture, AgradDistributionWiener_ffv_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_108, AgradDistributionTestFixture, AgradDistributionWiener_ffv_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_109, AgradDistributionTestFixture, AgradDistributionWiener_ffv_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_110, AgradDistributionTestFixture, AgradDistributionWiener_ffv_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_111, AgradDistributionTestFixture, AgradDistributionWiener_ffv_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_112, AgradDistributionTestFixture, AgradDistributionWiener_ffv_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_113, AgradDistributionTestFixture, AgradDistributionWiener_ffv_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_114, AgradDistributionTestFixture, AgradDistributionWiener_ffv_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_115, AgradDistributionTestFixture, AgradDistributionWiener_ffv_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_116, AgradDistributionTestFixture, AgradDistributionWiener_ffv_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_117, AgradDistributionTestFixture, AgradDistributionWiener_ffv_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_118, AgradDistributionTestFixture, AgradDistributionWiener_ffv_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_119, AgradDistributionTestFixture, AgradDistributionWiener_ffv_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_120, AgradDistributionTestFixture, AgradDistributionWiener_ffv_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_121, AgradDistributionTestFixture, AgradDistributionWiener_ffv_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_122, AgradDistributionTestFixture, AgradDistributionWiener_ffv_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_123, AgradDistributionTestFixture, AgradDistributionWiener_ffv_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_124, AgradDistributionTestFixture, AgradDistributionWiener_ffv_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_125, AgradDistributionTestFixture, AgradDistributionWiener_ffv_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_126, AgradDistributionTestFixture, AgradDistributionWiener_ffv_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_127, AgradDistributionTestFixture, AgradDistributionWiener_ffv_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_128, AgradDistributionTestFixture, AgradDistributionWiener_ffv_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_129, AgradDistributionTestFixture, AgradDistributionWiener_ffv_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_130, AgradDistributionTestFixture, AgradDistributionWiener_ffv_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_131, AgradDistributionTestFixture, AgradDistributionWiener_ffv_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_132, AgradDistributionTestFixture, AgradDistributionWiener_ffv_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_133, AgradDistributionTestFixture, AgradDistributionWiener_ffv_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_134, AgradDistributionTestFixture, AgradDistributionWiener_ffv_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_135, AgradDistributionTestFixture, AgradDistributionWiener_ffv_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_136, AgradDistributionTestFixture, AgradDistributionWiener_ffv_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_137, AgradDistributionTestFixture, AgradDistributionWiener_ffv_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_138, AgradDistributionTestFixture, AgradDistributionWiener_ffv_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_139, AgradDistributionTestFixture, AgradDistributionWiener_ffv_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_140, AgradDistributionTestFixture, AgradDistributionWiener_ffv_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_141, AgradDistributionTestFixture, AgradDistributionWiener_ffv_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_142, AgradDistributionTestFixture, AgradDistributionWiener_ffv_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_143, AgradDistributionTestFixture, AgradDistributionWiener_ffv_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_144, AgradDistributionTestFixture, AgradDistributionWiener_ffv_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_145, AgradDistributionTestFixture, AgradDistributionWiener_ffv_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_146, AgradDistributionTestFixture, AgradDistributionWiener_ffv_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_147, AgradDistributionTestFixture, AgradDistributionWiener_ffv_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_148, AgradDistributionTestFixture, AgradDistributionWiener_ffv_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_149, AgradDistributionTestFixture, AgradDistributionWiener_ffv_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_150, AgradDistributionTestFixture, AgradDistributionWiener_ffv_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_151, AgradDistributionTestFixture, AgradDistributionWiener_ffv_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_152, AgradDistributionTestFixture, AgradDistributionWiener_ffv_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_153, AgradDistributionTestFixture, AgradDistributionWiener_ffv_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_154, AgradDistributionTestFixture, AgradDistributionWiener_ffv_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_155, AgradDistributionTestFixture, AgradDistributionWiener_ffv_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_156, AgradDistributionTestFixture, AgradDistributionWiener_ffv_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_157, AgradDistributionTestFixture, AgradDistributionWiener_ffv_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_158, AgradDistributionTestFixture, AgradDistributionWiener_ffv_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_159, AgradDistributionTestFixture, AgradDistributionWiener_ffv_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_160, AgradDistributionTestFixture, AgradDistributionWiener_ffv_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_161, AgradDistributionTestFixture, AgradDistributionWiener_ffv_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_162, AgradDistributionTestFixture, AgradDistributionWiener_ffv_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_163, AgradDistributionTestFixture, AgradDistributionWiener_ffv_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_164, AgradDistributionTestFixture, AgradDistributionWiener_ffv_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_165, AgradDistributionTestFixture, AgradDistributionWiener_ffv_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_166, AgradDistributionTestFixture, AgradDistributionWiener_ffv_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_167, AgradDistributionTestFixture, AgradDistributionWiener_ffv_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_168, AgradDistributionTestFixture, AgradDistributionWiener_ffv_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_169, AgradDistributionTestFixture, AgradDistributionWiener_ffv_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_170, AgradDistributionTestFixture, AgradDistributionWiener_ffv_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_171, AgradDistributionTestFixture, AgradDistributionWiener_ffv_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_172, AgradDistributionTestFixture, AgradDistributionWiener_ffv_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_173, AgradDistributionTestFixture, AgradDistributionWiener_ffv_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_174, AgradDistributionTestFixture, AgradDistributionWiener_ffv_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_175, AgradDistributionTestFixture, AgradDistributionWiener_ffv_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_176, AgradDistributionTestFixture, AgradDistributionWiener_ffv_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_177, AgradDistributionTestFixture, AgradDistributionWiener_ffv_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_178, AgradDistributionTestFixture, AgradDistributionWiener_ffv_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_179, AgradDistributionTestFixture, AgradDistributionWiener_ffv_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_180, AgradDistributionTestFixture, AgradDistributionWiener_ffv_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_181, AgradDistributionTestFixture, AgradDistributionWiener_ffv_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_182, AgradDistributionTestFixture, AgradDistributionWiener_ffv_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_183, AgradDistributionTestFixture, AgradDistributionWiener_ffv_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_184, AgradDistributionTestFixture, AgradDistributionWiener_ffv_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_185, AgradDistributionTestFixture, AgradDistributionWiener_ffv_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_186, AgradDistributionTestFixture, AgradDistributionWiener_ffv_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_187, AgradDistributionTestFixture, AgradDistributionWiener_ffv_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_188, AgradDistributionTestFixture, AgradDistributionWiener_ffv_188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_189, AgradDistributionTestFixture, AgradDistributionWiener_ffv_189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_190, AgradDistributionTestFixture, AgradDistributionWiener_ffv_190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_191, AgradDistributionTestFixture, AgradDistributionWiener_ffv_191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_192, AgradDistributionTestFixture, AgradDistributionWiener_ffv_192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_193, AgradDistributionTestFixture, AgradDistributionWiener_ffv_193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_194, AgradDistributionTestFixture, AgradDistributionWiener_ffv_194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_195, AgradDistributionTestFixture, AgradDistributionWiener_ffv_195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_196, AgradDistributionTestFixture, AgradDistributionWiener_ffv_196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_197, AgradDistributionTestFixture, AgradDistributionWiener_ffv_197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_198, AgradDistributionTestFixture, AgradDistributionWiener_ffv_198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_199, AgradDistributionTestFixture, AgradDistributionWiener_ffv_199);
+
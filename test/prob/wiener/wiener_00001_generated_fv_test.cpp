@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_100;
+typedef boost::mpl::vector<double, double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_101;
+typedef boost::mpl::vector<double, double, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_102;
+typedef boost::mpl::vector<double, double, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_103;
+typedef boost::mpl::vector<double, double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_104;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_105;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_106;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_107;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_108;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_109;
+typedef boost::mpl::vector<double, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_110;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_111;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_112;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_113;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_114;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_115;
+typedef boost::mpl::vector<double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_116;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, double, double, empty> type_fv_117;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_118;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_119;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_120;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_121;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_122;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_123;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_124;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_125;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_126;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_127;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_128;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_129;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_130;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_131;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_132;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_133;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_134;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_135;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_136;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_137;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_138;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_139;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_140;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_141;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_142;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_143;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_144;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_145;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_146;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_147;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_148;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_149;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_150;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_151;
+typedef boost::mpl::vector<double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_152;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_153;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_154;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_155;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_156;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_157;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_158;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_159;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_160;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_161;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_162;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_163;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_164;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_165;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_166;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_167;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_168;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_169;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_170;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_171;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_172;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_173;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_174;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_175;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_176;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_177;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_178;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_179;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_180;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_181;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_182;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_183;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_184;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_185;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_186;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_187;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_188;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, fvar<var>, empty> type_fv_189;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, std::vector<fvar<var>>, empty> type_fv_190;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_191;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, fvar<var>, empty> type_fv_192;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_193;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_194;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_195;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_196;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_197;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<var>, double, empty> type_fv_198;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<var>, std::vector<double>, empty> type_fv_199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_100> AgradDistributionWiener_fv_100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_101> AgradDistributionWiener_fv_101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_102> AgradDistributionWiener_fv_102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_103> AgradDistributionWiener_fv_103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_104> AgradDistributionWiener_fv_104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_105> AgradDistributionWiener_fv_105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_106> AgradDistributionWiener_fv_106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_107> AgradDistributionWiener_fv_107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_108> AgradDistributionWiener_fv_108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_109> AgradDistributionWiener_fv_109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_110> AgradDistributionWiener_fv_110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_111> AgradDistributionWiener_fv_111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_112> AgradDistributionWiener_fv_112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_113> AgradDistributionWiener_fv_113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_114> AgradDistributionWiener_fv_114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_115> AgradDistributionWiener_fv_115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_116> AgradDistributionWiener_fv_116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_117> AgradDistributionWiener_fv_117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_118> AgradDistributionWiener_fv_118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_119> AgradDistributionWiener_fv_119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_120> AgradDistributionWiener_fv_120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_121> AgradDistributionWiener_fv_121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_122> AgradDistributionWiener_fv_122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_123> AgradDistributionWiener_fv_123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_124> AgradDistributionWiener_fv_124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_125> AgradDistributionWiener_fv_125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_126> AgradDistributionWiener_fv_126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_127> AgradDistributionWiener_fv_127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_128> AgradDistributionWiener_fv_128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_129> AgradDistributionWiener_fv_129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_130> AgradDistributionWiener_fv_130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_131> AgradDistributionWiener_fv_131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_132> AgradDistributionWiener_fv_132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_133> AgradDistributionWiener_fv_133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_134> AgradDistributionWiener_fv_134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_135> AgradDistributionWiener_fv_135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_136> AgradDistributionWiener_fv_136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_137> AgradDistributionWiener_fv_137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_138> AgradDistributionWiener_fv_138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_139> AgradDistributionWiener_fv_139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_140> AgradDistributionWiener_fv_140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_141> AgradDistributionWiener_fv_141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_142> AgradDistributionWiener_fv_142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_143> AgradDistributionWiener_fv_143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_144> AgradDistributionWiener_fv_144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_145> AgradDistributionWiener_fv_145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_146> AgradDistributionWiener_fv_146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_147> AgradDistributionWiener_fv_147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_148> AgradDistributionWiener_fv_148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_149> AgradDistributionWiener_fv_149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_150> AgradDistributionWiener_fv_150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_151> AgradDistributionWiener_fv_151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_152> AgradDistributionWiener_fv_152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_153> AgradDistributionWiener_fv_153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_154> AgradDistributionWiener_fv_154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_155> AgradDistributionWiener_fv_155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_156> AgradDistributionWiener_fv_156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_157> AgradDistributionWiener_fv_157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_158> AgradDistributionWiener_fv_158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_159> AgradDistributionWiener_fv_159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_160> AgradDistributionWiener_fv_160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_161> AgradDistributionWiener_fv_161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_162> AgradDistributionWiener_fv_162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_163> AgradDistributionWiener_fv_163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_164> AgradDistributionWiener_fv_164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_165> AgradDistributionWiener_fv_165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_166> AgradDistributionWiener_fv_166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_167> AgradDistributionWiener_fv_167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_168> AgradDistributionWiener_fv_168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_169> AgradDistributionWiener_fv_169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_170> AgradDistributionWiener_fv_170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_171> AgradDistributionWiener_fv_171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_172> AgradDistributionWiener_fv_172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_173> AgradDistributionWiener_fv_173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_174> AgradDistributionWiener_fv_174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_175> AgradDistributionWiener_fv_175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_176> AgradDistributionWiener_fv_176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_177> AgradDistributionWiener_fv_177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_178> AgradDistributionWiener_fv_178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_179> AgradDistributionWiener_fv_179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_180> AgradDistributionWiener_fv_180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_181> AgradDistributionWiener_fv_181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_182> AgradDistributionWiener_fv_182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_183> AgradDistributionWiener_fv_183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_184> AgradDistributionWiener_fv_184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_185> AgradDistributionWiener_fv_185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_186> AgradDistributionWiener_fv_186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_187> AgradDistributionWiener_fv_187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_188> AgradDistributionWiener_fv_188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_189> AgradDistributionWiener_fv_189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_190> AgradDistributionWiener_fv_190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_191> AgradDistributionWiener_fv_191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_192> AgradDistributionWiener_fv_192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_193> AgradDistributionWiener_fv_193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_194> AgradDistributionWiener_fv_194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_195> AgradDistributionWiener_fv_195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_196> AgradDistributionWiener_fv_196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_197> AgradDistributionWiener_fv_197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_198> AgradDistributionWiener_fv_198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_199> AgradDistributionWiener_fv_199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_100, AgradDistributionTestFixture, AgradDistributionWiener_fv_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_101, AgradDistributionTestFixture, AgradDistributionWiener_fv_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_102, AgradDistributionTestFixture, AgradDistributionWiener_fv_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_103, AgradDistributionTestFixture, AgradDistributionWiener_fv_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_104, AgradDistributionTestFixture, AgradDistributionWiener_fv_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_105, AgradDistributionTestFixture, AgradDistributionWiener_fv_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_106, AgradDistributionTestFixture, AgradDistributionWiener_fv_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_107, AgradDistributionTestFixture, AgradDistributionWiener_fv_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_108, AgradDistributionTestFixture, AgradDistributionWiener_fv_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_109, AgradDistributionTestFixture, AgradDistributionWiener_fv_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_110, AgradDistributionTestFixture, AgradDistributionWiener_fv_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_111, AgradDistributionTestFixture, AgradDistributionWiener_fv_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_112, AgradDistributionTestFixture, AgradDistributionWiener_fv_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_113, AgradDistributionTestFixture, AgradDistributionWiener_fv_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_114, AgradDistributionTestFixture, AgradDistributionWiener_fv_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_115, AgradDistributionTestFixture, AgradDistributionWiener_fv_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_116, AgradDistributionTestFixture, AgradDistributionWiener_fv_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_117, AgradDistributionTestFixture, AgradDistributionWiener_fv_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_118, AgradDistributionTestFixture, AgradDistributionWiener_fv_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_119, AgradDistributionTestFixture, AgradDistributionWiener_fv_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_120, AgradDistributionTestFixture, AgradDistributionWiener_fv_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_121, AgradDistributionTestFixture, AgradDistributionWiener_fv_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_122, AgradDistributionTestFixture, AgradDistributionWiener_fv_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_123, AgradDistributionTestFixture, AgradDistributionWiener_fv_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_124, AgradDistributionTestFixture, AgradDistributionWiener_fv_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_125, AgradDistributionTestFixture, AgradDistributionWiener_fv_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_126, AgradDistributionTestFixture, AgradDistributionWiener_fv_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_127, AgradDistributionTestFixture, AgradDistributionWiener_fv_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_128, AgradDistributionTestFixture, AgradDistributionWiener_fv_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_129, AgradDistributionTestFixture, AgradDistributionWiener_fv_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_130, AgradDistributionTestFixture, AgradDistributionWiener_fv_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_131, AgradDistributionTestFixture, AgradDistributionWiener_fv_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_132, AgradDistributionTestFixture, AgradDistributionWiener_fv_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_133, AgradDistributionTestFixture, AgradDistributionWiener_fv_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_134, AgradDistributionTestFixture, AgradDistributionWiener_fv_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_135, AgradDistributionTestFixture, AgradDistributionWiener_fv_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_136, AgradDistributionTestFixture, AgradDistributionWiener_fv_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_137, AgradDistributionTestFixture, AgradDistributionWiener_fv_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_138, AgradDistributionTestFixture, AgradDistributionWiener_fv_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_139, AgradDistributionTestFixture, AgradDistributionWiener_fv_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_140, AgradDistributionTestFixture, AgradDistributionWiener_fv_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_141, AgradDistributionTestFixture, AgradDistributionWiener_fv_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_142, AgradDistributionTestFixture, AgradDistributionWiener_fv_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_143, AgradDistributionTestFixture, AgradDistributionWiener_fv_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_144, AgradDistributionTestFixture, AgradDistributionWiener_fv_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_145, AgradDistributionTestFixture, AgradDistributionWiener_fv_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_146, AgradDistributionTestFixture, AgradDistributionWiener_fv_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_147, AgradDistributionTestFixture, AgradDistributionWiener_fv_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_148, AgradDistributionTestFixture, AgradDistributionWiener_fv_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_149, AgradDistributionTestFixture, AgradDistributionWiener_fv_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_150, AgradDistributionTestFixture, AgradDistributionWiener_fv_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_151, AgradDistributionTestFixture, AgradDistributionWiener_fv_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_152, AgradDistributionTestFixture, AgradDistributionWiener_fv_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_153, AgradDistributionTestFixture, AgradDistributionWiener_fv_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_154, AgradDistributionTestFixture, AgradDistributionWiener_fv_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_155, AgradDistributionTestFixture, AgradDistributionWiener_fv_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_156, AgradDistributionTestFixture, AgradDistributionWiener_fv_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_157, AgradDistributionTestFixture, AgradDistributionWiener_fv_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_158, AgradDistributionTestFixture, AgradDistributionWiener_fv_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_159, AgradDistributionTestFixture, AgradDistributionWiener_fv_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_160, AgradDistributionTestFixture, AgradDistributionWiener_fv_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_161, AgradDistributionTestFixture, AgradDistributionWiener_fv_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_162, AgradDistributionTestFixture, AgradDistributionWiener_fv_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_163, AgradDistributionTestFixture, AgradDistributionWiener_fv_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_164, AgradDistributionTestFixture, AgradDistributionWiener_fv_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_165, AgradDistributionTestFixture, AgradDistributionWiener_fv_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_166, AgradDistributionTestFixture, AgradDistributionWiener_fv_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_167, AgradDistributionTestFixture, AgradDistributionWiener_fv_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_168, AgradDistributionTestFixture, AgradDistributionWiener_fv_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_169, AgradDistributionTestFixture, AgradDistributionWiener_fv_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_170, AgradDistributionTestFixture, AgradDistributionWiener_fv_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_171, AgradDistributionTestFixture, AgradDistributionWiener_fv_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_172, AgradDistributionTestFixture, AgradDistributionWiener_fv_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_173, AgradDistributionTestFixture, AgradDistributionWiener_fv_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_174, AgradDistributionTestFixture, AgradDistributionWiener_fv_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_175, AgradDistributionTestFixture, AgradDistributionWiener_fv_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_176, AgradDistributionTestFixture, AgradDistributionWiener_fv_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_177, AgradDistributionTestFixture, AgradDistributionWiener_fv_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_178, AgradDistributionTestFixture, AgradDistributionWiener_fv_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_179, AgradDistributionTestFixture, AgradDistributionWiener_fv_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_180, AgradDistributionTestFixture, AgradDistributionWiener_fv_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_181, AgradDistributionTestFixture, AgradDistributionWiener_fv_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_182, AgradDistributionTestFixture, AgradDistributionWiener_fv_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_183, AgradDistributionTestFixture, AgradDistributionWiener_fv_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_184, AgradDistributionTestFixture, AgradDistributionWiener_fv_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_185, AgradDistributionTestFixture, AgradDistributionWiener_fv_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_186, AgradDistributionTestFixture, AgradDistributionWiener_fv_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_187, AgradDistributionTestFixture, AgradDistributionWiener_fv_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_188, AgradDistributionTestFixture, AgradDistributionWiener_fv_188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_189, AgradDistributionTestFixture, AgradDistributionWiener_fv_189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_190, AgradDistributionTestFixture, AgradDistributionWiener_fv_190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_191, AgradDistributionTestFixture, AgradDistributionWiener_fv_191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_192, AgradDistributionTestFixture, AgradDistributionWiener_fv_192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_193, AgradDistributionTestFixture, AgradDistributionWiener_fv_193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_194, AgradDistributionTestFixture, AgradDistributionWiener_fv_194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_195, AgradDistributionTestFixture, AgradDistributionWiener_fv_195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_196, AgradDistributionTestFixture, AgradDistributionWiener_fv_196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_197, AgradDistributionTestFixture, AgradDistributionWiener_fv_197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_198, AgradDistributionTestFixture, AgradDistributionWiener_fv_198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_199, AgradDistributionTestFixture, AgradDistributionWiener_fv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_100;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_101;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_102;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_103;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_104;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_105;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_106;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_107;
+typedef boost::mpl::vector<double, double, var, double, double, empty> type_v_108;
+typedef boost::mpl::vector<double, double, var, double, std::vector<double>, empty> type_v_109;
+typedef boost::mpl::vector<double, double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_110;
+typedef boost::mpl::vector<double, double, var, double, var, empty> type_v_111;
+typedef boost::mpl::vector<double, double, var, double, std::vector<var>, empty> type_v_112;
+typedef boost::mpl::vector<double, double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_113;
+typedef boost::mpl::vector<double, double, var, std::vector<double>, double, empty> type_v_114;
+typedef boost::mpl::vector<double, double, var, std::vector<double>, std::vector<double>, empty> type_v_115;
+typedef boost::mpl::vector<double, double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_116;
+typedef boost::mpl::vector<double, double, var, std::vector<double>, var, empty> type_v_117;
+typedef boost::mpl::vector<double, double, var, std::vector<double>, std::vector<var>, empty> type_v_118;
+typedef boost::mpl::vector<double, double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_119;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_120;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_121;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_122;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_123;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_124;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_125;
+typedef boost::mpl::vector<double, double, var, var, double, empty> type_v_126;
+typedef boost::mpl::vector<double, double, var, var, std::vector<double>, empty> type_v_127;
+typedef boost::mpl::vector<double, double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_128;
+typedef boost::mpl::vector<double, double, var, var, var, empty> type_v_129;
+typedef boost::mpl::vector<double, double, var, var, std::vector<var>, empty> type_v_130;
+typedef boost::mpl::vector<double, double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_131;
+typedef boost::mpl::vector<double, double, var, std::vector<var>, double, empty> type_v_132;
+typedef boost::mpl::vector<double, double, var, std::vector<var>, std::vector<double>, empty> type_v_133;
+typedef boost::mpl::vector<double, double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_134;
+typedef boost::mpl::vector<double, double, var, std::vector<var>, var, empty> type_v_135;
+typedef boost::mpl::vector<double, double, var, std::vector<var>, std::vector<var>, empty> type_v_136;
+typedef boost::mpl::vector<double, double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_137;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_138;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_139;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_140;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_141;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_142;
+typedef boost::mpl::vector<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_143;
+typedef boost::mpl::vector<double, double, std::vector<var>, double, double, empty> type_v_144;
+typedef boost::mpl::vector<double, double, std::vector<var>, double, std::vector<double>, empty> type_v_145;
+typedef boost::mpl::vector<double, double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_146;
+typedef boost::mpl::vector<double, double, std::vector<var>, double, var, empty> type_v_147;
+typedef boost::mpl::vector<double, double, std::vector<var>, double, std::vector<var>, empty> type_v_148;
+typedef boost::mpl::vector<double, double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_149;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<double>, double, empty> type_v_150;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_151;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_152;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<double>, var, empty> type_v_153;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_154;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_155;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_156;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_157;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_158;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_159;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_160;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_161;
+typedef boost::mpl::vector<double, double, std::vector<var>, var, double, empty> type_v_162;
+typedef boost::mpl::vector<double, double, std::vector<var>, var, std::vector<double>, empty> type_v_163;
+typedef boost::mpl::vector<double, double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_164;
+typedef boost::mpl::vector<double, double, std::vector<var>, var, var, empty> type_v_165;
+typedef boost::mpl::vector<double, double, std::vector<var>, var, std::vector<var>, empty> type_v_166;
+typedef boost::mpl::vector<double, double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_167;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<var>, double, empty> type_v_168;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_169;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_170;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<var>, var, empty> type_v_171;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_172;
+typedef boost::mpl::vector<double, double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_173;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_174;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_175;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_176;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_177;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_178;
+typedef boost::mpl::vector<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_179;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_180;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_181;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_182;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_183;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_184;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_185;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_186;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_187;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_188;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_189;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_190;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_191;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_192;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_193;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_194;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_195;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_196;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_197;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_198;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_100> AgradDistributionWiener_v_100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_101> AgradDistributionWiener_v_101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_102> AgradDistributionWiener_v_102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_103> AgradDistributionWiener_v_103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_104> AgradDistributionWiener_v_104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_105> AgradDistributionWiener_v_105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_106> AgradDistributionWiener_v_106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_107> AgradDistributionWiener_v_107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_108> AgradDistributionWiener_v_108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_109> AgradDistributionWiener_v_109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_110> AgradDistributionWiener_v_110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_111> AgradDistributionWiener_v_111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_112> AgradDistributionWiener_v_112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_113> AgradDistributionWiener_v_113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_114> AgradDistributionWiener_v_114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_115> AgradDistributionWiener_v_115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_116> AgradDistributionWiener_v_116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_117> AgradDistributionWiener_v_117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_118> AgradDistributionWiener_v_118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_119> AgradDistributionWiener_v_119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_120> AgradDistributionWiener_v_120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_121> AgradDistributionWiener_v_121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_122> AgradDistributionWiener_v_122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_123> AgradDistributionWiener_v_123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_124> AgradDistributionWiener_v_124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_125> AgradDistributionWiener_v_125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_126> AgradDistributionWiener_v_126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_127> AgradDistributionWiener_v_127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_128> AgradDistributionWiener_v_128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_129> AgradDistributionWiener_v_129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_130> AgradDistributionWiener_v_130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_131> AgradDistributionWiener_v_131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_132> AgradDistributionWiener_v_132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_133> AgradDistributionWiener_v_133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_134> AgradDistributionWiener_v_134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_135> AgradDistributionWiener_v_135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_136> AgradDistributionWiener_v_136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_137> AgradDistributionWiener_v_137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_138> AgradDistributionWiener_v_138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_139> AgradDistributionWiener_v_139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_140> AgradDistributionWiener_v_140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_141> AgradDistributionWiener_v_141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_142> AgradDistributionWiener_v_142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_143> AgradDistributionWiener_v_143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_144> AgradDistributionWiener_v_144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_145> AgradDistributionWiener_v_145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_146> AgradDistributionWiener_v_146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_147> AgradDistributionWiener_v_147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_148> AgradDistributionWiener_v_148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_149> AgradDistributionWiener_v_149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_150> AgradDistributionWiener_v_150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_151> AgradDistributionWiener_v_151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_152> AgradDistributionWiener_v_152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_153> AgradDistributionWiener_v_153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_154> AgradDistributionWiener_v_154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_155> AgradDistributionWiener_v_155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_156> AgradDistributionWiener_v_156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_157> AgradDistributionWiener_v_157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_158> AgradDistributionWiener_v_158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_159> AgradDistributionWiener_v_159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_160> AgradDistributionWiener_v_160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_161> AgradDistributionWiener_v_161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_162> AgradDistributionWiener_v_162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_163> AgradDistributionWiener_v_163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_164> AgradDistributionWiener_v_164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_165> AgradDistributionWiener_v_165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_166> AgradDistributionWiener_v_166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_167> AgradDistributionWiener_v_167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_168> AgradDistributionWiener_v_168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_169> AgradDistributionWiener_v_169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_170> AgradDistributionWiener_v_170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_171> AgradDistributionWiener_v_171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_172> AgradDistributionWiener_v_172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_173> AgradDistributionWiener_v_173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_174> AgradDistributionWiener_v_174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_175> AgradDistributionWiener_v_175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_176> AgradDistributionWiener_v_176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_177> AgradDistributionWiener_v_177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_178> AgradDistributionWiener_v_178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_179> AgradDistributionWiener_v_179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_180> AgradDistributionWiener_v_180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_181> AgradDistributionWiener_v_181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_182> AgradDistributionWiener_v_182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_183> AgradDistributionWiener_v_183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_184> AgradDistributionWiener_v_184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_185> AgradDistributionWiener_v_185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_186> AgradDistributionWiener_v_186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_187> AgradDistributionWiener_v_187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_188> AgradDistributionWiener_v_188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_189> AgradDistributionWiener_v_189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_190> AgradDistributionWiener_v_190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_191> AgradDistributionWiener_v_191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_192> AgradDistributionWiener_v_192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_193> AgradDistributionWiener_v_193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_194> AgradDistributionWiener_v_194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_195> AgradDistributionWiener_v_195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_196> AgradDistributionWiener_v_196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_197> AgradDistributionWiener_v_197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_198> AgradDistributionWiener_v_198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_199> AgradDistributionWiener_v_199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_100, AgradDistributionTestFixture, AgradDistributionWiener_v_100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_101, AgradDistributionTestFixture, AgradDistributionWiener_v_101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_102, AgradDistributionTestFixture, AgradDistributionWiener_v_102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_103, AgradDistributionTestFixture, AgradDistributionWiener_v_103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_104, AgradDistributionTestFixture, AgradDistributionWiener_v_104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_105, AgradDistributionTestFixture, AgradDistributionWiener_v_105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_106, AgradDistributionTestFixture, AgradDistributionWiener_v_106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_107, AgradDistributionTestFixture, AgradDistributionWiener_v_107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_108, AgradDistributionTestFixture, AgradDistributionWiener_v_108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_109, AgradDistributionTestFixture, AgradDistributionWiener_v_109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_110, AgradDistributionTestFixture, AgradDistributionWiener_v_110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_111, AgradDistributionTestFixture, AgradDistributionWiener_v_111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_112, AgradDistributionTestFixture, AgradDistributionWiener_v_112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_113, AgradDistributionTestFixture, AgradDistributionWiener_v_113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_114, AgradDistributionTestFixture, AgradDistributionWiener_v_114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_115, AgradDistributionTestFixture, AgradDistributionWiener_v_115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_116, AgradDistributionTestFixture, AgradDistributionWiener_v_116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_117, AgradDistributionTestFixture, AgradDistributionWiener_v_117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_118, AgradDistributionTestFixture, AgradDistributionWiener_v_118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_119, AgradDistributionTestFixture, AgradDistributionWiener_v_119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_120, AgradDistributionTestFixture, AgradDistributionWiener_v_120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_121, AgradDistributionTestFixture, AgradDistributionWiener_v_121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_122, AgradDistributionTestFixture, AgradDistributionWiener_v_122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_123, AgradDistributionTestFixture, AgradDistributionWiener_v_123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_124, AgradDistributionTestFixture, AgradDistributionWiener_v_124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_125, AgradDistributionTestFixture, AgradDistributionWiener_v_125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_126, AgradDistributionTestFixture, AgradDistributionWiener_v_126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_127, AgradDistributionTestFixture, AgradDistributionWiener_v_127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_128, AgradDistributionTestFixture, AgradDistributionWiener_v_128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_129, AgradDistributionTestFixture, AgradDistributionWiener_v_129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_130, AgradDistributionTestFixture, AgradDistributionWiener_v_130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_131, AgradDistributionTestFixture, AgradDistributionWiener_v_131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_132, AgradDistributionTestFixture, AgradDistributionWiener_v_132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_133, AgradDistributionTestFixture, AgradDistributionWiener_v_133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_134, AgradDistributionTestFixture, AgradDistributionWiener_v_134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_135, AgradDistributionTestFixture, AgradDistributionWiener_v_135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_136, AgradDistributionTestFixture, AgradDistributionWiener_v_136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_137, AgradDistributionTestFixture, AgradDistributionWiener_v_137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_138, AgradDistributionTestFixture, AgradDistributionWiener_v_138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_139, AgradDistributionTestFixture, AgradDistributionWiener_v_139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_140, AgradDistributionTestFixture, AgradDistributionWiener_v_140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_141, AgradDistributionTestFixture, AgradDistributionWiener_v_141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_142, AgradDistributionTestFixture, AgradDistributionWiener_v_142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_143, AgradDistributionTestFixture, AgradDistributionWiener_v_143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_144, AgradDistributionTestFixture, AgradDistributionWiener_v_144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_145, AgradDistributionTestFixture, AgradDistributionWiener_v_145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_146, AgradDistributionTestFixture, AgradDistributionWiener_v_146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_147, AgradDistributionTestFixture, AgradDistributionWiener_v_147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_148, AgradDistributionTestFixture, AgradDistributionWiener_v_148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_149, AgradDistributionTestFixture, AgradDistributionWiener_v_149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_150, AgradDistributionTestFixture, AgradDistributionWiener_v_150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_151, AgradDistributionTestFixture, AgradDistributionWiener_v_151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_152, AgradDistributionTestFixture, AgradDistributionWiener_v_152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_153, AgradDistributionTestFixture, AgradDistributionWiener_v_153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_154, AgradDistributionTestFixture, AgradDistributionWiener_v_154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_155, AgradDistributionTestFixture, AgradDistributionWiener_v_155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_156, AgradDistributionTestFixture, AgradDistributionWiener_v_156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_157, AgradDistributionTestFixture, AgradDistributionWiener_v_157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_158, AgradDistributionTestFixture, AgradDistributionWiener_v_158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_159, AgradDistributionTestFixture, AgradDistributionWiener_v_159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_160, AgradDistributionTestFixture, AgradDistributionWiener_v_160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_161, AgradDistributionTestFixture, AgradDistributionWiener_v_161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_162, AgradDistributionTestFixture, AgradDistributionWiener_v_162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_163, AgradDistributionTestFixture, AgradDistributionWiener_v_163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_164, AgradDistributionTestFixture, AgradDistributionWiener_v_164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_165, AgradDistributionTestFixture, AgradDistributionWiener_v_165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_166, AgradDistributionTestFixture, AgradDistributionWiener_v_166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_167, AgradDistributionTestFixture, AgradDistributionWiener_v_167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_168, AgradDistributionTestFixture, AgradDistributionWiener_v_168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_169, AgradDistributionTestFixture, AgradDistributionWiener_v_169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_170, AgradDistributionTestFixture, AgradDistributionWiener_v_170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_171, AgradDistributionTestFixture, AgradDistributionWiener_v_171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_172, AgradDistributionTestFixture, AgradDistributionWiener_v_172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_173, AgradDistributionTestFixture, AgradDistributionWiener_v_173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_174, AgradDistributionTestFixture, AgradDistributionWiener_v_174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_175, AgradDistributionTestFixture, AgradDistributionWiener_v_175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_176, AgradDistributionTestFixture, AgradDistributionWiener_v_176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_177, AgradDistributionTestFixture, AgradDistributionWiener_v_177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_178, AgradDistributionTestFixture, AgradDistributionWiener_v_178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_179, AgradDistributionTestFixture, AgradDistributionWiener_v_179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_180, AgradDistributionTestFixture, AgradDistributionWiener_v_180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_181, AgradDistributionTestFixture, AgradDistributionWiener_v_181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_182, AgradDistributionTestFixture, AgradDistributionWiener_v_182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_183, AgradDistributionTestFixture, AgradDistributionWiener_v_183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_184, AgradDistributionTestFixture, AgradDistributionWiener_v_184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_185, AgradDistributionTestFixture, AgradDistributionWiener_v_185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_186, AgradDistributionTestFixture, AgradDistributionWiener_v_186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_187, AgradDistributionTestFixture, AgradDistributionWiener_v_187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_188, AgradDistributionTestFixture, AgradDistributionWiener_v_188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_189, AgradDistributionTestFixture, AgradDistributionWiener_v_189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_190, AgradDistributionTestFixture, AgradDistributionWiener_v_190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_191, AgradDistributionTestFixture, AgradDistributionWiener_v_191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_192, AgradDistributionTestFixture, AgradDistributionWiener_v_192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_193, AgradDistributionTestFixture, AgradDistributionWiener_v_193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_194, AgradDistributionTestFixture, AgradDistributionWiener_v_194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_195, AgradDistributionTestFixture, AgradDistributionWiener_v_195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_196, AgradDistributionTestFixture, AgradDistributionWiener_v_196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_197, AgradDistributionTestFixture, AgradDistributionWiener_v_197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_198, AgradDistributionTestFixture, AgradDistributionWiener_v_198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_199, AgradDistributionTestFixture, AgradDistributionWiener_v_199);
+
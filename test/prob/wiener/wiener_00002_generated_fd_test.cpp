@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_200;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<double>, fvar<double>, empty> type_fd_201;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_202;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_203;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<double>>, double, empty> type_fd_204;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_205;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_206;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_207;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_208;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_209;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_210;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_211;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_212;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_213;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_214;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_215;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, fvar<double>, empty> type_fd_216;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_217;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_218;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_219;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_220;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_221;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_222;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_223;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_224;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<double>, double, empty> type_fd_225;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_226;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_227;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_228;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_229;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_230;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_231;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_232;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_233;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_234;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_235;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_236;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_237;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_238;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_239;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_240;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_241;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_242;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_243;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_244;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_245;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_246;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_247;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_248;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_249;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_250;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_251;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_252;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_253;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_254;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_255;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_256;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_257;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_258;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_259;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_260;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_261;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_262;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_263;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_264;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_265;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_266;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_267;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_268;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_269;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, double, double, empty> type_fd_270;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, double, std::vector<double>, empty> type_fd_271;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_272;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, double, fvar<double>, empty> type_fd_273;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_274;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_275;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<double>, double, empty> type_fd_276;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_277;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_278;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_279;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_280;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_281;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_282;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_283;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_284;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_285;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_286;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_287;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, fvar<double>, double, empty> type_fd_288;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_289;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_290;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_291;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_292;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_293;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_294;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_295;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_296;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_297;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_298;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_200> AgradDistributionWiener_fd_200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_201> AgradDistributionWiener_fd_201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_202> AgradDistributionWiener_fd_202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_203> AgradDistributionWiener_fd_203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_204> AgradDistributionWiener_fd_204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_205> AgradDistributionWiener_fd_205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_206> AgradDistributionWiener_fd_206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_207> AgradDistributionWiener_fd_207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_208> AgradDistributionWiener_fd_208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_209> AgradDistributionWiener_fd_209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_210> AgradDistributionWiener_fd_210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_211> AgradDistributionWiener_fd_211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_212> AgradDistributionWiener_fd_212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_213> AgradDistributionWiener_fd_213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_214> AgradDistributionWiener_fd_214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_215> AgradDistributionWiener_fd_215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_216> AgradDistributionWiener_fd_216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_217> AgradDistributionWiener_fd_217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_218> AgradDistributionWiener_fd_218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_219> AgradDistributionWiener_fd_219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_220> AgradDistributionWiener_fd_220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_221> AgradDistributionWiener_fd_221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_222> AgradDistributionWiener_fd_222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_223> AgradDistributionWiener_fd_223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_224> AgradDistributionWiener_fd_224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_225> AgradDistributionWiener_fd_225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_226> AgradDistributionWiener_fd_226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_227> AgradDistributionWiener_fd_227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_228> AgradDistributionWiener_fd_228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_229> AgradDistributionWiener_fd_229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_230> AgradDistributionWiener_fd_230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_231> AgradDistributionWiener_fd_231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_232> AgradDistributionWiener_fd_232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_233> AgradDistributionWiener_fd_233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_234> AgradDistributionWiener_fd_234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_235> AgradDistributionWiener_fd_235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_236> AgradDistributionWiener_fd_236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_237> AgradDistributionWiener_fd_237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_238> AgradDistributionWiener_fd_238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_239> AgradDistributionWiener_fd_239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_240> AgradDistributionWiener_fd_240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_241> AgradDistributionWiener_fd_241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_242> AgradDistributionWiener_fd_242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_243> AgradDistributionWiener_fd_243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_244> AgradDistributionWiener_fd_244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_245> AgradDistributionWiener_fd_245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_246> AgradDistributionWiener_fd_246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_247> AgradDistributionWiener_fd_247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_248> AgradDistributionWiener_fd_248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_249> AgradDistributionWiener_fd_249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_250> AgradDistributionWiener_fd_250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_251> AgradDistributionWiener_fd_251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_252> AgradDistributionWiener_fd_252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_253> AgradDistributionWiener_fd_253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_254> AgradDistributionWiener_fd_254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_255> AgradDistributionWiener_fd_255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_256> AgradDistributionWiener_fd_256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_257> AgradDistributionWiener_fd_257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_258> AgradDistributionWiener_fd_258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_259> AgradDistributionWiener_fd_259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_260> AgradDistributionWiener_fd_260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_261> AgradDistributionWiener_fd_261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_262> AgradDistributionWiener_fd_262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_263> AgradDistributionWiener_fd_263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_264> AgradDistributionWiener_fd_264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_265> AgradDistributionWiener_fd_265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_266> AgradDistributionWiener_fd_266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_267> AgradDistributionWiener_fd_267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_268> AgradDistributionWiener_fd_268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_269> AgradDistributionWiener_fd_269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_270> AgradDistributionWiener_fd_270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_271> AgradDistributionWiener_fd_271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_272> AgradDistributionWiener_fd_272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_273> AgradDistributionWiener_fd_273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_274> AgradDistributionWiener_fd_274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_275> AgradDistributionWiener_fd_275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_276> AgradDistributionWiener_fd_276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_277> AgradDistributionWiener_fd_277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_278> AgradDistributionWiener_fd_278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_279> AgradDistributionWiener_fd_279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_280> AgradDistributionWiener_fd_280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_281> AgradDistributionWiener_fd_281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_282> AgradDistributionWiener_fd_282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_283> AgradDistributionWiener_fd_283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_284> AgradDistributionWiener_fd_284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_285> AgradDistributionWiener_fd_285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_286> AgradDistributionWiener_fd_286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_287> AgradDistributionWiener_fd_287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_288> AgradDistributionWiener_fd_288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_289> AgradDistributionWiener_fd_289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_290> AgradDistributionWiener_fd_290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_291> AgradDistributionWiener_fd_291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_292> AgradDistributionWiener_fd_292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_293> AgradDistributionWiener_fd_293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_294> AgradDistributionWiener_fd_294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_295> AgradDistributionWiener_fd_295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_296> AgradDistributionWiener_fd_296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_297> AgradDistributionWiener_fd_297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_298> AgradDistributionWiener_fd_298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_299> AgradDistributionWiener_fd_299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_200, AgradDistributionTestFixture, AgradDistributionWiener_fd_200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_201, AgradDistributionTestFixture, AgradDistributionWiener_fd_201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_202, AgradDistributionTestFixture, AgradDistributionWiener_fd_202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_203, AgradDistributionTestFixture, AgradDistributionWiener_fd_203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_204, AgradDistributionTestFixture, AgradDistributionWiener_fd_204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_205, AgradDistributionTestFixture, AgradDistributionWiener_fd_205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_206, AgradDistributionTestFixture, AgradDistributionWiener_fd_206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_207, AgradDistributionTestFixture, AgradDistributionWiener_fd_207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_208, AgradDistributionTestFixture, AgradDistributionWiener_fd_208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_209, AgradDistributionTestFixture, AgradDistributionWiener_fd_209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_210, AgradDistributionTestFixture, AgradDistributionWiener_fd_210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_211, AgradDistributionTestFixture, AgradDistributionWiener_fd_211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_212, AgradDistributionTestFixture, AgradDistributionWiener_fd_212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_213, AgradDistributionTestFixture, AgradDistributionWiener_fd_213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_214, AgradDistributionTestFixture, AgradDistributionWiener_fd_214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_215, AgradDistributionTestFixture, AgradDistributionWiener_fd_215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_216, AgradDistributionTestFixture, AgradDistributionWiener_fd_216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_217, AgradDistributionTestFixture, AgradDistributionWiener_fd_217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_218, AgradDistributionTestFixture, AgradDistributionWiener_fd_218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_219, AgradDistributionTestFixture, AgradDistributionWiener_fd_219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_220, AgradDistributionTestFixture, AgradDistributionWiener_fd_220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_221, AgradDistributionTestFixture, AgradDistributionWiener_fd_221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_222, AgradDistributionTestFixture, AgradDistributionWiener_fd_222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_223, AgradDistributionTestFixture, AgradDistributionWiener_fd_223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_224, AgradDistributionTestFixture, AgradDistributionWiener_fd_224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_225, AgradDistributionTestFixture, AgradDistributionWiener_fd_225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_226, AgradDistributionTestFixture, AgradDistributionWiener_fd_226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_227, AgradDistributionTestFixture, AgradDistributionWiener_fd_227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_228, AgradDistributionTestFixture, AgradDistributionWiener_fd_228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_229, AgradDistributionTestFixture, AgradDistributionWiener_fd_229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_230, AgradDistributionTestFixture, AgradDistributionWiener_fd_230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_231, AgradDistributionTestFixture, AgradDistributionWiener_fd_231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_232, AgradDistributionTestFixture, AgradDistributionWiener_fd_232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_233, AgradDistributionTestFixture, AgradDistributionWiener_fd_233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_234, AgradDistributionTestFixture, AgradDistributionWiener_fd_234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_235, AgradDistributionTestFixture, AgradDistributionWiener_fd_235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_236, AgradDistributionTestFixture, AgradDistributionWiener_fd_236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_237, AgradDistributionTestFixture, AgradDistributionWiener_fd_237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_238, AgradDistributionTestFixture, AgradDistributionWiener_fd_238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_239, AgradDistributionTestFixture, AgradDistributionWiener_fd_239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_240, AgradDistributionTestFixture, AgradDistributionWiener_fd_240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_241, AgradDistributionTestFixture, AgradDistributionWiener_fd_241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_242, AgradDistributionTestFixture, AgradDistributionWiener_fd_242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_243, AgradDistributionTestFixture, AgradDistributionWiener_fd_243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_244, AgradDistributionTestFixture, AgradDistributionWiener_fd_244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_245, AgradDistributionTestFixture, AgradDistributionWiener_fd_245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_246, AgradDistributionTestFixture, AgradDistributionWiener_fd_246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_247, AgradDistributionTestFixture, AgradDistributionWiener_fd_247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_248, AgradDistributionTestFixture, AgradDistributionWiener_fd_248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_249, AgradDistributionTestFixture, AgradDistributionWiener_fd_249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_250, AgradDistributionTestFixture, AgradDistributionWiener_fd_250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_251, AgradDistributionTestFixture, AgradDistributionWiener_fd_251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_252, AgradDistributionTestFixture, AgradDistributionWiener_fd_252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_253, AgradDistributionTestFixture, AgradDistributionWiener_fd_253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_254, AgradDistributionTestFixture, AgradDistributionWiener_fd_254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_255, AgradDistributionTestFixture, AgradDistributionWiener_fd_255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_256, AgradDistributionTestFixture, AgradDistributionWiener_fd_256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_257, AgradDistributionTestFixture, AgradDistributionWiener_fd_257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_258, AgradDistributionTestFixture, AgradDistributionWiener_fd_258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_259, AgradDistributionTestFixture, AgradDistributionWiener_fd_259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_260, AgradDistributionTestFixture, AgradDistributionWiener_fd_260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_261, AgradDistributionTestFixture, AgradDistributionWiener_fd_261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_262, AgradDistributionTestFixture, AgradDistributionWiener_fd_262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_263, AgradDistributionTestFixture, AgradDistributionWiener_fd_263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_264, AgradDistributionTestFixture, AgradDistributionWiener_fd_264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_265, AgradDistributionTestFixture, AgradDistributionWiener_fd_265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_266, AgradDistributionTestFixture, AgradDistributionWiener_fd_266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_267, AgradDistributionTestFixture, AgradDistributionWiener_fd_267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_268, AgradDistributionTestFixture, AgradDistributionWiener_fd_268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_269, AgradDistributionTestFixture, AgradDistributionWiener_fd_269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_270, AgradDistributionTestFixture, AgradDistributionWiener_fd_270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_271, AgradDistributionTestFixture, AgradDistributionWiener_fd_271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_272, AgradDistributionTestFixture, AgradDistributionWiener_fd_272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_273, AgradDistributionTestFixture, AgradDistributionWiener_fd_273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_274, AgradDistributionTestFixture, AgradDistributionWiener_fd_274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_275, AgradDistributionTestFixture, AgradDistributionWiener_fd_275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_276, AgradDistributionTestFixture, AgradDistributionWiener_fd_276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_277, AgradDistributionTestFixture, AgradDistributionWiener_fd_277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_278, AgradDistributionTestFixture, AgradDistributionWiener_fd_278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_279, AgradDistributionTestFixture, AgradDistributionWiener_fd_279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_280, AgradDistributionTestFixture, AgradDistributionWiener_fd_280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_281, AgradDistributionTestFixture, AgradDistributionWiener_fd_281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_282, AgradDistributionTestFixture, AgradDistributionWiener_fd_282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_283, AgradDistributionTestFixture, AgradDistributionWiener_fd_283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_284, AgradDistributionTestFixture, AgradDistributionWiener_fd_284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_285, AgradDistributionTestFixture, AgradDistributionWiener_fd_285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_286, AgradDistributionTestFixture, AgradDistributionWiener_fd_286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_287, AgradDistributionTestFixture, AgradDistributionWiener_fd_287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_288, AgradDistributionTestFixture, AgradDistributionWiener_fd_288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_289, AgradDistributionTestFixture, AgradDistributionWiener_fd_289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_290, AgradDistributionTestFixture, AgradDistributionWiener_fd_290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_291, AgradDistributionTestFixture, AgradDistributionWiener_fd_291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_292, AgradDistributionTestFixture, AgradDistributionWiener_fd_292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_293, AgradDistributionTestFixture, AgradDistributionWiener_fd_293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_294, AgradDistributionTestFixture, AgradDistributionWiener_fd_294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_295, AgradDistributionTestFixture, AgradDistributionWiener_fd_295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_296, AgradDistributionTestFixture, AgradDistributionWiener_fd_296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_297, AgradDistributionTestFixture, AgradDistributionWiener_fd_297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_298, AgradDistributionTestFixture, AgradDistributionWiener_fd_298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_299, AgradDistributionTestFixture, AgradDistributionWiener_fd_299);
+
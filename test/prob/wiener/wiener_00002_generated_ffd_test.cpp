@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_200;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_201;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_202;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_203;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_204;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_205;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_206;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_207;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_208;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_209;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_210;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_211;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_212;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_213;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_214;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_215;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_216;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_217;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_218;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_219;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_220;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_221;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_222;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_223;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_224;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_225;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_226;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_227;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_228;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_229;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_230;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_231;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_232;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_233;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_234;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_235;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_236;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_237;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_238;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_239;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_240;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_241;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_242;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_243;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_244;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_245;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_246;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_247;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_248;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_249;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_250;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_251;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_252;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_253;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_254;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_255;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_256;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_257;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_258;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_259;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_260;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_261;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_262;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_263;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_264;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_265;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_266;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_267;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_268;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_269;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, double, double, empty> type_ffd_270;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_271;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_272;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_273;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_274;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_275;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_276;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_277;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_278;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_279;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_280;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_281;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_282;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_283;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_284;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_285;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_286;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_287;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_288;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_289;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_290;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_291;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_292;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_293;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_294;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_295;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_296;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_297;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_298;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_200> AgradDistributionWiener_ffd_200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_201> AgradDistributionWiener_ffd_201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_202> AgradDistributionWiener_ffd_202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_203> AgradDistributionWiener_ffd_203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_204> AgradDistributionWiener_ffd_204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_205> AgradDistributionWiener_ffd_205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_206> AgradDistributionWiener_ffd_206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_207> AgradDistributionWiener_ffd_207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_208> AgradDistributionWiener_ffd_208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_209> AgradDistributionWiener_ffd_209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_210> AgradDistributionWiener_ffd_210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_211> AgradDistributionWiener_ffd_211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_212> AgradDistributionWiener_ffd_212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_213> AgradDistributionWiener_ffd_213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_214> AgradDistributionWiener_ffd_214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_215> AgradDistributionWiener_ffd_215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_216> AgradDistributionWiener_ffd_216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_217> AgradDistributionWiener_ffd_217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_218> AgradDistributionWiener_ffd_218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_219> AgradDistributionWiener_ffd_219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_220> AgradDistributionWiener_ffd_220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_221> AgradDistributionWiener_ffd_221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_222> AgradDistributionWiener_ffd_222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_223> AgradDistributionWiener_ffd_223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_224> AgradDistributionWiener_ffd_224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_225> AgradDistributionWiener_ffd_225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_226> AgradDistributionWiener_ffd_226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_227> AgradDistributionWiener_ffd_227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_228> AgradDistributionWiener_ffd_228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_229> AgradDistributionWiener_ffd_229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_230> AgradDistributionWiener_ffd_230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_231> AgradDistributionWiener_ffd_231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_232> AgradDistributionWiener_ffd_232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_233> AgradDistributionWiener_ffd_233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_234> AgradDistributionWiener_ffd_234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_235> AgradDistributionWiener_ffd_235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_236> AgradDistributionWiener_ffd_236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_237> AgradDistributionWiener_ffd_237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_238> AgradDistributionWiener_ffd_238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_239> AgradDistributionWiener_ffd_239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_240> AgradDistributionWiener_ffd_240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_241> AgradDistributionWiener_ffd_241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_242> AgradDistributionWiener_ffd_242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_243> AgradDistributionWiener_ffd_243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_244> AgradDistributionWiener_ffd_244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_245> AgradDistributionWiener_ffd_245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_246> AgradDistributionWiener_ffd_246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_247> AgradDistributionWiener_ffd_247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_248> AgradDistributionWiener_ffd_248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_249> AgradDistributionWiener_ffd_249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_250> AgradDistributionWiener_ffd_250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_251> AgradDistributionWiener_ffd_251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_252> AgradDistributionWiener_ffd_252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_253> AgradDistributionWiener_ffd_253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_254> AgradDistributionWiener_ffd_254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_255> AgradDistributionWiener_ffd_255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_256> AgradDistributionWiener_ffd_256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_257> AgradDistributionWiener_ffd_257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_258> AgradDistributionWiener_ffd_258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_259> AgradDistributionWiener_ffd_259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_260> AgradDistributionWiener_ffd_260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_261> AgradDistributionWiener_ffd_261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_262> AgradDistributionWiener_ffd_262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_263> AgradDistributionWiener_ffd_263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_264> AgradDistributionWiener_ffd_264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_265> AgradDistributionWiener_ffd_265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_266> AgradDistributionWiener_ffd_266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_267> AgradDistributionWiener_ffd_267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_268> AgradDistributionWiener_ffd_268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_269> AgradDistributionWiener_ffd_269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_270> AgradDistributionWiener_ffd_270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_271> AgradDistributionWiener_ffd_271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_272> AgradDistributionWiener_ffd_272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_273> AgradDistributionWiener_ffd_273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_274> AgradDistributionWiener_ffd_274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_275> AgradDistributionWiener_ffd_275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_276> AgradDistributionWiener_ffd_276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_277> AgradDistributionWiener_ffd_277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_278> AgradDistributionWiener_ffd_278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_279> AgradDistributionWiener_ffd_279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_280> AgradDistributionWiener_ffd_280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_281> AgradDistributionWiener_ffd_281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_282> AgradDistributionWiener_ffd_282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_283> AgradDistributionWiener_ffd_283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_284> AgradDistributionWiener_ffd_284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_285> AgradDistributionWiener_ffd_285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_286> AgradDistributionWiener_ffd_286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_287> AgradDistributionWiener_ffd_287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_288> AgradDistributionWiener_ffd_288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_289> AgradDistributionWiener_ffd_289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_290> AgradDistributionWiener_ffd_290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_291> AgradDistributionWiener_ffd_291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_292> AgradDistributionWiener_ffd_292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_293> AgradDistributionWiener_ffd_293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_294> AgradDistributionWiener_ffd_294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_295> AgradDistributionWiener_ffd_295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_296> AgradDistributionWiener_ffd_296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_297> AgradDistributionWiener_ffd_297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_298> AgradDistributionWiener_ffd_298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_299> AgradDistributionWiener_ffd_299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_200, AgradDistributionTestFixture, AgradDistributionWiener_ffd_200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_201, AgradDistributionTestFixture, AgradDistributionWiener_ffd_201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_202, AgradDistributionTestFixture, AgradDistributionWiener_ffd_202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_203, AgradDistributionTestFixture, AgradDistributionWiener_ffd_203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_204, AgradDistributionTestFixture, AgradDistributionWiener_ffd_204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_205, AgradDistributionTestFixture, AgradDistributionWiener_ffd_205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_206, AgradDistributionTestFixture, AgradDistributionWiener_ffd_206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_207, AgradDistributionTestFixture, AgradDistributionWiener_ffd_207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_208, AgradDistributionTestFixture, AgradDistributionWiener_ffd_208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_209, AgradDistributionTestFixture, AgradDistributionWiener_ffd_209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_210, AgradDistributionTestFixture, AgradDistributionWiener_ffd_210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_211, AgradDistributionTestFixture, AgradDistributionWiener_ffd_211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_212, AgradDistributionTestFixture, AgradDistributionWiener_ffd_212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_213, AgradDistributionTestFixture, AgradDistributionWiener_ffd_213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_214, AgradDistributionTestFixture, AgradDistributionWiener_ffd_214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_215, AgradDistributionTestFixture, AgradDistributionWiener_ffd_215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_216, AgradDistributionTestFixture, AgradDistributionWiener_ffd_216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_217, AgradDistributionTestFixture, AgradDistributionWiener_ffd_217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_218, AgradDistributionTestFixture, AgradDistributionWiener_ffd_218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_219, AgradDistributionTestFixture, AgradDistributionWiener_ffd_219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_220, AgradDistributionTestFixture, AgradDistributionWiener_ffd_220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_221, AgradDistributionTestFixture, AgradDistributionWiener_ffd_221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_222, AgradDistributionTestFixture, AgradDistributionWiener_ffd_222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_223, AgradDistributionTestFixture, AgradDistributionWiener_ffd_223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_224, AgradDistributionTestFixture, AgradDistributionWiener_ffd_224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_225, AgradDistributionTestFixture, AgradDistributionWiener_ffd_225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_226, AgradDistributionTestFixture, AgradDistributionWiener_ffd_226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_227, AgradDistributionTestFixture, AgradDistributionWiener_ffd_227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_228, AgradDistributionTestFixture, AgradDistributionWiener_ffd_228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_229, AgradDistributionTestFixture, AgradDistributionWiener_ffd_229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_230, AgradDistributionTestFixture, AgradDistributionWiener_ffd_230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_231, AgradDistributionTestFixture, AgradDistributionWiener_ffd_231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_232, AgradDistributionTestFixture, AgradDistributionWiener_ffd_232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_233, AgradDistributionTestFixture, AgradDistributionWiener_ffd_233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_234, AgradDistributionTestFixture, AgradDistributionWiener_ffd_234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_235, AgradDistributionTestFixture, AgradDistributionWiener_ffd_235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_236, AgradDistributionTestFixture, AgradDistributionWiener_ffd_236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_237, AgradDistributionTestFixture, AgradDistributionWiener_ffd_237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_238, AgradDistributionTestFixture, AgradDistributionWiener_ffd_238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_239, AgradDistributionTestFixture, AgradDistributionWiener_ffd_239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_240, AgradDistributionTestFixture, AgradDistributionWiener_ffd_240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_241, AgradDistributionTestFixture, AgradDistributionWiener_ffd_241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_242, AgradDistributionTestFixture, AgradDistributionWiener_ffd_242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_243, AgradDistributionTestFixture, AgradDistributionWiener_ffd_243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_244, AgradDistributionTestFixture, AgradDistributionWiener_ffd_244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_245, AgradDistributionTestFixture, AgradDistributionWiener_ffd_245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_246, AgradDistributionTestFixture, AgradDistributionWiener_ffd_246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_247, AgradDistributionTestFixture, AgradDistributionWiener_ffd_247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_248, AgradDistributionTestFixture, AgradDistributionWiener_ffd_248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_249, AgradDistributionTestFixture, AgradDistributionWiener_ffd_249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_250, AgradDistributionTestFixture, AgradDistributionWiener_ffd_250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_251, AgradDistributionTestFixture, AgradDistributionWiener_ffd_251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_252, AgradDistributionTestFixture, AgradDistributionWiener_ffd_252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_253, AgradDistributionTestFixture, AgradDistributionWiener_ffd_253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_254, AgradDistributionTestFixture, AgradDistributionWiener_ffd_254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_255, AgradDistributionTestFixture, AgradDistributionWiener_ffd_255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_256, AgradDistributionTestFixture, AgradDistributionWiener_ffd_256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_257, AgradDistributionTestFixture, AgradDistributionWiener_ffd_257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_258, AgradDistributionTestFixture, AgradDistributionWiener_ffd_258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_259, AgradDistributionTestFixture, AgradDistributionWiener_ffd_259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_260, AgradDistributionTestFixture, AgradDistributionWiener_ffd_260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_261, AgradDistributionTestFixture, AgradDistributionWiener_ffd_261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_262, AgradDistributionTestFixture, AgradDistributionWiener_ffd_262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_263, AgradDistributionTestFixture, AgradDistributionWiener_ffd_263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_264, AgradDistributionTestFixture, AgradDistributionWiener_ffd_264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_265, AgradDistributionTestFixture, AgradDistributionWiener_ffd_265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_266, AgradDistributionTestFixture, AgradDistributionWiener_ffd_266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_267, AgradDistributionTestFixture, AgradDistributionWiener_ffd_267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_268, AgradDistributionTestFixture, AgradDistributionWiener_ffd_268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_269, AgradDistributionTestFixture, AgradDistributionWiener_ffd_269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_270, AgradDistributionTestFixture, AgradDistributionWiener_ffd_270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_271, AgradDistributionTestFixture, AgradDistributionWiener_ffd_271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_272, AgradDistributionTestFixture, AgradDistributionWiener_ffd_272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_273, AgradDistributionTestFixture, AgradDistributionWiener_ffd_273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_274, AgradDistributionTestFixture, AgradDistributionWiener_ffd_274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_275, AgradDistributionTestFixture, AgradDistributionWiener_ffd_275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_276, AgradDistributionTestFixture, AgradDistributionWiener_ffd_276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_277, AgradDistributionTestFixture, AgradDistributionWiener_ffd_277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_278, AgradDistributionTestFixture, AgradDistributionWiener_ffd_278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_279, AgradDistributionTestFixture, AgradDistributionWiener_ffd_279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_280, AgradDistributionTestFixture, AgradDistributionWiener_ffd_280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_281, AgradDistributionTestFixture, AgradDistributionWiener_ffd_281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_282, AgradDistributionTestFixture, AgradDistributionWiener_ffd_282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_283, AgradDistributionTestFixture, AgradDistributionWiener_ffd_283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_284, AgradDistributionTestFixture, AgradDistributionWiener_ffd_284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_285, AgradDistributionTestFixture, AgradDistributionWiener_ffd_285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_286, AgradDistributionTestFixture, AgradDistributionWiener_ffd_286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_287, AgradDistributionTestFixture, AgradDistributionWiener_ffd_287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_288, AgradDistributionTestFixture, AgradDistributionWiener_ffd_288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_289, AgradDistributionTestFixture, AgradDistributionWiener_ffd_289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_290, AgradDistributionTestFixture, AgradDistributionWiener_ffd_290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_291, AgradDistributionTestFixture, AgradDistributionWiener_ffd_291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_292, AgradDistributionTestFixture, AgradDistributionWiener_ffd_292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_293, AgradDistributionTestFixture, AgradDistributionWiener_ffd_293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_294, AgradDistributionTestFixture, AgradDistributionWiener_ffd_294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_295, AgradDistributionTestFixture, AgradDistributionWiener_ffd_295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_296, AgradDistributionTestFixture, AgradDistributionWiener_ffd_296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_297, AgradDistributionTestFixture, AgradDistributionWiener_ffd_297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_298, AgradDistributionTestFixture, AgradDistributionWiener_ffd_298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_299, AgradDistributionTestFixture, AgradDistributionWiener_ffd_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_200;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_201;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_202;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_203;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_204;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_205;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_206;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_207;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_208;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_209;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_210;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_211;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_212;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_213;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_214;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_215;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_216;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_217;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_218;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_219;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_220;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_221;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_222;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_223;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_224;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_225;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_226;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_227;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_228;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_229;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_230;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_231;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_232;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_233;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_234;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_235;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_236;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_237;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_238;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_239;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_240;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_241;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_242;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_243;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_244;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_245;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_246;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_247;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_248;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_249;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_250;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_251;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_252;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_253;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_254;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_255;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_256;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_257;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_258;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_259;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_260;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_261;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_262;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_263;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_264;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_265;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_266;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_267;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_268;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_269;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, double, double, empty> type_ffv_270;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_271;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_272;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_273;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_274;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_275;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_276;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_277;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_278;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_279;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_280;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_281;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_282;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_283;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_284;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_285;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_286;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_287;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_288;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_289;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_290;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_291;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_292;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_293;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_294;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_295;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_296;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_297;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_298;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_200> AgradDistributionWiener_ffv_200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_201> AgradDistributionWiener_ffv_201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_202> AgradDistributionWiener_ffv_202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_203> AgradDistributionWiener_ffv_203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_204> AgradDistributionWiener_ffv_204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_205> AgradDistributionWiener_ffv_205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_206> AgradDistributionWiener_ffv_206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_207> AgradDistributionWiener_ffv_207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_208> AgradDistributionWiener_ffv_208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_209> AgradDistributionWiener_ffv_209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_210> AgradDistributionWiener_ffv_210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_211> AgradDistributionWiener_ffv_211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_212> AgradDistributionWiener_ffv_212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_213> AgradDistributionWiener_ffv_213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_214> AgradDistributionWiener_ffv_214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_215> AgradDistributionWiener_ffv_215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_216> AgradDistributionWiener_ffv_216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_217> AgradDistributionWiener_ffv_217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_218> AgradDistributionWiener_ffv_218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_219> AgradDistributionWiener_ffv_219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_220> AgradDistributionWiener_ffv_220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_221> AgradDistributionWiener_ffv_221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_222> AgradDistributionWiener_ffv_222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_223> AgradDistributionWiener_ffv_223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_224> AgradDistributionWiener_ffv_224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_225> AgradDistributionWiener_ffv_225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_226> AgradDistributionWiener_ffv_226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_227> AgradDistributionWiener_ffv_227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_228> AgradDistributionWiener_ffv_228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_229> AgradDistributionWiener_ffv_229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_230> AgradDistributionWiener_ffv_230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_231> AgradDistributionWiener_ffv_231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_232> AgradDistributionWiener_ffv_232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_233> AgradDistributionWiener_ffv_233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_234> AgradDistributionWiener_ffv_234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_235> AgradDistributionWiener_ffv_235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_236> AgradDistributionWiener_ffv_236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_237> AgradDistributionWiener_ffv_237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_238> AgradDistributionWiener_ffv_238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_239> AgradDistributionWiener_ffv_239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_240> AgradDistributionWiener_ffv_240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_241> AgradDistributionWiener_ffv_241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_242> AgradDistributionWiener_ffv_242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_243> AgradDistributionWiener_ffv_243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_244> AgradDistributionWiener_ffv_244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_245> AgradDistributionWiener_ffv_245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_246> AgradDistributionWiener_ffv_246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_247> AgradDistributionWiener_ffv_247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_248> AgradDistributionWiener_ffv_248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_249> AgradDistributionWiener_ffv_249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_250> AgradDistributionWiener_ffv_250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_251> AgradDistributionWiener_ffv_251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_252> AgradDistributionWiener_ffv_252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_253> AgradDistributionWiener_ffv_253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_254> AgradDistributionWiener_ffv_254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_255> AgradDistributionWiener_ffv_255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_256> AgradDistributionWiener_ffv_256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_257> AgradDistributionWiener_ffv_257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_258> AgradDistributionWiener_ffv_258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_259> AgradDistributionWiener_ffv_259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_260> AgradDistributionWiener_ffv_260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_261> AgradDistributionWiener_ffv_261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_262> AgradDistributionWiener_ffv_262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_263> AgradDistributionWiener_ffv_263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_264> AgradDistributionWiener_ffv_264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_265> AgradDistributionWiener_ffv_265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_266> AgradDistributionWiener_ffv_266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_267> AgradDistributionWiener_ffv_267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_268> AgradDistributionWiener_ffv_268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_269> AgradDistributionWiener_ffv_269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_270> AgradDistributionWiener_ffv_270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_271> AgradDistributionWiener_ffv_271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_272> AgradDistributionWiener_ffv_272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_273> AgradDistributionWiener_ffv_273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_274> AgradDistributionWiener_ffv_274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_275> AgradDistributionWiener_ffv_275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_276> AgradDistributionWiener_ffv_276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_277> AgradDistributionWiener_ffv_277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_278> AgradDistributionWiener_ffv_278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_279> AgradDistributionWiener_ffv_279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_280> AgradDistributionWiener_ffv_280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_281> AgradDistributionWiener_ffv_281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_282> AgradDistributionWiener_ffv_282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_283> AgradDistributionWiener_ffv_283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_284> AgradDistributionWiener_ffv_284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_285> AgradDistributionWiener_ffv_285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_286> AgradDistributionWiener_ffv_286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_287> AgradDistributionWiener_ffv_287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_288> AgradDistributionWiener_ffv_288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_289> AgradDistributionWiener_ffv_289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_290> AgradDistributionWiener_ffv_290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_291> AgradDistributionWiener_ffv_291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_292> AgradDistributionWiener_ffv_292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_293> AgradDistributionWiener_ffv_293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_294> AgradDistributionWiener_ffv_294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_295> AgradDistributionWiener_ffv_295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_296> AgradDistributionWiener_ffv_296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_297> AgradDistributionWiener_ffv_297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_298> AgradDistributionWiener_ffv_298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_299> AgradDistributionWiener_ffv_299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_200, AgradDistributionTestFixture, AgradDistributionWiener_ffv_200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_201, AgradDistributionTestFixture, AgradDistributionWiener_ffv_201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_202, AgradDistributionTestFixture, AgradDistributionWiener_ffv_202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_203, AgradDistributionTestFixture, AgradDistributionWiener_ffv_203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_204, AgradDistributionTestFixture, AgradDistributionWiener_ffv_204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_205, AgradDistributionTestFixture, AgradDistributionWiener_ffv_205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_206, AgradDistributionTestFixture, AgradDistributionWiener_ffv_206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_207, AgradDistributionTestFixture, AgradDistributionWiener_ffv_207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_208, AgradDistributionTestFixture, AgradDistributionWiener_ffv_208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_209, AgradDistributionTestFixture, AgradDistributionWiener_ffv_209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_210, AgradDistributionTestFixture, AgradDistributionWiener_ffv_210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_211, AgradDistributionTestFixture, AgradDistributionWiener_ffv_211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_212, AgradDistributionTestFixture, AgradDistributionWiener_ffv_212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_213, AgradDistributionTestFixture, AgradDistributionWiener_ffv_213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_214, AgradDistributionTestFixture, AgradDistributionWiener_ffv_214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_215, AgradDistributionTestFixture, AgradDistributionWiener_ffv_215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_216, AgradDistributionTestFixture, AgradDistributionWiener_ffv_216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_217, AgradDistributionTestFixture, AgradDistributionWiener_ffv_217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_218, AgradDistributionTestFixture, AgradDistributionWiener_ffv_218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_219, AgradDistributionTestFixture, AgradDistributionWiener_ffv_219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_220, AgradDistributionTestFixture, AgradDistributionWiener_ffv_220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_221, AgradDistributionTestFixture, AgradDistributionWiener_ffv_221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_222, AgradDistributionTestFixture, AgradDistributionWiener_ffv_222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_223, AgradDistributionTestFixture, AgradDistributionWiener_ffv_223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_224, AgradDistributionTestFixture, AgradDistributionWiener_ffv_224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_225, AgradDistributionTestFixture, AgradDistributionWiener_ffv_225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_226, AgradDistributionTestFixture, AgradDistributionWiener_ffv_226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_227, AgradDistributionTestFixture, AgradDistributionWiener_ffv_227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_228, AgradDistributionTestFixture, AgradDistributionWiener_ffv_228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_229, AgradDistributionTestFixture, AgradDistributionWiener_ffv_229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_230, AgradDistributionTestFixture, AgradDistributionWiener_ffv_230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_231, AgradDistributionTestFixture, AgradDistributionWiener_ffv_231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_232, AgradDistributionTestFixture, AgradDistributionWiener_ffv_232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_233, AgradDistributionTestFixture, AgradDistributionWiener_ffv_233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_234, AgradDistributionTestFixture, AgradDistributionWiener_ffv_234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_235, AgradDistributionTestFixture, AgradDistributionWiener_ffv_235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_236, AgradDistributionTestFixture, AgradDistributionWiener_ffv_236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_237, AgradDistributionTestFixture, AgradDistributionWiener_ffv_237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_238, AgradDistributionTestFixture, AgradDistributionWiener_ffv_238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_239, AgradDistributionTestFixture, AgradDistributionWiener_ffv_239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_240, AgradDistributionTestFixture, AgradDistributionWiener_ffv_240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_241, AgradDistributionTestFixture, AgradDistributionWiener_ffv_241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_242, AgradDistributionTestFixture, AgradDistributionWiener_ffv_242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_243, AgradDistributionTestFixture, AgradDistributionWiener_ffv_243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_244, AgradDistributionTestFixture, AgradDistributionWiener_ffv_244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_245, AgradDistributionTestFixture, AgradDistributionWiener_ffv_245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_246, AgradDistributionTestFixture, AgradDistributionWiener_ffv_246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_247, AgradDistributionTestFixture, AgradDistributionWiener_ffv_247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_248, AgradDistributionTestFixture, AgradDistributionWiener_ffv_248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_249, AgradDistributionTestFixture, AgradDistributionWiener_ffv_249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_250, AgradDistributionTestFixture, AgradDistributionWiener_ffv_250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_251, AgradDistributionTestFixture, AgradDistributionWiener_ffv_251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_252, AgradDistributionTestFixture, AgradDistributionWiener_ffv_252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_253, AgradDistributionTestFixture, AgradDistributionWiener_ffv_253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_254, AgradDistributionTestFixture, AgradDistributionWiener_ffv_254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_255, AgradDistributionTestFixture, AgradDistributionWiener_ffv_255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_256, AgradDistributionTestFixture, AgradDistributionWiener_ffv_256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_257, AgradDistributionTestFixture, AgradDistributionWiener_ffv_257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_258, AgradDistributionTestFixture, AgradDistributionWiener_ffv_258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_259, AgradDistributionTestFixture, AgradDistributionWiener_ffv_259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_260, AgradDistributionTestFixture, AgradDistributionWiener_ffv_260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_261, AgradDistributionTestFixture, AgradDistributionWiener_ffv_261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_262, AgradDistributionTestFixture, AgradDistributionWiener_ffv_262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_263, AgradDistributionTestFixture, AgradDistributionWiener_ffv_263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_264, AgradDistributionTestFixture, AgradDistributionWiener_ffv_264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_265, AgradDistributionTestFixture, AgradDistributionWiener_ffv_265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_266, AgradDistributionTestFixture, AgradDistributionWiener_ffv_266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_267, AgradDistributionTestFixture, AgradDistributionWiener_ffv_267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_268, AgradDistributionTestFixture, AgradDistributionWiener_ffv_268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_269, AgradDistributionTestFixture, AgradDistributionWiener_ffv_269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_270, AgradDistributionTestFixture, AgradDistributionWiener_ffv_270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_271, AgradDistributionTestFixture, AgradDistributionWiener_ffv_271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_272, AgradDistributionTestFixture, AgradDistributionWiener_ffv_272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_273, AgradDistributionTestFixture, AgradDistributionWiener_ffv_273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_274, AgradDistributionTestFixture, AgradDistributionWiener_ffv_274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_275, AgradDistributionTestFixture, AgradDistributionWiener_ffv_275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_276, AgradDistributionTestFixture, AgradDistributionWiener_ffv_276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_277, AgradDistributionTestFixture, AgradDistributionWiener_ffv_277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_278, AgradDistributionTestFixture, AgradDistributionWiener_ffv_278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_279, AgradDistributionTestFixture, AgradDistributionWiener_ffv_279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_280, AgradDistributionTestFixture, AgradDistributionWiener_ffv_280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_281, AgradDistributionTestFixture, AgradDistributionWiener_ffv_281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_282, AgradDistributionTestFixture, AgradDistributionWiener_ffv_282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_283, AgradDistributionTestFixture, AgradDistributionWiener_ffv_283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_284, AgradDistributionTestFixture, AgradDistributionWiener_ffv_284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_285, AgradDistributionTestFixture, AgradDistributionWiener_ffv_285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_286, AgradDistributionTestFixture, AgradDistributionWiener_ffv_286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_287, AgradDistributionTestFixture, AgradDistributionWiener_ffv_287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_288, AgradDistributionTestFixture, AgradDistributionWiener_ffv_288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_289, AgradDistributionTestFixture, AgradDistributionWiener_ffv_289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_290, AgradDistributionTestFixture, AgradDistributionWiener_ffv_290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_291, AgradDistributionTestFixture, AgradDistributionWiener_ffv_291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_292, AgradDistributionTestFixture, AgradDistributionWiener_ffv_292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_293, AgradDistributionTestFixture, AgradDistributionWiener_ffv_293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_294, AgradDistributionTestFixture, AgradDistributionWiener_ffv_294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_295, AgradDistributionTestFixture, AgradDistributionWiener_ffv_295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_296, AgradDistributionTestFixture, AgradDistributionWiener_ffv_296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_297, AgradDistributionTestFixture, AgradDistributionWiener_ffv_297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_298, AgradDistributionTestFixture, AgradDistributionWiener_ffv_298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_299, AgradDistributionTestFixture, AgradDistributionWiener_ffv_299);
+
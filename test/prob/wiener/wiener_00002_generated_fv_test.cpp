@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_200;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<var>, fvar<var>, empty> type_fv_201;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_202;
+typedef boost::mpl::vector<double, std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_203;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<var>>, double, empty> type_fv_204;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_205;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_206;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_207;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_208;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_209;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_210;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_211;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_212;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_213;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_214;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_215;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, fvar<var>, empty> type_fv_216;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_217;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_218;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_219;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_220;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_221;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_222;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_223;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_224;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<var>, double, empty> type_fv_225;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_226;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_227;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_228;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_229;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_230;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_231;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_232;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_233;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_234;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_235;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_236;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_237;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_238;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_239;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_240;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_241;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_242;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_243;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_244;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_245;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_246;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_247;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_248;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_249;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_250;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_251;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_252;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_253;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_254;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_255;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_256;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_257;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_258;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_259;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_260;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_261;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_262;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_263;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_264;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_265;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_266;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_267;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_268;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_269;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, double, double, empty> type_fv_270;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, double, std::vector<double>, empty> type_fv_271;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_272;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, double, fvar<var>, empty> type_fv_273;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_274;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_275;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<double>, double, empty> type_fv_276;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_277;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_278;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_279;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_280;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_281;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_282;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_283;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_284;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_285;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_286;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_287;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, fvar<var>, double, empty> type_fv_288;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_289;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_290;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_291;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_292;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_293;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_294;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_295;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_296;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_297;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_298;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_200> AgradDistributionWiener_fv_200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_201> AgradDistributionWiener_fv_201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_202> AgradDistributionWiener_fv_202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_203> AgradDistributionWiener_fv_203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_204> AgradDistributionWiener_fv_204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_205> AgradDistributionWiener_fv_205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_206> AgradDistributionWiener_fv_206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_207> AgradDistributionWiener_fv_207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_208> AgradDistributionWiener_fv_208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_209> AgradDistributionWiener_fv_209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_210> AgradDistributionWiener_fv_210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_211> AgradDistributionWiener_fv_211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_212> AgradDistributionWiener_fv_212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_213> AgradDistributionWiener_fv_213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_214> AgradDistributionWiener_fv_214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_215> AgradDistributionWiener_fv_215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_216> AgradDistributionWiener_fv_216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_217> AgradDistributionWiener_fv_217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_218> AgradDistributionWiener_fv_218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_219> AgradDistributionWiener_fv_219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_220> AgradDistributionWiener_fv_220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_221> AgradDistributionWiener_fv_221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_222> AgradDistributionWiener_fv_222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_223> AgradDistributionWiener_fv_223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_224> AgradDistributionWiener_fv_224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_225> AgradDistributionWiener_fv_225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_226> AgradDistributionWiener_fv_226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_227> AgradDistributionWiener_fv_227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_228> AgradDistributionWiener_fv_228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_229> AgradDistributionWiener_fv_229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_230> AgradDistributionWiener_fv_230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_231> AgradDistributionWiener_fv_231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_232> AgradDistributionWiener_fv_232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_233> AgradDistributionWiener_fv_233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_234> AgradDistributionWiener_fv_234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_235> AgradDistributionWiener_fv_235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_236> AgradDistributionWiener_fv_236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_237> AgradDistributionWiener_fv_237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_238> AgradDistributionWiener_fv_238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_239> AgradDistributionWiener_fv_239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_240> AgradDistributionWiener_fv_240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_241> AgradDistributionWiener_fv_241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_242> AgradDistributionWiener_fv_242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_243> AgradDistributionWiener_fv_243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_244> AgradDistributionWiener_fv_244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_245> AgradDistributionWiener_fv_245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_246> AgradDistributionWiener_fv_246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_247> AgradDistributionWiener_fv_247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_248> AgradDistributionWiener_fv_248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_249> AgradDistributionWiener_fv_249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_250> AgradDistributionWiener_fv_250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_251> AgradDistributionWiener_fv_251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_252> AgradDistributionWiener_fv_252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_253> AgradDistributionWiener_fv_253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_254> AgradDistributionWiener_fv_254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_255> AgradDistributionWiener_fv_255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_256> AgradDistributionWiener_fv_256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_257> AgradDistributionWiener_fv_257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_258> AgradDistributionWiener_fv_258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_259> AgradDistributionWiener_fv_259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_260> AgradDistributionWiener_fv_260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_261> AgradDistributionWiener_fv_261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_262> AgradDistributionWiener_fv_262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_263> AgradDistributionWiener_fv_263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_264> AgradDistributionWiener_fv_264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_265> AgradDistributionWiener_fv_265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_266> AgradDistributionWiener_fv_266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_267> AgradDistributionWiener_fv_267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_268> AgradDistributionWiener_fv_268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_269> AgradDistributionWiener_fv_269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_270> AgradDistributionWiener_fv_270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_271> AgradDistributionWiener_fv_271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_272> AgradDistributionWiener_fv_272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_273> AgradDistributionWiener_fv_273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_274> AgradDistributionWiener_fv_274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_275> AgradDistributionWiener_fv_275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_276> AgradDistributionWiener_fv_276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_277> AgradDistributionWiener_fv_277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_278> AgradDistributionWiener_fv_278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_279> AgradDistributionWiener_fv_279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_280> AgradDistributionWiener_fv_280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_281> AgradDistributionWiener_fv_281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_282> AgradDistributionWiener_fv_282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_283> AgradDistributionWiener_fv_283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_284> AgradDistributionWiener_fv_284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_285> AgradDistributionWiener_fv_285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_286> AgradDistributionWiener_fv_286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_287> AgradDistributionWiener_fv_287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_288> AgradDistributionWiener_fv_288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_289> AgradDistributionWiener_fv_289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_290> AgradDistributionWiener_fv_290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_291> AgradDistributionWiener_fv_291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_292> AgradDistributionWiener_fv_292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_293> AgradDistributionWiener_fv_293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_294> AgradDistributionWiener_fv_294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_295> AgradDistributionWiener_fv_295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_296> AgradDistributionWiener_fv_296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_297> AgradDistributionWiener_fv_297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_298> AgradDistributionWiener_fv_298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_299> AgradDistributionWiener_fv_299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_200, AgradDistributionTestFixture, AgradDistributionWiener_fv_200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_201, AgradDistributionTestFixture, AgradDistributionWiener_fv_201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_202, AgradDistributionTestFixture, AgradDistributionWiener_fv_202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_203, AgradDistributionTestFixture, AgradDistributionWiener_fv_203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_204, AgradDistributionTestFixture, AgradDistributionWiener_fv_204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_205, AgradDistributionTestFixture, AgradDistributionWiener_fv_205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_206, AgradDistributionTestFixture, AgradDistributionWiener_fv_206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_207, AgradDistributionTestFixture, AgradDistributionWiener_fv_207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_208, AgradDistributionTestFixture, AgradDistributionWiener_fv_208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_209, AgradDistributionTestFixture, AgradDistributionWiener_fv_209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_210, AgradDistributionTestFixture, AgradDistributionWiener_fv_210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_211, AgradDistributionTestFixture, AgradDistributionWiener_fv_211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_212, AgradDistributionTestFixture, AgradDistributionWiener_fv_212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_213, AgradDistributionTestFixture, AgradDistributionWiener_fv_213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_214, AgradDistributionTestFixture, AgradDistributionWiener_fv_214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_215, AgradDistributionTestFixture, AgradDistributionWiener_fv_215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_216, AgradDistributionTestFixture, AgradDistributionWiener_fv_216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_217, AgradDistributionTestFixture, AgradDistributionWiener_fv_217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_218, AgradDistributionTestFixture, AgradDistributionWiener_fv_218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_219, AgradDistributionTestFixture, AgradDistributionWiener_fv_219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_220, AgradDistributionTestFixture, AgradDistributionWiener_fv_220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_221, AgradDistributionTestFixture, AgradDistributionWiener_fv_221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_222, AgradDistributionTestFixture, AgradDistributionWiener_fv_222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_223, AgradDistributionTestFixture, AgradDistributionWiener_fv_223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_224, AgradDistributionTestFixture, AgradDistributionWiener_fv_224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_225, AgradDistributionTestFixture, AgradDistributionWiener_fv_225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_226, AgradDistributionTestFixture, AgradDistributionWiener_fv_226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_227, AgradDistributionTestFixture, AgradDistributionWiener_fv_227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_228, AgradDistributionTestFixture, AgradDistributionWiener_fv_228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_229, AgradDistributionTestFixture, AgradDistributionWiener_fv_229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_230, AgradDistributionTestFixture, AgradDistributionWiener_fv_230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_231, AgradDistributionTestFixture, AgradDistributionWiener_fv_231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_232, AgradDistributionTestFixture, AgradDistributionWiener_fv_232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_233, AgradDistributionTestFixture, AgradDistributionWiener_fv_233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_234, AgradDistributionTestFixture, AgradDistributionWiener_fv_234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_235, AgradDistributionTestFixture, AgradDistributionWiener_fv_235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_236, AgradDistributionTestFixture, AgradDistributionWiener_fv_236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_237, AgradDistributionTestFixture, AgradDistributionWiener_fv_237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_238, AgradDistributionTestFixture, AgradDistributionWiener_fv_238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_239, AgradDistributionTestFixture, AgradDistributionWiener_fv_239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_240, AgradDistributionTestFixture, AgradDistributionWiener_fv_240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_241, AgradDistributionTestFixture, AgradDistributionWiener_fv_241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_242, AgradDistributionTestFixture, AgradDistributionWiener_fv_242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_243, AgradDistributionTestFixture, AgradDistributionWiener_fv_243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_244, AgradDistributionTestFixture, AgradDistributionWiener_fv_244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_245, AgradDistributionTestFixture, AgradDistributionWiener_fv_245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_246, AgradDistributionTestFixture, AgradDistributionWiener_fv_246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_247, AgradDistributionTestFixture, AgradDistributionWiener_fv_247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_248, AgradDistributionTestFixture, AgradDistributionWiener_fv_248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_249, AgradDistributionTestFixture, AgradDistributionWiener_fv_249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_250, AgradDistributionTestFixture, AgradDistributionWiener_fv_250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_251, AgradDistributionTestFixture, AgradDistributionWiener_fv_251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_252, AgradDistributionTestFixture, AgradDistributionWiener_fv_252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_253, AgradDistributionTestFixture, AgradDistributionWiener_fv_253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_254, AgradDistributionTestFixture, AgradDistributionWiener_fv_254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_255, AgradDistributionTestFixture, AgradDistributionWiener_fv_255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_256, AgradDistributionTestFixture, AgradDistributionWiener_fv_256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_257, AgradDistributionTestFixture, AgradDistributionWiener_fv_257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_258, AgradDistributionTestFixture, AgradDistributionWiener_fv_258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_259, AgradDistributionTestFixture, AgradDistributionWiener_fv_259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_260, AgradDistributionTestFixture, AgradDistributionWiener_fv_260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_261, AgradDistributionTestFixture, AgradDistributionWiener_fv_261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_262, AgradDistributionTestFixture, AgradDistributionWiener_fv_262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_263, AgradDistributionTestFixture, AgradDistributionWiener_fv_263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_264, AgradDistributionTestFixture, AgradDistributionWiener_fv_264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_265, AgradDistributionTestFixture, AgradDistributionWiener_fv_265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_266, AgradDistributionTestFixture, AgradDistributionWiener_fv_266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_267, AgradDistributionTestFixture, AgradDistributionWiener_fv_267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_268, AgradDistributionTestFixture, AgradDistributionWiener_fv_268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_269, AgradDistributionTestFixture, AgradDistributionWiener_fv_269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_270, AgradDistributionTestFixture, AgradDistributionWiener_fv_270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_271, AgradDistributionTestFixture, AgradDistributionWiener_fv_271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_272, AgradDistributionTestFixture, AgradDistributionWiener_fv_272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_273, AgradDistributionTestFixture, AgradDistributionWiener_fv_273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_274, AgradDistributionTestFixture, AgradDistributionWiener_fv_274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_275, AgradDistributionTestFixture, AgradDistributionWiener_fv_275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_276, AgradDistributionTestFixture, AgradDistributionWiener_fv_276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_277, AgradDistributionTestFixture, AgradDistributionWiener_fv_277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_278, AgradDistributionTestFixture, AgradDistributionWiener_fv_278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_279, AgradDistributionTestFixture, AgradDistributionWiener_fv_279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_280, AgradDistributionTestFixture, AgradDistributionWiener_fv_280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_281, AgradDistributionTestFixture, AgradDistributionWiener_fv_281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_282, AgradDistributionTestFixture, AgradDistributionWiener_fv_282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_283, AgradDistributionTestFixture, AgradDistributionWiener_fv_283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_284, AgradDistributionTestFixture, AgradDistributionWiener_fv_284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_285, AgradDistributionTestFixture, AgradDistributionWiener_fv_285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_286, AgradDistributionTestFixture, AgradDistributionWiener_fv_286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_287, AgradDistributionTestFixture, AgradDistributionWiener_fv_287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_288, AgradDistributionTestFixture, AgradDistributionWiener_fv_288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_289, AgradDistributionTestFixture, AgradDistributionWiener_fv_289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_290, AgradDistributionTestFixture, AgradDistributionWiener_fv_290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_291, AgradDistributionTestFixture, AgradDistributionWiener_fv_291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_292, AgradDistributionTestFixture, AgradDistributionWiener_fv_292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_293, AgradDistributionTestFixture, AgradDistributionWiener_fv_293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_294, AgradDistributionTestFixture, AgradDistributionWiener_fv_294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_295, AgradDistributionTestFixture, AgradDistributionWiener_fv_295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_296, AgradDistributionTestFixture, AgradDistributionWiener_fv_296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_297, AgradDistributionTestFixture, AgradDistributionWiener_fv_297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_298, AgradDistributionTestFixture, AgradDistributionWiener_fv_298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_299, AgradDistributionTestFixture, AgradDistributionWiener_fv_299);
+
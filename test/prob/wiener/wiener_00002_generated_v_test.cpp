@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_200;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_201;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_202;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_203;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_204;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_205;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_206;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_207;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_208;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_209;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_210;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_211;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_212;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_213;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_214;
+typedef boost::mpl::vector<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_215;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, double, empty> type_v_216;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, std::vector<double>, empty> type_v_217;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_218;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, var, empty> type_v_219;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, std::vector<var>, empty> type_v_220;
+typedef boost::mpl::vector<double, std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_221;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, double, empty> type_v_222;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, std::vector<double>, empty> type_v_223;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_224;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, var, empty> type_v_225;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, std::vector<var>, empty> type_v_226;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_227;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_228;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_229;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_230;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_231;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_232;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_233;
+typedef boost::mpl::vector<double, std::vector<double>, double, var, double, empty> type_v_234;
+typedef boost::mpl::vector<double, std::vector<double>, double, var, std::vector<double>, empty> type_v_235;
+typedef boost::mpl::vector<double, std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_236;
+typedef boost::mpl::vector<double, std::vector<double>, double, var, var, empty> type_v_237;
+typedef boost::mpl::vector<double, std::vector<double>, double, var, std::vector<var>, empty> type_v_238;
+typedef boost::mpl::vector<double, std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_239;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<var>, double, empty> type_v_240;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<var>, std::vector<double>, empty> type_v_241;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_242;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<var>, var, empty> type_v_243;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<var>, std::vector<var>, empty> type_v_244;
+typedef boost::mpl::vector<double, std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_245;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_246;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_247;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_248;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_249;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_250;
+typedef boost::mpl::vector<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_251;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, double, empty> type_v_252;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, std::vector<double>, empty> type_v_253;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_254;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, var, empty> type_v_255;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, std::vector<var>, empty> type_v_256;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_257;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, double, empty> type_v_258;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_259;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_260;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, var, empty> type_v_261;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_262;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_263;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_264;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_265;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_266;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_267;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_268;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_269;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, var, double, empty> type_v_270;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, var, std::vector<double>, empty> type_v_271;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_272;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, var, var, empty> type_v_273;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, var, std::vector<var>, empty> type_v_274;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_275;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<var>, double, empty> type_v_276;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_277;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_278;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<var>, var, empty> type_v_279;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_280;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_281;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_282;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_283;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_284;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_285;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_286;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_287;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_288;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_289;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_290;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_291;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_292;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_293;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_294;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_295;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_296;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_297;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_298;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_200> AgradDistributionWiener_v_200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_201> AgradDistributionWiener_v_201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_202> AgradDistributionWiener_v_202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_203> AgradDistributionWiener_v_203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_204> AgradDistributionWiener_v_204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_205> AgradDistributionWiener_v_205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_206> AgradDistributionWiener_v_206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_207> AgradDistributionWiener_v_207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_208> AgradDistributionWiener_v_208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_209> AgradDistributionWiener_v_209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_210> AgradDistributionWiener_v_210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_211> AgradDistributionWiener_v_211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_212> AgradDistributionWiener_v_212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_213> AgradDistributionWiener_v_213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_214> AgradDistributionWiener_v_214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_215> AgradDistributionWiener_v_215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_216> AgradDistributionWiener_v_216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_217> AgradDistributionWiener_v_217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_218> AgradDistributionWiener_v_218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_219> AgradDistributionWiener_v_219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_220> AgradDistributionWiener_v_220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_221> AgradDistributionWiener_v_221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_222> AgradDistributionWiener_v_222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_223> AgradDistributionWiener_v_223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_224> AgradDistributionWiener_v_224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_225> AgradDistributionWiener_v_225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_226> AgradDistributionWiener_v_226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_227> AgradDistributionWiener_v_227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_228> AgradDistributionWiener_v_228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_229> AgradDistributionWiener_v_229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_230> AgradDistributionWiener_v_230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_231> AgradDistributionWiener_v_231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_232> AgradDistributionWiener_v_232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_233> AgradDistributionWiener_v_233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_234> AgradDistributionWiener_v_234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_235> AgradDistributionWiener_v_235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_236> AgradDistributionWiener_v_236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_237> AgradDistributionWiener_v_237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_238> AgradDistributionWiener_v_238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_239> AgradDistributionWiener_v_239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_240> AgradDistributionWiener_v_240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_241> AgradDistributionWiener_v_241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_242> AgradDistributionWiener_v_242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_243> AgradDistributionWiener_v_243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_244> AgradDistributionWiener_v_244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_245> AgradDistributionWiener_v_245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_246> AgradDistributionWiener_v_246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_247> AgradDistributionWiener_v_247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_248> AgradDistributionWiener_v_248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_249> AgradDistributionWiener_v_249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_250> AgradDistributionWiener_v_250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_251> AgradDistributionWiener_v_251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_252> AgradDistributionWiener_v_252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_253> AgradDistributionWiener_v_253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_254> AgradDistributionWiener_v_254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_255> AgradDistributionWiener_v_255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_256> AgradDistributionWiener_v_256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_257> AgradDistributionWiener_v_257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_258> AgradDistributionWiener_v_258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_259> AgradDistributionWiener_v_259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_260> AgradDistributionWiener_v_260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_261> AgradDistributionWiener_v_261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_262> AgradDistributionWiener_v_262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_263> AgradDistributionWiener_v_263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_264> AgradDistributionWiener_v_264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_265> AgradDistributionWiener_v_265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_266> AgradDistributionWiener_v_266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_267> AgradDistributionWiener_v_267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_268> AgradDistributionWiener_v_268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_269> AgradDistributionWiener_v_269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_270> AgradDistributionWiener_v_270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_271> AgradDistributionWiener_v_271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_272> AgradDistributionWiener_v_272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_273> AgradDistributionWiener_v_273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_274> AgradDistributionWiener_v_274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_275> AgradDistributionWiener_v_275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_276> AgradDistributionWiener_v_276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_277> AgradDistributionWiener_v_277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_278> AgradDistributionWiener_v_278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_279> AgradDistributionWiener_v_279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_280> AgradDistributionWiener_v_280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_281> AgradDistributionWiener_v_281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_282> AgradDistributionWiener_v_282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_283> AgradDistributionWiener_v_283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_284> AgradDistributionWiener_v_284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_285> AgradDistributionWiener_v_285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_286> AgradDistributionWiener_v_286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_287> AgradDistributionWiener_v_287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_288> AgradDistributionWiener_v_288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_289> AgradDistributionWiener_v_289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_290> AgradDistributionWiener_v_290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_291> AgradDistributionWiener_v_291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_292> AgradDistributionWiener_v_292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_293> AgradDistributionWiener_v_293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_294> AgradDistributionWiener_v_294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_295> AgradDistributionWiener_v_295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_296> AgradDistributionWiener_v_296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_297> AgradDistributionWiener_v_297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_298> AgradDistributionWiener_v_298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_299> AgradDistributionWiener_v_299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_200, AgradDistributionTestFixture, AgradDistributionWiener_v_200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_201, AgradDistributionTestFixture, AgradDistributionWiener_v_201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_202, AgradDistributionTestFixture, AgradDistributionWiener_v_202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_203, AgradDistributionTestFixture, AgradDistributionWiener_v_203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_204, AgradDistributionTestFixture, AgradDistributionWiener_v_204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_205, AgradDistributionTestFixture, AgradDistributionWiener_v_205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_206, AgradDistributionTestFixture, AgradDistributionWiener_v_206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_207, AgradDistributionTestFixture, AgradDistributionWiener_v_207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_208, AgradDistributionTestFixture, AgradDistributionWiener_v_208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_209, AgradDistributionTestFixture, AgradDistributionWiener_v_209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_210, AgradDistributionTestFixture, AgradDistributionWiener_v_210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_211, AgradDistributionTestFixture, AgradDistributionWiener_v_211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_212, AgradDistributionTestFixture, AgradDistributionWiener_v_212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_213, AgradDistributionTestFixture, AgradDistributionWiener_v_213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_214, AgradDistributionTestFixture, AgradDistributionWiener_v_214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_215, AgradDistributionTestFixture, AgradDistributionWiener_v_215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_216, AgradDistributionTestFixture, AgradDistributionWiener_v_216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_217, AgradDistributionTestFixture, AgradDistributionWiener_v_217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_218, AgradDistributionTestFixture, AgradDistributionWiener_v_218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_219, AgradDistributionTestFixture, AgradDistributionWiener_v_219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_220, AgradDistributionTestFixture, AgradDistributionWiener_v_220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_221, AgradDistributionTestFixture, AgradDistributionWiener_v_221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_222, AgradDistributionTestFixture, AgradDistributionWiener_v_222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_223, AgradDistributionTestFixture, AgradDistributionWiener_v_223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_224, AgradDistributionTestFixture, AgradDistributionWiener_v_224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_225, AgradDistributionTestFixture, AgradDistributionWiener_v_225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_226, AgradDistributionTestFixture, AgradDistributionWiener_v_226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_227, AgradDistributionTestFixture, AgradDistributionWiener_v_227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_228, AgradDistributionTestFixture, AgradDistributionWiener_v_228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_229, AgradDistributionTestFixture, AgradDistributionWiener_v_229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_230, AgradDistributionTestFixture, AgradDistributionWiener_v_230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_231, AgradDistributionTestFixture, AgradDistributionWiener_v_231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_232, AgradDistributionTestFixture, AgradDistributionWiener_v_232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_233, AgradDistributionTestFixture, AgradDistributionWiener_v_233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_234, AgradDistributionTestFixture, AgradDistributionWiener_v_234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_235, AgradDistributionTestFixture, AgradDistributionWiener_v_235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_236, AgradDistributionTestFixture, AgradDistributionWiener_v_236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_237, AgradDistributionTestFixture, AgradDistributionWiener_v_237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_238, AgradDistributionTestFixture, AgradDistributionWiener_v_238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_239, AgradDistributionTestFixture, AgradDistributionWiener_v_239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_240, AgradDistributionTestFixture, AgradDistributionWiener_v_240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_241, AgradDistributionTestFixture, AgradDistributionWiener_v_241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_242, AgradDistributionTestFixture, AgradDistributionWiener_v_242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_243, AgradDistributionTestFixture, AgradDistributionWiener_v_243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_244, AgradDistributionTestFixture, AgradDistributionWiener_v_244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_245, AgradDistributionTestFixture, AgradDistributionWiener_v_245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_246, AgradDistributionTestFixture, AgradDistributionWiener_v_246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_247, AgradDistributionTestFixture, AgradDistributionWiener_v_247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_248, AgradDistributionTestFixture, AgradDistributionWiener_v_248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_249, AgradDistributionTestFixture, AgradDistributionWiener_v_249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_250, AgradDistributionTestFixture, AgradDistributionWiener_v_250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_251, AgradDistributionTestFixture, AgradDistributionWiener_v_251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_252, AgradDistributionTestFixture, AgradDistributionWiener_v_252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_253, AgradDistributionTestFixture, AgradDistributionWiener_v_253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_254, AgradDistributionTestFixture, AgradDistributionWiener_v_254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_255, AgradDistributionTestFixture, AgradDistributionWiener_v_255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_256, AgradDistributionTestFixture, AgradDistributionWiener_v_256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_257, AgradDistributionTestFixture, AgradDistributionWiener_v_257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_258, AgradDistributionTestFixture, AgradDistributionWiener_v_258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_259, AgradDistributionTestFixture, AgradDistributionWiener_v_259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_260, AgradDistributionTestFixture, AgradDistributionWiener_v_260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_261, AgradDistributionTestFixture, AgradDistributionWiener_v_261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_262, AgradDistributionTestFixture, AgradDistributionWiener_v_262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_263, AgradDistributionTestFixture, AgradDistributionWiener_v_263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_264, AgradDistributionTestFixture, AgradDistributionWiener_v_264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_265, AgradDistributionTestFixture, AgradDistributionWiener_v_265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_266, AgradDistributionTestFixture, AgradDistributionWiener_v_266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_267, AgradDistributionTestFixture, AgradDistributionWiener_v_267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_268, AgradDistributionTestFixture, AgradDistributionWiener_v_268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_269, AgradDistributionTestFixture, AgradDistributionWiener_v_269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_270, AgradDistributionTestFixture, AgradDistributionWiener_v_270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_271, AgradDistributionTestFixture, AgradDistributionWiener_v_271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_272, AgradDistributionTestFixture, AgradDistributionWiener_v_272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_273, AgradDistributionTestFixture, AgradDistributionWiener_v_273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_274, AgradDistributionTestFixture, AgradDistributionWiener_v_274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_275, AgradDistributionTestFixture, AgradDistributionWiener_v_275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_276, AgradDistributionTestFixture, AgradDistributionWiener_v_276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_277, AgradDistributionTestFixture, AgradDistributionWiener_v_277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_278, AgradDistributionTestFixture, AgradDistributionWiener_v_278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_279, AgradDistributionTestFixture, AgradDistributionWiener_v_279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_280, AgradDistributionTestFixture, AgradDistributionWiener_v_280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_281, AgradDistributionTestFixture, AgradDistributionWiener_v_281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_282, AgradDistributionTestFixture, AgradDistributionWiener_v_282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_283, AgradDistributionTestFixture, AgradDistributionWiener_v_283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_284, AgradDistributionTestFixture, AgradDistributionWiener_v_284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_285, AgradDistributionTestFixture, AgradDistributionWiener_v_285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_286, AgradDistributionTestFixture, AgradDistributionWiener_v_286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_287, AgradDistributionTestFixture, AgradDistributionWiener_v_287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_288, AgradDistributionTestFixture, AgradDistributionWiener_v_288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_289, AgradDistributionTestFixture, AgradDistributionWiener_v_289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_290, AgradDistributionTestFixture, AgradDistributionWiener_v_290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_291, AgradDistributionTestFixture, AgradDistributionWiener_v_291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_292, AgradDistributionTestFixture, AgradDistributionWiener_v_292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_293, AgradDistributionTestFixture, AgradDistributionWiener_v_293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_294, AgradDistributionTestFixture, AgradDistributionWiener_v_294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_295, AgradDistributionTestFixture, AgradDistributionWiener_v_295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_296, AgradDistributionTestFixture, AgradDistributionWiener_v_296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_297, AgradDistributionTestFixture, AgradDistributionWiener_v_297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_298, AgradDistributionTestFixture, AgradDistributionWiener_v_298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_299, AgradDistributionTestFixture, AgradDistributionWiener_v_299);
+
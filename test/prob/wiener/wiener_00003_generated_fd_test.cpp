@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_300;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_301;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_302;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_303;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_304;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_305;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, double, double, empty> type_fd_306;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_307;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_308;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_309;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_310;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_311;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_312;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_313;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_314;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_315;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_316;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_317;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_318;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_319;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_320;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_321;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_322;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_323;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_324;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_325;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_326;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_327;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_328;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_329;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_330;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_331;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_332;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_333;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_334;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_335;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_336;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_337;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_338;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_339;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_340;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_341;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_342;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_343;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_344;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_345;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_346;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_347;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_348;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_349;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_350;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_351;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_352;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_353;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_354;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_355;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_356;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_357;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_358;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_359;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_360;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_361;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_362;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_363;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_364;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_365;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_366;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_367;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_368;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_369;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_370;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_371;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_372;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_373;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_374;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_375;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_376;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_377;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<double>, empty> type_fd_378;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<double>>, empty> type_fd_379;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_380;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<double>, empty> type_fd_381;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_382;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_383;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_384;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_385;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_386;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, double, empty> type_fd_387;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<double>, empty> type_fd_388;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_389;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, fvar<double>, empty> type_fd_390;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_391;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_392;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, double, empty> type_fd_393;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_394;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_395;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_396;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_397;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_398;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_300> AgradDistributionWiener_fd_300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_301> AgradDistributionWiener_fd_301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_302> AgradDistributionWiener_fd_302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_303> AgradDistributionWiener_fd_303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_304> AgradDistributionWiener_fd_304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_305> AgradDistributionWiener_fd_305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_306> AgradDistributionWiener_fd_306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_307> AgradDistributionWiener_fd_307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_308> AgradDistributionWiener_fd_308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_309> AgradDistributionWiener_fd_309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_310> AgradDistributionWiener_fd_310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_311> AgradDistributionWiener_fd_311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_312> AgradDistributionWiener_fd_312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_313> AgradDistributionWiener_fd_313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_314> AgradDistributionWiener_fd_314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_315> AgradDistributionWiener_fd_315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_316> AgradDistributionWiener_fd_316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_317> AgradDistributionWiener_fd_317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_318> AgradDistributionWiener_fd_318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_319> AgradDistributionWiener_fd_319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_320> AgradDistributionWiener_fd_320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_321> AgradDistributionWiener_fd_321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_322> AgradDistributionWiener_fd_322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_323> AgradDistributionWiener_fd_323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_324> AgradDistributionWiener_fd_324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_325> AgradDistributionWiener_fd_325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_326> AgradDistributionWiener_fd_326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_327> AgradDistributionWiener_fd_327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_328> AgradDistributionWiener_fd_328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_329> AgradDistributionWiener_fd_329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_330> AgradDistributionWiener_fd_330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_331> AgradDistributionWiener_fd_331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_332> AgradDistributionWiener_fd_332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_333> AgradDistributionWiener_fd_333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_334> AgradDistributionWiener_fd_334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_335> AgradDistributionWiener_fd_335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_336> AgradDistributionWiener_fd_336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_337> AgradDistributionWiener_fd_337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_338> AgradDistributionWiener_fd_338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_339> AgradDistributionWiener_fd_339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_340> AgradDistributionWiener_fd_340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_341> AgradDistributionWiener_fd_341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_342> AgradDistributionWiener_fd_342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_343> AgradDistributionWiener_fd_343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_344> AgradDistributionWiener_fd_344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_345> AgradDistributionWiener_fd_345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_346> AgradDistributionWiener_fd_346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_347> AgradDistributionWiener_fd_347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_348> AgradDistributionWiener_fd_348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_349> AgradDistributionWiener_fd_349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_350> AgradDistributionWiener_fd_350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_351> AgradDistributionWiener_fd_351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_352> AgradDistributionWiener_fd_352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_353> AgradDistributionWiener_fd_353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_354> AgradDistributionWiener_fd_354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_355> AgradDistributionWiener_fd_355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_356> AgradDistributionWiener_fd_356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_357> AgradDistributionWiener_fd_357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_358> AgradDistributionWiener_fd_358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_359> AgradDistributionWiener_fd_359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_360> AgradDistributionWiener_fd_360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_361> AgradDistributionWiener_fd_361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_362> AgradDistributionWiener_fd_362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_363> AgradDistributionWiener_fd_363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_364> AgradDistributionWiener_fd_364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_365> AgradDistributionWiener_fd_365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_366> AgradDistributionWiener_fd_366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_367> AgradDistributionWiener_fd_367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_368> AgradDistributionWiener_fd_368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_369> AgradDistributionWiener_fd_369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_370> AgradDistributionWiener_fd_370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_371> AgradDistributionWiener_fd_371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_372> AgradDistributionWiener_fd_372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_373> AgradDistributionWiener_fd_373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_374> AgradDistributionWiener_fd_374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_375> AgradDistributionWiener_fd_375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_376> AgradDistributionWiener_fd_376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_377> AgradDistributionWiener_fd_377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_378> AgradDistributionWiener_fd_378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_379> AgradDistributionWiener_fd_379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_380> AgradDistributionWiener_fd_380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_381> AgradDistributionWiener_fd_381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_382> AgradDistributionWiener_fd_382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_383> AgradDistributionWiener_fd_383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_384> AgradDistributionWiener_fd_384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_385> AgradDistributionWiener_fd_385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_386> AgradDistributionWiener_fd_386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_387> AgradDistributionWiener_fd_387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_388> AgradDistributionWiener_fd_388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_389> AgradDistributionWiener_fd_389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_390> AgradDistributionWiener_fd_390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_391> AgradDistributionWiener_fd_391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_392> AgradDistributionWiener_fd_392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_393> AgradDistributionWiener_fd_393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_394> AgradDistributionWiener_fd_394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_395> AgradDistributionWiener_fd_395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_396> AgradDistributionWiener_fd_396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_397> AgradDistributionWiener_fd_397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_398> AgradDistributionWiener_fd_398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_399> AgradDistributionWiener_fd_399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_300, AgradDistributionTestFixture, AgradDistributionWiener_fd_300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_301, AgradDistributionTestFixture, AgradDistributionWiener_fd_301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_302, AgradDistributionTestFixture, AgradDistributionWiener_fd_302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_303, AgradDistributionTestFixture, AgradDistributionWiener_fd_303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_304, AgradDistributionTestFixture, AgradDistributionWiener_fd_304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_305, AgradDistributionTestFixture, AgradDistributionWiener_fd_305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_306, AgradDistributionTestFixture, AgradDistributionWiener_fd_306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_307, AgradDistributionTestFixture, AgradDistributionWiener_fd_307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_308, AgradDistributionTestFixture, AgradDistributionWiener_fd_308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_309, AgradDistributionTestFixture, AgradDistributionWiener_fd_309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_310, AgradDistributionTestFixture, AgradDistributionWiener_fd_310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_311, AgradDistributionTestFixture, AgradDistributionWiener_fd_311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_312, AgradDistributionTestFixture, AgradDistributionWiener_fd_312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_313, AgradDistributionTestFixture, AgradDistributionWiener_fd_313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_314, AgradDistributionTestFixture, AgradDistributionWiener_fd_314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_315, AgradDistributionTestFixture, AgradDistributionWiener_fd_315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_316, AgradDistributionTestFixture, AgradDistributionWiener_fd_316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_317, AgradDistributionTestFixture, AgradDistributionWiener_fd_317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_318, AgradDistributionTestFixture, AgradDistributionWiener_fd_318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_319, AgradDistributionTestFixture, AgradDistributionWiener_fd_319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_320, AgradDistributionTestFixture, AgradDistributionWiener_fd_320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_321, AgradDistributionTestFixture, AgradDistributionWiener_fd_321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_322, AgradDistributionTestFixture, AgradDistributionWiener_fd_322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_323, AgradDistributionTestFixture, AgradDistributionWiener_fd_323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_324, AgradDistributionTestFixture, AgradDistributionWiener_fd_324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_325, AgradDistributionTestFixture, AgradDistributionWiener_fd_325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_326, AgradDistributionTestFixture, AgradDistributionWiener_fd_326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_327, AgradDistributionTestFixture, AgradDistributionWiener_fd_327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_328, AgradDistributionTestFixture, AgradDistributionWiener_fd_328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_329, AgradDistributionTestFixture, AgradDistributionWiener_fd_329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_330, AgradDistributionTestFixture, AgradDistributionWiener_fd_330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_331, AgradDistributionTestFixture, AgradDistributionWiener_fd_331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_332, AgradDistributionTestFixture, AgradDistributionWiener_fd_332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_333, AgradDistributionTestFixture, AgradDistributionWiener_fd_333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_334, AgradDistributionTestFixture, AgradDistributionWiener_fd_334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_335, AgradDistributionTestFixture, AgradDistributionWiener_fd_335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_336, AgradDistributionTestFixture, AgradDistributionWiener_fd_336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_337, AgradDistributionTestFixture, AgradDistributionWiener_fd_337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_338, AgradDistributionTestFixture, AgradDistributionWiener_fd_338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_339, AgradDistributionTestFixture, AgradDistributionWiener_fd_339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_340, AgradDistributionTestFixture, AgradDistributionWiener_fd_340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_341, AgradDistributionTestFixture, AgradDistributionWiener_fd_341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_342, AgradDistributionTestFixture, AgradDistributionWiener_fd_342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_343, AgradDistributionTestFixture, AgradDistributionWiener_fd_343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_344, AgradDistributionTestFixture, AgradDistributionWiener_fd_344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_345, AgradDistributionTestFixture, AgradDistributionWiener_fd_345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_346, AgradDistributionTestFixture, AgradDistributionWiener_fd_346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_347, AgradDistributionTestFixture, AgradDistributionWiener_fd_347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_348, AgradDistributionTestFixture, AgradDistributionWiener_fd_348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_349, AgradDistributionTestFixture, AgradDistributionWiener_fd_349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_350, AgradDistributionTestFixture, AgradDistributionWiener_fd_350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_351, AgradDistributionTestFixture, AgradDistributionWiener_fd_351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_352, AgradDistributionTestFixture, AgradDistributionWiener_fd_352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_353, AgradDistributionTestFixture, AgradDistributionWiener_fd_353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_354, AgradDistributionTestFixture, AgradDistributionWiener_fd_354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_355, AgradDistributionTestFixture, AgradDistributionWiener_fd_355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_356, AgradDistributionTestFixture, AgradDistributionWiener_fd_356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_357, AgradDistributionTestFixture, AgradDistributionWiener_fd_357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_358, AgradDistributionTestFixture, AgradDistributionWiener_fd_358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_359, AgradDistributionTestFixture, AgradDistributionWiener_fd_359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_360, AgradDistributionTestFixture, AgradDistributionWiener_fd_360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_361, AgradDistributionTestFixture, AgradDistributionWiener_fd_361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_362, AgradDistributionTestFixture, AgradDistributionWiener_fd_362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_363, AgradDistributionTestFixture, AgradDistributionWiener_fd_363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_364, AgradDistributionTestFixture, AgradDistributionWiener_fd_364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_365, AgradDistributionTestFixture, AgradDistributionWiener_fd_365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_366, AgradDistributionTestFixture, AgradDistributionWiener_fd_366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_367, AgradDistributionTestFixture, AgradDistributionWiener_fd_367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_368, AgradDistributionTestFixture, AgradDistributionWiener_fd_368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_369, AgradDistributionTestFixture, AgradDistributionWiener_fd_369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_370, AgradDistributionTestFixture, AgradDistributionWiener_fd_370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_371, AgradDistributionTestFixture, AgradDistributionWiener_fd_371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_372, AgradDistributionTestFixture, AgradDistributionWiener_fd_372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_373, AgradDistributionTestFixture, AgradDistributionWiener_fd_373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_374, AgradDistributionTestFixture, AgradDistributionWiener_fd_374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_375, AgradDistributionTestFixture, AgradDistributionWiener_fd_375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_376, AgradDistributionTestFixture, AgradDistributionWiener_fd_376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_377, AgradDistributionTestFixture, AgradDistributionWiener_fd_377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_378, AgradDistributionTestFixture, AgradDistributionWiener_fd_378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_379, AgradDistributionTestFixture, AgradDistributionWiener_fd_379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_380, AgradDistributionTestFixture, AgradDistributionWiener_fd_380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_381, AgradDistributionTestFixture, AgradDistributionWiener_fd_381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_382, AgradDistributionTestFixture, AgradDistributionWiener_fd_382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_383, AgradDistributionTestFixture, AgradDistributionWiener_fd_383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_384, AgradDistributionTestFixture, AgradDistributionWiener_fd_384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_385, AgradDistributionTestFixture, AgradDistributionWiener_fd_385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_386, AgradDistributionTestFixture, AgradDistributionWiener_fd_386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_387, AgradDistributionTestFixture, AgradDistributionWiener_fd_387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_388, AgradDistributionTestFixture, AgradDistributionWiener_fd_388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_389, AgradDistributionTestFixture, AgradDistributionWiener_fd_389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_390, AgradDistributionTestFixture, AgradDistributionWiener_fd_390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_391, AgradDistributionTestFixture, AgradDistributionWiener_fd_391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_392, AgradDistributionTestFixture, AgradDistributionWiener_fd_392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_393, AgradDistributionTestFixture, AgradDistributionWiener_fd_393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_394, AgradDistributionTestFixture, AgradDistributionWiener_fd_394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_395, AgradDistributionTestFixture, AgradDistributionWiener_fd_395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_396, AgradDistributionTestFixture, AgradDistributionWiener_fd_396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_397, AgradDistributionTestFixture, AgradDistributionWiener_fd_397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_398, AgradDistributionTestFixture, AgradDistributionWiener_fd_398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_399, AgradDistributionTestFixture, AgradDistributionWiener_fd_399);
+
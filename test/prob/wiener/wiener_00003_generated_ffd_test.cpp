@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_300;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_301;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_302;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_303;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_304;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_305;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_306;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_307;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_308;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_309;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_310;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_311;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_312;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_313;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_314;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_315;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_316;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_317;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_318;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_319;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_320;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_321;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_322;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_323;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_324;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_325;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_326;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_327;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_328;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_329;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_330;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_331;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_332;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_333;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_334;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_335;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_336;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_337;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_338;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_339;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_340;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_341;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_342;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_343;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_344;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_345;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_346;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_347;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_348;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_349;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_350;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_351;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_352;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_353;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_354;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_355;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_356;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_357;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_358;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_359;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_360;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_361;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_362;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_363;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_364;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_365;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_366;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_367;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_368;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_369;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_370;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_371;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_372;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_373;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_374;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_375;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_376;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_377;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, empty> type_ffd_378;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_379;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_380;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_381;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_382;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_383;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_384;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_385;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_386;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, double, empty> type_ffd_387;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_388;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_389;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_390;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_391;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_392;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_393;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_394;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_395;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_396;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_397;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_398;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_300> AgradDistributionWiener_ffd_300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_301> AgradDistributionWiener_ffd_301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_302> AgradDistributionWiener_ffd_302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_303> AgradDistributionWiener_ffd_303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_304> AgradDistributionWiener_ffd_304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_305> AgradDistributionWiener_ffd_305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_306> AgradDistributionWiener_ffd_306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_307> AgradDistributionWiener_ffd_307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_308> AgradDistributionWiener_ffd_308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_309> AgradDistributionWiener_ffd_309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_310> AgradDistributionWiener_ffd_310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_311> AgradDistributionWiener_ffd_311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_312> AgradDistributionWiener_ffd_312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_313> AgradDistributionWiener_ffd_313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_314> AgradDistributionWiener_ffd_314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_315> AgradDistributionWiener_ffd_315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_316> AgradDistributionWiener_ffd_316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_317> AgradDistributionWiener_ffd_317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_318> AgradDistributionWiener_ffd_318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_319> AgradDistributionWiener_ffd_319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_320> AgradDistributionWiener_ffd_320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_321> AgradDistributionWiener_ffd_321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_322> AgradDistributionWiener_ffd_322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_323> AgradDistributionWiener_ffd_323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_324> AgradDistributionWiener_ffd_324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_325> AgradDistributionWiener_ffd_325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_326> AgradDistributionWiener_ffd_326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_327> AgradDistributionWiener_ffd_327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_328> AgradDistributionWiener_ffd_328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_329> AgradDistributionWiener_ffd_329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_330> AgradDistributionWiener_ffd_330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_331> AgradDistributionWiener_ffd_331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_332> AgradDistributionWiener_ffd_332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_333> AgradDistributionWiener_ffd_333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_334> AgradDistributionWiener_ffd_334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_335> AgradDistributionWiener_ffd_335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_336> AgradDistributionWiener_ffd_336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_337> AgradDistributionWiener_ffd_337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_338> AgradDistributionWiener_ffd_338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_339> AgradDistributionWiener_ffd_339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_340> AgradDistributionWiener_ffd_340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_341> AgradDistributionWiener_ffd_341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_342> AgradDistributionWiener_ffd_342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_343> AgradDistributionWiener_ffd_343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_344> AgradDistributionWiener_ffd_344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_345> AgradDistributionWiener_ffd_345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_346> AgradDistributionWiener_ffd_346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_347> AgradDistributionWiener_ffd_347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_348> AgradDistributionWiener_ffd_348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_349> AgradDistributionWiener_ffd_349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_350> AgradDistributionWiener_ffd_350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_351> AgradDistributionWiener_ffd_351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_352> AgradDistributionWiener_ffd_352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_353> AgradDistributionWiener_ffd_353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_354> AgradDistributionWiener_ffd_354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_355> AgradDistributionWiener_ffd_355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_356> AgradDistributionWiener_ffd_356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_357> AgradDistributionWiener_ffd_357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_358> AgradDistributionWiener_ffd_358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_359> AgradDistributionWiener_ffd_359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_360> AgradDistributionWiener_ffd_360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_361> AgradDistributionWiener_ffd_361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_362> AgradDistributionWiener_ffd_362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_363> AgradDistributionWiener_ffd_363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_364> AgradDistributionWiener_ffd_364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_365> AgradDistributionWiener_ffd_365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_366> AgradDistributionWiener_ffd_366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_367> AgradDistributionWiener_ffd_367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_368> AgradDistributionWiener_ffd_368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_369> AgradDistributionWiener_ffd_369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_370> AgradDistributionWiener_ffd_370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_371> AgradDistributionWiener_ffd_371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_372> AgradDistributionWiener_ffd_372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_373> AgradDistributionWiener_ffd_373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_374> AgradDistributionWiener_ffd_374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_375> AgradDistributionWiener_ffd_375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_376> AgradDistributionWiener_ffd_376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_377> AgradDistributionWiener_ffd_377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_378> AgradDistributionWiener_ffd_378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_379> AgradDistributionWiener_ffd_379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_380> AgradDistributionWiener_ffd_380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_381> AgradDistributionWiener_ffd_381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_382> AgradDistributionWiener_ffd_382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_383> AgradDistributionWiener_ffd_383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_384> AgradDistributionWiener_ffd_384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_385> AgradDistributionWiener_ffd_385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_386> AgradDistributionWiener_ffd_386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_387> AgradDistributionWiener_ffd_387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_388> AgradDistributionWiener_ffd_388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_389> AgradDistributionWiener_ffd_389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_390> AgradDistributionWiener_ffd_390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_391> AgradDistributionWiener_ffd_391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_392> AgradDistributionWiener_ffd_392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_393> AgradDistributionWiener_ffd_393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_394> AgradDistributionWiener_ffd_394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_395> AgradDistributionWiener_ffd_395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_396> AgradDistributionWiener_ffd_396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_397> AgradDistributionWiener_ffd_397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_398> AgradDistributionWiener_ffd_398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_399> AgradDistributionWiener_ffd_399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_300, AgradDistributionTestFixture, AgradDistributionWiener_ffd_300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_301, AgradDistributionTestFixture, AgradDistributionWiener_ffd_301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_302, AgradDistributionTestFixture, AgradDistributionWiener_ffd_302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_303, AgradDistributionTestFixture, AgradDistributionWiener_ffd_303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_304, AgradDistributionTestFixture, AgradDistributionWiener_ffd_304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_305, AgradDistributionTestFixture, AgradDistributionWiener_ffd_305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_306, AgradDistributionTestFixture, AgradDistributionWiener_ffd_306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_307, AgradDistributionTestFixture, AgradDistributionWiener_ffd_307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_308, AgradDistributionTestFixture, AgradDistributionWiener_ffd_308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_309, AgradDistributionTestFixture, AgradDistributionWiener_ffd_309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_310, AgradDistributionTestFixture, AgradDistributionWiener_ffd_310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_311, AgradDistributionTestFixture, AgradDistributionWiener_ffd_311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_312, AgradDistributionTestFixture, AgradDistributionWiener_ffd_312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_313, AgradDistributionTestFixture, AgradDistributionWiener_ffd_313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_314, AgradDistributionTestFixture, AgradDistributionWiener_ffd_314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_315, AgradDistributionTestFixture, AgradDistributionWiener_ffd_315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_316, AgradDistributionTestFixture, AgradDistributionWiener_ffd_316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_317, AgradDistributionTestFixture, AgradDistributionWiener_ffd_317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_318, AgradDistributionTestFixture, AgradDistributionWiener_ffd_318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_319, AgradDistributionTestFixture, AgradDistributionWiener_ffd_319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_320, AgradDistributionTestFixture, AgradDistributionWiener_ffd_320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_321, AgradDistributionTestFixture, AgradDistributionWiener_ffd_321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_322, AgradDistributionTestFixture, AgradDistributionWiener_ffd_322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_323, AgradDistributionTestFixture, AgradDistributionWiener_ffd_323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_324, AgradDistributionTestFixture, AgradDistributionWiener_ffd_324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_325, AgradDistributionTestFixture, AgradDistributionWiener_ffd_325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_326, AgradDistributionTestFixture, AgradDistributionWiener_ffd_326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_327, AgradDistributionTestFixture, AgradDistributionWiener_ffd_327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_328, AgradDistributionTestFixture, AgradDistributionWiener_ffd_328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_329, AgradDistributionTestFixture, AgradDistributionWiener_ffd_329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_330, AgradDistributionTestFixture, AgradDistributionWiener_ffd_330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_331, AgradDistributionTestFixture, AgradDistributionWiener_ffd_331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_332, AgradDistributionTestFixture, AgradDistributionWiener_ffd_332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_333, AgradDistributionTestFixture, AgradDistributionWiener_ffd_333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_334, AgradDistributionTestFixture, AgradDistributionWiener_ffd_334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_335, AgradDistributionTestFixture, AgradDistributionWiener_ffd_335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_336, AgradDistributionTestFixture, AgradDistributionWiener_ffd_336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_337, AgradDistributionTestFixture, AgradDistributionWiener_ffd_337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_338, AgradDistributionTestFixture, AgradDistributionWiener_ffd_338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_339, AgradDistributionTestFixture, AgradDistributionWiener_ffd_339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_340, AgradDistributionTestFixture, AgradDistributionWiener_ffd_340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_341, AgradDistributionTestFixture, AgradDistributionWiener_ffd_341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_342, AgradDistributionTestFixture, AgradDistributionWiener_ffd_342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_343, AgradDistributionTestFixture, AgradDistributionWiener_ffd_343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_344, AgradDistributionTestFixture, AgradDistributionWiener_ffd_344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_345, AgradDistributionTestFixture, AgradDistributionWiener_ffd_345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_346, AgradDistributionTestFixture, AgradDistributionWiener_ffd_346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_347, AgradDistributionTestFixture, AgradDistributionWiener_ffd_347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_348, AgradDistributionTestFixture, AgradDistributionWiener_ffd_348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_349, AgradDistributionTestFixture, AgradDistributionWiener_ffd_349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_350, AgradDistributionTestFixture, AgradDistributionWiener_ffd_350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_351, AgradDistributionTestFixture, AgradDistributionWiener_ffd_351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_352, AgradDistributionTestFixture, AgradDistributionWiener_ffd_352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_353, AgradDistributionTestFixture, AgradDistributionWiener_ffd_353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_354, AgradDistributionTestFixture, AgradDistributionWiener_ffd_354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_355, AgradDistributionTestFixture, AgradDistributionWiener_ffd_355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_356, AgradDistributionTestFixture, AgradDistributionWiener_ffd_356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_357, AgradDistributionTestFixture, AgradDistributionWiener_ffd_357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_358, AgradDistributionTestFixture, AgradDistributionWiener_ffd_358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_359, AgradDistributionTestFixture, AgradDistributionWiener_ffd_359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_360, AgradDistributionTestFixture, AgradDistributionWiener_ffd_360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_361, AgradDistributionTestFixture, AgradDistributionWiener_ffd_361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_362, AgradDistributionTestFixture, AgradDistributionWiener_ffd_362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_363, AgradDistributionTestFixture, AgradDistributionWiener_ffd_363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_364, AgradDistributionTestFixture, AgradDistributionWiener_ffd_364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_365, AgradDistributionTestFixture, AgradDistributionWiener_ffd_365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_366, AgradDistributionTestFixture, AgradDistributionWiener_ffd_366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_367, AgradDistributionTestFixture, AgradDistributionWiener_ffd_367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_368, AgradDistributionTestFixture, AgradDistributionWiener_ffd_368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_369, AgradDistributionTestFixture, AgradDistributionWiener_ffd_369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_370, AgradDistributionTestFixture, AgradDistributionWiener_ffd_370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_371, AgradDistributionTestFixture, AgradDistributionWiener_ffd_371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_372, AgradDistributionTestFixture, AgradDistributionWiener_ffd_372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_373, AgradDistributionTestFixture, AgradDistributionWiener_ffd_373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_374, AgradDistributionTestFixture, AgradDistributionWiener_ffd_374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_375, AgradDistributionTestFixture, AgradDistributionWiener_ffd_375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_376, AgradDistributionTestFixture, AgradDistributionWiener_ffd_376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_377, AgradDistributionTestFixture, AgradDistributionWiener_ffd_377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_378, AgradDistributionTestFixture, AgradDistributionWiener_ffd_378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_379, AgradDistributionTestFixture, AgradDistributionWiener_ffd_379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_380, AgradDistributionTestFixture, AgradDistributionWiener_ffd_380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_381, AgradDistributionTestFixture, AgradDistributionWiener_ffd_381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_382, AgradDistributionTestFixture, AgradDistributionWiener_ffd_382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_383, AgradDistributionTestFixture, AgradDistributionWiener_ffd_383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_384, AgradDistributionTestFixture, AgradDistributionWiener_ffd_384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_385, AgradDistributionTestFixture, AgradDistributionWiener_ffd_385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_386, AgradDistributionTestFixture, AgradDistributionWiener_ffd_386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_387, AgradDistributionTestFixture, AgradDistributionWiener_ffd_387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_388, AgradDistributionTestFixture, AgradDistributionWiener_ffd_388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_389, AgradDistributionTestFixture, AgradDistributionWiener_ffd_389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_390, AgradDistributionTestFixture, AgradDistributionWiener_ffd_390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_391, AgradDistributionTestFixture, AgradDistributionWiener_ffd_391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_392, AgradDistributionTestFixture, AgradDistributionWiener_ffd_392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_393, AgradDistributionTestFixture, AgradDistributionWiener_ffd_393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_394, AgradDistributionTestFixture, AgradDistributionWiener_ffd_394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_395, AgradDistributionTestFixture, AgradDistributionWiener_ffd_395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_396, AgradDistributionTestFixture, AgradDistributionWiener_ffd_396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_397, AgradDistributionTestFixture, AgradDistributionWiener_ffd_397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_398, AgradDistributionTestFixture, AgradDistributionWiener_ffd_398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_399, AgradDistributionTestFixture, AgradDistributionWiener_ffd_399);
+
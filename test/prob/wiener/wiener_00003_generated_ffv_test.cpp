@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_300;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_301;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_302;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_303;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_304;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_305;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_306;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_307;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_308;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_309;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_310;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_311;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_312;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_313;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_314;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_315;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_316;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_317;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_318;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_319;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_320;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_321;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_322;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_323;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_324;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_325;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_326;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_327;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_328;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_329;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_330;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_331;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_332;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_333;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_334;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_335;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_336;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_337;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_338;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_339;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_340;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_341;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_342;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_343;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_344;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_345;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_346;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_347;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_348;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_349;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_350;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_351;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_352;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_353;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_354;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_355;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_356;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_357;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_358;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_359;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_360;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_361;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_362;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_363;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_364;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_365;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_366;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_367;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_368;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_369;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_370;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_371;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_372;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_373;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_374;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_375;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_376;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_377;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty> type_ffv_378;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_379;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_380;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_381;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_382;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_383;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_384;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_385;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_386;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty> type_ffv_387;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_388;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_389;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_390;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_391;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_392;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_393;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_394;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_395;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_396;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_397;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_398;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_300> AgradDistributionWiener_ffv_300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_301> AgradDistributionWiener_ffv_301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_302> AgradDistributionWiener_ffv_302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_303> AgradDistributionWiener_ffv_303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_304> AgradDistributionWiener_ffv_304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_305> AgradDistributionWiener_ffv_305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_306> AgradDistributionWiener_ffv_306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_307> AgradDistributionWiener_ffv_307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_308> AgradDistributionWiener_ffv_308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_309> AgradDistributionWiener_ffv_309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_310> AgradDistributionWiener_ffv_310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_311> AgradDistributionWiener_ffv_311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_312> AgradDistributionWiener_ffv_312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_313> AgradDistributionWiener_ffv_313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_314> AgradDistributionWiener_ffv_314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_315> AgradDistributionWiener_ffv_315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_316> AgradDistributionWiener_ffv_316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_317> AgradDistributionWiener_ffv_317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_318> AgradDistributionWiener_ffv_318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_319> AgradDistributionWiener_ffv_319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_320> AgradDistributionWiener_ffv_320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_321> AgradDistributionWiener_ffv_321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_322> AgradDistributionWiener_ffv_322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_323> AgradDistributionWiener_ffv_323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_324> AgradDistributionWiener_ffv_324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_325> AgradDistributionWiener_ffv_325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_326> AgradDistributionWiener_ffv_326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_327> AgradDistributionWiener_ffv_327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_328> AgradDistributionWiener_ffv_328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_329> AgradDistributionWiener_ffv_329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_330> AgradDistributionWiener_ffv_330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_331> AgradDistributionWiener_ffv_331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_332> AgradDistributionWiener_ffv_332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_333> AgradDistributionWiener_ffv_333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_334> AgradDistributionWiener_ffv_334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_335> AgradDistributionWiener_ffv_335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_336> AgradDistributionWiener_ffv_336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_337> AgradDistributionWiener_ffv_337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_338> AgradDistributionWiener_ffv_338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_339> AgradDistributionWiener_ffv_339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_340> AgradDistributionWiener_ffv_340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_341> AgradDistributionWiener_ffv_341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_342> AgradDistributionWiener_ffv_342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_343> AgradDistributionWiener_ffv_343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_344> AgradDistributionWiener_ffv_344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_345> AgradDistributionWiener_ffv_345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_346> AgradDistributionWiener_ffv_346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_347> AgradDistributionWiener_ffv_347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_348> AgradDistributionWiener_ffv_348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_349> AgradDistributionWiener_ffv_349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_350> AgradDistributionWiener_ffv_350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_351> AgradDistributionWiener_ffv_351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_352> AgradDistributionWiener_ffv_352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_353> AgradDistributionWiener_ffv_353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_354> AgradDistributionWiener_ffv_354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_355> AgradDistributionWiener_ffv_355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_356> AgradDistributionWiener_ffv_356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_357> AgradDistributionWiener_ffv_357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_358> AgradDistributionWiener_ffv_358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_359> AgradDistributionWiener_ffv_359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_360> AgradDistributionWiener_ffv_360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_361> AgradDistributionWiener_ffv_361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_362> AgradDistributionWiener_ffv_362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_363> AgradDistributionWiener_ffv_363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_364> AgradDistributionWiener_ffv_364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_365> AgradDistributionWiener_ffv_365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_366> AgradDistributionWiener_ffv_366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_367> AgradDistributionWiener_ffv_367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_368> AgradDistributionWiener_ffv_368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_369> AgradDistributionWiener_ffv_369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_370> AgradDistributionWiener_ffv_370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_371> AgradDistributionWiener_ffv_371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_372> AgradDistributionWiener_ffv_372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_373> AgradDistributionWiener_ffv_373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_374> AgradDistributionWiener_ffv_374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_375> AgradDistributionWiener_ffv_375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_376> AgradDistributionWiener_ffv_376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_377> AgradDistributionWiener_ffv_377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_378> AgradDistributionWiener_ffv_378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_379> AgradDistributionWiener_ffv_379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_380> AgradDistributionWiener_ffv_380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_381> AgradDistributionWiener_ffv_381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_382> AgradDistributionWiener_ffv_382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_383> AgradDistributionWiener_ffv_383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_384> AgradDistributionWiener_ffv_384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_385> AgradDistributionWiener_ffv_385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_386> AgradDistributionWiener_ffv_386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_387> AgradDistributionWiener_ffv_387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_388> AgradDistributionWiener_ffv_388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_389> AgradDistributionWiener_ffv_389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_390> AgradDistributionWiener_ffv_390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_391> AgradDistributionWiener_ffv_391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_392> AgradDistributionWiener_ffv_392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_393> AgradDistributionWiener_ffv_393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_394> AgradDistributionWiener_ffv_394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_395> AgradDistributionWiener_ffv_395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_396> AgradDistributionWiener_ffv_396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_397> AgradDistributionWiener_ffv_397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_398> AgradDistributionWiener_ffv_398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_399> AgradDistributionWiener_ffv_399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_300, AgradDistributionTestFixture, AgradDistributionWiener_ffv_300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_301, AgradDistributionTestFixture, AgradDistributionWiener_ffv_301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_302, AgradDistributionTestFixture, AgradDistributionWiener_ffv_302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_303, AgradDistributionTestFixture, AgradDistributionWiener_ffv_303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_304, AgradDistributionTestFixture, AgradDistributionWiener_ffv_304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_305, AgradDistributionTestFixture, AgradDistributionWiener_ffv_305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_306, AgradDistributionTestFixture, AgradDistributionWiener_ffv_306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_307, AgradDistributionTestFixture, AgradDistributionWiener_ffv_307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_308, AgradDistributionTestFixture, AgradDistributionWiener_ffv_308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_309, AgradDistributionTestFixture, AgradDistributionWiener_ffv_309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_310, AgradDistributionTestFixture, AgradDistributionWiener_ffv_310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_311, AgradDistributionTestFixture, AgradDistributionWiener_ffv_311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_312, AgradDistributionTestFixture, AgradDistributionWiener_ffv_312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_313, AgradDistributionTestFixture, AgradDistributionWiener_ffv_313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_314, AgradDistributionTestFixture, AgradDistributionWiener_ffv_314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_315, AgradDistributionTestFixture, AgradDistributionWiener_ffv_315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_316, AgradDistributionTestFixture, AgradDistributionWiener_ffv_316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_317, AgradDistributionTestFixture, AgradDistributionWiener_ffv_317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_318, AgradDistributionTestFixture, AgradDistributionWiener_ffv_318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_319, AgradDistributionTestFixture, AgradDistributionWiener_ffv_319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_320, AgradDistributionTestFixture, AgradDistributionWiener_ffv_320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_321, AgradDistributionTestFixture, AgradDistributionWiener_ffv_321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_322, AgradDistributionTestFixture, AgradDistributionWiener_ffv_322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_323, AgradDistributionTestFixture, AgradDistributionWiener_ffv_323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_324, AgradDistributionTestFixture, AgradDistributionWiener_ffv_324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_325, AgradDistributionTestFixture, AgradDistributionWiener_ffv_325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_326, AgradDistributionTestFixture, AgradDistributionWiener_ffv_326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_327, AgradDistributionTestFixture, AgradDistributionWiener_ffv_327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_328, AgradDistributionTestFixture, AgradDistributionWiener_ffv_328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_329, AgradDistributionTestFixture, AgradDistributionWiener_ffv_329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_330, AgradDistributionTestFixture, AgradDistributionWiener_ffv_330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_331, AgradDistributionTestFixture, AgradDistributionWiener_ffv_331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_332, AgradDistributionTestFixture, AgradDistributionWiener_ffv_332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_333, AgradDistributionTestFixture, AgradDistributionWiener_ffv_333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_334, AgradDistributionTestFixture, AgradDistributionWiener_ffv_334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_335, AgradDistributionTestFixture, AgradDistributionWiener_ffv_335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_336, AgradDistributionTestFixture, AgradDistributionWiener_ffv_336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_337, AgradDistributionTestFixture, AgradDistributionWiener_ffv_337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_338, AgradDistributionTestFixture, AgradDistributionWiener_ffv_338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_339, AgradDistributionTestFixture, AgradDistributionWiener_ffv_339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_340, AgradDistributionTestFixture, AgradDistributionWiener_ffv_340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_341, AgradDistributionTestFixture, AgradDistributionWiener_ffv_341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_342, AgradDistributionTestFixture, AgradDistributionWiener_ffv_342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_343, AgradDistributionTestFixture, AgradDistributionWiener_ffv_343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_344, AgradDistributionTestFixture, AgradDistributionWiener_ffv_344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_345, AgradDistributionTestFixture, AgradDistributionWiener_ffv_345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_346, AgradDistributionTestFixture, AgradDistributionWiener_ffv_346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_347, AgradDistributionTestFixture, AgradDistributionWiener_ffv_347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_348, AgradDistributionTestFixture, AgradDistributionWiener_ffv_348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_349, AgradDistributionTestFixture, AgradDistributionWiener_ffv_349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_350, AgradDistributionTestFixture, AgradDistributionWiener_ffv_350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_351, AgradDistributionTestFixture, AgradDistributionWiener_ffv_351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_352, AgradDistributionTestFixture, AgradDistributionWiener_ffv_352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_353, AgradDistributionTestFixture, AgradDistributionWiener_ffv_353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_354, AgradDistributionTestFixture, AgradDistributionWiener_ffv_354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_355, AgradDistributionTestFixture, AgradDistributionWiener_ffv_355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_356, AgradDistributionTestFixture, AgradDistributionWiener_ffv_356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_357, AgradDistributionTestFixture, AgradDistributionWiener_ffv_357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_358, AgradDistributionTestFixture, AgradDistributionWiener_ffv_358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_359, AgradDistributionTestFixture, AgradDistributionWiener_ffv_359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_360, AgradDistributionTestFixture, AgradDistributionWiener_ffv_360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_361, AgradDistributionTestFixture, AgradDistributionWiener_ffv_361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_362, AgradDistributionTestFixture, AgradDistributionWiener_ffv_362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_363, AgradDistributionTestFixture, AgradDistributionWiener_ffv_363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_364, AgradDistributionTestFixture, AgradDistributionWiener_ffv_364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_365, AgradDistributionTestFixture, AgradDistributionWiener_ffv_365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_366, AgradDistributionTestFixture, AgradDistributionWiener_ffv_366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_367, AgradDistributionTestFixture, AgradDistributionWiener_ffv_367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_368, AgradDistributionTestFixture, AgradDistributionWiener_ffv_368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_369, AgradDistributionTestFixture, AgradDistributionWiener_ffv_369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_370, AgradDistributionTestFixture, AgradDistributionWiener_ffv_370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_371, AgradDistributionTestFixture, AgradDistributionWiener_ffv_371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_372, AgradDistributionTestFixture, AgradDistributionWiener_ffv_372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_373, AgradDistributionTestFixture, AgradDistributionWiener_ffv_373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_374, AgradDistributionTestFixture, AgradDistributionWiener_ffv_374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_375, AgradDistributionTestFixture, AgradDistributionWiener_ffv_375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_376, AgradDistributionTestFixture, AgradDistributionWiener_ffv_376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_377, AgradDistributionTestFixture, AgradDistributionWiener_ffv_377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_378, AgradDistributionTestFixture, AgradDistributionWiener_ffv_378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_379, AgradDistributionTestFixture, AgradDistributionWiener_ffv_379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_380, AgradDistributionTestFixture, AgradDistributionWiener_ffv_380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_381, AgradDistributionTestFixture, AgradDistributionWiener_ffv_381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_382, AgradDistributionTestFixture, AgradDistributionWiener_ffv_382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_383, AgradDistributionTestFixture, AgradDistributionWiener_ffv_383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_384, AgradDistributionTestFixture, AgradDistributionWiener_ffv_384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_385, AgradDistributionTestFixture, AgradDistributionWiener_ffv_385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_386, AgradDistributionTestFixture, AgradDistributionWiener_ffv_386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_387, AgradDistributionTestFixture, AgradDistributionWiener_ffv_387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_388, AgradDistributionTestFixture, AgradDistributionWiener_ffv_388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_389, AgradDistributionTestFixture, AgradDistributionWiener_ffv_389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_390, AgradDistributionTestFixture, AgradDistributionWiener_ffv_390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_391, AgradDistributionTestFixture, AgradDistributionWiener_ffv_391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_392, AgradDistributionTestFixture, AgradDistributionWiener_ffv_392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_393, AgradDistributionTestFixture, AgradDistributionWiener_ffv_393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_394, AgradDistributionTestFixture, AgradDistributionWiener_ffv_394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_395, AgradDistributionTestFixture, AgradDistributionWiener_ffv_395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_396, AgradDistributionTestFixture, AgradDistributionWiener_ffv_396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_397, AgradDistributionTestFixture, AgradDistributionWiener_ffv_397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_398, AgradDistributionTestFixture, AgradDistributionWiener_ffv_398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_399, AgradDistributionTestFixture, AgradDistributionWiener_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_300;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_301;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_302;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_303;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_304;
+typedef boost::mpl::vector<double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_305;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, double, double, empty> type_fv_306;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_307;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_308;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_309;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_310;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_311;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_312;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_313;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_314;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_315;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_316;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_317;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_318;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_319;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_320;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_321;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_322;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_323;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_324;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_325;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_326;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_327;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_328;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_329;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_330;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_331;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_332;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_333;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_334;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_335;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_336;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_337;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_338;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_339;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_340;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_341;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_342;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_343;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_344;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_345;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_346;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_347;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_348;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_349;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_350;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_351;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_352;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_353;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_354;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_355;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_356;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_357;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_358;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_359;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_360;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_361;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_362;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_363;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_364;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_365;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_366;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_367;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_368;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_369;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_370;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_371;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_372;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_373;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_374;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_375;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_376;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_377;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<var>, empty> type_fv_378;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<var>>, empty> type_fv_379;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_380;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<var>, empty> type_fv_381;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_382;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_383;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_384;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_385;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_386;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, double, empty> type_fv_387;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, empty> type_fv_388;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_389;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, empty> type_fv_390;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_391;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_392;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, empty> type_fv_393;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_394;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_395;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_396;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_397;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_398;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_300> AgradDistributionWiener_fv_300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_301> AgradDistributionWiener_fv_301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_302> AgradDistributionWiener_fv_302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_303> AgradDistributionWiener_fv_303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_304> AgradDistributionWiener_fv_304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_305> AgradDistributionWiener_fv_305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_306> AgradDistributionWiener_fv_306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_307> AgradDistributionWiener_fv_307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_308> AgradDistributionWiener_fv_308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_309> AgradDistributionWiener_fv_309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_310> AgradDistributionWiener_fv_310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_311> AgradDistributionWiener_fv_311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_312> AgradDistributionWiener_fv_312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_313> AgradDistributionWiener_fv_313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_314> AgradDistributionWiener_fv_314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_315> AgradDistributionWiener_fv_315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_316> AgradDistributionWiener_fv_316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_317> AgradDistributionWiener_fv_317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_318> AgradDistributionWiener_fv_318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_319> AgradDistributionWiener_fv_319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_320> AgradDistributionWiener_fv_320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_321> AgradDistributionWiener_fv_321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_322> AgradDistributionWiener_fv_322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_323> AgradDistributionWiener_fv_323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_324> AgradDistributionWiener_fv_324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_325> AgradDistributionWiener_fv_325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_326> AgradDistributionWiener_fv_326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_327> AgradDistributionWiener_fv_327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_328> AgradDistributionWiener_fv_328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_329> AgradDistributionWiener_fv_329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_330> AgradDistributionWiener_fv_330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_331> AgradDistributionWiener_fv_331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_332> AgradDistributionWiener_fv_332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_333> AgradDistributionWiener_fv_333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_334> AgradDistributionWiener_fv_334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_335> AgradDistributionWiener_fv_335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_336> AgradDistributionWiener_fv_336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_337> AgradDistributionWiener_fv_337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_338> AgradDistributionWiener_fv_338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_339> AgradDistributionWiener_fv_339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_340> AgradDistributionWiener_fv_340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_341> AgradDistributionWiener_fv_341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_342> AgradDistributionWiener_fv_342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_343> AgradDistributionWiener_fv_343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_344> AgradDistributionWiener_fv_344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_345> AgradDistributionWiener_fv_345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_346> AgradDistributionWiener_fv_346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_347> AgradDistributionWiener_fv_347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_348> AgradDistributionWiener_fv_348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_349> AgradDistributionWiener_fv_349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_350> AgradDistributionWiener_fv_350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_351> AgradDistributionWiener_fv_351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_352> AgradDistributionWiener_fv_352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_353> AgradDistributionWiener_fv_353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_354> AgradDistributionWiener_fv_354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_355> AgradDistributionWiener_fv_355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_356> AgradDistributionWiener_fv_356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_357> AgradDistributionWiener_fv_357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_358> AgradDistributionWiener_fv_358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_359> AgradDistributionWiener_fv_359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_360> AgradDistributionWiener_fv_360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_361> AgradDistributionWiener_fv_361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_362> AgradDistributionWiener_fv_362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_363> AgradDistributionWiener_fv_363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_364> AgradDistributionWiener_fv_364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_365> AgradDistributionWiener_fv_365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_366> AgradDistributionWiener_fv_366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_367> AgradDistributionWiener_fv_367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_368> AgradDistributionWiener_fv_368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_369> AgradDistributionWiener_fv_369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_370> AgradDistributionWiener_fv_370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_371> AgradDistributionWiener_fv_371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_372> AgradDistributionWiener_fv_372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_373> AgradDistributionWiener_fv_373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_374> AgradDistributionWiener_fv_374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_375> AgradDistributionWiener_fv_375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_376> AgradDistributionWiener_fv_376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_377> AgradDistributionWiener_fv_377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_378> AgradDistributionWiener_fv_378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_379> AgradDistributionWiener_fv_379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_380> AgradDistributionWiener_fv_380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_381> AgradDistributionWiener_fv_381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_382> AgradDistributionWiener_fv_382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_383> AgradDistributionWiener_fv_383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_384> AgradDistributionWiener_fv_384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_385> AgradDistributionWiener_fv_385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_386> AgradDistributionWiener_fv_386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_387> AgradDistributionWiener_fv_387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_388> AgradDistributionWiener_fv_388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_389> AgradDistributionWiener_fv_389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_390> AgradDistributionWiener_fv_390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_391> AgradDistributionWiener_fv_391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_392> AgradDistributionWiener_fv_392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_393> AgradDistributionWiener_fv_393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_394> AgradDistributionWiener_fv_394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_395> AgradDistributionWiener_fv_395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_396> AgradDistributionWiener_fv_396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_397> AgradDistributionWiener_fv_397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_398> AgradDistributionWiener_fv_398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_399> AgradDistributionWiener_fv_399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_300, AgradDistributionTestFixture, AgradDistributionWiener_fv_300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_301, AgradDistributionTestFixture, AgradDistributionWiener_fv_301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_302, AgradDistributionTestFixture, AgradDistributionWiener_fv_302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_303, AgradDistributionTestFixture, AgradDistributionWiener_fv_303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_304, AgradDistributionTestFixture, AgradDistributionWiener_fv_304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_305, AgradDistributionTestFixture, AgradDistributionWiener_fv_305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_306, AgradDistributionTestFixture, AgradDistributionWiener_fv_306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_307, AgradDistributionTestFixture, AgradDistributionWiener_fv_307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_308, AgradDistributionTestFixture, AgradDistributionWiener_fv_308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_309, AgradDistributionTestFixture, AgradDistributionWiener_fv_309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_310, AgradDistributionTestFixture, AgradDistributionWiener_fv_310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_311, AgradDistributionTestFixture, AgradDistributionWiener_fv_311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_312, AgradDistributionTestFixture, AgradDistributionWiener_fv_312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_313, AgradDistributionTestFixture, AgradDistributionWiener_fv_313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_314, AgradDistributionTestFixture, AgradDistributionWiener_fv_314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_315, AgradDistributionTestFixture, AgradDistributionWiener_fv_315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_316, AgradDistributionTestFixture, AgradDistributionWiener_fv_316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_317, AgradDistributionTestFixture, AgradDistributionWiener_fv_317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_318, AgradDistributionTestFixture, AgradDistributionWiener_fv_318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_319, AgradDistributionTestFixture, AgradDistributionWiener_fv_319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_320, AgradDistributionTestFixture, AgradDistributionWiener_fv_320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_321, AgradDistributionTestFixture, AgradDistributionWiener_fv_321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_322, AgradDistributionTestFixture, AgradDistributionWiener_fv_322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_323, AgradDistributionTestFixture, AgradDistributionWiener_fv_323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_324, AgradDistributionTestFixture, AgradDistributionWiener_fv_324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_325, AgradDistributionTestFixture, AgradDistributionWiener_fv_325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_326, AgradDistributionTestFixture, AgradDistributionWiener_fv_326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_327, AgradDistributionTestFixture, AgradDistributionWiener_fv_327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_328, AgradDistributionTestFixture, AgradDistributionWiener_fv_328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_329, AgradDistributionTestFixture, AgradDistributionWiener_fv_329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_330, AgradDistributionTestFixture, AgradDistributionWiener_fv_330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_331, AgradDistributionTestFixture, AgradDistributionWiener_fv_331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_332, AgradDistributionTestFixture, AgradDistributionWiener_fv_332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_333, AgradDistributionTestFixture, AgradDistributionWiener_fv_333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_334, AgradDistributionTestFixture, AgradDistributionWiener_fv_334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_335, AgradDistributionTestFixture, AgradDistributionWiener_fv_335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_336, AgradDistributionTestFixture, AgradDistributionWiener_fv_336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_337, AgradDistributionTestFixture, AgradDistributionWiener_fv_337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_338, AgradDistributionTestFixture, AgradDistributionWiener_fv_338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_339, AgradDistributionTestFixture, AgradDistributionWiener_fv_339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_340, AgradDistributionTestFixture, AgradDistributionWiener_fv_340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_341, AgradDistributionTestFixture, AgradDistributionWiener_fv_341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_342, AgradDistributionTestFixture, AgradDistributionWiener_fv_342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_343, AgradDistributionTestFixture, AgradDistributionWiener_fv_343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_344, AgradDistributionTestFixture, AgradDistributionWiener_fv_344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_345, AgradDistributionTestFixture, AgradDistributionWiener_fv_345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_346, AgradDistributionTestFixture, AgradDistributionWiener_fv_346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_347, AgradDistributionTestFixture, AgradDistributionWiener_fv_347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_348, AgradDistributionTestFixture, AgradDistributionWiener_fv_348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_349, AgradDistributionTestFixture, AgradDistributionWiener_fv_349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_350, AgradDistributionTestFixture, AgradDistributionWiener_fv_350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_351, AgradDistributionTestFixture, AgradDistributionWiener_fv_351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_352, AgradDistributionTestFixture, AgradDistributionWiener_fv_352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_353, AgradDistributionTestFixture, AgradDistributionWiener_fv_353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_354, AgradDistributionTestFixture, AgradDistributionWiener_fv_354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_355, AgradDistributionTestFixture, AgradDistributionWiener_fv_355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_356, AgradDistributionTestFixture, AgradDistributionWiener_fv_356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_357, AgradDistributionTestFixture, AgradDistributionWiener_fv_357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_358, AgradDistributionTestFixture, AgradDistributionWiener_fv_358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_359, AgradDistributionTestFixture, AgradDistributionWiener_fv_359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_360, AgradDistributionTestFixture, AgradDistributionWiener_fv_360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_361, AgradDistributionTestFixture, AgradDistributionWiener_fv_361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_362, AgradDistributionTestFixture, AgradDistributionWiener_fv_362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_363, AgradDistributionTestFixture, AgradDistributionWiener_fv_363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_364, AgradDistributionTestFixture, AgradDistributionWiener_fv_364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_365, AgradDistributionTestFixture, AgradDistributionWiener_fv_365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_366, AgradDistributionTestFixture, AgradDistributionWiener_fv_366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_367, AgradDistributionTestFixture, AgradDistributionWiener_fv_367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_368, AgradDistributionTestFixture, AgradDistributionWiener_fv_368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_369, AgradDistributionTestFixture, AgradDistributionWiener_fv_369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_370, AgradDistributionTestFixture, AgradDistributionWiener_fv_370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_371, AgradDistributionTestFixture, AgradDistributionWiener_fv_371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_372, AgradDistributionTestFixture, AgradDistributionWiener_fv_372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_373, AgradDistributionTestFixture, AgradDistributionWiener_fv_373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_374, AgradDistributionTestFixture, AgradDistributionWiener_fv_374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_375, AgradDistributionTestFixture, AgradDistributionWiener_fv_375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_376, AgradDistributionTestFixture, AgradDistributionWiener_fv_376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_377, AgradDistributionTestFixture, AgradDistributionWiener_fv_377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_378, AgradDistributionTestFixture, AgradDistributionWiener_fv_378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_379, AgradDistributionTestFixture, AgradDistributionWiener_fv_379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_380, AgradDistributionTestFixture, AgradDistributionWiener_fv_380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_381, AgradDistributionTestFixture, AgradDistributionWiener_fv_381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_382, AgradDistributionTestFixture, AgradDistributionWiener_fv_382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_383, AgradDistributionTestFixture, AgradDistributionWiener_fv_383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_384, AgradDistributionTestFixture, AgradDistributionWiener_fv_384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_385, AgradDistributionTestFixture, AgradDistributionWiener_fv_385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_386, AgradDistributionTestFixture, AgradDistributionWiener_fv_386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_387, AgradDistributionTestFixture, AgradDistributionWiener_fv_387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_388, AgradDistributionTestFixture, AgradDistributionWiener_fv_388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_389, AgradDistributionTestFixture, AgradDistributionWiener_fv_389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_390, AgradDistributionTestFixture, AgradDistributionWiener_fv_390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_391, AgradDistributionTestFixture, AgradDistributionWiener_fv_391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_392, AgradDistributionTestFixture, AgradDistributionWiener_fv_392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_393, AgradDistributionTestFixture, AgradDistributionWiener_fv_393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_394, AgradDistributionTestFixture, AgradDistributionWiener_fv_394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_395, AgradDistributionTestFixture, AgradDistributionWiener_fv_395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_396, AgradDistributionTestFixture, AgradDistributionWiener_fv_396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_397, AgradDistributionTestFixture, AgradDistributionWiener_fv_397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_398, AgradDistributionTestFixture, AgradDistributionWiener_fv_398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_399, AgradDistributionTestFixture, AgradDistributionWiener_fv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_300;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_301;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_302;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_303;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_304;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_305;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_306;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_307;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_308;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_309;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_310;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_311;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_312;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_313;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_314;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_315;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_316;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_317;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_318;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_319;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_320;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_321;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_322;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_323;
+typedef boost::mpl::vector<double, std::vector<double>, var, double, double, empty> type_v_324;
+typedef boost::mpl::vector<double, std::vector<double>, var, double, std::vector<double>, empty> type_v_325;
+typedef boost::mpl::vector<double, std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_326;
+typedef boost::mpl::vector<double, std::vector<double>, var, double, var, empty> type_v_327;
+typedef boost::mpl::vector<double, std::vector<double>, var, double, std::vector<var>, empty> type_v_328;
+typedef boost::mpl::vector<double, std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_329;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<double>, double, empty> type_v_330;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<double>, std::vector<double>, empty> type_v_331;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_332;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<double>, var, empty> type_v_333;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<double>, std::vector<var>, empty> type_v_334;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_335;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_336;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_337;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_338;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_339;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_340;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_341;
+typedef boost::mpl::vector<double, std::vector<double>, var, var, double, empty> type_v_342;
+typedef boost::mpl::vector<double, std::vector<double>, var, var, std::vector<double>, empty> type_v_343;
+typedef boost::mpl::vector<double, std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_344;
+typedef boost::mpl::vector<double, std::vector<double>, var, var, var, empty> type_v_345;
+typedef boost::mpl::vector<double, std::vector<double>, var, var, std::vector<var>, empty> type_v_346;
+typedef boost::mpl::vector<double, std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_347;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<var>, double, empty> type_v_348;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<var>, std::vector<double>, empty> type_v_349;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_350;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<var>, var, empty> type_v_351;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<var>, std::vector<var>, empty> type_v_352;
+typedef boost::mpl::vector<double, std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_353;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_354;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_355;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_356;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_357;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_358;
+typedef boost::mpl::vector<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_359;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, double, double, empty> type_v_360;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, double, std::vector<double>, empty> type_v_361;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_362;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, double, var, empty> type_v_363;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, double, std::vector<var>, empty> type_v_364;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_365;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<double>, double, empty> type_v_366;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_367;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_368;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<double>, var, empty> type_v_369;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_370;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_371;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_372;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_373;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_374;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_375;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_376;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_377;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, var, double, empty> type_v_378;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, var, std::vector<double>, empty> type_v_379;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_380;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, var, var, empty> type_v_381;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, var, std::vector<var>, empty> type_v_382;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_383;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<var>, double, empty> type_v_384;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_385;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_386;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<var>, var, empty> type_v_387;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_388;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_389;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_390;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_391;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_392;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_393;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_394;
+typedef boost::mpl::vector<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_395;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_396;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_397;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_398;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_300> AgradDistributionWiener_v_300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_301> AgradDistributionWiener_v_301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_302> AgradDistributionWiener_v_302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_303> AgradDistributionWiener_v_303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_304> AgradDistributionWiener_v_304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_305> AgradDistributionWiener_v_305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_306> AgradDistributionWiener_v_306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_307> AgradDistributionWiener_v_307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_308> AgradDistributionWiener_v_308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_309> AgradDistributionWiener_v_309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_310> AgradDistributionWiener_v_310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_311> AgradDistributionWiener_v_311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_312> AgradDistributionWiener_v_312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_313> AgradDistributionWiener_v_313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_314> AgradDistributionWiener_v_314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_315> AgradDistributionWiener_v_315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_316> AgradDistributionWiener_v_316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_317> AgradDistributionWiener_v_317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_318> AgradDistributionWiener_v_318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_319> AgradDistributionWiener_v_319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_320> AgradDistributionWiener_v_320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_321> AgradDistributionWiener_v_321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_322> AgradDistributionWiener_v_322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_323> AgradDistributionWiener_v_323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_324> AgradDistributionWiener_v_324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_325> AgradDistributionWiener_v_325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_326> AgradDistributionWiener_v_326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_327> AgradDistributionWiener_v_327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_328> AgradDistributionWiener_v_328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_329> AgradDistributionWiener_v_329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_330> AgradDistributionWiener_v_330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_331> AgradDistributionWiener_v_331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_332> AgradDistributionWiener_v_332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_333> AgradDistributionWiener_v_333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_334> AgradDistributionWiener_v_334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_335> AgradDistributionWiener_v_335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_336> AgradDistributionWiener_v_336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_337> AgradDistributionWiener_v_337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_338> AgradDistributionWiener_v_338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_339> AgradDistributionWiener_v_339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_340> AgradDistributionWiener_v_340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_341> AgradDistributionWiener_v_341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_342> AgradDistributionWiener_v_342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_343> AgradDistributionWiener_v_343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_344> AgradDistributionWiener_v_344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_345> AgradDistributionWiener_v_345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_346> AgradDistributionWiener_v_346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_347> AgradDistributionWiener_v_347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_348> AgradDistributionWiener_v_348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_349> AgradDistributionWiener_v_349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_350> AgradDistributionWiener_v_350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_351> AgradDistributionWiener_v_351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_352> AgradDistributionWiener_v_352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_353> AgradDistributionWiener_v_353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_354> AgradDistributionWiener_v_354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_355> AgradDistributionWiener_v_355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_356> AgradDistributionWiener_v_356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_357> AgradDistributionWiener_v_357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_358> AgradDistributionWiener_v_358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_359> AgradDistributionWiener_v_359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_360> AgradDistributionWiener_v_360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_361> AgradDistributionWiener_v_361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_362> AgradDistributionWiener_v_362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_363> AgradDistributionWiener_v_363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_364> AgradDistributionWiener_v_364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_365> AgradDistributionWiener_v_365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_366> AgradDistributionWiener_v_366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_367> AgradDistributionWiener_v_367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_368> AgradDistributionWiener_v_368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_369> AgradDistributionWiener_v_369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_370> AgradDistributionWiener_v_370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_371> AgradDistributionWiener_v_371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_372> AgradDistributionWiener_v_372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_373> AgradDistributionWiener_v_373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_374> AgradDistributionWiener_v_374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_375> AgradDistributionWiener_v_375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_376> AgradDistributionWiener_v_376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_377> AgradDistributionWiener_v_377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_378> AgradDistributionWiener_v_378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_379> AgradDistributionWiener_v_379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_380> AgradDistributionWiener_v_380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_381> AgradDistributionWiener_v_381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_382> AgradDistributionWiener_v_382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_383> AgradDistributionWiener_v_383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_384> AgradDistributionWiener_v_384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_385> AgradDistributionWiener_v_385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_386> AgradDistributionWiener_v_386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_387> AgradDistributionWiener_v_387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_388> AgradDistributionWiener_v_388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_389> AgradDistributionWiener_v_389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_390> AgradDistributionWiener_v_390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_391> AgradDistributionWiener_v_391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_392> AgradDistributionWiener_v_392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_393> AgradDistributionWiener_v_393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_394> AgradDistributionWiener_v_394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_395> AgradDistributionWiener_v_395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_396> AgradDistributionWiener_v_396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_397> AgradDistributionWiener_v_397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_398> AgradDistributionWiener_v_398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_399> AgradDistributionWiener_v_399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_300, AgradDistributionTestFixture, AgradDistributionWiener_v_300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_301, AgradDistributionTestFixture, AgradDistributionWiener_v_301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_302, AgradDistributionTestFixture, AgradDistributionWiener_v_302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_303, AgradDistributionTestFixture, AgradDistributionWiener_v_303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_304, AgradDistributionTestFixture, AgradDistributionWiener_v_304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_305, AgradDistributionTestFixture, AgradDistributionWiener_v_305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_306, AgradDistributionTestFixture, AgradDistributionWiener_v_306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_307, AgradDistributionTestFixture, AgradDistributionWiener_v_307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_308, AgradDistributionTestFixture, AgradDistributionWiener_v_308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_309, AgradDistributionTestFixture, AgradDistributionWiener_v_309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_310, AgradDistributionTestFixture, AgradDistributionWiener_v_310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_311, AgradDistributionTestFixture, AgradDistributionWiener_v_311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_312, AgradDistributionTestFixture, AgradDistributionWiener_v_312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_313, AgradDistributionTestFixture, AgradDistributionWiener_v_313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_314, AgradDistributionTestFixture, AgradDistributionWiener_v_314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_315, AgradDistributionTestFixture, AgradDistributionWiener_v_315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_316, AgradDistributionTestFixture, AgradDistributionWiener_v_316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_317, AgradDistributionTestFixture, AgradDistributionWiener_v_317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_318, AgradDistributionTestFixture, AgradDistributionWiener_v_318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_319, AgradDistributionTestFixture, AgradDistributionWiener_v_319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_320, AgradDistributionTestFixture, AgradDistributionWiener_v_320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_321, AgradDistributionTestFixture, AgradDistributionWiener_v_321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_322, AgradDistributionTestFixture, AgradDistributionWiener_v_322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_323, AgradDistributionTestFixture, AgradDistributionWiener_v_323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_324, AgradDistributionTestFixture, AgradDistributionWiener_v_324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_325, AgradDistributionTestFixture, AgradDistributionWiener_v_325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_326, AgradDistributionTestFixture, AgradDistributionWiener_v_326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_327, AgradDistributionTestFixture, AgradDistributionWiener_v_327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_328, AgradDistributionTestFixture, AgradDistributionWiener_v_328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_329, AgradDistributionTestFixture, AgradDistributionWiener_v_329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_330, AgradDistributionTestFixture, AgradDistributionWiener_v_330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_331, AgradDistributionTestFixture, AgradDistributionWiener_v_331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_332, AgradDistributionTestFixture, AgradDistributionWiener_v_332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_333, AgradDistributionTestFixture, AgradDistributionWiener_v_333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_334, AgradDistributionTestFixture, AgradDistributionWiener_v_334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_335, AgradDistributionTestFixture, AgradDistributionWiener_v_335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_336, AgradDistributionTestFixture, AgradDistributionWiener_v_336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_337, AgradDistributionTestFixture, AgradDistributionWiener_v_337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_338, AgradDistributionTestFixture, AgradDistributionWiener_v_338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_339, AgradDistributionTestFixture, AgradDistributionWiener_v_339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_340, AgradDistributionTestFixture, AgradDistributionWiener_v_340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_341, AgradDistributionTestFixture, AgradDistributionWiener_v_341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_342, AgradDistributionTestFixture, AgradDistributionWiener_v_342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_343, AgradDistributionTestFixture, AgradDistributionWiener_v_343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_344, AgradDistributionTestFixture, AgradDistributionWiener_v_344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_345, AgradDistributionTestFixture, AgradDistributionWiener_v_345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_346, AgradDistributionTestFixture, AgradDistributionWiener_v_346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_347, AgradDistributionTestFixture, AgradDistributionWiener_v_347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_348, AgradDistributionTestFixture, AgradDistributionWiener_v_348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_349, AgradDistributionTestFixture, AgradDistributionWiener_v_349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_350, AgradDistributionTestFixture, AgradDistributionWiener_v_350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_351, AgradDistributionTestFixture, AgradDistributionWiener_v_351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_352, AgradDistributionTestFixture, AgradDistributionWiener_v_352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_353, AgradDistributionTestFixture, AgradDistributionWiener_v_353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_354, AgradDistributionTestFixture, AgradDistributionWiener_v_354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_355, AgradDistributionTestFixture, AgradDistributionWiener_v_355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_356, AgradDistributionTestFixture, AgradDistributionWiener_v_356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_357, AgradDistributionTestFixture, AgradDistributionWiener_v_357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_358, AgradDistributionTestFixture, AgradDistributionWiener_v_358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_359, AgradDistributionTestFixture, AgradDistributionWiener_v_359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_360, AgradDistributionTestFixture, AgradDistributionWiener_v_360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_361, AgradDistributionTestFixture, AgradDistributionWiener_v_361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_362, AgradDistributionTestFixture, AgradDistributionWiener_v_362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_363, AgradDistributionTestFixture, AgradDistributionWiener_v_363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_364, AgradDistributionTestFixture, AgradDistributionWiener_v_364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_365, AgradDistributionTestFixture, AgradDistributionWiener_v_365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_366, AgradDistributionTestFixture, AgradDistributionWiener_v_366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_367, AgradDistributionTestFixture, AgradDistributionWiener_v_367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_368, AgradDistributionTestFixture, AgradDistributionWiener_v_368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_369, AgradDistributionTestFixture, AgradDistributionWiener_v_369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_370, AgradDistributionTestFixture, AgradDistributionWiener_v_370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_371, AgradDistributionTestFixture, AgradDistributionWiener_v_371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_372, AgradDistributionTestFixture, AgradDistributionWiener_v_372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_373, AgradDistributionTestFixture, AgradDistributionWiener_v_373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_374, AgradDistributionTestFixture, AgradDistributionWiener_v_374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_375, AgradDistributionTestFixture, AgradDistributionWiener_v_375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_376, AgradDistributionTestFixture, AgradDistributionWiener_v_376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_377, AgradDistributionTestFixture, AgradDistributionWiener_v_377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_378, AgradDistributionTestFixture, AgradDistributionWiener_v_378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_379, AgradDistributionTestFixture, AgradDistributionWiener_v_379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_380, AgradDistributionTestFixture, AgradDistributionWiener_v_380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_381, AgradDistributionTestFixture, AgradDistributionWiener_v_381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_382, AgradDistributionTestFixture, AgradDistributionWiener_v_382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_383, AgradDistributionTestFixture, AgradDistributionWiener_v_383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_384, AgradDistributionTestFixture, AgradDistributionWiener_v_384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_385, AgradDistributionTestFixture, AgradDistributionWiener_v_385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_386, AgradDistributionTestFixture, AgradDistributionWiener_v_386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_387, AgradDistributionTestFixture, AgradDistributionWiener_v_387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_388, AgradDistributionTestFixture, AgradDistributionWiener_v_388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_389, AgradDistributionTestFixture, AgradDistributionWiener_v_389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_390, AgradDistributionTestFixture, AgradDistributionWiener_v_390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_391, AgradDistributionTestFixture, AgradDistributionWiener_v_391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_392, AgradDistributionTestFixture, AgradDistributionWiener_v_392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_393, AgradDistributionTestFixture, AgradDistributionWiener_v_393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_394, AgradDistributionTestFixture, AgradDistributionWiener_v_394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_395, AgradDistributionTestFixture, AgradDistributionWiener_v_395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_396, AgradDistributionTestFixture, AgradDistributionWiener_v_396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_397, AgradDistributionTestFixture, AgradDistributionWiener_v_397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_398, AgradDistributionTestFixture, AgradDistributionWiener_v_398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_399, AgradDistributionTestFixture, AgradDistributionWiener_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_400;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_401;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_402;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_403;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_404;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, empty> type_fd_405;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_406;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_407;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_408;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_409;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_410;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_411;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_412;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_413;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, double, empty> type_fd_414;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_415;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_416;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_417;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_418;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_419;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_420;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_421;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_422;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_423;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_424;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_425;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_426;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_427;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_428;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_429;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_430;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_431;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_432;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_433;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_434;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_435;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_436;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_437;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_438;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_439;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_440;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_441;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_442;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_443;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_444;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_445;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_446;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_447;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_448;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_449;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_450;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_451;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_452;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_453;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_454;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_455;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_456;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_457;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_458;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, double, empty> type_fd_459;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, std::vector<double>, empty> type_fd_460;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_461;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, fvar<double>, empty> type_fd_462;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_463;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_464;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, double, empty> type_fd_465;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_466;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_467;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_468;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_469;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_470;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_471;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_472;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_473;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_474;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_475;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_476;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, double, empty> type_fd_477;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_478;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_479;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_480;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_481;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_482;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_483;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_484;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_485;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_486;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_487;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_488;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_489;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_490;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_491;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_492;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_493;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_494;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, empty> type_fd_495;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_496;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_497;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_498;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_400> AgradDistributionWiener_fd_400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_401> AgradDistributionWiener_fd_401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_402> AgradDistributionWiener_fd_402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_403> AgradDistributionWiener_fd_403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_404> AgradDistributionWiener_fd_404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_405> AgradDistributionWiener_fd_405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_406> AgradDistributionWiener_fd_406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_407> AgradDistributionWiener_fd_407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_408> AgradDistributionWiener_fd_408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_409> AgradDistributionWiener_fd_409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_410> AgradDistributionWiener_fd_410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_411> AgradDistributionWiener_fd_411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_412> AgradDistributionWiener_fd_412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_413> AgradDistributionWiener_fd_413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_414> AgradDistributionWiener_fd_414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_415> AgradDistributionWiener_fd_415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_416> AgradDistributionWiener_fd_416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_417> AgradDistributionWiener_fd_417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_418> AgradDistributionWiener_fd_418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_419> AgradDistributionWiener_fd_419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_420> AgradDistributionWiener_fd_420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_421> AgradDistributionWiener_fd_421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_422> AgradDistributionWiener_fd_422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_423> AgradDistributionWiener_fd_423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_424> AgradDistributionWiener_fd_424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_425> AgradDistributionWiener_fd_425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_426> AgradDistributionWiener_fd_426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_427> AgradDistributionWiener_fd_427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_428> AgradDistributionWiener_fd_428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_429> AgradDistributionWiener_fd_429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_430> AgradDistributionWiener_fd_430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_431> AgradDistributionWiener_fd_431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_432> AgradDistributionWiener_fd_432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_433> AgradDistributionWiener_fd_433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_434> AgradDistributionWiener_fd_434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_435> AgradDistributionWiener_fd_435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_436> AgradDistributionWiener_fd_436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_437> AgradDistributionWiener_fd_437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_438> AgradDistributionWiener_fd_438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_439> AgradDistributionWiener_fd_439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_440> AgradDistributionWiener_fd_440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_441> AgradDistributionWiener_fd_441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_442> AgradDistributionWiener_fd_442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_443> AgradDistributionWiener_fd_443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_444> AgradDistributionWiener_fd_444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_445> AgradDistributionWiener_fd_445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_446> AgradDistributionWiener_fd_446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_447> AgradDistributionWiener_fd_447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_448> AgradDistributionWiener_fd_448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_449> AgradDistributionWiener_fd_449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_450> AgradDistributionWiener_fd_450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_451> AgradDistributionWiener_fd_451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_452> AgradDistributionWiener_fd_452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_453> AgradDistributionWiener_fd_453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_454> AgradDistributionWiener_fd_454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_455> AgradDistributionWiener_fd_455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_456> AgradDistributionWiener_fd_456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_457> AgradDistributionWiener_fd_457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_458> AgradDistributionWiener_fd_458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_459> AgradDistributionWiener_fd_459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_460> AgradDistributionWiener_fd_460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_461> AgradDistributionWiener_fd_461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_462> AgradDistributionWiener_fd_462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_463> AgradDistributionWiener_fd_463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_464> AgradDistributionWiener_fd_464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_465> AgradDistributionWiener_fd_465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_466> AgradDistributionWiener_fd_466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_467> AgradDistributionWiener_fd_467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_468> AgradDistributionWiener_fd_468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_469> AgradDistributionWiener_fd_469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_470> AgradDistributionWiener_fd_470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_471> AgradDistributionWiener_fd_471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_472> AgradDistributionWiener_fd_472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_473> AgradDistributionWiener_fd_473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_474> AgradDistributionWiener_fd_474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_475> AgradDistributionWiener_fd_475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_476> AgradDistributionWiener_fd_476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_477> AgradDistributionWiener_fd_477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_478> AgradDistributionWiener_fd_478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_479> AgradDistributionWiener_fd_479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_480> AgradDistributionWiener_fd_480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_481> AgradDistributionWiener_fd_481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_482> AgradDistributionWiener_fd_482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_483> AgradDistributionWiener_fd_483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_484> AgradDistributionWiener_fd_484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_485> AgradDistributionWiener_fd_485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_486> AgradDistributionWiener_fd_486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_487> AgradDistributionWiener_fd_487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_488> AgradDistributionWiener_fd_488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_489> AgradDistributionWiener_fd_489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_490> AgradDistributionWiener_fd_490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_491> AgradDistributionWiener_fd_491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_492> AgradDistributionWiener_fd_492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_493> AgradDistributionWiener_fd_493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_494> AgradDistributionWiener_fd_494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_495> AgradDistributionWiener_fd_495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_496> AgradDistributionWiener_fd_496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_497> AgradDistributionWiener_fd_497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_498> AgradDistributionWiener_fd_498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_499> AgradDistributionWiener_fd_499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_400, AgradDistributionTestFixture, AgradDistributionWiener_fd_400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_401, AgradDistributionTestFixture, AgradDistributionWiener_fd_401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_402, AgradDistributionTestFixture, AgradDistributionWiener_fd_402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_403, AgradDistributionTestFixture, AgradDistributionWiener_fd_403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_404, AgradDistributionTestFixture, AgradDistributionWiener_fd_404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_405, AgradDistributionTestFixture, AgradDistributionWiener_fd_405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_406, AgradDistributionTestFixture, AgradDistributionWiener_fd_406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_407, AgradDistributionTestFixture, AgradDistributionWiener_fd_407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_408, AgradDistributionTestFixture, AgradDistributionWiener_fd_408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_409, AgradDistributionTestFixture, AgradDistributionWiener_fd_409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_410, AgradDistributionTestFixture, AgradDistributionWiener_fd_410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_411, AgradDistributionTestFixture, AgradDistributionWiener_fd_411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_412, AgradDistributionTestFixture, AgradDistributionWiener_fd_412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_413, AgradDistributionTestFixture, AgradDistributionWiener_fd_413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_414, AgradDistributionTestFixture, AgradDistributionWiener_fd_414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_415, AgradDistributionTestFixture, AgradDistributionWiener_fd_415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_416, AgradDistributionTestFixture, AgradDistributionWiener_fd_416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_417, AgradDistributionTestFixture, AgradDistributionWiener_fd_417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_418, AgradDistributionTestFixture, AgradDistributionWiener_fd_418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_419, AgradDistributionTestFixture, AgradDistributionWiener_fd_419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_420, AgradDistributionTestFixture, AgradDistributionWiener_fd_420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_421, AgradDistributionTestFixture, AgradDistributionWiener_fd_421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_422, AgradDistributionTestFixture, AgradDistributionWiener_fd_422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_423, AgradDistributionTestFixture, AgradDistributionWiener_fd_423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_424, AgradDistributionTestFixture, AgradDistributionWiener_fd_424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_425, AgradDistributionTestFixture, AgradDistributionWiener_fd_425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_426, AgradDistributionTestFixture, AgradDistributionWiener_fd_426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_427, AgradDistributionTestFixture, AgradDistributionWiener_fd_427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_428, AgradDistributionTestFixture, AgradDistributionWiener_fd_428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_429, AgradDistributionTestFixture, AgradDistributionWiener_fd_429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_430, AgradDistributionTestFixture, AgradDistributionWiener_fd_430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_431, AgradDistributionTestFixture, AgradDistributionWiener_fd_431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_432, AgradDistributionTestFixture, AgradDistributionWiener_fd_432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_433, AgradDistributionTestFixture, AgradDistributionWiener_fd_433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_434, AgradDistributionTestFixture, AgradDistributionWiener_fd_434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_435, AgradDistributionTestFixture, AgradDistributionWiener_fd_435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_436, AgradDistributionTestFixture, AgradDistributionWiener_fd_436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_437, AgradDistributionTestFixture, AgradDistributionWiener_fd_437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_438, AgradDistributionTestFixture, AgradDistributionWiener_fd_438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_439, AgradDistributionTestFixture, AgradDistributionWiener_fd_439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_440, AgradDistributionTestFixture, AgradDistributionWiener_fd_440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_441, AgradDistributionTestFixture, AgradDistributionWiener_fd_441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_442, AgradDistributionTestFixture, AgradDistributionWiener_fd_442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_443, AgradDistributionTestFixture, AgradDistributionWiener_fd_443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_444, AgradDistributionTestFixture, AgradDistributionWiener_fd_444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_445, AgradDistributionTestFixture, AgradDistributionWiener_fd_445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_446, AgradDistributionTestFixture, AgradDistributionWiener_fd_446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_447, AgradDistributionTestFixture, AgradDistributionWiener_fd_447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_448, AgradDistributionTestFixture, AgradDistributionWiener_fd_448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_449, AgradDistributionTestFixture, AgradDistributionWiener_fd_449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_450, AgradDistributionTestFixture, AgradDistributionWiener_fd_450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_451, AgradDistributionTestFixture, AgradDistributionWiener_fd_451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_452, AgradDistributionTestFixture, AgradDistributionWiener_fd_452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_453, AgradDistributionTestFixture, AgradDistributionWiener_fd_453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_454, AgradDistributionTestFixture, AgradDistributionWiener_fd_454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_455, AgradDistributionTestFixture, AgradDistributionWiener_fd_455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_456, AgradDistributionTestFixture, AgradDistributionWiener_fd_456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_457, AgradDistributionTestFixture, AgradDistributionWiener_fd_457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_458, AgradDistributionTestFixture, AgradDistributionWiener_fd_458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_459, AgradDistributionTestFixture, AgradDistributionWiener_fd_459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_460, AgradDistributionTestFixture, AgradDistributionWiener_fd_460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_461, AgradDistributionTestFixture, AgradDistributionWiener_fd_461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_462, AgradDistributionTestFixture, AgradDistributionWiener_fd_462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_463, AgradDistributionTestFixture, AgradDistributionWiener_fd_463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_464, AgradDistributionTestFixture, AgradDistributionWiener_fd_464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_465, AgradDistributionTestFixture, AgradDistributionWiener_fd_465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_466, AgradDistributionTestFixture, AgradDistributionWiener_fd_466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_467, AgradDistributionTestFixture, AgradDistributionWiener_fd_467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_468, AgradDistributionTestFixture, AgradDistributionWiener_fd_468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_469, AgradDistributionTestFixture, AgradDistributionWiener_fd_469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_470, AgradDistributionTestFixture, AgradDistributionWiener_fd_470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_471, AgradDistributionTestFixture, AgradDistributionWiener_fd_471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_472, AgradDistributionTestFixture, AgradDistributionWiener_fd_472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_473, AgradDistributionTestFixture, AgradDistributionWiener_fd_473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_474, AgradDistributionTestFixture, AgradDistributionWiener_fd_474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_475, AgradDistributionTestFixture, AgradDistributionWiener_fd_475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_476, AgradDistributionTestFixture, AgradDistributionWiener_fd_476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_477, AgradDistributionTestFixture, AgradDistributionWiener_fd_477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_478, AgradDistributionTestFixture, AgradDistributionWiener_fd_478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_479, AgradDistributionTestFixture, AgradDistributionWiener_fd_479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_480, AgradDistributionTestFixture, AgradDistributionWiener_fd_480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_481, AgradDistributionTestFixture, AgradDistributionWiener_fd_481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_482, AgradDistributionTestFixture, AgradDistributionWiener_fd_482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_483, AgradDistributionTestFixture, AgradDistributionWiener_fd_483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_484, AgradDistributionTestFixture, AgradDistributionWiener_fd_484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_485, AgradDistributionTestFixture, AgradDistributionWiener_fd_485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_486, AgradDistributionTestFixture, AgradDistributionWiener_fd_486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_487, AgradDistributionTestFixture, AgradDistributionWiener_fd_487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_488, AgradDistributionTestFixture, AgradDistributionWiener_fd_488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_489, AgradDistributionTestFixture, AgradDistributionWiener_fd_489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_490, AgradDistributionTestFixture, AgradDistributionWiener_fd_490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_491, AgradDistributionTestFixture, AgradDistributionWiener_fd_491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_492, AgradDistributionTestFixture, AgradDistributionWiener_fd_492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_493, AgradDistributionTestFixture, AgradDistributionWiener_fd_493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_494, AgradDistributionTestFixture, AgradDistributionWiener_fd_494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_495, AgradDistributionTestFixture, AgradDistributionWiener_fd_495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_496, AgradDistributionTestFixture, AgradDistributionWiener_fd_496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_497, AgradDistributionTestFixture, AgradDistributionWiener_fd_497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_498, AgradDistributionTestFixture, AgradDistributionWiener_fd_498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_499, AgradDistributionTestFixture, AgradDistributionWiener_fd_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_400;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_401;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_402;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_403;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_404;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_405;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_406;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_407;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_408;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_409;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_410;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_411;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_412;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_413;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_414;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_415;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_416;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_417;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_418;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_419;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_420;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_421;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_422;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_423;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_424;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_425;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_426;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_427;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_428;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_429;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_430;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_431;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_432;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_433;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_434;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_435;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_436;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_437;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_438;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_439;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_440;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_441;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_442;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_443;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_444;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_445;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_446;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_447;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_448;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_449;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_450;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_451;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_452;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_453;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_454;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_455;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_456;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_457;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_458;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, double, empty> type_ffd_459;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_460;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_461;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_462;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_463;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_464;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_465;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_466;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_467;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_468;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_469;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_470;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_471;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_472;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_473;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_474;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_475;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_476;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_477;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_478;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_479;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_480;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_481;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_482;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_483;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_484;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_485;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_486;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_487;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_488;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_489;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_490;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_491;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_492;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_493;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_494;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_495;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_496;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_497;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_498;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_400> AgradDistributionWiener_ffd_400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_401> AgradDistributionWiener_ffd_401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_402> AgradDistributionWiener_ffd_402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_403> AgradDistributionWiener_ffd_403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_404> AgradDistributionWiener_ffd_404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_405> AgradDistributionWiener_ffd_405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_406> AgradDistributionWiener_ffd_406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_407> AgradDistributionWiener_ffd_407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_408> AgradDistributionWiener_ffd_408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_409> AgradDistributionWiener_ffd_409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_410> AgradDistributionWiener_ffd_410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_411> AgradDistributionWiener_ffd_411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_412> AgradDistributionWiener_ffd_412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_413> AgradDistributionWiener_ffd_413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_414> AgradDistributionWiener_ffd_414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_415> AgradDistributionWiener_ffd_415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_416> AgradDistributionWiener_ffd_416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_417> AgradDistributionWiener_ffd_417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_418> AgradDistributionWiener_ffd_418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_419> AgradDistributionWiener_ffd_419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_420> AgradDistributionWiener_ffd_420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_421> AgradDistributionWiener_ffd_421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_422> AgradDistributionWiener_ffd_422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_423> AgradDistributionWiener_ffd_423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_424> AgradDistributionWiener_ffd_424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_425> AgradDistributionWiener_ffd_425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_426> AgradDistributionWiener_ffd_426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_427> AgradDistributionWiener_ffd_427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_428> AgradDistributionWiener_ffd_428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_429> AgradDistributionWiener_ffd_429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_430> AgradDistributionWiener_ffd_430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_431> AgradDistributionWiener_ffd_431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_432> AgradDistributionWiener_ffd_432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_433> AgradDistributionWiener_ffd_433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_434> AgradDistributionWiener_ffd_434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_435> AgradDistributionWiener_ffd_435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_436> AgradDistributionWiener_ffd_436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_437> AgradDistributionWiener_ffd_437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_438> AgradDistributionWiener_ffd_438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_439> AgradDistributionWiener_ffd_439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_440> AgradDistributionWiener_ffd_440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_441> AgradDistributionWiener_ffd_441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_442> AgradDistributionWiener_ffd_442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_443> AgradDistributionWiener_ffd_443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_444> AgradDistributionWiener_ffd_444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_445> AgradDistributionWiener_ffd_445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_446> AgradDistributionWiener_ffd_446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_447> AgradDistributionWiener_ffd_447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_448> AgradDistributionWiener_ffd_448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_449> AgradDistributionWiener_ffd_449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_450> AgradDistributionWiener_ffd_450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_451> AgradDistributionWiener_ffd_451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_452> AgradDistributionWiener_ffd_452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_453> AgradDistributionWiener_ffd_453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_454> AgradDistributionWiener_ffd_454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_455> AgradDistributionWiener_ffd_455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_456> AgradDistributionWiener_ffd_456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_457> AgradDistributionWiener_ffd_457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_458> AgradDistributionWiener_ffd_458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_459> AgradDistributionWiener_ffd_459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_460> AgradDistributionWiener_ffd_460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_461> AgradDistributionWiener_ffd_461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_462> AgradDistributionWiener_ffd_462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_463> AgradDistributionWiener_ffd_463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_464> AgradDistributionWiener_ffd_464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_465> AgradDistributionWiener_ffd_465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_466> AgradDistributionWiener_ffd_466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_467> AgradDistributionWiener_ffd_467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_468> AgradDistributionWiener_ffd_468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_469> AgradDistributionWiener_ffd_469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_470> AgradDistributionWiener_ffd_470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_471> AgradDistributionWiener_ffd_471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_472> AgradDistributionWiener_ffd_472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_473> AgradDistributionWiener_ffd_473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_474> AgradDistributionWiener_ffd_474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_475> AgradDistributionWiener_ffd_475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_476> AgradDistributionWiener_ffd_476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_477> AgradDistributionWiener_ffd_477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_478> AgradDistributionWiener_ffd_478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_479> AgradDistributionWiener_ffd_479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_480> AgradDistributionWiener_ffd_480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_481> AgradDistributionWiener_ffd_481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_482> AgradDistributionWiener_ffd_482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_483> AgradDistributionWiener_ffd_483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_484> AgradDistributionWiener_ffd_484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_485> AgradDistributionWiener_ffd_485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_486> AgradDistributionWiener_ffd_486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_487> AgradDistributionWiener_ffd_487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_488> AgradDistributionWiener_ffd_488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_489> AgradDistributionWiener_ffd_489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_490> AgradDistributionWiener_ffd_490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_491> AgradDistributionWiener_ffd_491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_492> AgradDistributionWiener_ffd_492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_493> AgradDistributionWiener_ffd_493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_494> AgradDistributionWiener_ffd_494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_495> AgradDistributionWiener_ffd_495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_496> AgradDistributionWiener_ffd_496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_497> AgradDistributionWiener_ffd_497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_498> AgradDistributionWiener_ffd_498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_499> AgradDistributionWiener_ffd_499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_400, AgradDistributionTestFixture, AgradDistributionWiener_ffd_400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_401, AgradDistributionTestFixture, AgradDistributionWiener_ffd_401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_402, AgradDistributionTestFixture, AgradDistributionWiener_ffd_402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_403, AgradDistributionTestFixture, AgradDistributionWiener_ffd_403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_404, AgradDistributionTestFixture, AgradDistributionWiener_ffd_404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_405, AgradDistributionTestFixture, AgradDistributionWiener_ffd_405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_406, AgradDistributionTestFixture, AgradDistributionWiener_ffd_406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_407, AgradDistributionTestFixture, AgradDistributionWiener_ffd_407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_408, AgradDistributionTestFixture, AgradDistributionWiener_ffd_408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_409, AgradDistributionTestFixture, AgradDistributionWiener_ffd_409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_410, AgradDistributionTestFixture, AgradDistributionWiener_ffd_410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_411, AgradDistributionTestFixture, AgradDistributionWiener_ffd_411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_412, AgradDistributionTestFixture, AgradDistributionWiener_ffd_412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_413, AgradDistributionTestFixture, AgradDistributionWiener_ffd_413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_414, AgradDistributionTestFixture, AgradDistributionWiener_ffd_414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_415, AgradDistributionTestFixture, AgradDistributionWiener_ffd_415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_416, AgradDistributionTestFixture, AgradDistributionWiener_ffd_416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_417, AgradDistributionTestFixture, AgradDistributionWiener_ffd_417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_418, AgradDistributionTestFixture, AgradDistributionWiener_ffd_418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_419, AgradDistributionTestFixture, AgradDistributionWiener_ffd_419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_420, AgradDistributionTestFixture, AgradDistributionWiener_ffd_420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_421, AgradDistributionTestFixture, AgradDistributionWiener_ffd_421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_422, AgradDistributionTestFixture, AgradDistributionWiener_ffd_422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_423, AgradDistributionTestFixture, AgradDistributionWiener_ffd_423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_424, AgradDistributionTestFixture, AgradDistributionWiener_ffd_424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_425, AgradDistributionTestFixture, AgradDistributionWiener_ffd_425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_426, AgradDistributionTestFixture, AgradDistributionWiener_ffd_426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_427, AgradDistributionTestFixture, AgradDistributionWiener_ffd_427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_428, AgradDistributionTestFixture, AgradDistributionWiener_ffd_428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_429, AgradDistributionTestFixture, AgradDistributionWiener_ffd_429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_430, AgradDistributionTestFixture, AgradDistributionWiener_ffd_430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_431, AgradDistributionTestFixture, AgradDistributionWiener_ffd_431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_432, AgradDistributionTestFixture, AgradDistributionWiener_ffd_432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_433, AgradDistributionTestFixture, AgradDistributionWiener_ffd_433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_434, AgradDistributionTestFixture, AgradDistributionWiener_ffd_434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_435, AgradDistributionTestFixture, AgradDistributionWiener_ffd_435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_436, AgradDistributionTestFixture, AgradDistributionWiener_ffd_436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_437, AgradDistributionTestFixture, AgradDistributionWiener_ffd_437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_438, AgradDistributionTestFixture, AgradDistributionWiener_ffd_438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_439, AgradDistributionTestFixture, AgradDistributionWiener_ffd_439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_440, AgradDistributionTestFixture, AgradDistributionWiener_ffd_440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_441, AgradDistributionTestFixture, AgradDistributionWiener_ffd_441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_442, AgradDistributionTestFixture, AgradDistributionWiener_ffd_442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_443, AgradDistributionTestFixture, AgradDistributionWiener_ffd_443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_444, AgradDistributionTestFixture, AgradDistributionWiener_ffd_444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_445, AgradDistributionTestFixture, AgradDistributionWiener_ffd_445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_446, AgradDistributionTestFixture, AgradDistributionWiener_ffd_446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_447, AgradDistributionTestFixture, AgradDistributionWiener_ffd_447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_448, AgradDistributionTestFixture, AgradDistributionWiener_ffd_448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_449, AgradDistributionTestFixture, AgradDistributionWiener_ffd_449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_450, AgradDistributionTestFixture, AgradDistributionWiener_ffd_450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_451, AgradDistributionTestFixture, AgradDistributionWiener_ffd_451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_452, AgradDistributionTestFixture, AgradDistributionWiener_ffd_452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_453, AgradDistributionTestFixture, AgradDistributionWiener_ffd_453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_454, AgradDistributionTestFixture, AgradDistributionWiener_ffd_454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_455, AgradDistributionTestFixture, AgradDistributionWiener_ffd_455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_456, AgradDistributionTestFixture, AgradDistributionWiener_ffd_456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_457, AgradDistributionTestFixture, AgradDistributionWiener_ffd_457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_458, AgradDistributionTestFixture, AgradDistributionWiener_ffd_458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_459, AgradDistributionTestFixture, AgradDistributionWiener_ffd_459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_460, AgradDistributionTestFixture, AgradDistributionWiener_ffd_460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_461, AgradDistributionTestFixture, AgradDistributionWiener_ffd_461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_462, AgradDistributionTestFixture, AgradDistributionWiener_ffd_462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_463, AgradDistributionTestFixture, AgradDistributionWiener_ffd_463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_464, AgradDistributionTestFixture, AgradDistributionWiener_ffd_464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_465, AgradDistributionTestFixture, AgradDistributionWiener_ffd_465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_466, AgradDistributionTestFixture, AgradDistributionWiener_ffd_466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_467, AgradDistributionTestFixture, AgradDistributionWiener_ffd_467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_468, AgradDistributionTestFixture, AgradDistributionWiener_ffd_468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_469, AgradDistributionTestFixture, AgradDistributionWiener_ffd_469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_470, AgradDistributionTestFixture, AgradDistributionWiener_ffd_470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_471, AgradDistributionTestFixture, AgradDistributionWiener_ffd_471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_472, AgradDistributionTestFixture, AgradDistributionWiener_ffd_472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_473, AgradDistributionTestFixture, AgradDistributionWiener_ffd_473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_474, AgradDistributionTestFixture, AgradDistributionWiener_ffd_474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_475, AgradDistributionTestFixture, AgradDistributionWiener_ffd_475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_476, AgradDistributionTestFixture, AgradDistributionWiener_ffd_476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_477, AgradDistributionTestFixture, AgradDistributionWiener_ffd_477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_478, AgradDistributionTestFixture, AgradDistributionWiener_ffd_478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_479, AgradDistributionTestFixture, AgradDistributionWiener_ffd_479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_480, AgradDistributionTestFixture, AgradDistributionWiener_ffd_480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_481, AgradDistributionTestFixture, AgradDistributionWiener_ffd_481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_482, AgradDistributionTestFixture, AgradDistributionWiener_ffd_482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_483, AgradDistributionTestFixture, AgradDistributionWiener_ffd_483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_484, AgradDistributionTestFixture, AgradDistributionWiener_ffd_484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_485, AgradDistributionTestFixture, AgradDistributionWiener_ffd_485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_486, AgradDistributionTestFixture, AgradDistributionWiener_ffd_486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_487, AgradDistributionTestFixture, AgradDistributionWiener_ffd_487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_488, AgradDistributionTestFixture, AgradDistributionWiener_ffd_488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_489, AgradDistributionTestFixture, AgradDistributionWiener_ffd_489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_490, AgradDistributionTestFixture, AgradDistributionWiener_ffd_490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_491, AgradDistributionTestFixture, AgradDistributionWiener_ffd_491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_492, AgradDistributionTestFixture, AgradDistributionWiener_ffd_492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_493, AgradDistributionTestFixture, AgradDistributionWiener_ffd_493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_494, AgradDistributionTestFixture, AgradDistributionWiener_ffd_494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_495, AgradDistributionTestFixture, AgradDistributionWiener_ffd_495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_496, AgradDistributionTestFixture, AgradDistributionWiener_ffd_496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_497, AgradDistributionTestFixture, AgradDistributionWiener_ffd_497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_498, AgradDistributionTestFixture, AgradDistributionWiener_ffd_498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_499, AgradDistributionTestFixture, AgradDistributionWiener_ffd_499);
+
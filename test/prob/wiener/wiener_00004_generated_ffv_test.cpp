@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_400;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_401;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_402;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_403;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_404;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_405;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_406;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_407;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_408;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_409;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_410;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_411;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_412;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_413;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_414;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_415;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_416;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_417;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_418;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_419;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_420;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_421;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_422;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_423;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_424;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_425;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_426;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_427;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_428;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_429;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_430;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_431;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_432;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_433;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_434;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_435;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_436;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_437;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_438;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_439;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_440;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_441;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_442;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_443;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_444;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_445;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_446;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_447;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_448;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_449;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_450;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_451;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_452;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_453;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_454;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_455;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_456;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_457;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_458;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty> type_ffv_459;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_460;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_461;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_462;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_463;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_464;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_465;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_466;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_467;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_468;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_469;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_470;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_471;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_472;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_473;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_474;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_475;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_476;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_477;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_478;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_479;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_480;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_481;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_482;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_483;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_484;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_485;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_486;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_487;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_488;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_489;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_490;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_491;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_492;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_493;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_494;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_495;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_496;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_497;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_498;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_400> AgradDistributionWiener_ffv_400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_401> AgradDistributionWiener_ffv_401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_402> AgradDistributionWiener_ffv_402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_403> AgradDistributionWiener_ffv_403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_404> AgradDistributionWiener_ffv_404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_405> AgradDistributionWiener_ffv_405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_406> AgradDistributionWiener_ffv_406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_407> AgradDistributionWiener_ffv_407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_408> AgradDistributionWiener_ffv_408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_409> AgradDistributionWiener_ffv_409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_410> AgradDistributionWiener_ffv_410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_411> AgradDistributionWiener_ffv_411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_412> AgradDistributionWiener_ffv_412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_413> AgradDistributionWiener_ffv_413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_414> AgradDistributionWiener_ffv_414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_415> AgradDistributionWiener_ffv_415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_416> AgradDistributionWiener_ffv_416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_417> AgradDistributionWiener_ffv_417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_418> AgradDistributionWiener_ffv_418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_419> AgradDistributionWiener_ffv_419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_420> AgradDistributionWiener_ffv_420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_421> AgradDistributionWiener_ffv_421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_422> AgradDistributionWiener_ffv_422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_423> AgradDistributionWiener_ffv_423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_424> AgradDistributionWiener_ffv_424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_425> AgradDistributionWiener_ffv_425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_426> AgradDistributionWiener_ffv_426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_427> AgradDistributionWiener_ffv_427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_428> AgradDistributionWiener_ffv_428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_429> AgradDistributionWiener_ffv_429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_430> AgradDistributionWiener_ffv_430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_431> AgradDistributionWiener_ffv_431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_432> AgradDistributionWiener_ffv_432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_433> AgradDistributionWiener_ffv_433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_434> AgradDistributionWiener_ffv_434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_435> AgradDistributionWiener_ffv_435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_436> AgradDistributionWiener_ffv_436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_437> AgradDistributionWiener_ffv_437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_438> AgradDistributionWiener_ffv_438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_439> AgradDistributionWiener_ffv_439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_440> AgradDistributionWiener_ffv_440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_441> AgradDistributionWiener_ffv_441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_442> AgradDistributionWiener_ffv_442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_443> AgradDistributionWiener_ffv_443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_444> AgradDistributionWiener_ffv_444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_445> AgradDistributionWiener_ffv_445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_446> AgradDistributionWiener_ffv_446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_447> AgradDistributionWiener_ffv_447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_448> AgradDistributionWiener_ffv_448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_449> AgradDistributionWiener_ffv_449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_450> AgradDistributionWiener_ffv_450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_451> AgradDistributionWiener_ffv_451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_452> AgradDistributionWiener_ffv_452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_453> AgradDistributionWiener_ffv_453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_454> AgradDistributionWiener_ffv_454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_455> AgradDistributionWiener_ffv_455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_456> AgradDistributionWiener_ffv_456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_457> AgradDistributionWiener_ffv_457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_458> AgradDistributionWiener_ffv_458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_459> AgradDistributionWiener_ffv_459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_460> AgradDistributionWiener_ffv_460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_461> AgradDistributionWiener_ffv_461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_462> AgradDistributionWiener_ffv_462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_463> AgradDistributionWiener_ffv_463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_464> AgradDistributionWiener_ffv_464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_465> AgradDistributionWiener_ffv_465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_466> AgradDistributionWiener_ffv_466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_467> AgradDistributionWiener_ffv_467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_468> AgradDistributionWiener_ffv_468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_469> AgradDistributionWiener_ffv_469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_470> AgradDistributionWiener_ffv_470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_471> AgradDistributionWiener_ffv_471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_472> AgradDistributionWiener_ffv_472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_473> AgradDistributionWiener_ffv_473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_474> AgradDistributionWiener_ffv_474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_475> AgradDistributionWiener_ffv_475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_476> AgradDistributionWiener_ffv_476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_477> AgradDistributionWiener_ffv_477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_478> AgradDistributionWiener_ffv_478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_479> AgradDistributionWiener_ffv_479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_480> AgradDistributionWiener_ffv_480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_481> AgradDistributionWiener_ffv_481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_482> AgradDistributionWiener_ffv_482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_483> AgradDistributionWiener_ffv_483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_484> AgradDistributionWiener_ffv_484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_485> AgradDistributionWiener_ffv_485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_486> AgradDistributionWiener_ffv_486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_487> AgradDistributionWiener_ffv_487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_488> AgradDistributionWiener_ffv_488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_489> AgradDistributionWiener_ffv_489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_490> AgradDistributionWiener_ffv_490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_491> AgradDistributionWiener_ffv_491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_492> AgradDistributionWiener_ffv_492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_493> AgradDistributionWiener_ffv_493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_494> AgradDistributionWiener_ffv_494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_495> AgradDistributionWiener_ffv_495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_496> AgradDistributionWiener_ffv_496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_497> AgradDistributionWiener_ffv_497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_498> AgradDistributionWiener_ffv_498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_499> AgradDistributionWiener_ffv_499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_400, AgradDistributionTestFixture, AgradDistributionWiener_ffv_400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_401, AgradDistributionTestFixture, AgradDistributionWiener_ffv_401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_402, AgradDistributionTestFixture, AgradDistributionWiener_ffv_402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_403, AgradDistributionTestFixture, AgradDistributionWiener_ffv_403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_404, AgradDistributionTestFixture, AgradDistributionWiener_ffv_404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_405, AgradDistributionTestFixture, AgradDistributionWiener_ffv_405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_406, AgradDistributionTestFixture, AgradDistributionWiener_ffv_406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_407, AgradDistributionTestFixture, AgradDistributionWiener_ffv_407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_408, AgradDistributionTestFixture, AgradDistributionWiener_ffv_408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_409, AgradDistributionTestFixture, AgradDistributionWiener_ffv_409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_410, AgradDistributionTestFixture, AgradDistributionWiener_ffv_410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_411, AgradDistributionTestFixture, AgradDistributionWiener_ffv_411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_412, AgradDistributionTestFixture, AgradDistributionWiener_ffv_412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_413, AgradDistributionTestFixture, AgradDistributionWiener_ffv_413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_414, AgradDistributionTestFixture, AgradDistributionWiener_ffv_414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_415, AgradDistributionTestFixture, AgradDistributionWiener_ffv_415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_416, AgradDistributionTestFixture, AgradDistributionWiener_ffv_416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_417, AgradDistributionTestFixture, AgradDistributionWiener_ffv_417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_418, AgradDistributionTestFixture, AgradDistributionWiener_ffv_418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_419, AgradDistributionTestFixture, AgradDistributionWiener_ffv_419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_420, AgradDistributionTestFixture, AgradDistributionWiener_ffv_420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_421, AgradDistributionTestFixture, AgradDistributionWiener_ffv_421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_422, AgradDistributionTestFixture, AgradDistributionWiener_ffv_422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_423, AgradDistributionTestFixture, AgradDistributionWiener_ffv_423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_424, AgradDistributionTestFixture, AgradDistributionWiener_ffv_424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_425, AgradDistributionTestFixture, AgradDistributionWiener_ffv_425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_426, AgradDistributionTestFixture, AgradDistributionWiener_ffv_426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_427, AgradDistributionTestFixture, AgradDistributionWiener_ffv_427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_428, AgradDistributionTestFixture, AgradDistributionWiener_ffv_428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_429, AgradDistributionTestFixture, AgradDistributionWiener_ffv_429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_430, AgradDistributionTestFixture, AgradDistributionWiener_ffv_430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_431, AgradDistributionTestFixture, AgradDistributionWiener_ffv_431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_432, AgradDistributionTestFixture, AgradDistributionWiener_ffv_432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_433, AgradDistributionTestFixture, AgradDistributionWiener_ffv_433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_434, AgradDistributionTestFixture, AgradDistributionWiener_ffv_434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_435, AgradDistributionTestFixture, AgradDistributionWiener_ffv_435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_436, AgradDistributionTestFixture, AgradDistributionWiener_ffv_436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_437, AgradDistributionTestFixture, AgradDistributionWiener_ffv_437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_438, AgradDistributionTestFixture, AgradDistributionWiener_ffv_438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_439, AgradDistributionTestFixture, AgradDistributionWiener_ffv_439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_440, AgradDistributionTestFixture, AgradDistributionWiener_ffv_440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_441, AgradDistributionTestFixture, AgradDistributionWiener_ffv_441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_442, AgradDistributionTestFixture, AgradDistributionWiener_ffv_442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_443, AgradDistributionTestFixture, AgradDistributionWiener_ffv_443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_444, AgradDistributionTestFixture, AgradDistributionWiener_ffv_444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_445, AgradDistributionTestFixture, AgradDistributionWiener_ffv_445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_446, AgradDistributionTestFixture, AgradDistributionWiener_ffv_446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_447, AgradDistributionTestFixture, AgradDistributionWiener_ffv_447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_448, AgradDistributionTestFixture, AgradDistributionWiener_ffv_448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_449, AgradDistributionTestFixture, AgradDistributionWiener_ffv_449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_450, AgradDistributionTestFixture, AgradDistributionWiener_ffv_450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_451, AgradDistributionTestFixture, AgradDistributionWiener_ffv_451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_452, AgradDistributionTestFixture, AgradDistributionWiener_ffv_452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_453, AgradDistributionTestFixture, AgradDistributionWiener_ffv_453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_454, AgradDistributionTestFixture, AgradDistributionWiener_ffv_454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_455, AgradDistributionTestFixture, AgradDistributionWiener_ffv_455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_456, AgradDistributionTestFixture, AgradDistributionWiener_ffv_456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_457, AgradDistributionTestFixture, AgradDistributionWiener_ffv_457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_458, AgradDistributionTestFixture, AgradDistributionWiener_ffv_458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_459, AgradDistributionTestFixture, AgradDistributionWiener_ffv_459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_460, AgradDistributionTestFixture, AgradDistributionWiener_ffv_460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_461, AgradDistributionTestFixture, AgradDistributionWiener_ffv_461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_462, AgradDistributionTestFixture, AgradDistributionWiener_ffv_462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_463, AgradDistributionTestFixture, AgradDistributionWiener_ffv_463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_464, AgradDistributionTestFixture, AgradDistributionWiener_ffv_464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_465, AgradDistributionTestFixture, AgradDistributionWiener_ffv_465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_466, AgradDistributionTestFixture, AgradDistributionWiener_ffv_466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_467, AgradDistributionTestFixture, AgradDistributionWiener_ffv_467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_468, AgradDistributionTestFixture, AgradDistributionWiener_ffv_468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_469, AgradDistributionTestFixture, AgradDistributionWiener_ffv_469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_470, AgradDistributionTestFixture, AgradDistributionWiener_ffv_470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_471, AgradDistributionTestFixture, AgradDistributionWiener_ffv_471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_472, AgradDistributionTestFixture, AgradDistributionWiener_ffv_472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_473, AgradDistributionTestFixture, AgradDistributionWiener_ffv_473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_474, AgradDistributionTestFixture, AgradDistributionWiener_ffv_474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_475, AgradDistributionTestFixture, AgradDistributionWiener_ffv_475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_476, AgradDistributionTestFixture, AgradDistributionWiener_ffv_476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_477, AgradDistributionTestFixture, AgradDistributionWiener_ffv_477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_478, AgradDistributionTestFixture, AgradDistributionWiener_ffv_478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_479, AgradDistributionTestFixture, AgradDistributionWiener_ffv_479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_480, AgradDistributionTestFixture, AgradDistributionWiener_ffv_480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_481, AgradDistributionTestFixture, AgradDistributionWiener_ffv_481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_482, AgradDistributionTestFixture, AgradDistributionWiener_ffv_482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_483, AgradDistributionTestFixture, AgradDistributionWiener_ffv_483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_484, AgradDistributionTestFixture, AgradDistributionWiener_ffv_484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_485, AgradDistributionTestFixture, AgradDistributionWiener_ffv_485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_486, AgradDistributionTestFixture, AgradDistributionWiener_ffv_486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_487, AgradDistributionTestFixture, AgradDistributionWiener_ffv_487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_488, AgradDistributionTestFixture, AgradDistributionWiener_ffv_488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_489, AgradDistributionTestFixture, AgradDistributionWiener_ffv_489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_490, AgradDistributionTestFixture, AgradDistributionWiener_ffv_490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_491, AgradDistributionTestFixture, AgradDistributionWiener_ffv_491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_492, AgradDistributionTestFixture, AgradDistributionWiener_ffv_492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_493, AgradDistributionTestFixture, AgradDistributionWiener_ffv_493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_494, AgradDistributionTestFixture, AgradDistributionWiener_ffv_494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_495, AgradDistributionTestFixture, AgradDistributionWiener_ffv_495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_496, AgradDistributionTestFixture, AgradDistributionWiener_ffv_496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_497, AgradDistributionTestFixture, AgradDistributionWiener_ffv_497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_498, AgradDistributionTestFixture, AgradDistributionWiener_ffv_498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_499, AgradDistributionTestFixture, AgradDistributionWiener_ffv_499);
+
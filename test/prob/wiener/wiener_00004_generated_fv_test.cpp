@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_400;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_401;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_402;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_403;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_404;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<var>, empty> type_fv_405;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_406;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_407;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_408;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_409;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_410;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_411;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_412;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_413;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, empty> type_fv_414;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_415;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_416;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_417;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_418;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_419;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_420;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_421;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_422;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_423;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_424;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_425;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_426;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_427;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_428;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_429;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_430;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_431;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_432;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_433;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_434;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_435;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_436;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_437;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_438;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_439;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_440;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_441;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_442;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_443;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_444;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_445;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_446;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_447;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_448;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_449;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_450;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_451;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_452;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_453;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_454;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_455;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_456;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_457;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_458;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, double, empty> type_fv_459;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, empty> type_fv_460;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_461;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, empty> type_fv_462;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_463;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_464;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, empty> type_fv_465;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_466;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_467;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_468;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_469;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_470;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_471;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_472;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_473;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_474;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_475;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_476;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, empty> type_fv_477;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_478;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_479;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_480;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_481;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_482;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_483;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_484;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_485;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_486;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_487;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_488;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_489;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_490;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_491;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_492;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_493;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_494;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, empty> type_fv_495;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_496;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_497;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_498;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_400> AgradDistributionWiener_fv_400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_401> AgradDistributionWiener_fv_401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_402> AgradDistributionWiener_fv_402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_403> AgradDistributionWiener_fv_403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_404> AgradDistributionWiener_fv_404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_405> AgradDistributionWiener_fv_405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_406> AgradDistributionWiener_fv_406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_407> AgradDistributionWiener_fv_407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_408> AgradDistributionWiener_fv_408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_409> AgradDistributionWiener_fv_409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_410> AgradDistributionWiener_fv_410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_411> AgradDistributionWiener_fv_411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_412> AgradDistributionWiener_fv_412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_413> AgradDistributionWiener_fv_413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_414> AgradDistributionWiener_fv_414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_415> AgradDistributionWiener_fv_415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_416> AgradDistributionWiener_fv_416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_417> AgradDistributionWiener_fv_417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_418> AgradDistributionWiener_fv_418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_419> AgradDistributionWiener_fv_419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_420> AgradDistributionWiener_fv_420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_421> AgradDistributionWiener_fv_421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_422> AgradDistributionWiener_fv_422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_423> AgradDistributionWiener_fv_423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_424> AgradDistributionWiener_fv_424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_425> AgradDistributionWiener_fv_425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_426> AgradDistributionWiener_fv_426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_427> AgradDistributionWiener_fv_427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_428> AgradDistributionWiener_fv_428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_429> AgradDistributionWiener_fv_429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_430> AgradDistributionWiener_fv_430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_431> AgradDistributionWiener_fv_431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_432> AgradDistributionWiener_fv_432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_433> AgradDistributionWiener_fv_433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_434> AgradDistributionWiener_fv_434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_435> AgradDistributionWiener_fv_435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_436> AgradDistributionWiener_fv_436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_437> AgradDistributionWiener_fv_437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_438> AgradDistributionWiener_fv_438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_439> AgradDistributionWiener_fv_439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_440> AgradDistributionWiener_fv_440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_441> AgradDistributionWiener_fv_441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_442> AgradDistributionWiener_fv_442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_443> AgradDistributionWiener_fv_443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_444> AgradDistributionWiener_fv_444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_445> AgradDistributionWiener_fv_445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_446> AgradDistributionWiener_fv_446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_447> AgradDistributionWiener_fv_447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_448> AgradDistributionWiener_fv_448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_449> AgradDistributionWiener_fv_449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_450> AgradDistributionWiener_fv_450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_451> AgradDistributionWiener_fv_451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_452> AgradDistributionWiener_fv_452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_453> AgradDistributionWiener_fv_453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_454> AgradDistributionWiener_fv_454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_455> AgradDistributionWiener_fv_455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_456> AgradDistributionWiener_fv_456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_457> AgradDistributionWiener_fv_457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_458> AgradDistributionWiener_fv_458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_459> AgradDistributionWiener_fv_459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_460> AgradDistributionWiener_fv_460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_461> AgradDistributionWiener_fv_461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_462> AgradDistributionWiener_fv_462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_463> AgradDistributionWiener_fv_463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_464> AgradDistributionWiener_fv_464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_465> AgradDistributionWiener_fv_465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_466> AgradDistributionWiener_fv_466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_467> AgradDistributionWiener_fv_467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_468> AgradDistributionWiener_fv_468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_469> AgradDistributionWiener_fv_469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_470> AgradDistributionWiener_fv_470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_471> AgradDistributionWiener_fv_471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_472> AgradDistributionWiener_fv_472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_473> AgradDistributionWiener_fv_473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_474> AgradDistributionWiener_fv_474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_475> AgradDistributionWiener_fv_475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_476> AgradDistributionWiener_fv_476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_477> AgradDistributionWiener_fv_477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_478> AgradDistributionWiener_fv_478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_479> AgradDistributionWiener_fv_479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_480> AgradDistributionWiener_fv_480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_481> AgradDistributionWiener_fv_481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_482> AgradDistributionWiener_fv_482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_483> AgradDistributionWiener_fv_483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_484> AgradDistributionWiener_fv_484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_485> AgradDistributionWiener_fv_485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_486> AgradDistributionWiener_fv_486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_487> AgradDistributionWiener_fv_487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_488> AgradDistributionWiener_fv_488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_489> AgradDistributionWiener_fv_489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_490> AgradDistributionWiener_fv_490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_491> AgradDistributionWiener_fv_491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_492> AgradDistributionWiener_fv_492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_493> AgradDistributionWiener_fv_493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_494> AgradDistributionWiener_fv_494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_495> AgradDistributionWiener_fv_495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_496> AgradDistributionWiener_fv_496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_497> AgradDistributionWiener_fv_497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_498> AgradDistributionWiener_fv_498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_499> AgradDistributionWiener_fv_499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_400, AgradDistributionTestFixture, AgradDistributionWiener_fv_400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_401, AgradDistributionTestFixture, AgradDistributionWiener_fv_401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_402, AgradDistributionTestFixture, AgradDistributionWiener_fv_402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_403, AgradDistributionTestFixture, AgradDistributionWiener_fv_403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_404, AgradDistributionTestFixture, AgradDistributionWiener_fv_404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_405, AgradDistributionTestFixture, AgradDistributionWiener_fv_405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_406, AgradDistributionTestFixture, AgradDistributionWiener_fv_406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_407, AgradDistributionTestFixture, AgradDistributionWiener_fv_407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_408, AgradDistributionTestFixture, AgradDistributionWiener_fv_408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_409, AgradDistributionTestFixture, AgradDistributionWiener_fv_409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_410, AgradDistributionTestFixture, AgradDistributionWiener_fv_410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_411, AgradDistributionTestFixture, AgradDistributionWiener_fv_411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_412, AgradDistributionTestFixture, AgradDistributionWiener_fv_412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_413, AgradDistributionTestFixture, AgradDistributionWiener_fv_413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_414, AgradDistributionTestFixture, AgradDistributionWiener_fv_414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_415, AgradDistributionTestFixture, AgradDistributionWiener_fv_415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_416, AgradDistributionTestFixture, AgradDistributionWiener_fv_416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_417, AgradDistributionTestFixture, AgradDistributionWiener_fv_417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_418, AgradDistributionTestFixture, AgradDistributionWiener_fv_418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_419, AgradDistributionTestFixture, AgradDistributionWiener_fv_419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_420, AgradDistributionTestFixture, AgradDistributionWiener_fv_420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_421, AgradDistributionTestFixture, AgradDistributionWiener_fv_421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_422, AgradDistributionTestFixture, AgradDistributionWiener_fv_422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_423, AgradDistributionTestFixture, AgradDistributionWiener_fv_423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_424, AgradDistributionTestFixture, AgradDistributionWiener_fv_424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_425, AgradDistributionTestFixture, AgradDistributionWiener_fv_425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_426, AgradDistributionTestFixture, AgradDistributionWiener_fv_426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_427, AgradDistributionTestFixture, AgradDistributionWiener_fv_427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_428, AgradDistributionTestFixture, AgradDistributionWiener_fv_428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_429, AgradDistributionTestFixture, AgradDistributionWiener_fv_429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_430, AgradDistributionTestFixture, AgradDistributionWiener_fv_430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_431, AgradDistributionTestFixture, AgradDistributionWiener_fv_431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_432, AgradDistributionTestFixture, AgradDistributionWiener_fv_432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_433, AgradDistributionTestFixture, AgradDistributionWiener_fv_433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_434, AgradDistributionTestFixture, AgradDistributionWiener_fv_434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_435, AgradDistributionTestFixture, AgradDistributionWiener_fv_435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_436, AgradDistributionTestFixture, AgradDistributionWiener_fv_436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_437, AgradDistributionTestFixture, AgradDistributionWiener_fv_437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_438, AgradDistributionTestFixture, AgradDistributionWiener_fv_438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_439, AgradDistributionTestFixture, AgradDistributionWiener_fv_439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_440, AgradDistributionTestFixture, AgradDistributionWiener_fv_440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_441, AgradDistributionTestFixture, AgradDistributionWiener_fv_441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_442, AgradDistributionTestFixture, AgradDistributionWiener_fv_442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_443, AgradDistributionTestFixture, AgradDistributionWiener_fv_443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_444, AgradDistributionTestFixture, AgradDistributionWiener_fv_444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_445, AgradDistributionTestFixture, AgradDistributionWiener_fv_445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_446, AgradDistributionTestFixture, AgradDistributionWiener_fv_446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_447, AgradDistributionTestFixture, AgradDistributionWiener_fv_447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_448, AgradDistributionTestFixture, AgradDistributionWiener_fv_448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_449, AgradDistributionTestFixture, AgradDistributionWiener_fv_449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_450, AgradDistributionTestFixture, AgradDistributionWiener_fv_450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_451, AgradDistributionTestFixture, AgradDistributionWiener_fv_451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_452, AgradDistributionTestFixture, AgradDistributionWiener_fv_452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_453, AgradDistributionTestFixture, AgradDistributionWiener_fv_453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_454, AgradDistributionTestFixture, AgradDistributionWiener_fv_454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_455, AgradDistributionTestFixture, AgradDistributionWiener_fv_455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_456, AgradDistributionTestFixture, AgradDistributionWiener_fv_456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_457, AgradDistributionTestFixture, AgradDistributionWiener_fv_457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_458, AgradDistributionTestFixture, AgradDistributionWiener_fv_458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_459, AgradDistributionTestFixture, AgradDistributionWiener_fv_459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_460, AgradDistributionTestFixture, AgradDistributionWiener_fv_460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_461, AgradDistributionTestFixture, AgradDistributionWiener_fv_461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_462, AgradDistributionTestFixture, AgradDistributionWiener_fv_462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_463, AgradDistributionTestFixture, AgradDistributionWiener_fv_463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_464, AgradDistributionTestFixture, AgradDistributionWiener_fv_464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_465, AgradDistributionTestFixture, AgradDistributionWiener_fv_465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_466, AgradDistributionTestFixture, AgradDistributionWiener_fv_466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_467, AgradDistributionTestFixture, AgradDistributionWiener_fv_467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_468, AgradDistributionTestFixture, AgradDistributionWiener_fv_468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_469, AgradDistributionTestFixture, AgradDistributionWiener_fv_469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_470, AgradDistributionTestFixture, AgradDistributionWiener_fv_470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_471, AgradDistributionTestFixture, AgradDistributionWiener_fv_471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_472, AgradDistributionTestFixture, AgradDistributionWiener_fv_472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_473, AgradDistributionTestFixture, AgradDistributionWiener_fv_473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_474, AgradDistributionTestFixture, AgradDistributionWiener_fv_474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_475, AgradDistributionTestFixture, AgradDistributionWiener_fv_475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_476, AgradDistributionTestFixture, AgradDistributionWiener_fv_476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_477, AgradDistributionTestFixture, AgradDistributionWiener_fv_477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_478, AgradDistributionTestFixture, AgradDistributionWiener_fv_478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_479, AgradDistributionTestFixture, AgradDistributionWiener_fv_479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_480, AgradDistributionTestFixture, AgradDistributionWiener_fv_480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_481, AgradDistributionTestFixture, AgradDistributionWiener_fv_481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_482, AgradDistributionTestFixture, AgradDistributionWiener_fv_482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_483, AgradDistributionTestFixture, AgradDistributionWiener_fv_483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_484, AgradDistributionTestFixture, AgradDistributionWiener_fv_484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_485, AgradDistributionTestFixture, AgradDistributionWiener_fv_485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_486, AgradDistributionTestFixture, AgradDistributionWiener_fv_486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_487, AgradDistributionTestFixture, AgradDistributionWiener_fv_487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_488, AgradDistributionTestFixture, AgradDistributionWiener_fv_488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_489, AgradDistributionTestFixture, AgradDistributionWiener_fv_489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_490, AgradDistributionTestFixture, AgradDistributionWiener_fv_490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_491, AgradDistributionTestFixture, AgradDistributionWiener_fv_491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_492, AgradDistributionTestFixture, AgradDistributionWiener_fv_492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_493, AgradDistributionTestFixture, AgradDistributionWiener_fv_493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_494, AgradDistributionTestFixture, AgradDistributionWiener_fv_494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_495, AgradDistributionTestFixture, AgradDistributionWiener_fv_495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_496, AgradDistributionTestFixture, AgradDistributionWiener_fv_496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_497, AgradDistributionTestFixture, AgradDistributionWiener_fv_497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_498, AgradDistributionTestFixture, AgradDistributionWiener_fv_498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_499, AgradDistributionTestFixture, AgradDistributionWiener_fv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_400;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_401;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_402;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_403;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_404;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_405;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_406;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_407;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_408;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_409;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_410;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_411;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_412;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_413;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_414;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_415;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_416;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_417;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_418;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_419;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_420;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_421;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_422;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_423;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_424;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_425;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_426;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_427;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_428;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_429;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_430;
+typedef boost::mpl::vector<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_431;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty> type_v_432;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_v_433;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_434;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty> type_v_435;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty> type_v_436;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_437;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_v_438;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_v_439;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_440;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty> type_v_441;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty> type_v_442;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_443;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_444;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_445;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_446;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_447;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_448;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_449;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty> type_v_450;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty> type_v_451;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_452;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty> type_v_453;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty> type_v_454;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_455;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty> type_v_456;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty> type_v_457;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_458;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty> type_v_459;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty> type_v_460;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_461;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_462;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_463;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_464;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_465;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_466;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_467;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_v_468;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_v_469;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_470;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty> type_v_471;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty> type_v_472;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_473;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_v_474;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_475;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_476;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty> type_v_477;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_478;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_479;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_480;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_481;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_482;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_483;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_484;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_485;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty> type_v_486;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty> type_v_487;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_488;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty> type_v_489;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty> type_v_490;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_491;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty> type_v_492;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_493;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_494;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty> type_v_495;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_496;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_497;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_498;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_400> AgradDistributionWiener_v_400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_401> AgradDistributionWiener_v_401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_402> AgradDistributionWiener_v_402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_403> AgradDistributionWiener_v_403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_404> AgradDistributionWiener_v_404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_405> AgradDistributionWiener_v_405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_406> AgradDistributionWiener_v_406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_407> AgradDistributionWiener_v_407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_408> AgradDistributionWiener_v_408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_409> AgradDistributionWiener_v_409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_410> AgradDistributionWiener_v_410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_411> AgradDistributionWiener_v_411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_412> AgradDistributionWiener_v_412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_413> AgradDistributionWiener_v_413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_414> AgradDistributionWiener_v_414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_415> AgradDistributionWiener_v_415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_416> AgradDistributionWiener_v_416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_417> AgradDistributionWiener_v_417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_418> AgradDistributionWiener_v_418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_419> AgradDistributionWiener_v_419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_420> AgradDistributionWiener_v_420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_421> AgradDistributionWiener_v_421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_422> AgradDistributionWiener_v_422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_423> AgradDistributionWiener_v_423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_424> AgradDistributionWiener_v_424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_425> AgradDistributionWiener_v_425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_426> AgradDistributionWiener_v_426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_427> AgradDistributionWiener_v_427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_428> AgradDistributionWiener_v_428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_429> AgradDistributionWiener_v_429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_430> AgradDistributionWiener_v_430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_431> AgradDistributionWiener_v_431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_432> AgradDistributionWiener_v_432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_433> AgradDistributionWiener_v_433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_434> AgradDistributionWiener_v_434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_435> AgradDistributionWiener_v_435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_436> AgradDistributionWiener_v_436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_437> AgradDistributionWiener_v_437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_438> AgradDistributionWiener_v_438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_439> AgradDistributionWiener_v_439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_440> AgradDistributionWiener_v_440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_441> AgradDistributionWiener_v_441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_442> AgradDistributionWiener_v_442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_443> AgradDistributionWiener_v_443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_444> AgradDistributionWiener_v_444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_445> AgradDistributionWiener_v_445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_446> AgradDistributionWiener_v_446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_447> AgradDistributionWiener_v_447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_448> AgradDistributionWiener_v_448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_449> AgradDistributionWiener_v_449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_450> AgradDistributionWiener_v_450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_451> AgradDistributionWiener_v_451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_452> AgradDistributionWiener_v_452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_453> AgradDistributionWiener_v_453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_454> AgradDistributionWiener_v_454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_455> AgradDistributionWiener_v_455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_456> AgradDistributionWiener_v_456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_457> AgradDistributionWiener_v_457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_458> AgradDistributionWiener_v_458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_459> AgradDistributionWiener_v_459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_460> AgradDistributionWiener_v_460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_461> AgradDistributionWiener_v_461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_462> AgradDistributionWiener_v_462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_463> AgradDistributionWiener_v_463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_464> AgradDistributionWiener_v_464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_465> AgradDistributionWiener_v_465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_466> AgradDistributionWiener_v_466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_467> AgradDistributionWiener_v_467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_468> AgradDistributionWiener_v_468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_469> AgradDistributionWiener_v_469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_470> AgradDistributionWiener_v_470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_471> AgradDistributionWiener_v_471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_472> AgradDistributionWiener_v_472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_473> AgradDistributionWiener_v_473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_474> AgradDistributionWiener_v_474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_475> AgradDistributionWiener_v_475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_476> AgradDistributionWiener_v_476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_477> AgradDistributionWiener_v_477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_478> AgradDistributionWiener_v_478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_479> AgradDistributionWiener_v_479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_480> AgradDistributionWiener_v_480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_481> AgradDistributionWiener_v_481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_482> AgradDistributionWiener_v_482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_483> AgradDistributionWiener_v_483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_484> AgradDistributionWiener_v_484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_485> AgradDistributionWiener_v_485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_486> AgradDistributionWiener_v_486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_487> AgradDistributionWiener_v_487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_488> AgradDistributionWiener_v_488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_489> AgradDistributionWiener_v_489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_490> AgradDistributionWiener_v_490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_491> AgradDistributionWiener_v_491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_492> AgradDistributionWiener_v_492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_493> AgradDistributionWiener_v_493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_494> AgradDistributionWiener_v_494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_495> AgradDistributionWiener_v_495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_496> AgradDistributionWiener_v_496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_497> AgradDistributionWiener_v_497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_498> AgradDistributionWiener_v_498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_499> AgradDistributionWiener_v_499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_400, AgradDistributionTestFixture, AgradDistributionWiener_v_400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_401, AgradDistributionTestFixture, AgradDistributionWiener_v_401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_402, AgradDistributionTestFixture, AgradDistributionWiener_v_402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_403, AgradDistributionTestFixture, AgradDistributionWiener_v_403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_404, AgradDistributionTestFixture, AgradDistributionWiener_v_404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_405, AgradDistributionTestFixture, AgradDistributionWiener_v_405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_406, AgradDistributionTestFixture, AgradDistributionWiener_v_406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_407, AgradDistributionTestFixture, AgradDistributionWiener_v_407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_408, AgradDistributionTestFixture, AgradDistributionWiener_v_408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_409, AgradDistributionTestFixture, AgradDistributionWiener_v_409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_410, AgradDistributionTestFixture, AgradDistributionWiener_v_410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_411, AgradDistributionTestFixture, AgradDistributionWiener_v_411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_412, AgradDistributionTestFixture, AgradDistributionWiener_v_412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_413, AgradDistributionTestFixture, AgradDistributionWiener_v_413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_414, AgradDistributionTestFixture, AgradDistributionWiener_v_414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_415, AgradDistributionTestFixture, AgradDistributionWiener_v_415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_416, AgradDistributionTestFixture, AgradDistributionWiener_v_416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_417, AgradDistributionTestFixture, AgradDistributionWiener_v_417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_418, AgradDistributionTestFixture, AgradDistributionWiener_v_418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_419, AgradDistributionTestFixture, AgradDistributionWiener_v_419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_420, AgradDistributionTestFixture, AgradDistributionWiener_v_420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_421, AgradDistributionTestFixture, AgradDistributionWiener_v_421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_422, AgradDistributionTestFixture, AgradDistributionWiener_v_422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_423, AgradDistributionTestFixture, AgradDistributionWiener_v_423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_424, AgradDistributionTestFixture, AgradDistributionWiener_v_424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_425, AgradDistributionTestFixture, AgradDistributionWiener_v_425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_426, AgradDistributionTestFixture, AgradDistributionWiener_v_426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_427, AgradDistributionTestFixture, AgradDistributionWiener_v_427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_428, AgradDistributionTestFixture, AgradDistributionWiener_v_428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_429, AgradDistributionTestFixture, AgradDistributionWiener_v_429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_430, AgradDistributionTestFixture, AgradDistributionWiener_v_430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_431, AgradDistributionTestFixture, AgradDistributionWiener_v_431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_432, AgradDistributionTestFixture, AgradDistributionWiener_v_432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_433, AgradDistributionTestFixture, AgradDistributionWiener_v_433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_434, AgradDistributionTestFixture, AgradDistributionWiener_v_434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_435, AgradDistributionTestFixture, AgradDistributionWiener_v_435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_436, AgradDistributionTestFixture, AgradDistributionWiener_v_436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_437, AgradDistributionTestFixture, AgradDistributionWiener_v_437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_438, AgradDistributionTestFixture, AgradDistributionWiener_v_438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_439, AgradDistributionTestFixture, AgradDistributionWiener_v_439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_440, AgradDistributionTestFixture, AgradDistributionWiener_v_440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_441, AgradDistributionTestFixture, AgradDistributionWiener_v_441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_442, AgradDistributionTestFixture, AgradDistributionWiener_v_442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_443, AgradDistributionTestFixture, AgradDistributionWiener_v_443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_444, AgradDistributionTestFixture, AgradDistributionWiener_v_444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_445, AgradDistributionTestFixture, AgradDistributionWiener_v_445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_446, AgradDistributionTestFixture, AgradDistributionWiener_v_446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_447, AgradDistributionTestFixture, AgradDistributionWiener_v_447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_448, AgradDistributionTestFixture, AgradDistributionWiener_v_448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_449, AgradDistributionTestFixture, AgradDistributionWiener_v_449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_450, AgradDistributionTestFixture, AgradDistributionWiener_v_450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_451, AgradDistributionTestFixture, AgradDistributionWiener_v_451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_452, AgradDistributionTestFixture, AgradDistributionWiener_v_452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_453, AgradDistributionTestFixture, AgradDistributionWiener_v_453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_454, AgradDistributionTestFixture, AgradDistributionWiener_v_454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_455, AgradDistributionTestFixture, AgradDistributionWiener_v_455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_456, AgradDistributionTestFixture, AgradDistributionWiener_v_456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_457, AgradDistributionTestFixture, AgradDistributionWiener_v_457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_458, AgradDistributionTestFixture, AgradDistributionWiener_v_458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_459, AgradDistributionTestFixture, AgradDistributionWiener_v_459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_460, AgradDistributionTestFixture, AgradDistributionWiener_v_460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_461, AgradDistributionTestFixture, AgradDistributionWiener_v_461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_462, AgradDistributionTestFixture, AgradDistributionWiener_v_462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_463, AgradDistributionTestFixture, AgradDistributionWiener_v_463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_464, AgradDistributionTestFixture, AgradDistributionWiener_v_464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_465, AgradDistributionTestFixture, AgradDistributionWiener_v_465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_466, AgradDistributionTestFixture, AgradDistributionWiener_v_466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_467, AgradDistributionTestFixture, AgradDistributionWiener_v_467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_468, AgradDistributionTestFixture, AgradDistributionWiener_v_468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_469, AgradDistributionTestFixture, AgradDistributionWiener_v_469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_470, AgradDistributionTestFixture, AgradDistributionWiener_v_470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_471, AgradDistributionTestFixture, AgradDistributionWiener_v_471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_472, AgradDistributionTestFixture, AgradDistributionWiener_v_472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_473, AgradDistributionTestFixture, AgradDistributionWiener_v_473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_474, AgradDistributionTestFixture, AgradDistributionWiener_v_474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_475, AgradDistributionTestFixture, AgradDistributionWiener_v_475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_476, AgradDistributionTestFixture, AgradDistributionWiener_v_476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_477, AgradDistributionTestFixture, AgradDistributionWiener_v_477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_478, AgradDistributionTestFixture, AgradDistributionWiener_v_478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_479, AgradDistributionTestFixture, AgradDistributionWiener_v_479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_480, AgradDistributionTestFixture, AgradDistributionWiener_v_480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_481, AgradDistributionTestFixture, AgradDistributionWiener_v_481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_482, AgradDistributionTestFixture, AgradDistributionWiener_v_482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_483, AgradDistributionTestFixture, AgradDistributionWiener_v_483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_484, AgradDistributionTestFixture, AgradDistributionWiener_v_484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_485, AgradDistributionTestFixture, AgradDistributionWiener_v_485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_486, AgradDistributionTestFixture, AgradDistributionWiener_v_486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_487, AgradDistributionTestFixture, AgradDistributionWiener_v_487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_488, AgradDistributionTestFixture, AgradDistributionWiener_v_488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_489, AgradDistributionTestFixture, AgradDistributionWiener_v_489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_490, AgradDistributionTestFixture, AgradDistributionWiener_v_490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_491, AgradDistributionTestFixture, AgradDistributionWiener_v_491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_492, AgradDistributionTestFixture, AgradDistributionWiener_v_492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_493, AgradDistributionTestFixture, AgradDistributionWiener_v_493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_494, AgradDistributionTestFixture, AgradDistributionWiener_v_494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_495, AgradDistributionTestFixture, AgradDistributionWiener_v_495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_496, AgradDistributionTestFixture, AgradDistributionWiener_v_496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_497, AgradDistributionTestFixture, AgradDistributionWiener_v_497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_498, AgradDistributionTestFixture, AgradDistributionWiener_v_498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_499, AgradDistributionTestFixture, AgradDistributionWiener_v_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_500;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_501;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_502;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_503;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_504;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_505;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_506;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_507;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_508;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_509;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_510;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_511;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_512;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_513;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_514;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_515;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_516;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_517;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_518;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_519;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_520;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_521;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_522;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_523;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_524;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_525;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_526;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_527;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_528;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_529;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_530;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_531;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_532;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_533;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_534;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_535;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_536;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_537;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_538;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_539;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_540;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_541;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_542;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_543;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_544;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_545;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_546;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_547;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_548;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_549;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_550;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_551;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_552;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_553;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_554;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_555;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_556;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_557;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_558;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_559;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_560;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_561;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_562;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_563;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_564;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_565;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_566;
+typedef boost::mpl::vector<double, fvar<double>, double, double, double, empty> type_fd_567;
+typedef boost::mpl::vector<double, fvar<double>, double, double, std::vector<double>, empty> type_fd_568;
+typedef boost::mpl::vector<double, fvar<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_569;
+typedef boost::mpl::vector<double, fvar<double>, double, double, fvar<double>, empty> type_fd_570;
+typedef boost::mpl::vector<double, fvar<double>, double, double, std::vector<fvar<double>>, empty> type_fd_571;
+typedef boost::mpl::vector<double, fvar<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_572;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<double>, double, empty> type_fd_573;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<double>, std::vector<double>, empty> type_fd_574;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_575;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<double>, fvar<double>, empty> type_fd_576;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_577;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_578;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_579;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_580;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_581;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_582;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_583;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_584;
+typedef boost::mpl::vector<double, fvar<double>, double, fvar<double>, double, empty> type_fd_585;
+typedef boost::mpl::vector<double, fvar<double>, double, fvar<double>, std::vector<double>, empty> type_fd_586;
+typedef boost::mpl::vector<double, fvar<double>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_587;
+typedef boost::mpl::vector<double, fvar<double>, double, fvar<double>, fvar<double>, empty> type_fd_588;
+typedef boost::mpl::vector<double, fvar<double>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_589;
+typedef boost::mpl::vector<double, fvar<double>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_590;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<fvar<double>>, double, empty> type_fd_591;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_592;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_593;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_594;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_595;
+typedef boost::mpl::vector<double, fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_596;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_597;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_598;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_500> AgradDistributionWiener_fd_500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_501> AgradDistributionWiener_fd_501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_502> AgradDistributionWiener_fd_502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_503> AgradDistributionWiener_fd_503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_504> AgradDistributionWiener_fd_504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_505> AgradDistributionWiener_fd_505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_506> AgradDistributionWiener_fd_506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_507> AgradDistributionWiener_fd_507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_508> AgradDistributionWiener_fd_508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_509> AgradDistributionWiener_fd_509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_510> AgradDistributionWiener_fd_510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_511> AgradDistributionWiener_fd_511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_512> AgradDistributionWiener_fd_512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_513> AgradDistributionWiener_fd_513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_514> AgradDistributionWiener_fd_514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_515> AgradDistributionWiener_fd_515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_516> AgradDistributionWiener_fd_516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_517> AgradDistributionWiener_fd_517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_518> AgradDistributionWiener_fd_518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_519> AgradDistributionWiener_fd_519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_520> AgradDistributionWiener_fd_520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_521> AgradDistributionWiener_fd_521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_522> AgradDistributionWiener_fd_522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_523> AgradDistributionWiener_fd_523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_524> AgradDistributionWiener_fd_524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_525> AgradDistributionWiener_fd_525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_526> AgradDistributionWiener_fd_526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_527> AgradDistributionWiener_fd_527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_528> AgradDistributionWiener_fd_528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_529> AgradDistributionWiener_fd_529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_530> AgradDistributionWiener_fd_530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_531> AgradDistributionWiener_fd_531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_532> AgradDistributionWiener_fd_532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_533> AgradDistributionWiener_fd_533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_534> AgradDistributionWiener_fd_534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_535> AgradDistributionWiener_fd_535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_536> AgradDistributionWiener_fd_536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_537> AgradDistributionWiener_fd_537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_538> AgradDistributionWiener_fd_538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_539> AgradDistributionWiener_fd_539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_540> AgradDistributionWiener_fd_540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_541> AgradDistributionWiener_fd_541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_542> AgradDistributionWiener_fd_542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_543> AgradDistributionWiener_fd_543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_544> AgradDistributionWiener_fd_544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_545> AgradDistributionWiener_fd_545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_546> AgradDistributionWiener_fd_546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_547> AgradDistributionWiener_fd_547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_548> AgradDistributionWiener_fd_548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_549> AgradDistributionWiener_fd_549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_550> AgradDistributionWiener_fd_550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_551> AgradDistributionWiener_fd_551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_552> AgradDistributionWiener_fd_552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_553> AgradDistributionWiener_fd_553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_554> AgradDistributionWiener_fd_554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_555> AgradDistributionWiener_fd_555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_556> AgradDistributionWiener_fd_556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_557> AgradDistributionWiener_fd_557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_558> AgradDistributionWiener_fd_558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_559> AgradDistributionWiener_fd_559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_560> AgradDistributionWiener_fd_560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_561> AgradDistributionWiener_fd_561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_562> AgradDistributionWiener_fd_562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_563> AgradDistributionWiener_fd_563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_564> AgradDistributionWiener_fd_564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_565> AgradDistributionWiener_fd_565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_566> AgradDistributionWiener_fd_566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_567> AgradDistributionWiener_fd_567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_568> AgradDistributionWiener_fd_568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_569> AgradDistributionWiener_fd_569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_570> AgradDistributionWiener_fd_570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_571> AgradDistributionWiener_fd_571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_572> AgradDistributionWiener_fd_572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_573> AgradDistributionWiener_fd_573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_574> AgradDistributionWiener_fd_574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_575> AgradDistributionWiener_fd_575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_576> AgradDistributionWiener_fd_576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_577> AgradDistributionWiener_fd_577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_578> AgradDistributionWiener_fd_578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_579> AgradDistributionWiener_fd_579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_580> AgradDistributionWiener_fd_580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_581> AgradDistributionWiener_fd_581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_582> AgradDistributionWiener_fd_582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_583> AgradDistributionWiener_fd_583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_584> AgradDistributionWiener_fd_584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_585> AgradDistributionWiener_fd_585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_586> AgradDistributionWiener_fd_586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_587> AgradDistributionWiener_fd_587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_588> AgradDistributionWiener_fd_588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_589> AgradDistributionWiener_fd_589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_590> AgradDistributionWiener_fd_590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_591> AgradDistributionWiener_fd_591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_592> AgradDistributionWiener_fd_592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_593> AgradDistributionWiener_fd_593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_594> AgradDistributionWiener_fd_594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_595> AgradDistributionWiener_fd_595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_596> AgradDistributionWiener_fd_596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_597> AgradDistributionWiener_fd_597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_598> AgradDistributionWiener_fd_598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_599> AgradDistributionWiener_fd_599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_500, AgradDistributionTestFixture, AgradDistributionWiener_fd_500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_501, AgradDistributionTestFixture, AgradDistributionWiener_fd_501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_502, AgradDistributionTestFixture, AgradDistributionWiener_fd_502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_503, AgradDistributionTestFixture, AgradDistributionWiener_fd_503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_504, AgradDistributionTestFixture, AgradDistributionWiener_fd_504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_505, AgradDistributionTestFixture, AgradDistributionWiener_fd_505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_506, AgradDistributionTestFixture, AgradDistributionWiener_fd_506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_507, AgradDistributionTestFixture, AgradDistributionWiener_fd_507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_508, AgradDistributionTestFixture, AgradDistributionWiener_fd_508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_509, AgradDistributionTestFixture, AgradDistributionWiener_fd_509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_510, AgradDistributionTestFixture, AgradDistributionWiener_fd_510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_511, AgradDistributionTestFixture, AgradDistributionWiener_fd_511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_512, AgradDistributionTestFixture, AgradDistributionWiener_fd_512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_513, AgradDistributionTestFixture, AgradDistributionWiener_fd_513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_514, AgradDistributionTestFixture, AgradDistributionWiener_fd_514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_515, AgradDistributionTestFixture, AgradDistributionWiener_fd_515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_516, AgradDistributionTestFixture, AgradDistributionWiener_fd_516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_517, AgradDistributionTestFixture, AgradDistributionWiener_fd_517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_518, AgradDistributionTestFixture, AgradDistributionWiener_fd_518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_519, AgradDistributionTestFixture, AgradDistributionWiener_fd_519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_520, AgradDistributionTestFixture, AgradDistributionWiener_fd_520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_521, AgradDistributionTestFixture, AgradDistributionWiener_fd_521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_522, AgradDistributionTestFixture, AgradDistributionWiener_fd_522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_523, AgradDistributionTestFixture, AgradDistributionWiener_fd_523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_524, AgradDistributionTestFixture, AgradDistributionWiener_fd_524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_525, AgradDistributionTestFixture, AgradDistributionWiener_fd_525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_526, AgradDistributionTestFixture, AgradDistributionWiener_fd_526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_527, AgradDistributionTestFixture, AgradDistributionWiener_fd_527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_528, AgradDistributionTestFixture, AgradDistributionWiener_fd_528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_529, AgradDistributionTestFixture, AgradDistributionWiener_fd_529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_530, AgradDistributionTestFixture, AgradDistributionWiener_fd_530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_531, AgradDistributionTestFixture, AgradDistributionWiener_fd_531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_532, AgradDistributionTestFixture, AgradDistributionWiener_fd_532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_533, AgradDistributionTestFixture, AgradDistributionWiener_fd_533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_534, AgradDistributionTestFixture, AgradDistributionWiener_fd_534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_535, AgradDistributionTestFixture, AgradDistributionWiener_fd_535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_536, AgradDistributionTestFixture, AgradDistributionWiener_fd_536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_537, AgradDistributionTestFixture, AgradDistributionWiener_fd_537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_538, AgradDistributionTestFixture, AgradDistributionWiener_fd_538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_539, AgradDistributionTestFixture, AgradDistributionWiener_fd_539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_540, AgradDistributionTestFixture, AgradDistributionWiener_fd_540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_541, AgradDistributionTestFixture, AgradDistributionWiener_fd_541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_542, AgradDistributionTestFixture, AgradDistributionWiener_fd_542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_543, AgradDistributionTestFixture, AgradDistributionWiener_fd_543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_544, AgradDistributionTestFixture, AgradDistributionWiener_fd_544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_545, AgradDistributionTestFixture, AgradDistributionWiener_fd_545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_546, AgradDistributionTestFixture, AgradDistributionWiener_fd_546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_547, AgradDistributionTestFixture, AgradDistributionWiener_fd_547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_548, AgradDistributionTestFixture, AgradDistributionWiener_fd_548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_549, AgradDistributionTestFixture, AgradDistributionWiener_fd_549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_550, AgradDistributionTestFixture, AgradDistributionWiener_fd_550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_551, AgradDistributionTestFixture, AgradDistributionWiener_fd_551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_552, AgradDistributionTestFixture, AgradDistributionWiener_fd_552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_553, AgradDistributionTestFixture, AgradDistributionWiener_fd_553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_554, AgradDistributionTestFixture, AgradDistributionWiener_fd_554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_555, AgradDistributionTestFixture, AgradDistributionWiener_fd_555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_556, AgradDistributionTestFixture, AgradDistributionWiener_fd_556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_557, AgradDistributionTestFixture, AgradDistributionWiener_fd_557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_558, AgradDistributionTestFixture, AgradDistributionWiener_fd_558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_559, AgradDistributionTestFixture, AgradDistributionWiener_fd_559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_560, AgradDistributionTestFixture, AgradDistributionWiener_fd_560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_561, AgradDistributionTestFixture, AgradDistributionWiener_fd_561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_562, AgradDistributionTestFixture, AgradDistributionWiener_fd_562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_563, AgradDistributionTestFixture, AgradDistributionWiener_fd_563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_564, AgradDistributionTestFixture, AgradDistributionWiener_fd_564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_565, AgradDistributionTestFixture, AgradDistributionWiener_fd_565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_566, AgradDistributionTestFixture, AgradDistributionWiener_fd_566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_567, AgradDistributionTestFixture, AgradDistributionWiener_fd_567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_568, AgradDistributionTestFixture, AgradDistributionWiener_fd_568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_569, AgradDistributionTestFixture, AgradDistributionWiener_fd_569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_570, AgradDistributionTestFixture, AgradDistributionWiener_fd_570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_571, AgradDistributionTestFixture, AgradDistributionWiener_fd_571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_572, AgradDistributionTestFixture, AgradDistributionWiener_fd_572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_573, AgradDistributionTestFixture, AgradDistributionWiener_fd_573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_574, AgradDistributionTestFixture, AgradDistributionWiener_fd_574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_575, AgradDistributionTestFixture, AgradDistributionWiener_fd_575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_576, AgradDistributionTestFixture, AgradDistributionWiener_fd_576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_577, AgradDistributionTestFixture, AgradDistributionWiener_fd_577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_578, AgradDistributionTestFixture, AgradDistributionWiener_fd_578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_579, AgradDistributionTestFixture, AgradDistributionWiener_fd_579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_580, AgradDistributionTestFixture, AgradDistributionWiener_fd_580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_581, AgradDistributionTestFixture, AgradDistributionWiener_fd_581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_582, AgradDistributionTestFixture, AgradDistributionWiener_fd_582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_583, AgradDistributionTestFixture, AgradDistributionWiener_fd_583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_584, AgradDistributionTestFixture, AgradDistributionWiener_fd_584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_585, AgradDistributionTestFixture, AgradDistributionWiener_fd_585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_586, AgradDistributionTestFixture, AgradDistributionWiener_fd_586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_587, AgradDistributionTestFixture, AgradDistributionWiener_fd_587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_588, AgradDistributionTestFixture, AgradDistributionWiener_fd_588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_589, AgradDistributionTestFixture, AgradDistributionWiener_fd_589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_590, AgradDistributionTestFixture, AgradDistributionWiener_fd_590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_591, AgradDistributionTestFixture, AgradDistributionWiener_fd_591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_592, AgradDistributionTestFixture, AgradDistributionWiener_fd_592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_593, AgradDistributionTestFixture, AgradDistributionWiener_fd_593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_594, AgradDistributionTestFixture, AgradDistributionWiener_fd_594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_595, AgradDistributionTestFixture, AgradDistributionWiener_fd_595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_596, AgradDistributionTestFixture, AgradDistributionWiener_fd_596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_597, AgradDistributionTestFixture, AgradDistributionWiener_fd_597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_598, AgradDistributionTestFixture, AgradDistributionWiener_fd_598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_599, AgradDistributionTestFixture, AgradDistributionWiener_fd_599);
+
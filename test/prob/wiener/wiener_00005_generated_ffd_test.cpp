@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_500;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_501;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_502;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_503;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_504;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_505;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_506;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_507;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_508;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_509;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_510;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_511;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_512;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_513;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_514;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_515;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_516;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_517;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_518;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_519;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_520;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_521;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_522;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_523;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_524;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_525;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_526;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_527;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_528;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_529;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_530;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_531;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_532;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_533;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_534;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_535;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_536;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_537;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_538;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_539;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_540;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_541;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_542;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_543;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_544;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_545;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_546;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_547;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_548;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_549;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_550;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_551;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_552;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_553;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_554;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_555;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_556;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_557;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_558;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_559;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_560;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_561;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_562;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_563;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_564;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_565;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_566;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, double, double, empty> type_ffd_567;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, double, std::vector<double>, empty> type_ffd_568;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_569;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, double, fvar<fvar<double> >, empty> type_ffd_570;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_571;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_572;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<double>, double, empty> type_ffd_573;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<double>, std::vector<double>, empty> type_ffd_574;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_575;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_576;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_577;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_578;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_579;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_580;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_581;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_582;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_583;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_584;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, fvar<fvar<double> >, double, empty> type_ffd_585;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_586;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_587;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_588;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_589;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_590;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_591;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_592;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_593;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_594;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_595;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_596;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_597;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_598;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_500> AgradDistributionWiener_ffd_500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_501> AgradDistributionWiener_ffd_501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_502> AgradDistributionWiener_ffd_502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_503> AgradDistributionWiener_ffd_503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_504> AgradDistributionWiener_ffd_504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_505> AgradDistributionWiener_ffd_505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_506> AgradDistributionWiener_ffd_506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_507> AgradDistributionWiener_ffd_507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_508> AgradDistributionWiener_ffd_508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_509> AgradDistributionWiener_ffd_509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_510> AgradDistributionWiener_ffd_510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_511> AgradDistributionWiener_ffd_511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_512> AgradDistributionWiener_ffd_512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_513> AgradDistributionWiener_ffd_513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_514> AgradDistributionWiener_ffd_514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_515> AgradDistributionWiener_ffd_515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_516> AgradDistributionWiener_ffd_516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_517> AgradDistributionWiener_ffd_517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_518> AgradDistributionWiener_ffd_518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_519> AgradDistributionWiener_ffd_519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_520> AgradDistributionWiener_ffd_520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_521> AgradDistributionWiener_ffd_521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_522> AgradDistributionWiener_ffd_522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_523> AgradDistributionWiener_ffd_523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_524> AgradDistributionWiener_ffd_524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_525> AgradDistributionWiener_ffd_525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_526> AgradDistributionWiener_ffd_526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_527> AgradDistributionWiener_ffd_527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_528> AgradDistributionWiener_ffd_528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_529> AgradDistributionWiener_ffd_529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_530> AgradDistributionWiener_ffd_530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_531> AgradDistributionWiener_ffd_531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_532> AgradDistributionWiener_ffd_532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_533> AgradDistributionWiener_ffd_533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_534> AgradDistributionWiener_ffd_534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_535> AgradDistributionWiener_ffd_535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_536> AgradDistributionWiener_ffd_536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_537> AgradDistributionWiener_ffd_537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_538> AgradDistributionWiener_ffd_538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_539> AgradDistributionWiener_ffd_539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_540> AgradDistributionWiener_ffd_540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_541> AgradDistributionWiener_ffd_541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_542> AgradDistributionWiener_ffd_542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_543> AgradDistributionWiener_ffd_543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_544> AgradDistributionWiener_ffd_544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_545> AgradDistributionWiener_ffd_545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_546> AgradDistributionWiener_ffd_546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_547> AgradDistributionWiener_ffd_547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_548> AgradDistributionWiener_ffd_548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_549> AgradDistributionWiener_ffd_549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_550> AgradDistributionWiener_ffd_550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_551> AgradDistributionWiener_ffd_551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_552> AgradDistributionWiener_ffd_552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_553> AgradDistributionWiener_ffd_553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_554> AgradDistributionWiener_ffd_554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_555> AgradDistributionWiener_ffd_555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_556> AgradDistributionWiener_ffd_556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_557> AgradDistributionWiener_ffd_557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_558> AgradDistributionWiener_ffd_558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_559> AgradDistributionWiener_ffd_559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_560> AgradDistributionWiener_ffd_560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_561> AgradDistributionWiener_ffd_561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_562> AgradDistributionWiener_ffd_562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_563> AgradDistributionWiener_ffd_563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_564> AgradDistributionWiener_ffd_564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_565> AgradDistributionWiener_ffd_565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_566> AgradDistributionWiener_ffd_566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_567> AgradDistributionWiener_ffd_567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_568> AgradDistributionWiener_ffd_568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_569> AgradDistributionWiener_ffd_569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_570> AgradDistributionWiener_ffd_570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_571> AgradDistributionWiener_ffd_571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_572> AgradDistributionWiener_ffd_572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_573> AgradDistributionWiener_ffd_573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_574> AgradDistributionWiener_ffd_574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_575> AgradDistributionWiener_ffd_575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_576> AgradDistributionWiener_ffd_576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_577> AgradDistributionWiener_ffd_577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_578> AgradDistributionWiener_ffd_578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_579> AgradDistributionWiener_ffd_579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_580> AgradDistributionWiener_ffd_580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_581> AgradDistributionWiener_ffd_581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_582> AgradDistributionWiener_ffd_582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_583> AgradDistributionWiener_ffd_583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_584> AgradDistributionWiener_ffd_584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_585> AgradDistributionWiener_ffd_585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_586> AgradDistributionWiener_ffd_586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_587> AgradDistributionWiener_ffd_587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_588> AgradDistributionWiener_ffd_588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_589> AgradDistributionWiener_ffd_589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_590> AgradDistributionWiener_ffd_590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_591> AgradDistributionWiener_ffd_591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_592> AgradDistributionWiener_ffd_592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_593> AgradDistributionWiener_ffd_593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_594> AgradDistributionWiener_ffd_594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_595> AgradDistributionWiener_ffd_595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_596> AgradDistributionWiener_ffd_596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_597> AgradDistributionWiener_ffd_597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_598> AgradDistributionWiener_ffd_598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_599> AgradDistributionWiener_ffd_599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_500, AgradDistributionTestFixture, AgradDistributionWiener_ffd_500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_501, AgradDistributionTestFixture, AgradDistributionWiener_ffd_501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_502, AgradDistributionTestFixture, AgradDistributionWiener_ffd_502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_503, AgradDistributionTestFixture, AgradDistributionWiener_ffd_503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_504, AgradDistributionTestFixture, AgradDistributionWiener_ffd_504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_505, AgradDistributionTestFixture, AgradDistributionWiener_ffd_505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_506, AgradDistributionTestFixture, AgradDistributionWiener_ffd_506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_507, AgradDistributionTestFixture, AgradDistributionWiener_ffd_507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_508, AgradDistributionTestFixture, AgradDistributionWiener_ffd_508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_509, AgradDistributionTestFixture, AgradDistributionWiener_ffd_509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_510, AgradDistributionTestFixture, AgradDistributionWiener_ffd_510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_511, AgradDistributionTestFixture, AgradDistributionWiener_ffd_511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_512, AgradDistributionTestFixture, AgradDistributionWiener_ffd_512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_513, AgradDistributionTestFixture, AgradDistributionWiener_ffd_513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_514, AgradDistributionTestFixture, AgradDistributionWiener_ffd_514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_515, AgradDistributionTestFixture, AgradDistributionWiener_ffd_515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_516, AgradDistributionTestFixture, AgradDistributionWiener_ffd_516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_517, AgradDistributionTestFixture, AgradDistributionWiener_ffd_517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_518, AgradDistributionTestFixture, AgradDistributionWiener_ffd_518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_519, AgradDistributionTestFixture, AgradDistributionWiener_ffd_519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_520, AgradDistributionTestFixture, AgradDistributionWiener_ffd_520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_521, AgradDistributionTestFixture, AgradDistributionWiener_ffd_521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_522, AgradDistributionTestFixture, AgradDistributionWiener_ffd_522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_523, AgradDistributionTestFixture, AgradDistributionWiener_ffd_523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_524, AgradDistributionTestFixture, AgradDistributionWiener_ffd_524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_525, AgradDistributionTestFixture, AgradDistributionWiener_ffd_525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_526, AgradDistributionTestFixture, AgradDistributionWiener_ffd_526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_527, AgradDistributionTestFixture, AgradDistributionWiener_ffd_527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_528, AgradDistributionTestFixture, AgradDistributionWiener_ffd_528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_529, AgradDistributionTestFixture, AgradDistributionWiener_ffd_529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_530, AgradDistributionTestFixture, AgradDistributionWiener_ffd_530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_531, AgradDistributionTestFixture, AgradDistributionWiener_ffd_531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_532, AgradDistributionTestFixture, AgradDistributionWiener_ffd_532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_533, AgradDistributionTestFixture, AgradDistributionWiener_ffd_533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_534, AgradDistributionTestFixture, AgradDistributionWiener_ffd_534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_535, AgradDistributionTestFixture, AgradDistributionWiener_ffd_535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_536, AgradDistributionTestFixture, AgradDistributionWiener_ffd_536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_537, AgradDistributionTestFixture, AgradDistributionWiener_ffd_537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_538, AgradDistributionTestFixture, AgradDistributionWiener_ffd_538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_539, AgradDistributionTestFixture, AgradDistributionWiener_ffd_539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_540, AgradDistributionTestFixture, AgradDistributionWiener_ffd_540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_541, AgradDistributionTestFixture, AgradDistributionWiener_ffd_541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_542, AgradDistributionTestFixture, AgradDistributionWiener_ffd_542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_543, AgradDistributionTestFixture, AgradDistributionWiener_ffd_543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_544, AgradDistributionTestFixture, AgradDistributionWiener_ffd_544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_545, AgradDistributionTestFixture, AgradDistributionWiener_ffd_545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_546, AgradDistributionTestFixture, AgradDistributionWiener_ffd_546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_547, AgradDistributionTestFixture, AgradDistributionWiener_ffd_547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_548, AgradDistributionTestFixture, AgradDistributionWiener_ffd_548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_549, AgradDistributionTestFixture, AgradDistributionWiener_ffd_549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_550, AgradDistributionTestFixture, AgradDistributionWiener_ffd_550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_551, AgradDistributionTestFixture, AgradDistributionWiener_ffd_551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_552, AgradDistributionTestFixture, AgradDistributionWiener_ffd_552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_553, AgradDistributionTestFixture, AgradDistributionWiener_ffd_553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_554, AgradDistributionTestFixture, AgradDistributionWiener_ffd_554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_555, AgradDistributionTestFixture, AgradDistributionWiener_ffd_555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_556, AgradDistributionTestFixture, AgradDistributionWiener_ffd_556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_557, AgradDistributionTestFixture, AgradDistributionWiener_ffd_557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_558, AgradDistributionTestFixture, AgradDistributionWiener_ffd_558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_559, AgradDistributionTestFixture, AgradDistributionWiener_ffd_559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_560, AgradDistributionTestFixture, AgradDistributionWiener_ffd_560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_561, AgradDistributionTestFixture, AgradDistributionWiener_ffd_561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_562, AgradDistributionTestFixture, AgradDistributionWiener_ffd_562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_563, AgradDistributionTestFixture, AgradDistributionWiener_ffd_563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_564, AgradDistributionTestFixture, AgradDistributionWiener_ffd_564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_565, AgradDistributionTestFixture, AgradDistributionWiener_ffd_565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_566, AgradDistributionTestFixture, AgradDistributionWiener_ffd_566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_567, AgradDistributionTestFixture, AgradDistributionWiener_ffd_567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_568, AgradDistributionTestFixture, AgradDistributionWiener_ffd_568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_569, AgradDistributionTestFixture, AgradDistributionWiener_ffd_569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_570, AgradDistributionTestFixture, AgradDistributionWiener_ffd_570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_571, AgradDistributionTestFixture, AgradDistributionWiener_ffd_571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_572, AgradDistributionTestFixture, AgradDistributionWiener_ffd_572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_573, AgradDistributionTestFixture, AgradDistributionWiener_ffd_573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_574, AgradDistributionTestFixture, AgradDistributionWiener_ffd_574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_575, AgradDistributionTestFixture, AgradDistributionWiener_ffd_575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_576, AgradDistributionTestFixture, AgradDistributionWiener_ffd_576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_577, AgradDistributionTestFixture, AgradDistributionWiener_ffd_577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_578, AgradDistributionTestFixture, AgradDistributionWiener_ffd_578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_579, AgradDistributionTestFixture, AgradDistributionWiener_ffd_579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_580, AgradDistributionTestFixture, AgradDistributionWiener_ffd_580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_581, AgradDistributionTestFixture, AgradDistributionWiener_ffd_581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_582, AgradDistributionTestFixture, AgradDistributionWiener_ffd_582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_583, AgradDistributionTestFixture, AgradDistributionWiener_ffd_583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_584, AgradDistributionTestFixture, AgradDistributionWiener_ffd_584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_585, AgradDistributionTestFixture, AgradDistributionWiener_ffd_585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_586, AgradDistributionTestFixture, AgradDistributionWiener_ffd_586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_587, AgradDistributionTestFixture, AgradDistributionWiener_ffd_587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_588, AgradDistributionTestFixture, AgradDistributionWiener_ffd_588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_589, AgradDistributionTestFixture, AgradDistributionWiener_ffd_589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_590, AgradDistributionTestFixture, AgradDistributionWiener_ffd_590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_591, AgradDistributionTestFixture, AgradDistributionWiener_ffd_591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_592, AgradDistributionTestFixture, AgradDistributionWiener_ffd_592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_593, AgradDistributionTestFixture, AgradDistributionWiener_ffd_593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_594, AgradDistributionTestFixture, AgradDistributionWiener_ffd_594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_595, AgradDistributionTestFixture, AgradDistributionWiener_ffd_595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_596, AgradDistributionTestFixture, AgradDistributionWiener_ffd_596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_597, AgradDistributionTestFixture, AgradDistributionWiener_ffd_597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_598, AgradDistributionTestFixture, AgradDistributionWiener_ffd_598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_599, AgradDistributionTestFixture, AgradDistributionWiener_ffd_599);
+
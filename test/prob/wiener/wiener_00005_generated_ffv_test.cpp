@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_500;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_501;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_502;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_503;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_504;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_505;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_506;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_507;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_508;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_509;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_510;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_511;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_512;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_513;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_514;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_515;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_516;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_517;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_518;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_519;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_520;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_521;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_522;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_523;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_524;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_525;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_526;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_527;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_528;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_529;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_530;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_531;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_532;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_533;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_534;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_535;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_536;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_537;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_538;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_539;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_540;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_541;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_542;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_543;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_544;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_545;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_546;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_547;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_548;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_549;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_550;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_551;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_552;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_553;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_554;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_555;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_556;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_557;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_558;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_559;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_560;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_561;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_562;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_563;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_564;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_565;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_566;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, double, double, empty> type_ffv_567;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, double, std::vector<double>, empty> type_ffv_568;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_569;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty> type_ffv_570;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_571;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_572;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<double>, double, empty> type_ffv_573;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty> type_ffv_574;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_575;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_576;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_577;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_578;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_579;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_580;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_581;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_582;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_583;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_584;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty> type_ffv_585;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_586;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_587;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_588;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_589;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_590;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_591;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_592;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_593;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_594;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_595;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_596;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_597;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_598;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_500> AgradDistributionWiener_ffv_500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_501> AgradDistributionWiener_ffv_501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_502> AgradDistributionWiener_ffv_502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_503> AgradDistributionWiener_ffv_503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_504> AgradDistributionWiener_ffv_504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_505> AgradDistributionWiener_ffv_505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_506> AgradDistributionWiener_ffv_506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_507> AgradDistributionWiener_ffv_507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_508> AgradDistributionWiener_ffv_508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_509> AgradDistributionWiener_ffv_509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_510> AgradDistributionWiener_ffv_510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_511> AgradDistributionWiener_ffv_511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_512> AgradDistributionWiener_ffv_512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_513> AgradDistributionWiener_ffv_513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_514> AgradDistributionWiener_ffv_514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_515> AgradDistributionWiener_ffv_515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_516> AgradDistributionWiener_ffv_516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_517> AgradDistributionWiener_ffv_517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_518> AgradDistributionWiener_ffv_518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_519> AgradDistributionWiener_ffv_519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_520> AgradDistributionWiener_ffv_520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_521> AgradDistributionWiener_ffv_521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_522> AgradDistributionWiener_ffv_522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_523> AgradDistributionWiener_ffv_523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_524> AgradDistributionWiener_ffv_524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_525> AgradDistributionWiener_ffv_525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_526> AgradDistributionWiener_ffv_526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_527> AgradDistributionWiener_ffv_527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_528> AgradDistributionWiener_ffv_528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_529> AgradDistributionWiener_ffv_529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_530> AgradDistributionWiener_ffv_530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_531> AgradDistributionWiener_ffv_531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_532> AgradDistributionWiener_ffv_532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_533> AgradDistributionWiener_ffv_533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_534> AgradDistributionWiener_ffv_534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_535> AgradDistributionWiener_ffv_535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_536> AgradDistributionWiener_ffv_536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_537> AgradDistributionWiener_ffv_537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_538> AgradDistributionWiener_ffv_538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_539> AgradDistributionWiener_ffv_539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_540> AgradDistributionWiener_ffv_540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_541> AgradDistributionWiener_ffv_541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_542> AgradDistributionWiener_ffv_542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_543> AgradDistributionWiener_ffv_543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_544> AgradDistributionWiener_ffv_544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_545> AgradDistributionWiener_ffv_545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_546> AgradDistributionWiener_ffv_546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_547> AgradDistributionWiener_ffv_547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_548> AgradDistributionWiener_ffv_548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_549> AgradDistributionWiener_ffv_549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_550> AgradDistributionWiener_ffv_550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_551> AgradDistributionWiener_ffv_551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_552> AgradDistributionWiener_ffv_552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_553> AgradDistributionWiener_ffv_553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_554> AgradDistributionWiener_ffv_554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_555> AgradDistributionWiener_ffv_555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_556> AgradDistributionWiener_ffv_556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_557> AgradDistributionWiener_ffv_557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_558> AgradDistributionWiener_ffv_558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_559> AgradDistributionWiener_ffv_559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_560> AgradDistributionWiener_ffv_560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_561> AgradDistributionWiener_ffv_561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_562> AgradDistributionWiener_ffv_562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_563> AgradDistributionWiener_ffv_563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_564> AgradDistributionWiener_ffv_564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_565> AgradDistributionWiener_ffv_565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_566> AgradDistributionWiener_ffv_566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_567> AgradDistributionWiener_ffv_567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_568> AgradDistributionWiener_ffv_568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_569> AgradDistributionWiener_ffv_569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_570> AgradDistributionWiener_ffv_570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_571> AgradDistributionWiener_ffv_571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_572> AgradDistributionWiener_ffv_572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_573> AgradDistributionWiener_ffv_573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_574> AgradDistributionWiener_ffv_574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_575> AgradDistributionWiener_ffv_575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_576> AgradDistributionWiener_ffv_576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_577> AgradDistributionWiener_ffv_577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_578> AgradDistributionWiener_ffv_578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_579> AgradDistributionWiener_ffv_579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_580> AgradDistributionWiener_ffv_580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_581> AgradDistributionWiener_ffv_581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_582> AgradDistributionWiener_ffv_582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_583> AgradDistributionWiener_ffv_583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_584> AgradDistributionWiener_ffv_584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_585> AgradDistributionWiener_ffv_585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_586> AgradDistributionWiener_ffv_586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_587> AgradDistributionWiener_ffv_587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_588> AgradDistributionWiener_ffv_588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_589> AgradDistributionWiener_ffv_589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_590> AgradDistributionWiener_ffv_590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_591> AgradDistributionWiener_ffv_591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_592> AgradDistributionWiener_ffv_592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_593> AgradDistributionWiener_ffv_593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_594> AgradDistributionWiener_ffv_594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_595> AgradDistributionWiener_ffv_595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_596> AgradDistributionWiener_ffv_596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_597> AgradDistributionWiener_ffv_597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_598> AgradDistributionWiener_ffv_598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_599> AgradDistributionWiener_ffv_599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_500, AgradDistributionTestFixture, AgradDistributionWiener_ffv_500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_501, AgradDistributionTestFixture, AgradDistributionWiener_ffv_501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_502, AgradDistributionTestFixture, AgradDistributionWiener_ffv_502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_503, AgradDistributionTestFixture, AgradDistributionWiener_ffv_503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_504, AgradDistributionTestFixture, AgradDistributionWiener_ffv_504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_505, AgradDistributionTestFixture, AgradDistributionWiener_ffv_505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_506, AgradDistributionTestFixture, AgradDistributionWiener_ffv_506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_507, AgradDistributionTestFixture, AgradDistributionWiener_ffv_507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_508, AgradDistributionTestFixture, AgradDistributionWiener_ffv_508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_509, AgradDistributionTestFixture, AgradDistributionWiener_ffv_509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_510, AgradDistributionTestFixture, AgradDistributionWiener_ffv_510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_511, AgradDistributionTestFixture, AgradDistributionWiener_ffv_511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_512, AgradDistributionTestFixture, AgradDistributionWiener_ffv_512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_513, AgradDistributionTestFixture, AgradDistributionWiener_ffv_513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_514, AgradDistributionTestFixture, AgradDistributionWiener_ffv_514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_515, AgradDistributionTestFixture, AgradDistributionWiener_ffv_515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_516, AgradDistributionTestFixture, AgradDistributionWiener_ffv_516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_517, AgradDistributionTestFixture, AgradDistributionWiener_ffv_517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_518, AgradDistributionTestFixture, AgradDistributionWiener_ffv_518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_519, AgradDistributionTestFixture, AgradDistributionWiener_ffv_519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_520, AgradDistributionTestFixture, AgradDistributionWiener_ffv_520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_521, AgradDistributionTestFixture, AgradDistributionWiener_ffv_521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_522, AgradDistributionTestFixture, AgradDistributionWiener_ffv_522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_523, AgradDistributionTestFixture, AgradDistributionWiener_ffv_523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_524, AgradDistributionTestFixture, AgradDistributionWiener_ffv_524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_525, AgradDistributionTestFixture, AgradDistributionWiener_ffv_525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_526, AgradDistributionTestFixture, AgradDistributionWiener_ffv_526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_527, AgradDistributionTestFixture, AgradDistributionWiener_ffv_527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_528, AgradDistributionTestFixture, AgradDistributionWiener_ffv_528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_529, AgradDistributionTestFixture, AgradDistributionWiener_ffv_529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_530, AgradDistributionTestFixture, AgradDistributionWiener_ffv_530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_531, AgradDistributionTestFixture, AgradDistributionWiener_ffv_531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_532, AgradDistributionTestFixture, AgradDistributionWiener_ffv_532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_533, AgradDistributionTestFixture, AgradDistributionWiener_ffv_533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_534, AgradDistributionTestFixture, AgradDistributionWiener_ffv_534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_535, AgradDistributionTestFixture, AgradDistributionWiener_ffv_535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_536, AgradDistributionTestFixture, AgradDistributionWiener_ffv_536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_537, AgradDistributionTestFixture, AgradDistributionWiener_ffv_537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_538, AgradDistributionTestFixture, AgradDistributionWiener_ffv_538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_539, AgradDistributionTestFixture, AgradDistributionWiener_ffv_539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_540, AgradDistributionTestFixture, AgradDistributionWiener_ffv_540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_541, AgradDistributionTestFixture, AgradDistributionWiener_ffv_541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_542, AgradDistributionTestFixture, AgradDistributionWiener_ffv_542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_543, AgradDistributionTestFixture, AgradDistributionWiener_ffv_543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_544, AgradDistributionTestFixture, AgradDistributionWiener_ffv_544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_545, AgradDistributionTestFixture, AgradDistributionWiener_ffv_545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_546, AgradDistributionTestFixture, AgradDistributionWiener_ffv_546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_547, AgradDistributionTestFixture, AgradDistributionWiener_ffv_547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_548, AgradDistributionTestFixture, AgradDistributionWiener_ffv_548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_549, AgradDistributionTestFixture, AgradDistributionWiener_ffv_549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_550, AgradDistributionTestFixture, AgradDistributionWiener_ffv_550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_551, AgradDistributionTestFixture, AgradDistributionWiener_ffv_551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_552, AgradDistributionTestFixture, AgradDistributionWiener_ffv_552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_553, AgradDistributionTestFixture, AgradDistributionWiener_ffv_553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_554, AgradDistributionTestFixture, AgradDistributionWiener_ffv_554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_555, AgradDistributionTestFixture, AgradDistributionWiener_ffv_555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_556, AgradDistributionTestFixture, AgradDistributionWiener_ffv_556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_557, AgradDistributionTestFixture, AgradDistributionWiener_ffv_557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_558, AgradDistributionTestFixture, AgradDistributionWiener_ffv_558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_559, AgradDistributionTestFixture, AgradDistributionWiener_ffv_559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_560, AgradDistributionTestFixture, AgradDistributionWiener_ffv_560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_561, AgradDistributionTestFixture, AgradDistributionWiener_ffv_561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_562, AgradDistributionTestFixture, AgradDistributionWiener_ffv_562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_563, AgradDistributionTestFixture, AgradDistributionWiener_ffv_563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_564, AgradDistributionTestFixture, AgradDistributionWiener_ffv_564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_565, AgradDistributionTestFixture, AgradDistributionWiener_ffv_565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_566, AgradDistributionTestFixture, AgradDistributionWiener_ffv_566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_567, AgradDistributionTestFixture, AgradDistributionWiener_ffv_567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_568, AgradDistributionTestFixture, AgradDistributionWiener_ffv_568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_569, AgradDistributionTestFixture, AgradDistributionWiener_ffv_569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_570, AgradDistributionTestFixture, AgradDistributionWiener_ffv_570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_571, AgradDistributionTestFixture, AgradDistributionWiener_ffv_571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_572, AgradDistributionTestFixture, AgradDistributionWiener_ffv_572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_573, AgradDistributionTestFixture, AgradDistributionWiener_ffv_573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_574, AgradDistributionTestFixture, AgradDistributionWiener_ffv_574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_575, AgradDistributionTestFixture, AgradDistributionWiener_ffv_575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_576, AgradDistributionTestFixture, AgradDistributionWiener_ffv_576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_577, AgradDistributionTestFixture, AgradDistributionWiener_ffv_577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_578, AgradDistributionTestFixture, AgradDistributionWiener_ffv_578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_579, AgradDistributionTestFixture, AgradDistributionWiener_ffv_579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_580, AgradDistributionTestFixture, AgradDistributionWiener_ffv_580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_581, AgradDistributionTestFixture, AgradDistributionWiener_ffv_581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_582, AgradDistributionTestFixture, AgradDistributionWiener_ffv_582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_583, AgradDistributionTestFixture, AgradDistributionWiener_ffv_583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_584, AgradDistributionTestFixture, AgradDistributionWiener_ffv_584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_585, AgradDistributionTestFixture, AgradDistributionWiener_ffv_585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_586, AgradDistributionTestFixture, AgradDistributionWiener_ffv_586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_587, AgradDistributionTestFixture, AgradDistributionWiener_ffv_587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_588, AgradDistributionTestFixture, AgradDistributionWiener_ffv_588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_589, AgradDistributionTestFixture, AgradDistributionWiener_ffv_589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_590, AgradDistributionTestFixture, AgradDistributionWiener_ffv_590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_591, AgradDistributionTestFixture, AgradDistributionWiener_ffv_591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_592, AgradDistributionTestFixture, AgradDistributionWiener_ffv_592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_593, AgradDistributionTestFixture, AgradDistributionWiener_ffv_593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_594, AgradDistributionTestFixture, AgradDistributionWiener_ffv_594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_595, AgradDistributionTestFixture, AgradDistributionWiener_ffv_595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_596, AgradDistributionTestFixture, AgradDistributionWiener_ffv_596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_597, AgradDistributionTestFixture, AgradDistributionWiener_ffv_597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_598, AgradDistributionTestFixture, AgradDistributionWiener_ffv_598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_599, AgradDistributionTestFixture, AgradDistributionWiener_ffv_599);
+
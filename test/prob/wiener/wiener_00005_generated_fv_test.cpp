@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_500;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_501;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_502;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_503;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_504;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_505;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_506;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_507;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_508;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_509;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_510;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_511;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_512;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_513;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_514;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_515;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_516;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_517;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_518;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_519;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_520;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_521;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_522;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_523;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_524;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_525;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_526;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_527;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_528;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_529;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_530;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_531;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_532;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_533;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_534;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_535;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_536;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_537;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_538;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_539;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_540;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_541;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_542;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_543;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_544;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_545;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_546;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_547;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_548;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_549;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_550;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_551;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_552;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_553;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_554;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_555;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_556;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_557;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_558;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_559;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_560;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_561;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_562;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_563;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_564;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_565;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_566;
+typedef boost::mpl::vector<double, fvar<var>, double, double, double, empty> type_fv_567;
+typedef boost::mpl::vector<double, fvar<var>, double, double, std::vector<double>, empty> type_fv_568;
+typedef boost::mpl::vector<double, fvar<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_569;
+typedef boost::mpl::vector<double, fvar<var>, double, double, fvar<var>, empty> type_fv_570;
+typedef boost::mpl::vector<double, fvar<var>, double, double, std::vector<fvar<var>>, empty> type_fv_571;
+typedef boost::mpl::vector<double, fvar<var>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_572;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<double>, double, empty> type_fv_573;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<double>, std::vector<double>, empty> type_fv_574;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_575;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<double>, fvar<var>, empty> type_fv_576;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_577;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_578;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_579;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_580;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_581;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_582;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_583;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_584;
+typedef boost::mpl::vector<double, fvar<var>, double, fvar<var>, double, empty> type_fv_585;
+typedef boost::mpl::vector<double, fvar<var>, double, fvar<var>, std::vector<double>, empty> type_fv_586;
+typedef boost::mpl::vector<double, fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_587;
+typedef boost::mpl::vector<double, fvar<var>, double, fvar<var>, fvar<var>, empty> type_fv_588;
+typedef boost::mpl::vector<double, fvar<var>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_589;
+typedef boost::mpl::vector<double, fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_590;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<fvar<var>>, double, empty> type_fv_591;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_592;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_593;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_594;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_595;
+typedef boost::mpl::vector<double, fvar<var>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_596;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_597;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_598;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_500> AgradDistributionWiener_fv_500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_501> AgradDistributionWiener_fv_501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_502> AgradDistributionWiener_fv_502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_503> AgradDistributionWiener_fv_503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_504> AgradDistributionWiener_fv_504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_505> AgradDistributionWiener_fv_505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_506> AgradDistributionWiener_fv_506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_507> AgradDistributionWiener_fv_507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_508> AgradDistributionWiener_fv_508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_509> AgradDistributionWiener_fv_509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_510> AgradDistributionWiener_fv_510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_511> AgradDistributionWiener_fv_511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_512> AgradDistributionWiener_fv_512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_513> AgradDistributionWiener_fv_513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_514> AgradDistributionWiener_fv_514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_515> AgradDistributionWiener_fv_515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_516> AgradDistributionWiener_fv_516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_517> AgradDistributionWiener_fv_517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_518> AgradDistributionWiener_fv_518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_519> AgradDistributionWiener_fv_519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_520> AgradDistributionWiener_fv_520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_521> AgradDistributionWiener_fv_521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_522> AgradDistributionWiener_fv_522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_523> AgradDistributionWiener_fv_523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_524> AgradDistributionWiener_fv_524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_525> AgradDistributionWiener_fv_525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_526> AgradDistributionWiener_fv_526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_527> AgradDistributionWiener_fv_527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_528> AgradDistributionWiener_fv_528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_529> AgradDistributionWiener_fv_529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_530> AgradDistributionWiener_fv_530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_531> AgradDistributionWiener_fv_531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_532> AgradDistributionWiener_fv_532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_533> AgradDistributionWiener_fv_533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_534> AgradDistributionWiener_fv_534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_535> AgradDistributionWiener_fv_535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_536> AgradDistributionWiener_fv_536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_537> AgradDistributionWiener_fv_537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_538> AgradDistributionWiener_fv_538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_539> AgradDistributionWiener_fv_539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_540> AgradDistributionWiener_fv_540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_541> AgradDistributionWiener_fv_541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_542> AgradDistributionWiener_fv_542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_543> AgradDistributionWiener_fv_543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_544> AgradDistributionWiener_fv_544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_545> AgradDistributionWiener_fv_545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_546> AgradDistributionWiener_fv_546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_547> AgradDistributionWiener_fv_547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_548> AgradDistributionWiener_fv_548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_549> AgradDistributionWiener_fv_549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_550> AgradDistributionWiener_fv_550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_551> AgradDistributionWiener_fv_551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_552> AgradDistributionWiener_fv_552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_553> AgradDistributionWiener_fv_553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_554> AgradDistributionWiener_fv_554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_555> AgradDistributionWiener_fv_555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_556> AgradDistributionWiener_fv_556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_557> AgradDistributionWiener_fv_557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_558> AgradDistributionWiener_fv_558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_559> AgradDistributionWiener_fv_559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_560> AgradDistributionWiener_fv_560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_561> AgradDistributionWiener_fv_561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_562> AgradDistributionWiener_fv_562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_563> AgradDistributionWiener_fv_563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_564> AgradDistributionWiener_fv_564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_565> AgradDistributionWiener_fv_565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_566> AgradDistributionWiener_fv_566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_567> AgradDistributionWiener_fv_567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_568> AgradDistributionWiener_fv_568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_569> AgradDistributionWiener_fv_569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_570> AgradDistributionWiener_fv_570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_571> AgradDistributionWiener_fv_571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_572> AgradDistributionWiener_fv_572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_573> AgradDistributionWiener_fv_573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_574> AgradDistributionWiener_fv_574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_575> AgradDistributionWiener_fv_575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_576> AgradDistributionWiener_fv_576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_577> AgradDistributionWiener_fv_577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_578> AgradDistributionWiener_fv_578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_579> AgradDistributionWiener_fv_579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_580> AgradDistributionWiener_fv_580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_581> AgradDistributionWiener_fv_581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_582> AgradDistributionWiener_fv_582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_583> AgradDistributionWiener_fv_583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_584> AgradDistributionWiener_fv_584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_585> AgradDistributionWiener_fv_585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_586> AgradDistributionWiener_fv_586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_587> AgradDistributionWiener_fv_587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_588> AgradDistributionWiener_fv_588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_589> AgradDistributionWiener_fv_589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_590> AgradDistributionWiener_fv_590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_591> AgradDistributionWiener_fv_591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_592> AgradDistributionWiener_fv_592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_593> AgradDistributionWiener_fv_593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_594> AgradDistributionWiener_fv_594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_595> AgradDistributionWiener_fv_595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_596> AgradDistributionWiener_fv_596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_597> AgradDistributionWiener_fv_597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_598> AgradDistributionWiener_fv_598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_599> AgradDistributionWiener_fv_599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_500, AgradDistributionTestFixture, AgradDistributionWiener_fv_500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_501, AgradDistributionTestFixture, AgradDistributionWiener_fv_501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_502, AgradDistributionTestFixture, AgradDistributionWiener_fv_502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_503, AgradDistributionTestFixture, AgradDistributionWiener_fv_503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_504, AgradDistributionTestFixture, AgradDistributionWiener_fv_504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_505, AgradDistributionTestFixture, AgradDistributionWiener_fv_505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_506, AgradDistributionTestFixture, AgradDistributionWiener_fv_506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_507, AgradDistributionTestFixture, AgradDistributionWiener_fv_507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_508, AgradDistributionTestFixture, AgradDistributionWiener_fv_508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_509, AgradDistributionTestFixture, AgradDistributionWiener_fv_509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_510, AgradDistributionTestFixture, AgradDistributionWiener_fv_510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_511, AgradDistributionTestFixture, AgradDistributionWiener_fv_511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_512, AgradDistributionTestFixture, AgradDistributionWiener_fv_512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_513, AgradDistributionTestFixture, AgradDistributionWiener_fv_513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_514, AgradDistributionTestFixture, AgradDistributionWiener_fv_514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_515, AgradDistributionTestFixture, AgradDistributionWiener_fv_515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_516, AgradDistributionTestFixture, AgradDistributionWiener_fv_516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_517, AgradDistributionTestFixture, AgradDistributionWiener_fv_517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_518, AgradDistributionTestFixture, AgradDistributionWiener_fv_518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_519, AgradDistributionTestFixture, AgradDistributionWiener_fv_519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_520, AgradDistributionTestFixture, AgradDistributionWiener_fv_520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_521, AgradDistributionTestFixture, AgradDistributionWiener_fv_521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_522, AgradDistributionTestFixture, AgradDistributionWiener_fv_522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_523, AgradDistributionTestFixture, AgradDistributionWiener_fv_523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_524, AgradDistributionTestFixture, AgradDistributionWiener_fv_524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_525, AgradDistributionTestFixture, AgradDistributionWiener_fv_525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_526, AgradDistributionTestFixture, AgradDistributionWiener_fv_526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_527, AgradDistributionTestFixture, AgradDistributionWiener_fv_527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_528, AgradDistributionTestFixture, AgradDistributionWiener_fv_528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_529, AgradDistributionTestFixture, AgradDistributionWiener_fv_529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_530, AgradDistributionTestFixture, AgradDistributionWiener_fv_530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_531, AgradDistributionTestFixture, AgradDistributionWiener_fv_531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_532, AgradDistributionTestFixture, AgradDistributionWiener_fv_532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_533, AgradDistributionTestFixture, AgradDistributionWiener_fv_533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_534, AgradDistributionTestFixture, AgradDistributionWiener_fv_534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_535, AgradDistributionTestFixture, AgradDistributionWiener_fv_535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_536, AgradDistributionTestFixture, AgradDistributionWiener_fv_536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_537, AgradDistributionTestFixture, AgradDistributionWiener_fv_537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_538, AgradDistributionTestFixture, AgradDistributionWiener_fv_538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_539, AgradDistributionTestFixture, AgradDistributionWiener_fv_539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_540, AgradDistributionTestFixture, AgradDistributionWiener_fv_540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_541, AgradDistributionTestFixture, AgradDistributionWiener_fv_541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_542, AgradDistributionTestFixture, AgradDistributionWiener_fv_542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_543, AgradDistributionTestFixture, AgradDistributionWiener_fv_543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_544, AgradDistributionTestFixture, AgradDistributionWiener_fv_544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_545, AgradDistributionTestFixture, AgradDistributionWiener_fv_545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_546, AgradDistributionTestFixture, AgradDistributionWiener_fv_546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_547, AgradDistributionTestFixture, AgradDistributionWiener_fv_547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_548, AgradDistributionTestFixture, AgradDistributionWiener_fv_548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_549, AgradDistributionTestFixture, AgradDistributionWiener_fv_549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_550, AgradDistributionTestFixture, AgradDistributionWiener_fv_550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_551, AgradDistributionTestFixture, AgradDistributionWiener_fv_551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_552, AgradDistributionTestFixture, AgradDistributionWiener_fv_552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_553, AgradDistributionTestFixture, AgradDistributionWiener_fv_553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_554, AgradDistributionTestFixture, AgradDistributionWiener_fv_554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_555, AgradDistributionTestFixture, AgradDistributionWiener_fv_555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_556, AgradDistributionTestFixture, AgradDistributionWiener_fv_556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_557, AgradDistributionTestFixture, AgradDistributionWiener_fv_557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_558, AgradDistributionTestFixture, AgradDistributionWiener_fv_558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_559, AgradDistributionTestFixture, AgradDistributionWiener_fv_559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_560, AgradDistributionTestFixture, AgradDistributionWiener_fv_560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_561, AgradDistributionTestFixture, AgradDistributionWiener_fv_561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_562, AgradDistributionTestFixture, AgradDistributionWiener_fv_562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_563, AgradDistributionTestFixture, AgradDistributionWiener_fv_563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_564, AgradDistributionTestFixture, AgradDistributionWiener_fv_564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_565, AgradDistributionTestFixture, AgradDistributionWiener_fv_565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_566, AgradDistributionTestFixture, AgradDistributionWiener_fv_566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_567, AgradDistributionTestFixture, AgradDistributionWiener_fv_567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_568, AgradDistributionTestFixture, AgradDistributionWiener_fv_568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_569, AgradDistributionTestFixture, AgradDistributionWiener_fv_569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_570, AgradDistributionTestFixture, AgradDistributionWiener_fv_570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_571, AgradDistributionTestFixture, AgradDistributionWiener_fv_571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_572, AgradDistributionTestFixture, AgradDistributionWiener_fv_572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_573, AgradDistributionTestFixture, AgradDistributionWiener_fv_573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_574, AgradDistributionTestFixture, AgradDistributionWiener_fv_574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_575, AgradDistributionTestFixture, AgradDistributionWiener_fv_575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_576, AgradDistributionTestFixture, AgradDistributionWiener_fv_576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_577, AgradDistributionTestFixture, AgradDistributionWiener_fv_577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_578, AgradDistributionTestFixture, AgradDistributionWiener_fv_578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_579, AgradDistributionTestFixture, AgradDistributionWiener_fv_579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_580, AgradDistributionTestFixture, AgradDistributionWiener_fv_580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_581, AgradDistributionTestFixture, AgradDistributionWiener_fv_581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_582, AgradDistributionTestFixture, AgradDistributionWiener_fv_582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_583, AgradDistributionTestFixture, AgradDistributionWiener_fv_583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_584, AgradDistributionTestFixture, AgradDistributionWiener_fv_584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_585, AgradDistributionTestFixture, AgradDistributionWiener_fv_585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_586, AgradDistributionTestFixture, AgradDistributionWiener_fv_586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_587, AgradDistributionTestFixture, AgradDistributionWiener_fv_587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_588, AgradDistributionTestFixture, AgradDistributionWiener_fv_588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_589, AgradDistributionTestFixture, AgradDistributionWiener_fv_589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_590, AgradDistributionTestFixture, AgradDistributionWiener_fv_590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_591, AgradDistributionTestFixture, AgradDistributionWiener_fv_591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_592, AgradDistributionTestFixture, AgradDistributionWiener_fv_592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_593, AgradDistributionTestFixture, AgradDistributionWiener_fv_593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_594, AgradDistributionTestFixture, AgradDistributionWiener_fv_594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_595, AgradDistributionTestFixture, AgradDistributionWiener_fv_595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_596, AgradDistributionTestFixture, AgradDistributionWiener_fv_596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_597, AgradDistributionTestFixture, AgradDistributionWiener_fv_597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_598, AgradDistributionTestFixture, AgradDistributionWiener_fv_598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_599, AgradDistributionTestFixture, AgradDistributionWiener_fv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_500;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_501;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_502;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_503;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_504;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_505;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_506;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_507;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_508;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_509;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_510;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_511;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_512;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_513;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_514;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_515;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_516;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_517;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_518;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_519;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_520;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_521;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_522;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_523;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_524;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_525;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_526;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_527;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_528;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_529;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_530;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_531;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_532;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_533;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_534;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_535;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_536;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_537;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_538;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_539;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty> type_v_540;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_541;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_542;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty> type_v_543;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_544;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_545;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_546;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_547;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_548;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_549;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_550;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_551;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_552;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_553;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_554;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_555;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_556;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_557;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty> type_v_558;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty> type_v_559;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_560;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty> type_v_561;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_562;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_563;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_564;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_565;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_566;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_567;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_568;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_569;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_570;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_571;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_572;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_573;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_574;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_575;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_576;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_577;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_578;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_579;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_580;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_581;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_582;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_583;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_584;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_585;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_586;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_587;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_588;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_589;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_590;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_591;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_592;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_593;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_594;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_595;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_596;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_597;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_598;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_500> AgradDistributionWiener_v_500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_501> AgradDistributionWiener_v_501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_502> AgradDistributionWiener_v_502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_503> AgradDistributionWiener_v_503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_504> AgradDistributionWiener_v_504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_505> AgradDistributionWiener_v_505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_506> AgradDistributionWiener_v_506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_507> AgradDistributionWiener_v_507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_508> AgradDistributionWiener_v_508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_509> AgradDistributionWiener_v_509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_510> AgradDistributionWiener_v_510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_511> AgradDistributionWiener_v_511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_512> AgradDistributionWiener_v_512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_513> AgradDistributionWiener_v_513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_514> AgradDistributionWiener_v_514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_515> AgradDistributionWiener_v_515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_516> AgradDistributionWiener_v_516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_517> AgradDistributionWiener_v_517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_518> AgradDistributionWiener_v_518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_519> AgradDistributionWiener_v_519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_520> AgradDistributionWiener_v_520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_521> AgradDistributionWiener_v_521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_522> AgradDistributionWiener_v_522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_523> AgradDistributionWiener_v_523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_524> AgradDistributionWiener_v_524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_525> AgradDistributionWiener_v_525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_526> AgradDistributionWiener_v_526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_527> AgradDistributionWiener_v_527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_528> AgradDistributionWiener_v_528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_529> AgradDistributionWiener_v_529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_530> AgradDistributionWiener_v_530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_531> AgradDistributionWiener_v_531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_532> AgradDistributionWiener_v_532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_533> AgradDistributionWiener_v_533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_534> AgradDistributionWiener_v_534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_535> AgradDistributionWiener_v_535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_536> AgradDistributionWiener_v_536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_537> AgradDistributionWiener_v_537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_538> AgradDistributionWiener_v_538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_539> AgradDistributionWiener_v_539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_540> AgradDistributionWiener_v_540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_541> AgradDistributionWiener_v_541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_542> AgradDistributionWiener_v_542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_543> AgradDistributionWiener_v_543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_544> AgradDistributionWiener_v_544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_545> AgradDistributionWiener_v_545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_546> AgradDistributionWiener_v_546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_547> AgradDistributionWiener_v_547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_548> AgradDistributionWiener_v_548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_549> AgradDistributionWiener_v_549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_550> AgradDistributionWiener_v_550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_551> AgradDistributionWiener_v_551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_552> AgradDistributionWiener_v_552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_553> AgradDistributionWiener_v_553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_554> AgradDistributionWiener_v_554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_555> AgradDistributionWiener_v_555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_556> AgradDistributionWiener_v_556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_557> AgradDistributionWiener_v_557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_558> AgradDistributionWiener_v_558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_559> AgradDistributionWiener_v_559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_560> AgradDistributionWiener_v_560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_561> AgradDistributionWiener_v_561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_562> AgradDistributionWiener_v_562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_563> AgradDistributionWiener_v_563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_564> AgradDistributionWiener_v_564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_565> AgradDistributionWiener_v_565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_566> AgradDistributionWiener_v_566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_567> AgradDistributionWiener_v_567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_568> AgradDistributionWiener_v_568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_569> AgradDistributionWiener_v_569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_570> AgradDistributionWiener_v_570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_571> AgradDistributionWiener_v_571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_572> AgradDistributionWiener_v_572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_573> AgradDistributionWiener_v_573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_574> AgradDistributionWiener_v_574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_575> AgradDistributionWiener_v_575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_576> AgradDistributionWiener_v_576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_577> AgradDistributionWiener_v_577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_578> AgradDistributionWiener_v_578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_579> AgradDistributionWiener_v_579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_580> AgradDistributionWiener_v_580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_581> AgradDistributionWiener_v_581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_582> AgradDistributionWiener_v_582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_583> AgradDistributionWiener_v_583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_584> AgradDistributionWiener_v_584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_585> AgradDistributionWiener_v_585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_586> AgradDistributionWiener_v_586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_587> AgradDistributionWiener_v_587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_588> AgradDistributionWiener_v_588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_589> AgradDistributionWiener_v_589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_590> AgradDistributionWiener_v_590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_591> AgradDistributionWiener_v_591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_592> AgradDistributionWiener_v_592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_593> AgradDistributionWiener_v_593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_594> AgradDistributionWiener_v_594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_595> AgradDistributionWiener_v_595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_596> AgradDistributionWiener_v_596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_597> AgradDistributionWiener_v_597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_598> AgradDistributionWiener_v_598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_599> AgradDistributionWiener_v_599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_500, AgradDistributionTestFixture, AgradDistributionWiener_v_500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_501, AgradDistributionTestFixture, AgradDistributionWiener_v_501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_502, AgradDistributionTestFixture, AgradDistributionWiener_v_502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_503, AgradDistributionTestFixture, AgradDistributionWiener_v_503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_504, AgradDistributionTestFixture, AgradDistributionWiener_v_504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_505, AgradDistributionTestFixture, AgradDistributionWiener_v_505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_506, AgradDistributionTestFixture, AgradDistributionWiener_v_506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_507, AgradDistributionTestFixture, AgradDistributionWiener_v_507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_508, AgradDistributionTestFixture, AgradDistributionWiener_v_508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_509, AgradDistributionTestFixture, AgradDistributionWiener_v_509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_510, AgradDistributionTestFixture, AgradDistributionWiener_v_510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_511, AgradDistributionTestFixture, AgradDistributionWiener_v_511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_512, AgradDistributionTestFixture, AgradDistributionWiener_v_512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_513, AgradDistributionTestFixture, AgradDistributionWiener_v_513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_514, AgradDistributionTestFixture, AgradDistributionWiener_v_514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_515, AgradDistributionTestFixture, AgradDistributionWiener_v_515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_516, AgradDistributionTestFixture, AgradDistributionWiener_v_516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_517, AgradDistributionTestFixture, AgradDistributionWiener_v_517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_518, AgradDistributionTestFixture, AgradDistributionWiener_v_518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_519, AgradDistributionTestFixture, AgradDistributionWiener_v_519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_520, AgradDistributionTestFixture, AgradDistributionWiener_v_520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_521, AgradDistributionTestFixture, AgradDistributionWiener_v_521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_522, AgradDistributionTestFixture, AgradDistributionWiener_v_522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_523, AgradDistributionTestFixture, AgradDistributionWiener_v_523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_524, AgradDistributionTestFixture, AgradDistributionWiener_v_524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_525, AgradDistributionTestFixture, AgradDistributionWiener_v_525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_526, AgradDistributionTestFixture, AgradDistributionWiener_v_526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_527, AgradDistributionTestFixture, AgradDistributionWiener_v_527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_528, AgradDistributionTestFixture, AgradDistributionWiener_v_528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_529, AgradDistributionTestFixture, AgradDistributionWiener_v_529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_530, AgradDistributionTestFixture, AgradDistributionWiener_v_530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_531, AgradDistributionTestFixture, AgradDistributionWiener_v_531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_532, AgradDistributionTestFixture, AgradDistributionWiener_v_532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_533, AgradDistributionTestFixture, AgradDistributionWiener_v_533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_534, AgradDistributionTestFixture, AgradDistributionWiener_v_534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_535, AgradDistributionTestFixture, AgradDistributionWiener_v_535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_536, AgradDistributionTestFixture, AgradDistributionWiener_v_536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_537, AgradDistributionTestFixture, AgradDistributionWiener_v_537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_538, AgradDistributionTestFixture, AgradDistributionWiener_v_538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_539, AgradDistributionTestFixture, AgradDistributionWiener_v_539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_540, AgradDistributionTestFixture, AgradDistributionWiener_v_540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_541, AgradDistributionTestFixture, AgradDistributionWiener_v_541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_542, AgradDistributionTestFixture, AgradDistributionWiener_v_542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_543, AgradDistributionTestFixture, AgradDistributionWiener_v_543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_544, AgradDistributionTestFixture, AgradDistributionWiener_v_544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_545, AgradDistributionTestFixture, AgradDistributionWiener_v_545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_546, AgradDistributionTestFixture, AgradDistributionWiener_v_546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_547, AgradDistributionTestFixture, AgradDistributionWiener_v_547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_548, AgradDistributionTestFixture, AgradDistributionWiener_v_548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_549, AgradDistributionTestFixture, AgradDistributionWiener_v_549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_550, AgradDistributionTestFixture, AgradDistributionWiener_v_550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_551, AgradDistributionTestFixture, AgradDistributionWiener_v_551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_552, AgradDistributionTestFixture, AgradDistributionWiener_v_552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_553, AgradDistributionTestFixture, AgradDistributionWiener_v_553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_554, AgradDistributionTestFixture, AgradDistributionWiener_v_554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_555, AgradDistributionTestFixture, AgradDistributionWiener_v_555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_556, AgradDistributionTestFixture, AgradDistributionWiener_v_556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_557, AgradDistributionTestFixture, AgradDistributionWiener_v_557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_558, AgradDistributionTestFixture, AgradDistributionWiener_v_558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_559, AgradDistributionTestFixture, AgradDistributionWiener_v_559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_560, AgradDistributionTestFixture, AgradDistributionWiener_v_560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_561, AgradDistributionTestFixture, AgradDistributionWiener_v_561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_562, AgradDistributionTestFixture, AgradDistributionWiener_v_562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_563, AgradDistributionTestFixture, AgradDistributionWiener_v_563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_564, AgradDistributionTestFixture, AgradDistributionWiener_v_564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_565, AgradDistributionTestFixture, AgradDistributionWiener_v_565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_566, AgradDistributionTestFixture, AgradDistributionWiener_v_566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_567, AgradDistributionTestFixture, AgradDistributionWiener_v_567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_568, AgradDistributionTestFixture, AgradDistributionWiener_v_568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_569, AgradDistributionTestFixture, AgradDistributionWiener_v_569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_570, AgradDistributionTestFixture, AgradDistributionWiener_v_570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_571, AgradDistributionTestFixture, AgradDistributionWiener_v_571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_572, AgradDistributionTestFixture, AgradDistributionWiener_v_572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_573, AgradDistributionTestFixture, AgradDistributionWiener_v_573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_574, AgradDistributionTestFixture, AgradDistributionWiener_v_574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_575, AgradDistributionTestFixture, AgradDistributionWiener_v_575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_576, AgradDistributionTestFixture, AgradDistributionWiener_v_576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_577, AgradDistributionTestFixture, AgradDistributionWiener_v_577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_578, AgradDistributionTestFixture, AgradDistributionWiener_v_578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_579, AgradDistributionTestFixture, AgradDistributionWiener_v_579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_580, AgradDistributionTestFixture, AgradDistributionWiener_v_580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_581, AgradDistributionTestFixture, AgradDistributionWiener_v_581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_582, AgradDistributionTestFixture, AgradDistributionWiener_v_582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_583, AgradDistributionTestFixture, AgradDistributionWiener_v_583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_584, AgradDistributionTestFixture, AgradDistributionWiener_v_584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_585, AgradDistributionTestFixture, AgradDistributionWiener_v_585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_586, AgradDistributionTestFixture, AgradDistributionWiener_v_586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_587, AgradDistributionTestFixture, AgradDistributionWiener_v_587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_588, AgradDistributionTestFixture, AgradDistributionWiener_v_588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_589, AgradDistributionTestFixture, AgradDistributionWiener_v_589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_590, AgradDistributionTestFixture, AgradDistributionWiener_v_590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_591, AgradDistributionTestFixture, AgradDistributionWiener_v_591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_592, AgradDistributionTestFixture, AgradDistributionWiener_v_592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_593, AgradDistributionTestFixture, AgradDistributionWiener_v_593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_594, AgradDistributionTestFixture, AgradDistributionWiener_v_594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_595, AgradDistributionTestFixture, AgradDistributionWiener_v_595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_596, AgradDistributionTestFixture, AgradDistributionWiener_v_596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_597, AgradDistributionTestFixture, AgradDistributionWiener_v_597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_598, AgradDistributionTestFixture, AgradDistributionWiener_v_598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_599, AgradDistributionTestFixture, AgradDistributionWiener_v_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_600;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_601;
+typedef boost::mpl::vector<double, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_602;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, double, double, empty> type_fd_603;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, double, std::vector<double>, empty> type_fd_604;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_605;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, double, fvar<double>, empty> type_fd_606;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_607;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_608;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<double>, double, empty> type_fd_609;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_610;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_611;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_612;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_613;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_614;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_615;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_616;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_617;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_618;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_619;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_620;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, fvar<double>, double, empty> type_fd_621;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_622;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_623;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_624;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_625;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_626;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_627;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_628;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_629;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_630;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_631;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_632;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_633;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_634;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_635;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_636;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_637;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_638;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fd_639;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_640;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_641;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_642;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_643;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_644;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_645;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_646;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_647;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_648;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_649;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_650;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_651;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_652;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_653;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_654;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_655;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_656;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_657;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_658;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_659;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_660;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_661;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_662;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_663;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_664;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_665;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_666;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_667;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_668;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_669;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_670;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_671;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_672;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_673;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_674;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, double, double, empty> type_fd_675;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, double, std::vector<double>, empty> type_fd_676;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_677;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, double, fvar<double>, empty> type_fd_678;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_679;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_680;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<double>, double, empty> type_fd_681;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_682;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_683;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_684;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_685;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_686;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_687;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_688;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_689;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_690;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_691;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_692;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, fvar<double>, double, empty> type_fd_693;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_694;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_695;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_696;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_697;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_698;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_600> AgradDistributionWiener_fd_600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_601> AgradDistributionWiener_fd_601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_602> AgradDistributionWiener_fd_602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_603> AgradDistributionWiener_fd_603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_604> AgradDistributionWiener_fd_604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_605> AgradDistributionWiener_fd_605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_606> AgradDistributionWiener_fd_606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_607> AgradDistributionWiener_fd_607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_608> AgradDistributionWiener_fd_608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_609> AgradDistributionWiener_fd_609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_610> AgradDistributionWiener_fd_610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_611> AgradDistributionWiener_fd_611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_612> AgradDistributionWiener_fd_612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_613> AgradDistributionWiener_fd_613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_614> AgradDistributionWiener_fd_614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_615> AgradDistributionWiener_fd_615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_616> AgradDistributionWiener_fd_616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_617> AgradDistributionWiener_fd_617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_618> AgradDistributionWiener_fd_618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_619> AgradDistributionWiener_fd_619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_620> AgradDistributionWiener_fd_620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_621> AgradDistributionWiener_fd_621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_622> AgradDistributionWiener_fd_622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_623> AgradDistributionWiener_fd_623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_624> AgradDistributionWiener_fd_624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_625> AgradDistributionWiener_fd_625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_626> AgradDistributionWiener_fd_626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_627> AgradDistributionWiener_fd_627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_628> AgradDistributionWiener_fd_628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_629> AgradDistributionWiener_fd_629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_630> AgradDistributionWiener_fd_630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_631> AgradDistributionWiener_fd_631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_632> AgradDistributionWiener_fd_632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_633> AgradDistributionWiener_fd_633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_634> AgradDistributionWiener_fd_634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_635> AgradDistributionWiener_fd_635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_636> AgradDistributionWiener_fd_636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_637> AgradDistributionWiener_fd_637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_638> AgradDistributionWiener_fd_638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_639> AgradDistributionWiener_fd_639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_640> AgradDistributionWiener_fd_640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_641> AgradDistributionWiener_fd_641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_642> AgradDistributionWiener_fd_642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_643> AgradDistributionWiener_fd_643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_644> AgradDistributionWiener_fd_644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_645> AgradDistributionWiener_fd_645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_646> AgradDistributionWiener_fd_646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_647> AgradDistributionWiener_fd_647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_648> AgradDistributionWiener_fd_648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_649> AgradDistributionWiener_fd_649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_650> AgradDistributionWiener_fd_650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_651> AgradDistributionWiener_fd_651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_652> AgradDistributionWiener_fd_652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_653> AgradDistributionWiener_fd_653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_654> AgradDistributionWiener_fd_654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_655> AgradDistributionWiener_fd_655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_656> AgradDistributionWiener_fd_656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_657> AgradDistributionWiener_fd_657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_658> AgradDistributionWiener_fd_658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_659> AgradDistributionWiener_fd_659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_660> AgradDistributionWiener_fd_660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_661> AgradDistributionWiener_fd_661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_662> AgradDistributionWiener_fd_662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_663> AgradDistributionWiener_fd_663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_664> AgradDistributionWiener_fd_664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_665> AgradDistributionWiener_fd_665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_666> AgradDistributionWiener_fd_666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_667> AgradDistributionWiener_fd_667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_668> AgradDistributionWiener_fd_668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_669> AgradDistributionWiener_fd_669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_670> AgradDistributionWiener_fd_670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_671> AgradDistributionWiener_fd_671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_672> AgradDistributionWiener_fd_672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_673> AgradDistributionWiener_fd_673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_674> AgradDistributionWiener_fd_674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_675> AgradDistributionWiener_fd_675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_676> AgradDistributionWiener_fd_676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_677> AgradDistributionWiener_fd_677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_678> AgradDistributionWiener_fd_678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_679> AgradDistributionWiener_fd_679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_680> AgradDistributionWiener_fd_680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_681> AgradDistributionWiener_fd_681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_682> AgradDistributionWiener_fd_682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_683> AgradDistributionWiener_fd_683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_684> AgradDistributionWiener_fd_684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_685> AgradDistributionWiener_fd_685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_686> AgradDistributionWiener_fd_686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_687> AgradDistributionWiener_fd_687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_688> AgradDistributionWiener_fd_688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_689> AgradDistributionWiener_fd_689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_690> AgradDistributionWiener_fd_690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_691> AgradDistributionWiener_fd_691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_692> AgradDistributionWiener_fd_692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_693> AgradDistributionWiener_fd_693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_694> AgradDistributionWiener_fd_694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_695> AgradDistributionWiener_fd_695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_696> AgradDistributionWiener_fd_696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_697> AgradDistributionWiener_fd_697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_698> AgradDistributionWiener_fd_698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_699> AgradDistributionWiener_fd_699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_600, AgradDistributionTestFixture, AgradDistributionWiener_fd_600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_601, AgradDistributionTestFixture, AgradDistributionWiener_fd_601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_602, AgradDistributionTestFixture, AgradDistributionWiener_fd_602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_603, AgradDistributionTestFixture, AgradDistributionWiener_fd_603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_604, AgradDistributionTestFixture, AgradDistributionWiener_fd_604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_605, AgradDistributionTestFixture, AgradDistributionWiener_fd_605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_606, AgradDistributionTestFixture, AgradDistributionWiener_fd_606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_607, AgradDistributionTestFixture, AgradDistributionWiener_fd_607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_608, AgradDistributionTestFixture, AgradDistributionWiener_fd_608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_609, AgradDistributionTestFixture, AgradDistributionWiener_fd_609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_610, AgradDistributionTestFixture, AgradDistributionWiener_fd_610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_611, AgradDistributionTestFixture, AgradDistributionWiener_fd_611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_612, AgradDistributionTestFixture, AgradDistributionWiener_fd_612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_613, AgradDistributionTestFixture, AgradDistributionWiener_fd_613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_614, AgradDistributionTestFixture, AgradDistributionWiener_fd_614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_615, AgradDistributionTestFixture, AgradDistributionWiener_fd_615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_616, AgradDistributionTestFixture, AgradDistributionWiener_fd_616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_617, AgradDistributionTestFixture, AgradDistributionWiener_fd_617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_618, AgradDistributionTestFixture, AgradDistributionWiener_fd_618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_619, AgradDistributionTestFixture, AgradDistributionWiener_fd_619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_620, AgradDistributionTestFixture, AgradDistributionWiener_fd_620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_621, AgradDistributionTestFixture, AgradDistributionWiener_fd_621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_622, AgradDistributionTestFixture, AgradDistributionWiener_fd_622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_623, AgradDistributionTestFixture, AgradDistributionWiener_fd_623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_624, AgradDistributionTestFixture, AgradDistributionWiener_fd_624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_625, AgradDistributionTestFixture, AgradDistributionWiener_fd_625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_626, AgradDistributionTestFixture, AgradDistributionWiener_fd_626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_627, AgradDistributionTestFixture, AgradDistributionWiener_fd_627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_628, AgradDistributionTestFixture, AgradDistributionWiener_fd_628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_629, AgradDistributionTestFixture, AgradDistributionWiener_fd_629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_630, AgradDistributionTestFixture, AgradDistributionWiener_fd_630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_631, AgradDistributionTestFixture, AgradDistributionWiener_fd_631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_632, AgradDistributionTestFixture, AgradDistributionWiener_fd_632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_633, AgradDistributionTestFixture, AgradDistributionWiener_fd_633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_634, AgradDistributionTestFixture, AgradDistributionWiener_fd_634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_635, AgradDistributionTestFixture, AgradDistributionWiener_fd_635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_636, AgradDistributionTestFixture, AgradDistributionWiener_fd_636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_637, AgradDistributionTestFixture, AgradDistributionWiener_fd_637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_638, AgradDistributionTestFixture, AgradDistributionWiener_fd_638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_639, AgradDistributionTestFixture, AgradDistributionWiener_fd_639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_640, AgradDistributionTestFixture, AgradDistributionWiener_fd_640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_641, AgradDistributionTestFixture, AgradDistributionWiener_fd_641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_642, AgradDistributionTestFixture, AgradDistributionWiener_fd_642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_643, AgradDistributionTestFixture, AgradDistributionWiener_fd_643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_644, AgradDistributionTestFixture, AgradDistributionWiener_fd_644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_645, AgradDistributionTestFixture, AgradDistributionWiener_fd_645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_646, AgradDistributionTestFixture, AgradDistributionWiener_fd_646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_647, AgradDistributionTestFixture, AgradDistributionWiener_fd_647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_648, AgradDistributionTestFixture, AgradDistributionWiener_fd_648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_649, AgradDistributionTestFixture, AgradDistributionWiener_fd_649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_650, AgradDistributionTestFixture, AgradDistributionWiener_fd_650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_651, AgradDistributionTestFixture, AgradDistributionWiener_fd_651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_652, AgradDistributionTestFixture, AgradDistributionWiener_fd_652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_653, AgradDistributionTestFixture, AgradDistributionWiener_fd_653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_654, AgradDistributionTestFixture, AgradDistributionWiener_fd_654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_655, AgradDistributionTestFixture, AgradDistributionWiener_fd_655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_656, AgradDistributionTestFixture, AgradDistributionWiener_fd_656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_657, AgradDistributionTestFixture, AgradDistributionWiener_fd_657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_658, AgradDistributionTestFixture, AgradDistributionWiener_fd_658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_659, AgradDistributionTestFixture, AgradDistributionWiener_fd_659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_660, AgradDistributionTestFixture, AgradDistributionWiener_fd_660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_661, AgradDistributionTestFixture, AgradDistributionWiener_fd_661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_662, AgradDistributionTestFixture, AgradDistributionWiener_fd_662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_663, AgradDistributionTestFixture, AgradDistributionWiener_fd_663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_664, AgradDistributionTestFixture, AgradDistributionWiener_fd_664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_665, AgradDistributionTestFixture, AgradDistributionWiener_fd_665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_666, AgradDistributionTestFixture, AgradDistributionWiener_fd_666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_667, AgradDistributionTestFixture, AgradDistributionWiener_fd_667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_668, AgradDistributionTestFixture, AgradDistributionWiener_fd_668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_669, AgradDistributionTestFixture, AgradDistributionWiener_fd_669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_670, AgradDistributionTestFixture, AgradDistributionWiener_fd_670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_671, AgradDistributionTestFixture, AgradDistributionWiener_fd_671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_672, AgradDistributionTestFixture, AgradDistributionWiener_fd_672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_673, AgradDistributionTestFixture, AgradDistributionWiener_fd_673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_674, AgradDistributionTestFixture, AgradDistributionWiener_fd_674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_675, AgradDistributionTestFixture, AgradDistributionWiener_fd_675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_676, AgradDistributionTestFixture, AgradDistributionWiener_fd_676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_677, AgradDistributionTestFixture, AgradDistributionWiener_fd_677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_678, AgradDistributionTestFixture, AgradDistributionWiener_fd_678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_679, AgradDistributionTestFixture, AgradDistributionWiener_fd_679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_680, AgradDistributionTestFixture, AgradDistributionWiener_fd_680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_681, AgradDistributionTestFixture, AgradDistributionWiener_fd_681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_682, AgradDistributionTestFixture, AgradDistributionWiener_fd_682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_683, AgradDistributionTestFixture, AgradDistributionWiener_fd_683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_684, AgradDistributionTestFixture, AgradDistributionWiener_fd_684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_685, AgradDistributionTestFixture, AgradDistributionWiener_fd_685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_686, AgradDistributionTestFixture, AgradDistributionWiener_fd_686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_687, AgradDistributionTestFixture, AgradDistributionWiener_fd_687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_688, AgradDistributionTestFixture, AgradDistributionWiener_fd_688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_689, AgradDistributionTestFixture, AgradDistributionWiener_fd_689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_690, AgradDistributionTestFixture, AgradDistributionWiener_fd_690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_691, AgradDistributionTestFixture, AgradDistributionWiener_fd_691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_692, AgradDistributionTestFixture, AgradDistributionWiener_fd_692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_693, AgradDistributionTestFixture, AgradDistributionWiener_fd_693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_694, AgradDistributionTestFixture, AgradDistributionWiener_fd_694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_695, AgradDistributionTestFixture, AgradDistributionWiener_fd_695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_696, AgradDistributionTestFixture, AgradDistributionWiener_fd_696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_697, AgradDistributionTestFixture, AgradDistributionWiener_fd_697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_698, AgradDistributionTestFixture, AgradDistributionWiener_fd_698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_699, AgradDistributionTestFixture, AgradDistributionWiener_fd_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_600;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_601;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_602;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, double, double, empty> type_ffd_603;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, double, std::vector<double>, empty> type_ffd_604;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_605;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_606;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_607;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_608;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, double, empty> type_ffd_609;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_610;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_611;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_612;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_613;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_614;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_615;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_616;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_617;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_618;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_619;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_620;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_621;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_622;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_623;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_624;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_625;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_626;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_627;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_628;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_629;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_630;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_631;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_632;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_633;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_634;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_635;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_636;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_637;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_638;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_639;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_640;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_641;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_642;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_643;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_644;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_645;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_646;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_647;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_648;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_649;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_650;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_651;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_652;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_653;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_654;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_655;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_656;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_657;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_658;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_659;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_660;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_661;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_662;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_663;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_664;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_665;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_666;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_667;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_668;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_669;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_670;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_671;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_672;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_673;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_674;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, double, double, empty> type_ffd_675;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_676;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_677;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_678;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_679;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_680;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_681;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_682;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_683;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_684;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_685;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_686;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_687;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_688;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_689;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_690;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_691;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_692;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_693;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_694;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_695;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_696;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_697;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_698;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_600> AgradDistributionWiener_ffd_600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_601> AgradDistributionWiener_ffd_601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_602> AgradDistributionWiener_ffd_602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_603> AgradDistributionWiener_ffd_603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_604> AgradDistributionWiener_ffd_604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_605> AgradDistributionWiener_ffd_605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_606> AgradDistributionWiener_ffd_606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_607> AgradDistributionWiener_ffd_607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_608> AgradDistributionWiener_ffd_608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_609> AgradDistributionWiener_ffd_609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_610> AgradDistributionWiener_ffd_610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_611> AgradDistributionWiener_ffd_611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_612> AgradDistributionWiener_ffd_612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_613> AgradDistributionWiener_ffd_613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_614> AgradDistributionWiener_ffd_614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_615> AgradDistributionWiener_ffd_615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_616> AgradDistributionWiener_ffd_616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_617> AgradDistributionWiener_ffd_617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_618> AgradDistributionWiener_ffd_618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_619> AgradDistributionWiener_ffd_619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_620> AgradDistributionWiener_ffd_620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_621> AgradDistributionWiener_ffd_621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_622> AgradDistributionWiener_ffd_622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_623> AgradDistributionWiener_ffd_623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_624> AgradDistributionWiener_ffd_624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_625> AgradDistributionWiener_ffd_625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_626> AgradDistributionWiener_ffd_626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_627> AgradDistributionWiener_ffd_627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_628> AgradDistributionWiener_ffd_628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_629> AgradDistributionWiener_ffd_629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_630> AgradDistributionWiener_ffd_630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_631> AgradDistributionWiener_ffd_631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_632> AgradDistributionWiener_ffd_632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_633> AgradDistributionWiener_ffd_633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_634> AgradDistributionWiener_ffd_634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_635> AgradDistributionWiener_ffd_635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_636> AgradDistributionWiener_ffd_636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_637> AgradDistributionWiener_ffd_637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_638> AgradDistributionWiener_ffd_638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_639> AgradDistributionWiener_ffd_639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_640> AgradDistributionWiener_ffd_640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_641> AgradDistributionWiener_ffd_641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_642> AgradDistributionWiener_ffd_642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_643> AgradDistributionWiener_ffd_643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_644> AgradDistributionWiener_ffd_644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_645> AgradDistributionWiener_ffd_645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_646> AgradDistributionWiener_ffd_646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_647> AgradDistributionWiener_ffd_647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_648> AgradDistributionWiener_ffd_648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_649> AgradDistributionWiener_ffd_649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_650> AgradDistributionWiener_ffd_650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_651> AgradDistributionWiener_ffd_651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_652> AgradDistributionWiener_ffd_652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_653> AgradDistributionWiener_ffd_653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_654> AgradDistributionWiener_ffd_654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_655> AgradDistributionWiener_ffd_655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_656> AgradDistributionWiener_ffd_656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_657> AgradDistributionWiener_ffd_657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_658> AgradDistributionWiener_ffd_658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_659> AgradDistributionWiener_ffd_659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_660> AgradDistributionWiener_ffd_660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_661> AgradDistributionWiener_ffd_661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_662> AgradDistributionWiener_ffd_662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_663> AgradDistributionWiener_ffd_663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_664> AgradDistributionWiener_ffd_664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_665> AgradDistributionWiener_ffd_665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_666> AgradDistributionWiener_ffd_666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_667> AgradDistributionWiener_ffd_667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_668> AgradDistributionWiener_ffd_668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_669> AgradDistributionWiener_ffd_669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_670> AgradDistributionWiener_ffd_670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_671> AgradDistributionWiener_ffd_671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_672> AgradDistributionWiener_ffd_672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_673> AgradDistributionWiener_ffd_673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_674> AgradDistributionWiener_ffd_674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_675> AgradDistributionWiener_ffd_675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_676> AgradDistributionWiener_ffd_676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_677> AgradDistributionWiener_ffd_677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_678> AgradDistributionWiener_ffd_678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_679> AgradDistributionWiener_ffd_679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_680> AgradDistributionWiener_ffd_680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_681> AgradDistributionWiener_ffd_681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_682> AgradDistributionWiener_ffd_682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_683> AgradDistributionWiener_ffd_683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_684> AgradDistributionWiener_ffd_684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_685> AgradDistributionWiener_ffd_685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_686> AgradDistributionWiener_ffd_686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_687> AgradDistributionWiener_ffd_687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_688> AgradDistributionWiener_ffd_688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_689> AgradDistributionWiener_ffd_689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_690> AgradDistributionWiener_ffd_690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_691> AgradDistributionWiener_ffd_691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_692> AgradDistributionWiener_ffd_692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_693> AgradDistributionWiener_ffd_693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_694> AgradDistributionWiener_ffd_694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_695> AgradDistributionWiener_ffd_695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_696> AgradDistributionWiener_ffd_696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_697> AgradDistributionWiener_ffd_697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_698> AgradDistributionWiener_ffd_698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_699> AgradDistributionWiener_ffd_699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_600, AgradDistributionTestFixture, AgradDistributionWiener_ffd_600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_601, AgradDistributionTestFixture, AgradDistributionWiener_ffd_601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_602, AgradDistributionTestFixture, AgradDistributionWiener_ffd_602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_603, AgradDistributionTestFixture, AgradDistributionWiener_ffd_603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_604, AgradDistributionTestFixture, AgradDistributionWiener_ffd_604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_605, AgradDistributionTestFixture, AgradDistributionWiener_ffd_605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_606, AgradDistributionTestFixture, AgradDistributionWiener_ffd_606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_607, AgradDistributionTestFixture, AgradDistributionWiener_ffd_607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_608, AgradDistributionTestFixture, AgradDistributionWiener_ffd_608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_609, AgradDistributionTestFixture, AgradDistributionWiener_ffd_609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_610, AgradDistributionTestFixture, AgradDistributionWiener_ffd_610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_611, AgradDistributionTestFixture, AgradDistributionWiener_ffd_611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_612, AgradDistributionTestFixture, AgradDistributionWiener_ffd_612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_613, AgradDistributionTestFixture, AgradDistributionWiener_ffd_613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_614, AgradDistributionTestFixture, AgradDistributionWiener_ffd_614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_615, AgradDistributionTestFixture, AgradDistributionWiener_ffd_615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_616, AgradDistributionTestFixture, AgradDistributionWiener_ffd_616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_617, AgradDistributionTestFixture, AgradDistributionWiener_ffd_617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_618, AgradDistributionTestFixture, AgradDistributionWiener_ffd_618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_619, AgradDistributionTestFixture, AgradDistributionWiener_ffd_619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_620, AgradDistributionTestFixture, AgradDistributionWiener_ffd_620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_621, AgradDistributionTestFixture, AgradDistributionWiener_ffd_621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_622, AgradDistributionTestFixture, AgradDistributionWiener_ffd_622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_623, AgradDistributionTestFixture, AgradDistributionWiener_ffd_623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_624, AgradDistributionTestFixture, AgradDistributionWiener_ffd_624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_625, AgradDistributionTestFixture, AgradDistributionWiener_ffd_625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_626, AgradDistributionTestFixture, AgradDistributionWiener_ffd_626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_627, AgradDistributionTestFixture, AgradDistributionWiener_ffd_627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_628, AgradDistributionTestFixture, AgradDistributionWiener_ffd_628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_629, AgradDistributionTestFixture, AgradDistributionWiener_ffd_629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_630, AgradDistributionTestFixture, AgradDistributionWiener_ffd_630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_631, AgradDistributionTestFixture, AgradDistributionWiener_ffd_631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_632, AgradDistributionTestFixture, AgradDistributionWiener_ffd_632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_633, AgradDistributionTestFixture, AgradDistributionWiener_ffd_633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_634, AgradDistributionTestFixture, AgradDistributionWiener_ffd_634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_635, AgradDistributionTestFixture, AgradDistributionWiener_ffd_635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_636, AgradDistributionTestFixture, AgradDistributionWiener_ffd_636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_637, AgradDistributionTestFixture, AgradDistributionWiener_ffd_637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_638, AgradDistributionTestFixture, AgradDistributionWiener_ffd_638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_639, AgradDistributionTestFixture, AgradDistributionWiener_ffd_639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_640, AgradDistributionTestFixture, AgradDistributionWiener_ffd_640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_641, AgradDistributionTestFixture, AgradDistributionWiener_ffd_641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_642, AgradDistributionTestFixture, AgradDistributionWiener_ffd_642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_643, AgradDistributionTestFixture, AgradDistributionWiener_ffd_643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_644, AgradDistributionTestFixture, AgradDistributionWiener_ffd_644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_645, AgradDistributionTestFixture, AgradDistributionWiener_ffd_645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_646, AgradDistributionTestFixture, AgradDistributionWiener_ffd_646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_647, AgradDistributionTestFixture, AgradDistributionWiener_ffd_647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_648, AgradDistributionTestFixture, AgradDistributionWiener_ffd_648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_649, AgradDistributionTestFixture, AgradDistributionWiener_ffd_649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_650, AgradDistributionTestFixture, AgradDistributionWiener_ffd_650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_651, AgradDistributionTestFixture, AgradDistributionWiener_ffd_651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_652, AgradDistributionTestFixture, AgradDistributionWiener_ffd_652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_653, AgradDistributionTestFixture, AgradDistributionWiener_ffd_653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_654, AgradDistributionTestFixture, AgradDistributionWiener_ffd_654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_655, AgradDistributionTestFixture, AgradDistributionWiener_ffd_655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_656, AgradDistributionTestFixture, AgradDistributionWiener_ffd_656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_657, AgradDistributionTestFixture, AgradDistributionWiener_ffd_657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_658, AgradDistributionTestFixture, AgradDistributionWiener_ffd_658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_659, AgradDistributionTestFixture, AgradDistributionWiener_ffd_659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_660, AgradDistributionTestFixture, AgradDistributionWiener_ffd_660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_661, AgradDistributionTestFixture, AgradDistributionWiener_ffd_661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_662, AgradDistributionTestFixture, AgradDistributionWiener_ffd_662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_663, AgradDistributionTestFixture, AgradDistributionWiener_ffd_663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_664, AgradDistributionTestFixture, AgradDistributionWiener_ffd_664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_665, AgradDistributionTestFixture, AgradDistributionWiener_ffd_665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_666, AgradDistributionTestFixture, AgradDistributionWiener_ffd_666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_667, AgradDistributionTestFixture, AgradDistributionWiener_ffd_667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_668, AgradDistributionTestFixture, AgradDistributionWiener_ffd_668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_669, AgradDistributionTestFixture, AgradDistributionWiener_ffd_669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_670, AgradDistributionTestFixture, AgradDistributionWiener_ffd_670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_671, AgradDistributionTestFixture, AgradDistributionWiener_ffd_671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_672, AgradDistributionTestFixture, AgradDistributionWiener_ffd_672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_673, AgradDistributionTestFixture, AgradDistributionWiener_ffd_673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_674, AgradDistributionTestFixture, AgradDistributionWiener_ffd_674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_675, AgradDistributionTestFixture, AgradDistributionWiener_ffd_675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_676, AgradDistributionTestFixture, AgradDistributionWiener_ffd_676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_677, AgradDistributionTestFixture, AgradDistributionWiener_ffd_677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_678, AgradDistributionTestFixture, AgradDistributionWiener_ffd_678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_679, AgradDistributionTestFixture, AgradDistributionWiener_ffd_679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_680, AgradDistributionTestFixture, AgradDistributionWiener_ffd_680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_681, AgradDistributionTestFixture, AgradDistributionWiener_ffd_681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_682, AgradDistributionTestFixture, AgradDistributionWiener_ffd_682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_683, AgradDistributionTestFixture, AgradDistributionWiener_ffd_683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_684, AgradDistributionTestFixture, AgradDistributionWiener_ffd_684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_685, AgradDistributionTestFixture, AgradDistributionWiener_ffd_685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_686, AgradDistributionTestFixture, AgradDistributionWiener_ffd_686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_687, AgradDistributionTestFixture, AgradDistributionWiener_ffd_687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_688, AgradDistributionTestFixture, AgradDistributionWiener_ffd_688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_689, AgradDistributionTestFixture, AgradDistributionWiener_ffd_689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_690, AgradDistributionTestFixture, AgradDistributionWiener_ffd_690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_691, AgradDistributionTestFixture, AgradDistributionWiener_ffd_691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_692, AgradDistributionTestFixture, AgradDistributionWiener_ffd_692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_693, AgradDistributionTestFixture, AgradDistributionWiener_ffd_693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_694, AgradDistributionTestFixture, AgradDistributionWiener_ffd_694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_695, AgradDistributionTestFixture, AgradDistributionWiener_ffd_695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_696, AgradDistributionTestFixture, AgradDistributionWiener_ffd_696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_697, AgradDistributionTestFixture, AgradDistributionWiener_ffd_697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_698, AgradDistributionTestFixture, AgradDistributionWiener_ffd_698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_699, AgradDistributionTestFixture, AgradDistributionWiener_ffd_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_600;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_601;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_602;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, double, double, empty> type_ffv_603;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty> type_ffv_604;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_605;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_606;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_607;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_608;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty> type_ffv_609;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_610;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_611;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_612;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_613;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_614;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_615;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_616;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_617;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_618;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_619;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_620;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_621;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_622;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_623;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_624;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_625;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_626;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_627;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_628;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_629;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_630;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_631;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_632;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_633;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_634;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_635;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_636;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_637;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_638;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_639;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_640;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_641;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_642;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_643;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_644;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_645;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_646;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_647;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_648;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_649;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_650;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_651;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_652;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_653;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_654;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_655;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_656;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_657;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_658;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_659;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_660;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_661;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_662;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_663;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_664;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_665;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_666;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_667;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_668;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_669;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_670;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_671;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_672;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_673;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_674;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty> type_ffv_675;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_676;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_677;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_678;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_679;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_680;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_681;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_682;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_683;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_684;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_685;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_686;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_687;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_688;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_689;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_690;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_691;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_692;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_693;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_694;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_695;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_696;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_697;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_698;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_600> AgradDistributionWiener_ffv_600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_601> AgradDistributionWiener_ffv_601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_602> AgradDistributionWiener_ffv_602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_603> AgradDistributionWiener_ffv_603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_604> AgradDistributionWiener_ffv_604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_605> AgradDistributionWiener_ffv_605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_606> AgradDistributionWiener_ffv_606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_607> AgradDistributionWiener_ffv_607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_608> AgradDistributionWiener_ffv_608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_609> AgradDistributionWiener_ffv_609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_610> AgradDistributionWiener_ffv_610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_611> AgradDistributionWiener_ffv_611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_612> AgradDistributionWiener_ffv_612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_613> AgradDistributionWiener_ffv_613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_614> AgradDistributionWiener_ffv_614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_615> AgradDistributionWiener_ffv_615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_616> AgradDistributionWiener_ffv_616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_617> AgradDistributionWiener_ffv_617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_618> AgradDistributionWiener_ffv_618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_619> AgradDistributionWiener_ffv_619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_620> AgradDistributionWiener_ffv_620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_621> AgradDistributionWiener_ffv_621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_622> AgradDistributionWiener_ffv_622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_623> AgradDistributionWiener_ffv_623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_624> AgradDistributionWiener_ffv_624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_625> AgradDistributionWiener_ffv_625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_626> AgradDistributionWiener_ffv_626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_627> AgradDistributionWiener_ffv_627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_628> AgradDistributionWiener_ffv_628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_629> AgradDistributionWiener_ffv_629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_630> AgradDistributionWiener_ffv_630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_631> AgradDistributionWiener_ffv_631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_632> AgradDistributionWiener_ffv_632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_633> AgradDistributionWiener_ffv_633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_634> AgradDistributionWiener_ffv_634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_635> AgradDistributionWiener_ffv_635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_636> AgradDistributionWiener_ffv_636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_637> AgradDistributionWiener_ffv_637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_638> AgradDistributionWiener_ffv_638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_639> AgradDistributionWiener_ffv_639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_640> AgradDistributionWiener_ffv_640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_641> AgradDistributionWiener_ffv_641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_642> AgradDistributionWiener_ffv_642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_643> AgradDistributionWiener_ffv_643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_644> AgradDistributionWiener_ffv_644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_645> AgradDistributionWiener_ffv_645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_646> AgradDistributionWiener_ffv_646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_647> AgradDistributionWiener_ffv_647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_648> AgradDistributionWiener_ffv_648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_649> AgradDistributionWiener_ffv_649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_650> AgradDistributionWiener_ffv_650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_651> AgradDistributionWiener_ffv_651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_652> AgradDistributionWiener_ffv_652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_653> AgradDistributionWiener_ffv_653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_654> AgradDistributionWiener_ffv_654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_655> AgradDistributionWiener_ffv_655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_656> AgradDistributionWiener_ffv_656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_657> AgradDistributionWiener_ffv_657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_658> AgradDistributionWiener_ffv_658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_659> AgradDistributionWiener_ffv_659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_660> AgradDistributionWiener_ffv_660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_661> AgradDistributionWiener_ffv_661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_662> AgradDistributionWiener_ffv_662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_663> AgradDistributionWiener_ffv_663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_664> AgradDistributionWiener_ffv_664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_665> AgradDistributionWiener_ffv_665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_666> AgradDistributionWiener_ffv_666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_667> AgradDistributionWiener_ffv_667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_668> AgradDistributionWiener_ffv_668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_669> AgradDistributionWiener_ffv_669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_670> AgradDistributionWiener_ffv_670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_671> AgradDistributionWiener_ffv_671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_672> AgradDistributionWiener_ffv_672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_673> AgradDistributionWiener_ffv_673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_674> AgradDistributionWiener_ffv_674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_675> AgradDistributionWiener_ffv_675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_676> AgradDistributionWiener_ffv_676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_677> AgradDistributionWiener_ffv_677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_678> AgradDistributionWiener_ffv_678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_679> AgradDistributionWiener_ffv_679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_680> AgradDistributionWiener_ffv_680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_681> AgradDistributionWiener_ffv_681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_682> AgradDistributionWiener_ffv_682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_683> AgradDistributionWiener_ffv_683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_684> AgradDistributionWiener_ffv_684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_685> AgradDistributionWiener_ffv_685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_686> AgradDistributionWiener_ffv_686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_687> AgradDistributionWiener_ffv_687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_688> AgradDistributionWiener_ffv_688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_689> AgradDistributionWiener_ffv_689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_690> AgradDistributionWiener_ffv_690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_691> AgradDistributionWiener_ffv_691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_692> AgradDistributionWiener_ffv_692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_693> AgradDistributionWiener_ffv_693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_694> AgradDistributionWiener_ffv_694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_695> AgradDistributionWiener_ffv_695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_696> AgradDistributionWiener_ffv_696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_697> AgradDistributionWiener_ffv_697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_698> AgradDistributionWiener_ffv_698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_699> AgradDistributionWiener_ffv_699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_600, AgradDistributionTestFixture, AgradDistributionWiener_ffv_600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_601, AgradDistributionTestFixture, AgradDistributionWiener_ffv_601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_602, AgradDistributionTestFixture, AgradDistributionWiener_ffv_602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_603, AgradDistributionTestFixture, AgradDistributionWiener_ffv_603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_604, AgradDistributionTestFixture, AgradDistributionWiener_ffv_604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_605, AgradDistributionTestFixture, AgradDistributionWiener_ffv_605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_606, AgradDistributionTestFixture, AgradDistributionWiener_ffv_606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_607, AgradDistributionTestFixture, AgradDistributionWiener_ffv_607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_608, AgradDistributionTestFixture, AgradDistributionWiener_ffv_608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_609, AgradDistributionTestFixture, AgradDistributionWiener_ffv_609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_610, AgradDistributionTestFixture, AgradDistributionWiener_ffv_610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_611, AgradDistributionTestFixture, AgradDistributionWiener_ffv_611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_612, AgradDistributionTestFixture, AgradDistributionWiener_ffv_612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_613, AgradDistributionTestFixture, AgradDistributionWiener_ffv_613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_614, AgradDistributionTestFixture, AgradDistributionWiener_ffv_614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_615, AgradDistributionTestFixture, AgradDistributionWiener_ffv_615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_616, AgradDistributionTestFixture, AgradDistributionWiener_ffv_616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_617, AgradDistributionTestFixture, AgradDistributionWiener_ffv_617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_618, AgradDistributionTestFixture, AgradDistributionWiener_ffv_618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_619, AgradDistributionTestFixture, AgradDistributionWiener_ffv_619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_620, AgradDistributionTestFixture, AgradDistributionWiener_ffv_620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_621, AgradDistributionTestFixture, AgradDistributionWiener_ffv_621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_622, AgradDistributionTestFixture, AgradDistributionWiener_ffv_622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_623, AgradDistributionTestFixture, AgradDistributionWiener_ffv_623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_624, AgradDistributionTestFixture, AgradDistributionWiener_ffv_624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_625, AgradDistributionTestFixture, AgradDistributionWiener_ffv_625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_626, AgradDistributionTestFixture, AgradDistributionWiener_ffv_626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_627, AgradDistributionTestFixture, AgradDistributionWiener_ffv_627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_628, AgradDistributionTestFixture, AgradDistributionWiener_ffv_628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_629, AgradDistributionTestFixture, AgradDistributionWiener_ffv_629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_630, AgradDistributionTestFixture, AgradDistributionWiener_ffv_630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_631, AgradDistributionTestFixture, AgradDistributionWiener_ffv_631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_632, AgradDistributionTestFixture, AgradDistributionWiener_ffv_632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_633, AgradDistributionTestFixture, AgradDistributionWiener_ffv_633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_634, AgradDistributionTestFixture, AgradDistributionWiener_ffv_634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_635, AgradDistributionTestFixture, AgradDistributionWiener_ffv_635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_636, AgradDistributionTestFixture, AgradDistributionWiener_ffv_636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_637, AgradDistributionTestFixture, AgradDistributionWiener_ffv_637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_638, AgradDistributionTestFixture, AgradDistributionWiener_ffv_638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_639, AgradDistributionTestFixture, AgradDistributionWiener_ffv_639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_640, AgradDistributionTestFixture, AgradDistributionWiener_ffv_640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_641, AgradDistributionTestFixture, AgradDistributionWiener_ffv_641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_642, AgradDistributionTestFixture, AgradDistributionWiener_ffv_642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_643, AgradDistributionTestFixture, AgradDistributionWiener_ffv_643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_644, AgradDistributionTestFixture, AgradDistributionWiener_ffv_644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_645, AgradDistributionTestFixture, AgradDistributionWiener_ffv_645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_646, AgradDistributionTestFixture, AgradDistributionWiener_ffv_646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_647, AgradDistributionTestFixture, AgradDistributionWiener_ffv_647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_648, AgradDistributionTestFixture, AgradDistributionWiener_ffv_648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_649, AgradDistributionTestFixture, AgradDistributionWiener_ffv_649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_650, AgradDistributionTestFixture, AgradDistributionWiener_ffv_650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_651, AgradDistributionTestFixture, AgradDistributionWiener_ffv_651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_652, AgradDistributionTestFixture, AgradDistributionWiener_ffv_652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_653, AgradDistributionTestFixture, AgradDistributionWiener_ffv_653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_654, AgradDistributionTestFixture, AgradDistributionWiener_ffv_654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_655, AgradDistributionTestFixture, AgradDistributionWiener_ffv_655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_656, AgradDistributionTestFixture, AgradDistributionWiener_ffv_656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_657, AgradDistributionTestFixture, AgradDistributionWiener_ffv_657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_658, AgradDistributionTestFixture, AgradDistributionWiener_ffv_658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_659, AgradDistributionTestFixture, AgradDistributionWiener_ffv_659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_660, AgradDistributionTestFixture, AgradDistributionWiener_ffv_660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_661, AgradDistributionTestFixture, AgradDistributionWiener_ffv_661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_662, AgradDistributionTestFixture, AgradDistributionWiener_ffv_662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_663, AgradDistributionTestFixture, AgradDistributionWiener_ffv_663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_664, AgradDistributionTestFixture, AgradDistributionWiener_ffv_664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_665, AgradDistributionTestFixture, AgradDistributionWiener_ffv_665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_666, AgradDistributionTestFixture, AgradDistributionWiener_ffv_666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_667, AgradDistributionTestFixture, AgradDistributionWiener_ffv_667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_668, AgradDistributionTestFixture, AgradDistributionWiener_ffv_668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_669, AgradDistributionTestFixture, AgradDistributionWiener_ffv_669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_670, AgradDistributionTestFixture, AgradDistributionWiener_ffv_670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_671, AgradDistributionTestFixture, AgradDistributionWiener_ffv_671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_672, AgradDistributionTestFixture, AgradDistributionWiener_ffv_672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_673, AgradDistributionTestFixture, AgradDistributionWiener_ffv_673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_674, AgradDistributionTestFixture, AgradDistributionWiener_ffv_674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_675, AgradDistributionTestFixture, AgradDistributionWiener_ffv_675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_676, AgradDistributionTestFixture, AgradDistributionWiener_ffv_676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_677, AgradDistributionTestFixture, AgradDistributionWiener_ffv_677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_678, AgradDistributionTestFixture, AgradDistributionWiener_ffv_678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_679, AgradDistributionTestFixture, AgradDistributionWiener_ffv_679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_680, AgradDistributionTestFixture, AgradDistributionWiener_ffv_680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_681, AgradDistributionTestFixture, AgradDistributionWiener_ffv_681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_682, AgradDistributionTestFixture, AgradDistributionWiener_ffv_682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_683, AgradDistributionTestFixture, AgradDistributionWiener_ffv_683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_684, AgradDistributionTestFixture, AgradDistributionWiener_ffv_684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_685, AgradDistributionTestFixture, AgradDistributionWiener_ffv_685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_686, AgradDistributionTestFixture, AgradDistributionWiener_ffv_686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_687, AgradDistributionTestFixture, AgradDistributionWiener_ffv_687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_688, AgradDistributionTestFixture, AgradDistributionWiener_ffv_688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_689, AgradDistributionTestFixture, AgradDistributionWiener_ffv_689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_690, AgradDistributionTestFixture, AgradDistributionWiener_ffv_690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_691, AgradDistributionTestFixture, AgradDistributionWiener_ffv_691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_692, AgradDistributionTestFixture, AgradDistributionWiener_ffv_692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_693, AgradDistributionTestFixture, AgradDistributionWiener_ffv_693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_694, AgradDistributionTestFixture, AgradDistributionWiener_ffv_694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_695, AgradDistributionTestFixture, AgradDistributionWiener_ffv_695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_696, AgradDistributionTestFixture, AgradDistributionWiener_ffv_696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_697, AgradDistributionTestFixture, AgradDistributionWiener_ffv_697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_698, AgradDistributionTestFixture, AgradDistributionWiener_ffv_698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_699, AgradDistributionTestFixture, AgradDistributionWiener_ffv_699);
+
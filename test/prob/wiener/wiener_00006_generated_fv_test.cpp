@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_600;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_601;
+typedef boost::mpl::vector<double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_602;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, double, double, empty> type_fv_603;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, double, std::vector<double>, empty> type_fv_604;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_605;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, double, fvar<var>, empty> type_fv_606;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_607;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_608;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<double>, double, empty> type_fv_609;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_610;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_611;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_612;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_613;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_614;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_615;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_616;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_617;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_618;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_619;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_620;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, fvar<var>, double, empty> type_fv_621;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_622;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_623;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_624;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_625;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_626;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_627;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_628;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_629;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_630;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_631;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_632;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_633;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_634;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_635;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_636;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_637;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_638;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_639;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_640;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_641;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_642;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_643;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_644;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_645;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_646;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_647;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_648;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_649;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_650;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_651;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_652;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_653;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_654;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_655;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_656;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_657;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_658;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_659;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_660;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_661;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_662;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_663;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_664;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_665;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_666;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_667;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_668;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_669;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_670;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_671;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_672;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_673;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_674;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, double, double, empty> type_fv_675;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, double, std::vector<double>, empty> type_fv_676;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_677;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, double, fvar<var>, empty> type_fv_678;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_679;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_680;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<double>, double, empty> type_fv_681;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_682;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_683;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_684;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_685;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_686;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_687;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_688;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_689;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_690;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_691;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_692;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, fvar<var>, double, empty> type_fv_693;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_694;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_695;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_696;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_697;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_698;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_600> AgradDistributionWiener_fv_600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_601> AgradDistributionWiener_fv_601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_602> AgradDistributionWiener_fv_602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_603> AgradDistributionWiener_fv_603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_604> AgradDistributionWiener_fv_604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_605> AgradDistributionWiener_fv_605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_606> AgradDistributionWiener_fv_606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_607> AgradDistributionWiener_fv_607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_608> AgradDistributionWiener_fv_608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_609> AgradDistributionWiener_fv_609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_610> AgradDistributionWiener_fv_610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_611> AgradDistributionWiener_fv_611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_612> AgradDistributionWiener_fv_612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_613> AgradDistributionWiener_fv_613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_614> AgradDistributionWiener_fv_614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_615> AgradDistributionWiener_fv_615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_616> AgradDistributionWiener_fv_616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_617> AgradDistributionWiener_fv_617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_618> AgradDistributionWiener_fv_618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_619> AgradDistributionWiener_fv_619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_620> AgradDistributionWiener_fv_620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_621> AgradDistributionWiener_fv_621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_622> AgradDistributionWiener_fv_622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_623> AgradDistributionWiener_fv_623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_624> AgradDistributionWiener_fv_624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_625> AgradDistributionWiener_fv_625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_626> AgradDistributionWiener_fv_626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_627> AgradDistributionWiener_fv_627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_628> AgradDistributionWiener_fv_628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_629> AgradDistributionWiener_fv_629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_630> AgradDistributionWiener_fv_630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_631> AgradDistributionWiener_fv_631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_632> AgradDistributionWiener_fv_632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_633> AgradDistributionWiener_fv_633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_634> AgradDistributionWiener_fv_634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_635> AgradDistributionWiener_fv_635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_636> AgradDistributionWiener_fv_636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_637> AgradDistributionWiener_fv_637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_638> AgradDistributionWiener_fv_638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_639> AgradDistributionWiener_fv_639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_640> AgradDistributionWiener_fv_640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_641> AgradDistributionWiener_fv_641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_642> AgradDistributionWiener_fv_642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_643> AgradDistributionWiener_fv_643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_644> AgradDistributionWiener_fv_644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_645> AgradDistributionWiener_fv_645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_646> AgradDistributionWiener_fv_646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_647> AgradDistributionWiener_fv_647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_648> AgradDistributionWiener_fv_648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_649> AgradDistributionWiener_fv_649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_650> AgradDistributionWiener_fv_650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_651> AgradDistributionWiener_fv_651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_652> AgradDistributionWiener_fv_652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_653> AgradDistributionWiener_fv_653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_654> AgradDistributionWiener_fv_654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_655> AgradDistributionWiener_fv_655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_656> AgradDistributionWiener_fv_656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_657> AgradDistributionWiener_fv_657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_658> AgradDistributionWiener_fv_658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_659> AgradDistributionWiener_fv_659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_660> AgradDistributionWiener_fv_660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_661> AgradDistributionWiener_fv_661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_662> AgradDistributionWiener_fv_662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_663> AgradDistributionWiener_fv_663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_664> AgradDistributionWiener_fv_664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_665> AgradDistributionWiener_fv_665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_666> AgradDistributionWiener_fv_666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_667> AgradDistributionWiener_fv_667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_668> AgradDistributionWiener_fv_668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_669> AgradDistributionWiener_fv_669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_670> AgradDistributionWiener_fv_670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_671> AgradDistributionWiener_fv_671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_672> AgradDistributionWiener_fv_672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_673> AgradDistributionWiener_fv_673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_674> AgradDistributionWiener_fv_674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_675> AgradDistributionWiener_fv_675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_676> AgradDistributionWiener_fv_676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_677> AgradDistributionWiener_fv_677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_678> AgradDistributionWiener_fv_678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_679> AgradDistributionWiener_fv_679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_680> AgradDistributionWiener_fv_680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_681> AgradDistributionWiener_fv_681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_682> AgradDistributionWiener_fv_682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_683> AgradDistributionWiener_fv_683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_684> AgradDistributionWiener_fv_684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_685> AgradDistributionWiener_fv_685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_686> AgradDistributionWiener_fv_686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_687> AgradDistributionWiener_fv_687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_688> AgradDistributionWiener_fv_688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_689> AgradDistributionWiener_fv_689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_690> AgradDistributionWiener_fv_690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_691> AgradDistributionWiener_fv_691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_692> AgradDistributionWiener_fv_692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_693> AgradDistributionWiener_fv_693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_694> AgradDistributionWiener_fv_694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_695> AgradDistributionWiener_fv_695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_696> AgradDistributionWiener_fv_696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_697> AgradDistributionWiener_fv_697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_698> AgradDistributionWiener_fv_698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_699> AgradDistributionWiener_fv_699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_600, AgradDistributionTestFixture, AgradDistributionWiener_fv_600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_601, AgradDistributionTestFixture, AgradDistributionWiener_fv_601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_602, AgradDistributionTestFixture, AgradDistributionWiener_fv_602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_603, AgradDistributionTestFixture, AgradDistributionWiener_fv_603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_604, AgradDistributionTestFixture, AgradDistributionWiener_fv_604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_605, AgradDistributionTestFixture, AgradDistributionWiener_fv_605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_606, AgradDistributionTestFixture, AgradDistributionWiener_fv_606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_607, AgradDistributionTestFixture, AgradDistributionWiener_fv_607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_608, AgradDistributionTestFixture, AgradDistributionWiener_fv_608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_609, AgradDistributionTestFixture, AgradDistributionWiener_fv_609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_610, AgradDistributionTestFixture, AgradDistributionWiener_fv_610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_611, AgradDistributionTestFixture, AgradDistributionWiener_fv_611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_612, AgradDistributionTestFixture, AgradDistributionWiener_fv_612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_613, AgradDistributionTestFixture, AgradDistributionWiener_fv_613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_614, AgradDistributionTestFixture, AgradDistributionWiener_fv_614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_615, AgradDistributionTestFixture, AgradDistributionWiener_fv_615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_616, AgradDistributionTestFixture, AgradDistributionWiener_fv_616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_617, AgradDistributionTestFixture, AgradDistributionWiener_fv_617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_618, AgradDistributionTestFixture, AgradDistributionWiener_fv_618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_619, AgradDistributionTestFixture, AgradDistributionWiener_fv_619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_620, AgradDistributionTestFixture, AgradDistributionWiener_fv_620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_621, AgradDistributionTestFixture, AgradDistributionWiener_fv_621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_622, AgradDistributionTestFixture, AgradDistributionWiener_fv_622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_623, AgradDistributionTestFixture, AgradDistributionWiener_fv_623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_624, AgradDistributionTestFixture, AgradDistributionWiener_fv_624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_625, AgradDistributionTestFixture, AgradDistributionWiener_fv_625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_626, AgradDistributionTestFixture, AgradDistributionWiener_fv_626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_627, AgradDistributionTestFixture, AgradDistributionWiener_fv_627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_628, AgradDistributionTestFixture, AgradDistributionWiener_fv_628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_629, AgradDistributionTestFixture, AgradDistributionWiener_fv_629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_630, AgradDistributionTestFixture, AgradDistributionWiener_fv_630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_631, AgradDistributionTestFixture, AgradDistributionWiener_fv_631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_632, AgradDistributionTestFixture, AgradDistributionWiener_fv_632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_633, AgradDistributionTestFixture, AgradDistributionWiener_fv_633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_634, AgradDistributionTestFixture, AgradDistributionWiener_fv_634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_635, AgradDistributionTestFixture, AgradDistributionWiener_fv_635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_636, AgradDistributionTestFixture, AgradDistributionWiener_fv_636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_637, AgradDistributionTestFixture, AgradDistributionWiener_fv_637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_638, AgradDistributionTestFixture, AgradDistributionWiener_fv_638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_639, AgradDistributionTestFixture, AgradDistributionWiener_fv_639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_640, AgradDistributionTestFixture, AgradDistributionWiener_fv_640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_641, AgradDistributionTestFixture, AgradDistributionWiener_fv_641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_642, AgradDistributionTestFixture, AgradDistributionWiener_fv_642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_643, AgradDistributionTestFixture, AgradDistributionWiener_fv_643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_644, AgradDistributionTestFixture, AgradDistributionWiener_fv_644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_645, AgradDistributionTestFixture, AgradDistributionWiener_fv_645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_646, AgradDistributionTestFixture, AgradDistributionWiener_fv_646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_647, AgradDistributionTestFixture, AgradDistributionWiener_fv_647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_648, AgradDistributionTestFixture, AgradDistributionWiener_fv_648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_649, AgradDistributionTestFixture, AgradDistributionWiener_fv_649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_650, AgradDistributionTestFixture, AgradDistributionWiener_fv_650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_651, AgradDistributionTestFixture, AgradDistributionWiener_fv_651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_652, AgradDistributionTestFixture, AgradDistributionWiener_fv_652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_653, AgradDistributionTestFixture, AgradDistributionWiener_fv_653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_654, AgradDistributionTestFixture, AgradDistributionWiener_fv_654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_655, AgradDistributionTestFixture, AgradDistributionWiener_fv_655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_656, AgradDistributionTestFixture, AgradDistributionWiener_fv_656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_657, AgradDistributionTestFixture, AgradDistributionWiener_fv_657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_658, AgradDistributionTestFixture, AgradDistributionWiener_fv_658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_659, AgradDistributionTestFixture, AgradDistributionWiener_fv_659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_660, AgradDistributionTestFixture, AgradDistributionWiener_fv_660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_661, AgradDistributionTestFixture, AgradDistributionWiener_fv_661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_662, AgradDistributionTestFixture, AgradDistributionWiener_fv_662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_663, AgradDistributionTestFixture, AgradDistributionWiener_fv_663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_664, AgradDistributionTestFixture, AgradDistributionWiener_fv_664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_665, AgradDistributionTestFixture, AgradDistributionWiener_fv_665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_666, AgradDistributionTestFixture, AgradDistributionWiener_fv_666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_667, AgradDistributionTestFixture, AgradDistributionWiener_fv_667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_668, AgradDistributionTestFixture, AgradDistributionWiener_fv_668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_669, AgradDistributionTestFixture, AgradDistributionWiener_fv_669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_670, AgradDistributionTestFixture, AgradDistributionWiener_fv_670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_671, AgradDistributionTestFixture, AgradDistributionWiener_fv_671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_672, AgradDistributionTestFixture, AgradDistributionWiener_fv_672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_673, AgradDistributionTestFixture, AgradDistributionWiener_fv_673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_674, AgradDistributionTestFixture, AgradDistributionWiener_fv_674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_675, AgradDistributionTestFixture, AgradDistributionWiener_fv_675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_676, AgradDistributionTestFixture, AgradDistributionWiener_fv_676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_677, AgradDistributionTestFixture, AgradDistributionWiener_fv_677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_678, AgradDistributionTestFixture, AgradDistributionWiener_fv_678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_679, AgradDistributionTestFixture, AgradDistributionWiener_fv_679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_680, AgradDistributionTestFixture, AgradDistributionWiener_fv_680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_681, AgradDistributionTestFixture, AgradDistributionWiener_fv_681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_682, AgradDistributionTestFixture, AgradDistributionWiener_fv_682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_683, AgradDistributionTestFixture, AgradDistributionWiener_fv_683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_684, AgradDistributionTestFixture, AgradDistributionWiener_fv_684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_685, AgradDistributionTestFixture, AgradDistributionWiener_fv_685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_686, AgradDistributionTestFixture, AgradDistributionWiener_fv_686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_687, AgradDistributionTestFixture, AgradDistributionWiener_fv_687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_688, AgradDistributionTestFixture, AgradDistributionWiener_fv_688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_689, AgradDistributionTestFixture, AgradDistributionWiener_fv_689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_690, AgradDistributionTestFixture, AgradDistributionWiener_fv_690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_691, AgradDistributionTestFixture, AgradDistributionWiener_fv_691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_692, AgradDistributionTestFixture, AgradDistributionWiener_fv_692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_693, AgradDistributionTestFixture, AgradDistributionWiener_fv_693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_694, AgradDistributionTestFixture, AgradDistributionWiener_fv_694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_695, AgradDistributionTestFixture, AgradDistributionWiener_fv_695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_696, AgradDistributionTestFixture, AgradDistributionWiener_fv_696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_697, AgradDistributionTestFixture, AgradDistributionWiener_fv_697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_698, AgradDistributionTestFixture, AgradDistributionWiener_fv_698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_699, AgradDistributionTestFixture, AgradDistributionWiener_fv_699);
+
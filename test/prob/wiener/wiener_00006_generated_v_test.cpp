@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_600;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_601;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_602;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_603;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_604;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_605;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_606;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_607;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_608;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_609;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_610;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_611;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_612;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_613;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_614;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_615;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_616;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_617;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_618;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_619;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_620;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_621;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_622;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_623;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_624;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_625;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_626;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_627;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_628;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_629;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_630;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_631;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_632;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_633;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_634;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_635;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_636;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_637;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_638;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_639;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_640;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_641;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_642;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_643;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_644;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_645;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_646;
+typedef boost::mpl::vector<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_647;
+typedef boost::mpl::vector<double, var, double, double, double, empty> type_v_648;
+typedef boost::mpl::vector<double, var, double, double, std::vector<double>, empty> type_v_649;
+typedef boost::mpl::vector<double, var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_650;
+typedef boost::mpl::vector<double, var, double, double, var, empty> type_v_651;
+typedef boost::mpl::vector<double, var, double, double, std::vector<var>, empty> type_v_652;
+typedef boost::mpl::vector<double, var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_653;
+typedef boost::mpl::vector<double, var, double, std::vector<double>, double, empty> type_v_654;
+typedef boost::mpl::vector<double, var, double, std::vector<double>, std::vector<double>, empty> type_v_655;
+typedef boost::mpl::vector<double, var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_656;
+typedef boost::mpl::vector<double, var, double, std::vector<double>, var, empty> type_v_657;
+typedef boost::mpl::vector<double, var, double, std::vector<double>, std::vector<var>, empty> type_v_658;
+typedef boost::mpl::vector<double, var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_659;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_660;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_661;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_662;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_663;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_664;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_665;
+typedef boost::mpl::vector<double, var, double, var, double, empty> type_v_666;
+typedef boost::mpl::vector<double, var, double, var, std::vector<double>, empty> type_v_667;
+typedef boost::mpl::vector<double, var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_668;
+typedef boost::mpl::vector<double, var, double, var, var, empty> type_v_669;
+typedef boost::mpl::vector<double, var, double, var, std::vector<var>, empty> type_v_670;
+typedef boost::mpl::vector<double, var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_671;
+typedef boost::mpl::vector<double, var, double, std::vector<var>, double, empty> type_v_672;
+typedef boost::mpl::vector<double, var, double, std::vector<var>, std::vector<double>, empty> type_v_673;
+typedef boost::mpl::vector<double, var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_674;
+typedef boost::mpl::vector<double, var, double, std::vector<var>, var, empty> type_v_675;
+typedef boost::mpl::vector<double, var, double, std::vector<var>, std::vector<var>, empty> type_v_676;
+typedef boost::mpl::vector<double, var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_677;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_678;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_679;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_680;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_681;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_682;
+typedef boost::mpl::vector<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_683;
+typedef boost::mpl::vector<double, var, std::vector<double>, double, double, empty> type_v_684;
+typedef boost::mpl::vector<double, var, std::vector<double>, double, std::vector<double>, empty> type_v_685;
+typedef boost::mpl::vector<double, var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_686;
+typedef boost::mpl::vector<double, var, std::vector<double>, double, var, empty> type_v_687;
+typedef boost::mpl::vector<double, var, std::vector<double>, double, std::vector<var>, empty> type_v_688;
+typedef boost::mpl::vector<double, var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_689;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<double>, double, empty> type_v_690;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_691;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_692;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<double>, var, empty> type_v_693;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_694;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_695;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_696;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_697;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_698;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_600> AgradDistributionWiener_v_600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_601> AgradDistributionWiener_v_601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_602> AgradDistributionWiener_v_602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_603> AgradDistributionWiener_v_603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_604> AgradDistributionWiener_v_604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_605> AgradDistributionWiener_v_605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_606> AgradDistributionWiener_v_606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_607> AgradDistributionWiener_v_607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_608> AgradDistributionWiener_v_608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_609> AgradDistributionWiener_v_609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_610> AgradDistributionWiener_v_610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_611> AgradDistributionWiener_v_611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_612> AgradDistributionWiener_v_612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_613> AgradDistributionWiener_v_613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_614> AgradDistributionWiener_v_614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_615> AgradDistributionWiener_v_615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_616> AgradDistributionWiener_v_616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_617> AgradDistributionWiener_v_617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_618> AgradDistributionWiener_v_618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_619> AgradDistributionWiener_v_619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_620> AgradDistributionWiener_v_620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_621> AgradDistributionWiener_v_621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_622> AgradDistributionWiener_v_622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_623> AgradDistributionWiener_v_623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_624> AgradDistributionWiener_v_624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_625> AgradDistributionWiener_v_625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_626> AgradDistributionWiener_v_626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_627> AgradDistributionWiener_v_627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_628> AgradDistributionWiener_v_628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_629> AgradDistributionWiener_v_629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_630> AgradDistributionWiener_v_630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_631> AgradDistributionWiener_v_631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_632> AgradDistributionWiener_v_632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_633> AgradDistributionWiener_v_633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_634> AgradDistributionWiener_v_634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_635> AgradDistributionWiener_v_635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_636> AgradDistributionWiener_v_636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_637> AgradDistributionWiener_v_637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_638> AgradDistributionWiener_v_638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_639> AgradDistributionWiener_v_639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_640> AgradDistributionWiener_v_640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_641> AgradDistributionWiener_v_641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_642> AgradDistributionWiener_v_642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_643> AgradDistributionWiener_v_643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_644> AgradDistributionWiener_v_644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_645> AgradDistributionWiener_v_645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_646> AgradDistributionWiener_v_646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_647> AgradDistributionWiener_v_647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_648> AgradDistributionWiener_v_648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_649> AgradDistributionWiener_v_649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_650> AgradDistributionWiener_v_650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_651> AgradDistributionWiener_v_651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_652> AgradDistributionWiener_v_652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_653> AgradDistributionWiener_v_653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_654> AgradDistributionWiener_v_654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_655> AgradDistributionWiener_v_655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_656> AgradDistributionWiener_v_656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_657> AgradDistributionWiener_v_657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_658> AgradDistributionWiener_v_658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_659> AgradDistributionWiener_v_659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_660> AgradDistributionWiener_v_660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_661> AgradDistributionWiener_v_661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_662> AgradDistributionWiener_v_662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_663> AgradDistributionWiener_v_663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_664> AgradDistributionWiener_v_664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_665> AgradDistributionWiener_v_665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_666> AgradDistributionWiener_v_666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_667> AgradDistributionWiener_v_667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_668> AgradDistributionWiener_v_668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_669> AgradDistributionWiener_v_669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_670> AgradDistributionWiener_v_670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_671> AgradDistributionWiener_v_671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_672> AgradDistributionWiener_v_672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_673> AgradDistributionWiener_v_673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_674> AgradDistributionWiener_v_674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_675> AgradDistributionWiener_v_675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_676> AgradDistributionWiener_v_676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_677> AgradDistributionWiener_v_677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_678> AgradDistributionWiener_v_678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_679> AgradDistributionWiener_v_679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_680> AgradDistributionWiener_v_680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_681> AgradDistributionWiener_v_681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_682> AgradDistributionWiener_v_682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_683> AgradDistributionWiener_v_683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_684> AgradDistributionWiener_v_684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_685> AgradDistributionWiener_v_685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_686> AgradDistributionWiener_v_686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_687> AgradDistributionWiener_v_687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_688> AgradDistributionWiener_v_688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_689> AgradDistributionWiener_v_689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_690> AgradDistributionWiener_v_690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_691> AgradDistributionWiener_v_691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_692> AgradDistributionWiener_v_692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_693> AgradDistributionWiener_v_693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_694> AgradDistributionWiener_v_694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_695> AgradDistributionWiener_v_695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_696> AgradDistributionWiener_v_696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_697> AgradDistributionWiener_v_697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_698> AgradDistributionWiener_v_698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_699> AgradDistributionWiener_v_699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_600, AgradDistributionTestFixture, AgradDistributionWiener_v_600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_601, AgradDistributionTestFixture, AgradDistributionWiener_v_601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_602, AgradDistributionTestFixture, AgradDistributionWiener_v_602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_603, AgradDistributionTestFixture, AgradDistributionWiener_v_603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_604, AgradDistributionTestFixture, AgradDistributionWiener_v_604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_605, AgradDistributionTestFixture, AgradDistributionWiener_v_605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_606, AgradDistributionTestFixture, AgradDistributionWiener_v_606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_607, AgradDistributionTestFixture, AgradDistributionWiener_v_607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_608, AgradDistributionTestFixture, AgradDistributionWiener_v_608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_609, AgradDistributionTestFixture, AgradDistributionWiener_v_609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_610, AgradDistributionTestFixture, AgradDistributionWiener_v_610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_611, AgradDistributionTestFixture, AgradDistributionWiener_v_611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_612, AgradDistributionTestFixture, AgradDistributionWiener_v_612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_613, AgradDistributionTestFixture, AgradDistributionWiener_v_613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_614, AgradDistributionTestFixture, AgradDistributionWiener_v_614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_615, AgradDistributionTestFixture, AgradDistributionWiener_v_615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_616, AgradDistributionTestFixture, AgradDistributionWiener_v_616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_617, AgradDistributionTestFixture, AgradDistributionWiener_v_617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_618, AgradDistributionTestFixture, AgradDistributionWiener_v_618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_619, AgradDistributionTestFixture, AgradDistributionWiener_v_619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_620, AgradDistributionTestFixture, AgradDistributionWiener_v_620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_621, AgradDistributionTestFixture, AgradDistributionWiener_v_621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_622, AgradDistributionTestFixture, AgradDistributionWiener_v_622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_623, AgradDistributionTestFixture, AgradDistributionWiener_v_623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_624, AgradDistributionTestFixture, AgradDistributionWiener_v_624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_625, AgradDistributionTestFixture, AgradDistributionWiener_v_625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_626, AgradDistributionTestFixture, AgradDistributionWiener_v_626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_627, AgradDistributionTestFixture, AgradDistributionWiener_v_627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_628, AgradDistributionTestFixture, AgradDistributionWiener_v_628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_629, AgradDistributionTestFixture, AgradDistributionWiener_v_629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_630, AgradDistributionTestFixture, AgradDistributionWiener_v_630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_631, AgradDistributionTestFixture, AgradDistributionWiener_v_631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_632, AgradDistributionTestFixture, AgradDistributionWiener_v_632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_633, AgradDistributionTestFixture, AgradDistributionWiener_v_633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_634, AgradDistributionTestFixture, AgradDistributionWiener_v_634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_635, AgradDistributionTestFixture, AgradDistributionWiener_v_635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_636, AgradDistributionTestFixture, AgradDistributionWiener_v_636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_637, AgradDistributionTestFixture, AgradDistributionWiener_v_637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_638, AgradDistributionTestFixture, AgradDistributionWiener_v_638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_639, AgradDistributionTestFixture, AgradDistributionWiener_v_639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_640, AgradDistributionTestFixture, AgradDistributionWiener_v_640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_641, AgradDistributionTestFixture, AgradDistributionWiener_v_641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_642, AgradDistributionTestFixture, AgradDistributionWiener_v_642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_643, AgradDistributionTestFixture, AgradDistributionWiener_v_643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_644, AgradDistributionTestFixture, AgradDistributionWiener_v_644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_645, AgradDistributionTestFixture, AgradDistributionWiener_v_645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_646, AgradDistributionTestFixture, AgradDistributionWiener_v_646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_647, AgradDistributionTestFixture, AgradDistributionWiener_v_647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_648, AgradDistributionTestFixture, AgradDistributionWiener_v_648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_649, AgradDistributionTestFixture, AgradDistributionWiener_v_649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_650, AgradDistributionTestFixture, AgradDistributionWiener_v_650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_651, AgradDistributionTestFixture, AgradDistributionWiener_v_651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_652, AgradDistributionTestFixture, AgradDistributionWiener_v_652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_653, AgradDistributionTestFixture, AgradDistributionWiener_v_653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_654, AgradDistributionTestFixture, AgradDistributionWiener_v_654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_655, AgradDistributionTestFixture, AgradDistributionWiener_v_655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_656, AgradDistributionTestFixture, AgradDistributionWiener_v_656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_657, AgradDistributionTestFixture, AgradDistributionWiener_v_657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_658, AgradDistributionTestFixture, AgradDistributionWiener_v_658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_659, AgradDistributionTestFixture, AgradDistributionWiener_v_659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_660, AgradDistributionTestFixture, AgradDistributionWiener_v_660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_661, AgradDistributionTestFixture, AgradDistributionWiener_v_661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_662, AgradDistributionTestFixture, AgradDistributionWiener_v_662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_663, AgradDistributionTestFixture, AgradDistributionWiener_v_663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_664, AgradDistributionTestFixture, AgradDistributionWiener_v_664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_665, AgradDistributionTestFixture, AgradDistributionWiener_v_665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_666, AgradDistributionTestFixture, AgradDistributionWiener_v_666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_667, AgradDistributionTestFixture, AgradDistributionWiener_v_667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_668, AgradDistributionTestFixture, AgradDistributionWiener_v_668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_669, AgradDistributionTestFixture, AgradDistributionWiener_v_669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_670, AgradDistributionTestFixture, AgradDistributionWiener_v_670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_671, AgradDistributionTestFixture, AgradDistributionWiener_v_671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_672, AgradDistributionTestFixture, AgradDistributionWiener_v_672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_673, AgradDistributionTestFixture, AgradDistributionWiener_v_673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_674, AgradDistributionTestFixture, AgradDistributionWiener_v_674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_675, AgradDistributionTestFixture, AgradDistributionWiener_v_675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_676, AgradDistributionTestFixture, AgradDistributionWiener_v_676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_677, AgradDistributionTestFixture, AgradDistributionWiener_v_677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_678, AgradDistributionTestFixture, AgradDistributionWiener_v_678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_679, AgradDistributionTestFixture, AgradDistributionWiener_v_679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_680, AgradDistributionTestFixture, AgradDistributionWiener_v_680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_681, AgradDistributionTestFixture, AgradDistributionWiener_v_681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_682, AgradDistributionTestFixture, AgradDistributionWiener_v_682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_683, AgradDistributionTestFixture, AgradDistributionWiener_v_683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_684, AgradDistributionTestFixture, AgradDistributionWiener_v_684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_685, AgradDistributionTestFixture, AgradDistributionWiener_v_685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_686, AgradDistributionTestFixture, AgradDistributionWiener_v_686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_687, AgradDistributionTestFixture, AgradDistributionWiener_v_687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_688, AgradDistributionTestFixture, AgradDistributionWiener_v_688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_689, AgradDistributionTestFixture, AgradDistributionWiener_v_689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_690, AgradDistributionTestFixture, AgradDistributionWiener_v_690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_691, AgradDistributionTestFixture, AgradDistributionWiener_v_691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_692, AgradDistributionTestFixture, AgradDistributionWiener_v_692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_693, AgradDistributionTestFixture, AgradDistributionWiener_v_693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_694, AgradDistributionTestFixture, AgradDistributionWiener_v_694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_695, AgradDistributionTestFixture, AgradDistributionWiener_v_695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_696, AgradDistributionTestFixture, AgradDistributionWiener_v_696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_697, AgradDistributionTestFixture, AgradDistributionWiener_v_697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_698, AgradDistributionTestFixture, AgradDistributionWiener_v_698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_699, AgradDistributionTestFixture, AgradDistributionWiener_v_699);
+
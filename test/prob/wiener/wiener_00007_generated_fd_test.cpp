@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_700;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_701;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_702;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_703;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_704;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_705;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_706;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_707;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_708;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_709;
+typedef boost::mpl::vector<double, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_710;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, double, double, empty> type_fd_711;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_712;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_713;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_714;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_715;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_716;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_717;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_718;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_719;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_720;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_721;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_722;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_723;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_724;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_725;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_726;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_727;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_728;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_729;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_730;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_731;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_732;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_733;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_734;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_735;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_736;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_737;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_738;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_739;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_740;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_741;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_742;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_743;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_744;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_745;
+typedef boost::mpl::vector<double, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_746;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_747;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_748;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_749;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_750;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_751;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_752;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_753;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_754;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_755;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_756;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_757;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_758;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_759;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_760;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_761;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_762;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_763;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_764;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_765;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_766;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_767;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_768;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_769;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_770;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_771;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_772;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_773;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_774;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_775;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_776;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_777;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_778;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_779;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_780;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_781;
+typedef boost::mpl::vector<double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_782;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, double, double, empty> type_fd_783;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, double, std::vector<double>, empty> type_fd_784;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_785;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, double, fvar<double>, empty> type_fd_786;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, empty> type_fd_787;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_788;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<double>, double, empty> type_fd_789;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, empty> type_fd_790;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_791;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, empty> type_fd_792;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_793;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_794;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_795;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_796;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_797;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_798;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_700> AgradDistributionWiener_fd_700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_701> AgradDistributionWiener_fd_701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_702> AgradDistributionWiener_fd_702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_703> AgradDistributionWiener_fd_703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_704> AgradDistributionWiener_fd_704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_705> AgradDistributionWiener_fd_705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_706> AgradDistributionWiener_fd_706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_707> AgradDistributionWiener_fd_707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_708> AgradDistributionWiener_fd_708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_709> AgradDistributionWiener_fd_709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_710> AgradDistributionWiener_fd_710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_711> AgradDistributionWiener_fd_711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_712> AgradDistributionWiener_fd_712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_713> AgradDistributionWiener_fd_713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_714> AgradDistributionWiener_fd_714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_715> AgradDistributionWiener_fd_715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_716> AgradDistributionWiener_fd_716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_717> AgradDistributionWiener_fd_717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_718> AgradDistributionWiener_fd_718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_719> AgradDistributionWiener_fd_719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_720> AgradDistributionWiener_fd_720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_721> AgradDistributionWiener_fd_721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_722> AgradDistributionWiener_fd_722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_723> AgradDistributionWiener_fd_723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_724> AgradDistributionWiener_fd_724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_725> AgradDistributionWiener_fd_725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_726> AgradDistributionWiener_fd_726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_727> AgradDistributionWiener_fd_727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_728> AgradDistributionWiener_fd_728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_729> AgradDistributionWiener_fd_729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_730> AgradDistributionWiener_fd_730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_731> AgradDistributionWiener_fd_731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_732> AgradDistributionWiener_fd_732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_733> AgradDistributionWiener_fd_733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_734> AgradDistributionWiener_fd_734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_735> AgradDistributionWiener_fd_735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_736> AgradDistributionWiener_fd_736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_737> AgradDistributionWiener_fd_737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_738> AgradDistributionWiener_fd_738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_739> AgradDistributionWiener_fd_739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_740> AgradDistributionWiener_fd_740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_741> AgradDistributionWiener_fd_741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_742> AgradDistributionWiener_fd_742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_743> AgradDistributionWiener_fd_743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_744> AgradDistributionWiener_fd_744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_745> AgradDistributionWiener_fd_745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_746> AgradDistributionWiener_fd_746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_747> AgradDistributionWiener_fd_747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_748> AgradDistributionWiener_fd_748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_749> AgradDistributionWiener_fd_749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_750> AgradDistributionWiener_fd_750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_751> AgradDistributionWiener_fd_751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_752> AgradDistributionWiener_fd_752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_753> AgradDistributionWiener_fd_753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_754> AgradDistributionWiener_fd_754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_755> AgradDistributionWiener_fd_755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_756> AgradDistributionWiener_fd_756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_757> AgradDistributionWiener_fd_757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_758> AgradDistributionWiener_fd_758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_759> AgradDistributionWiener_fd_759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_760> AgradDistributionWiener_fd_760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_761> AgradDistributionWiener_fd_761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_762> AgradDistributionWiener_fd_762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_763> AgradDistributionWiener_fd_763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_764> AgradDistributionWiener_fd_764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_765> AgradDistributionWiener_fd_765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_766> AgradDistributionWiener_fd_766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_767> AgradDistributionWiener_fd_767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_768> AgradDistributionWiener_fd_768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_769> AgradDistributionWiener_fd_769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_770> AgradDistributionWiener_fd_770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_771> AgradDistributionWiener_fd_771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_772> AgradDistributionWiener_fd_772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_773> AgradDistributionWiener_fd_773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_774> AgradDistributionWiener_fd_774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_775> AgradDistributionWiener_fd_775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_776> AgradDistributionWiener_fd_776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_777> AgradDistributionWiener_fd_777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_778> AgradDistributionWiener_fd_778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_779> AgradDistributionWiener_fd_779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_780> AgradDistributionWiener_fd_780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_781> AgradDistributionWiener_fd_781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_782> AgradDistributionWiener_fd_782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_783> AgradDistributionWiener_fd_783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_784> AgradDistributionWiener_fd_784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_785> AgradDistributionWiener_fd_785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_786> AgradDistributionWiener_fd_786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_787> AgradDistributionWiener_fd_787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_788> AgradDistributionWiener_fd_788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_789> AgradDistributionWiener_fd_789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_790> AgradDistributionWiener_fd_790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_791> AgradDistributionWiener_fd_791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_792> AgradDistributionWiener_fd_792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_793> AgradDistributionWiener_fd_793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_794> AgradDistributionWiener_fd_794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_795> AgradDistributionWiener_fd_795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_796> AgradDistributionWiener_fd_796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_797> AgradDistributionWiener_fd_797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_798> AgradDistributionWiener_fd_798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_799> AgradDistributionWiener_fd_799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_700, AgradDistributionTestFixture, AgradDistributionWiener_fd_700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_701, AgradDistributionTestFixture, AgradDistributionWiener_fd_701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_702, AgradDistributionTestFixture, AgradDistributionWiener_fd_702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_703, AgradDistributionTestFixture, AgradDistributionWiener_fd_703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_704, AgradDistributionTestFixture, AgradDistributionWiener_fd_704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_705, AgradDistributionTestFixture, AgradDistributionWiener_fd_705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_706, AgradDistributionTestFixture, AgradDistributionWiener_fd_706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_707, AgradDistributionTestFixture, AgradDistributionWiener_fd_707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_708, AgradDistributionTestFixture, AgradDistributionWiener_fd_708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_709, AgradDistributionTestFixture, AgradDistributionWiener_fd_709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_710, AgradDistributionTestFixture, AgradDistributionWiener_fd_710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_711, AgradDistributionTestFixture, AgradDistributionWiener_fd_711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_712, AgradDistributionTestFixture, AgradDistributionWiener_fd_712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_713, AgradDistributionTestFixture, AgradDistributionWiener_fd_713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_714, AgradDistributionTestFixture, AgradDistributionWiener_fd_714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_715, AgradDistributionTestFixture, AgradDistributionWiener_fd_715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_716, AgradDistributionTestFixture, AgradDistributionWiener_fd_716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_717, AgradDistributionTestFixture, AgradDistributionWiener_fd_717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_718, AgradDistributionTestFixture, AgradDistributionWiener_fd_718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_719, AgradDistributionTestFixture, AgradDistributionWiener_fd_719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_720, AgradDistributionTestFixture, AgradDistributionWiener_fd_720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_721, AgradDistributionTestFixture, AgradDistributionWiener_fd_721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_722, AgradDistributionTestFixture, AgradDistributionWiener_fd_722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_723, AgradDistributionTestFixture, AgradDistributionWiener_fd_723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_724, AgradDistributionTestFixture, AgradDistributionWiener_fd_724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_725, AgradDistributionTestFixture, AgradDistributionWiener_fd_725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_726, AgradDistributionTestFixture, AgradDistributionWiener_fd_726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_727, AgradDistributionTestFixture, AgradDistributionWiener_fd_727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_728, AgradDistributionTestFixture, AgradDistributionWiener_fd_728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_729, AgradDistributionTestFixture, AgradDistributionWiener_fd_729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_730, AgradDistributionTestFixture, AgradDistributionWiener_fd_730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_731, AgradDistributionTestFixture, AgradDistributionWiener_fd_731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_732, AgradDistributionTestFixture, AgradDistributionWiener_fd_732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_733, AgradDistributionTestFixture, AgradDistributionWiener_fd_733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_734, AgradDistributionTestFixture, AgradDistributionWiener_fd_734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_735, AgradDistributionTestFixture, AgradDistributionWiener_fd_735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_736, AgradDistributionTestFixture, AgradDistributionWiener_fd_736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_737, AgradDistributionTestFixture, AgradDistributionWiener_fd_737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_738, AgradDistributionTestFixture, AgradDistributionWiener_fd_738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_739, AgradDistributionTestFixture, AgradDistributionWiener_fd_739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_740, AgradDistributionTestFixture, AgradDistributionWiener_fd_740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_741, AgradDistributionTestFixture, AgradDistributionWiener_fd_741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_742, AgradDistributionTestFixture, AgradDistributionWiener_fd_742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_743, AgradDistributionTestFixture, AgradDistributionWiener_fd_743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_744, AgradDistributionTestFixture, AgradDistributionWiener_fd_744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_745, AgradDistributionTestFixture, AgradDistributionWiener_fd_745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_746, AgradDistributionTestFixture, AgradDistributionWiener_fd_746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_747, AgradDistributionTestFixture, AgradDistributionWiener_fd_747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_748, AgradDistributionTestFixture, AgradDistributionWiener_fd_748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_749, AgradDistributionTestFixture, AgradDistributionWiener_fd_749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_750, AgradDistributionTestFixture, AgradDistributionWiener_fd_750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_751, AgradDistributionTestFixture, AgradDistributionWiener_fd_751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_752, AgradDistributionTestFixture, AgradDistributionWiener_fd_752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_753, AgradDistributionTestFixture, AgradDistributionWiener_fd_753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_754, AgradDistributionTestFixture, AgradDistributionWiener_fd_754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_755, AgradDistributionTestFixture, AgradDistributionWiener_fd_755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_756, AgradDistributionTestFixture, AgradDistributionWiener_fd_756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_757, AgradDistributionTestFixture, AgradDistributionWiener_fd_757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_758, AgradDistributionTestFixture, AgradDistributionWiener_fd_758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_759, AgradDistributionTestFixture, AgradDistributionWiener_fd_759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_760, AgradDistributionTestFixture, AgradDistributionWiener_fd_760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_761, AgradDistributionTestFixture, AgradDistributionWiener_fd_761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_762, AgradDistributionTestFixture, AgradDistributionWiener_fd_762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_763, AgradDistributionTestFixture, AgradDistributionWiener_fd_763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_764, AgradDistributionTestFixture, AgradDistributionWiener_fd_764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_765, AgradDistributionTestFixture, AgradDistributionWiener_fd_765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_766, AgradDistributionTestFixture, AgradDistributionWiener_fd_766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_767, AgradDistributionTestFixture, AgradDistributionWiener_fd_767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_768, AgradDistributionTestFixture, AgradDistributionWiener_fd_768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_769, AgradDistributionTestFixture, AgradDistributionWiener_fd_769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_770, AgradDistributionTestFixture, AgradDistributionWiener_fd_770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_771, AgradDistributionTestFixture, AgradDistributionWiener_fd_771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_772, AgradDistributionTestFixture, AgradDistributionWiener_fd_772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_773, AgradDistributionTestFixture, AgradDistributionWiener_fd_773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_774, AgradDistributionTestFixture, AgradDistributionWiener_fd_774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_775, AgradDistributionTestFixture, AgradDistributionWiener_fd_775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_776, AgradDistributionTestFixture, AgradDistributionWiener_fd_776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_777, AgradDistributionTestFixture, AgradDistributionWiener_fd_777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_778, AgradDistributionTestFixture, AgradDistributionWiener_fd_778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_779, AgradDistributionTestFixture, AgradDistributionWiener_fd_779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_780, AgradDistributionTestFixture, AgradDistributionWiener_fd_780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_781, AgradDistributionTestFixture, AgradDistributionWiener_fd_781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_782, AgradDistributionTestFixture, AgradDistributionWiener_fd_782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_783, AgradDistributionTestFixture, AgradDistributionWiener_fd_783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_784, AgradDistributionTestFixture, AgradDistributionWiener_fd_784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_785, AgradDistributionTestFixture, AgradDistributionWiener_fd_785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_786, AgradDistributionTestFixture, AgradDistributionWiener_fd_786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_787, AgradDistributionTestFixture, AgradDistributionWiener_fd_787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_788, AgradDistributionTestFixture, AgradDistributionWiener_fd_788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_789, AgradDistributionTestFixture, AgradDistributionWiener_fd_789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_790, AgradDistributionTestFixture, AgradDistributionWiener_fd_790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_791, AgradDistributionTestFixture, AgradDistributionWiener_fd_791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_792, AgradDistributionTestFixture, AgradDistributionWiener_fd_792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_793, AgradDistributionTestFixture, AgradDistributionWiener_fd_793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_794, AgradDistributionTestFixture, AgradDistributionWiener_fd_794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_795, AgradDistributionTestFixture, AgradDistributionWiener_fd_795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_796, AgradDistributionTestFixture, AgradDistributionWiener_fd_796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_797, AgradDistributionTestFixture, AgradDistributionWiener_fd_797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_798, AgradDistributionTestFixture, AgradDistributionWiener_fd_798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_799, AgradDistributionTestFixture, AgradDistributionWiener_fd_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_700;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_701;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_702;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_703;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_704;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_705;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_706;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_707;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_708;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_709;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_710;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_711;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_712;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_713;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_714;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_715;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_716;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_717;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_718;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_719;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_720;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_721;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_722;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_723;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_724;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_725;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_726;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_727;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_728;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_729;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_730;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_731;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_732;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_733;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_734;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_735;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_736;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_737;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_738;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_739;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_740;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_741;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_742;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_743;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_744;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_745;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_746;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_747;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_748;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_749;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_750;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_751;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_752;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_753;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_754;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_755;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_756;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_757;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_758;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_759;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_760;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_761;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_762;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_763;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_764;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_765;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_766;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_767;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_768;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_769;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_770;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_771;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_772;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_773;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_774;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_775;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_776;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_777;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_778;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_779;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_780;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_781;
+typedef boost::mpl::vector<double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_782;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, double, double, empty> type_ffd_783;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, double, std::vector<double>, empty> type_ffd_784;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_785;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, double, fvar<fvar<double> >, empty> type_ffd_786;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_787;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_788;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, double, empty> type_ffd_789;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<double>, empty> type_ffd_790;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_791;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_792;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_793;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_794;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_795;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_796;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_797;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_798;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_700> AgradDistributionWiener_ffd_700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_701> AgradDistributionWiener_ffd_701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_702> AgradDistributionWiener_ffd_702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_703> AgradDistributionWiener_ffd_703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_704> AgradDistributionWiener_ffd_704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_705> AgradDistributionWiener_ffd_705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_706> AgradDistributionWiener_ffd_706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_707> AgradDistributionWiener_ffd_707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_708> AgradDistributionWiener_ffd_708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_709> AgradDistributionWiener_ffd_709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_710> AgradDistributionWiener_ffd_710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_711> AgradDistributionWiener_ffd_711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_712> AgradDistributionWiener_ffd_712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_713> AgradDistributionWiener_ffd_713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_714> AgradDistributionWiener_ffd_714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_715> AgradDistributionWiener_ffd_715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_716> AgradDistributionWiener_ffd_716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_717> AgradDistributionWiener_ffd_717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_718> AgradDistributionWiener_ffd_718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_719> AgradDistributionWiener_ffd_719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_720> AgradDistributionWiener_ffd_720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_721> AgradDistributionWiener_ffd_721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_722> AgradDistributionWiener_ffd_722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_723> AgradDistributionWiener_ffd_723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_724> AgradDistributionWiener_ffd_724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_725> AgradDistributionWiener_ffd_725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_726> AgradDistributionWiener_ffd_726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_727> AgradDistributionWiener_ffd_727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_728> AgradDistributionWiener_ffd_728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_729> AgradDistributionWiener_ffd_729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_730> AgradDistributionWiener_ffd_730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_731> AgradDistributionWiener_ffd_731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_732> AgradDistributionWiener_ffd_732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_733> AgradDistributionWiener_ffd_733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_734> AgradDistributionWiener_ffd_734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_735> AgradDistributionWiener_ffd_735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_736> AgradDistributionWiener_ffd_736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_737> AgradDistributionWiener_ffd_737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_738> AgradDistributionWiener_ffd_738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_739> AgradDistributionWiener_ffd_739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_740> AgradDistributionWiener_ffd_740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_741> AgradDistributionWiener_ffd_741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_742> AgradDistributionWiener_ffd_742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_743> AgradDistributionWiener_ffd_743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_744> AgradDistributionWiener_ffd_744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_745> AgradDistributionWiener_ffd_745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_746> AgradDistributionWiener_ffd_746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_747> AgradDistributionWiener_ffd_747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_748> AgradDistributionWiener_ffd_748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_749> AgradDistributionWiener_ffd_749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_750> AgradDistributionWiener_ffd_750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_751> AgradDistributionWiener_ffd_751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_752> AgradDistributionWiener_ffd_752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_753> AgradDistributionWiener_ffd_753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_754> AgradDistributionWiener_ffd_754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_755> AgradDistributionWiener_ffd_755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_756> AgradDistributionWiener_ffd_756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_757> AgradDistributionWiener_ffd_757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_758> AgradDistributionWiener_ffd_758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_759> AgradDistributionWiener_ffd_759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_760> AgradDistributionWiener_ffd_760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_761> AgradDistributionWiener_ffd_761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_762> AgradDistributionWiener_ffd_762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_763> AgradDistributionWiener_ffd_763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_764> AgradDistributionWiener_ffd_764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_765> AgradDistributionWiener_ffd_765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_766> AgradDistributionWiener_ffd_766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_767> AgradDistributionWiener_ffd_767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_768> AgradDistributionWiener_ffd_768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_769> AgradDistributionWiener_ffd_769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_770> AgradDistributionWiener_ffd_770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_771> AgradDistributionWiener_ffd_771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_772> AgradDistributionWiener_ffd_772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_773> AgradDistributionWiener_ffd_773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_774> AgradDistributionWiener_ffd_774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_775> AgradDistributionWiener_ffd_775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_776> AgradDistributionWiener_ffd_776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_777> AgradDistributionWiener_ffd_777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_778> AgradDistributionWiener_ffd_778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_779> AgradDistributionWiener_ffd_779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_780> AgradDistributionWiener_ffd_780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_781> AgradDistributionWiener_ffd_781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_782> AgradDistributionWiener_ffd_782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_783> AgradDistributionWiener_ffd_783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_784> AgradDistributionWiener_ffd_784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_785> AgradDistributionWiener_ffd_785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_786> AgradDistributionWiener_ffd_786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_787> AgradDistributionWiener_ffd_787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_788> AgradDistributionWiener_ffd_788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_789> AgradDistributionWiener_ffd_789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_790> AgradDistributionWiener_ffd_790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_791> AgradDistributionWiener_ffd_791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_792> AgradDistributionWiener_ffd_792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_793> AgradDistributionWiener_ffd_793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_794> AgradDistributionWiener_ffd_794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_795> AgradDistributionWiener_ffd_795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_796> AgradDistributionWiener_ffd_796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_797> AgradDistributionWiener_ffd_797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_798> AgradDistributionWiener_ffd_798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_799> AgradDistributionWiener_ffd_799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_700, AgradDistributionTestFixture, AgradDistributionWiener_ffd_700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_701, AgradDistributionTestFixture, AgradDistributionWiener_ffd_701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_702, AgradDistributionTestFixture, AgradDistributionWiener_ffd_702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_703, AgradDistributionTestFixture, AgradDistributionWiener_ffd_703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_704, AgradDistributionTestFixture, AgradDistributionWiener_ffd_704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_705, AgradDistributionTestFixture, AgradDistributionWiener_ffd_705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_706, AgradDistributionTestFixture, AgradDistributionWiener_ffd_706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_707, AgradDistributionTestFixture, AgradDistributionWiener_ffd_707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_708, AgradDistributionTestFixture, AgradDistributionWiener_ffd_708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_709, AgradDistributionTestFixture, AgradDistributionWiener_ffd_709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_710, AgradDistributionTestFixture, AgradDistributionWiener_ffd_710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_711, AgradDistributionTestFixture, AgradDistributionWiener_ffd_711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_712, AgradDistributionTestFixture, AgradDistributionWiener_ffd_712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_713, AgradDistributionTestFixture, AgradDistributionWiener_ffd_713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_714, AgradDistributionTestFixture, AgradDistributionWiener_ffd_714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_715, AgradDistributionTestFixture, AgradDistributionWiener_ffd_715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_716, AgradDistributionTestFixture, AgradDistributionWiener_ffd_716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_717, AgradDistributionTestFixture, AgradDistributionWiener_ffd_717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_718, AgradDistributionTestFixture, AgradDistributionWiener_ffd_718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_719, AgradDistributionTestFixture, AgradDistributionWiener_ffd_719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_720, AgradDistributionTestFixture, AgradDistributionWiener_ffd_720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_721, AgradDistributionTestFixture, AgradDistributionWiener_ffd_721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_722, AgradDistributionTestFixture, AgradDistributionWiener_ffd_722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_723, AgradDistributionTestFixture, AgradDistributionWiener_ffd_723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_724, AgradDistributionTestFixture, AgradDistributionWiener_ffd_724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_725, AgradDistributionTestFixture, AgradDistributionWiener_ffd_725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_726, AgradDistributionTestFixture, AgradDistributionWiener_ffd_726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_727, AgradDistributionTestFixture, AgradDistributionWiener_ffd_727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_728, AgradDistributionTestFixture, AgradDistributionWiener_ffd_728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_729, AgradDistributionTestFixture, AgradDistributionWiener_ffd_729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_730, AgradDistributionTestFixture, AgradDistributionWiener_ffd_730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_731, AgradDistributionTestFixture, AgradDistributionWiener_ffd_731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_732, AgradDistributionTestFixture, AgradDistributionWiener_ffd_732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_733, AgradDistributionTestFixture, AgradDistributionWiener_ffd_733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_734, AgradDistributionTestFixture, AgradDistributionWiener_ffd_734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_735, AgradDistributionTestFixture, AgradDistributionWiener_ffd_735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_736, AgradDistributionTestFixture, AgradDistributionWiener_ffd_736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_737, AgradDistributionTestFixture, AgradDistributionWiener_ffd_737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_738, AgradDistributionTestFixture, AgradDistributionWiener_ffd_738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_739, AgradDistributionTestFixture, AgradDistributionWiener_ffd_739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_740, AgradDistributionTestFixture, AgradDistributionWiener_ffd_740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_741, AgradDistributionTestFixture, AgradDistributionWiener_ffd_741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_742, AgradDistributionTestFixture, AgradDistributionWiener_ffd_742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_743, AgradDistributionTestFixture, AgradDistributionWiener_ffd_743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_744, AgradDistributionTestFixture, AgradDistributionWiener_ffd_744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_745, AgradDistributionTestFixture, AgradDistributionWiener_ffd_745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_746, AgradDistributionTestFixture, AgradDistributionWiener_ffd_746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_747, AgradDistributionTestFixture, AgradDistributionWiener_ffd_747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_748, AgradDistributionTestFixture, AgradDistributionWiener_ffd_748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_749, AgradDistributionTestFixture, AgradDistributionWiener_ffd_749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_750, AgradDistributionTestFixture, AgradDistributionWiener_ffd_750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_751, AgradDistributionTestFixture, AgradDistributionWiener_ffd_751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_752, AgradDistributionTestFixture, AgradDistributionWiener_ffd_752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_753, AgradDistributionTestFixture, AgradDistributionWiener_ffd_753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_754, AgradDistributionTestFixture, AgradDistributionWiener_ffd_754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_755, AgradDistributionTestFixture, AgradDistributionWiener_ffd_755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_756, AgradDistributionTestFixture, AgradDistributionWiener_ffd_756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_757, AgradDistributionTestFixture, AgradDistributionWiener_ffd_757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_758, AgradDistributionTestFixture, AgradDistributionWiener_ffd_758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_759, AgradDistributionTestFixture, AgradDistributionWiener_ffd_759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_760, AgradDistributionTestFixture, AgradDistributionWiener_ffd_760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_761, AgradDistributionTestFixture, AgradDistributionWiener_ffd_761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_762, AgradDistributionTestFixture, AgradDistributionWiener_ffd_762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_763, AgradDistributionTestFixture, AgradDistributionWiener_ffd_763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_764, AgradDistributionTestFixture, AgradDistributionWiener_ffd_764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_765, AgradDistributionTestFixture, AgradDistributionWiener_ffd_765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_766, AgradDistributionTestFixture, AgradDistributionWiener_ffd_766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_767, AgradDistributionTestFixture, AgradDistributionWiener_ffd_767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_768, AgradDistributionTestFixture, AgradDistributionWiener_ffd_768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_769, AgradDistributionTestFixture, AgradDistributionWiener_ffd_769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_770, AgradDistributionTestFixture, AgradDistributionWiener_ffd_770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_771, AgradDistributionTestFixture, AgradDistributionWiener_ffd_771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_772, AgradDistributionTestFixture, AgradDistributionWiener_ffd_772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_773, AgradDistributionTestFixture, AgradDistributionWiener_ffd_773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_774, AgradDistributionTestFixture, AgradDistributionWiener_ffd_774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_775, AgradDistributionTestFixture, AgradDistributionWiener_ffd_775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_776, AgradDistributionTestFixture, AgradDistributionWiener_ffd_776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_777, AgradDistributionTestFixture, AgradDistributionWiener_ffd_777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_778, AgradDistributionTestFixture, AgradDistributionWiener_ffd_778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_779, AgradDistributionTestFixture, AgradDistributionWiener_ffd_779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_780, AgradDistributionTestFixture, AgradDistributionWiener_ffd_780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_781, AgradDistributionTestFixture, AgradDistributionWiener_ffd_781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_782, AgradDistributionTestFixture, AgradDistributionWiener_ffd_782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_783, AgradDistributionTestFixture, AgradDistributionWiener_ffd_783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_784, AgradDistributionTestFixture, AgradDistributionWiener_ffd_784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_785, AgradDistributionTestFixture, AgradDistributionWiener_ffd_785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_786, AgradDistributionTestFixture, AgradDistributionWiener_ffd_786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_787, AgradDistributionTestFixture, AgradDistributionWiener_ffd_787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_788, AgradDistributionTestFixture, AgradDistributionWiener_ffd_788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_789, AgradDistributionTestFixture, AgradDistributionWiener_ffd_789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_790, AgradDistributionTestFixture, AgradDistributionWiener_ffd_790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_791, AgradDistributionTestFixture, AgradDistributionWiener_ffd_791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_792, AgradDistributionTestFixture, AgradDistributionWiener_ffd_792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_793, AgradDistributionTestFixture, AgradDistributionWiener_ffd_793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_794, AgradDistributionTestFixture, AgradDistributionWiener_ffd_794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_795, AgradDistributionTestFixture, AgradDistributionWiener_ffd_795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_796, AgradDistributionTestFixture, AgradDistributionWiener_ffd_796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_797, AgradDistributionTestFixture, AgradDistributionWiener_ffd_797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_798, AgradDistributionTestFixture, AgradDistributionWiener_ffd_798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_799, AgradDistributionTestFixture, AgradDistributionWiener_ffd_799);
+
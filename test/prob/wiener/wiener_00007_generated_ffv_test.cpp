@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_700;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_701;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_702;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_703;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_704;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_705;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_706;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_707;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_708;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_709;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_710;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_711;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_712;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_713;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_714;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_715;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_716;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_717;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_718;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_719;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_720;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_721;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_722;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_723;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_724;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_725;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_726;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_727;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_728;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_729;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_730;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_731;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_732;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_733;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_734;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_735;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_736;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_737;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_738;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_739;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_740;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_741;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_742;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_743;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_744;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_745;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_746;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_747;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_748;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_749;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_750;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_751;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_752;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_753;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_754;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_755;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_756;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_757;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_758;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_759;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_760;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_761;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_762;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_763;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_764;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_765;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_766;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_767;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_768;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_769;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_770;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_771;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_772;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_773;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_774;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_775;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_776;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_777;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_778;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_779;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_780;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_781;
+typedef boost::mpl::vector<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_782;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, double, double, empty> type_ffv_783;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty> type_ffv_784;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_785;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty> type_ffv_786;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_787;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_788;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty> type_ffv_789;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty> type_ffv_790;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_791;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_792;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_793;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_794;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_795;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_796;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_797;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_798;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_700> AgradDistributionWiener_ffv_700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_701> AgradDistributionWiener_ffv_701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_702> AgradDistributionWiener_ffv_702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_703> AgradDistributionWiener_ffv_703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_704> AgradDistributionWiener_ffv_704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_705> AgradDistributionWiener_ffv_705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_706> AgradDistributionWiener_ffv_706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_707> AgradDistributionWiener_ffv_707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_708> AgradDistributionWiener_ffv_708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_709> AgradDistributionWiener_ffv_709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_710> AgradDistributionWiener_ffv_710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_711> AgradDistributionWiener_ffv_711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_712> AgradDistributionWiener_ffv_712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_713> AgradDistributionWiener_ffv_713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_714> AgradDistributionWiener_ffv_714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_715> AgradDistributionWiener_ffv_715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_716> AgradDistributionWiener_ffv_716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_717> AgradDistributionWiener_ffv_717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_718> AgradDistributionWiener_ffv_718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_719> AgradDistributionWiener_ffv_719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_720> AgradDistributionWiener_ffv_720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_721> AgradDistributionWiener_ffv_721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_722> AgradDistributionWiener_ffv_722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_723> AgradDistributionWiener_ffv_723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_724> AgradDistributionWiener_ffv_724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_725> AgradDistributionWiener_ffv_725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_726> AgradDistributionWiener_ffv_726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_727> AgradDistributionWiener_ffv_727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_728> AgradDistributionWiener_ffv_728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_729> AgradDistributionWiener_ffv_729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_730> AgradDistributionWiener_ffv_730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_731> AgradDistributionWiener_ffv_731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_732> AgradDistributionWiener_ffv_732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_733> AgradDistributionWiener_ffv_733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_734> AgradDistributionWiener_ffv_734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_735> AgradDistributionWiener_ffv_735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_736> AgradDistributionWiener_ffv_736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_737> AgradDistributionWiener_ffv_737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_738> AgradDistributionWiener_ffv_738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_739> AgradDistributionWiener_ffv_739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_740> AgradDistributionWiener_ffv_740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_741> AgradDistributionWiener_ffv_741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_742> AgradDistributionWiener_ffv_742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_743> AgradDistributionWiener_ffv_743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_744> AgradDistributionWiener_ffv_744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_745> AgradDistributionWiener_ffv_745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_746> AgradDistributionWiener_ffv_746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_747> AgradDistributionWiener_ffv_747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_748> AgradDistributionWiener_ffv_748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_749> AgradDistributionWiener_ffv_749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_750> AgradDistributionWiener_ffv_750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_751> AgradDistributionWiener_ffv_751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_752> AgradDistributionWiener_ffv_752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_753> AgradDistributionWiener_ffv_753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_754> AgradDistributionWiener_ffv_754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_755> AgradDistributionWiener_ffv_755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_756> AgradDistributionWiener_ffv_756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_757> AgradDistributionWiener_ffv_757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_758> AgradDistributionWiener_ffv_758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_759> AgradDistributionWiener_ffv_759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_760> AgradDistributionWiener_ffv_760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_761> AgradDistributionWiener_ffv_761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_762> AgradDistributionWiener_ffv_762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_763> AgradDistributionWiener_ffv_763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_764> AgradDistributionWiener_ffv_764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_765> AgradDistributionWiener_ffv_765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_766> AgradDistributionWiener_ffv_766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_767> AgradDistributionWiener_ffv_767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_768> AgradDistributionWiener_ffv_768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_769> AgradDistributionWiener_ffv_769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_770> AgradDistributionWiener_ffv_770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_771> AgradDistributionWiener_ffv_771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_772> AgradDistributionWiener_ffv_772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_773> AgradDistributionWiener_ffv_773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_774> AgradDistributionWiener_ffv_774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_775> AgradDistributionWiener_ffv_775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_776> AgradDistributionWiener_ffv_776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_777> AgradDistributionWiener_ffv_777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_778> AgradDistributionWiener_ffv_778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_779> AgradDistributionWiener_ffv_779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_780> AgradDistributionWiener_ffv_780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_781> AgradDistributionWiener_ffv_781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_782> AgradDistributionWiener_ffv_782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_783> AgradDistributionWiener_ffv_783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_784> AgradDistributionWiener_ffv_784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_785> AgradDistributionWiener_ffv_785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_786> AgradDistributionWiener_ffv_786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_787> AgradDistributionWiener_ffv_787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_788> AgradDistributionWiener_ffv_788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_789> AgradDistributionWiener_ffv_789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_790> AgradDistributionWiener_ffv_790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_791> AgradDistributionWiener_ffv_791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_792> AgradDistributionWiener_ffv_792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_793> AgradDistributionWiener_ffv_793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_794> AgradDistributionWiener_ffv_794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_795> AgradDistributionWiener_ffv_795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_796> AgradDistributionWiener_ffv_796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_797> AgradDistributionWiener_ffv_797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_798> AgradDistributionWiener_ffv_798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_799> AgradDistributionWiener_ffv_799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_700, AgradDistributionTestFixture, AgradDistributionWiener_ffv_700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_701, AgradDistributionTestFixture, AgradDistributionWiener_ffv_701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_702, AgradDistributionTestFixture, AgradDistributionWiener_ffv_702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_703, AgradDistributionTestFixture, AgradDistributionWiener_ffv_703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_704, AgradDistributionTestFixture, AgradDistributionWiener_ffv_704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_705, AgradDistributionTestFixture, AgradDistributionWiener_ffv_705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_706, AgradDistributionTestFixture, AgradDistributionWiener_ffv_706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_707, AgradDistributionTestFixture, AgradDistributionWiener_ffv_707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_708, AgradDistributionTestFixture, AgradDistributionWiener_ffv_708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_709, AgradDistributionTestFixture, AgradDistributionWiener_ffv_709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_710, AgradDistributionTestFixture, AgradDistributionWiener_ffv_710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_711, AgradDistributionTestFixture, AgradDistributionWiener_ffv_711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_712, AgradDistributionTestFixture, AgradDistributionWiener_ffv_712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_713, AgradDistributionTestFixture, AgradDistributionWiener_ffv_713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_714, AgradDistributionTestFixture, AgradDistributionWiener_ffv_714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_715, AgradDistributionTestFixture, AgradDistributionWiener_ffv_715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_716, AgradDistributionTestFixture, AgradDistributionWiener_ffv_716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_717, AgradDistributionTestFixture, AgradDistributionWiener_ffv_717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_718, AgradDistributionTestFixture, AgradDistributionWiener_ffv_718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_719, AgradDistributionTestFixture, AgradDistributionWiener_ffv_719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_720, AgradDistributionTestFixture, AgradDistributionWiener_ffv_720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_721, AgradDistributionTestFixture, AgradDistributionWiener_ffv_721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_722, AgradDistributionTestFixture, AgradDistributionWiener_ffv_722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_723, AgradDistributionTestFixture, AgradDistributionWiener_ffv_723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_724, AgradDistributionTestFixture, AgradDistributionWiener_ffv_724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_725, AgradDistributionTestFixture, AgradDistributionWiener_ffv_725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_726, AgradDistributionTestFixture, AgradDistributionWiener_ffv_726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_727, AgradDistributionTestFixture, AgradDistributionWiener_ffv_727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_728, AgradDistributionTestFixture, AgradDistributionWiener_ffv_728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_729, AgradDistributionTestFixture, AgradDistributionWiener_ffv_729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_730, AgradDistributionTestFixture, AgradDistributionWiener_ffv_730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_731, AgradDistributionTestFixture, AgradDistributionWiener_ffv_731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_732, AgradDistributionTestFixture, AgradDistributionWiener_ffv_732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_733, AgradDistributionTestFixture, AgradDistributionWiener_ffv_733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_734, AgradDistributionTestFixture, AgradDistributionWiener_ffv_734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_735, AgradDistributionTestFixture, AgradDistributionWiener_ffv_735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_736, AgradDistributionTestFixture, AgradDistributionWiener_ffv_736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_737, AgradDistributionTestFixture, AgradDistributionWiener_ffv_737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_738, AgradDistributionTestFixture, AgradDistributionWiener_ffv_738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_739, AgradDistributionTestFixture, AgradDistributionWiener_ffv_739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_740, AgradDistributionTestFixture, AgradDistributionWiener_ffv_740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_741, AgradDistributionTestFixture, AgradDistributionWiener_ffv_741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_742, AgradDistributionTestFixture, AgradDistributionWiener_ffv_742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_743, AgradDistributionTestFixture, AgradDistributionWiener_ffv_743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_744, AgradDistributionTestFixture, AgradDistributionWiener_ffv_744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_745, AgradDistributionTestFixture, AgradDistributionWiener_ffv_745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_746, AgradDistributionTestFixture, AgradDistributionWiener_ffv_746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_747, AgradDistributionTestFixture, AgradDistributionWiener_ffv_747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_748, AgradDistributionTestFixture, AgradDistributionWiener_ffv_748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_749, AgradDistributionTestFixture, AgradDistributionWiener_ffv_749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_750, AgradDistributionTestFixture, AgradDistributionWiener_ffv_750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_751, AgradDistributionTestFixture, AgradDistributionWiener_ffv_751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_752, AgradDistributionTestFixture, AgradDistributionWiener_ffv_752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_753, AgradDistributionTestFixture, AgradDistributionWiener_ffv_753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_754, AgradDistributionTestFixture, AgradDistributionWiener_ffv_754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_755, AgradDistributionTestFixture, AgradDistributionWiener_ffv_755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_756, AgradDistributionTestFixture, AgradDistributionWiener_ffv_756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_757, AgradDistributionTestFixture, AgradDistributionWiener_ffv_757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_758, AgradDistributionTestFixture, AgradDistributionWiener_ffv_758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_759, AgradDistributionTestFixture, AgradDistributionWiener_ffv_759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_760, AgradDistributionTestFixture, AgradDistributionWiener_ffv_760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_761, AgradDistributionTestFixture, AgradDistributionWiener_ffv_761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_762, AgradDistributionTestFixture, AgradDistributionWiener_ffv_762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_763, AgradDistributionTestFixture, AgradDistributionWiener_ffv_763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_764, AgradDistributionTestFixture, AgradDistributionWiener_ffv_764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_765, AgradDistributionTestFixture, AgradDistributionWiener_ffv_765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_766, AgradDistributionTestFixture, AgradDistributionWiener_ffv_766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_767, AgradDistributionTestFixture, AgradDistributionWiener_ffv_767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_768, AgradDistributionTestFixture, AgradDistributionWiener_ffv_768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_769, AgradDistributionTestFixture, AgradDistributionWiener_ffv_769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_770, AgradDistributionTestFixture, AgradDistributionWiener_ffv_770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_771, AgradDistributionTestFixture, AgradDistributionWiener_ffv_771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_772, AgradDistributionTestFixture, AgradDistributionWiener_ffv_772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_773, AgradDistributionTestFixture, AgradDistributionWiener_ffv_773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_774, AgradDistributionTestFixture, AgradDistributionWiener_ffv_774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_775, AgradDistributionTestFixture, AgradDistributionWiener_ffv_775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_776, AgradDistributionTestFixture, AgradDistributionWiener_ffv_776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_777, AgradDistributionTestFixture, AgradDistributionWiener_ffv_777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_778, AgradDistributionTestFixture, AgradDistributionWiener_ffv_778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_779, AgradDistributionTestFixture, AgradDistributionWiener_ffv_779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_780, AgradDistributionTestFixture, AgradDistributionWiener_ffv_780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_781, AgradDistributionTestFixture, AgradDistributionWiener_ffv_781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_782, AgradDistributionTestFixture, AgradDistributionWiener_ffv_782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_783, AgradDistributionTestFixture, AgradDistributionWiener_ffv_783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_784, AgradDistributionTestFixture, AgradDistributionWiener_ffv_784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_785, AgradDistributionTestFixture, AgradDistributionWiener_ffv_785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_786, AgradDistributionTestFixture, AgradDistributionWiener_ffv_786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_787, AgradDistributionTestFixture, AgradDistributionWiener_ffv_787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_788, AgradDistributionTestFixture, AgradDistributionWiener_ffv_788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_789, AgradDistributionTestFixture, AgradDistributionWiener_ffv_789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_790, AgradDistributionTestFixture, AgradDistributionWiener_ffv_790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_791, AgradDistributionTestFixture, AgradDistributionWiener_ffv_791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_792, AgradDistributionTestFixture, AgradDistributionWiener_ffv_792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_793, AgradDistributionTestFixture, AgradDistributionWiener_ffv_793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_794, AgradDistributionTestFixture, AgradDistributionWiener_ffv_794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_795, AgradDistributionTestFixture, AgradDistributionWiener_ffv_795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_796, AgradDistributionTestFixture, AgradDistributionWiener_ffv_796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_797, AgradDistributionTestFixture, AgradDistributionWiener_ffv_797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_798, AgradDistributionTestFixture, AgradDistributionWiener_ffv_798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_799, AgradDistributionTestFixture, AgradDistributionWiener_ffv_799);
+
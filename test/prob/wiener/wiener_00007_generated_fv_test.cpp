@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_700;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_701;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_702;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_703;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_704;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_705;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_706;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_707;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_708;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_709;
+typedef boost::mpl::vector<double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_710;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, double, double, empty> type_fv_711;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_712;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_713;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_714;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_715;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_716;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_717;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_718;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_719;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_720;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_721;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_722;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_723;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_724;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_725;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_726;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_727;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_728;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_729;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_730;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_731;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_732;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_733;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_734;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_735;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_736;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_737;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_738;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_739;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_740;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_741;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_742;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_743;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_744;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_745;
+typedef boost::mpl::vector<double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_746;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_747;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_748;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_749;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_750;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_751;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_752;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_753;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_754;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_755;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_756;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_757;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_758;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_759;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_760;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_761;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_762;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_763;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_764;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_765;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_766;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_767;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_768;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_769;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_770;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_771;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_772;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_773;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_774;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_775;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_776;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_777;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_778;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_779;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_780;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_781;
+typedef boost::mpl::vector<double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_782;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, double, double, empty> type_fv_783;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, double, std::vector<double>, empty> type_fv_784;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_785;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, double, fvar<var>, empty> type_fv_786;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, empty> type_fv_787;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_788;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<double>, double, empty> type_fv_789;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, empty> type_fv_790;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_791;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, empty> type_fv_792;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_793;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_794;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_795;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_796;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_797;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_798;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_700> AgradDistributionWiener_fv_700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_701> AgradDistributionWiener_fv_701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_702> AgradDistributionWiener_fv_702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_703> AgradDistributionWiener_fv_703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_704> AgradDistributionWiener_fv_704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_705> AgradDistributionWiener_fv_705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_706> AgradDistributionWiener_fv_706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_707> AgradDistributionWiener_fv_707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_708> AgradDistributionWiener_fv_708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_709> AgradDistributionWiener_fv_709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_710> AgradDistributionWiener_fv_710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_711> AgradDistributionWiener_fv_711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_712> AgradDistributionWiener_fv_712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_713> AgradDistributionWiener_fv_713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_714> AgradDistributionWiener_fv_714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_715> AgradDistributionWiener_fv_715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_716> AgradDistributionWiener_fv_716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_717> AgradDistributionWiener_fv_717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_718> AgradDistributionWiener_fv_718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_719> AgradDistributionWiener_fv_719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_720> AgradDistributionWiener_fv_720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_721> AgradDistributionWiener_fv_721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_722> AgradDistributionWiener_fv_722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_723> AgradDistributionWiener_fv_723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_724> AgradDistributionWiener_fv_724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_725> AgradDistributionWiener_fv_725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_726> AgradDistributionWiener_fv_726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_727> AgradDistributionWiener_fv_727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_728> AgradDistributionWiener_fv_728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_729> AgradDistributionWiener_fv_729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_730> AgradDistributionWiener_fv_730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_731> AgradDistributionWiener_fv_731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_732> AgradDistributionWiener_fv_732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_733> AgradDistributionWiener_fv_733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_734> AgradDistributionWiener_fv_734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_735> AgradDistributionWiener_fv_735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_736> AgradDistributionWiener_fv_736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_737> AgradDistributionWiener_fv_737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_738> AgradDistributionWiener_fv_738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_739> AgradDistributionWiener_fv_739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_740> AgradDistributionWiener_fv_740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_741> AgradDistributionWiener_fv_741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_742> AgradDistributionWiener_fv_742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_743> AgradDistributionWiener_fv_743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_744> AgradDistributionWiener_fv_744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_745> AgradDistributionWiener_fv_745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_746> AgradDistributionWiener_fv_746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_747> AgradDistributionWiener_fv_747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_748> AgradDistributionWiener_fv_748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_749> AgradDistributionWiener_fv_749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_750> AgradDistributionWiener_fv_750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_751> AgradDistributionWiener_fv_751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_752> AgradDistributionWiener_fv_752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_753> AgradDistributionWiener_fv_753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_754> AgradDistributionWiener_fv_754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_755> AgradDistributionWiener_fv_755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_756> AgradDistributionWiener_fv_756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_757> AgradDistributionWiener_fv_757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_758> AgradDistributionWiener_fv_758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_759> AgradDistributionWiener_fv_759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_760> AgradDistributionWiener_fv_760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_761> AgradDistributionWiener_fv_761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_762> AgradDistributionWiener_fv_762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_763> AgradDistributionWiener_fv_763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_764> AgradDistributionWiener_fv_764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_765> AgradDistributionWiener_fv_765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_766> AgradDistributionWiener_fv_766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_767> AgradDistributionWiener_fv_767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_768> AgradDistributionWiener_fv_768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_769> AgradDistributionWiener_fv_769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_770> AgradDistributionWiener_fv_770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_771> AgradDistributionWiener_fv_771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_772> AgradDistributionWiener_fv_772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_773> AgradDistributionWiener_fv_773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_774> AgradDistributionWiener_fv_774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_775> AgradDistributionWiener_fv_775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_776> AgradDistributionWiener_fv_776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_777> AgradDistributionWiener_fv_777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_778> AgradDistributionWiener_fv_778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_779> AgradDistributionWiener_fv_779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_780> AgradDistributionWiener_fv_780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_781> AgradDistributionWiener_fv_781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_782> AgradDistributionWiener_fv_782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_783> AgradDistributionWiener_fv_783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_784> AgradDistributionWiener_fv_784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_785> AgradDistributionWiener_fv_785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_786> AgradDistributionWiener_fv_786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_787> AgradDistributionWiener_fv_787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_788> AgradDistributionWiener_fv_788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_789> AgradDistributionWiener_fv_789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_790> AgradDistributionWiener_fv_790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_791> AgradDistributionWiener_fv_791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_792> AgradDistributionWiener_fv_792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_793> AgradDistributionWiener_fv_793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_794> AgradDistributionWiener_fv_794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_795> AgradDistributionWiener_fv_795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_796> AgradDistributionWiener_fv_796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_797> AgradDistributionWiener_fv_797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_798> AgradDistributionWiener_fv_798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_799> AgradDistributionWiener_fv_799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_700, AgradDistributionTestFixture, AgradDistributionWiener_fv_700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_701, AgradDistributionTestFixture, AgradDistributionWiener_fv_701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_702, AgradDistributionTestFixture, AgradDistributionWiener_fv_702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_703, AgradDistributionTestFixture, AgradDistributionWiener_fv_703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_704, AgradDistributionTestFixture, AgradDistributionWiener_fv_704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_705, AgradDistributionTestFixture, AgradDistributionWiener_fv_705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_706, AgradDistributionTestFixture, AgradDistributionWiener_fv_706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_707, AgradDistributionTestFixture, AgradDistributionWiener_fv_707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_708, AgradDistributionTestFixture, AgradDistributionWiener_fv_708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_709, AgradDistributionTestFixture, AgradDistributionWiener_fv_709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_710, AgradDistributionTestFixture, AgradDistributionWiener_fv_710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_711, AgradDistributionTestFixture, AgradDistributionWiener_fv_711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_712, AgradDistributionTestFixture, AgradDistributionWiener_fv_712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_713, AgradDistributionTestFixture, AgradDistributionWiener_fv_713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_714, AgradDistributionTestFixture, AgradDistributionWiener_fv_714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_715, AgradDistributionTestFixture, AgradDistributionWiener_fv_715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_716, AgradDistributionTestFixture, AgradDistributionWiener_fv_716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_717, AgradDistributionTestFixture, AgradDistributionWiener_fv_717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_718, AgradDistributionTestFixture, AgradDistributionWiener_fv_718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_719, AgradDistributionTestFixture, AgradDistributionWiener_fv_719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_720, AgradDistributionTestFixture, AgradDistributionWiener_fv_720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_721, AgradDistributionTestFixture, AgradDistributionWiener_fv_721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_722, AgradDistributionTestFixture, AgradDistributionWiener_fv_722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_723, AgradDistributionTestFixture, AgradDistributionWiener_fv_723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_724, AgradDistributionTestFixture, AgradDistributionWiener_fv_724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_725, AgradDistributionTestFixture, AgradDistributionWiener_fv_725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_726, AgradDistributionTestFixture, AgradDistributionWiener_fv_726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_727, AgradDistributionTestFixture, AgradDistributionWiener_fv_727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_728, AgradDistributionTestFixture, AgradDistributionWiener_fv_728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_729, AgradDistributionTestFixture, AgradDistributionWiener_fv_729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_730, AgradDistributionTestFixture, AgradDistributionWiener_fv_730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_731, AgradDistributionTestFixture, AgradDistributionWiener_fv_731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_732, AgradDistributionTestFixture, AgradDistributionWiener_fv_732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_733, AgradDistributionTestFixture, AgradDistributionWiener_fv_733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_734, AgradDistributionTestFixture, AgradDistributionWiener_fv_734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_735, AgradDistributionTestFixture, AgradDistributionWiener_fv_735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_736, AgradDistributionTestFixture, AgradDistributionWiener_fv_736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_737, AgradDistributionTestFixture, AgradDistributionWiener_fv_737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_738, AgradDistributionTestFixture, AgradDistributionWiener_fv_738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_739, AgradDistributionTestFixture, AgradDistributionWiener_fv_739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_740, AgradDistributionTestFixture, AgradDistributionWiener_fv_740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_741, AgradDistributionTestFixture, AgradDistributionWiener_fv_741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_742, AgradDistributionTestFixture, AgradDistributionWiener_fv_742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_743, AgradDistributionTestFixture, AgradDistributionWiener_fv_743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_744, AgradDistributionTestFixture, AgradDistributionWiener_fv_744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_745, AgradDistributionTestFixture, AgradDistributionWiener_fv_745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_746, AgradDistributionTestFixture, AgradDistributionWiener_fv_746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_747, AgradDistributionTestFixture, AgradDistributionWiener_fv_747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_748, AgradDistributionTestFixture, AgradDistributionWiener_fv_748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_749, AgradDistributionTestFixture, AgradDistributionWiener_fv_749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_750, AgradDistributionTestFixture, AgradDistributionWiener_fv_750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_751, AgradDistributionTestFixture, AgradDistributionWiener_fv_751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_752, AgradDistributionTestFixture, AgradDistributionWiener_fv_752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_753, AgradDistributionTestFixture, AgradDistributionWiener_fv_753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_754, AgradDistributionTestFixture, AgradDistributionWiener_fv_754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_755, AgradDistributionTestFixture, AgradDistributionWiener_fv_755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_756, AgradDistributionTestFixture, AgradDistributionWiener_fv_756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_757, AgradDistributionTestFixture, AgradDistributionWiener_fv_757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_758, AgradDistributionTestFixture, AgradDistributionWiener_fv_758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_759, AgradDistributionTestFixture, AgradDistributionWiener_fv_759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_760, AgradDistributionTestFixture, AgradDistributionWiener_fv_760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_761, AgradDistributionTestFixture, AgradDistributionWiener_fv_761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_762, AgradDistributionTestFixture, AgradDistributionWiener_fv_762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_763, AgradDistributionTestFixture, AgradDistributionWiener_fv_763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_764, AgradDistributionTestFixture, AgradDistributionWiener_fv_764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_765, AgradDistributionTestFixture, AgradDistributionWiener_fv_765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_766, AgradDistributionTestFixture, AgradDistributionWiener_fv_766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_767, AgradDistributionTestFixture, AgradDistributionWiener_fv_767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_768, AgradDistributionTestFixture, AgradDistributionWiener_fv_768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_769, AgradDistributionTestFixture, AgradDistributionWiener_fv_769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_770, AgradDistributionTestFixture, AgradDistributionWiener_fv_770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_771, AgradDistributionTestFixture, AgradDistributionWiener_fv_771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_772, AgradDistributionTestFixture, AgradDistributionWiener_fv_772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_773, AgradDistributionTestFixture, AgradDistributionWiener_fv_773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_774, AgradDistributionTestFixture, AgradDistributionWiener_fv_774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_775, AgradDistributionTestFixture, AgradDistributionWiener_fv_775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_776, AgradDistributionTestFixture, AgradDistributionWiener_fv_776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_777, AgradDistributionTestFixture, AgradDistributionWiener_fv_777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_778, AgradDistributionTestFixture, AgradDistributionWiener_fv_778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_779, AgradDistributionTestFixture, AgradDistributionWiener_fv_779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_780, AgradDistributionTestFixture, AgradDistributionWiener_fv_780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_781, AgradDistributionTestFixture, AgradDistributionWiener_fv_781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_782, AgradDistributionTestFixture, AgradDistributionWiener_fv_782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_783, AgradDistributionTestFixture, AgradDistributionWiener_fv_783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_784, AgradDistributionTestFixture, AgradDistributionWiener_fv_784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_785, AgradDistributionTestFixture, AgradDistributionWiener_fv_785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_786, AgradDistributionTestFixture, AgradDistributionWiener_fv_786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_787, AgradDistributionTestFixture, AgradDistributionWiener_fv_787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_788, AgradDistributionTestFixture, AgradDistributionWiener_fv_788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_789, AgradDistributionTestFixture, AgradDistributionWiener_fv_789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_790, AgradDistributionTestFixture, AgradDistributionWiener_fv_790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_791, AgradDistributionTestFixture, AgradDistributionWiener_fv_791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_792, AgradDistributionTestFixture, AgradDistributionWiener_fv_792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_793, AgradDistributionTestFixture, AgradDistributionWiener_fv_793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_794, AgradDistributionTestFixture, AgradDistributionWiener_fv_794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_795, AgradDistributionTestFixture, AgradDistributionWiener_fv_795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_796, AgradDistributionTestFixture, AgradDistributionWiener_fv_796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_797, AgradDistributionTestFixture, AgradDistributionWiener_fv_797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_798, AgradDistributionTestFixture, AgradDistributionWiener_fv_798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_799, AgradDistributionTestFixture, AgradDistributionWiener_fv_799);
+
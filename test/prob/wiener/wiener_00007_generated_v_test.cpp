@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_700;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_701;
+typedef boost::mpl::vector<double, var, std::vector<double>, var, double, empty> type_v_702;
+typedef boost::mpl::vector<double, var, std::vector<double>, var, std::vector<double>, empty> type_v_703;
+typedef boost::mpl::vector<double, var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_704;
+typedef boost::mpl::vector<double, var, std::vector<double>, var, var, empty> type_v_705;
+typedef boost::mpl::vector<double, var, std::vector<double>, var, std::vector<var>, empty> type_v_706;
+typedef boost::mpl::vector<double, var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_707;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<var>, double, empty> type_v_708;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_709;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_710;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<var>, var, empty> type_v_711;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_712;
+typedef boost::mpl::vector<double, var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_713;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_714;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_715;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_716;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_717;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_718;
+typedef boost::mpl::vector<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_719;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_720;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_721;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_722;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_723;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_724;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_725;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_726;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_727;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_728;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_729;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_730;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_731;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_732;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_733;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_734;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_735;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_736;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_737;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_738;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_739;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_740;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_741;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_742;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_743;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_744;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_745;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_746;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_747;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_748;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_749;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_750;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_751;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_752;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_753;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_754;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_755;
+typedef boost::mpl::vector<double, var, var, double, double, empty> type_v_756;
+typedef boost::mpl::vector<double, var, var, double, std::vector<double>, empty> type_v_757;
+typedef boost::mpl::vector<double, var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_758;
+typedef boost::mpl::vector<double, var, var, double, var, empty> type_v_759;
+typedef boost::mpl::vector<double, var, var, double, std::vector<var>, empty> type_v_760;
+typedef boost::mpl::vector<double, var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_761;
+typedef boost::mpl::vector<double, var, var, std::vector<double>, double, empty> type_v_762;
+typedef boost::mpl::vector<double, var, var, std::vector<double>, std::vector<double>, empty> type_v_763;
+typedef boost::mpl::vector<double, var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_764;
+typedef boost::mpl::vector<double, var, var, std::vector<double>, var, empty> type_v_765;
+typedef boost::mpl::vector<double, var, var, std::vector<double>, std::vector<var>, empty> type_v_766;
+typedef boost::mpl::vector<double, var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_767;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_768;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_769;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_770;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_771;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_772;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_773;
+typedef boost::mpl::vector<double, var, var, var, double, empty> type_v_774;
+typedef boost::mpl::vector<double, var, var, var, std::vector<double>, empty> type_v_775;
+typedef boost::mpl::vector<double, var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_776;
+typedef boost::mpl::vector<double, var, var, var, var, empty> type_v_777;
+typedef boost::mpl::vector<double, var, var, var, std::vector<var>, empty> type_v_778;
+typedef boost::mpl::vector<double, var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_779;
+typedef boost::mpl::vector<double, var, var, std::vector<var>, double, empty> type_v_780;
+typedef boost::mpl::vector<double, var, var, std::vector<var>, std::vector<double>, empty> type_v_781;
+typedef boost::mpl::vector<double, var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_782;
+typedef boost::mpl::vector<double, var, var, std::vector<var>, var, empty> type_v_783;
+typedef boost::mpl::vector<double, var, var, std::vector<var>, std::vector<var>, empty> type_v_784;
+typedef boost::mpl::vector<double, var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_785;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_786;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_787;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_788;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_789;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_790;
+typedef boost::mpl::vector<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_791;
+typedef boost::mpl::vector<double, var, std::vector<var>, double, double, empty> type_v_792;
+typedef boost::mpl::vector<double, var, std::vector<var>, double, std::vector<double>, empty> type_v_793;
+typedef boost::mpl::vector<double, var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_794;
+typedef boost::mpl::vector<double, var, std::vector<var>, double, var, empty> type_v_795;
+typedef boost::mpl::vector<double, var, std::vector<var>, double, std::vector<var>, empty> type_v_796;
+typedef boost::mpl::vector<double, var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_797;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<double>, double, empty> type_v_798;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_700> AgradDistributionWiener_v_700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_701> AgradDistributionWiener_v_701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_702> AgradDistributionWiener_v_702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_703> AgradDistributionWiener_v_703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_704> AgradDistributionWiener_v_704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_705> AgradDistributionWiener_v_705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_706> AgradDistributionWiener_v_706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_707> AgradDistributionWiener_v_707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_708> AgradDistributionWiener_v_708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_709> AgradDistributionWiener_v_709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_710> AgradDistributionWiener_v_710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_711> AgradDistributionWiener_v_711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_712> AgradDistributionWiener_v_712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_713> AgradDistributionWiener_v_713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_714> AgradDistributionWiener_v_714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_715> AgradDistributionWiener_v_715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_716> AgradDistributionWiener_v_716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_717> AgradDistributionWiener_v_717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_718> AgradDistributionWiener_v_718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_719> AgradDistributionWiener_v_719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_720> AgradDistributionWiener_v_720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_721> AgradDistributionWiener_v_721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_722> AgradDistributionWiener_v_722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_723> AgradDistributionWiener_v_723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_724> AgradDistributionWiener_v_724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_725> AgradDistributionWiener_v_725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_726> AgradDistributionWiener_v_726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_727> AgradDistributionWiener_v_727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_728> AgradDistributionWiener_v_728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_729> AgradDistributionWiener_v_729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_730> AgradDistributionWiener_v_730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_731> AgradDistributionWiener_v_731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_732> AgradDistributionWiener_v_732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_733> AgradDistributionWiener_v_733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_734> AgradDistributionWiener_v_734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_735> AgradDistributionWiener_v_735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_736> AgradDistributionWiener_v_736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_737> AgradDistributionWiener_v_737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_738> AgradDistributionWiener_v_738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_739> AgradDistributionWiener_v_739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_740> AgradDistributionWiener_v_740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_741> AgradDistributionWiener_v_741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_742> AgradDistributionWiener_v_742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_743> AgradDistributionWiener_v_743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_744> AgradDistributionWiener_v_744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_745> AgradDistributionWiener_v_745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_746> AgradDistributionWiener_v_746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_747> AgradDistributionWiener_v_747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_748> AgradDistributionWiener_v_748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_749> AgradDistributionWiener_v_749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_750> AgradDistributionWiener_v_750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_751> AgradDistributionWiener_v_751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_752> AgradDistributionWiener_v_752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_753> AgradDistributionWiener_v_753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_754> AgradDistributionWiener_v_754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_755> AgradDistributionWiener_v_755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_756> AgradDistributionWiener_v_756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_757> AgradDistributionWiener_v_757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_758> AgradDistributionWiener_v_758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_759> AgradDistributionWiener_v_759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_760> AgradDistributionWiener_v_760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_761> AgradDistributionWiener_v_761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_762> AgradDistributionWiener_v_762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_763> AgradDistributionWiener_v_763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_764> AgradDistributionWiener_v_764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_765> AgradDistributionWiener_v_765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_766> AgradDistributionWiener_v_766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_767> AgradDistributionWiener_v_767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_768> AgradDistributionWiener_v_768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_769> AgradDistributionWiener_v_769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_770> AgradDistributionWiener_v_770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_771> AgradDistributionWiener_v_771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_772> AgradDistributionWiener_v_772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_773> AgradDistributionWiener_v_773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_774> AgradDistributionWiener_v_774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_775> AgradDistributionWiener_v_775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_776> AgradDistributionWiener_v_776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_777> AgradDistributionWiener_v_777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_778> AgradDistributionWiener_v_778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_779> AgradDistributionWiener_v_779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_780> AgradDistributionWiener_v_780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_781> AgradDistributionWiener_v_781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_782> AgradDistributionWiener_v_782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_783> AgradDistributionWiener_v_783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_784> AgradDistributionWiener_v_784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_785> AgradDistributionWiener_v_785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_786> AgradDistributionWiener_v_786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_787> AgradDistributionWiener_v_787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_788> AgradDistributionWiener_v_788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_789> AgradDistributionWiener_v_789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_790> AgradDistributionWiener_v_790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_791> AgradDistributionWiener_v_791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_792> AgradDistributionWiener_v_792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_793> AgradDistributionWiener_v_793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_794> AgradDistributionWiener_v_794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_795> AgradDistributionWiener_v_795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_796> AgradDistributionWiener_v_796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_797> AgradDistributionWiener_v_797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_798> AgradDistributionWiener_v_798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_799> AgradDistributionWiener_v_799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_700, AgradDistributionTestFixture, AgradDistributionWiener_v_700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_701, AgradDistributionTestFixture, AgradDistributionWiener_v_701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_702, AgradDistributionTestFixture, AgradDistributionWiener_v_702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_703, AgradDistributionTestFixture, AgradDistributionWiener_v_703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_704, AgradDistributionTestFixture, AgradDistributionWiener_v_704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_705, AgradDistributionTestFixture, AgradDistributionWiener_v_705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_706, AgradDistributionTestFixture, AgradDistributionWiener_v_706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_707, AgradDistributionTestFixture, AgradDistributionWiener_v_707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_708, AgradDistributionTestFixture, AgradDistributionWiener_v_708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_709, AgradDistributionTestFixture, AgradDistributionWiener_v_709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_710, AgradDistributionTestFixture, AgradDistributionWiener_v_710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_711, AgradDistributionTestFixture, AgradDistributionWiener_v_711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_712, AgradDistributionTestFixture, AgradDistributionWiener_v_712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_713, AgradDistributionTestFixture, AgradDistributionWiener_v_713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_714, AgradDistributionTestFixture, AgradDistributionWiener_v_714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_715, AgradDistributionTestFixture, AgradDistributionWiener_v_715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_716, AgradDistributionTestFixture, AgradDistributionWiener_v_716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_717, AgradDistributionTestFixture, AgradDistributionWiener_v_717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_718, AgradDistributionTestFixture, AgradDistributionWiener_v_718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_719, AgradDistributionTestFixture, AgradDistributionWiener_v_719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_720, AgradDistributionTestFixture, AgradDistributionWiener_v_720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_721, AgradDistributionTestFixture, AgradDistributionWiener_v_721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_722, AgradDistributionTestFixture, AgradDistributionWiener_v_722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_723, AgradDistributionTestFixture, AgradDistributionWiener_v_723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_724, AgradDistributionTestFixture, AgradDistributionWiener_v_724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_725, AgradDistributionTestFixture, AgradDistributionWiener_v_725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_726, AgradDistributionTestFixture, AgradDistributionWiener_v_726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_727, AgradDistributionTestFixture, AgradDistributionWiener_v_727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_728, AgradDistributionTestFixture, AgradDistributionWiener_v_728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_729, AgradDistributionTestFixture, AgradDistributionWiener_v_729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_730, AgradDistributionTestFixture, AgradDistributionWiener_v_730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_731, AgradDistributionTestFixture, AgradDistributionWiener_v_731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_732, AgradDistributionTestFixture, AgradDistributionWiener_v_732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_733, AgradDistributionTestFixture, AgradDistributionWiener_v_733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_734, AgradDistributionTestFixture, AgradDistributionWiener_v_734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_735, AgradDistributionTestFixture, AgradDistributionWiener_v_735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_736, AgradDistributionTestFixture, AgradDistributionWiener_v_736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_737, AgradDistributionTestFixture, AgradDistributionWiener_v_737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_738, AgradDistributionTestFixture, AgradDistributionWiener_v_738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_739, AgradDistributionTestFixture, AgradDistributionWiener_v_739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_740, AgradDistributionTestFixture, AgradDistributionWiener_v_740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_741, AgradDistributionTestFixture, AgradDistributionWiener_v_741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_742, AgradDistributionTestFixture, AgradDistributionWiener_v_742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_743, AgradDistributionTestFixture, AgradDistributionWiener_v_743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_744, AgradDistributionTestFixture, AgradDistributionWiener_v_744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_745, AgradDistributionTestFixture, AgradDistributionWiener_v_745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_746, AgradDistributionTestFixture, AgradDistributionWiener_v_746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_747, AgradDistributionTestFixture, AgradDistributionWiener_v_747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_748, AgradDistributionTestFixture, AgradDistributionWiener_v_748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_749, AgradDistributionTestFixture, AgradDistributionWiener_v_749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_750, AgradDistributionTestFixture, AgradDistributionWiener_v_750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_751, AgradDistributionTestFixture, AgradDistributionWiener_v_751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_752, AgradDistributionTestFixture, AgradDistributionWiener_v_752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_753, AgradDistributionTestFixture, AgradDistributionWiener_v_753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_754, AgradDistributionTestFixture, AgradDistributionWiener_v_754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_755, AgradDistributionTestFixture, AgradDistributionWiener_v_755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_756, AgradDistributionTestFixture, AgradDistributionWiener_v_756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_757, AgradDistributionTestFixture, AgradDistributionWiener_v_757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_758, AgradDistributionTestFixture, AgradDistributionWiener_v_758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_759, AgradDistributionTestFixture, AgradDistributionWiener_v_759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_760, AgradDistributionTestFixture, AgradDistributionWiener_v_760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_761, AgradDistributionTestFixture, AgradDistributionWiener_v_761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_762, AgradDistributionTestFixture, AgradDistributionWiener_v_762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_763, AgradDistributionTestFixture, AgradDistributionWiener_v_763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_764, AgradDistributionTestFixture, AgradDistributionWiener_v_764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_765, AgradDistributionTestFixture, AgradDistributionWiener_v_765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_766, AgradDistributionTestFixture, AgradDistributionWiener_v_766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_767, AgradDistributionTestFixture, AgradDistributionWiener_v_767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_768, AgradDistributionTestFixture, AgradDistributionWiener_v_768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_769, AgradDistributionTestFixture, AgradDistributionWiener_v_769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_770, AgradDistributionTestFixture, AgradDistributionWiener_v_770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_771, AgradDistributionTestFixture, AgradDistributionWiener_v_771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_772, AgradDistributionTestFixture, AgradDistributionWiener_v_772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_773, AgradDistributionTestFixture, AgradDistributionWiener_v_773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_774, AgradDistributionTestFixture, AgradDistributionWiener_v_774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_775, AgradDistributionTestFixture, AgradDistributionWiener_v_775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_776, AgradDistributionTestFixture, AgradDistributionWiener_v_776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_777, AgradDistributionTestFixture, AgradDistributionWiener_v_777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_778, AgradDistributionTestFixture, AgradDistributionWiener_v_778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_779, AgradDistributionTestFixture, AgradDistributionWiener_v_779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_780, AgradDistributionTestFixture, AgradDistributionWiener_v_780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_781, AgradDistributionTestFixture, AgradDistributionWiener_v_781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_782, AgradDistributionTestFixture, AgradDistributionWiener_v_782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_783, AgradDistributionTestFixture, AgradDistributionWiener_v_783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_784, AgradDistributionTestFixture, AgradDistributionWiener_v_784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_785, AgradDistributionTestFixture, AgradDistributionWiener_v_785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_786, AgradDistributionTestFixture, AgradDistributionWiener_v_786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_787, AgradDistributionTestFixture, AgradDistributionWiener_v_787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_788, AgradDistributionTestFixture, AgradDistributionWiener_v_788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_789, AgradDistributionTestFixture, AgradDistributionWiener_v_789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_790, AgradDistributionTestFixture, AgradDistributionWiener_v_790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_791, AgradDistributionTestFixture, AgradDistributionWiener_v_791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_792, AgradDistributionTestFixture, AgradDistributionWiener_v_792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_793, AgradDistributionTestFixture, AgradDistributionWiener_v_793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_794, AgradDistributionTestFixture, AgradDistributionWiener_v_794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_795, AgradDistributionTestFixture, AgradDistributionWiener_v_795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_796, AgradDistributionTestFixture, AgradDistributionWiener_v_796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_797, AgradDistributionTestFixture, AgradDistributionWiener_v_797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_798, AgradDistributionTestFixture, AgradDistributionWiener_v_798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_799, AgradDistributionTestFixture, AgradDistributionWiener_v_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_800;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, fvar<double>, double, empty> type_fd_801;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, fvar<double>, std::vector<double>, empty> type_fd_802;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_803;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, fvar<double>, fvar<double>, empty> type_fd_804;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_805;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_806;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, double, empty> type_fd_807;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_808;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_809;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_810;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_811;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_812;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_813;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_814;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_815;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_816;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_817;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_818;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, double, double, empty> type_fd_819;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, empty> type_fd_820;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_821;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, empty> type_fd_822;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_823;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_824;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, empty> type_fd_825;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_826;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_827;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_828;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_829;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_830;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_831;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_832;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_833;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_834;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_835;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_836;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, double, empty> type_fd_837;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_838;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_839;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_840;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_841;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_842;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_843;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_844;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_845;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_846;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_847;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_848;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_849;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_850;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_851;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_852;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_853;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_854;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fd_855;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_856;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_857;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_858;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_859;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_860;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_861;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_862;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_863;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_864;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_865;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_866;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_867;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_868;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_869;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_870;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_871;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_872;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_873;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_874;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_875;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_876;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_877;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_878;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_879;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_880;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_881;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_882;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_883;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_884;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_885;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_886;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_887;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_888;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_889;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_890;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, double, double, empty> type_fd_891;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, double, std::vector<double>, empty> type_fd_892;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_893;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, double, fvar<double>, empty> type_fd_894;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_895;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_896;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, double, empty> type_fd_897;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_898;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_800> AgradDistributionWiener_fd_800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_801> AgradDistributionWiener_fd_801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_802> AgradDistributionWiener_fd_802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_803> AgradDistributionWiener_fd_803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_804> AgradDistributionWiener_fd_804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_805> AgradDistributionWiener_fd_805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_806> AgradDistributionWiener_fd_806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_807> AgradDistributionWiener_fd_807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_808> AgradDistributionWiener_fd_808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_809> AgradDistributionWiener_fd_809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_810> AgradDistributionWiener_fd_810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_811> AgradDistributionWiener_fd_811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_812> AgradDistributionWiener_fd_812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_813> AgradDistributionWiener_fd_813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_814> AgradDistributionWiener_fd_814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_815> AgradDistributionWiener_fd_815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_816> AgradDistributionWiener_fd_816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_817> AgradDistributionWiener_fd_817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_818> AgradDistributionWiener_fd_818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_819> AgradDistributionWiener_fd_819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_820> AgradDistributionWiener_fd_820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_821> AgradDistributionWiener_fd_821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_822> AgradDistributionWiener_fd_822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_823> AgradDistributionWiener_fd_823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_824> AgradDistributionWiener_fd_824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_825> AgradDistributionWiener_fd_825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_826> AgradDistributionWiener_fd_826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_827> AgradDistributionWiener_fd_827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_828> AgradDistributionWiener_fd_828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_829> AgradDistributionWiener_fd_829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_830> AgradDistributionWiener_fd_830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_831> AgradDistributionWiener_fd_831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_832> AgradDistributionWiener_fd_832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_833> AgradDistributionWiener_fd_833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_834> AgradDistributionWiener_fd_834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_835> AgradDistributionWiener_fd_835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_836> AgradDistributionWiener_fd_836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_837> AgradDistributionWiener_fd_837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_838> AgradDistributionWiener_fd_838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_839> AgradDistributionWiener_fd_839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_840> AgradDistributionWiener_fd_840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_841> AgradDistributionWiener_fd_841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_842> AgradDistributionWiener_fd_842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_843> AgradDistributionWiener_fd_843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_844> AgradDistributionWiener_fd_844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_845> AgradDistributionWiener_fd_845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_846> AgradDistributionWiener_fd_846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_847> AgradDistributionWiener_fd_847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_848> AgradDistributionWiener_fd_848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_849> AgradDistributionWiener_fd_849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_850> AgradDistributionWiener_fd_850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_851> AgradDistributionWiener_fd_851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_852> AgradDistributionWiener_fd_852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_853> AgradDistributionWiener_fd_853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_854> AgradDistributionWiener_fd_854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_855> AgradDistributionWiener_fd_855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_856> AgradDistributionWiener_fd_856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_857> AgradDistributionWiener_fd_857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_858> AgradDistributionWiener_fd_858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_859> AgradDistributionWiener_fd_859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_860> AgradDistributionWiener_fd_860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_861> AgradDistributionWiener_fd_861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_862> AgradDistributionWiener_fd_862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_863> AgradDistributionWiener_fd_863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_864> AgradDistributionWiener_fd_864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_865> AgradDistributionWiener_fd_865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_866> AgradDistributionWiener_fd_866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_867> AgradDistributionWiener_fd_867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_868> AgradDistributionWiener_fd_868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_869> AgradDistributionWiener_fd_869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_870> AgradDistributionWiener_fd_870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_871> AgradDistributionWiener_fd_871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_872> AgradDistributionWiener_fd_872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_873> AgradDistributionWiener_fd_873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_874> AgradDistributionWiener_fd_874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_875> AgradDistributionWiener_fd_875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_876> AgradDistributionWiener_fd_876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_877> AgradDistributionWiener_fd_877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_878> AgradDistributionWiener_fd_878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_879> AgradDistributionWiener_fd_879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_880> AgradDistributionWiener_fd_880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_881> AgradDistributionWiener_fd_881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_882> AgradDistributionWiener_fd_882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_883> AgradDistributionWiener_fd_883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_884> AgradDistributionWiener_fd_884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_885> AgradDistributionWiener_fd_885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_886> AgradDistributionWiener_fd_886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_887> AgradDistributionWiener_fd_887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_888> AgradDistributionWiener_fd_888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_889> AgradDistributionWiener_fd_889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_890> AgradDistributionWiener_fd_890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_891> AgradDistributionWiener_fd_891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_892> AgradDistributionWiener_fd_892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_893> AgradDistributionWiener_fd_893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_894> AgradDistributionWiener_fd_894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_895> AgradDistributionWiener_fd_895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_896> AgradDistributionWiener_fd_896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_897> AgradDistributionWiener_fd_897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_898> AgradDistributionWiener_fd_898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_899> AgradDistributionWiener_fd_899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_800, AgradDistributionTestFixture, AgradDistributionWiener_fd_800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_801, AgradDistributionTestFixture, AgradDistributionWiener_fd_801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_802, AgradDistributionTestFixture, AgradDistributionWiener_fd_802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_803, AgradDistributionTestFixture, AgradDistributionWiener_fd_803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_804, AgradDistributionTestFixture, AgradDistributionWiener_fd_804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_805, AgradDistributionTestFixture, AgradDistributionWiener_fd_805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_806, AgradDistributionTestFixture, AgradDistributionWiener_fd_806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_807, AgradDistributionTestFixture, AgradDistributionWiener_fd_807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_808, AgradDistributionTestFixture, AgradDistributionWiener_fd_808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_809, AgradDistributionTestFixture, AgradDistributionWiener_fd_809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_810, AgradDistributionTestFixture, AgradDistributionWiener_fd_810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_811, AgradDistributionTestFixture, AgradDistributionWiener_fd_811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_812, AgradDistributionTestFixture, AgradDistributionWiener_fd_812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_813, AgradDistributionTestFixture, AgradDistributionWiener_fd_813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_814, AgradDistributionTestFixture, AgradDistributionWiener_fd_814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_815, AgradDistributionTestFixture, AgradDistributionWiener_fd_815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_816, AgradDistributionTestFixture, AgradDistributionWiener_fd_816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_817, AgradDistributionTestFixture, AgradDistributionWiener_fd_817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_818, AgradDistributionTestFixture, AgradDistributionWiener_fd_818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_819, AgradDistributionTestFixture, AgradDistributionWiener_fd_819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_820, AgradDistributionTestFixture, AgradDistributionWiener_fd_820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_821, AgradDistributionTestFixture, AgradDistributionWiener_fd_821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_822, AgradDistributionTestFixture, AgradDistributionWiener_fd_822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_823, AgradDistributionTestFixture, AgradDistributionWiener_fd_823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_824, AgradDistributionTestFixture, AgradDistributionWiener_fd_824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_825, AgradDistributionTestFixture, AgradDistributionWiener_fd_825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_826, AgradDistributionTestFixture, AgradDistributionWiener_fd_826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_827, AgradDistributionTestFixture, AgradDistributionWiener_fd_827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_828, AgradDistributionTestFixture, AgradDistributionWiener_fd_828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_829, AgradDistributionTestFixture, AgradDistributionWiener_fd_829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_830, AgradDistributionTestFixture, AgradDistributionWiener_fd_830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_831, AgradDistributionTestFixture, AgradDistributionWiener_fd_831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_832, AgradDistributionTestFixture, AgradDistributionWiener_fd_832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_833, AgradDistributionTestFixture, AgradDistributionWiener_fd_833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_834, AgradDistributionTestFixture, AgradDistributionWiener_fd_834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_835, AgradDistributionTestFixture, AgradDistributionWiener_fd_835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_836, AgradDistributionTestFixture, AgradDistributionWiener_fd_836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_837, AgradDistributionTestFixture, AgradDistributionWiener_fd_837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_838, AgradDistributionTestFixture, AgradDistributionWiener_fd_838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_839, AgradDistributionTestFixture, AgradDistributionWiener_fd_839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_840, AgradDistributionTestFixture, AgradDistributionWiener_fd_840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_841, AgradDistributionTestFixture, AgradDistributionWiener_fd_841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_842, AgradDistributionTestFixture, AgradDistributionWiener_fd_842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_843, AgradDistributionTestFixture, AgradDistributionWiener_fd_843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_844, AgradDistributionTestFixture, AgradDistributionWiener_fd_844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_845, AgradDistributionTestFixture, AgradDistributionWiener_fd_845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_846, AgradDistributionTestFixture, AgradDistributionWiener_fd_846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_847, AgradDistributionTestFixture, AgradDistributionWiener_fd_847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_848, AgradDistributionTestFixture, AgradDistributionWiener_fd_848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_849, AgradDistributionTestFixture, AgradDistributionWiener_fd_849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_850, AgradDistributionTestFixture, AgradDistributionWiener_fd_850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_851, AgradDistributionTestFixture, AgradDistributionWiener_fd_851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_852, AgradDistributionTestFixture, AgradDistributionWiener_fd_852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_853, AgradDistributionTestFixture, AgradDistributionWiener_fd_853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_854, AgradDistributionTestFixture, AgradDistributionWiener_fd_854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_855, AgradDistributionTestFixture, AgradDistributionWiener_fd_855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_856, AgradDistributionTestFixture, AgradDistributionWiener_fd_856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_857, AgradDistributionTestFixture, AgradDistributionWiener_fd_857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_858, AgradDistributionTestFixture, AgradDistributionWiener_fd_858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_859, AgradDistributionTestFixture, AgradDistributionWiener_fd_859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_860, AgradDistributionTestFixture, AgradDistributionWiener_fd_860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_861, AgradDistributionTestFixture, AgradDistributionWiener_fd_861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_862, AgradDistributionTestFixture, AgradDistributionWiener_fd_862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_863, AgradDistributionTestFixture, AgradDistributionWiener_fd_863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_864, AgradDistributionTestFixture, AgradDistributionWiener_fd_864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_865, AgradDistributionTestFixture, AgradDistributionWiener_fd_865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_866, AgradDistributionTestFixture, AgradDistributionWiener_fd_866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_867, AgradDistributionTestFixture, AgradDistributionWiener_fd_867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_868, AgradDistributionTestFixture, AgradDistributionWiener_fd_868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_869, AgradDistributionTestFixture, AgradDistributionWiener_fd_869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_870, AgradDistributionTestFixture, AgradDistributionWiener_fd_870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_871, AgradDistributionTestFixture, AgradDistributionWiener_fd_871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_872, AgradDistributionTestFixture, AgradDistributionWiener_fd_872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_873, AgradDistributionTestFixture, AgradDistributionWiener_fd_873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_874, AgradDistributionTestFixture, AgradDistributionWiener_fd_874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_875, AgradDistributionTestFixture, AgradDistributionWiener_fd_875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_876, AgradDistributionTestFixture, AgradDistributionWiener_fd_876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_877, AgradDistributionTestFixture, AgradDistributionWiener_fd_877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_878, AgradDistributionTestFixture, AgradDistributionWiener_fd_878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_879, AgradDistributionTestFixture, AgradDistributionWiener_fd_879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_880, AgradDistributionTestFixture, AgradDistributionWiener_fd_880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_881, AgradDistributionTestFixture, AgradDistributionWiener_fd_881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_882, AgradDistributionTestFixture, AgradDistributionWiener_fd_882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_883, AgradDistributionTestFixture, AgradDistributionWiener_fd_883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_884, AgradDistributionTestFixture, AgradDistributionWiener_fd_884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_885, AgradDistributionTestFixture, AgradDistributionWiener_fd_885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_886, AgradDistributionTestFixture, AgradDistributionWiener_fd_886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_887, AgradDistributionTestFixture, AgradDistributionWiener_fd_887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_888, AgradDistributionTestFixture, AgradDistributionWiener_fd_888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_889, AgradDistributionTestFixture, AgradDistributionWiener_fd_889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_890, AgradDistributionTestFixture, AgradDistributionWiener_fd_890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_891, AgradDistributionTestFixture, AgradDistributionWiener_fd_891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_892, AgradDistributionTestFixture, AgradDistributionWiener_fd_892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_893, AgradDistributionTestFixture, AgradDistributionWiener_fd_893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_894, AgradDistributionTestFixture, AgradDistributionWiener_fd_894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_895, AgradDistributionTestFixture, AgradDistributionWiener_fd_895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_896, AgradDistributionTestFixture, AgradDistributionWiener_fd_896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_897, AgradDistributionTestFixture, AgradDistributionWiener_fd_897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_898, AgradDistributionTestFixture, AgradDistributionWiener_fd_898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_899, AgradDistributionTestFixture, AgradDistributionWiener_fd_899);
+
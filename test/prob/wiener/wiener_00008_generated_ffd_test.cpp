@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_800;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, empty> type_ffd_801;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_802;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_803;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_804;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_805;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_806;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_807;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_808;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_809;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_810;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_811;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_812;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_813;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_814;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_815;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_816;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_817;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_818;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, double, empty> type_ffd_819;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, std::vector<double>, empty> type_ffd_820;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_821;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_822;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_823;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_824;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, double, empty> type_ffd_825;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_826;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_827;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_828;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_829;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_830;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_831;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_832;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_833;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_834;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_835;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_836;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_837;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_838;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_839;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_840;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_841;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_842;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_843;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_844;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_845;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_846;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_847;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_848;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_849;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_850;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_851;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_852;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_853;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_854;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_855;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_856;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_857;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_858;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_859;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_860;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_861;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_862;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_863;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_864;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_865;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_866;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_867;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_868;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_869;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_870;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_871;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_872;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_873;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_874;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_875;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_876;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_877;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_878;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_879;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_880;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_881;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_882;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_883;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_884;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_885;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_886;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_887;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_888;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_889;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_890;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, double, empty> type_ffd_891;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_892;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_893;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_894;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_895;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_896;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_897;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_898;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_800> AgradDistributionWiener_ffd_800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_801> AgradDistributionWiener_ffd_801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_802> AgradDistributionWiener_ffd_802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_803> AgradDistributionWiener_ffd_803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_804> AgradDistributionWiener_ffd_804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_805> AgradDistributionWiener_ffd_805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_806> AgradDistributionWiener_ffd_806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_807> AgradDistributionWiener_ffd_807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_808> AgradDistributionWiener_ffd_808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_809> AgradDistributionWiener_ffd_809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_810> AgradDistributionWiener_ffd_810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_811> AgradDistributionWiener_ffd_811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_812> AgradDistributionWiener_ffd_812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_813> AgradDistributionWiener_ffd_813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_814> AgradDistributionWiener_ffd_814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_815> AgradDistributionWiener_ffd_815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_816> AgradDistributionWiener_ffd_816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_817> AgradDistributionWiener_ffd_817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_818> AgradDistributionWiener_ffd_818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_819> AgradDistributionWiener_ffd_819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_820> AgradDistributionWiener_ffd_820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_821> AgradDistributionWiener_ffd_821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_822> AgradDistributionWiener_ffd_822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_823> AgradDistributionWiener_ffd_823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_824> AgradDistributionWiener_ffd_824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_825> AgradDistributionWiener_ffd_825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_826> AgradDistributionWiener_ffd_826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_827> AgradDistributionWiener_ffd_827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_828> AgradDistributionWiener_ffd_828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_829> AgradDistributionWiener_ffd_829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_830> AgradDistributionWiener_ffd_830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_831> AgradDistributionWiener_ffd_831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_832> AgradDistributionWiener_ffd_832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_833> AgradDistributionWiener_ffd_833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_834> AgradDistributionWiener_ffd_834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_835> AgradDistributionWiener_ffd_835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_836> AgradDistributionWiener_ffd_836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_837> AgradDistributionWiener_ffd_837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_838> AgradDistributionWiener_ffd_838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_839> AgradDistributionWiener_ffd_839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_840> AgradDistributionWiener_ffd_840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_841> AgradDistributionWiener_ffd_841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_842> AgradDistributionWiener_ffd_842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_843> AgradDistributionWiener_ffd_843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_844> AgradDistributionWiener_ffd_844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_845> AgradDistributionWiener_ffd_845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_846> AgradDistributionWiener_ffd_846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_847> AgradDistributionWiener_ffd_847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_848> AgradDistributionWiener_ffd_848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_849> AgradDistributionWiener_ffd_849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_850> AgradDistributionWiener_ffd_850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_851> AgradDistributionWiener_ffd_851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_852> AgradDistributionWiener_ffd_852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_853> AgradDistributionWiener_ffd_853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_854> AgradDistributionWiener_ffd_854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_855> AgradDistributionWiener_ffd_855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_856> AgradDistributionWiener_ffd_856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_857> AgradDistributionWiener_ffd_857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_858> AgradDistributionWiener_ffd_858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_859> AgradDistributionWiener_ffd_859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_860> AgradDistributionWiener_ffd_860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_861> AgradDistributionWiener_ffd_861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_862> AgradDistributionWiener_ffd_862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_863> AgradDistributionWiener_ffd_863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_864> AgradDistributionWiener_ffd_864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_865> AgradDistributionWiener_ffd_865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_866> AgradDistributionWiener_ffd_866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_867> AgradDistributionWiener_ffd_867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_868> AgradDistributionWiener_ffd_868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_869> AgradDistributionWiener_ffd_869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_870> AgradDistributionWiener_ffd_870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_871> AgradDistributionWiener_ffd_871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_872> AgradDistributionWiener_ffd_872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_873> AgradDistributionWiener_ffd_873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_874> AgradDistributionWiener_ffd_874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_875> AgradDistributionWiener_ffd_875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_876> AgradDistributionWiener_ffd_876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_877> AgradDistributionWiener_ffd_877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_878> AgradDistributionWiener_ffd_878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_879> AgradDistributionWiener_ffd_879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_880> AgradDistributionWiener_ffd_880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_881> AgradDistributionWiener_ffd_881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_882> AgradDistributionWiener_ffd_882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_883> AgradDistributionWiener_ffd_883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_884> AgradDistributionWiener_ffd_884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_885> AgradDistributionWiener_ffd_885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_886> AgradDistributionWiener_ffd_886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_887> AgradDistributionWiener_ffd_887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_888> AgradDistributionWiener_ffd_888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_889> AgradDistributionWiener_ffd_889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_890> AgradDistributionWiener_ffd_890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_891> AgradDistributionWiener_ffd_891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_892> AgradDistributionWiener_ffd_892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_893> AgradDistributionWiener_ffd_893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_894> AgradDistributionWiener_ffd_894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_895> AgradDistributionWiener_ffd_895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_896> AgradDistributionWiener_ffd_896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_897> AgradDistributionWiener_ffd_897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_898> AgradDistributionWiener_ffd_898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_899> AgradDistributionWiener_ffd_899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_800, AgradDistributionTestFixture, AgradDistributionWiener_ffd_800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_801, AgradDistributionTestFixture, AgradDistributionWiener_ffd_801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_802, AgradDistributionTestFixture, AgradDistributionWiener_ffd_802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_803, AgradDistributionTestFixture, AgradDistributionWiener_ffd_803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_804, AgradDistributionTestFixture, AgradDistributionWiener_ffd_804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_805, AgradDistributionTestFixture, AgradDistributionWiener_ffd_805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_806, AgradDistributionTestFixture, AgradDistributionWiener_ffd_806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_807, AgradDistributionTestFixture, AgradDistributionWiener_ffd_807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_808, AgradDistributionTestFixture, AgradDistributionWiener_ffd_808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_809, AgradDistributionTestFixture, AgradDistributionWiener_ffd_809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_810, AgradDistributionTestFixture, AgradDistributionWiener_ffd_810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_811, AgradDistributionTestFixture, AgradDistributionWiener_ffd_811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_812, AgradDistributionTestFixture, AgradDistributionWiener_ffd_812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_813, AgradDistributionTestFixture, AgradDistributionWiener_ffd_813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_814, AgradDistributionTestFixture, AgradDistributionWiener_ffd_814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_815, AgradDistributionTestFixture, AgradDistributionWiener_ffd_815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_816, AgradDistributionTestFixture, AgradDistributionWiener_ffd_816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_817, AgradDistributionTestFixture, AgradDistributionWiener_ffd_817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_818, AgradDistributionTestFixture, AgradDistributionWiener_ffd_818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_819, AgradDistributionTestFixture, AgradDistributionWiener_ffd_819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_820, AgradDistributionTestFixture, AgradDistributionWiener_ffd_820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_821, AgradDistributionTestFixture, AgradDistributionWiener_ffd_821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_822, AgradDistributionTestFixture, AgradDistributionWiener_ffd_822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_823, AgradDistributionTestFixture, AgradDistributionWiener_ffd_823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_824, AgradDistributionTestFixture, AgradDistributionWiener_ffd_824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_825, AgradDistributionTestFixture, AgradDistributionWiener_ffd_825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_826, AgradDistributionTestFixture, AgradDistributionWiener_ffd_826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_827, AgradDistributionTestFixture, AgradDistributionWiener_ffd_827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_828, AgradDistributionTestFixture, AgradDistributionWiener_ffd_828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_829, AgradDistributionTestFixture, AgradDistributionWiener_ffd_829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_830, AgradDistributionTestFixture, AgradDistributionWiener_ffd_830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_831, AgradDistributionTestFixture, AgradDistributionWiener_ffd_831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_832, AgradDistributionTestFixture, AgradDistributionWiener_ffd_832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_833, AgradDistributionTestFixture, AgradDistributionWiener_ffd_833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_834, AgradDistributionTestFixture, AgradDistributionWiener_ffd_834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_835, AgradDistributionTestFixture, AgradDistributionWiener_ffd_835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_836, AgradDistributionTestFixture, AgradDistributionWiener_ffd_836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_837, AgradDistributionTestFixture, AgradDistributionWiener_ffd_837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_838, AgradDistributionTestFixture, AgradDistributionWiener_ffd_838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_839, AgradDistributionTestFixture, AgradDistributionWiener_ffd_839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_840, AgradDistributionTestFixture, AgradDistributionWiener_ffd_840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_841, AgradDistributionTestFixture, AgradDistributionWiener_ffd_841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_842, AgradDistributionTestFixture, AgradDistributionWiener_ffd_842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_843, AgradDistributionTestFixture, AgradDistributionWiener_ffd_843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_844, AgradDistributionTestFixture, AgradDistributionWiener_ffd_844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_845, AgradDistributionTestFixture, AgradDistributionWiener_ffd_845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_846, AgradDistributionTestFixture, AgradDistributionWiener_ffd_846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_847, AgradDistributionTestFixture, AgradDistributionWiener_ffd_847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_848, AgradDistributionTestFixture, AgradDistributionWiener_ffd_848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_849, AgradDistributionTestFixture, AgradDistributionWiener_ffd_849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_850, AgradDistributionTestFixture, AgradDistributionWiener_ffd_850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_851, AgradDistributionTestFixture, AgradDistributionWiener_ffd_851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_852, AgradDistributionTestFixture, AgradDistributionWiener_ffd_852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_853, AgradDistributionTestFixture, AgradDistributionWiener_ffd_853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_854, AgradDistributionTestFixture, AgradDistributionWiener_ffd_854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_855, AgradDistributionTestFixture, AgradDistributionWiener_ffd_855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_856, AgradDistributionTestFixture, AgradDistributionWiener_ffd_856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_857, AgradDistributionTestFixture, AgradDistributionWiener_ffd_857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_858, AgradDistributionTestFixture, AgradDistributionWiener_ffd_858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_859, AgradDistributionTestFixture, AgradDistributionWiener_ffd_859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_860, AgradDistributionTestFixture, AgradDistributionWiener_ffd_860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_861, AgradDistributionTestFixture, AgradDistributionWiener_ffd_861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_862, AgradDistributionTestFixture, AgradDistributionWiener_ffd_862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_863, AgradDistributionTestFixture, AgradDistributionWiener_ffd_863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_864, AgradDistributionTestFixture, AgradDistributionWiener_ffd_864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_865, AgradDistributionTestFixture, AgradDistributionWiener_ffd_865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_866, AgradDistributionTestFixture, AgradDistributionWiener_ffd_866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_867, AgradDistributionTestFixture, AgradDistributionWiener_ffd_867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_868, AgradDistributionTestFixture, AgradDistributionWiener_ffd_868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_869, AgradDistributionTestFixture, AgradDistributionWiener_ffd_869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_870, AgradDistributionTestFixture, AgradDistributionWiener_ffd_870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_871, AgradDistributionTestFixture, AgradDistributionWiener_ffd_871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_872, AgradDistributionTestFixture, AgradDistributionWiener_ffd_872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_873, AgradDistributionTestFixture, AgradDistributionWiener_ffd_873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_874, AgradDistributionTestFixture, AgradDistributionWiener_ffd_874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_875, AgradDistributionTestFixture, AgradDistributionWiener_ffd_875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_876, AgradDistributionTestFixture, AgradDistributionWiener_ffd_876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_877, AgradDistributionTestFixture, AgradDistributionWiener_ffd_877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_878, AgradDistributionTestFixture, AgradDistributionWiener_ffd_878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_879, AgradDistributionTestFixture, AgradDistributionWiener_ffd_879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_880, AgradDistributionTestFixture, AgradDistributionWiener_ffd_880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_881, AgradDistributionTestFixture, AgradDistributionWiener_ffd_881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_882, AgradDistributionTestFixture, AgradDistributionWiener_ffd_882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_883, AgradDistributionTestFixture, AgradDistributionWiener_ffd_883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_884, AgradDistributionTestFixture, AgradDistributionWiener_ffd_884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_885, AgradDistributionTestFixture, AgradDistributionWiener_ffd_885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_886, AgradDistributionTestFixture, AgradDistributionWiener_ffd_886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_887, AgradDistributionTestFixture, AgradDistributionWiener_ffd_887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_888, AgradDistributionTestFixture, AgradDistributionWiener_ffd_888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_889, AgradDistributionTestFixture, AgradDistributionWiener_ffd_889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_890, AgradDistributionTestFixture, AgradDistributionWiener_ffd_890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_891, AgradDistributionTestFixture, AgradDistributionWiener_ffd_891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_892, AgradDistributionTestFixture, AgradDistributionWiener_ffd_892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_893, AgradDistributionTestFixture, AgradDistributionWiener_ffd_893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_894, AgradDistributionTestFixture, AgradDistributionWiener_ffd_894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_895, AgradDistributionTestFixture, AgradDistributionWiener_ffd_895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_896, AgradDistributionTestFixture, AgradDistributionWiener_ffd_896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_897, AgradDistributionTestFixture, AgradDistributionWiener_ffd_897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_898, AgradDistributionTestFixture, AgradDistributionWiener_ffd_898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_899, AgradDistributionTestFixture, AgradDistributionWiener_ffd_899);
+
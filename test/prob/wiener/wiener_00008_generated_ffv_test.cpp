@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_800;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty> type_ffv_801;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_802;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_803;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_804;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_805;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_806;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_807;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_808;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_809;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_810;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_811;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_812;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_813;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_814;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_815;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_816;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_817;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_818;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty> type_ffv_819;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty> type_ffv_820;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_821;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_822;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_823;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_824;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty> type_ffv_825;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_826;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_827;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_828;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_829;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_830;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_831;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_832;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_833;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_834;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_835;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_836;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_837;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_838;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_839;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_840;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_841;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_842;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_843;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_844;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_845;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_846;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_847;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_848;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_849;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_850;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_851;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_852;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_853;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_854;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_855;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_856;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_857;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_858;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_859;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_860;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_861;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_862;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_863;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_864;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_865;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_866;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_867;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_868;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_869;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_870;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_871;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_872;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_873;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_874;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_875;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_876;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_877;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_878;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_879;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_880;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_881;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_882;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_883;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_884;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_885;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_886;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_887;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_888;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_889;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_890;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty> type_ffv_891;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_892;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_893;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_894;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_895;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_896;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_897;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_898;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_800> AgradDistributionWiener_ffv_800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_801> AgradDistributionWiener_ffv_801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_802> AgradDistributionWiener_ffv_802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_803> AgradDistributionWiener_ffv_803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_804> AgradDistributionWiener_ffv_804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_805> AgradDistributionWiener_ffv_805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_806> AgradDistributionWiener_ffv_806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_807> AgradDistributionWiener_ffv_807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_808> AgradDistributionWiener_ffv_808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_809> AgradDistributionWiener_ffv_809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_810> AgradDistributionWiener_ffv_810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_811> AgradDistributionWiener_ffv_811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_812> AgradDistributionWiener_ffv_812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_813> AgradDistributionWiener_ffv_813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_814> AgradDistributionWiener_ffv_814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_815> AgradDistributionWiener_ffv_815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_816> AgradDistributionWiener_ffv_816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_817> AgradDistributionWiener_ffv_817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_818> AgradDistributionWiener_ffv_818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_819> AgradDistributionWiener_ffv_819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_820> AgradDistributionWiener_ffv_820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_821> AgradDistributionWiener_ffv_821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_822> AgradDistributionWiener_ffv_822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_823> AgradDistributionWiener_ffv_823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_824> AgradDistributionWiener_ffv_824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_825> AgradDistributionWiener_ffv_825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_826> AgradDistributionWiener_ffv_826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_827> AgradDistributionWiener_ffv_827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_828> AgradDistributionWiener_ffv_828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_829> AgradDistributionWiener_ffv_829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_830> AgradDistributionWiener_ffv_830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_831> AgradDistributionWiener_ffv_831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_832> AgradDistributionWiener_ffv_832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_833> AgradDistributionWiener_ffv_833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_834> AgradDistributionWiener_ffv_834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_835> AgradDistributionWiener_ffv_835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_836> AgradDistributionWiener_ffv_836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_837> AgradDistributionWiener_ffv_837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_838> AgradDistributionWiener_ffv_838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_839> AgradDistributionWiener_ffv_839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_840> AgradDistributionWiener_ffv_840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_841> AgradDistributionWiener_ffv_841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_842> AgradDistributionWiener_ffv_842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_843> AgradDistributionWiener_ffv_843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_844> AgradDistributionWiener_ffv_844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_845> AgradDistributionWiener_ffv_845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_846> AgradDistributionWiener_ffv_846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_847> AgradDistributionWiener_ffv_847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_848> AgradDistributionWiener_ffv_848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_849> AgradDistributionWiener_ffv_849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_850> AgradDistributionWiener_ffv_850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_851> AgradDistributionWiener_ffv_851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_852> AgradDistributionWiener_ffv_852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_853> AgradDistributionWiener_ffv_853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_854> AgradDistributionWiener_ffv_854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_855> AgradDistributionWiener_ffv_855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_856> AgradDistributionWiener_ffv_856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_857> AgradDistributionWiener_ffv_857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_858> AgradDistributionWiener_ffv_858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_859> AgradDistributionWiener_ffv_859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_860> AgradDistributionWiener_ffv_860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_861> AgradDistributionWiener_ffv_861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_862> AgradDistributionWiener_ffv_862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_863> AgradDistributionWiener_ffv_863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_864> AgradDistributionWiener_ffv_864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_865> AgradDistributionWiener_ffv_865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_866> AgradDistributionWiener_ffv_866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_867> AgradDistributionWiener_ffv_867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_868> AgradDistributionWiener_ffv_868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_869> AgradDistributionWiener_ffv_869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_870> AgradDistributionWiener_ffv_870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_871> AgradDistributionWiener_ffv_871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_872> AgradDistributionWiener_ffv_872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_873> AgradDistributionWiener_ffv_873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_874> AgradDistributionWiener_ffv_874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_875> AgradDistributionWiener_ffv_875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_876> AgradDistributionWiener_ffv_876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_877> AgradDistributionWiener_ffv_877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_878> AgradDistributionWiener_ffv_878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_879> AgradDistributionWiener_ffv_879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_880> AgradDistributionWiener_ffv_880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_881> AgradDistributionWiener_ffv_881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_882> AgradDistributionWiener_ffv_882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_883> AgradDistributionWiener_ffv_883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_884> AgradDistributionWiener_ffv_884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_885> AgradDistributionWiener_ffv_885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_886> AgradDistributionWiener_ffv_886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_887> AgradDistributionWiener_ffv_887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_888> AgradDistributionWiener_ffv_888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_889> AgradDistributionWiener_ffv_889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_890> AgradDistributionWiener_ffv_890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_891> AgradDistributionWiener_ffv_891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_892> AgradDistributionWiener_ffv_892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_893> AgradDistributionWiener_ffv_893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_894> AgradDistributionWiener_ffv_894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_895> AgradDistributionWiener_ffv_895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_896> AgradDistributionWiener_ffv_896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_897> AgradDistributionWiener_ffv_897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_898> AgradDistributionWiener_ffv_898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_899> AgradDistributionWiener_ffv_899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_800, AgradDistributionTestFixture, AgradDistributionWiener_ffv_800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_801, AgradDistributionTestFixture, AgradDistributionWiener_ffv_801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_802, AgradDistributionTestFixture, AgradDistributionWiener_ffv_802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_803, AgradDistributionTestFixture, AgradDistributionWiener_ffv_803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_804, AgradDistributionTestFixture, AgradDistributionWiener_ffv_804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_805, AgradDistributionTestFixture, AgradDistributionWiener_ffv_805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_806, AgradDistributionTestFixture, AgradDistributionWiener_ffv_806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_807, AgradDistributionTestFixture, AgradDistributionWiener_ffv_807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_808, AgradDistributionTestFixture, AgradDistributionWiener_ffv_808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_809, AgradDistributionTestFixture, AgradDistributionWiener_ffv_809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_810, AgradDistributionTestFixture, AgradDistributionWiener_ffv_810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_811, AgradDistributionTestFixture, AgradDistributionWiener_ffv_811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_812, AgradDistributionTestFixture, AgradDistributionWiener_ffv_812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_813, AgradDistributionTestFixture, AgradDistributionWiener_ffv_813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_814, AgradDistributionTestFixture, AgradDistributionWiener_ffv_814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_815, AgradDistributionTestFixture, AgradDistributionWiener_ffv_815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_816, AgradDistributionTestFixture, AgradDistributionWiener_ffv_816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_817, AgradDistributionTestFixture, AgradDistributionWiener_ffv_817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_818, AgradDistributionTestFixture, AgradDistributionWiener_ffv_818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_819, AgradDistributionTestFixture, AgradDistributionWiener_ffv_819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_820, AgradDistributionTestFixture, AgradDistributionWiener_ffv_820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_821, AgradDistributionTestFixture, AgradDistributionWiener_ffv_821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_822, AgradDistributionTestFixture, AgradDistributionWiener_ffv_822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_823, AgradDistributionTestFixture, AgradDistributionWiener_ffv_823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_824, AgradDistributionTestFixture, AgradDistributionWiener_ffv_824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_825, AgradDistributionTestFixture, AgradDistributionWiener_ffv_825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_826, AgradDistributionTestFixture, AgradDistributionWiener_ffv_826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_827, AgradDistributionTestFixture, AgradDistributionWiener_ffv_827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_828, AgradDistributionTestFixture, AgradDistributionWiener_ffv_828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_829, AgradDistributionTestFixture, AgradDistributionWiener_ffv_829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_830, AgradDistributionTestFixture, AgradDistributionWiener_ffv_830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_831, AgradDistributionTestFixture, AgradDistributionWiener_ffv_831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_832, AgradDistributionTestFixture, AgradDistributionWiener_ffv_832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_833, AgradDistributionTestFixture, AgradDistributionWiener_ffv_833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_834, AgradDistributionTestFixture, AgradDistributionWiener_ffv_834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_835, AgradDistributionTestFixture, AgradDistributionWiener_ffv_835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_836, AgradDistributionTestFixture, AgradDistributionWiener_ffv_836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_837, AgradDistributionTestFixture, AgradDistributionWiener_ffv_837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_838, AgradDistributionTestFixture, AgradDistributionWiener_ffv_838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_839, AgradDistributionTestFixture, AgradDistributionWiener_ffv_839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_840, AgradDistributionTestFixture, AgradDistributionWiener_ffv_840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_841, AgradDistributionTestFixture, AgradDistributionWiener_ffv_841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_842, AgradDistributionTestFixture, AgradDistributionWiener_ffv_842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_843, AgradDistributionTestFixture, AgradDistributionWiener_ffv_843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_844, AgradDistributionTestFixture, AgradDistributionWiener_ffv_844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_845, AgradDistributionTestFixture, AgradDistributionWiener_ffv_845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_846, AgradDistributionTestFixture, AgradDistributionWiener_ffv_846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_847, AgradDistributionTestFixture, AgradDistributionWiener_ffv_847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_848, AgradDistributionTestFixture, AgradDistributionWiener_ffv_848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_849, AgradDistributionTestFixture, AgradDistributionWiener_ffv_849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_850, AgradDistributionTestFixture, AgradDistributionWiener_ffv_850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_851, AgradDistributionTestFixture, AgradDistributionWiener_ffv_851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_852, AgradDistributionTestFixture, AgradDistributionWiener_ffv_852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_853, AgradDistributionTestFixture, AgradDistributionWiener_ffv_853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_854, AgradDistributionTestFixture, AgradDistributionWiener_ffv_854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_855, AgradDistributionTestFixture, AgradDistributionWiener_ffv_855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_856, AgradDistributionTestFixture, AgradDistributionWiener_ffv_856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_857, AgradDistributionTestFixture, AgradDistributionWiener_ffv_857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_858, AgradDistributionTestFixture, AgradDistributionWiener_ffv_858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_859, AgradDistributionTestFixture, AgradDistributionWiener_ffv_859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_860, AgradDistributionTestFixture, AgradDistributionWiener_ffv_860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_861, AgradDistributionTestFixture, AgradDistributionWiener_ffv_861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_862, AgradDistributionTestFixture, AgradDistributionWiener_ffv_862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_863, AgradDistributionTestFixture, AgradDistributionWiener_ffv_863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_864, AgradDistributionTestFixture, AgradDistributionWiener_ffv_864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_865, AgradDistributionTestFixture, AgradDistributionWiener_ffv_865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_866, AgradDistributionTestFixture, AgradDistributionWiener_ffv_866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_867, AgradDistributionTestFixture, AgradDistributionWiener_ffv_867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_868, AgradDistributionTestFixture, AgradDistributionWiener_ffv_868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_869, AgradDistributionTestFixture, AgradDistributionWiener_ffv_869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_870, AgradDistributionTestFixture, AgradDistributionWiener_ffv_870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_871, AgradDistributionTestFixture, AgradDistributionWiener_ffv_871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_872, AgradDistributionTestFixture, AgradDistributionWiener_ffv_872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_873, AgradDistributionTestFixture, AgradDistributionWiener_ffv_873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_874, AgradDistributionTestFixture, AgradDistributionWiener_ffv_874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_875, AgradDistributionTestFixture, AgradDistributionWiener_ffv_875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_876, AgradDistributionTestFixture, AgradDistributionWiener_ffv_876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_877, AgradDistributionTestFixture, AgradDistributionWiener_ffv_877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_878, AgradDistributionTestFixture, AgradDistributionWiener_ffv_878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_879, AgradDistributionTestFixture, AgradDistributionWiener_ffv_879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_880, AgradDistributionTestFixture, AgradDistributionWiener_ffv_880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_881, AgradDistributionTestFixture, AgradDistributionWiener_ffv_881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_882, AgradDistributionTestFixture, AgradDistributionWiener_ffv_882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_883, AgradDistributionTestFixture, AgradDistributionWiener_ffv_883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_884, AgradDistributionTestFixture, AgradDistributionWiener_ffv_884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_885, AgradDistributionTestFixture, AgradDistributionWiener_ffv_885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_886, AgradDistributionTestFixture, AgradDistributionWiener_ffv_886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_887, AgradDistributionTestFixture, AgradDistributionWiener_ffv_887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_888, AgradDistributionTestFixture, AgradDistributionWiener_ffv_888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_889, AgradDistributionTestFixture, AgradDistributionWiener_ffv_889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_890, AgradDistributionTestFixture, AgradDistributionWiener_ffv_890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_891, AgradDistributionTestFixture, AgradDistributionWiener_ffv_891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_892, AgradDistributionTestFixture, AgradDistributionWiener_ffv_892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_893, AgradDistributionTestFixture, AgradDistributionWiener_ffv_893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_894, AgradDistributionTestFixture, AgradDistributionWiener_ffv_894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_895, AgradDistributionTestFixture, AgradDistributionWiener_ffv_895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_896, AgradDistributionTestFixture, AgradDistributionWiener_ffv_896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_897, AgradDistributionTestFixture, AgradDistributionWiener_ffv_897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_898, AgradDistributionTestFixture, AgradDistributionWiener_ffv_898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_899, AgradDistributionTestFixture, AgradDistributionWiener_ffv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_800;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, fvar<var>, double, empty> type_fv_801;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, fvar<var>, std::vector<double>, empty> type_fv_802;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_803;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, fvar<var>, fvar<var>, empty> type_fv_804;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_805;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_806;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, double, empty> type_fv_807;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_808;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_809;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_810;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_811;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_812;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_813;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_814;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_815;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_816;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_817;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_818;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, double, double, empty> type_fv_819;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, double, std::vector<double>, empty> type_fv_820;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_821;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, double, fvar<var>, empty> type_fv_822;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_823;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_824;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, double, empty> type_fv_825;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_826;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_827;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_828;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_829;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_830;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_831;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_832;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_833;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_834;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_835;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_836;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, empty> type_fv_837;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_838;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_839;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_840;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_841;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_842;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_843;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_844;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_845;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_846;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_847;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_848;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_849;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_850;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_851;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_852;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_853;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_854;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_855;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_856;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_857;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_858;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_859;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_860;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_861;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_862;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_863;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_864;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_865;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_866;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_867;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_868;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_869;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_870;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_871;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_872;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_873;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_874;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_875;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_876;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_877;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_878;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_879;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_880;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_881;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_882;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_883;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_884;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_885;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_886;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_887;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_888;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_889;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_890;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, double, double, empty> type_fv_891;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, empty> type_fv_892;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_893;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, double, fvar<var>, empty> type_fv_894;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_895;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_896;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, double, empty> type_fv_897;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_898;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_800> AgradDistributionWiener_fv_800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_801> AgradDistributionWiener_fv_801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_802> AgradDistributionWiener_fv_802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_803> AgradDistributionWiener_fv_803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_804> AgradDistributionWiener_fv_804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_805> AgradDistributionWiener_fv_805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_806> AgradDistributionWiener_fv_806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_807> AgradDistributionWiener_fv_807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_808> AgradDistributionWiener_fv_808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_809> AgradDistributionWiener_fv_809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_810> AgradDistributionWiener_fv_810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_811> AgradDistributionWiener_fv_811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_812> AgradDistributionWiener_fv_812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_813> AgradDistributionWiener_fv_813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_814> AgradDistributionWiener_fv_814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_815> AgradDistributionWiener_fv_815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_816> AgradDistributionWiener_fv_816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_817> AgradDistributionWiener_fv_817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_818> AgradDistributionWiener_fv_818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_819> AgradDistributionWiener_fv_819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_820> AgradDistributionWiener_fv_820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_821> AgradDistributionWiener_fv_821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_822> AgradDistributionWiener_fv_822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_823> AgradDistributionWiener_fv_823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_824> AgradDistributionWiener_fv_824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_825> AgradDistributionWiener_fv_825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_826> AgradDistributionWiener_fv_826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_827> AgradDistributionWiener_fv_827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_828> AgradDistributionWiener_fv_828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_829> AgradDistributionWiener_fv_829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_830> AgradDistributionWiener_fv_830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_831> AgradDistributionWiener_fv_831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_832> AgradDistributionWiener_fv_832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_833> AgradDistributionWiener_fv_833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_834> AgradDistributionWiener_fv_834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_835> AgradDistributionWiener_fv_835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_836> AgradDistributionWiener_fv_836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_837> AgradDistributionWiener_fv_837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_838> AgradDistributionWiener_fv_838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_839> AgradDistributionWiener_fv_839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_840> AgradDistributionWiener_fv_840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_841> AgradDistributionWiener_fv_841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_842> AgradDistributionWiener_fv_842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_843> AgradDistributionWiener_fv_843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_844> AgradDistributionWiener_fv_844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_845> AgradDistributionWiener_fv_845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_846> AgradDistributionWiener_fv_846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_847> AgradDistributionWiener_fv_847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_848> AgradDistributionWiener_fv_848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_849> AgradDistributionWiener_fv_849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_850> AgradDistributionWiener_fv_850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_851> AgradDistributionWiener_fv_851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_852> AgradDistributionWiener_fv_852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_853> AgradDistributionWiener_fv_853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_854> AgradDistributionWiener_fv_854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_855> AgradDistributionWiener_fv_855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_856> AgradDistributionWiener_fv_856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_857> AgradDistributionWiener_fv_857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_858> AgradDistributionWiener_fv_858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_859> AgradDistributionWiener_fv_859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_860> AgradDistributionWiener_fv_860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_861> AgradDistributionWiener_fv_861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_862> AgradDistributionWiener_fv_862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_863> AgradDistributionWiener_fv_863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_864> AgradDistributionWiener_fv_864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_865> AgradDistributionWiener_fv_865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_866> AgradDistributionWiener_fv_866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_867> AgradDistributionWiener_fv_867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_868> AgradDistributionWiener_fv_868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_869> AgradDistributionWiener_fv_869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_870> AgradDistributionWiener_fv_870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_871> AgradDistributionWiener_fv_871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_872> AgradDistributionWiener_fv_872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_873> AgradDistributionWiener_fv_873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_874> AgradDistributionWiener_fv_874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_875> AgradDistributionWiener_fv_875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_876> AgradDistributionWiener_fv_876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_877> AgradDistributionWiener_fv_877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_878> AgradDistributionWiener_fv_878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_879> AgradDistributionWiener_fv_879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_880> AgradDistributionWiener_fv_880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_881> AgradDistributionWiener_fv_881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_882> AgradDistributionWiener_fv_882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_883> AgradDistributionWiener_fv_883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_884> AgradDistributionWiener_fv_884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_885> AgradDistributionWiener_fv_885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_886> AgradDistributionWiener_fv_886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_887> AgradDistributionWiener_fv_887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_888> AgradDistributionWiener_fv_888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_889> AgradDistributionWiener_fv_889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_890> AgradDistributionWiener_fv_890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_891> AgradDistributionWiener_fv_891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_892> AgradDistributionWiener_fv_892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_893> AgradDistributionWiener_fv_893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_894> AgradDistributionWiener_fv_894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_895> AgradDistributionWiener_fv_895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_896> AgradDistributionWiener_fv_896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_897> AgradDistributionWiener_fv_897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_898> AgradDistributionWiener_fv_898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_899> AgradDistributionWiener_fv_899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_800, AgradDistributionTestFixture, AgradDistributionWiener_fv_800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_801, AgradDistributionTestFixture, AgradDistributionWiener_fv_801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_802, AgradDistributionTestFixture, AgradDistributionWiener_fv_802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_803, AgradDistributionTestFixture, AgradDistributionWiener_fv_803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_804, AgradDistributionTestFixture, AgradDistributionWiener_fv_804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_805, AgradDistributionTestFixture, AgradDistributionWiener_fv_805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_806, AgradDistributionTestFixture, AgradDistributionWiener_fv_806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_807, AgradDistributionTestFixture, AgradDistributionWiener_fv_807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_808, AgradDistributionTestFixture, AgradDistributionWiener_fv_808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_809, AgradDistributionTestFixture, AgradDistributionWiener_fv_809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_810, AgradDistributionTestFixture, AgradDistributionWiener_fv_810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_811, AgradDistributionTestFixture, AgradDistributionWiener_fv_811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_812, AgradDistributionTestFixture, AgradDistributionWiener_fv_812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_813, AgradDistributionTestFixture, AgradDistributionWiener_fv_813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_814, AgradDistributionTestFixture, AgradDistributionWiener_fv_814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_815, AgradDistributionTestFixture, AgradDistributionWiener_fv_815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_816, AgradDistributionTestFixture, AgradDistributionWiener_fv_816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_817, AgradDistributionTestFixture, AgradDistributionWiener_fv_817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_818, AgradDistributionTestFixture, AgradDistributionWiener_fv_818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_819, AgradDistributionTestFixture, AgradDistributionWiener_fv_819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_820, AgradDistributionTestFixture, AgradDistributionWiener_fv_820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_821, AgradDistributionTestFixture, AgradDistributionWiener_fv_821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_822, AgradDistributionTestFixture, AgradDistributionWiener_fv_822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_823, AgradDistributionTestFixture, AgradDistributionWiener_fv_823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_824, AgradDistributionTestFixture, AgradDistributionWiener_fv_824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_825, AgradDistributionTestFixture, AgradDistributionWiener_fv_825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_826, AgradDistributionTestFixture, AgradDistributionWiener_fv_826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_827, AgradDistributionTestFixture, AgradDistributionWiener_fv_827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_828, AgradDistributionTestFixture, AgradDistributionWiener_fv_828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_829, AgradDistributionTestFixture, AgradDistributionWiener_fv_829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_830, AgradDistributionTestFixture, AgradDistributionWiener_fv_830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_831, AgradDistributionTestFixture, AgradDistributionWiener_fv_831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_832, AgradDistributionTestFixture, AgradDistributionWiener_fv_832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_833, AgradDistributionTestFixture, AgradDistributionWiener_fv_833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_834, AgradDistributionTestFixture, AgradDistributionWiener_fv_834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_835, AgradDistributionTestFixture, AgradDistributionWiener_fv_835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_836, AgradDistributionTestFixture, AgradDistributionWiener_fv_836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_837, AgradDistributionTestFixture, AgradDistributionWiener_fv_837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_838, AgradDistributionTestFixture, AgradDistributionWiener_fv_838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_839, AgradDistributionTestFixture, AgradDistributionWiener_fv_839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_840, AgradDistributionTestFixture, AgradDistributionWiener_fv_840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_841, AgradDistributionTestFixture, AgradDistributionWiener_fv_841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_842, AgradDistributionTestFixture, AgradDistributionWiener_fv_842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_843, AgradDistributionTestFixture, AgradDistributionWiener_fv_843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_844, AgradDistributionTestFixture, AgradDistributionWiener_fv_844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_845, AgradDistributionTestFixture, AgradDistributionWiener_fv_845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_846, AgradDistributionTestFixture, AgradDistributionWiener_fv_846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_847, AgradDistributionTestFixture, AgradDistributionWiener_fv_847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_848, AgradDistributionTestFixture, AgradDistributionWiener_fv_848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_849, AgradDistributionTestFixture, AgradDistributionWiener_fv_849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_850, AgradDistributionTestFixture, AgradDistributionWiener_fv_850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_851, AgradDistributionTestFixture, AgradDistributionWiener_fv_851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_852, AgradDistributionTestFixture, AgradDistributionWiener_fv_852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_853, AgradDistributionTestFixture, AgradDistributionWiener_fv_853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_854, AgradDistributionTestFixture, AgradDistributionWiener_fv_854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_855, AgradDistributionTestFixture, AgradDistributionWiener_fv_855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_856, AgradDistributionTestFixture, AgradDistributionWiener_fv_856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_857, AgradDistributionTestFixture, AgradDistributionWiener_fv_857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_858, AgradDistributionTestFixture, AgradDistributionWiener_fv_858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_859, AgradDistributionTestFixture, AgradDistributionWiener_fv_859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_860, AgradDistributionTestFixture, AgradDistributionWiener_fv_860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_861, AgradDistributionTestFixture, AgradDistributionWiener_fv_861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_862, AgradDistributionTestFixture, AgradDistributionWiener_fv_862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_863, AgradDistributionTestFixture, AgradDistributionWiener_fv_863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_864, AgradDistributionTestFixture, AgradDistributionWiener_fv_864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_865, AgradDistributionTestFixture, AgradDistributionWiener_fv_865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_866, AgradDistributionTestFixture, AgradDistributionWiener_fv_866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_867, AgradDistributionTestFixture, AgradDistributionWiener_fv_867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_868, AgradDistributionTestFixture, AgradDistributionWiener_fv_868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_869, AgradDistributionTestFixture, AgradDistributionWiener_fv_869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_870, AgradDistributionTestFixture, AgradDistributionWiener_fv_870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_871, AgradDistributionTestFixture, AgradDistributionWiener_fv_871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_872, AgradDistributionTestFixture, AgradDistributionWiener_fv_872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_873, AgradDistributionTestFixture, AgradDistributionWiener_fv_873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_874, AgradDistributionTestFixture, AgradDistributionWiener_fv_874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_875, AgradDistributionTestFixture, AgradDistributionWiener_fv_875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_876, AgradDistributionTestFixture, AgradDistributionWiener_fv_876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_877, AgradDistributionTestFixture, AgradDistributionWiener_fv_877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_878, AgradDistributionTestFixture, AgradDistributionWiener_fv_878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_879, AgradDistributionTestFixture, AgradDistributionWiener_fv_879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_880, AgradDistributionTestFixture, AgradDistributionWiener_fv_880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_881, AgradDistributionTestFixture, AgradDistributionWiener_fv_881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_882, AgradDistributionTestFixture, AgradDistributionWiener_fv_882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_883, AgradDistributionTestFixture, AgradDistributionWiener_fv_883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_884, AgradDistributionTestFixture, AgradDistributionWiener_fv_884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_885, AgradDistributionTestFixture, AgradDistributionWiener_fv_885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_886, AgradDistributionTestFixture, AgradDistributionWiener_fv_886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_887, AgradDistributionTestFixture, AgradDistributionWiener_fv_887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_888, AgradDistributionTestFixture, AgradDistributionWiener_fv_888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_889, AgradDistributionTestFixture, AgradDistributionWiener_fv_889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_890, AgradDistributionTestFixture, AgradDistributionWiener_fv_890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_891, AgradDistributionTestFixture, AgradDistributionWiener_fv_891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_892, AgradDistributionTestFixture, AgradDistributionWiener_fv_892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_893, AgradDistributionTestFixture, AgradDistributionWiener_fv_893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_894, AgradDistributionTestFixture, AgradDistributionWiener_fv_894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_895, AgradDistributionTestFixture, AgradDistributionWiener_fv_895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_896, AgradDistributionTestFixture, AgradDistributionWiener_fv_896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_897, AgradDistributionTestFixture, AgradDistributionWiener_fv_897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_898, AgradDistributionTestFixture, AgradDistributionWiener_fv_898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_899, AgradDistributionTestFixture, AgradDistributionWiener_fv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_800;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<double>, var, empty> type_v_801;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_802;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_803;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_804;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_805;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_806;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_807;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_808;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_809;
+typedef boost::mpl::vector<double, var, std::vector<var>, var, double, empty> type_v_810;
+typedef boost::mpl::vector<double, var, std::vector<var>, var, std::vector<double>, empty> type_v_811;
+typedef boost::mpl::vector<double, var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_812;
+typedef boost::mpl::vector<double, var, std::vector<var>, var, var, empty> type_v_813;
+typedef boost::mpl::vector<double, var, std::vector<var>, var, std::vector<var>, empty> type_v_814;
+typedef boost::mpl::vector<double, var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_815;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<var>, double, empty> type_v_816;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_817;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_818;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<var>, var, empty> type_v_819;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_820;
+typedef boost::mpl::vector<double, var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_821;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_822;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_823;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_824;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_825;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_826;
+typedef boost::mpl::vector<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_827;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_828;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_829;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_830;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_831;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_832;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_833;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_834;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_835;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_836;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_837;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_838;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_839;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_840;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_841;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_842;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_843;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_844;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_845;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_846;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_847;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_848;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_849;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_850;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_851;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_852;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_853;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_854;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_855;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_856;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_857;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_858;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_859;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_860;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_861;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_862;
+typedef boost::mpl::vector<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_863;
+typedef boost::mpl::vector<double, std::vector<var>, double, double, double, empty> type_v_864;
+typedef boost::mpl::vector<double, std::vector<var>, double, double, std::vector<double>, empty> type_v_865;
+typedef boost::mpl::vector<double, std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_866;
+typedef boost::mpl::vector<double, std::vector<var>, double, double, var, empty> type_v_867;
+typedef boost::mpl::vector<double, std::vector<var>, double, double, std::vector<var>, empty> type_v_868;
+typedef boost::mpl::vector<double, std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_869;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<double>, double, empty> type_v_870;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<double>, std::vector<double>, empty> type_v_871;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_872;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<double>, var, empty> type_v_873;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<double>, std::vector<var>, empty> type_v_874;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_875;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_876;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_877;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_878;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_879;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_880;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_881;
+typedef boost::mpl::vector<double, std::vector<var>, double, var, double, empty> type_v_882;
+typedef boost::mpl::vector<double, std::vector<var>, double, var, std::vector<double>, empty> type_v_883;
+typedef boost::mpl::vector<double, std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_884;
+typedef boost::mpl::vector<double, std::vector<var>, double, var, var, empty> type_v_885;
+typedef boost::mpl::vector<double, std::vector<var>, double, var, std::vector<var>, empty> type_v_886;
+typedef boost::mpl::vector<double, std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_887;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<var>, double, empty> type_v_888;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<var>, std::vector<double>, empty> type_v_889;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_890;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<var>, var, empty> type_v_891;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<var>, std::vector<var>, empty> type_v_892;
+typedef boost::mpl::vector<double, std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_893;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_894;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_895;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_896;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_897;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_898;
+typedef boost::mpl::vector<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_800> AgradDistributionWiener_v_800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_801> AgradDistributionWiener_v_801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_802> AgradDistributionWiener_v_802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_803> AgradDistributionWiener_v_803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_804> AgradDistributionWiener_v_804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_805> AgradDistributionWiener_v_805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_806> AgradDistributionWiener_v_806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_807> AgradDistributionWiener_v_807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_808> AgradDistributionWiener_v_808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_809> AgradDistributionWiener_v_809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_810> AgradDistributionWiener_v_810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_811> AgradDistributionWiener_v_811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_812> AgradDistributionWiener_v_812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_813> AgradDistributionWiener_v_813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_814> AgradDistributionWiener_v_814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_815> AgradDistributionWiener_v_815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_816> AgradDistributionWiener_v_816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_817> AgradDistributionWiener_v_817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_818> AgradDistributionWiener_v_818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_819> AgradDistributionWiener_v_819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_820> AgradDistributionWiener_v_820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_821> AgradDistributionWiener_v_821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_822> AgradDistributionWiener_v_822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_823> AgradDistributionWiener_v_823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_824> AgradDistributionWiener_v_824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_825> AgradDistributionWiener_v_825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_826> AgradDistributionWiener_v_826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_827> AgradDistributionWiener_v_827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_828> AgradDistributionWiener_v_828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_829> AgradDistributionWiener_v_829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_830> AgradDistributionWiener_v_830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_831> AgradDistributionWiener_v_831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_832> AgradDistributionWiener_v_832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_833> AgradDistributionWiener_v_833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_834> AgradDistributionWiener_v_834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_835> AgradDistributionWiener_v_835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_836> AgradDistributionWiener_v_836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_837> AgradDistributionWiener_v_837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_838> AgradDistributionWiener_v_838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_839> AgradDistributionWiener_v_839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_840> AgradDistributionWiener_v_840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_841> AgradDistributionWiener_v_841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_842> AgradDistributionWiener_v_842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_843> AgradDistributionWiener_v_843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_844> AgradDistributionWiener_v_844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_845> AgradDistributionWiener_v_845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_846> AgradDistributionWiener_v_846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_847> AgradDistributionWiener_v_847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_848> AgradDistributionWiener_v_848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_849> AgradDistributionWiener_v_849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_850> AgradDistributionWiener_v_850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_851> AgradDistributionWiener_v_851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_852> AgradDistributionWiener_v_852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_853> AgradDistributionWiener_v_853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_854> AgradDistributionWiener_v_854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_855> AgradDistributionWiener_v_855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_856> AgradDistributionWiener_v_856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_857> AgradDistributionWiener_v_857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_858> AgradDistributionWiener_v_858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_859> AgradDistributionWiener_v_859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_860> AgradDistributionWiener_v_860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_861> AgradDistributionWiener_v_861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_862> AgradDistributionWiener_v_862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_863> AgradDistributionWiener_v_863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_864> AgradDistributionWiener_v_864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_865> AgradDistributionWiener_v_865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_866> AgradDistributionWiener_v_866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_867> AgradDistributionWiener_v_867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_868> AgradDistributionWiener_v_868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_869> AgradDistributionWiener_v_869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_870> AgradDistributionWiener_v_870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_871> AgradDistributionWiener_v_871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_872> AgradDistributionWiener_v_872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_873> AgradDistributionWiener_v_873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_874> AgradDistributionWiener_v_874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_875> AgradDistributionWiener_v_875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_876> AgradDistributionWiener_v_876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_877> AgradDistributionWiener_v_877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_878> AgradDistributionWiener_v_878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_879> AgradDistributionWiener_v_879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_880> AgradDistributionWiener_v_880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_881> AgradDistributionWiener_v_881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_882> AgradDistributionWiener_v_882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_883> AgradDistributionWiener_v_883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_884> AgradDistributionWiener_v_884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_885> AgradDistributionWiener_v_885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_886> AgradDistributionWiener_v_886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_887> AgradDistributionWiener_v_887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_888> AgradDistributionWiener_v_888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_889> AgradDistributionWiener_v_889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_890> AgradDistributionWiener_v_890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_891> AgradDistributionWiener_v_891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_892> AgradDistributionWiener_v_892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_893> AgradDistributionWiener_v_893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_894> AgradDistributionWiener_v_894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_895> AgradDistributionWiener_v_895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_896> AgradDistributionWiener_v_896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_897> AgradDistributionWiener_v_897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_898> AgradDistributionWiener_v_898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_899> AgradDistributionWiener_v_899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_800, AgradDistributionTestFixture, AgradDistributionWiener_v_800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_801, AgradDistributionTestFixture, AgradDistributionWiener_v_801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_802, AgradDistributionTestFixture, AgradDistributionWiener_v_802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_803, AgradDistributionTestFixture, AgradDistributionWiener_v_803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_804, AgradDistributionTestFixture, AgradDistributionWiener_v_804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_805, AgradDistributionTestFixture, AgradDistributionWiener_v_805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_806, AgradDistributionTestFixture, AgradDistributionWiener_v_806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_807, AgradDistributionTestFixture, AgradDistributionWiener_v_807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_808, AgradDistributionTestFixture, AgradDistributionWiener_v_808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_809, AgradDistributionTestFixture, AgradDistributionWiener_v_809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_810, AgradDistributionTestFixture, AgradDistributionWiener_v_810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_811, AgradDistributionTestFixture, AgradDistributionWiener_v_811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_812, AgradDistributionTestFixture, AgradDistributionWiener_v_812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_813, AgradDistributionTestFixture, AgradDistributionWiener_v_813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_814, AgradDistributionTestFixture, AgradDistributionWiener_v_814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_815, AgradDistributionTestFixture, AgradDistributionWiener_v_815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_816, AgradDistributionTestFixture, AgradDistributionWiener_v_816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_817, AgradDistributionTestFixture, AgradDistributionWiener_v_817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_818, AgradDistributionTestFixture, AgradDistributionWiener_v_818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_819, AgradDistributionTestFixture, AgradDistributionWiener_v_819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_820, AgradDistributionTestFixture, AgradDistributionWiener_v_820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_821, AgradDistributionTestFixture, AgradDistributionWiener_v_821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_822, AgradDistributionTestFixture, AgradDistributionWiener_v_822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_823, AgradDistributionTestFixture, AgradDistributionWiener_v_823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_824, AgradDistributionTestFixture, AgradDistributionWiener_v_824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_825, AgradDistributionTestFixture, AgradDistributionWiener_v_825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_826, AgradDistributionTestFixture, AgradDistributionWiener_v_826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_827, AgradDistributionTestFixture, AgradDistributionWiener_v_827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_828, AgradDistributionTestFixture, AgradDistributionWiener_v_828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_829, AgradDistributionTestFixture, AgradDistributionWiener_v_829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_830, AgradDistributionTestFixture, AgradDistributionWiener_v_830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_831, AgradDistributionTestFixture, AgradDistributionWiener_v_831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_832, AgradDistributionTestFixture, AgradDistributionWiener_v_832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_833, AgradDistributionTestFixture, AgradDistributionWiener_v_833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_834, AgradDistributionTestFixture, AgradDistributionWiener_v_834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_835, AgradDistributionTestFixture, AgradDistributionWiener_v_835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_836, AgradDistributionTestFixture, AgradDistributionWiener_v_836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_837, AgradDistributionTestFixture, AgradDistributionWiener_v_837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_838, AgradDistributionTestFixture, AgradDistributionWiener_v_838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_839, AgradDistributionTestFixture, AgradDistributionWiener_v_839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_840, AgradDistributionTestFixture, AgradDistributionWiener_v_840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_841, AgradDistributionTestFixture, AgradDistributionWiener_v_841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_842, AgradDistributionTestFixture, AgradDistributionWiener_v_842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_843, AgradDistributionTestFixture, AgradDistributionWiener_v_843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_844, AgradDistributionTestFixture, AgradDistributionWiener_v_844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_845, AgradDistributionTestFixture, AgradDistributionWiener_v_845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_846, AgradDistributionTestFixture, AgradDistributionWiener_v_846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_847, AgradDistributionTestFixture, AgradDistributionWiener_v_847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_848, AgradDistributionTestFixture, AgradDistributionWiener_v_848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_849, AgradDistributionTestFixture, AgradDistributionWiener_v_849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_850, AgradDistributionTestFixture, AgradDistributionWiener_v_850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_851, AgradDistributionTestFixture, AgradDistributionWiener_v_851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_852, AgradDistributionTestFixture, AgradDistributionWiener_v_852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_853, AgradDistributionTestFixture, AgradDistributionWiener_v_853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_854, AgradDistributionTestFixture, AgradDistributionWiener_v_854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_855, AgradDistributionTestFixture, AgradDistributionWiener_v_855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_856, AgradDistributionTestFixture, AgradDistributionWiener_v_856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_857, AgradDistributionTestFixture, AgradDistributionWiener_v_857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_858, AgradDistributionTestFixture, AgradDistributionWiener_v_858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_859, AgradDistributionTestFixture, AgradDistributionWiener_v_859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_860, AgradDistributionTestFixture, AgradDistributionWiener_v_860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_861, AgradDistributionTestFixture, AgradDistributionWiener_v_861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_862, AgradDistributionTestFixture, AgradDistributionWiener_v_862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_863, AgradDistributionTestFixture, AgradDistributionWiener_v_863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_864, AgradDistributionTestFixture, AgradDistributionWiener_v_864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_865, AgradDistributionTestFixture, AgradDistributionWiener_v_865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_866, AgradDistributionTestFixture, AgradDistributionWiener_v_866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_867, AgradDistributionTestFixture, AgradDistributionWiener_v_867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_868, AgradDistributionTestFixture, AgradDistributionWiener_v_868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_869, AgradDistributionTestFixture, AgradDistributionWiener_v_869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_870, AgradDistributionTestFixture, AgradDistributionWiener_v_870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_871, AgradDistributionTestFixture, AgradDistributionWiener_v_871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_872, AgradDistributionTestFixture, AgradDistributionWiener_v_872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_873, AgradDistributionTestFixture, AgradDistributionWiener_v_873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_874, AgradDistributionTestFixture, AgradDistributionWiener_v_874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_875, AgradDistributionTestFixture, AgradDistributionWiener_v_875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_876, AgradDistributionTestFixture, AgradDistributionWiener_v_876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_877, AgradDistributionTestFixture, AgradDistributionWiener_v_877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_878, AgradDistributionTestFixture, AgradDistributionWiener_v_878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_879, AgradDistributionTestFixture, AgradDistributionWiener_v_879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_880, AgradDistributionTestFixture, AgradDistributionWiener_v_880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_881, AgradDistributionTestFixture, AgradDistributionWiener_v_881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_882, AgradDistributionTestFixture, AgradDistributionWiener_v_882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_883, AgradDistributionTestFixture, AgradDistributionWiener_v_883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_884, AgradDistributionTestFixture, AgradDistributionWiener_v_884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_885, AgradDistributionTestFixture, AgradDistributionWiener_v_885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_886, AgradDistributionTestFixture, AgradDistributionWiener_v_886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_887, AgradDistributionTestFixture, AgradDistributionWiener_v_887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_888, AgradDistributionTestFixture, AgradDistributionWiener_v_888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_889, AgradDistributionTestFixture, AgradDistributionWiener_v_889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_890, AgradDistributionTestFixture, AgradDistributionWiener_v_890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_891, AgradDistributionTestFixture, AgradDistributionWiener_v_891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_892, AgradDistributionTestFixture, AgradDistributionWiener_v_892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_893, AgradDistributionTestFixture, AgradDistributionWiener_v_893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_894, AgradDistributionTestFixture, AgradDistributionWiener_v_894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_895, AgradDistributionTestFixture, AgradDistributionWiener_v_895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_896, AgradDistributionTestFixture, AgradDistributionWiener_v_896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_897, AgradDistributionTestFixture, AgradDistributionWiener_v_897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_898, AgradDistributionTestFixture, AgradDistributionWiener_v_898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_899, AgradDistributionTestFixture, AgradDistributionWiener_v_899);
+
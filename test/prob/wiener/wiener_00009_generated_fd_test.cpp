@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_900;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_901;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_902;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_903;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_904;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_905;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_906;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_907;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_908;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, fvar<double>, double, empty> type_fd_909;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_910;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_911;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_912;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_913;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_914;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_915;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_916;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_917;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_918;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_919;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_920;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_921;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_922;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_923;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_924;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_925;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_926;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, double, empty> type_fd_927;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_928;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_929;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_930;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_931;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_932;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_933;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_934;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_935;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_936;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_937;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_938;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_939;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_940;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_941;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_942;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_943;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_944;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_945;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_946;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_947;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_948;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_949;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_950;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_951;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_952;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_953;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_954;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_955;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_956;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_957;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_958;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_959;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_960;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_961;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_962;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_963;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_964;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_965;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_966;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_967;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_968;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_969;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_970;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_971;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_972;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_973;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_974;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_975;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_976;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_977;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_978;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_979;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_980;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_981;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_982;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_983;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_984;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_985;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_986;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_987;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_988;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_989;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_990;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_991;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_992;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_993;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_994;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_995;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_996;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_997;
+typedef boost::mpl::vector<double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_998;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, double, empty> type_fd_999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_900> AgradDistributionWiener_fd_900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_901> AgradDistributionWiener_fd_901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_902> AgradDistributionWiener_fd_902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_903> AgradDistributionWiener_fd_903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_904> AgradDistributionWiener_fd_904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_905> AgradDistributionWiener_fd_905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_906> AgradDistributionWiener_fd_906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_907> AgradDistributionWiener_fd_907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_908> AgradDistributionWiener_fd_908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_909> AgradDistributionWiener_fd_909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_910> AgradDistributionWiener_fd_910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_911> AgradDistributionWiener_fd_911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_912> AgradDistributionWiener_fd_912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_913> AgradDistributionWiener_fd_913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_914> AgradDistributionWiener_fd_914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_915> AgradDistributionWiener_fd_915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_916> AgradDistributionWiener_fd_916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_917> AgradDistributionWiener_fd_917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_918> AgradDistributionWiener_fd_918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_919> AgradDistributionWiener_fd_919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_920> AgradDistributionWiener_fd_920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_921> AgradDistributionWiener_fd_921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_922> AgradDistributionWiener_fd_922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_923> AgradDistributionWiener_fd_923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_924> AgradDistributionWiener_fd_924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_925> AgradDistributionWiener_fd_925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_926> AgradDistributionWiener_fd_926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_927> AgradDistributionWiener_fd_927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_928> AgradDistributionWiener_fd_928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_929> AgradDistributionWiener_fd_929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_930> AgradDistributionWiener_fd_930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_931> AgradDistributionWiener_fd_931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_932> AgradDistributionWiener_fd_932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_933> AgradDistributionWiener_fd_933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_934> AgradDistributionWiener_fd_934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_935> AgradDistributionWiener_fd_935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_936> AgradDistributionWiener_fd_936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_937> AgradDistributionWiener_fd_937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_938> AgradDistributionWiener_fd_938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_939> AgradDistributionWiener_fd_939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_940> AgradDistributionWiener_fd_940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_941> AgradDistributionWiener_fd_941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_942> AgradDistributionWiener_fd_942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_943> AgradDistributionWiener_fd_943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_944> AgradDistributionWiener_fd_944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_945> AgradDistributionWiener_fd_945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_946> AgradDistributionWiener_fd_946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_947> AgradDistributionWiener_fd_947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_948> AgradDistributionWiener_fd_948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_949> AgradDistributionWiener_fd_949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_950> AgradDistributionWiener_fd_950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_951> AgradDistributionWiener_fd_951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_952> AgradDistributionWiener_fd_952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_953> AgradDistributionWiener_fd_953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_954> AgradDistributionWiener_fd_954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_955> AgradDistributionWiener_fd_955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_956> AgradDistributionWiener_fd_956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_957> AgradDistributionWiener_fd_957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_958> AgradDistributionWiener_fd_958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_959> AgradDistributionWiener_fd_959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_960> AgradDistributionWiener_fd_960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_961> AgradDistributionWiener_fd_961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_962> AgradDistributionWiener_fd_962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_963> AgradDistributionWiener_fd_963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_964> AgradDistributionWiener_fd_964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_965> AgradDistributionWiener_fd_965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_966> AgradDistributionWiener_fd_966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_967> AgradDistributionWiener_fd_967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_968> AgradDistributionWiener_fd_968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_969> AgradDistributionWiener_fd_969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_970> AgradDistributionWiener_fd_970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_971> AgradDistributionWiener_fd_971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_972> AgradDistributionWiener_fd_972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_973> AgradDistributionWiener_fd_973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_974> AgradDistributionWiener_fd_974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_975> AgradDistributionWiener_fd_975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_976> AgradDistributionWiener_fd_976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_977> AgradDistributionWiener_fd_977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_978> AgradDistributionWiener_fd_978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_979> AgradDistributionWiener_fd_979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_980> AgradDistributionWiener_fd_980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_981> AgradDistributionWiener_fd_981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_982> AgradDistributionWiener_fd_982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_983> AgradDistributionWiener_fd_983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_984> AgradDistributionWiener_fd_984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_985> AgradDistributionWiener_fd_985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_986> AgradDistributionWiener_fd_986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_987> AgradDistributionWiener_fd_987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_988> AgradDistributionWiener_fd_988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_989> AgradDistributionWiener_fd_989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_990> AgradDistributionWiener_fd_990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_991> AgradDistributionWiener_fd_991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_992> AgradDistributionWiener_fd_992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_993> AgradDistributionWiener_fd_993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_994> AgradDistributionWiener_fd_994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_995> AgradDistributionWiener_fd_995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_996> AgradDistributionWiener_fd_996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_997> AgradDistributionWiener_fd_997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_998> AgradDistributionWiener_fd_998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_999> AgradDistributionWiener_fd_999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_900, AgradDistributionTestFixture, AgradDistributionWiener_fd_900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_901, AgradDistributionTestFixture, AgradDistributionWiener_fd_901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_902, AgradDistributionTestFixture, AgradDistributionWiener_fd_902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_903, AgradDistributionTestFixture, AgradDistributionWiener_fd_903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_904, AgradDistributionTestFixture, AgradDistributionWiener_fd_904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_905, AgradDistributionTestFixture, AgradDistributionWiener_fd_905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_906, AgradDistributionTestFixture, AgradDistributionWiener_fd_906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_907, AgradDistributionTestFixture, AgradDistributionWiener_fd_907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_908, AgradDistributionTestFixture, AgradDistributionWiener_fd_908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_909, AgradDistributionTestFixture, AgradDistributionWiener_fd_909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_910, AgradDistributionTestFixture, AgradDistributionWiener_fd_910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_911, AgradDistributionTestFixture, AgradDistributionWiener_fd_911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_912, AgradDistributionTestFixture, AgradDistributionWiener_fd_912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_913, AgradDistributionTestFixture, AgradDistributionWiener_fd_913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_914, AgradDistributionTestFixture, AgradDistributionWiener_fd_914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_915, AgradDistributionTestFixture, AgradDistributionWiener_fd_915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_916, AgradDistributionTestFixture, AgradDistributionWiener_fd_916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_917, AgradDistributionTestFixture, AgradDistributionWiener_fd_917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_918, AgradDistributionTestFixture, AgradDistributionWiener_fd_918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_919, AgradDistributionTestFixture, AgradDistributionWiener_fd_919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_920, AgradDistributionTestFixture, AgradDistributionWiener_fd_920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_921, AgradDistributionTestFixture, AgradDistributionWiener_fd_921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_922, AgradDistributionTestFixture, AgradDistributionWiener_fd_922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_923, AgradDistributionTestFixture, AgradDistributionWiener_fd_923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_924, AgradDistributionTestFixture, AgradDistributionWiener_fd_924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_925, AgradDistributionTestFixture, AgradDistributionWiener_fd_925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_926, AgradDistributionTestFixture, AgradDistributionWiener_fd_926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_927, AgradDistributionTestFixture, AgradDistributionWiener_fd_927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_928, AgradDistributionTestFixture, AgradDistributionWiener_fd_928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_929, AgradDistributionTestFixture, AgradDistributionWiener_fd_929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_930, AgradDistributionTestFixture, AgradDistributionWiener_fd_930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_931, AgradDistributionTestFixture, AgradDistributionWiener_fd_931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_932, AgradDistributionTestFixture, AgradDistributionWiener_fd_932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_933, AgradDistributionTestFixture, AgradDistributionWiener_fd_933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_934, AgradDistributionTestFixture, AgradDistributionWiener_fd_934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_935, AgradDistributionTestFixture, AgradDistributionWiener_fd_935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_936, AgradDistributionTestFixture, AgradDistributionWiener_fd_936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_937, AgradDistributionTestFixture, AgradDistributionWiener_fd_937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_938, AgradDistributionTestFixture, AgradDistributionWiener_fd_938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_939, AgradDistributionTestFixture, AgradDistributionWiener_fd_939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_940, AgradDistributionTestFixture, AgradDistributionWiener_fd_940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_941, AgradDistributionTestFixture, AgradDistributionWiener_fd_941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_942, AgradDistributionTestFixture, AgradDistributionWiener_fd_942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_943, AgradDistributionTestFixture, AgradDistributionWiener_fd_943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_944, AgradDistributionTestFixture, AgradDistributionWiener_fd_944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_945, AgradDistributionTestFixture, AgradDistributionWiener_fd_945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_946, AgradDistributionTestFixture, AgradDistributionWiener_fd_946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_947, AgradDistributionTestFixture, AgradDistributionWiener_fd_947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_948, AgradDistributionTestFixture, AgradDistributionWiener_fd_948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_949, AgradDistributionTestFixture, AgradDistributionWiener_fd_949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_950, AgradDistributionTestFixture, AgradDistributionWiener_fd_950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_951, AgradDistributionTestFixture, AgradDistributionWiener_fd_951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_952, AgradDistributionTestFixture, AgradDistributionWiener_fd_952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_953, AgradDistributionTestFixture, AgradDistributionWiener_fd_953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_954, AgradDistributionTestFixture, AgradDistributionWiener_fd_954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_955, AgradDistributionTestFixture, AgradDistributionWiener_fd_955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_956, AgradDistributionTestFixture, AgradDistributionWiener_fd_956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_957, AgradDistributionTestFixture, AgradDistributionWiener_fd_957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_958, AgradDistributionTestFixture, AgradDistributionWiener_fd_958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_959, AgradDistributionTestFixture, AgradDistributionWiener_fd_959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_960, AgradDistributionTestFixture, AgradDistributionWiener_fd_960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_961, AgradDistributionTestFixture, AgradDistributionWiener_fd_961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_962, AgradDistributionTestFixture, AgradDistributionWiener_fd_962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_963, AgradDistributionTestFixture, AgradDistributionWiener_fd_963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_964, AgradDistributionTestFixture, AgradDistributionWiener_fd_964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_965, AgradDistributionTestFixture, AgradDistributionWiener_fd_965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_966, AgradDistributionTestFixture, AgradDistributionWiener_fd_966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_967, AgradDistributionTestFixture, AgradDistributionWiener_fd_967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_968, AgradDistributionTestFixture, AgradDistributionWiener_fd_968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_969, AgradDistributionTestFixture, AgradDistributionWiener_fd_969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_970, AgradDistributionTestFixture, AgradDistributionWiener_fd_970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_971, AgradDistributionTestFixture, AgradDistributionWiener_fd_971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_972, AgradDistributionTestFixture, AgradDistributionWiener_fd_972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_973, AgradDistributionTestFixture, AgradDistributionWiener_fd_973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_974, AgradDistributionTestFixture, AgradDistributionWiener_fd_974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_975, AgradDistributionTestFixture, AgradDistributionWiener_fd_975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_976, AgradDistributionTestFixture, AgradDistributionWiener_fd_976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_977, AgradDistributionTestFixture, AgradDistributionWiener_fd_977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_978, AgradDistributionTestFixture, AgradDistributionWiener_fd_978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_979, AgradDistributionTestFixture, AgradDistributionWiener_fd_979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_980, AgradDistributionTestFixture, AgradDistributionWiener_fd_980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_981, AgradDistributionTestFixture, AgradDistributionWiener_fd_981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_982, AgradDistributionTestFixture, AgradDistributionWiener_fd_982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_983, AgradDistributionTestFixture, AgradDistributionWiener_fd_983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_984, AgradDistributionTestFixture, AgradDistributionWiener_fd_984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_985, AgradDistributionTestFixture, AgradDistributionWiener_fd_985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_986, AgradDistributionTestFixture, AgradDistributionWiener_fd_986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_987, AgradDistributionTestFixture, AgradDistributionWiener_fd_987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_988, AgradDistributionTestFixture, AgradDistributionWiener_fd_988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_989, AgradDistributionTestFixture, AgradDistributionWiener_fd_989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_990, AgradDistributionTestFixture, AgradDistributionWiener_fd_990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_991, AgradDistributionTestFixture, AgradDistributionWiener_fd_991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_992, AgradDistributionTestFixture, AgradDistributionWiener_fd_992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_993, AgradDistributionTestFixture, AgradDistributionWiener_fd_993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_994, AgradDistributionTestFixture, AgradDistributionWiener_fd_994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_995, AgradDistributionTestFixture, AgradDistributionWiener_fd_995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_996, AgradDistributionTestFixture, AgradDistributionWiener_fd_996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_997, AgradDistributionTestFixture, AgradDistributionWiener_fd_997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_998, AgradDistributionTestFixture, AgradDistributionWiener_fd_998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_999, AgradDistributionTestFixture, AgradDistributionWiener_fd_999);
+
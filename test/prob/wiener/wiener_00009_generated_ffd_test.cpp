@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_900;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_901;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_902;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_903;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_904;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_905;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_906;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_907;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_908;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_909;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_910;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_911;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_912;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_913;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_914;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_915;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_916;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_917;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_918;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_919;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_920;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_921;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_922;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_923;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_924;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_925;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_926;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_927;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_928;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_929;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_930;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_931;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_932;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_933;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_934;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_935;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_936;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_937;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_938;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_939;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_940;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_941;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_942;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_943;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_944;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_945;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_946;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_947;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_948;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_949;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_950;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_951;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_952;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_953;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_954;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_955;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_956;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_957;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_958;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_959;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_960;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_961;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_962;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_963;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_964;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_965;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_966;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_967;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_968;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_969;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_970;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_971;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_972;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_973;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_974;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_975;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_976;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_977;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_978;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_979;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_980;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_981;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_982;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_983;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_984;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_985;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_986;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_987;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_988;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_989;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_990;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_991;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_992;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_993;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_994;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_995;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_996;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_997;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_998;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, empty> type_ffd_999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_900> AgradDistributionWiener_ffd_900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_901> AgradDistributionWiener_ffd_901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_902> AgradDistributionWiener_ffd_902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_903> AgradDistributionWiener_ffd_903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_904> AgradDistributionWiener_ffd_904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_905> AgradDistributionWiener_ffd_905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_906> AgradDistributionWiener_ffd_906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_907> AgradDistributionWiener_ffd_907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_908> AgradDistributionWiener_ffd_908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_909> AgradDistributionWiener_ffd_909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_910> AgradDistributionWiener_ffd_910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_911> AgradDistributionWiener_ffd_911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_912> AgradDistributionWiener_ffd_912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_913> AgradDistributionWiener_ffd_913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_914> AgradDistributionWiener_ffd_914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_915> AgradDistributionWiener_ffd_915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_916> AgradDistributionWiener_ffd_916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_917> AgradDistributionWiener_ffd_917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_918> AgradDistributionWiener_ffd_918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_919> AgradDistributionWiener_ffd_919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_920> AgradDistributionWiener_ffd_920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_921> AgradDistributionWiener_ffd_921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_922> AgradDistributionWiener_ffd_922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_923> AgradDistributionWiener_ffd_923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_924> AgradDistributionWiener_ffd_924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_925> AgradDistributionWiener_ffd_925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_926> AgradDistributionWiener_ffd_926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_927> AgradDistributionWiener_ffd_927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_928> AgradDistributionWiener_ffd_928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_929> AgradDistributionWiener_ffd_929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_930> AgradDistributionWiener_ffd_930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_931> AgradDistributionWiener_ffd_931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_932> AgradDistributionWiener_ffd_932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_933> AgradDistributionWiener_ffd_933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_934> AgradDistributionWiener_ffd_934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_935> AgradDistributionWiener_ffd_935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_936> AgradDistributionWiener_ffd_936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_937> AgradDistributionWiener_ffd_937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_938> AgradDistributionWiener_ffd_938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_939> AgradDistributionWiener_ffd_939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_940> AgradDistributionWiener_ffd_940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_941> AgradDistributionWiener_ffd_941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_942> AgradDistributionWiener_ffd_942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_943> AgradDistributionWiener_ffd_943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_944> AgradDistributionWiener_ffd_944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_945> AgradDistributionWiener_ffd_945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_946> AgradDistributionWiener_ffd_946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_947> AgradDistributionWiener_ffd_947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_948> AgradDistributionWiener_ffd_948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_949> AgradDistributionWiener_ffd_949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_950> AgradDistributionWiener_ffd_950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_951> AgradDistributionWiener_ffd_951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_952> AgradDistributionWiener_ffd_952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_953> AgradDistributionWiener_ffd_953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_954> AgradDistributionWiener_ffd_954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_955> AgradDistributionWiener_ffd_955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_956> AgradDistributionWiener_ffd_956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_957> AgradDistributionWiener_ffd_957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_958> AgradDistributionWiener_ffd_958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_959> AgradDistributionWiener_ffd_959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_960> AgradDistributionWiener_ffd_960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_961> AgradDistributionWiener_ffd_961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_962> AgradDistributionWiener_ffd_962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_963> AgradDistributionWiener_ffd_963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_964> AgradDistributionWiener_ffd_964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_965> AgradDistributionWiener_ffd_965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_966> AgradDistributionWiener_ffd_966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_967> AgradDistributionWiener_ffd_967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_968> AgradDistributionWiener_ffd_968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_969> AgradDistributionWiener_ffd_969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_970> AgradDistributionWiener_ffd_970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_971> AgradDistributionWiener_ffd_971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_972> AgradDistributionWiener_ffd_972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_973> AgradDistributionWiener_ffd_973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_974> AgradDistributionWiener_ffd_974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_975> AgradDistributionWiener_ffd_975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_976> AgradDistributionWiener_ffd_976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_977> AgradDistributionWiener_ffd_977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_978> AgradDistributionWiener_ffd_978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_979> AgradDistributionWiener_ffd_979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_980> AgradDistributionWiener_ffd_980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_981> AgradDistributionWiener_ffd_981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_982> AgradDistributionWiener_ffd_982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_983> AgradDistributionWiener_ffd_983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_984> AgradDistributionWiener_ffd_984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_985> AgradDistributionWiener_ffd_985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_986> AgradDistributionWiener_ffd_986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_987> AgradDistributionWiener_ffd_987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_988> AgradDistributionWiener_ffd_988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_989> AgradDistributionWiener_ffd_989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_990> AgradDistributionWiener_ffd_990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_991> AgradDistributionWiener_ffd_991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_992> AgradDistributionWiener_ffd_992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_993> AgradDistributionWiener_ffd_993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_994> AgradDistributionWiener_ffd_994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_995> AgradDistributionWiener_ffd_995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_996> AgradDistributionWiener_ffd_996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_997> AgradDistributionWiener_ffd_997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_998> AgradDistributionWiener_ffd_998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_999> AgradDistributionWiener_ffd_999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_900, AgradDistributionTestFixture, AgradDistributionWiener_ffd_900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_901, AgradDistributionTestFixture, AgradDistributionWiener_ffd_901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_902, AgradDistributionTestFixture, AgradDistributionWiener_ffd_902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_903, AgradDistributionTestFixture, AgradDistributionWiener_ffd_903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_904, AgradDistributionTestFixture, AgradDistributionWiener_ffd_904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_905, AgradDistributionTestFixture, AgradDistributionWiener_ffd_905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_906, AgradDistributionTestFixture, AgradDistributionWiener_ffd_906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_907, AgradDistributionTestFixture, AgradDistributionWiener_ffd_907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_908, AgradDistributionTestFixture, AgradDistributionWiener_ffd_908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_909, AgradDistributionTestFixture, AgradDistributionWiener_ffd_909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_910, AgradDistributionTestFixture, AgradDistributionWiener_ffd_910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_911, AgradDistributionTestFixture, AgradDistributionWiener_ffd_911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_912, AgradDistributionTestFixture, AgradDistributionWiener_ffd_912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_913, AgradDistributionTestFixture, AgradDistributionWiener_ffd_913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_914, AgradDistributionTestFixture, AgradDistributionWiener_ffd_914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_915, AgradDistributionTestFixture, AgradDistributionWiener_ffd_915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_916, AgradDistributionTestFixture, AgradDistributionWiener_ffd_916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_917, AgradDistributionTestFixture, AgradDistributionWiener_ffd_917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_918, AgradDistributionTestFixture, AgradDistributionWiener_ffd_918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_919, AgradDistributionTestFixture, AgradDistributionWiener_ffd_919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_920, AgradDistributionTestFixture, AgradDistributionWiener_ffd_920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_921, AgradDistributionTestFixture, AgradDistributionWiener_ffd_921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_922, AgradDistributionTestFixture, AgradDistributionWiener_ffd_922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_923, AgradDistributionTestFixture, AgradDistributionWiener_ffd_923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_924, AgradDistributionTestFixture, AgradDistributionWiener_ffd_924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_925, AgradDistributionTestFixture, AgradDistributionWiener_ffd_925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_926, AgradDistributionTestFixture, AgradDistributionWiener_ffd_926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_927, AgradDistributionTestFixture, AgradDistributionWiener_ffd_927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_928, AgradDistributionTestFixture, AgradDistributionWiener_ffd_928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_929, AgradDistributionTestFixture, AgradDistributionWiener_ffd_929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_930, AgradDistributionTestFixture, AgradDistributionWiener_ffd_930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_931, AgradDistributionTestFixture, AgradDistributionWiener_ffd_931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_932, AgradDistributionTestFixture, AgradDistributionWiener_ffd_932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_933, AgradDistributionTestFixture, AgradDistributionWiener_ffd_933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_934, AgradDistributionTestFixture, AgradDistributionWiener_ffd_934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_935, AgradDistributionTestFixture, AgradDistributionWiener_ffd_935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_936, AgradDistributionTestFixture, AgradDistributionWiener_ffd_936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_937, AgradDistributionTestFixture, AgradDistributionWiener_ffd_937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_938, AgradDistributionTestFixture, AgradDistributionWiener_ffd_938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_939, AgradDistributionTestFixture, AgradDistributionWiener_ffd_939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_940, AgradDistributionTestFixture, AgradDistributionWiener_ffd_940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_941, AgradDistributionTestFixture, AgradDistributionWiener_ffd_941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_942, AgradDistributionTestFixture, AgradDistributionWiener_ffd_942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_943, AgradDistributionTestFixture, AgradDistributionWiener_ffd_943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_944, AgradDistributionTestFixture, AgradDistributionWiener_ffd_944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_945, AgradDistributionTestFixture, AgradDistributionWiener_ffd_945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_946, AgradDistributionTestFixture, AgradDistributionWiener_ffd_946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_947, AgradDistributionTestFixture, AgradDistributionWiener_ffd_947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_948, AgradDistributionTestFixture, AgradDistributionWiener_ffd_948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_949, AgradDistributionTestFixture, AgradDistributionWiener_ffd_949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_950, AgradDistributionTestFixture, AgradDistributionWiener_ffd_950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_951, AgradDistributionTestFixture, AgradDistributionWiener_ffd_951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_952, AgradDistributionTestFixture, AgradDistributionWiener_ffd_952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_953, AgradDistributionTestFixture, AgradDistributionWiener_ffd_953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_954, AgradDistributionTestFixture, AgradDistributionWiener_ffd_954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_955, AgradDistributionTestFixture, AgradDistributionWiener_ffd_955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_956, AgradDistributionTestFixture, AgradDistributionWiener_ffd_956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_957, AgradDistributionTestFixture, AgradDistributionWiener_ffd_957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_958, AgradDistributionTestFixture, AgradDistributionWiener_ffd_958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_959, AgradDistributionTestFixture, AgradDistributionWiener_ffd_959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_960, AgradDistributionTestFixture, AgradDistributionWiener_ffd_960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_961, AgradDistributionTestFixture, AgradDistributionWiener_ffd_961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_962, AgradDistributionTestFixture, AgradDistributionWiener_ffd_962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_963, AgradDistributionTestFixture, AgradDistributionWiener_ffd_963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_964, AgradDistributionTestFixture, AgradDistributionWiener_ffd_964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_965, AgradDistributionTestFixture, AgradDistributionWiener_ffd_965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_966, AgradDistributionTestFixture, AgradDistributionWiener_ffd_966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_967, AgradDistributionTestFixture, AgradDistributionWiener_ffd_967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_968, AgradDistributionTestFixture, AgradDistributionWiener_ffd_968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_969, AgradDistributionTestFixture, AgradDistributionWiener_ffd_969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_970, AgradDistributionTestFixture, AgradDistributionWiener_ffd_970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_971, AgradDistributionTestFixture, AgradDistributionWiener_ffd_971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_972, AgradDistributionTestFixture, AgradDistributionWiener_ffd_972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_973, AgradDistributionTestFixture, AgradDistributionWiener_ffd_973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_974, AgradDistributionTestFixture, AgradDistributionWiener_ffd_974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_975, AgradDistributionTestFixture, AgradDistributionWiener_ffd_975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_976, AgradDistributionTestFixture, AgradDistributionWiener_ffd_976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_977, AgradDistributionTestFixture, AgradDistributionWiener_ffd_977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_978, AgradDistributionTestFixture, AgradDistributionWiener_ffd_978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_979, AgradDistributionTestFixture, AgradDistributionWiener_ffd_979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_980, AgradDistributionTestFixture, AgradDistributionWiener_ffd_980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_981, AgradDistributionTestFixture, AgradDistributionWiener_ffd_981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_982, AgradDistributionTestFixture, AgradDistributionWiener_ffd_982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_983, AgradDistributionTestFixture, AgradDistributionWiener_ffd_983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_984, AgradDistributionTestFixture, AgradDistributionWiener_ffd_984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_985, AgradDistributionTestFixture, AgradDistributionWiener_ffd_985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_986, AgradDistributionTestFixture, AgradDistributionWiener_ffd_986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_987, AgradDistributionTestFixture, AgradDistributionWiener_ffd_987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_988, AgradDistributionTestFixture, AgradDistributionWiener_ffd_988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_989, AgradDistributionTestFixture, AgradDistributionWiener_ffd_989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_990, AgradDistributionTestFixture, AgradDistributionWiener_ffd_990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_991, AgradDistributionTestFixture, AgradDistributionWiener_ffd_991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_992, AgradDistributionTestFixture, AgradDistributionWiener_ffd_992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_993, AgradDistributionTestFixture, AgradDistributionWiener_ffd_993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_994, AgradDistributionTestFixture, AgradDistributionWiener_ffd_994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_995, AgradDistributionTestFixture, AgradDistributionWiener_ffd_995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_996, AgradDistributionTestFixture, AgradDistributionWiener_ffd_996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_997, AgradDistributionTestFixture, AgradDistributionWiener_ffd_997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_998, AgradDistributionTestFixture, AgradDistributionWiener_ffd_998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_999, AgradDistributionTestFixture, AgradDistributionWiener_ffd_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_900;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_901;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_902;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_903;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_904;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_905;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_906;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_907;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_908;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_909;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_910;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_911;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_912;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_913;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_914;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_915;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_916;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_917;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_918;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_919;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_920;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_921;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_922;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_923;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_924;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_925;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_926;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_927;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_928;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_929;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_930;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_931;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_932;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_933;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_934;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_935;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_936;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_937;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_938;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_939;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_940;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_941;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_942;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_943;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_944;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_945;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_946;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_947;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_948;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_949;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_950;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_951;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_952;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_953;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_954;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_955;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_956;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_957;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_958;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_959;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_960;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_961;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_962;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_963;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_964;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_965;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_966;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_967;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_968;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_969;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_970;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_971;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_972;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_973;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_974;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_975;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_976;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_977;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_978;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_979;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_980;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_981;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_982;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_983;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_984;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_985;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_986;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_987;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_988;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_989;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_990;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_991;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_992;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_993;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_994;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_995;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_996;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_997;
+typedef boost::mpl::vector<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_998;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty> type_ffv_999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_900> AgradDistributionWiener_ffv_900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_901> AgradDistributionWiener_ffv_901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_902> AgradDistributionWiener_ffv_902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_903> AgradDistributionWiener_ffv_903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_904> AgradDistributionWiener_ffv_904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_905> AgradDistributionWiener_ffv_905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_906> AgradDistributionWiener_ffv_906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_907> AgradDistributionWiener_ffv_907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_908> AgradDistributionWiener_ffv_908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_909> AgradDistributionWiener_ffv_909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_910> AgradDistributionWiener_ffv_910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_911> AgradDistributionWiener_ffv_911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_912> AgradDistributionWiener_ffv_912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_913> AgradDistributionWiener_ffv_913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_914> AgradDistributionWiener_ffv_914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_915> AgradDistributionWiener_ffv_915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_916> AgradDistributionWiener_ffv_916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_917> AgradDistributionWiener_ffv_917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_918> AgradDistributionWiener_ffv_918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_919> AgradDistributionWiener_ffv_919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_920> AgradDistributionWiener_ffv_920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_921> AgradDistributionWiener_ffv_921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_922> AgradDistributionWiener_ffv_922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_923> AgradDistributionWiener_ffv_923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_924> AgradDistributionWiener_ffv_924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_925> AgradDistributionWiener_ffv_925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_926> AgradDistributionWiener_ffv_926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_927> AgradDistributionWiener_ffv_927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_928> AgradDistributionWiener_ffv_928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_929> AgradDistributionWiener_ffv_929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_930> AgradDistributionWiener_ffv_930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_931> AgradDistributionWiener_ffv_931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_932> AgradDistributionWiener_ffv_932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_933> AgradDistributionWiener_ffv_933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_934> AgradDistributionWiener_ffv_934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_935> AgradDistributionWiener_ffv_935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_936> AgradDistributionWiener_ffv_936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_937> AgradDistributionWiener_ffv_937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_938> AgradDistributionWiener_ffv_938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_939> AgradDistributionWiener_ffv_939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_940> AgradDistributionWiener_ffv_940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_941> AgradDistributionWiener_ffv_941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_942> AgradDistributionWiener_ffv_942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_943> AgradDistributionWiener_ffv_943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_944> AgradDistributionWiener_ffv_944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_945> AgradDistributionWiener_ffv_945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_946> AgradDistributionWiener_ffv_946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_947> AgradDistributionWiener_ffv_947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_948> AgradDistributionWiener_ffv_948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_949> AgradDistributionWiener_ffv_949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_950> AgradDistributionWiener_ffv_950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_951> AgradDistributionWiener_ffv_951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_952> AgradDistributionWiener_ffv_952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_953> AgradDistributionWiener_ffv_953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_954> AgradDistributionWiener_ffv_954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_955> AgradDistributionWiener_ffv_955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_956> AgradDistributionWiener_ffv_956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_957> AgradDistributionWiener_ffv_957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_958> AgradDistributionWiener_ffv_958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_959> AgradDistributionWiener_ffv_959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_960> AgradDistributionWiener_ffv_960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_961> AgradDistributionWiener_ffv_961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_962> AgradDistributionWiener_ffv_962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_963> AgradDistributionWiener_ffv_963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_964> AgradDistributionWiener_ffv_964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_965> AgradDistributionWiener_ffv_965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_966> AgradDistributionWiener_ffv_966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_967> AgradDistributionWiener_ffv_967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_968> AgradDistributionWiener_ffv_968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_969> AgradDistributionWiener_ffv_969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_970> AgradDistributionWiener_ffv_970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_971> AgradDistributionWiener_ffv_971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_972> AgradDistributionWiener_ffv_972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_973> AgradDistributionWiener_ffv_973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_974> AgradDistributionWiener_ffv_974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_975> AgradDistributionWiener_ffv_975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_976> AgradDistributionWiener_ffv_976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_977> AgradDistributionWiener_ffv_977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_978> AgradDistributionWiener_ffv_978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_979> AgradDistributionWiener_ffv_979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_980> AgradDistributionWiener_ffv_980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_981> AgradDistributionWiener_ffv_981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_982> AgradDistributionWiener_ffv_982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_983> AgradDistributionWiener_ffv_983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_984> AgradDistributionWiener_ffv_984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_985> AgradDistributionWiener_ffv_985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_986> AgradDistributionWiener_ffv_986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_987> AgradDistributionWiener_ffv_987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_988> AgradDistributionWiener_ffv_988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_989> AgradDistributionWiener_ffv_989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_990> AgradDistributionWiener_ffv_990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_991> AgradDistributionWiener_ffv_991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_992> AgradDistributionWiener_ffv_992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_993> AgradDistributionWiener_ffv_993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_994> AgradDistributionWiener_ffv_994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_995> AgradDistributionWiener_ffv_995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_996> AgradDistributionWiener_ffv_996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_997> AgradDistributionWiener_ffv_997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_998> AgradDistributionWiener_ffv_998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_999> AgradDistributionWiener_ffv_999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_900, AgradDistributionTestFixture, AgradDistributionWiener_ffv_900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_901, AgradDistributionTestFixture, AgradDistributionWiener_ffv_901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_902, AgradDistributionTestFixture, AgradDistributionWiener_ffv_902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_903, AgradDistributionTestFixture, AgradDistributionWiener_ffv_903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_904, AgradDistributionTestFixture, AgradDistributionWiener_ffv_904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_905, AgradDistributionTestFixture, AgradDistributionWiener_ffv_905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_906, AgradDistributionTestFixture, AgradDistributionWiener_ffv_906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_907, AgradDistributionTestFixture, AgradDistributionWiener_ffv_907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_908, AgradDistributionTestFixture, AgradDistributionWiener_ffv_908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_909, AgradDistributionTestFixture, AgradDistributionWiener_ffv_909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_910, AgradDistributionTestFixture, AgradDistributionWiener_ffv_910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_911, AgradDistributionTestFixture, AgradDistributionWiener_ffv_911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_912, AgradDistributionTestFixture, AgradDistributionWiener_ffv_912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_913, AgradDistributionTestFixture, AgradDistributionWiener_ffv_913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_914, AgradDistributionTestFixture, AgradDistributionWiener_ffv_914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_915, AgradDistributionTestFixture, AgradDistributionWiener_ffv_915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_916, AgradDistributionTestFixture, AgradDistributionWiener_ffv_916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_917, AgradDistributionTestFixture, AgradDistributionWiener_ffv_917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_918, AgradDistributionTestFixture, AgradDistributionWiener_ffv_918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_919, AgradDistributionTestFixture, AgradDistributionWiener_ffv_919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_920, AgradDistributionTestFixture, AgradDistributionWiener_ffv_920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_921, AgradDistributionTestFixture, AgradDistributionWiener_ffv_921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_922, AgradDistributionTestFixture, AgradDistributionWiener_ffv_922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_923, AgradDistributionTestFixture, AgradDistributionWiener_ffv_923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_924, AgradDistributionTestFixture, AgradDistributionWiener_ffv_924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_925, AgradDistributionTestFixture, AgradDistributionWiener_ffv_925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_926, AgradDistributionTestFixture, AgradDistributionWiener_ffv_926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_927, AgradDistributionTestFixture, AgradDistributionWiener_ffv_927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_928, AgradDistributionTestFixture, AgradDistributionWiener_ffv_928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_929, AgradDistributionTestFixture, AgradDistributionWiener_ffv_929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_930, AgradDistributionTestFixture, AgradDistributionWiener_ffv_930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_931, AgradDistributionTestFixture, AgradDistributionWiener_ffv_931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_932, AgradDistributionTestFixture, AgradDistributionWiener_ffv_932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_933, AgradDistributionTestFixture, AgradDistributionWiener_ffv_933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_934, AgradDistributionTestFixture, AgradDistributionWiener_ffv_934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_935, AgradDistributionTestFixture, AgradDistributionWiener_ffv_935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_936, AgradDistributionTestFixture, AgradDistributionWiener_ffv_936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_937, AgradDistributionTestFixture, AgradDistributionWiener_ffv_937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_938, AgradDistributionTestFixture, AgradDistributionWiener_ffv_938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_939, AgradDistributionTestFixture, AgradDistributionWiener_ffv_939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_940, AgradDistributionTestFixture, AgradDistributionWiener_ffv_940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_941, AgradDistributionTestFixture, AgradDistributionWiener_ffv_941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_942, AgradDistributionTestFixture, AgradDistributionWiener_ffv_942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_943, AgradDistributionTestFixture, AgradDistributionWiener_ffv_943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_944, AgradDistributionTestFixture, AgradDistributionWiener_ffv_944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_945, AgradDistributionTestFixture, AgradDistributionWiener_ffv_945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_946, AgradDistributionTestFixture, AgradDistributionWiener_ffv_946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_947, AgradDistributionTestFixture, AgradDistributionWiener_ffv_947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_948, AgradDistributionTestFixture, AgradDistributionWiener_ffv_948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_949, AgradDistributionTestFixture, AgradDistributionWiener_ffv_949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_950, AgradDistributionTestFixture, AgradDistributionWiener_ffv_950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_951, AgradDistributionTestFixture, AgradDistributionWiener_ffv_951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_952, AgradDistributionTestFixture, AgradDistributionWiener_ffv_952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_953, AgradDistributionTestFixture, AgradDistributionWiener_ffv_953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_954, AgradDistributionTestFixture, AgradDistributionWiener_ffv_954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_955, AgradDistributionTestFixture, AgradDistributionWiener_ffv_955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_956, AgradDistributionTestFixture, AgradDistributionWiener_ffv_956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_957, AgradDistributionTestFixture, AgradDistributionWiener_ffv_957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_958, AgradDistributionTestFixture, AgradDistributionWiener_ffv_958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_959, AgradDistributionTestFixture, AgradDistributionWiener_ffv_959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_960, AgradDistributionTestFixture, AgradDistributionWiener_ffv_960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_961, AgradDistributionTestFixture, AgradDistributionWiener_ffv_961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_962, AgradDistributionTestFixture, AgradDistributionWiener_ffv_962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_963, AgradDistributionTestFixture, AgradDistributionWiener_ffv_963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_964, AgradDistributionTestFixture, AgradDistributionWiener_ffv_964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_965, AgradDistributionTestFixture, AgradDistributionWiener_ffv_965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_966, AgradDistributionTestFixture, AgradDistributionWiener_ffv_966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_967, AgradDistributionTestFixture, AgradDistributionWiener_ffv_967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_968, AgradDistributionTestFixture, AgradDistributionWiener_ffv_968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_969, AgradDistributionTestFixture, AgradDistributionWiener_ffv_969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_970, AgradDistributionTestFixture, AgradDistributionWiener_ffv_970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_971, AgradDistributionTestFixture, AgradDistributionWiener_ffv_971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_972, AgradDistributionTestFixture, AgradDistributionWiener_ffv_972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_973, AgradDistributionTestFixture, AgradDistributionWiener_ffv_973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_974, AgradDistributionTestFixture, AgradDistributionWiener_ffv_974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_975, AgradDistributionTestFixture, AgradDistributionWiener_ffv_975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_976, AgradDistributionTestFixture, AgradDistributionWiener_ffv_976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_977, AgradDistributionTestFixture, AgradDistributionWiener_ffv_977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_978, AgradDistributionTestFixture, AgradDistributionWiener_ffv_978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_979, AgradDistributionTestFixture, AgradDistributionWiener_ffv_979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_980, AgradDistributionTestFixture, AgradDistributionWiener_ffv_980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_981, AgradDistributionTestFixture, AgradDistributionWiener_ffv_981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_982, AgradDistributionTestFixture, AgradDistributionWiener_ffv_982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_983, AgradDistributionTestFixture, AgradDistributionWiener_ffv_983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_984, AgradDistributionTestFixture, AgradDistributionWiener_ffv_984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_985, AgradDistributionTestFixture, AgradDistributionWiener_ffv_985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_986, AgradDistributionTestFixture, AgradDistributionWiener_ffv_986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_987, AgradDistributionTestFixture, AgradDistributionWiener_ffv_987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_988, AgradDistributionTestFixture, AgradDistributionWiener_ffv_988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_989, AgradDistributionTestFixture, AgradDistributionWiener_ffv_989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_990, AgradDistributionTestFixture, AgradDistributionWiener_ffv_990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_991, AgradDistributionTestFixture, AgradDistributionWiener_ffv_991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_992, AgradDistributionTestFixture, AgradDistributionWiener_ffv_992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_993, AgradDistributionTestFixture, AgradDistributionWiener_ffv_993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_994, AgradDistributionTestFixture, AgradDistributionWiener_ffv_994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_995, AgradDistributionTestFixture, AgradDistributionWiener_ffv_995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_996, AgradDistributionTestFixture, AgradDistributionWiener_ffv_996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_997, AgradDistributionTestFixture, AgradDistributionWiener_ffv_997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_998, AgradDistributionTestFixture, AgradDistributionWiener_ffv_998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_999, AgradDistributionTestFixture, AgradDistributionWiener_ffv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_900;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_901;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_902;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_903;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_904;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_905;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_906;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_907;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_908;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, fvar<var>, double, empty> type_fv_909;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_910;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_911;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_912;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_913;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_914;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_915;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_916;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_917;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_918;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_919;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_920;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_921;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_922;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_923;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_924;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_925;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_926;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, double, empty> type_fv_927;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_928;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_929;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_930;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_931;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_932;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_933;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_934;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_935;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_936;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_937;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_938;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_939;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_940;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_941;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_942;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_943;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_944;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_945;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_946;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_947;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_948;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_949;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_950;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_951;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_952;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_953;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_954;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_955;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_956;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_957;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_958;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_959;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_960;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_961;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_962;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_963;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_964;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_965;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_966;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_967;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_968;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_969;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_970;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_971;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_972;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_973;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_974;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_975;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_976;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_977;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_978;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_979;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_980;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_981;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_982;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_983;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_984;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_985;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_986;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_987;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_988;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_989;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_990;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_991;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_992;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_993;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_994;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_995;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_996;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_997;
+typedef boost::mpl::vector<double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_998;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, double, empty> type_fv_999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_900> AgradDistributionWiener_fv_900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_901> AgradDistributionWiener_fv_901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_902> AgradDistributionWiener_fv_902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_903> AgradDistributionWiener_fv_903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_904> AgradDistributionWiener_fv_904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_905> AgradDistributionWiener_fv_905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_906> AgradDistributionWiener_fv_906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_907> AgradDistributionWiener_fv_907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_908> AgradDistributionWiener_fv_908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_909> AgradDistributionWiener_fv_909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_910> AgradDistributionWiener_fv_910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_911> AgradDistributionWiener_fv_911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_912> AgradDistributionWiener_fv_912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_913> AgradDistributionWiener_fv_913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_914> AgradDistributionWiener_fv_914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_915> AgradDistributionWiener_fv_915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_916> AgradDistributionWiener_fv_916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_917> AgradDistributionWiener_fv_917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_918> AgradDistributionWiener_fv_918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_919> AgradDistributionWiener_fv_919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_920> AgradDistributionWiener_fv_920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_921> AgradDistributionWiener_fv_921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_922> AgradDistributionWiener_fv_922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_923> AgradDistributionWiener_fv_923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_924> AgradDistributionWiener_fv_924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_925> AgradDistributionWiener_fv_925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_926> AgradDistributionWiener_fv_926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_927> AgradDistributionWiener_fv_927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_928> AgradDistributionWiener_fv_928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_929> AgradDistributionWiener_fv_929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_930> AgradDistributionWiener_fv_930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_931> AgradDistributionWiener_fv_931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_932> AgradDistributionWiener_fv_932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_933> AgradDistributionWiener_fv_933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_934> AgradDistributionWiener_fv_934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_935> AgradDistributionWiener_fv_935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_936> AgradDistributionWiener_fv_936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_937> AgradDistributionWiener_fv_937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_938> AgradDistributionWiener_fv_938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_939> AgradDistributionWiener_fv_939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_940> AgradDistributionWiener_fv_940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_941> AgradDistributionWiener_fv_941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_942> AgradDistributionWiener_fv_942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_943> AgradDistributionWiener_fv_943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_944> AgradDistributionWiener_fv_944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_945> AgradDistributionWiener_fv_945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_946> AgradDistributionWiener_fv_946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_947> AgradDistributionWiener_fv_947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_948> AgradDistributionWiener_fv_948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_949> AgradDistributionWiener_fv_949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_950> AgradDistributionWiener_fv_950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_951> AgradDistributionWiener_fv_951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_952> AgradDistributionWiener_fv_952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_953> AgradDistributionWiener_fv_953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_954> AgradDistributionWiener_fv_954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_955> AgradDistributionWiener_fv_955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_956> AgradDistributionWiener_fv_956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_957> AgradDistributionWiener_fv_957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_958> AgradDistributionWiener_fv_958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_959> AgradDistributionWiener_fv_959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_960> AgradDistributionWiener_fv_960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_961> AgradDistributionWiener_fv_961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_962> AgradDistributionWiener_fv_962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_963> AgradDistributionWiener_fv_963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_964> AgradDistributionWiener_fv_964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_965> AgradDistributionWiener_fv_965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_966> AgradDistributionWiener_fv_966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_967> AgradDistributionWiener_fv_967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_968> AgradDistributionWiener_fv_968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_969> AgradDistributionWiener_fv_969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_970> AgradDistributionWiener_fv_970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_971> AgradDistributionWiener_fv_971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_972> AgradDistributionWiener_fv_972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_973> AgradDistributionWiener_fv_973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_974> AgradDistributionWiener_fv_974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_975> AgradDistributionWiener_fv_975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_976> AgradDistributionWiener_fv_976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_977> AgradDistributionWiener_fv_977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_978> AgradDistributionWiener_fv_978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_979> AgradDistributionWiener_fv_979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_980> AgradDistributionWiener_fv_980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_981> AgradDistributionWiener_fv_981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_982> AgradDistributionWiener_fv_982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_983> AgradDistributionWiener_fv_983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_984> AgradDistributionWiener_fv_984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_985> AgradDistributionWiener_fv_985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_986> AgradDistributionWiener_fv_986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_987> AgradDistributionWiener_fv_987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_988> AgradDistributionWiener_fv_988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_989> AgradDistributionWiener_fv_989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_990> AgradDistributionWiener_fv_990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_991> AgradDistributionWiener_fv_991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_992> AgradDistributionWiener_fv_992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_993> AgradDistributionWiener_fv_993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_994> AgradDistributionWiener_fv_994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_995> AgradDistributionWiener_fv_995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_996> AgradDistributionWiener_fv_996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_997> AgradDistributionWiener_fv_997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_998> AgradDistributionWiener_fv_998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_999> AgradDistributionWiener_fv_999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_900, AgradDistributionTestFixture, AgradDistributionWiener_fv_900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_901, AgradDistributionTestFixture, AgradDistributionWiener_fv_901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_902, AgradDistributionTestFixture, AgradDistributionWiener_fv_902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_903, AgradDistributionTestFixture, AgradDistributionWiener_fv_903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_904, AgradDistributionTestFixture, AgradDistributionWiener_fv_904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_905, AgradDistributionTestFixture, AgradDistributionWiener_fv_905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_906, AgradDistributionTestFixture, AgradDistributionWiener_fv_906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_907, AgradDistributionTestFixture, AgradDistributionWiener_fv_907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_908, AgradDistributionTestFixture, AgradDistributionWiener_fv_908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_909, AgradDistributionTestFixture, AgradDistributionWiener_fv_909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_910, AgradDistributionTestFixture, AgradDistributionWiener_fv_910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_911, AgradDistributionTestFixture, AgradDistributionWiener_fv_911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_912, AgradDistributionTestFixture, AgradDistributionWiener_fv_912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_913, AgradDistributionTestFixture, AgradDistributionWiener_fv_913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_914, AgradDistributionTestFixture, AgradDistributionWiener_fv_914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_915, AgradDistributionTestFixture, AgradDistributionWiener_fv_915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_916, AgradDistributionTestFixture, AgradDistributionWiener_fv_916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_917, AgradDistributionTestFixture, AgradDistributionWiener_fv_917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_918, AgradDistributionTestFixture, AgradDistributionWiener_fv_918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_919, AgradDistributionTestFixture, AgradDistributionWiener_fv_919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_920, AgradDistributionTestFixture, AgradDistributionWiener_fv_920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_921, AgradDistributionTestFixture, AgradDistributionWiener_fv_921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_922, AgradDistributionTestFixture, AgradDistributionWiener_fv_922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_923, AgradDistributionTestFixture, AgradDistributionWiener_fv_923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_924, AgradDistributionTestFixture, AgradDistributionWiener_fv_924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_925, AgradDistributionTestFixture, AgradDistributionWiener_fv_925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_926, AgradDistributionTestFixture, AgradDistributionWiener_fv_926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_927, AgradDistributionTestFixture, AgradDistributionWiener_fv_927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_928, AgradDistributionTestFixture, AgradDistributionWiener_fv_928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_929, AgradDistributionTestFixture, AgradDistributionWiener_fv_929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_930, AgradDistributionTestFixture, AgradDistributionWiener_fv_930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_931, AgradDistributionTestFixture, AgradDistributionWiener_fv_931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_932, AgradDistributionTestFixture, AgradDistributionWiener_fv_932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_933, AgradDistributionTestFixture, AgradDistributionWiener_fv_933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_934, AgradDistributionTestFixture, AgradDistributionWiener_fv_934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_935, AgradDistributionTestFixture, AgradDistributionWiener_fv_935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_936, AgradDistributionTestFixture, AgradDistributionWiener_fv_936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_937, AgradDistributionTestFixture, AgradDistributionWiener_fv_937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_938, AgradDistributionTestFixture, AgradDistributionWiener_fv_938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_939, AgradDistributionTestFixture, AgradDistributionWiener_fv_939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_940, AgradDistributionTestFixture, AgradDistributionWiener_fv_940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_941, AgradDistributionTestFixture, AgradDistributionWiener_fv_941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_942, AgradDistributionTestFixture, AgradDistributionWiener_fv_942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_943, AgradDistributionTestFixture, AgradDistributionWiener_fv_943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_944, AgradDistributionTestFixture, AgradDistributionWiener_fv_944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_945, AgradDistributionTestFixture, AgradDistributionWiener_fv_945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_946, AgradDistributionTestFixture, AgradDistributionWiener_fv_946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_947, AgradDistributionTestFixture, AgradDistributionWiener_fv_947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_948, AgradDistributionTestFixture, AgradDistributionWiener_fv_948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_949, AgradDistributionTestFixture, AgradDistributionWiener_fv_949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_950, AgradDistributionTestFixture, AgradDistributionWiener_fv_950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_951, AgradDistributionTestFixture, AgradDistributionWiener_fv_951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_952, AgradDistributionTestFixture, AgradDistributionWiener_fv_952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_953, AgradDistributionTestFixture, AgradDistributionWiener_fv_953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_954, AgradDistributionTestFixture, AgradDistributionWiener_fv_954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_955, AgradDistributionTestFixture, AgradDistributionWiener_fv_955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_956, AgradDistributionTestFixture, AgradDistributionWiener_fv_956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_957, AgradDistributionTestFixture, AgradDistributionWiener_fv_957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_958, AgradDistributionTestFixture, AgradDistributionWiener_fv_958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_959, AgradDistributionTestFixture, AgradDistributionWiener_fv_959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_960, AgradDistributionTestFixture, AgradDistributionWiener_fv_960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_961, AgradDistributionTestFixture, AgradDistributionWiener_fv_961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_962, AgradDistributionTestFixture, AgradDistributionWiener_fv_962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_963, AgradDistributionTestFixture, AgradDistributionWiener_fv_963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_964, AgradDistributionTestFixture, AgradDistributionWiener_fv_964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_965, AgradDistributionTestFixture, AgradDistributionWiener_fv_965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_966, AgradDistributionTestFixture, AgradDistributionWiener_fv_966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_967, AgradDistributionTestFixture, AgradDistributionWiener_fv_967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_968, AgradDistributionTestFixture, AgradDistributionWiener_fv_968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_969, AgradDistributionTestFixture, AgradDistributionWiener_fv_969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_970, AgradDistributionTestFixture, AgradDistributionWiener_fv_970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_971, AgradDistributionTestFixture, AgradDistributionWiener_fv_971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_972, AgradDistributionTestFixture, AgradDistributionWiener_fv_972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_973, AgradDistributionTestFixture, AgradDistributionWiener_fv_973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_974, AgradDistributionTestFixture, AgradDistributionWiener_fv_974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_975, AgradDistributionTestFixture, AgradDistributionWiener_fv_975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_976, AgradDistributionTestFixture, AgradDistributionWiener_fv_976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_977, AgradDistributionTestFixture, AgradDistributionWiener_fv_977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_978, AgradDistributionTestFixture, AgradDistributionWiener_fv_978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_979, AgradDistributionTestFixture, AgradDistributionWiener_fv_979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_980, AgradDistributionTestFixture, AgradDistributionWiener_fv_980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_981, AgradDistributionTestFixture, AgradDistributionWiener_fv_981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_982, AgradDistributionTestFixture, AgradDistributionWiener_fv_982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_983, AgradDistributionTestFixture, AgradDistributionWiener_fv_983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_984, AgradDistributionTestFixture, AgradDistributionWiener_fv_984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_985, AgradDistributionTestFixture, AgradDistributionWiener_fv_985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_986, AgradDistributionTestFixture, AgradDistributionWiener_fv_986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_987, AgradDistributionTestFixture, AgradDistributionWiener_fv_987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_988, AgradDistributionTestFixture, AgradDistributionWiener_fv_988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_989, AgradDistributionTestFixture, AgradDistributionWiener_fv_989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_990, AgradDistributionTestFixture, AgradDistributionWiener_fv_990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_991, AgradDistributionTestFixture, AgradDistributionWiener_fv_991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_992, AgradDistributionTestFixture, AgradDistributionWiener_fv_992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_993, AgradDistributionTestFixture, AgradDistributionWiener_fv_993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_994, AgradDistributionTestFixture, AgradDistributionWiener_fv_994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_995, AgradDistributionTestFixture, AgradDistributionWiener_fv_995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_996, AgradDistributionTestFixture, AgradDistributionWiener_fv_996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_997, AgradDistributionTestFixture, AgradDistributionWiener_fv_997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_998, AgradDistributionTestFixture, AgradDistributionWiener_fv_998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_999, AgradDistributionTestFixture, AgradDistributionWiener_fv_999);
+
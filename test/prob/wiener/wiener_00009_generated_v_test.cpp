@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, double, double, empty> type_v_900;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, double, std::vector<double>, empty> type_v_901;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_902;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, double, var, empty> type_v_903;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, double, std::vector<var>, empty> type_v_904;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_905;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<double>, double, empty> type_v_906;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_907;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_908;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<double>, var, empty> type_v_909;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_910;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_911;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_912;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_913;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_914;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_915;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_916;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_917;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, var, double, empty> type_v_918;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, var, std::vector<double>, empty> type_v_919;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_920;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, var, var, empty> type_v_921;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, var, std::vector<var>, empty> type_v_922;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_923;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<var>, double, empty> type_v_924;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_925;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_926;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<var>, var, empty> type_v_927;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_928;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_929;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_930;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_931;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_932;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_933;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_934;
+typedef boost::mpl::vector<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_935;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_936;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_937;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_938;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_939;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_940;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_941;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_942;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_943;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_944;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_945;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_946;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_947;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_948;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_949;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_950;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_951;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_952;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_953;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_954;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_955;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_956;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_957;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_958;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_959;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_960;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_961;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_962;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_963;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_964;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_965;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_966;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_967;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_968;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_969;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_970;
+typedef boost::mpl::vector<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_971;
+typedef boost::mpl::vector<double, std::vector<var>, var, double, double, empty> type_v_972;
+typedef boost::mpl::vector<double, std::vector<var>, var, double, std::vector<double>, empty> type_v_973;
+typedef boost::mpl::vector<double, std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_974;
+typedef boost::mpl::vector<double, std::vector<var>, var, double, var, empty> type_v_975;
+typedef boost::mpl::vector<double, std::vector<var>, var, double, std::vector<var>, empty> type_v_976;
+typedef boost::mpl::vector<double, std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_977;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<double>, double, empty> type_v_978;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<double>, std::vector<double>, empty> type_v_979;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_980;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<double>, var, empty> type_v_981;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<double>, std::vector<var>, empty> type_v_982;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_983;
+typedef boost::mpl::vector<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_984;
+typedef boost::mpl::vector<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_985;
+typedef boost::mpl::vector<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_986;
+typedef boost::mpl::vector<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_987;
+typedef boost::mpl::vector<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_988;
+typedef boost::mpl::vector<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_989;
+typedef boost::mpl::vector<double, std::vector<var>, var, var, double, empty> type_v_990;
+typedef boost::mpl::vector<double, std::vector<var>, var, var, std::vector<double>, empty> type_v_991;
+typedef boost::mpl::vector<double, std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_992;
+typedef boost::mpl::vector<double, std::vector<var>, var, var, var, empty> type_v_993;
+typedef boost::mpl::vector<double, std::vector<var>, var, var, std::vector<var>, empty> type_v_994;
+typedef boost::mpl::vector<double, std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_995;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<var>, double, empty> type_v_996;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<var>, std::vector<double>, empty> type_v_997;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_998;
+typedef boost::mpl::vector<double, std::vector<var>, var, std::vector<var>, var, empty> type_v_999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_900> AgradDistributionWiener_v_900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_901> AgradDistributionWiener_v_901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_902> AgradDistributionWiener_v_902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_903> AgradDistributionWiener_v_903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_904> AgradDistributionWiener_v_904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_905> AgradDistributionWiener_v_905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_906> AgradDistributionWiener_v_906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_907> AgradDistributionWiener_v_907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_908> AgradDistributionWiener_v_908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_909> AgradDistributionWiener_v_909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_910> AgradDistributionWiener_v_910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_911> AgradDistributionWiener_v_911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_912> AgradDistributionWiener_v_912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_913> AgradDistributionWiener_v_913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_914> AgradDistributionWiener_v_914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_915> AgradDistributionWiener_v_915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_916> AgradDistributionWiener_v_916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_917> AgradDistributionWiener_v_917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_918> AgradDistributionWiener_v_918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_919> AgradDistributionWiener_v_919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_920> AgradDistributionWiener_v_920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_921> AgradDistributionWiener_v_921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_922> AgradDistributionWiener_v_922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_923> AgradDistributionWiener_v_923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_924> AgradDistributionWiener_v_924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_925> AgradDistributionWiener_v_925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_926> AgradDistributionWiener_v_926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_927> AgradDistributionWiener_v_927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_928> AgradDistributionWiener_v_928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_929> AgradDistributionWiener_v_929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_930> AgradDistributionWiener_v_930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_931> AgradDistributionWiener_v_931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_932> AgradDistributionWiener_v_932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_933> AgradDistributionWiener_v_933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_934> AgradDistributionWiener_v_934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_935> AgradDistributionWiener_v_935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_936> AgradDistributionWiener_v_936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_937> AgradDistributionWiener_v_937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_938> AgradDistributionWiener_v_938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_939> AgradDistributionWiener_v_939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_940> AgradDistributionWiener_v_940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_941> AgradDistributionWiener_v_941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_942> AgradDistributionWiener_v_942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_943> AgradDistributionWiener_v_943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_944> AgradDistributionWiener_v_944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_945> AgradDistributionWiener_v_945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_946> AgradDistributionWiener_v_946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_947> AgradDistributionWiener_v_947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_948> AgradDistributionWiener_v_948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_949> AgradDistributionWiener_v_949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_950> AgradDistributionWiener_v_950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_951> AgradDistributionWiener_v_951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_952> AgradDistributionWiener_v_952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_953> AgradDistributionWiener_v_953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_954> AgradDistributionWiener_v_954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_955> AgradDistributionWiener_v_955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_956> AgradDistributionWiener_v_956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_957> AgradDistributionWiener_v_957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_958> AgradDistributionWiener_v_958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_959> AgradDistributionWiener_v_959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_960> AgradDistributionWiener_v_960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_961> AgradDistributionWiener_v_961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_962> AgradDistributionWiener_v_962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_963> AgradDistributionWiener_v_963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_964> AgradDistributionWiener_v_964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_965> AgradDistributionWiener_v_965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_966> AgradDistributionWiener_v_966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_967> AgradDistributionWiener_v_967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_968> AgradDistributionWiener_v_968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_969> AgradDistributionWiener_v_969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_970> AgradDistributionWiener_v_970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_971> AgradDistributionWiener_v_971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_972> AgradDistributionWiener_v_972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_973> AgradDistributionWiener_v_973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_974> AgradDistributionWiener_v_974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_975> AgradDistributionWiener_v_975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_976> AgradDistributionWiener_v_976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_977> AgradDistributionWiener_v_977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_978> AgradDistributionWiener_v_978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_979> AgradDistributionWiener_v_979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_980> AgradDistributionWiener_v_980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_981> AgradDistributionWiener_v_981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_982> AgradDistributionWiener_v_982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_983> AgradDistributionWiener_v_983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_984> AgradDistributionWiener_v_984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_985> AgradDistributionWiener_v_985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_986> AgradDistributionWiener_v_986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_987> AgradDistributionWiener_v_987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_988> AgradDistributionWiener_v_988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_989> AgradDistributionWiener_v_989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_990> AgradDistributionWiener_v_990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_991> AgradDistributionWiener_v_991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_992> AgradDistributionWiener_v_992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_993> AgradDistributionWiener_v_993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_994> AgradDistributionWiener_v_994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_995> AgradDistributionWiener_v_995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_996> AgradDistributionWiener_v_996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_997> AgradDistributionWiener_v_997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_998> AgradDistributionWiener_v_998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_999> AgradDistributionWiener_v_999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_900, AgradDistributionTestFixture, AgradDistributionWiener_v_900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_901, AgradDistributionTestFixture, AgradDistributionWiener_v_901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_902, AgradDistributionTestFixture, AgradDistributionWiener_v_902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_903, AgradDistributionTestFixture, AgradDistributionWiener_v_903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_904, AgradDistributionTestFixture, AgradDistributionWiener_v_904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_905, AgradDistributionTestFixture, AgradDistributionWiener_v_905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_906, AgradDistributionTestFixture, AgradDistributionWiener_v_906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_907, AgradDistributionTestFixture, AgradDistributionWiener_v_907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_908, AgradDistributionTestFixture, AgradDistributionWiener_v_908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_909, AgradDistributionTestFixture, AgradDistributionWiener_v_909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_910, AgradDistributionTestFixture, AgradDistributionWiener_v_910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_911, AgradDistributionTestFixture, AgradDistributionWiener_v_911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_912, AgradDistributionTestFixture, AgradDistributionWiener_v_912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_913, AgradDistributionTestFixture, AgradDistributionWiener_v_913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_914, AgradDistributionTestFixture, AgradDistributionWiener_v_914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_915, AgradDistributionTestFixture, AgradDistributionWiener_v_915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_916, AgradDistributionTestFixture, AgradDistributionWiener_v_916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_917, AgradDistributionTestFixture, AgradDistributionWiener_v_917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_918, AgradDistributionTestFixture, AgradDistributionWiener_v_918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_919, AgradDistributionTestFixture, AgradDistributionWiener_v_919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_920, AgradDistributionTestFixture, AgradDistributionWiener_v_920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_921, AgradDistributionTestFixture, AgradDistributionWiener_v_921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_922, AgradDistributionTestFixture, AgradDistributionWiener_v_922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_923, AgradDistributionTestFixture, AgradDistributionWiener_v_923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_924, AgradDistributionTestFixture, AgradDistributionWiener_v_924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_925, AgradDistributionTestFixture, AgradDistributionWiener_v_925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_926, AgradDistributionTestFixture, AgradDistributionWiener_v_926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_927, AgradDistributionTestFixture, AgradDistributionWiener_v_927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_928, AgradDistributionTestFixture, AgradDistributionWiener_v_928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_929, AgradDistributionTestFixture, AgradDistributionWiener_v_929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_930, AgradDistributionTestFixture, AgradDistributionWiener_v_930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_931, AgradDistributionTestFixture, AgradDistributionWiener_v_931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_932, AgradDistributionTestFixture, AgradDistributionWiener_v_932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_933, AgradDistributionTestFixture, AgradDistributionWiener_v_933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_934, AgradDistributionTestFixture, AgradDistributionWiener_v_934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_935, AgradDistributionTestFixture, AgradDistributionWiener_v_935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_936, AgradDistributionTestFixture, AgradDistributionWiener_v_936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_937, AgradDistributionTestFixture, AgradDistributionWiener_v_937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_938, AgradDistributionTestFixture, AgradDistributionWiener_v_938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_939, AgradDistributionTestFixture, AgradDistributionWiener_v_939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_940, AgradDistributionTestFixture, AgradDistributionWiener_v_940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_941, AgradDistributionTestFixture, AgradDistributionWiener_v_941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_942, AgradDistributionTestFixture, AgradDistributionWiener_v_942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_943, AgradDistributionTestFixture, AgradDistributionWiener_v_943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_944, AgradDistributionTestFixture, AgradDistributionWiener_v_944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_945, AgradDistributionTestFixture, AgradDistributionWiener_v_945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_946, AgradDistributionTestFixture, AgradDistributionWiener_v_946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_947, AgradDistributionTestFixture, AgradDistributionWiener_v_947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_948, AgradDistributionTestFixture, AgradDistributionWiener_v_948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_949, AgradDistributionTestFixture, AgradDistributionWiener_v_949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_950, AgradDistributionTestFixture, AgradDistributionWiener_v_950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_951, AgradDistributionTestFixture, AgradDistributionWiener_v_951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_952, AgradDistributionTestFixture, AgradDistributionWiener_v_952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_953, AgradDistributionTestFixture, AgradDistributionWiener_v_953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_954, AgradDistributionTestFixture, AgradDistributionWiener_v_954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_955, AgradDistributionTestFixture, AgradDistributionWiener_v_955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_956, AgradDistributionTestFixture, AgradDistributionWiener_v_956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_957, AgradDistributionTestFixture, AgradDistributionWiener_v_957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_958, AgradDistributionTestFixture, AgradDistributionWiener_v_958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_959, AgradDistributionTestFixture, AgradDistributionWiener_v_959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_960, AgradDistributionTestFixture, AgradDistributionWiener_v_960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_961, AgradDistributionTestFixture, AgradDistributionWiener_v_961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_962, AgradDistributionTestFixture, AgradDistributionWiener_v_962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_963, AgradDistributionTestFixture, AgradDistributionWiener_v_963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_964, AgradDistributionTestFixture, AgradDistributionWiener_v_964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_965, AgradDistributionTestFixture, AgradDistributionWiener_v_965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_966, AgradDistributionTestFixture, AgradDistributionWiener_v_966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_967, AgradDistributionTestFixture, AgradDistributionWiener_v_967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_968, AgradDistributionTestFixture, AgradDistributionWiener_v_968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_969, AgradDistributionTestFixture, AgradDistributionWiener_v_969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_970, AgradDistributionTestFixture, AgradDistributionWiener_v_970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_971, AgradDistributionTestFixture, AgradDistributionWiener_v_971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_972, AgradDistributionTestFixture, AgradDistributionWiener_v_972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_973, AgradDistributionTestFixture, AgradDistributionWiener_v_973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_974, AgradDistributionTestFixture, AgradDistributionWiener_v_974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_975, AgradDistributionTestFixture, AgradDistributionWiener_v_975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_976, AgradDistributionTestFixture, AgradDistributionWiener_v_976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_977, AgradDistributionTestFixture, AgradDistributionWiener_v_977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_978, AgradDistributionTestFixture, AgradDistributionWiener_v_978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_979, AgradDistributionTestFixture, AgradDistributionWiener_v_979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_980, AgradDistributionTestFixture, AgradDistributionWiener_v_980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_981, AgradDistributionTestFixture, AgradDistributionWiener_v_981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_982, AgradDistributionTestFixture, AgradDistributionWiener_v_982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_983, AgradDistributionTestFixture, AgradDistributionWiener_v_983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_984, AgradDistributionTestFixture, AgradDistributionWiener_v_984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_985, AgradDistributionTestFixture, AgradDistributionWiener_v_985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_986, AgradDistributionTestFixture, AgradDistributionWiener_v_986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_987, AgradDistributionTestFixture, AgradDistributionWiener_v_987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_988, AgradDistributionTestFixture, AgradDistributionWiener_v_988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_989, AgradDistributionTestFixture, AgradDistributionWiener_v_989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_990, AgradDistributionTestFixture, AgradDistributionWiener_v_990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_991, AgradDistributionTestFixture, AgradDistributionWiener_v_991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_992, AgradDistributionTestFixture, AgradDistributionWiener_v_992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_993, AgradDistributionTestFixture, AgradDistributionWiener_v_993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_994, AgradDistributionTestFixture, AgradDistributionWiener_v_994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_995, AgradDistributionTestFixture, AgradDistributionWiener_v_995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_996, AgradDistributionTestFixture, AgradDistributionWiener_v_996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_997, AgradDistributionTestFixture, AgradDistributionWiener_v_997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_998, AgradDistributionTestFixture, AgradDistributionWiener_v_998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_999, AgradDistributionTestFixture, AgradDistributionWiener_v_999);
+
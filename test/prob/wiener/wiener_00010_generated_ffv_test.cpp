@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_ffv_1000;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1001;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty> type_ffv_1002;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1003;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1004;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_ffv_1005;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_ffv_1006;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1007;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1008;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1009;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1010;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1011;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1012;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1013;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1014;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1015;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1016;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty> type_ffv_1017;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1018;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1019;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1020;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1021;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1022;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1023;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1024;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1025;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1026;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1027;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1028;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1029;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1030;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1031;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1032;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1033;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1034;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_ffv_1035;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_ffv_1036;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1037;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_1038;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1039;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1040;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_ffv_1041;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_1042;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1043;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1044;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1045;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1046;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1047;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1048;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1049;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1050;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1051;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1052;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_1053;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1054;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1055;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1056;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1057;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1058;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1059;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1060;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1061;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1062;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1063;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1064;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1065;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1066;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1067;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1068;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1069;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1070;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1071;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1072;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1073;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1074;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1075;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1076;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1077;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1078;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1079;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1080;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1081;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1082;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1083;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1084;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1085;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1086;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1087;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1088;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1089;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1090;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1091;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1092;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1093;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1094;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1095;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1096;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1097;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1098;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1000> AgradDistributionWiener_ffv_1000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1001> AgradDistributionWiener_ffv_1001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1002> AgradDistributionWiener_ffv_1002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1003> AgradDistributionWiener_ffv_1003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1004> AgradDistributionWiener_ffv_1004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1005> AgradDistributionWiener_ffv_1005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1006> AgradDistributionWiener_ffv_1006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1007> AgradDistributionWiener_ffv_1007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1008> AgradDistributionWiener_ffv_1008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1009> AgradDistributionWiener_ffv_1009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1010> AgradDistributionWiener_ffv_1010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1011> AgradDistributionWiener_ffv_1011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1012> AgradDistributionWiener_ffv_1012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1013> AgradDistributionWiener_ffv_1013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1014> AgradDistributionWiener_ffv_1014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1015> AgradDistributionWiener_ffv_1015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1016> AgradDistributionWiener_ffv_1016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1017> AgradDistributionWiener_ffv_1017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1018> AgradDistributionWiener_ffv_1018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1019> AgradDistributionWiener_ffv_1019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1020> AgradDistributionWiener_ffv_1020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1021> AgradDistributionWiener_ffv_1021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1022> AgradDistributionWiener_ffv_1022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1023> AgradDistributionWiener_ffv_1023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1024> AgradDistributionWiener_ffv_1024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1025> AgradDistributionWiener_ffv_1025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1026> AgradDistributionWiener_ffv_1026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1027> AgradDistributionWiener_ffv_1027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1028> AgradDistributionWiener_ffv_1028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1029> AgradDistributionWiener_ffv_1029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1030> AgradDistributionWiener_ffv_1030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1031> AgradDistributionWiener_ffv_1031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1032> AgradDistributionWiener_ffv_1032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1033> AgradDistributionWiener_ffv_1033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1034> AgradDistributionWiener_ffv_1034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1035> AgradDistributionWiener_ffv_1035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1036> AgradDistributionWiener_ffv_1036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1037> AgradDistributionWiener_ffv_1037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1038> AgradDistributionWiener_ffv_1038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1039> AgradDistributionWiener_ffv_1039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1040> AgradDistributionWiener_ffv_1040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1041> AgradDistributionWiener_ffv_1041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1042> AgradDistributionWiener_ffv_1042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1043> AgradDistributionWiener_ffv_1043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1044> AgradDistributionWiener_ffv_1044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1045> AgradDistributionWiener_ffv_1045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1046> AgradDistributionWiener_ffv_1046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1047> AgradDistributionWiener_ffv_1047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1048> AgradDistributionWiener_ffv_1048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1049> AgradDistributionWiener_ffv_1049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1050> AgradDistributionWiener_ffv_1050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1051> AgradDistributionWiener_ffv_1051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1052> AgradDistributionWiener_ffv_1052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1053> AgradDistributionWiener_ffv_1053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1054> AgradDistributionWiener_ffv_1054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1055> AgradDistributionWiener_ffv_1055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1056> AgradDistributionWiener_ffv_1056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1057> AgradDistributionWiener_ffv_1057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1058> AgradDistributionWiener_ffv_1058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1059> AgradDistributionWiener_ffv_1059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1060> AgradDistributionWiener_ffv_1060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1061> AgradDistributionWiener_ffv_1061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1062> AgradDistributionWiener_ffv_1062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1063> AgradDistributionWiener_ffv_1063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1064> AgradDistributionWiener_ffv_1064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1065> AgradDistributionWiener_ffv_1065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1066> AgradDistributionWiener_ffv_1066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1067> AgradDistributionWiener_ffv_1067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1068> AgradDistributionWiener_ffv_1068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1069> AgradDistributionWiener_ffv_1069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1070> AgradDistributionWiener_ffv_1070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1071> AgradDistributionWiener_ffv_1071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1072> AgradDistributionWiener_ffv_1072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1073> AgradDistributionWiener_ffv_1073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1074> AgradDistributionWiener_ffv_1074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1075> AgradDistributionWiener_ffv_1075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1076> AgradDistributionWiener_ffv_1076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1077> AgradDistributionWiener_ffv_1077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1078> AgradDistributionWiener_ffv_1078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1079> AgradDistributionWiener_ffv_1079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1080> AgradDistributionWiener_ffv_1080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1081> AgradDistributionWiener_ffv_1081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1082> AgradDistributionWiener_ffv_1082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1083> AgradDistributionWiener_ffv_1083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1084> AgradDistributionWiener_ffv_1084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1085> AgradDistributionWiener_ffv_1085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1086> AgradDistributionWiener_ffv_1086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1087> AgradDistributionWiener_ffv_1087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1088> AgradDistributionWiener_ffv_1088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1089> AgradDistributionWiener_ffv_1089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1090> AgradDistributionWiener_ffv_1090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1091> AgradDistributionWiener_ffv_1091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1092> AgradDistributionWiener_ffv_1092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1093> AgradDistributionWiener_ffv_1093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1094> AgradDistributionWiener_ffv_1094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1095> AgradDistributionWiener_ffv_1095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1096> AgradDistributionWiener_ffv_1096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1097> AgradDistributionWiener_ffv_1097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1098> AgradDistributionWiener_ffv_1098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1099> AgradDistributionWiener_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1000, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1001, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1002, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1003, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1004, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1005, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1006, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1007, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1008, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1009, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1010, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1011, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1012, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1013, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1014, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1015, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1016, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1017, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1018, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1019, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1020, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1021, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1022, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1023, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1024, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1025, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1026, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1027, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1028, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1029, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1030, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1031, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1032, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1033, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1034, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1035, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1036, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1037, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1038, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1039, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1040, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1041, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1042, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1043, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1044, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1045, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1046, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1047, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1048, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1049, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1050, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1051, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1052, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1053, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1054, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1055, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1056, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1057, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1058, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1059, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1060, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1061, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1062, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1063, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1064, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1065, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1066, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1067, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1068, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1069, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1070, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1071, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1072, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1073, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1074, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1075, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1076, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1077, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1078, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1079, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1080, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1081, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1082, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1083, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1084, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1085, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1086, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1087, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1088, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1089, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1090, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1091, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1092, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1093, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1094, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1095, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1096, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1097, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1098, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1099, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1100;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1101;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1102;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1103;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1104;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1105;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1106;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, double, empty> type_ffd_1107;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_1108;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1109;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_1110;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1111;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1112;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_1113;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_1114;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1115;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1116;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1117;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1118;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1119;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1120;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1121;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1122;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1123;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1124;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_1125;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1126;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1127;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1128;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1129;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1130;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1131;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1132;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1133;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1134;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1135;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1136;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1137;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1138;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1139;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1140;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1141;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1142;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_1143;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_1144;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1145;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_1146;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1147;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1148;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_1149;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_1150;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1151;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1152;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1153;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1154;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1155;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1156;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1157;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1158;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1159;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1160;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_1161;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1162;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1163;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1164;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1165;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1166;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1167;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1168;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1169;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1170;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1171;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1172;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1173;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1174;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1175;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1176;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1177;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1178;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_1179;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_1180;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1181;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_1182;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1183;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1184;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_1185;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_1186;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1187;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1188;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1189;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1190;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1191;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1192;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1193;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1194;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1195;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1196;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_1197;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1198;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1100> AgradDistributionWiener_ffd_1100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1101> AgradDistributionWiener_ffd_1101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1102> AgradDistributionWiener_ffd_1102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1103> AgradDistributionWiener_ffd_1103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1104> AgradDistributionWiener_ffd_1104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1105> AgradDistributionWiener_ffd_1105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1106> AgradDistributionWiener_ffd_1106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1107> AgradDistributionWiener_ffd_1107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1108> AgradDistributionWiener_ffd_1108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1109> AgradDistributionWiener_ffd_1109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1110> AgradDistributionWiener_ffd_1110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1111> AgradDistributionWiener_ffd_1111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1112> AgradDistributionWiener_ffd_1112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1113> AgradDistributionWiener_ffd_1113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1114> AgradDistributionWiener_ffd_1114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1115> AgradDistributionWiener_ffd_1115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1116> AgradDistributionWiener_ffd_1116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1117> AgradDistributionWiener_ffd_1117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1118> AgradDistributionWiener_ffd_1118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1119> AgradDistributionWiener_ffd_1119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1120> AgradDistributionWiener_ffd_1120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1121> AgradDistributionWiener_ffd_1121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1122> AgradDistributionWiener_ffd_1122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1123> AgradDistributionWiener_ffd_1123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1124> AgradDistributionWiener_ffd_1124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1125> AgradDistributionWiener_ffd_1125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1126> AgradDistributionWiener_ffd_1126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1127> AgradDistributionWiener_ffd_1127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1128> AgradDistributionWiener_ffd_1128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1129> AgradDistributionWiener_ffd_1129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1130> AgradDistributionWiener_ffd_1130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1131> AgradDistributionWiener_ffd_1131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1132> AgradDistributionWiener_ffd_1132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1133> AgradDistributionWiener_ffd_1133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1134> AgradDistributionWiener_ffd_1134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1135> AgradDistributionWiener_ffd_1135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1136> AgradDistributionWiener_ffd_1136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1137> AgradDistributionWiener_ffd_1137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1138> AgradDistributionWiener_ffd_1138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1139> AgradDistributionWiener_ffd_1139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1140> AgradDistributionWiener_ffd_1140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1141> AgradDistributionWiener_ffd_1141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1142> AgradDistributionWiener_ffd_1142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1143> AgradDistributionWiener_ffd_1143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1144> AgradDistributionWiener_ffd_1144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1145> AgradDistributionWiener_ffd_1145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1146> AgradDistributionWiener_ffd_1146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1147> AgradDistributionWiener_ffd_1147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1148> AgradDistributionWiener_ffd_1148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1149> AgradDistributionWiener_ffd_1149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1150> AgradDistributionWiener_ffd_1150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1151> AgradDistributionWiener_ffd_1151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1152> AgradDistributionWiener_ffd_1152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1153> AgradDistributionWiener_ffd_1153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1154> AgradDistributionWiener_ffd_1154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1155> AgradDistributionWiener_ffd_1155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1156> AgradDistributionWiener_ffd_1156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1157> AgradDistributionWiener_ffd_1157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1158> AgradDistributionWiener_ffd_1158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1159> AgradDistributionWiener_ffd_1159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1160> AgradDistributionWiener_ffd_1160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1161> AgradDistributionWiener_ffd_1161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1162> AgradDistributionWiener_ffd_1162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1163> AgradDistributionWiener_ffd_1163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1164> AgradDistributionWiener_ffd_1164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1165> AgradDistributionWiener_ffd_1165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1166> AgradDistributionWiener_ffd_1166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1167> AgradDistributionWiener_ffd_1167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1168> AgradDistributionWiener_ffd_1168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1169> AgradDistributionWiener_ffd_1169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1170> AgradDistributionWiener_ffd_1170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1171> AgradDistributionWiener_ffd_1171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1172> AgradDistributionWiener_ffd_1172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1173> AgradDistributionWiener_ffd_1173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1174> AgradDistributionWiener_ffd_1174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1175> AgradDistributionWiener_ffd_1175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1176> AgradDistributionWiener_ffd_1176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1177> AgradDistributionWiener_ffd_1177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1178> AgradDistributionWiener_ffd_1178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1179> AgradDistributionWiener_ffd_1179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1180> AgradDistributionWiener_ffd_1180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1181> AgradDistributionWiener_ffd_1181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1182> AgradDistributionWiener_ffd_1182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1183> AgradDistributionWiener_ffd_1183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1184> AgradDistributionWiener_ffd_1184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1185> AgradDistributionWiener_ffd_1185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1186> AgradDistributionWiener_ffd_1186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1187> AgradDistributionWiener_ffd_1187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1188> AgradDistributionWiener_ffd_1188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1189> AgradDistributionWiener_ffd_1189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1190> AgradDistributionWiener_ffd_1190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1191> AgradDistributionWiener_ffd_1191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1192> AgradDistributionWiener_ffd_1192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1193> AgradDistributionWiener_ffd_1193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1194> AgradDistributionWiener_ffd_1194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1195> AgradDistributionWiener_ffd_1195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1196> AgradDistributionWiener_ffd_1196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1197> AgradDistributionWiener_ffd_1197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1198> AgradDistributionWiener_ffd_1198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1199> AgradDistributionWiener_ffd_1199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1100, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1101, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1102, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1103, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1104, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1105, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1106, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1107, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1108, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1109, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1110, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1111, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1112, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1113, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1114, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1115, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1116, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1117, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1118, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1119, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1120, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1121, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1122, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1123, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1124, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1125, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1126, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1127, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1128, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1129, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1130, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1131, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1132, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1133, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1134, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1135, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1136, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1137, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1138, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1139, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1140, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1141, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1142, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1143, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1144, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1145, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1146, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1147, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1148, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1149, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1150, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1151, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1152, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1153, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1154, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1155, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1156, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1157, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1158, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1159, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1160, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1161, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1162, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1163, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1164, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1165, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1166, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1167, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1168, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1169, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1170, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1171, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1172, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1173, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1174, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1175, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1176, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1177, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1178, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1179, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1180, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1181, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1182, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1183, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1184, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1185, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1186, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1187, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1188, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1189, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1190, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1191, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1192, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1193, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1194, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1195, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1196, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1197, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1198, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1199, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1100;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1101;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1102;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1103;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1104;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1105;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1106;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, empty> type_fv_1107;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, empty> type_fv_1108;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1109;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, empty> type_fv_1110;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_1111;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1112;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, empty> type_fv_1113;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_1114;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1115;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_1116;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1117;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1118;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1119;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1120;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1121;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1122;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1123;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1124;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, empty> type_fv_1125;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_1126;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1127;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_1128;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1129;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1130;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_1131;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1132;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1133;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1134;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1135;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1136;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1137;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1138;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1139;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1140;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1141;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1142;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, empty> type_fv_1143;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_1144;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1145;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_1146;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_1147;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1148;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_1149;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_1150;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1151;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_1152;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1153;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1154;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1155;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1156;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1157;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1158;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1159;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1160;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_1161;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_1162;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1163;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_1164;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1165;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1166;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_1167;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1168;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1169;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1170;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1171;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1172;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1173;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1174;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1175;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1176;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1177;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1178;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_1179;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_1180;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1181;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_1182;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_1183;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1184;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_1185;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_1186;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1187;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_1188;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1189;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1190;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1191;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1192;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1193;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1194;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1195;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1196;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_1197;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_1198;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1100> AgradDistributionWiener_fv_1100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1101> AgradDistributionWiener_fv_1101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1102> AgradDistributionWiener_fv_1102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1103> AgradDistributionWiener_fv_1103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1104> AgradDistributionWiener_fv_1104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1105> AgradDistributionWiener_fv_1105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1106> AgradDistributionWiener_fv_1106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1107> AgradDistributionWiener_fv_1107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1108> AgradDistributionWiener_fv_1108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1109> AgradDistributionWiener_fv_1109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1110> AgradDistributionWiener_fv_1110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1111> AgradDistributionWiener_fv_1111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1112> AgradDistributionWiener_fv_1112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1113> AgradDistributionWiener_fv_1113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1114> AgradDistributionWiener_fv_1114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1115> AgradDistributionWiener_fv_1115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1116> AgradDistributionWiener_fv_1116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1117> AgradDistributionWiener_fv_1117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1118> AgradDistributionWiener_fv_1118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1119> AgradDistributionWiener_fv_1119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1120> AgradDistributionWiener_fv_1120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1121> AgradDistributionWiener_fv_1121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1122> AgradDistributionWiener_fv_1122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1123> AgradDistributionWiener_fv_1123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1124> AgradDistributionWiener_fv_1124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1125> AgradDistributionWiener_fv_1125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1126> AgradDistributionWiener_fv_1126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1127> AgradDistributionWiener_fv_1127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1128> AgradDistributionWiener_fv_1128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1129> AgradDistributionWiener_fv_1129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1130> AgradDistributionWiener_fv_1130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1131> AgradDistributionWiener_fv_1131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1132> AgradDistributionWiener_fv_1132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1133> AgradDistributionWiener_fv_1133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1134> AgradDistributionWiener_fv_1134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1135> AgradDistributionWiener_fv_1135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1136> AgradDistributionWiener_fv_1136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1137> AgradDistributionWiener_fv_1137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1138> AgradDistributionWiener_fv_1138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1139> AgradDistributionWiener_fv_1139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1140> AgradDistributionWiener_fv_1140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1141> AgradDistributionWiener_fv_1141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1142> AgradDistributionWiener_fv_1142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1143> AgradDistributionWiener_fv_1143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1144> AgradDistributionWiener_fv_1144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1145> AgradDistributionWiener_fv_1145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1146> AgradDistributionWiener_fv_1146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1147> AgradDistributionWiener_fv_1147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1148> AgradDistributionWiener_fv_1148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1149> AgradDistributionWiener_fv_1149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1150> AgradDistributionWiener_fv_1150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1151> AgradDistributionWiener_fv_1151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1152> AgradDistributionWiener_fv_1152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1153> AgradDistributionWiener_fv_1153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1154> AgradDistributionWiener_fv_1154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1155> AgradDistributionWiener_fv_1155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1156> AgradDistributionWiener_fv_1156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1157> AgradDistributionWiener_fv_1157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1158> AgradDistributionWiener_fv_1158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1159> AgradDistributionWiener_fv_1159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1160> AgradDistributionWiener_fv_1160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1161> AgradDistributionWiener_fv_1161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1162> AgradDistributionWiener_fv_1162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1163> AgradDistributionWiener_fv_1163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1164> AgradDistributionWiener_fv_1164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1165> AgradDistributionWiener_fv_1165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1166> AgradDistributionWiener_fv_1166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1167> AgradDistributionWiener_fv_1167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1168> AgradDistributionWiener_fv_1168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1169> AgradDistributionWiener_fv_1169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1170> AgradDistributionWiener_fv_1170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1171> AgradDistributionWiener_fv_1171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1172> AgradDistributionWiener_fv_1172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1173> AgradDistributionWiener_fv_1173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1174> AgradDistributionWiener_fv_1174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1175> AgradDistributionWiener_fv_1175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1176> AgradDistributionWiener_fv_1176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1177> AgradDistributionWiener_fv_1177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1178> AgradDistributionWiener_fv_1178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1179> AgradDistributionWiener_fv_1179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1180> AgradDistributionWiener_fv_1180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1181> AgradDistributionWiener_fv_1181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1182> AgradDistributionWiener_fv_1182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1183> AgradDistributionWiener_fv_1183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1184> AgradDistributionWiener_fv_1184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1185> AgradDistributionWiener_fv_1185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1186> AgradDistributionWiener_fv_1186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1187> AgradDistributionWiener_fv_1187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1188> AgradDistributionWiener_fv_1188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1189> AgradDistributionWiener_fv_1189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1190> AgradDistributionWiener_fv_1190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1191> AgradDistributionWiener_fv_1191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1192> AgradDistributionWiener_fv_1192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1193> AgradDistributionWiener_fv_1193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1194> AgradDistributionWiener_fv_1194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1195> AgradDistributionWiener_fv_1195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1196> AgradDistributionWiener_fv_1196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1197> AgradDistributionWiener_fv_1197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1198> AgradDistributionWiener_fv_1198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1199> AgradDistributionWiener_fv_1199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1100, AgradDistributionTestFixture, AgradDistributionWiener_fv_1100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1101, AgradDistributionTestFixture, AgradDistributionWiener_fv_1101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1102, AgradDistributionTestFixture, AgradDistributionWiener_fv_1102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1103, AgradDistributionTestFixture, AgradDistributionWiener_fv_1103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1104, AgradDistributionTestFixture, AgradDistributionWiener_fv_1104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1105, AgradDistributionTestFixture, AgradDistributionWiener_fv_1105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1106, AgradDistributionTestFixture, AgradDistributionWiener_fv_1106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1107, AgradDistributionTestFixture, AgradDistributionWiener_fv_1107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1108, AgradDistributionTestFixture, AgradDistributionWiener_fv_1108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1109, AgradDistributionTestFixture, AgradDistributionWiener_fv_1109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1110, AgradDistributionTestFixture, AgradDistributionWiener_fv_1110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1111, AgradDistributionTestFixture, AgradDistributionWiener_fv_1111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1112, AgradDistributionTestFixture, AgradDistributionWiener_fv_1112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1113, AgradDistributionTestFixture, AgradDistributionWiener_fv_1113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1114, AgradDistributionTestFixture, AgradDistributionWiener_fv_1114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1115, AgradDistributionTestFixture, AgradDistributionWiener_fv_1115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1116, AgradDistributionTestFixture, AgradDistributionWiener_fv_1116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1117, AgradDistributionTestFixture, AgradDistributionWiener_fv_1117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1118, AgradDistributionTestFixture, AgradDistributionWiener_fv_1118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1119, AgradDistributionTestFixture, AgradDistributionWiener_fv_1119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1120, AgradDistributionTestFixture, AgradDistributionWiener_fv_1120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1121, AgradDistributionTestFixture, AgradDistributionWiener_fv_1121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1122, AgradDistributionTestFixture, AgradDistributionWiener_fv_1122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1123, AgradDistributionTestFixture, AgradDistributionWiener_fv_1123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1124, AgradDistributionTestFixture, AgradDistributionWiener_fv_1124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1125, AgradDistributionTestFixture, AgradDistributionWiener_fv_1125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1126, AgradDistributionTestFixture, AgradDistributionWiener_fv_1126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1127, AgradDistributionTestFixture, AgradDistributionWiener_fv_1127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1128, AgradDistributionTestFixture, AgradDistributionWiener_fv_1128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1129, AgradDistributionTestFixture, AgradDistributionWiener_fv_1129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1130, AgradDistributionTestFixture, AgradDistributionWiener_fv_1130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1131, AgradDistributionTestFixture, AgradDistributionWiener_fv_1131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1132, AgradDistributionTestFixture, AgradDistributionWiener_fv_1132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1133, AgradDistributionTestFixture, AgradDistributionWiener_fv_1133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1134, AgradDistributionTestFixture, AgradDistributionWiener_fv_1134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1135, AgradDistributionTestFixture, AgradDistributionWiener_fv_1135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1136, AgradDistributionTestFixture, AgradDistributionWiener_fv_1136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1137, AgradDistributionTestFixture, AgradDistributionWiener_fv_1137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1138, AgradDistributionTestFixture, AgradDistributionWiener_fv_1138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1139, AgradDistributionTestFixture, AgradDistributionWiener_fv_1139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1140, AgradDistributionTestFixture, AgradDistributionWiener_fv_1140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1141, AgradDistributionTestFixture, AgradDistributionWiener_fv_1141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1142, AgradDistributionTestFixture, AgradDistributionWiener_fv_1142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1143, AgradDistributionTestFixture, AgradDistributionWiener_fv_1143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1144, AgradDistributionTestFixture, AgradDistributionWiener_fv_1144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1145, AgradDistributionTestFixture, AgradDistributionWiener_fv_1145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1146, AgradDistributionTestFixture, AgradDistributionWiener_fv_1146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1147, AgradDistributionTestFixture, AgradDistributionWiener_fv_1147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1148, AgradDistributionTestFixture, AgradDistributionWiener_fv_1148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1149, AgradDistributionTestFixture, AgradDistributionWiener_fv_1149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1150, AgradDistributionTestFixture, AgradDistributionWiener_fv_1150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1151, AgradDistributionTestFixture, AgradDistributionWiener_fv_1151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1152, AgradDistributionTestFixture, AgradDistributionWiener_fv_1152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1153, AgradDistributionTestFixture, AgradDistributionWiener_fv_1153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1154, AgradDistributionTestFixture, AgradDistributionWiener_fv_1154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1155, AgradDistributionTestFixture, AgradDistributionWiener_fv_1155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1156, AgradDistributionTestFixture, AgradDistributionWiener_fv_1156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1157, AgradDistributionTestFixture, AgradDistributionWiener_fv_1157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1158, AgradDistributionTestFixture, AgradDistributionWiener_fv_1158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1159, AgradDistributionTestFixture, AgradDistributionWiener_fv_1159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1160, AgradDistributionTestFixture, AgradDistributionWiener_fv_1160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1161, AgradDistributionTestFixture, AgradDistributionWiener_fv_1161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1162, AgradDistributionTestFixture, AgradDistributionWiener_fv_1162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1163, AgradDistributionTestFixture, AgradDistributionWiener_fv_1163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1164, AgradDistributionTestFixture, AgradDistributionWiener_fv_1164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1165, AgradDistributionTestFixture, AgradDistributionWiener_fv_1165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1166, AgradDistributionTestFixture, AgradDistributionWiener_fv_1166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1167, AgradDistributionTestFixture, AgradDistributionWiener_fv_1167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1168, AgradDistributionTestFixture, AgradDistributionWiener_fv_1168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1169, AgradDistributionTestFixture, AgradDistributionWiener_fv_1169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1170, AgradDistributionTestFixture, AgradDistributionWiener_fv_1170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1171, AgradDistributionTestFixture, AgradDistributionWiener_fv_1171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1172, AgradDistributionTestFixture, AgradDistributionWiener_fv_1172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1173, AgradDistributionTestFixture, AgradDistributionWiener_fv_1173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1174, AgradDistributionTestFixture, AgradDistributionWiener_fv_1174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1175, AgradDistributionTestFixture, AgradDistributionWiener_fv_1175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1176, AgradDistributionTestFixture, AgradDistributionWiener_fv_1176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1177, AgradDistributionTestFixture, AgradDistributionWiener_fv_1177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1178, AgradDistributionTestFixture, AgradDistributionWiener_fv_1178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1179, AgradDistributionTestFixture, AgradDistributionWiener_fv_1179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1180, AgradDistributionTestFixture, AgradDistributionWiener_fv_1180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1181, AgradDistributionTestFixture, AgradDistributionWiener_fv_1181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1182, AgradDistributionTestFixture, AgradDistributionWiener_fv_1182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1183, AgradDistributionTestFixture, AgradDistributionWiener_fv_1183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1184, AgradDistributionTestFixture, AgradDistributionWiener_fv_1184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1185, AgradDistributionTestFixture, AgradDistributionWiener_fv_1185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1186, AgradDistributionTestFixture, AgradDistributionWiener_fv_1186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1187, AgradDistributionTestFixture, AgradDistributionWiener_fv_1187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1188, AgradDistributionTestFixture, AgradDistributionWiener_fv_1188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1189, AgradDistributionTestFixture, AgradDistributionWiener_fv_1189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1190, AgradDistributionTestFixture, AgradDistributionWiener_fv_1190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1191, AgradDistributionTestFixture, AgradDistributionWiener_fv_1191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1192, AgradDistributionTestFixture, AgradDistributionWiener_fv_1192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1193, AgradDistributionTestFixture, AgradDistributionWiener_fv_1193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1194, AgradDistributionTestFixture, AgradDistributionWiener_fv_1194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1195, AgradDistributionTestFixture, AgradDistributionWiener_fv_1195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1196, AgradDistributionTestFixture, AgradDistributionWiener_fv_1196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1197, AgradDistributionTestFixture, AgradDistributionWiener_fv_1197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1198, AgradDistributionTestFixture, AgradDistributionWiener_fv_1198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1199, AgradDistributionTestFixture, AgradDistributionWiener_fv_1199);
+
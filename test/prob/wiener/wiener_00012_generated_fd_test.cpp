@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_1200;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_1201;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1202;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_1203;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_1204;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1205;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_1206;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_1207;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1208;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_1209;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_1210;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1211;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1212;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1213;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1214;
+typedef boost::mpl::vector<std::vector<double>, double, double, double, fvar<double>, empty> type_fd_1215;
+typedef boost::mpl::vector<std::vector<double>, double, double, double, std::vector<fvar<double>>, empty> type_fd_1216;
+typedef boost::mpl::vector<std::vector<double>, double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1217;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<double>, fvar<double>, empty> type_fd_1218;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_1219;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1220;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1221;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1222;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1223;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<double>, double, empty> type_fd_1224;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<double>, std::vector<double>, empty> type_fd_1225;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1226;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<double>, fvar<double>, empty> type_fd_1227;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_1228;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1229;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<double>>, double, empty> type_fd_1230;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_1231;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1232;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_1233;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_1234;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1235;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_1236;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_1237;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1238;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1239;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1240;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1241;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, double, fvar<double>, empty> type_fd_1242;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_1243;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1244;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_1245;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_1246;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1247;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1248;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1249;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1250;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<double>, double, empty> type_fd_1251;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_1252;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1253;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_1254;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_1255;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1256;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_1257;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_1258;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1259;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_1260;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_1261;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1262;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_1263;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_1264;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1265;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1266;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1267;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1268;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_1269;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_1270;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1271;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_1272;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_1273;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1274;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1275;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1276;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1277;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_1278;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_1279;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1280;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_1281;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_1282;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1283;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_1284;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_1285;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1286;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_1287;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_1288;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1289;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_1290;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_1291;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1292;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_1293;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_1294;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_1295;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<double>, double, double, empty> type_fd_1296;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<double>, double, std::vector<double>, empty> type_fd_1297;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_1298;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<double>, double, fvar<double>, empty> type_fd_1299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1200> AgradDistributionWiener_fd_1200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1201> AgradDistributionWiener_fd_1201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1202> AgradDistributionWiener_fd_1202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1203> AgradDistributionWiener_fd_1203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1204> AgradDistributionWiener_fd_1204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1205> AgradDistributionWiener_fd_1205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1206> AgradDistributionWiener_fd_1206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1207> AgradDistributionWiener_fd_1207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1208> AgradDistributionWiener_fd_1208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1209> AgradDistributionWiener_fd_1209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1210> AgradDistributionWiener_fd_1210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1211> AgradDistributionWiener_fd_1211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1212> AgradDistributionWiener_fd_1212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1213> AgradDistributionWiener_fd_1213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1214> AgradDistributionWiener_fd_1214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1215> AgradDistributionWiener_fd_1215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1216> AgradDistributionWiener_fd_1216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1217> AgradDistributionWiener_fd_1217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1218> AgradDistributionWiener_fd_1218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1219> AgradDistributionWiener_fd_1219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1220> AgradDistributionWiener_fd_1220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1221> AgradDistributionWiener_fd_1221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1222> AgradDistributionWiener_fd_1222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1223> AgradDistributionWiener_fd_1223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1224> AgradDistributionWiener_fd_1224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1225> AgradDistributionWiener_fd_1225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1226> AgradDistributionWiener_fd_1226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1227> AgradDistributionWiener_fd_1227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1228> AgradDistributionWiener_fd_1228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1229> AgradDistributionWiener_fd_1229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1230> AgradDistributionWiener_fd_1230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1231> AgradDistributionWiener_fd_1231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1232> AgradDistributionWiener_fd_1232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1233> AgradDistributionWiener_fd_1233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1234> AgradDistributionWiener_fd_1234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1235> AgradDistributionWiener_fd_1235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1236> AgradDistributionWiener_fd_1236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1237> AgradDistributionWiener_fd_1237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1238> AgradDistributionWiener_fd_1238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1239> AgradDistributionWiener_fd_1239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1240> AgradDistributionWiener_fd_1240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1241> AgradDistributionWiener_fd_1241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1242> AgradDistributionWiener_fd_1242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1243> AgradDistributionWiener_fd_1243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1244> AgradDistributionWiener_fd_1244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1245> AgradDistributionWiener_fd_1245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1246> AgradDistributionWiener_fd_1246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1247> AgradDistributionWiener_fd_1247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1248> AgradDistributionWiener_fd_1248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1249> AgradDistributionWiener_fd_1249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1250> AgradDistributionWiener_fd_1250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1251> AgradDistributionWiener_fd_1251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1252> AgradDistributionWiener_fd_1252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1253> AgradDistributionWiener_fd_1253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1254> AgradDistributionWiener_fd_1254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1255> AgradDistributionWiener_fd_1255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1256> AgradDistributionWiener_fd_1256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1257> AgradDistributionWiener_fd_1257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1258> AgradDistributionWiener_fd_1258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1259> AgradDistributionWiener_fd_1259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1260> AgradDistributionWiener_fd_1260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1261> AgradDistributionWiener_fd_1261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1262> AgradDistributionWiener_fd_1262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1263> AgradDistributionWiener_fd_1263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1264> AgradDistributionWiener_fd_1264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1265> AgradDistributionWiener_fd_1265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1266> AgradDistributionWiener_fd_1266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1267> AgradDistributionWiener_fd_1267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1268> AgradDistributionWiener_fd_1268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1269> AgradDistributionWiener_fd_1269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1270> AgradDistributionWiener_fd_1270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1271> AgradDistributionWiener_fd_1271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1272> AgradDistributionWiener_fd_1272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1273> AgradDistributionWiener_fd_1273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1274> AgradDistributionWiener_fd_1274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1275> AgradDistributionWiener_fd_1275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1276> AgradDistributionWiener_fd_1276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1277> AgradDistributionWiener_fd_1277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1278> AgradDistributionWiener_fd_1278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1279> AgradDistributionWiener_fd_1279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1280> AgradDistributionWiener_fd_1280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1281> AgradDistributionWiener_fd_1281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1282> AgradDistributionWiener_fd_1282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1283> AgradDistributionWiener_fd_1283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1284> AgradDistributionWiener_fd_1284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1285> AgradDistributionWiener_fd_1285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1286> AgradDistributionWiener_fd_1286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1287> AgradDistributionWiener_fd_1287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1288> AgradDistributionWiener_fd_1288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1289> AgradDistributionWiener_fd_1289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1290> AgradDistributionWiener_fd_1290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1291> AgradDistributionWiener_fd_1291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1292> AgradDistributionWiener_fd_1292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1293> AgradDistributionWiener_fd_1293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1294> AgradDistributionWiener_fd_1294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1295> AgradDistributionWiener_fd_1295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1296> AgradDistributionWiener_fd_1296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1297> AgradDistributionWiener_fd_1297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1298> AgradDistributionWiener_fd_1298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_1299> AgradDistributionWiener_fd_1299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1200, AgradDistributionTestFixture, AgradDistributionWiener_fd_1200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1201, AgradDistributionTestFixture, AgradDistributionWiener_fd_1201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1202, AgradDistributionTestFixture, AgradDistributionWiener_fd_1202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1203, AgradDistributionTestFixture, AgradDistributionWiener_fd_1203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1204, AgradDistributionTestFixture, AgradDistributionWiener_fd_1204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1205, AgradDistributionTestFixture, AgradDistributionWiener_fd_1205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1206, AgradDistributionTestFixture, AgradDistributionWiener_fd_1206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1207, AgradDistributionTestFixture, AgradDistributionWiener_fd_1207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1208, AgradDistributionTestFixture, AgradDistributionWiener_fd_1208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1209, AgradDistributionTestFixture, AgradDistributionWiener_fd_1209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1210, AgradDistributionTestFixture, AgradDistributionWiener_fd_1210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1211, AgradDistributionTestFixture, AgradDistributionWiener_fd_1211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1212, AgradDistributionTestFixture, AgradDistributionWiener_fd_1212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1213, AgradDistributionTestFixture, AgradDistributionWiener_fd_1213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1214, AgradDistributionTestFixture, AgradDistributionWiener_fd_1214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1215, AgradDistributionTestFixture, AgradDistributionWiener_fd_1215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1216, AgradDistributionTestFixture, AgradDistributionWiener_fd_1216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1217, AgradDistributionTestFixture, AgradDistributionWiener_fd_1217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1218, AgradDistributionTestFixture, AgradDistributionWiener_fd_1218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1219, AgradDistributionTestFixture, AgradDistributionWiener_fd_1219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1220, AgradDistributionTestFixture, AgradDistributionWiener_fd_1220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1221, AgradDistributionTestFixture, AgradDistributionWiener_fd_1221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1222, AgradDistributionTestFixture, AgradDistributionWiener_fd_1222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1223, AgradDistributionTestFixture, AgradDistributionWiener_fd_1223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1224, AgradDistributionTestFixture, AgradDistributionWiener_fd_1224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1225, AgradDistributionTestFixture, AgradDistributionWiener_fd_1225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1226, AgradDistributionTestFixture, AgradDistributionWiener_fd_1226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1227, AgradDistributionTestFixture, AgradDistributionWiener_fd_1227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1228, AgradDistributionTestFixture, AgradDistributionWiener_fd_1228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1229, AgradDistributionTestFixture, AgradDistributionWiener_fd_1229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1230, AgradDistributionTestFixture, AgradDistributionWiener_fd_1230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1231, AgradDistributionTestFixture, AgradDistributionWiener_fd_1231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1232, AgradDistributionTestFixture, AgradDistributionWiener_fd_1232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1233, AgradDistributionTestFixture, AgradDistributionWiener_fd_1233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1234, AgradDistributionTestFixture, AgradDistributionWiener_fd_1234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1235, AgradDistributionTestFixture, AgradDistributionWiener_fd_1235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1236, AgradDistributionTestFixture, AgradDistributionWiener_fd_1236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1237, AgradDistributionTestFixture, AgradDistributionWiener_fd_1237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1238, AgradDistributionTestFixture, AgradDistributionWiener_fd_1238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1239, AgradDistributionTestFixture, AgradDistributionWiener_fd_1239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1240, AgradDistributionTestFixture, AgradDistributionWiener_fd_1240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1241, AgradDistributionTestFixture, AgradDistributionWiener_fd_1241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1242, AgradDistributionTestFixture, AgradDistributionWiener_fd_1242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1243, AgradDistributionTestFixture, AgradDistributionWiener_fd_1243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1244, AgradDistributionTestFixture, AgradDistributionWiener_fd_1244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1245, AgradDistributionTestFixture, AgradDistributionWiener_fd_1245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1246, AgradDistributionTestFixture, AgradDistributionWiener_fd_1246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1247, AgradDistributionTestFixture, AgradDistributionWiener_fd_1247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1248, AgradDistributionTestFixture, AgradDistributionWiener_fd_1248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1249, AgradDistributionTestFixture, AgradDistributionWiener_fd_1249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1250, AgradDistributionTestFixture, AgradDistributionWiener_fd_1250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1251, AgradDistributionTestFixture, AgradDistributionWiener_fd_1251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1252, AgradDistributionTestFixture, AgradDistributionWiener_fd_1252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1253, AgradDistributionTestFixture, AgradDistributionWiener_fd_1253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1254, AgradDistributionTestFixture, AgradDistributionWiener_fd_1254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1255, AgradDistributionTestFixture, AgradDistributionWiener_fd_1255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1256, AgradDistributionTestFixture, AgradDistributionWiener_fd_1256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1257, AgradDistributionTestFixture, AgradDistributionWiener_fd_1257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1258, AgradDistributionTestFixture, AgradDistributionWiener_fd_1258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1259, AgradDistributionTestFixture, AgradDistributionWiener_fd_1259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1260, AgradDistributionTestFixture, AgradDistributionWiener_fd_1260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1261, AgradDistributionTestFixture, AgradDistributionWiener_fd_1261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1262, AgradDistributionTestFixture, AgradDistributionWiener_fd_1262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1263, AgradDistributionTestFixture, AgradDistributionWiener_fd_1263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1264, AgradDistributionTestFixture, AgradDistributionWiener_fd_1264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1265, AgradDistributionTestFixture, AgradDistributionWiener_fd_1265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1266, AgradDistributionTestFixture, AgradDistributionWiener_fd_1266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1267, AgradDistributionTestFixture, AgradDistributionWiener_fd_1267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1268, AgradDistributionTestFixture, AgradDistributionWiener_fd_1268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1269, AgradDistributionTestFixture, AgradDistributionWiener_fd_1269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1270, AgradDistributionTestFixture, AgradDistributionWiener_fd_1270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1271, AgradDistributionTestFixture, AgradDistributionWiener_fd_1271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1272, AgradDistributionTestFixture, AgradDistributionWiener_fd_1272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1273, AgradDistributionTestFixture, AgradDistributionWiener_fd_1273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1274, AgradDistributionTestFixture, AgradDistributionWiener_fd_1274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1275, AgradDistributionTestFixture, AgradDistributionWiener_fd_1275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1276, AgradDistributionTestFixture, AgradDistributionWiener_fd_1276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1277, AgradDistributionTestFixture, AgradDistributionWiener_fd_1277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1278, AgradDistributionTestFixture, AgradDistributionWiener_fd_1278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1279, AgradDistributionTestFixture, AgradDistributionWiener_fd_1279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1280, AgradDistributionTestFixture, AgradDistributionWiener_fd_1280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1281, AgradDistributionTestFixture, AgradDistributionWiener_fd_1281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1282, AgradDistributionTestFixture, AgradDistributionWiener_fd_1282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1283, AgradDistributionTestFixture, AgradDistributionWiener_fd_1283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1284, AgradDistributionTestFixture, AgradDistributionWiener_fd_1284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1285, AgradDistributionTestFixture, AgradDistributionWiener_fd_1285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1286, AgradDistributionTestFixture, AgradDistributionWiener_fd_1286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1287, AgradDistributionTestFixture, AgradDistributionWiener_fd_1287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1288, AgradDistributionTestFixture, AgradDistributionWiener_fd_1288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1289, AgradDistributionTestFixture, AgradDistributionWiener_fd_1289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1290, AgradDistributionTestFixture, AgradDistributionWiener_fd_1290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1291, AgradDistributionTestFixture, AgradDistributionWiener_fd_1291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1292, AgradDistributionTestFixture, AgradDistributionWiener_fd_1292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1293, AgradDistributionTestFixture, AgradDistributionWiener_fd_1293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1294, AgradDistributionTestFixture, AgradDistributionWiener_fd_1294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1295, AgradDistributionTestFixture, AgradDistributionWiener_fd_1295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1296, AgradDistributionTestFixture, AgradDistributionWiener_fd_1296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1297, AgradDistributionTestFixture, AgradDistributionWiener_fd_1297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1298, AgradDistributionTestFixture, AgradDistributionWiener_fd_1298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_1299, AgradDistributionTestFixture, AgradDistributionWiener_fd_1299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1200;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1201;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1202;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1203;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1204;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1205;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1206;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1207;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1208;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1209;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1210;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1211;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1212;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1213;
+typedef boost::mpl::vector<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1214;
+typedef boost::mpl::vector<std::vector<double>, double, double, double, fvar<fvar<var> >, empty> type_ffv_1215;
+typedef boost::mpl::vector<std::vector<double>, double, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1216;
+typedef boost::mpl::vector<std::vector<double>, double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1217;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1218;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1219;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1220;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1221;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1222;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1223;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<fvar<var> >, double, empty> type_ffv_1224;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1225;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1226;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1227;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1228;
+typedef boost::mpl::vector<std::vector<double>, double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1229;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1230;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1231;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1232;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1233;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1234;
+typedef boost::mpl::vector<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1235;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1236;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1237;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1238;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1239;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1240;
+typedef boost::mpl::vector<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1241;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_1242;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1243;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1244;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1245;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1246;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1247;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1248;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1249;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1250;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_1251;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1252;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1253;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1254;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1255;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1256;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1257;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1258;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1259;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1260;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1261;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1262;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1263;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1264;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1265;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1266;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1267;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1268;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1269;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1270;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1271;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1272;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1273;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1274;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1275;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1276;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1277;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1278;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1279;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1280;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1281;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1282;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1283;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1284;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1285;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1286;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1287;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1288;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1289;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1290;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1291;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1292;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1293;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1294;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1295;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, double, double, empty> type_ffv_1296;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_1297;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1298;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_1299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1200> AgradDistributionWiener_ffv_1200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1201> AgradDistributionWiener_ffv_1201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1202> AgradDistributionWiener_ffv_1202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1203> AgradDistributionWiener_ffv_1203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1204> AgradDistributionWiener_ffv_1204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1205> AgradDistributionWiener_ffv_1205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1206> AgradDistributionWiener_ffv_1206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1207> AgradDistributionWiener_ffv_1207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1208> AgradDistributionWiener_ffv_1208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1209> AgradDistributionWiener_ffv_1209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1210> AgradDistributionWiener_ffv_1210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1211> AgradDistributionWiener_ffv_1211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1212> AgradDistributionWiener_ffv_1212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1213> AgradDistributionWiener_ffv_1213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1214> AgradDistributionWiener_ffv_1214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1215> AgradDistributionWiener_ffv_1215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1216> AgradDistributionWiener_ffv_1216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1217> AgradDistributionWiener_ffv_1217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1218> AgradDistributionWiener_ffv_1218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1219> AgradDistributionWiener_ffv_1219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1220> AgradDistributionWiener_ffv_1220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1221> AgradDistributionWiener_ffv_1221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1222> AgradDistributionWiener_ffv_1222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1223> AgradDistributionWiener_ffv_1223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1224> AgradDistributionWiener_ffv_1224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1225> AgradDistributionWiener_ffv_1225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1226> AgradDistributionWiener_ffv_1226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1227> AgradDistributionWiener_ffv_1227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1228> AgradDistributionWiener_ffv_1228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1229> AgradDistributionWiener_ffv_1229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1230> AgradDistributionWiener_ffv_1230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1231> AgradDistributionWiener_ffv_1231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1232> AgradDistributionWiener_ffv_1232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1233> AgradDistributionWiener_ffv_1233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1234> AgradDistributionWiener_ffv_1234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1235> AgradDistributionWiener_ffv_1235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1236> AgradDistributionWiener_ffv_1236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1237> AgradDistributionWiener_ffv_1237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1238> AgradDistributionWiener_ffv_1238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1239> AgradDistributionWiener_ffv_1239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1240> AgradDistributionWiener_ffv_1240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1241> AgradDistributionWiener_ffv_1241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1242> AgradDistributionWiener_ffv_1242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1243> AgradDistributionWiener_ffv_1243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1244> AgradDistributionWiener_ffv_1244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1245> AgradDistributionWiener_ffv_1245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1246> AgradDistributionWiener_ffv_1246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1247> AgradDistributionWiener_ffv_1247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1248> AgradDistributionWiener_ffv_1248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1249> AgradDistributionWiener_ffv_1249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1250> AgradDistributionWiener_ffv_1250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1251> AgradDistributionWiener_ffv_1251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1252> AgradDistributionWiener_ffv_1252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1253> AgradDistributionWiener_ffv_1253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1254> AgradDistributionWiener_ffv_1254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1255> AgradDistributionWiener_ffv_1255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1256> AgradDistributionWiener_ffv_1256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1257> AgradDistributionWiener_ffv_1257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1258> AgradDistributionWiener_ffv_1258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1259> AgradDistributionWiener_ffv_1259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1260> AgradDistributionWiener_ffv_1260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1261> AgradDistributionWiener_ffv_1261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1262> AgradDistributionWiener_ffv_1262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1263> AgradDistributionWiener_ffv_1263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1264> AgradDistributionWiener_ffv_1264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1265> AgradDistributionWiener_ffv_1265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1266> AgradDistributionWiener_ffv_1266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1267> AgradDistributionWiener_ffv_1267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1268> AgradDistributionWiener_ffv_1268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1269> AgradDistributionWiener_ffv_1269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1270> AgradDistributionWiener_ffv_1270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1271> AgradDistributionWiener_ffv_1271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1272> AgradDistributionWiener_ffv_1272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1273> AgradDistributionWiener_ffv_1273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1274> AgradDistributionWiener_ffv_1274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1275> AgradDistributionWiener_ffv_1275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1276> AgradDistributionWiener_ffv_1276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1277> AgradDistributionWiener_ffv_1277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1278> AgradDistributionWiener_ffv_1278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1279> AgradDistributionWiener_ffv_1279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1280> AgradDistributionWiener_ffv_1280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1281> AgradDistributionWiener_ffv_1281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1282> AgradDistributionWiener_ffv_1282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1283> AgradDistributionWiener_ffv_1283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1284> AgradDistributionWiener_ffv_1284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1285> AgradDistributionWiener_ffv_1285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1286> AgradDistributionWiener_ffv_1286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1287> AgradDistributionWiener_ffv_1287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1288> AgradDistributionWiener_ffv_1288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1289> AgradDistributionWiener_ffv_1289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1290> AgradDistributionWiener_ffv_1290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1291> AgradDistributionWiener_ffv_1291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1292> AgradDistributionWiener_ffv_1292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1293> AgradDistributionWiener_ffv_1293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1294> AgradDistributionWiener_ffv_1294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1295> AgradDistributionWiener_ffv_1295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1296> AgradDistributionWiener_ffv_1296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1297> AgradDistributionWiener_ffv_1297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1298> AgradDistributionWiener_ffv_1298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1299> AgradDistributionWiener_ffv_1299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1200, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1201, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1202, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1203, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1204, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1205, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1206, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1207, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1208, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1209, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1210, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1211, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1212, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1213, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1214, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1215, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1216, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1217, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1218, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1219, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1220, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1221, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1222, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1223, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1224, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1225, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1226, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1227, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1228, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1229, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1230, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1231, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1232, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1233, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1234, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1235, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1236, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1237, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1238, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1239, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1240, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1241, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1242, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1243, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1244, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1245, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1246, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1247, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1248, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1249, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1250, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1251, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1252, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1253, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1254, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1255, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1256, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1257, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1258, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1259, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1260, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1261, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1262, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1263, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1264, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1265, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1266, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1267, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1268, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1269, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1270, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1271, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1272, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1273, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1274, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1275, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1276, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1277, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1278, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1279, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1280, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1281, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1282, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1283, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1284, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1285, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1286, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1287, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1288, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1289, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1290, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1291, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1292, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1293, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1294, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1295, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1296, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1297, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1298, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1299, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1300;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1301;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_1302;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_1303;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1304;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1305;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1306;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1307;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1308;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1309;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1310;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1311;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1312;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1313;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_1314;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1315;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1316;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1317;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1318;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1319;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1320;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1321;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1322;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1323;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1324;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1325;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1326;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1327;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1328;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1329;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1330;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1331;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_1332;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_1333;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1334;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_1335;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1336;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1337;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_1338;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_1339;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1340;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1341;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1342;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1343;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1344;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1345;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1346;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1347;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1348;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1349;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_1350;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1351;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1352;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1353;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1354;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1355;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1356;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1357;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1358;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1359;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1360;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1361;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1362;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1363;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1364;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1365;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1366;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1367;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_1368;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_1369;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1370;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_1371;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1372;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1373;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_1374;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_1375;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1376;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1377;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1378;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1379;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1380;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1381;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1382;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1383;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1384;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1385;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_1386;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1387;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1388;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1389;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1390;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1391;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1392;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1393;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1394;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1395;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1396;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1397;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1398;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1300> AgradDistributionWiener_ffd_1300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1301> AgradDistributionWiener_ffd_1301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1302> AgradDistributionWiener_ffd_1302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1303> AgradDistributionWiener_ffd_1303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1304> AgradDistributionWiener_ffd_1304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1305> AgradDistributionWiener_ffd_1305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1306> AgradDistributionWiener_ffd_1306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1307> AgradDistributionWiener_ffd_1307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1308> AgradDistributionWiener_ffd_1308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1309> AgradDistributionWiener_ffd_1309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1310> AgradDistributionWiener_ffd_1310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1311> AgradDistributionWiener_ffd_1311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1312> AgradDistributionWiener_ffd_1312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1313> AgradDistributionWiener_ffd_1313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1314> AgradDistributionWiener_ffd_1314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1315> AgradDistributionWiener_ffd_1315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1316> AgradDistributionWiener_ffd_1316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1317> AgradDistributionWiener_ffd_1317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1318> AgradDistributionWiener_ffd_1318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1319> AgradDistributionWiener_ffd_1319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1320> AgradDistributionWiener_ffd_1320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1321> AgradDistributionWiener_ffd_1321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1322> AgradDistributionWiener_ffd_1322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1323> AgradDistributionWiener_ffd_1323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1324> AgradDistributionWiener_ffd_1324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1325> AgradDistributionWiener_ffd_1325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1326> AgradDistributionWiener_ffd_1326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1327> AgradDistributionWiener_ffd_1327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1328> AgradDistributionWiener_ffd_1328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1329> AgradDistributionWiener_ffd_1329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1330> AgradDistributionWiener_ffd_1330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1331> AgradDistributionWiener_ffd_1331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1332> AgradDistributionWiener_ffd_1332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1333> AgradDistributionWiener_ffd_1333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1334> AgradDistributionWiener_ffd_1334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1335> AgradDistributionWiener_ffd_1335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1336> AgradDistributionWiener_ffd_1336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1337> AgradDistributionWiener_ffd_1337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1338> AgradDistributionWiener_ffd_1338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1339> AgradDistributionWiener_ffd_1339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1340> AgradDistributionWiener_ffd_1340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1341> AgradDistributionWiener_ffd_1341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1342> AgradDistributionWiener_ffd_1342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1343> AgradDistributionWiener_ffd_1343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1344> AgradDistributionWiener_ffd_1344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1345> AgradDistributionWiener_ffd_1345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1346> AgradDistributionWiener_ffd_1346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1347> AgradDistributionWiener_ffd_1347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1348> AgradDistributionWiener_ffd_1348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1349> AgradDistributionWiener_ffd_1349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1350> AgradDistributionWiener_ffd_1350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1351> AgradDistributionWiener_ffd_1351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1352> AgradDistributionWiener_ffd_1352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1353> AgradDistributionWiener_ffd_1353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1354> AgradDistributionWiener_ffd_1354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1355> AgradDistributionWiener_ffd_1355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1356> AgradDistributionWiener_ffd_1356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1357> AgradDistributionWiener_ffd_1357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1358> AgradDistributionWiener_ffd_1358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1359> AgradDistributionWiener_ffd_1359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1360> AgradDistributionWiener_ffd_1360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1361> AgradDistributionWiener_ffd_1361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1362> AgradDistributionWiener_ffd_1362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1363> AgradDistributionWiener_ffd_1363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1364> AgradDistributionWiener_ffd_1364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1365> AgradDistributionWiener_ffd_1365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1366> AgradDistributionWiener_ffd_1366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1367> AgradDistributionWiener_ffd_1367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1368> AgradDistributionWiener_ffd_1368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1369> AgradDistributionWiener_ffd_1369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1370> AgradDistributionWiener_ffd_1370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1371> AgradDistributionWiener_ffd_1371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1372> AgradDistributionWiener_ffd_1372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1373> AgradDistributionWiener_ffd_1373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1374> AgradDistributionWiener_ffd_1374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1375> AgradDistributionWiener_ffd_1375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1376> AgradDistributionWiener_ffd_1376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1377> AgradDistributionWiener_ffd_1377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1378> AgradDistributionWiener_ffd_1378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1379> AgradDistributionWiener_ffd_1379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1380> AgradDistributionWiener_ffd_1380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1381> AgradDistributionWiener_ffd_1381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1382> AgradDistributionWiener_ffd_1382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1383> AgradDistributionWiener_ffd_1383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1384> AgradDistributionWiener_ffd_1384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1385> AgradDistributionWiener_ffd_1385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1386> AgradDistributionWiener_ffd_1386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1387> AgradDistributionWiener_ffd_1387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1388> AgradDistributionWiener_ffd_1388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1389> AgradDistributionWiener_ffd_1389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1390> AgradDistributionWiener_ffd_1390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1391> AgradDistributionWiener_ffd_1391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1392> AgradDistributionWiener_ffd_1392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1393> AgradDistributionWiener_ffd_1393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1394> AgradDistributionWiener_ffd_1394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1395> AgradDistributionWiener_ffd_1395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1396> AgradDistributionWiener_ffd_1396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1397> AgradDistributionWiener_ffd_1397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1398> AgradDistributionWiener_ffd_1398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1399> AgradDistributionWiener_ffd_1399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1300, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1301, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1302, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1303, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1304, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1305, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1306, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1307, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1308, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1309, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1310, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1311, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1312, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1313, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1314, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1315, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1316, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1317, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1318, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1319, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1320, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1321, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1322, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1323, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1324, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1325, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1326, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1327, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1328, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1329, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1330, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1331, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1332, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1333, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1334, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1335, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1336, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1337, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1338, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1339, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1340, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1341, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1342, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1343, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1344, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1345, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1346, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1347, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1348, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1349, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1350, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1351, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1352, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1353, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1354, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1355, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1356, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1357, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1358, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1359, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1360, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1361, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1362, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1363, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1364, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1365, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1366, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1367, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1368, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1369, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1370, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1371, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1372, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1373, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1374, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1375, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1376, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1377, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1378, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1379, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1380, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1381, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1382, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1383, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1384, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1385, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1386, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1387, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1388, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1389, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1390, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1391, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1392, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1393, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1394, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1395, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1396, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1397, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1398, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1399, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1300;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1301;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_1302;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_1303;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1304;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1305;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1306;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1307;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1308;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1309;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1310;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1311;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1312;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1313;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_1314;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1315;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1316;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1317;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1318;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1319;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1320;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1321;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1322;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1323;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1324;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1325;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1326;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1327;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1328;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1329;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1330;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1331;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_1332;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_1333;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1334;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_1335;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1336;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1337;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_1338;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_1339;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1340;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1341;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1342;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1343;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1344;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1345;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1346;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1347;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1348;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1349;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_1350;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1351;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1352;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1353;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1354;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1355;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1356;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1357;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1358;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1359;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1360;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1361;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1362;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1363;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1364;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1365;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1366;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1367;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1368;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1369;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1370;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1371;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1372;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1373;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1374;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1375;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1376;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1377;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1378;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1379;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1380;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1381;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1382;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1383;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1384;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1385;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1386;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1387;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1388;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1389;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1390;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1391;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1392;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1393;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1394;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1395;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1396;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1397;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1398;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1300> AgradDistributionWiener_ffv_1300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1301> AgradDistributionWiener_ffv_1301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1302> AgradDistributionWiener_ffv_1302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1303> AgradDistributionWiener_ffv_1303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1304> AgradDistributionWiener_ffv_1304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1305> AgradDistributionWiener_ffv_1305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1306> AgradDistributionWiener_ffv_1306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1307> AgradDistributionWiener_ffv_1307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1308> AgradDistributionWiener_ffv_1308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1309> AgradDistributionWiener_ffv_1309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1310> AgradDistributionWiener_ffv_1310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1311> AgradDistributionWiener_ffv_1311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1312> AgradDistributionWiener_ffv_1312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1313> AgradDistributionWiener_ffv_1313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1314> AgradDistributionWiener_ffv_1314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1315> AgradDistributionWiener_ffv_1315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1316> AgradDistributionWiener_ffv_1316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1317> AgradDistributionWiener_ffv_1317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1318> AgradDistributionWiener_ffv_1318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1319> AgradDistributionWiener_ffv_1319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1320> AgradDistributionWiener_ffv_1320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1321> AgradDistributionWiener_ffv_1321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1322> AgradDistributionWiener_ffv_1322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1323> AgradDistributionWiener_ffv_1323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1324> AgradDistributionWiener_ffv_1324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1325> AgradDistributionWiener_ffv_1325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1326> AgradDistributionWiener_ffv_1326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1327> AgradDistributionWiener_ffv_1327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1328> AgradDistributionWiener_ffv_1328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1329> AgradDistributionWiener_ffv_1329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1330> AgradDistributionWiener_ffv_1330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1331> AgradDistributionWiener_ffv_1331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1332> AgradDistributionWiener_ffv_1332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1333> AgradDistributionWiener_ffv_1333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1334> AgradDistributionWiener_ffv_1334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1335> AgradDistributionWiener_ffv_1335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1336> AgradDistributionWiener_ffv_1336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1337> AgradDistributionWiener_ffv_1337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1338> AgradDistributionWiener_ffv_1338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1339> AgradDistributionWiener_ffv_1339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1340> AgradDistributionWiener_ffv_1340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1341> AgradDistributionWiener_ffv_1341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1342> AgradDistributionWiener_ffv_1342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1343> AgradDistributionWiener_ffv_1343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1344> AgradDistributionWiener_ffv_1344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1345> AgradDistributionWiener_ffv_1345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1346> AgradDistributionWiener_ffv_1346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1347> AgradDistributionWiener_ffv_1347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1348> AgradDistributionWiener_ffv_1348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1349> AgradDistributionWiener_ffv_1349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1350> AgradDistributionWiener_ffv_1350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1351> AgradDistributionWiener_ffv_1351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1352> AgradDistributionWiener_ffv_1352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1353> AgradDistributionWiener_ffv_1353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1354> AgradDistributionWiener_ffv_1354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1355> AgradDistributionWiener_ffv_1355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1356> AgradDistributionWiener_ffv_1356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1357> AgradDistributionWiener_ffv_1357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1358> AgradDistributionWiener_ffv_1358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1359> AgradDistributionWiener_ffv_1359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1360> AgradDistributionWiener_ffv_1360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1361> AgradDistributionWiener_ffv_1361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1362> AgradDistributionWiener_ffv_1362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1363> AgradDistributionWiener_ffv_1363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1364> AgradDistributionWiener_ffv_1364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1365> AgradDistributionWiener_ffv_1365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1366> AgradDistributionWiener_ffv_1366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1367> AgradDistributionWiener_ffv_1367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1368> AgradDistributionWiener_ffv_1368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1369> AgradDistributionWiener_ffv_1369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1370> AgradDistributionWiener_ffv_1370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1371> AgradDistributionWiener_ffv_1371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1372> AgradDistributionWiener_ffv_1372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1373> AgradDistributionWiener_ffv_1373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1374> AgradDistributionWiener_ffv_1374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1375> AgradDistributionWiener_ffv_1375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1376> AgradDistributionWiener_ffv_1376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1377> AgradDistributionWiener_ffv_1377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1378> AgradDistributionWiener_ffv_1378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1379> AgradDistributionWiener_ffv_1379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1380> AgradDistributionWiener_ffv_1380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1381> AgradDistributionWiener_ffv_1381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1382> AgradDistributionWiener_ffv_1382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1383> AgradDistributionWiener_ffv_1383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1384> AgradDistributionWiener_ffv_1384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1385> AgradDistributionWiener_ffv_1385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1386> AgradDistributionWiener_ffv_1386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1387> AgradDistributionWiener_ffv_1387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1388> AgradDistributionWiener_ffv_1388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1389> AgradDistributionWiener_ffv_1389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1390> AgradDistributionWiener_ffv_1390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1391> AgradDistributionWiener_ffv_1391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1392> AgradDistributionWiener_ffv_1392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1393> AgradDistributionWiener_ffv_1393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1394> AgradDistributionWiener_ffv_1394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1395> AgradDistributionWiener_ffv_1395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1396> AgradDistributionWiener_ffv_1396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1397> AgradDistributionWiener_ffv_1397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1398> AgradDistributionWiener_ffv_1398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1399> AgradDistributionWiener_ffv_1399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1300, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1301, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1302, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1303, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1304, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1305, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1306, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1307, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1308, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1309, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1310, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1311, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1312, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1313, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1314, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1315, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1316, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1317, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1318, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1319, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1320, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1321, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1322, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1323, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1324, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1325, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1326, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1327, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1328, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1329, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1330, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1331, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1332, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1333, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1334, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1335, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1336, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1337, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1338, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1339, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1340, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1341, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1342, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1343, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1344, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1345, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1346, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1347, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1348, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1349, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1350, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1351, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1352, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1353, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1354, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1355, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1356, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1357, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1358, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1359, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1360, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1361, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1362, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1363, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1364, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1365, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1366, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1367, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1368, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1369, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1370, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1371, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1372, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1373, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1374, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1375, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1376, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1377, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1378, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1379, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1380, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1381, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1382, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1383, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1384, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1385, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1386, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1387, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1388, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1389, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1390, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1391, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1392, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1393, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1394, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1395, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1396, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1397, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1398, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1399, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1399);
+
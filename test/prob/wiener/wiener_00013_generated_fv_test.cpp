@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_1300;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1301;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<double>, double, empty> type_fv_1302;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_1303;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1304;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_1305;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1306;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1307;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1308;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1309;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1310;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1311;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1312;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1313;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, fvar<var>, double, empty> type_fv_1314;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_1315;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1316;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_1317;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1318;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1319;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_1320;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1321;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1322;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1323;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1324;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1325;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1326;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1327;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1328;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1329;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1330;
+typedef boost::mpl::vector<std::vector<double>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1331;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, double, double, empty> type_fv_1332;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_1333;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1334;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_1335;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_1336;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1337;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_1338;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_1339;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1340;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_1341;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1342;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1343;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1344;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1345;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1346;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1347;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1348;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1349;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_1350;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_1351;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1352;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_1353;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1354;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1355;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_1356;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1357;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1358;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1359;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1360;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1361;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1362;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1363;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1364;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1365;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1366;
+typedef boost::mpl::vector<std::vector<double>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1367;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_1368;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_1369;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1370;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_1371;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_1372;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1373;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_1374;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_1375;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1376;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_1377;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1378;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1379;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1380;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1381;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1382;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1383;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1384;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1385;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_1386;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_1387;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1388;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_1389;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1390;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1391;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_1392;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1393;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1394;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1395;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1396;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1397;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1398;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1300> AgradDistributionWiener_fv_1300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1301> AgradDistributionWiener_fv_1301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1302> AgradDistributionWiener_fv_1302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1303> AgradDistributionWiener_fv_1303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1304> AgradDistributionWiener_fv_1304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1305> AgradDistributionWiener_fv_1305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1306> AgradDistributionWiener_fv_1306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1307> AgradDistributionWiener_fv_1307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1308> AgradDistributionWiener_fv_1308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1309> AgradDistributionWiener_fv_1309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1310> AgradDistributionWiener_fv_1310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1311> AgradDistributionWiener_fv_1311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1312> AgradDistributionWiener_fv_1312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1313> AgradDistributionWiener_fv_1313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1314> AgradDistributionWiener_fv_1314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1315> AgradDistributionWiener_fv_1315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1316> AgradDistributionWiener_fv_1316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1317> AgradDistributionWiener_fv_1317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1318> AgradDistributionWiener_fv_1318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1319> AgradDistributionWiener_fv_1319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1320> AgradDistributionWiener_fv_1320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1321> AgradDistributionWiener_fv_1321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1322> AgradDistributionWiener_fv_1322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1323> AgradDistributionWiener_fv_1323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1324> AgradDistributionWiener_fv_1324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1325> AgradDistributionWiener_fv_1325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1326> AgradDistributionWiener_fv_1326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1327> AgradDistributionWiener_fv_1327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1328> AgradDistributionWiener_fv_1328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1329> AgradDistributionWiener_fv_1329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1330> AgradDistributionWiener_fv_1330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1331> AgradDistributionWiener_fv_1331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1332> AgradDistributionWiener_fv_1332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1333> AgradDistributionWiener_fv_1333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1334> AgradDistributionWiener_fv_1334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1335> AgradDistributionWiener_fv_1335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1336> AgradDistributionWiener_fv_1336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1337> AgradDistributionWiener_fv_1337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1338> AgradDistributionWiener_fv_1338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1339> AgradDistributionWiener_fv_1339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1340> AgradDistributionWiener_fv_1340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1341> AgradDistributionWiener_fv_1341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1342> AgradDistributionWiener_fv_1342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1343> AgradDistributionWiener_fv_1343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1344> AgradDistributionWiener_fv_1344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1345> AgradDistributionWiener_fv_1345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1346> AgradDistributionWiener_fv_1346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1347> AgradDistributionWiener_fv_1347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1348> AgradDistributionWiener_fv_1348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1349> AgradDistributionWiener_fv_1349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1350> AgradDistributionWiener_fv_1350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1351> AgradDistributionWiener_fv_1351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1352> AgradDistributionWiener_fv_1352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1353> AgradDistributionWiener_fv_1353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1354> AgradDistributionWiener_fv_1354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1355> AgradDistributionWiener_fv_1355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1356> AgradDistributionWiener_fv_1356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1357> AgradDistributionWiener_fv_1357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1358> AgradDistributionWiener_fv_1358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1359> AgradDistributionWiener_fv_1359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1360> AgradDistributionWiener_fv_1360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1361> AgradDistributionWiener_fv_1361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1362> AgradDistributionWiener_fv_1362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1363> AgradDistributionWiener_fv_1363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1364> AgradDistributionWiener_fv_1364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1365> AgradDistributionWiener_fv_1365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1366> AgradDistributionWiener_fv_1366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1367> AgradDistributionWiener_fv_1367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1368> AgradDistributionWiener_fv_1368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1369> AgradDistributionWiener_fv_1369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1370> AgradDistributionWiener_fv_1370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1371> AgradDistributionWiener_fv_1371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1372> AgradDistributionWiener_fv_1372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1373> AgradDistributionWiener_fv_1373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1374> AgradDistributionWiener_fv_1374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1375> AgradDistributionWiener_fv_1375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1376> AgradDistributionWiener_fv_1376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1377> AgradDistributionWiener_fv_1377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1378> AgradDistributionWiener_fv_1378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1379> AgradDistributionWiener_fv_1379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1380> AgradDistributionWiener_fv_1380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1381> AgradDistributionWiener_fv_1381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1382> AgradDistributionWiener_fv_1382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1383> AgradDistributionWiener_fv_1383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1384> AgradDistributionWiener_fv_1384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1385> AgradDistributionWiener_fv_1385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1386> AgradDistributionWiener_fv_1386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1387> AgradDistributionWiener_fv_1387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1388> AgradDistributionWiener_fv_1388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1389> AgradDistributionWiener_fv_1389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1390> AgradDistributionWiener_fv_1390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1391> AgradDistributionWiener_fv_1391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1392> AgradDistributionWiener_fv_1392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1393> AgradDistributionWiener_fv_1393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1394> AgradDistributionWiener_fv_1394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1395> AgradDistributionWiener_fv_1395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1396> AgradDistributionWiener_fv_1396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1397> AgradDistributionWiener_fv_1397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1398> AgradDistributionWiener_fv_1398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1399> AgradDistributionWiener_fv_1399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1300, AgradDistributionTestFixture, AgradDistributionWiener_fv_1300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1301, AgradDistributionTestFixture, AgradDistributionWiener_fv_1301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1302, AgradDistributionTestFixture, AgradDistributionWiener_fv_1302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1303, AgradDistributionTestFixture, AgradDistributionWiener_fv_1303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1304, AgradDistributionTestFixture, AgradDistributionWiener_fv_1304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1305, AgradDistributionTestFixture, AgradDistributionWiener_fv_1305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1306, AgradDistributionTestFixture, AgradDistributionWiener_fv_1306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1307, AgradDistributionTestFixture, AgradDistributionWiener_fv_1307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1308, AgradDistributionTestFixture, AgradDistributionWiener_fv_1308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1309, AgradDistributionTestFixture, AgradDistributionWiener_fv_1309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1310, AgradDistributionTestFixture, AgradDistributionWiener_fv_1310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1311, AgradDistributionTestFixture, AgradDistributionWiener_fv_1311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1312, AgradDistributionTestFixture, AgradDistributionWiener_fv_1312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1313, AgradDistributionTestFixture, AgradDistributionWiener_fv_1313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1314, AgradDistributionTestFixture, AgradDistributionWiener_fv_1314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1315, AgradDistributionTestFixture, AgradDistributionWiener_fv_1315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1316, AgradDistributionTestFixture, AgradDistributionWiener_fv_1316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1317, AgradDistributionTestFixture, AgradDistributionWiener_fv_1317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1318, AgradDistributionTestFixture, AgradDistributionWiener_fv_1318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1319, AgradDistributionTestFixture, AgradDistributionWiener_fv_1319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1320, AgradDistributionTestFixture, AgradDistributionWiener_fv_1320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1321, AgradDistributionTestFixture, AgradDistributionWiener_fv_1321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1322, AgradDistributionTestFixture, AgradDistributionWiener_fv_1322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1323, AgradDistributionTestFixture, AgradDistributionWiener_fv_1323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1324, AgradDistributionTestFixture, AgradDistributionWiener_fv_1324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1325, AgradDistributionTestFixture, AgradDistributionWiener_fv_1325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1326, AgradDistributionTestFixture, AgradDistributionWiener_fv_1326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1327, AgradDistributionTestFixture, AgradDistributionWiener_fv_1327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1328, AgradDistributionTestFixture, AgradDistributionWiener_fv_1328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1329, AgradDistributionTestFixture, AgradDistributionWiener_fv_1329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1330, AgradDistributionTestFixture, AgradDistributionWiener_fv_1330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1331, AgradDistributionTestFixture, AgradDistributionWiener_fv_1331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1332, AgradDistributionTestFixture, AgradDistributionWiener_fv_1332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1333, AgradDistributionTestFixture, AgradDistributionWiener_fv_1333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1334, AgradDistributionTestFixture, AgradDistributionWiener_fv_1334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1335, AgradDistributionTestFixture, AgradDistributionWiener_fv_1335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1336, AgradDistributionTestFixture, AgradDistributionWiener_fv_1336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1337, AgradDistributionTestFixture, AgradDistributionWiener_fv_1337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1338, AgradDistributionTestFixture, AgradDistributionWiener_fv_1338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1339, AgradDistributionTestFixture, AgradDistributionWiener_fv_1339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1340, AgradDistributionTestFixture, AgradDistributionWiener_fv_1340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1341, AgradDistributionTestFixture, AgradDistributionWiener_fv_1341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1342, AgradDistributionTestFixture, AgradDistributionWiener_fv_1342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1343, AgradDistributionTestFixture, AgradDistributionWiener_fv_1343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1344, AgradDistributionTestFixture, AgradDistributionWiener_fv_1344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1345, AgradDistributionTestFixture, AgradDistributionWiener_fv_1345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1346, AgradDistributionTestFixture, AgradDistributionWiener_fv_1346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1347, AgradDistributionTestFixture, AgradDistributionWiener_fv_1347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1348, AgradDistributionTestFixture, AgradDistributionWiener_fv_1348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1349, AgradDistributionTestFixture, AgradDistributionWiener_fv_1349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1350, AgradDistributionTestFixture, AgradDistributionWiener_fv_1350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1351, AgradDistributionTestFixture, AgradDistributionWiener_fv_1351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1352, AgradDistributionTestFixture, AgradDistributionWiener_fv_1352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1353, AgradDistributionTestFixture, AgradDistributionWiener_fv_1353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1354, AgradDistributionTestFixture, AgradDistributionWiener_fv_1354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1355, AgradDistributionTestFixture, AgradDistributionWiener_fv_1355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1356, AgradDistributionTestFixture, AgradDistributionWiener_fv_1356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1357, AgradDistributionTestFixture, AgradDistributionWiener_fv_1357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1358, AgradDistributionTestFixture, AgradDistributionWiener_fv_1358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1359, AgradDistributionTestFixture, AgradDistributionWiener_fv_1359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1360, AgradDistributionTestFixture, AgradDistributionWiener_fv_1360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1361, AgradDistributionTestFixture, AgradDistributionWiener_fv_1361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1362, AgradDistributionTestFixture, AgradDistributionWiener_fv_1362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1363, AgradDistributionTestFixture, AgradDistributionWiener_fv_1363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1364, AgradDistributionTestFixture, AgradDistributionWiener_fv_1364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1365, AgradDistributionTestFixture, AgradDistributionWiener_fv_1365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1366, AgradDistributionTestFixture, AgradDistributionWiener_fv_1366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1367, AgradDistributionTestFixture, AgradDistributionWiener_fv_1367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1368, AgradDistributionTestFixture, AgradDistributionWiener_fv_1368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1369, AgradDistributionTestFixture, AgradDistributionWiener_fv_1369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1370, AgradDistributionTestFixture, AgradDistributionWiener_fv_1370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1371, AgradDistributionTestFixture, AgradDistributionWiener_fv_1371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1372, AgradDistributionTestFixture, AgradDistributionWiener_fv_1372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1373, AgradDistributionTestFixture, AgradDistributionWiener_fv_1373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1374, AgradDistributionTestFixture, AgradDistributionWiener_fv_1374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1375, AgradDistributionTestFixture, AgradDistributionWiener_fv_1375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1376, AgradDistributionTestFixture, AgradDistributionWiener_fv_1376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1377, AgradDistributionTestFixture, AgradDistributionWiener_fv_1377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1378, AgradDistributionTestFixture, AgradDistributionWiener_fv_1378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1379, AgradDistributionTestFixture, AgradDistributionWiener_fv_1379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1380, AgradDistributionTestFixture, AgradDistributionWiener_fv_1380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1381, AgradDistributionTestFixture, AgradDistributionWiener_fv_1381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1382, AgradDistributionTestFixture, AgradDistributionWiener_fv_1382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1383, AgradDistributionTestFixture, AgradDistributionWiener_fv_1383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1384, AgradDistributionTestFixture, AgradDistributionWiener_fv_1384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1385, AgradDistributionTestFixture, AgradDistributionWiener_fv_1385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1386, AgradDistributionTestFixture, AgradDistributionWiener_fv_1386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1387, AgradDistributionTestFixture, AgradDistributionWiener_fv_1387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1388, AgradDistributionTestFixture, AgradDistributionWiener_fv_1388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1389, AgradDistributionTestFixture, AgradDistributionWiener_fv_1389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1390, AgradDistributionTestFixture, AgradDistributionWiener_fv_1390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1391, AgradDistributionTestFixture, AgradDistributionWiener_fv_1391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1392, AgradDistributionTestFixture, AgradDistributionWiener_fv_1392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1393, AgradDistributionTestFixture, AgradDistributionWiener_fv_1393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1394, AgradDistributionTestFixture, AgradDistributionWiener_fv_1394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1395, AgradDistributionTestFixture, AgradDistributionWiener_fv_1395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1396, AgradDistributionTestFixture, AgradDistributionWiener_fv_1396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1397, AgradDistributionTestFixture, AgradDistributionWiener_fv_1397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1398, AgradDistributionTestFixture, AgradDistributionWiener_fv_1398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1399, AgradDistributionTestFixture, AgradDistributionWiener_fv_1399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1400;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1401;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1402;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1403;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, fvar<fvar<double> >, empty> type_ffd_1404;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1405;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1406;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1407;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1408;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1409;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1410;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1411;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1412;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, double, empty> type_ffd_1413;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1414;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1415;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1416;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1417;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1418;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1419;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1420;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1421;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1422;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1423;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1424;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1425;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1426;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1427;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1428;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1429;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1430;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_1431;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1432;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1433;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1434;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1435;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1436;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1437;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1438;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1439;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_1440;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1441;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1442;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1443;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1444;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1445;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1446;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1447;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1448;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1449;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1450;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1451;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1452;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1453;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1454;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1455;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1456;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1457;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_1458;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1459;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1460;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1461;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1462;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1463;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1464;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1465;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1466;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_1467;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_1468;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1469;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_1470;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_1471;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1472;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_1473;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_1474;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1475;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_1476;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1477;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1478;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_1479;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1480;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1481;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_1482;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1483;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1484;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, double, empty> type_ffd_1485;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_1486;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1487;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_1488;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_1489;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1490;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_1491;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_1492;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1493;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_1494;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_1495;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_1496;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_1497;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_1498;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_1499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1400> AgradDistributionWiener_ffd_1400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1401> AgradDistributionWiener_ffd_1401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1402> AgradDistributionWiener_ffd_1402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1403> AgradDistributionWiener_ffd_1403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1404> AgradDistributionWiener_ffd_1404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1405> AgradDistributionWiener_ffd_1405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1406> AgradDistributionWiener_ffd_1406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1407> AgradDistributionWiener_ffd_1407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1408> AgradDistributionWiener_ffd_1408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1409> AgradDistributionWiener_ffd_1409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1410> AgradDistributionWiener_ffd_1410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1411> AgradDistributionWiener_ffd_1411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1412> AgradDistributionWiener_ffd_1412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1413> AgradDistributionWiener_ffd_1413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1414> AgradDistributionWiener_ffd_1414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1415> AgradDistributionWiener_ffd_1415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1416> AgradDistributionWiener_ffd_1416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1417> AgradDistributionWiener_ffd_1417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1418> AgradDistributionWiener_ffd_1418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1419> AgradDistributionWiener_ffd_1419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1420> AgradDistributionWiener_ffd_1420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1421> AgradDistributionWiener_ffd_1421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1422> AgradDistributionWiener_ffd_1422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1423> AgradDistributionWiener_ffd_1423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1424> AgradDistributionWiener_ffd_1424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1425> AgradDistributionWiener_ffd_1425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1426> AgradDistributionWiener_ffd_1426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1427> AgradDistributionWiener_ffd_1427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1428> AgradDistributionWiener_ffd_1428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1429> AgradDistributionWiener_ffd_1429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1430> AgradDistributionWiener_ffd_1430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1431> AgradDistributionWiener_ffd_1431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1432> AgradDistributionWiener_ffd_1432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1433> AgradDistributionWiener_ffd_1433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1434> AgradDistributionWiener_ffd_1434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1435> AgradDistributionWiener_ffd_1435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1436> AgradDistributionWiener_ffd_1436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1437> AgradDistributionWiener_ffd_1437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1438> AgradDistributionWiener_ffd_1438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1439> AgradDistributionWiener_ffd_1439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1440> AgradDistributionWiener_ffd_1440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1441> AgradDistributionWiener_ffd_1441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1442> AgradDistributionWiener_ffd_1442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1443> AgradDistributionWiener_ffd_1443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1444> AgradDistributionWiener_ffd_1444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1445> AgradDistributionWiener_ffd_1445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1446> AgradDistributionWiener_ffd_1446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1447> AgradDistributionWiener_ffd_1447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1448> AgradDistributionWiener_ffd_1448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1449> AgradDistributionWiener_ffd_1449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1450> AgradDistributionWiener_ffd_1450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1451> AgradDistributionWiener_ffd_1451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1452> AgradDistributionWiener_ffd_1452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1453> AgradDistributionWiener_ffd_1453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1454> AgradDistributionWiener_ffd_1454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1455> AgradDistributionWiener_ffd_1455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1456> AgradDistributionWiener_ffd_1456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1457> AgradDistributionWiener_ffd_1457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1458> AgradDistributionWiener_ffd_1458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1459> AgradDistributionWiener_ffd_1459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1460> AgradDistributionWiener_ffd_1460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1461> AgradDistributionWiener_ffd_1461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1462> AgradDistributionWiener_ffd_1462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1463> AgradDistributionWiener_ffd_1463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1464> AgradDistributionWiener_ffd_1464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1465> AgradDistributionWiener_ffd_1465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1466> AgradDistributionWiener_ffd_1466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1467> AgradDistributionWiener_ffd_1467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1468> AgradDistributionWiener_ffd_1468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1469> AgradDistributionWiener_ffd_1469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1470> AgradDistributionWiener_ffd_1470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1471> AgradDistributionWiener_ffd_1471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1472> AgradDistributionWiener_ffd_1472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1473> AgradDistributionWiener_ffd_1473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1474> AgradDistributionWiener_ffd_1474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1475> AgradDistributionWiener_ffd_1475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1476> AgradDistributionWiener_ffd_1476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1477> AgradDistributionWiener_ffd_1477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1478> AgradDistributionWiener_ffd_1478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1479> AgradDistributionWiener_ffd_1479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1480> AgradDistributionWiener_ffd_1480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1481> AgradDistributionWiener_ffd_1481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1482> AgradDistributionWiener_ffd_1482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1483> AgradDistributionWiener_ffd_1483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1484> AgradDistributionWiener_ffd_1484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1485> AgradDistributionWiener_ffd_1485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1486> AgradDistributionWiener_ffd_1486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1487> AgradDistributionWiener_ffd_1487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1488> AgradDistributionWiener_ffd_1488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1489> AgradDistributionWiener_ffd_1489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1490> AgradDistributionWiener_ffd_1490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1491> AgradDistributionWiener_ffd_1491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1492> AgradDistributionWiener_ffd_1492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1493> AgradDistributionWiener_ffd_1493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1494> AgradDistributionWiener_ffd_1494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1495> AgradDistributionWiener_ffd_1495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1496> AgradDistributionWiener_ffd_1496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1497> AgradDistributionWiener_ffd_1497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1498> AgradDistributionWiener_ffd_1498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_1499> AgradDistributionWiener_ffd_1499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1400, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1401, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1402, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1403, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1404, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1405, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1406, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1407, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1408, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1409, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1410, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1411, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1412, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1413, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1414, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1415, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1416, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1417, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1418, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1419, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1420, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1421, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1422, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1423, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1424, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1425, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1426, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1427, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1428, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1429, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1430, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1431, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1432, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1433, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1434, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1435, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1436, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1437, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1438, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1439, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1440, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1441, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1442, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1443, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1444, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1445, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1446, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1447, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1448, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1449, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1450, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1451, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1452, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1453, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1454, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1455, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1456, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1457, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1458, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1459, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1460, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1461, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1462, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1463, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1464, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1465, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1466, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1467, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1468, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1469, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1470, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1471, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1472, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1473, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1474, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1475, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1476, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1477, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1478, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1479, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1480, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1481, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1482, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1483, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1484, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1485, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1486, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1487, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1488, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1489, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1490, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1491, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1492, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1493, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1494, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1495, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1496, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1497, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1498, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_1499, AgradDistributionTestFixture, AgradDistributionWiener_ffd_1499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1500;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1501;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1502;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_1503;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1504;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1505;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1506;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1507;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1508;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1509;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1510;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1511;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1512;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1513;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1514;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1515;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1516;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1517;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1518;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1519;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1520;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_1521;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_1522;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1523;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_1524;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1525;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1526;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_1527;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_1528;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1529;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1530;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1531;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1532;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1533;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1534;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1535;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1536;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1537;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1538;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_1539;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1540;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1541;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1542;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1543;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1544;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1545;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1546;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1547;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1548;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1549;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1550;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1551;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1552;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1553;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1554;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1555;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1556;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1557;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1558;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1559;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1560;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1561;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1562;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1563;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1564;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1565;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1566;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1567;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1568;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1569;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1570;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1571;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1572;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1573;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1574;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1575;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1576;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1577;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1578;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1579;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1580;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1581;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1582;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1583;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1584;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1585;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1586;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1587;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1588;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1589;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1590;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1591;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1592;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty> type_ffv_1593;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1594;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1595;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1596;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1597;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1598;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1500> AgradDistributionWiener_ffv_1500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1501> AgradDistributionWiener_ffv_1501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1502> AgradDistributionWiener_ffv_1502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1503> AgradDistributionWiener_ffv_1503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1504> AgradDistributionWiener_ffv_1504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1505> AgradDistributionWiener_ffv_1505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1506> AgradDistributionWiener_ffv_1506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1507> AgradDistributionWiener_ffv_1507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1508> AgradDistributionWiener_ffv_1508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1509> AgradDistributionWiener_ffv_1509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1510> AgradDistributionWiener_ffv_1510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1511> AgradDistributionWiener_ffv_1511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1512> AgradDistributionWiener_ffv_1512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1513> AgradDistributionWiener_ffv_1513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1514> AgradDistributionWiener_ffv_1514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1515> AgradDistributionWiener_ffv_1515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1516> AgradDistributionWiener_ffv_1516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1517> AgradDistributionWiener_ffv_1517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1518> AgradDistributionWiener_ffv_1518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1519> AgradDistributionWiener_ffv_1519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1520> AgradDistributionWiener_ffv_1520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1521> AgradDistributionWiener_ffv_1521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1522> AgradDistributionWiener_ffv_1522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1523> AgradDistributionWiener_ffv_1523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1524> AgradDistributionWiener_ffv_1524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1525> AgradDistributionWiener_ffv_1525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1526> AgradDistributionWiener_ffv_1526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1527> AgradDistributionWiener_ffv_1527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1528> AgradDistributionWiener_ffv_1528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1529> AgradDistributionWiener_ffv_1529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1530> AgradDistributionWiener_ffv_1530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1531> AgradDistributionWiener_ffv_1531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1532> AgradDistributionWiener_ffv_1532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1533> AgradDistributionWiener_ffv_1533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1534> AgradDistributionWiener_ffv_1534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1535> AgradDistributionWiener_ffv_1535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1536> AgradDistributionWiener_ffv_1536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1537> AgradDistributionWiener_ffv_1537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1538> AgradDistributionWiener_ffv_1538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1539> AgradDistributionWiener_ffv_1539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1540> AgradDistributionWiener_ffv_1540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1541> AgradDistributionWiener_ffv_1541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1542> AgradDistributionWiener_ffv_1542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1543> AgradDistributionWiener_ffv_1543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1544> AgradDistributionWiener_ffv_1544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1545> AgradDistributionWiener_ffv_1545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1546> AgradDistributionWiener_ffv_1546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1547> AgradDistributionWiener_ffv_1547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1548> AgradDistributionWiener_ffv_1548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1549> AgradDistributionWiener_ffv_1549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1550> AgradDistributionWiener_ffv_1550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1551> AgradDistributionWiener_ffv_1551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1552> AgradDistributionWiener_ffv_1552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1553> AgradDistributionWiener_ffv_1553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1554> AgradDistributionWiener_ffv_1554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1555> AgradDistributionWiener_ffv_1555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1556> AgradDistributionWiener_ffv_1556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1557> AgradDistributionWiener_ffv_1557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1558> AgradDistributionWiener_ffv_1558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1559> AgradDistributionWiener_ffv_1559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1560> AgradDistributionWiener_ffv_1560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1561> AgradDistributionWiener_ffv_1561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1562> AgradDistributionWiener_ffv_1562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1563> AgradDistributionWiener_ffv_1563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1564> AgradDistributionWiener_ffv_1564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1565> AgradDistributionWiener_ffv_1565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1566> AgradDistributionWiener_ffv_1566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1567> AgradDistributionWiener_ffv_1567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1568> AgradDistributionWiener_ffv_1568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1569> AgradDistributionWiener_ffv_1569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1570> AgradDistributionWiener_ffv_1570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1571> AgradDistributionWiener_ffv_1571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1572> AgradDistributionWiener_ffv_1572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1573> AgradDistributionWiener_ffv_1573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1574> AgradDistributionWiener_ffv_1574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1575> AgradDistributionWiener_ffv_1575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1576> AgradDistributionWiener_ffv_1576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1577> AgradDistributionWiener_ffv_1577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1578> AgradDistributionWiener_ffv_1578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1579> AgradDistributionWiener_ffv_1579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1580> AgradDistributionWiener_ffv_1580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1581> AgradDistributionWiener_ffv_1581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1582> AgradDistributionWiener_ffv_1582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1583> AgradDistributionWiener_ffv_1583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1584> AgradDistributionWiener_ffv_1584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1585> AgradDistributionWiener_ffv_1585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1586> AgradDistributionWiener_ffv_1586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1587> AgradDistributionWiener_ffv_1587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1588> AgradDistributionWiener_ffv_1588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1589> AgradDistributionWiener_ffv_1589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1590> AgradDistributionWiener_ffv_1590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1591> AgradDistributionWiener_ffv_1591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1592> AgradDistributionWiener_ffv_1592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1593> AgradDistributionWiener_ffv_1593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1594> AgradDistributionWiener_ffv_1594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1595> AgradDistributionWiener_ffv_1595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1596> AgradDistributionWiener_ffv_1596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1597> AgradDistributionWiener_ffv_1597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1598> AgradDistributionWiener_ffv_1598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1599> AgradDistributionWiener_ffv_1599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1500, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1501, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1502, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1503, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1504, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1505, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1506, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1507, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1508, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1509, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1510, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1511, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1512, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1513, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1514, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1515, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1516, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1517, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1518, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1519, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1520, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1521, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1522, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1523, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1524, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1525, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1526, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1527, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1528, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1529, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1530, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1531, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1532, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1533, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1534, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1535, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1536, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1537, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1538, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1539, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1540, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1541, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1542, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1543, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1544, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1545, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1546, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1547, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1548, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1549, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1550, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1551, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1552, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1553, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1554, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1555, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1556, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1557, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1558, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1559, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1560, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1561, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1562, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1563, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1564, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1565, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1566, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1567, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1568, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1569, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1570, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1571, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1572, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1573, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1574, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1575, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1576, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1577, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1578, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1579, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1580, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1581, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1582, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1583, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1584, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1585, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1586, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1587, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1588, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1589, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1590, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1591, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1592, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1593, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1594, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1595, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1596, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1597, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1598, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1599, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1599);
+
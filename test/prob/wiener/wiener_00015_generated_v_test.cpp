@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_1500;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_1501;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1502;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_1503;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_1504;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1505;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1506;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1507;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1508;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1509;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1510;
+typedef boost::mpl::vector<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1511;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, double, empty> type_v_1512;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, std::vector<double>, empty> type_v_1513;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1514;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, var, empty> type_v_1515;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, std::vector<var>, empty> type_v_1516;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1517;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, double, empty> type_v_1518;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, std::vector<double>, empty> type_v_1519;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1520;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, var, empty> type_v_1521;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, std::vector<var>, empty> type_v_1522;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1523;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1524;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1525;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1526;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1527;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1528;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1529;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, var, double, empty> type_v_1530;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, var, std::vector<double>, empty> type_v_1531;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1532;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, var, var, empty> type_v_1533;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, var, std::vector<var>, empty> type_v_1534;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1535;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<var>, double, empty> type_v_1536;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<var>, std::vector<double>, empty> type_v_1537;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1538;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<var>, var, empty> type_v_1539;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<var>, std::vector<var>, empty> type_v_1540;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1541;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1542;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1543;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1544;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1545;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1546;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1547;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, double, empty> type_v_1548;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, std::vector<double>, empty> type_v_1549;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1550;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, var, empty> type_v_1551;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, std::vector<var>, empty> type_v_1552;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1553;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, double, empty> type_v_1554;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_1555;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1556;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, var, empty> type_v_1557;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_1558;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1559;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1560;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1561;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1562;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1563;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1564;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1565;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, var, double, empty> type_v_1566;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, var, std::vector<double>, empty> type_v_1567;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1568;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, var, var, empty> type_v_1569;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, var, std::vector<var>, empty> type_v_1570;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1571;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, double, empty> type_v_1572;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_1573;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1574;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, var, empty> type_v_1575;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_1576;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1577;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1578;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1579;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1580;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1581;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1582;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1583;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_1584;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_1585;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1586;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_1587;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_1588;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1589;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_1590;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_1591;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1592;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_1593;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_1594;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1595;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1596;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1597;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1598;
+typedef boost::mpl::vector<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1500> AgradDistributionWiener_v_1500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1501> AgradDistributionWiener_v_1501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1502> AgradDistributionWiener_v_1502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1503> AgradDistributionWiener_v_1503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1504> AgradDistributionWiener_v_1504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1505> AgradDistributionWiener_v_1505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1506> AgradDistributionWiener_v_1506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1507> AgradDistributionWiener_v_1507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1508> AgradDistributionWiener_v_1508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1509> AgradDistributionWiener_v_1509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1510> AgradDistributionWiener_v_1510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1511> AgradDistributionWiener_v_1511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1512> AgradDistributionWiener_v_1512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1513> AgradDistributionWiener_v_1513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1514> AgradDistributionWiener_v_1514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1515> AgradDistributionWiener_v_1515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1516> AgradDistributionWiener_v_1516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1517> AgradDistributionWiener_v_1517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1518> AgradDistributionWiener_v_1518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1519> AgradDistributionWiener_v_1519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1520> AgradDistributionWiener_v_1520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1521> AgradDistributionWiener_v_1521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1522> AgradDistributionWiener_v_1522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1523> AgradDistributionWiener_v_1523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1524> AgradDistributionWiener_v_1524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1525> AgradDistributionWiener_v_1525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1526> AgradDistributionWiener_v_1526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1527> AgradDistributionWiener_v_1527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1528> AgradDistributionWiener_v_1528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1529> AgradDistributionWiener_v_1529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1530> AgradDistributionWiener_v_1530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1531> AgradDistributionWiener_v_1531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1532> AgradDistributionWiener_v_1532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1533> AgradDistributionWiener_v_1533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1534> AgradDistributionWiener_v_1534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1535> AgradDistributionWiener_v_1535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1536> AgradDistributionWiener_v_1536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1537> AgradDistributionWiener_v_1537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1538> AgradDistributionWiener_v_1538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1539> AgradDistributionWiener_v_1539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1540> AgradDistributionWiener_v_1540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1541> AgradDistributionWiener_v_1541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1542> AgradDistributionWiener_v_1542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1543> AgradDistributionWiener_v_1543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1544> AgradDistributionWiener_v_1544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1545> AgradDistributionWiener_v_1545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1546> AgradDistributionWiener_v_1546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1547> AgradDistributionWiener_v_1547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1548> AgradDistributionWiener_v_1548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1549> AgradDistributionWiener_v_1549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1550> AgradDistributionWiener_v_1550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1551> AgradDistributionWiener_v_1551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1552> AgradDistributionWiener_v_1552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1553> AgradDistributionWiener_v_1553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1554> AgradDistributionWiener_v_1554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1555> AgradDistributionWiener_v_1555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1556> AgradDistributionWiener_v_1556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1557> AgradDistributionWiener_v_1557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1558> AgradDistributionWiener_v_1558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1559> AgradDistributionWiener_v_1559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1560> AgradDistributionWiener_v_1560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1561> AgradDistributionWiener_v_1561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1562> AgradDistributionWiener_v_1562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1563> AgradDistributionWiener_v_1563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1564> AgradDistributionWiener_v_1564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1565> AgradDistributionWiener_v_1565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1566> AgradDistributionWiener_v_1566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1567> AgradDistributionWiener_v_1567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1568> AgradDistributionWiener_v_1568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1569> AgradDistributionWiener_v_1569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1570> AgradDistributionWiener_v_1570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1571> AgradDistributionWiener_v_1571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1572> AgradDistributionWiener_v_1572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1573> AgradDistributionWiener_v_1573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1574> AgradDistributionWiener_v_1574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1575> AgradDistributionWiener_v_1575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1576> AgradDistributionWiener_v_1576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1577> AgradDistributionWiener_v_1577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1578> AgradDistributionWiener_v_1578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1579> AgradDistributionWiener_v_1579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1580> AgradDistributionWiener_v_1580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1581> AgradDistributionWiener_v_1581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1582> AgradDistributionWiener_v_1582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1583> AgradDistributionWiener_v_1583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1584> AgradDistributionWiener_v_1584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1585> AgradDistributionWiener_v_1585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1586> AgradDistributionWiener_v_1586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1587> AgradDistributionWiener_v_1587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1588> AgradDistributionWiener_v_1588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1589> AgradDistributionWiener_v_1589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1590> AgradDistributionWiener_v_1590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1591> AgradDistributionWiener_v_1591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1592> AgradDistributionWiener_v_1592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1593> AgradDistributionWiener_v_1593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1594> AgradDistributionWiener_v_1594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1595> AgradDistributionWiener_v_1595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1596> AgradDistributionWiener_v_1596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1597> AgradDistributionWiener_v_1597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1598> AgradDistributionWiener_v_1598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1599> AgradDistributionWiener_v_1599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1500, AgradDistributionTestFixture, AgradDistributionWiener_v_1500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1501, AgradDistributionTestFixture, AgradDistributionWiener_v_1501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1502, AgradDistributionTestFixture, AgradDistributionWiener_v_1502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1503, AgradDistributionTestFixture, AgradDistributionWiener_v_1503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1504, AgradDistributionTestFixture, AgradDistributionWiener_v_1504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1505, AgradDistributionTestFixture, AgradDistributionWiener_v_1505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1506, AgradDistributionTestFixture, AgradDistributionWiener_v_1506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1507, AgradDistributionTestFixture, AgradDistributionWiener_v_1507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1508, AgradDistributionTestFixture, AgradDistributionWiener_v_1508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1509, AgradDistributionTestFixture, AgradDistributionWiener_v_1509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1510, AgradDistributionTestFixture, AgradDistributionWiener_v_1510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1511, AgradDistributionTestFixture, AgradDistributionWiener_v_1511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1512, AgradDistributionTestFixture, AgradDistributionWiener_v_1512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1513, AgradDistributionTestFixture, AgradDistributionWiener_v_1513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1514, AgradDistributionTestFixture, AgradDistributionWiener_v_1514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1515, AgradDistributionTestFixture, AgradDistributionWiener_v_1515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1516, AgradDistributionTestFixture, AgradDistributionWiener_v_1516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1517, AgradDistributionTestFixture, AgradDistributionWiener_v_1517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1518, AgradDistributionTestFixture, AgradDistributionWiener_v_1518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1519, AgradDistributionTestFixture, AgradDistributionWiener_v_1519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1520, AgradDistributionTestFixture, AgradDistributionWiener_v_1520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1521, AgradDistributionTestFixture, AgradDistributionWiener_v_1521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1522, AgradDistributionTestFixture, AgradDistributionWiener_v_1522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1523, AgradDistributionTestFixture, AgradDistributionWiener_v_1523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1524, AgradDistributionTestFixture, AgradDistributionWiener_v_1524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1525, AgradDistributionTestFixture, AgradDistributionWiener_v_1525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1526, AgradDistributionTestFixture, AgradDistributionWiener_v_1526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1527, AgradDistributionTestFixture, AgradDistributionWiener_v_1527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1528, AgradDistributionTestFixture, AgradDistributionWiener_v_1528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1529, AgradDistributionTestFixture, AgradDistributionWiener_v_1529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1530, AgradDistributionTestFixture, AgradDistributionWiener_v_1530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1531, AgradDistributionTestFixture, AgradDistributionWiener_v_1531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1532, AgradDistributionTestFixture, AgradDistributionWiener_v_1532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1533, AgradDistributionTestFixture, AgradDistributionWiener_v_1533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1534, AgradDistributionTestFixture, AgradDistributionWiener_v_1534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1535, AgradDistributionTestFixture, AgradDistributionWiener_v_1535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1536, AgradDistributionTestFixture, AgradDistributionWiener_v_1536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1537, AgradDistributionTestFixture, AgradDistributionWiener_v_1537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1538, AgradDistributionTestFixture, AgradDistributionWiener_v_1538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1539, AgradDistributionTestFixture, AgradDistributionWiener_v_1539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1540, AgradDistributionTestFixture, AgradDistributionWiener_v_1540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1541, AgradDistributionTestFixture, AgradDistributionWiener_v_1541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1542, AgradDistributionTestFixture, AgradDistributionWiener_v_1542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1543, AgradDistributionTestFixture, AgradDistributionWiener_v_1543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1544, AgradDistributionTestFixture, AgradDistributionWiener_v_1544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1545, AgradDistributionTestFixture, AgradDistributionWiener_v_1545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1546, AgradDistributionTestFixture, AgradDistributionWiener_v_1546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1547, AgradDistributionTestFixture, AgradDistributionWiener_v_1547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1548, AgradDistributionTestFixture, AgradDistributionWiener_v_1548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1549, AgradDistributionTestFixture, AgradDistributionWiener_v_1549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1550, AgradDistributionTestFixture, AgradDistributionWiener_v_1550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1551, AgradDistributionTestFixture, AgradDistributionWiener_v_1551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1552, AgradDistributionTestFixture, AgradDistributionWiener_v_1552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1553, AgradDistributionTestFixture, AgradDistributionWiener_v_1553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1554, AgradDistributionTestFixture, AgradDistributionWiener_v_1554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1555, AgradDistributionTestFixture, AgradDistributionWiener_v_1555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1556, AgradDistributionTestFixture, AgradDistributionWiener_v_1556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1557, AgradDistributionTestFixture, AgradDistributionWiener_v_1557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1558, AgradDistributionTestFixture, AgradDistributionWiener_v_1558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1559, AgradDistributionTestFixture, AgradDistributionWiener_v_1559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1560, AgradDistributionTestFixture, AgradDistributionWiener_v_1560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1561, AgradDistributionTestFixture, AgradDistributionWiener_v_1561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1562, AgradDistributionTestFixture, AgradDistributionWiener_v_1562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1563, AgradDistributionTestFixture, AgradDistributionWiener_v_1563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1564, AgradDistributionTestFixture, AgradDistributionWiener_v_1564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1565, AgradDistributionTestFixture, AgradDistributionWiener_v_1565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1566, AgradDistributionTestFixture, AgradDistributionWiener_v_1566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1567, AgradDistributionTestFixture, AgradDistributionWiener_v_1567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1568, AgradDistributionTestFixture, AgradDistributionWiener_v_1568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1569, AgradDistributionTestFixture, AgradDistributionWiener_v_1569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1570, AgradDistributionTestFixture, AgradDistributionWiener_v_1570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1571, AgradDistributionTestFixture, AgradDistributionWiener_v_1571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1572, AgradDistributionTestFixture, AgradDistributionWiener_v_1572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1573, AgradDistributionTestFixture, AgradDistributionWiener_v_1573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1574, AgradDistributionTestFixture, AgradDistributionWiener_v_1574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1575, AgradDistributionTestFixture, AgradDistributionWiener_v_1575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1576, AgradDistributionTestFixture, AgradDistributionWiener_v_1576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1577, AgradDistributionTestFixture, AgradDistributionWiener_v_1577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1578, AgradDistributionTestFixture, AgradDistributionWiener_v_1578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1579, AgradDistributionTestFixture, AgradDistributionWiener_v_1579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1580, AgradDistributionTestFixture, AgradDistributionWiener_v_1580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1581, AgradDistributionTestFixture, AgradDistributionWiener_v_1581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1582, AgradDistributionTestFixture, AgradDistributionWiener_v_1582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1583, AgradDistributionTestFixture, AgradDistributionWiener_v_1583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1584, AgradDistributionTestFixture, AgradDistributionWiener_v_1584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1585, AgradDistributionTestFixture, AgradDistributionWiener_v_1585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1586, AgradDistributionTestFixture, AgradDistributionWiener_v_1586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1587, AgradDistributionTestFixture, AgradDistributionWiener_v_1587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1588, AgradDistributionTestFixture, AgradDistributionWiener_v_1588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1589, AgradDistributionTestFixture, AgradDistributionWiener_v_1589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1590, AgradDistributionTestFixture, AgradDistributionWiener_v_1590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1591, AgradDistributionTestFixture, AgradDistributionWiener_v_1591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1592, AgradDistributionTestFixture, AgradDistributionWiener_v_1592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1593, AgradDistributionTestFixture, AgradDistributionWiener_v_1593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1594, AgradDistributionTestFixture, AgradDistributionWiener_v_1594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1595, AgradDistributionTestFixture, AgradDistributionWiener_v_1595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1596, AgradDistributionTestFixture, AgradDistributionWiener_v_1596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1597, AgradDistributionTestFixture, AgradDistributionWiener_v_1597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1598, AgradDistributionTestFixture, AgradDistributionWiener_v_1598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1599, AgradDistributionTestFixture, AgradDistributionWiener_v_1599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1600;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1601;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty> type_ffv_1602;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1603;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1604;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1605;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1606;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1607;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1608;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1609;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1610;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1611;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1612;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1613;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1614;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1615;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1616;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1617;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1618;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1619;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_1620;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1621;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1622;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1623;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1624;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1625;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1626;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1627;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1628;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_1629;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1630;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1631;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1632;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1633;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1634;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1635;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1636;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1637;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1638;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1639;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1640;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1641;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1642;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1643;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1644;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1645;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1646;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1647;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1648;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1649;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1650;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1651;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1652;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1653;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1654;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1655;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1656;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1657;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1658;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1659;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1660;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1661;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1662;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1663;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1664;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1665;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1666;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1667;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1668;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1669;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1670;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1671;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1672;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1673;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty> type_ffv_1674;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_1675;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1676;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_1677;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1678;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1679;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_1680;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_1681;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1682;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1683;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1684;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1685;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1686;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1687;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1688;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1689;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1690;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1691;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_1692;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1693;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1694;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1695;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1696;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1697;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1698;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1600> AgradDistributionWiener_ffv_1600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1601> AgradDistributionWiener_ffv_1601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1602> AgradDistributionWiener_ffv_1602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1603> AgradDistributionWiener_ffv_1603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1604> AgradDistributionWiener_ffv_1604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1605> AgradDistributionWiener_ffv_1605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1606> AgradDistributionWiener_ffv_1606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1607> AgradDistributionWiener_ffv_1607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1608> AgradDistributionWiener_ffv_1608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1609> AgradDistributionWiener_ffv_1609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1610> AgradDistributionWiener_ffv_1610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1611> AgradDistributionWiener_ffv_1611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1612> AgradDistributionWiener_ffv_1612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1613> AgradDistributionWiener_ffv_1613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1614> AgradDistributionWiener_ffv_1614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1615> AgradDistributionWiener_ffv_1615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1616> AgradDistributionWiener_ffv_1616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1617> AgradDistributionWiener_ffv_1617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1618> AgradDistributionWiener_ffv_1618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1619> AgradDistributionWiener_ffv_1619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1620> AgradDistributionWiener_ffv_1620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1621> AgradDistributionWiener_ffv_1621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1622> AgradDistributionWiener_ffv_1622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1623> AgradDistributionWiener_ffv_1623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1624> AgradDistributionWiener_ffv_1624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1625> AgradDistributionWiener_ffv_1625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1626> AgradDistributionWiener_ffv_1626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1627> AgradDistributionWiener_ffv_1627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1628> AgradDistributionWiener_ffv_1628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1629> AgradDistributionWiener_ffv_1629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1630> AgradDistributionWiener_ffv_1630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1631> AgradDistributionWiener_ffv_1631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1632> AgradDistributionWiener_ffv_1632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1633> AgradDistributionWiener_ffv_1633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1634> AgradDistributionWiener_ffv_1634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1635> AgradDistributionWiener_ffv_1635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1636> AgradDistributionWiener_ffv_1636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1637> AgradDistributionWiener_ffv_1637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1638> AgradDistributionWiener_ffv_1638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1639> AgradDistributionWiener_ffv_1639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1640> AgradDistributionWiener_ffv_1640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1641> AgradDistributionWiener_ffv_1641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1642> AgradDistributionWiener_ffv_1642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1643> AgradDistributionWiener_ffv_1643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1644> AgradDistributionWiener_ffv_1644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1645> AgradDistributionWiener_ffv_1645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1646> AgradDistributionWiener_ffv_1646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1647> AgradDistributionWiener_ffv_1647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1648> AgradDistributionWiener_ffv_1648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1649> AgradDistributionWiener_ffv_1649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1650> AgradDistributionWiener_ffv_1650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1651> AgradDistributionWiener_ffv_1651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1652> AgradDistributionWiener_ffv_1652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1653> AgradDistributionWiener_ffv_1653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1654> AgradDistributionWiener_ffv_1654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1655> AgradDistributionWiener_ffv_1655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1656> AgradDistributionWiener_ffv_1656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1657> AgradDistributionWiener_ffv_1657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1658> AgradDistributionWiener_ffv_1658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1659> AgradDistributionWiener_ffv_1659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1660> AgradDistributionWiener_ffv_1660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1661> AgradDistributionWiener_ffv_1661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1662> AgradDistributionWiener_ffv_1662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1663> AgradDistributionWiener_ffv_1663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1664> AgradDistributionWiener_ffv_1664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1665> AgradDistributionWiener_ffv_1665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1666> AgradDistributionWiener_ffv_1666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1667> AgradDistributionWiener_ffv_1667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1668> AgradDistributionWiener_ffv_1668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1669> AgradDistributionWiener_ffv_1669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1670> AgradDistributionWiener_ffv_1670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1671> AgradDistributionWiener_ffv_1671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1672> AgradDistributionWiener_ffv_1672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1673> AgradDistributionWiener_ffv_1673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1674> AgradDistributionWiener_ffv_1674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1675> AgradDistributionWiener_ffv_1675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1676> AgradDistributionWiener_ffv_1676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1677> AgradDistributionWiener_ffv_1677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1678> AgradDistributionWiener_ffv_1678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1679> AgradDistributionWiener_ffv_1679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1680> AgradDistributionWiener_ffv_1680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1681> AgradDistributionWiener_ffv_1681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1682> AgradDistributionWiener_ffv_1682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1683> AgradDistributionWiener_ffv_1683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1684> AgradDistributionWiener_ffv_1684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1685> AgradDistributionWiener_ffv_1685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1686> AgradDistributionWiener_ffv_1686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1687> AgradDistributionWiener_ffv_1687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1688> AgradDistributionWiener_ffv_1688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1689> AgradDistributionWiener_ffv_1689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1690> AgradDistributionWiener_ffv_1690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1691> AgradDistributionWiener_ffv_1691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1692> AgradDistributionWiener_ffv_1692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1693> AgradDistributionWiener_ffv_1693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1694> AgradDistributionWiener_ffv_1694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1695> AgradDistributionWiener_ffv_1695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1696> AgradDistributionWiener_ffv_1696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1697> AgradDistributionWiener_ffv_1697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1698> AgradDistributionWiener_ffv_1698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1699> AgradDistributionWiener_ffv_1699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1600, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1601, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1602, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1603, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1604, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1605, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1606, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1607, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1608, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1609, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1610, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1611, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1612, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1613, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1614, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1615, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1616, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1617, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1618, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1619, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1620, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1621, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1622, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1623, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1624, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1625, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1626, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1627, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1628, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1629, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1630, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1631, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1632, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1633, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1634, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1635, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1636, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1637, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1638, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1639, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1640, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1641, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1642, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1643, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1644, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1645, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1646, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1647, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1648, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1649, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1650, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1651, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1652, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1653, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1654, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1655, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1656, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1657, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1658, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1659, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1660, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1661, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1662, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1663, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1664, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1665, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1666, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1667, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1668, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1669, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1670, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1671, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1672, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1673, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1674, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1675, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1676, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1677, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1678, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1679, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1680, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1681, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1682, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1683, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1684, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1685, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1686, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1687, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1688, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1689, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1690, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1691, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1692, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1693, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1694, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1695, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1696, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1697, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1698, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1699, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1699);
+
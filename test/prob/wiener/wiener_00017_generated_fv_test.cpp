@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1700;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1701;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1702;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1703;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1704;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1705;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1706;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1707;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1708;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1709;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, empty> type_fv_1710;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_1711;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1712;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_1713;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_1714;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1715;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_1716;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_1717;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1718;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_1719;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1720;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1721;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1722;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1723;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1724;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1725;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1726;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1727;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_1728;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_1729;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1730;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_1731;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1732;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1733;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_1734;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1735;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1736;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1737;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1738;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1739;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1740;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1741;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1742;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1743;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1744;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1745;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_1746;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_1747;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1748;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_1749;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_1750;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1751;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_1752;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_1753;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1754;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_1755;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1756;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1757;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1758;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1759;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1760;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1761;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1762;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1763;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_1764;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_1765;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1766;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_1767;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1768;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1769;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_1770;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1771;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1772;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1773;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1774;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1775;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1776;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1777;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1778;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1779;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1780;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1781;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, double, double, empty> type_fv_1782;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, double, std::vector<double>, empty> type_fv_1783;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1784;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, double, fvar<var>, empty> type_fv_1785;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, double, std::vector<fvar<var>>, empty> type_fv_1786;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1787;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<double>, double, empty> type_fv_1788;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<double>, std::vector<double>, empty> type_fv_1789;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1790;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<double>, fvar<var>, empty> type_fv_1791;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1792;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1793;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1794;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1795;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1796;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1797;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1798;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1700> AgradDistributionWiener_fv_1700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1701> AgradDistributionWiener_fv_1701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1702> AgradDistributionWiener_fv_1702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1703> AgradDistributionWiener_fv_1703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1704> AgradDistributionWiener_fv_1704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1705> AgradDistributionWiener_fv_1705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1706> AgradDistributionWiener_fv_1706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1707> AgradDistributionWiener_fv_1707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1708> AgradDistributionWiener_fv_1708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1709> AgradDistributionWiener_fv_1709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1710> AgradDistributionWiener_fv_1710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1711> AgradDistributionWiener_fv_1711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1712> AgradDistributionWiener_fv_1712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1713> AgradDistributionWiener_fv_1713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1714> AgradDistributionWiener_fv_1714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1715> AgradDistributionWiener_fv_1715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1716> AgradDistributionWiener_fv_1716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1717> AgradDistributionWiener_fv_1717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1718> AgradDistributionWiener_fv_1718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1719> AgradDistributionWiener_fv_1719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1720> AgradDistributionWiener_fv_1720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1721> AgradDistributionWiener_fv_1721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1722> AgradDistributionWiener_fv_1722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1723> AgradDistributionWiener_fv_1723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1724> AgradDistributionWiener_fv_1724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1725> AgradDistributionWiener_fv_1725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1726> AgradDistributionWiener_fv_1726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1727> AgradDistributionWiener_fv_1727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1728> AgradDistributionWiener_fv_1728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1729> AgradDistributionWiener_fv_1729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1730> AgradDistributionWiener_fv_1730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1731> AgradDistributionWiener_fv_1731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1732> AgradDistributionWiener_fv_1732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1733> AgradDistributionWiener_fv_1733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1734> AgradDistributionWiener_fv_1734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1735> AgradDistributionWiener_fv_1735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1736> AgradDistributionWiener_fv_1736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1737> AgradDistributionWiener_fv_1737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1738> AgradDistributionWiener_fv_1738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1739> AgradDistributionWiener_fv_1739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1740> AgradDistributionWiener_fv_1740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1741> AgradDistributionWiener_fv_1741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1742> AgradDistributionWiener_fv_1742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1743> AgradDistributionWiener_fv_1743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1744> AgradDistributionWiener_fv_1744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1745> AgradDistributionWiener_fv_1745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1746> AgradDistributionWiener_fv_1746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1747> AgradDistributionWiener_fv_1747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1748> AgradDistributionWiener_fv_1748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1749> AgradDistributionWiener_fv_1749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1750> AgradDistributionWiener_fv_1750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1751> AgradDistributionWiener_fv_1751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1752> AgradDistributionWiener_fv_1752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1753> AgradDistributionWiener_fv_1753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1754> AgradDistributionWiener_fv_1754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1755> AgradDistributionWiener_fv_1755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1756> AgradDistributionWiener_fv_1756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1757> AgradDistributionWiener_fv_1757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1758> AgradDistributionWiener_fv_1758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1759> AgradDistributionWiener_fv_1759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1760> AgradDistributionWiener_fv_1760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1761> AgradDistributionWiener_fv_1761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1762> AgradDistributionWiener_fv_1762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1763> AgradDistributionWiener_fv_1763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1764> AgradDistributionWiener_fv_1764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1765> AgradDistributionWiener_fv_1765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1766> AgradDistributionWiener_fv_1766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1767> AgradDistributionWiener_fv_1767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1768> AgradDistributionWiener_fv_1768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1769> AgradDistributionWiener_fv_1769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1770> AgradDistributionWiener_fv_1770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1771> AgradDistributionWiener_fv_1771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1772> AgradDistributionWiener_fv_1772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1773> AgradDistributionWiener_fv_1773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1774> AgradDistributionWiener_fv_1774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1775> AgradDistributionWiener_fv_1775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1776> AgradDistributionWiener_fv_1776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1777> AgradDistributionWiener_fv_1777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1778> AgradDistributionWiener_fv_1778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1779> AgradDistributionWiener_fv_1779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1780> AgradDistributionWiener_fv_1780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1781> AgradDistributionWiener_fv_1781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1782> AgradDistributionWiener_fv_1782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1783> AgradDistributionWiener_fv_1783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1784> AgradDistributionWiener_fv_1784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1785> AgradDistributionWiener_fv_1785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1786> AgradDistributionWiener_fv_1786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1787> AgradDistributionWiener_fv_1787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1788> AgradDistributionWiener_fv_1788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1789> AgradDistributionWiener_fv_1789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1790> AgradDistributionWiener_fv_1790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1791> AgradDistributionWiener_fv_1791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1792> AgradDistributionWiener_fv_1792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1793> AgradDistributionWiener_fv_1793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1794> AgradDistributionWiener_fv_1794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1795> AgradDistributionWiener_fv_1795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1796> AgradDistributionWiener_fv_1796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1797> AgradDistributionWiener_fv_1797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1798> AgradDistributionWiener_fv_1798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1799> AgradDistributionWiener_fv_1799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1700, AgradDistributionTestFixture, AgradDistributionWiener_fv_1700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1701, AgradDistributionTestFixture, AgradDistributionWiener_fv_1701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1702, AgradDistributionTestFixture, AgradDistributionWiener_fv_1702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1703, AgradDistributionTestFixture, AgradDistributionWiener_fv_1703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1704, AgradDistributionTestFixture, AgradDistributionWiener_fv_1704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1705, AgradDistributionTestFixture, AgradDistributionWiener_fv_1705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1706, AgradDistributionTestFixture, AgradDistributionWiener_fv_1706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1707, AgradDistributionTestFixture, AgradDistributionWiener_fv_1707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1708, AgradDistributionTestFixture, AgradDistributionWiener_fv_1708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1709, AgradDistributionTestFixture, AgradDistributionWiener_fv_1709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1710, AgradDistributionTestFixture, AgradDistributionWiener_fv_1710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1711, AgradDistributionTestFixture, AgradDistributionWiener_fv_1711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1712, AgradDistributionTestFixture, AgradDistributionWiener_fv_1712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1713, AgradDistributionTestFixture, AgradDistributionWiener_fv_1713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1714, AgradDistributionTestFixture, AgradDistributionWiener_fv_1714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1715, AgradDistributionTestFixture, AgradDistributionWiener_fv_1715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1716, AgradDistributionTestFixture, AgradDistributionWiener_fv_1716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1717, AgradDistributionTestFixture, AgradDistributionWiener_fv_1717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1718, AgradDistributionTestFixture, AgradDistributionWiener_fv_1718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1719, AgradDistributionTestFixture, AgradDistributionWiener_fv_1719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1720, AgradDistributionTestFixture, AgradDistributionWiener_fv_1720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1721, AgradDistributionTestFixture, AgradDistributionWiener_fv_1721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1722, AgradDistributionTestFixture, AgradDistributionWiener_fv_1722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1723, AgradDistributionTestFixture, AgradDistributionWiener_fv_1723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1724, AgradDistributionTestFixture, AgradDistributionWiener_fv_1724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1725, AgradDistributionTestFixture, AgradDistributionWiener_fv_1725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1726, AgradDistributionTestFixture, AgradDistributionWiener_fv_1726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1727, AgradDistributionTestFixture, AgradDistributionWiener_fv_1727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1728, AgradDistributionTestFixture, AgradDistributionWiener_fv_1728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1729, AgradDistributionTestFixture, AgradDistributionWiener_fv_1729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1730, AgradDistributionTestFixture, AgradDistributionWiener_fv_1730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1731, AgradDistributionTestFixture, AgradDistributionWiener_fv_1731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1732, AgradDistributionTestFixture, AgradDistributionWiener_fv_1732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1733, AgradDistributionTestFixture, AgradDistributionWiener_fv_1733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1734, AgradDistributionTestFixture, AgradDistributionWiener_fv_1734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1735, AgradDistributionTestFixture, AgradDistributionWiener_fv_1735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1736, AgradDistributionTestFixture, AgradDistributionWiener_fv_1736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1737, AgradDistributionTestFixture, AgradDistributionWiener_fv_1737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1738, AgradDistributionTestFixture, AgradDistributionWiener_fv_1738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1739, AgradDistributionTestFixture, AgradDistributionWiener_fv_1739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1740, AgradDistributionTestFixture, AgradDistributionWiener_fv_1740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1741, AgradDistributionTestFixture, AgradDistributionWiener_fv_1741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1742, AgradDistributionTestFixture, AgradDistributionWiener_fv_1742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1743, AgradDistributionTestFixture, AgradDistributionWiener_fv_1743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1744, AgradDistributionTestFixture, AgradDistributionWiener_fv_1744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1745, AgradDistributionTestFixture, AgradDistributionWiener_fv_1745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1746, AgradDistributionTestFixture, AgradDistributionWiener_fv_1746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1747, AgradDistributionTestFixture, AgradDistributionWiener_fv_1747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1748, AgradDistributionTestFixture, AgradDistributionWiener_fv_1748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1749, AgradDistributionTestFixture, AgradDistributionWiener_fv_1749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1750, AgradDistributionTestFixture, AgradDistributionWiener_fv_1750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1751, AgradDistributionTestFixture, AgradDistributionWiener_fv_1751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1752, AgradDistributionTestFixture, AgradDistributionWiener_fv_1752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1753, AgradDistributionTestFixture, AgradDistributionWiener_fv_1753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1754, AgradDistributionTestFixture, AgradDistributionWiener_fv_1754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1755, AgradDistributionTestFixture, AgradDistributionWiener_fv_1755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1756, AgradDistributionTestFixture, AgradDistributionWiener_fv_1756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1757, AgradDistributionTestFixture, AgradDistributionWiener_fv_1757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1758, AgradDistributionTestFixture, AgradDistributionWiener_fv_1758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1759, AgradDistributionTestFixture, AgradDistributionWiener_fv_1759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1760, AgradDistributionTestFixture, AgradDistributionWiener_fv_1760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1761, AgradDistributionTestFixture, AgradDistributionWiener_fv_1761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1762, AgradDistributionTestFixture, AgradDistributionWiener_fv_1762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1763, AgradDistributionTestFixture, AgradDistributionWiener_fv_1763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1764, AgradDistributionTestFixture, AgradDistributionWiener_fv_1764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1765, AgradDistributionTestFixture, AgradDistributionWiener_fv_1765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1766, AgradDistributionTestFixture, AgradDistributionWiener_fv_1766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1767, AgradDistributionTestFixture, AgradDistributionWiener_fv_1767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1768, AgradDistributionTestFixture, AgradDistributionWiener_fv_1768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1769, AgradDistributionTestFixture, AgradDistributionWiener_fv_1769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1770, AgradDistributionTestFixture, AgradDistributionWiener_fv_1770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1771, AgradDistributionTestFixture, AgradDistributionWiener_fv_1771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1772, AgradDistributionTestFixture, AgradDistributionWiener_fv_1772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1773, AgradDistributionTestFixture, AgradDistributionWiener_fv_1773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1774, AgradDistributionTestFixture, AgradDistributionWiener_fv_1774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1775, AgradDistributionTestFixture, AgradDistributionWiener_fv_1775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1776, AgradDistributionTestFixture, AgradDistributionWiener_fv_1776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1777, AgradDistributionTestFixture, AgradDistributionWiener_fv_1777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1778, AgradDistributionTestFixture, AgradDistributionWiener_fv_1778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1779, AgradDistributionTestFixture, AgradDistributionWiener_fv_1779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1780, AgradDistributionTestFixture, AgradDistributionWiener_fv_1780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1781, AgradDistributionTestFixture, AgradDistributionWiener_fv_1781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1782, AgradDistributionTestFixture, AgradDistributionWiener_fv_1782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1783, AgradDistributionTestFixture, AgradDistributionWiener_fv_1783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1784, AgradDistributionTestFixture, AgradDistributionWiener_fv_1784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1785, AgradDistributionTestFixture, AgradDistributionWiener_fv_1785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1786, AgradDistributionTestFixture, AgradDistributionWiener_fv_1786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1787, AgradDistributionTestFixture, AgradDistributionWiener_fv_1787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1788, AgradDistributionTestFixture, AgradDistributionWiener_fv_1788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1789, AgradDistributionTestFixture, AgradDistributionWiener_fv_1789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1790, AgradDistributionTestFixture, AgradDistributionWiener_fv_1790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1791, AgradDistributionTestFixture, AgradDistributionWiener_fv_1791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1792, AgradDistributionTestFixture, AgradDistributionWiener_fv_1792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1793, AgradDistributionTestFixture, AgradDistributionWiener_fv_1793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1794, AgradDistributionTestFixture, AgradDistributionWiener_fv_1794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1795, AgradDistributionTestFixture, AgradDistributionWiener_fv_1795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1796, AgradDistributionTestFixture, AgradDistributionWiener_fv_1796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1797, AgradDistributionTestFixture, AgradDistributionWiener_fv_1797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1798, AgradDistributionTestFixture, AgradDistributionWiener_fv_1798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1799, AgradDistributionTestFixture, AgradDistributionWiener_fv_1799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty> type_ffv_1800;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1801;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1802;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1803;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1804;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1805;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1806;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1807;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1808;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1809;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1810;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1811;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1812;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1813;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1814;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1815;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1816;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1817;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, double, empty> type_ffv_1818;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty> type_ffv_1819;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1820;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_1821;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1822;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1823;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty> type_ffv_1824;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_1825;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1826;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1827;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1828;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1829;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1830;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1831;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1832;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1833;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1834;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1835;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_1836;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1837;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1838;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1839;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1840;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1841;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1842;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1843;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1844;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1845;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1846;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1847;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1848;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1849;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1850;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1851;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1852;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1853;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1854;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1855;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1856;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1857;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1858;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1859;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1860;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1861;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1862;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1863;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1864;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1865;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1866;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1867;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1868;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1869;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1870;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1871;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1872;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1873;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1874;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1875;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1876;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1877;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1878;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1879;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1880;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1881;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1882;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1883;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1884;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1885;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1886;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1887;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1888;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1889;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty> type_ffv_1890;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_1891;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1892;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_1893;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1894;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1895;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_1896;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_1897;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1898;
+typedef boost::mpl::vector<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1800> AgradDistributionWiener_ffv_1800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1801> AgradDistributionWiener_ffv_1801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1802> AgradDistributionWiener_ffv_1802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1803> AgradDistributionWiener_ffv_1803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1804> AgradDistributionWiener_ffv_1804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1805> AgradDistributionWiener_ffv_1805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1806> AgradDistributionWiener_ffv_1806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1807> AgradDistributionWiener_ffv_1807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1808> AgradDistributionWiener_ffv_1808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1809> AgradDistributionWiener_ffv_1809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1810> AgradDistributionWiener_ffv_1810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1811> AgradDistributionWiener_ffv_1811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1812> AgradDistributionWiener_ffv_1812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1813> AgradDistributionWiener_ffv_1813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1814> AgradDistributionWiener_ffv_1814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1815> AgradDistributionWiener_ffv_1815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1816> AgradDistributionWiener_ffv_1816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1817> AgradDistributionWiener_ffv_1817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1818> AgradDistributionWiener_ffv_1818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1819> AgradDistributionWiener_ffv_1819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1820> AgradDistributionWiener_ffv_1820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1821> AgradDistributionWiener_ffv_1821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1822> AgradDistributionWiener_ffv_1822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1823> AgradDistributionWiener_ffv_1823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1824> AgradDistributionWiener_ffv_1824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1825> AgradDistributionWiener_ffv_1825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1826> AgradDistributionWiener_ffv_1826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1827> AgradDistributionWiener_ffv_1827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1828> AgradDistributionWiener_ffv_1828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1829> AgradDistributionWiener_ffv_1829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1830> AgradDistributionWiener_ffv_1830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1831> AgradDistributionWiener_ffv_1831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1832> AgradDistributionWiener_ffv_1832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1833> AgradDistributionWiener_ffv_1833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1834> AgradDistributionWiener_ffv_1834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1835> AgradDistributionWiener_ffv_1835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1836> AgradDistributionWiener_ffv_1836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1837> AgradDistributionWiener_ffv_1837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1838> AgradDistributionWiener_ffv_1838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1839> AgradDistributionWiener_ffv_1839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1840> AgradDistributionWiener_ffv_1840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1841> AgradDistributionWiener_ffv_1841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1842> AgradDistributionWiener_ffv_1842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1843> AgradDistributionWiener_ffv_1843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1844> AgradDistributionWiener_ffv_1844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1845> AgradDistributionWiener_ffv_1845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1846> AgradDistributionWiener_ffv_1846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1847> AgradDistributionWiener_ffv_1847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1848> AgradDistributionWiener_ffv_1848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1849> AgradDistributionWiener_ffv_1849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1850> AgradDistributionWiener_ffv_1850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1851> AgradDistributionWiener_ffv_1851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1852> AgradDistributionWiener_ffv_1852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1853> AgradDistributionWiener_ffv_1853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1854> AgradDistributionWiener_ffv_1854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1855> AgradDistributionWiener_ffv_1855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1856> AgradDistributionWiener_ffv_1856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1857> AgradDistributionWiener_ffv_1857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1858> AgradDistributionWiener_ffv_1858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1859> AgradDistributionWiener_ffv_1859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1860> AgradDistributionWiener_ffv_1860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1861> AgradDistributionWiener_ffv_1861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1862> AgradDistributionWiener_ffv_1862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1863> AgradDistributionWiener_ffv_1863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1864> AgradDistributionWiener_ffv_1864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1865> AgradDistributionWiener_ffv_1865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1866> AgradDistributionWiener_ffv_1866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1867> AgradDistributionWiener_ffv_1867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1868> AgradDistributionWiener_ffv_1868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1869> AgradDistributionWiener_ffv_1869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1870> AgradDistributionWiener_ffv_1870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1871> AgradDistributionWiener_ffv_1871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1872> AgradDistributionWiener_ffv_1872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1873> AgradDistributionWiener_ffv_1873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1874> AgradDistributionWiener_ffv_1874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1875> AgradDistributionWiener_ffv_1875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1876> AgradDistributionWiener_ffv_1876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1877> AgradDistributionWiener_ffv_1877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1878> AgradDistributionWiener_ffv_1878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1879> AgradDistributionWiener_ffv_1879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1880> AgradDistributionWiener_ffv_1880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1881> AgradDistributionWiener_ffv_1881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1882> AgradDistributionWiener_ffv_1882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1883> AgradDistributionWiener_ffv_1883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1884> AgradDistributionWiener_ffv_1884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1885> AgradDistributionWiener_ffv_1885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1886> AgradDistributionWiener_ffv_1886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1887> AgradDistributionWiener_ffv_1887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1888> AgradDistributionWiener_ffv_1888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1889> AgradDistributionWiener_ffv_1889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1890> AgradDistributionWiener_ffv_1890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1891> AgradDistributionWiener_ffv_1891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1892> AgradDistributionWiener_ffv_1892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1893> AgradDistributionWiener_ffv_1893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1894> AgradDistributionWiener_ffv_1894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1895> AgradDistributionWiener_ffv_1895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1896> AgradDistributionWiener_ffv_1896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1897> AgradDistributionWiener_ffv_1897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1898> AgradDistributionWiener_ffv_1898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_1899> AgradDistributionWiener_ffv_1899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1800, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1801, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1802, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1803, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1804, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1805, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1806, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1807, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1808, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1809, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1810, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1811, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1812, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1813, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1814, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1815, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1816, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1817, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1818, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1819, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1820, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1821, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1822, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1823, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1824, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1825, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1826, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1827, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1828, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1829, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1830, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1831, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1832, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1833, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1834, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1835, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1836, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1837, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1838, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1839, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1840, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1841, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1842, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1843, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1844, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1845, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1846, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1847, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1848, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1849, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1850, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1851, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1852, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1853, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1854, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1855, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1856, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1857, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1858, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1859, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1860, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1861, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1862, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1863, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1864, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1865, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1866, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1867, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1868, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1869, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1870, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1871, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1872, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1873, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1874, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1875, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1876, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1877, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1878, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1879, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1880, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1881, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1882, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1883, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1884, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1885, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1886, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1887, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1888, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1889, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1890, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1891, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1892, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1893, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1894, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1895, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1896, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1897, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1898, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_1899, AgradDistributionTestFixture, AgradDistributionWiener_ffv_1899);
+
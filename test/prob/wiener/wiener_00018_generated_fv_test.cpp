@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, fvar<var>, double, empty> type_fv_1800;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, fvar<var>, std::vector<double>, empty> type_fv_1801;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1802;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, fvar<var>, fvar<var>, empty> type_fv_1803;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1804;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1805;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, double, empty> type_fv_1806;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1807;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1808;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1809;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1810;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1811;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1812;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1813;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1814;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1815;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1816;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1817;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, double, double, empty> type_fv_1818;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, double, std::vector<double>, empty> type_fv_1819;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1820;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, double, fvar<var>, empty> type_fv_1821;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_1822;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1823;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, double, empty> type_fv_1824;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_1825;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1826;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_1827;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1828;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1829;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1830;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1831;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1832;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1833;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1834;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1835;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, double, empty> type_fv_1836;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_1837;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1838;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_1839;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1840;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1841;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_1842;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1843;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1844;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1845;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1846;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1847;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1848;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1849;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1850;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1851;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1852;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1853;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_1854;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_1855;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1856;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_1857;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_1858;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1859;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_1860;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_1861;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1862;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_1863;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1864;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1865;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1866;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1867;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1868;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1869;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1870;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1871;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_1872;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_1873;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1874;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_1875;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1876;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1877;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_1878;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1879;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1880;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1881;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1882;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1883;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1884;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1885;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1886;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1887;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1888;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1889;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, double, double, empty> type_fv_1890;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, double, std::vector<double>, empty> type_fv_1891;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1892;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, double, fvar<var>, empty> type_fv_1893;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_1894;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1895;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, double, empty> type_fv_1896;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_1897;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1898;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_1899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1800> AgradDistributionWiener_fv_1800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1801> AgradDistributionWiener_fv_1801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1802> AgradDistributionWiener_fv_1802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1803> AgradDistributionWiener_fv_1803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1804> AgradDistributionWiener_fv_1804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1805> AgradDistributionWiener_fv_1805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1806> AgradDistributionWiener_fv_1806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1807> AgradDistributionWiener_fv_1807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1808> AgradDistributionWiener_fv_1808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1809> AgradDistributionWiener_fv_1809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1810> AgradDistributionWiener_fv_1810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1811> AgradDistributionWiener_fv_1811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1812> AgradDistributionWiener_fv_1812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1813> AgradDistributionWiener_fv_1813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1814> AgradDistributionWiener_fv_1814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1815> AgradDistributionWiener_fv_1815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1816> AgradDistributionWiener_fv_1816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1817> AgradDistributionWiener_fv_1817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1818> AgradDistributionWiener_fv_1818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1819> AgradDistributionWiener_fv_1819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1820> AgradDistributionWiener_fv_1820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1821> AgradDistributionWiener_fv_1821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1822> AgradDistributionWiener_fv_1822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1823> AgradDistributionWiener_fv_1823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1824> AgradDistributionWiener_fv_1824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1825> AgradDistributionWiener_fv_1825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1826> AgradDistributionWiener_fv_1826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1827> AgradDistributionWiener_fv_1827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1828> AgradDistributionWiener_fv_1828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1829> AgradDistributionWiener_fv_1829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1830> AgradDistributionWiener_fv_1830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1831> AgradDistributionWiener_fv_1831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1832> AgradDistributionWiener_fv_1832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1833> AgradDistributionWiener_fv_1833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1834> AgradDistributionWiener_fv_1834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1835> AgradDistributionWiener_fv_1835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1836> AgradDistributionWiener_fv_1836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1837> AgradDistributionWiener_fv_1837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1838> AgradDistributionWiener_fv_1838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1839> AgradDistributionWiener_fv_1839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1840> AgradDistributionWiener_fv_1840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1841> AgradDistributionWiener_fv_1841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1842> AgradDistributionWiener_fv_1842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1843> AgradDistributionWiener_fv_1843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1844> AgradDistributionWiener_fv_1844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1845> AgradDistributionWiener_fv_1845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1846> AgradDistributionWiener_fv_1846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1847> AgradDistributionWiener_fv_1847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1848> AgradDistributionWiener_fv_1848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1849> AgradDistributionWiener_fv_1849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1850> AgradDistributionWiener_fv_1850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1851> AgradDistributionWiener_fv_1851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1852> AgradDistributionWiener_fv_1852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1853> AgradDistributionWiener_fv_1853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1854> AgradDistributionWiener_fv_1854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1855> AgradDistributionWiener_fv_1855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1856> AgradDistributionWiener_fv_1856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1857> AgradDistributionWiener_fv_1857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1858> AgradDistributionWiener_fv_1858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1859> AgradDistributionWiener_fv_1859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1860> AgradDistributionWiener_fv_1860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1861> AgradDistributionWiener_fv_1861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1862> AgradDistributionWiener_fv_1862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1863> AgradDistributionWiener_fv_1863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1864> AgradDistributionWiener_fv_1864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1865> AgradDistributionWiener_fv_1865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1866> AgradDistributionWiener_fv_1866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1867> AgradDistributionWiener_fv_1867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1868> AgradDistributionWiener_fv_1868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1869> AgradDistributionWiener_fv_1869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1870> AgradDistributionWiener_fv_1870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1871> AgradDistributionWiener_fv_1871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1872> AgradDistributionWiener_fv_1872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1873> AgradDistributionWiener_fv_1873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1874> AgradDistributionWiener_fv_1874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1875> AgradDistributionWiener_fv_1875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1876> AgradDistributionWiener_fv_1876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1877> AgradDistributionWiener_fv_1877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1878> AgradDistributionWiener_fv_1878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1879> AgradDistributionWiener_fv_1879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1880> AgradDistributionWiener_fv_1880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1881> AgradDistributionWiener_fv_1881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1882> AgradDistributionWiener_fv_1882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1883> AgradDistributionWiener_fv_1883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1884> AgradDistributionWiener_fv_1884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1885> AgradDistributionWiener_fv_1885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1886> AgradDistributionWiener_fv_1886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1887> AgradDistributionWiener_fv_1887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1888> AgradDistributionWiener_fv_1888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1889> AgradDistributionWiener_fv_1889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1890> AgradDistributionWiener_fv_1890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1891> AgradDistributionWiener_fv_1891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1892> AgradDistributionWiener_fv_1892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1893> AgradDistributionWiener_fv_1893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1894> AgradDistributionWiener_fv_1894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1895> AgradDistributionWiener_fv_1895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1896> AgradDistributionWiener_fv_1896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1897> AgradDistributionWiener_fv_1897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1898> AgradDistributionWiener_fv_1898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1899> AgradDistributionWiener_fv_1899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1800, AgradDistributionTestFixture, AgradDistributionWiener_fv_1800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1801, AgradDistributionTestFixture, AgradDistributionWiener_fv_1801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1802, AgradDistributionTestFixture, AgradDistributionWiener_fv_1802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1803, AgradDistributionTestFixture, AgradDistributionWiener_fv_1803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1804, AgradDistributionTestFixture, AgradDistributionWiener_fv_1804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1805, AgradDistributionTestFixture, AgradDistributionWiener_fv_1805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1806, AgradDistributionTestFixture, AgradDistributionWiener_fv_1806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1807, AgradDistributionTestFixture, AgradDistributionWiener_fv_1807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1808, AgradDistributionTestFixture, AgradDistributionWiener_fv_1808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1809, AgradDistributionTestFixture, AgradDistributionWiener_fv_1809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1810, AgradDistributionTestFixture, AgradDistributionWiener_fv_1810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1811, AgradDistributionTestFixture, AgradDistributionWiener_fv_1811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1812, AgradDistributionTestFixture, AgradDistributionWiener_fv_1812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1813, AgradDistributionTestFixture, AgradDistributionWiener_fv_1813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1814, AgradDistributionTestFixture, AgradDistributionWiener_fv_1814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1815, AgradDistributionTestFixture, AgradDistributionWiener_fv_1815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1816, AgradDistributionTestFixture, AgradDistributionWiener_fv_1816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1817, AgradDistributionTestFixture, AgradDistributionWiener_fv_1817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1818, AgradDistributionTestFixture, AgradDistributionWiener_fv_1818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1819, AgradDistributionTestFixture, AgradDistributionWiener_fv_1819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1820, AgradDistributionTestFixture, AgradDistributionWiener_fv_1820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1821, AgradDistributionTestFixture, AgradDistributionWiener_fv_1821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1822, AgradDistributionTestFixture, AgradDistributionWiener_fv_1822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1823, AgradDistributionTestFixture, AgradDistributionWiener_fv_1823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1824, AgradDistributionTestFixture, AgradDistributionWiener_fv_1824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1825, AgradDistributionTestFixture, AgradDistributionWiener_fv_1825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1826, AgradDistributionTestFixture, AgradDistributionWiener_fv_1826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1827, AgradDistributionTestFixture, AgradDistributionWiener_fv_1827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1828, AgradDistributionTestFixture, AgradDistributionWiener_fv_1828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1829, AgradDistributionTestFixture, AgradDistributionWiener_fv_1829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1830, AgradDistributionTestFixture, AgradDistributionWiener_fv_1830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1831, AgradDistributionTestFixture, AgradDistributionWiener_fv_1831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1832, AgradDistributionTestFixture, AgradDistributionWiener_fv_1832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1833, AgradDistributionTestFixture, AgradDistributionWiener_fv_1833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1834, AgradDistributionTestFixture, AgradDistributionWiener_fv_1834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1835, AgradDistributionTestFixture, AgradDistributionWiener_fv_1835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1836, AgradDistributionTestFixture, AgradDistributionWiener_fv_1836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1837, AgradDistributionTestFixture, AgradDistributionWiener_fv_1837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1838, AgradDistributionTestFixture, AgradDistributionWiener_fv_1838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1839, AgradDistributionTestFixture, AgradDistributionWiener_fv_1839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1840, AgradDistributionTestFixture, AgradDistributionWiener_fv_1840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1841, AgradDistributionTestFixture, AgradDistributionWiener_fv_1841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1842, AgradDistributionTestFixture, AgradDistributionWiener_fv_1842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1843, AgradDistributionTestFixture, AgradDistributionWiener_fv_1843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1844, AgradDistributionTestFixture, AgradDistributionWiener_fv_1844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1845, AgradDistributionTestFixture, AgradDistributionWiener_fv_1845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1846, AgradDistributionTestFixture, AgradDistributionWiener_fv_1846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1847, AgradDistributionTestFixture, AgradDistributionWiener_fv_1847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1848, AgradDistributionTestFixture, AgradDistributionWiener_fv_1848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1849, AgradDistributionTestFixture, AgradDistributionWiener_fv_1849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1850, AgradDistributionTestFixture, AgradDistributionWiener_fv_1850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1851, AgradDistributionTestFixture, AgradDistributionWiener_fv_1851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1852, AgradDistributionTestFixture, AgradDistributionWiener_fv_1852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1853, AgradDistributionTestFixture, AgradDistributionWiener_fv_1853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1854, AgradDistributionTestFixture, AgradDistributionWiener_fv_1854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1855, AgradDistributionTestFixture, AgradDistributionWiener_fv_1855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1856, AgradDistributionTestFixture, AgradDistributionWiener_fv_1856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1857, AgradDistributionTestFixture, AgradDistributionWiener_fv_1857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1858, AgradDistributionTestFixture, AgradDistributionWiener_fv_1858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1859, AgradDistributionTestFixture, AgradDistributionWiener_fv_1859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1860, AgradDistributionTestFixture, AgradDistributionWiener_fv_1860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1861, AgradDistributionTestFixture, AgradDistributionWiener_fv_1861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1862, AgradDistributionTestFixture, AgradDistributionWiener_fv_1862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1863, AgradDistributionTestFixture, AgradDistributionWiener_fv_1863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1864, AgradDistributionTestFixture, AgradDistributionWiener_fv_1864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1865, AgradDistributionTestFixture, AgradDistributionWiener_fv_1865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1866, AgradDistributionTestFixture, AgradDistributionWiener_fv_1866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1867, AgradDistributionTestFixture, AgradDistributionWiener_fv_1867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1868, AgradDistributionTestFixture, AgradDistributionWiener_fv_1868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1869, AgradDistributionTestFixture, AgradDistributionWiener_fv_1869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1870, AgradDistributionTestFixture, AgradDistributionWiener_fv_1870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1871, AgradDistributionTestFixture, AgradDistributionWiener_fv_1871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1872, AgradDistributionTestFixture, AgradDistributionWiener_fv_1872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1873, AgradDistributionTestFixture, AgradDistributionWiener_fv_1873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1874, AgradDistributionTestFixture, AgradDistributionWiener_fv_1874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1875, AgradDistributionTestFixture, AgradDistributionWiener_fv_1875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1876, AgradDistributionTestFixture, AgradDistributionWiener_fv_1876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1877, AgradDistributionTestFixture, AgradDistributionWiener_fv_1877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1878, AgradDistributionTestFixture, AgradDistributionWiener_fv_1878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1879, AgradDistributionTestFixture, AgradDistributionWiener_fv_1879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1880, AgradDistributionTestFixture, AgradDistributionWiener_fv_1880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1881, AgradDistributionTestFixture, AgradDistributionWiener_fv_1881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1882, AgradDistributionTestFixture, AgradDistributionWiener_fv_1882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1883, AgradDistributionTestFixture, AgradDistributionWiener_fv_1883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1884, AgradDistributionTestFixture, AgradDistributionWiener_fv_1884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1885, AgradDistributionTestFixture, AgradDistributionWiener_fv_1885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1886, AgradDistributionTestFixture, AgradDistributionWiener_fv_1886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1887, AgradDistributionTestFixture, AgradDistributionWiener_fv_1887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1888, AgradDistributionTestFixture, AgradDistributionWiener_fv_1888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1889, AgradDistributionTestFixture, AgradDistributionWiener_fv_1889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1890, AgradDistributionTestFixture, AgradDistributionWiener_fv_1890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1891, AgradDistributionTestFixture, AgradDistributionWiener_fv_1891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1892, AgradDistributionTestFixture, AgradDistributionWiener_fv_1892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1893, AgradDistributionTestFixture, AgradDistributionWiener_fv_1893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1894, AgradDistributionTestFixture, AgradDistributionWiener_fv_1894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1895, AgradDistributionTestFixture, AgradDistributionWiener_fv_1895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1896, AgradDistributionTestFixture, AgradDistributionWiener_fv_1896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1897, AgradDistributionTestFixture, AgradDistributionWiener_fv_1897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1898, AgradDistributionTestFixture, AgradDistributionWiener_fv_1898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1899, AgradDistributionTestFixture, AgradDistributionWiener_fv_1899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1900;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1901;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1902;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1903;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1904;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1905;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1906;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1907;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, fvar<var>, double, empty> type_fv_1908;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_1909;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1910;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_1911;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1912;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1913;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_1914;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1915;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1916;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1917;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1918;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1919;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1920;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1921;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1922;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1923;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1924;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1925;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, double, empty> type_fv_1926;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_1927;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1928;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_1929;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_1930;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1931;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_1932;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_1933;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1934;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_1935;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1936;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1937;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1938;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1939;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1940;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1941;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1942;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1943;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_1944;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_1945;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1946;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_1947;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1948;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1949;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_1950;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1951;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1952;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1953;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1954;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1955;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1956;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1957;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1958;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1959;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1960;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1961;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_1962;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_1963;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1964;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_1965;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_1966;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1967;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_1968;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_1969;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1970;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_1971;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_1972;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1973;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_1974;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1975;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1976;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1977;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1978;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1979;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_1980;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_1981;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1982;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_1983;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_1984;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1985;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_1986;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_1987;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1988;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_1989;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_1990;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1991;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_1992;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_1993;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_1994;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_1995;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_1996;
+typedef boost::mpl::vector<std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_1997;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, double, double, empty> type_fv_1998;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, double, std::vector<double>, empty> type_fv_1999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1900> AgradDistributionWiener_fv_1900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1901> AgradDistributionWiener_fv_1901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1902> AgradDistributionWiener_fv_1902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1903> AgradDistributionWiener_fv_1903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1904> AgradDistributionWiener_fv_1904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1905> AgradDistributionWiener_fv_1905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1906> AgradDistributionWiener_fv_1906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1907> AgradDistributionWiener_fv_1907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1908> AgradDistributionWiener_fv_1908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1909> AgradDistributionWiener_fv_1909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1910> AgradDistributionWiener_fv_1910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1911> AgradDistributionWiener_fv_1911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1912> AgradDistributionWiener_fv_1912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1913> AgradDistributionWiener_fv_1913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1914> AgradDistributionWiener_fv_1914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1915> AgradDistributionWiener_fv_1915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1916> AgradDistributionWiener_fv_1916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1917> AgradDistributionWiener_fv_1917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1918> AgradDistributionWiener_fv_1918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1919> AgradDistributionWiener_fv_1919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1920> AgradDistributionWiener_fv_1920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1921> AgradDistributionWiener_fv_1921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1922> AgradDistributionWiener_fv_1922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1923> AgradDistributionWiener_fv_1923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1924> AgradDistributionWiener_fv_1924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1925> AgradDistributionWiener_fv_1925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1926> AgradDistributionWiener_fv_1926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1927> AgradDistributionWiener_fv_1927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1928> AgradDistributionWiener_fv_1928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1929> AgradDistributionWiener_fv_1929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1930> AgradDistributionWiener_fv_1930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1931> AgradDistributionWiener_fv_1931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1932> AgradDistributionWiener_fv_1932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1933> AgradDistributionWiener_fv_1933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1934> AgradDistributionWiener_fv_1934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1935> AgradDistributionWiener_fv_1935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1936> AgradDistributionWiener_fv_1936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1937> AgradDistributionWiener_fv_1937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1938> AgradDistributionWiener_fv_1938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1939> AgradDistributionWiener_fv_1939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1940> AgradDistributionWiener_fv_1940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1941> AgradDistributionWiener_fv_1941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1942> AgradDistributionWiener_fv_1942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1943> AgradDistributionWiener_fv_1943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1944> AgradDistributionWiener_fv_1944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1945> AgradDistributionWiener_fv_1945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1946> AgradDistributionWiener_fv_1946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1947> AgradDistributionWiener_fv_1947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1948> AgradDistributionWiener_fv_1948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1949> AgradDistributionWiener_fv_1949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1950> AgradDistributionWiener_fv_1950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1951> AgradDistributionWiener_fv_1951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1952> AgradDistributionWiener_fv_1952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1953> AgradDistributionWiener_fv_1953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1954> AgradDistributionWiener_fv_1954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1955> AgradDistributionWiener_fv_1955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1956> AgradDistributionWiener_fv_1956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1957> AgradDistributionWiener_fv_1957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1958> AgradDistributionWiener_fv_1958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1959> AgradDistributionWiener_fv_1959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1960> AgradDistributionWiener_fv_1960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1961> AgradDistributionWiener_fv_1961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1962> AgradDistributionWiener_fv_1962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1963> AgradDistributionWiener_fv_1963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1964> AgradDistributionWiener_fv_1964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1965> AgradDistributionWiener_fv_1965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1966> AgradDistributionWiener_fv_1966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1967> AgradDistributionWiener_fv_1967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1968> AgradDistributionWiener_fv_1968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1969> AgradDistributionWiener_fv_1969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1970> AgradDistributionWiener_fv_1970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1971> AgradDistributionWiener_fv_1971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1972> AgradDistributionWiener_fv_1972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1973> AgradDistributionWiener_fv_1973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1974> AgradDistributionWiener_fv_1974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1975> AgradDistributionWiener_fv_1975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1976> AgradDistributionWiener_fv_1976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1977> AgradDistributionWiener_fv_1977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1978> AgradDistributionWiener_fv_1978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1979> AgradDistributionWiener_fv_1979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1980> AgradDistributionWiener_fv_1980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1981> AgradDistributionWiener_fv_1981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1982> AgradDistributionWiener_fv_1982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1983> AgradDistributionWiener_fv_1983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1984> AgradDistributionWiener_fv_1984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1985> AgradDistributionWiener_fv_1985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1986> AgradDistributionWiener_fv_1986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1987> AgradDistributionWiener_fv_1987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1988> AgradDistributionWiener_fv_1988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1989> AgradDistributionWiener_fv_1989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1990> AgradDistributionWiener_fv_1990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1991> AgradDistributionWiener_fv_1991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1992> AgradDistributionWiener_fv_1992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1993> AgradDistributionWiener_fv_1993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1994> AgradDistributionWiener_fv_1994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1995> AgradDistributionWiener_fv_1995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1996> AgradDistributionWiener_fv_1996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1997> AgradDistributionWiener_fv_1997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1998> AgradDistributionWiener_fv_1998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_1999> AgradDistributionWiener_fv_1999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1900, AgradDistributionTestFixture, AgradDistributionWiener_fv_1900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1901, AgradDistributionTestFixture, AgradDistributionWiener_fv_1901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1902, AgradDistributionTestFixture, AgradDistributionWiener_fv_1902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1903, AgradDistributionTestFixture, AgradDistributionWiener_fv_1903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1904, AgradDistributionTestFixture, AgradDistributionWiener_fv_1904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1905, AgradDistributionTestFixture, AgradDistributionWiener_fv_1905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1906, AgradDistributionTestFixture, AgradDistributionWiener_fv_1906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1907, AgradDistributionTestFixture, AgradDistributionWiener_fv_1907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1908, AgradDistributionTestFixture, AgradDistributionWiener_fv_1908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1909, AgradDistributionTestFixture, AgradDistributionWiener_fv_1909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1910, AgradDistributionTestFixture, AgradDistributionWiener_fv_1910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1911, AgradDistributionTestFixture, AgradDistributionWiener_fv_1911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1912, AgradDistributionTestFixture, AgradDistributionWiener_fv_1912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1913, AgradDistributionTestFixture, AgradDistributionWiener_fv_1913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1914, AgradDistributionTestFixture, AgradDistributionWiener_fv_1914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1915, AgradDistributionTestFixture, AgradDistributionWiener_fv_1915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1916, AgradDistributionTestFixture, AgradDistributionWiener_fv_1916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1917, AgradDistributionTestFixture, AgradDistributionWiener_fv_1917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1918, AgradDistributionTestFixture, AgradDistributionWiener_fv_1918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1919, AgradDistributionTestFixture, AgradDistributionWiener_fv_1919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1920, AgradDistributionTestFixture, AgradDistributionWiener_fv_1920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1921, AgradDistributionTestFixture, AgradDistributionWiener_fv_1921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1922, AgradDistributionTestFixture, AgradDistributionWiener_fv_1922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1923, AgradDistributionTestFixture, AgradDistributionWiener_fv_1923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1924, AgradDistributionTestFixture, AgradDistributionWiener_fv_1924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1925, AgradDistributionTestFixture, AgradDistributionWiener_fv_1925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1926, AgradDistributionTestFixture, AgradDistributionWiener_fv_1926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1927, AgradDistributionTestFixture, AgradDistributionWiener_fv_1927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1928, AgradDistributionTestFixture, AgradDistributionWiener_fv_1928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1929, AgradDistributionTestFixture, AgradDistributionWiener_fv_1929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1930, AgradDistributionTestFixture, AgradDistributionWiener_fv_1930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1931, AgradDistributionTestFixture, AgradDistributionWiener_fv_1931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1932, AgradDistributionTestFixture, AgradDistributionWiener_fv_1932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1933, AgradDistributionTestFixture, AgradDistributionWiener_fv_1933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1934, AgradDistributionTestFixture, AgradDistributionWiener_fv_1934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1935, AgradDistributionTestFixture, AgradDistributionWiener_fv_1935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1936, AgradDistributionTestFixture, AgradDistributionWiener_fv_1936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1937, AgradDistributionTestFixture, AgradDistributionWiener_fv_1937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1938, AgradDistributionTestFixture, AgradDistributionWiener_fv_1938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1939, AgradDistributionTestFixture, AgradDistributionWiener_fv_1939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1940, AgradDistributionTestFixture, AgradDistributionWiener_fv_1940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1941, AgradDistributionTestFixture, AgradDistributionWiener_fv_1941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1942, AgradDistributionTestFixture, AgradDistributionWiener_fv_1942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1943, AgradDistributionTestFixture, AgradDistributionWiener_fv_1943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1944, AgradDistributionTestFixture, AgradDistributionWiener_fv_1944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1945, AgradDistributionTestFixture, AgradDistributionWiener_fv_1945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1946, AgradDistributionTestFixture, AgradDistributionWiener_fv_1946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1947, AgradDistributionTestFixture, AgradDistributionWiener_fv_1947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1948, AgradDistributionTestFixture, AgradDistributionWiener_fv_1948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1949, AgradDistributionTestFixture, AgradDistributionWiener_fv_1949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1950, AgradDistributionTestFixture, AgradDistributionWiener_fv_1950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1951, AgradDistributionTestFixture, AgradDistributionWiener_fv_1951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1952, AgradDistributionTestFixture, AgradDistributionWiener_fv_1952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1953, AgradDistributionTestFixture, AgradDistributionWiener_fv_1953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1954, AgradDistributionTestFixture, AgradDistributionWiener_fv_1954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1955, AgradDistributionTestFixture, AgradDistributionWiener_fv_1955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1956, AgradDistributionTestFixture, AgradDistributionWiener_fv_1956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1957, AgradDistributionTestFixture, AgradDistributionWiener_fv_1957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1958, AgradDistributionTestFixture, AgradDistributionWiener_fv_1958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1959, AgradDistributionTestFixture, AgradDistributionWiener_fv_1959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1960, AgradDistributionTestFixture, AgradDistributionWiener_fv_1960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1961, AgradDistributionTestFixture, AgradDistributionWiener_fv_1961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1962, AgradDistributionTestFixture, AgradDistributionWiener_fv_1962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1963, AgradDistributionTestFixture, AgradDistributionWiener_fv_1963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1964, AgradDistributionTestFixture, AgradDistributionWiener_fv_1964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1965, AgradDistributionTestFixture, AgradDistributionWiener_fv_1965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1966, AgradDistributionTestFixture, AgradDistributionWiener_fv_1966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1967, AgradDistributionTestFixture, AgradDistributionWiener_fv_1967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1968, AgradDistributionTestFixture, AgradDistributionWiener_fv_1968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1969, AgradDistributionTestFixture, AgradDistributionWiener_fv_1969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1970, AgradDistributionTestFixture, AgradDistributionWiener_fv_1970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1971, AgradDistributionTestFixture, AgradDistributionWiener_fv_1971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1972, AgradDistributionTestFixture, AgradDistributionWiener_fv_1972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1973, AgradDistributionTestFixture, AgradDistributionWiener_fv_1973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1974, AgradDistributionTestFixture, AgradDistributionWiener_fv_1974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1975, AgradDistributionTestFixture, AgradDistributionWiener_fv_1975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1976, AgradDistributionTestFixture, AgradDistributionWiener_fv_1976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1977, AgradDistributionTestFixture, AgradDistributionWiener_fv_1977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1978, AgradDistributionTestFixture, AgradDistributionWiener_fv_1978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1979, AgradDistributionTestFixture, AgradDistributionWiener_fv_1979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1980, AgradDistributionTestFixture, AgradDistributionWiener_fv_1980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1981, AgradDistributionTestFixture, AgradDistributionWiener_fv_1981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1982, AgradDistributionTestFixture, AgradDistributionWiener_fv_1982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1983, AgradDistributionTestFixture, AgradDistributionWiener_fv_1983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1984, AgradDistributionTestFixture, AgradDistributionWiener_fv_1984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1985, AgradDistributionTestFixture, AgradDistributionWiener_fv_1985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1986, AgradDistributionTestFixture, AgradDistributionWiener_fv_1986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1987, AgradDistributionTestFixture, AgradDistributionWiener_fv_1987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1988, AgradDistributionTestFixture, AgradDistributionWiener_fv_1988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1989, AgradDistributionTestFixture, AgradDistributionWiener_fv_1989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1990, AgradDistributionTestFixture, AgradDistributionWiener_fv_1990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1991, AgradDistributionTestFixture, AgradDistributionWiener_fv_1991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1992, AgradDistributionTestFixture, AgradDistributionWiener_fv_1992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1993, AgradDistributionTestFixture, AgradDistributionWiener_fv_1993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1994, AgradDistributionTestFixture, AgradDistributionWiener_fv_1994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1995, AgradDistributionTestFixture, AgradDistributionWiener_fv_1995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1996, AgradDistributionTestFixture, AgradDistributionWiener_fv_1996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1997, AgradDistributionTestFixture, AgradDistributionWiener_fv_1997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1998, AgradDistributionTestFixture, AgradDistributionWiener_fv_1998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_1999, AgradDistributionTestFixture, AgradDistributionWiener_fv_1999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_1900;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1901;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1902;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1903;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1904;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1905;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1906;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1907;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_1908;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_1909;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1910;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_1911;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_1912;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1913;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_1914;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_1915;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1916;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_1917;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_1918;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1919;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1920;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1921;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1922;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1923;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1924;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1925;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_1926;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_1927;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1928;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_1929;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_1930;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1931;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_1932;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_1933;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1934;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_1935;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_1936;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1937;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1938;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1939;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1940;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1941;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1942;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1943;
+typedef boost::mpl::vector<std::vector<double>, var, double, double, double, empty> type_v_1944;
+typedef boost::mpl::vector<std::vector<double>, var, double, double, std::vector<double>, empty> type_v_1945;
+typedef boost::mpl::vector<std::vector<double>, var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1946;
+typedef boost::mpl::vector<std::vector<double>, var, double, double, var, empty> type_v_1947;
+typedef boost::mpl::vector<std::vector<double>, var, double, double, std::vector<var>, empty> type_v_1948;
+typedef boost::mpl::vector<std::vector<double>, var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1949;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<double>, double, empty> type_v_1950;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<double>, std::vector<double>, empty> type_v_1951;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1952;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<double>, var, empty> type_v_1953;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<double>, std::vector<var>, empty> type_v_1954;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1955;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1956;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1957;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1958;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1959;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1960;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1961;
+typedef boost::mpl::vector<std::vector<double>, var, double, var, double, empty> type_v_1962;
+typedef boost::mpl::vector<std::vector<double>, var, double, var, std::vector<double>, empty> type_v_1963;
+typedef boost::mpl::vector<std::vector<double>, var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1964;
+typedef boost::mpl::vector<std::vector<double>, var, double, var, var, empty> type_v_1965;
+typedef boost::mpl::vector<std::vector<double>, var, double, var, std::vector<var>, empty> type_v_1966;
+typedef boost::mpl::vector<std::vector<double>, var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1967;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<var>, double, empty> type_v_1968;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<var>, std::vector<double>, empty> type_v_1969;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1970;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<var>, var, empty> type_v_1971;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<var>, std::vector<var>, empty> type_v_1972;
+typedef boost::mpl::vector<std::vector<double>, var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1973;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1974;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1975;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1976;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1977;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1978;
+typedef boost::mpl::vector<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1979;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, double, double, empty> type_v_1980;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, double, std::vector<double>, empty> type_v_1981;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1982;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, double, var, empty> type_v_1983;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, double, std::vector<var>, empty> type_v_1984;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1985;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, std::vector<double>, double, empty> type_v_1986;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_1987;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1988;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, std::vector<double>, var, empty> type_v_1989;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_1990;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1991;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1992;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1993;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1994;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1995;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1996;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1997;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, var, double, empty> type_v_1998;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<double>, var, std::vector<double>, empty> type_v_1999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1900> AgradDistributionWiener_v_1900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1901> AgradDistributionWiener_v_1901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1902> AgradDistributionWiener_v_1902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1903> AgradDistributionWiener_v_1903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1904> AgradDistributionWiener_v_1904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1905> AgradDistributionWiener_v_1905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1906> AgradDistributionWiener_v_1906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1907> AgradDistributionWiener_v_1907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1908> AgradDistributionWiener_v_1908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1909> AgradDistributionWiener_v_1909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1910> AgradDistributionWiener_v_1910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1911> AgradDistributionWiener_v_1911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1912> AgradDistributionWiener_v_1912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1913> AgradDistributionWiener_v_1913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1914> AgradDistributionWiener_v_1914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1915> AgradDistributionWiener_v_1915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1916> AgradDistributionWiener_v_1916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1917> AgradDistributionWiener_v_1917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1918> AgradDistributionWiener_v_1918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1919> AgradDistributionWiener_v_1919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1920> AgradDistributionWiener_v_1920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1921> AgradDistributionWiener_v_1921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1922> AgradDistributionWiener_v_1922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1923> AgradDistributionWiener_v_1923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1924> AgradDistributionWiener_v_1924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1925> AgradDistributionWiener_v_1925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1926> AgradDistributionWiener_v_1926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1927> AgradDistributionWiener_v_1927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1928> AgradDistributionWiener_v_1928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1929> AgradDistributionWiener_v_1929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1930> AgradDistributionWiener_v_1930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1931> AgradDistributionWiener_v_1931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1932> AgradDistributionWiener_v_1932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1933> AgradDistributionWiener_v_1933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1934> AgradDistributionWiener_v_1934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1935> AgradDistributionWiener_v_1935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1936> AgradDistributionWiener_v_1936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1937> AgradDistributionWiener_v_1937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1938> AgradDistributionWiener_v_1938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1939> AgradDistributionWiener_v_1939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1940> AgradDistributionWiener_v_1940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1941> AgradDistributionWiener_v_1941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1942> AgradDistributionWiener_v_1942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1943> AgradDistributionWiener_v_1943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1944> AgradDistributionWiener_v_1944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1945> AgradDistributionWiener_v_1945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1946> AgradDistributionWiener_v_1946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1947> AgradDistributionWiener_v_1947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1948> AgradDistributionWiener_v_1948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1949> AgradDistributionWiener_v_1949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1950> AgradDistributionWiener_v_1950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1951> AgradDistributionWiener_v_1951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1952> AgradDistributionWiener_v_1952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1953> AgradDistributionWiener_v_1953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1954> AgradDistributionWiener_v_1954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1955> AgradDistributionWiener_v_1955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1956> AgradDistributionWiener_v_1956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1957> AgradDistributionWiener_v_1957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1958> AgradDistributionWiener_v_1958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1959> AgradDistributionWiener_v_1959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1960> AgradDistributionWiener_v_1960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1961> AgradDistributionWiener_v_1961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1962> AgradDistributionWiener_v_1962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1963> AgradDistributionWiener_v_1963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1964> AgradDistributionWiener_v_1964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1965> AgradDistributionWiener_v_1965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1966> AgradDistributionWiener_v_1966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1967> AgradDistributionWiener_v_1967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1968> AgradDistributionWiener_v_1968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1969> AgradDistributionWiener_v_1969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1970> AgradDistributionWiener_v_1970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1971> AgradDistributionWiener_v_1971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1972> AgradDistributionWiener_v_1972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1973> AgradDistributionWiener_v_1973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1974> AgradDistributionWiener_v_1974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1975> AgradDistributionWiener_v_1975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1976> AgradDistributionWiener_v_1976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1977> AgradDistributionWiener_v_1977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1978> AgradDistributionWiener_v_1978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1979> AgradDistributionWiener_v_1979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1980> AgradDistributionWiener_v_1980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1981> AgradDistributionWiener_v_1981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1982> AgradDistributionWiener_v_1982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1983> AgradDistributionWiener_v_1983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1984> AgradDistributionWiener_v_1984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1985> AgradDistributionWiener_v_1985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1986> AgradDistributionWiener_v_1986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1987> AgradDistributionWiener_v_1987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1988> AgradDistributionWiener_v_1988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1989> AgradDistributionWiener_v_1989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1990> AgradDistributionWiener_v_1990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1991> AgradDistributionWiener_v_1991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1992> AgradDistributionWiener_v_1992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1993> AgradDistributionWiener_v_1993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1994> AgradDistributionWiener_v_1994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1995> AgradDistributionWiener_v_1995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1996> AgradDistributionWiener_v_1996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1997> AgradDistributionWiener_v_1997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1998> AgradDistributionWiener_v_1998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_1999> AgradDistributionWiener_v_1999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1900, AgradDistributionTestFixture, AgradDistributionWiener_v_1900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1901, AgradDistributionTestFixture, AgradDistributionWiener_v_1901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1902, AgradDistributionTestFixture, AgradDistributionWiener_v_1902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1903, AgradDistributionTestFixture, AgradDistributionWiener_v_1903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1904, AgradDistributionTestFixture, AgradDistributionWiener_v_1904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1905, AgradDistributionTestFixture, AgradDistributionWiener_v_1905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1906, AgradDistributionTestFixture, AgradDistributionWiener_v_1906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1907, AgradDistributionTestFixture, AgradDistributionWiener_v_1907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1908, AgradDistributionTestFixture, AgradDistributionWiener_v_1908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1909, AgradDistributionTestFixture, AgradDistributionWiener_v_1909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1910, AgradDistributionTestFixture, AgradDistributionWiener_v_1910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1911, AgradDistributionTestFixture, AgradDistributionWiener_v_1911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1912, AgradDistributionTestFixture, AgradDistributionWiener_v_1912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1913, AgradDistributionTestFixture, AgradDistributionWiener_v_1913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1914, AgradDistributionTestFixture, AgradDistributionWiener_v_1914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1915, AgradDistributionTestFixture, AgradDistributionWiener_v_1915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1916, AgradDistributionTestFixture, AgradDistributionWiener_v_1916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1917, AgradDistributionTestFixture, AgradDistributionWiener_v_1917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1918, AgradDistributionTestFixture, AgradDistributionWiener_v_1918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1919, AgradDistributionTestFixture, AgradDistributionWiener_v_1919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1920, AgradDistributionTestFixture, AgradDistributionWiener_v_1920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1921, AgradDistributionTestFixture, AgradDistributionWiener_v_1921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1922, AgradDistributionTestFixture, AgradDistributionWiener_v_1922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1923, AgradDistributionTestFixture, AgradDistributionWiener_v_1923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1924, AgradDistributionTestFixture, AgradDistributionWiener_v_1924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1925, AgradDistributionTestFixture, AgradDistributionWiener_v_1925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1926, AgradDistributionTestFixture, AgradDistributionWiener_v_1926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1927, AgradDistributionTestFixture, AgradDistributionWiener_v_1927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1928, AgradDistributionTestFixture, AgradDistributionWiener_v_1928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1929, AgradDistributionTestFixture, AgradDistributionWiener_v_1929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1930, AgradDistributionTestFixture, AgradDistributionWiener_v_1930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1931, AgradDistributionTestFixture, AgradDistributionWiener_v_1931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1932, AgradDistributionTestFixture, AgradDistributionWiener_v_1932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1933, AgradDistributionTestFixture, AgradDistributionWiener_v_1933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1934, AgradDistributionTestFixture, AgradDistributionWiener_v_1934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1935, AgradDistributionTestFixture, AgradDistributionWiener_v_1935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1936, AgradDistributionTestFixture, AgradDistributionWiener_v_1936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1937, AgradDistributionTestFixture, AgradDistributionWiener_v_1937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1938, AgradDistributionTestFixture, AgradDistributionWiener_v_1938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1939, AgradDistributionTestFixture, AgradDistributionWiener_v_1939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1940, AgradDistributionTestFixture, AgradDistributionWiener_v_1940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1941, AgradDistributionTestFixture, AgradDistributionWiener_v_1941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1942, AgradDistributionTestFixture, AgradDistributionWiener_v_1942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1943, AgradDistributionTestFixture, AgradDistributionWiener_v_1943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1944, AgradDistributionTestFixture, AgradDistributionWiener_v_1944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1945, AgradDistributionTestFixture, AgradDistributionWiener_v_1945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1946, AgradDistributionTestFixture, AgradDistributionWiener_v_1946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1947, AgradDistributionTestFixture, AgradDistributionWiener_v_1947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1948, AgradDistributionTestFixture, AgradDistributionWiener_v_1948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1949, AgradDistributionTestFixture, AgradDistributionWiener_v_1949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1950, AgradDistributionTestFixture, AgradDistributionWiener_v_1950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1951, AgradDistributionTestFixture, AgradDistributionWiener_v_1951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1952, AgradDistributionTestFixture, AgradDistributionWiener_v_1952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1953, AgradDistributionTestFixture, AgradDistributionWiener_v_1953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1954, AgradDistributionTestFixture, AgradDistributionWiener_v_1954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1955, AgradDistributionTestFixture, AgradDistributionWiener_v_1955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1956, AgradDistributionTestFixture, AgradDistributionWiener_v_1956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1957, AgradDistributionTestFixture, AgradDistributionWiener_v_1957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1958, AgradDistributionTestFixture, AgradDistributionWiener_v_1958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1959, AgradDistributionTestFixture, AgradDistributionWiener_v_1959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1960, AgradDistributionTestFixture, AgradDistributionWiener_v_1960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1961, AgradDistributionTestFixture, AgradDistributionWiener_v_1961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1962, AgradDistributionTestFixture, AgradDistributionWiener_v_1962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1963, AgradDistributionTestFixture, AgradDistributionWiener_v_1963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1964, AgradDistributionTestFixture, AgradDistributionWiener_v_1964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1965, AgradDistributionTestFixture, AgradDistributionWiener_v_1965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1966, AgradDistributionTestFixture, AgradDistributionWiener_v_1966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1967, AgradDistributionTestFixture, AgradDistributionWiener_v_1967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1968, AgradDistributionTestFixture, AgradDistributionWiener_v_1968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1969, AgradDistributionTestFixture, AgradDistributionWiener_v_1969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1970, AgradDistributionTestFixture, AgradDistributionWiener_v_1970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1971, AgradDistributionTestFixture, AgradDistributionWiener_v_1971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1972, AgradDistributionTestFixture, AgradDistributionWiener_v_1972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1973, AgradDistributionTestFixture, AgradDistributionWiener_v_1973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1974, AgradDistributionTestFixture, AgradDistributionWiener_v_1974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1975, AgradDistributionTestFixture, AgradDistributionWiener_v_1975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1976, AgradDistributionTestFixture, AgradDistributionWiener_v_1976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1977, AgradDistributionTestFixture, AgradDistributionWiener_v_1977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1978, AgradDistributionTestFixture, AgradDistributionWiener_v_1978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1979, AgradDistributionTestFixture, AgradDistributionWiener_v_1979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1980, AgradDistributionTestFixture, AgradDistributionWiener_v_1980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1981, AgradDistributionTestFixture, AgradDistributionWiener_v_1981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1982, AgradDistributionTestFixture, AgradDistributionWiener_v_1982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1983, AgradDistributionTestFixture, AgradDistributionWiener_v_1983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1984, AgradDistributionTestFixture, AgradDistributionWiener_v_1984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1985, AgradDistributionTestFixture, AgradDistributionWiener_v_1985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1986, AgradDistributionTestFixture, AgradDistributionWiener_v_1986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1987, AgradDistributionTestFixture, AgradDistributionWiener_v_1987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1988, AgradDistributionTestFixture, AgradDistributionWiener_v_1988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1989, AgradDistributionTestFixture, AgradDistributionWiener_v_1989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1990, AgradDistributionTestFixture, AgradDistributionWiener_v_1990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1991, AgradDistributionTestFixture, AgradDistributionWiener_v_1991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1992, AgradDistributionTestFixture, AgradDistributionWiener_v_1992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1993, AgradDistributionTestFixture, AgradDistributionWiener_v_1993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1994, AgradDistributionTestFixture, AgradDistributionWiener_v_1994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1995, AgradDistributionTestFixture, AgradDistributionWiener_v_1995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1996, AgradDistributionTestFixture, AgradDistributionWiener_v_1996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1997, AgradDistributionTestFixture, AgradDistributionWiener_v_1997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1998, AgradDistributionTestFixture, AgradDistributionWiener_v_1998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_1999, AgradDistributionTestFixture, AgradDistributionWiener_v_1999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2000;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, double, fvar<fvar<double> >, empty> type_ffd_2001;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2002;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2003;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, double, empty> type_ffd_2004;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<double>, empty> type_ffd_2005;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2006;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2007;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2008;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2009;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2010;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2011;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2012;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2013;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2014;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2015;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, empty> type_ffd_2016;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2017;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2018;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2019;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2020;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2021;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2022;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2023;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2024;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2025;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2026;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2027;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2028;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2029;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2030;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2031;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2032;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2033;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, double, empty> type_ffd_2034;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, std::vector<double>, empty> type_ffd_2035;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2036;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_2037;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2038;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2039;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, double, empty> type_ffd_2040;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_2041;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2042;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2043;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2044;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2045;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2046;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2047;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2048;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2049;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2050;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2051;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_2052;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2053;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2054;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2055;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2056;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2057;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2058;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2059;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2060;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2061;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2062;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2063;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2064;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2065;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2066;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2067;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2068;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2069;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_2070;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_2071;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2072;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_2073;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2074;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2075;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_2076;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_2077;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2078;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2079;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2080;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2081;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2082;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2083;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2084;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2085;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2086;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2087;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_2088;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2089;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2090;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2091;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2092;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2093;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2094;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2095;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2096;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2097;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2098;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2000> AgradDistributionWiener_ffd_2000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2001> AgradDistributionWiener_ffd_2001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2002> AgradDistributionWiener_ffd_2002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2003> AgradDistributionWiener_ffd_2003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2004> AgradDistributionWiener_ffd_2004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2005> AgradDistributionWiener_ffd_2005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2006> AgradDistributionWiener_ffd_2006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2007> AgradDistributionWiener_ffd_2007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2008> AgradDistributionWiener_ffd_2008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2009> AgradDistributionWiener_ffd_2009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2010> AgradDistributionWiener_ffd_2010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2011> AgradDistributionWiener_ffd_2011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2012> AgradDistributionWiener_ffd_2012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2013> AgradDistributionWiener_ffd_2013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2014> AgradDistributionWiener_ffd_2014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2015> AgradDistributionWiener_ffd_2015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2016> AgradDistributionWiener_ffd_2016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2017> AgradDistributionWiener_ffd_2017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2018> AgradDistributionWiener_ffd_2018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2019> AgradDistributionWiener_ffd_2019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2020> AgradDistributionWiener_ffd_2020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2021> AgradDistributionWiener_ffd_2021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2022> AgradDistributionWiener_ffd_2022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2023> AgradDistributionWiener_ffd_2023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2024> AgradDistributionWiener_ffd_2024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2025> AgradDistributionWiener_ffd_2025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2026> AgradDistributionWiener_ffd_2026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2027> AgradDistributionWiener_ffd_2027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2028> AgradDistributionWiener_ffd_2028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2029> AgradDistributionWiener_ffd_2029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2030> AgradDistributionWiener_ffd_2030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2031> AgradDistributionWiener_ffd_2031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2032> AgradDistributionWiener_ffd_2032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2033> AgradDistributionWiener_ffd_2033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2034> AgradDistributionWiener_ffd_2034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2035> AgradDistributionWiener_ffd_2035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2036> AgradDistributionWiener_ffd_2036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2037> AgradDistributionWiener_ffd_2037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2038> AgradDistributionWiener_ffd_2038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2039> AgradDistributionWiener_ffd_2039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2040> AgradDistributionWiener_ffd_2040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2041> AgradDistributionWiener_ffd_2041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2042> AgradDistributionWiener_ffd_2042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2043> AgradDistributionWiener_ffd_2043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2044> AgradDistributionWiener_ffd_2044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2045> AgradDistributionWiener_ffd_2045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2046> AgradDistributionWiener_ffd_2046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2047> AgradDistributionWiener_ffd_2047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2048> AgradDistributionWiener_ffd_2048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2049> AgradDistributionWiener_ffd_2049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2050> AgradDistributionWiener_ffd_2050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2051> AgradDistributionWiener_ffd_2051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2052> AgradDistributionWiener_ffd_2052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2053> AgradDistributionWiener_ffd_2053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2054> AgradDistributionWiener_ffd_2054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2055> AgradDistributionWiener_ffd_2055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2056> AgradDistributionWiener_ffd_2056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2057> AgradDistributionWiener_ffd_2057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2058> AgradDistributionWiener_ffd_2058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2059> AgradDistributionWiener_ffd_2059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2060> AgradDistributionWiener_ffd_2060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2061> AgradDistributionWiener_ffd_2061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2062> AgradDistributionWiener_ffd_2062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2063> AgradDistributionWiener_ffd_2063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2064> AgradDistributionWiener_ffd_2064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2065> AgradDistributionWiener_ffd_2065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2066> AgradDistributionWiener_ffd_2066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2067> AgradDistributionWiener_ffd_2067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2068> AgradDistributionWiener_ffd_2068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2069> AgradDistributionWiener_ffd_2069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2070> AgradDistributionWiener_ffd_2070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2071> AgradDistributionWiener_ffd_2071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2072> AgradDistributionWiener_ffd_2072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2073> AgradDistributionWiener_ffd_2073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2074> AgradDistributionWiener_ffd_2074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2075> AgradDistributionWiener_ffd_2075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2076> AgradDistributionWiener_ffd_2076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2077> AgradDistributionWiener_ffd_2077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2078> AgradDistributionWiener_ffd_2078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2079> AgradDistributionWiener_ffd_2079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2080> AgradDistributionWiener_ffd_2080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2081> AgradDistributionWiener_ffd_2081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2082> AgradDistributionWiener_ffd_2082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2083> AgradDistributionWiener_ffd_2083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2084> AgradDistributionWiener_ffd_2084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2085> AgradDistributionWiener_ffd_2085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2086> AgradDistributionWiener_ffd_2086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2087> AgradDistributionWiener_ffd_2087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2088> AgradDistributionWiener_ffd_2088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2089> AgradDistributionWiener_ffd_2089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2090> AgradDistributionWiener_ffd_2090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2091> AgradDistributionWiener_ffd_2091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2092> AgradDistributionWiener_ffd_2092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2093> AgradDistributionWiener_ffd_2093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2094> AgradDistributionWiener_ffd_2094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2095> AgradDistributionWiener_ffd_2095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2096> AgradDistributionWiener_ffd_2096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2097> AgradDistributionWiener_ffd_2097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2098> AgradDistributionWiener_ffd_2098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2099> AgradDistributionWiener_ffd_2099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2000, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2001, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2002, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2003, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2004, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2005, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2006, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2007, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2008, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2009, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2010, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2011, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2012, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2013, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2014, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2015, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2016, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2017, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2018, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2019, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2020, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2021, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2022, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2023, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2024, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2025, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2026, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2027, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2028, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2029, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2030, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2031, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2032, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2033, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2034, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2035, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2036, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2037, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2038, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2039, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2040, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2041, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2042, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2043, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2044, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2045, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2046, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2047, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2048, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2049, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2050, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2051, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2052, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2053, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2054, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2055, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2056, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2057, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2058, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2059, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2060, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2061, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2062, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2063, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2064, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2065, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2066, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2067, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2068, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2069, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2070, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2071, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2072, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2073, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2074, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2075, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2076, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2077, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2078, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2079, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2080, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2081, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2082, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2083, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2084, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2085, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2086, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2087, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2088, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2089, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2090, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2091, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2092, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2093, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2094, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2095, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2096, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2097, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2098, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2099, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2099);
+
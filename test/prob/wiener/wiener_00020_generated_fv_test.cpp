@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2000;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, double, fvar<var>, empty> type_fv_2001;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, empty> type_fv_2002;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2003;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, double, empty> type_fv_2004;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, empty> type_fv_2005;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2006;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, empty> type_fv_2007;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_2008;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2009;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_2010;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2011;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2012;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2013;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2014;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2015;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, double, empty> type_fv_2016;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, std::vector<double>, empty> type_fv_2017;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2018;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, fvar<var>, empty> type_fv_2019;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_2020;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2021;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, double, empty> type_fv_2022;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_2023;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2024;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_2025;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_2026;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2027;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_2028;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2029;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2030;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2031;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2032;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2033;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, double, empty> type_fv_2034;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, std::vector<double>, empty> type_fv_2035;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2036;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, fvar<var>, empty> type_fv_2037;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_2038;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2039;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, double, empty> type_fv_2040;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_2041;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2042;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_2043;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_2044;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2045;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_2046;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2047;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2048;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2049;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2050;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2051;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, empty> type_fv_2052;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_2053;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2054;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_2055;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_2056;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2057;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_2058;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_2059;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2060;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_2061;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_2062;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2063;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_2064;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2065;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2066;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2067;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2068;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2069;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_2070;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_2071;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2072;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_2073;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_2074;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2075;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_2076;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_2077;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2078;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_2079;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_2080;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2081;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_2082;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2083;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2084;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2085;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2086;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2087;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_2088;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_2089;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2090;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_2091;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_2092;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2093;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_2094;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_2095;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2096;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_2097;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_2098;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2000> AgradDistributionWiener_fv_2000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2001> AgradDistributionWiener_fv_2001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2002> AgradDistributionWiener_fv_2002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2003> AgradDistributionWiener_fv_2003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2004> AgradDistributionWiener_fv_2004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2005> AgradDistributionWiener_fv_2005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2006> AgradDistributionWiener_fv_2006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2007> AgradDistributionWiener_fv_2007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2008> AgradDistributionWiener_fv_2008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2009> AgradDistributionWiener_fv_2009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2010> AgradDistributionWiener_fv_2010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2011> AgradDistributionWiener_fv_2011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2012> AgradDistributionWiener_fv_2012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2013> AgradDistributionWiener_fv_2013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2014> AgradDistributionWiener_fv_2014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2015> AgradDistributionWiener_fv_2015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2016> AgradDistributionWiener_fv_2016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2017> AgradDistributionWiener_fv_2017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2018> AgradDistributionWiener_fv_2018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2019> AgradDistributionWiener_fv_2019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2020> AgradDistributionWiener_fv_2020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2021> AgradDistributionWiener_fv_2021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2022> AgradDistributionWiener_fv_2022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2023> AgradDistributionWiener_fv_2023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2024> AgradDistributionWiener_fv_2024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2025> AgradDistributionWiener_fv_2025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2026> AgradDistributionWiener_fv_2026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2027> AgradDistributionWiener_fv_2027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2028> AgradDistributionWiener_fv_2028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2029> AgradDistributionWiener_fv_2029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2030> AgradDistributionWiener_fv_2030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2031> AgradDistributionWiener_fv_2031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2032> AgradDistributionWiener_fv_2032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2033> AgradDistributionWiener_fv_2033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2034> AgradDistributionWiener_fv_2034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2035> AgradDistributionWiener_fv_2035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2036> AgradDistributionWiener_fv_2036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2037> AgradDistributionWiener_fv_2037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2038> AgradDistributionWiener_fv_2038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2039> AgradDistributionWiener_fv_2039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2040> AgradDistributionWiener_fv_2040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2041> AgradDistributionWiener_fv_2041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2042> AgradDistributionWiener_fv_2042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2043> AgradDistributionWiener_fv_2043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2044> AgradDistributionWiener_fv_2044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2045> AgradDistributionWiener_fv_2045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2046> AgradDistributionWiener_fv_2046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2047> AgradDistributionWiener_fv_2047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2048> AgradDistributionWiener_fv_2048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2049> AgradDistributionWiener_fv_2049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2050> AgradDistributionWiener_fv_2050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2051> AgradDistributionWiener_fv_2051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2052> AgradDistributionWiener_fv_2052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2053> AgradDistributionWiener_fv_2053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2054> AgradDistributionWiener_fv_2054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2055> AgradDistributionWiener_fv_2055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2056> AgradDistributionWiener_fv_2056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2057> AgradDistributionWiener_fv_2057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2058> AgradDistributionWiener_fv_2058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2059> AgradDistributionWiener_fv_2059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2060> AgradDistributionWiener_fv_2060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2061> AgradDistributionWiener_fv_2061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2062> AgradDistributionWiener_fv_2062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2063> AgradDistributionWiener_fv_2063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2064> AgradDistributionWiener_fv_2064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2065> AgradDistributionWiener_fv_2065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2066> AgradDistributionWiener_fv_2066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2067> AgradDistributionWiener_fv_2067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2068> AgradDistributionWiener_fv_2068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2069> AgradDistributionWiener_fv_2069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2070> AgradDistributionWiener_fv_2070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2071> AgradDistributionWiener_fv_2071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2072> AgradDistributionWiener_fv_2072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2073> AgradDistributionWiener_fv_2073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2074> AgradDistributionWiener_fv_2074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2075> AgradDistributionWiener_fv_2075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2076> AgradDistributionWiener_fv_2076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2077> AgradDistributionWiener_fv_2077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2078> AgradDistributionWiener_fv_2078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2079> AgradDistributionWiener_fv_2079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2080> AgradDistributionWiener_fv_2080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2081> AgradDistributionWiener_fv_2081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2082> AgradDistributionWiener_fv_2082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2083> AgradDistributionWiener_fv_2083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2084> AgradDistributionWiener_fv_2084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2085> AgradDistributionWiener_fv_2085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2086> AgradDistributionWiener_fv_2086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2087> AgradDistributionWiener_fv_2087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2088> AgradDistributionWiener_fv_2088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2089> AgradDistributionWiener_fv_2089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2090> AgradDistributionWiener_fv_2090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2091> AgradDistributionWiener_fv_2091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2092> AgradDistributionWiener_fv_2092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2093> AgradDistributionWiener_fv_2093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2094> AgradDistributionWiener_fv_2094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2095> AgradDistributionWiener_fv_2095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2096> AgradDistributionWiener_fv_2096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2097> AgradDistributionWiener_fv_2097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2098> AgradDistributionWiener_fv_2098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2099> AgradDistributionWiener_fv_2099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2000, AgradDistributionTestFixture, AgradDistributionWiener_fv_2000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2001, AgradDistributionTestFixture, AgradDistributionWiener_fv_2001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2002, AgradDistributionTestFixture, AgradDistributionWiener_fv_2002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2003, AgradDistributionTestFixture, AgradDistributionWiener_fv_2003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2004, AgradDistributionTestFixture, AgradDistributionWiener_fv_2004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2005, AgradDistributionTestFixture, AgradDistributionWiener_fv_2005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2006, AgradDistributionTestFixture, AgradDistributionWiener_fv_2006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2007, AgradDistributionTestFixture, AgradDistributionWiener_fv_2007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2008, AgradDistributionTestFixture, AgradDistributionWiener_fv_2008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2009, AgradDistributionTestFixture, AgradDistributionWiener_fv_2009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2010, AgradDistributionTestFixture, AgradDistributionWiener_fv_2010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2011, AgradDistributionTestFixture, AgradDistributionWiener_fv_2011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2012, AgradDistributionTestFixture, AgradDistributionWiener_fv_2012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2013, AgradDistributionTestFixture, AgradDistributionWiener_fv_2013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2014, AgradDistributionTestFixture, AgradDistributionWiener_fv_2014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2015, AgradDistributionTestFixture, AgradDistributionWiener_fv_2015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2016, AgradDistributionTestFixture, AgradDistributionWiener_fv_2016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2017, AgradDistributionTestFixture, AgradDistributionWiener_fv_2017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2018, AgradDistributionTestFixture, AgradDistributionWiener_fv_2018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2019, AgradDistributionTestFixture, AgradDistributionWiener_fv_2019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2020, AgradDistributionTestFixture, AgradDistributionWiener_fv_2020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2021, AgradDistributionTestFixture, AgradDistributionWiener_fv_2021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2022, AgradDistributionTestFixture, AgradDistributionWiener_fv_2022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2023, AgradDistributionTestFixture, AgradDistributionWiener_fv_2023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2024, AgradDistributionTestFixture, AgradDistributionWiener_fv_2024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2025, AgradDistributionTestFixture, AgradDistributionWiener_fv_2025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2026, AgradDistributionTestFixture, AgradDistributionWiener_fv_2026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2027, AgradDistributionTestFixture, AgradDistributionWiener_fv_2027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2028, AgradDistributionTestFixture, AgradDistributionWiener_fv_2028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2029, AgradDistributionTestFixture, AgradDistributionWiener_fv_2029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2030, AgradDistributionTestFixture, AgradDistributionWiener_fv_2030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2031, AgradDistributionTestFixture, AgradDistributionWiener_fv_2031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2032, AgradDistributionTestFixture, AgradDistributionWiener_fv_2032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2033, AgradDistributionTestFixture, AgradDistributionWiener_fv_2033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2034, AgradDistributionTestFixture, AgradDistributionWiener_fv_2034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2035, AgradDistributionTestFixture, AgradDistributionWiener_fv_2035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2036, AgradDistributionTestFixture, AgradDistributionWiener_fv_2036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2037, AgradDistributionTestFixture, AgradDistributionWiener_fv_2037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2038, AgradDistributionTestFixture, AgradDistributionWiener_fv_2038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2039, AgradDistributionTestFixture, AgradDistributionWiener_fv_2039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2040, AgradDistributionTestFixture, AgradDistributionWiener_fv_2040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2041, AgradDistributionTestFixture, AgradDistributionWiener_fv_2041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2042, AgradDistributionTestFixture, AgradDistributionWiener_fv_2042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2043, AgradDistributionTestFixture, AgradDistributionWiener_fv_2043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2044, AgradDistributionTestFixture, AgradDistributionWiener_fv_2044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2045, AgradDistributionTestFixture, AgradDistributionWiener_fv_2045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2046, AgradDistributionTestFixture, AgradDistributionWiener_fv_2046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2047, AgradDistributionTestFixture, AgradDistributionWiener_fv_2047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2048, AgradDistributionTestFixture, AgradDistributionWiener_fv_2048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2049, AgradDistributionTestFixture, AgradDistributionWiener_fv_2049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2050, AgradDistributionTestFixture, AgradDistributionWiener_fv_2050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2051, AgradDistributionTestFixture, AgradDistributionWiener_fv_2051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2052, AgradDistributionTestFixture, AgradDistributionWiener_fv_2052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2053, AgradDistributionTestFixture, AgradDistributionWiener_fv_2053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2054, AgradDistributionTestFixture, AgradDistributionWiener_fv_2054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2055, AgradDistributionTestFixture, AgradDistributionWiener_fv_2055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2056, AgradDistributionTestFixture, AgradDistributionWiener_fv_2056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2057, AgradDistributionTestFixture, AgradDistributionWiener_fv_2057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2058, AgradDistributionTestFixture, AgradDistributionWiener_fv_2058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2059, AgradDistributionTestFixture, AgradDistributionWiener_fv_2059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2060, AgradDistributionTestFixture, AgradDistributionWiener_fv_2060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2061, AgradDistributionTestFixture, AgradDistributionWiener_fv_2061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2062, AgradDistributionTestFixture, AgradDistributionWiener_fv_2062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2063, AgradDistributionTestFixture, AgradDistributionWiener_fv_2063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2064, AgradDistributionTestFixture, AgradDistributionWiener_fv_2064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2065, AgradDistributionTestFixture, AgradDistributionWiener_fv_2065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2066, AgradDistributionTestFixture, AgradDistributionWiener_fv_2066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2067, AgradDistributionTestFixture, AgradDistributionWiener_fv_2067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2068, AgradDistributionTestFixture, AgradDistributionWiener_fv_2068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2069, AgradDistributionTestFixture, AgradDistributionWiener_fv_2069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2070, AgradDistributionTestFixture, AgradDistributionWiener_fv_2070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2071, AgradDistributionTestFixture, AgradDistributionWiener_fv_2071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2072, AgradDistributionTestFixture, AgradDistributionWiener_fv_2072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2073, AgradDistributionTestFixture, AgradDistributionWiener_fv_2073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2074, AgradDistributionTestFixture, AgradDistributionWiener_fv_2074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2075, AgradDistributionTestFixture, AgradDistributionWiener_fv_2075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2076, AgradDistributionTestFixture, AgradDistributionWiener_fv_2076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2077, AgradDistributionTestFixture, AgradDistributionWiener_fv_2077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2078, AgradDistributionTestFixture, AgradDistributionWiener_fv_2078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2079, AgradDistributionTestFixture, AgradDistributionWiener_fv_2079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2080, AgradDistributionTestFixture, AgradDistributionWiener_fv_2080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2081, AgradDistributionTestFixture, AgradDistributionWiener_fv_2081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2082, AgradDistributionTestFixture, AgradDistributionWiener_fv_2082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2083, AgradDistributionTestFixture, AgradDistributionWiener_fv_2083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2084, AgradDistributionTestFixture, AgradDistributionWiener_fv_2084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2085, AgradDistributionTestFixture, AgradDistributionWiener_fv_2085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2086, AgradDistributionTestFixture, AgradDistributionWiener_fv_2086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2087, AgradDistributionTestFixture, AgradDistributionWiener_fv_2087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2088, AgradDistributionTestFixture, AgradDistributionWiener_fv_2088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2089, AgradDistributionTestFixture, AgradDistributionWiener_fv_2089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2090, AgradDistributionTestFixture, AgradDistributionWiener_fv_2090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2091, AgradDistributionTestFixture, AgradDistributionWiener_fv_2091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2092, AgradDistributionTestFixture, AgradDistributionWiener_fv_2092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2093, AgradDistributionTestFixture, AgradDistributionWiener_fv_2093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2094, AgradDistributionTestFixture, AgradDistributionWiener_fv_2094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2095, AgradDistributionTestFixture, AgradDistributionWiener_fv_2095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2096, AgradDistributionTestFixture, AgradDistributionWiener_fv_2096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2097, AgradDistributionTestFixture, AgradDistributionWiener_fv_2097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2098, AgradDistributionTestFixture, AgradDistributionWiener_fv_2098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2099, AgradDistributionTestFixture, AgradDistributionWiener_fv_2099);
+
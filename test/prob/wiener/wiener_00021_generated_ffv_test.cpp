@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2100;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2101;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2102;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2103;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2104;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2105;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty> type_ffv_2106;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_2107;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2108;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_2109;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2110;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2111;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_2112;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_2113;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2114;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2115;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2116;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2117;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2118;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2119;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2120;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2121;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2122;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2123;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_2124;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2125;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2126;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2127;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2128;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2129;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2130;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2131;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2132;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2133;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2134;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2135;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2136;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2137;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2138;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2139;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2140;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2141;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_2142;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_2143;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2144;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_2145;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2146;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2147;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_2148;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_2149;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2150;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2151;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2152;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2153;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2154;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2155;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2156;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2157;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2158;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2159;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_2160;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2161;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2162;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2163;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2164;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2165;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2166;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2167;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2168;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2169;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2170;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2171;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2172;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2173;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2174;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2175;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2176;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2177;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2178;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2179;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2180;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2181;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2182;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2183;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2184;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2185;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2186;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2187;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2188;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2189;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2190;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2191;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2192;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2193;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2194;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2195;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2196;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2197;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2198;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2100> AgradDistributionWiener_ffv_2100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2101> AgradDistributionWiener_ffv_2101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2102> AgradDistributionWiener_ffv_2102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2103> AgradDistributionWiener_ffv_2103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2104> AgradDistributionWiener_ffv_2104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2105> AgradDistributionWiener_ffv_2105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2106> AgradDistributionWiener_ffv_2106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2107> AgradDistributionWiener_ffv_2107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2108> AgradDistributionWiener_ffv_2108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2109> AgradDistributionWiener_ffv_2109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2110> AgradDistributionWiener_ffv_2110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2111> AgradDistributionWiener_ffv_2111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2112> AgradDistributionWiener_ffv_2112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2113> AgradDistributionWiener_ffv_2113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2114> AgradDistributionWiener_ffv_2114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2115> AgradDistributionWiener_ffv_2115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2116> AgradDistributionWiener_ffv_2116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2117> AgradDistributionWiener_ffv_2117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2118> AgradDistributionWiener_ffv_2118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2119> AgradDistributionWiener_ffv_2119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2120> AgradDistributionWiener_ffv_2120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2121> AgradDistributionWiener_ffv_2121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2122> AgradDistributionWiener_ffv_2122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2123> AgradDistributionWiener_ffv_2123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2124> AgradDistributionWiener_ffv_2124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2125> AgradDistributionWiener_ffv_2125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2126> AgradDistributionWiener_ffv_2126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2127> AgradDistributionWiener_ffv_2127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2128> AgradDistributionWiener_ffv_2128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2129> AgradDistributionWiener_ffv_2129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2130> AgradDistributionWiener_ffv_2130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2131> AgradDistributionWiener_ffv_2131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2132> AgradDistributionWiener_ffv_2132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2133> AgradDistributionWiener_ffv_2133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2134> AgradDistributionWiener_ffv_2134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2135> AgradDistributionWiener_ffv_2135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2136> AgradDistributionWiener_ffv_2136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2137> AgradDistributionWiener_ffv_2137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2138> AgradDistributionWiener_ffv_2138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2139> AgradDistributionWiener_ffv_2139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2140> AgradDistributionWiener_ffv_2140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2141> AgradDistributionWiener_ffv_2141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2142> AgradDistributionWiener_ffv_2142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2143> AgradDistributionWiener_ffv_2143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2144> AgradDistributionWiener_ffv_2144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2145> AgradDistributionWiener_ffv_2145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2146> AgradDistributionWiener_ffv_2146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2147> AgradDistributionWiener_ffv_2147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2148> AgradDistributionWiener_ffv_2148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2149> AgradDistributionWiener_ffv_2149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2150> AgradDistributionWiener_ffv_2150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2151> AgradDistributionWiener_ffv_2151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2152> AgradDistributionWiener_ffv_2152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2153> AgradDistributionWiener_ffv_2153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2154> AgradDistributionWiener_ffv_2154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2155> AgradDistributionWiener_ffv_2155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2156> AgradDistributionWiener_ffv_2156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2157> AgradDistributionWiener_ffv_2157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2158> AgradDistributionWiener_ffv_2158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2159> AgradDistributionWiener_ffv_2159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2160> AgradDistributionWiener_ffv_2160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2161> AgradDistributionWiener_ffv_2161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2162> AgradDistributionWiener_ffv_2162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2163> AgradDistributionWiener_ffv_2163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2164> AgradDistributionWiener_ffv_2164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2165> AgradDistributionWiener_ffv_2165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2166> AgradDistributionWiener_ffv_2166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2167> AgradDistributionWiener_ffv_2167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2168> AgradDistributionWiener_ffv_2168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2169> AgradDistributionWiener_ffv_2169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2170> AgradDistributionWiener_ffv_2170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2171> AgradDistributionWiener_ffv_2171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2172> AgradDistributionWiener_ffv_2172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2173> AgradDistributionWiener_ffv_2173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2174> AgradDistributionWiener_ffv_2174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2175> AgradDistributionWiener_ffv_2175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2176> AgradDistributionWiener_ffv_2176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2177> AgradDistributionWiener_ffv_2177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2178> AgradDistributionWiener_ffv_2178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2179> AgradDistributionWiener_ffv_2179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2180> AgradDistributionWiener_ffv_2180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2181> AgradDistributionWiener_ffv_2181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2182> AgradDistributionWiener_ffv_2182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2183> AgradDistributionWiener_ffv_2183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2184> AgradDistributionWiener_ffv_2184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2185> AgradDistributionWiener_ffv_2185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2186> AgradDistributionWiener_ffv_2186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2187> AgradDistributionWiener_ffv_2187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2188> AgradDistributionWiener_ffv_2188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2189> AgradDistributionWiener_ffv_2189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2190> AgradDistributionWiener_ffv_2190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2191> AgradDistributionWiener_ffv_2191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2192> AgradDistributionWiener_ffv_2192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2193> AgradDistributionWiener_ffv_2193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2194> AgradDistributionWiener_ffv_2194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2195> AgradDistributionWiener_ffv_2195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2196> AgradDistributionWiener_ffv_2196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2197> AgradDistributionWiener_ffv_2197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2198> AgradDistributionWiener_ffv_2198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2199> AgradDistributionWiener_ffv_2199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2100, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2101, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2102, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2103, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2104, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2105, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2106, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2107, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2108, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2109, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2110, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2111, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2112, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2113, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2114, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2115, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2116, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2117, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2118, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2119, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2120, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2121, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2122, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2123, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2124, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2125, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2126, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2127, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2128, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2129, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2130, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2131, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2132, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2133, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2134, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2135, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2136, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2137, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2138, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2139, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2140, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2141, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2142, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2143, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2144, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2145, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2146, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2147, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2148, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2149, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2150, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2151, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2152, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2153, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2154, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2155, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2156, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2157, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2158, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2159, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2160, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2161, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2162, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2163, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2164, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2165, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2166, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2167, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2168, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2169, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2170, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2171, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2172, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2173, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2174, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2175, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2176, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2177, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2178, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2179, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2180, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2181, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2182, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2183, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2184, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2185, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2186, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2187, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2188, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2189, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2190, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2191, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2192, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2193, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2194, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2195, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2196, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2197, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2198, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2199, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2199);
+
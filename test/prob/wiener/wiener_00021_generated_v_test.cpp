@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2100;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2101;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2102;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2103;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2104;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2105;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, var, double, empty> type_v_2106;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, var, std::vector<double>, empty> type_v_2107;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2108;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, var, var, empty> type_v_2109;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, var, std::vector<var>, empty> type_v_2110;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2111;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, std::vector<var>, double, empty> type_v_2112;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_2113;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2114;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, std::vector<var>, var, empty> type_v_2115;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_2116;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2117;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2118;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2119;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2120;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2121;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2122;
+typedef boost::mpl::vector<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2123;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_2124;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2125;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2126;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_2127;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2128;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2129;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2130;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2131;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2132;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2133;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2134;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2135;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2136;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2137;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2138;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2139;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2140;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2141;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_2142;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_2143;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2144;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_2145;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2146;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2147;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2148;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2149;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2150;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2151;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2152;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2153;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2154;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2155;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2156;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2157;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2158;
+typedef boost::mpl::vector<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2159;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, double, double, empty> type_v_2160;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, double, std::vector<double>, empty> type_v_2161;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2162;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, double, var, empty> type_v_2163;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, double, std::vector<var>, empty> type_v_2164;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2165;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<double>, double, empty> type_v_2166;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<double>, std::vector<double>, empty> type_v_2167;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2168;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<double>, var, empty> type_v_2169;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<double>, std::vector<var>, empty> type_v_2170;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2171;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2172;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2173;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2174;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2175;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2176;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2177;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, var, double, empty> type_v_2178;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, var, std::vector<double>, empty> type_v_2179;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2180;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, var, var, empty> type_v_2181;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, var, std::vector<var>, empty> type_v_2182;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2183;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<var>, double, empty> type_v_2184;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<var>, std::vector<double>, empty> type_v_2185;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2186;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<var>, var, empty> type_v_2187;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<var>, std::vector<var>, empty> type_v_2188;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2189;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2190;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2191;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2192;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2193;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2194;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2195;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<double>, double, double, empty> type_v_2196;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<double>, double, std::vector<double>, empty> type_v_2197;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2198;
+typedef boost::mpl::vector<std::vector<double>, std::vector<var>, std::vector<double>, double, var, empty> type_v_2199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2100> AgradDistributionWiener_v_2100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2101> AgradDistributionWiener_v_2101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2102> AgradDistributionWiener_v_2102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2103> AgradDistributionWiener_v_2103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2104> AgradDistributionWiener_v_2104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2105> AgradDistributionWiener_v_2105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2106> AgradDistributionWiener_v_2106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2107> AgradDistributionWiener_v_2107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2108> AgradDistributionWiener_v_2108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2109> AgradDistributionWiener_v_2109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2110> AgradDistributionWiener_v_2110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2111> AgradDistributionWiener_v_2111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2112> AgradDistributionWiener_v_2112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2113> AgradDistributionWiener_v_2113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2114> AgradDistributionWiener_v_2114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2115> AgradDistributionWiener_v_2115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2116> AgradDistributionWiener_v_2116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2117> AgradDistributionWiener_v_2117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2118> AgradDistributionWiener_v_2118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2119> AgradDistributionWiener_v_2119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2120> AgradDistributionWiener_v_2120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2121> AgradDistributionWiener_v_2121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2122> AgradDistributionWiener_v_2122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2123> AgradDistributionWiener_v_2123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2124> AgradDistributionWiener_v_2124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2125> AgradDistributionWiener_v_2125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2126> AgradDistributionWiener_v_2126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2127> AgradDistributionWiener_v_2127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2128> AgradDistributionWiener_v_2128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2129> AgradDistributionWiener_v_2129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2130> AgradDistributionWiener_v_2130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2131> AgradDistributionWiener_v_2131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2132> AgradDistributionWiener_v_2132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2133> AgradDistributionWiener_v_2133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2134> AgradDistributionWiener_v_2134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2135> AgradDistributionWiener_v_2135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2136> AgradDistributionWiener_v_2136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2137> AgradDistributionWiener_v_2137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2138> AgradDistributionWiener_v_2138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2139> AgradDistributionWiener_v_2139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2140> AgradDistributionWiener_v_2140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2141> AgradDistributionWiener_v_2141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2142> AgradDistributionWiener_v_2142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2143> AgradDistributionWiener_v_2143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2144> AgradDistributionWiener_v_2144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2145> AgradDistributionWiener_v_2145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2146> AgradDistributionWiener_v_2146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2147> AgradDistributionWiener_v_2147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2148> AgradDistributionWiener_v_2148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2149> AgradDistributionWiener_v_2149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2150> AgradDistributionWiener_v_2150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2151> AgradDistributionWiener_v_2151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2152> AgradDistributionWiener_v_2152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2153> AgradDistributionWiener_v_2153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2154> AgradDistributionWiener_v_2154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2155> AgradDistributionWiener_v_2155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2156> AgradDistributionWiener_v_2156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2157> AgradDistributionWiener_v_2157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2158> AgradDistributionWiener_v_2158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2159> AgradDistributionWiener_v_2159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2160> AgradDistributionWiener_v_2160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2161> AgradDistributionWiener_v_2161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2162> AgradDistributionWiener_v_2162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2163> AgradDistributionWiener_v_2163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2164> AgradDistributionWiener_v_2164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2165> AgradDistributionWiener_v_2165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2166> AgradDistributionWiener_v_2166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2167> AgradDistributionWiener_v_2167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2168> AgradDistributionWiener_v_2168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2169> AgradDistributionWiener_v_2169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2170> AgradDistributionWiener_v_2170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2171> AgradDistributionWiener_v_2171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2172> AgradDistributionWiener_v_2172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2173> AgradDistributionWiener_v_2173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2174> AgradDistributionWiener_v_2174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2175> AgradDistributionWiener_v_2175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2176> AgradDistributionWiener_v_2176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2177> AgradDistributionWiener_v_2177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2178> AgradDistributionWiener_v_2178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2179> AgradDistributionWiener_v_2179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2180> AgradDistributionWiener_v_2180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2181> AgradDistributionWiener_v_2181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2182> AgradDistributionWiener_v_2182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2183> AgradDistributionWiener_v_2183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2184> AgradDistributionWiener_v_2184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2185> AgradDistributionWiener_v_2185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2186> AgradDistributionWiener_v_2186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2187> AgradDistributionWiener_v_2187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2188> AgradDistributionWiener_v_2188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2189> AgradDistributionWiener_v_2189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2190> AgradDistributionWiener_v_2190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2191> AgradDistributionWiener_v_2191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2192> AgradDistributionWiener_v_2192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2193> AgradDistributionWiener_v_2193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2194> AgradDistributionWiener_v_2194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2195> AgradDistributionWiener_v_2195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2196> AgradDistributionWiener_v_2196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2197> AgradDistributionWiener_v_2197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2198> AgradDistributionWiener_v_2198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2199> AgradDistributionWiener_v_2199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2100, AgradDistributionTestFixture, AgradDistributionWiener_v_2100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2101, AgradDistributionTestFixture, AgradDistributionWiener_v_2101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2102, AgradDistributionTestFixture, AgradDistributionWiener_v_2102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2103, AgradDistributionTestFixture, AgradDistributionWiener_v_2103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2104, AgradDistributionTestFixture, AgradDistributionWiener_v_2104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2105, AgradDistributionTestFixture, AgradDistributionWiener_v_2105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2106, AgradDistributionTestFixture, AgradDistributionWiener_v_2106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2107, AgradDistributionTestFixture, AgradDistributionWiener_v_2107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2108, AgradDistributionTestFixture, AgradDistributionWiener_v_2108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2109, AgradDistributionTestFixture, AgradDistributionWiener_v_2109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2110, AgradDistributionTestFixture, AgradDistributionWiener_v_2110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2111, AgradDistributionTestFixture, AgradDistributionWiener_v_2111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2112, AgradDistributionTestFixture, AgradDistributionWiener_v_2112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2113, AgradDistributionTestFixture, AgradDistributionWiener_v_2113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2114, AgradDistributionTestFixture, AgradDistributionWiener_v_2114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2115, AgradDistributionTestFixture, AgradDistributionWiener_v_2115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2116, AgradDistributionTestFixture, AgradDistributionWiener_v_2116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2117, AgradDistributionTestFixture, AgradDistributionWiener_v_2117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2118, AgradDistributionTestFixture, AgradDistributionWiener_v_2118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2119, AgradDistributionTestFixture, AgradDistributionWiener_v_2119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2120, AgradDistributionTestFixture, AgradDistributionWiener_v_2120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2121, AgradDistributionTestFixture, AgradDistributionWiener_v_2121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2122, AgradDistributionTestFixture, AgradDistributionWiener_v_2122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2123, AgradDistributionTestFixture, AgradDistributionWiener_v_2123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2124, AgradDistributionTestFixture, AgradDistributionWiener_v_2124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2125, AgradDistributionTestFixture, AgradDistributionWiener_v_2125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2126, AgradDistributionTestFixture, AgradDistributionWiener_v_2126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2127, AgradDistributionTestFixture, AgradDistributionWiener_v_2127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2128, AgradDistributionTestFixture, AgradDistributionWiener_v_2128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2129, AgradDistributionTestFixture, AgradDistributionWiener_v_2129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2130, AgradDistributionTestFixture, AgradDistributionWiener_v_2130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2131, AgradDistributionTestFixture, AgradDistributionWiener_v_2131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2132, AgradDistributionTestFixture, AgradDistributionWiener_v_2132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2133, AgradDistributionTestFixture, AgradDistributionWiener_v_2133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2134, AgradDistributionTestFixture, AgradDistributionWiener_v_2134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2135, AgradDistributionTestFixture, AgradDistributionWiener_v_2135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2136, AgradDistributionTestFixture, AgradDistributionWiener_v_2136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2137, AgradDistributionTestFixture, AgradDistributionWiener_v_2137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2138, AgradDistributionTestFixture, AgradDistributionWiener_v_2138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2139, AgradDistributionTestFixture, AgradDistributionWiener_v_2139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2140, AgradDistributionTestFixture, AgradDistributionWiener_v_2140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2141, AgradDistributionTestFixture, AgradDistributionWiener_v_2141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2142, AgradDistributionTestFixture, AgradDistributionWiener_v_2142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2143, AgradDistributionTestFixture, AgradDistributionWiener_v_2143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2144, AgradDistributionTestFixture, AgradDistributionWiener_v_2144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2145, AgradDistributionTestFixture, AgradDistributionWiener_v_2145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2146, AgradDistributionTestFixture, AgradDistributionWiener_v_2146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2147, AgradDistributionTestFixture, AgradDistributionWiener_v_2147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2148, AgradDistributionTestFixture, AgradDistributionWiener_v_2148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2149, AgradDistributionTestFixture, AgradDistributionWiener_v_2149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2150, AgradDistributionTestFixture, AgradDistributionWiener_v_2150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2151, AgradDistributionTestFixture, AgradDistributionWiener_v_2151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2152, AgradDistributionTestFixture, AgradDistributionWiener_v_2152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2153, AgradDistributionTestFixture, AgradDistributionWiener_v_2153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2154, AgradDistributionTestFixture, AgradDistributionWiener_v_2154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2155, AgradDistributionTestFixture, AgradDistributionWiener_v_2155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2156, AgradDistributionTestFixture, AgradDistributionWiener_v_2156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2157, AgradDistributionTestFixture, AgradDistributionWiener_v_2157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2158, AgradDistributionTestFixture, AgradDistributionWiener_v_2158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2159, AgradDistributionTestFixture, AgradDistributionWiener_v_2159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2160, AgradDistributionTestFixture, AgradDistributionWiener_v_2160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2161, AgradDistributionTestFixture, AgradDistributionWiener_v_2161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2162, AgradDistributionTestFixture, AgradDistributionWiener_v_2162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2163, AgradDistributionTestFixture, AgradDistributionWiener_v_2163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2164, AgradDistributionTestFixture, AgradDistributionWiener_v_2164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2165, AgradDistributionTestFixture, AgradDistributionWiener_v_2165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2166, AgradDistributionTestFixture, AgradDistributionWiener_v_2166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2167, AgradDistributionTestFixture, AgradDistributionWiener_v_2167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2168, AgradDistributionTestFixture, AgradDistributionWiener_v_2168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2169, AgradDistributionTestFixture, AgradDistributionWiener_v_2169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2170, AgradDistributionTestFixture, AgradDistributionWiener_v_2170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2171, AgradDistributionTestFixture, AgradDistributionWiener_v_2171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2172, AgradDistributionTestFixture, AgradDistributionWiener_v_2172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2173, AgradDistributionTestFixture, AgradDistributionWiener_v_2173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2174, AgradDistributionTestFixture, AgradDistributionWiener_v_2174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2175, AgradDistributionTestFixture, AgradDistributionWiener_v_2175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2176, AgradDistributionTestFixture, AgradDistributionWiener_v_2176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2177, AgradDistributionTestFixture, AgradDistributionWiener_v_2177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2178, AgradDistributionTestFixture, AgradDistributionWiener_v_2178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2179, AgradDistributionTestFixture, AgradDistributionWiener_v_2179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2180, AgradDistributionTestFixture, AgradDistributionWiener_v_2180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2181, AgradDistributionTestFixture, AgradDistributionWiener_v_2181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2182, AgradDistributionTestFixture, AgradDistributionWiener_v_2182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2183, AgradDistributionTestFixture, AgradDistributionWiener_v_2183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2184, AgradDistributionTestFixture, AgradDistributionWiener_v_2184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2185, AgradDistributionTestFixture, AgradDistributionWiener_v_2185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2186, AgradDistributionTestFixture, AgradDistributionWiener_v_2186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2187, AgradDistributionTestFixture, AgradDistributionWiener_v_2187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2188, AgradDistributionTestFixture, AgradDistributionWiener_v_2188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2189, AgradDistributionTestFixture, AgradDistributionWiener_v_2189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2190, AgradDistributionTestFixture, AgradDistributionWiener_v_2190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2191, AgradDistributionTestFixture, AgradDistributionWiener_v_2191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2192, AgradDistributionTestFixture, AgradDistributionWiener_v_2192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2193, AgradDistributionTestFixture, AgradDistributionWiener_v_2193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2194, AgradDistributionTestFixture, AgradDistributionWiener_v_2194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2195, AgradDistributionTestFixture, AgradDistributionWiener_v_2195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2196, AgradDistributionTestFixture, AgradDistributionWiener_v_2196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2197, AgradDistributionTestFixture, AgradDistributionWiener_v_2197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2198, AgradDistributionTestFixture, AgradDistributionWiener_v_2198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2199, AgradDistributionTestFixture, AgradDistributionWiener_v_2199);
+
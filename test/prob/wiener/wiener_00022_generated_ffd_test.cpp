@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2200;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2201;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2202;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2203;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2204;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2205;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2206;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2207;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2208;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2209;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2210;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2211;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2212;
+typedef boost::mpl::vector<std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2213;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, empty> type_ffd_2214;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_ffd_2215;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2216;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, empty> type_ffd_2217;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2218;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2219;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_ffd_2220;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_ffd_2221;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2222;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2223;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2224;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2225;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2226;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2227;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2228;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2229;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2230;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2231;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, double, empty> type_ffd_2232;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2233;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2234;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2235;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2236;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2237;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2238;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2239;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2240;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2241;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2242;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2243;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2244;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2245;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2246;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2247;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2248;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2249;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_ffd_2250;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_ffd_2251;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2252;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_2253;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2254;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2255;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_ffd_2256;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_2257;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2258;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2259;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2260;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2261;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2262;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2263;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2264;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2265;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2266;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2267;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_2268;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2269;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2270;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2271;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2272;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2273;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2274;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2275;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2276;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2277;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2278;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2279;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2280;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2281;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2282;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2283;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2284;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2285;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_2286;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_2287;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2288;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_2289;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2290;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2291;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_2292;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_2293;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2294;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2295;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2296;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2297;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2298;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2200> AgradDistributionWiener_ffd_2200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2201> AgradDistributionWiener_ffd_2201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2202> AgradDistributionWiener_ffd_2202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2203> AgradDistributionWiener_ffd_2203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2204> AgradDistributionWiener_ffd_2204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2205> AgradDistributionWiener_ffd_2205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2206> AgradDistributionWiener_ffd_2206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2207> AgradDistributionWiener_ffd_2207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2208> AgradDistributionWiener_ffd_2208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2209> AgradDistributionWiener_ffd_2209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2210> AgradDistributionWiener_ffd_2210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2211> AgradDistributionWiener_ffd_2211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2212> AgradDistributionWiener_ffd_2212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2213> AgradDistributionWiener_ffd_2213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2214> AgradDistributionWiener_ffd_2214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2215> AgradDistributionWiener_ffd_2215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2216> AgradDistributionWiener_ffd_2216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2217> AgradDistributionWiener_ffd_2217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2218> AgradDistributionWiener_ffd_2218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2219> AgradDistributionWiener_ffd_2219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2220> AgradDistributionWiener_ffd_2220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2221> AgradDistributionWiener_ffd_2221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2222> AgradDistributionWiener_ffd_2222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2223> AgradDistributionWiener_ffd_2223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2224> AgradDistributionWiener_ffd_2224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2225> AgradDistributionWiener_ffd_2225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2226> AgradDistributionWiener_ffd_2226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2227> AgradDistributionWiener_ffd_2227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2228> AgradDistributionWiener_ffd_2228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2229> AgradDistributionWiener_ffd_2229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2230> AgradDistributionWiener_ffd_2230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2231> AgradDistributionWiener_ffd_2231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2232> AgradDistributionWiener_ffd_2232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2233> AgradDistributionWiener_ffd_2233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2234> AgradDistributionWiener_ffd_2234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2235> AgradDistributionWiener_ffd_2235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2236> AgradDistributionWiener_ffd_2236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2237> AgradDistributionWiener_ffd_2237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2238> AgradDistributionWiener_ffd_2238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2239> AgradDistributionWiener_ffd_2239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2240> AgradDistributionWiener_ffd_2240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2241> AgradDistributionWiener_ffd_2241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2242> AgradDistributionWiener_ffd_2242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2243> AgradDistributionWiener_ffd_2243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2244> AgradDistributionWiener_ffd_2244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2245> AgradDistributionWiener_ffd_2245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2246> AgradDistributionWiener_ffd_2246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2247> AgradDistributionWiener_ffd_2247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2248> AgradDistributionWiener_ffd_2248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2249> AgradDistributionWiener_ffd_2249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2250> AgradDistributionWiener_ffd_2250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2251> AgradDistributionWiener_ffd_2251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2252> AgradDistributionWiener_ffd_2252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2253> AgradDistributionWiener_ffd_2253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2254> AgradDistributionWiener_ffd_2254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2255> AgradDistributionWiener_ffd_2255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2256> AgradDistributionWiener_ffd_2256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2257> AgradDistributionWiener_ffd_2257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2258> AgradDistributionWiener_ffd_2258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2259> AgradDistributionWiener_ffd_2259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2260> AgradDistributionWiener_ffd_2260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2261> AgradDistributionWiener_ffd_2261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2262> AgradDistributionWiener_ffd_2262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2263> AgradDistributionWiener_ffd_2263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2264> AgradDistributionWiener_ffd_2264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2265> AgradDistributionWiener_ffd_2265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2266> AgradDistributionWiener_ffd_2266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2267> AgradDistributionWiener_ffd_2267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2268> AgradDistributionWiener_ffd_2268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2269> AgradDistributionWiener_ffd_2269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2270> AgradDistributionWiener_ffd_2270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2271> AgradDistributionWiener_ffd_2271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2272> AgradDistributionWiener_ffd_2272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2273> AgradDistributionWiener_ffd_2273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2274> AgradDistributionWiener_ffd_2274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2275> AgradDistributionWiener_ffd_2275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2276> AgradDistributionWiener_ffd_2276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2277> AgradDistributionWiener_ffd_2277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2278> AgradDistributionWiener_ffd_2278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2279> AgradDistributionWiener_ffd_2279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2280> AgradDistributionWiener_ffd_2280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2281> AgradDistributionWiener_ffd_2281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2282> AgradDistributionWiener_ffd_2282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2283> AgradDistributionWiener_ffd_2283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2284> AgradDistributionWiener_ffd_2284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2285> AgradDistributionWiener_ffd_2285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2286> AgradDistributionWiener_ffd_2286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2287> AgradDistributionWiener_ffd_2287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2288> AgradDistributionWiener_ffd_2288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2289> AgradDistributionWiener_ffd_2289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2290> AgradDistributionWiener_ffd_2290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2291> AgradDistributionWiener_ffd_2291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2292> AgradDistributionWiener_ffd_2292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2293> AgradDistributionWiener_ffd_2293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2294> AgradDistributionWiener_ffd_2294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2295> AgradDistributionWiener_ffd_2295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2296> AgradDistributionWiener_ffd_2296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2297> AgradDistributionWiener_ffd_2297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2298> AgradDistributionWiener_ffd_2298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2299> AgradDistributionWiener_ffd_2299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2200, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2201, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2202, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2203, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2204, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2205, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2206, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2207, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2208, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2209, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2210, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2211, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2212, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2213, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2214, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2215, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2216, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2217, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2218, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2219, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2220, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2221, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2222, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2223, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2224, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2225, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2226, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2227, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2228, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2229, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2230, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2231, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2232, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2233, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2234, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2235, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2236, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2237, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2238, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2239, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2240, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2241, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2242, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2243, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2244, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2245, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2246, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2247, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2248, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2249, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2250, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2251, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2252, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2253, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2254, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2255, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2256, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2257, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2258, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2259, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2260, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2261, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2262, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2263, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2264, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2265, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2266, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2267, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2268, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2269, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2270, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2271, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2272, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2273, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2274, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2275, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2276, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2277, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2278, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2279, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2280, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2281, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2282, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2283, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2284, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2285, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2286, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2287, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2288, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2289, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2290, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2291, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2292, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2293, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2294, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2295, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2296, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2297, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2298, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2299, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2299);
+
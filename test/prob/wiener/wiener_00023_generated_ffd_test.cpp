@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2300;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2301;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2302;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2303;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_2304;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2305;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2306;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2307;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2308;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2309;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2310;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2311;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2312;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2313;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2314;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2315;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2316;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2317;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2318;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2319;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2320;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2321;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, double, empty> type_ffd_2322;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_2323;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2324;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_2325;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2326;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2327;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_2328;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_2329;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2330;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2331;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2332;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2333;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2334;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2335;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2336;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2337;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2338;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2339;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_2340;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2341;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2342;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2343;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2344;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2345;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2346;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2347;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2348;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2349;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2350;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2351;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2352;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2353;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2354;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2355;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2356;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2357;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_2358;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_2359;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2360;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_2361;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2362;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2363;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_2364;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_2365;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2366;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_2367;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2368;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2369;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_2370;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2371;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2372;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2373;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2374;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2375;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_2376;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_2377;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2378;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_2379;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_2380;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2381;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_2382;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_2383;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2384;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_2385;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2386;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2387;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_2388;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_2389;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2390;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_2391;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_2392;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2393;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_2394;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_2395;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_2396;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_2397;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_2398;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_2399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2300> AgradDistributionWiener_ffd_2300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2301> AgradDistributionWiener_ffd_2301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2302> AgradDistributionWiener_ffd_2302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2303> AgradDistributionWiener_ffd_2303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2304> AgradDistributionWiener_ffd_2304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2305> AgradDistributionWiener_ffd_2305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2306> AgradDistributionWiener_ffd_2306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2307> AgradDistributionWiener_ffd_2307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2308> AgradDistributionWiener_ffd_2308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2309> AgradDistributionWiener_ffd_2309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2310> AgradDistributionWiener_ffd_2310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2311> AgradDistributionWiener_ffd_2311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2312> AgradDistributionWiener_ffd_2312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2313> AgradDistributionWiener_ffd_2313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2314> AgradDistributionWiener_ffd_2314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2315> AgradDistributionWiener_ffd_2315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2316> AgradDistributionWiener_ffd_2316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2317> AgradDistributionWiener_ffd_2317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2318> AgradDistributionWiener_ffd_2318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2319> AgradDistributionWiener_ffd_2319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2320> AgradDistributionWiener_ffd_2320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2321> AgradDistributionWiener_ffd_2321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2322> AgradDistributionWiener_ffd_2322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2323> AgradDistributionWiener_ffd_2323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2324> AgradDistributionWiener_ffd_2324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2325> AgradDistributionWiener_ffd_2325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2326> AgradDistributionWiener_ffd_2326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2327> AgradDistributionWiener_ffd_2327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2328> AgradDistributionWiener_ffd_2328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2329> AgradDistributionWiener_ffd_2329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2330> AgradDistributionWiener_ffd_2330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2331> AgradDistributionWiener_ffd_2331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2332> AgradDistributionWiener_ffd_2332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2333> AgradDistributionWiener_ffd_2333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2334> AgradDistributionWiener_ffd_2334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2335> AgradDistributionWiener_ffd_2335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2336> AgradDistributionWiener_ffd_2336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2337> AgradDistributionWiener_ffd_2337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2338> AgradDistributionWiener_ffd_2338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2339> AgradDistributionWiener_ffd_2339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2340> AgradDistributionWiener_ffd_2340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2341> AgradDistributionWiener_ffd_2341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2342> AgradDistributionWiener_ffd_2342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2343> AgradDistributionWiener_ffd_2343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2344> AgradDistributionWiener_ffd_2344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2345> AgradDistributionWiener_ffd_2345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2346> AgradDistributionWiener_ffd_2346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2347> AgradDistributionWiener_ffd_2347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2348> AgradDistributionWiener_ffd_2348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2349> AgradDistributionWiener_ffd_2349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2350> AgradDistributionWiener_ffd_2350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2351> AgradDistributionWiener_ffd_2351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2352> AgradDistributionWiener_ffd_2352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2353> AgradDistributionWiener_ffd_2353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2354> AgradDistributionWiener_ffd_2354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2355> AgradDistributionWiener_ffd_2355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2356> AgradDistributionWiener_ffd_2356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2357> AgradDistributionWiener_ffd_2357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2358> AgradDistributionWiener_ffd_2358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2359> AgradDistributionWiener_ffd_2359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2360> AgradDistributionWiener_ffd_2360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2361> AgradDistributionWiener_ffd_2361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2362> AgradDistributionWiener_ffd_2362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2363> AgradDistributionWiener_ffd_2363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2364> AgradDistributionWiener_ffd_2364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2365> AgradDistributionWiener_ffd_2365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2366> AgradDistributionWiener_ffd_2366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2367> AgradDistributionWiener_ffd_2367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2368> AgradDistributionWiener_ffd_2368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2369> AgradDistributionWiener_ffd_2369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2370> AgradDistributionWiener_ffd_2370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2371> AgradDistributionWiener_ffd_2371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2372> AgradDistributionWiener_ffd_2372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2373> AgradDistributionWiener_ffd_2373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2374> AgradDistributionWiener_ffd_2374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2375> AgradDistributionWiener_ffd_2375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2376> AgradDistributionWiener_ffd_2376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2377> AgradDistributionWiener_ffd_2377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2378> AgradDistributionWiener_ffd_2378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2379> AgradDistributionWiener_ffd_2379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2380> AgradDistributionWiener_ffd_2380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2381> AgradDistributionWiener_ffd_2381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2382> AgradDistributionWiener_ffd_2382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2383> AgradDistributionWiener_ffd_2383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2384> AgradDistributionWiener_ffd_2384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2385> AgradDistributionWiener_ffd_2385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2386> AgradDistributionWiener_ffd_2386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2387> AgradDistributionWiener_ffd_2387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2388> AgradDistributionWiener_ffd_2388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2389> AgradDistributionWiener_ffd_2389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2390> AgradDistributionWiener_ffd_2390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2391> AgradDistributionWiener_ffd_2391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2392> AgradDistributionWiener_ffd_2392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2393> AgradDistributionWiener_ffd_2393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2394> AgradDistributionWiener_ffd_2394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2395> AgradDistributionWiener_ffd_2395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2396> AgradDistributionWiener_ffd_2396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2397> AgradDistributionWiener_ffd_2397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2398> AgradDistributionWiener_ffd_2398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_2399> AgradDistributionWiener_ffd_2399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2300, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2301, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2302, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2303, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2304, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2305, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2306, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2307, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2308, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2309, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2310, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2311, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2312, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2313, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2314, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2315, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2316, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2317, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2318, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2319, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2320, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2321, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2322, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2323, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2324, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2325, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2326, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2327, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2328, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2329, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2330, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2331, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2332, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2333, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2334, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2335, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2336, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2337, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2338, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2339, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2340, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2341, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2342, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2343, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2344, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2345, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2346, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2347, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2348, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2349, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2350, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2351, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2352, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2353, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2354, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2355, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2356, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2357, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2358, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2359, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2360, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2361, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2362, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2363, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2364, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2365, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2366, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2367, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2368, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2369, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2370, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2371, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2372, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2373, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2374, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2375, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2376, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2377, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2378, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2379, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2380, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2381, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2382, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2383, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2384, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2385, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2386, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2387, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2388, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2389, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2390, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2391, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2392, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2393, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2394, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2395, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2396, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2397, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2398, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_2399, AgradDistributionTestFixture, AgradDistributionWiener_ffd_2399);
+
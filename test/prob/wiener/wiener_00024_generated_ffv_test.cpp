@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2400;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2401;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2402;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2403;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2404;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2405;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2406;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2407;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2408;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2409;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2410;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2411;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2412;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2413;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2414;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2415;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2416;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2417;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2418;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2419;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2420;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2421;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2422;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2423;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2424;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2425;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2426;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2427;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2428;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2429;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, fvar<fvar<var> >, empty> type_ffv_2430;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2431;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2432;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2433;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2434;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2435;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2436;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2437;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2438;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, double, empty> type_ffv_2439;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2440;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2441;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2442;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2443;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2444;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2445;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2446;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2447;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2448;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2449;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2450;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2451;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2452;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2453;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2454;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2455;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2456;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_2457;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2458;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2459;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2460;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2461;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2462;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2463;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2464;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2465;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_2466;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2467;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2468;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2469;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2470;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2471;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2472;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2473;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2474;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2475;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2476;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2477;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2478;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2479;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2480;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2481;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2482;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2483;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2484;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2485;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2486;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2487;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2488;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2489;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2490;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2491;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2492;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2493;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2494;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2495;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2496;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2497;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2498;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2400> AgradDistributionWiener_ffv_2400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2401> AgradDistributionWiener_ffv_2401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2402> AgradDistributionWiener_ffv_2402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2403> AgradDistributionWiener_ffv_2403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2404> AgradDistributionWiener_ffv_2404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2405> AgradDistributionWiener_ffv_2405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2406> AgradDistributionWiener_ffv_2406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2407> AgradDistributionWiener_ffv_2407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2408> AgradDistributionWiener_ffv_2408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2409> AgradDistributionWiener_ffv_2409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2410> AgradDistributionWiener_ffv_2410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2411> AgradDistributionWiener_ffv_2411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2412> AgradDistributionWiener_ffv_2412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2413> AgradDistributionWiener_ffv_2413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2414> AgradDistributionWiener_ffv_2414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2415> AgradDistributionWiener_ffv_2415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2416> AgradDistributionWiener_ffv_2416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2417> AgradDistributionWiener_ffv_2417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2418> AgradDistributionWiener_ffv_2418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2419> AgradDistributionWiener_ffv_2419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2420> AgradDistributionWiener_ffv_2420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2421> AgradDistributionWiener_ffv_2421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2422> AgradDistributionWiener_ffv_2422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2423> AgradDistributionWiener_ffv_2423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2424> AgradDistributionWiener_ffv_2424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2425> AgradDistributionWiener_ffv_2425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2426> AgradDistributionWiener_ffv_2426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2427> AgradDistributionWiener_ffv_2427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2428> AgradDistributionWiener_ffv_2428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2429> AgradDistributionWiener_ffv_2429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2430> AgradDistributionWiener_ffv_2430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2431> AgradDistributionWiener_ffv_2431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2432> AgradDistributionWiener_ffv_2432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2433> AgradDistributionWiener_ffv_2433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2434> AgradDistributionWiener_ffv_2434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2435> AgradDistributionWiener_ffv_2435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2436> AgradDistributionWiener_ffv_2436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2437> AgradDistributionWiener_ffv_2437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2438> AgradDistributionWiener_ffv_2438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2439> AgradDistributionWiener_ffv_2439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2440> AgradDistributionWiener_ffv_2440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2441> AgradDistributionWiener_ffv_2441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2442> AgradDistributionWiener_ffv_2442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2443> AgradDistributionWiener_ffv_2443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2444> AgradDistributionWiener_ffv_2444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2445> AgradDistributionWiener_ffv_2445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2446> AgradDistributionWiener_ffv_2446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2447> AgradDistributionWiener_ffv_2447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2448> AgradDistributionWiener_ffv_2448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2449> AgradDistributionWiener_ffv_2449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2450> AgradDistributionWiener_ffv_2450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2451> AgradDistributionWiener_ffv_2451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2452> AgradDistributionWiener_ffv_2452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2453> AgradDistributionWiener_ffv_2453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2454> AgradDistributionWiener_ffv_2454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2455> AgradDistributionWiener_ffv_2455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2456> AgradDistributionWiener_ffv_2456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2457> AgradDistributionWiener_ffv_2457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2458> AgradDistributionWiener_ffv_2458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2459> AgradDistributionWiener_ffv_2459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2460> AgradDistributionWiener_ffv_2460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2461> AgradDistributionWiener_ffv_2461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2462> AgradDistributionWiener_ffv_2462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2463> AgradDistributionWiener_ffv_2463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2464> AgradDistributionWiener_ffv_2464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2465> AgradDistributionWiener_ffv_2465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2466> AgradDistributionWiener_ffv_2466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2467> AgradDistributionWiener_ffv_2467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2468> AgradDistributionWiener_ffv_2468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2469> AgradDistributionWiener_ffv_2469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2470> AgradDistributionWiener_ffv_2470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2471> AgradDistributionWiener_ffv_2471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2472> AgradDistributionWiener_ffv_2472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2473> AgradDistributionWiener_ffv_2473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2474> AgradDistributionWiener_ffv_2474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2475> AgradDistributionWiener_ffv_2475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2476> AgradDistributionWiener_ffv_2476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2477> AgradDistributionWiener_ffv_2477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2478> AgradDistributionWiener_ffv_2478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2479> AgradDistributionWiener_ffv_2479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2480> AgradDistributionWiener_ffv_2480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2481> AgradDistributionWiener_ffv_2481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2482> AgradDistributionWiener_ffv_2482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2483> AgradDistributionWiener_ffv_2483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2484> AgradDistributionWiener_ffv_2484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2485> AgradDistributionWiener_ffv_2485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2486> AgradDistributionWiener_ffv_2486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2487> AgradDistributionWiener_ffv_2487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2488> AgradDistributionWiener_ffv_2488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2489> AgradDistributionWiener_ffv_2489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2490> AgradDistributionWiener_ffv_2490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2491> AgradDistributionWiener_ffv_2491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2492> AgradDistributionWiener_ffv_2492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2493> AgradDistributionWiener_ffv_2493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2494> AgradDistributionWiener_ffv_2494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2495> AgradDistributionWiener_ffv_2495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2496> AgradDistributionWiener_ffv_2496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2497> AgradDistributionWiener_ffv_2497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2498> AgradDistributionWiener_ffv_2498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2499> AgradDistributionWiener_ffv_2499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2400, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2401, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2402, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2403, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2404, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2405, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2406, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2407, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2408, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2409, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2410, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2411, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2412, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2413, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2414, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2415, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2416, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2417, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2418, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2419, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2420, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2421, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2422, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2423, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2424, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2425, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2426, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2427, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2428, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2429, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2430, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2431, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2432, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2433, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2434, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2435, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2436, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2437, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2438, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2439, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2440, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2441, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2442, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2443, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2444, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2445, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2446, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2447, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2448, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2449, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2450, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2451, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2452, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2453, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2454, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2455, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2456, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2457, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2458, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2459, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2460, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2461, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2462, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2463, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2464, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2465, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2466, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2467, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2468, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2469, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2470, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2471, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2472, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2473, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2474, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2475, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2476, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2477, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2478, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2479, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2480, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2481, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2482, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2483, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2484, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2485, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2486, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2487, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2488, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2489, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2490, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2491, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2492, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2493, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2494, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2495, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2496, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2497, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2498, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2499, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty> type_v_2400;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty> type_v_2401;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2402;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty> type_v_2403;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty> type_v_2404;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2405;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2406;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2407;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2408;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2409;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2410;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2411;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_v_2412;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_v_2413;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2414;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty> type_v_2415;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty> type_v_2416;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2417;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_v_2418;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_2419;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2420;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty> type_v_2421;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_2422;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2423;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2424;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2425;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2426;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2427;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2428;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2429;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty> type_v_2430;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty> type_v_2431;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2432;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty> type_v_2433;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty> type_v_2434;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2435;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty> type_v_2436;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_2437;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2438;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty> type_v_2439;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_2440;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2441;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2442;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2443;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2444;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2445;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2446;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2447;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_2448;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2449;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2450;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_2451;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2452;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2453;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2454;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2455;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2456;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2457;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2458;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2459;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2460;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2461;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2462;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2463;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2464;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2465;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_2466;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_2467;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2468;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_2469;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2470;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2471;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2472;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2473;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2474;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2475;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2476;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2477;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2478;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2479;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2480;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2481;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2482;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2483;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, empty> type_v_2484;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_2485;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2486;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, empty> type_v_2487;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_2488;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2489;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_2490;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_2491;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2492;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_2493;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_2494;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2495;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2496;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2497;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2498;
+typedef boost::mpl::vector<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2400> AgradDistributionWiener_v_2400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2401> AgradDistributionWiener_v_2401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2402> AgradDistributionWiener_v_2402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2403> AgradDistributionWiener_v_2403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2404> AgradDistributionWiener_v_2404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2405> AgradDistributionWiener_v_2405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2406> AgradDistributionWiener_v_2406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2407> AgradDistributionWiener_v_2407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2408> AgradDistributionWiener_v_2408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2409> AgradDistributionWiener_v_2409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2410> AgradDistributionWiener_v_2410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2411> AgradDistributionWiener_v_2411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2412> AgradDistributionWiener_v_2412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2413> AgradDistributionWiener_v_2413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2414> AgradDistributionWiener_v_2414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2415> AgradDistributionWiener_v_2415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2416> AgradDistributionWiener_v_2416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2417> AgradDistributionWiener_v_2417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2418> AgradDistributionWiener_v_2418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2419> AgradDistributionWiener_v_2419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2420> AgradDistributionWiener_v_2420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2421> AgradDistributionWiener_v_2421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2422> AgradDistributionWiener_v_2422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2423> AgradDistributionWiener_v_2423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2424> AgradDistributionWiener_v_2424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2425> AgradDistributionWiener_v_2425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2426> AgradDistributionWiener_v_2426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2427> AgradDistributionWiener_v_2427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2428> AgradDistributionWiener_v_2428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2429> AgradDistributionWiener_v_2429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2430> AgradDistributionWiener_v_2430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2431> AgradDistributionWiener_v_2431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2432> AgradDistributionWiener_v_2432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2433> AgradDistributionWiener_v_2433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2434> AgradDistributionWiener_v_2434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2435> AgradDistributionWiener_v_2435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2436> AgradDistributionWiener_v_2436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2437> AgradDistributionWiener_v_2437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2438> AgradDistributionWiener_v_2438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2439> AgradDistributionWiener_v_2439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2440> AgradDistributionWiener_v_2440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2441> AgradDistributionWiener_v_2441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2442> AgradDistributionWiener_v_2442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2443> AgradDistributionWiener_v_2443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2444> AgradDistributionWiener_v_2444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2445> AgradDistributionWiener_v_2445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2446> AgradDistributionWiener_v_2446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2447> AgradDistributionWiener_v_2447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2448> AgradDistributionWiener_v_2448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2449> AgradDistributionWiener_v_2449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2450> AgradDistributionWiener_v_2450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2451> AgradDistributionWiener_v_2451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2452> AgradDistributionWiener_v_2452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2453> AgradDistributionWiener_v_2453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2454> AgradDistributionWiener_v_2454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2455> AgradDistributionWiener_v_2455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2456> AgradDistributionWiener_v_2456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2457> AgradDistributionWiener_v_2457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2458> AgradDistributionWiener_v_2458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2459> AgradDistributionWiener_v_2459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2460> AgradDistributionWiener_v_2460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2461> AgradDistributionWiener_v_2461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2462> AgradDistributionWiener_v_2462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2463> AgradDistributionWiener_v_2463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2464> AgradDistributionWiener_v_2464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2465> AgradDistributionWiener_v_2465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2466> AgradDistributionWiener_v_2466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2467> AgradDistributionWiener_v_2467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2468> AgradDistributionWiener_v_2468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2469> AgradDistributionWiener_v_2469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2470> AgradDistributionWiener_v_2470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2471> AgradDistributionWiener_v_2471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2472> AgradDistributionWiener_v_2472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2473> AgradDistributionWiener_v_2473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2474> AgradDistributionWiener_v_2474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2475> AgradDistributionWiener_v_2475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2476> AgradDistributionWiener_v_2476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2477> AgradDistributionWiener_v_2477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2478> AgradDistributionWiener_v_2478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2479> AgradDistributionWiener_v_2479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2480> AgradDistributionWiener_v_2480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2481> AgradDistributionWiener_v_2481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2482> AgradDistributionWiener_v_2482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2483> AgradDistributionWiener_v_2483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2484> AgradDistributionWiener_v_2484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2485> AgradDistributionWiener_v_2485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2486> AgradDistributionWiener_v_2486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2487> AgradDistributionWiener_v_2487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2488> AgradDistributionWiener_v_2488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2489> AgradDistributionWiener_v_2489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2490> AgradDistributionWiener_v_2490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2491> AgradDistributionWiener_v_2491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2492> AgradDistributionWiener_v_2492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2493> AgradDistributionWiener_v_2493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2494> AgradDistributionWiener_v_2494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2495> AgradDistributionWiener_v_2495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2496> AgradDistributionWiener_v_2496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2497> AgradDistributionWiener_v_2497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2498> AgradDistributionWiener_v_2498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2499> AgradDistributionWiener_v_2499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2400, AgradDistributionTestFixture, AgradDistributionWiener_v_2400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2401, AgradDistributionTestFixture, AgradDistributionWiener_v_2401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2402, AgradDistributionTestFixture, AgradDistributionWiener_v_2402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2403, AgradDistributionTestFixture, AgradDistributionWiener_v_2403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2404, AgradDistributionTestFixture, AgradDistributionWiener_v_2404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2405, AgradDistributionTestFixture, AgradDistributionWiener_v_2405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2406, AgradDistributionTestFixture, AgradDistributionWiener_v_2406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2407, AgradDistributionTestFixture, AgradDistributionWiener_v_2407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2408, AgradDistributionTestFixture, AgradDistributionWiener_v_2408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2409, AgradDistributionTestFixture, AgradDistributionWiener_v_2409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2410, AgradDistributionTestFixture, AgradDistributionWiener_v_2410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2411, AgradDistributionTestFixture, AgradDistributionWiener_v_2411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2412, AgradDistributionTestFixture, AgradDistributionWiener_v_2412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2413, AgradDistributionTestFixture, AgradDistributionWiener_v_2413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2414, AgradDistributionTestFixture, AgradDistributionWiener_v_2414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2415, AgradDistributionTestFixture, AgradDistributionWiener_v_2415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2416, AgradDistributionTestFixture, AgradDistributionWiener_v_2416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2417, AgradDistributionTestFixture, AgradDistributionWiener_v_2417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2418, AgradDistributionTestFixture, AgradDistributionWiener_v_2418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2419, AgradDistributionTestFixture, AgradDistributionWiener_v_2419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2420, AgradDistributionTestFixture, AgradDistributionWiener_v_2420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2421, AgradDistributionTestFixture, AgradDistributionWiener_v_2421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2422, AgradDistributionTestFixture, AgradDistributionWiener_v_2422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2423, AgradDistributionTestFixture, AgradDistributionWiener_v_2423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2424, AgradDistributionTestFixture, AgradDistributionWiener_v_2424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2425, AgradDistributionTestFixture, AgradDistributionWiener_v_2425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2426, AgradDistributionTestFixture, AgradDistributionWiener_v_2426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2427, AgradDistributionTestFixture, AgradDistributionWiener_v_2427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2428, AgradDistributionTestFixture, AgradDistributionWiener_v_2428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2429, AgradDistributionTestFixture, AgradDistributionWiener_v_2429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2430, AgradDistributionTestFixture, AgradDistributionWiener_v_2430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2431, AgradDistributionTestFixture, AgradDistributionWiener_v_2431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2432, AgradDistributionTestFixture, AgradDistributionWiener_v_2432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2433, AgradDistributionTestFixture, AgradDistributionWiener_v_2433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2434, AgradDistributionTestFixture, AgradDistributionWiener_v_2434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2435, AgradDistributionTestFixture, AgradDistributionWiener_v_2435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2436, AgradDistributionTestFixture, AgradDistributionWiener_v_2436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2437, AgradDistributionTestFixture, AgradDistributionWiener_v_2437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2438, AgradDistributionTestFixture, AgradDistributionWiener_v_2438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2439, AgradDistributionTestFixture, AgradDistributionWiener_v_2439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2440, AgradDistributionTestFixture, AgradDistributionWiener_v_2440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2441, AgradDistributionTestFixture, AgradDistributionWiener_v_2441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2442, AgradDistributionTestFixture, AgradDistributionWiener_v_2442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2443, AgradDistributionTestFixture, AgradDistributionWiener_v_2443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2444, AgradDistributionTestFixture, AgradDistributionWiener_v_2444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2445, AgradDistributionTestFixture, AgradDistributionWiener_v_2445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2446, AgradDistributionTestFixture, AgradDistributionWiener_v_2446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2447, AgradDistributionTestFixture, AgradDistributionWiener_v_2447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2448, AgradDistributionTestFixture, AgradDistributionWiener_v_2448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2449, AgradDistributionTestFixture, AgradDistributionWiener_v_2449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2450, AgradDistributionTestFixture, AgradDistributionWiener_v_2450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2451, AgradDistributionTestFixture, AgradDistributionWiener_v_2451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2452, AgradDistributionTestFixture, AgradDistributionWiener_v_2452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2453, AgradDistributionTestFixture, AgradDistributionWiener_v_2453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2454, AgradDistributionTestFixture, AgradDistributionWiener_v_2454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2455, AgradDistributionTestFixture, AgradDistributionWiener_v_2455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2456, AgradDistributionTestFixture, AgradDistributionWiener_v_2456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2457, AgradDistributionTestFixture, AgradDistributionWiener_v_2457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2458, AgradDistributionTestFixture, AgradDistributionWiener_v_2458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2459, AgradDistributionTestFixture, AgradDistributionWiener_v_2459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2460, AgradDistributionTestFixture, AgradDistributionWiener_v_2460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2461, AgradDistributionTestFixture, AgradDistributionWiener_v_2461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2462, AgradDistributionTestFixture, AgradDistributionWiener_v_2462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2463, AgradDistributionTestFixture, AgradDistributionWiener_v_2463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2464, AgradDistributionTestFixture, AgradDistributionWiener_v_2464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2465, AgradDistributionTestFixture, AgradDistributionWiener_v_2465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2466, AgradDistributionTestFixture, AgradDistributionWiener_v_2466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2467, AgradDistributionTestFixture, AgradDistributionWiener_v_2467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2468, AgradDistributionTestFixture, AgradDistributionWiener_v_2468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2469, AgradDistributionTestFixture, AgradDistributionWiener_v_2469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2470, AgradDistributionTestFixture, AgradDistributionWiener_v_2470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2471, AgradDistributionTestFixture, AgradDistributionWiener_v_2471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2472, AgradDistributionTestFixture, AgradDistributionWiener_v_2472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2473, AgradDistributionTestFixture, AgradDistributionWiener_v_2473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2474, AgradDistributionTestFixture, AgradDistributionWiener_v_2474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2475, AgradDistributionTestFixture, AgradDistributionWiener_v_2475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2476, AgradDistributionTestFixture, AgradDistributionWiener_v_2476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2477, AgradDistributionTestFixture, AgradDistributionWiener_v_2477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2478, AgradDistributionTestFixture, AgradDistributionWiener_v_2478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2479, AgradDistributionTestFixture, AgradDistributionWiener_v_2479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2480, AgradDistributionTestFixture, AgradDistributionWiener_v_2480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2481, AgradDistributionTestFixture, AgradDistributionWiener_v_2481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2482, AgradDistributionTestFixture, AgradDistributionWiener_v_2482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2483, AgradDistributionTestFixture, AgradDistributionWiener_v_2483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2484, AgradDistributionTestFixture, AgradDistributionWiener_v_2484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2485, AgradDistributionTestFixture, AgradDistributionWiener_v_2485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2486, AgradDistributionTestFixture, AgradDistributionWiener_v_2486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2487, AgradDistributionTestFixture, AgradDistributionWiener_v_2487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2488, AgradDistributionTestFixture, AgradDistributionWiener_v_2488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2489, AgradDistributionTestFixture, AgradDistributionWiener_v_2489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2490, AgradDistributionTestFixture, AgradDistributionWiener_v_2490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2491, AgradDistributionTestFixture, AgradDistributionWiener_v_2491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2492, AgradDistributionTestFixture, AgradDistributionWiener_v_2492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2493, AgradDistributionTestFixture, AgradDistributionWiener_v_2493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2494, AgradDistributionTestFixture, AgradDistributionWiener_v_2494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2495, AgradDistributionTestFixture, AgradDistributionWiener_v_2495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2496, AgradDistributionTestFixture, AgradDistributionWiener_v_2496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2497, AgradDistributionTestFixture, AgradDistributionWiener_v_2497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2498, AgradDistributionTestFixture, AgradDistributionWiener_v_2498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2499, AgradDistributionTestFixture, AgradDistributionWiener_v_2499);
+
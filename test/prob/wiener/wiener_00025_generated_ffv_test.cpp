@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2500;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2501;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2502;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2503;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2504;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2505;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2506;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2507;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2508;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2509;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2510;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, double, empty> type_ffv_2511;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_2512;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2513;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_2514;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2515;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2516;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_2517;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_2518;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2519;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2520;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2521;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2522;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2523;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2524;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2525;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2526;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2527;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2528;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_2529;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2530;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2531;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2532;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2533;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2534;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2535;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2536;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2537;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2538;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2539;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2540;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2541;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2542;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2543;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2544;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2545;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2546;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_2547;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_2548;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2549;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_2550;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2551;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2552;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_2553;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_2554;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2555;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2556;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2557;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2558;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2559;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2560;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2561;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2562;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2563;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2564;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_2565;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2566;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2567;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2568;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2569;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2570;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2571;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2572;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2573;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2574;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2575;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2576;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2577;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2578;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2579;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2580;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2581;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2582;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2583;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2584;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2585;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2586;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2587;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2588;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2589;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2590;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2591;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2592;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2593;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2594;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2595;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2596;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2597;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2598;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2500> AgradDistributionWiener_ffv_2500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2501> AgradDistributionWiener_ffv_2501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2502> AgradDistributionWiener_ffv_2502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2503> AgradDistributionWiener_ffv_2503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2504> AgradDistributionWiener_ffv_2504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2505> AgradDistributionWiener_ffv_2505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2506> AgradDistributionWiener_ffv_2506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2507> AgradDistributionWiener_ffv_2507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2508> AgradDistributionWiener_ffv_2508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2509> AgradDistributionWiener_ffv_2509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2510> AgradDistributionWiener_ffv_2510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2511> AgradDistributionWiener_ffv_2511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2512> AgradDistributionWiener_ffv_2512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2513> AgradDistributionWiener_ffv_2513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2514> AgradDistributionWiener_ffv_2514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2515> AgradDistributionWiener_ffv_2515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2516> AgradDistributionWiener_ffv_2516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2517> AgradDistributionWiener_ffv_2517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2518> AgradDistributionWiener_ffv_2518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2519> AgradDistributionWiener_ffv_2519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2520> AgradDistributionWiener_ffv_2520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2521> AgradDistributionWiener_ffv_2521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2522> AgradDistributionWiener_ffv_2522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2523> AgradDistributionWiener_ffv_2523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2524> AgradDistributionWiener_ffv_2524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2525> AgradDistributionWiener_ffv_2525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2526> AgradDistributionWiener_ffv_2526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2527> AgradDistributionWiener_ffv_2527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2528> AgradDistributionWiener_ffv_2528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2529> AgradDistributionWiener_ffv_2529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2530> AgradDistributionWiener_ffv_2530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2531> AgradDistributionWiener_ffv_2531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2532> AgradDistributionWiener_ffv_2532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2533> AgradDistributionWiener_ffv_2533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2534> AgradDistributionWiener_ffv_2534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2535> AgradDistributionWiener_ffv_2535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2536> AgradDistributionWiener_ffv_2536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2537> AgradDistributionWiener_ffv_2537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2538> AgradDistributionWiener_ffv_2538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2539> AgradDistributionWiener_ffv_2539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2540> AgradDistributionWiener_ffv_2540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2541> AgradDistributionWiener_ffv_2541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2542> AgradDistributionWiener_ffv_2542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2543> AgradDistributionWiener_ffv_2543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2544> AgradDistributionWiener_ffv_2544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2545> AgradDistributionWiener_ffv_2545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2546> AgradDistributionWiener_ffv_2546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2547> AgradDistributionWiener_ffv_2547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2548> AgradDistributionWiener_ffv_2548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2549> AgradDistributionWiener_ffv_2549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2550> AgradDistributionWiener_ffv_2550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2551> AgradDistributionWiener_ffv_2551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2552> AgradDistributionWiener_ffv_2552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2553> AgradDistributionWiener_ffv_2553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2554> AgradDistributionWiener_ffv_2554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2555> AgradDistributionWiener_ffv_2555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2556> AgradDistributionWiener_ffv_2556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2557> AgradDistributionWiener_ffv_2557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2558> AgradDistributionWiener_ffv_2558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2559> AgradDistributionWiener_ffv_2559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2560> AgradDistributionWiener_ffv_2560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2561> AgradDistributionWiener_ffv_2561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2562> AgradDistributionWiener_ffv_2562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2563> AgradDistributionWiener_ffv_2563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2564> AgradDistributionWiener_ffv_2564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2565> AgradDistributionWiener_ffv_2565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2566> AgradDistributionWiener_ffv_2566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2567> AgradDistributionWiener_ffv_2567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2568> AgradDistributionWiener_ffv_2568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2569> AgradDistributionWiener_ffv_2569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2570> AgradDistributionWiener_ffv_2570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2571> AgradDistributionWiener_ffv_2571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2572> AgradDistributionWiener_ffv_2572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2573> AgradDistributionWiener_ffv_2573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2574> AgradDistributionWiener_ffv_2574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2575> AgradDistributionWiener_ffv_2575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2576> AgradDistributionWiener_ffv_2576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2577> AgradDistributionWiener_ffv_2577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2578> AgradDistributionWiener_ffv_2578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2579> AgradDistributionWiener_ffv_2579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2580> AgradDistributionWiener_ffv_2580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2581> AgradDistributionWiener_ffv_2581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2582> AgradDistributionWiener_ffv_2582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2583> AgradDistributionWiener_ffv_2583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2584> AgradDistributionWiener_ffv_2584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2585> AgradDistributionWiener_ffv_2585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2586> AgradDistributionWiener_ffv_2586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2587> AgradDistributionWiener_ffv_2587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2588> AgradDistributionWiener_ffv_2588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2589> AgradDistributionWiener_ffv_2589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2590> AgradDistributionWiener_ffv_2590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2591> AgradDistributionWiener_ffv_2591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2592> AgradDistributionWiener_ffv_2592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2593> AgradDistributionWiener_ffv_2593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2594> AgradDistributionWiener_ffv_2594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2595> AgradDistributionWiener_ffv_2595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2596> AgradDistributionWiener_ffv_2596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2597> AgradDistributionWiener_ffv_2597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2598> AgradDistributionWiener_ffv_2598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_2599> AgradDistributionWiener_ffv_2599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2500, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2501, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2502, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2503, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2504, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2505, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2506, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2507, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2508, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2509, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2510, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2511, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2512, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2513, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2514, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2515, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2516, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2517, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2518, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2519, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2520, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2521, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2522, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2523, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2524, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2525, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2526, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2527, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2528, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2529, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2530, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2531, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2532, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2533, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2534, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2535, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2536, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2537, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2538, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2539, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2540, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2541, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2542, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2543, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2544, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2545, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2546, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2547, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2548, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2549, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2550, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2551, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2552, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2553, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2554, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2555, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2556, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2557, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2558, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2559, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2560, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2561, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2562, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2563, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2564, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2565, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2566, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2567, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2568, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2569, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2570, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2571, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2572, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2573, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2574, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2575, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2576, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2577, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2578, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2579, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2580, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2581, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2582, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2583, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2584, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2585, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2586, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2587, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2588, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2589, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2590, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2591, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2592, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2593, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2594, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2595, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2596, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2597, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2598, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_2599, AgradDistributionTestFixture, AgradDistributionWiener_ffv_2599);
+
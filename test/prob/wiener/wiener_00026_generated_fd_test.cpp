@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2600;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_2601;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_2602;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2603;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_2604;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2605;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2606;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_2607;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2608;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2609;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2610;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2611;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2612;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2613;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2614;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2615;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2616;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2617;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2618;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, fvar<double>, empty> type_fd_2619;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, std::vector<fvar<double>>, empty> type_fd_2620;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2621;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, fvar<double>, empty> type_fd_2622;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2623;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2624;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2625;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2626;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2627;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, double, empty> type_fd_2628;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, std::vector<double>, empty> type_fd_2629;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2630;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, fvar<double>, empty> type_fd_2631;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2632;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2633;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, double, empty> type_fd_2634;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2635;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2636;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2637;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2638;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2639;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2640;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2641;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2642;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2643;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2644;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2645;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, fvar<double>, empty> type_fd_2646;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_2647;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2648;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_2649;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2650;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2651;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2652;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2653;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2654;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, double, empty> type_fd_2655;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_2656;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2657;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_2658;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2659;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2660;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_2661;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2662;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2663;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2664;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2665;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2666;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2667;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2668;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2669;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2670;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2671;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2672;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_2673;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_2674;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2675;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_2676;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2677;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2678;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2679;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2680;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2681;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_2682;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_2683;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2684;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_2685;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2686;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2687;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_2688;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2689;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2690;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2691;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2692;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2693;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2694;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2695;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2696;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2697;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2698;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2600> AgradDistributionWiener_fd_2600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2601> AgradDistributionWiener_fd_2601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2602> AgradDistributionWiener_fd_2602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2603> AgradDistributionWiener_fd_2603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2604> AgradDistributionWiener_fd_2604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2605> AgradDistributionWiener_fd_2605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2606> AgradDistributionWiener_fd_2606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2607> AgradDistributionWiener_fd_2607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2608> AgradDistributionWiener_fd_2608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2609> AgradDistributionWiener_fd_2609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2610> AgradDistributionWiener_fd_2610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2611> AgradDistributionWiener_fd_2611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2612> AgradDistributionWiener_fd_2612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2613> AgradDistributionWiener_fd_2613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2614> AgradDistributionWiener_fd_2614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2615> AgradDistributionWiener_fd_2615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2616> AgradDistributionWiener_fd_2616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2617> AgradDistributionWiener_fd_2617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2618> AgradDistributionWiener_fd_2618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2619> AgradDistributionWiener_fd_2619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2620> AgradDistributionWiener_fd_2620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2621> AgradDistributionWiener_fd_2621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2622> AgradDistributionWiener_fd_2622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2623> AgradDistributionWiener_fd_2623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2624> AgradDistributionWiener_fd_2624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2625> AgradDistributionWiener_fd_2625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2626> AgradDistributionWiener_fd_2626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2627> AgradDistributionWiener_fd_2627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2628> AgradDistributionWiener_fd_2628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2629> AgradDistributionWiener_fd_2629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2630> AgradDistributionWiener_fd_2630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2631> AgradDistributionWiener_fd_2631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2632> AgradDistributionWiener_fd_2632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2633> AgradDistributionWiener_fd_2633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2634> AgradDistributionWiener_fd_2634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2635> AgradDistributionWiener_fd_2635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2636> AgradDistributionWiener_fd_2636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2637> AgradDistributionWiener_fd_2637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2638> AgradDistributionWiener_fd_2638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2639> AgradDistributionWiener_fd_2639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2640> AgradDistributionWiener_fd_2640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2641> AgradDistributionWiener_fd_2641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2642> AgradDistributionWiener_fd_2642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2643> AgradDistributionWiener_fd_2643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2644> AgradDistributionWiener_fd_2644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2645> AgradDistributionWiener_fd_2645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2646> AgradDistributionWiener_fd_2646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2647> AgradDistributionWiener_fd_2647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2648> AgradDistributionWiener_fd_2648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2649> AgradDistributionWiener_fd_2649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2650> AgradDistributionWiener_fd_2650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2651> AgradDistributionWiener_fd_2651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2652> AgradDistributionWiener_fd_2652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2653> AgradDistributionWiener_fd_2653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2654> AgradDistributionWiener_fd_2654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2655> AgradDistributionWiener_fd_2655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2656> AgradDistributionWiener_fd_2656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2657> AgradDistributionWiener_fd_2657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2658> AgradDistributionWiener_fd_2658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2659> AgradDistributionWiener_fd_2659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2660> AgradDistributionWiener_fd_2660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2661> AgradDistributionWiener_fd_2661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2662> AgradDistributionWiener_fd_2662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2663> AgradDistributionWiener_fd_2663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2664> AgradDistributionWiener_fd_2664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2665> AgradDistributionWiener_fd_2665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2666> AgradDistributionWiener_fd_2666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2667> AgradDistributionWiener_fd_2667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2668> AgradDistributionWiener_fd_2668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2669> AgradDistributionWiener_fd_2669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2670> AgradDistributionWiener_fd_2670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2671> AgradDistributionWiener_fd_2671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2672> AgradDistributionWiener_fd_2672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2673> AgradDistributionWiener_fd_2673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2674> AgradDistributionWiener_fd_2674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2675> AgradDistributionWiener_fd_2675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2676> AgradDistributionWiener_fd_2676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2677> AgradDistributionWiener_fd_2677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2678> AgradDistributionWiener_fd_2678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2679> AgradDistributionWiener_fd_2679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2680> AgradDistributionWiener_fd_2680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2681> AgradDistributionWiener_fd_2681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2682> AgradDistributionWiener_fd_2682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2683> AgradDistributionWiener_fd_2683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2684> AgradDistributionWiener_fd_2684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2685> AgradDistributionWiener_fd_2685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2686> AgradDistributionWiener_fd_2686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2687> AgradDistributionWiener_fd_2687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2688> AgradDistributionWiener_fd_2688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2689> AgradDistributionWiener_fd_2689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2690> AgradDistributionWiener_fd_2690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2691> AgradDistributionWiener_fd_2691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2692> AgradDistributionWiener_fd_2692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2693> AgradDistributionWiener_fd_2693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2694> AgradDistributionWiener_fd_2694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2695> AgradDistributionWiener_fd_2695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2696> AgradDistributionWiener_fd_2696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2697> AgradDistributionWiener_fd_2697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2698> AgradDistributionWiener_fd_2698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2699> AgradDistributionWiener_fd_2699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2600, AgradDistributionTestFixture, AgradDistributionWiener_fd_2600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2601, AgradDistributionTestFixture, AgradDistributionWiener_fd_2601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2602, AgradDistributionTestFixture, AgradDistributionWiener_fd_2602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2603, AgradDistributionTestFixture, AgradDistributionWiener_fd_2603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2604, AgradDistributionTestFixture, AgradDistributionWiener_fd_2604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2605, AgradDistributionTestFixture, AgradDistributionWiener_fd_2605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2606, AgradDistributionTestFixture, AgradDistributionWiener_fd_2606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2607, AgradDistributionTestFixture, AgradDistributionWiener_fd_2607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2608, AgradDistributionTestFixture, AgradDistributionWiener_fd_2608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2609, AgradDistributionTestFixture, AgradDistributionWiener_fd_2609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2610, AgradDistributionTestFixture, AgradDistributionWiener_fd_2610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2611, AgradDistributionTestFixture, AgradDistributionWiener_fd_2611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2612, AgradDistributionTestFixture, AgradDistributionWiener_fd_2612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2613, AgradDistributionTestFixture, AgradDistributionWiener_fd_2613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2614, AgradDistributionTestFixture, AgradDistributionWiener_fd_2614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2615, AgradDistributionTestFixture, AgradDistributionWiener_fd_2615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2616, AgradDistributionTestFixture, AgradDistributionWiener_fd_2616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2617, AgradDistributionTestFixture, AgradDistributionWiener_fd_2617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2618, AgradDistributionTestFixture, AgradDistributionWiener_fd_2618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2619, AgradDistributionTestFixture, AgradDistributionWiener_fd_2619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2620, AgradDistributionTestFixture, AgradDistributionWiener_fd_2620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2621, AgradDistributionTestFixture, AgradDistributionWiener_fd_2621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2622, AgradDistributionTestFixture, AgradDistributionWiener_fd_2622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2623, AgradDistributionTestFixture, AgradDistributionWiener_fd_2623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2624, AgradDistributionTestFixture, AgradDistributionWiener_fd_2624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2625, AgradDistributionTestFixture, AgradDistributionWiener_fd_2625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2626, AgradDistributionTestFixture, AgradDistributionWiener_fd_2626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2627, AgradDistributionTestFixture, AgradDistributionWiener_fd_2627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2628, AgradDistributionTestFixture, AgradDistributionWiener_fd_2628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2629, AgradDistributionTestFixture, AgradDistributionWiener_fd_2629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2630, AgradDistributionTestFixture, AgradDistributionWiener_fd_2630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2631, AgradDistributionTestFixture, AgradDistributionWiener_fd_2631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2632, AgradDistributionTestFixture, AgradDistributionWiener_fd_2632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2633, AgradDistributionTestFixture, AgradDistributionWiener_fd_2633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2634, AgradDistributionTestFixture, AgradDistributionWiener_fd_2634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2635, AgradDistributionTestFixture, AgradDistributionWiener_fd_2635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2636, AgradDistributionTestFixture, AgradDistributionWiener_fd_2636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2637, AgradDistributionTestFixture, AgradDistributionWiener_fd_2637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2638, AgradDistributionTestFixture, AgradDistributionWiener_fd_2638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2639, AgradDistributionTestFixture, AgradDistributionWiener_fd_2639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2640, AgradDistributionTestFixture, AgradDistributionWiener_fd_2640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2641, AgradDistributionTestFixture, AgradDistributionWiener_fd_2641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2642, AgradDistributionTestFixture, AgradDistributionWiener_fd_2642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2643, AgradDistributionTestFixture, AgradDistributionWiener_fd_2643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2644, AgradDistributionTestFixture, AgradDistributionWiener_fd_2644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2645, AgradDistributionTestFixture, AgradDistributionWiener_fd_2645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2646, AgradDistributionTestFixture, AgradDistributionWiener_fd_2646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2647, AgradDistributionTestFixture, AgradDistributionWiener_fd_2647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2648, AgradDistributionTestFixture, AgradDistributionWiener_fd_2648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2649, AgradDistributionTestFixture, AgradDistributionWiener_fd_2649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2650, AgradDistributionTestFixture, AgradDistributionWiener_fd_2650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2651, AgradDistributionTestFixture, AgradDistributionWiener_fd_2651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2652, AgradDistributionTestFixture, AgradDistributionWiener_fd_2652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2653, AgradDistributionTestFixture, AgradDistributionWiener_fd_2653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2654, AgradDistributionTestFixture, AgradDistributionWiener_fd_2654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2655, AgradDistributionTestFixture, AgradDistributionWiener_fd_2655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2656, AgradDistributionTestFixture, AgradDistributionWiener_fd_2656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2657, AgradDistributionTestFixture, AgradDistributionWiener_fd_2657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2658, AgradDistributionTestFixture, AgradDistributionWiener_fd_2658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2659, AgradDistributionTestFixture, AgradDistributionWiener_fd_2659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2660, AgradDistributionTestFixture, AgradDistributionWiener_fd_2660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2661, AgradDistributionTestFixture, AgradDistributionWiener_fd_2661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2662, AgradDistributionTestFixture, AgradDistributionWiener_fd_2662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2663, AgradDistributionTestFixture, AgradDistributionWiener_fd_2663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2664, AgradDistributionTestFixture, AgradDistributionWiener_fd_2664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2665, AgradDistributionTestFixture, AgradDistributionWiener_fd_2665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2666, AgradDistributionTestFixture, AgradDistributionWiener_fd_2666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2667, AgradDistributionTestFixture, AgradDistributionWiener_fd_2667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2668, AgradDistributionTestFixture, AgradDistributionWiener_fd_2668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2669, AgradDistributionTestFixture, AgradDistributionWiener_fd_2669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2670, AgradDistributionTestFixture, AgradDistributionWiener_fd_2670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2671, AgradDistributionTestFixture, AgradDistributionWiener_fd_2671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2672, AgradDistributionTestFixture, AgradDistributionWiener_fd_2672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2673, AgradDistributionTestFixture, AgradDistributionWiener_fd_2673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2674, AgradDistributionTestFixture, AgradDistributionWiener_fd_2674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2675, AgradDistributionTestFixture, AgradDistributionWiener_fd_2675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2676, AgradDistributionTestFixture, AgradDistributionWiener_fd_2676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2677, AgradDistributionTestFixture, AgradDistributionWiener_fd_2677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2678, AgradDistributionTestFixture, AgradDistributionWiener_fd_2678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2679, AgradDistributionTestFixture, AgradDistributionWiener_fd_2679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2680, AgradDistributionTestFixture, AgradDistributionWiener_fd_2680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2681, AgradDistributionTestFixture, AgradDistributionWiener_fd_2681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2682, AgradDistributionTestFixture, AgradDistributionWiener_fd_2682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2683, AgradDistributionTestFixture, AgradDistributionWiener_fd_2683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2684, AgradDistributionTestFixture, AgradDistributionWiener_fd_2684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2685, AgradDistributionTestFixture, AgradDistributionWiener_fd_2685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2686, AgradDistributionTestFixture, AgradDistributionWiener_fd_2686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2687, AgradDistributionTestFixture, AgradDistributionWiener_fd_2687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2688, AgradDistributionTestFixture, AgradDistributionWiener_fd_2688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2689, AgradDistributionTestFixture, AgradDistributionWiener_fd_2689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2690, AgradDistributionTestFixture, AgradDistributionWiener_fd_2690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2691, AgradDistributionTestFixture, AgradDistributionWiener_fd_2691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2692, AgradDistributionTestFixture, AgradDistributionWiener_fd_2692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2693, AgradDistributionTestFixture, AgradDistributionWiener_fd_2693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2694, AgradDistributionTestFixture, AgradDistributionWiener_fd_2694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2695, AgradDistributionTestFixture, AgradDistributionWiener_fd_2695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2696, AgradDistributionTestFixture, AgradDistributionWiener_fd_2696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2697, AgradDistributionTestFixture, AgradDistributionWiener_fd_2697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2698, AgradDistributionTestFixture, AgradDistributionWiener_fd_2698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2699, AgradDistributionTestFixture, AgradDistributionWiener_fd_2699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, double, empty> type_fv_2700;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, std::vector<double>, empty> type_fv_2701;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2702;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, fvar<var>, empty> type_fv_2703;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_2704;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2705;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, double, empty> type_fv_2706;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_2707;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2708;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_2709;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_2710;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2711;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_2712;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2713;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2714;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2715;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2716;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2717;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, double, empty> type_fv_2718;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_2719;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2720;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_2721;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_2722;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2723;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_2724;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_2725;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2726;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_2727;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_2728;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2729;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_2730;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2731;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2732;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2733;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2734;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2735;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, double, empty> type_fv_2736;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_2737;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2738;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_2739;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_2740;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2741;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_2742;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_2743;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2744;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_2745;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_2746;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2747;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_2748;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2749;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2750;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2751;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2752;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2753;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_2754;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_2755;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2756;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_2757;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_2758;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2759;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_2760;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_2761;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2762;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_2763;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_2764;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2765;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_2766;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2767;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2768;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2769;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2770;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2771;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_2772;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_2773;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2774;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_2775;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_2776;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2777;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_2778;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_2779;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2780;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_2781;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_2782;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2783;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_2784;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_2785;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2786;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_2787;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_2788;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2789;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_2790;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_2791;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2792;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_2793;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_2794;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_2795;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_2796;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_2797;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_2798;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_2799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2700> AgradDistributionWiener_fv_2700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2701> AgradDistributionWiener_fv_2701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2702> AgradDistributionWiener_fv_2702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2703> AgradDistributionWiener_fv_2703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2704> AgradDistributionWiener_fv_2704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2705> AgradDistributionWiener_fv_2705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2706> AgradDistributionWiener_fv_2706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2707> AgradDistributionWiener_fv_2707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2708> AgradDistributionWiener_fv_2708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2709> AgradDistributionWiener_fv_2709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2710> AgradDistributionWiener_fv_2710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2711> AgradDistributionWiener_fv_2711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2712> AgradDistributionWiener_fv_2712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2713> AgradDistributionWiener_fv_2713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2714> AgradDistributionWiener_fv_2714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2715> AgradDistributionWiener_fv_2715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2716> AgradDistributionWiener_fv_2716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2717> AgradDistributionWiener_fv_2717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2718> AgradDistributionWiener_fv_2718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2719> AgradDistributionWiener_fv_2719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2720> AgradDistributionWiener_fv_2720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2721> AgradDistributionWiener_fv_2721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2722> AgradDistributionWiener_fv_2722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2723> AgradDistributionWiener_fv_2723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2724> AgradDistributionWiener_fv_2724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2725> AgradDistributionWiener_fv_2725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2726> AgradDistributionWiener_fv_2726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2727> AgradDistributionWiener_fv_2727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2728> AgradDistributionWiener_fv_2728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2729> AgradDistributionWiener_fv_2729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2730> AgradDistributionWiener_fv_2730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2731> AgradDistributionWiener_fv_2731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2732> AgradDistributionWiener_fv_2732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2733> AgradDistributionWiener_fv_2733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2734> AgradDistributionWiener_fv_2734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2735> AgradDistributionWiener_fv_2735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2736> AgradDistributionWiener_fv_2736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2737> AgradDistributionWiener_fv_2737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2738> AgradDistributionWiener_fv_2738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2739> AgradDistributionWiener_fv_2739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2740> AgradDistributionWiener_fv_2740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2741> AgradDistributionWiener_fv_2741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2742> AgradDistributionWiener_fv_2742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2743> AgradDistributionWiener_fv_2743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2744> AgradDistributionWiener_fv_2744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2745> AgradDistributionWiener_fv_2745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2746> AgradDistributionWiener_fv_2746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2747> AgradDistributionWiener_fv_2747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2748> AgradDistributionWiener_fv_2748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2749> AgradDistributionWiener_fv_2749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2750> AgradDistributionWiener_fv_2750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2751> AgradDistributionWiener_fv_2751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2752> AgradDistributionWiener_fv_2752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2753> AgradDistributionWiener_fv_2753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2754> AgradDistributionWiener_fv_2754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2755> AgradDistributionWiener_fv_2755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2756> AgradDistributionWiener_fv_2756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2757> AgradDistributionWiener_fv_2757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2758> AgradDistributionWiener_fv_2758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2759> AgradDistributionWiener_fv_2759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2760> AgradDistributionWiener_fv_2760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2761> AgradDistributionWiener_fv_2761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2762> AgradDistributionWiener_fv_2762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2763> AgradDistributionWiener_fv_2763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2764> AgradDistributionWiener_fv_2764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2765> AgradDistributionWiener_fv_2765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2766> AgradDistributionWiener_fv_2766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2767> AgradDistributionWiener_fv_2767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2768> AgradDistributionWiener_fv_2768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2769> AgradDistributionWiener_fv_2769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2770> AgradDistributionWiener_fv_2770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2771> AgradDistributionWiener_fv_2771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2772> AgradDistributionWiener_fv_2772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2773> AgradDistributionWiener_fv_2773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2774> AgradDistributionWiener_fv_2774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2775> AgradDistributionWiener_fv_2775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2776> AgradDistributionWiener_fv_2776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2777> AgradDistributionWiener_fv_2777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2778> AgradDistributionWiener_fv_2778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2779> AgradDistributionWiener_fv_2779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2780> AgradDistributionWiener_fv_2780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2781> AgradDistributionWiener_fv_2781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2782> AgradDistributionWiener_fv_2782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2783> AgradDistributionWiener_fv_2783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2784> AgradDistributionWiener_fv_2784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2785> AgradDistributionWiener_fv_2785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2786> AgradDistributionWiener_fv_2786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2787> AgradDistributionWiener_fv_2787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2788> AgradDistributionWiener_fv_2788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2789> AgradDistributionWiener_fv_2789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2790> AgradDistributionWiener_fv_2790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2791> AgradDistributionWiener_fv_2791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2792> AgradDistributionWiener_fv_2792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2793> AgradDistributionWiener_fv_2793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2794> AgradDistributionWiener_fv_2794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2795> AgradDistributionWiener_fv_2795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2796> AgradDistributionWiener_fv_2796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2797> AgradDistributionWiener_fv_2797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2798> AgradDistributionWiener_fv_2798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_2799> AgradDistributionWiener_fv_2799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2700, AgradDistributionTestFixture, AgradDistributionWiener_fv_2700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2701, AgradDistributionTestFixture, AgradDistributionWiener_fv_2701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2702, AgradDistributionTestFixture, AgradDistributionWiener_fv_2702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2703, AgradDistributionTestFixture, AgradDistributionWiener_fv_2703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2704, AgradDistributionTestFixture, AgradDistributionWiener_fv_2704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2705, AgradDistributionTestFixture, AgradDistributionWiener_fv_2705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2706, AgradDistributionTestFixture, AgradDistributionWiener_fv_2706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2707, AgradDistributionTestFixture, AgradDistributionWiener_fv_2707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2708, AgradDistributionTestFixture, AgradDistributionWiener_fv_2708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2709, AgradDistributionTestFixture, AgradDistributionWiener_fv_2709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2710, AgradDistributionTestFixture, AgradDistributionWiener_fv_2710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2711, AgradDistributionTestFixture, AgradDistributionWiener_fv_2711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2712, AgradDistributionTestFixture, AgradDistributionWiener_fv_2712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2713, AgradDistributionTestFixture, AgradDistributionWiener_fv_2713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2714, AgradDistributionTestFixture, AgradDistributionWiener_fv_2714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2715, AgradDistributionTestFixture, AgradDistributionWiener_fv_2715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2716, AgradDistributionTestFixture, AgradDistributionWiener_fv_2716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2717, AgradDistributionTestFixture, AgradDistributionWiener_fv_2717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2718, AgradDistributionTestFixture, AgradDistributionWiener_fv_2718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2719, AgradDistributionTestFixture, AgradDistributionWiener_fv_2719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2720, AgradDistributionTestFixture, AgradDistributionWiener_fv_2720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2721, AgradDistributionTestFixture, AgradDistributionWiener_fv_2721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2722, AgradDistributionTestFixture, AgradDistributionWiener_fv_2722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2723, AgradDistributionTestFixture, AgradDistributionWiener_fv_2723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2724, AgradDistributionTestFixture, AgradDistributionWiener_fv_2724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2725, AgradDistributionTestFixture, AgradDistributionWiener_fv_2725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2726, AgradDistributionTestFixture, AgradDistributionWiener_fv_2726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2727, AgradDistributionTestFixture, AgradDistributionWiener_fv_2727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2728, AgradDistributionTestFixture, AgradDistributionWiener_fv_2728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2729, AgradDistributionTestFixture, AgradDistributionWiener_fv_2729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2730, AgradDistributionTestFixture, AgradDistributionWiener_fv_2730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2731, AgradDistributionTestFixture, AgradDistributionWiener_fv_2731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2732, AgradDistributionTestFixture, AgradDistributionWiener_fv_2732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2733, AgradDistributionTestFixture, AgradDistributionWiener_fv_2733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2734, AgradDistributionTestFixture, AgradDistributionWiener_fv_2734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2735, AgradDistributionTestFixture, AgradDistributionWiener_fv_2735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2736, AgradDistributionTestFixture, AgradDistributionWiener_fv_2736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2737, AgradDistributionTestFixture, AgradDistributionWiener_fv_2737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2738, AgradDistributionTestFixture, AgradDistributionWiener_fv_2738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2739, AgradDistributionTestFixture, AgradDistributionWiener_fv_2739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2740, AgradDistributionTestFixture, AgradDistributionWiener_fv_2740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2741, AgradDistributionTestFixture, AgradDistributionWiener_fv_2741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2742, AgradDistributionTestFixture, AgradDistributionWiener_fv_2742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2743, AgradDistributionTestFixture, AgradDistributionWiener_fv_2743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2744, AgradDistributionTestFixture, AgradDistributionWiener_fv_2744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2745, AgradDistributionTestFixture, AgradDistributionWiener_fv_2745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2746, AgradDistributionTestFixture, AgradDistributionWiener_fv_2746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2747, AgradDistributionTestFixture, AgradDistributionWiener_fv_2747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2748, AgradDistributionTestFixture, AgradDistributionWiener_fv_2748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2749, AgradDistributionTestFixture, AgradDistributionWiener_fv_2749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2750, AgradDistributionTestFixture, AgradDistributionWiener_fv_2750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2751, AgradDistributionTestFixture, AgradDistributionWiener_fv_2751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2752, AgradDistributionTestFixture, AgradDistributionWiener_fv_2752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2753, AgradDistributionTestFixture, AgradDistributionWiener_fv_2753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2754, AgradDistributionTestFixture, AgradDistributionWiener_fv_2754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2755, AgradDistributionTestFixture, AgradDistributionWiener_fv_2755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2756, AgradDistributionTestFixture, AgradDistributionWiener_fv_2756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2757, AgradDistributionTestFixture, AgradDistributionWiener_fv_2757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2758, AgradDistributionTestFixture, AgradDistributionWiener_fv_2758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2759, AgradDistributionTestFixture, AgradDistributionWiener_fv_2759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2760, AgradDistributionTestFixture, AgradDistributionWiener_fv_2760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2761, AgradDistributionTestFixture, AgradDistributionWiener_fv_2761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2762, AgradDistributionTestFixture, AgradDistributionWiener_fv_2762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2763, AgradDistributionTestFixture, AgradDistributionWiener_fv_2763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2764, AgradDistributionTestFixture, AgradDistributionWiener_fv_2764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2765, AgradDistributionTestFixture, AgradDistributionWiener_fv_2765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2766, AgradDistributionTestFixture, AgradDistributionWiener_fv_2766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2767, AgradDistributionTestFixture, AgradDistributionWiener_fv_2767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2768, AgradDistributionTestFixture, AgradDistributionWiener_fv_2768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2769, AgradDistributionTestFixture, AgradDistributionWiener_fv_2769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2770, AgradDistributionTestFixture, AgradDistributionWiener_fv_2770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2771, AgradDistributionTestFixture, AgradDistributionWiener_fv_2771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2772, AgradDistributionTestFixture, AgradDistributionWiener_fv_2772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2773, AgradDistributionTestFixture, AgradDistributionWiener_fv_2773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2774, AgradDistributionTestFixture, AgradDistributionWiener_fv_2774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2775, AgradDistributionTestFixture, AgradDistributionWiener_fv_2775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2776, AgradDistributionTestFixture, AgradDistributionWiener_fv_2776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2777, AgradDistributionTestFixture, AgradDistributionWiener_fv_2777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2778, AgradDistributionTestFixture, AgradDistributionWiener_fv_2778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2779, AgradDistributionTestFixture, AgradDistributionWiener_fv_2779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2780, AgradDistributionTestFixture, AgradDistributionWiener_fv_2780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2781, AgradDistributionTestFixture, AgradDistributionWiener_fv_2781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2782, AgradDistributionTestFixture, AgradDistributionWiener_fv_2782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2783, AgradDistributionTestFixture, AgradDistributionWiener_fv_2783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2784, AgradDistributionTestFixture, AgradDistributionWiener_fv_2784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2785, AgradDistributionTestFixture, AgradDistributionWiener_fv_2785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2786, AgradDistributionTestFixture, AgradDistributionWiener_fv_2786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2787, AgradDistributionTestFixture, AgradDistributionWiener_fv_2787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2788, AgradDistributionTestFixture, AgradDistributionWiener_fv_2788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2789, AgradDistributionTestFixture, AgradDistributionWiener_fv_2789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2790, AgradDistributionTestFixture, AgradDistributionWiener_fv_2790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2791, AgradDistributionTestFixture, AgradDistributionWiener_fv_2791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2792, AgradDistributionTestFixture, AgradDistributionWiener_fv_2792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2793, AgradDistributionTestFixture, AgradDistributionWiener_fv_2793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2794, AgradDistributionTestFixture, AgradDistributionWiener_fv_2794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2795, AgradDistributionTestFixture, AgradDistributionWiener_fv_2795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2796, AgradDistributionTestFixture, AgradDistributionWiener_fv_2796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2797, AgradDistributionTestFixture, AgradDistributionWiener_fv_2797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2798, AgradDistributionTestFixture, AgradDistributionWiener_fv_2798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_2799, AgradDistributionTestFixture, AgradDistributionWiener_fv_2799);
+
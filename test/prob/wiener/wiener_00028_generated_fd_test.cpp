@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2800;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2801;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2802;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2803;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2804;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2805;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2806;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2807;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<double>, empty> type_fd_2808;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<double>>, empty> type_fd_2809;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2810;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<double>, empty> type_fd_2811;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2812;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2813;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2814;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2815;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2816;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, double, empty> type_fd_2817;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<double>, empty> type_fd_2818;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2819;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, fvar<double>, empty> type_fd_2820;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2821;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2822;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, double, empty> type_fd_2823;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2824;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2825;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2826;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2827;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2828;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2829;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2830;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2831;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2832;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2833;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2834;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, empty> type_fd_2835;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_2836;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2837;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_2838;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2839;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2840;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2841;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2842;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2843;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, double, empty> type_fd_2844;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_2845;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2846;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_2847;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2848;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2849;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_2850;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2851;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2852;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2853;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2854;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2855;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2856;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2857;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2858;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2859;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2860;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2861;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_2862;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_2863;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2864;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_2865;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2866;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2867;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2868;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2869;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2870;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_2871;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_2872;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2873;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_2874;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2875;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2876;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_2877;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2878;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2879;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2880;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2881;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2882;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2883;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2884;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2885;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2886;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2887;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2888;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, double, empty> type_fd_2889;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, std::vector<double>, empty> type_fd_2890;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2891;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, fvar<double>, empty> type_fd_2892;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_2893;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2894;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, double, empty> type_fd_2895;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_2896;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2897;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_2898;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2800> AgradDistributionWiener_fd_2800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2801> AgradDistributionWiener_fd_2801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2802> AgradDistributionWiener_fd_2802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2803> AgradDistributionWiener_fd_2803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2804> AgradDistributionWiener_fd_2804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2805> AgradDistributionWiener_fd_2805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2806> AgradDistributionWiener_fd_2806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2807> AgradDistributionWiener_fd_2807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2808> AgradDistributionWiener_fd_2808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2809> AgradDistributionWiener_fd_2809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2810> AgradDistributionWiener_fd_2810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2811> AgradDistributionWiener_fd_2811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2812> AgradDistributionWiener_fd_2812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2813> AgradDistributionWiener_fd_2813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2814> AgradDistributionWiener_fd_2814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2815> AgradDistributionWiener_fd_2815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2816> AgradDistributionWiener_fd_2816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2817> AgradDistributionWiener_fd_2817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2818> AgradDistributionWiener_fd_2818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2819> AgradDistributionWiener_fd_2819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2820> AgradDistributionWiener_fd_2820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2821> AgradDistributionWiener_fd_2821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2822> AgradDistributionWiener_fd_2822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2823> AgradDistributionWiener_fd_2823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2824> AgradDistributionWiener_fd_2824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2825> AgradDistributionWiener_fd_2825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2826> AgradDistributionWiener_fd_2826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2827> AgradDistributionWiener_fd_2827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2828> AgradDistributionWiener_fd_2828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2829> AgradDistributionWiener_fd_2829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2830> AgradDistributionWiener_fd_2830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2831> AgradDistributionWiener_fd_2831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2832> AgradDistributionWiener_fd_2832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2833> AgradDistributionWiener_fd_2833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2834> AgradDistributionWiener_fd_2834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2835> AgradDistributionWiener_fd_2835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2836> AgradDistributionWiener_fd_2836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2837> AgradDistributionWiener_fd_2837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2838> AgradDistributionWiener_fd_2838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2839> AgradDistributionWiener_fd_2839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2840> AgradDistributionWiener_fd_2840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2841> AgradDistributionWiener_fd_2841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2842> AgradDistributionWiener_fd_2842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2843> AgradDistributionWiener_fd_2843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2844> AgradDistributionWiener_fd_2844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2845> AgradDistributionWiener_fd_2845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2846> AgradDistributionWiener_fd_2846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2847> AgradDistributionWiener_fd_2847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2848> AgradDistributionWiener_fd_2848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2849> AgradDistributionWiener_fd_2849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2850> AgradDistributionWiener_fd_2850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2851> AgradDistributionWiener_fd_2851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2852> AgradDistributionWiener_fd_2852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2853> AgradDistributionWiener_fd_2853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2854> AgradDistributionWiener_fd_2854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2855> AgradDistributionWiener_fd_2855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2856> AgradDistributionWiener_fd_2856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2857> AgradDistributionWiener_fd_2857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2858> AgradDistributionWiener_fd_2858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2859> AgradDistributionWiener_fd_2859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2860> AgradDistributionWiener_fd_2860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2861> AgradDistributionWiener_fd_2861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2862> AgradDistributionWiener_fd_2862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2863> AgradDistributionWiener_fd_2863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2864> AgradDistributionWiener_fd_2864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2865> AgradDistributionWiener_fd_2865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2866> AgradDistributionWiener_fd_2866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2867> AgradDistributionWiener_fd_2867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2868> AgradDistributionWiener_fd_2868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2869> AgradDistributionWiener_fd_2869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2870> AgradDistributionWiener_fd_2870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2871> AgradDistributionWiener_fd_2871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2872> AgradDistributionWiener_fd_2872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2873> AgradDistributionWiener_fd_2873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2874> AgradDistributionWiener_fd_2874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2875> AgradDistributionWiener_fd_2875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2876> AgradDistributionWiener_fd_2876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2877> AgradDistributionWiener_fd_2877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2878> AgradDistributionWiener_fd_2878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2879> AgradDistributionWiener_fd_2879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2880> AgradDistributionWiener_fd_2880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2881> AgradDistributionWiener_fd_2881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2882> AgradDistributionWiener_fd_2882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2883> AgradDistributionWiener_fd_2883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2884> AgradDistributionWiener_fd_2884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2885> AgradDistributionWiener_fd_2885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2886> AgradDistributionWiener_fd_2886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2887> AgradDistributionWiener_fd_2887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2888> AgradDistributionWiener_fd_2888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2889> AgradDistributionWiener_fd_2889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2890> AgradDistributionWiener_fd_2890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2891> AgradDistributionWiener_fd_2891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2892> AgradDistributionWiener_fd_2892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2893> AgradDistributionWiener_fd_2893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2894> AgradDistributionWiener_fd_2894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2895> AgradDistributionWiener_fd_2895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2896> AgradDistributionWiener_fd_2896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2897> AgradDistributionWiener_fd_2897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2898> AgradDistributionWiener_fd_2898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2899> AgradDistributionWiener_fd_2899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2800, AgradDistributionTestFixture, AgradDistributionWiener_fd_2800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2801, AgradDistributionTestFixture, AgradDistributionWiener_fd_2801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2802, AgradDistributionTestFixture, AgradDistributionWiener_fd_2802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2803, AgradDistributionTestFixture, AgradDistributionWiener_fd_2803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2804, AgradDistributionTestFixture, AgradDistributionWiener_fd_2804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2805, AgradDistributionTestFixture, AgradDistributionWiener_fd_2805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2806, AgradDistributionTestFixture, AgradDistributionWiener_fd_2806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2807, AgradDistributionTestFixture, AgradDistributionWiener_fd_2807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2808, AgradDistributionTestFixture, AgradDistributionWiener_fd_2808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2809, AgradDistributionTestFixture, AgradDistributionWiener_fd_2809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2810, AgradDistributionTestFixture, AgradDistributionWiener_fd_2810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2811, AgradDistributionTestFixture, AgradDistributionWiener_fd_2811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2812, AgradDistributionTestFixture, AgradDistributionWiener_fd_2812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2813, AgradDistributionTestFixture, AgradDistributionWiener_fd_2813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2814, AgradDistributionTestFixture, AgradDistributionWiener_fd_2814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2815, AgradDistributionTestFixture, AgradDistributionWiener_fd_2815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2816, AgradDistributionTestFixture, AgradDistributionWiener_fd_2816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2817, AgradDistributionTestFixture, AgradDistributionWiener_fd_2817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2818, AgradDistributionTestFixture, AgradDistributionWiener_fd_2818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2819, AgradDistributionTestFixture, AgradDistributionWiener_fd_2819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2820, AgradDistributionTestFixture, AgradDistributionWiener_fd_2820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2821, AgradDistributionTestFixture, AgradDistributionWiener_fd_2821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2822, AgradDistributionTestFixture, AgradDistributionWiener_fd_2822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2823, AgradDistributionTestFixture, AgradDistributionWiener_fd_2823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2824, AgradDistributionTestFixture, AgradDistributionWiener_fd_2824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2825, AgradDistributionTestFixture, AgradDistributionWiener_fd_2825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2826, AgradDistributionTestFixture, AgradDistributionWiener_fd_2826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2827, AgradDistributionTestFixture, AgradDistributionWiener_fd_2827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2828, AgradDistributionTestFixture, AgradDistributionWiener_fd_2828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2829, AgradDistributionTestFixture, AgradDistributionWiener_fd_2829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2830, AgradDistributionTestFixture, AgradDistributionWiener_fd_2830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2831, AgradDistributionTestFixture, AgradDistributionWiener_fd_2831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2832, AgradDistributionTestFixture, AgradDistributionWiener_fd_2832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2833, AgradDistributionTestFixture, AgradDistributionWiener_fd_2833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2834, AgradDistributionTestFixture, AgradDistributionWiener_fd_2834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2835, AgradDistributionTestFixture, AgradDistributionWiener_fd_2835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2836, AgradDistributionTestFixture, AgradDistributionWiener_fd_2836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2837, AgradDistributionTestFixture, AgradDistributionWiener_fd_2837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2838, AgradDistributionTestFixture, AgradDistributionWiener_fd_2838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2839, AgradDistributionTestFixture, AgradDistributionWiener_fd_2839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2840, AgradDistributionTestFixture, AgradDistributionWiener_fd_2840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2841, AgradDistributionTestFixture, AgradDistributionWiener_fd_2841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2842, AgradDistributionTestFixture, AgradDistributionWiener_fd_2842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2843, AgradDistributionTestFixture, AgradDistributionWiener_fd_2843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2844, AgradDistributionTestFixture, AgradDistributionWiener_fd_2844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2845, AgradDistributionTestFixture, AgradDistributionWiener_fd_2845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2846, AgradDistributionTestFixture, AgradDistributionWiener_fd_2846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2847, AgradDistributionTestFixture, AgradDistributionWiener_fd_2847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2848, AgradDistributionTestFixture, AgradDistributionWiener_fd_2848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2849, AgradDistributionTestFixture, AgradDistributionWiener_fd_2849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2850, AgradDistributionTestFixture, AgradDistributionWiener_fd_2850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2851, AgradDistributionTestFixture, AgradDistributionWiener_fd_2851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2852, AgradDistributionTestFixture, AgradDistributionWiener_fd_2852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2853, AgradDistributionTestFixture, AgradDistributionWiener_fd_2853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2854, AgradDistributionTestFixture, AgradDistributionWiener_fd_2854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2855, AgradDistributionTestFixture, AgradDistributionWiener_fd_2855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2856, AgradDistributionTestFixture, AgradDistributionWiener_fd_2856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2857, AgradDistributionTestFixture, AgradDistributionWiener_fd_2857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2858, AgradDistributionTestFixture, AgradDistributionWiener_fd_2858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2859, AgradDistributionTestFixture, AgradDistributionWiener_fd_2859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2860, AgradDistributionTestFixture, AgradDistributionWiener_fd_2860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2861, AgradDistributionTestFixture, AgradDistributionWiener_fd_2861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2862, AgradDistributionTestFixture, AgradDistributionWiener_fd_2862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2863, AgradDistributionTestFixture, AgradDistributionWiener_fd_2863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2864, AgradDistributionTestFixture, AgradDistributionWiener_fd_2864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2865, AgradDistributionTestFixture, AgradDistributionWiener_fd_2865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2866, AgradDistributionTestFixture, AgradDistributionWiener_fd_2866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2867, AgradDistributionTestFixture, AgradDistributionWiener_fd_2867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2868, AgradDistributionTestFixture, AgradDistributionWiener_fd_2868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2869, AgradDistributionTestFixture, AgradDistributionWiener_fd_2869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2870, AgradDistributionTestFixture, AgradDistributionWiener_fd_2870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2871, AgradDistributionTestFixture, AgradDistributionWiener_fd_2871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2872, AgradDistributionTestFixture, AgradDistributionWiener_fd_2872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2873, AgradDistributionTestFixture, AgradDistributionWiener_fd_2873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2874, AgradDistributionTestFixture, AgradDistributionWiener_fd_2874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2875, AgradDistributionTestFixture, AgradDistributionWiener_fd_2875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2876, AgradDistributionTestFixture, AgradDistributionWiener_fd_2876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2877, AgradDistributionTestFixture, AgradDistributionWiener_fd_2877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2878, AgradDistributionTestFixture, AgradDistributionWiener_fd_2878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2879, AgradDistributionTestFixture, AgradDistributionWiener_fd_2879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2880, AgradDistributionTestFixture, AgradDistributionWiener_fd_2880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2881, AgradDistributionTestFixture, AgradDistributionWiener_fd_2881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2882, AgradDistributionTestFixture, AgradDistributionWiener_fd_2882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2883, AgradDistributionTestFixture, AgradDistributionWiener_fd_2883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2884, AgradDistributionTestFixture, AgradDistributionWiener_fd_2884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2885, AgradDistributionTestFixture, AgradDistributionWiener_fd_2885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2886, AgradDistributionTestFixture, AgradDistributionWiener_fd_2886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2887, AgradDistributionTestFixture, AgradDistributionWiener_fd_2887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2888, AgradDistributionTestFixture, AgradDistributionWiener_fd_2888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2889, AgradDistributionTestFixture, AgradDistributionWiener_fd_2889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2890, AgradDistributionTestFixture, AgradDistributionWiener_fd_2890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2891, AgradDistributionTestFixture, AgradDistributionWiener_fd_2891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2892, AgradDistributionTestFixture, AgradDistributionWiener_fd_2892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2893, AgradDistributionTestFixture, AgradDistributionWiener_fd_2893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2894, AgradDistributionTestFixture, AgradDistributionWiener_fd_2894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2895, AgradDistributionTestFixture, AgradDistributionWiener_fd_2895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2896, AgradDistributionTestFixture, AgradDistributionWiener_fd_2896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2897, AgradDistributionTestFixture, AgradDistributionWiener_fd_2897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2898, AgradDistributionTestFixture, AgradDistributionWiener_fd_2898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2899, AgradDistributionTestFixture, AgradDistributionWiener_fd_2899);
+
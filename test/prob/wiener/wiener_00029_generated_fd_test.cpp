@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2900;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_2901;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2902;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2903;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2904;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2905;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2906;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, double, empty> type_fd_2907;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_2908;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2909;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_2910;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2911;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2912;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_2913;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2914;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2915;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2916;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2917;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2918;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2919;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2920;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2921;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2922;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2923;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2924;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, empty> type_fd_2925;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_2926;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2927;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_2928;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_2929;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2930;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_2931;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_2932;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2933;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_2934;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2935;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2936;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_2937;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2938;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2939;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2940;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2941;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2942;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_2943;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_2944;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2945;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_2946;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2947;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2948;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_2949;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2950;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2951;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2952;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2953;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2954;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2955;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2956;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2957;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2958;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2959;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2960;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_2961;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_2962;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2963;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_2964;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_2965;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2966;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_2967;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_2968;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2969;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_2970;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_2971;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2972;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_2973;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2974;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2975;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2976;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2977;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2978;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_2979;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_2980;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2981;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_2982;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_2983;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2984;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_2985;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_2986;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2987;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_2988;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_2989;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2990;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_2991;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_2992;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2993;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_2994;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_2995;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_2996;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, double, double, empty> type_fd_2997;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, double, std::vector<double>, empty> type_fd_2998;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_2999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2900> AgradDistributionWiener_fd_2900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2901> AgradDistributionWiener_fd_2901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2902> AgradDistributionWiener_fd_2902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2903> AgradDistributionWiener_fd_2903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2904> AgradDistributionWiener_fd_2904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2905> AgradDistributionWiener_fd_2905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2906> AgradDistributionWiener_fd_2906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2907> AgradDistributionWiener_fd_2907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2908> AgradDistributionWiener_fd_2908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2909> AgradDistributionWiener_fd_2909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2910> AgradDistributionWiener_fd_2910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2911> AgradDistributionWiener_fd_2911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2912> AgradDistributionWiener_fd_2912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2913> AgradDistributionWiener_fd_2913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2914> AgradDistributionWiener_fd_2914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2915> AgradDistributionWiener_fd_2915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2916> AgradDistributionWiener_fd_2916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2917> AgradDistributionWiener_fd_2917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2918> AgradDistributionWiener_fd_2918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2919> AgradDistributionWiener_fd_2919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2920> AgradDistributionWiener_fd_2920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2921> AgradDistributionWiener_fd_2921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2922> AgradDistributionWiener_fd_2922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2923> AgradDistributionWiener_fd_2923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2924> AgradDistributionWiener_fd_2924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2925> AgradDistributionWiener_fd_2925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2926> AgradDistributionWiener_fd_2926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2927> AgradDistributionWiener_fd_2927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2928> AgradDistributionWiener_fd_2928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2929> AgradDistributionWiener_fd_2929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2930> AgradDistributionWiener_fd_2930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2931> AgradDistributionWiener_fd_2931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2932> AgradDistributionWiener_fd_2932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2933> AgradDistributionWiener_fd_2933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2934> AgradDistributionWiener_fd_2934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2935> AgradDistributionWiener_fd_2935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2936> AgradDistributionWiener_fd_2936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2937> AgradDistributionWiener_fd_2937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2938> AgradDistributionWiener_fd_2938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2939> AgradDistributionWiener_fd_2939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2940> AgradDistributionWiener_fd_2940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2941> AgradDistributionWiener_fd_2941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2942> AgradDistributionWiener_fd_2942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2943> AgradDistributionWiener_fd_2943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2944> AgradDistributionWiener_fd_2944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2945> AgradDistributionWiener_fd_2945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2946> AgradDistributionWiener_fd_2946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2947> AgradDistributionWiener_fd_2947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2948> AgradDistributionWiener_fd_2948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2949> AgradDistributionWiener_fd_2949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2950> AgradDistributionWiener_fd_2950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2951> AgradDistributionWiener_fd_2951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2952> AgradDistributionWiener_fd_2952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2953> AgradDistributionWiener_fd_2953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2954> AgradDistributionWiener_fd_2954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2955> AgradDistributionWiener_fd_2955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2956> AgradDistributionWiener_fd_2956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2957> AgradDistributionWiener_fd_2957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2958> AgradDistributionWiener_fd_2958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2959> AgradDistributionWiener_fd_2959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2960> AgradDistributionWiener_fd_2960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2961> AgradDistributionWiener_fd_2961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2962> AgradDistributionWiener_fd_2962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2963> AgradDistributionWiener_fd_2963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2964> AgradDistributionWiener_fd_2964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2965> AgradDistributionWiener_fd_2965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2966> AgradDistributionWiener_fd_2966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2967> AgradDistributionWiener_fd_2967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2968> AgradDistributionWiener_fd_2968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2969> AgradDistributionWiener_fd_2969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2970> AgradDistributionWiener_fd_2970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2971> AgradDistributionWiener_fd_2971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2972> AgradDistributionWiener_fd_2972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2973> AgradDistributionWiener_fd_2973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2974> AgradDistributionWiener_fd_2974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2975> AgradDistributionWiener_fd_2975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2976> AgradDistributionWiener_fd_2976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2977> AgradDistributionWiener_fd_2977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2978> AgradDistributionWiener_fd_2978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2979> AgradDistributionWiener_fd_2979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2980> AgradDistributionWiener_fd_2980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2981> AgradDistributionWiener_fd_2981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2982> AgradDistributionWiener_fd_2982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2983> AgradDistributionWiener_fd_2983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2984> AgradDistributionWiener_fd_2984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2985> AgradDistributionWiener_fd_2985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2986> AgradDistributionWiener_fd_2986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2987> AgradDistributionWiener_fd_2987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2988> AgradDistributionWiener_fd_2988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2989> AgradDistributionWiener_fd_2989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2990> AgradDistributionWiener_fd_2990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2991> AgradDistributionWiener_fd_2991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2992> AgradDistributionWiener_fd_2992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2993> AgradDistributionWiener_fd_2993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2994> AgradDistributionWiener_fd_2994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2995> AgradDistributionWiener_fd_2995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2996> AgradDistributionWiener_fd_2996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2997> AgradDistributionWiener_fd_2997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2998> AgradDistributionWiener_fd_2998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_2999> AgradDistributionWiener_fd_2999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2900, AgradDistributionTestFixture, AgradDistributionWiener_fd_2900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2901, AgradDistributionTestFixture, AgradDistributionWiener_fd_2901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2902, AgradDistributionTestFixture, AgradDistributionWiener_fd_2902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2903, AgradDistributionTestFixture, AgradDistributionWiener_fd_2903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2904, AgradDistributionTestFixture, AgradDistributionWiener_fd_2904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2905, AgradDistributionTestFixture, AgradDistributionWiener_fd_2905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2906, AgradDistributionTestFixture, AgradDistributionWiener_fd_2906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2907, AgradDistributionTestFixture, AgradDistributionWiener_fd_2907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2908, AgradDistributionTestFixture, AgradDistributionWiener_fd_2908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2909, AgradDistributionTestFixture, AgradDistributionWiener_fd_2909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2910, AgradDistributionTestFixture, AgradDistributionWiener_fd_2910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2911, AgradDistributionTestFixture, AgradDistributionWiener_fd_2911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2912, AgradDistributionTestFixture, AgradDistributionWiener_fd_2912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2913, AgradDistributionTestFixture, AgradDistributionWiener_fd_2913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2914, AgradDistributionTestFixture, AgradDistributionWiener_fd_2914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2915, AgradDistributionTestFixture, AgradDistributionWiener_fd_2915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2916, AgradDistributionTestFixture, AgradDistributionWiener_fd_2916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2917, AgradDistributionTestFixture, AgradDistributionWiener_fd_2917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2918, AgradDistributionTestFixture, AgradDistributionWiener_fd_2918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2919, AgradDistributionTestFixture, AgradDistributionWiener_fd_2919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2920, AgradDistributionTestFixture, AgradDistributionWiener_fd_2920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2921, AgradDistributionTestFixture, AgradDistributionWiener_fd_2921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2922, AgradDistributionTestFixture, AgradDistributionWiener_fd_2922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2923, AgradDistributionTestFixture, AgradDistributionWiener_fd_2923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2924, AgradDistributionTestFixture, AgradDistributionWiener_fd_2924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2925, AgradDistributionTestFixture, AgradDistributionWiener_fd_2925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2926, AgradDistributionTestFixture, AgradDistributionWiener_fd_2926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2927, AgradDistributionTestFixture, AgradDistributionWiener_fd_2927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2928, AgradDistributionTestFixture, AgradDistributionWiener_fd_2928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2929, AgradDistributionTestFixture, AgradDistributionWiener_fd_2929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2930, AgradDistributionTestFixture, AgradDistributionWiener_fd_2930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2931, AgradDistributionTestFixture, AgradDistributionWiener_fd_2931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2932, AgradDistributionTestFixture, AgradDistributionWiener_fd_2932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2933, AgradDistributionTestFixture, AgradDistributionWiener_fd_2933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2934, AgradDistributionTestFixture, AgradDistributionWiener_fd_2934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2935, AgradDistributionTestFixture, AgradDistributionWiener_fd_2935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2936, AgradDistributionTestFixture, AgradDistributionWiener_fd_2936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2937, AgradDistributionTestFixture, AgradDistributionWiener_fd_2937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2938, AgradDistributionTestFixture, AgradDistributionWiener_fd_2938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2939, AgradDistributionTestFixture, AgradDistributionWiener_fd_2939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2940, AgradDistributionTestFixture, AgradDistributionWiener_fd_2940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2941, AgradDistributionTestFixture, AgradDistributionWiener_fd_2941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2942, AgradDistributionTestFixture, AgradDistributionWiener_fd_2942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2943, AgradDistributionTestFixture, AgradDistributionWiener_fd_2943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2944, AgradDistributionTestFixture, AgradDistributionWiener_fd_2944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2945, AgradDistributionTestFixture, AgradDistributionWiener_fd_2945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2946, AgradDistributionTestFixture, AgradDistributionWiener_fd_2946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2947, AgradDistributionTestFixture, AgradDistributionWiener_fd_2947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2948, AgradDistributionTestFixture, AgradDistributionWiener_fd_2948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2949, AgradDistributionTestFixture, AgradDistributionWiener_fd_2949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2950, AgradDistributionTestFixture, AgradDistributionWiener_fd_2950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2951, AgradDistributionTestFixture, AgradDistributionWiener_fd_2951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2952, AgradDistributionTestFixture, AgradDistributionWiener_fd_2952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2953, AgradDistributionTestFixture, AgradDistributionWiener_fd_2953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2954, AgradDistributionTestFixture, AgradDistributionWiener_fd_2954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2955, AgradDistributionTestFixture, AgradDistributionWiener_fd_2955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2956, AgradDistributionTestFixture, AgradDistributionWiener_fd_2956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2957, AgradDistributionTestFixture, AgradDistributionWiener_fd_2957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2958, AgradDistributionTestFixture, AgradDistributionWiener_fd_2958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2959, AgradDistributionTestFixture, AgradDistributionWiener_fd_2959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2960, AgradDistributionTestFixture, AgradDistributionWiener_fd_2960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2961, AgradDistributionTestFixture, AgradDistributionWiener_fd_2961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2962, AgradDistributionTestFixture, AgradDistributionWiener_fd_2962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2963, AgradDistributionTestFixture, AgradDistributionWiener_fd_2963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2964, AgradDistributionTestFixture, AgradDistributionWiener_fd_2964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2965, AgradDistributionTestFixture, AgradDistributionWiener_fd_2965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2966, AgradDistributionTestFixture, AgradDistributionWiener_fd_2966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2967, AgradDistributionTestFixture, AgradDistributionWiener_fd_2967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2968, AgradDistributionTestFixture, AgradDistributionWiener_fd_2968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2969, AgradDistributionTestFixture, AgradDistributionWiener_fd_2969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2970, AgradDistributionTestFixture, AgradDistributionWiener_fd_2970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2971, AgradDistributionTestFixture, AgradDistributionWiener_fd_2971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2972, AgradDistributionTestFixture, AgradDistributionWiener_fd_2972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2973, AgradDistributionTestFixture, AgradDistributionWiener_fd_2973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2974, AgradDistributionTestFixture, AgradDistributionWiener_fd_2974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2975, AgradDistributionTestFixture, AgradDistributionWiener_fd_2975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2976, AgradDistributionTestFixture, AgradDistributionWiener_fd_2976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2977, AgradDistributionTestFixture, AgradDistributionWiener_fd_2977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2978, AgradDistributionTestFixture, AgradDistributionWiener_fd_2978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2979, AgradDistributionTestFixture, AgradDistributionWiener_fd_2979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2980, AgradDistributionTestFixture, AgradDistributionWiener_fd_2980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2981, AgradDistributionTestFixture, AgradDistributionWiener_fd_2981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2982, AgradDistributionTestFixture, AgradDistributionWiener_fd_2982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2983, AgradDistributionTestFixture, AgradDistributionWiener_fd_2983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2984, AgradDistributionTestFixture, AgradDistributionWiener_fd_2984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2985, AgradDistributionTestFixture, AgradDistributionWiener_fd_2985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2986, AgradDistributionTestFixture, AgradDistributionWiener_fd_2986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2987, AgradDistributionTestFixture, AgradDistributionWiener_fd_2987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2988, AgradDistributionTestFixture, AgradDistributionWiener_fd_2988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2989, AgradDistributionTestFixture, AgradDistributionWiener_fd_2989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2990, AgradDistributionTestFixture, AgradDistributionWiener_fd_2990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2991, AgradDistributionTestFixture, AgradDistributionWiener_fd_2991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2992, AgradDistributionTestFixture, AgradDistributionWiener_fd_2992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2993, AgradDistributionTestFixture, AgradDistributionWiener_fd_2993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2994, AgradDistributionTestFixture, AgradDistributionWiener_fd_2994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2995, AgradDistributionTestFixture, AgradDistributionWiener_fd_2995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2996, AgradDistributionTestFixture, AgradDistributionWiener_fd_2996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2997, AgradDistributionTestFixture, AgradDistributionWiener_fd_2997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2998, AgradDistributionTestFixture, AgradDistributionWiener_fd_2998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_2999, AgradDistributionTestFixture, AgradDistributionWiener_fd_2999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2900;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_2901;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2902;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2903;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2904;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2905;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2906;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2907;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2908;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2909;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2910;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2911;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2912;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2913;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2914;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2915;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, double, empty> type_v_2916;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, std::vector<double>, empty> type_v_2917;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2918;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, var, empty> type_v_2919;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, std::vector<var>, empty> type_v_2920;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2921;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, double, empty> type_v_2922;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, std::vector<double>, empty> type_v_2923;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2924;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, var, empty> type_v_2925;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, std::vector<var>, empty> type_v_2926;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2927;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2928;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2929;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2930;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2931;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2932;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2933;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, double, empty> type_v_2934;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, std::vector<double>, empty> type_v_2935;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2936;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, var, empty> type_v_2937;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, std::vector<var>, empty> type_v_2938;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2939;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, double, empty> type_v_2940;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, std::vector<double>, empty> type_v_2941;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2942;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, var, empty> type_v_2943;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, std::vector<var>, empty> type_v_2944;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2945;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2946;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2947;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2948;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2949;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2950;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2951;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, double, empty> type_v_2952;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, std::vector<double>, empty> type_v_2953;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2954;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, var, empty> type_v_2955;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, std::vector<var>, empty> type_v_2956;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2957;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, double, empty> type_v_2958;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_2959;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2960;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, var, empty> type_v_2961;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_2962;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2963;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2964;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2965;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2966;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2967;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2968;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2969;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, double, empty> type_v_2970;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, std::vector<double>, empty> type_v_2971;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2972;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, var, empty> type_v_2973;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, std::vector<var>, empty> type_v_2974;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2975;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, double, empty> type_v_2976;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_2977;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2978;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, var, empty> type_v_2979;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_2980;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2981;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2982;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2983;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2984;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2985;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2986;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2987;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_2988;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2989;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2990;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_2991;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2992;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2993;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2994;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2995;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2996;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2997;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2998;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2900> AgradDistributionWiener_v_2900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2901> AgradDistributionWiener_v_2901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2902> AgradDistributionWiener_v_2902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2903> AgradDistributionWiener_v_2903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2904> AgradDistributionWiener_v_2904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2905> AgradDistributionWiener_v_2905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2906> AgradDistributionWiener_v_2906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2907> AgradDistributionWiener_v_2907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2908> AgradDistributionWiener_v_2908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2909> AgradDistributionWiener_v_2909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2910> AgradDistributionWiener_v_2910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2911> AgradDistributionWiener_v_2911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2912> AgradDistributionWiener_v_2912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2913> AgradDistributionWiener_v_2913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2914> AgradDistributionWiener_v_2914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2915> AgradDistributionWiener_v_2915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2916> AgradDistributionWiener_v_2916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2917> AgradDistributionWiener_v_2917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2918> AgradDistributionWiener_v_2918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2919> AgradDistributionWiener_v_2919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2920> AgradDistributionWiener_v_2920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2921> AgradDistributionWiener_v_2921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2922> AgradDistributionWiener_v_2922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2923> AgradDistributionWiener_v_2923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2924> AgradDistributionWiener_v_2924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2925> AgradDistributionWiener_v_2925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2926> AgradDistributionWiener_v_2926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2927> AgradDistributionWiener_v_2927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2928> AgradDistributionWiener_v_2928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2929> AgradDistributionWiener_v_2929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2930> AgradDistributionWiener_v_2930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2931> AgradDistributionWiener_v_2931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2932> AgradDistributionWiener_v_2932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2933> AgradDistributionWiener_v_2933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2934> AgradDistributionWiener_v_2934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2935> AgradDistributionWiener_v_2935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2936> AgradDistributionWiener_v_2936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2937> AgradDistributionWiener_v_2937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2938> AgradDistributionWiener_v_2938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2939> AgradDistributionWiener_v_2939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2940> AgradDistributionWiener_v_2940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2941> AgradDistributionWiener_v_2941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2942> AgradDistributionWiener_v_2942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2943> AgradDistributionWiener_v_2943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2944> AgradDistributionWiener_v_2944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2945> AgradDistributionWiener_v_2945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2946> AgradDistributionWiener_v_2946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2947> AgradDistributionWiener_v_2947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2948> AgradDistributionWiener_v_2948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2949> AgradDistributionWiener_v_2949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2950> AgradDistributionWiener_v_2950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2951> AgradDistributionWiener_v_2951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2952> AgradDistributionWiener_v_2952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2953> AgradDistributionWiener_v_2953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2954> AgradDistributionWiener_v_2954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2955> AgradDistributionWiener_v_2955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2956> AgradDistributionWiener_v_2956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2957> AgradDistributionWiener_v_2957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2958> AgradDistributionWiener_v_2958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2959> AgradDistributionWiener_v_2959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2960> AgradDistributionWiener_v_2960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2961> AgradDistributionWiener_v_2961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2962> AgradDistributionWiener_v_2962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2963> AgradDistributionWiener_v_2963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2964> AgradDistributionWiener_v_2964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2965> AgradDistributionWiener_v_2965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2966> AgradDistributionWiener_v_2966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2967> AgradDistributionWiener_v_2967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2968> AgradDistributionWiener_v_2968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2969> AgradDistributionWiener_v_2969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2970> AgradDistributionWiener_v_2970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2971> AgradDistributionWiener_v_2971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2972> AgradDistributionWiener_v_2972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2973> AgradDistributionWiener_v_2973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2974> AgradDistributionWiener_v_2974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2975> AgradDistributionWiener_v_2975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2976> AgradDistributionWiener_v_2976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2977> AgradDistributionWiener_v_2977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2978> AgradDistributionWiener_v_2978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2979> AgradDistributionWiener_v_2979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2980> AgradDistributionWiener_v_2980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2981> AgradDistributionWiener_v_2981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2982> AgradDistributionWiener_v_2982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2983> AgradDistributionWiener_v_2983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2984> AgradDistributionWiener_v_2984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2985> AgradDistributionWiener_v_2985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2986> AgradDistributionWiener_v_2986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2987> AgradDistributionWiener_v_2987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2988> AgradDistributionWiener_v_2988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2989> AgradDistributionWiener_v_2989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2990> AgradDistributionWiener_v_2990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2991> AgradDistributionWiener_v_2991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2992> AgradDistributionWiener_v_2992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2993> AgradDistributionWiener_v_2993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2994> AgradDistributionWiener_v_2994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2995> AgradDistributionWiener_v_2995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2996> AgradDistributionWiener_v_2996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2997> AgradDistributionWiener_v_2997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2998> AgradDistributionWiener_v_2998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_2999> AgradDistributionWiener_v_2999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2900, AgradDistributionTestFixture, AgradDistributionWiener_v_2900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2901, AgradDistributionTestFixture, AgradDistributionWiener_v_2901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2902, AgradDistributionTestFixture, AgradDistributionWiener_v_2902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2903, AgradDistributionTestFixture, AgradDistributionWiener_v_2903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2904, AgradDistributionTestFixture, AgradDistributionWiener_v_2904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2905, AgradDistributionTestFixture, AgradDistributionWiener_v_2905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2906, AgradDistributionTestFixture, AgradDistributionWiener_v_2906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2907, AgradDistributionTestFixture, AgradDistributionWiener_v_2907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2908, AgradDistributionTestFixture, AgradDistributionWiener_v_2908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2909, AgradDistributionTestFixture, AgradDistributionWiener_v_2909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2910, AgradDistributionTestFixture, AgradDistributionWiener_v_2910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2911, AgradDistributionTestFixture, AgradDistributionWiener_v_2911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2912, AgradDistributionTestFixture, AgradDistributionWiener_v_2912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2913, AgradDistributionTestFixture, AgradDistributionWiener_v_2913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2914, AgradDistributionTestFixture, AgradDistributionWiener_v_2914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2915, AgradDistributionTestFixture, AgradDistributionWiener_v_2915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2916, AgradDistributionTestFixture, AgradDistributionWiener_v_2916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2917, AgradDistributionTestFixture, AgradDistributionWiener_v_2917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2918, AgradDistributionTestFixture, AgradDistributionWiener_v_2918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2919, AgradDistributionTestFixture, AgradDistributionWiener_v_2919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2920, AgradDistributionTestFixture, AgradDistributionWiener_v_2920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2921, AgradDistributionTestFixture, AgradDistributionWiener_v_2921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2922, AgradDistributionTestFixture, AgradDistributionWiener_v_2922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2923, AgradDistributionTestFixture, AgradDistributionWiener_v_2923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2924, AgradDistributionTestFixture, AgradDistributionWiener_v_2924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2925, AgradDistributionTestFixture, AgradDistributionWiener_v_2925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2926, AgradDistributionTestFixture, AgradDistributionWiener_v_2926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2927, AgradDistributionTestFixture, AgradDistributionWiener_v_2927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2928, AgradDistributionTestFixture, AgradDistributionWiener_v_2928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2929, AgradDistributionTestFixture, AgradDistributionWiener_v_2929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2930, AgradDistributionTestFixture, AgradDistributionWiener_v_2930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2931, AgradDistributionTestFixture, AgradDistributionWiener_v_2931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2932, AgradDistributionTestFixture, AgradDistributionWiener_v_2932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2933, AgradDistributionTestFixture, AgradDistributionWiener_v_2933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2934, AgradDistributionTestFixture, AgradDistributionWiener_v_2934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2935, AgradDistributionTestFixture, AgradDistributionWiener_v_2935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2936, AgradDistributionTestFixture, AgradDistributionWiener_v_2936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2937, AgradDistributionTestFixture, AgradDistributionWiener_v_2937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2938, AgradDistributionTestFixture, AgradDistributionWiener_v_2938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2939, AgradDistributionTestFixture, AgradDistributionWiener_v_2939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2940, AgradDistributionTestFixture, AgradDistributionWiener_v_2940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2941, AgradDistributionTestFixture, AgradDistributionWiener_v_2941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2942, AgradDistributionTestFixture, AgradDistributionWiener_v_2942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2943, AgradDistributionTestFixture, AgradDistributionWiener_v_2943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2944, AgradDistributionTestFixture, AgradDistributionWiener_v_2944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2945, AgradDistributionTestFixture, AgradDistributionWiener_v_2945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2946, AgradDistributionTestFixture, AgradDistributionWiener_v_2946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2947, AgradDistributionTestFixture, AgradDistributionWiener_v_2947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2948, AgradDistributionTestFixture, AgradDistributionWiener_v_2948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2949, AgradDistributionTestFixture, AgradDistributionWiener_v_2949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2950, AgradDistributionTestFixture, AgradDistributionWiener_v_2950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2951, AgradDistributionTestFixture, AgradDistributionWiener_v_2951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2952, AgradDistributionTestFixture, AgradDistributionWiener_v_2952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2953, AgradDistributionTestFixture, AgradDistributionWiener_v_2953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2954, AgradDistributionTestFixture, AgradDistributionWiener_v_2954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2955, AgradDistributionTestFixture, AgradDistributionWiener_v_2955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2956, AgradDistributionTestFixture, AgradDistributionWiener_v_2956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2957, AgradDistributionTestFixture, AgradDistributionWiener_v_2957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2958, AgradDistributionTestFixture, AgradDistributionWiener_v_2958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2959, AgradDistributionTestFixture, AgradDistributionWiener_v_2959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2960, AgradDistributionTestFixture, AgradDistributionWiener_v_2960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2961, AgradDistributionTestFixture, AgradDistributionWiener_v_2961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2962, AgradDistributionTestFixture, AgradDistributionWiener_v_2962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2963, AgradDistributionTestFixture, AgradDistributionWiener_v_2963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2964, AgradDistributionTestFixture, AgradDistributionWiener_v_2964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2965, AgradDistributionTestFixture, AgradDistributionWiener_v_2965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2966, AgradDistributionTestFixture, AgradDistributionWiener_v_2966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2967, AgradDistributionTestFixture, AgradDistributionWiener_v_2967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2968, AgradDistributionTestFixture, AgradDistributionWiener_v_2968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2969, AgradDistributionTestFixture, AgradDistributionWiener_v_2969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2970, AgradDistributionTestFixture, AgradDistributionWiener_v_2970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2971, AgradDistributionTestFixture, AgradDistributionWiener_v_2971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2972, AgradDistributionTestFixture, AgradDistributionWiener_v_2972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2973, AgradDistributionTestFixture, AgradDistributionWiener_v_2973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2974, AgradDistributionTestFixture, AgradDistributionWiener_v_2974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2975, AgradDistributionTestFixture, AgradDistributionWiener_v_2975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2976, AgradDistributionTestFixture, AgradDistributionWiener_v_2976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2977, AgradDistributionTestFixture, AgradDistributionWiener_v_2977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2978, AgradDistributionTestFixture, AgradDistributionWiener_v_2978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2979, AgradDistributionTestFixture, AgradDistributionWiener_v_2979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2980, AgradDistributionTestFixture, AgradDistributionWiener_v_2980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2981, AgradDistributionTestFixture, AgradDistributionWiener_v_2981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2982, AgradDistributionTestFixture, AgradDistributionWiener_v_2982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2983, AgradDistributionTestFixture, AgradDistributionWiener_v_2983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2984, AgradDistributionTestFixture, AgradDistributionWiener_v_2984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2985, AgradDistributionTestFixture, AgradDistributionWiener_v_2985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2986, AgradDistributionTestFixture, AgradDistributionWiener_v_2986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2987, AgradDistributionTestFixture, AgradDistributionWiener_v_2987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2988, AgradDistributionTestFixture, AgradDistributionWiener_v_2988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2989, AgradDistributionTestFixture, AgradDistributionWiener_v_2989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2990, AgradDistributionTestFixture, AgradDistributionWiener_v_2990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2991, AgradDistributionTestFixture, AgradDistributionWiener_v_2991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2992, AgradDistributionTestFixture, AgradDistributionWiener_v_2992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2993, AgradDistributionTestFixture, AgradDistributionWiener_v_2993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2994, AgradDistributionTestFixture, AgradDistributionWiener_v_2994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2995, AgradDistributionTestFixture, AgradDistributionWiener_v_2995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2996, AgradDistributionTestFixture, AgradDistributionWiener_v_2996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2997, AgradDistributionTestFixture, AgradDistributionWiener_v_2997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2998, AgradDistributionTestFixture, AgradDistributionWiener_v_2998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_2999, AgradDistributionTestFixture, AgradDistributionWiener_v_2999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty> type_ffv_3000;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3001;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3002;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, double, empty> type_ffv_3003;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty> type_ffv_3004;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3005;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3006;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3007;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3008;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3009;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3010;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3011;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3012;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3013;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3014;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty> type_ffv_3015;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3016;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3017;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3018;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3019;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3020;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3021;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3022;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3023;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3024;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3025;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3026;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3027;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3028;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3029;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3030;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3031;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3032;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, double, empty> type_ffv_3033;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty> type_ffv_3034;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3035;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_3036;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3037;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3038;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty> type_ffv_3039;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_3040;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3041;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3042;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3043;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3044;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3045;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3046;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3047;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3048;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3049;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3050;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_3051;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3052;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3053;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3054;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3055;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3056;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3057;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3058;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3059;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3060;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3061;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3062;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3063;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3064;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3065;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3066;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3067;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3068;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3069;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3070;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3071;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3072;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3073;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3074;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3075;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_3076;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3077;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3078;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3079;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3080;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3081;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3082;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3083;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3084;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3085;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3086;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3087;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3088;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3089;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3090;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3091;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3092;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3093;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3094;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3095;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3096;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3097;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3098;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3000> AgradDistributionWiener_ffv_3000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3001> AgradDistributionWiener_ffv_3001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3002> AgradDistributionWiener_ffv_3002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3003> AgradDistributionWiener_ffv_3003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3004> AgradDistributionWiener_ffv_3004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3005> AgradDistributionWiener_ffv_3005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3006> AgradDistributionWiener_ffv_3006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3007> AgradDistributionWiener_ffv_3007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3008> AgradDistributionWiener_ffv_3008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3009> AgradDistributionWiener_ffv_3009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3010> AgradDistributionWiener_ffv_3010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3011> AgradDistributionWiener_ffv_3011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3012> AgradDistributionWiener_ffv_3012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3013> AgradDistributionWiener_ffv_3013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3014> AgradDistributionWiener_ffv_3014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3015> AgradDistributionWiener_ffv_3015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3016> AgradDistributionWiener_ffv_3016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3017> AgradDistributionWiener_ffv_3017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3018> AgradDistributionWiener_ffv_3018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3019> AgradDistributionWiener_ffv_3019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3020> AgradDistributionWiener_ffv_3020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3021> AgradDistributionWiener_ffv_3021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3022> AgradDistributionWiener_ffv_3022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3023> AgradDistributionWiener_ffv_3023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3024> AgradDistributionWiener_ffv_3024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3025> AgradDistributionWiener_ffv_3025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3026> AgradDistributionWiener_ffv_3026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3027> AgradDistributionWiener_ffv_3027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3028> AgradDistributionWiener_ffv_3028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3029> AgradDistributionWiener_ffv_3029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3030> AgradDistributionWiener_ffv_3030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3031> AgradDistributionWiener_ffv_3031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3032> AgradDistributionWiener_ffv_3032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3033> AgradDistributionWiener_ffv_3033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3034> AgradDistributionWiener_ffv_3034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3035> AgradDistributionWiener_ffv_3035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3036> AgradDistributionWiener_ffv_3036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3037> AgradDistributionWiener_ffv_3037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3038> AgradDistributionWiener_ffv_3038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3039> AgradDistributionWiener_ffv_3039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3040> AgradDistributionWiener_ffv_3040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3041> AgradDistributionWiener_ffv_3041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3042> AgradDistributionWiener_ffv_3042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3043> AgradDistributionWiener_ffv_3043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3044> AgradDistributionWiener_ffv_3044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3045> AgradDistributionWiener_ffv_3045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3046> AgradDistributionWiener_ffv_3046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3047> AgradDistributionWiener_ffv_3047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3048> AgradDistributionWiener_ffv_3048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3049> AgradDistributionWiener_ffv_3049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3050> AgradDistributionWiener_ffv_3050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3051> AgradDistributionWiener_ffv_3051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3052> AgradDistributionWiener_ffv_3052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3053> AgradDistributionWiener_ffv_3053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3054> AgradDistributionWiener_ffv_3054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3055> AgradDistributionWiener_ffv_3055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3056> AgradDistributionWiener_ffv_3056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3057> AgradDistributionWiener_ffv_3057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3058> AgradDistributionWiener_ffv_3058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3059> AgradDistributionWiener_ffv_3059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3060> AgradDistributionWiener_ffv_3060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3061> AgradDistributionWiener_ffv_3061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3062> AgradDistributionWiener_ffv_3062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3063> AgradDistributionWiener_ffv_3063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3064> AgradDistributionWiener_ffv_3064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3065> AgradDistributionWiener_ffv_3065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3066> AgradDistributionWiener_ffv_3066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3067> AgradDistributionWiener_ffv_3067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3068> AgradDistributionWiener_ffv_3068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3069> AgradDistributionWiener_ffv_3069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3070> AgradDistributionWiener_ffv_3070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3071> AgradDistributionWiener_ffv_3071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3072> AgradDistributionWiener_ffv_3072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3073> AgradDistributionWiener_ffv_3073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3074> AgradDistributionWiener_ffv_3074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3075> AgradDistributionWiener_ffv_3075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3076> AgradDistributionWiener_ffv_3076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3077> AgradDistributionWiener_ffv_3077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3078> AgradDistributionWiener_ffv_3078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3079> AgradDistributionWiener_ffv_3079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3080> AgradDistributionWiener_ffv_3080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3081> AgradDistributionWiener_ffv_3081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3082> AgradDistributionWiener_ffv_3082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3083> AgradDistributionWiener_ffv_3083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3084> AgradDistributionWiener_ffv_3084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3085> AgradDistributionWiener_ffv_3085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3086> AgradDistributionWiener_ffv_3086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3087> AgradDistributionWiener_ffv_3087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3088> AgradDistributionWiener_ffv_3088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3089> AgradDistributionWiener_ffv_3089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3090> AgradDistributionWiener_ffv_3090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3091> AgradDistributionWiener_ffv_3091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3092> AgradDistributionWiener_ffv_3092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3093> AgradDistributionWiener_ffv_3093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3094> AgradDistributionWiener_ffv_3094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3095> AgradDistributionWiener_ffv_3095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3096> AgradDistributionWiener_ffv_3096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3097> AgradDistributionWiener_ffv_3097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3098> AgradDistributionWiener_ffv_3098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3099> AgradDistributionWiener_ffv_3099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3000, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3001, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3002, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3003, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3004, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3005, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3006, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3007, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3008, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3009, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3010, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3011, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3012, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3013, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3014, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3015, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3016, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3017, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3018, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3019, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3020, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3021, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3022, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3023, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3024, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3025, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3026, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3027, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3028, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3029, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3030, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3031, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3032, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3033, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3034, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3035, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3036, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3037, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3038, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3039, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3040, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3041, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3042, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3043, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3044, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3045, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3046, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3047, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3048, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3049, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3050, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3051, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3052, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3053, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3054, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3055, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3056, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3057, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3058, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3059, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3060, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3061, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3062, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3063, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3064, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3065, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3066, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3067, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3068, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3069, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3070, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3071, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3072, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3073, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3074, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3075, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3076, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3077, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3078, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3079, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3080, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3081, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3082, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3083, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3084, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3085, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3086, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3087, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3088, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3089, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3090, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3091, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3092, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3093, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3094, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3095, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3096, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3097, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3098, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3099, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_3100;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3101;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_3102;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_3103;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3104;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_3105;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_3106;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3107;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3108;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3109;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3110;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3111;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3112;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3113;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_3114;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3115;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3116;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_3117;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3118;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3119;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3120;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3121;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3122;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3123;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3124;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3125;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3126;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3127;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3128;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3129;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3130;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3131;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty> type_v_3132;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_3133;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3134;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty> type_v_3135;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_3136;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3137;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_3138;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_3139;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3140;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_3141;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_3142;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3143;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3144;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3145;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3146;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3147;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3148;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3149;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty> type_v_3150;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty> type_v_3151;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3152;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty> type_v_3153;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_3154;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3155;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_3156;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_3157;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3158;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_3159;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_3160;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3161;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3162;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3163;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3164;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3165;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3166;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3167;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_3168;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_3169;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3170;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_3171;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_3172;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3173;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_3174;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_3175;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3176;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_3177;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_3178;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3179;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3180;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3181;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3182;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3183;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3184;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3185;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_3186;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_3187;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3188;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_3189;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_3190;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3191;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_3192;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_3193;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3194;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_3195;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_3196;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3197;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3198;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3100> AgradDistributionWiener_v_3100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3101> AgradDistributionWiener_v_3101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3102> AgradDistributionWiener_v_3102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3103> AgradDistributionWiener_v_3103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3104> AgradDistributionWiener_v_3104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3105> AgradDistributionWiener_v_3105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3106> AgradDistributionWiener_v_3106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3107> AgradDistributionWiener_v_3107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3108> AgradDistributionWiener_v_3108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3109> AgradDistributionWiener_v_3109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3110> AgradDistributionWiener_v_3110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3111> AgradDistributionWiener_v_3111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3112> AgradDistributionWiener_v_3112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3113> AgradDistributionWiener_v_3113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3114> AgradDistributionWiener_v_3114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3115> AgradDistributionWiener_v_3115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3116> AgradDistributionWiener_v_3116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3117> AgradDistributionWiener_v_3117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3118> AgradDistributionWiener_v_3118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3119> AgradDistributionWiener_v_3119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3120> AgradDistributionWiener_v_3120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3121> AgradDistributionWiener_v_3121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3122> AgradDistributionWiener_v_3122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3123> AgradDistributionWiener_v_3123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3124> AgradDistributionWiener_v_3124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3125> AgradDistributionWiener_v_3125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3126> AgradDistributionWiener_v_3126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3127> AgradDistributionWiener_v_3127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3128> AgradDistributionWiener_v_3128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3129> AgradDistributionWiener_v_3129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3130> AgradDistributionWiener_v_3130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3131> AgradDistributionWiener_v_3131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3132> AgradDistributionWiener_v_3132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3133> AgradDistributionWiener_v_3133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3134> AgradDistributionWiener_v_3134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3135> AgradDistributionWiener_v_3135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3136> AgradDistributionWiener_v_3136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3137> AgradDistributionWiener_v_3137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3138> AgradDistributionWiener_v_3138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3139> AgradDistributionWiener_v_3139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3140> AgradDistributionWiener_v_3140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3141> AgradDistributionWiener_v_3141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3142> AgradDistributionWiener_v_3142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3143> AgradDistributionWiener_v_3143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3144> AgradDistributionWiener_v_3144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3145> AgradDistributionWiener_v_3145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3146> AgradDistributionWiener_v_3146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3147> AgradDistributionWiener_v_3147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3148> AgradDistributionWiener_v_3148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3149> AgradDistributionWiener_v_3149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3150> AgradDistributionWiener_v_3150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3151> AgradDistributionWiener_v_3151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3152> AgradDistributionWiener_v_3152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3153> AgradDistributionWiener_v_3153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3154> AgradDistributionWiener_v_3154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3155> AgradDistributionWiener_v_3155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3156> AgradDistributionWiener_v_3156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3157> AgradDistributionWiener_v_3157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3158> AgradDistributionWiener_v_3158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3159> AgradDistributionWiener_v_3159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3160> AgradDistributionWiener_v_3160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3161> AgradDistributionWiener_v_3161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3162> AgradDistributionWiener_v_3162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3163> AgradDistributionWiener_v_3163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3164> AgradDistributionWiener_v_3164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3165> AgradDistributionWiener_v_3165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3166> AgradDistributionWiener_v_3166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3167> AgradDistributionWiener_v_3167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3168> AgradDistributionWiener_v_3168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3169> AgradDistributionWiener_v_3169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3170> AgradDistributionWiener_v_3170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3171> AgradDistributionWiener_v_3171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3172> AgradDistributionWiener_v_3172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3173> AgradDistributionWiener_v_3173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3174> AgradDistributionWiener_v_3174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3175> AgradDistributionWiener_v_3175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3176> AgradDistributionWiener_v_3176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3177> AgradDistributionWiener_v_3177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3178> AgradDistributionWiener_v_3178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3179> AgradDistributionWiener_v_3179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3180> AgradDistributionWiener_v_3180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3181> AgradDistributionWiener_v_3181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3182> AgradDistributionWiener_v_3182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3183> AgradDistributionWiener_v_3183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3184> AgradDistributionWiener_v_3184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3185> AgradDistributionWiener_v_3185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3186> AgradDistributionWiener_v_3186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3187> AgradDistributionWiener_v_3187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3188> AgradDistributionWiener_v_3188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3189> AgradDistributionWiener_v_3189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3190> AgradDistributionWiener_v_3190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3191> AgradDistributionWiener_v_3191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3192> AgradDistributionWiener_v_3192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3193> AgradDistributionWiener_v_3193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3194> AgradDistributionWiener_v_3194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3195> AgradDistributionWiener_v_3195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3196> AgradDistributionWiener_v_3196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3197> AgradDistributionWiener_v_3197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3198> AgradDistributionWiener_v_3198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3199> AgradDistributionWiener_v_3199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3100, AgradDistributionTestFixture, AgradDistributionWiener_v_3100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3101, AgradDistributionTestFixture, AgradDistributionWiener_v_3101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3102, AgradDistributionTestFixture, AgradDistributionWiener_v_3102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3103, AgradDistributionTestFixture, AgradDistributionWiener_v_3103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3104, AgradDistributionTestFixture, AgradDistributionWiener_v_3104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3105, AgradDistributionTestFixture, AgradDistributionWiener_v_3105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3106, AgradDistributionTestFixture, AgradDistributionWiener_v_3106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3107, AgradDistributionTestFixture, AgradDistributionWiener_v_3107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3108, AgradDistributionTestFixture, AgradDistributionWiener_v_3108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3109, AgradDistributionTestFixture, AgradDistributionWiener_v_3109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3110, AgradDistributionTestFixture, AgradDistributionWiener_v_3110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3111, AgradDistributionTestFixture, AgradDistributionWiener_v_3111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3112, AgradDistributionTestFixture, AgradDistributionWiener_v_3112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3113, AgradDistributionTestFixture, AgradDistributionWiener_v_3113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3114, AgradDistributionTestFixture, AgradDistributionWiener_v_3114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3115, AgradDistributionTestFixture, AgradDistributionWiener_v_3115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3116, AgradDistributionTestFixture, AgradDistributionWiener_v_3116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3117, AgradDistributionTestFixture, AgradDistributionWiener_v_3117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3118, AgradDistributionTestFixture, AgradDistributionWiener_v_3118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3119, AgradDistributionTestFixture, AgradDistributionWiener_v_3119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3120, AgradDistributionTestFixture, AgradDistributionWiener_v_3120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3121, AgradDistributionTestFixture, AgradDistributionWiener_v_3121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3122, AgradDistributionTestFixture, AgradDistributionWiener_v_3122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3123, AgradDistributionTestFixture, AgradDistributionWiener_v_3123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3124, AgradDistributionTestFixture, AgradDistributionWiener_v_3124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3125, AgradDistributionTestFixture, AgradDistributionWiener_v_3125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3126, AgradDistributionTestFixture, AgradDistributionWiener_v_3126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3127, AgradDistributionTestFixture, AgradDistributionWiener_v_3127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3128, AgradDistributionTestFixture, AgradDistributionWiener_v_3128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3129, AgradDistributionTestFixture, AgradDistributionWiener_v_3129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3130, AgradDistributionTestFixture, AgradDistributionWiener_v_3130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3131, AgradDistributionTestFixture, AgradDistributionWiener_v_3131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3132, AgradDistributionTestFixture, AgradDistributionWiener_v_3132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3133, AgradDistributionTestFixture, AgradDistributionWiener_v_3133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3134, AgradDistributionTestFixture, AgradDistributionWiener_v_3134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3135, AgradDistributionTestFixture, AgradDistributionWiener_v_3135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3136, AgradDistributionTestFixture, AgradDistributionWiener_v_3136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3137, AgradDistributionTestFixture, AgradDistributionWiener_v_3137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3138, AgradDistributionTestFixture, AgradDistributionWiener_v_3138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3139, AgradDistributionTestFixture, AgradDistributionWiener_v_3139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3140, AgradDistributionTestFixture, AgradDistributionWiener_v_3140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3141, AgradDistributionTestFixture, AgradDistributionWiener_v_3141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3142, AgradDistributionTestFixture, AgradDistributionWiener_v_3142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3143, AgradDistributionTestFixture, AgradDistributionWiener_v_3143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3144, AgradDistributionTestFixture, AgradDistributionWiener_v_3144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3145, AgradDistributionTestFixture, AgradDistributionWiener_v_3145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3146, AgradDistributionTestFixture, AgradDistributionWiener_v_3146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3147, AgradDistributionTestFixture, AgradDistributionWiener_v_3147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3148, AgradDistributionTestFixture, AgradDistributionWiener_v_3148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3149, AgradDistributionTestFixture, AgradDistributionWiener_v_3149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3150, AgradDistributionTestFixture, AgradDistributionWiener_v_3150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3151, AgradDistributionTestFixture, AgradDistributionWiener_v_3151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3152, AgradDistributionTestFixture, AgradDistributionWiener_v_3152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3153, AgradDistributionTestFixture, AgradDistributionWiener_v_3153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3154, AgradDistributionTestFixture, AgradDistributionWiener_v_3154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3155, AgradDistributionTestFixture, AgradDistributionWiener_v_3155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3156, AgradDistributionTestFixture, AgradDistributionWiener_v_3156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3157, AgradDistributionTestFixture, AgradDistributionWiener_v_3157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3158, AgradDistributionTestFixture, AgradDistributionWiener_v_3158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3159, AgradDistributionTestFixture, AgradDistributionWiener_v_3159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3160, AgradDistributionTestFixture, AgradDistributionWiener_v_3160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3161, AgradDistributionTestFixture, AgradDistributionWiener_v_3161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3162, AgradDistributionTestFixture, AgradDistributionWiener_v_3162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3163, AgradDistributionTestFixture, AgradDistributionWiener_v_3163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3164, AgradDistributionTestFixture, AgradDistributionWiener_v_3164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3165, AgradDistributionTestFixture, AgradDistributionWiener_v_3165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3166, AgradDistributionTestFixture, AgradDistributionWiener_v_3166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3167, AgradDistributionTestFixture, AgradDistributionWiener_v_3167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3168, AgradDistributionTestFixture, AgradDistributionWiener_v_3168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3169, AgradDistributionTestFixture, AgradDistributionWiener_v_3169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3170, AgradDistributionTestFixture, AgradDistributionWiener_v_3170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3171, AgradDistributionTestFixture, AgradDistributionWiener_v_3171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3172, AgradDistributionTestFixture, AgradDistributionWiener_v_3172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3173, AgradDistributionTestFixture, AgradDistributionWiener_v_3173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3174, AgradDistributionTestFixture, AgradDistributionWiener_v_3174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3175, AgradDistributionTestFixture, AgradDistributionWiener_v_3175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3176, AgradDistributionTestFixture, AgradDistributionWiener_v_3176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3177, AgradDistributionTestFixture, AgradDistributionWiener_v_3177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3178, AgradDistributionTestFixture, AgradDistributionWiener_v_3178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3179, AgradDistributionTestFixture, AgradDistributionWiener_v_3179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3180, AgradDistributionTestFixture, AgradDistributionWiener_v_3180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3181, AgradDistributionTestFixture, AgradDistributionWiener_v_3181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3182, AgradDistributionTestFixture, AgradDistributionWiener_v_3182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3183, AgradDistributionTestFixture, AgradDistributionWiener_v_3183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3184, AgradDistributionTestFixture, AgradDistributionWiener_v_3184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3185, AgradDistributionTestFixture, AgradDistributionWiener_v_3185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3186, AgradDistributionTestFixture, AgradDistributionWiener_v_3186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3187, AgradDistributionTestFixture, AgradDistributionWiener_v_3187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3188, AgradDistributionTestFixture, AgradDistributionWiener_v_3188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3189, AgradDistributionTestFixture, AgradDistributionWiener_v_3189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3190, AgradDistributionTestFixture, AgradDistributionWiener_v_3190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3191, AgradDistributionTestFixture, AgradDistributionWiener_v_3191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3192, AgradDistributionTestFixture, AgradDistributionWiener_v_3192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3193, AgradDistributionTestFixture, AgradDistributionWiener_v_3193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3194, AgradDistributionTestFixture, AgradDistributionWiener_v_3194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3195, AgradDistributionTestFixture, AgradDistributionWiener_v_3195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3196, AgradDistributionTestFixture, AgradDistributionWiener_v_3196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3197, AgradDistributionTestFixture, AgradDistributionWiener_v_3197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3198, AgradDistributionTestFixture, AgradDistributionWiener_v_3198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3199, AgradDistributionTestFixture, AgradDistributionWiener_v_3199);
+
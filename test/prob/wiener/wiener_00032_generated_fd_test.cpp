@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3200;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_3201;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3202;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3203;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3204;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3205;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3206;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3207;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3208;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3209;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3210;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3211;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3212;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, double, empty> type_fd_3213;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, std::vector<double>, empty> type_fd_3214;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3215;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, fvar<double>, empty> type_fd_3216;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, empty> type_fd_3217;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3218;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, double, empty> type_fd_3219;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, empty> type_fd_3220;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3221;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, empty> type_fd_3222;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3223;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3224;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3225;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3226;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3227;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3228;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3229;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3230;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, double, empty> type_fd_3231;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, std::vector<double>, empty> type_fd_3232;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3233;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, fvar<double>, empty> type_fd_3234;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3235;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3236;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, double, empty> type_fd_3237;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3238;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3239;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3240;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3241;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3242;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3243;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3244;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3245;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3246;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3247;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3248;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, double, empty> type_fd_3249;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, empty> type_fd_3250;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3251;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, empty> type_fd_3252;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_3253;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3254;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, empty> type_fd_3255;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_3256;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3257;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_3258;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3259;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3260;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3261;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3262;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3263;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3264;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3265;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3266;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, double, empty> type_fd_3267;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_3268;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3269;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_3270;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3271;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3272;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_3273;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3274;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3275;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3276;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3277;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3278;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3279;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3280;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3281;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3282;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3283;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3284;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fd_3285;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_3286;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3287;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_3288;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_3289;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3290;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_3291;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_3292;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3293;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_3294;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3295;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3296;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3297;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3298;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3200> AgradDistributionWiener_fd_3200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3201> AgradDistributionWiener_fd_3201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3202> AgradDistributionWiener_fd_3202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3203> AgradDistributionWiener_fd_3203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3204> AgradDistributionWiener_fd_3204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3205> AgradDistributionWiener_fd_3205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3206> AgradDistributionWiener_fd_3206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3207> AgradDistributionWiener_fd_3207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3208> AgradDistributionWiener_fd_3208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3209> AgradDistributionWiener_fd_3209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3210> AgradDistributionWiener_fd_3210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3211> AgradDistributionWiener_fd_3211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3212> AgradDistributionWiener_fd_3212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3213> AgradDistributionWiener_fd_3213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3214> AgradDistributionWiener_fd_3214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3215> AgradDistributionWiener_fd_3215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3216> AgradDistributionWiener_fd_3216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3217> AgradDistributionWiener_fd_3217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3218> AgradDistributionWiener_fd_3218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3219> AgradDistributionWiener_fd_3219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3220> AgradDistributionWiener_fd_3220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3221> AgradDistributionWiener_fd_3221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3222> AgradDistributionWiener_fd_3222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3223> AgradDistributionWiener_fd_3223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3224> AgradDistributionWiener_fd_3224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3225> AgradDistributionWiener_fd_3225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3226> AgradDistributionWiener_fd_3226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3227> AgradDistributionWiener_fd_3227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3228> AgradDistributionWiener_fd_3228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3229> AgradDistributionWiener_fd_3229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3230> AgradDistributionWiener_fd_3230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3231> AgradDistributionWiener_fd_3231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3232> AgradDistributionWiener_fd_3232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3233> AgradDistributionWiener_fd_3233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3234> AgradDistributionWiener_fd_3234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3235> AgradDistributionWiener_fd_3235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3236> AgradDistributionWiener_fd_3236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3237> AgradDistributionWiener_fd_3237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3238> AgradDistributionWiener_fd_3238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3239> AgradDistributionWiener_fd_3239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3240> AgradDistributionWiener_fd_3240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3241> AgradDistributionWiener_fd_3241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3242> AgradDistributionWiener_fd_3242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3243> AgradDistributionWiener_fd_3243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3244> AgradDistributionWiener_fd_3244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3245> AgradDistributionWiener_fd_3245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3246> AgradDistributionWiener_fd_3246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3247> AgradDistributionWiener_fd_3247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3248> AgradDistributionWiener_fd_3248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3249> AgradDistributionWiener_fd_3249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3250> AgradDistributionWiener_fd_3250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3251> AgradDistributionWiener_fd_3251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3252> AgradDistributionWiener_fd_3252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3253> AgradDistributionWiener_fd_3253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3254> AgradDistributionWiener_fd_3254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3255> AgradDistributionWiener_fd_3255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3256> AgradDistributionWiener_fd_3256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3257> AgradDistributionWiener_fd_3257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3258> AgradDistributionWiener_fd_3258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3259> AgradDistributionWiener_fd_3259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3260> AgradDistributionWiener_fd_3260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3261> AgradDistributionWiener_fd_3261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3262> AgradDistributionWiener_fd_3262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3263> AgradDistributionWiener_fd_3263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3264> AgradDistributionWiener_fd_3264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3265> AgradDistributionWiener_fd_3265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3266> AgradDistributionWiener_fd_3266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3267> AgradDistributionWiener_fd_3267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3268> AgradDistributionWiener_fd_3268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3269> AgradDistributionWiener_fd_3269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3270> AgradDistributionWiener_fd_3270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3271> AgradDistributionWiener_fd_3271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3272> AgradDistributionWiener_fd_3272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3273> AgradDistributionWiener_fd_3273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3274> AgradDistributionWiener_fd_3274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3275> AgradDistributionWiener_fd_3275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3276> AgradDistributionWiener_fd_3276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3277> AgradDistributionWiener_fd_3277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3278> AgradDistributionWiener_fd_3278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3279> AgradDistributionWiener_fd_3279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3280> AgradDistributionWiener_fd_3280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3281> AgradDistributionWiener_fd_3281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3282> AgradDistributionWiener_fd_3282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3283> AgradDistributionWiener_fd_3283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3284> AgradDistributionWiener_fd_3284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3285> AgradDistributionWiener_fd_3285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3286> AgradDistributionWiener_fd_3286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3287> AgradDistributionWiener_fd_3287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3288> AgradDistributionWiener_fd_3288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3289> AgradDistributionWiener_fd_3289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3290> AgradDistributionWiener_fd_3290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3291> AgradDistributionWiener_fd_3291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3292> AgradDistributionWiener_fd_3292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3293> AgradDistributionWiener_fd_3293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3294> AgradDistributionWiener_fd_3294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3295> AgradDistributionWiener_fd_3295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3296> AgradDistributionWiener_fd_3296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3297> AgradDistributionWiener_fd_3297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3298> AgradDistributionWiener_fd_3298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3299> AgradDistributionWiener_fd_3299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3200, AgradDistributionTestFixture, AgradDistributionWiener_fd_3200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3201, AgradDistributionTestFixture, AgradDistributionWiener_fd_3201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3202, AgradDistributionTestFixture, AgradDistributionWiener_fd_3202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3203, AgradDistributionTestFixture, AgradDistributionWiener_fd_3203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3204, AgradDistributionTestFixture, AgradDistributionWiener_fd_3204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3205, AgradDistributionTestFixture, AgradDistributionWiener_fd_3205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3206, AgradDistributionTestFixture, AgradDistributionWiener_fd_3206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3207, AgradDistributionTestFixture, AgradDistributionWiener_fd_3207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3208, AgradDistributionTestFixture, AgradDistributionWiener_fd_3208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3209, AgradDistributionTestFixture, AgradDistributionWiener_fd_3209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3210, AgradDistributionTestFixture, AgradDistributionWiener_fd_3210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3211, AgradDistributionTestFixture, AgradDistributionWiener_fd_3211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3212, AgradDistributionTestFixture, AgradDistributionWiener_fd_3212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3213, AgradDistributionTestFixture, AgradDistributionWiener_fd_3213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3214, AgradDistributionTestFixture, AgradDistributionWiener_fd_3214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3215, AgradDistributionTestFixture, AgradDistributionWiener_fd_3215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3216, AgradDistributionTestFixture, AgradDistributionWiener_fd_3216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3217, AgradDistributionTestFixture, AgradDistributionWiener_fd_3217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3218, AgradDistributionTestFixture, AgradDistributionWiener_fd_3218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3219, AgradDistributionTestFixture, AgradDistributionWiener_fd_3219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3220, AgradDistributionTestFixture, AgradDistributionWiener_fd_3220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3221, AgradDistributionTestFixture, AgradDistributionWiener_fd_3221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3222, AgradDistributionTestFixture, AgradDistributionWiener_fd_3222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3223, AgradDistributionTestFixture, AgradDistributionWiener_fd_3223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3224, AgradDistributionTestFixture, AgradDistributionWiener_fd_3224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3225, AgradDistributionTestFixture, AgradDistributionWiener_fd_3225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3226, AgradDistributionTestFixture, AgradDistributionWiener_fd_3226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3227, AgradDistributionTestFixture, AgradDistributionWiener_fd_3227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3228, AgradDistributionTestFixture, AgradDistributionWiener_fd_3228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3229, AgradDistributionTestFixture, AgradDistributionWiener_fd_3229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3230, AgradDistributionTestFixture, AgradDistributionWiener_fd_3230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3231, AgradDistributionTestFixture, AgradDistributionWiener_fd_3231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3232, AgradDistributionTestFixture, AgradDistributionWiener_fd_3232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3233, AgradDistributionTestFixture, AgradDistributionWiener_fd_3233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3234, AgradDistributionTestFixture, AgradDistributionWiener_fd_3234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3235, AgradDistributionTestFixture, AgradDistributionWiener_fd_3235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3236, AgradDistributionTestFixture, AgradDistributionWiener_fd_3236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3237, AgradDistributionTestFixture, AgradDistributionWiener_fd_3237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3238, AgradDistributionTestFixture, AgradDistributionWiener_fd_3238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3239, AgradDistributionTestFixture, AgradDistributionWiener_fd_3239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3240, AgradDistributionTestFixture, AgradDistributionWiener_fd_3240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3241, AgradDistributionTestFixture, AgradDistributionWiener_fd_3241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3242, AgradDistributionTestFixture, AgradDistributionWiener_fd_3242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3243, AgradDistributionTestFixture, AgradDistributionWiener_fd_3243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3244, AgradDistributionTestFixture, AgradDistributionWiener_fd_3244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3245, AgradDistributionTestFixture, AgradDistributionWiener_fd_3245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3246, AgradDistributionTestFixture, AgradDistributionWiener_fd_3246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3247, AgradDistributionTestFixture, AgradDistributionWiener_fd_3247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3248, AgradDistributionTestFixture, AgradDistributionWiener_fd_3248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3249, AgradDistributionTestFixture, AgradDistributionWiener_fd_3249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3250, AgradDistributionTestFixture, AgradDistributionWiener_fd_3250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3251, AgradDistributionTestFixture, AgradDistributionWiener_fd_3251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3252, AgradDistributionTestFixture, AgradDistributionWiener_fd_3252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3253, AgradDistributionTestFixture, AgradDistributionWiener_fd_3253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3254, AgradDistributionTestFixture, AgradDistributionWiener_fd_3254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3255, AgradDistributionTestFixture, AgradDistributionWiener_fd_3255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3256, AgradDistributionTestFixture, AgradDistributionWiener_fd_3256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3257, AgradDistributionTestFixture, AgradDistributionWiener_fd_3257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3258, AgradDistributionTestFixture, AgradDistributionWiener_fd_3258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3259, AgradDistributionTestFixture, AgradDistributionWiener_fd_3259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3260, AgradDistributionTestFixture, AgradDistributionWiener_fd_3260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3261, AgradDistributionTestFixture, AgradDistributionWiener_fd_3261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3262, AgradDistributionTestFixture, AgradDistributionWiener_fd_3262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3263, AgradDistributionTestFixture, AgradDistributionWiener_fd_3263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3264, AgradDistributionTestFixture, AgradDistributionWiener_fd_3264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3265, AgradDistributionTestFixture, AgradDistributionWiener_fd_3265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3266, AgradDistributionTestFixture, AgradDistributionWiener_fd_3266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3267, AgradDistributionTestFixture, AgradDistributionWiener_fd_3267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3268, AgradDistributionTestFixture, AgradDistributionWiener_fd_3268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3269, AgradDistributionTestFixture, AgradDistributionWiener_fd_3269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3270, AgradDistributionTestFixture, AgradDistributionWiener_fd_3270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3271, AgradDistributionTestFixture, AgradDistributionWiener_fd_3271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3272, AgradDistributionTestFixture, AgradDistributionWiener_fd_3272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3273, AgradDistributionTestFixture, AgradDistributionWiener_fd_3273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3274, AgradDistributionTestFixture, AgradDistributionWiener_fd_3274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3275, AgradDistributionTestFixture, AgradDistributionWiener_fd_3275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3276, AgradDistributionTestFixture, AgradDistributionWiener_fd_3276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3277, AgradDistributionTestFixture, AgradDistributionWiener_fd_3277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3278, AgradDistributionTestFixture, AgradDistributionWiener_fd_3278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3279, AgradDistributionTestFixture, AgradDistributionWiener_fd_3279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3280, AgradDistributionTestFixture, AgradDistributionWiener_fd_3280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3281, AgradDistributionTestFixture, AgradDistributionWiener_fd_3281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3282, AgradDistributionTestFixture, AgradDistributionWiener_fd_3282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3283, AgradDistributionTestFixture, AgradDistributionWiener_fd_3283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3284, AgradDistributionTestFixture, AgradDistributionWiener_fd_3284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3285, AgradDistributionTestFixture, AgradDistributionWiener_fd_3285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3286, AgradDistributionTestFixture, AgradDistributionWiener_fd_3286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3287, AgradDistributionTestFixture, AgradDistributionWiener_fd_3287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3288, AgradDistributionTestFixture, AgradDistributionWiener_fd_3288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3289, AgradDistributionTestFixture, AgradDistributionWiener_fd_3289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3290, AgradDistributionTestFixture, AgradDistributionWiener_fd_3290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3291, AgradDistributionTestFixture, AgradDistributionWiener_fd_3291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3292, AgradDistributionTestFixture, AgradDistributionWiener_fd_3292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3293, AgradDistributionTestFixture, AgradDistributionWiener_fd_3293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3294, AgradDistributionTestFixture, AgradDistributionWiener_fd_3294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3295, AgradDistributionTestFixture, AgradDistributionWiener_fd_3295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3296, AgradDistributionTestFixture, AgradDistributionWiener_fd_3296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3297, AgradDistributionTestFixture, AgradDistributionWiener_fd_3297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3298, AgradDistributionTestFixture, AgradDistributionWiener_fd_3298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3299, AgradDistributionTestFixture, AgradDistributionWiener_fd_3299);
+
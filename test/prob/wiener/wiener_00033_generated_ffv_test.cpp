@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3300;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3301;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3302;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3303;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3304;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3305;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3306;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3307;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3308;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3309;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3310;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3311;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3312;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3313;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3314;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3315;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3316;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3317;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3318;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3319;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3320;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty> type_ffv_3321;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_3322;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3323;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_3324;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3325;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3326;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_3327;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_3328;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3329;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3330;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3331;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3332;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3333;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3334;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3335;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3336;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3337;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3338;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_3339;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3340;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3341;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3342;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3343;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3344;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3345;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3346;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3347;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3348;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3349;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3350;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3351;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3352;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3353;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3354;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3355;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3356;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_3357;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_3358;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3359;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_3360;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3361;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3362;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_3363;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_3364;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3365;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3366;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3367;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3368;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3369;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3370;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3371;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3372;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3373;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3374;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_3375;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3376;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3377;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3378;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3379;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3380;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3381;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3382;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3383;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3384;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3385;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3386;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3387;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3388;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3389;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3390;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3391;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3392;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3393;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3394;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3395;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3396;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3397;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3398;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3300> AgradDistributionWiener_ffv_3300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3301> AgradDistributionWiener_ffv_3301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3302> AgradDistributionWiener_ffv_3302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3303> AgradDistributionWiener_ffv_3303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3304> AgradDistributionWiener_ffv_3304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3305> AgradDistributionWiener_ffv_3305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3306> AgradDistributionWiener_ffv_3306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3307> AgradDistributionWiener_ffv_3307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3308> AgradDistributionWiener_ffv_3308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3309> AgradDistributionWiener_ffv_3309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3310> AgradDistributionWiener_ffv_3310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3311> AgradDistributionWiener_ffv_3311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3312> AgradDistributionWiener_ffv_3312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3313> AgradDistributionWiener_ffv_3313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3314> AgradDistributionWiener_ffv_3314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3315> AgradDistributionWiener_ffv_3315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3316> AgradDistributionWiener_ffv_3316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3317> AgradDistributionWiener_ffv_3317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3318> AgradDistributionWiener_ffv_3318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3319> AgradDistributionWiener_ffv_3319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3320> AgradDistributionWiener_ffv_3320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3321> AgradDistributionWiener_ffv_3321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3322> AgradDistributionWiener_ffv_3322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3323> AgradDistributionWiener_ffv_3323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3324> AgradDistributionWiener_ffv_3324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3325> AgradDistributionWiener_ffv_3325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3326> AgradDistributionWiener_ffv_3326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3327> AgradDistributionWiener_ffv_3327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3328> AgradDistributionWiener_ffv_3328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3329> AgradDistributionWiener_ffv_3329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3330> AgradDistributionWiener_ffv_3330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3331> AgradDistributionWiener_ffv_3331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3332> AgradDistributionWiener_ffv_3332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3333> AgradDistributionWiener_ffv_3333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3334> AgradDistributionWiener_ffv_3334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3335> AgradDistributionWiener_ffv_3335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3336> AgradDistributionWiener_ffv_3336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3337> AgradDistributionWiener_ffv_3337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3338> AgradDistributionWiener_ffv_3338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3339> AgradDistributionWiener_ffv_3339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3340> AgradDistributionWiener_ffv_3340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3341> AgradDistributionWiener_ffv_3341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3342> AgradDistributionWiener_ffv_3342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3343> AgradDistributionWiener_ffv_3343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3344> AgradDistributionWiener_ffv_3344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3345> AgradDistributionWiener_ffv_3345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3346> AgradDistributionWiener_ffv_3346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3347> AgradDistributionWiener_ffv_3347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3348> AgradDistributionWiener_ffv_3348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3349> AgradDistributionWiener_ffv_3349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3350> AgradDistributionWiener_ffv_3350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3351> AgradDistributionWiener_ffv_3351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3352> AgradDistributionWiener_ffv_3352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3353> AgradDistributionWiener_ffv_3353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3354> AgradDistributionWiener_ffv_3354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3355> AgradDistributionWiener_ffv_3355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3356> AgradDistributionWiener_ffv_3356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3357> AgradDistributionWiener_ffv_3357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3358> AgradDistributionWiener_ffv_3358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3359> AgradDistributionWiener_ffv_3359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3360> AgradDistributionWiener_ffv_3360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3361> AgradDistributionWiener_ffv_3361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3362> AgradDistributionWiener_ffv_3362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3363> AgradDistributionWiener_ffv_3363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3364> AgradDistributionWiener_ffv_3364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3365> AgradDistributionWiener_ffv_3365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3366> AgradDistributionWiener_ffv_3366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3367> AgradDistributionWiener_ffv_3367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3368> AgradDistributionWiener_ffv_3368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3369> AgradDistributionWiener_ffv_3369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3370> AgradDistributionWiener_ffv_3370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3371> AgradDistributionWiener_ffv_3371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3372> AgradDistributionWiener_ffv_3372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3373> AgradDistributionWiener_ffv_3373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3374> AgradDistributionWiener_ffv_3374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3375> AgradDistributionWiener_ffv_3375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3376> AgradDistributionWiener_ffv_3376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3377> AgradDistributionWiener_ffv_3377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3378> AgradDistributionWiener_ffv_3378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3379> AgradDistributionWiener_ffv_3379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3380> AgradDistributionWiener_ffv_3380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3381> AgradDistributionWiener_ffv_3381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3382> AgradDistributionWiener_ffv_3382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3383> AgradDistributionWiener_ffv_3383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3384> AgradDistributionWiener_ffv_3384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3385> AgradDistributionWiener_ffv_3385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3386> AgradDistributionWiener_ffv_3386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3387> AgradDistributionWiener_ffv_3387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3388> AgradDistributionWiener_ffv_3388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3389> AgradDistributionWiener_ffv_3389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3390> AgradDistributionWiener_ffv_3390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3391> AgradDistributionWiener_ffv_3391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3392> AgradDistributionWiener_ffv_3392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3393> AgradDistributionWiener_ffv_3393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3394> AgradDistributionWiener_ffv_3394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3395> AgradDistributionWiener_ffv_3395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3396> AgradDistributionWiener_ffv_3396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3397> AgradDistributionWiener_ffv_3397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3398> AgradDistributionWiener_ffv_3398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3399> AgradDistributionWiener_ffv_3399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3300, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3301, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3302, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3303, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3304, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3305, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3306, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3307, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3308, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3309, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3310, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3311, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3312, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3313, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3314, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3315, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3316, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3317, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3318, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3319, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3320, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3321, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3322, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3323, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3324, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3325, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3326, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3327, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3328, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3329, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3330, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3331, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3332, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3333, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3334, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3335, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3336, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3337, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3338, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3339, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3340, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3341, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3342, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3343, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3344, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3345, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3346, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3347, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3348, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3349, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3350, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3351, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3352, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3353, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3354, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3355, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3356, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3357, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3358, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3359, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3360, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3361, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3362, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3363, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3364, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3365, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3366, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3367, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3368, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3369, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3370, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3371, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3372, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3373, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3374, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3375, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3376, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3377, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3378, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3379, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3380, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3381, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3382, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3383, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3384, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3385, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3386, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3387, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3388, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3389, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3390, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3391, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3392, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3393, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3394, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3395, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3396, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3397, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3398, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3399, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_3400;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3401;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_3402;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3403;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3404;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3405;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3406;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3407;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3408;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3409;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3410;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_3411;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_3412;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3413;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_3414;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3415;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3416;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_3417;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3418;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3419;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3420;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3421;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3422;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3423;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3424;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3425;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3426;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3427;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3428;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, double, empty> type_fd_3429;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_fd_3430;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3431;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, fvar<double>, empty> type_fd_3432;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, std::vector<fvar<double>>, empty> type_fd_3433;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3434;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_fd_3435;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_fd_3436;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3437;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<double>, empty> type_fd_3438;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3439;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3440;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3441;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3442;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3443;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3444;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3445;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3446;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, double, empty> type_fd_3447;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<double>, empty> type_fd_3448;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3449;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, fvar<double>, empty> type_fd_3450;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3451;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3452;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, double, empty> type_fd_3453;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3454;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3455;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3456;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3457;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3458;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3459;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3460;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3461;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3462;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3463;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3464;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_fd_3465;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_fd_3466;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3467;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, empty> type_fd_3468;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_3469;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3470;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_fd_3471;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_3472;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3473;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_3474;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3475;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3476;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3477;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3478;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3479;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3480;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3481;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3482;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, double, empty> type_fd_3483;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_3484;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3485;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_3486;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3487;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3488;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_3489;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3490;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3491;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3492;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3493;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3494;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3495;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3496;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3497;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3498;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3400> AgradDistributionWiener_fd_3400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3401> AgradDistributionWiener_fd_3401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3402> AgradDistributionWiener_fd_3402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3403> AgradDistributionWiener_fd_3403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3404> AgradDistributionWiener_fd_3404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3405> AgradDistributionWiener_fd_3405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3406> AgradDistributionWiener_fd_3406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3407> AgradDistributionWiener_fd_3407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3408> AgradDistributionWiener_fd_3408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3409> AgradDistributionWiener_fd_3409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3410> AgradDistributionWiener_fd_3410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3411> AgradDistributionWiener_fd_3411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3412> AgradDistributionWiener_fd_3412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3413> AgradDistributionWiener_fd_3413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3414> AgradDistributionWiener_fd_3414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3415> AgradDistributionWiener_fd_3415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3416> AgradDistributionWiener_fd_3416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3417> AgradDistributionWiener_fd_3417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3418> AgradDistributionWiener_fd_3418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3419> AgradDistributionWiener_fd_3419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3420> AgradDistributionWiener_fd_3420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3421> AgradDistributionWiener_fd_3421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3422> AgradDistributionWiener_fd_3422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3423> AgradDistributionWiener_fd_3423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3424> AgradDistributionWiener_fd_3424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3425> AgradDistributionWiener_fd_3425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3426> AgradDistributionWiener_fd_3426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3427> AgradDistributionWiener_fd_3427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3428> AgradDistributionWiener_fd_3428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3429> AgradDistributionWiener_fd_3429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3430> AgradDistributionWiener_fd_3430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3431> AgradDistributionWiener_fd_3431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3432> AgradDistributionWiener_fd_3432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3433> AgradDistributionWiener_fd_3433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3434> AgradDistributionWiener_fd_3434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3435> AgradDistributionWiener_fd_3435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3436> AgradDistributionWiener_fd_3436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3437> AgradDistributionWiener_fd_3437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3438> AgradDistributionWiener_fd_3438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3439> AgradDistributionWiener_fd_3439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3440> AgradDistributionWiener_fd_3440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3441> AgradDistributionWiener_fd_3441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3442> AgradDistributionWiener_fd_3442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3443> AgradDistributionWiener_fd_3443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3444> AgradDistributionWiener_fd_3444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3445> AgradDistributionWiener_fd_3445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3446> AgradDistributionWiener_fd_3446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3447> AgradDistributionWiener_fd_3447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3448> AgradDistributionWiener_fd_3448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3449> AgradDistributionWiener_fd_3449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3450> AgradDistributionWiener_fd_3450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3451> AgradDistributionWiener_fd_3451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3452> AgradDistributionWiener_fd_3452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3453> AgradDistributionWiener_fd_3453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3454> AgradDistributionWiener_fd_3454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3455> AgradDistributionWiener_fd_3455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3456> AgradDistributionWiener_fd_3456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3457> AgradDistributionWiener_fd_3457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3458> AgradDistributionWiener_fd_3458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3459> AgradDistributionWiener_fd_3459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3460> AgradDistributionWiener_fd_3460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3461> AgradDistributionWiener_fd_3461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3462> AgradDistributionWiener_fd_3462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3463> AgradDistributionWiener_fd_3463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3464> AgradDistributionWiener_fd_3464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3465> AgradDistributionWiener_fd_3465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3466> AgradDistributionWiener_fd_3466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3467> AgradDistributionWiener_fd_3467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3468> AgradDistributionWiener_fd_3468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3469> AgradDistributionWiener_fd_3469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3470> AgradDistributionWiener_fd_3470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3471> AgradDistributionWiener_fd_3471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3472> AgradDistributionWiener_fd_3472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3473> AgradDistributionWiener_fd_3473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3474> AgradDistributionWiener_fd_3474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3475> AgradDistributionWiener_fd_3475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3476> AgradDistributionWiener_fd_3476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3477> AgradDistributionWiener_fd_3477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3478> AgradDistributionWiener_fd_3478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3479> AgradDistributionWiener_fd_3479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3480> AgradDistributionWiener_fd_3480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3481> AgradDistributionWiener_fd_3481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3482> AgradDistributionWiener_fd_3482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3483> AgradDistributionWiener_fd_3483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3484> AgradDistributionWiener_fd_3484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3485> AgradDistributionWiener_fd_3485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3486> AgradDistributionWiener_fd_3486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3487> AgradDistributionWiener_fd_3487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3488> AgradDistributionWiener_fd_3488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3489> AgradDistributionWiener_fd_3489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3490> AgradDistributionWiener_fd_3490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3491> AgradDistributionWiener_fd_3491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3492> AgradDistributionWiener_fd_3492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3493> AgradDistributionWiener_fd_3493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3494> AgradDistributionWiener_fd_3494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3495> AgradDistributionWiener_fd_3495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3496> AgradDistributionWiener_fd_3496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3497> AgradDistributionWiener_fd_3497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3498> AgradDistributionWiener_fd_3498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3499> AgradDistributionWiener_fd_3499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3400, AgradDistributionTestFixture, AgradDistributionWiener_fd_3400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3401, AgradDistributionTestFixture, AgradDistributionWiener_fd_3401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3402, AgradDistributionTestFixture, AgradDistributionWiener_fd_3402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3403, AgradDistributionTestFixture, AgradDistributionWiener_fd_3403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3404, AgradDistributionTestFixture, AgradDistributionWiener_fd_3404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3405, AgradDistributionTestFixture, AgradDistributionWiener_fd_3405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3406, AgradDistributionTestFixture, AgradDistributionWiener_fd_3406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3407, AgradDistributionTestFixture, AgradDistributionWiener_fd_3407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3408, AgradDistributionTestFixture, AgradDistributionWiener_fd_3408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3409, AgradDistributionTestFixture, AgradDistributionWiener_fd_3409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3410, AgradDistributionTestFixture, AgradDistributionWiener_fd_3410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3411, AgradDistributionTestFixture, AgradDistributionWiener_fd_3411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3412, AgradDistributionTestFixture, AgradDistributionWiener_fd_3412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3413, AgradDistributionTestFixture, AgradDistributionWiener_fd_3413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3414, AgradDistributionTestFixture, AgradDistributionWiener_fd_3414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3415, AgradDistributionTestFixture, AgradDistributionWiener_fd_3415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3416, AgradDistributionTestFixture, AgradDistributionWiener_fd_3416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3417, AgradDistributionTestFixture, AgradDistributionWiener_fd_3417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3418, AgradDistributionTestFixture, AgradDistributionWiener_fd_3418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3419, AgradDistributionTestFixture, AgradDistributionWiener_fd_3419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3420, AgradDistributionTestFixture, AgradDistributionWiener_fd_3420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3421, AgradDistributionTestFixture, AgradDistributionWiener_fd_3421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3422, AgradDistributionTestFixture, AgradDistributionWiener_fd_3422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3423, AgradDistributionTestFixture, AgradDistributionWiener_fd_3423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3424, AgradDistributionTestFixture, AgradDistributionWiener_fd_3424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3425, AgradDistributionTestFixture, AgradDistributionWiener_fd_3425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3426, AgradDistributionTestFixture, AgradDistributionWiener_fd_3426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3427, AgradDistributionTestFixture, AgradDistributionWiener_fd_3427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3428, AgradDistributionTestFixture, AgradDistributionWiener_fd_3428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3429, AgradDistributionTestFixture, AgradDistributionWiener_fd_3429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3430, AgradDistributionTestFixture, AgradDistributionWiener_fd_3430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3431, AgradDistributionTestFixture, AgradDistributionWiener_fd_3431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3432, AgradDistributionTestFixture, AgradDistributionWiener_fd_3432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3433, AgradDistributionTestFixture, AgradDistributionWiener_fd_3433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3434, AgradDistributionTestFixture, AgradDistributionWiener_fd_3434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3435, AgradDistributionTestFixture, AgradDistributionWiener_fd_3435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3436, AgradDistributionTestFixture, AgradDistributionWiener_fd_3436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3437, AgradDistributionTestFixture, AgradDistributionWiener_fd_3437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3438, AgradDistributionTestFixture, AgradDistributionWiener_fd_3438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3439, AgradDistributionTestFixture, AgradDistributionWiener_fd_3439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3440, AgradDistributionTestFixture, AgradDistributionWiener_fd_3440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3441, AgradDistributionTestFixture, AgradDistributionWiener_fd_3441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3442, AgradDistributionTestFixture, AgradDistributionWiener_fd_3442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3443, AgradDistributionTestFixture, AgradDistributionWiener_fd_3443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3444, AgradDistributionTestFixture, AgradDistributionWiener_fd_3444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3445, AgradDistributionTestFixture, AgradDistributionWiener_fd_3445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3446, AgradDistributionTestFixture, AgradDistributionWiener_fd_3446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3447, AgradDistributionTestFixture, AgradDistributionWiener_fd_3447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3448, AgradDistributionTestFixture, AgradDistributionWiener_fd_3448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3449, AgradDistributionTestFixture, AgradDistributionWiener_fd_3449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3450, AgradDistributionTestFixture, AgradDistributionWiener_fd_3450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3451, AgradDistributionTestFixture, AgradDistributionWiener_fd_3451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3452, AgradDistributionTestFixture, AgradDistributionWiener_fd_3452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3453, AgradDistributionTestFixture, AgradDistributionWiener_fd_3453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3454, AgradDistributionTestFixture, AgradDistributionWiener_fd_3454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3455, AgradDistributionTestFixture, AgradDistributionWiener_fd_3455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3456, AgradDistributionTestFixture, AgradDistributionWiener_fd_3456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3457, AgradDistributionTestFixture, AgradDistributionWiener_fd_3457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3458, AgradDistributionTestFixture, AgradDistributionWiener_fd_3458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3459, AgradDistributionTestFixture, AgradDistributionWiener_fd_3459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3460, AgradDistributionTestFixture, AgradDistributionWiener_fd_3460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3461, AgradDistributionTestFixture, AgradDistributionWiener_fd_3461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3462, AgradDistributionTestFixture, AgradDistributionWiener_fd_3462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3463, AgradDistributionTestFixture, AgradDistributionWiener_fd_3463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3464, AgradDistributionTestFixture, AgradDistributionWiener_fd_3464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3465, AgradDistributionTestFixture, AgradDistributionWiener_fd_3465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3466, AgradDistributionTestFixture, AgradDistributionWiener_fd_3466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3467, AgradDistributionTestFixture, AgradDistributionWiener_fd_3467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3468, AgradDistributionTestFixture, AgradDistributionWiener_fd_3468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3469, AgradDistributionTestFixture, AgradDistributionWiener_fd_3469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3470, AgradDistributionTestFixture, AgradDistributionWiener_fd_3470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3471, AgradDistributionTestFixture, AgradDistributionWiener_fd_3471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3472, AgradDistributionTestFixture, AgradDistributionWiener_fd_3472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3473, AgradDistributionTestFixture, AgradDistributionWiener_fd_3473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3474, AgradDistributionTestFixture, AgradDistributionWiener_fd_3474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3475, AgradDistributionTestFixture, AgradDistributionWiener_fd_3475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3476, AgradDistributionTestFixture, AgradDistributionWiener_fd_3476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3477, AgradDistributionTestFixture, AgradDistributionWiener_fd_3477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3478, AgradDistributionTestFixture, AgradDistributionWiener_fd_3478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3479, AgradDistributionTestFixture, AgradDistributionWiener_fd_3479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3480, AgradDistributionTestFixture, AgradDistributionWiener_fd_3480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3481, AgradDistributionTestFixture, AgradDistributionWiener_fd_3481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3482, AgradDistributionTestFixture, AgradDistributionWiener_fd_3482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3483, AgradDistributionTestFixture, AgradDistributionWiener_fd_3483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3484, AgradDistributionTestFixture, AgradDistributionWiener_fd_3484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3485, AgradDistributionTestFixture, AgradDistributionWiener_fd_3485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3486, AgradDistributionTestFixture, AgradDistributionWiener_fd_3486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3487, AgradDistributionTestFixture, AgradDistributionWiener_fd_3487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3488, AgradDistributionTestFixture, AgradDistributionWiener_fd_3488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3489, AgradDistributionTestFixture, AgradDistributionWiener_fd_3489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3490, AgradDistributionTestFixture, AgradDistributionWiener_fd_3490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3491, AgradDistributionTestFixture, AgradDistributionWiener_fd_3491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3492, AgradDistributionTestFixture, AgradDistributionWiener_fd_3492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3493, AgradDistributionTestFixture, AgradDistributionWiener_fd_3493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3494, AgradDistributionTestFixture, AgradDistributionWiener_fd_3494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3495, AgradDistributionTestFixture, AgradDistributionWiener_fd_3495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3496, AgradDistributionTestFixture, AgradDistributionWiener_fd_3496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3497, AgradDistributionTestFixture, AgradDistributionWiener_fd_3497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3498, AgradDistributionTestFixture, AgradDistributionWiener_fd_3498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3499, AgradDistributionTestFixture, AgradDistributionWiener_fd_3499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3500;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3501;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3502;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3503;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3504;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3505;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3506;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3507;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_3508;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3509;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3510;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3511;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3512;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3513;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3514;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3515;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3516;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3517;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3518;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3519;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3520;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3521;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3522;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3523;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3524;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3525;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3526;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3527;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3528;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3529;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3530;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3531;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3532;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3533;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3534;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3535;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3536;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty> type_ffv_3537;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_3538;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3539;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_3540;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3541;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3542;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_3543;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_3544;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3545;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3546;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3547;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3548;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3549;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3550;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3551;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3552;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3553;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3554;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_3555;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3556;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3557;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3558;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3559;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3560;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3561;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3562;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3563;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3564;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3565;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3566;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3567;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3568;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3569;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3570;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3571;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3572;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_3573;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_3574;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3575;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_3576;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3577;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3578;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_3579;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_3580;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3581;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3582;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3583;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3584;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3585;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3586;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3587;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3588;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3589;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3590;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_3591;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3592;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3593;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3594;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3595;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3596;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3597;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3598;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3500> AgradDistributionWiener_ffv_3500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3501> AgradDistributionWiener_ffv_3501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3502> AgradDistributionWiener_ffv_3502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3503> AgradDistributionWiener_ffv_3503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3504> AgradDistributionWiener_ffv_3504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3505> AgradDistributionWiener_ffv_3505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3506> AgradDistributionWiener_ffv_3506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3507> AgradDistributionWiener_ffv_3507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3508> AgradDistributionWiener_ffv_3508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3509> AgradDistributionWiener_ffv_3509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3510> AgradDistributionWiener_ffv_3510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3511> AgradDistributionWiener_ffv_3511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3512> AgradDistributionWiener_ffv_3512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3513> AgradDistributionWiener_ffv_3513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3514> AgradDistributionWiener_ffv_3514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3515> AgradDistributionWiener_ffv_3515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3516> AgradDistributionWiener_ffv_3516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3517> AgradDistributionWiener_ffv_3517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3518> AgradDistributionWiener_ffv_3518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3519> AgradDistributionWiener_ffv_3519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3520> AgradDistributionWiener_ffv_3520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3521> AgradDistributionWiener_ffv_3521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3522> AgradDistributionWiener_ffv_3522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3523> AgradDistributionWiener_ffv_3523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3524> AgradDistributionWiener_ffv_3524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3525> AgradDistributionWiener_ffv_3525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3526> AgradDistributionWiener_ffv_3526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3527> AgradDistributionWiener_ffv_3527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3528> AgradDistributionWiener_ffv_3528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3529> AgradDistributionWiener_ffv_3529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3530> AgradDistributionWiener_ffv_3530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3531> AgradDistributionWiener_ffv_3531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3532> AgradDistributionWiener_ffv_3532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3533> AgradDistributionWiener_ffv_3533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3534> AgradDistributionWiener_ffv_3534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3535> AgradDistributionWiener_ffv_3535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3536> AgradDistributionWiener_ffv_3536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3537> AgradDistributionWiener_ffv_3537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3538> AgradDistributionWiener_ffv_3538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3539> AgradDistributionWiener_ffv_3539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3540> AgradDistributionWiener_ffv_3540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3541> AgradDistributionWiener_ffv_3541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3542> AgradDistributionWiener_ffv_3542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3543> AgradDistributionWiener_ffv_3543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3544> AgradDistributionWiener_ffv_3544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3545> AgradDistributionWiener_ffv_3545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3546> AgradDistributionWiener_ffv_3546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3547> AgradDistributionWiener_ffv_3547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3548> AgradDistributionWiener_ffv_3548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3549> AgradDistributionWiener_ffv_3549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3550> AgradDistributionWiener_ffv_3550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3551> AgradDistributionWiener_ffv_3551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3552> AgradDistributionWiener_ffv_3552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3553> AgradDistributionWiener_ffv_3553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3554> AgradDistributionWiener_ffv_3554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3555> AgradDistributionWiener_ffv_3555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3556> AgradDistributionWiener_ffv_3556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3557> AgradDistributionWiener_ffv_3557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3558> AgradDistributionWiener_ffv_3558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3559> AgradDistributionWiener_ffv_3559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3560> AgradDistributionWiener_ffv_3560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3561> AgradDistributionWiener_ffv_3561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3562> AgradDistributionWiener_ffv_3562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3563> AgradDistributionWiener_ffv_3563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3564> AgradDistributionWiener_ffv_3564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3565> AgradDistributionWiener_ffv_3565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3566> AgradDistributionWiener_ffv_3566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3567> AgradDistributionWiener_ffv_3567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3568> AgradDistributionWiener_ffv_3568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3569> AgradDistributionWiener_ffv_3569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3570> AgradDistributionWiener_ffv_3570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3571> AgradDistributionWiener_ffv_3571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3572> AgradDistributionWiener_ffv_3572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3573> AgradDistributionWiener_ffv_3573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3574> AgradDistributionWiener_ffv_3574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3575> AgradDistributionWiener_ffv_3575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3576> AgradDistributionWiener_ffv_3576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3577> AgradDistributionWiener_ffv_3577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3578> AgradDistributionWiener_ffv_3578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3579> AgradDistributionWiener_ffv_3579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3580> AgradDistributionWiener_ffv_3580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3581> AgradDistributionWiener_ffv_3581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3582> AgradDistributionWiener_ffv_3582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3583> AgradDistributionWiener_ffv_3583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3584> AgradDistributionWiener_ffv_3584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3585> AgradDistributionWiener_ffv_3585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3586> AgradDistributionWiener_ffv_3586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3587> AgradDistributionWiener_ffv_3587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3588> AgradDistributionWiener_ffv_3588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3589> AgradDistributionWiener_ffv_3589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3590> AgradDistributionWiener_ffv_3590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3591> AgradDistributionWiener_ffv_3591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3592> AgradDistributionWiener_ffv_3592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3593> AgradDistributionWiener_ffv_3593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3594> AgradDistributionWiener_ffv_3594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3595> AgradDistributionWiener_ffv_3595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3596> AgradDistributionWiener_ffv_3596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3597> AgradDistributionWiener_ffv_3597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3598> AgradDistributionWiener_ffv_3598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3599> AgradDistributionWiener_ffv_3599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3500, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3501, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3502, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3503, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3504, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3505, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3506, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3507, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3508, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3509, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3510, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3511, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3512, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3513, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3514, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3515, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3516, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3517, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3518, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3519, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3520, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3521, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3522, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3523, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3524, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3525, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3526, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3527, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3528, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3529, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3530, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3531, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3532, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3533, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3534, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3535, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3536, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3537, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3538, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3539, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3540, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3541, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3542, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3543, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3544, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3545, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3546, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3547, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3548, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3549, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3550, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3551, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3552, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3553, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3554, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3555, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3556, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3557, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3558, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3559, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3560, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3561, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3562, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3563, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3564, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3565, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3566, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3567, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3568, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3569, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3570, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3571, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3572, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3573, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3574, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3575, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3576, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3577, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3578, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3579, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3580, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3581, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3582, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3583, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3584, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3585, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3586, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3587, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3588, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3589, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3590, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3591, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3592, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3593, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3594, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3595, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3596, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3597, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3598, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3599, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3600;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3601;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3602;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3603;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3604;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3605;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3606;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3607;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3608;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3609;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3610;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3611;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3612;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3613;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3614;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3615;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_3616;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3617;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3618;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3619;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3620;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3621;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3622;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3623;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3624;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3625;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3626;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3627;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3628;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3629;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3630;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3631;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3632;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3633;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3634;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3635;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3636;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3637;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3638;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3639;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3640;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3641;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3642;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3643;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3644;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, double, double, empty> type_ffv_3645;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, double, std::vector<double>, empty> type_ffv_3646;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3647;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, double, fvar<fvar<var> >, empty> type_ffv_3648;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3649;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3650;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<double>, double, empty> type_ffv_3651;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<double>, std::vector<double>, empty> type_ffv_3652;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3653;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3654;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3655;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3656;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3657;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3658;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3659;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3660;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3661;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3662;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, fvar<fvar<var> >, double, empty> type_ffv_3663;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3664;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3665;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3666;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3667;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3668;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3669;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3670;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3671;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3672;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3673;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3674;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3675;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3676;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3677;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3678;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3679;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3680;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, double, double, empty> type_ffv_3681;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, double, std::vector<double>, empty> type_ffv_3682;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3683;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_3684;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3685;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3686;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, double, empty> type_ffv_3687;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_3688;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3689;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3690;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3691;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3692;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3693;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3694;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3695;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3696;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3697;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3698;
+typedef boost::mpl::vector<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_3699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3600> AgradDistributionWiener_ffv_3600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3601> AgradDistributionWiener_ffv_3601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3602> AgradDistributionWiener_ffv_3602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3603> AgradDistributionWiener_ffv_3603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3604> AgradDistributionWiener_ffv_3604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3605> AgradDistributionWiener_ffv_3605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3606> AgradDistributionWiener_ffv_3606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3607> AgradDistributionWiener_ffv_3607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3608> AgradDistributionWiener_ffv_3608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3609> AgradDistributionWiener_ffv_3609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3610> AgradDistributionWiener_ffv_3610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3611> AgradDistributionWiener_ffv_3611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3612> AgradDistributionWiener_ffv_3612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3613> AgradDistributionWiener_ffv_3613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3614> AgradDistributionWiener_ffv_3614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3615> AgradDistributionWiener_ffv_3615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3616> AgradDistributionWiener_ffv_3616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3617> AgradDistributionWiener_ffv_3617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3618> AgradDistributionWiener_ffv_3618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3619> AgradDistributionWiener_ffv_3619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3620> AgradDistributionWiener_ffv_3620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3621> AgradDistributionWiener_ffv_3621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3622> AgradDistributionWiener_ffv_3622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3623> AgradDistributionWiener_ffv_3623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3624> AgradDistributionWiener_ffv_3624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3625> AgradDistributionWiener_ffv_3625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3626> AgradDistributionWiener_ffv_3626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3627> AgradDistributionWiener_ffv_3627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3628> AgradDistributionWiener_ffv_3628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3629> AgradDistributionWiener_ffv_3629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3630> AgradDistributionWiener_ffv_3630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3631> AgradDistributionWiener_ffv_3631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3632> AgradDistributionWiener_ffv_3632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3633> AgradDistributionWiener_ffv_3633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3634> AgradDistributionWiener_ffv_3634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3635> AgradDistributionWiener_ffv_3635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3636> AgradDistributionWiener_ffv_3636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3637> AgradDistributionWiener_ffv_3637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3638> AgradDistributionWiener_ffv_3638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3639> AgradDistributionWiener_ffv_3639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3640> AgradDistributionWiener_ffv_3640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3641> AgradDistributionWiener_ffv_3641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3642> AgradDistributionWiener_ffv_3642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3643> AgradDistributionWiener_ffv_3643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3644> AgradDistributionWiener_ffv_3644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3645> AgradDistributionWiener_ffv_3645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3646> AgradDistributionWiener_ffv_3646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3647> AgradDistributionWiener_ffv_3647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3648> AgradDistributionWiener_ffv_3648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3649> AgradDistributionWiener_ffv_3649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3650> AgradDistributionWiener_ffv_3650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3651> AgradDistributionWiener_ffv_3651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3652> AgradDistributionWiener_ffv_3652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3653> AgradDistributionWiener_ffv_3653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3654> AgradDistributionWiener_ffv_3654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3655> AgradDistributionWiener_ffv_3655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3656> AgradDistributionWiener_ffv_3656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3657> AgradDistributionWiener_ffv_3657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3658> AgradDistributionWiener_ffv_3658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3659> AgradDistributionWiener_ffv_3659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3660> AgradDistributionWiener_ffv_3660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3661> AgradDistributionWiener_ffv_3661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3662> AgradDistributionWiener_ffv_3662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3663> AgradDistributionWiener_ffv_3663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3664> AgradDistributionWiener_ffv_3664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3665> AgradDistributionWiener_ffv_3665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3666> AgradDistributionWiener_ffv_3666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3667> AgradDistributionWiener_ffv_3667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3668> AgradDistributionWiener_ffv_3668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3669> AgradDistributionWiener_ffv_3669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3670> AgradDistributionWiener_ffv_3670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3671> AgradDistributionWiener_ffv_3671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3672> AgradDistributionWiener_ffv_3672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3673> AgradDistributionWiener_ffv_3673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3674> AgradDistributionWiener_ffv_3674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3675> AgradDistributionWiener_ffv_3675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3676> AgradDistributionWiener_ffv_3676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3677> AgradDistributionWiener_ffv_3677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3678> AgradDistributionWiener_ffv_3678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3679> AgradDistributionWiener_ffv_3679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3680> AgradDistributionWiener_ffv_3680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3681> AgradDistributionWiener_ffv_3681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3682> AgradDistributionWiener_ffv_3682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3683> AgradDistributionWiener_ffv_3683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3684> AgradDistributionWiener_ffv_3684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3685> AgradDistributionWiener_ffv_3685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3686> AgradDistributionWiener_ffv_3686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3687> AgradDistributionWiener_ffv_3687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3688> AgradDistributionWiener_ffv_3688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3689> AgradDistributionWiener_ffv_3689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3690> AgradDistributionWiener_ffv_3690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3691> AgradDistributionWiener_ffv_3691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3692> AgradDistributionWiener_ffv_3692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3693> AgradDistributionWiener_ffv_3693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3694> AgradDistributionWiener_ffv_3694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3695> AgradDistributionWiener_ffv_3695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3696> AgradDistributionWiener_ffv_3696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3697> AgradDistributionWiener_ffv_3697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3698> AgradDistributionWiener_ffv_3698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_3699> AgradDistributionWiener_ffv_3699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3600, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3601, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3602, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3603, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3604, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3605, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3606, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3607, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3608, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3609, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3610, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3611, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3612, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3613, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3614, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3615, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3616, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3617, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3618, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3619, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3620, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3621, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3622, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3623, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3624, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3625, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3626, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3627, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3628, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3629, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3630, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3631, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3632, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3633, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3634, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3635, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3636, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3637, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3638, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3639, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3640, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3641, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3642, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3643, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3644, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3645, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3646, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3647, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3648, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3649, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3650, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3651, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3652, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3653, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3654, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3655, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3656, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3657, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3658, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3659, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3660, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3661, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3662, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3663, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3664, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3665, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3666, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3667, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3668, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3669, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3670, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3671, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3672, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3673, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3674, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3675, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3676, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3677, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3678, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3679, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3680, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3681, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3682, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3683, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3684, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3685, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3686, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3687, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3688, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3689, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3690, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3691, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3692, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3693, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3694, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3695, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3696, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3697, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3698, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_3699, AgradDistributionTestFixture, AgradDistributionWiener_ffv_3699);
+
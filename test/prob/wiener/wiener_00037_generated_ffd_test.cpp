@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_3700;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3701;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_3702;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_3703;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3704;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_3705;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_3706;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3707;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_3708;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3709;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3710;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_3711;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_3712;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3713;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_3714;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3715;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3716;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_3717;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_3718;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3719;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_3720;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_3721;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3722;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_3723;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_3724;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3725;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_3726;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3727;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3728;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_3729;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_3730;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3731;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_3732;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3733;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3734;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_3735;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_3736;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3737;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_3738;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_3739;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3740;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_3741;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_3742;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3743;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_3744;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3745;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3746;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_3747;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_3748;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3749;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_3750;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3751;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3752;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, double, double, empty> type_ffd_3753;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_3754;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3755;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_3756;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_3757;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3758;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_3759;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_3760;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3761;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_3762;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3763;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3764;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_3765;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_3766;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3767;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_3768;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3769;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3770;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_3771;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_3772;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3773;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_3774;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_3775;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3776;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_3777;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_3778;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3779;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_3780;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3781;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3782;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_3783;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_3784;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3785;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_3786;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3787;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3788;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_3789;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_3790;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3791;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_3792;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_3793;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_3794;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_3795;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_3796;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_3797;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_3798;
+typedef boost::mpl::vector<fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_3799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3700> AgradDistributionWiener_ffd_3700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3701> AgradDistributionWiener_ffd_3701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3702> AgradDistributionWiener_ffd_3702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3703> AgradDistributionWiener_ffd_3703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3704> AgradDistributionWiener_ffd_3704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3705> AgradDistributionWiener_ffd_3705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3706> AgradDistributionWiener_ffd_3706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3707> AgradDistributionWiener_ffd_3707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3708> AgradDistributionWiener_ffd_3708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3709> AgradDistributionWiener_ffd_3709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3710> AgradDistributionWiener_ffd_3710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3711> AgradDistributionWiener_ffd_3711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3712> AgradDistributionWiener_ffd_3712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3713> AgradDistributionWiener_ffd_3713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3714> AgradDistributionWiener_ffd_3714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3715> AgradDistributionWiener_ffd_3715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3716> AgradDistributionWiener_ffd_3716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3717> AgradDistributionWiener_ffd_3717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3718> AgradDistributionWiener_ffd_3718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3719> AgradDistributionWiener_ffd_3719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3720> AgradDistributionWiener_ffd_3720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3721> AgradDistributionWiener_ffd_3721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3722> AgradDistributionWiener_ffd_3722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3723> AgradDistributionWiener_ffd_3723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3724> AgradDistributionWiener_ffd_3724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3725> AgradDistributionWiener_ffd_3725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3726> AgradDistributionWiener_ffd_3726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3727> AgradDistributionWiener_ffd_3727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3728> AgradDistributionWiener_ffd_3728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3729> AgradDistributionWiener_ffd_3729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3730> AgradDistributionWiener_ffd_3730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3731> AgradDistributionWiener_ffd_3731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3732> AgradDistributionWiener_ffd_3732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3733> AgradDistributionWiener_ffd_3733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3734> AgradDistributionWiener_ffd_3734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3735> AgradDistributionWiener_ffd_3735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3736> AgradDistributionWiener_ffd_3736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3737> AgradDistributionWiener_ffd_3737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3738> AgradDistributionWiener_ffd_3738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3739> AgradDistributionWiener_ffd_3739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3740> AgradDistributionWiener_ffd_3740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3741> AgradDistributionWiener_ffd_3741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3742> AgradDistributionWiener_ffd_3742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3743> AgradDistributionWiener_ffd_3743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3744> AgradDistributionWiener_ffd_3744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3745> AgradDistributionWiener_ffd_3745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3746> AgradDistributionWiener_ffd_3746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3747> AgradDistributionWiener_ffd_3747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3748> AgradDistributionWiener_ffd_3748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3749> AgradDistributionWiener_ffd_3749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3750> AgradDistributionWiener_ffd_3750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3751> AgradDistributionWiener_ffd_3751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3752> AgradDistributionWiener_ffd_3752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3753> AgradDistributionWiener_ffd_3753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3754> AgradDistributionWiener_ffd_3754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3755> AgradDistributionWiener_ffd_3755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3756> AgradDistributionWiener_ffd_3756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3757> AgradDistributionWiener_ffd_3757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3758> AgradDistributionWiener_ffd_3758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3759> AgradDistributionWiener_ffd_3759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3760> AgradDistributionWiener_ffd_3760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3761> AgradDistributionWiener_ffd_3761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3762> AgradDistributionWiener_ffd_3762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3763> AgradDistributionWiener_ffd_3763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3764> AgradDistributionWiener_ffd_3764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3765> AgradDistributionWiener_ffd_3765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3766> AgradDistributionWiener_ffd_3766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3767> AgradDistributionWiener_ffd_3767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3768> AgradDistributionWiener_ffd_3768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3769> AgradDistributionWiener_ffd_3769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3770> AgradDistributionWiener_ffd_3770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3771> AgradDistributionWiener_ffd_3771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3772> AgradDistributionWiener_ffd_3772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3773> AgradDistributionWiener_ffd_3773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3774> AgradDistributionWiener_ffd_3774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3775> AgradDistributionWiener_ffd_3775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3776> AgradDistributionWiener_ffd_3776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3777> AgradDistributionWiener_ffd_3777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3778> AgradDistributionWiener_ffd_3778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3779> AgradDistributionWiener_ffd_3779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3780> AgradDistributionWiener_ffd_3780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3781> AgradDistributionWiener_ffd_3781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3782> AgradDistributionWiener_ffd_3782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3783> AgradDistributionWiener_ffd_3783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3784> AgradDistributionWiener_ffd_3784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3785> AgradDistributionWiener_ffd_3785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3786> AgradDistributionWiener_ffd_3786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3787> AgradDistributionWiener_ffd_3787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3788> AgradDistributionWiener_ffd_3788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3789> AgradDistributionWiener_ffd_3789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3790> AgradDistributionWiener_ffd_3790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3791> AgradDistributionWiener_ffd_3791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3792> AgradDistributionWiener_ffd_3792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3793> AgradDistributionWiener_ffd_3793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3794> AgradDistributionWiener_ffd_3794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3795> AgradDistributionWiener_ffd_3795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3796> AgradDistributionWiener_ffd_3796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3797> AgradDistributionWiener_ffd_3797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3798> AgradDistributionWiener_ffd_3798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_3799> AgradDistributionWiener_ffd_3799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3700, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3701, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3702, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3703, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3704, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3705, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3706, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3707, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3708, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3709, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3710, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3711, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3712, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3713, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3714, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3715, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3716, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3717, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3718, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3719, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3720, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3721, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3722, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3723, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3724, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3725, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3726, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3727, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3728, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3729, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3730, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3731, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3732, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3733, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3734, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3735, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3736, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3737, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3738, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3739, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3740, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3741, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3742, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3743, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3744, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3745, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3746, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3747, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3748, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3749, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3750, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3751, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3752, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3753, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3754, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3755, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3756, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3757, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3758, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3759, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3760, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3761, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3762, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3763, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3764, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3765, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3766, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3767, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3768, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3769, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3770, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3771, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3772, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3773, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3774, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3775, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3776, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3777, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3778, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3779, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3780, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3781, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3782, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3783, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3784, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3785, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3786, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3787, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3788, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3789, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3790, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3791, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3792, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3793, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3794, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3795, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3796, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3797, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3798, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_3799, AgradDistributionTestFixture, AgradDistributionWiener_ffd_3799);
+
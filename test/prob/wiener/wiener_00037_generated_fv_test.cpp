@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_3700;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3701;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_3702;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_3703;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3704;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_3705;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_3706;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3707;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_3708;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_3709;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3710;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_3711;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_3712;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3713;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_3714;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_3715;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3716;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_3717;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_3718;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3719;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_3720;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_3721;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3722;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_3723;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_3724;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3725;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_3726;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_3727;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3728;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_3729;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_3730;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3731;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_3732;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_3733;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3734;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_3735;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_3736;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3737;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_3738;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_3739;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3740;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_3741;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_3742;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3743;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_3744;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_3745;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3746;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_3747;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_3748;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3749;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_3750;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_3751;
+typedef boost::mpl::vector<fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3752;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, double, double, empty> type_fv_3753;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, double, std::vector<double>, empty> type_fv_3754;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3755;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, double, fvar<var>, empty> type_fv_3756;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_3757;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3758;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<double>, double, empty> type_fv_3759;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_3760;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3761;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_3762;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_3763;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3764;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_3765;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_3766;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3767;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_3768;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_3769;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3770;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, fvar<var>, double, empty> type_fv_3771;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_3772;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3773;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_3774;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_3775;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3776;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_3777;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_3778;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3779;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_3780;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_3781;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3782;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_3783;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_3784;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3785;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_3786;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_3787;
+typedef boost::mpl::vector<fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3788;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, double, double, empty> type_fv_3789;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_3790;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3791;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_3792;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_3793;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_3794;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_3795;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_3796;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_3797;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_3798;
+typedef boost::mpl::vector<fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_3799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3700> AgradDistributionWiener_fv_3700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3701> AgradDistributionWiener_fv_3701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3702> AgradDistributionWiener_fv_3702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3703> AgradDistributionWiener_fv_3703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3704> AgradDistributionWiener_fv_3704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3705> AgradDistributionWiener_fv_3705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3706> AgradDistributionWiener_fv_3706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3707> AgradDistributionWiener_fv_3707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3708> AgradDistributionWiener_fv_3708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3709> AgradDistributionWiener_fv_3709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3710> AgradDistributionWiener_fv_3710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3711> AgradDistributionWiener_fv_3711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3712> AgradDistributionWiener_fv_3712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3713> AgradDistributionWiener_fv_3713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3714> AgradDistributionWiener_fv_3714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3715> AgradDistributionWiener_fv_3715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3716> AgradDistributionWiener_fv_3716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3717> AgradDistributionWiener_fv_3717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3718> AgradDistributionWiener_fv_3718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3719> AgradDistributionWiener_fv_3719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3720> AgradDistributionWiener_fv_3720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3721> AgradDistributionWiener_fv_3721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3722> AgradDistributionWiener_fv_3722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3723> AgradDistributionWiener_fv_3723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3724> AgradDistributionWiener_fv_3724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3725> AgradDistributionWiener_fv_3725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3726> AgradDistributionWiener_fv_3726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3727> AgradDistributionWiener_fv_3727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3728> AgradDistributionWiener_fv_3728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3729> AgradDistributionWiener_fv_3729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3730> AgradDistributionWiener_fv_3730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3731> AgradDistributionWiener_fv_3731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3732> AgradDistributionWiener_fv_3732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3733> AgradDistributionWiener_fv_3733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3734> AgradDistributionWiener_fv_3734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3735> AgradDistributionWiener_fv_3735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3736> AgradDistributionWiener_fv_3736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3737> AgradDistributionWiener_fv_3737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3738> AgradDistributionWiener_fv_3738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3739> AgradDistributionWiener_fv_3739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3740> AgradDistributionWiener_fv_3740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3741> AgradDistributionWiener_fv_3741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3742> AgradDistributionWiener_fv_3742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3743> AgradDistributionWiener_fv_3743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3744> AgradDistributionWiener_fv_3744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3745> AgradDistributionWiener_fv_3745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3746> AgradDistributionWiener_fv_3746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3747> AgradDistributionWiener_fv_3747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3748> AgradDistributionWiener_fv_3748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3749> AgradDistributionWiener_fv_3749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3750> AgradDistributionWiener_fv_3750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3751> AgradDistributionWiener_fv_3751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3752> AgradDistributionWiener_fv_3752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3753> AgradDistributionWiener_fv_3753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3754> AgradDistributionWiener_fv_3754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3755> AgradDistributionWiener_fv_3755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3756> AgradDistributionWiener_fv_3756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3757> AgradDistributionWiener_fv_3757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3758> AgradDistributionWiener_fv_3758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3759> AgradDistributionWiener_fv_3759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3760> AgradDistributionWiener_fv_3760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3761> AgradDistributionWiener_fv_3761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3762> AgradDistributionWiener_fv_3762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3763> AgradDistributionWiener_fv_3763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3764> AgradDistributionWiener_fv_3764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3765> AgradDistributionWiener_fv_3765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3766> AgradDistributionWiener_fv_3766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3767> AgradDistributionWiener_fv_3767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3768> AgradDistributionWiener_fv_3768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3769> AgradDistributionWiener_fv_3769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3770> AgradDistributionWiener_fv_3770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3771> AgradDistributionWiener_fv_3771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3772> AgradDistributionWiener_fv_3772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3773> AgradDistributionWiener_fv_3773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3774> AgradDistributionWiener_fv_3774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3775> AgradDistributionWiener_fv_3775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3776> AgradDistributionWiener_fv_3776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3777> AgradDistributionWiener_fv_3777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3778> AgradDistributionWiener_fv_3778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3779> AgradDistributionWiener_fv_3779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3780> AgradDistributionWiener_fv_3780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3781> AgradDistributionWiener_fv_3781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3782> AgradDistributionWiener_fv_3782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3783> AgradDistributionWiener_fv_3783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3784> AgradDistributionWiener_fv_3784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3785> AgradDistributionWiener_fv_3785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3786> AgradDistributionWiener_fv_3786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3787> AgradDistributionWiener_fv_3787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3788> AgradDistributionWiener_fv_3788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3789> AgradDistributionWiener_fv_3789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3790> AgradDistributionWiener_fv_3790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3791> AgradDistributionWiener_fv_3791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3792> AgradDistributionWiener_fv_3792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3793> AgradDistributionWiener_fv_3793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3794> AgradDistributionWiener_fv_3794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3795> AgradDistributionWiener_fv_3795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3796> AgradDistributionWiener_fv_3796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3797> AgradDistributionWiener_fv_3797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3798> AgradDistributionWiener_fv_3798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_3799> AgradDistributionWiener_fv_3799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3700, AgradDistributionTestFixture, AgradDistributionWiener_fv_3700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3701, AgradDistributionTestFixture, AgradDistributionWiener_fv_3701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3702, AgradDistributionTestFixture, AgradDistributionWiener_fv_3702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3703, AgradDistributionTestFixture, AgradDistributionWiener_fv_3703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3704, AgradDistributionTestFixture, AgradDistributionWiener_fv_3704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3705, AgradDistributionTestFixture, AgradDistributionWiener_fv_3705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3706, AgradDistributionTestFixture, AgradDistributionWiener_fv_3706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3707, AgradDistributionTestFixture, AgradDistributionWiener_fv_3707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3708, AgradDistributionTestFixture, AgradDistributionWiener_fv_3708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3709, AgradDistributionTestFixture, AgradDistributionWiener_fv_3709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3710, AgradDistributionTestFixture, AgradDistributionWiener_fv_3710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3711, AgradDistributionTestFixture, AgradDistributionWiener_fv_3711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3712, AgradDistributionTestFixture, AgradDistributionWiener_fv_3712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3713, AgradDistributionTestFixture, AgradDistributionWiener_fv_3713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3714, AgradDistributionTestFixture, AgradDistributionWiener_fv_3714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3715, AgradDistributionTestFixture, AgradDistributionWiener_fv_3715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3716, AgradDistributionTestFixture, AgradDistributionWiener_fv_3716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3717, AgradDistributionTestFixture, AgradDistributionWiener_fv_3717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3718, AgradDistributionTestFixture, AgradDistributionWiener_fv_3718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3719, AgradDistributionTestFixture, AgradDistributionWiener_fv_3719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3720, AgradDistributionTestFixture, AgradDistributionWiener_fv_3720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3721, AgradDistributionTestFixture, AgradDistributionWiener_fv_3721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3722, AgradDistributionTestFixture, AgradDistributionWiener_fv_3722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3723, AgradDistributionTestFixture, AgradDistributionWiener_fv_3723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3724, AgradDistributionTestFixture, AgradDistributionWiener_fv_3724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3725, AgradDistributionTestFixture, AgradDistributionWiener_fv_3725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3726, AgradDistributionTestFixture, AgradDistributionWiener_fv_3726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3727, AgradDistributionTestFixture, AgradDistributionWiener_fv_3727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3728, AgradDistributionTestFixture, AgradDistributionWiener_fv_3728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3729, AgradDistributionTestFixture, AgradDistributionWiener_fv_3729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3730, AgradDistributionTestFixture, AgradDistributionWiener_fv_3730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3731, AgradDistributionTestFixture, AgradDistributionWiener_fv_3731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3732, AgradDistributionTestFixture, AgradDistributionWiener_fv_3732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3733, AgradDistributionTestFixture, AgradDistributionWiener_fv_3733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3734, AgradDistributionTestFixture, AgradDistributionWiener_fv_3734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3735, AgradDistributionTestFixture, AgradDistributionWiener_fv_3735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3736, AgradDistributionTestFixture, AgradDistributionWiener_fv_3736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3737, AgradDistributionTestFixture, AgradDistributionWiener_fv_3737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3738, AgradDistributionTestFixture, AgradDistributionWiener_fv_3738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3739, AgradDistributionTestFixture, AgradDistributionWiener_fv_3739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3740, AgradDistributionTestFixture, AgradDistributionWiener_fv_3740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3741, AgradDistributionTestFixture, AgradDistributionWiener_fv_3741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3742, AgradDistributionTestFixture, AgradDistributionWiener_fv_3742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3743, AgradDistributionTestFixture, AgradDistributionWiener_fv_3743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3744, AgradDistributionTestFixture, AgradDistributionWiener_fv_3744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3745, AgradDistributionTestFixture, AgradDistributionWiener_fv_3745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3746, AgradDistributionTestFixture, AgradDistributionWiener_fv_3746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3747, AgradDistributionTestFixture, AgradDistributionWiener_fv_3747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3748, AgradDistributionTestFixture, AgradDistributionWiener_fv_3748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3749, AgradDistributionTestFixture, AgradDistributionWiener_fv_3749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3750, AgradDistributionTestFixture, AgradDistributionWiener_fv_3750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3751, AgradDistributionTestFixture, AgradDistributionWiener_fv_3751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3752, AgradDistributionTestFixture, AgradDistributionWiener_fv_3752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3753, AgradDistributionTestFixture, AgradDistributionWiener_fv_3753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3754, AgradDistributionTestFixture, AgradDistributionWiener_fv_3754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3755, AgradDistributionTestFixture, AgradDistributionWiener_fv_3755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3756, AgradDistributionTestFixture, AgradDistributionWiener_fv_3756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3757, AgradDistributionTestFixture, AgradDistributionWiener_fv_3757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3758, AgradDistributionTestFixture, AgradDistributionWiener_fv_3758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3759, AgradDistributionTestFixture, AgradDistributionWiener_fv_3759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3760, AgradDistributionTestFixture, AgradDistributionWiener_fv_3760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3761, AgradDistributionTestFixture, AgradDistributionWiener_fv_3761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3762, AgradDistributionTestFixture, AgradDistributionWiener_fv_3762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3763, AgradDistributionTestFixture, AgradDistributionWiener_fv_3763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3764, AgradDistributionTestFixture, AgradDistributionWiener_fv_3764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3765, AgradDistributionTestFixture, AgradDistributionWiener_fv_3765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3766, AgradDistributionTestFixture, AgradDistributionWiener_fv_3766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3767, AgradDistributionTestFixture, AgradDistributionWiener_fv_3767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3768, AgradDistributionTestFixture, AgradDistributionWiener_fv_3768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3769, AgradDistributionTestFixture, AgradDistributionWiener_fv_3769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3770, AgradDistributionTestFixture, AgradDistributionWiener_fv_3770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3771, AgradDistributionTestFixture, AgradDistributionWiener_fv_3771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3772, AgradDistributionTestFixture, AgradDistributionWiener_fv_3772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3773, AgradDistributionTestFixture, AgradDistributionWiener_fv_3773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3774, AgradDistributionTestFixture, AgradDistributionWiener_fv_3774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3775, AgradDistributionTestFixture, AgradDistributionWiener_fv_3775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3776, AgradDistributionTestFixture, AgradDistributionWiener_fv_3776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3777, AgradDistributionTestFixture, AgradDistributionWiener_fv_3777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3778, AgradDistributionTestFixture, AgradDistributionWiener_fv_3778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3779, AgradDistributionTestFixture, AgradDistributionWiener_fv_3779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3780, AgradDistributionTestFixture, AgradDistributionWiener_fv_3780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3781, AgradDistributionTestFixture, AgradDistributionWiener_fv_3781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3782, AgradDistributionTestFixture, AgradDistributionWiener_fv_3782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3783, AgradDistributionTestFixture, AgradDistributionWiener_fv_3783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3784, AgradDistributionTestFixture, AgradDistributionWiener_fv_3784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3785, AgradDistributionTestFixture, AgradDistributionWiener_fv_3785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3786, AgradDistributionTestFixture, AgradDistributionWiener_fv_3786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3787, AgradDistributionTestFixture, AgradDistributionWiener_fv_3787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3788, AgradDistributionTestFixture, AgradDistributionWiener_fv_3788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3789, AgradDistributionTestFixture, AgradDistributionWiener_fv_3789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3790, AgradDistributionTestFixture, AgradDistributionWiener_fv_3790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3791, AgradDistributionTestFixture, AgradDistributionWiener_fv_3791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3792, AgradDistributionTestFixture, AgradDistributionWiener_fv_3792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3793, AgradDistributionTestFixture, AgradDistributionWiener_fv_3793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3794, AgradDistributionTestFixture, AgradDistributionWiener_fv_3794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3795, AgradDistributionTestFixture, AgradDistributionWiener_fv_3795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3796, AgradDistributionTestFixture, AgradDistributionWiener_fv_3796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3797, AgradDistributionTestFixture, AgradDistributionWiener_fv_3797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3798, AgradDistributionTestFixture, AgradDistributionWiener_fv_3798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_3799, AgradDistributionTestFixture, AgradDistributionWiener_fv_3799);
+
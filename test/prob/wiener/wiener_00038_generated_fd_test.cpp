@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3800;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3801;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3802;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3803;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3804;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3805;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3806;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_3807;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_3808;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3809;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_3810;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3811;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3812;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_3813;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3814;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3815;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3816;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3817;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3818;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3819;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3820;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3821;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3822;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3823;
+typedef boost::mpl::vector<fvar<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3824;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_3825;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_3826;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3827;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_3828;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_3829;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3830;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_3831;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_3832;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3833;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_3834;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3835;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3836;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3837;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3838;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3839;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3840;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3841;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3842;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_3843;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_3844;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3845;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_3846;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3847;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3848;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_3849;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3850;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3851;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3852;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3853;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3854;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3855;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3856;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3857;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3858;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3859;
+typedef boost::mpl::vector<fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3860;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, double, double, empty> type_fd_3861;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, double, std::vector<double>, empty> type_fd_3862;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3863;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, double, fvar<double>, empty> type_fd_3864;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, double, std::vector<fvar<double>>, empty> type_fd_3865;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3866;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<double>, double, empty> type_fd_3867;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<double>, std::vector<double>, empty> type_fd_3868;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3869;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<double>, fvar<double>, empty> type_fd_3870;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_3871;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3872;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_3873;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3874;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3875;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3876;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3877;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3878;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, fvar<double>, double, empty> type_fd_3879;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, fvar<double>, std::vector<double>, empty> type_fd_3880;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3881;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, fvar<double>, fvar<double>, empty> type_fd_3882;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_3883;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3884;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, double, empty> type_fd_3885;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_3886;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3887;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_3888;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_3889;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3890;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_3891;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_3892;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3893;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_3894;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_3895;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_3896;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<double>, double, double, empty> type_fd_3897;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<double>, double, std::vector<double>, empty> type_fd_3898;
+typedef boost::mpl::vector<fvar<double>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_3899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3800> AgradDistributionWiener_fd_3800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3801> AgradDistributionWiener_fd_3801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3802> AgradDistributionWiener_fd_3802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3803> AgradDistributionWiener_fd_3803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3804> AgradDistributionWiener_fd_3804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3805> AgradDistributionWiener_fd_3805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3806> AgradDistributionWiener_fd_3806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3807> AgradDistributionWiener_fd_3807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3808> AgradDistributionWiener_fd_3808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3809> AgradDistributionWiener_fd_3809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3810> AgradDistributionWiener_fd_3810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3811> AgradDistributionWiener_fd_3811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3812> AgradDistributionWiener_fd_3812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3813> AgradDistributionWiener_fd_3813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3814> AgradDistributionWiener_fd_3814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3815> AgradDistributionWiener_fd_3815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3816> AgradDistributionWiener_fd_3816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3817> AgradDistributionWiener_fd_3817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3818> AgradDistributionWiener_fd_3818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3819> AgradDistributionWiener_fd_3819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3820> AgradDistributionWiener_fd_3820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3821> AgradDistributionWiener_fd_3821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3822> AgradDistributionWiener_fd_3822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3823> AgradDistributionWiener_fd_3823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3824> AgradDistributionWiener_fd_3824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3825> AgradDistributionWiener_fd_3825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3826> AgradDistributionWiener_fd_3826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3827> AgradDistributionWiener_fd_3827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3828> AgradDistributionWiener_fd_3828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3829> AgradDistributionWiener_fd_3829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3830> AgradDistributionWiener_fd_3830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3831> AgradDistributionWiener_fd_3831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3832> AgradDistributionWiener_fd_3832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3833> AgradDistributionWiener_fd_3833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3834> AgradDistributionWiener_fd_3834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3835> AgradDistributionWiener_fd_3835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3836> AgradDistributionWiener_fd_3836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3837> AgradDistributionWiener_fd_3837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3838> AgradDistributionWiener_fd_3838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3839> AgradDistributionWiener_fd_3839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3840> AgradDistributionWiener_fd_3840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3841> AgradDistributionWiener_fd_3841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3842> AgradDistributionWiener_fd_3842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3843> AgradDistributionWiener_fd_3843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3844> AgradDistributionWiener_fd_3844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3845> AgradDistributionWiener_fd_3845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3846> AgradDistributionWiener_fd_3846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3847> AgradDistributionWiener_fd_3847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3848> AgradDistributionWiener_fd_3848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3849> AgradDistributionWiener_fd_3849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3850> AgradDistributionWiener_fd_3850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3851> AgradDistributionWiener_fd_3851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3852> AgradDistributionWiener_fd_3852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3853> AgradDistributionWiener_fd_3853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3854> AgradDistributionWiener_fd_3854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3855> AgradDistributionWiener_fd_3855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3856> AgradDistributionWiener_fd_3856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3857> AgradDistributionWiener_fd_3857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3858> AgradDistributionWiener_fd_3858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3859> AgradDistributionWiener_fd_3859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3860> AgradDistributionWiener_fd_3860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3861> AgradDistributionWiener_fd_3861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3862> AgradDistributionWiener_fd_3862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3863> AgradDistributionWiener_fd_3863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3864> AgradDistributionWiener_fd_3864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3865> AgradDistributionWiener_fd_3865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3866> AgradDistributionWiener_fd_3866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3867> AgradDistributionWiener_fd_3867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3868> AgradDistributionWiener_fd_3868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3869> AgradDistributionWiener_fd_3869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3870> AgradDistributionWiener_fd_3870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3871> AgradDistributionWiener_fd_3871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3872> AgradDistributionWiener_fd_3872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3873> AgradDistributionWiener_fd_3873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3874> AgradDistributionWiener_fd_3874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3875> AgradDistributionWiener_fd_3875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3876> AgradDistributionWiener_fd_3876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3877> AgradDistributionWiener_fd_3877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3878> AgradDistributionWiener_fd_3878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3879> AgradDistributionWiener_fd_3879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3880> AgradDistributionWiener_fd_3880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3881> AgradDistributionWiener_fd_3881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3882> AgradDistributionWiener_fd_3882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3883> AgradDistributionWiener_fd_3883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3884> AgradDistributionWiener_fd_3884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3885> AgradDistributionWiener_fd_3885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3886> AgradDistributionWiener_fd_3886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3887> AgradDistributionWiener_fd_3887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3888> AgradDistributionWiener_fd_3888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3889> AgradDistributionWiener_fd_3889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3890> AgradDistributionWiener_fd_3890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3891> AgradDistributionWiener_fd_3891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3892> AgradDistributionWiener_fd_3892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3893> AgradDistributionWiener_fd_3893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3894> AgradDistributionWiener_fd_3894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3895> AgradDistributionWiener_fd_3895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3896> AgradDistributionWiener_fd_3896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3897> AgradDistributionWiener_fd_3897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3898> AgradDistributionWiener_fd_3898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_3899> AgradDistributionWiener_fd_3899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3800, AgradDistributionTestFixture, AgradDistributionWiener_fd_3800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3801, AgradDistributionTestFixture, AgradDistributionWiener_fd_3801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3802, AgradDistributionTestFixture, AgradDistributionWiener_fd_3802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3803, AgradDistributionTestFixture, AgradDistributionWiener_fd_3803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3804, AgradDistributionTestFixture, AgradDistributionWiener_fd_3804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3805, AgradDistributionTestFixture, AgradDistributionWiener_fd_3805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3806, AgradDistributionTestFixture, AgradDistributionWiener_fd_3806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3807, AgradDistributionTestFixture, AgradDistributionWiener_fd_3807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3808, AgradDistributionTestFixture, AgradDistributionWiener_fd_3808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3809, AgradDistributionTestFixture, AgradDistributionWiener_fd_3809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3810, AgradDistributionTestFixture, AgradDistributionWiener_fd_3810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3811, AgradDistributionTestFixture, AgradDistributionWiener_fd_3811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3812, AgradDistributionTestFixture, AgradDistributionWiener_fd_3812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3813, AgradDistributionTestFixture, AgradDistributionWiener_fd_3813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3814, AgradDistributionTestFixture, AgradDistributionWiener_fd_3814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3815, AgradDistributionTestFixture, AgradDistributionWiener_fd_3815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3816, AgradDistributionTestFixture, AgradDistributionWiener_fd_3816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3817, AgradDistributionTestFixture, AgradDistributionWiener_fd_3817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3818, AgradDistributionTestFixture, AgradDistributionWiener_fd_3818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3819, AgradDistributionTestFixture, AgradDistributionWiener_fd_3819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3820, AgradDistributionTestFixture, AgradDistributionWiener_fd_3820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3821, AgradDistributionTestFixture, AgradDistributionWiener_fd_3821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3822, AgradDistributionTestFixture, AgradDistributionWiener_fd_3822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3823, AgradDistributionTestFixture, AgradDistributionWiener_fd_3823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3824, AgradDistributionTestFixture, AgradDistributionWiener_fd_3824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3825, AgradDistributionTestFixture, AgradDistributionWiener_fd_3825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3826, AgradDistributionTestFixture, AgradDistributionWiener_fd_3826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3827, AgradDistributionTestFixture, AgradDistributionWiener_fd_3827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3828, AgradDistributionTestFixture, AgradDistributionWiener_fd_3828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3829, AgradDistributionTestFixture, AgradDistributionWiener_fd_3829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3830, AgradDistributionTestFixture, AgradDistributionWiener_fd_3830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3831, AgradDistributionTestFixture, AgradDistributionWiener_fd_3831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3832, AgradDistributionTestFixture, AgradDistributionWiener_fd_3832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3833, AgradDistributionTestFixture, AgradDistributionWiener_fd_3833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3834, AgradDistributionTestFixture, AgradDistributionWiener_fd_3834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3835, AgradDistributionTestFixture, AgradDistributionWiener_fd_3835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3836, AgradDistributionTestFixture, AgradDistributionWiener_fd_3836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3837, AgradDistributionTestFixture, AgradDistributionWiener_fd_3837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3838, AgradDistributionTestFixture, AgradDistributionWiener_fd_3838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3839, AgradDistributionTestFixture, AgradDistributionWiener_fd_3839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3840, AgradDistributionTestFixture, AgradDistributionWiener_fd_3840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3841, AgradDistributionTestFixture, AgradDistributionWiener_fd_3841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3842, AgradDistributionTestFixture, AgradDistributionWiener_fd_3842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3843, AgradDistributionTestFixture, AgradDistributionWiener_fd_3843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3844, AgradDistributionTestFixture, AgradDistributionWiener_fd_3844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3845, AgradDistributionTestFixture, AgradDistributionWiener_fd_3845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3846, AgradDistributionTestFixture, AgradDistributionWiener_fd_3846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3847, AgradDistributionTestFixture, AgradDistributionWiener_fd_3847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3848, AgradDistributionTestFixture, AgradDistributionWiener_fd_3848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3849, AgradDistributionTestFixture, AgradDistributionWiener_fd_3849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3850, AgradDistributionTestFixture, AgradDistributionWiener_fd_3850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3851, AgradDistributionTestFixture, AgradDistributionWiener_fd_3851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3852, AgradDistributionTestFixture, AgradDistributionWiener_fd_3852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3853, AgradDistributionTestFixture, AgradDistributionWiener_fd_3853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3854, AgradDistributionTestFixture, AgradDistributionWiener_fd_3854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3855, AgradDistributionTestFixture, AgradDistributionWiener_fd_3855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3856, AgradDistributionTestFixture, AgradDistributionWiener_fd_3856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3857, AgradDistributionTestFixture, AgradDistributionWiener_fd_3857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3858, AgradDistributionTestFixture, AgradDistributionWiener_fd_3858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3859, AgradDistributionTestFixture, AgradDistributionWiener_fd_3859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3860, AgradDistributionTestFixture, AgradDistributionWiener_fd_3860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3861, AgradDistributionTestFixture, AgradDistributionWiener_fd_3861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3862, AgradDistributionTestFixture, AgradDistributionWiener_fd_3862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3863, AgradDistributionTestFixture, AgradDistributionWiener_fd_3863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3864, AgradDistributionTestFixture, AgradDistributionWiener_fd_3864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3865, AgradDistributionTestFixture, AgradDistributionWiener_fd_3865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3866, AgradDistributionTestFixture, AgradDistributionWiener_fd_3866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3867, AgradDistributionTestFixture, AgradDistributionWiener_fd_3867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3868, AgradDistributionTestFixture, AgradDistributionWiener_fd_3868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3869, AgradDistributionTestFixture, AgradDistributionWiener_fd_3869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3870, AgradDistributionTestFixture, AgradDistributionWiener_fd_3870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3871, AgradDistributionTestFixture, AgradDistributionWiener_fd_3871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3872, AgradDistributionTestFixture, AgradDistributionWiener_fd_3872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3873, AgradDistributionTestFixture, AgradDistributionWiener_fd_3873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3874, AgradDistributionTestFixture, AgradDistributionWiener_fd_3874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3875, AgradDistributionTestFixture, AgradDistributionWiener_fd_3875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3876, AgradDistributionTestFixture, AgradDistributionWiener_fd_3876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3877, AgradDistributionTestFixture, AgradDistributionWiener_fd_3877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3878, AgradDistributionTestFixture, AgradDistributionWiener_fd_3878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3879, AgradDistributionTestFixture, AgradDistributionWiener_fd_3879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3880, AgradDistributionTestFixture, AgradDistributionWiener_fd_3880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3881, AgradDistributionTestFixture, AgradDistributionWiener_fd_3881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3882, AgradDistributionTestFixture, AgradDistributionWiener_fd_3882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3883, AgradDistributionTestFixture, AgradDistributionWiener_fd_3883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3884, AgradDistributionTestFixture, AgradDistributionWiener_fd_3884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3885, AgradDistributionTestFixture, AgradDistributionWiener_fd_3885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3886, AgradDistributionTestFixture, AgradDistributionWiener_fd_3886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3887, AgradDistributionTestFixture, AgradDistributionWiener_fd_3887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3888, AgradDistributionTestFixture, AgradDistributionWiener_fd_3888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3889, AgradDistributionTestFixture, AgradDistributionWiener_fd_3889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3890, AgradDistributionTestFixture, AgradDistributionWiener_fd_3890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3891, AgradDistributionTestFixture, AgradDistributionWiener_fd_3891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3892, AgradDistributionTestFixture, AgradDistributionWiener_fd_3892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3893, AgradDistributionTestFixture, AgradDistributionWiener_fd_3893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3894, AgradDistributionTestFixture, AgradDistributionWiener_fd_3894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3895, AgradDistributionTestFixture, AgradDistributionWiener_fd_3895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3896, AgradDistributionTestFixture, AgradDistributionWiener_fd_3896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3897, AgradDistributionTestFixture, AgradDistributionWiener_fd_3897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3898, AgradDistributionTestFixture, AgradDistributionWiener_fd_3898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_3899, AgradDistributionTestFixture, AgradDistributionWiener_fd_3899);
+
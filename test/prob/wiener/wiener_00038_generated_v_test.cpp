@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3800;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty> type_v_3801;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_3802;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3803;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_3804;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_3805;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3806;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_3807;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_3808;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3809;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3810;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3811;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3812;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3813;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3814;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3815;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_3816;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_3817;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3818;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_3819;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_3820;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3821;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_3822;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_3823;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3824;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_3825;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_3826;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3827;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3828;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3829;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3830;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3831;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3832;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3833;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_3834;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_3835;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3836;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_3837;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_3838;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3839;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_3840;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_3841;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3842;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_3843;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_3844;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3845;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3846;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3847;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3848;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3849;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3850;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3851;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_3852;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_3853;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3854;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_3855;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_3856;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3857;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_3858;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_3859;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3860;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_3861;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_3862;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3863;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3864;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3865;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3866;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3867;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3868;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3869;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_3870;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3871;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3872;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_3873;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3874;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3875;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3876;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3877;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3878;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3879;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3880;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3881;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3882;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3883;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3884;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3885;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3886;
+typedef boost::mpl::vector<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3887;
+typedef boost::mpl::vector<var, double, double, double, double, empty> type_v_3888;
+typedef boost::mpl::vector<var, double, double, double, std::vector<double>, empty> type_v_3889;
+typedef boost::mpl::vector<var, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3890;
+typedef boost::mpl::vector<var, double, double, double, var, empty> type_v_3891;
+typedef boost::mpl::vector<var, double, double, double, std::vector<var>, empty> type_v_3892;
+typedef boost::mpl::vector<var, double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3893;
+typedef boost::mpl::vector<var, double, double, std::vector<double>, double, empty> type_v_3894;
+typedef boost::mpl::vector<var, double, double, std::vector<double>, std::vector<double>, empty> type_v_3895;
+typedef boost::mpl::vector<var, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3896;
+typedef boost::mpl::vector<var, double, double, std::vector<double>, var, empty> type_v_3897;
+typedef boost::mpl::vector<var, double, double, std::vector<double>, std::vector<var>, empty> type_v_3898;
+typedef boost::mpl::vector<var, double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3800> AgradDistributionWiener_v_3800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3801> AgradDistributionWiener_v_3801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3802> AgradDistributionWiener_v_3802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3803> AgradDistributionWiener_v_3803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3804> AgradDistributionWiener_v_3804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3805> AgradDistributionWiener_v_3805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3806> AgradDistributionWiener_v_3806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3807> AgradDistributionWiener_v_3807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3808> AgradDistributionWiener_v_3808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3809> AgradDistributionWiener_v_3809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3810> AgradDistributionWiener_v_3810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3811> AgradDistributionWiener_v_3811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3812> AgradDistributionWiener_v_3812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3813> AgradDistributionWiener_v_3813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3814> AgradDistributionWiener_v_3814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3815> AgradDistributionWiener_v_3815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3816> AgradDistributionWiener_v_3816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3817> AgradDistributionWiener_v_3817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3818> AgradDistributionWiener_v_3818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3819> AgradDistributionWiener_v_3819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3820> AgradDistributionWiener_v_3820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3821> AgradDistributionWiener_v_3821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3822> AgradDistributionWiener_v_3822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3823> AgradDistributionWiener_v_3823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3824> AgradDistributionWiener_v_3824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3825> AgradDistributionWiener_v_3825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3826> AgradDistributionWiener_v_3826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3827> AgradDistributionWiener_v_3827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3828> AgradDistributionWiener_v_3828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3829> AgradDistributionWiener_v_3829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3830> AgradDistributionWiener_v_3830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3831> AgradDistributionWiener_v_3831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3832> AgradDistributionWiener_v_3832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3833> AgradDistributionWiener_v_3833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3834> AgradDistributionWiener_v_3834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3835> AgradDistributionWiener_v_3835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3836> AgradDistributionWiener_v_3836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3837> AgradDistributionWiener_v_3837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3838> AgradDistributionWiener_v_3838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3839> AgradDistributionWiener_v_3839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3840> AgradDistributionWiener_v_3840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3841> AgradDistributionWiener_v_3841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3842> AgradDistributionWiener_v_3842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3843> AgradDistributionWiener_v_3843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3844> AgradDistributionWiener_v_3844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3845> AgradDistributionWiener_v_3845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3846> AgradDistributionWiener_v_3846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3847> AgradDistributionWiener_v_3847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3848> AgradDistributionWiener_v_3848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3849> AgradDistributionWiener_v_3849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3850> AgradDistributionWiener_v_3850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3851> AgradDistributionWiener_v_3851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3852> AgradDistributionWiener_v_3852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3853> AgradDistributionWiener_v_3853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3854> AgradDistributionWiener_v_3854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3855> AgradDistributionWiener_v_3855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3856> AgradDistributionWiener_v_3856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3857> AgradDistributionWiener_v_3857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3858> AgradDistributionWiener_v_3858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3859> AgradDistributionWiener_v_3859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3860> AgradDistributionWiener_v_3860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3861> AgradDistributionWiener_v_3861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3862> AgradDistributionWiener_v_3862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3863> AgradDistributionWiener_v_3863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3864> AgradDistributionWiener_v_3864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3865> AgradDistributionWiener_v_3865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3866> AgradDistributionWiener_v_3866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3867> AgradDistributionWiener_v_3867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3868> AgradDistributionWiener_v_3868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3869> AgradDistributionWiener_v_3869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3870> AgradDistributionWiener_v_3870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3871> AgradDistributionWiener_v_3871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3872> AgradDistributionWiener_v_3872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3873> AgradDistributionWiener_v_3873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3874> AgradDistributionWiener_v_3874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3875> AgradDistributionWiener_v_3875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3876> AgradDistributionWiener_v_3876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3877> AgradDistributionWiener_v_3877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3878> AgradDistributionWiener_v_3878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3879> AgradDistributionWiener_v_3879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3880> AgradDistributionWiener_v_3880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3881> AgradDistributionWiener_v_3881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3882> AgradDistributionWiener_v_3882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3883> AgradDistributionWiener_v_3883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3884> AgradDistributionWiener_v_3884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3885> AgradDistributionWiener_v_3885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3886> AgradDistributionWiener_v_3886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3887> AgradDistributionWiener_v_3887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3888> AgradDistributionWiener_v_3888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3889> AgradDistributionWiener_v_3889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3890> AgradDistributionWiener_v_3890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3891> AgradDistributionWiener_v_3891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3892> AgradDistributionWiener_v_3892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3893> AgradDistributionWiener_v_3893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3894> AgradDistributionWiener_v_3894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3895> AgradDistributionWiener_v_3895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3896> AgradDistributionWiener_v_3896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3897> AgradDistributionWiener_v_3897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3898> AgradDistributionWiener_v_3898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3899> AgradDistributionWiener_v_3899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3800, AgradDistributionTestFixture, AgradDistributionWiener_v_3800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3801, AgradDistributionTestFixture, AgradDistributionWiener_v_3801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3802, AgradDistributionTestFixture, AgradDistributionWiener_v_3802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3803, AgradDistributionTestFixture, AgradDistributionWiener_v_3803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3804, AgradDistributionTestFixture, AgradDistributionWiener_v_3804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3805, AgradDistributionTestFixture, AgradDistributionWiener_v_3805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3806, AgradDistributionTestFixture, AgradDistributionWiener_v_3806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3807, AgradDistributionTestFixture, AgradDistributionWiener_v_3807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3808, AgradDistributionTestFixture, AgradDistributionWiener_v_3808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3809, AgradDistributionTestFixture, AgradDistributionWiener_v_3809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3810, AgradDistributionTestFixture, AgradDistributionWiener_v_3810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3811, AgradDistributionTestFixture, AgradDistributionWiener_v_3811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3812, AgradDistributionTestFixture, AgradDistributionWiener_v_3812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3813, AgradDistributionTestFixture, AgradDistributionWiener_v_3813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3814, AgradDistributionTestFixture, AgradDistributionWiener_v_3814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3815, AgradDistributionTestFixture, AgradDistributionWiener_v_3815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3816, AgradDistributionTestFixture, AgradDistributionWiener_v_3816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3817, AgradDistributionTestFixture, AgradDistributionWiener_v_3817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3818, AgradDistributionTestFixture, AgradDistributionWiener_v_3818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3819, AgradDistributionTestFixture, AgradDistributionWiener_v_3819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3820, AgradDistributionTestFixture, AgradDistributionWiener_v_3820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3821, AgradDistributionTestFixture, AgradDistributionWiener_v_3821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3822, AgradDistributionTestFixture, AgradDistributionWiener_v_3822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3823, AgradDistributionTestFixture, AgradDistributionWiener_v_3823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3824, AgradDistributionTestFixture, AgradDistributionWiener_v_3824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3825, AgradDistributionTestFixture, AgradDistributionWiener_v_3825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3826, AgradDistributionTestFixture, AgradDistributionWiener_v_3826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3827, AgradDistributionTestFixture, AgradDistributionWiener_v_3827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3828, AgradDistributionTestFixture, AgradDistributionWiener_v_3828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3829, AgradDistributionTestFixture, AgradDistributionWiener_v_3829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3830, AgradDistributionTestFixture, AgradDistributionWiener_v_3830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3831, AgradDistributionTestFixture, AgradDistributionWiener_v_3831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3832, AgradDistributionTestFixture, AgradDistributionWiener_v_3832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3833, AgradDistributionTestFixture, AgradDistributionWiener_v_3833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3834, AgradDistributionTestFixture, AgradDistributionWiener_v_3834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3835, AgradDistributionTestFixture, AgradDistributionWiener_v_3835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3836, AgradDistributionTestFixture, AgradDistributionWiener_v_3836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3837, AgradDistributionTestFixture, AgradDistributionWiener_v_3837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3838, AgradDistributionTestFixture, AgradDistributionWiener_v_3838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3839, AgradDistributionTestFixture, AgradDistributionWiener_v_3839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3840, AgradDistributionTestFixture, AgradDistributionWiener_v_3840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3841, AgradDistributionTestFixture, AgradDistributionWiener_v_3841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3842, AgradDistributionTestFixture, AgradDistributionWiener_v_3842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3843, AgradDistributionTestFixture, AgradDistributionWiener_v_3843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3844, AgradDistributionTestFixture, AgradDistributionWiener_v_3844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3845, AgradDistributionTestFixture, AgradDistributionWiener_v_3845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3846, AgradDistributionTestFixture, AgradDistributionWiener_v_3846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3847, AgradDistributionTestFixture, AgradDistributionWiener_v_3847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3848, AgradDistributionTestFixture, AgradDistributionWiener_v_3848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3849, AgradDistributionTestFixture, AgradDistributionWiener_v_3849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3850, AgradDistributionTestFixture, AgradDistributionWiener_v_3850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3851, AgradDistributionTestFixture, AgradDistributionWiener_v_3851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3852, AgradDistributionTestFixture, AgradDistributionWiener_v_3852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3853, AgradDistributionTestFixture, AgradDistributionWiener_v_3853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3854, AgradDistributionTestFixture, AgradDistributionWiener_v_3854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3855, AgradDistributionTestFixture, AgradDistributionWiener_v_3855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3856, AgradDistributionTestFixture, AgradDistributionWiener_v_3856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3857, AgradDistributionTestFixture, AgradDistributionWiener_v_3857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3858, AgradDistributionTestFixture, AgradDistributionWiener_v_3858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3859, AgradDistributionTestFixture, AgradDistributionWiener_v_3859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3860, AgradDistributionTestFixture, AgradDistributionWiener_v_3860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3861, AgradDistributionTestFixture, AgradDistributionWiener_v_3861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3862, AgradDistributionTestFixture, AgradDistributionWiener_v_3862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3863, AgradDistributionTestFixture, AgradDistributionWiener_v_3863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3864, AgradDistributionTestFixture, AgradDistributionWiener_v_3864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3865, AgradDistributionTestFixture, AgradDistributionWiener_v_3865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3866, AgradDistributionTestFixture, AgradDistributionWiener_v_3866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3867, AgradDistributionTestFixture, AgradDistributionWiener_v_3867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3868, AgradDistributionTestFixture, AgradDistributionWiener_v_3868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3869, AgradDistributionTestFixture, AgradDistributionWiener_v_3869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3870, AgradDistributionTestFixture, AgradDistributionWiener_v_3870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3871, AgradDistributionTestFixture, AgradDistributionWiener_v_3871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3872, AgradDistributionTestFixture, AgradDistributionWiener_v_3872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3873, AgradDistributionTestFixture, AgradDistributionWiener_v_3873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3874, AgradDistributionTestFixture, AgradDistributionWiener_v_3874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3875, AgradDistributionTestFixture, AgradDistributionWiener_v_3875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3876, AgradDistributionTestFixture, AgradDistributionWiener_v_3876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3877, AgradDistributionTestFixture, AgradDistributionWiener_v_3877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3878, AgradDistributionTestFixture, AgradDistributionWiener_v_3878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3879, AgradDistributionTestFixture, AgradDistributionWiener_v_3879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3880, AgradDistributionTestFixture, AgradDistributionWiener_v_3880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3881, AgradDistributionTestFixture, AgradDistributionWiener_v_3881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3882, AgradDistributionTestFixture, AgradDistributionWiener_v_3882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3883, AgradDistributionTestFixture, AgradDistributionWiener_v_3883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3884, AgradDistributionTestFixture, AgradDistributionWiener_v_3884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3885, AgradDistributionTestFixture, AgradDistributionWiener_v_3885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3886, AgradDistributionTestFixture, AgradDistributionWiener_v_3886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3887, AgradDistributionTestFixture, AgradDistributionWiener_v_3887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3888, AgradDistributionTestFixture, AgradDistributionWiener_v_3888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3889, AgradDistributionTestFixture, AgradDistributionWiener_v_3889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3890, AgradDistributionTestFixture, AgradDistributionWiener_v_3890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3891, AgradDistributionTestFixture, AgradDistributionWiener_v_3891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3892, AgradDistributionTestFixture, AgradDistributionWiener_v_3892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3893, AgradDistributionTestFixture, AgradDistributionWiener_v_3893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3894, AgradDistributionTestFixture, AgradDistributionWiener_v_3894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3895, AgradDistributionTestFixture, AgradDistributionWiener_v_3895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3896, AgradDistributionTestFixture, AgradDistributionWiener_v_3896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3897, AgradDistributionTestFixture, AgradDistributionWiener_v_3897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3898, AgradDistributionTestFixture, AgradDistributionWiener_v_3898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3899, AgradDistributionTestFixture, AgradDistributionWiener_v_3899);
+
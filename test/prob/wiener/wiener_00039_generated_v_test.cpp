@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3900;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3901;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3902;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3903;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3904;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3905;
+typedef boost::mpl::vector<var, double, double, var, double, empty> type_v_3906;
+typedef boost::mpl::vector<var, double, double, var, std::vector<double>, empty> type_v_3907;
+typedef boost::mpl::vector<var, double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3908;
+typedef boost::mpl::vector<var, double, double, var, var, empty> type_v_3909;
+typedef boost::mpl::vector<var, double, double, var, std::vector<var>, empty> type_v_3910;
+typedef boost::mpl::vector<var, double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3911;
+typedef boost::mpl::vector<var, double, double, std::vector<var>, double, empty> type_v_3912;
+typedef boost::mpl::vector<var, double, double, std::vector<var>, std::vector<double>, empty> type_v_3913;
+typedef boost::mpl::vector<var, double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3914;
+typedef boost::mpl::vector<var, double, double, std::vector<var>, var, empty> type_v_3915;
+typedef boost::mpl::vector<var, double, double, std::vector<var>, std::vector<var>, empty> type_v_3916;
+typedef boost::mpl::vector<var, double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3917;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3918;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3919;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3920;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3921;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3922;
+typedef boost::mpl::vector<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3923;
+typedef boost::mpl::vector<var, double, std::vector<double>, double, double, empty> type_v_3924;
+typedef boost::mpl::vector<var, double, std::vector<double>, double, std::vector<double>, empty> type_v_3925;
+typedef boost::mpl::vector<var, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3926;
+typedef boost::mpl::vector<var, double, std::vector<double>, double, var, empty> type_v_3927;
+typedef boost::mpl::vector<var, double, std::vector<double>, double, std::vector<var>, empty> type_v_3928;
+typedef boost::mpl::vector<var, double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3929;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<double>, double, empty> type_v_3930;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_3931;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3932;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<double>, var, empty> type_v_3933;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_3934;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3935;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3936;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3937;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3938;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3939;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3940;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3941;
+typedef boost::mpl::vector<var, double, std::vector<double>, var, double, empty> type_v_3942;
+typedef boost::mpl::vector<var, double, std::vector<double>, var, std::vector<double>, empty> type_v_3943;
+typedef boost::mpl::vector<var, double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3944;
+typedef boost::mpl::vector<var, double, std::vector<double>, var, var, empty> type_v_3945;
+typedef boost::mpl::vector<var, double, std::vector<double>, var, std::vector<var>, empty> type_v_3946;
+typedef boost::mpl::vector<var, double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3947;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<var>, double, empty> type_v_3948;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_3949;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3950;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<var>, var, empty> type_v_3951;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_3952;
+typedef boost::mpl::vector<var, double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3953;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3954;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3955;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3956;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3957;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3958;
+typedef boost::mpl::vector<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3959;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_3960;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_3961;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3962;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_3963;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_3964;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3965;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_3966;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_3967;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3968;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_3969;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_3970;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3971;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3972;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3973;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3974;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3975;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3976;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3977;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_3978;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3979;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3980;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_3981;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3982;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3983;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3984;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3985;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3986;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3987;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3988;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3989;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3990;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3991;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3992;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3993;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3994;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3995;
+typedef boost::mpl::vector<var, double, var, double, double, empty> type_v_3996;
+typedef boost::mpl::vector<var, double, var, double, std::vector<double>, empty> type_v_3997;
+typedef boost::mpl::vector<var, double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3998;
+typedef boost::mpl::vector<var, double, var, double, var, empty> type_v_3999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3900> AgradDistributionWiener_v_3900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3901> AgradDistributionWiener_v_3901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3902> AgradDistributionWiener_v_3902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3903> AgradDistributionWiener_v_3903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3904> AgradDistributionWiener_v_3904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3905> AgradDistributionWiener_v_3905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3906> AgradDistributionWiener_v_3906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3907> AgradDistributionWiener_v_3907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3908> AgradDistributionWiener_v_3908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3909> AgradDistributionWiener_v_3909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3910> AgradDistributionWiener_v_3910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3911> AgradDistributionWiener_v_3911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3912> AgradDistributionWiener_v_3912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3913> AgradDistributionWiener_v_3913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3914> AgradDistributionWiener_v_3914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3915> AgradDistributionWiener_v_3915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3916> AgradDistributionWiener_v_3916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3917> AgradDistributionWiener_v_3917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3918> AgradDistributionWiener_v_3918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3919> AgradDistributionWiener_v_3919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3920> AgradDistributionWiener_v_3920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3921> AgradDistributionWiener_v_3921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3922> AgradDistributionWiener_v_3922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3923> AgradDistributionWiener_v_3923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3924> AgradDistributionWiener_v_3924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3925> AgradDistributionWiener_v_3925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3926> AgradDistributionWiener_v_3926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3927> AgradDistributionWiener_v_3927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3928> AgradDistributionWiener_v_3928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3929> AgradDistributionWiener_v_3929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3930> AgradDistributionWiener_v_3930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3931> AgradDistributionWiener_v_3931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3932> AgradDistributionWiener_v_3932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3933> AgradDistributionWiener_v_3933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3934> AgradDistributionWiener_v_3934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3935> AgradDistributionWiener_v_3935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3936> AgradDistributionWiener_v_3936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3937> AgradDistributionWiener_v_3937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3938> AgradDistributionWiener_v_3938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3939> AgradDistributionWiener_v_3939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3940> AgradDistributionWiener_v_3940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3941> AgradDistributionWiener_v_3941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3942> AgradDistributionWiener_v_3942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3943> AgradDistributionWiener_v_3943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3944> AgradDistributionWiener_v_3944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3945> AgradDistributionWiener_v_3945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3946> AgradDistributionWiener_v_3946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3947> AgradDistributionWiener_v_3947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3948> AgradDistributionWiener_v_3948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3949> AgradDistributionWiener_v_3949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3950> AgradDistributionWiener_v_3950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3951> AgradDistributionWiener_v_3951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3952> AgradDistributionWiener_v_3952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3953> AgradDistributionWiener_v_3953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3954> AgradDistributionWiener_v_3954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3955> AgradDistributionWiener_v_3955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3956> AgradDistributionWiener_v_3956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3957> AgradDistributionWiener_v_3957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3958> AgradDistributionWiener_v_3958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3959> AgradDistributionWiener_v_3959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3960> AgradDistributionWiener_v_3960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3961> AgradDistributionWiener_v_3961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3962> AgradDistributionWiener_v_3962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3963> AgradDistributionWiener_v_3963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3964> AgradDistributionWiener_v_3964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3965> AgradDistributionWiener_v_3965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3966> AgradDistributionWiener_v_3966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3967> AgradDistributionWiener_v_3967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3968> AgradDistributionWiener_v_3968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3969> AgradDistributionWiener_v_3969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3970> AgradDistributionWiener_v_3970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3971> AgradDistributionWiener_v_3971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3972> AgradDistributionWiener_v_3972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3973> AgradDistributionWiener_v_3973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3974> AgradDistributionWiener_v_3974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3975> AgradDistributionWiener_v_3975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3976> AgradDistributionWiener_v_3976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3977> AgradDistributionWiener_v_3977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3978> AgradDistributionWiener_v_3978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3979> AgradDistributionWiener_v_3979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3980> AgradDistributionWiener_v_3980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3981> AgradDistributionWiener_v_3981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3982> AgradDistributionWiener_v_3982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3983> AgradDistributionWiener_v_3983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3984> AgradDistributionWiener_v_3984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3985> AgradDistributionWiener_v_3985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3986> AgradDistributionWiener_v_3986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3987> AgradDistributionWiener_v_3987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3988> AgradDistributionWiener_v_3988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3989> AgradDistributionWiener_v_3989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3990> AgradDistributionWiener_v_3990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3991> AgradDistributionWiener_v_3991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3992> AgradDistributionWiener_v_3992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3993> AgradDistributionWiener_v_3993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3994> AgradDistributionWiener_v_3994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3995> AgradDistributionWiener_v_3995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3996> AgradDistributionWiener_v_3996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3997> AgradDistributionWiener_v_3997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3998> AgradDistributionWiener_v_3998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_3999> AgradDistributionWiener_v_3999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3900, AgradDistributionTestFixture, AgradDistributionWiener_v_3900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3901, AgradDistributionTestFixture, AgradDistributionWiener_v_3901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3902, AgradDistributionTestFixture, AgradDistributionWiener_v_3902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3903, AgradDistributionTestFixture, AgradDistributionWiener_v_3903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3904, AgradDistributionTestFixture, AgradDistributionWiener_v_3904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3905, AgradDistributionTestFixture, AgradDistributionWiener_v_3905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3906, AgradDistributionTestFixture, AgradDistributionWiener_v_3906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3907, AgradDistributionTestFixture, AgradDistributionWiener_v_3907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3908, AgradDistributionTestFixture, AgradDistributionWiener_v_3908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3909, AgradDistributionTestFixture, AgradDistributionWiener_v_3909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3910, AgradDistributionTestFixture, AgradDistributionWiener_v_3910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3911, AgradDistributionTestFixture, AgradDistributionWiener_v_3911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3912, AgradDistributionTestFixture, AgradDistributionWiener_v_3912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3913, AgradDistributionTestFixture, AgradDistributionWiener_v_3913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3914, AgradDistributionTestFixture, AgradDistributionWiener_v_3914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3915, AgradDistributionTestFixture, AgradDistributionWiener_v_3915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3916, AgradDistributionTestFixture, AgradDistributionWiener_v_3916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3917, AgradDistributionTestFixture, AgradDistributionWiener_v_3917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3918, AgradDistributionTestFixture, AgradDistributionWiener_v_3918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3919, AgradDistributionTestFixture, AgradDistributionWiener_v_3919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3920, AgradDistributionTestFixture, AgradDistributionWiener_v_3920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3921, AgradDistributionTestFixture, AgradDistributionWiener_v_3921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3922, AgradDistributionTestFixture, AgradDistributionWiener_v_3922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3923, AgradDistributionTestFixture, AgradDistributionWiener_v_3923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3924, AgradDistributionTestFixture, AgradDistributionWiener_v_3924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3925, AgradDistributionTestFixture, AgradDistributionWiener_v_3925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3926, AgradDistributionTestFixture, AgradDistributionWiener_v_3926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3927, AgradDistributionTestFixture, AgradDistributionWiener_v_3927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3928, AgradDistributionTestFixture, AgradDistributionWiener_v_3928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3929, AgradDistributionTestFixture, AgradDistributionWiener_v_3929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3930, AgradDistributionTestFixture, AgradDistributionWiener_v_3930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3931, AgradDistributionTestFixture, AgradDistributionWiener_v_3931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3932, AgradDistributionTestFixture, AgradDistributionWiener_v_3932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3933, AgradDistributionTestFixture, AgradDistributionWiener_v_3933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3934, AgradDistributionTestFixture, AgradDistributionWiener_v_3934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3935, AgradDistributionTestFixture, AgradDistributionWiener_v_3935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3936, AgradDistributionTestFixture, AgradDistributionWiener_v_3936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3937, AgradDistributionTestFixture, AgradDistributionWiener_v_3937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3938, AgradDistributionTestFixture, AgradDistributionWiener_v_3938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3939, AgradDistributionTestFixture, AgradDistributionWiener_v_3939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3940, AgradDistributionTestFixture, AgradDistributionWiener_v_3940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3941, AgradDistributionTestFixture, AgradDistributionWiener_v_3941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3942, AgradDistributionTestFixture, AgradDistributionWiener_v_3942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3943, AgradDistributionTestFixture, AgradDistributionWiener_v_3943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3944, AgradDistributionTestFixture, AgradDistributionWiener_v_3944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3945, AgradDistributionTestFixture, AgradDistributionWiener_v_3945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3946, AgradDistributionTestFixture, AgradDistributionWiener_v_3946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3947, AgradDistributionTestFixture, AgradDistributionWiener_v_3947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3948, AgradDistributionTestFixture, AgradDistributionWiener_v_3948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3949, AgradDistributionTestFixture, AgradDistributionWiener_v_3949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3950, AgradDistributionTestFixture, AgradDistributionWiener_v_3950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3951, AgradDistributionTestFixture, AgradDistributionWiener_v_3951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3952, AgradDistributionTestFixture, AgradDistributionWiener_v_3952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3953, AgradDistributionTestFixture, AgradDistributionWiener_v_3953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3954, AgradDistributionTestFixture, AgradDistributionWiener_v_3954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3955, AgradDistributionTestFixture, AgradDistributionWiener_v_3955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3956, AgradDistributionTestFixture, AgradDistributionWiener_v_3956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3957, AgradDistributionTestFixture, AgradDistributionWiener_v_3957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3958, AgradDistributionTestFixture, AgradDistributionWiener_v_3958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3959, AgradDistributionTestFixture, AgradDistributionWiener_v_3959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3960, AgradDistributionTestFixture, AgradDistributionWiener_v_3960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3961, AgradDistributionTestFixture, AgradDistributionWiener_v_3961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3962, AgradDistributionTestFixture, AgradDistributionWiener_v_3962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3963, AgradDistributionTestFixture, AgradDistributionWiener_v_3963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3964, AgradDistributionTestFixture, AgradDistributionWiener_v_3964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3965, AgradDistributionTestFixture, AgradDistributionWiener_v_3965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3966, AgradDistributionTestFixture, AgradDistributionWiener_v_3966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3967, AgradDistributionTestFixture, AgradDistributionWiener_v_3967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3968, AgradDistributionTestFixture, AgradDistributionWiener_v_3968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3969, AgradDistributionTestFixture, AgradDistributionWiener_v_3969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3970, AgradDistributionTestFixture, AgradDistributionWiener_v_3970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3971, AgradDistributionTestFixture, AgradDistributionWiener_v_3971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3972, AgradDistributionTestFixture, AgradDistributionWiener_v_3972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3973, AgradDistributionTestFixture, AgradDistributionWiener_v_3973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3974, AgradDistributionTestFixture, AgradDistributionWiener_v_3974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3975, AgradDistributionTestFixture, AgradDistributionWiener_v_3975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3976, AgradDistributionTestFixture, AgradDistributionWiener_v_3976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3977, AgradDistributionTestFixture, AgradDistributionWiener_v_3977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3978, AgradDistributionTestFixture, AgradDistributionWiener_v_3978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3979, AgradDistributionTestFixture, AgradDistributionWiener_v_3979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3980, AgradDistributionTestFixture, AgradDistributionWiener_v_3980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3981, AgradDistributionTestFixture, AgradDistributionWiener_v_3981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3982, AgradDistributionTestFixture, AgradDistributionWiener_v_3982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3983, AgradDistributionTestFixture, AgradDistributionWiener_v_3983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3984, AgradDistributionTestFixture, AgradDistributionWiener_v_3984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3985, AgradDistributionTestFixture, AgradDistributionWiener_v_3985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3986, AgradDistributionTestFixture, AgradDistributionWiener_v_3986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3987, AgradDistributionTestFixture, AgradDistributionWiener_v_3987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3988, AgradDistributionTestFixture, AgradDistributionWiener_v_3988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3989, AgradDistributionTestFixture, AgradDistributionWiener_v_3989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3990, AgradDistributionTestFixture, AgradDistributionWiener_v_3990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3991, AgradDistributionTestFixture, AgradDistributionWiener_v_3991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3992, AgradDistributionTestFixture, AgradDistributionWiener_v_3992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3993, AgradDistributionTestFixture, AgradDistributionWiener_v_3993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3994, AgradDistributionTestFixture, AgradDistributionWiener_v_3994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3995, AgradDistributionTestFixture, AgradDistributionWiener_v_3995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3996, AgradDistributionTestFixture, AgradDistributionWiener_v_3996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3997, AgradDistributionTestFixture, AgradDistributionWiener_v_3997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3998, AgradDistributionTestFixture, AgradDistributionWiener_v_3998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_3999, AgradDistributionTestFixture, AgradDistributionWiener_v_3999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4000;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4001;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4002;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4003;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4004;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, double, empty> type_fv_4005;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_4006;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4007;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_4008;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_4009;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4010;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_4011;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_4012;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4013;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_4014;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4015;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4016;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4017;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4018;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4019;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4020;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4021;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4022;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_4023;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_4024;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4025;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_4026;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4027;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4028;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_4029;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4030;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4031;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4032;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4033;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4034;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4035;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4036;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4037;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4038;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4039;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4040;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_4041;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_4042;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4043;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_4044;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_4045;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4046;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_4047;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_4048;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4049;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_4050;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4051;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4052;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4053;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4054;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4055;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4056;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4057;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4058;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_4059;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_4060;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4061;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_4062;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4063;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4064;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_4065;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4066;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4067;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4068;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4069;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4070;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4071;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4072;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4073;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4074;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4075;
+typedef boost::mpl::vector<fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4076;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty> type_fv_4077;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_fv_4078;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4079;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<var>, empty> type_fv_4080;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<var>>, empty> type_fv_4081;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4082;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_fv_4083;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_fv_4084;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4085;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<var>, empty> type_fv_4086;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4087;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4088;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4089;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4090;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4091;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4092;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4093;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4094;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, double, empty> type_fv_4095;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, empty> type_fv_4096;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4097;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, empty> type_fv_4098;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4000> AgradDistributionWiener_fv_4000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4001> AgradDistributionWiener_fv_4001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4002> AgradDistributionWiener_fv_4002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4003> AgradDistributionWiener_fv_4003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4004> AgradDistributionWiener_fv_4004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4005> AgradDistributionWiener_fv_4005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4006> AgradDistributionWiener_fv_4006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4007> AgradDistributionWiener_fv_4007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4008> AgradDistributionWiener_fv_4008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4009> AgradDistributionWiener_fv_4009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4010> AgradDistributionWiener_fv_4010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4011> AgradDistributionWiener_fv_4011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4012> AgradDistributionWiener_fv_4012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4013> AgradDistributionWiener_fv_4013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4014> AgradDistributionWiener_fv_4014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4015> AgradDistributionWiener_fv_4015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4016> AgradDistributionWiener_fv_4016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4017> AgradDistributionWiener_fv_4017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4018> AgradDistributionWiener_fv_4018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4019> AgradDistributionWiener_fv_4019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4020> AgradDistributionWiener_fv_4020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4021> AgradDistributionWiener_fv_4021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4022> AgradDistributionWiener_fv_4022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4023> AgradDistributionWiener_fv_4023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4024> AgradDistributionWiener_fv_4024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4025> AgradDistributionWiener_fv_4025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4026> AgradDistributionWiener_fv_4026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4027> AgradDistributionWiener_fv_4027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4028> AgradDistributionWiener_fv_4028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4029> AgradDistributionWiener_fv_4029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4030> AgradDistributionWiener_fv_4030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4031> AgradDistributionWiener_fv_4031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4032> AgradDistributionWiener_fv_4032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4033> AgradDistributionWiener_fv_4033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4034> AgradDistributionWiener_fv_4034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4035> AgradDistributionWiener_fv_4035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4036> AgradDistributionWiener_fv_4036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4037> AgradDistributionWiener_fv_4037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4038> AgradDistributionWiener_fv_4038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4039> AgradDistributionWiener_fv_4039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4040> AgradDistributionWiener_fv_4040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4041> AgradDistributionWiener_fv_4041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4042> AgradDistributionWiener_fv_4042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4043> AgradDistributionWiener_fv_4043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4044> AgradDistributionWiener_fv_4044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4045> AgradDistributionWiener_fv_4045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4046> AgradDistributionWiener_fv_4046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4047> AgradDistributionWiener_fv_4047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4048> AgradDistributionWiener_fv_4048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4049> AgradDistributionWiener_fv_4049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4050> AgradDistributionWiener_fv_4050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4051> AgradDistributionWiener_fv_4051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4052> AgradDistributionWiener_fv_4052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4053> AgradDistributionWiener_fv_4053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4054> AgradDistributionWiener_fv_4054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4055> AgradDistributionWiener_fv_4055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4056> AgradDistributionWiener_fv_4056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4057> AgradDistributionWiener_fv_4057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4058> AgradDistributionWiener_fv_4058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4059> AgradDistributionWiener_fv_4059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4060> AgradDistributionWiener_fv_4060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4061> AgradDistributionWiener_fv_4061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4062> AgradDistributionWiener_fv_4062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4063> AgradDistributionWiener_fv_4063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4064> AgradDistributionWiener_fv_4064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4065> AgradDistributionWiener_fv_4065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4066> AgradDistributionWiener_fv_4066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4067> AgradDistributionWiener_fv_4067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4068> AgradDistributionWiener_fv_4068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4069> AgradDistributionWiener_fv_4069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4070> AgradDistributionWiener_fv_4070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4071> AgradDistributionWiener_fv_4071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4072> AgradDistributionWiener_fv_4072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4073> AgradDistributionWiener_fv_4073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4074> AgradDistributionWiener_fv_4074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4075> AgradDistributionWiener_fv_4075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4076> AgradDistributionWiener_fv_4076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4077> AgradDistributionWiener_fv_4077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4078> AgradDistributionWiener_fv_4078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4079> AgradDistributionWiener_fv_4079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4080> AgradDistributionWiener_fv_4080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4081> AgradDistributionWiener_fv_4081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4082> AgradDistributionWiener_fv_4082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4083> AgradDistributionWiener_fv_4083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4084> AgradDistributionWiener_fv_4084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4085> AgradDistributionWiener_fv_4085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4086> AgradDistributionWiener_fv_4086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4087> AgradDistributionWiener_fv_4087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4088> AgradDistributionWiener_fv_4088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4089> AgradDistributionWiener_fv_4089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4090> AgradDistributionWiener_fv_4090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4091> AgradDistributionWiener_fv_4091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4092> AgradDistributionWiener_fv_4092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4093> AgradDistributionWiener_fv_4093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4094> AgradDistributionWiener_fv_4094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4095> AgradDistributionWiener_fv_4095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4096> AgradDistributionWiener_fv_4096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4097> AgradDistributionWiener_fv_4097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4098> AgradDistributionWiener_fv_4098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4099> AgradDistributionWiener_fv_4099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4000, AgradDistributionTestFixture, AgradDistributionWiener_fv_4000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4001, AgradDistributionTestFixture, AgradDistributionWiener_fv_4001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4002, AgradDistributionTestFixture, AgradDistributionWiener_fv_4002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4003, AgradDistributionTestFixture, AgradDistributionWiener_fv_4003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4004, AgradDistributionTestFixture, AgradDistributionWiener_fv_4004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4005, AgradDistributionTestFixture, AgradDistributionWiener_fv_4005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4006, AgradDistributionTestFixture, AgradDistributionWiener_fv_4006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4007, AgradDistributionTestFixture, AgradDistributionWiener_fv_4007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4008, AgradDistributionTestFixture, AgradDistributionWiener_fv_4008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4009, AgradDistributionTestFixture, AgradDistributionWiener_fv_4009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4010, AgradDistributionTestFixture, AgradDistributionWiener_fv_4010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4011, AgradDistributionTestFixture, AgradDistributionWiener_fv_4011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4012, AgradDistributionTestFixture, AgradDistributionWiener_fv_4012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4013, AgradDistributionTestFixture, AgradDistributionWiener_fv_4013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4014, AgradDistributionTestFixture, AgradDistributionWiener_fv_4014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4015, AgradDistributionTestFixture, AgradDistributionWiener_fv_4015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4016, AgradDistributionTestFixture, AgradDistributionWiener_fv_4016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4017, AgradDistributionTestFixture, AgradDistributionWiener_fv_4017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4018, AgradDistributionTestFixture, AgradDistributionWiener_fv_4018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4019, AgradDistributionTestFixture, AgradDistributionWiener_fv_4019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4020, AgradDistributionTestFixture, AgradDistributionWiener_fv_4020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4021, AgradDistributionTestFixture, AgradDistributionWiener_fv_4021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4022, AgradDistributionTestFixture, AgradDistributionWiener_fv_4022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4023, AgradDistributionTestFixture, AgradDistributionWiener_fv_4023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4024, AgradDistributionTestFixture, AgradDistributionWiener_fv_4024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4025, AgradDistributionTestFixture, AgradDistributionWiener_fv_4025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4026, AgradDistributionTestFixture, AgradDistributionWiener_fv_4026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4027, AgradDistributionTestFixture, AgradDistributionWiener_fv_4027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4028, AgradDistributionTestFixture, AgradDistributionWiener_fv_4028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4029, AgradDistributionTestFixture, AgradDistributionWiener_fv_4029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4030, AgradDistributionTestFixture, AgradDistributionWiener_fv_4030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4031, AgradDistributionTestFixture, AgradDistributionWiener_fv_4031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4032, AgradDistributionTestFixture, AgradDistributionWiener_fv_4032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4033, AgradDistributionTestFixture, AgradDistributionWiener_fv_4033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4034, AgradDistributionTestFixture, AgradDistributionWiener_fv_4034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4035, AgradDistributionTestFixture, AgradDistributionWiener_fv_4035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4036, AgradDistributionTestFixture, AgradDistributionWiener_fv_4036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4037, AgradDistributionTestFixture, AgradDistributionWiener_fv_4037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4038, AgradDistributionTestFixture, AgradDistributionWiener_fv_4038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4039, AgradDistributionTestFixture, AgradDistributionWiener_fv_4039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4040, AgradDistributionTestFixture, AgradDistributionWiener_fv_4040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4041, AgradDistributionTestFixture, AgradDistributionWiener_fv_4041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4042, AgradDistributionTestFixture, AgradDistributionWiener_fv_4042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4043, AgradDistributionTestFixture, AgradDistributionWiener_fv_4043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4044, AgradDistributionTestFixture, AgradDistributionWiener_fv_4044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4045, AgradDistributionTestFixture, AgradDistributionWiener_fv_4045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4046, AgradDistributionTestFixture, AgradDistributionWiener_fv_4046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4047, AgradDistributionTestFixture, AgradDistributionWiener_fv_4047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4048, AgradDistributionTestFixture, AgradDistributionWiener_fv_4048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4049, AgradDistributionTestFixture, AgradDistributionWiener_fv_4049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4050, AgradDistributionTestFixture, AgradDistributionWiener_fv_4050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4051, AgradDistributionTestFixture, AgradDistributionWiener_fv_4051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4052, AgradDistributionTestFixture, AgradDistributionWiener_fv_4052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4053, AgradDistributionTestFixture, AgradDistributionWiener_fv_4053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4054, AgradDistributionTestFixture, AgradDistributionWiener_fv_4054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4055, AgradDistributionTestFixture, AgradDistributionWiener_fv_4055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4056, AgradDistributionTestFixture, AgradDistributionWiener_fv_4056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4057, AgradDistributionTestFixture, AgradDistributionWiener_fv_4057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4058, AgradDistributionTestFixture, AgradDistributionWiener_fv_4058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4059, AgradDistributionTestFixture, AgradDistributionWiener_fv_4059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4060, AgradDistributionTestFixture, AgradDistributionWiener_fv_4060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4061, AgradDistributionTestFixture, AgradDistributionWiener_fv_4061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4062, AgradDistributionTestFixture, AgradDistributionWiener_fv_4062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4063, AgradDistributionTestFixture, AgradDistributionWiener_fv_4063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4064, AgradDistributionTestFixture, AgradDistributionWiener_fv_4064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4065, AgradDistributionTestFixture, AgradDistributionWiener_fv_4065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4066, AgradDistributionTestFixture, AgradDistributionWiener_fv_4066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4067, AgradDistributionTestFixture, AgradDistributionWiener_fv_4067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4068, AgradDistributionTestFixture, AgradDistributionWiener_fv_4068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4069, AgradDistributionTestFixture, AgradDistributionWiener_fv_4069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4070, AgradDistributionTestFixture, AgradDistributionWiener_fv_4070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4071, AgradDistributionTestFixture, AgradDistributionWiener_fv_4071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4072, AgradDistributionTestFixture, AgradDistributionWiener_fv_4072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4073, AgradDistributionTestFixture, AgradDistributionWiener_fv_4073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4074, AgradDistributionTestFixture, AgradDistributionWiener_fv_4074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4075, AgradDistributionTestFixture, AgradDistributionWiener_fv_4075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4076, AgradDistributionTestFixture, AgradDistributionWiener_fv_4076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4077, AgradDistributionTestFixture, AgradDistributionWiener_fv_4077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4078, AgradDistributionTestFixture, AgradDistributionWiener_fv_4078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4079, AgradDistributionTestFixture, AgradDistributionWiener_fv_4079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4080, AgradDistributionTestFixture, AgradDistributionWiener_fv_4080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4081, AgradDistributionTestFixture, AgradDistributionWiener_fv_4081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4082, AgradDistributionTestFixture, AgradDistributionWiener_fv_4082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4083, AgradDistributionTestFixture, AgradDistributionWiener_fv_4083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4084, AgradDistributionTestFixture, AgradDistributionWiener_fv_4084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4085, AgradDistributionTestFixture, AgradDistributionWiener_fv_4085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4086, AgradDistributionTestFixture, AgradDistributionWiener_fv_4086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4087, AgradDistributionTestFixture, AgradDistributionWiener_fv_4087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4088, AgradDistributionTestFixture, AgradDistributionWiener_fv_4088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4089, AgradDistributionTestFixture, AgradDistributionWiener_fv_4089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4090, AgradDistributionTestFixture, AgradDistributionWiener_fv_4090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4091, AgradDistributionTestFixture, AgradDistributionWiener_fv_4091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4092, AgradDistributionTestFixture, AgradDistributionWiener_fv_4092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4093, AgradDistributionTestFixture, AgradDistributionWiener_fv_4093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4094, AgradDistributionTestFixture, AgradDistributionWiener_fv_4094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4095, AgradDistributionTestFixture, AgradDistributionWiener_fv_4095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4096, AgradDistributionTestFixture, AgradDistributionWiener_fv_4096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4097, AgradDistributionTestFixture, AgradDistributionWiener_fv_4097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4098, AgradDistributionTestFixture, AgradDistributionWiener_fv_4098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4099, AgradDistributionTestFixture, AgradDistributionWiener_fv_4099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, double, var, double, std::vector<var>, empty> type_v_4000;
+typedef boost::mpl::vector<var, double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4001;
+typedef boost::mpl::vector<var, double, var, std::vector<double>, double, empty> type_v_4002;
+typedef boost::mpl::vector<var, double, var, std::vector<double>, std::vector<double>, empty> type_v_4003;
+typedef boost::mpl::vector<var, double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4004;
+typedef boost::mpl::vector<var, double, var, std::vector<double>, var, empty> type_v_4005;
+typedef boost::mpl::vector<var, double, var, std::vector<double>, std::vector<var>, empty> type_v_4006;
+typedef boost::mpl::vector<var, double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4007;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4008;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4009;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4010;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4011;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4012;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4013;
+typedef boost::mpl::vector<var, double, var, var, double, empty> type_v_4014;
+typedef boost::mpl::vector<var, double, var, var, std::vector<double>, empty> type_v_4015;
+typedef boost::mpl::vector<var, double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4016;
+typedef boost::mpl::vector<var, double, var, var, var, empty> type_v_4017;
+typedef boost::mpl::vector<var, double, var, var, std::vector<var>, empty> type_v_4018;
+typedef boost::mpl::vector<var, double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4019;
+typedef boost::mpl::vector<var, double, var, std::vector<var>, double, empty> type_v_4020;
+typedef boost::mpl::vector<var, double, var, std::vector<var>, std::vector<double>, empty> type_v_4021;
+typedef boost::mpl::vector<var, double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4022;
+typedef boost::mpl::vector<var, double, var, std::vector<var>, var, empty> type_v_4023;
+typedef boost::mpl::vector<var, double, var, std::vector<var>, std::vector<var>, empty> type_v_4024;
+typedef boost::mpl::vector<var, double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4025;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4026;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4027;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4028;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4029;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4030;
+typedef boost::mpl::vector<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4031;
+typedef boost::mpl::vector<var, double, std::vector<var>, double, double, empty> type_v_4032;
+typedef boost::mpl::vector<var, double, std::vector<var>, double, std::vector<double>, empty> type_v_4033;
+typedef boost::mpl::vector<var, double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4034;
+typedef boost::mpl::vector<var, double, std::vector<var>, double, var, empty> type_v_4035;
+typedef boost::mpl::vector<var, double, std::vector<var>, double, std::vector<var>, empty> type_v_4036;
+typedef boost::mpl::vector<var, double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4037;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<double>, double, empty> type_v_4038;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_4039;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4040;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<double>, var, empty> type_v_4041;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_4042;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4043;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4044;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4045;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4046;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4047;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4048;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4049;
+typedef boost::mpl::vector<var, double, std::vector<var>, var, double, empty> type_v_4050;
+typedef boost::mpl::vector<var, double, std::vector<var>, var, std::vector<double>, empty> type_v_4051;
+typedef boost::mpl::vector<var, double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4052;
+typedef boost::mpl::vector<var, double, std::vector<var>, var, var, empty> type_v_4053;
+typedef boost::mpl::vector<var, double, std::vector<var>, var, std::vector<var>, empty> type_v_4054;
+typedef boost::mpl::vector<var, double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4055;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<var>, double, empty> type_v_4056;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_4057;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4058;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<var>, var, empty> type_v_4059;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_4060;
+typedef boost::mpl::vector<var, double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4061;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4062;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4063;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4064;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4065;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4066;
+typedef boost::mpl::vector<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4067;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_4068;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_4069;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4070;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_4071;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_4072;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4073;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_4074;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_4075;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4076;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_4077;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_4078;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4079;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4080;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4081;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4082;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4083;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4084;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4085;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_4086;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_4087;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4088;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_4089;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_4090;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4091;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_4092;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_4093;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4094;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_4095;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_4096;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4097;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4098;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4000> AgradDistributionWiener_v_4000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4001> AgradDistributionWiener_v_4001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4002> AgradDistributionWiener_v_4002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4003> AgradDistributionWiener_v_4003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4004> AgradDistributionWiener_v_4004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4005> AgradDistributionWiener_v_4005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4006> AgradDistributionWiener_v_4006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4007> AgradDistributionWiener_v_4007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4008> AgradDistributionWiener_v_4008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4009> AgradDistributionWiener_v_4009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4010> AgradDistributionWiener_v_4010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4011> AgradDistributionWiener_v_4011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4012> AgradDistributionWiener_v_4012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4013> AgradDistributionWiener_v_4013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4014> AgradDistributionWiener_v_4014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4015> AgradDistributionWiener_v_4015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4016> AgradDistributionWiener_v_4016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4017> AgradDistributionWiener_v_4017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4018> AgradDistributionWiener_v_4018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4019> AgradDistributionWiener_v_4019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4020> AgradDistributionWiener_v_4020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4021> AgradDistributionWiener_v_4021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4022> AgradDistributionWiener_v_4022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4023> AgradDistributionWiener_v_4023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4024> AgradDistributionWiener_v_4024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4025> AgradDistributionWiener_v_4025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4026> AgradDistributionWiener_v_4026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4027> AgradDistributionWiener_v_4027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4028> AgradDistributionWiener_v_4028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4029> AgradDistributionWiener_v_4029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4030> AgradDistributionWiener_v_4030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4031> AgradDistributionWiener_v_4031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4032> AgradDistributionWiener_v_4032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4033> AgradDistributionWiener_v_4033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4034> AgradDistributionWiener_v_4034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4035> AgradDistributionWiener_v_4035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4036> AgradDistributionWiener_v_4036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4037> AgradDistributionWiener_v_4037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4038> AgradDistributionWiener_v_4038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4039> AgradDistributionWiener_v_4039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4040> AgradDistributionWiener_v_4040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4041> AgradDistributionWiener_v_4041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4042> AgradDistributionWiener_v_4042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4043> AgradDistributionWiener_v_4043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4044> AgradDistributionWiener_v_4044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4045> AgradDistributionWiener_v_4045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4046> AgradDistributionWiener_v_4046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4047> AgradDistributionWiener_v_4047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4048> AgradDistributionWiener_v_4048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4049> AgradDistributionWiener_v_4049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4050> AgradDistributionWiener_v_4050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4051> AgradDistributionWiener_v_4051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4052> AgradDistributionWiener_v_4052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4053> AgradDistributionWiener_v_4053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4054> AgradDistributionWiener_v_4054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4055> AgradDistributionWiener_v_4055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4056> AgradDistributionWiener_v_4056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4057> AgradDistributionWiener_v_4057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4058> AgradDistributionWiener_v_4058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4059> AgradDistributionWiener_v_4059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4060> AgradDistributionWiener_v_4060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4061> AgradDistributionWiener_v_4061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4062> AgradDistributionWiener_v_4062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4063> AgradDistributionWiener_v_4063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4064> AgradDistributionWiener_v_4064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4065> AgradDistributionWiener_v_4065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4066> AgradDistributionWiener_v_4066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4067> AgradDistributionWiener_v_4067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4068> AgradDistributionWiener_v_4068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4069> AgradDistributionWiener_v_4069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4070> AgradDistributionWiener_v_4070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4071> AgradDistributionWiener_v_4071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4072> AgradDistributionWiener_v_4072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4073> AgradDistributionWiener_v_4073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4074> AgradDistributionWiener_v_4074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4075> AgradDistributionWiener_v_4075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4076> AgradDistributionWiener_v_4076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4077> AgradDistributionWiener_v_4077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4078> AgradDistributionWiener_v_4078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4079> AgradDistributionWiener_v_4079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4080> AgradDistributionWiener_v_4080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4081> AgradDistributionWiener_v_4081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4082> AgradDistributionWiener_v_4082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4083> AgradDistributionWiener_v_4083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4084> AgradDistributionWiener_v_4084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4085> AgradDistributionWiener_v_4085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4086> AgradDistributionWiener_v_4086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4087> AgradDistributionWiener_v_4087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4088> AgradDistributionWiener_v_4088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4089> AgradDistributionWiener_v_4089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4090> AgradDistributionWiener_v_4090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4091> AgradDistributionWiener_v_4091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4092> AgradDistributionWiener_v_4092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4093> AgradDistributionWiener_v_4093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4094> AgradDistributionWiener_v_4094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4095> AgradDistributionWiener_v_4095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4096> AgradDistributionWiener_v_4096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4097> AgradDistributionWiener_v_4097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4098> AgradDistributionWiener_v_4098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4099> AgradDistributionWiener_v_4099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4000, AgradDistributionTestFixture, AgradDistributionWiener_v_4000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4001, AgradDistributionTestFixture, AgradDistributionWiener_v_4001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4002, AgradDistributionTestFixture, AgradDistributionWiener_v_4002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4003, AgradDistributionTestFixture, AgradDistributionWiener_v_4003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4004, AgradDistributionTestFixture, AgradDistributionWiener_v_4004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4005, AgradDistributionTestFixture, AgradDistributionWiener_v_4005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4006, AgradDistributionTestFixture, AgradDistributionWiener_v_4006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4007, AgradDistributionTestFixture, AgradDistributionWiener_v_4007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4008, AgradDistributionTestFixture, AgradDistributionWiener_v_4008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4009, AgradDistributionTestFixture, AgradDistributionWiener_v_4009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4010, AgradDistributionTestFixture, AgradDistributionWiener_v_4010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4011, AgradDistributionTestFixture, AgradDistributionWiener_v_4011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4012, AgradDistributionTestFixture, AgradDistributionWiener_v_4012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4013, AgradDistributionTestFixture, AgradDistributionWiener_v_4013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4014, AgradDistributionTestFixture, AgradDistributionWiener_v_4014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4015, AgradDistributionTestFixture, AgradDistributionWiener_v_4015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4016, AgradDistributionTestFixture, AgradDistributionWiener_v_4016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4017, AgradDistributionTestFixture, AgradDistributionWiener_v_4017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4018, AgradDistributionTestFixture, AgradDistributionWiener_v_4018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4019, AgradDistributionTestFixture, AgradDistributionWiener_v_4019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4020, AgradDistributionTestFixture, AgradDistributionWiener_v_4020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4021, AgradDistributionTestFixture, AgradDistributionWiener_v_4021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4022, AgradDistributionTestFixture, AgradDistributionWiener_v_4022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4023, AgradDistributionTestFixture, AgradDistributionWiener_v_4023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4024, AgradDistributionTestFixture, AgradDistributionWiener_v_4024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4025, AgradDistributionTestFixture, AgradDistributionWiener_v_4025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4026, AgradDistributionTestFixture, AgradDistributionWiener_v_4026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4027, AgradDistributionTestFixture, AgradDistributionWiener_v_4027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4028, AgradDistributionTestFixture, AgradDistributionWiener_v_4028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4029, AgradDistributionTestFixture, AgradDistributionWiener_v_4029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4030, AgradDistributionTestFixture, AgradDistributionWiener_v_4030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4031, AgradDistributionTestFixture, AgradDistributionWiener_v_4031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4032, AgradDistributionTestFixture, AgradDistributionWiener_v_4032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4033, AgradDistributionTestFixture, AgradDistributionWiener_v_4033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4034, AgradDistributionTestFixture, AgradDistributionWiener_v_4034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4035, AgradDistributionTestFixture, AgradDistributionWiener_v_4035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4036, AgradDistributionTestFixture, AgradDistributionWiener_v_4036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4037, AgradDistributionTestFixture, AgradDistributionWiener_v_4037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4038, AgradDistributionTestFixture, AgradDistributionWiener_v_4038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4039, AgradDistributionTestFixture, AgradDistributionWiener_v_4039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4040, AgradDistributionTestFixture, AgradDistributionWiener_v_4040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4041, AgradDistributionTestFixture, AgradDistributionWiener_v_4041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4042, AgradDistributionTestFixture, AgradDistributionWiener_v_4042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4043, AgradDistributionTestFixture, AgradDistributionWiener_v_4043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4044, AgradDistributionTestFixture, AgradDistributionWiener_v_4044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4045, AgradDistributionTestFixture, AgradDistributionWiener_v_4045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4046, AgradDistributionTestFixture, AgradDistributionWiener_v_4046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4047, AgradDistributionTestFixture, AgradDistributionWiener_v_4047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4048, AgradDistributionTestFixture, AgradDistributionWiener_v_4048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4049, AgradDistributionTestFixture, AgradDistributionWiener_v_4049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4050, AgradDistributionTestFixture, AgradDistributionWiener_v_4050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4051, AgradDistributionTestFixture, AgradDistributionWiener_v_4051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4052, AgradDistributionTestFixture, AgradDistributionWiener_v_4052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4053, AgradDistributionTestFixture, AgradDistributionWiener_v_4053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4054, AgradDistributionTestFixture, AgradDistributionWiener_v_4054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4055, AgradDistributionTestFixture, AgradDistributionWiener_v_4055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4056, AgradDistributionTestFixture, AgradDistributionWiener_v_4056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4057, AgradDistributionTestFixture, AgradDistributionWiener_v_4057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4058, AgradDistributionTestFixture, AgradDistributionWiener_v_4058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4059, AgradDistributionTestFixture, AgradDistributionWiener_v_4059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4060, AgradDistributionTestFixture, AgradDistributionWiener_v_4060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4061, AgradDistributionTestFixture, AgradDistributionWiener_v_4061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4062, AgradDistributionTestFixture, AgradDistributionWiener_v_4062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4063, AgradDistributionTestFixture, AgradDistributionWiener_v_4063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4064, AgradDistributionTestFixture, AgradDistributionWiener_v_4064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4065, AgradDistributionTestFixture, AgradDistributionWiener_v_4065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4066, AgradDistributionTestFixture, AgradDistributionWiener_v_4066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4067, AgradDistributionTestFixture, AgradDistributionWiener_v_4067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4068, AgradDistributionTestFixture, AgradDistributionWiener_v_4068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4069, AgradDistributionTestFixture, AgradDistributionWiener_v_4069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4070, AgradDistributionTestFixture, AgradDistributionWiener_v_4070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4071, AgradDistributionTestFixture, AgradDistributionWiener_v_4071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4072, AgradDistributionTestFixture, AgradDistributionWiener_v_4072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4073, AgradDistributionTestFixture, AgradDistributionWiener_v_4073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4074, AgradDistributionTestFixture, AgradDistributionWiener_v_4074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4075, AgradDistributionTestFixture, AgradDistributionWiener_v_4075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4076, AgradDistributionTestFixture, AgradDistributionWiener_v_4076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4077, AgradDistributionTestFixture, AgradDistributionWiener_v_4077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4078, AgradDistributionTestFixture, AgradDistributionWiener_v_4078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4079, AgradDistributionTestFixture, AgradDistributionWiener_v_4079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4080, AgradDistributionTestFixture, AgradDistributionWiener_v_4080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4081, AgradDistributionTestFixture, AgradDistributionWiener_v_4081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4082, AgradDistributionTestFixture, AgradDistributionWiener_v_4082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4083, AgradDistributionTestFixture, AgradDistributionWiener_v_4083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4084, AgradDistributionTestFixture, AgradDistributionWiener_v_4084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4085, AgradDistributionTestFixture, AgradDistributionWiener_v_4085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4086, AgradDistributionTestFixture, AgradDistributionWiener_v_4086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4087, AgradDistributionTestFixture, AgradDistributionWiener_v_4087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4088, AgradDistributionTestFixture, AgradDistributionWiener_v_4088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4089, AgradDistributionTestFixture, AgradDistributionWiener_v_4089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4090, AgradDistributionTestFixture, AgradDistributionWiener_v_4090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4091, AgradDistributionTestFixture, AgradDistributionWiener_v_4091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4092, AgradDistributionTestFixture, AgradDistributionWiener_v_4092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4093, AgradDistributionTestFixture, AgradDistributionWiener_v_4093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4094, AgradDistributionTestFixture, AgradDistributionWiener_v_4094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4095, AgradDistributionTestFixture, AgradDistributionWiener_v_4095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4096, AgradDistributionTestFixture, AgradDistributionWiener_v_4096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4097, AgradDistributionTestFixture, AgradDistributionWiener_v_4097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4098, AgradDistributionTestFixture, AgradDistributionWiener_v_4098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4099, AgradDistributionTestFixture, AgradDistributionWiener_v_4099);
+
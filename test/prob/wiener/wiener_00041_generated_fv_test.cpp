@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4100;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, empty> type_fv_4101;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4102;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4103;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4104;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4105;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4106;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4107;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4108;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4109;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4110;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4111;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4112;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_fv_4113;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_fv_4114;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4115;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<var>, empty> type_fv_4116;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_4117;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4118;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_fv_4119;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_4120;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4121;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_4122;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4123;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4124;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4125;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4126;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4127;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4128;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4129;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4130;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, empty> type_fv_4131;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_4132;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4133;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_4134;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4135;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4136;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_4137;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4138;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4139;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4140;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4141;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4142;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4143;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4144;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4145;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4146;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4147;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4148;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_4149;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_4150;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4151;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_4152;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_4153;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4154;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_4155;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_4156;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4157;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_4158;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4159;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4160;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4161;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4162;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4163;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4164;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4165;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4166;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_4167;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_4168;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4169;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_4170;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4171;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4172;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_4173;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4174;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4175;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4176;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4177;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4178;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4179;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4180;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4181;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4182;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4183;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4184;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, double, empty> type_fv_4185;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, empty> type_fv_4186;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4187;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, empty> type_fv_4188;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_4189;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4190;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, empty> type_fv_4191;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_4192;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4193;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_4194;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4195;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4196;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4197;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4198;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4100> AgradDistributionWiener_fv_4100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4101> AgradDistributionWiener_fv_4101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4102> AgradDistributionWiener_fv_4102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4103> AgradDistributionWiener_fv_4103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4104> AgradDistributionWiener_fv_4104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4105> AgradDistributionWiener_fv_4105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4106> AgradDistributionWiener_fv_4106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4107> AgradDistributionWiener_fv_4107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4108> AgradDistributionWiener_fv_4108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4109> AgradDistributionWiener_fv_4109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4110> AgradDistributionWiener_fv_4110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4111> AgradDistributionWiener_fv_4111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4112> AgradDistributionWiener_fv_4112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4113> AgradDistributionWiener_fv_4113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4114> AgradDistributionWiener_fv_4114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4115> AgradDistributionWiener_fv_4115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4116> AgradDistributionWiener_fv_4116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4117> AgradDistributionWiener_fv_4117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4118> AgradDistributionWiener_fv_4118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4119> AgradDistributionWiener_fv_4119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4120> AgradDistributionWiener_fv_4120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4121> AgradDistributionWiener_fv_4121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4122> AgradDistributionWiener_fv_4122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4123> AgradDistributionWiener_fv_4123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4124> AgradDistributionWiener_fv_4124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4125> AgradDistributionWiener_fv_4125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4126> AgradDistributionWiener_fv_4126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4127> AgradDistributionWiener_fv_4127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4128> AgradDistributionWiener_fv_4128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4129> AgradDistributionWiener_fv_4129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4130> AgradDistributionWiener_fv_4130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4131> AgradDistributionWiener_fv_4131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4132> AgradDistributionWiener_fv_4132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4133> AgradDistributionWiener_fv_4133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4134> AgradDistributionWiener_fv_4134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4135> AgradDistributionWiener_fv_4135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4136> AgradDistributionWiener_fv_4136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4137> AgradDistributionWiener_fv_4137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4138> AgradDistributionWiener_fv_4138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4139> AgradDistributionWiener_fv_4139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4140> AgradDistributionWiener_fv_4140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4141> AgradDistributionWiener_fv_4141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4142> AgradDistributionWiener_fv_4142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4143> AgradDistributionWiener_fv_4143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4144> AgradDistributionWiener_fv_4144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4145> AgradDistributionWiener_fv_4145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4146> AgradDistributionWiener_fv_4146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4147> AgradDistributionWiener_fv_4147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4148> AgradDistributionWiener_fv_4148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4149> AgradDistributionWiener_fv_4149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4150> AgradDistributionWiener_fv_4150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4151> AgradDistributionWiener_fv_4151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4152> AgradDistributionWiener_fv_4152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4153> AgradDistributionWiener_fv_4153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4154> AgradDistributionWiener_fv_4154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4155> AgradDistributionWiener_fv_4155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4156> AgradDistributionWiener_fv_4156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4157> AgradDistributionWiener_fv_4157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4158> AgradDistributionWiener_fv_4158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4159> AgradDistributionWiener_fv_4159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4160> AgradDistributionWiener_fv_4160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4161> AgradDistributionWiener_fv_4161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4162> AgradDistributionWiener_fv_4162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4163> AgradDistributionWiener_fv_4163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4164> AgradDistributionWiener_fv_4164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4165> AgradDistributionWiener_fv_4165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4166> AgradDistributionWiener_fv_4166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4167> AgradDistributionWiener_fv_4167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4168> AgradDistributionWiener_fv_4168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4169> AgradDistributionWiener_fv_4169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4170> AgradDistributionWiener_fv_4170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4171> AgradDistributionWiener_fv_4171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4172> AgradDistributionWiener_fv_4172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4173> AgradDistributionWiener_fv_4173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4174> AgradDistributionWiener_fv_4174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4175> AgradDistributionWiener_fv_4175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4176> AgradDistributionWiener_fv_4176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4177> AgradDistributionWiener_fv_4177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4178> AgradDistributionWiener_fv_4178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4179> AgradDistributionWiener_fv_4179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4180> AgradDistributionWiener_fv_4180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4181> AgradDistributionWiener_fv_4181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4182> AgradDistributionWiener_fv_4182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4183> AgradDistributionWiener_fv_4183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4184> AgradDistributionWiener_fv_4184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4185> AgradDistributionWiener_fv_4185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4186> AgradDistributionWiener_fv_4186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4187> AgradDistributionWiener_fv_4187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4188> AgradDistributionWiener_fv_4188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4189> AgradDistributionWiener_fv_4189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4190> AgradDistributionWiener_fv_4190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4191> AgradDistributionWiener_fv_4191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4192> AgradDistributionWiener_fv_4192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4193> AgradDistributionWiener_fv_4193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4194> AgradDistributionWiener_fv_4194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4195> AgradDistributionWiener_fv_4195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4196> AgradDistributionWiener_fv_4196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4197> AgradDistributionWiener_fv_4197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4198> AgradDistributionWiener_fv_4198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4199> AgradDistributionWiener_fv_4199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4100, AgradDistributionTestFixture, AgradDistributionWiener_fv_4100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4101, AgradDistributionTestFixture, AgradDistributionWiener_fv_4101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4102, AgradDistributionTestFixture, AgradDistributionWiener_fv_4102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4103, AgradDistributionTestFixture, AgradDistributionWiener_fv_4103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4104, AgradDistributionTestFixture, AgradDistributionWiener_fv_4104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4105, AgradDistributionTestFixture, AgradDistributionWiener_fv_4105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4106, AgradDistributionTestFixture, AgradDistributionWiener_fv_4106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4107, AgradDistributionTestFixture, AgradDistributionWiener_fv_4107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4108, AgradDistributionTestFixture, AgradDistributionWiener_fv_4108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4109, AgradDistributionTestFixture, AgradDistributionWiener_fv_4109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4110, AgradDistributionTestFixture, AgradDistributionWiener_fv_4110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4111, AgradDistributionTestFixture, AgradDistributionWiener_fv_4111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4112, AgradDistributionTestFixture, AgradDistributionWiener_fv_4112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4113, AgradDistributionTestFixture, AgradDistributionWiener_fv_4113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4114, AgradDistributionTestFixture, AgradDistributionWiener_fv_4114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4115, AgradDistributionTestFixture, AgradDistributionWiener_fv_4115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4116, AgradDistributionTestFixture, AgradDistributionWiener_fv_4116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4117, AgradDistributionTestFixture, AgradDistributionWiener_fv_4117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4118, AgradDistributionTestFixture, AgradDistributionWiener_fv_4118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4119, AgradDistributionTestFixture, AgradDistributionWiener_fv_4119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4120, AgradDistributionTestFixture, AgradDistributionWiener_fv_4120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4121, AgradDistributionTestFixture, AgradDistributionWiener_fv_4121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4122, AgradDistributionTestFixture, AgradDistributionWiener_fv_4122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4123, AgradDistributionTestFixture, AgradDistributionWiener_fv_4123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4124, AgradDistributionTestFixture, AgradDistributionWiener_fv_4124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4125, AgradDistributionTestFixture, AgradDistributionWiener_fv_4125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4126, AgradDistributionTestFixture, AgradDistributionWiener_fv_4126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4127, AgradDistributionTestFixture, AgradDistributionWiener_fv_4127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4128, AgradDistributionTestFixture, AgradDistributionWiener_fv_4128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4129, AgradDistributionTestFixture, AgradDistributionWiener_fv_4129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4130, AgradDistributionTestFixture, AgradDistributionWiener_fv_4130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4131, AgradDistributionTestFixture, AgradDistributionWiener_fv_4131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4132, AgradDistributionTestFixture, AgradDistributionWiener_fv_4132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4133, AgradDistributionTestFixture, AgradDistributionWiener_fv_4133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4134, AgradDistributionTestFixture, AgradDistributionWiener_fv_4134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4135, AgradDistributionTestFixture, AgradDistributionWiener_fv_4135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4136, AgradDistributionTestFixture, AgradDistributionWiener_fv_4136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4137, AgradDistributionTestFixture, AgradDistributionWiener_fv_4137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4138, AgradDistributionTestFixture, AgradDistributionWiener_fv_4138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4139, AgradDistributionTestFixture, AgradDistributionWiener_fv_4139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4140, AgradDistributionTestFixture, AgradDistributionWiener_fv_4140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4141, AgradDistributionTestFixture, AgradDistributionWiener_fv_4141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4142, AgradDistributionTestFixture, AgradDistributionWiener_fv_4142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4143, AgradDistributionTestFixture, AgradDistributionWiener_fv_4143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4144, AgradDistributionTestFixture, AgradDistributionWiener_fv_4144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4145, AgradDistributionTestFixture, AgradDistributionWiener_fv_4145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4146, AgradDistributionTestFixture, AgradDistributionWiener_fv_4146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4147, AgradDistributionTestFixture, AgradDistributionWiener_fv_4147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4148, AgradDistributionTestFixture, AgradDistributionWiener_fv_4148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4149, AgradDistributionTestFixture, AgradDistributionWiener_fv_4149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4150, AgradDistributionTestFixture, AgradDistributionWiener_fv_4150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4151, AgradDistributionTestFixture, AgradDistributionWiener_fv_4151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4152, AgradDistributionTestFixture, AgradDistributionWiener_fv_4152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4153, AgradDistributionTestFixture, AgradDistributionWiener_fv_4153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4154, AgradDistributionTestFixture, AgradDistributionWiener_fv_4154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4155, AgradDistributionTestFixture, AgradDistributionWiener_fv_4155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4156, AgradDistributionTestFixture, AgradDistributionWiener_fv_4156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4157, AgradDistributionTestFixture, AgradDistributionWiener_fv_4157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4158, AgradDistributionTestFixture, AgradDistributionWiener_fv_4158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4159, AgradDistributionTestFixture, AgradDistributionWiener_fv_4159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4160, AgradDistributionTestFixture, AgradDistributionWiener_fv_4160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4161, AgradDistributionTestFixture, AgradDistributionWiener_fv_4161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4162, AgradDistributionTestFixture, AgradDistributionWiener_fv_4162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4163, AgradDistributionTestFixture, AgradDistributionWiener_fv_4163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4164, AgradDistributionTestFixture, AgradDistributionWiener_fv_4164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4165, AgradDistributionTestFixture, AgradDistributionWiener_fv_4165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4166, AgradDistributionTestFixture, AgradDistributionWiener_fv_4166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4167, AgradDistributionTestFixture, AgradDistributionWiener_fv_4167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4168, AgradDistributionTestFixture, AgradDistributionWiener_fv_4168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4169, AgradDistributionTestFixture, AgradDistributionWiener_fv_4169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4170, AgradDistributionTestFixture, AgradDistributionWiener_fv_4170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4171, AgradDistributionTestFixture, AgradDistributionWiener_fv_4171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4172, AgradDistributionTestFixture, AgradDistributionWiener_fv_4172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4173, AgradDistributionTestFixture, AgradDistributionWiener_fv_4173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4174, AgradDistributionTestFixture, AgradDistributionWiener_fv_4174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4175, AgradDistributionTestFixture, AgradDistributionWiener_fv_4175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4176, AgradDistributionTestFixture, AgradDistributionWiener_fv_4176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4177, AgradDistributionTestFixture, AgradDistributionWiener_fv_4177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4178, AgradDistributionTestFixture, AgradDistributionWiener_fv_4178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4179, AgradDistributionTestFixture, AgradDistributionWiener_fv_4179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4180, AgradDistributionTestFixture, AgradDistributionWiener_fv_4180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4181, AgradDistributionTestFixture, AgradDistributionWiener_fv_4181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4182, AgradDistributionTestFixture, AgradDistributionWiener_fv_4182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4183, AgradDistributionTestFixture, AgradDistributionWiener_fv_4183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4184, AgradDistributionTestFixture, AgradDistributionWiener_fv_4184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4185, AgradDistributionTestFixture, AgradDistributionWiener_fv_4185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4186, AgradDistributionTestFixture, AgradDistributionWiener_fv_4186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4187, AgradDistributionTestFixture, AgradDistributionWiener_fv_4187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4188, AgradDistributionTestFixture, AgradDistributionWiener_fv_4188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4189, AgradDistributionTestFixture, AgradDistributionWiener_fv_4189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4190, AgradDistributionTestFixture, AgradDistributionWiener_fv_4190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4191, AgradDistributionTestFixture, AgradDistributionWiener_fv_4191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4192, AgradDistributionTestFixture, AgradDistributionWiener_fv_4192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4193, AgradDistributionTestFixture, AgradDistributionWiener_fv_4193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4194, AgradDistributionTestFixture, AgradDistributionWiener_fv_4194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4195, AgradDistributionTestFixture, AgradDistributionWiener_fv_4195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4196, AgradDistributionTestFixture, AgradDistributionWiener_fv_4196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4197, AgradDistributionTestFixture, AgradDistributionWiener_fv_4197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4198, AgradDistributionTestFixture, AgradDistributionWiener_fv_4198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4199, AgradDistributionTestFixture, AgradDistributionWiener_fv_4199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4100;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4101;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4102;
+typedef boost::mpl::vector<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4103;
+typedef boost::mpl::vector<var, std::vector<double>, double, double, double, empty> type_v_4104;
+typedef boost::mpl::vector<var, std::vector<double>, double, double, std::vector<double>, empty> type_v_4105;
+typedef boost::mpl::vector<var, std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4106;
+typedef boost::mpl::vector<var, std::vector<double>, double, double, var, empty> type_v_4107;
+typedef boost::mpl::vector<var, std::vector<double>, double, double, std::vector<var>, empty> type_v_4108;
+typedef boost::mpl::vector<var, std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4109;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<double>, double, empty> type_v_4110;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<double>, std::vector<double>, empty> type_v_4111;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4112;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<double>, var, empty> type_v_4113;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<double>, std::vector<var>, empty> type_v_4114;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4115;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4116;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4117;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4118;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4119;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4120;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4121;
+typedef boost::mpl::vector<var, std::vector<double>, double, var, double, empty> type_v_4122;
+typedef boost::mpl::vector<var, std::vector<double>, double, var, std::vector<double>, empty> type_v_4123;
+typedef boost::mpl::vector<var, std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4124;
+typedef boost::mpl::vector<var, std::vector<double>, double, var, var, empty> type_v_4125;
+typedef boost::mpl::vector<var, std::vector<double>, double, var, std::vector<var>, empty> type_v_4126;
+typedef boost::mpl::vector<var, std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4127;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<var>, double, empty> type_v_4128;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<var>, std::vector<double>, empty> type_v_4129;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4130;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<var>, var, empty> type_v_4131;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<var>, std::vector<var>, empty> type_v_4132;
+typedef boost::mpl::vector<var, std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4133;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4134;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4135;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4136;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4137;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4138;
+typedef boost::mpl::vector<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4139;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, double, double, empty> type_v_4140;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, double, std::vector<double>, empty> type_v_4141;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4142;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, double, var, empty> type_v_4143;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, double, std::vector<var>, empty> type_v_4144;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4145;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<double>, double, empty> type_v_4146;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_4147;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4148;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<double>, var, empty> type_v_4149;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_4150;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4151;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4152;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4153;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4154;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4155;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4156;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4157;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, var, double, empty> type_v_4158;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, var, std::vector<double>, empty> type_v_4159;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4160;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, var, var, empty> type_v_4161;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, var, std::vector<var>, empty> type_v_4162;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4163;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<var>, double, empty> type_v_4164;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_4165;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4166;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<var>, var, empty> type_v_4167;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_4168;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4169;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4170;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4171;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4172;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4173;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4174;
+typedef boost::mpl::vector<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4175;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_4176;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_4177;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4178;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_4179;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_4180;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4181;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_4182;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_4183;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4184;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_4185;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_4186;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4187;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4188;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4189;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4190;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4191;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4192;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4193;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_4194;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_4195;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4196;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_4197;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_4198;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4100> AgradDistributionWiener_v_4100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4101> AgradDistributionWiener_v_4101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4102> AgradDistributionWiener_v_4102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4103> AgradDistributionWiener_v_4103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4104> AgradDistributionWiener_v_4104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4105> AgradDistributionWiener_v_4105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4106> AgradDistributionWiener_v_4106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4107> AgradDistributionWiener_v_4107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4108> AgradDistributionWiener_v_4108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4109> AgradDistributionWiener_v_4109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4110> AgradDistributionWiener_v_4110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4111> AgradDistributionWiener_v_4111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4112> AgradDistributionWiener_v_4112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4113> AgradDistributionWiener_v_4113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4114> AgradDistributionWiener_v_4114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4115> AgradDistributionWiener_v_4115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4116> AgradDistributionWiener_v_4116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4117> AgradDistributionWiener_v_4117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4118> AgradDistributionWiener_v_4118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4119> AgradDistributionWiener_v_4119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4120> AgradDistributionWiener_v_4120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4121> AgradDistributionWiener_v_4121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4122> AgradDistributionWiener_v_4122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4123> AgradDistributionWiener_v_4123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4124> AgradDistributionWiener_v_4124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4125> AgradDistributionWiener_v_4125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4126> AgradDistributionWiener_v_4126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4127> AgradDistributionWiener_v_4127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4128> AgradDistributionWiener_v_4128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4129> AgradDistributionWiener_v_4129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4130> AgradDistributionWiener_v_4130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4131> AgradDistributionWiener_v_4131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4132> AgradDistributionWiener_v_4132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4133> AgradDistributionWiener_v_4133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4134> AgradDistributionWiener_v_4134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4135> AgradDistributionWiener_v_4135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4136> AgradDistributionWiener_v_4136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4137> AgradDistributionWiener_v_4137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4138> AgradDistributionWiener_v_4138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4139> AgradDistributionWiener_v_4139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4140> AgradDistributionWiener_v_4140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4141> AgradDistributionWiener_v_4141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4142> AgradDistributionWiener_v_4142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4143> AgradDistributionWiener_v_4143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4144> AgradDistributionWiener_v_4144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4145> AgradDistributionWiener_v_4145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4146> AgradDistributionWiener_v_4146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4147> AgradDistributionWiener_v_4147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4148> AgradDistributionWiener_v_4148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4149> AgradDistributionWiener_v_4149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4150> AgradDistributionWiener_v_4150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4151> AgradDistributionWiener_v_4151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4152> AgradDistributionWiener_v_4152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4153> AgradDistributionWiener_v_4153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4154> AgradDistributionWiener_v_4154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4155> AgradDistributionWiener_v_4155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4156> AgradDistributionWiener_v_4156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4157> AgradDistributionWiener_v_4157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4158> AgradDistributionWiener_v_4158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4159> AgradDistributionWiener_v_4159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4160> AgradDistributionWiener_v_4160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4161> AgradDistributionWiener_v_4161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4162> AgradDistributionWiener_v_4162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4163> AgradDistributionWiener_v_4163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4164> AgradDistributionWiener_v_4164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4165> AgradDistributionWiener_v_4165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4166> AgradDistributionWiener_v_4166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4167> AgradDistributionWiener_v_4167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4168> AgradDistributionWiener_v_4168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4169> AgradDistributionWiener_v_4169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4170> AgradDistributionWiener_v_4170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4171> AgradDistributionWiener_v_4171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4172> AgradDistributionWiener_v_4172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4173> AgradDistributionWiener_v_4173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4174> AgradDistributionWiener_v_4174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4175> AgradDistributionWiener_v_4175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4176> AgradDistributionWiener_v_4176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4177> AgradDistributionWiener_v_4177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4178> AgradDistributionWiener_v_4178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4179> AgradDistributionWiener_v_4179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4180> AgradDistributionWiener_v_4180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4181> AgradDistributionWiener_v_4181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4182> AgradDistributionWiener_v_4182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4183> AgradDistributionWiener_v_4183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4184> AgradDistributionWiener_v_4184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4185> AgradDistributionWiener_v_4185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4186> AgradDistributionWiener_v_4186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4187> AgradDistributionWiener_v_4187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4188> AgradDistributionWiener_v_4188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4189> AgradDistributionWiener_v_4189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4190> AgradDistributionWiener_v_4190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4191> AgradDistributionWiener_v_4191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4192> AgradDistributionWiener_v_4192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4193> AgradDistributionWiener_v_4193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4194> AgradDistributionWiener_v_4194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4195> AgradDistributionWiener_v_4195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4196> AgradDistributionWiener_v_4196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4197> AgradDistributionWiener_v_4197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4198> AgradDistributionWiener_v_4198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4199> AgradDistributionWiener_v_4199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4100, AgradDistributionTestFixture, AgradDistributionWiener_v_4100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4101, AgradDistributionTestFixture, AgradDistributionWiener_v_4101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4102, AgradDistributionTestFixture, AgradDistributionWiener_v_4102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4103, AgradDistributionTestFixture, AgradDistributionWiener_v_4103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4104, AgradDistributionTestFixture, AgradDistributionWiener_v_4104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4105, AgradDistributionTestFixture, AgradDistributionWiener_v_4105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4106, AgradDistributionTestFixture, AgradDistributionWiener_v_4106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4107, AgradDistributionTestFixture, AgradDistributionWiener_v_4107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4108, AgradDistributionTestFixture, AgradDistributionWiener_v_4108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4109, AgradDistributionTestFixture, AgradDistributionWiener_v_4109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4110, AgradDistributionTestFixture, AgradDistributionWiener_v_4110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4111, AgradDistributionTestFixture, AgradDistributionWiener_v_4111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4112, AgradDistributionTestFixture, AgradDistributionWiener_v_4112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4113, AgradDistributionTestFixture, AgradDistributionWiener_v_4113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4114, AgradDistributionTestFixture, AgradDistributionWiener_v_4114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4115, AgradDistributionTestFixture, AgradDistributionWiener_v_4115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4116, AgradDistributionTestFixture, AgradDistributionWiener_v_4116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4117, AgradDistributionTestFixture, AgradDistributionWiener_v_4117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4118, AgradDistributionTestFixture, AgradDistributionWiener_v_4118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4119, AgradDistributionTestFixture, AgradDistributionWiener_v_4119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4120, AgradDistributionTestFixture, AgradDistributionWiener_v_4120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4121, AgradDistributionTestFixture, AgradDistributionWiener_v_4121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4122, AgradDistributionTestFixture, AgradDistributionWiener_v_4122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4123, AgradDistributionTestFixture, AgradDistributionWiener_v_4123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4124, AgradDistributionTestFixture, AgradDistributionWiener_v_4124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4125, AgradDistributionTestFixture, AgradDistributionWiener_v_4125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4126, AgradDistributionTestFixture, AgradDistributionWiener_v_4126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4127, AgradDistributionTestFixture, AgradDistributionWiener_v_4127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4128, AgradDistributionTestFixture, AgradDistributionWiener_v_4128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4129, AgradDistributionTestFixture, AgradDistributionWiener_v_4129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4130, AgradDistributionTestFixture, AgradDistributionWiener_v_4130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4131, AgradDistributionTestFixture, AgradDistributionWiener_v_4131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4132, AgradDistributionTestFixture, AgradDistributionWiener_v_4132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4133, AgradDistributionTestFixture, AgradDistributionWiener_v_4133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4134, AgradDistributionTestFixture, AgradDistributionWiener_v_4134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4135, AgradDistributionTestFixture, AgradDistributionWiener_v_4135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4136, AgradDistributionTestFixture, AgradDistributionWiener_v_4136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4137, AgradDistributionTestFixture, AgradDistributionWiener_v_4137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4138, AgradDistributionTestFixture, AgradDistributionWiener_v_4138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4139, AgradDistributionTestFixture, AgradDistributionWiener_v_4139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4140, AgradDistributionTestFixture, AgradDistributionWiener_v_4140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4141, AgradDistributionTestFixture, AgradDistributionWiener_v_4141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4142, AgradDistributionTestFixture, AgradDistributionWiener_v_4142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4143, AgradDistributionTestFixture, AgradDistributionWiener_v_4143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4144, AgradDistributionTestFixture, AgradDistributionWiener_v_4144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4145, AgradDistributionTestFixture, AgradDistributionWiener_v_4145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4146, AgradDistributionTestFixture, AgradDistributionWiener_v_4146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4147, AgradDistributionTestFixture, AgradDistributionWiener_v_4147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4148, AgradDistributionTestFixture, AgradDistributionWiener_v_4148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4149, AgradDistributionTestFixture, AgradDistributionWiener_v_4149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4150, AgradDistributionTestFixture, AgradDistributionWiener_v_4150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4151, AgradDistributionTestFixture, AgradDistributionWiener_v_4151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4152, AgradDistributionTestFixture, AgradDistributionWiener_v_4152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4153, AgradDistributionTestFixture, AgradDistributionWiener_v_4153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4154, AgradDistributionTestFixture, AgradDistributionWiener_v_4154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4155, AgradDistributionTestFixture, AgradDistributionWiener_v_4155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4156, AgradDistributionTestFixture, AgradDistributionWiener_v_4156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4157, AgradDistributionTestFixture, AgradDistributionWiener_v_4157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4158, AgradDistributionTestFixture, AgradDistributionWiener_v_4158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4159, AgradDistributionTestFixture, AgradDistributionWiener_v_4159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4160, AgradDistributionTestFixture, AgradDistributionWiener_v_4160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4161, AgradDistributionTestFixture, AgradDistributionWiener_v_4161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4162, AgradDistributionTestFixture, AgradDistributionWiener_v_4162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4163, AgradDistributionTestFixture, AgradDistributionWiener_v_4163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4164, AgradDistributionTestFixture, AgradDistributionWiener_v_4164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4165, AgradDistributionTestFixture, AgradDistributionWiener_v_4165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4166, AgradDistributionTestFixture, AgradDistributionWiener_v_4166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4167, AgradDistributionTestFixture, AgradDistributionWiener_v_4167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4168, AgradDistributionTestFixture, AgradDistributionWiener_v_4168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4169, AgradDistributionTestFixture, AgradDistributionWiener_v_4169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4170, AgradDistributionTestFixture, AgradDistributionWiener_v_4170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4171, AgradDistributionTestFixture, AgradDistributionWiener_v_4171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4172, AgradDistributionTestFixture, AgradDistributionWiener_v_4172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4173, AgradDistributionTestFixture, AgradDistributionWiener_v_4173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4174, AgradDistributionTestFixture, AgradDistributionWiener_v_4174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4175, AgradDistributionTestFixture, AgradDistributionWiener_v_4175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4176, AgradDistributionTestFixture, AgradDistributionWiener_v_4176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4177, AgradDistributionTestFixture, AgradDistributionWiener_v_4177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4178, AgradDistributionTestFixture, AgradDistributionWiener_v_4178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4179, AgradDistributionTestFixture, AgradDistributionWiener_v_4179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4180, AgradDistributionTestFixture, AgradDistributionWiener_v_4180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4181, AgradDistributionTestFixture, AgradDistributionWiener_v_4181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4182, AgradDistributionTestFixture, AgradDistributionWiener_v_4182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4183, AgradDistributionTestFixture, AgradDistributionWiener_v_4183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4184, AgradDistributionTestFixture, AgradDistributionWiener_v_4184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4185, AgradDistributionTestFixture, AgradDistributionWiener_v_4185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4186, AgradDistributionTestFixture, AgradDistributionWiener_v_4186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4187, AgradDistributionTestFixture, AgradDistributionWiener_v_4187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4188, AgradDistributionTestFixture, AgradDistributionWiener_v_4188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4189, AgradDistributionTestFixture, AgradDistributionWiener_v_4189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4190, AgradDistributionTestFixture, AgradDistributionWiener_v_4190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4191, AgradDistributionTestFixture, AgradDistributionWiener_v_4191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4192, AgradDistributionTestFixture, AgradDistributionWiener_v_4192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4193, AgradDistributionTestFixture, AgradDistributionWiener_v_4193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4194, AgradDistributionTestFixture, AgradDistributionWiener_v_4194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4195, AgradDistributionTestFixture, AgradDistributionWiener_v_4195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4196, AgradDistributionTestFixture, AgradDistributionWiener_v_4196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4197, AgradDistributionTestFixture, AgradDistributionWiener_v_4197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4198, AgradDistributionTestFixture, AgradDistributionWiener_v_4198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4199, AgradDistributionTestFixture, AgradDistributionWiener_v_4199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_4200;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4201;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4202;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_4203;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_4204;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4205;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_4206;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_4207;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4208;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_4209;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_4210;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4211;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_4212;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4213;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4214;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_4215;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_4216;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4217;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_4218;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4219;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4220;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_4221;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_4222;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4223;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_4224;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_4225;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4226;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_4227;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_4228;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4229;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_4230;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4231;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4232;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_4233;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_4234;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4235;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_4236;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4237;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4238;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_4239;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_4240;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4241;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_4242;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_4243;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4244;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_4245;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_4246;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4247;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_4248;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4249;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4250;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_4251;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_4252;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4253;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_4254;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4255;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4256;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_4257;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_4258;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4259;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_4260;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_4261;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4262;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_4263;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_4264;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4265;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_4266;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4267;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4268;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_4269;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_4270;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4271;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_4272;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4273;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4274;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_4275;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_4276;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4277;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_4278;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_4279;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4280;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_4281;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_4282;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4283;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_4284;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4285;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4286;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_4287;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_4288;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4289;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_4290;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_4291;
+typedef boost::mpl::vector<fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4292;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, double, double, empty> type_ffd_4293;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, double, std::vector<double>, empty> type_ffd_4294;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_4295;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, double, fvar<fvar<double> >, empty> type_ffd_4296;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_4297;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_4298;
+typedef boost::mpl::vector<fvar<fvar<double> >, fvar<fvar<double> >, double, std::vector<double>, double, empty> type_ffd_4299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4200> AgradDistributionWiener_ffd_4200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4201> AgradDistributionWiener_ffd_4201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4202> AgradDistributionWiener_ffd_4202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4203> AgradDistributionWiener_ffd_4203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4204> AgradDistributionWiener_ffd_4204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4205> AgradDistributionWiener_ffd_4205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4206> AgradDistributionWiener_ffd_4206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4207> AgradDistributionWiener_ffd_4207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4208> AgradDistributionWiener_ffd_4208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4209> AgradDistributionWiener_ffd_4209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4210> AgradDistributionWiener_ffd_4210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4211> AgradDistributionWiener_ffd_4211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4212> AgradDistributionWiener_ffd_4212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4213> AgradDistributionWiener_ffd_4213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4214> AgradDistributionWiener_ffd_4214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4215> AgradDistributionWiener_ffd_4215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4216> AgradDistributionWiener_ffd_4216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4217> AgradDistributionWiener_ffd_4217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4218> AgradDistributionWiener_ffd_4218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4219> AgradDistributionWiener_ffd_4219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4220> AgradDistributionWiener_ffd_4220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4221> AgradDistributionWiener_ffd_4221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4222> AgradDistributionWiener_ffd_4222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4223> AgradDistributionWiener_ffd_4223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4224> AgradDistributionWiener_ffd_4224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4225> AgradDistributionWiener_ffd_4225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4226> AgradDistributionWiener_ffd_4226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4227> AgradDistributionWiener_ffd_4227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4228> AgradDistributionWiener_ffd_4228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4229> AgradDistributionWiener_ffd_4229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4230> AgradDistributionWiener_ffd_4230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4231> AgradDistributionWiener_ffd_4231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4232> AgradDistributionWiener_ffd_4232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4233> AgradDistributionWiener_ffd_4233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4234> AgradDistributionWiener_ffd_4234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4235> AgradDistributionWiener_ffd_4235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4236> AgradDistributionWiener_ffd_4236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4237> AgradDistributionWiener_ffd_4237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4238> AgradDistributionWiener_ffd_4238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4239> AgradDistributionWiener_ffd_4239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4240> AgradDistributionWiener_ffd_4240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4241> AgradDistributionWiener_ffd_4241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4242> AgradDistributionWiener_ffd_4242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4243> AgradDistributionWiener_ffd_4243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4244> AgradDistributionWiener_ffd_4244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4245> AgradDistributionWiener_ffd_4245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4246> AgradDistributionWiener_ffd_4246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4247> AgradDistributionWiener_ffd_4247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4248> AgradDistributionWiener_ffd_4248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4249> AgradDistributionWiener_ffd_4249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4250> AgradDistributionWiener_ffd_4250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4251> AgradDistributionWiener_ffd_4251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4252> AgradDistributionWiener_ffd_4252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4253> AgradDistributionWiener_ffd_4253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4254> AgradDistributionWiener_ffd_4254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4255> AgradDistributionWiener_ffd_4255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4256> AgradDistributionWiener_ffd_4256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4257> AgradDistributionWiener_ffd_4257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4258> AgradDistributionWiener_ffd_4258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4259> AgradDistributionWiener_ffd_4259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4260> AgradDistributionWiener_ffd_4260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4261> AgradDistributionWiener_ffd_4261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4262> AgradDistributionWiener_ffd_4262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4263> AgradDistributionWiener_ffd_4263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4264> AgradDistributionWiener_ffd_4264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4265> AgradDistributionWiener_ffd_4265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4266> AgradDistributionWiener_ffd_4266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4267> AgradDistributionWiener_ffd_4267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4268> AgradDistributionWiener_ffd_4268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4269> AgradDistributionWiener_ffd_4269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4270> AgradDistributionWiener_ffd_4270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4271> AgradDistributionWiener_ffd_4271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4272> AgradDistributionWiener_ffd_4272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4273> AgradDistributionWiener_ffd_4273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4274> AgradDistributionWiener_ffd_4274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4275> AgradDistributionWiener_ffd_4275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4276> AgradDistributionWiener_ffd_4276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4277> AgradDistributionWiener_ffd_4277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4278> AgradDistributionWiener_ffd_4278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4279> AgradDistributionWiener_ffd_4279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4280> AgradDistributionWiener_ffd_4280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4281> AgradDistributionWiener_ffd_4281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4282> AgradDistributionWiener_ffd_4282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4283> AgradDistributionWiener_ffd_4283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4284> AgradDistributionWiener_ffd_4284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4285> AgradDistributionWiener_ffd_4285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4286> AgradDistributionWiener_ffd_4286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4287> AgradDistributionWiener_ffd_4287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4288> AgradDistributionWiener_ffd_4288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4289> AgradDistributionWiener_ffd_4289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4290> AgradDistributionWiener_ffd_4290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4291> AgradDistributionWiener_ffd_4291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4292> AgradDistributionWiener_ffd_4292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4293> AgradDistributionWiener_ffd_4293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4294> AgradDistributionWiener_ffd_4294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4295> AgradDistributionWiener_ffd_4295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4296> AgradDistributionWiener_ffd_4296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4297> AgradDistributionWiener_ffd_4297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4298> AgradDistributionWiener_ffd_4298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_4299> AgradDistributionWiener_ffd_4299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4200, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4201, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4202, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4203, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4204, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4205, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4206, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4207, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4208, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4209, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4210, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4211, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4212, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4213, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4214, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4215, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4216, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4217, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4218, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4219, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4220, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4221, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4222, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4223, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4224, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4225, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4226, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4227, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4228, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4229, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4230, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4231, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4232, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4233, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4234, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4235, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4236, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4237, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4238, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4239, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4240, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4241, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4242, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4243, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4244, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4245, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4246, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4247, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4248, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4249, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4250, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4251, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4252, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4253, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4254, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4255, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4256, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4257, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4258, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4259, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4260, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4261, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4262, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4263, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4264, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4265, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4266, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4267, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4268, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4269, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4270, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4271, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4272, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4273, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4274, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4275, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4276, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4277, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4278, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4279, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4280, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4281, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4282, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4283, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4284, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4285, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4286, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4287, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4288, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4289, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4290, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4291, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4292, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4293, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4294, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4295, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4296, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4297, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4298, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_4299, AgradDistributionTestFixture, AgradDistributionWiener_ffd_4299);
+
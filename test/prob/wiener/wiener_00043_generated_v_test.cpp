@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4300;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4301;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_4302;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_4303;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4304;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_4305;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_4306;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4307;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_4308;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_4309;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4310;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_4311;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_4312;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4313;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4314;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4315;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4316;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4317;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4318;
+typedef boost::mpl::vector<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4319;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty> type_v_4320;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_v_4321;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4322;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty> type_v_4323;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty> type_v_4324;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4325;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_v_4326;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_v_4327;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4328;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty> type_v_4329;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty> type_v_4330;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4331;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4332;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4333;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4334;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4335;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4336;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4337;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty> type_v_4338;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty> type_v_4339;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4340;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty> type_v_4341;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty> type_v_4342;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4343;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty> type_v_4344;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty> type_v_4345;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4346;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty> type_v_4347;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty> type_v_4348;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4349;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4350;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4351;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4352;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4353;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4354;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4355;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_v_4356;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_v_4357;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4358;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty> type_v_4359;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty> type_v_4360;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4361;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_v_4362;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_4363;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4364;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty> type_v_4365;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_4366;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4367;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4368;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4369;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4370;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4371;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4372;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4373;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty> type_v_4374;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty> type_v_4375;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4376;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty> type_v_4377;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty> type_v_4378;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4379;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty> type_v_4380;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_4381;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4382;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty> type_v_4383;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_4384;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4385;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4386;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4387;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4388;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4389;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4390;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4391;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_4392;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_4393;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4394;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_4395;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_4396;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4397;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_4398;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_4399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4300> AgradDistributionWiener_v_4300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4301> AgradDistributionWiener_v_4301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4302> AgradDistributionWiener_v_4302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4303> AgradDistributionWiener_v_4303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4304> AgradDistributionWiener_v_4304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4305> AgradDistributionWiener_v_4305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4306> AgradDistributionWiener_v_4306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4307> AgradDistributionWiener_v_4307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4308> AgradDistributionWiener_v_4308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4309> AgradDistributionWiener_v_4309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4310> AgradDistributionWiener_v_4310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4311> AgradDistributionWiener_v_4311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4312> AgradDistributionWiener_v_4312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4313> AgradDistributionWiener_v_4313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4314> AgradDistributionWiener_v_4314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4315> AgradDistributionWiener_v_4315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4316> AgradDistributionWiener_v_4316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4317> AgradDistributionWiener_v_4317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4318> AgradDistributionWiener_v_4318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4319> AgradDistributionWiener_v_4319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4320> AgradDistributionWiener_v_4320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4321> AgradDistributionWiener_v_4321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4322> AgradDistributionWiener_v_4322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4323> AgradDistributionWiener_v_4323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4324> AgradDistributionWiener_v_4324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4325> AgradDistributionWiener_v_4325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4326> AgradDistributionWiener_v_4326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4327> AgradDistributionWiener_v_4327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4328> AgradDistributionWiener_v_4328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4329> AgradDistributionWiener_v_4329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4330> AgradDistributionWiener_v_4330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4331> AgradDistributionWiener_v_4331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4332> AgradDistributionWiener_v_4332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4333> AgradDistributionWiener_v_4333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4334> AgradDistributionWiener_v_4334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4335> AgradDistributionWiener_v_4335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4336> AgradDistributionWiener_v_4336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4337> AgradDistributionWiener_v_4337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4338> AgradDistributionWiener_v_4338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4339> AgradDistributionWiener_v_4339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4340> AgradDistributionWiener_v_4340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4341> AgradDistributionWiener_v_4341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4342> AgradDistributionWiener_v_4342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4343> AgradDistributionWiener_v_4343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4344> AgradDistributionWiener_v_4344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4345> AgradDistributionWiener_v_4345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4346> AgradDistributionWiener_v_4346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4347> AgradDistributionWiener_v_4347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4348> AgradDistributionWiener_v_4348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4349> AgradDistributionWiener_v_4349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4350> AgradDistributionWiener_v_4350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4351> AgradDistributionWiener_v_4351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4352> AgradDistributionWiener_v_4352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4353> AgradDistributionWiener_v_4353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4354> AgradDistributionWiener_v_4354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4355> AgradDistributionWiener_v_4355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4356> AgradDistributionWiener_v_4356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4357> AgradDistributionWiener_v_4357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4358> AgradDistributionWiener_v_4358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4359> AgradDistributionWiener_v_4359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4360> AgradDistributionWiener_v_4360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4361> AgradDistributionWiener_v_4361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4362> AgradDistributionWiener_v_4362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4363> AgradDistributionWiener_v_4363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4364> AgradDistributionWiener_v_4364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4365> AgradDistributionWiener_v_4365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4366> AgradDistributionWiener_v_4366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4367> AgradDistributionWiener_v_4367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4368> AgradDistributionWiener_v_4368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4369> AgradDistributionWiener_v_4369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4370> AgradDistributionWiener_v_4370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4371> AgradDistributionWiener_v_4371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4372> AgradDistributionWiener_v_4372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4373> AgradDistributionWiener_v_4373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4374> AgradDistributionWiener_v_4374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4375> AgradDistributionWiener_v_4375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4376> AgradDistributionWiener_v_4376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4377> AgradDistributionWiener_v_4377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4378> AgradDistributionWiener_v_4378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4379> AgradDistributionWiener_v_4379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4380> AgradDistributionWiener_v_4380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4381> AgradDistributionWiener_v_4381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4382> AgradDistributionWiener_v_4382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4383> AgradDistributionWiener_v_4383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4384> AgradDistributionWiener_v_4384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4385> AgradDistributionWiener_v_4385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4386> AgradDistributionWiener_v_4386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4387> AgradDistributionWiener_v_4387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4388> AgradDistributionWiener_v_4388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4389> AgradDistributionWiener_v_4389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4390> AgradDistributionWiener_v_4390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4391> AgradDistributionWiener_v_4391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4392> AgradDistributionWiener_v_4392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4393> AgradDistributionWiener_v_4393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4394> AgradDistributionWiener_v_4394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4395> AgradDistributionWiener_v_4395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4396> AgradDistributionWiener_v_4396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4397> AgradDistributionWiener_v_4397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4398> AgradDistributionWiener_v_4398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4399> AgradDistributionWiener_v_4399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4300, AgradDistributionTestFixture, AgradDistributionWiener_v_4300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4301, AgradDistributionTestFixture, AgradDistributionWiener_v_4301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4302, AgradDistributionTestFixture, AgradDistributionWiener_v_4302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4303, AgradDistributionTestFixture, AgradDistributionWiener_v_4303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4304, AgradDistributionTestFixture, AgradDistributionWiener_v_4304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4305, AgradDistributionTestFixture, AgradDistributionWiener_v_4305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4306, AgradDistributionTestFixture, AgradDistributionWiener_v_4306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4307, AgradDistributionTestFixture, AgradDistributionWiener_v_4307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4308, AgradDistributionTestFixture, AgradDistributionWiener_v_4308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4309, AgradDistributionTestFixture, AgradDistributionWiener_v_4309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4310, AgradDistributionTestFixture, AgradDistributionWiener_v_4310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4311, AgradDistributionTestFixture, AgradDistributionWiener_v_4311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4312, AgradDistributionTestFixture, AgradDistributionWiener_v_4312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4313, AgradDistributionTestFixture, AgradDistributionWiener_v_4313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4314, AgradDistributionTestFixture, AgradDistributionWiener_v_4314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4315, AgradDistributionTestFixture, AgradDistributionWiener_v_4315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4316, AgradDistributionTestFixture, AgradDistributionWiener_v_4316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4317, AgradDistributionTestFixture, AgradDistributionWiener_v_4317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4318, AgradDistributionTestFixture, AgradDistributionWiener_v_4318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4319, AgradDistributionTestFixture, AgradDistributionWiener_v_4319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4320, AgradDistributionTestFixture, AgradDistributionWiener_v_4320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4321, AgradDistributionTestFixture, AgradDistributionWiener_v_4321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4322, AgradDistributionTestFixture, AgradDistributionWiener_v_4322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4323, AgradDistributionTestFixture, AgradDistributionWiener_v_4323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4324, AgradDistributionTestFixture, AgradDistributionWiener_v_4324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4325, AgradDistributionTestFixture, AgradDistributionWiener_v_4325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4326, AgradDistributionTestFixture, AgradDistributionWiener_v_4326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4327, AgradDistributionTestFixture, AgradDistributionWiener_v_4327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4328, AgradDistributionTestFixture, AgradDistributionWiener_v_4328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4329, AgradDistributionTestFixture, AgradDistributionWiener_v_4329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4330, AgradDistributionTestFixture, AgradDistributionWiener_v_4330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4331, AgradDistributionTestFixture, AgradDistributionWiener_v_4331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4332, AgradDistributionTestFixture, AgradDistributionWiener_v_4332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4333, AgradDistributionTestFixture, AgradDistributionWiener_v_4333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4334, AgradDistributionTestFixture, AgradDistributionWiener_v_4334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4335, AgradDistributionTestFixture, AgradDistributionWiener_v_4335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4336, AgradDistributionTestFixture, AgradDistributionWiener_v_4336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4337, AgradDistributionTestFixture, AgradDistributionWiener_v_4337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4338, AgradDistributionTestFixture, AgradDistributionWiener_v_4338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4339, AgradDistributionTestFixture, AgradDistributionWiener_v_4339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4340, AgradDistributionTestFixture, AgradDistributionWiener_v_4340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4341, AgradDistributionTestFixture, AgradDistributionWiener_v_4341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4342, AgradDistributionTestFixture, AgradDistributionWiener_v_4342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4343, AgradDistributionTestFixture, AgradDistributionWiener_v_4343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4344, AgradDistributionTestFixture, AgradDistributionWiener_v_4344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4345, AgradDistributionTestFixture, AgradDistributionWiener_v_4345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4346, AgradDistributionTestFixture, AgradDistributionWiener_v_4346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4347, AgradDistributionTestFixture, AgradDistributionWiener_v_4347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4348, AgradDistributionTestFixture, AgradDistributionWiener_v_4348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4349, AgradDistributionTestFixture, AgradDistributionWiener_v_4349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4350, AgradDistributionTestFixture, AgradDistributionWiener_v_4350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4351, AgradDistributionTestFixture, AgradDistributionWiener_v_4351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4352, AgradDistributionTestFixture, AgradDistributionWiener_v_4352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4353, AgradDistributionTestFixture, AgradDistributionWiener_v_4353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4354, AgradDistributionTestFixture, AgradDistributionWiener_v_4354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4355, AgradDistributionTestFixture, AgradDistributionWiener_v_4355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4356, AgradDistributionTestFixture, AgradDistributionWiener_v_4356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4357, AgradDistributionTestFixture, AgradDistributionWiener_v_4357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4358, AgradDistributionTestFixture, AgradDistributionWiener_v_4358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4359, AgradDistributionTestFixture, AgradDistributionWiener_v_4359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4360, AgradDistributionTestFixture, AgradDistributionWiener_v_4360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4361, AgradDistributionTestFixture, AgradDistributionWiener_v_4361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4362, AgradDistributionTestFixture, AgradDistributionWiener_v_4362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4363, AgradDistributionTestFixture, AgradDistributionWiener_v_4363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4364, AgradDistributionTestFixture, AgradDistributionWiener_v_4364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4365, AgradDistributionTestFixture, AgradDistributionWiener_v_4365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4366, AgradDistributionTestFixture, AgradDistributionWiener_v_4366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4367, AgradDistributionTestFixture, AgradDistributionWiener_v_4367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4368, AgradDistributionTestFixture, AgradDistributionWiener_v_4368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4369, AgradDistributionTestFixture, AgradDistributionWiener_v_4369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4370, AgradDistributionTestFixture, AgradDistributionWiener_v_4370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4371, AgradDistributionTestFixture, AgradDistributionWiener_v_4371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4372, AgradDistributionTestFixture, AgradDistributionWiener_v_4372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4373, AgradDistributionTestFixture, AgradDistributionWiener_v_4373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4374, AgradDistributionTestFixture, AgradDistributionWiener_v_4374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4375, AgradDistributionTestFixture, AgradDistributionWiener_v_4375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4376, AgradDistributionTestFixture, AgradDistributionWiener_v_4376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4377, AgradDistributionTestFixture, AgradDistributionWiener_v_4377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4378, AgradDistributionTestFixture, AgradDistributionWiener_v_4378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4379, AgradDistributionTestFixture, AgradDistributionWiener_v_4379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4380, AgradDistributionTestFixture, AgradDistributionWiener_v_4380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4381, AgradDistributionTestFixture, AgradDistributionWiener_v_4381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4382, AgradDistributionTestFixture, AgradDistributionWiener_v_4382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4383, AgradDistributionTestFixture, AgradDistributionWiener_v_4383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4384, AgradDistributionTestFixture, AgradDistributionWiener_v_4384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4385, AgradDistributionTestFixture, AgradDistributionWiener_v_4385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4386, AgradDistributionTestFixture, AgradDistributionWiener_v_4386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4387, AgradDistributionTestFixture, AgradDistributionWiener_v_4387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4388, AgradDistributionTestFixture, AgradDistributionWiener_v_4388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4389, AgradDistributionTestFixture, AgradDistributionWiener_v_4389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4390, AgradDistributionTestFixture, AgradDistributionWiener_v_4390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4391, AgradDistributionTestFixture, AgradDistributionWiener_v_4391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4392, AgradDistributionTestFixture, AgradDistributionWiener_v_4392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4393, AgradDistributionTestFixture, AgradDistributionWiener_v_4393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4394, AgradDistributionTestFixture, AgradDistributionWiener_v_4394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4395, AgradDistributionTestFixture, AgradDistributionWiener_v_4395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4396, AgradDistributionTestFixture, AgradDistributionWiener_v_4396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4397, AgradDistributionTestFixture, AgradDistributionWiener_v_4397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4398, AgradDistributionTestFixture, AgradDistributionWiener_v_4398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4399, AgradDistributionTestFixture, AgradDistributionWiener_v_4399);
+
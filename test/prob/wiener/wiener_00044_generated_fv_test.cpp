@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4400;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, double, double, empty> type_fv_4401;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, double, std::vector<double>, empty> type_fv_4402;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4403;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, double, fvar<var>, empty> type_fv_4404;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_4405;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4406;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<double>, double, empty> type_fv_4407;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_4408;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4409;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_4410;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4411;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4412;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4413;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4414;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4415;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4416;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4417;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4418;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, fvar<var>, double, empty> type_fv_4419;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_4420;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4421;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_4422;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4423;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4424;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_4425;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4426;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4427;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4428;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4429;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4430;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4431;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4432;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4433;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4434;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4435;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4436;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, double, double, empty> type_fv_4437;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_4438;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4439;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_4440;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_4441;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4442;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_4443;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_4444;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4445;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_4446;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4447;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4448;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4449;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4450;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4451;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4452;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4453;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4454;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_4455;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_4456;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4457;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_4458;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4459;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4460;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_4461;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4462;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4463;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4464;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4465;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4466;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4467;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4468;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4469;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4470;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4471;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4472;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_4473;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_4474;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4475;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_4476;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_4477;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4478;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_4479;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_4480;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4481;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_4482;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4483;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4484;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4485;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4486;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4487;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4488;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4489;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4490;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_4491;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_4492;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4493;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_4494;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4495;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4496;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_4497;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4498;
+typedef boost::mpl::vector<fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4400> AgradDistributionWiener_fv_4400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4401> AgradDistributionWiener_fv_4401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4402> AgradDistributionWiener_fv_4402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4403> AgradDistributionWiener_fv_4403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4404> AgradDistributionWiener_fv_4404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4405> AgradDistributionWiener_fv_4405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4406> AgradDistributionWiener_fv_4406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4407> AgradDistributionWiener_fv_4407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4408> AgradDistributionWiener_fv_4408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4409> AgradDistributionWiener_fv_4409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4410> AgradDistributionWiener_fv_4410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4411> AgradDistributionWiener_fv_4411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4412> AgradDistributionWiener_fv_4412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4413> AgradDistributionWiener_fv_4413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4414> AgradDistributionWiener_fv_4414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4415> AgradDistributionWiener_fv_4415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4416> AgradDistributionWiener_fv_4416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4417> AgradDistributionWiener_fv_4417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4418> AgradDistributionWiener_fv_4418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4419> AgradDistributionWiener_fv_4419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4420> AgradDistributionWiener_fv_4420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4421> AgradDistributionWiener_fv_4421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4422> AgradDistributionWiener_fv_4422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4423> AgradDistributionWiener_fv_4423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4424> AgradDistributionWiener_fv_4424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4425> AgradDistributionWiener_fv_4425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4426> AgradDistributionWiener_fv_4426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4427> AgradDistributionWiener_fv_4427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4428> AgradDistributionWiener_fv_4428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4429> AgradDistributionWiener_fv_4429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4430> AgradDistributionWiener_fv_4430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4431> AgradDistributionWiener_fv_4431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4432> AgradDistributionWiener_fv_4432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4433> AgradDistributionWiener_fv_4433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4434> AgradDistributionWiener_fv_4434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4435> AgradDistributionWiener_fv_4435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4436> AgradDistributionWiener_fv_4436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4437> AgradDistributionWiener_fv_4437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4438> AgradDistributionWiener_fv_4438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4439> AgradDistributionWiener_fv_4439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4440> AgradDistributionWiener_fv_4440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4441> AgradDistributionWiener_fv_4441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4442> AgradDistributionWiener_fv_4442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4443> AgradDistributionWiener_fv_4443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4444> AgradDistributionWiener_fv_4444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4445> AgradDistributionWiener_fv_4445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4446> AgradDistributionWiener_fv_4446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4447> AgradDistributionWiener_fv_4447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4448> AgradDistributionWiener_fv_4448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4449> AgradDistributionWiener_fv_4449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4450> AgradDistributionWiener_fv_4450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4451> AgradDistributionWiener_fv_4451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4452> AgradDistributionWiener_fv_4452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4453> AgradDistributionWiener_fv_4453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4454> AgradDistributionWiener_fv_4454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4455> AgradDistributionWiener_fv_4455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4456> AgradDistributionWiener_fv_4456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4457> AgradDistributionWiener_fv_4457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4458> AgradDistributionWiener_fv_4458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4459> AgradDistributionWiener_fv_4459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4460> AgradDistributionWiener_fv_4460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4461> AgradDistributionWiener_fv_4461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4462> AgradDistributionWiener_fv_4462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4463> AgradDistributionWiener_fv_4463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4464> AgradDistributionWiener_fv_4464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4465> AgradDistributionWiener_fv_4465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4466> AgradDistributionWiener_fv_4466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4467> AgradDistributionWiener_fv_4467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4468> AgradDistributionWiener_fv_4468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4469> AgradDistributionWiener_fv_4469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4470> AgradDistributionWiener_fv_4470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4471> AgradDistributionWiener_fv_4471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4472> AgradDistributionWiener_fv_4472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4473> AgradDistributionWiener_fv_4473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4474> AgradDistributionWiener_fv_4474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4475> AgradDistributionWiener_fv_4475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4476> AgradDistributionWiener_fv_4476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4477> AgradDistributionWiener_fv_4477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4478> AgradDistributionWiener_fv_4478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4479> AgradDistributionWiener_fv_4479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4480> AgradDistributionWiener_fv_4480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4481> AgradDistributionWiener_fv_4481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4482> AgradDistributionWiener_fv_4482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4483> AgradDistributionWiener_fv_4483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4484> AgradDistributionWiener_fv_4484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4485> AgradDistributionWiener_fv_4485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4486> AgradDistributionWiener_fv_4486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4487> AgradDistributionWiener_fv_4487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4488> AgradDistributionWiener_fv_4488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4489> AgradDistributionWiener_fv_4489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4490> AgradDistributionWiener_fv_4490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4491> AgradDistributionWiener_fv_4491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4492> AgradDistributionWiener_fv_4492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4493> AgradDistributionWiener_fv_4493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4494> AgradDistributionWiener_fv_4494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4495> AgradDistributionWiener_fv_4495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4496> AgradDistributionWiener_fv_4496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4497> AgradDistributionWiener_fv_4497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4498> AgradDistributionWiener_fv_4498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4499> AgradDistributionWiener_fv_4499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4400, AgradDistributionTestFixture, AgradDistributionWiener_fv_4400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4401, AgradDistributionTestFixture, AgradDistributionWiener_fv_4401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4402, AgradDistributionTestFixture, AgradDistributionWiener_fv_4402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4403, AgradDistributionTestFixture, AgradDistributionWiener_fv_4403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4404, AgradDistributionTestFixture, AgradDistributionWiener_fv_4404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4405, AgradDistributionTestFixture, AgradDistributionWiener_fv_4405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4406, AgradDistributionTestFixture, AgradDistributionWiener_fv_4406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4407, AgradDistributionTestFixture, AgradDistributionWiener_fv_4407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4408, AgradDistributionTestFixture, AgradDistributionWiener_fv_4408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4409, AgradDistributionTestFixture, AgradDistributionWiener_fv_4409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4410, AgradDistributionTestFixture, AgradDistributionWiener_fv_4410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4411, AgradDistributionTestFixture, AgradDistributionWiener_fv_4411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4412, AgradDistributionTestFixture, AgradDistributionWiener_fv_4412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4413, AgradDistributionTestFixture, AgradDistributionWiener_fv_4413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4414, AgradDistributionTestFixture, AgradDistributionWiener_fv_4414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4415, AgradDistributionTestFixture, AgradDistributionWiener_fv_4415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4416, AgradDistributionTestFixture, AgradDistributionWiener_fv_4416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4417, AgradDistributionTestFixture, AgradDistributionWiener_fv_4417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4418, AgradDistributionTestFixture, AgradDistributionWiener_fv_4418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4419, AgradDistributionTestFixture, AgradDistributionWiener_fv_4419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4420, AgradDistributionTestFixture, AgradDistributionWiener_fv_4420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4421, AgradDistributionTestFixture, AgradDistributionWiener_fv_4421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4422, AgradDistributionTestFixture, AgradDistributionWiener_fv_4422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4423, AgradDistributionTestFixture, AgradDistributionWiener_fv_4423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4424, AgradDistributionTestFixture, AgradDistributionWiener_fv_4424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4425, AgradDistributionTestFixture, AgradDistributionWiener_fv_4425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4426, AgradDistributionTestFixture, AgradDistributionWiener_fv_4426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4427, AgradDistributionTestFixture, AgradDistributionWiener_fv_4427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4428, AgradDistributionTestFixture, AgradDistributionWiener_fv_4428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4429, AgradDistributionTestFixture, AgradDistributionWiener_fv_4429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4430, AgradDistributionTestFixture, AgradDistributionWiener_fv_4430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4431, AgradDistributionTestFixture, AgradDistributionWiener_fv_4431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4432, AgradDistributionTestFixture, AgradDistributionWiener_fv_4432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4433, AgradDistributionTestFixture, AgradDistributionWiener_fv_4433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4434, AgradDistributionTestFixture, AgradDistributionWiener_fv_4434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4435, AgradDistributionTestFixture, AgradDistributionWiener_fv_4435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4436, AgradDistributionTestFixture, AgradDistributionWiener_fv_4436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4437, AgradDistributionTestFixture, AgradDistributionWiener_fv_4437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4438, AgradDistributionTestFixture, AgradDistributionWiener_fv_4438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4439, AgradDistributionTestFixture, AgradDistributionWiener_fv_4439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4440, AgradDistributionTestFixture, AgradDistributionWiener_fv_4440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4441, AgradDistributionTestFixture, AgradDistributionWiener_fv_4441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4442, AgradDistributionTestFixture, AgradDistributionWiener_fv_4442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4443, AgradDistributionTestFixture, AgradDistributionWiener_fv_4443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4444, AgradDistributionTestFixture, AgradDistributionWiener_fv_4444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4445, AgradDistributionTestFixture, AgradDistributionWiener_fv_4445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4446, AgradDistributionTestFixture, AgradDistributionWiener_fv_4446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4447, AgradDistributionTestFixture, AgradDistributionWiener_fv_4447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4448, AgradDistributionTestFixture, AgradDistributionWiener_fv_4448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4449, AgradDistributionTestFixture, AgradDistributionWiener_fv_4449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4450, AgradDistributionTestFixture, AgradDistributionWiener_fv_4450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4451, AgradDistributionTestFixture, AgradDistributionWiener_fv_4451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4452, AgradDistributionTestFixture, AgradDistributionWiener_fv_4452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4453, AgradDistributionTestFixture, AgradDistributionWiener_fv_4453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4454, AgradDistributionTestFixture, AgradDistributionWiener_fv_4454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4455, AgradDistributionTestFixture, AgradDistributionWiener_fv_4455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4456, AgradDistributionTestFixture, AgradDistributionWiener_fv_4456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4457, AgradDistributionTestFixture, AgradDistributionWiener_fv_4457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4458, AgradDistributionTestFixture, AgradDistributionWiener_fv_4458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4459, AgradDistributionTestFixture, AgradDistributionWiener_fv_4459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4460, AgradDistributionTestFixture, AgradDistributionWiener_fv_4460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4461, AgradDistributionTestFixture, AgradDistributionWiener_fv_4461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4462, AgradDistributionTestFixture, AgradDistributionWiener_fv_4462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4463, AgradDistributionTestFixture, AgradDistributionWiener_fv_4463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4464, AgradDistributionTestFixture, AgradDistributionWiener_fv_4464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4465, AgradDistributionTestFixture, AgradDistributionWiener_fv_4465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4466, AgradDistributionTestFixture, AgradDistributionWiener_fv_4466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4467, AgradDistributionTestFixture, AgradDistributionWiener_fv_4467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4468, AgradDistributionTestFixture, AgradDistributionWiener_fv_4468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4469, AgradDistributionTestFixture, AgradDistributionWiener_fv_4469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4470, AgradDistributionTestFixture, AgradDistributionWiener_fv_4470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4471, AgradDistributionTestFixture, AgradDistributionWiener_fv_4471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4472, AgradDistributionTestFixture, AgradDistributionWiener_fv_4472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4473, AgradDistributionTestFixture, AgradDistributionWiener_fv_4473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4474, AgradDistributionTestFixture, AgradDistributionWiener_fv_4474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4475, AgradDistributionTestFixture, AgradDistributionWiener_fv_4475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4476, AgradDistributionTestFixture, AgradDistributionWiener_fv_4476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4477, AgradDistributionTestFixture, AgradDistributionWiener_fv_4477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4478, AgradDistributionTestFixture, AgradDistributionWiener_fv_4478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4479, AgradDistributionTestFixture, AgradDistributionWiener_fv_4479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4480, AgradDistributionTestFixture, AgradDistributionWiener_fv_4480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4481, AgradDistributionTestFixture, AgradDistributionWiener_fv_4481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4482, AgradDistributionTestFixture, AgradDistributionWiener_fv_4482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4483, AgradDistributionTestFixture, AgradDistributionWiener_fv_4483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4484, AgradDistributionTestFixture, AgradDistributionWiener_fv_4484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4485, AgradDistributionTestFixture, AgradDistributionWiener_fv_4485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4486, AgradDistributionTestFixture, AgradDistributionWiener_fv_4486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4487, AgradDistributionTestFixture, AgradDistributionWiener_fv_4487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4488, AgradDistributionTestFixture, AgradDistributionWiener_fv_4488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4489, AgradDistributionTestFixture, AgradDistributionWiener_fv_4489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4490, AgradDistributionTestFixture, AgradDistributionWiener_fv_4490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4491, AgradDistributionTestFixture, AgradDistributionWiener_fv_4491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4492, AgradDistributionTestFixture, AgradDistributionWiener_fv_4492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4493, AgradDistributionTestFixture, AgradDistributionWiener_fv_4493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4494, AgradDistributionTestFixture, AgradDistributionWiener_fv_4494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4495, AgradDistributionTestFixture, AgradDistributionWiener_fv_4495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4496, AgradDistributionTestFixture, AgradDistributionWiener_fv_4496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4497, AgradDistributionTestFixture, AgradDistributionWiener_fv_4497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4498, AgradDistributionTestFixture, AgradDistributionWiener_fv_4498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4499, AgradDistributionTestFixture, AgradDistributionWiener_fv_4499);
+
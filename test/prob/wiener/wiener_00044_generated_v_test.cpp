@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4400;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_4401;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_4402;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4403;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4404;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4405;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4406;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4407;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4408;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4409;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_4410;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_4411;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4412;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_4413;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_4414;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4415;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_4416;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_4417;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4418;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_4419;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_4420;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4421;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4422;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4423;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4424;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4425;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4426;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4427;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty> type_v_4428;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_4429;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4430;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty> type_v_4431;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_4432;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4433;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_4434;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_4435;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4436;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_4437;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_4438;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4439;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4440;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4441;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4442;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4443;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4444;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4445;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty> type_v_4446;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty> type_v_4447;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4448;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty> type_v_4449;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_4450;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4451;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_4452;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_4453;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4454;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_4455;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_4456;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4457;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4458;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4459;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4460;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4461;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4462;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4463;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_4464;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_4465;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4466;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_4467;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_4468;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4469;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_4470;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_4471;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4472;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_4473;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_4474;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4475;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4476;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4477;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4478;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4479;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4480;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4481;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_4482;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_4483;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4484;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_4485;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_4486;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4487;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_4488;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_4489;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4490;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_4491;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_4492;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4493;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4494;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4495;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4496;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4497;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4498;
+typedef boost::mpl::vector<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4400> AgradDistributionWiener_v_4400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4401> AgradDistributionWiener_v_4401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4402> AgradDistributionWiener_v_4402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4403> AgradDistributionWiener_v_4403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4404> AgradDistributionWiener_v_4404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4405> AgradDistributionWiener_v_4405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4406> AgradDistributionWiener_v_4406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4407> AgradDistributionWiener_v_4407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4408> AgradDistributionWiener_v_4408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4409> AgradDistributionWiener_v_4409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4410> AgradDistributionWiener_v_4410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4411> AgradDistributionWiener_v_4411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4412> AgradDistributionWiener_v_4412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4413> AgradDistributionWiener_v_4413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4414> AgradDistributionWiener_v_4414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4415> AgradDistributionWiener_v_4415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4416> AgradDistributionWiener_v_4416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4417> AgradDistributionWiener_v_4417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4418> AgradDistributionWiener_v_4418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4419> AgradDistributionWiener_v_4419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4420> AgradDistributionWiener_v_4420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4421> AgradDistributionWiener_v_4421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4422> AgradDistributionWiener_v_4422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4423> AgradDistributionWiener_v_4423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4424> AgradDistributionWiener_v_4424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4425> AgradDistributionWiener_v_4425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4426> AgradDistributionWiener_v_4426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4427> AgradDistributionWiener_v_4427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4428> AgradDistributionWiener_v_4428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4429> AgradDistributionWiener_v_4429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4430> AgradDistributionWiener_v_4430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4431> AgradDistributionWiener_v_4431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4432> AgradDistributionWiener_v_4432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4433> AgradDistributionWiener_v_4433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4434> AgradDistributionWiener_v_4434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4435> AgradDistributionWiener_v_4435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4436> AgradDistributionWiener_v_4436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4437> AgradDistributionWiener_v_4437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4438> AgradDistributionWiener_v_4438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4439> AgradDistributionWiener_v_4439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4440> AgradDistributionWiener_v_4440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4441> AgradDistributionWiener_v_4441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4442> AgradDistributionWiener_v_4442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4443> AgradDistributionWiener_v_4443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4444> AgradDistributionWiener_v_4444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4445> AgradDistributionWiener_v_4445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4446> AgradDistributionWiener_v_4446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4447> AgradDistributionWiener_v_4447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4448> AgradDistributionWiener_v_4448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4449> AgradDistributionWiener_v_4449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4450> AgradDistributionWiener_v_4450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4451> AgradDistributionWiener_v_4451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4452> AgradDistributionWiener_v_4452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4453> AgradDistributionWiener_v_4453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4454> AgradDistributionWiener_v_4454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4455> AgradDistributionWiener_v_4455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4456> AgradDistributionWiener_v_4456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4457> AgradDistributionWiener_v_4457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4458> AgradDistributionWiener_v_4458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4459> AgradDistributionWiener_v_4459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4460> AgradDistributionWiener_v_4460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4461> AgradDistributionWiener_v_4461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4462> AgradDistributionWiener_v_4462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4463> AgradDistributionWiener_v_4463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4464> AgradDistributionWiener_v_4464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4465> AgradDistributionWiener_v_4465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4466> AgradDistributionWiener_v_4466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4467> AgradDistributionWiener_v_4467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4468> AgradDistributionWiener_v_4468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4469> AgradDistributionWiener_v_4469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4470> AgradDistributionWiener_v_4470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4471> AgradDistributionWiener_v_4471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4472> AgradDistributionWiener_v_4472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4473> AgradDistributionWiener_v_4473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4474> AgradDistributionWiener_v_4474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4475> AgradDistributionWiener_v_4475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4476> AgradDistributionWiener_v_4476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4477> AgradDistributionWiener_v_4477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4478> AgradDistributionWiener_v_4478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4479> AgradDistributionWiener_v_4479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4480> AgradDistributionWiener_v_4480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4481> AgradDistributionWiener_v_4481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4482> AgradDistributionWiener_v_4482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4483> AgradDistributionWiener_v_4483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4484> AgradDistributionWiener_v_4484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4485> AgradDistributionWiener_v_4485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4486> AgradDistributionWiener_v_4486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4487> AgradDistributionWiener_v_4487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4488> AgradDistributionWiener_v_4488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4489> AgradDistributionWiener_v_4489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4490> AgradDistributionWiener_v_4490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4491> AgradDistributionWiener_v_4491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4492> AgradDistributionWiener_v_4492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4493> AgradDistributionWiener_v_4493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4494> AgradDistributionWiener_v_4494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4495> AgradDistributionWiener_v_4495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4496> AgradDistributionWiener_v_4496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4497> AgradDistributionWiener_v_4497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4498> AgradDistributionWiener_v_4498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4499> AgradDistributionWiener_v_4499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4400, AgradDistributionTestFixture, AgradDistributionWiener_v_4400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4401, AgradDistributionTestFixture, AgradDistributionWiener_v_4401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4402, AgradDistributionTestFixture, AgradDistributionWiener_v_4402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4403, AgradDistributionTestFixture, AgradDistributionWiener_v_4403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4404, AgradDistributionTestFixture, AgradDistributionWiener_v_4404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4405, AgradDistributionTestFixture, AgradDistributionWiener_v_4405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4406, AgradDistributionTestFixture, AgradDistributionWiener_v_4406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4407, AgradDistributionTestFixture, AgradDistributionWiener_v_4407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4408, AgradDistributionTestFixture, AgradDistributionWiener_v_4408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4409, AgradDistributionTestFixture, AgradDistributionWiener_v_4409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4410, AgradDistributionTestFixture, AgradDistributionWiener_v_4410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4411, AgradDistributionTestFixture, AgradDistributionWiener_v_4411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4412, AgradDistributionTestFixture, AgradDistributionWiener_v_4412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4413, AgradDistributionTestFixture, AgradDistributionWiener_v_4413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4414, AgradDistributionTestFixture, AgradDistributionWiener_v_4414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4415, AgradDistributionTestFixture, AgradDistributionWiener_v_4415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4416, AgradDistributionTestFixture, AgradDistributionWiener_v_4416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4417, AgradDistributionTestFixture, AgradDistributionWiener_v_4417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4418, AgradDistributionTestFixture, AgradDistributionWiener_v_4418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4419, AgradDistributionTestFixture, AgradDistributionWiener_v_4419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4420, AgradDistributionTestFixture, AgradDistributionWiener_v_4420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4421, AgradDistributionTestFixture, AgradDistributionWiener_v_4421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4422, AgradDistributionTestFixture, AgradDistributionWiener_v_4422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4423, AgradDistributionTestFixture, AgradDistributionWiener_v_4423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4424, AgradDistributionTestFixture, AgradDistributionWiener_v_4424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4425, AgradDistributionTestFixture, AgradDistributionWiener_v_4425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4426, AgradDistributionTestFixture, AgradDistributionWiener_v_4426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4427, AgradDistributionTestFixture, AgradDistributionWiener_v_4427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4428, AgradDistributionTestFixture, AgradDistributionWiener_v_4428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4429, AgradDistributionTestFixture, AgradDistributionWiener_v_4429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4430, AgradDistributionTestFixture, AgradDistributionWiener_v_4430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4431, AgradDistributionTestFixture, AgradDistributionWiener_v_4431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4432, AgradDistributionTestFixture, AgradDistributionWiener_v_4432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4433, AgradDistributionTestFixture, AgradDistributionWiener_v_4433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4434, AgradDistributionTestFixture, AgradDistributionWiener_v_4434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4435, AgradDistributionTestFixture, AgradDistributionWiener_v_4435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4436, AgradDistributionTestFixture, AgradDistributionWiener_v_4436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4437, AgradDistributionTestFixture, AgradDistributionWiener_v_4437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4438, AgradDistributionTestFixture, AgradDistributionWiener_v_4438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4439, AgradDistributionTestFixture, AgradDistributionWiener_v_4439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4440, AgradDistributionTestFixture, AgradDistributionWiener_v_4440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4441, AgradDistributionTestFixture, AgradDistributionWiener_v_4441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4442, AgradDistributionTestFixture, AgradDistributionWiener_v_4442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4443, AgradDistributionTestFixture, AgradDistributionWiener_v_4443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4444, AgradDistributionTestFixture, AgradDistributionWiener_v_4444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4445, AgradDistributionTestFixture, AgradDistributionWiener_v_4445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4446, AgradDistributionTestFixture, AgradDistributionWiener_v_4446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4447, AgradDistributionTestFixture, AgradDistributionWiener_v_4447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4448, AgradDistributionTestFixture, AgradDistributionWiener_v_4448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4449, AgradDistributionTestFixture, AgradDistributionWiener_v_4449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4450, AgradDistributionTestFixture, AgradDistributionWiener_v_4450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4451, AgradDistributionTestFixture, AgradDistributionWiener_v_4451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4452, AgradDistributionTestFixture, AgradDistributionWiener_v_4452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4453, AgradDistributionTestFixture, AgradDistributionWiener_v_4453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4454, AgradDistributionTestFixture, AgradDistributionWiener_v_4454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4455, AgradDistributionTestFixture, AgradDistributionWiener_v_4455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4456, AgradDistributionTestFixture, AgradDistributionWiener_v_4456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4457, AgradDistributionTestFixture, AgradDistributionWiener_v_4457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4458, AgradDistributionTestFixture, AgradDistributionWiener_v_4458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4459, AgradDistributionTestFixture, AgradDistributionWiener_v_4459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4460, AgradDistributionTestFixture, AgradDistributionWiener_v_4460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4461, AgradDistributionTestFixture, AgradDistributionWiener_v_4461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4462, AgradDistributionTestFixture, AgradDistributionWiener_v_4462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4463, AgradDistributionTestFixture, AgradDistributionWiener_v_4463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4464, AgradDistributionTestFixture, AgradDistributionWiener_v_4464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4465, AgradDistributionTestFixture, AgradDistributionWiener_v_4465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4466, AgradDistributionTestFixture, AgradDistributionWiener_v_4466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4467, AgradDistributionTestFixture, AgradDistributionWiener_v_4467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4468, AgradDistributionTestFixture, AgradDistributionWiener_v_4468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4469, AgradDistributionTestFixture, AgradDistributionWiener_v_4469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4470, AgradDistributionTestFixture, AgradDistributionWiener_v_4470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4471, AgradDistributionTestFixture, AgradDistributionWiener_v_4471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4472, AgradDistributionTestFixture, AgradDistributionWiener_v_4472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4473, AgradDistributionTestFixture, AgradDistributionWiener_v_4473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4474, AgradDistributionTestFixture, AgradDistributionWiener_v_4474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4475, AgradDistributionTestFixture, AgradDistributionWiener_v_4475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4476, AgradDistributionTestFixture, AgradDistributionWiener_v_4476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4477, AgradDistributionTestFixture, AgradDistributionWiener_v_4477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4478, AgradDistributionTestFixture, AgradDistributionWiener_v_4478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4479, AgradDistributionTestFixture, AgradDistributionWiener_v_4479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4480, AgradDistributionTestFixture, AgradDistributionWiener_v_4480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4481, AgradDistributionTestFixture, AgradDistributionWiener_v_4481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4482, AgradDistributionTestFixture, AgradDistributionWiener_v_4482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4483, AgradDistributionTestFixture, AgradDistributionWiener_v_4483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4484, AgradDistributionTestFixture, AgradDistributionWiener_v_4484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4485, AgradDistributionTestFixture, AgradDistributionWiener_v_4485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4486, AgradDistributionTestFixture, AgradDistributionWiener_v_4486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4487, AgradDistributionTestFixture, AgradDistributionWiener_v_4487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4488, AgradDistributionTestFixture, AgradDistributionWiener_v_4488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4489, AgradDistributionTestFixture, AgradDistributionWiener_v_4489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4490, AgradDistributionTestFixture, AgradDistributionWiener_v_4490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4491, AgradDistributionTestFixture, AgradDistributionWiener_v_4491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4492, AgradDistributionTestFixture, AgradDistributionWiener_v_4492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4493, AgradDistributionTestFixture, AgradDistributionWiener_v_4493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4494, AgradDistributionTestFixture, AgradDistributionWiener_v_4494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4495, AgradDistributionTestFixture, AgradDistributionWiener_v_4495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4496, AgradDistributionTestFixture, AgradDistributionWiener_v_4496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4497, AgradDistributionTestFixture, AgradDistributionWiener_v_4497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4498, AgradDistributionTestFixture, AgradDistributionWiener_v_4498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4499, AgradDistributionTestFixture, AgradDistributionWiener_v_4499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4500;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4501;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4502;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4503;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4504;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4505;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4506;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4507;
+typedef boost::mpl::vector<fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4508;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, double, double, empty> type_fd_4509;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, double, std::vector<double>, empty> type_fd_4510;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4511;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, double, fvar<double>, empty> type_fd_4512;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, empty> type_fd_4513;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4514;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, double, empty> type_fd_4515;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, empty> type_fd_4516;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4517;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, empty> type_fd_4518;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4519;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4520;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4521;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4522;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4523;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4524;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4525;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4526;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, fvar<double>, double, empty> type_fd_4527;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, fvar<double>, std::vector<double>, empty> type_fd_4528;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4529;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, fvar<double>, fvar<double>, empty> type_fd_4530;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4531;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4532;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, double, empty> type_fd_4533;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4534;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4535;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4536;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4537;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4538;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4539;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4540;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4541;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4542;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4543;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4544;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, double, empty> type_fd_4545;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, empty> type_fd_4546;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4547;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, empty> type_fd_4548;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_4549;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4550;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, empty> type_fd_4551;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_4552;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4553;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_4554;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4555;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4556;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4557;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4558;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4559;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4560;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4561;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4562;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, double, empty> type_fd_4563;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_4564;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4565;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_4566;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4567;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4568;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_4569;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4570;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4571;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4572;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4573;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4574;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4575;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4576;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4577;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4578;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4579;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4580;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fd_4581;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_4582;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4583;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_4584;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_4585;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4586;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_4587;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_4588;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4589;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_4590;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4591;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4592;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4593;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4594;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4595;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4596;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4597;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4598;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_4599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4500> AgradDistributionWiener_fd_4500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4501> AgradDistributionWiener_fd_4501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4502> AgradDistributionWiener_fd_4502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4503> AgradDistributionWiener_fd_4503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4504> AgradDistributionWiener_fd_4504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4505> AgradDistributionWiener_fd_4505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4506> AgradDistributionWiener_fd_4506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4507> AgradDistributionWiener_fd_4507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4508> AgradDistributionWiener_fd_4508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4509> AgradDistributionWiener_fd_4509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4510> AgradDistributionWiener_fd_4510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4511> AgradDistributionWiener_fd_4511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4512> AgradDistributionWiener_fd_4512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4513> AgradDistributionWiener_fd_4513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4514> AgradDistributionWiener_fd_4514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4515> AgradDistributionWiener_fd_4515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4516> AgradDistributionWiener_fd_4516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4517> AgradDistributionWiener_fd_4517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4518> AgradDistributionWiener_fd_4518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4519> AgradDistributionWiener_fd_4519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4520> AgradDistributionWiener_fd_4520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4521> AgradDistributionWiener_fd_4521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4522> AgradDistributionWiener_fd_4522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4523> AgradDistributionWiener_fd_4523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4524> AgradDistributionWiener_fd_4524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4525> AgradDistributionWiener_fd_4525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4526> AgradDistributionWiener_fd_4526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4527> AgradDistributionWiener_fd_4527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4528> AgradDistributionWiener_fd_4528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4529> AgradDistributionWiener_fd_4529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4530> AgradDistributionWiener_fd_4530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4531> AgradDistributionWiener_fd_4531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4532> AgradDistributionWiener_fd_4532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4533> AgradDistributionWiener_fd_4533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4534> AgradDistributionWiener_fd_4534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4535> AgradDistributionWiener_fd_4535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4536> AgradDistributionWiener_fd_4536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4537> AgradDistributionWiener_fd_4537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4538> AgradDistributionWiener_fd_4538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4539> AgradDistributionWiener_fd_4539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4540> AgradDistributionWiener_fd_4540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4541> AgradDistributionWiener_fd_4541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4542> AgradDistributionWiener_fd_4542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4543> AgradDistributionWiener_fd_4543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4544> AgradDistributionWiener_fd_4544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4545> AgradDistributionWiener_fd_4545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4546> AgradDistributionWiener_fd_4546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4547> AgradDistributionWiener_fd_4547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4548> AgradDistributionWiener_fd_4548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4549> AgradDistributionWiener_fd_4549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4550> AgradDistributionWiener_fd_4550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4551> AgradDistributionWiener_fd_4551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4552> AgradDistributionWiener_fd_4552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4553> AgradDistributionWiener_fd_4553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4554> AgradDistributionWiener_fd_4554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4555> AgradDistributionWiener_fd_4555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4556> AgradDistributionWiener_fd_4556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4557> AgradDistributionWiener_fd_4557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4558> AgradDistributionWiener_fd_4558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4559> AgradDistributionWiener_fd_4559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4560> AgradDistributionWiener_fd_4560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4561> AgradDistributionWiener_fd_4561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4562> AgradDistributionWiener_fd_4562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4563> AgradDistributionWiener_fd_4563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4564> AgradDistributionWiener_fd_4564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4565> AgradDistributionWiener_fd_4565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4566> AgradDistributionWiener_fd_4566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4567> AgradDistributionWiener_fd_4567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4568> AgradDistributionWiener_fd_4568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4569> AgradDistributionWiener_fd_4569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4570> AgradDistributionWiener_fd_4570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4571> AgradDistributionWiener_fd_4571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4572> AgradDistributionWiener_fd_4572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4573> AgradDistributionWiener_fd_4573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4574> AgradDistributionWiener_fd_4574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4575> AgradDistributionWiener_fd_4575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4576> AgradDistributionWiener_fd_4576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4577> AgradDistributionWiener_fd_4577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4578> AgradDistributionWiener_fd_4578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4579> AgradDistributionWiener_fd_4579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4580> AgradDistributionWiener_fd_4580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4581> AgradDistributionWiener_fd_4581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4582> AgradDistributionWiener_fd_4582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4583> AgradDistributionWiener_fd_4583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4584> AgradDistributionWiener_fd_4584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4585> AgradDistributionWiener_fd_4585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4586> AgradDistributionWiener_fd_4586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4587> AgradDistributionWiener_fd_4587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4588> AgradDistributionWiener_fd_4588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4589> AgradDistributionWiener_fd_4589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4590> AgradDistributionWiener_fd_4590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4591> AgradDistributionWiener_fd_4591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4592> AgradDistributionWiener_fd_4592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4593> AgradDistributionWiener_fd_4593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4594> AgradDistributionWiener_fd_4594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4595> AgradDistributionWiener_fd_4595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4596> AgradDistributionWiener_fd_4596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4597> AgradDistributionWiener_fd_4597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4598> AgradDistributionWiener_fd_4598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4599> AgradDistributionWiener_fd_4599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4500, AgradDistributionTestFixture, AgradDistributionWiener_fd_4500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4501, AgradDistributionTestFixture, AgradDistributionWiener_fd_4501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4502, AgradDistributionTestFixture, AgradDistributionWiener_fd_4502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4503, AgradDistributionTestFixture, AgradDistributionWiener_fd_4503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4504, AgradDistributionTestFixture, AgradDistributionWiener_fd_4504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4505, AgradDistributionTestFixture, AgradDistributionWiener_fd_4505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4506, AgradDistributionTestFixture, AgradDistributionWiener_fd_4506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4507, AgradDistributionTestFixture, AgradDistributionWiener_fd_4507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4508, AgradDistributionTestFixture, AgradDistributionWiener_fd_4508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4509, AgradDistributionTestFixture, AgradDistributionWiener_fd_4509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4510, AgradDistributionTestFixture, AgradDistributionWiener_fd_4510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4511, AgradDistributionTestFixture, AgradDistributionWiener_fd_4511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4512, AgradDistributionTestFixture, AgradDistributionWiener_fd_4512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4513, AgradDistributionTestFixture, AgradDistributionWiener_fd_4513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4514, AgradDistributionTestFixture, AgradDistributionWiener_fd_4514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4515, AgradDistributionTestFixture, AgradDistributionWiener_fd_4515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4516, AgradDistributionTestFixture, AgradDistributionWiener_fd_4516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4517, AgradDistributionTestFixture, AgradDistributionWiener_fd_4517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4518, AgradDistributionTestFixture, AgradDistributionWiener_fd_4518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4519, AgradDistributionTestFixture, AgradDistributionWiener_fd_4519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4520, AgradDistributionTestFixture, AgradDistributionWiener_fd_4520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4521, AgradDistributionTestFixture, AgradDistributionWiener_fd_4521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4522, AgradDistributionTestFixture, AgradDistributionWiener_fd_4522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4523, AgradDistributionTestFixture, AgradDistributionWiener_fd_4523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4524, AgradDistributionTestFixture, AgradDistributionWiener_fd_4524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4525, AgradDistributionTestFixture, AgradDistributionWiener_fd_4525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4526, AgradDistributionTestFixture, AgradDistributionWiener_fd_4526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4527, AgradDistributionTestFixture, AgradDistributionWiener_fd_4527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4528, AgradDistributionTestFixture, AgradDistributionWiener_fd_4528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4529, AgradDistributionTestFixture, AgradDistributionWiener_fd_4529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4530, AgradDistributionTestFixture, AgradDistributionWiener_fd_4530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4531, AgradDistributionTestFixture, AgradDistributionWiener_fd_4531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4532, AgradDistributionTestFixture, AgradDistributionWiener_fd_4532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4533, AgradDistributionTestFixture, AgradDistributionWiener_fd_4533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4534, AgradDistributionTestFixture, AgradDistributionWiener_fd_4534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4535, AgradDistributionTestFixture, AgradDistributionWiener_fd_4535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4536, AgradDistributionTestFixture, AgradDistributionWiener_fd_4536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4537, AgradDistributionTestFixture, AgradDistributionWiener_fd_4537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4538, AgradDistributionTestFixture, AgradDistributionWiener_fd_4538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4539, AgradDistributionTestFixture, AgradDistributionWiener_fd_4539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4540, AgradDistributionTestFixture, AgradDistributionWiener_fd_4540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4541, AgradDistributionTestFixture, AgradDistributionWiener_fd_4541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4542, AgradDistributionTestFixture, AgradDistributionWiener_fd_4542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4543, AgradDistributionTestFixture, AgradDistributionWiener_fd_4543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4544, AgradDistributionTestFixture, AgradDistributionWiener_fd_4544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4545, AgradDistributionTestFixture, AgradDistributionWiener_fd_4545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4546, AgradDistributionTestFixture, AgradDistributionWiener_fd_4546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4547, AgradDistributionTestFixture, AgradDistributionWiener_fd_4547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4548, AgradDistributionTestFixture, AgradDistributionWiener_fd_4548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4549, AgradDistributionTestFixture, AgradDistributionWiener_fd_4549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4550, AgradDistributionTestFixture, AgradDistributionWiener_fd_4550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4551, AgradDistributionTestFixture, AgradDistributionWiener_fd_4551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4552, AgradDistributionTestFixture, AgradDistributionWiener_fd_4552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4553, AgradDistributionTestFixture, AgradDistributionWiener_fd_4553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4554, AgradDistributionTestFixture, AgradDistributionWiener_fd_4554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4555, AgradDistributionTestFixture, AgradDistributionWiener_fd_4555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4556, AgradDistributionTestFixture, AgradDistributionWiener_fd_4556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4557, AgradDistributionTestFixture, AgradDistributionWiener_fd_4557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4558, AgradDistributionTestFixture, AgradDistributionWiener_fd_4558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4559, AgradDistributionTestFixture, AgradDistributionWiener_fd_4559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4560, AgradDistributionTestFixture, AgradDistributionWiener_fd_4560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4561, AgradDistributionTestFixture, AgradDistributionWiener_fd_4561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4562, AgradDistributionTestFixture, AgradDistributionWiener_fd_4562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4563, AgradDistributionTestFixture, AgradDistributionWiener_fd_4563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4564, AgradDistributionTestFixture, AgradDistributionWiener_fd_4564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4565, AgradDistributionTestFixture, AgradDistributionWiener_fd_4565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4566, AgradDistributionTestFixture, AgradDistributionWiener_fd_4566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4567, AgradDistributionTestFixture, AgradDistributionWiener_fd_4567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4568, AgradDistributionTestFixture, AgradDistributionWiener_fd_4568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4569, AgradDistributionTestFixture, AgradDistributionWiener_fd_4569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4570, AgradDistributionTestFixture, AgradDistributionWiener_fd_4570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4571, AgradDistributionTestFixture, AgradDistributionWiener_fd_4571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4572, AgradDistributionTestFixture, AgradDistributionWiener_fd_4572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4573, AgradDistributionTestFixture, AgradDistributionWiener_fd_4573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4574, AgradDistributionTestFixture, AgradDistributionWiener_fd_4574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4575, AgradDistributionTestFixture, AgradDistributionWiener_fd_4575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4576, AgradDistributionTestFixture, AgradDistributionWiener_fd_4576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4577, AgradDistributionTestFixture, AgradDistributionWiener_fd_4577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4578, AgradDistributionTestFixture, AgradDistributionWiener_fd_4578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4579, AgradDistributionTestFixture, AgradDistributionWiener_fd_4579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4580, AgradDistributionTestFixture, AgradDistributionWiener_fd_4580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4581, AgradDistributionTestFixture, AgradDistributionWiener_fd_4581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4582, AgradDistributionTestFixture, AgradDistributionWiener_fd_4582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4583, AgradDistributionTestFixture, AgradDistributionWiener_fd_4583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4584, AgradDistributionTestFixture, AgradDistributionWiener_fd_4584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4585, AgradDistributionTestFixture, AgradDistributionWiener_fd_4585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4586, AgradDistributionTestFixture, AgradDistributionWiener_fd_4586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4587, AgradDistributionTestFixture, AgradDistributionWiener_fd_4587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4588, AgradDistributionTestFixture, AgradDistributionWiener_fd_4588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4589, AgradDistributionTestFixture, AgradDistributionWiener_fd_4589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4590, AgradDistributionTestFixture, AgradDistributionWiener_fd_4590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4591, AgradDistributionTestFixture, AgradDistributionWiener_fd_4591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4592, AgradDistributionTestFixture, AgradDistributionWiener_fd_4592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4593, AgradDistributionTestFixture, AgradDistributionWiener_fd_4593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4594, AgradDistributionTestFixture, AgradDistributionWiener_fd_4594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4595, AgradDistributionTestFixture, AgradDistributionWiener_fd_4595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4596, AgradDistributionTestFixture, AgradDistributionWiener_fd_4596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4597, AgradDistributionTestFixture, AgradDistributionWiener_fd_4597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4598, AgradDistributionTestFixture, AgradDistributionWiener_fd_4598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4599, AgradDistributionTestFixture, AgradDistributionWiener_fd_4599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_4600;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4601;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_4602;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4603;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4604;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_4605;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4606;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4607;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4608;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4609;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4610;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4611;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4612;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4613;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4614;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4615;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4616;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, double, double, empty> type_fd_4617;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, double, std::vector<double>, empty> type_fd_4618;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4619;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, double, fvar<double>, empty> type_fd_4620;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_4621;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4622;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, double, empty> type_fd_4623;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_4624;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4625;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_4626;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4627;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4628;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4629;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4630;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4631;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4632;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4633;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4634;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, double, empty> type_fd_4635;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_4636;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4637;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_4638;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4639;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4640;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_4641;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4642;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4643;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4644;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4645;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4646;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4647;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4648;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4649;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4650;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4651;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4652;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, double, empty> type_fd_4653;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_4654;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4655;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_4656;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_4657;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4658;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_4659;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_4660;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4661;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_4662;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4663;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4664;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4665;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4666;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4667;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4668;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4669;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4670;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_4671;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_4672;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4673;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_4674;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4675;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4676;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_4677;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4678;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4679;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4680;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4681;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4682;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4683;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4684;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4685;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4686;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4687;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4688;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_4689;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_4690;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4691;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_4692;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_4693;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4694;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_4695;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_4696;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4697;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_4698;
+typedef boost::mpl::vector<fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4600> AgradDistributionWiener_fd_4600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4601> AgradDistributionWiener_fd_4601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4602> AgradDistributionWiener_fd_4602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4603> AgradDistributionWiener_fd_4603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4604> AgradDistributionWiener_fd_4604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4605> AgradDistributionWiener_fd_4605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4606> AgradDistributionWiener_fd_4606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4607> AgradDistributionWiener_fd_4607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4608> AgradDistributionWiener_fd_4608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4609> AgradDistributionWiener_fd_4609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4610> AgradDistributionWiener_fd_4610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4611> AgradDistributionWiener_fd_4611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4612> AgradDistributionWiener_fd_4612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4613> AgradDistributionWiener_fd_4613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4614> AgradDistributionWiener_fd_4614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4615> AgradDistributionWiener_fd_4615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4616> AgradDistributionWiener_fd_4616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4617> AgradDistributionWiener_fd_4617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4618> AgradDistributionWiener_fd_4618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4619> AgradDistributionWiener_fd_4619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4620> AgradDistributionWiener_fd_4620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4621> AgradDistributionWiener_fd_4621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4622> AgradDistributionWiener_fd_4622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4623> AgradDistributionWiener_fd_4623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4624> AgradDistributionWiener_fd_4624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4625> AgradDistributionWiener_fd_4625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4626> AgradDistributionWiener_fd_4626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4627> AgradDistributionWiener_fd_4627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4628> AgradDistributionWiener_fd_4628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4629> AgradDistributionWiener_fd_4629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4630> AgradDistributionWiener_fd_4630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4631> AgradDistributionWiener_fd_4631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4632> AgradDistributionWiener_fd_4632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4633> AgradDistributionWiener_fd_4633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4634> AgradDistributionWiener_fd_4634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4635> AgradDistributionWiener_fd_4635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4636> AgradDistributionWiener_fd_4636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4637> AgradDistributionWiener_fd_4637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4638> AgradDistributionWiener_fd_4638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4639> AgradDistributionWiener_fd_4639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4640> AgradDistributionWiener_fd_4640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4641> AgradDistributionWiener_fd_4641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4642> AgradDistributionWiener_fd_4642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4643> AgradDistributionWiener_fd_4643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4644> AgradDistributionWiener_fd_4644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4645> AgradDistributionWiener_fd_4645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4646> AgradDistributionWiener_fd_4646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4647> AgradDistributionWiener_fd_4647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4648> AgradDistributionWiener_fd_4648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4649> AgradDistributionWiener_fd_4649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4650> AgradDistributionWiener_fd_4650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4651> AgradDistributionWiener_fd_4651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4652> AgradDistributionWiener_fd_4652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4653> AgradDistributionWiener_fd_4653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4654> AgradDistributionWiener_fd_4654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4655> AgradDistributionWiener_fd_4655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4656> AgradDistributionWiener_fd_4656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4657> AgradDistributionWiener_fd_4657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4658> AgradDistributionWiener_fd_4658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4659> AgradDistributionWiener_fd_4659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4660> AgradDistributionWiener_fd_4660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4661> AgradDistributionWiener_fd_4661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4662> AgradDistributionWiener_fd_4662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4663> AgradDistributionWiener_fd_4663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4664> AgradDistributionWiener_fd_4664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4665> AgradDistributionWiener_fd_4665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4666> AgradDistributionWiener_fd_4666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4667> AgradDistributionWiener_fd_4667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4668> AgradDistributionWiener_fd_4668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4669> AgradDistributionWiener_fd_4669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4670> AgradDistributionWiener_fd_4670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4671> AgradDistributionWiener_fd_4671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4672> AgradDistributionWiener_fd_4672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4673> AgradDistributionWiener_fd_4673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4674> AgradDistributionWiener_fd_4674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4675> AgradDistributionWiener_fd_4675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4676> AgradDistributionWiener_fd_4676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4677> AgradDistributionWiener_fd_4677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4678> AgradDistributionWiener_fd_4678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4679> AgradDistributionWiener_fd_4679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4680> AgradDistributionWiener_fd_4680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4681> AgradDistributionWiener_fd_4681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4682> AgradDistributionWiener_fd_4682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4683> AgradDistributionWiener_fd_4683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4684> AgradDistributionWiener_fd_4684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4685> AgradDistributionWiener_fd_4685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4686> AgradDistributionWiener_fd_4686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4687> AgradDistributionWiener_fd_4687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4688> AgradDistributionWiener_fd_4688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4689> AgradDistributionWiener_fd_4689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4690> AgradDistributionWiener_fd_4690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4691> AgradDistributionWiener_fd_4691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4692> AgradDistributionWiener_fd_4692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4693> AgradDistributionWiener_fd_4693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4694> AgradDistributionWiener_fd_4694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4695> AgradDistributionWiener_fd_4695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4696> AgradDistributionWiener_fd_4696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4697> AgradDistributionWiener_fd_4697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4698> AgradDistributionWiener_fd_4698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4699> AgradDistributionWiener_fd_4699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4600, AgradDistributionTestFixture, AgradDistributionWiener_fd_4600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4601, AgradDistributionTestFixture, AgradDistributionWiener_fd_4601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4602, AgradDistributionTestFixture, AgradDistributionWiener_fd_4602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4603, AgradDistributionTestFixture, AgradDistributionWiener_fd_4603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4604, AgradDistributionTestFixture, AgradDistributionWiener_fd_4604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4605, AgradDistributionTestFixture, AgradDistributionWiener_fd_4605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4606, AgradDistributionTestFixture, AgradDistributionWiener_fd_4606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4607, AgradDistributionTestFixture, AgradDistributionWiener_fd_4607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4608, AgradDistributionTestFixture, AgradDistributionWiener_fd_4608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4609, AgradDistributionTestFixture, AgradDistributionWiener_fd_4609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4610, AgradDistributionTestFixture, AgradDistributionWiener_fd_4610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4611, AgradDistributionTestFixture, AgradDistributionWiener_fd_4611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4612, AgradDistributionTestFixture, AgradDistributionWiener_fd_4612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4613, AgradDistributionTestFixture, AgradDistributionWiener_fd_4613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4614, AgradDistributionTestFixture, AgradDistributionWiener_fd_4614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4615, AgradDistributionTestFixture, AgradDistributionWiener_fd_4615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4616, AgradDistributionTestFixture, AgradDistributionWiener_fd_4616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4617, AgradDistributionTestFixture, AgradDistributionWiener_fd_4617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4618, AgradDistributionTestFixture, AgradDistributionWiener_fd_4618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4619, AgradDistributionTestFixture, AgradDistributionWiener_fd_4619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4620, AgradDistributionTestFixture, AgradDistributionWiener_fd_4620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4621, AgradDistributionTestFixture, AgradDistributionWiener_fd_4621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4622, AgradDistributionTestFixture, AgradDistributionWiener_fd_4622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4623, AgradDistributionTestFixture, AgradDistributionWiener_fd_4623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4624, AgradDistributionTestFixture, AgradDistributionWiener_fd_4624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4625, AgradDistributionTestFixture, AgradDistributionWiener_fd_4625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4626, AgradDistributionTestFixture, AgradDistributionWiener_fd_4626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4627, AgradDistributionTestFixture, AgradDistributionWiener_fd_4627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4628, AgradDistributionTestFixture, AgradDistributionWiener_fd_4628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4629, AgradDistributionTestFixture, AgradDistributionWiener_fd_4629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4630, AgradDistributionTestFixture, AgradDistributionWiener_fd_4630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4631, AgradDistributionTestFixture, AgradDistributionWiener_fd_4631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4632, AgradDistributionTestFixture, AgradDistributionWiener_fd_4632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4633, AgradDistributionTestFixture, AgradDistributionWiener_fd_4633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4634, AgradDistributionTestFixture, AgradDistributionWiener_fd_4634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4635, AgradDistributionTestFixture, AgradDistributionWiener_fd_4635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4636, AgradDistributionTestFixture, AgradDistributionWiener_fd_4636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4637, AgradDistributionTestFixture, AgradDistributionWiener_fd_4637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4638, AgradDistributionTestFixture, AgradDistributionWiener_fd_4638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4639, AgradDistributionTestFixture, AgradDistributionWiener_fd_4639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4640, AgradDistributionTestFixture, AgradDistributionWiener_fd_4640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4641, AgradDistributionTestFixture, AgradDistributionWiener_fd_4641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4642, AgradDistributionTestFixture, AgradDistributionWiener_fd_4642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4643, AgradDistributionTestFixture, AgradDistributionWiener_fd_4643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4644, AgradDistributionTestFixture, AgradDistributionWiener_fd_4644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4645, AgradDistributionTestFixture, AgradDistributionWiener_fd_4645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4646, AgradDistributionTestFixture, AgradDistributionWiener_fd_4646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4647, AgradDistributionTestFixture, AgradDistributionWiener_fd_4647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4648, AgradDistributionTestFixture, AgradDistributionWiener_fd_4648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4649, AgradDistributionTestFixture, AgradDistributionWiener_fd_4649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4650, AgradDistributionTestFixture, AgradDistributionWiener_fd_4650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4651, AgradDistributionTestFixture, AgradDistributionWiener_fd_4651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4652, AgradDistributionTestFixture, AgradDistributionWiener_fd_4652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4653, AgradDistributionTestFixture, AgradDistributionWiener_fd_4653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4654, AgradDistributionTestFixture, AgradDistributionWiener_fd_4654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4655, AgradDistributionTestFixture, AgradDistributionWiener_fd_4655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4656, AgradDistributionTestFixture, AgradDistributionWiener_fd_4656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4657, AgradDistributionTestFixture, AgradDistributionWiener_fd_4657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4658, AgradDistributionTestFixture, AgradDistributionWiener_fd_4658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4659, AgradDistributionTestFixture, AgradDistributionWiener_fd_4659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4660, AgradDistributionTestFixture, AgradDistributionWiener_fd_4660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4661, AgradDistributionTestFixture, AgradDistributionWiener_fd_4661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4662, AgradDistributionTestFixture, AgradDistributionWiener_fd_4662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4663, AgradDistributionTestFixture, AgradDistributionWiener_fd_4663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4664, AgradDistributionTestFixture, AgradDistributionWiener_fd_4664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4665, AgradDistributionTestFixture, AgradDistributionWiener_fd_4665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4666, AgradDistributionTestFixture, AgradDistributionWiener_fd_4666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4667, AgradDistributionTestFixture, AgradDistributionWiener_fd_4667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4668, AgradDistributionTestFixture, AgradDistributionWiener_fd_4668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4669, AgradDistributionTestFixture, AgradDistributionWiener_fd_4669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4670, AgradDistributionTestFixture, AgradDistributionWiener_fd_4670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4671, AgradDistributionTestFixture, AgradDistributionWiener_fd_4671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4672, AgradDistributionTestFixture, AgradDistributionWiener_fd_4672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4673, AgradDistributionTestFixture, AgradDistributionWiener_fd_4673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4674, AgradDistributionTestFixture, AgradDistributionWiener_fd_4674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4675, AgradDistributionTestFixture, AgradDistributionWiener_fd_4675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4676, AgradDistributionTestFixture, AgradDistributionWiener_fd_4676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4677, AgradDistributionTestFixture, AgradDistributionWiener_fd_4677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4678, AgradDistributionTestFixture, AgradDistributionWiener_fd_4678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4679, AgradDistributionTestFixture, AgradDistributionWiener_fd_4679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4680, AgradDistributionTestFixture, AgradDistributionWiener_fd_4680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4681, AgradDistributionTestFixture, AgradDistributionWiener_fd_4681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4682, AgradDistributionTestFixture, AgradDistributionWiener_fd_4682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4683, AgradDistributionTestFixture, AgradDistributionWiener_fd_4683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4684, AgradDistributionTestFixture, AgradDistributionWiener_fd_4684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4685, AgradDistributionTestFixture, AgradDistributionWiener_fd_4685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4686, AgradDistributionTestFixture, AgradDistributionWiener_fd_4686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4687, AgradDistributionTestFixture, AgradDistributionWiener_fd_4687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4688, AgradDistributionTestFixture, AgradDistributionWiener_fd_4688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4689, AgradDistributionTestFixture, AgradDistributionWiener_fd_4689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4690, AgradDistributionTestFixture, AgradDistributionWiener_fd_4690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4691, AgradDistributionTestFixture, AgradDistributionWiener_fd_4691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4692, AgradDistributionTestFixture, AgradDistributionWiener_fd_4692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4693, AgradDistributionTestFixture, AgradDistributionWiener_fd_4693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4694, AgradDistributionTestFixture, AgradDistributionWiener_fd_4694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4695, AgradDistributionTestFixture, AgradDistributionWiener_fd_4695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4696, AgradDistributionTestFixture, AgradDistributionWiener_fd_4696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4697, AgradDistributionTestFixture, AgradDistributionWiener_fd_4697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4698, AgradDistributionTestFixture, AgradDistributionWiener_fd_4698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4699, AgradDistributionTestFixture, AgradDistributionWiener_fd_4699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4700;
+typedef boost::mpl::vector<var, var, std::vector<var>, var, var, empty> type_v_4701;
+typedef boost::mpl::vector<var, var, std::vector<var>, var, std::vector<var>, empty> type_v_4702;
+typedef boost::mpl::vector<var, var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4703;
+typedef boost::mpl::vector<var, var, std::vector<var>, std::vector<var>, double, empty> type_v_4704;
+typedef boost::mpl::vector<var, var, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_4705;
+typedef boost::mpl::vector<var, var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4706;
+typedef boost::mpl::vector<var, var, std::vector<var>, std::vector<var>, var, empty> type_v_4707;
+typedef boost::mpl::vector<var, var, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_4708;
+typedef boost::mpl::vector<var, var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4709;
+typedef boost::mpl::vector<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4710;
+typedef boost::mpl::vector<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4711;
+typedef boost::mpl::vector<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4712;
+typedef boost::mpl::vector<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4713;
+typedef boost::mpl::vector<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4714;
+typedef boost::mpl::vector<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4715;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_4716;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_4717;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4718;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_4719;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_4720;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4721;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_4722;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_4723;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4724;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_4725;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_4726;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4727;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4728;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4729;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4730;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4731;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4732;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4733;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_4734;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_4735;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4736;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_4737;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_4738;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4739;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_4740;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_4741;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4742;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_4743;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_4744;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4745;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4746;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4747;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4748;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4749;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4750;
+typedef boost::mpl::vector<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4751;
+typedef boost::mpl::vector<var, std::vector<var>, double, double, double, empty> type_v_4752;
+typedef boost::mpl::vector<var, std::vector<var>, double, double, std::vector<double>, empty> type_v_4753;
+typedef boost::mpl::vector<var, std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4754;
+typedef boost::mpl::vector<var, std::vector<var>, double, double, var, empty> type_v_4755;
+typedef boost::mpl::vector<var, std::vector<var>, double, double, std::vector<var>, empty> type_v_4756;
+typedef boost::mpl::vector<var, std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4757;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<double>, double, empty> type_v_4758;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<double>, std::vector<double>, empty> type_v_4759;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4760;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<double>, var, empty> type_v_4761;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<double>, std::vector<var>, empty> type_v_4762;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4763;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4764;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4765;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4766;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4767;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4768;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4769;
+typedef boost::mpl::vector<var, std::vector<var>, double, var, double, empty> type_v_4770;
+typedef boost::mpl::vector<var, std::vector<var>, double, var, std::vector<double>, empty> type_v_4771;
+typedef boost::mpl::vector<var, std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4772;
+typedef boost::mpl::vector<var, std::vector<var>, double, var, var, empty> type_v_4773;
+typedef boost::mpl::vector<var, std::vector<var>, double, var, std::vector<var>, empty> type_v_4774;
+typedef boost::mpl::vector<var, std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4775;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<var>, double, empty> type_v_4776;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<var>, std::vector<double>, empty> type_v_4777;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4778;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<var>, var, empty> type_v_4779;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<var>, std::vector<var>, empty> type_v_4780;
+typedef boost::mpl::vector<var, std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4781;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4782;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4783;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4784;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4785;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4786;
+typedef boost::mpl::vector<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4787;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, double, double, empty> type_v_4788;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, double, std::vector<double>, empty> type_v_4789;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4790;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, double, var, empty> type_v_4791;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, double, std::vector<var>, empty> type_v_4792;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4793;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<double>, double, empty> type_v_4794;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_4795;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4796;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<double>, var, empty> type_v_4797;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_4798;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4700> AgradDistributionWiener_v_4700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4701> AgradDistributionWiener_v_4701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4702> AgradDistributionWiener_v_4702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4703> AgradDistributionWiener_v_4703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4704> AgradDistributionWiener_v_4704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4705> AgradDistributionWiener_v_4705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4706> AgradDistributionWiener_v_4706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4707> AgradDistributionWiener_v_4707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4708> AgradDistributionWiener_v_4708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4709> AgradDistributionWiener_v_4709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4710> AgradDistributionWiener_v_4710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4711> AgradDistributionWiener_v_4711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4712> AgradDistributionWiener_v_4712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4713> AgradDistributionWiener_v_4713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4714> AgradDistributionWiener_v_4714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4715> AgradDistributionWiener_v_4715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4716> AgradDistributionWiener_v_4716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4717> AgradDistributionWiener_v_4717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4718> AgradDistributionWiener_v_4718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4719> AgradDistributionWiener_v_4719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4720> AgradDistributionWiener_v_4720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4721> AgradDistributionWiener_v_4721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4722> AgradDistributionWiener_v_4722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4723> AgradDistributionWiener_v_4723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4724> AgradDistributionWiener_v_4724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4725> AgradDistributionWiener_v_4725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4726> AgradDistributionWiener_v_4726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4727> AgradDistributionWiener_v_4727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4728> AgradDistributionWiener_v_4728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4729> AgradDistributionWiener_v_4729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4730> AgradDistributionWiener_v_4730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4731> AgradDistributionWiener_v_4731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4732> AgradDistributionWiener_v_4732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4733> AgradDistributionWiener_v_4733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4734> AgradDistributionWiener_v_4734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4735> AgradDistributionWiener_v_4735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4736> AgradDistributionWiener_v_4736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4737> AgradDistributionWiener_v_4737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4738> AgradDistributionWiener_v_4738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4739> AgradDistributionWiener_v_4739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4740> AgradDistributionWiener_v_4740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4741> AgradDistributionWiener_v_4741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4742> AgradDistributionWiener_v_4742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4743> AgradDistributionWiener_v_4743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4744> AgradDistributionWiener_v_4744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4745> AgradDistributionWiener_v_4745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4746> AgradDistributionWiener_v_4746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4747> AgradDistributionWiener_v_4747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4748> AgradDistributionWiener_v_4748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4749> AgradDistributionWiener_v_4749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4750> AgradDistributionWiener_v_4750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4751> AgradDistributionWiener_v_4751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4752> AgradDistributionWiener_v_4752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4753> AgradDistributionWiener_v_4753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4754> AgradDistributionWiener_v_4754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4755> AgradDistributionWiener_v_4755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4756> AgradDistributionWiener_v_4756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4757> AgradDistributionWiener_v_4757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4758> AgradDistributionWiener_v_4758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4759> AgradDistributionWiener_v_4759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4760> AgradDistributionWiener_v_4760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4761> AgradDistributionWiener_v_4761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4762> AgradDistributionWiener_v_4762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4763> AgradDistributionWiener_v_4763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4764> AgradDistributionWiener_v_4764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4765> AgradDistributionWiener_v_4765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4766> AgradDistributionWiener_v_4766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4767> AgradDistributionWiener_v_4767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4768> AgradDistributionWiener_v_4768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4769> AgradDistributionWiener_v_4769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4770> AgradDistributionWiener_v_4770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4771> AgradDistributionWiener_v_4771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4772> AgradDistributionWiener_v_4772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4773> AgradDistributionWiener_v_4773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4774> AgradDistributionWiener_v_4774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4775> AgradDistributionWiener_v_4775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4776> AgradDistributionWiener_v_4776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4777> AgradDistributionWiener_v_4777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4778> AgradDistributionWiener_v_4778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4779> AgradDistributionWiener_v_4779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4780> AgradDistributionWiener_v_4780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4781> AgradDistributionWiener_v_4781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4782> AgradDistributionWiener_v_4782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4783> AgradDistributionWiener_v_4783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4784> AgradDistributionWiener_v_4784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4785> AgradDistributionWiener_v_4785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4786> AgradDistributionWiener_v_4786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4787> AgradDistributionWiener_v_4787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4788> AgradDistributionWiener_v_4788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4789> AgradDistributionWiener_v_4789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4790> AgradDistributionWiener_v_4790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4791> AgradDistributionWiener_v_4791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4792> AgradDistributionWiener_v_4792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4793> AgradDistributionWiener_v_4793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4794> AgradDistributionWiener_v_4794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4795> AgradDistributionWiener_v_4795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4796> AgradDistributionWiener_v_4796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4797> AgradDistributionWiener_v_4797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4798> AgradDistributionWiener_v_4798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4799> AgradDistributionWiener_v_4799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4700, AgradDistributionTestFixture, AgradDistributionWiener_v_4700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4701, AgradDistributionTestFixture, AgradDistributionWiener_v_4701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4702, AgradDistributionTestFixture, AgradDistributionWiener_v_4702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4703, AgradDistributionTestFixture, AgradDistributionWiener_v_4703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4704, AgradDistributionTestFixture, AgradDistributionWiener_v_4704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4705, AgradDistributionTestFixture, AgradDistributionWiener_v_4705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4706, AgradDistributionTestFixture, AgradDistributionWiener_v_4706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4707, AgradDistributionTestFixture, AgradDistributionWiener_v_4707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4708, AgradDistributionTestFixture, AgradDistributionWiener_v_4708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4709, AgradDistributionTestFixture, AgradDistributionWiener_v_4709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4710, AgradDistributionTestFixture, AgradDistributionWiener_v_4710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4711, AgradDistributionTestFixture, AgradDistributionWiener_v_4711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4712, AgradDistributionTestFixture, AgradDistributionWiener_v_4712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4713, AgradDistributionTestFixture, AgradDistributionWiener_v_4713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4714, AgradDistributionTestFixture, AgradDistributionWiener_v_4714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4715, AgradDistributionTestFixture, AgradDistributionWiener_v_4715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4716, AgradDistributionTestFixture, AgradDistributionWiener_v_4716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4717, AgradDistributionTestFixture, AgradDistributionWiener_v_4717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4718, AgradDistributionTestFixture, AgradDistributionWiener_v_4718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4719, AgradDistributionTestFixture, AgradDistributionWiener_v_4719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4720, AgradDistributionTestFixture, AgradDistributionWiener_v_4720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4721, AgradDistributionTestFixture, AgradDistributionWiener_v_4721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4722, AgradDistributionTestFixture, AgradDistributionWiener_v_4722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4723, AgradDistributionTestFixture, AgradDistributionWiener_v_4723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4724, AgradDistributionTestFixture, AgradDistributionWiener_v_4724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4725, AgradDistributionTestFixture, AgradDistributionWiener_v_4725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4726, AgradDistributionTestFixture, AgradDistributionWiener_v_4726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4727, AgradDistributionTestFixture, AgradDistributionWiener_v_4727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4728, AgradDistributionTestFixture, AgradDistributionWiener_v_4728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4729, AgradDistributionTestFixture, AgradDistributionWiener_v_4729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4730, AgradDistributionTestFixture, AgradDistributionWiener_v_4730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4731, AgradDistributionTestFixture, AgradDistributionWiener_v_4731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4732, AgradDistributionTestFixture, AgradDistributionWiener_v_4732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4733, AgradDistributionTestFixture, AgradDistributionWiener_v_4733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4734, AgradDistributionTestFixture, AgradDistributionWiener_v_4734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4735, AgradDistributionTestFixture, AgradDistributionWiener_v_4735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4736, AgradDistributionTestFixture, AgradDistributionWiener_v_4736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4737, AgradDistributionTestFixture, AgradDistributionWiener_v_4737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4738, AgradDistributionTestFixture, AgradDistributionWiener_v_4738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4739, AgradDistributionTestFixture, AgradDistributionWiener_v_4739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4740, AgradDistributionTestFixture, AgradDistributionWiener_v_4740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4741, AgradDistributionTestFixture, AgradDistributionWiener_v_4741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4742, AgradDistributionTestFixture, AgradDistributionWiener_v_4742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4743, AgradDistributionTestFixture, AgradDistributionWiener_v_4743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4744, AgradDistributionTestFixture, AgradDistributionWiener_v_4744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4745, AgradDistributionTestFixture, AgradDistributionWiener_v_4745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4746, AgradDistributionTestFixture, AgradDistributionWiener_v_4746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4747, AgradDistributionTestFixture, AgradDistributionWiener_v_4747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4748, AgradDistributionTestFixture, AgradDistributionWiener_v_4748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4749, AgradDistributionTestFixture, AgradDistributionWiener_v_4749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4750, AgradDistributionTestFixture, AgradDistributionWiener_v_4750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4751, AgradDistributionTestFixture, AgradDistributionWiener_v_4751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4752, AgradDistributionTestFixture, AgradDistributionWiener_v_4752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4753, AgradDistributionTestFixture, AgradDistributionWiener_v_4753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4754, AgradDistributionTestFixture, AgradDistributionWiener_v_4754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4755, AgradDistributionTestFixture, AgradDistributionWiener_v_4755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4756, AgradDistributionTestFixture, AgradDistributionWiener_v_4756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4757, AgradDistributionTestFixture, AgradDistributionWiener_v_4757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4758, AgradDistributionTestFixture, AgradDistributionWiener_v_4758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4759, AgradDistributionTestFixture, AgradDistributionWiener_v_4759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4760, AgradDistributionTestFixture, AgradDistributionWiener_v_4760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4761, AgradDistributionTestFixture, AgradDistributionWiener_v_4761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4762, AgradDistributionTestFixture, AgradDistributionWiener_v_4762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4763, AgradDistributionTestFixture, AgradDistributionWiener_v_4763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4764, AgradDistributionTestFixture, AgradDistributionWiener_v_4764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4765, AgradDistributionTestFixture, AgradDistributionWiener_v_4765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4766, AgradDistributionTestFixture, AgradDistributionWiener_v_4766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4767, AgradDistributionTestFixture, AgradDistributionWiener_v_4767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4768, AgradDistributionTestFixture, AgradDistributionWiener_v_4768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4769, AgradDistributionTestFixture, AgradDistributionWiener_v_4769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4770, AgradDistributionTestFixture, AgradDistributionWiener_v_4770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4771, AgradDistributionTestFixture, AgradDistributionWiener_v_4771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4772, AgradDistributionTestFixture, AgradDistributionWiener_v_4772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4773, AgradDistributionTestFixture, AgradDistributionWiener_v_4773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4774, AgradDistributionTestFixture, AgradDistributionWiener_v_4774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4775, AgradDistributionTestFixture, AgradDistributionWiener_v_4775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4776, AgradDistributionTestFixture, AgradDistributionWiener_v_4776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4777, AgradDistributionTestFixture, AgradDistributionWiener_v_4777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4778, AgradDistributionTestFixture, AgradDistributionWiener_v_4778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4779, AgradDistributionTestFixture, AgradDistributionWiener_v_4779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4780, AgradDistributionTestFixture, AgradDistributionWiener_v_4780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4781, AgradDistributionTestFixture, AgradDistributionWiener_v_4781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4782, AgradDistributionTestFixture, AgradDistributionWiener_v_4782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4783, AgradDistributionTestFixture, AgradDistributionWiener_v_4783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4784, AgradDistributionTestFixture, AgradDistributionWiener_v_4784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4785, AgradDistributionTestFixture, AgradDistributionWiener_v_4785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4786, AgradDistributionTestFixture, AgradDistributionWiener_v_4786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4787, AgradDistributionTestFixture, AgradDistributionWiener_v_4787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4788, AgradDistributionTestFixture, AgradDistributionWiener_v_4788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4789, AgradDistributionTestFixture, AgradDistributionWiener_v_4789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4790, AgradDistributionTestFixture, AgradDistributionWiener_v_4790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4791, AgradDistributionTestFixture, AgradDistributionWiener_v_4791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4792, AgradDistributionTestFixture, AgradDistributionWiener_v_4792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4793, AgradDistributionTestFixture, AgradDistributionWiener_v_4793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4794, AgradDistributionTestFixture, AgradDistributionWiener_v_4794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4795, AgradDistributionTestFixture, AgradDistributionWiener_v_4795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4796, AgradDistributionTestFixture, AgradDistributionWiener_v_4796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4797, AgradDistributionTestFixture, AgradDistributionWiener_v_4797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4798, AgradDistributionTestFixture, AgradDistributionWiener_v_4798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4799, AgradDistributionTestFixture, AgradDistributionWiener_v_4799);
+
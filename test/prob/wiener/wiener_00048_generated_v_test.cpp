@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4800;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4801;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4802;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4803;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4804;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4805;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, var, double, empty> type_v_4806;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, var, std::vector<double>, empty> type_v_4807;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4808;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, var, var, empty> type_v_4809;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, var, std::vector<var>, empty> type_v_4810;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4811;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<var>, double, empty> type_v_4812;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_4813;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4814;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<var>, var, empty> type_v_4815;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_4816;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4817;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4818;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4819;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4820;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4821;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4822;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4823;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_4824;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_4825;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4826;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_4827;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_4828;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4829;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_4830;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_4831;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4832;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_4833;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_4834;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4835;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4836;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4837;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4838;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4839;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4840;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4841;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_4842;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_4843;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4844;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_4845;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_4846;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4847;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_4848;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_4849;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4850;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_4851;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_4852;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4853;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4854;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4855;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4856;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4857;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4858;
+typedef boost::mpl::vector<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4859;
+typedef boost::mpl::vector<var, std::vector<var>, var, double, double, empty> type_v_4860;
+typedef boost::mpl::vector<var, std::vector<var>, var, double, std::vector<double>, empty> type_v_4861;
+typedef boost::mpl::vector<var, std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4862;
+typedef boost::mpl::vector<var, std::vector<var>, var, double, var, empty> type_v_4863;
+typedef boost::mpl::vector<var, std::vector<var>, var, double, std::vector<var>, empty> type_v_4864;
+typedef boost::mpl::vector<var, std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4865;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<double>, double, empty> type_v_4866;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<double>, std::vector<double>, empty> type_v_4867;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4868;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<double>, var, empty> type_v_4869;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<double>, std::vector<var>, empty> type_v_4870;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4871;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_4872;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4873;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4874;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_4875;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4876;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4877;
+typedef boost::mpl::vector<var, std::vector<var>, var, var, double, empty> type_v_4878;
+typedef boost::mpl::vector<var, std::vector<var>, var, var, std::vector<double>, empty> type_v_4879;
+typedef boost::mpl::vector<var, std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4880;
+typedef boost::mpl::vector<var, std::vector<var>, var, var, var, empty> type_v_4881;
+typedef boost::mpl::vector<var, std::vector<var>, var, var, std::vector<var>, empty> type_v_4882;
+typedef boost::mpl::vector<var, std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4883;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<var>, double, empty> type_v_4884;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<var>, std::vector<double>, empty> type_v_4885;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4886;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<var>, var, empty> type_v_4887;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<var>, std::vector<var>, empty> type_v_4888;
+typedef boost::mpl::vector<var, std::vector<var>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4889;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_4890;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_4891;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4892;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_4893;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_4894;
+typedef boost::mpl::vector<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_4895;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<var>, double, double, empty> type_v_4896;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<var>, double, std::vector<double>, empty> type_v_4897;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_4898;
+typedef boost::mpl::vector<var, std::vector<var>, std::vector<var>, double, var, empty> type_v_4899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4800> AgradDistributionWiener_v_4800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4801> AgradDistributionWiener_v_4801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4802> AgradDistributionWiener_v_4802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4803> AgradDistributionWiener_v_4803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4804> AgradDistributionWiener_v_4804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4805> AgradDistributionWiener_v_4805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4806> AgradDistributionWiener_v_4806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4807> AgradDistributionWiener_v_4807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4808> AgradDistributionWiener_v_4808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4809> AgradDistributionWiener_v_4809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4810> AgradDistributionWiener_v_4810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4811> AgradDistributionWiener_v_4811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4812> AgradDistributionWiener_v_4812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4813> AgradDistributionWiener_v_4813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4814> AgradDistributionWiener_v_4814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4815> AgradDistributionWiener_v_4815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4816> AgradDistributionWiener_v_4816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4817> AgradDistributionWiener_v_4817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4818> AgradDistributionWiener_v_4818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4819> AgradDistributionWiener_v_4819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4820> AgradDistributionWiener_v_4820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4821> AgradDistributionWiener_v_4821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4822> AgradDistributionWiener_v_4822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4823> AgradDistributionWiener_v_4823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4824> AgradDistributionWiener_v_4824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4825> AgradDistributionWiener_v_4825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4826> AgradDistributionWiener_v_4826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4827> AgradDistributionWiener_v_4827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4828> AgradDistributionWiener_v_4828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4829> AgradDistributionWiener_v_4829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4830> AgradDistributionWiener_v_4830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4831> AgradDistributionWiener_v_4831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4832> AgradDistributionWiener_v_4832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4833> AgradDistributionWiener_v_4833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4834> AgradDistributionWiener_v_4834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4835> AgradDistributionWiener_v_4835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4836> AgradDistributionWiener_v_4836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4837> AgradDistributionWiener_v_4837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4838> AgradDistributionWiener_v_4838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4839> AgradDistributionWiener_v_4839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4840> AgradDistributionWiener_v_4840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4841> AgradDistributionWiener_v_4841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4842> AgradDistributionWiener_v_4842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4843> AgradDistributionWiener_v_4843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4844> AgradDistributionWiener_v_4844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4845> AgradDistributionWiener_v_4845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4846> AgradDistributionWiener_v_4846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4847> AgradDistributionWiener_v_4847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4848> AgradDistributionWiener_v_4848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4849> AgradDistributionWiener_v_4849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4850> AgradDistributionWiener_v_4850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4851> AgradDistributionWiener_v_4851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4852> AgradDistributionWiener_v_4852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4853> AgradDistributionWiener_v_4853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4854> AgradDistributionWiener_v_4854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4855> AgradDistributionWiener_v_4855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4856> AgradDistributionWiener_v_4856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4857> AgradDistributionWiener_v_4857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4858> AgradDistributionWiener_v_4858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4859> AgradDistributionWiener_v_4859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4860> AgradDistributionWiener_v_4860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4861> AgradDistributionWiener_v_4861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4862> AgradDistributionWiener_v_4862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4863> AgradDistributionWiener_v_4863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4864> AgradDistributionWiener_v_4864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4865> AgradDistributionWiener_v_4865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4866> AgradDistributionWiener_v_4866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4867> AgradDistributionWiener_v_4867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4868> AgradDistributionWiener_v_4868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4869> AgradDistributionWiener_v_4869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4870> AgradDistributionWiener_v_4870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4871> AgradDistributionWiener_v_4871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4872> AgradDistributionWiener_v_4872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4873> AgradDistributionWiener_v_4873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4874> AgradDistributionWiener_v_4874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4875> AgradDistributionWiener_v_4875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4876> AgradDistributionWiener_v_4876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4877> AgradDistributionWiener_v_4877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4878> AgradDistributionWiener_v_4878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4879> AgradDistributionWiener_v_4879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4880> AgradDistributionWiener_v_4880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4881> AgradDistributionWiener_v_4881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4882> AgradDistributionWiener_v_4882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4883> AgradDistributionWiener_v_4883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4884> AgradDistributionWiener_v_4884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4885> AgradDistributionWiener_v_4885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4886> AgradDistributionWiener_v_4886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4887> AgradDistributionWiener_v_4887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4888> AgradDistributionWiener_v_4888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4889> AgradDistributionWiener_v_4889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4890> AgradDistributionWiener_v_4890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4891> AgradDistributionWiener_v_4891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4892> AgradDistributionWiener_v_4892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4893> AgradDistributionWiener_v_4893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4894> AgradDistributionWiener_v_4894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4895> AgradDistributionWiener_v_4895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4896> AgradDistributionWiener_v_4896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4897> AgradDistributionWiener_v_4897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4898> AgradDistributionWiener_v_4898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_4899> AgradDistributionWiener_v_4899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4800, AgradDistributionTestFixture, AgradDistributionWiener_v_4800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4801, AgradDistributionTestFixture, AgradDistributionWiener_v_4801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4802, AgradDistributionTestFixture, AgradDistributionWiener_v_4802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4803, AgradDistributionTestFixture, AgradDistributionWiener_v_4803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4804, AgradDistributionTestFixture, AgradDistributionWiener_v_4804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4805, AgradDistributionTestFixture, AgradDistributionWiener_v_4805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4806, AgradDistributionTestFixture, AgradDistributionWiener_v_4806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4807, AgradDistributionTestFixture, AgradDistributionWiener_v_4807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4808, AgradDistributionTestFixture, AgradDistributionWiener_v_4808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4809, AgradDistributionTestFixture, AgradDistributionWiener_v_4809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4810, AgradDistributionTestFixture, AgradDistributionWiener_v_4810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4811, AgradDistributionTestFixture, AgradDistributionWiener_v_4811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4812, AgradDistributionTestFixture, AgradDistributionWiener_v_4812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4813, AgradDistributionTestFixture, AgradDistributionWiener_v_4813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4814, AgradDistributionTestFixture, AgradDistributionWiener_v_4814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4815, AgradDistributionTestFixture, AgradDistributionWiener_v_4815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4816, AgradDistributionTestFixture, AgradDistributionWiener_v_4816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4817, AgradDistributionTestFixture, AgradDistributionWiener_v_4817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4818, AgradDistributionTestFixture, AgradDistributionWiener_v_4818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4819, AgradDistributionTestFixture, AgradDistributionWiener_v_4819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4820, AgradDistributionTestFixture, AgradDistributionWiener_v_4820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4821, AgradDistributionTestFixture, AgradDistributionWiener_v_4821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4822, AgradDistributionTestFixture, AgradDistributionWiener_v_4822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4823, AgradDistributionTestFixture, AgradDistributionWiener_v_4823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4824, AgradDistributionTestFixture, AgradDistributionWiener_v_4824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4825, AgradDistributionTestFixture, AgradDistributionWiener_v_4825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4826, AgradDistributionTestFixture, AgradDistributionWiener_v_4826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4827, AgradDistributionTestFixture, AgradDistributionWiener_v_4827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4828, AgradDistributionTestFixture, AgradDistributionWiener_v_4828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4829, AgradDistributionTestFixture, AgradDistributionWiener_v_4829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4830, AgradDistributionTestFixture, AgradDistributionWiener_v_4830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4831, AgradDistributionTestFixture, AgradDistributionWiener_v_4831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4832, AgradDistributionTestFixture, AgradDistributionWiener_v_4832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4833, AgradDistributionTestFixture, AgradDistributionWiener_v_4833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4834, AgradDistributionTestFixture, AgradDistributionWiener_v_4834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4835, AgradDistributionTestFixture, AgradDistributionWiener_v_4835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4836, AgradDistributionTestFixture, AgradDistributionWiener_v_4836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4837, AgradDistributionTestFixture, AgradDistributionWiener_v_4837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4838, AgradDistributionTestFixture, AgradDistributionWiener_v_4838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4839, AgradDistributionTestFixture, AgradDistributionWiener_v_4839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4840, AgradDistributionTestFixture, AgradDistributionWiener_v_4840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4841, AgradDistributionTestFixture, AgradDistributionWiener_v_4841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4842, AgradDistributionTestFixture, AgradDistributionWiener_v_4842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4843, AgradDistributionTestFixture, AgradDistributionWiener_v_4843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4844, AgradDistributionTestFixture, AgradDistributionWiener_v_4844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4845, AgradDistributionTestFixture, AgradDistributionWiener_v_4845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4846, AgradDistributionTestFixture, AgradDistributionWiener_v_4846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4847, AgradDistributionTestFixture, AgradDistributionWiener_v_4847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4848, AgradDistributionTestFixture, AgradDistributionWiener_v_4848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4849, AgradDistributionTestFixture, AgradDistributionWiener_v_4849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4850, AgradDistributionTestFixture, AgradDistributionWiener_v_4850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4851, AgradDistributionTestFixture, AgradDistributionWiener_v_4851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4852, AgradDistributionTestFixture, AgradDistributionWiener_v_4852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4853, AgradDistributionTestFixture, AgradDistributionWiener_v_4853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4854, AgradDistributionTestFixture, AgradDistributionWiener_v_4854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4855, AgradDistributionTestFixture, AgradDistributionWiener_v_4855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4856, AgradDistributionTestFixture, AgradDistributionWiener_v_4856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4857, AgradDistributionTestFixture, AgradDistributionWiener_v_4857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4858, AgradDistributionTestFixture, AgradDistributionWiener_v_4858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4859, AgradDistributionTestFixture, AgradDistributionWiener_v_4859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4860, AgradDistributionTestFixture, AgradDistributionWiener_v_4860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4861, AgradDistributionTestFixture, AgradDistributionWiener_v_4861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4862, AgradDistributionTestFixture, AgradDistributionWiener_v_4862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4863, AgradDistributionTestFixture, AgradDistributionWiener_v_4863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4864, AgradDistributionTestFixture, AgradDistributionWiener_v_4864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4865, AgradDistributionTestFixture, AgradDistributionWiener_v_4865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4866, AgradDistributionTestFixture, AgradDistributionWiener_v_4866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4867, AgradDistributionTestFixture, AgradDistributionWiener_v_4867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4868, AgradDistributionTestFixture, AgradDistributionWiener_v_4868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4869, AgradDistributionTestFixture, AgradDistributionWiener_v_4869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4870, AgradDistributionTestFixture, AgradDistributionWiener_v_4870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4871, AgradDistributionTestFixture, AgradDistributionWiener_v_4871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4872, AgradDistributionTestFixture, AgradDistributionWiener_v_4872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4873, AgradDistributionTestFixture, AgradDistributionWiener_v_4873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4874, AgradDistributionTestFixture, AgradDistributionWiener_v_4874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4875, AgradDistributionTestFixture, AgradDistributionWiener_v_4875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4876, AgradDistributionTestFixture, AgradDistributionWiener_v_4876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4877, AgradDistributionTestFixture, AgradDistributionWiener_v_4877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4878, AgradDistributionTestFixture, AgradDistributionWiener_v_4878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4879, AgradDistributionTestFixture, AgradDistributionWiener_v_4879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4880, AgradDistributionTestFixture, AgradDistributionWiener_v_4880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4881, AgradDistributionTestFixture, AgradDistributionWiener_v_4881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4882, AgradDistributionTestFixture, AgradDistributionWiener_v_4882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4883, AgradDistributionTestFixture, AgradDistributionWiener_v_4883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4884, AgradDistributionTestFixture, AgradDistributionWiener_v_4884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4885, AgradDistributionTestFixture, AgradDistributionWiener_v_4885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4886, AgradDistributionTestFixture, AgradDistributionWiener_v_4886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4887, AgradDistributionTestFixture, AgradDistributionWiener_v_4887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4888, AgradDistributionTestFixture, AgradDistributionWiener_v_4888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4889, AgradDistributionTestFixture, AgradDistributionWiener_v_4889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4890, AgradDistributionTestFixture, AgradDistributionWiener_v_4890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4891, AgradDistributionTestFixture, AgradDistributionWiener_v_4891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4892, AgradDistributionTestFixture, AgradDistributionWiener_v_4892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4893, AgradDistributionTestFixture, AgradDistributionWiener_v_4893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4894, AgradDistributionTestFixture, AgradDistributionWiener_v_4894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4895, AgradDistributionTestFixture, AgradDistributionWiener_v_4895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4896, AgradDistributionTestFixture, AgradDistributionWiener_v_4896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4897, AgradDistributionTestFixture, AgradDistributionWiener_v_4897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4898, AgradDistributionTestFixture, AgradDistributionWiener_v_4898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_4899, AgradDistributionTestFixture, AgradDistributionWiener_v_4899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4900;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4901;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4902;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4903;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4904;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_4905;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_4906;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4907;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_4908;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_4909;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4910;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_4911;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_4912;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4913;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_4914;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4915;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4916;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4917;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4918;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4919;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4920;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4921;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4922;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_4923;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_4924;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4925;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_4926;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4927;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4928;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_4929;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4930;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4931;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4932;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4933;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4934;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4935;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4936;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4937;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4938;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4939;
+typedef boost::mpl::vector<fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4940;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, double, double, empty> type_fd_4941;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, double, std::vector<double>, empty> type_fd_4942;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4943;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, double, fvar<double>, empty> type_fd_4944;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, double, std::vector<fvar<double>>, empty> type_fd_4945;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4946;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<double>, double, empty> type_fd_4947;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<double>, std::vector<double>, empty> type_fd_4948;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4949;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<double>, fvar<double>, empty> type_fd_4950;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4951;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4952;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4953;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4954;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4955;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4956;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4957;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4958;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, fvar<double>, double, empty> type_fd_4959;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, fvar<double>, std::vector<double>, empty> type_fd_4960;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4961;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, fvar<double>, fvar<double>, empty> type_fd_4962;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4963;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4964;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, double, empty> type_fd_4965;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_4966;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4967;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_4968;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_4969;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4970;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_4971;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4972;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4973;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4974;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4975;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4976;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, double, double, empty> type_fd_4977;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, double, std::vector<double>, empty> type_fd_4978;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4979;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, double, fvar<double>, empty> type_fd_4980;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_4981;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4982;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, double, empty> type_fd_4983;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_4984;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4985;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_4986;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_4987;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4988;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_4989;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_4990;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4991;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_4992;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_4993;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_4994;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, double, empty> type_fd_4995;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_4996;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_4997;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_4998;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_4999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4900> AgradDistributionWiener_fd_4900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4901> AgradDistributionWiener_fd_4901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4902> AgradDistributionWiener_fd_4902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4903> AgradDistributionWiener_fd_4903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4904> AgradDistributionWiener_fd_4904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4905> AgradDistributionWiener_fd_4905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4906> AgradDistributionWiener_fd_4906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4907> AgradDistributionWiener_fd_4907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4908> AgradDistributionWiener_fd_4908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4909> AgradDistributionWiener_fd_4909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4910> AgradDistributionWiener_fd_4910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4911> AgradDistributionWiener_fd_4911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4912> AgradDistributionWiener_fd_4912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4913> AgradDistributionWiener_fd_4913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4914> AgradDistributionWiener_fd_4914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4915> AgradDistributionWiener_fd_4915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4916> AgradDistributionWiener_fd_4916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4917> AgradDistributionWiener_fd_4917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4918> AgradDistributionWiener_fd_4918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4919> AgradDistributionWiener_fd_4919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4920> AgradDistributionWiener_fd_4920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4921> AgradDistributionWiener_fd_4921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4922> AgradDistributionWiener_fd_4922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4923> AgradDistributionWiener_fd_4923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4924> AgradDistributionWiener_fd_4924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4925> AgradDistributionWiener_fd_4925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4926> AgradDistributionWiener_fd_4926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4927> AgradDistributionWiener_fd_4927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4928> AgradDistributionWiener_fd_4928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4929> AgradDistributionWiener_fd_4929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4930> AgradDistributionWiener_fd_4930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4931> AgradDistributionWiener_fd_4931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4932> AgradDistributionWiener_fd_4932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4933> AgradDistributionWiener_fd_4933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4934> AgradDistributionWiener_fd_4934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4935> AgradDistributionWiener_fd_4935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4936> AgradDistributionWiener_fd_4936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4937> AgradDistributionWiener_fd_4937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4938> AgradDistributionWiener_fd_4938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4939> AgradDistributionWiener_fd_4939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4940> AgradDistributionWiener_fd_4940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4941> AgradDistributionWiener_fd_4941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4942> AgradDistributionWiener_fd_4942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4943> AgradDistributionWiener_fd_4943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4944> AgradDistributionWiener_fd_4944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4945> AgradDistributionWiener_fd_4945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4946> AgradDistributionWiener_fd_4946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4947> AgradDistributionWiener_fd_4947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4948> AgradDistributionWiener_fd_4948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4949> AgradDistributionWiener_fd_4949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4950> AgradDistributionWiener_fd_4950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4951> AgradDistributionWiener_fd_4951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4952> AgradDistributionWiener_fd_4952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4953> AgradDistributionWiener_fd_4953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4954> AgradDistributionWiener_fd_4954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4955> AgradDistributionWiener_fd_4955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4956> AgradDistributionWiener_fd_4956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4957> AgradDistributionWiener_fd_4957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4958> AgradDistributionWiener_fd_4958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4959> AgradDistributionWiener_fd_4959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4960> AgradDistributionWiener_fd_4960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4961> AgradDistributionWiener_fd_4961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4962> AgradDistributionWiener_fd_4962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4963> AgradDistributionWiener_fd_4963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4964> AgradDistributionWiener_fd_4964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4965> AgradDistributionWiener_fd_4965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4966> AgradDistributionWiener_fd_4966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4967> AgradDistributionWiener_fd_4967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4968> AgradDistributionWiener_fd_4968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4969> AgradDistributionWiener_fd_4969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4970> AgradDistributionWiener_fd_4970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4971> AgradDistributionWiener_fd_4971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4972> AgradDistributionWiener_fd_4972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4973> AgradDistributionWiener_fd_4973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4974> AgradDistributionWiener_fd_4974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4975> AgradDistributionWiener_fd_4975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4976> AgradDistributionWiener_fd_4976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4977> AgradDistributionWiener_fd_4977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4978> AgradDistributionWiener_fd_4978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4979> AgradDistributionWiener_fd_4979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4980> AgradDistributionWiener_fd_4980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4981> AgradDistributionWiener_fd_4981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4982> AgradDistributionWiener_fd_4982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4983> AgradDistributionWiener_fd_4983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4984> AgradDistributionWiener_fd_4984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4985> AgradDistributionWiener_fd_4985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4986> AgradDistributionWiener_fd_4986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4987> AgradDistributionWiener_fd_4987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4988> AgradDistributionWiener_fd_4988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4989> AgradDistributionWiener_fd_4989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4990> AgradDistributionWiener_fd_4990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4991> AgradDistributionWiener_fd_4991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4992> AgradDistributionWiener_fd_4992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4993> AgradDistributionWiener_fd_4993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4994> AgradDistributionWiener_fd_4994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4995> AgradDistributionWiener_fd_4995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4996> AgradDistributionWiener_fd_4996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4997> AgradDistributionWiener_fd_4997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4998> AgradDistributionWiener_fd_4998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_4999> AgradDistributionWiener_fd_4999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4900, AgradDistributionTestFixture, AgradDistributionWiener_fd_4900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4901, AgradDistributionTestFixture, AgradDistributionWiener_fd_4901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4902, AgradDistributionTestFixture, AgradDistributionWiener_fd_4902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4903, AgradDistributionTestFixture, AgradDistributionWiener_fd_4903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4904, AgradDistributionTestFixture, AgradDistributionWiener_fd_4904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4905, AgradDistributionTestFixture, AgradDistributionWiener_fd_4905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4906, AgradDistributionTestFixture, AgradDistributionWiener_fd_4906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4907, AgradDistributionTestFixture, AgradDistributionWiener_fd_4907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4908, AgradDistributionTestFixture, AgradDistributionWiener_fd_4908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4909, AgradDistributionTestFixture, AgradDistributionWiener_fd_4909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4910, AgradDistributionTestFixture, AgradDistributionWiener_fd_4910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4911, AgradDistributionTestFixture, AgradDistributionWiener_fd_4911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4912, AgradDistributionTestFixture, AgradDistributionWiener_fd_4912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4913, AgradDistributionTestFixture, AgradDistributionWiener_fd_4913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4914, AgradDistributionTestFixture, AgradDistributionWiener_fd_4914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4915, AgradDistributionTestFixture, AgradDistributionWiener_fd_4915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4916, AgradDistributionTestFixture, AgradDistributionWiener_fd_4916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4917, AgradDistributionTestFixture, AgradDistributionWiener_fd_4917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4918, AgradDistributionTestFixture, AgradDistributionWiener_fd_4918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4919, AgradDistributionTestFixture, AgradDistributionWiener_fd_4919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4920, AgradDistributionTestFixture, AgradDistributionWiener_fd_4920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4921, AgradDistributionTestFixture, AgradDistributionWiener_fd_4921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4922, AgradDistributionTestFixture, AgradDistributionWiener_fd_4922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4923, AgradDistributionTestFixture, AgradDistributionWiener_fd_4923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4924, AgradDistributionTestFixture, AgradDistributionWiener_fd_4924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4925, AgradDistributionTestFixture, AgradDistributionWiener_fd_4925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4926, AgradDistributionTestFixture, AgradDistributionWiener_fd_4926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4927, AgradDistributionTestFixture, AgradDistributionWiener_fd_4927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4928, AgradDistributionTestFixture, AgradDistributionWiener_fd_4928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4929, AgradDistributionTestFixture, AgradDistributionWiener_fd_4929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4930, AgradDistributionTestFixture, AgradDistributionWiener_fd_4930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4931, AgradDistributionTestFixture, AgradDistributionWiener_fd_4931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4932, AgradDistributionTestFixture, AgradDistributionWiener_fd_4932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4933, AgradDistributionTestFixture, AgradDistributionWiener_fd_4933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4934, AgradDistributionTestFixture, AgradDistributionWiener_fd_4934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4935, AgradDistributionTestFixture, AgradDistributionWiener_fd_4935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4936, AgradDistributionTestFixture, AgradDistributionWiener_fd_4936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4937, AgradDistributionTestFixture, AgradDistributionWiener_fd_4937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4938, AgradDistributionTestFixture, AgradDistributionWiener_fd_4938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4939, AgradDistributionTestFixture, AgradDistributionWiener_fd_4939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4940, AgradDistributionTestFixture, AgradDistributionWiener_fd_4940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4941, AgradDistributionTestFixture, AgradDistributionWiener_fd_4941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4942, AgradDistributionTestFixture, AgradDistributionWiener_fd_4942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4943, AgradDistributionTestFixture, AgradDistributionWiener_fd_4943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4944, AgradDistributionTestFixture, AgradDistributionWiener_fd_4944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4945, AgradDistributionTestFixture, AgradDistributionWiener_fd_4945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4946, AgradDistributionTestFixture, AgradDistributionWiener_fd_4946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4947, AgradDistributionTestFixture, AgradDistributionWiener_fd_4947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4948, AgradDistributionTestFixture, AgradDistributionWiener_fd_4948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4949, AgradDistributionTestFixture, AgradDistributionWiener_fd_4949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4950, AgradDistributionTestFixture, AgradDistributionWiener_fd_4950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4951, AgradDistributionTestFixture, AgradDistributionWiener_fd_4951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4952, AgradDistributionTestFixture, AgradDistributionWiener_fd_4952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4953, AgradDistributionTestFixture, AgradDistributionWiener_fd_4953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4954, AgradDistributionTestFixture, AgradDistributionWiener_fd_4954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4955, AgradDistributionTestFixture, AgradDistributionWiener_fd_4955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4956, AgradDistributionTestFixture, AgradDistributionWiener_fd_4956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4957, AgradDistributionTestFixture, AgradDistributionWiener_fd_4957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4958, AgradDistributionTestFixture, AgradDistributionWiener_fd_4958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4959, AgradDistributionTestFixture, AgradDistributionWiener_fd_4959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4960, AgradDistributionTestFixture, AgradDistributionWiener_fd_4960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4961, AgradDistributionTestFixture, AgradDistributionWiener_fd_4961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4962, AgradDistributionTestFixture, AgradDistributionWiener_fd_4962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4963, AgradDistributionTestFixture, AgradDistributionWiener_fd_4963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4964, AgradDistributionTestFixture, AgradDistributionWiener_fd_4964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4965, AgradDistributionTestFixture, AgradDistributionWiener_fd_4965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4966, AgradDistributionTestFixture, AgradDistributionWiener_fd_4966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4967, AgradDistributionTestFixture, AgradDistributionWiener_fd_4967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4968, AgradDistributionTestFixture, AgradDistributionWiener_fd_4968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4969, AgradDistributionTestFixture, AgradDistributionWiener_fd_4969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4970, AgradDistributionTestFixture, AgradDistributionWiener_fd_4970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4971, AgradDistributionTestFixture, AgradDistributionWiener_fd_4971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4972, AgradDistributionTestFixture, AgradDistributionWiener_fd_4972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4973, AgradDistributionTestFixture, AgradDistributionWiener_fd_4973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4974, AgradDistributionTestFixture, AgradDistributionWiener_fd_4974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4975, AgradDistributionTestFixture, AgradDistributionWiener_fd_4975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4976, AgradDistributionTestFixture, AgradDistributionWiener_fd_4976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4977, AgradDistributionTestFixture, AgradDistributionWiener_fd_4977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4978, AgradDistributionTestFixture, AgradDistributionWiener_fd_4978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4979, AgradDistributionTestFixture, AgradDistributionWiener_fd_4979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4980, AgradDistributionTestFixture, AgradDistributionWiener_fd_4980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4981, AgradDistributionTestFixture, AgradDistributionWiener_fd_4981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4982, AgradDistributionTestFixture, AgradDistributionWiener_fd_4982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4983, AgradDistributionTestFixture, AgradDistributionWiener_fd_4983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4984, AgradDistributionTestFixture, AgradDistributionWiener_fd_4984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4985, AgradDistributionTestFixture, AgradDistributionWiener_fd_4985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4986, AgradDistributionTestFixture, AgradDistributionWiener_fd_4986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4987, AgradDistributionTestFixture, AgradDistributionWiener_fd_4987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4988, AgradDistributionTestFixture, AgradDistributionWiener_fd_4988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4989, AgradDistributionTestFixture, AgradDistributionWiener_fd_4989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4990, AgradDistributionTestFixture, AgradDistributionWiener_fd_4990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4991, AgradDistributionTestFixture, AgradDistributionWiener_fd_4991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4992, AgradDistributionTestFixture, AgradDistributionWiener_fd_4992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4993, AgradDistributionTestFixture, AgradDistributionWiener_fd_4993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4994, AgradDistributionTestFixture, AgradDistributionWiener_fd_4994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4995, AgradDistributionTestFixture, AgradDistributionWiener_fd_4995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4996, AgradDistributionTestFixture, AgradDistributionWiener_fd_4996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4997, AgradDistributionTestFixture, AgradDistributionWiener_fd_4997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4998, AgradDistributionTestFixture, AgradDistributionWiener_fd_4998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_4999, AgradDistributionTestFixture, AgradDistributionWiener_fd_4999);
+
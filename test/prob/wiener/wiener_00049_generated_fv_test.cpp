@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4900;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4901;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4902;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4903;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4904;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_4905;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_4906;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4907;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_4908;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_4909;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4910;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_4911;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_4912;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4913;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_4914;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4915;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4916;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4917;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4918;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4919;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4920;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4921;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4922;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_4923;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_4924;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4925;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_4926;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4927;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4928;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_4929;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4930;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4931;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4932;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4933;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4934;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4935;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4936;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4937;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4938;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4939;
+typedef boost::mpl::vector<fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4940;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, double, double, empty> type_fv_4941;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, double, std::vector<double>, empty> type_fv_4942;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4943;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, double, fvar<var>, empty> type_fv_4944;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, double, std::vector<fvar<var>>, empty> type_fv_4945;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4946;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<double>, double, empty> type_fv_4947;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<double>, std::vector<double>, empty> type_fv_4948;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4949;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<double>, fvar<var>, empty> type_fv_4950;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4951;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4952;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4953;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4954;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4955;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4956;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4957;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4958;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, fvar<var>, double, empty> type_fv_4959;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, fvar<var>, std::vector<double>, empty> type_fv_4960;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4961;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, fvar<var>, fvar<var>, empty> type_fv_4962;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4963;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4964;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, double, empty> type_fv_4965;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_4966;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4967;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_4968;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_4969;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4970;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_4971;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4972;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4973;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4974;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4975;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4976;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, double, double, empty> type_fv_4977;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, double, std::vector<double>, empty> type_fv_4978;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4979;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, double, fvar<var>, empty> type_fv_4980;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_4981;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4982;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, double, empty> type_fv_4983;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_4984;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4985;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_4986;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_4987;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4988;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_4989;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_4990;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4991;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_4992;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_4993;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_4994;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, double, empty> type_fv_4995;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_4996;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_4997;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_4998;
+typedef boost::mpl::vector<std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_4999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4900> AgradDistributionWiener_fv_4900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4901> AgradDistributionWiener_fv_4901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4902> AgradDistributionWiener_fv_4902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4903> AgradDistributionWiener_fv_4903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4904> AgradDistributionWiener_fv_4904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4905> AgradDistributionWiener_fv_4905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4906> AgradDistributionWiener_fv_4906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4907> AgradDistributionWiener_fv_4907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4908> AgradDistributionWiener_fv_4908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4909> AgradDistributionWiener_fv_4909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4910> AgradDistributionWiener_fv_4910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4911> AgradDistributionWiener_fv_4911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4912> AgradDistributionWiener_fv_4912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4913> AgradDistributionWiener_fv_4913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4914> AgradDistributionWiener_fv_4914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4915> AgradDistributionWiener_fv_4915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4916> AgradDistributionWiener_fv_4916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4917> AgradDistributionWiener_fv_4917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4918> AgradDistributionWiener_fv_4918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4919> AgradDistributionWiener_fv_4919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4920> AgradDistributionWiener_fv_4920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4921> AgradDistributionWiener_fv_4921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4922> AgradDistributionWiener_fv_4922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4923> AgradDistributionWiener_fv_4923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4924> AgradDistributionWiener_fv_4924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4925> AgradDistributionWiener_fv_4925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4926> AgradDistributionWiener_fv_4926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4927> AgradDistributionWiener_fv_4927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4928> AgradDistributionWiener_fv_4928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4929> AgradDistributionWiener_fv_4929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4930> AgradDistributionWiener_fv_4930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4931> AgradDistributionWiener_fv_4931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4932> AgradDistributionWiener_fv_4932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4933> AgradDistributionWiener_fv_4933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4934> AgradDistributionWiener_fv_4934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4935> AgradDistributionWiener_fv_4935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4936> AgradDistributionWiener_fv_4936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4937> AgradDistributionWiener_fv_4937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4938> AgradDistributionWiener_fv_4938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4939> AgradDistributionWiener_fv_4939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4940> AgradDistributionWiener_fv_4940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4941> AgradDistributionWiener_fv_4941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4942> AgradDistributionWiener_fv_4942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4943> AgradDistributionWiener_fv_4943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4944> AgradDistributionWiener_fv_4944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4945> AgradDistributionWiener_fv_4945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4946> AgradDistributionWiener_fv_4946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4947> AgradDistributionWiener_fv_4947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4948> AgradDistributionWiener_fv_4948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4949> AgradDistributionWiener_fv_4949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4950> AgradDistributionWiener_fv_4950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4951> AgradDistributionWiener_fv_4951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4952> AgradDistributionWiener_fv_4952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4953> AgradDistributionWiener_fv_4953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4954> AgradDistributionWiener_fv_4954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4955> AgradDistributionWiener_fv_4955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4956> AgradDistributionWiener_fv_4956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4957> AgradDistributionWiener_fv_4957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4958> AgradDistributionWiener_fv_4958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4959> AgradDistributionWiener_fv_4959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4960> AgradDistributionWiener_fv_4960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4961> AgradDistributionWiener_fv_4961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4962> AgradDistributionWiener_fv_4962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4963> AgradDistributionWiener_fv_4963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4964> AgradDistributionWiener_fv_4964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4965> AgradDistributionWiener_fv_4965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4966> AgradDistributionWiener_fv_4966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4967> AgradDistributionWiener_fv_4967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4968> AgradDistributionWiener_fv_4968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4969> AgradDistributionWiener_fv_4969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4970> AgradDistributionWiener_fv_4970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4971> AgradDistributionWiener_fv_4971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4972> AgradDistributionWiener_fv_4972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4973> AgradDistributionWiener_fv_4973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4974> AgradDistributionWiener_fv_4974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4975> AgradDistributionWiener_fv_4975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4976> AgradDistributionWiener_fv_4976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4977> AgradDistributionWiener_fv_4977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4978> AgradDistributionWiener_fv_4978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4979> AgradDistributionWiener_fv_4979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4980> AgradDistributionWiener_fv_4980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4981> AgradDistributionWiener_fv_4981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4982> AgradDistributionWiener_fv_4982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4983> AgradDistributionWiener_fv_4983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4984> AgradDistributionWiener_fv_4984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4985> AgradDistributionWiener_fv_4985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4986> AgradDistributionWiener_fv_4986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4987> AgradDistributionWiener_fv_4987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4988> AgradDistributionWiener_fv_4988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4989> AgradDistributionWiener_fv_4989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4990> AgradDistributionWiener_fv_4990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4991> AgradDistributionWiener_fv_4991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4992> AgradDistributionWiener_fv_4992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4993> AgradDistributionWiener_fv_4993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4994> AgradDistributionWiener_fv_4994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4995> AgradDistributionWiener_fv_4995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4996> AgradDistributionWiener_fv_4996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4997> AgradDistributionWiener_fv_4997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4998> AgradDistributionWiener_fv_4998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_4999> AgradDistributionWiener_fv_4999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4900, AgradDistributionTestFixture, AgradDistributionWiener_fv_4900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4901, AgradDistributionTestFixture, AgradDistributionWiener_fv_4901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4902, AgradDistributionTestFixture, AgradDistributionWiener_fv_4902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4903, AgradDistributionTestFixture, AgradDistributionWiener_fv_4903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4904, AgradDistributionTestFixture, AgradDistributionWiener_fv_4904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4905, AgradDistributionTestFixture, AgradDistributionWiener_fv_4905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4906, AgradDistributionTestFixture, AgradDistributionWiener_fv_4906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4907, AgradDistributionTestFixture, AgradDistributionWiener_fv_4907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4908, AgradDistributionTestFixture, AgradDistributionWiener_fv_4908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4909, AgradDistributionTestFixture, AgradDistributionWiener_fv_4909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4910, AgradDistributionTestFixture, AgradDistributionWiener_fv_4910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4911, AgradDistributionTestFixture, AgradDistributionWiener_fv_4911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4912, AgradDistributionTestFixture, AgradDistributionWiener_fv_4912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4913, AgradDistributionTestFixture, AgradDistributionWiener_fv_4913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4914, AgradDistributionTestFixture, AgradDistributionWiener_fv_4914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4915, AgradDistributionTestFixture, AgradDistributionWiener_fv_4915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4916, AgradDistributionTestFixture, AgradDistributionWiener_fv_4916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4917, AgradDistributionTestFixture, AgradDistributionWiener_fv_4917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4918, AgradDistributionTestFixture, AgradDistributionWiener_fv_4918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4919, AgradDistributionTestFixture, AgradDistributionWiener_fv_4919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4920, AgradDistributionTestFixture, AgradDistributionWiener_fv_4920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4921, AgradDistributionTestFixture, AgradDistributionWiener_fv_4921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4922, AgradDistributionTestFixture, AgradDistributionWiener_fv_4922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4923, AgradDistributionTestFixture, AgradDistributionWiener_fv_4923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4924, AgradDistributionTestFixture, AgradDistributionWiener_fv_4924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4925, AgradDistributionTestFixture, AgradDistributionWiener_fv_4925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4926, AgradDistributionTestFixture, AgradDistributionWiener_fv_4926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4927, AgradDistributionTestFixture, AgradDistributionWiener_fv_4927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4928, AgradDistributionTestFixture, AgradDistributionWiener_fv_4928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4929, AgradDistributionTestFixture, AgradDistributionWiener_fv_4929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4930, AgradDistributionTestFixture, AgradDistributionWiener_fv_4930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4931, AgradDistributionTestFixture, AgradDistributionWiener_fv_4931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4932, AgradDistributionTestFixture, AgradDistributionWiener_fv_4932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4933, AgradDistributionTestFixture, AgradDistributionWiener_fv_4933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4934, AgradDistributionTestFixture, AgradDistributionWiener_fv_4934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4935, AgradDistributionTestFixture, AgradDistributionWiener_fv_4935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4936, AgradDistributionTestFixture, AgradDistributionWiener_fv_4936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4937, AgradDistributionTestFixture, AgradDistributionWiener_fv_4937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4938, AgradDistributionTestFixture, AgradDistributionWiener_fv_4938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4939, AgradDistributionTestFixture, AgradDistributionWiener_fv_4939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4940, AgradDistributionTestFixture, AgradDistributionWiener_fv_4940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4941, AgradDistributionTestFixture, AgradDistributionWiener_fv_4941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4942, AgradDistributionTestFixture, AgradDistributionWiener_fv_4942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4943, AgradDistributionTestFixture, AgradDistributionWiener_fv_4943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4944, AgradDistributionTestFixture, AgradDistributionWiener_fv_4944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4945, AgradDistributionTestFixture, AgradDistributionWiener_fv_4945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4946, AgradDistributionTestFixture, AgradDistributionWiener_fv_4946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4947, AgradDistributionTestFixture, AgradDistributionWiener_fv_4947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4948, AgradDistributionTestFixture, AgradDistributionWiener_fv_4948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4949, AgradDistributionTestFixture, AgradDistributionWiener_fv_4949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4950, AgradDistributionTestFixture, AgradDistributionWiener_fv_4950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4951, AgradDistributionTestFixture, AgradDistributionWiener_fv_4951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4952, AgradDistributionTestFixture, AgradDistributionWiener_fv_4952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4953, AgradDistributionTestFixture, AgradDistributionWiener_fv_4953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4954, AgradDistributionTestFixture, AgradDistributionWiener_fv_4954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4955, AgradDistributionTestFixture, AgradDistributionWiener_fv_4955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4956, AgradDistributionTestFixture, AgradDistributionWiener_fv_4956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4957, AgradDistributionTestFixture, AgradDistributionWiener_fv_4957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4958, AgradDistributionTestFixture, AgradDistributionWiener_fv_4958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4959, AgradDistributionTestFixture, AgradDistributionWiener_fv_4959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4960, AgradDistributionTestFixture, AgradDistributionWiener_fv_4960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4961, AgradDistributionTestFixture, AgradDistributionWiener_fv_4961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4962, AgradDistributionTestFixture, AgradDistributionWiener_fv_4962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4963, AgradDistributionTestFixture, AgradDistributionWiener_fv_4963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4964, AgradDistributionTestFixture, AgradDistributionWiener_fv_4964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4965, AgradDistributionTestFixture, AgradDistributionWiener_fv_4965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4966, AgradDistributionTestFixture, AgradDistributionWiener_fv_4966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4967, AgradDistributionTestFixture, AgradDistributionWiener_fv_4967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4968, AgradDistributionTestFixture, AgradDistributionWiener_fv_4968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4969, AgradDistributionTestFixture, AgradDistributionWiener_fv_4969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4970, AgradDistributionTestFixture, AgradDistributionWiener_fv_4970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4971, AgradDistributionTestFixture, AgradDistributionWiener_fv_4971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4972, AgradDistributionTestFixture, AgradDistributionWiener_fv_4972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4973, AgradDistributionTestFixture, AgradDistributionWiener_fv_4973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4974, AgradDistributionTestFixture, AgradDistributionWiener_fv_4974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4975, AgradDistributionTestFixture, AgradDistributionWiener_fv_4975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4976, AgradDistributionTestFixture, AgradDistributionWiener_fv_4976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4977, AgradDistributionTestFixture, AgradDistributionWiener_fv_4977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4978, AgradDistributionTestFixture, AgradDistributionWiener_fv_4978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4979, AgradDistributionTestFixture, AgradDistributionWiener_fv_4979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4980, AgradDistributionTestFixture, AgradDistributionWiener_fv_4980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4981, AgradDistributionTestFixture, AgradDistributionWiener_fv_4981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4982, AgradDistributionTestFixture, AgradDistributionWiener_fv_4982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4983, AgradDistributionTestFixture, AgradDistributionWiener_fv_4983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4984, AgradDistributionTestFixture, AgradDistributionWiener_fv_4984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4985, AgradDistributionTestFixture, AgradDistributionWiener_fv_4985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4986, AgradDistributionTestFixture, AgradDistributionWiener_fv_4986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4987, AgradDistributionTestFixture, AgradDistributionWiener_fv_4987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4988, AgradDistributionTestFixture, AgradDistributionWiener_fv_4988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4989, AgradDistributionTestFixture, AgradDistributionWiener_fv_4989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4990, AgradDistributionTestFixture, AgradDistributionWiener_fv_4990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4991, AgradDistributionTestFixture, AgradDistributionWiener_fv_4991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4992, AgradDistributionTestFixture, AgradDistributionWiener_fv_4992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4993, AgradDistributionTestFixture, AgradDistributionWiener_fv_4993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4994, AgradDistributionTestFixture, AgradDistributionWiener_fv_4994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4995, AgradDistributionTestFixture, AgradDistributionWiener_fv_4995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4996, AgradDistributionTestFixture, AgradDistributionWiener_fv_4996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4997, AgradDistributionTestFixture, AgradDistributionWiener_fv_4997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4998, AgradDistributionTestFixture, AgradDistributionWiener_fv_4998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_4999, AgradDistributionTestFixture, AgradDistributionWiener_fv_4999);
+
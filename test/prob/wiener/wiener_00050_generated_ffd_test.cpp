@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5000;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5001;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5002;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5003;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5004;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5005;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5006;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5007;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5008;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5009;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5010;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5011;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5012;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_5013;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_5014;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5015;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_5016;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5017;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5018;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_5019;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_5020;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5021;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5022;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5023;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5024;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5025;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5026;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5027;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5028;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5029;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5030;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_5031;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5032;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5033;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5034;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5035;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5036;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5037;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5038;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5039;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5040;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5041;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5042;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5043;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5044;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5045;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5046;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5047;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5048;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, double, empty> type_ffd_5049;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_5050;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5051;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_5052;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5053;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5054;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_5055;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_5056;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5057;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5058;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5059;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5060;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5061;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5062;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5063;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5064;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5065;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5066;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_5067;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5068;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5069;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5070;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5071;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5072;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5073;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5074;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5075;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5076;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5077;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5078;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5079;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5080;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5081;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5082;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5083;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5084;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_5085;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_5086;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5087;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_5088;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5089;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5090;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_5091;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_5092;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5093;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5094;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5095;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5096;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5097;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5098;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5000> AgradDistributionWiener_ffd_5000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5001> AgradDistributionWiener_ffd_5001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5002> AgradDistributionWiener_ffd_5002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5003> AgradDistributionWiener_ffd_5003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5004> AgradDistributionWiener_ffd_5004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5005> AgradDistributionWiener_ffd_5005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5006> AgradDistributionWiener_ffd_5006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5007> AgradDistributionWiener_ffd_5007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5008> AgradDistributionWiener_ffd_5008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5009> AgradDistributionWiener_ffd_5009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5010> AgradDistributionWiener_ffd_5010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5011> AgradDistributionWiener_ffd_5011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5012> AgradDistributionWiener_ffd_5012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5013> AgradDistributionWiener_ffd_5013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5014> AgradDistributionWiener_ffd_5014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5015> AgradDistributionWiener_ffd_5015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5016> AgradDistributionWiener_ffd_5016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5017> AgradDistributionWiener_ffd_5017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5018> AgradDistributionWiener_ffd_5018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5019> AgradDistributionWiener_ffd_5019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5020> AgradDistributionWiener_ffd_5020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5021> AgradDistributionWiener_ffd_5021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5022> AgradDistributionWiener_ffd_5022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5023> AgradDistributionWiener_ffd_5023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5024> AgradDistributionWiener_ffd_5024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5025> AgradDistributionWiener_ffd_5025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5026> AgradDistributionWiener_ffd_5026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5027> AgradDistributionWiener_ffd_5027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5028> AgradDistributionWiener_ffd_5028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5029> AgradDistributionWiener_ffd_5029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5030> AgradDistributionWiener_ffd_5030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5031> AgradDistributionWiener_ffd_5031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5032> AgradDistributionWiener_ffd_5032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5033> AgradDistributionWiener_ffd_5033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5034> AgradDistributionWiener_ffd_5034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5035> AgradDistributionWiener_ffd_5035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5036> AgradDistributionWiener_ffd_5036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5037> AgradDistributionWiener_ffd_5037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5038> AgradDistributionWiener_ffd_5038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5039> AgradDistributionWiener_ffd_5039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5040> AgradDistributionWiener_ffd_5040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5041> AgradDistributionWiener_ffd_5041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5042> AgradDistributionWiener_ffd_5042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5043> AgradDistributionWiener_ffd_5043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5044> AgradDistributionWiener_ffd_5044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5045> AgradDistributionWiener_ffd_5045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5046> AgradDistributionWiener_ffd_5046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5047> AgradDistributionWiener_ffd_5047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5048> AgradDistributionWiener_ffd_5048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5049> AgradDistributionWiener_ffd_5049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5050> AgradDistributionWiener_ffd_5050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5051> AgradDistributionWiener_ffd_5051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5052> AgradDistributionWiener_ffd_5052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5053> AgradDistributionWiener_ffd_5053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5054> AgradDistributionWiener_ffd_5054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5055> AgradDistributionWiener_ffd_5055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5056> AgradDistributionWiener_ffd_5056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5057> AgradDistributionWiener_ffd_5057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5058> AgradDistributionWiener_ffd_5058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5059> AgradDistributionWiener_ffd_5059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5060> AgradDistributionWiener_ffd_5060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5061> AgradDistributionWiener_ffd_5061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5062> AgradDistributionWiener_ffd_5062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5063> AgradDistributionWiener_ffd_5063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5064> AgradDistributionWiener_ffd_5064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5065> AgradDistributionWiener_ffd_5065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5066> AgradDistributionWiener_ffd_5066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5067> AgradDistributionWiener_ffd_5067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5068> AgradDistributionWiener_ffd_5068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5069> AgradDistributionWiener_ffd_5069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5070> AgradDistributionWiener_ffd_5070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5071> AgradDistributionWiener_ffd_5071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5072> AgradDistributionWiener_ffd_5072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5073> AgradDistributionWiener_ffd_5073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5074> AgradDistributionWiener_ffd_5074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5075> AgradDistributionWiener_ffd_5075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5076> AgradDistributionWiener_ffd_5076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5077> AgradDistributionWiener_ffd_5077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5078> AgradDistributionWiener_ffd_5078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5079> AgradDistributionWiener_ffd_5079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5080> AgradDistributionWiener_ffd_5080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5081> AgradDistributionWiener_ffd_5081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5082> AgradDistributionWiener_ffd_5082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5083> AgradDistributionWiener_ffd_5083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5084> AgradDistributionWiener_ffd_5084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5085> AgradDistributionWiener_ffd_5085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5086> AgradDistributionWiener_ffd_5086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5087> AgradDistributionWiener_ffd_5087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5088> AgradDistributionWiener_ffd_5088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5089> AgradDistributionWiener_ffd_5089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5090> AgradDistributionWiener_ffd_5090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5091> AgradDistributionWiener_ffd_5091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5092> AgradDistributionWiener_ffd_5092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5093> AgradDistributionWiener_ffd_5093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5094> AgradDistributionWiener_ffd_5094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5095> AgradDistributionWiener_ffd_5095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5096> AgradDistributionWiener_ffd_5096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5097> AgradDistributionWiener_ffd_5097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5098> AgradDistributionWiener_ffd_5098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5099> AgradDistributionWiener_ffd_5099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5000, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5001, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5002, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5003, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5004, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5005, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5006, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5007, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5008, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5009, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5010, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5011, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5012, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5013, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5014, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5015, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5016, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5017, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5018, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5019, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5020, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5021, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5022, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5023, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5024, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5025, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5026, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5027, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5028, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5029, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5030, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5031, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5032, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5033, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5034, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5035, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5036, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5037, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5038, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5039, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5040, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5041, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5042, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5043, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5044, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5045, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5046, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5047, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5048, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5049, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5050, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5051, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5052, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5053, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5054, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5055, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5056, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5057, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5058, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5059, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5060, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5061, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5062, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5063, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5064, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5065, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5066, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5067, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5068, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5069, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5070, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5071, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5072, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5073, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5074, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5075, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5076, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5077, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5078, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5079, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5080, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5081, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5082, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5083, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5084, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5085, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5086, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5087, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5088, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5089, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5090, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5091, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5092, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5093, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5094, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5095, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5096, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5097, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5098, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5099, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5000;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5001;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5002;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5003;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5004;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5005;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5006;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5007;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5008;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5009;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5010;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5011;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5012;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_5013;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_5014;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5015;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_5016;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5017;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5018;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_5019;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_5020;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5021;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5022;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5023;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5024;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5025;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5026;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5027;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5028;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5029;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5030;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_5031;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5032;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5033;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5034;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5035;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5036;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5037;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5038;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5039;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5040;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5041;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5042;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5043;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5044;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5045;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5046;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5047;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5048;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, double, empty> type_ffv_5049;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_5050;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5051;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_5052;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5053;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5054;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_5055;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_5056;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5057;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5058;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5059;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5060;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5061;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5062;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5063;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5064;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5065;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5066;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_5067;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5068;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5069;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5070;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5071;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5072;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5073;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5074;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5075;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5076;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5077;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5078;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5079;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5080;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5081;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5082;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5083;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5084;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_5085;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_5086;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5087;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_5088;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5089;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5090;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_5091;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_5092;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5093;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5094;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5095;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5096;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5097;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5098;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5000> AgradDistributionWiener_ffv_5000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5001> AgradDistributionWiener_ffv_5001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5002> AgradDistributionWiener_ffv_5002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5003> AgradDistributionWiener_ffv_5003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5004> AgradDistributionWiener_ffv_5004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5005> AgradDistributionWiener_ffv_5005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5006> AgradDistributionWiener_ffv_5006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5007> AgradDistributionWiener_ffv_5007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5008> AgradDistributionWiener_ffv_5008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5009> AgradDistributionWiener_ffv_5009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5010> AgradDistributionWiener_ffv_5010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5011> AgradDistributionWiener_ffv_5011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5012> AgradDistributionWiener_ffv_5012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5013> AgradDistributionWiener_ffv_5013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5014> AgradDistributionWiener_ffv_5014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5015> AgradDistributionWiener_ffv_5015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5016> AgradDistributionWiener_ffv_5016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5017> AgradDistributionWiener_ffv_5017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5018> AgradDistributionWiener_ffv_5018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5019> AgradDistributionWiener_ffv_5019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5020> AgradDistributionWiener_ffv_5020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5021> AgradDistributionWiener_ffv_5021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5022> AgradDistributionWiener_ffv_5022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5023> AgradDistributionWiener_ffv_5023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5024> AgradDistributionWiener_ffv_5024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5025> AgradDistributionWiener_ffv_5025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5026> AgradDistributionWiener_ffv_5026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5027> AgradDistributionWiener_ffv_5027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5028> AgradDistributionWiener_ffv_5028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5029> AgradDistributionWiener_ffv_5029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5030> AgradDistributionWiener_ffv_5030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5031> AgradDistributionWiener_ffv_5031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5032> AgradDistributionWiener_ffv_5032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5033> AgradDistributionWiener_ffv_5033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5034> AgradDistributionWiener_ffv_5034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5035> AgradDistributionWiener_ffv_5035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5036> AgradDistributionWiener_ffv_5036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5037> AgradDistributionWiener_ffv_5037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5038> AgradDistributionWiener_ffv_5038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5039> AgradDistributionWiener_ffv_5039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5040> AgradDistributionWiener_ffv_5040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5041> AgradDistributionWiener_ffv_5041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5042> AgradDistributionWiener_ffv_5042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5043> AgradDistributionWiener_ffv_5043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5044> AgradDistributionWiener_ffv_5044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5045> AgradDistributionWiener_ffv_5045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5046> AgradDistributionWiener_ffv_5046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5047> AgradDistributionWiener_ffv_5047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5048> AgradDistributionWiener_ffv_5048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5049> AgradDistributionWiener_ffv_5049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5050> AgradDistributionWiener_ffv_5050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5051> AgradDistributionWiener_ffv_5051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5052> AgradDistributionWiener_ffv_5052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5053> AgradDistributionWiener_ffv_5053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5054> AgradDistributionWiener_ffv_5054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5055> AgradDistributionWiener_ffv_5055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5056> AgradDistributionWiener_ffv_5056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5057> AgradDistributionWiener_ffv_5057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5058> AgradDistributionWiener_ffv_5058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5059> AgradDistributionWiener_ffv_5059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5060> AgradDistributionWiener_ffv_5060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5061> AgradDistributionWiener_ffv_5061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5062> AgradDistributionWiener_ffv_5062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5063> AgradDistributionWiener_ffv_5063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5064> AgradDistributionWiener_ffv_5064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5065> AgradDistributionWiener_ffv_5065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5066> AgradDistributionWiener_ffv_5066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5067> AgradDistributionWiener_ffv_5067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5068> AgradDistributionWiener_ffv_5068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5069> AgradDistributionWiener_ffv_5069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5070> AgradDistributionWiener_ffv_5070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5071> AgradDistributionWiener_ffv_5071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5072> AgradDistributionWiener_ffv_5072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5073> AgradDistributionWiener_ffv_5073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5074> AgradDistributionWiener_ffv_5074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5075> AgradDistributionWiener_ffv_5075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5076> AgradDistributionWiener_ffv_5076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5077> AgradDistributionWiener_ffv_5077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5078> AgradDistributionWiener_ffv_5078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5079> AgradDistributionWiener_ffv_5079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5080> AgradDistributionWiener_ffv_5080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5081> AgradDistributionWiener_ffv_5081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5082> AgradDistributionWiener_ffv_5082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5083> AgradDistributionWiener_ffv_5083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5084> AgradDistributionWiener_ffv_5084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5085> AgradDistributionWiener_ffv_5085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5086> AgradDistributionWiener_ffv_5086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5087> AgradDistributionWiener_ffv_5087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5088> AgradDistributionWiener_ffv_5088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5089> AgradDistributionWiener_ffv_5089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5090> AgradDistributionWiener_ffv_5090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5091> AgradDistributionWiener_ffv_5091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5092> AgradDistributionWiener_ffv_5092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5093> AgradDistributionWiener_ffv_5093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5094> AgradDistributionWiener_ffv_5094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5095> AgradDistributionWiener_ffv_5095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5096> AgradDistributionWiener_ffv_5096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5097> AgradDistributionWiener_ffv_5097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5098> AgradDistributionWiener_ffv_5098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5099> AgradDistributionWiener_ffv_5099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5000, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5001, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5002, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5003, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5004, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5005, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5006, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5007, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5008, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5009, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5010, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5011, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5012, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5013, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5014, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5015, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5016, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5017, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5018, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5019, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5020, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5021, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5022, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5023, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5024, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5025, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5026, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5027, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5028, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5029, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5030, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5031, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5032, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5033, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5034, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5035, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5036, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5037, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5038, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5039, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5040, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5041, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5042, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5043, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5044, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5045, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5046, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5047, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5048, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5049, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5050, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5051, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5052, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5053, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5054, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5055, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5056, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5057, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5058, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5059, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5060, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5061, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5062, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5063, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5064, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5065, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5066, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5067, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5068, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5069, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5070, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5071, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5072, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5073, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5074, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5075, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5076, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5077, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5078, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5079, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5080, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5081, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5082, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5083, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5084, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5085, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5086, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5087, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5088, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5089, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5090, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5091, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5092, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5093, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5094, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5095, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5096, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5097, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5098, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5099, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5100;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5101;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5102;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_5103;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_5104;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5105;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_5106;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5107;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5108;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_5109;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5110;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5111;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5112;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5113;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5114;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5115;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5116;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5117;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5118;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5119;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5120;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_5121;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_5122;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5123;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_5124;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_5125;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5126;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_5127;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_5128;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5129;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_5130;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5131;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5132;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5133;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5134;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5135;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5136;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5137;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5138;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_5139;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_5140;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5141;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_5142;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5143;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5144;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_5145;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5146;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5147;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5148;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5149;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5150;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5151;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5152;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5153;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5154;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5155;
+typedef boost::mpl::vector<std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5156;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, double, double, empty> type_fd_5157;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, double, std::vector<double>, empty> type_fd_5158;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5159;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, double, fvar<double>, empty> type_fd_5160;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, double, std::vector<fvar<double>>, empty> type_fd_5161;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5162;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, double, empty> type_fd_5163;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, std::vector<double>, empty> type_fd_5164;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5165;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, fvar<double>, empty> type_fd_5166;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5167;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5168;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5169;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5170;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5171;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5172;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5173;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5174;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, double, empty> type_fd_5175;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, std::vector<double>, empty> type_fd_5176;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5177;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, fvar<double>, empty> type_fd_5178;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5179;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5180;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, double, empty> type_fd_5181;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5182;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5183;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5184;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5185;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5186;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5187;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5188;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5189;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5190;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5191;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5192;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, double, empty> type_fd_5193;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, std::vector<double>, empty> type_fd_5194;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5195;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, fvar<double>, empty> type_fd_5196;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_5197;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5198;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<double>, double, empty> type_fd_5199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5100> AgradDistributionWiener_fd_5100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5101> AgradDistributionWiener_fd_5101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5102> AgradDistributionWiener_fd_5102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5103> AgradDistributionWiener_fd_5103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5104> AgradDistributionWiener_fd_5104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5105> AgradDistributionWiener_fd_5105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5106> AgradDistributionWiener_fd_5106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5107> AgradDistributionWiener_fd_5107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5108> AgradDistributionWiener_fd_5108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5109> AgradDistributionWiener_fd_5109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5110> AgradDistributionWiener_fd_5110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5111> AgradDistributionWiener_fd_5111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5112> AgradDistributionWiener_fd_5112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5113> AgradDistributionWiener_fd_5113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5114> AgradDistributionWiener_fd_5114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5115> AgradDistributionWiener_fd_5115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5116> AgradDistributionWiener_fd_5116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5117> AgradDistributionWiener_fd_5117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5118> AgradDistributionWiener_fd_5118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5119> AgradDistributionWiener_fd_5119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5120> AgradDistributionWiener_fd_5120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5121> AgradDistributionWiener_fd_5121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5122> AgradDistributionWiener_fd_5122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5123> AgradDistributionWiener_fd_5123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5124> AgradDistributionWiener_fd_5124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5125> AgradDistributionWiener_fd_5125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5126> AgradDistributionWiener_fd_5126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5127> AgradDistributionWiener_fd_5127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5128> AgradDistributionWiener_fd_5128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5129> AgradDistributionWiener_fd_5129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5130> AgradDistributionWiener_fd_5130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5131> AgradDistributionWiener_fd_5131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5132> AgradDistributionWiener_fd_5132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5133> AgradDistributionWiener_fd_5133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5134> AgradDistributionWiener_fd_5134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5135> AgradDistributionWiener_fd_5135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5136> AgradDistributionWiener_fd_5136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5137> AgradDistributionWiener_fd_5137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5138> AgradDistributionWiener_fd_5138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5139> AgradDistributionWiener_fd_5139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5140> AgradDistributionWiener_fd_5140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5141> AgradDistributionWiener_fd_5141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5142> AgradDistributionWiener_fd_5142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5143> AgradDistributionWiener_fd_5143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5144> AgradDistributionWiener_fd_5144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5145> AgradDistributionWiener_fd_5145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5146> AgradDistributionWiener_fd_5146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5147> AgradDistributionWiener_fd_5147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5148> AgradDistributionWiener_fd_5148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5149> AgradDistributionWiener_fd_5149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5150> AgradDistributionWiener_fd_5150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5151> AgradDistributionWiener_fd_5151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5152> AgradDistributionWiener_fd_5152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5153> AgradDistributionWiener_fd_5153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5154> AgradDistributionWiener_fd_5154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5155> AgradDistributionWiener_fd_5155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5156> AgradDistributionWiener_fd_5156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5157> AgradDistributionWiener_fd_5157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5158> AgradDistributionWiener_fd_5158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5159> AgradDistributionWiener_fd_5159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5160> AgradDistributionWiener_fd_5160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5161> AgradDistributionWiener_fd_5161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5162> AgradDistributionWiener_fd_5162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5163> AgradDistributionWiener_fd_5163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5164> AgradDistributionWiener_fd_5164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5165> AgradDistributionWiener_fd_5165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5166> AgradDistributionWiener_fd_5166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5167> AgradDistributionWiener_fd_5167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5168> AgradDistributionWiener_fd_5168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5169> AgradDistributionWiener_fd_5169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5170> AgradDistributionWiener_fd_5170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5171> AgradDistributionWiener_fd_5171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5172> AgradDistributionWiener_fd_5172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5173> AgradDistributionWiener_fd_5173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5174> AgradDistributionWiener_fd_5174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5175> AgradDistributionWiener_fd_5175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5176> AgradDistributionWiener_fd_5176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5177> AgradDistributionWiener_fd_5177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5178> AgradDistributionWiener_fd_5178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5179> AgradDistributionWiener_fd_5179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5180> AgradDistributionWiener_fd_5180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5181> AgradDistributionWiener_fd_5181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5182> AgradDistributionWiener_fd_5182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5183> AgradDistributionWiener_fd_5183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5184> AgradDistributionWiener_fd_5184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5185> AgradDistributionWiener_fd_5185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5186> AgradDistributionWiener_fd_5186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5187> AgradDistributionWiener_fd_5187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5188> AgradDistributionWiener_fd_5188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5189> AgradDistributionWiener_fd_5189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5190> AgradDistributionWiener_fd_5190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5191> AgradDistributionWiener_fd_5191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5192> AgradDistributionWiener_fd_5192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5193> AgradDistributionWiener_fd_5193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5194> AgradDistributionWiener_fd_5194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5195> AgradDistributionWiener_fd_5195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5196> AgradDistributionWiener_fd_5196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5197> AgradDistributionWiener_fd_5197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5198> AgradDistributionWiener_fd_5198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5199> AgradDistributionWiener_fd_5199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5100, AgradDistributionTestFixture, AgradDistributionWiener_fd_5100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5101, AgradDistributionTestFixture, AgradDistributionWiener_fd_5101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5102, AgradDistributionTestFixture, AgradDistributionWiener_fd_5102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5103, AgradDistributionTestFixture, AgradDistributionWiener_fd_5103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5104, AgradDistributionTestFixture, AgradDistributionWiener_fd_5104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5105, AgradDistributionTestFixture, AgradDistributionWiener_fd_5105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5106, AgradDistributionTestFixture, AgradDistributionWiener_fd_5106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5107, AgradDistributionTestFixture, AgradDistributionWiener_fd_5107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5108, AgradDistributionTestFixture, AgradDistributionWiener_fd_5108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5109, AgradDistributionTestFixture, AgradDistributionWiener_fd_5109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5110, AgradDistributionTestFixture, AgradDistributionWiener_fd_5110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5111, AgradDistributionTestFixture, AgradDistributionWiener_fd_5111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5112, AgradDistributionTestFixture, AgradDistributionWiener_fd_5112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5113, AgradDistributionTestFixture, AgradDistributionWiener_fd_5113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5114, AgradDistributionTestFixture, AgradDistributionWiener_fd_5114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5115, AgradDistributionTestFixture, AgradDistributionWiener_fd_5115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5116, AgradDistributionTestFixture, AgradDistributionWiener_fd_5116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5117, AgradDistributionTestFixture, AgradDistributionWiener_fd_5117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5118, AgradDistributionTestFixture, AgradDistributionWiener_fd_5118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5119, AgradDistributionTestFixture, AgradDistributionWiener_fd_5119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5120, AgradDistributionTestFixture, AgradDistributionWiener_fd_5120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5121, AgradDistributionTestFixture, AgradDistributionWiener_fd_5121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5122, AgradDistributionTestFixture, AgradDistributionWiener_fd_5122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5123, AgradDistributionTestFixture, AgradDistributionWiener_fd_5123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5124, AgradDistributionTestFixture, AgradDistributionWiener_fd_5124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5125, AgradDistributionTestFixture, AgradDistributionWiener_fd_5125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5126, AgradDistributionTestFixture, AgradDistributionWiener_fd_5126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5127, AgradDistributionTestFixture, AgradDistributionWiener_fd_5127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5128, AgradDistributionTestFixture, AgradDistributionWiener_fd_5128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5129, AgradDistributionTestFixture, AgradDistributionWiener_fd_5129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5130, AgradDistributionTestFixture, AgradDistributionWiener_fd_5130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5131, AgradDistributionTestFixture, AgradDistributionWiener_fd_5131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5132, AgradDistributionTestFixture, AgradDistributionWiener_fd_5132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5133, AgradDistributionTestFixture, AgradDistributionWiener_fd_5133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5134, AgradDistributionTestFixture, AgradDistributionWiener_fd_5134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5135, AgradDistributionTestFixture, AgradDistributionWiener_fd_5135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5136, AgradDistributionTestFixture, AgradDistributionWiener_fd_5136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5137, AgradDistributionTestFixture, AgradDistributionWiener_fd_5137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5138, AgradDistributionTestFixture, AgradDistributionWiener_fd_5138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5139, AgradDistributionTestFixture, AgradDistributionWiener_fd_5139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5140, AgradDistributionTestFixture, AgradDistributionWiener_fd_5140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5141, AgradDistributionTestFixture, AgradDistributionWiener_fd_5141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5142, AgradDistributionTestFixture, AgradDistributionWiener_fd_5142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5143, AgradDistributionTestFixture, AgradDistributionWiener_fd_5143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5144, AgradDistributionTestFixture, AgradDistributionWiener_fd_5144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5145, AgradDistributionTestFixture, AgradDistributionWiener_fd_5145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5146, AgradDistributionTestFixture, AgradDistributionWiener_fd_5146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5147, AgradDistributionTestFixture, AgradDistributionWiener_fd_5147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5148, AgradDistributionTestFixture, AgradDistributionWiener_fd_5148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5149, AgradDistributionTestFixture, AgradDistributionWiener_fd_5149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5150, AgradDistributionTestFixture, AgradDistributionWiener_fd_5150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5151, AgradDistributionTestFixture, AgradDistributionWiener_fd_5151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5152, AgradDistributionTestFixture, AgradDistributionWiener_fd_5152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5153, AgradDistributionTestFixture, AgradDistributionWiener_fd_5153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5154, AgradDistributionTestFixture, AgradDistributionWiener_fd_5154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5155, AgradDistributionTestFixture, AgradDistributionWiener_fd_5155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5156, AgradDistributionTestFixture, AgradDistributionWiener_fd_5156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5157, AgradDistributionTestFixture, AgradDistributionWiener_fd_5157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5158, AgradDistributionTestFixture, AgradDistributionWiener_fd_5158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5159, AgradDistributionTestFixture, AgradDistributionWiener_fd_5159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5160, AgradDistributionTestFixture, AgradDistributionWiener_fd_5160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5161, AgradDistributionTestFixture, AgradDistributionWiener_fd_5161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5162, AgradDistributionTestFixture, AgradDistributionWiener_fd_5162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5163, AgradDistributionTestFixture, AgradDistributionWiener_fd_5163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5164, AgradDistributionTestFixture, AgradDistributionWiener_fd_5164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5165, AgradDistributionTestFixture, AgradDistributionWiener_fd_5165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5166, AgradDistributionTestFixture, AgradDistributionWiener_fd_5166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5167, AgradDistributionTestFixture, AgradDistributionWiener_fd_5167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5168, AgradDistributionTestFixture, AgradDistributionWiener_fd_5168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5169, AgradDistributionTestFixture, AgradDistributionWiener_fd_5169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5170, AgradDistributionTestFixture, AgradDistributionWiener_fd_5170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5171, AgradDistributionTestFixture, AgradDistributionWiener_fd_5171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5172, AgradDistributionTestFixture, AgradDistributionWiener_fd_5172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5173, AgradDistributionTestFixture, AgradDistributionWiener_fd_5173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5174, AgradDistributionTestFixture, AgradDistributionWiener_fd_5174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5175, AgradDistributionTestFixture, AgradDistributionWiener_fd_5175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5176, AgradDistributionTestFixture, AgradDistributionWiener_fd_5176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5177, AgradDistributionTestFixture, AgradDistributionWiener_fd_5177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5178, AgradDistributionTestFixture, AgradDistributionWiener_fd_5178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5179, AgradDistributionTestFixture, AgradDistributionWiener_fd_5179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5180, AgradDistributionTestFixture, AgradDistributionWiener_fd_5180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5181, AgradDistributionTestFixture, AgradDistributionWiener_fd_5181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5182, AgradDistributionTestFixture, AgradDistributionWiener_fd_5182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5183, AgradDistributionTestFixture, AgradDistributionWiener_fd_5183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5184, AgradDistributionTestFixture, AgradDistributionWiener_fd_5184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5185, AgradDistributionTestFixture, AgradDistributionWiener_fd_5185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5186, AgradDistributionTestFixture, AgradDistributionWiener_fd_5186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5187, AgradDistributionTestFixture, AgradDistributionWiener_fd_5187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5188, AgradDistributionTestFixture, AgradDistributionWiener_fd_5188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5189, AgradDistributionTestFixture, AgradDistributionWiener_fd_5189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5190, AgradDistributionTestFixture, AgradDistributionWiener_fd_5190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5191, AgradDistributionTestFixture, AgradDistributionWiener_fd_5191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5192, AgradDistributionTestFixture, AgradDistributionWiener_fd_5192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5193, AgradDistributionTestFixture, AgradDistributionWiener_fd_5193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5194, AgradDistributionTestFixture, AgradDistributionWiener_fd_5194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5195, AgradDistributionTestFixture, AgradDistributionWiener_fd_5195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5196, AgradDistributionTestFixture, AgradDistributionWiener_fd_5196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5197, AgradDistributionTestFixture, AgradDistributionWiener_fd_5197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5198, AgradDistributionTestFixture, AgradDistributionWiener_fd_5198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5199, AgradDistributionTestFixture, AgradDistributionWiener_fd_5199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_5100;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_5101;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5102;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_5103;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_5104;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5105;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5106;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5107;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5108;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5109;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5110;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5111;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_5112;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_5113;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5114;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_5115;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_5116;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5117;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_5118;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_5119;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5120;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_5121;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_5122;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5123;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5124;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5125;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5126;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5127;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5128;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5129;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_5130;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_5131;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5132;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_5133;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_5134;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5135;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_5136;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_5137;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5138;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_5139;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_5140;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5141;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5142;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5143;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5144;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5145;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5146;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5147;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_5148;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_5149;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5150;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_5151;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_5152;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5153;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_5154;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_5155;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5156;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_5157;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_5158;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5159;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5160;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5161;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5162;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5163;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5164;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5165;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_5166;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_5167;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5168;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_5169;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_5170;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5171;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_5172;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_5173;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5174;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_5175;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_5176;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5177;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5178;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5179;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5180;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5181;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5182;
+typedef boost::mpl::vector<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5183;
+typedef boost::mpl::vector<std::vector<var>, double, double, double, double, empty> type_v_5184;
+typedef boost::mpl::vector<std::vector<var>, double, double, double, std::vector<double>, empty> type_v_5185;
+typedef boost::mpl::vector<std::vector<var>, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5186;
+typedef boost::mpl::vector<std::vector<var>, double, double, double, var, empty> type_v_5187;
+typedef boost::mpl::vector<std::vector<var>, double, double, double, std::vector<var>, empty> type_v_5188;
+typedef boost::mpl::vector<std::vector<var>, double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5189;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<double>, double, empty> type_v_5190;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<double>, std::vector<double>, empty> type_v_5191;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5192;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<double>, var, empty> type_v_5193;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<double>, std::vector<var>, empty> type_v_5194;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5195;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5196;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5197;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5198;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5100> AgradDistributionWiener_v_5100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5101> AgradDistributionWiener_v_5101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5102> AgradDistributionWiener_v_5102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5103> AgradDistributionWiener_v_5103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5104> AgradDistributionWiener_v_5104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5105> AgradDistributionWiener_v_5105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5106> AgradDistributionWiener_v_5106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5107> AgradDistributionWiener_v_5107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5108> AgradDistributionWiener_v_5108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5109> AgradDistributionWiener_v_5109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5110> AgradDistributionWiener_v_5110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5111> AgradDistributionWiener_v_5111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5112> AgradDistributionWiener_v_5112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5113> AgradDistributionWiener_v_5113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5114> AgradDistributionWiener_v_5114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5115> AgradDistributionWiener_v_5115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5116> AgradDistributionWiener_v_5116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5117> AgradDistributionWiener_v_5117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5118> AgradDistributionWiener_v_5118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5119> AgradDistributionWiener_v_5119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5120> AgradDistributionWiener_v_5120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5121> AgradDistributionWiener_v_5121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5122> AgradDistributionWiener_v_5122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5123> AgradDistributionWiener_v_5123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5124> AgradDistributionWiener_v_5124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5125> AgradDistributionWiener_v_5125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5126> AgradDistributionWiener_v_5126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5127> AgradDistributionWiener_v_5127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5128> AgradDistributionWiener_v_5128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5129> AgradDistributionWiener_v_5129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5130> AgradDistributionWiener_v_5130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5131> AgradDistributionWiener_v_5131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5132> AgradDistributionWiener_v_5132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5133> AgradDistributionWiener_v_5133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5134> AgradDistributionWiener_v_5134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5135> AgradDistributionWiener_v_5135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5136> AgradDistributionWiener_v_5136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5137> AgradDistributionWiener_v_5137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5138> AgradDistributionWiener_v_5138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5139> AgradDistributionWiener_v_5139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5140> AgradDistributionWiener_v_5140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5141> AgradDistributionWiener_v_5141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5142> AgradDistributionWiener_v_5142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5143> AgradDistributionWiener_v_5143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5144> AgradDistributionWiener_v_5144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5145> AgradDistributionWiener_v_5145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5146> AgradDistributionWiener_v_5146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5147> AgradDistributionWiener_v_5147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5148> AgradDistributionWiener_v_5148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5149> AgradDistributionWiener_v_5149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5150> AgradDistributionWiener_v_5150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5151> AgradDistributionWiener_v_5151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5152> AgradDistributionWiener_v_5152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5153> AgradDistributionWiener_v_5153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5154> AgradDistributionWiener_v_5154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5155> AgradDistributionWiener_v_5155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5156> AgradDistributionWiener_v_5156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5157> AgradDistributionWiener_v_5157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5158> AgradDistributionWiener_v_5158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5159> AgradDistributionWiener_v_5159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5160> AgradDistributionWiener_v_5160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5161> AgradDistributionWiener_v_5161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5162> AgradDistributionWiener_v_5162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5163> AgradDistributionWiener_v_5163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5164> AgradDistributionWiener_v_5164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5165> AgradDistributionWiener_v_5165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5166> AgradDistributionWiener_v_5166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5167> AgradDistributionWiener_v_5167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5168> AgradDistributionWiener_v_5168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5169> AgradDistributionWiener_v_5169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5170> AgradDistributionWiener_v_5170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5171> AgradDistributionWiener_v_5171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5172> AgradDistributionWiener_v_5172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5173> AgradDistributionWiener_v_5173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5174> AgradDistributionWiener_v_5174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5175> AgradDistributionWiener_v_5175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5176> AgradDistributionWiener_v_5176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5177> AgradDistributionWiener_v_5177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5178> AgradDistributionWiener_v_5178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5179> AgradDistributionWiener_v_5179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5180> AgradDistributionWiener_v_5180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5181> AgradDistributionWiener_v_5181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5182> AgradDistributionWiener_v_5182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5183> AgradDistributionWiener_v_5183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5184> AgradDistributionWiener_v_5184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5185> AgradDistributionWiener_v_5185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5186> AgradDistributionWiener_v_5186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5187> AgradDistributionWiener_v_5187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5188> AgradDistributionWiener_v_5188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5189> AgradDistributionWiener_v_5189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5190> AgradDistributionWiener_v_5190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5191> AgradDistributionWiener_v_5191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5192> AgradDistributionWiener_v_5192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5193> AgradDistributionWiener_v_5193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5194> AgradDistributionWiener_v_5194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5195> AgradDistributionWiener_v_5195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5196> AgradDistributionWiener_v_5196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5197> AgradDistributionWiener_v_5197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5198> AgradDistributionWiener_v_5198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5199> AgradDistributionWiener_v_5199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5100, AgradDistributionTestFixture, AgradDistributionWiener_v_5100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5101, AgradDistributionTestFixture, AgradDistributionWiener_v_5101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5102, AgradDistributionTestFixture, AgradDistributionWiener_v_5102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5103, AgradDistributionTestFixture, AgradDistributionWiener_v_5103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5104, AgradDistributionTestFixture, AgradDistributionWiener_v_5104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5105, AgradDistributionTestFixture, AgradDistributionWiener_v_5105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5106, AgradDistributionTestFixture, AgradDistributionWiener_v_5106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5107, AgradDistributionTestFixture, AgradDistributionWiener_v_5107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5108, AgradDistributionTestFixture, AgradDistributionWiener_v_5108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5109, AgradDistributionTestFixture, AgradDistributionWiener_v_5109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5110, AgradDistributionTestFixture, AgradDistributionWiener_v_5110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5111, AgradDistributionTestFixture, AgradDistributionWiener_v_5111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5112, AgradDistributionTestFixture, AgradDistributionWiener_v_5112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5113, AgradDistributionTestFixture, AgradDistributionWiener_v_5113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5114, AgradDistributionTestFixture, AgradDistributionWiener_v_5114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5115, AgradDistributionTestFixture, AgradDistributionWiener_v_5115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5116, AgradDistributionTestFixture, AgradDistributionWiener_v_5116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5117, AgradDistributionTestFixture, AgradDistributionWiener_v_5117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5118, AgradDistributionTestFixture, AgradDistributionWiener_v_5118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5119, AgradDistributionTestFixture, AgradDistributionWiener_v_5119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5120, AgradDistributionTestFixture, AgradDistributionWiener_v_5120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5121, AgradDistributionTestFixture, AgradDistributionWiener_v_5121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5122, AgradDistributionTestFixture, AgradDistributionWiener_v_5122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5123, AgradDistributionTestFixture, AgradDistributionWiener_v_5123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5124, AgradDistributionTestFixture, AgradDistributionWiener_v_5124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5125, AgradDistributionTestFixture, AgradDistributionWiener_v_5125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5126, AgradDistributionTestFixture, AgradDistributionWiener_v_5126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5127, AgradDistributionTestFixture, AgradDistributionWiener_v_5127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5128, AgradDistributionTestFixture, AgradDistributionWiener_v_5128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5129, AgradDistributionTestFixture, AgradDistributionWiener_v_5129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5130, AgradDistributionTestFixture, AgradDistributionWiener_v_5130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5131, AgradDistributionTestFixture, AgradDistributionWiener_v_5131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5132, AgradDistributionTestFixture, AgradDistributionWiener_v_5132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5133, AgradDistributionTestFixture, AgradDistributionWiener_v_5133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5134, AgradDistributionTestFixture, AgradDistributionWiener_v_5134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5135, AgradDistributionTestFixture, AgradDistributionWiener_v_5135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5136, AgradDistributionTestFixture, AgradDistributionWiener_v_5136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5137, AgradDistributionTestFixture, AgradDistributionWiener_v_5137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5138, AgradDistributionTestFixture, AgradDistributionWiener_v_5138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5139, AgradDistributionTestFixture, AgradDistributionWiener_v_5139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5140, AgradDistributionTestFixture, AgradDistributionWiener_v_5140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5141, AgradDistributionTestFixture, AgradDistributionWiener_v_5141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5142, AgradDistributionTestFixture, AgradDistributionWiener_v_5142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5143, AgradDistributionTestFixture, AgradDistributionWiener_v_5143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5144, AgradDistributionTestFixture, AgradDistributionWiener_v_5144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5145, AgradDistributionTestFixture, AgradDistributionWiener_v_5145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5146, AgradDistributionTestFixture, AgradDistributionWiener_v_5146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5147, AgradDistributionTestFixture, AgradDistributionWiener_v_5147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5148, AgradDistributionTestFixture, AgradDistributionWiener_v_5148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5149, AgradDistributionTestFixture, AgradDistributionWiener_v_5149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5150, AgradDistributionTestFixture, AgradDistributionWiener_v_5150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5151, AgradDistributionTestFixture, AgradDistributionWiener_v_5151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5152, AgradDistributionTestFixture, AgradDistributionWiener_v_5152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5153, AgradDistributionTestFixture, AgradDistributionWiener_v_5153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5154, AgradDistributionTestFixture, AgradDistributionWiener_v_5154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5155, AgradDistributionTestFixture, AgradDistributionWiener_v_5155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5156, AgradDistributionTestFixture, AgradDistributionWiener_v_5156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5157, AgradDistributionTestFixture, AgradDistributionWiener_v_5157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5158, AgradDistributionTestFixture, AgradDistributionWiener_v_5158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5159, AgradDistributionTestFixture, AgradDistributionWiener_v_5159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5160, AgradDistributionTestFixture, AgradDistributionWiener_v_5160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5161, AgradDistributionTestFixture, AgradDistributionWiener_v_5161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5162, AgradDistributionTestFixture, AgradDistributionWiener_v_5162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5163, AgradDistributionTestFixture, AgradDistributionWiener_v_5163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5164, AgradDistributionTestFixture, AgradDistributionWiener_v_5164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5165, AgradDistributionTestFixture, AgradDistributionWiener_v_5165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5166, AgradDistributionTestFixture, AgradDistributionWiener_v_5166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5167, AgradDistributionTestFixture, AgradDistributionWiener_v_5167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5168, AgradDistributionTestFixture, AgradDistributionWiener_v_5168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5169, AgradDistributionTestFixture, AgradDistributionWiener_v_5169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5170, AgradDistributionTestFixture, AgradDistributionWiener_v_5170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5171, AgradDistributionTestFixture, AgradDistributionWiener_v_5171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5172, AgradDistributionTestFixture, AgradDistributionWiener_v_5172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5173, AgradDistributionTestFixture, AgradDistributionWiener_v_5173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5174, AgradDistributionTestFixture, AgradDistributionWiener_v_5174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5175, AgradDistributionTestFixture, AgradDistributionWiener_v_5175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5176, AgradDistributionTestFixture, AgradDistributionWiener_v_5176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5177, AgradDistributionTestFixture, AgradDistributionWiener_v_5177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5178, AgradDistributionTestFixture, AgradDistributionWiener_v_5178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5179, AgradDistributionTestFixture, AgradDistributionWiener_v_5179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5180, AgradDistributionTestFixture, AgradDistributionWiener_v_5180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5181, AgradDistributionTestFixture, AgradDistributionWiener_v_5181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5182, AgradDistributionTestFixture, AgradDistributionWiener_v_5182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5183, AgradDistributionTestFixture, AgradDistributionWiener_v_5183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5184, AgradDistributionTestFixture, AgradDistributionWiener_v_5184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5185, AgradDistributionTestFixture, AgradDistributionWiener_v_5185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5186, AgradDistributionTestFixture, AgradDistributionWiener_v_5186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5187, AgradDistributionTestFixture, AgradDistributionWiener_v_5187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5188, AgradDistributionTestFixture, AgradDistributionWiener_v_5188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5189, AgradDistributionTestFixture, AgradDistributionWiener_v_5189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5190, AgradDistributionTestFixture, AgradDistributionWiener_v_5190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5191, AgradDistributionTestFixture, AgradDistributionWiener_v_5191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5192, AgradDistributionTestFixture, AgradDistributionWiener_v_5192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5193, AgradDistributionTestFixture, AgradDistributionWiener_v_5193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5194, AgradDistributionTestFixture, AgradDistributionWiener_v_5194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5195, AgradDistributionTestFixture, AgradDistributionWiener_v_5195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5196, AgradDistributionTestFixture, AgradDistributionWiener_v_5196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5197, AgradDistributionTestFixture, AgradDistributionWiener_v_5197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5198, AgradDistributionTestFixture, AgradDistributionWiener_v_5198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5199, AgradDistributionTestFixture, AgradDistributionWiener_v_5199);
+
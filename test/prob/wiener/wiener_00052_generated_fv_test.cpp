@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_5200;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5201;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_5202;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5203;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5204;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5205;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5206;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5207;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5208;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5209;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5210;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, double, empty> type_fv_5211;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_5212;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5213;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_5214;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5215;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5216;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_5217;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5218;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5219;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5220;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5221;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5222;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5223;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5224;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5225;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5226;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5227;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5228;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_5229;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_5230;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5231;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_5232;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_5233;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5234;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_5235;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_5236;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5237;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_5238;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5239;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5240;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5241;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5242;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5243;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5244;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5245;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5246;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_5247;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_5248;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5249;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_5250;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5251;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5252;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_5253;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5254;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5255;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5256;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5257;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5258;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5259;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5260;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5261;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5262;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5263;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5264;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, double, empty> type_fv_5265;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, std::vector<double>, empty> type_fv_5266;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5267;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, fvar<var>, empty> type_fv_5268;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_5269;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5270;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, double, empty> type_fv_5271;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_5272;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5273;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_5274;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5275;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5276;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5277;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5278;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5279;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5280;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5281;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5282;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, double, empty> type_fv_5283;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_5284;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5285;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_5286;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5287;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5288;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_5289;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5290;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5291;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5292;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5293;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5294;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5295;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5296;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5297;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5298;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5200> AgradDistributionWiener_fv_5200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5201> AgradDistributionWiener_fv_5201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5202> AgradDistributionWiener_fv_5202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5203> AgradDistributionWiener_fv_5203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5204> AgradDistributionWiener_fv_5204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5205> AgradDistributionWiener_fv_5205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5206> AgradDistributionWiener_fv_5206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5207> AgradDistributionWiener_fv_5207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5208> AgradDistributionWiener_fv_5208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5209> AgradDistributionWiener_fv_5209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5210> AgradDistributionWiener_fv_5210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5211> AgradDistributionWiener_fv_5211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5212> AgradDistributionWiener_fv_5212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5213> AgradDistributionWiener_fv_5213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5214> AgradDistributionWiener_fv_5214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5215> AgradDistributionWiener_fv_5215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5216> AgradDistributionWiener_fv_5216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5217> AgradDistributionWiener_fv_5217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5218> AgradDistributionWiener_fv_5218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5219> AgradDistributionWiener_fv_5219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5220> AgradDistributionWiener_fv_5220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5221> AgradDistributionWiener_fv_5221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5222> AgradDistributionWiener_fv_5222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5223> AgradDistributionWiener_fv_5223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5224> AgradDistributionWiener_fv_5224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5225> AgradDistributionWiener_fv_5225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5226> AgradDistributionWiener_fv_5226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5227> AgradDistributionWiener_fv_5227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5228> AgradDistributionWiener_fv_5228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5229> AgradDistributionWiener_fv_5229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5230> AgradDistributionWiener_fv_5230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5231> AgradDistributionWiener_fv_5231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5232> AgradDistributionWiener_fv_5232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5233> AgradDistributionWiener_fv_5233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5234> AgradDistributionWiener_fv_5234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5235> AgradDistributionWiener_fv_5235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5236> AgradDistributionWiener_fv_5236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5237> AgradDistributionWiener_fv_5237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5238> AgradDistributionWiener_fv_5238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5239> AgradDistributionWiener_fv_5239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5240> AgradDistributionWiener_fv_5240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5241> AgradDistributionWiener_fv_5241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5242> AgradDistributionWiener_fv_5242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5243> AgradDistributionWiener_fv_5243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5244> AgradDistributionWiener_fv_5244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5245> AgradDistributionWiener_fv_5245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5246> AgradDistributionWiener_fv_5246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5247> AgradDistributionWiener_fv_5247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5248> AgradDistributionWiener_fv_5248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5249> AgradDistributionWiener_fv_5249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5250> AgradDistributionWiener_fv_5250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5251> AgradDistributionWiener_fv_5251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5252> AgradDistributionWiener_fv_5252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5253> AgradDistributionWiener_fv_5253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5254> AgradDistributionWiener_fv_5254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5255> AgradDistributionWiener_fv_5255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5256> AgradDistributionWiener_fv_5256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5257> AgradDistributionWiener_fv_5257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5258> AgradDistributionWiener_fv_5258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5259> AgradDistributionWiener_fv_5259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5260> AgradDistributionWiener_fv_5260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5261> AgradDistributionWiener_fv_5261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5262> AgradDistributionWiener_fv_5262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5263> AgradDistributionWiener_fv_5263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5264> AgradDistributionWiener_fv_5264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5265> AgradDistributionWiener_fv_5265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5266> AgradDistributionWiener_fv_5266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5267> AgradDistributionWiener_fv_5267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5268> AgradDistributionWiener_fv_5268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5269> AgradDistributionWiener_fv_5269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5270> AgradDistributionWiener_fv_5270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5271> AgradDistributionWiener_fv_5271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5272> AgradDistributionWiener_fv_5272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5273> AgradDistributionWiener_fv_5273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5274> AgradDistributionWiener_fv_5274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5275> AgradDistributionWiener_fv_5275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5276> AgradDistributionWiener_fv_5276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5277> AgradDistributionWiener_fv_5277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5278> AgradDistributionWiener_fv_5278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5279> AgradDistributionWiener_fv_5279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5280> AgradDistributionWiener_fv_5280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5281> AgradDistributionWiener_fv_5281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5282> AgradDistributionWiener_fv_5282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5283> AgradDistributionWiener_fv_5283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5284> AgradDistributionWiener_fv_5284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5285> AgradDistributionWiener_fv_5285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5286> AgradDistributionWiener_fv_5286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5287> AgradDistributionWiener_fv_5287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5288> AgradDistributionWiener_fv_5288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5289> AgradDistributionWiener_fv_5289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5290> AgradDistributionWiener_fv_5290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5291> AgradDistributionWiener_fv_5291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5292> AgradDistributionWiener_fv_5292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5293> AgradDistributionWiener_fv_5293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5294> AgradDistributionWiener_fv_5294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5295> AgradDistributionWiener_fv_5295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5296> AgradDistributionWiener_fv_5296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5297> AgradDistributionWiener_fv_5297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5298> AgradDistributionWiener_fv_5298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5299> AgradDistributionWiener_fv_5299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5200, AgradDistributionTestFixture, AgradDistributionWiener_fv_5200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5201, AgradDistributionTestFixture, AgradDistributionWiener_fv_5201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5202, AgradDistributionTestFixture, AgradDistributionWiener_fv_5202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5203, AgradDistributionTestFixture, AgradDistributionWiener_fv_5203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5204, AgradDistributionTestFixture, AgradDistributionWiener_fv_5204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5205, AgradDistributionTestFixture, AgradDistributionWiener_fv_5205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5206, AgradDistributionTestFixture, AgradDistributionWiener_fv_5206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5207, AgradDistributionTestFixture, AgradDistributionWiener_fv_5207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5208, AgradDistributionTestFixture, AgradDistributionWiener_fv_5208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5209, AgradDistributionTestFixture, AgradDistributionWiener_fv_5209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5210, AgradDistributionTestFixture, AgradDistributionWiener_fv_5210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5211, AgradDistributionTestFixture, AgradDistributionWiener_fv_5211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5212, AgradDistributionTestFixture, AgradDistributionWiener_fv_5212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5213, AgradDistributionTestFixture, AgradDistributionWiener_fv_5213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5214, AgradDistributionTestFixture, AgradDistributionWiener_fv_5214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5215, AgradDistributionTestFixture, AgradDistributionWiener_fv_5215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5216, AgradDistributionTestFixture, AgradDistributionWiener_fv_5216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5217, AgradDistributionTestFixture, AgradDistributionWiener_fv_5217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5218, AgradDistributionTestFixture, AgradDistributionWiener_fv_5218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5219, AgradDistributionTestFixture, AgradDistributionWiener_fv_5219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5220, AgradDistributionTestFixture, AgradDistributionWiener_fv_5220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5221, AgradDistributionTestFixture, AgradDistributionWiener_fv_5221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5222, AgradDistributionTestFixture, AgradDistributionWiener_fv_5222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5223, AgradDistributionTestFixture, AgradDistributionWiener_fv_5223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5224, AgradDistributionTestFixture, AgradDistributionWiener_fv_5224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5225, AgradDistributionTestFixture, AgradDistributionWiener_fv_5225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5226, AgradDistributionTestFixture, AgradDistributionWiener_fv_5226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5227, AgradDistributionTestFixture, AgradDistributionWiener_fv_5227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5228, AgradDistributionTestFixture, AgradDistributionWiener_fv_5228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5229, AgradDistributionTestFixture, AgradDistributionWiener_fv_5229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5230, AgradDistributionTestFixture, AgradDistributionWiener_fv_5230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5231, AgradDistributionTestFixture, AgradDistributionWiener_fv_5231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5232, AgradDistributionTestFixture, AgradDistributionWiener_fv_5232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5233, AgradDistributionTestFixture, AgradDistributionWiener_fv_5233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5234, AgradDistributionTestFixture, AgradDistributionWiener_fv_5234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5235, AgradDistributionTestFixture, AgradDistributionWiener_fv_5235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5236, AgradDistributionTestFixture, AgradDistributionWiener_fv_5236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5237, AgradDistributionTestFixture, AgradDistributionWiener_fv_5237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5238, AgradDistributionTestFixture, AgradDistributionWiener_fv_5238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5239, AgradDistributionTestFixture, AgradDistributionWiener_fv_5239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5240, AgradDistributionTestFixture, AgradDistributionWiener_fv_5240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5241, AgradDistributionTestFixture, AgradDistributionWiener_fv_5241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5242, AgradDistributionTestFixture, AgradDistributionWiener_fv_5242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5243, AgradDistributionTestFixture, AgradDistributionWiener_fv_5243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5244, AgradDistributionTestFixture, AgradDistributionWiener_fv_5244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5245, AgradDistributionTestFixture, AgradDistributionWiener_fv_5245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5246, AgradDistributionTestFixture, AgradDistributionWiener_fv_5246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5247, AgradDistributionTestFixture, AgradDistributionWiener_fv_5247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5248, AgradDistributionTestFixture, AgradDistributionWiener_fv_5248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5249, AgradDistributionTestFixture, AgradDistributionWiener_fv_5249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5250, AgradDistributionTestFixture, AgradDistributionWiener_fv_5250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5251, AgradDistributionTestFixture, AgradDistributionWiener_fv_5251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5252, AgradDistributionTestFixture, AgradDistributionWiener_fv_5252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5253, AgradDistributionTestFixture, AgradDistributionWiener_fv_5253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5254, AgradDistributionTestFixture, AgradDistributionWiener_fv_5254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5255, AgradDistributionTestFixture, AgradDistributionWiener_fv_5255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5256, AgradDistributionTestFixture, AgradDistributionWiener_fv_5256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5257, AgradDistributionTestFixture, AgradDistributionWiener_fv_5257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5258, AgradDistributionTestFixture, AgradDistributionWiener_fv_5258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5259, AgradDistributionTestFixture, AgradDistributionWiener_fv_5259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5260, AgradDistributionTestFixture, AgradDistributionWiener_fv_5260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5261, AgradDistributionTestFixture, AgradDistributionWiener_fv_5261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5262, AgradDistributionTestFixture, AgradDistributionWiener_fv_5262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5263, AgradDistributionTestFixture, AgradDistributionWiener_fv_5263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5264, AgradDistributionTestFixture, AgradDistributionWiener_fv_5264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5265, AgradDistributionTestFixture, AgradDistributionWiener_fv_5265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5266, AgradDistributionTestFixture, AgradDistributionWiener_fv_5266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5267, AgradDistributionTestFixture, AgradDistributionWiener_fv_5267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5268, AgradDistributionTestFixture, AgradDistributionWiener_fv_5268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5269, AgradDistributionTestFixture, AgradDistributionWiener_fv_5269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5270, AgradDistributionTestFixture, AgradDistributionWiener_fv_5270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5271, AgradDistributionTestFixture, AgradDistributionWiener_fv_5271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5272, AgradDistributionTestFixture, AgradDistributionWiener_fv_5272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5273, AgradDistributionTestFixture, AgradDistributionWiener_fv_5273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5274, AgradDistributionTestFixture, AgradDistributionWiener_fv_5274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5275, AgradDistributionTestFixture, AgradDistributionWiener_fv_5275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5276, AgradDistributionTestFixture, AgradDistributionWiener_fv_5276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5277, AgradDistributionTestFixture, AgradDistributionWiener_fv_5277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5278, AgradDistributionTestFixture, AgradDistributionWiener_fv_5278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5279, AgradDistributionTestFixture, AgradDistributionWiener_fv_5279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5280, AgradDistributionTestFixture, AgradDistributionWiener_fv_5280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5281, AgradDistributionTestFixture, AgradDistributionWiener_fv_5281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5282, AgradDistributionTestFixture, AgradDistributionWiener_fv_5282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5283, AgradDistributionTestFixture, AgradDistributionWiener_fv_5283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5284, AgradDistributionTestFixture, AgradDistributionWiener_fv_5284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5285, AgradDistributionTestFixture, AgradDistributionWiener_fv_5285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5286, AgradDistributionTestFixture, AgradDistributionWiener_fv_5286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5287, AgradDistributionTestFixture, AgradDistributionWiener_fv_5287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5288, AgradDistributionTestFixture, AgradDistributionWiener_fv_5288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5289, AgradDistributionTestFixture, AgradDistributionWiener_fv_5289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5290, AgradDistributionTestFixture, AgradDistributionWiener_fv_5290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5291, AgradDistributionTestFixture, AgradDistributionWiener_fv_5291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5292, AgradDistributionTestFixture, AgradDistributionWiener_fv_5292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5293, AgradDistributionTestFixture, AgradDistributionWiener_fv_5293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5294, AgradDistributionTestFixture, AgradDistributionWiener_fv_5294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5295, AgradDistributionTestFixture, AgradDistributionWiener_fv_5295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5296, AgradDistributionTestFixture, AgradDistributionWiener_fv_5296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5297, AgradDistributionTestFixture, AgradDistributionWiener_fv_5297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5298, AgradDistributionTestFixture, AgradDistributionWiener_fv_5298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5299, AgradDistributionTestFixture, AgradDistributionWiener_fv_5299);
+
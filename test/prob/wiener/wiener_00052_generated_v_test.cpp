@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5200;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5201;
+typedef boost::mpl::vector<std::vector<var>, double, double, var, double, empty> type_v_5202;
+typedef boost::mpl::vector<std::vector<var>, double, double, var, std::vector<double>, empty> type_v_5203;
+typedef boost::mpl::vector<std::vector<var>, double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5204;
+typedef boost::mpl::vector<std::vector<var>, double, double, var, var, empty> type_v_5205;
+typedef boost::mpl::vector<std::vector<var>, double, double, var, std::vector<var>, empty> type_v_5206;
+typedef boost::mpl::vector<std::vector<var>, double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5207;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<var>, double, empty> type_v_5208;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<var>, std::vector<double>, empty> type_v_5209;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5210;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<var>, var, empty> type_v_5211;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<var>, std::vector<var>, empty> type_v_5212;
+typedef boost::mpl::vector<std::vector<var>, double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5213;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5214;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5215;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5216;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5217;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5218;
+typedef boost::mpl::vector<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5219;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, double, double, empty> type_v_5220;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, double, std::vector<double>, empty> type_v_5221;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5222;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, double, var, empty> type_v_5223;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, double, std::vector<var>, empty> type_v_5224;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5225;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<double>, double, empty> type_v_5226;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_5227;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5228;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<double>, var, empty> type_v_5229;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_5230;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5231;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5232;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5233;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5234;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5235;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5236;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5237;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, var, double, empty> type_v_5238;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, var, std::vector<double>, empty> type_v_5239;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5240;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, var, var, empty> type_v_5241;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, var, std::vector<var>, empty> type_v_5242;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5243;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<var>, double, empty> type_v_5244;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_5245;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5246;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<var>, var, empty> type_v_5247;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_5248;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5249;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5250;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5251;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5252;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5253;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5254;
+typedef boost::mpl::vector<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5255;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_5256;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_5257;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5258;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_5259;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_5260;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5261;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_5262;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_5263;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5264;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_5265;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_5266;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5267;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5268;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5269;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5270;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5271;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5272;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5273;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_5274;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_5275;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5276;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_5277;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_5278;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5279;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_5280;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_5281;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5282;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_5283;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_5284;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5285;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5286;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5287;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5288;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5289;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5290;
+typedef boost::mpl::vector<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5291;
+typedef boost::mpl::vector<std::vector<var>, double, var, double, double, empty> type_v_5292;
+typedef boost::mpl::vector<std::vector<var>, double, var, double, std::vector<double>, empty> type_v_5293;
+typedef boost::mpl::vector<std::vector<var>, double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5294;
+typedef boost::mpl::vector<std::vector<var>, double, var, double, var, empty> type_v_5295;
+typedef boost::mpl::vector<std::vector<var>, double, var, double, std::vector<var>, empty> type_v_5296;
+typedef boost::mpl::vector<std::vector<var>, double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5297;
+typedef boost::mpl::vector<std::vector<var>, double, var, std::vector<double>, double, empty> type_v_5298;
+typedef boost::mpl::vector<std::vector<var>, double, var, std::vector<double>, std::vector<double>, empty> type_v_5299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5200> AgradDistributionWiener_v_5200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5201> AgradDistributionWiener_v_5201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5202> AgradDistributionWiener_v_5202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5203> AgradDistributionWiener_v_5203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5204> AgradDistributionWiener_v_5204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5205> AgradDistributionWiener_v_5205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5206> AgradDistributionWiener_v_5206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5207> AgradDistributionWiener_v_5207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5208> AgradDistributionWiener_v_5208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5209> AgradDistributionWiener_v_5209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5210> AgradDistributionWiener_v_5210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5211> AgradDistributionWiener_v_5211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5212> AgradDistributionWiener_v_5212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5213> AgradDistributionWiener_v_5213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5214> AgradDistributionWiener_v_5214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5215> AgradDistributionWiener_v_5215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5216> AgradDistributionWiener_v_5216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5217> AgradDistributionWiener_v_5217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5218> AgradDistributionWiener_v_5218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5219> AgradDistributionWiener_v_5219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5220> AgradDistributionWiener_v_5220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5221> AgradDistributionWiener_v_5221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5222> AgradDistributionWiener_v_5222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5223> AgradDistributionWiener_v_5223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5224> AgradDistributionWiener_v_5224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5225> AgradDistributionWiener_v_5225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5226> AgradDistributionWiener_v_5226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5227> AgradDistributionWiener_v_5227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5228> AgradDistributionWiener_v_5228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5229> AgradDistributionWiener_v_5229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5230> AgradDistributionWiener_v_5230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5231> AgradDistributionWiener_v_5231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5232> AgradDistributionWiener_v_5232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5233> AgradDistributionWiener_v_5233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5234> AgradDistributionWiener_v_5234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5235> AgradDistributionWiener_v_5235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5236> AgradDistributionWiener_v_5236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5237> AgradDistributionWiener_v_5237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5238> AgradDistributionWiener_v_5238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5239> AgradDistributionWiener_v_5239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5240> AgradDistributionWiener_v_5240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5241> AgradDistributionWiener_v_5241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5242> AgradDistributionWiener_v_5242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5243> AgradDistributionWiener_v_5243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5244> AgradDistributionWiener_v_5244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5245> AgradDistributionWiener_v_5245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5246> AgradDistributionWiener_v_5246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5247> AgradDistributionWiener_v_5247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5248> AgradDistributionWiener_v_5248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5249> AgradDistributionWiener_v_5249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5250> AgradDistributionWiener_v_5250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5251> AgradDistributionWiener_v_5251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5252> AgradDistributionWiener_v_5252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5253> AgradDistributionWiener_v_5253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5254> AgradDistributionWiener_v_5254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5255> AgradDistributionWiener_v_5255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5256> AgradDistributionWiener_v_5256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5257> AgradDistributionWiener_v_5257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5258> AgradDistributionWiener_v_5258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5259> AgradDistributionWiener_v_5259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5260> AgradDistributionWiener_v_5260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5261> AgradDistributionWiener_v_5261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5262> AgradDistributionWiener_v_5262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5263> AgradDistributionWiener_v_5263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5264> AgradDistributionWiener_v_5264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5265> AgradDistributionWiener_v_5265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5266> AgradDistributionWiener_v_5266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5267> AgradDistributionWiener_v_5267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5268> AgradDistributionWiener_v_5268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5269> AgradDistributionWiener_v_5269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5270> AgradDistributionWiener_v_5270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5271> AgradDistributionWiener_v_5271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5272> AgradDistributionWiener_v_5272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5273> AgradDistributionWiener_v_5273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5274> AgradDistributionWiener_v_5274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5275> AgradDistributionWiener_v_5275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5276> AgradDistributionWiener_v_5276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5277> AgradDistributionWiener_v_5277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5278> AgradDistributionWiener_v_5278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5279> AgradDistributionWiener_v_5279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5280> AgradDistributionWiener_v_5280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5281> AgradDistributionWiener_v_5281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5282> AgradDistributionWiener_v_5282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5283> AgradDistributionWiener_v_5283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5284> AgradDistributionWiener_v_5284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5285> AgradDistributionWiener_v_5285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5286> AgradDistributionWiener_v_5286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5287> AgradDistributionWiener_v_5287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5288> AgradDistributionWiener_v_5288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5289> AgradDistributionWiener_v_5289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5290> AgradDistributionWiener_v_5290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5291> AgradDistributionWiener_v_5291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5292> AgradDistributionWiener_v_5292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5293> AgradDistributionWiener_v_5293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5294> AgradDistributionWiener_v_5294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5295> AgradDistributionWiener_v_5295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5296> AgradDistributionWiener_v_5296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5297> AgradDistributionWiener_v_5297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5298> AgradDistributionWiener_v_5298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5299> AgradDistributionWiener_v_5299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5200, AgradDistributionTestFixture, AgradDistributionWiener_v_5200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5201, AgradDistributionTestFixture, AgradDistributionWiener_v_5201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5202, AgradDistributionTestFixture, AgradDistributionWiener_v_5202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5203, AgradDistributionTestFixture, AgradDistributionWiener_v_5203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5204, AgradDistributionTestFixture, AgradDistributionWiener_v_5204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5205, AgradDistributionTestFixture, AgradDistributionWiener_v_5205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5206, AgradDistributionTestFixture, AgradDistributionWiener_v_5206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5207, AgradDistributionTestFixture, AgradDistributionWiener_v_5207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5208, AgradDistributionTestFixture, AgradDistributionWiener_v_5208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5209, AgradDistributionTestFixture, AgradDistributionWiener_v_5209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5210, AgradDistributionTestFixture, AgradDistributionWiener_v_5210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5211, AgradDistributionTestFixture, AgradDistributionWiener_v_5211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5212, AgradDistributionTestFixture, AgradDistributionWiener_v_5212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5213, AgradDistributionTestFixture, AgradDistributionWiener_v_5213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5214, AgradDistributionTestFixture, AgradDistributionWiener_v_5214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5215, AgradDistributionTestFixture, AgradDistributionWiener_v_5215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5216, AgradDistributionTestFixture, AgradDistributionWiener_v_5216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5217, AgradDistributionTestFixture, AgradDistributionWiener_v_5217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5218, AgradDistributionTestFixture, AgradDistributionWiener_v_5218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5219, AgradDistributionTestFixture, AgradDistributionWiener_v_5219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5220, AgradDistributionTestFixture, AgradDistributionWiener_v_5220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5221, AgradDistributionTestFixture, AgradDistributionWiener_v_5221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5222, AgradDistributionTestFixture, AgradDistributionWiener_v_5222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5223, AgradDistributionTestFixture, AgradDistributionWiener_v_5223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5224, AgradDistributionTestFixture, AgradDistributionWiener_v_5224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5225, AgradDistributionTestFixture, AgradDistributionWiener_v_5225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5226, AgradDistributionTestFixture, AgradDistributionWiener_v_5226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5227, AgradDistributionTestFixture, AgradDistributionWiener_v_5227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5228, AgradDistributionTestFixture, AgradDistributionWiener_v_5228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5229, AgradDistributionTestFixture, AgradDistributionWiener_v_5229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5230, AgradDistributionTestFixture, AgradDistributionWiener_v_5230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5231, AgradDistributionTestFixture, AgradDistributionWiener_v_5231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5232, AgradDistributionTestFixture, AgradDistributionWiener_v_5232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5233, AgradDistributionTestFixture, AgradDistributionWiener_v_5233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5234, AgradDistributionTestFixture, AgradDistributionWiener_v_5234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5235, AgradDistributionTestFixture, AgradDistributionWiener_v_5235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5236, AgradDistributionTestFixture, AgradDistributionWiener_v_5236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5237, AgradDistributionTestFixture, AgradDistributionWiener_v_5237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5238, AgradDistributionTestFixture, AgradDistributionWiener_v_5238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5239, AgradDistributionTestFixture, AgradDistributionWiener_v_5239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5240, AgradDistributionTestFixture, AgradDistributionWiener_v_5240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5241, AgradDistributionTestFixture, AgradDistributionWiener_v_5241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5242, AgradDistributionTestFixture, AgradDistributionWiener_v_5242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5243, AgradDistributionTestFixture, AgradDistributionWiener_v_5243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5244, AgradDistributionTestFixture, AgradDistributionWiener_v_5244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5245, AgradDistributionTestFixture, AgradDistributionWiener_v_5245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5246, AgradDistributionTestFixture, AgradDistributionWiener_v_5246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5247, AgradDistributionTestFixture, AgradDistributionWiener_v_5247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5248, AgradDistributionTestFixture, AgradDistributionWiener_v_5248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5249, AgradDistributionTestFixture, AgradDistributionWiener_v_5249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5250, AgradDistributionTestFixture, AgradDistributionWiener_v_5250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5251, AgradDistributionTestFixture, AgradDistributionWiener_v_5251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5252, AgradDistributionTestFixture, AgradDistributionWiener_v_5252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5253, AgradDistributionTestFixture, AgradDistributionWiener_v_5253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5254, AgradDistributionTestFixture, AgradDistributionWiener_v_5254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5255, AgradDistributionTestFixture, AgradDistributionWiener_v_5255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5256, AgradDistributionTestFixture, AgradDistributionWiener_v_5256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5257, AgradDistributionTestFixture, AgradDistributionWiener_v_5257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5258, AgradDistributionTestFixture, AgradDistributionWiener_v_5258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5259, AgradDistributionTestFixture, AgradDistributionWiener_v_5259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5260, AgradDistributionTestFixture, AgradDistributionWiener_v_5260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5261, AgradDistributionTestFixture, AgradDistributionWiener_v_5261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5262, AgradDistributionTestFixture, AgradDistributionWiener_v_5262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5263, AgradDistributionTestFixture, AgradDistributionWiener_v_5263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5264, AgradDistributionTestFixture, AgradDistributionWiener_v_5264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5265, AgradDistributionTestFixture, AgradDistributionWiener_v_5265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5266, AgradDistributionTestFixture, AgradDistributionWiener_v_5266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5267, AgradDistributionTestFixture, AgradDistributionWiener_v_5267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5268, AgradDistributionTestFixture, AgradDistributionWiener_v_5268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5269, AgradDistributionTestFixture, AgradDistributionWiener_v_5269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5270, AgradDistributionTestFixture, AgradDistributionWiener_v_5270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5271, AgradDistributionTestFixture, AgradDistributionWiener_v_5271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5272, AgradDistributionTestFixture, AgradDistributionWiener_v_5272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5273, AgradDistributionTestFixture, AgradDistributionWiener_v_5273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5274, AgradDistributionTestFixture, AgradDistributionWiener_v_5274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5275, AgradDistributionTestFixture, AgradDistributionWiener_v_5275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5276, AgradDistributionTestFixture, AgradDistributionWiener_v_5276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5277, AgradDistributionTestFixture, AgradDistributionWiener_v_5277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5278, AgradDistributionTestFixture, AgradDistributionWiener_v_5278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5279, AgradDistributionTestFixture, AgradDistributionWiener_v_5279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5280, AgradDistributionTestFixture, AgradDistributionWiener_v_5280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5281, AgradDistributionTestFixture, AgradDistributionWiener_v_5281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5282, AgradDistributionTestFixture, AgradDistributionWiener_v_5282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5283, AgradDistributionTestFixture, AgradDistributionWiener_v_5283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5284, AgradDistributionTestFixture, AgradDistributionWiener_v_5284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5285, AgradDistributionTestFixture, AgradDistributionWiener_v_5285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5286, AgradDistributionTestFixture, AgradDistributionWiener_v_5286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5287, AgradDistributionTestFixture, AgradDistributionWiener_v_5287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5288, AgradDistributionTestFixture, AgradDistributionWiener_v_5288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5289, AgradDistributionTestFixture, AgradDistributionWiener_v_5289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5290, AgradDistributionTestFixture, AgradDistributionWiener_v_5290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5291, AgradDistributionTestFixture, AgradDistributionWiener_v_5291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5292, AgradDistributionTestFixture, AgradDistributionWiener_v_5292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5293, AgradDistributionTestFixture, AgradDistributionWiener_v_5293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5294, AgradDistributionTestFixture, AgradDistributionWiener_v_5294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5295, AgradDistributionTestFixture, AgradDistributionWiener_v_5295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5296, AgradDistributionTestFixture, AgradDistributionWiener_v_5296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5297, AgradDistributionTestFixture, AgradDistributionWiener_v_5297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5298, AgradDistributionTestFixture, AgradDistributionWiener_v_5298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5299, AgradDistributionTestFixture, AgradDistributionWiener_v_5299);
+
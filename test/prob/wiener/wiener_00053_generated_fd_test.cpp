@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5300;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, double, empty> type_fd_5301;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_5302;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5303;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_5304;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_5305;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5306;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_5307;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_5308;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5309;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_5310;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5311;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5312;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5313;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5314;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5315;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5316;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5317;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5318;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_5319;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_5320;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5321;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_5322;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5323;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5324;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_5325;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5326;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5327;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5328;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5329;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5330;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5331;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5332;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5333;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5334;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5335;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5336;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_5337;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_5338;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5339;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_5340;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_5341;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5342;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_5343;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_5344;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5345;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_5346;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5347;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5348;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5349;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5350;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5351;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5352;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5353;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5354;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_5355;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_5356;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5357;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_5358;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5359;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5360;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_5361;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5362;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5363;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5364;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5365;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5366;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5367;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5368;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5369;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5370;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5371;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5372;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty> type_fd_5373;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_fd_5374;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5375;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<double>, empty> type_fd_5376;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<double>>, empty> type_fd_5377;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5378;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_fd_5379;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_fd_5380;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5381;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<double>, empty> type_fd_5382;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5383;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5384;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5385;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5386;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5387;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5388;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5389;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5390;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, double, empty> type_fd_5391;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<double>, empty> type_fd_5392;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5393;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, fvar<double>, empty> type_fd_5394;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5395;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5396;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, double, empty> type_fd_5397;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5398;
+typedef boost::mpl::vector<std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5300> AgradDistributionWiener_fd_5300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5301> AgradDistributionWiener_fd_5301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5302> AgradDistributionWiener_fd_5302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5303> AgradDistributionWiener_fd_5303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5304> AgradDistributionWiener_fd_5304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5305> AgradDistributionWiener_fd_5305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5306> AgradDistributionWiener_fd_5306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5307> AgradDistributionWiener_fd_5307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5308> AgradDistributionWiener_fd_5308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5309> AgradDistributionWiener_fd_5309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5310> AgradDistributionWiener_fd_5310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5311> AgradDistributionWiener_fd_5311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5312> AgradDistributionWiener_fd_5312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5313> AgradDistributionWiener_fd_5313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5314> AgradDistributionWiener_fd_5314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5315> AgradDistributionWiener_fd_5315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5316> AgradDistributionWiener_fd_5316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5317> AgradDistributionWiener_fd_5317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5318> AgradDistributionWiener_fd_5318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5319> AgradDistributionWiener_fd_5319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5320> AgradDistributionWiener_fd_5320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5321> AgradDistributionWiener_fd_5321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5322> AgradDistributionWiener_fd_5322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5323> AgradDistributionWiener_fd_5323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5324> AgradDistributionWiener_fd_5324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5325> AgradDistributionWiener_fd_5325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5326> AgradDistributionWiener_fd_5326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5327> AgradDistributionWiener_fd_5327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5328> AgradDistributionWiener_fd_5328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5329> AgradDistributionWiener_fd_5329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5330> AgradDistributionWiener_fd_5330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5331> AgradDistributionWiener_fd_5331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5332> AgradDistributionWiener_fd_5332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5333> AgradDistributionWiener_fd_5333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5334> AgradDistributionWiener_fd_5334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5335> AgradDistributionWiener_fd_5335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5336> AgradDistributionWiener_fd_5336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5337> AgradDistributionWiener_fd_5337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5338> AgradDistributionWiener_fd_5338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5339> AgradDistributionWiener_fd_5339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5340> AgradDistributionWiener_fd_5340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5341> AgradDistributionWiener_fd_5341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5342> AgradDistributionWiener_fd_5342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5343> AgradDistributionWiener_fd_5343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5344> AgradDistributionWiener_fd_5344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5345> AgradDistributionWiener_fd_5345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5346> AgradDistributionWiener_fd_5346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5347> AgradDistributionWiener_fd_5347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5348> AgradDistributionWiener_fd_5348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5349> AgradDistributionWiener_fd_5349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5350> AgradDistributionWiener_fd_5350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5351> AgradDistributionWiener_fd_5351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5352> AgradDistributionWiener_fd_5352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5353> AgradDistributionWiener_fd_5353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5354> AgradDistributionWiener_fd_5354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5355> AgradDistributionWiener_fd_5355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5356> AgradDistributionWiener_fd_5356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5357> AgradDistributionWiener_fd_5357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5358> AgradDistributionWiener_fd_5358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5359> AgradDistributionWiener_fd_5359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5360> AgradDistributionWiener_fd_5360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5361> AgradDistributionWiener_fd_5361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5362> AgradDistributionWiener_fd_5362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5363> AgradDistributionWiener_fd_5363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5364> AgradDistributionWiener_fd_5364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5365> AgradDistributionWiener_fd_5365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5366> AgradDistributionWiener_fd_5366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5367> AgradDistributionWiener_fd_5367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5368> AgradDistributionWiener_fd_5368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5369> AgradDistributionWiener_fd_5369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5370> AgradDistributionWiener_fd_5370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5371> AgradDistributionWiener_fd_5371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5372> AgradDistributionWiener_fd_5372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5373> AgradDistributionWiener_fd_5373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5374> AgradDistributionWiener_fd_5374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5375> AgradDistributionWiener_fd_5375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5376> AgradDistributionWiener_fd_5376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5377> AgradDistributionWiener_fd_5377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5378> AgradDistributionWiener_fd_5378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5379> AgradDistributionWiener_fd_5379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5380> AgradDistributionWiener_fd_5380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5381> AgradDistributionWiener_fd_5381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5382> AgradDistributionWiener_fd_5382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5383> AgradDistributionWiener_fd_5383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5384> AgradDistributionWiener_fd_5384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5385> AgradDistributionWiener_fd_5385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5386> AgradDistributionWiener_fd_5386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5387> AgradDistributionWiener_fd_5387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5388> AgradDistributionWiener_fd_5388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5389> AgradDistributionWiener_fd_5389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5390> AgradDistributionWiener_fd_5390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5391> AgradDistributionWiener_fd_5391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5392> AgradDistributionWiener_fd_5392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5393> AgradDistributionWiener_fd_5393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5394> AgradDistributionWiener_fd_5394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5395> AgradDistributionWiener_fd_5395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5396> AgradDistributionWiener_fd_5396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5397> AgradDistributionWiener_fd_5397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5398> AgradDistributionWiener_fd_5398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5399> AgradDistributionWiener_fd_5399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5300, AgradDistributionTestFixture, AgradDistributionWiener_fd_5300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5301, AgradDistributionTestFixture, AgradDistributionWiener_fd_5301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5302, AgradDistributionTestFixture, AgradDistributionWiener_fd_5302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5303, AgradDistributionTestFixture, AgradDistributionWiener_fd_5303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5304, AgradDistributionTestFixture, AgradDistributionWiener_fd_5304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5305, AgradDistributionTestFixture, AgradDistributionWiener_fd_5305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5306, AgradDistributionTestFixture, AgradDistributionWiener_fd_5306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5307, AgradDistributionTestFixture, AgradDistributionWiener_fd_5307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5308, AgradDistributionTestFixture, AgradDistributionWiener_fd_5308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5309, AgradDistributionTestFixture, AgradDistributionWiener_fd_5309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5310, AgradDistributionTestFixture, AgradDistributionWiener_fd_5310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5311, AgradDistributionTestFixture, AgradDistributionWiener_fd_5311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5312, AgradDistributionTestFixture, AgradDistributionWiener_fd_5312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5313, AgradDistributionTestFixture, AgradDistributionWiener_fd_5313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5314, AgradDistributionTestFixture, AgradDistributionWiener_fd_5314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5315, AgradDistributionTestFixture, AgradDistributionWiener_fd_5315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5316, AgradDistributionTestFixture, AgradDistributionWiener_fd_5316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5317, AgradDistributionTestFixture, AgradDistributionWiener_fd_5317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5318, AgradDistributionTestFixture, AgradDistributionWiener_fd_5318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5319, AgradDistributionTestFixture, AgradDistributionWiener_fd_5319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5320, AgradDistributionTestFixture, AgradDistributionWiener_fd_5320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5321, AgradDistributionTestFixture, AgradDistributionWiener_fd_5321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5322, AgradDistributionTestFixture, AgradDistributionWiener_fd_5322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5323, AgradDistributionTestFixture, AgradDistributionWiener_fd_5323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5324, AgradDistributionTestFixture, AgradDistributionWiener_fd_5324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5325, AgradDistributionTestFixture, AgradDistributionWiener_fd_5325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5326, AgradDistributionTestFixture, AgradDistributionWiener_fd_5326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5327, AgradDistributionTestFixture, AgradDistributionWiener_fd_5327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5328, AgradDistributionTestFixture, AgradDistributionWiener_fd_5328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5329, AgradDistributionTestFixture, AgradDistributionWiener_fd_5329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5330, AgradDistributionTestFixture, AgradDistributionWiener_fd_5330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5331, AgradDistributionTestFixture, AgradDistributionWiener_fd_5331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5332, AgradDistributionTestFixture, AgradDistributionWiener_fd_5332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5333, AgradDistributionTestFixture, AgradDistributionWiener_fd_5333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5334, AgradDistributionTestFixture, AgradDistributionWiener_fd_5334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5335, AgradDistributionTestFixture, AgradDistributionWiener_fd_5335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5336, AgradDistributionTestFixture, AgradDistributionWiener_fd_5336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5337, AgradDistributionTestFixture, AgradDistributionWiener_fd_5337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5338, AgradDistributionTestFixture, AgradDistributionWiener_fd_5338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5339, AgradDistributionTestFixture, AgradDistributionWiener_fd_5339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5340, AgradDistributionTestFixture, AgradDistributionWiener_fd_5340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5341, AgradDistributionTestFixture, AgradDistributionWiener_fd_5341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5342, AgradDistributionTestFixture, AgradDistributionWiener_fd_5342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5343, AgradDistributionTestFixture, AgradDistributionWiener_fd_5343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5344, AgradDistributionTestFixture, AgradDistributionWiener_fd_5344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5345, AgradDistributionTestFixture, AgradDistributionWiener_fd_5345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5346, AgradDistributionTestFixture, AgradDistributionWiener_fd_5346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5347, AgradDistributionTestFixture, AgradDistributionWiener_fd_5347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5348, AgradDistributionTestFixture, AgradDistributionWiener_fd_5348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5349, AgradDistributionTestFixture, AgradDistributionWiener_fd_5349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5350, AgradDistributionTestFixture, AgradDistributionWiener_fd_5350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5351, AgradDistributionTestFixture, AgradDistributionWiener_fd_5351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5352, AgradDistributionTestFixture, AgradDistributionWiener_fd_5352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5353, AgradDistributionTestFixture, AgradDistributionWiener_fd_5353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5354, AgradDistributionTestFixture, AgradDistributionWiener_fd_5354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5355, AgradDistributionTestFixture, AgradDistributionWiener_fd_5355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5356, AgradDistributionTestFixture, AgradDistributionWiener_fd_5356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5357, AgradDistributionTestFixture, AgradDistributionWiener_fd_5357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5358, AgradDistributionTestFixture, AgradDistributionWiener_fd_5358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5359, AgradDistributionTestFixture, AgradDistributionWiener_fd_5359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5360, AgradDistributionTestFixture, AgradDistributionWiener_fd_5360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5361, AgradDistributionTestFixture, AgradDistributionWiener_fd_5361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5362, AgradDistributionTestFixture, AgradDistributionWiener_fd_5362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5363, AgradDistributionTestFixture, AgradDistributionWiener_fd_5363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5364, AgradDistributionTestFixture, AgradDistributionWiener_fd_5364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5365, AgradDistributionTestFixture, AgradDistributionWiener_fd_5365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5366, AgradDistributionTestFixture, AgradDistributionWiener_fd_5366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5367, AgradDistributionTestFixture, AgradDistributionWiener_fd_5367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5368, AgradDistributionTestFixture, AgradDistributionWiener_fd_5368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5369, AgradDistributionTestFixture, AgradDistributionWiener_fd_5369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5370, AgradDistributionTestFixture, AgradDistributionWiener_fd_5370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5371, AgradDistributionTestFixture, AgradDistributionWiener_fd_5371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5372, AgradDistributionTestFixture, AgradDistributionWiener_fd_5372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5373, AgradDistributionTestFixture, AgradDistributionWiener_fd_5373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5374, AgradDistributionTestFixture, AgradDistributionWiener_fd_5374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5375, AgradDistributionTestFixture, AgradDistributionWiener_fd_5375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5376, AgradDistributionTestFixture, AgradDistributionWiener_fd_5376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5377, AgradDistributionTestFixture, AgradDistributionWiener_fd_5377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5378, AgradDistributionTestFixture, AgradDistributionWiener_fd_5378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5379, AgradDistributionTestFixture, AgradDistributionWiener_fd_5379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5380, AgradDistributionTestFixture, AgradDistributionWiener_fd_5380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5381, AgradDistributionTestFixture, AgradDistributionWiener_fd_5381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5382, AgradDistributionTestFixture, AgradDistributionWiener_fd_5382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5383, AgradDistributionTestFixture, AgradDistributionWiener_fd_5383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5384, AgradDistributionTestFixture, AgradDistributionWiener_fd_5384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5385, AgradDistributionTestFixture, AgradDistributionWiener_fd_5385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5386, AgradDistributionTestFixture, AgradDistributionWiener_fd_5386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5387, AgradDistributionTestFixture, AgradDistributionWiener_fd_5387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5388, AgradDistributionTestFixture, AgradDistributionWiener_fd_5388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5389, AgradDistributionTestFixture, AgradDistributionWiener_fd_5389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5390, AgradDistributionTestFixture, AgradDistributionWiener_fd_5390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5391, AgradDistributionTestFixture, AgradDistributionWiener_fd_5391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5392, AgradDistributionTestFixture, AgradDistributionWiener_fd_5392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5393, AgradDistributionTestFixture, AgradDistributionWiener_fd_5393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5394, AgradDistributionTestFixture, AgradDistributionWiener_fd_5394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5395, AgradDistributionTestFixture, AgradDistributionWiener_fd_5395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5396, AgradDistributionTestFixture, AgradDistributionWiener_fd_5396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5397, AgradDistributionTestFixture, AgradDistributionWiener_fd_5397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5398, AgradDistributionTestFixture, AgradDistributionWiener_fd_5398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5399, AgradDistributionTestFixture, AgradDistributionWiener_fd_5399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5300;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, double, empty> type_fv_5301;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_5302;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5303;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_5304;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_5305;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5306;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_5307;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_5308;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5309;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_5310;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5311;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5312;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5313;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5314;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5315;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5316;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5317;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5318;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_5319;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_5320;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5321;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_5322;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5323;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5324;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_5325;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5326;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5327;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5328;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5329;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5330;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5331;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5332;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5333;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5334;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5335;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5336;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_5337;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_5338;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5339;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_5340;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_5341;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5342;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_5343;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_5344;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5345;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_5346;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5347;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5348;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5349;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5350;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5351;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5352;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5353;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5354;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_5355;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_5356;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5357;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_5358;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5359;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5360;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_5361;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5362;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5363;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5364;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5365;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5366;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5367;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5368;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5369;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5370;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5371;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5372;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty> type_fv_5373;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_fv_5374;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5375;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<var>, empty> type_fv_5376;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<var>>, empty> type_fv_5377;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5378;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_fv_5379;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_fv_5380;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5381;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<var>, empty> type_fv_5382;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5383;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5384;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5385;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5386;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5387;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5388;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5389;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5390;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, double, empty> type_fv_5391;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, empty> type_fv_5392;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5393;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, empty> type_fv_5394;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5395;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5396;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, empty> type_fv_5397;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5398;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5300> AgradDistributionWiener_fv_5300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5301> AgradDistributionWiener_fv_5301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5302> AgradDistributionWiener_fv_5302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5303> AgradDistributionWiener_fv_5303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5304> AgradDistributionWiener_fv_5304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5305> AgradDistributionWiener_fv_5305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5306> AgradDistributionWiener_fv_5306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5307> AgradDistributionWiener_fv_5307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5308> AgradDistributionWiener_fv_5308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5309> AgradDistributionWiener_fv_5309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5310> AgradDistributionWiener_fv_5310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5311> AgradDistributionWiener_fv_5311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5312> AgradDistributionWiener_fv_5312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5313> AgradDistributionWiener_fv_5313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5314> AgradDistributionWiener_fv_5314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5315> AgradDistributionWiener_fv_5315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5316> AgradDistributionWiener_fv_5316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5317> AgradDistributionWiener_fv_5317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5318> AgradDistributionWiener_fv_5318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5319> AgradDistributionWiener_fv_5319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5320> AgradDistributionWiener_fv_5320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5321> AgradDistributionWiener_fv_5321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5322> AgradDistributionWiener_fv_5322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5323> AgradDistributionWiener_fv_5323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5324> AgradDistributionWiener_fv_5324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5325> AgradDistributionWiener_fv_5325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5326> AgradDistributionWiener_fv_5326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5327> AgradDistributionWiener_fv_5327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5328> AgradDistributionWiener_fv_5328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5329> AgradDistributionWiener_fv_5329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5330> AgradDistributionWiener_fv_5330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5331> AgradDistributionWiener_fv_5331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5332> AgradDistributionWiener_fv_5332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5333> AgradDistributionWiener_fv_5333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5334> AgradDistributionWiener_fv_5334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5335> AgradDistributionWiener_fv_5335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5336> AgradDistributionWiener_fv_5336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5337> AgradDistributionWiener_fv_5337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5338> AgradDistributionWiener_fv_5338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5339> AgradDistributionWiener_fv_5339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5340> AgradDistributionWiener_fv_5340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5341> AgradDistributionWiener_fv_5341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5342> AgradDistributionWiener_fv_5342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5343> AgradDistributionWiener_fv_5343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5344> AgradDistributionWiener_fv_5344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5345> AgradDistributionWiener_fv_5345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5346> AgradDistributionWiener_fv_5346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5347> AgradDistributionWiener_fv_5347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5348> AgradDistributionWiener_fv_5348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5349> AgradDistributionWiener_fv_5349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5350> AgradDistributionWiener_fv_5350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5351> AgradDistributionWiener_fv_5351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5352> AgradDistributionWiener_fv_5352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5353> AgradDistributionWiener_fv_5353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5354> AgradDistributionWiener_fv_5354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5355> AgradDistributionWiener_fv_5355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5356> AgradDistributionWiener_fv_5356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5357> AgradDistributionWiener_fv_5357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5358> AgradDistributionWiener_fv_5358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5359> AgradDistributionWiener_fv_5359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5360> AgradDistributionWiener_fv_5360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5361> AgradDistributionWiener_fv_5361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5362> AgradDistributionWiener_fv_5362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5363> AgradDistributionWiener_fv_5363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5364> AgradDistributionWiener_fv_5364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5365> AgradDistributionWiener_fv_5365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5366> AgradDistributionWiener_fv_5366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5367> AgradDistributionWiener_fv_5367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5368> AgradDistributionWiener_fv_5368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5369> AgradDistributionWiener_fv_5369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5370> AgradDistributionWiener_fv_5370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5371> AgradDistributionWiener_fv_5371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5372> AgradDistributionWiener_fv_5372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5373> AgradDistributionWiener_fv_5373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5374> AgradDistributionWiener_fv_5374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5375> AgradDistributionWiener_fv_5375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5376> AgradDistributionWiener_fv_5376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5377> AgradDistributionWiener_fv_5377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5378> AgradDistributionWiener_fv_5378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5379> AgradDistributionWiener_fv_5379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5380> AgradDistributionWiener_fv_5380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5381> AgradDistributionWiener_fv_5381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5382> AgradDistributionWiener_fv_5382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5383> AgradDistributionWiener_fv_5383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5384> AgradDistributionWiener_fv_5384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5385> AgradDistributionWiener_fv_5385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5386> AgradDistributionWiener_fv_5386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5387> AgradDistributionWiener_fv_5387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5388> AgradDistributionWiener_fv_5388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5389> AgradDistributionWiener_fv_5389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5390> AgradDistributionWiener_fv_5390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5391> AgradDistributionWiener_fv_5391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5392> AgradDistributionWiener_fv_5392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5393> AgradDistributionWiener_fv_5393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5394> AgradDistributionWiener_fv_5394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5395> AgradDistributionWiener_fv_5395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5396> AgradDistributionWiener_fv_5396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5397> AgradDistributionWiener_fv_5397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5398> AgradDistributionWiener_fv_5398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5399> AgradDistributionWiener_fv_5399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5300, AgradDistributionTestFixture, AgradDistributionWiener_fv_5300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5301, AgradDistributionTestFixture, AgradDistributionWiener_fv_5301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5302, AgradDistributionTestFixture, AgradDistributionWiener_fv_5302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5303, AgradDistributionTestFixture, AgradDistributionWiener_fv_5303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5304, AgradDistributionTestFixture, AgradDistributionWiener_fv_5304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5305, AgradDistributionTestFixture, AgradDistributionWiener_fv_5305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5306, AgradDistributionTestFixture, AgradDistributionWiener_fv_5306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5307, AgradDistributionTestFixture, AgradDistributionWiener_fv_5307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5308, AgradDistributionTestFixture, AgradDistributionWiener_fv_5308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5309, AgradDistributionTestFixture, AgradDistributionWiener_fv_5309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5310, AgradDistributionTestFixture, AgradDistributionWiener_fv_5310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5311, AgradDistributionTestFixture, AgradDistributionWiener_fv_5311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5312, AgradDistributionTestFixture, AgradDistributionWiener_fv_5312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5313, AgradDistributionTestFixture, AgradDistributionWiener_fv_5313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5314, AgradDistributionTestFixture, AgradDistributionWiener_fv_5314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5315, AgradDistributionTestFixture, AgradDistributionWiener_fv_5315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5316, AgradDistributionTestFixture, AgradDistributionWiener_fv_5316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5317, AgradDistributionTestFixture, AgradDistributionWiener_fv_5317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5318, AgradDistributionTestFixture, AgradDistributionWiener_fv_5318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5319, AgradDistributionTestFixture, AgradDistributionWiener_fv_5319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5320, AgradDistributionTestFixture, AgradDistributionWiener_fv_5320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5321, AgradDistributionTestFixture, AgradDistributionWiener_fv_5321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5322, AgradDistributionTestFixture, AgradDistributionWiener_fv_5322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5323, AgradDistributionTestFixture, AgradDistributionWiener_fv_5323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5324, AgradDistributionTestFixture, AgradDistributionWiener_fv_5324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5325, AgradDistributionTestFixture, AgradDistributionWiener_fv_5325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5326, AgradDistributionTestFixture, AgradDistributionWiener_fv_5326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5327, AgradDistributionTestFixture, AgradDistributionWiener_fv_5327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5328, AgradDistributionTestFixture, AgradDistributionWiener_fv_5328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5329, AgradDistributionTestFixture, AgradDistributionWiener_fv_5329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5330, AgradDistributionTestFixture, AgradDistributionWiener_fv_5330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5331, AgradDistributionTestFixture, AgradDistributionWiener_fv_5331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5332, AgradDistributionTestFixture, AgradDistributionWiener_fv_5332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5333, AgradDistributionTestFixture, AgradDistributionWiener_fv_5333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5334, AgradDistributionTestFixture, AgradDistributionWiener_fv_5334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5335, AgradDistributionTestFixture, AgradDistributionWiener_fv_5335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5336, AgradDistributionTestFixture, AgradDistributionWiener_fv_5336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5337, AgradDistributionTestFixture, AgradDistributionWiener_fv_5337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5338, AgradDistributionTestFixture, AgradDistributionWiener_fv_5338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5339, AgradDistributionTestFixture, AgradDistributionWiener_fv_5339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5340, AgradDistributionTestFixture, AgradDistributionWiener_fv_5340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5341, AgradDistributionTestFixture, AgradDistributionWiener_fv_5341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5342, AgradDistributionTestFixture, AgradDistributionWiener_fv_5342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5343, AgradDistributionTestFixture, AgradDistributionWiener_fv_5343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5344, AgradDistributionTestFixture, AgradDistributionWiener_fv_5344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5345, AgradDistributionTestFixture, AgradDistributionWiener_fv_5345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5346, AgradDistributionTestFixture, AgradDistributionWiener_fv_5346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5347, AgradDistributionTestFixture, AgradDistributionWiener_fv_5347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5348, AgradDistributionTestFixture, AgradDistributionWiener_fv_5348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5349, AgradDistributionTestFixture, AgradDistributionWiener_fv_5349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5350, AgradDistributionTestFixture, AgradDistributionWiener_fv_5350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5351, AgradDistributionTestFixture, AgradDistributionWiener_fv_5351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5352, AgradDistributionTestFixture, AgradDistributionWiener_fv_5352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5353, AgradDistributionTestFixture, AgradDistributionWiener_fv_5353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5354, AgradDistributionTestFixture, AgradDistributionWiener_fv_5354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5355, AgradDistributionTestFixture, AgradDistributionWiener_fv_5355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5356, AgradDistributionTestFixture, AgradDistributionWiener_fv_5356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5357, AgradDistributionTestFixture, AgradDistributionWiener_fv_5357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5358, AgradDistributionTestFixture, AgradDistributionWiener_fv_5358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5359, AgradDistributionTestFixture, AgradDistributionWiener_fv_5359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5360, AgradDistributionTestFixture, AgradDistributionWiener_fv_5360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5361, AgradDistributionTestFixture, AgradDistributionWiener_fv_5361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5362, AgradDistributionTestFixture, AgradDistributionWiener_fv_5362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5363, AgradDistributionTestFixture, AgradDistributionWiener_fv_5363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5364, AgradDistributionTestFixture, AgradDistributionWiener_fv_5364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5365, AgradDistributionTestFixture, AgradDistributionWiener_fv_5365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5366, AgradDistributionTestFixture, AgradDistributionWiener_fv_5366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5367, AgradDistributionTestFixture, AgradDistributionWiener_fv_5367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5368, AgradDistributionTestFixture, AgradDistributionWiener_fv_5368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5369, AgradDistributionTestFixture, AgradDistributionWiener_fv_5369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5370, AgradDistributionTestFixture, AgradDistributionWiener_fv_5370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5371, AgradDistributionTestFixture, AgradDistributionWiener_fv_5371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5372, AgradDistributionTestFixture, AgradDistributionWiener_fv_5372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5373, AgradDistributionTestFixture, AgradDistributionWiener_fv_5373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5374, AgradDistributionTestFixture, AgradDistributionWiener_fv_5374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5375, AgradDistributionTestFixture, AgradDistributionWiener_fv_5375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5376, AgradDistributionTestFixture, AgradDistributionWiener_fv_5376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5377, AgradDistributionTestFixture, AgradDistributionWiener_fv_5377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5378, AgradDistributionTestFixture, AgradDistributionWiener_fv_5378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5379, AgradDistributionTestFixture, AgradDistributionWiener_fv_5379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5380, AgradDistributionTestFixture, AgradDistributionWiener_fv_5380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5381, AgradDistributionTestFixture, AgradDistributionWiener_fv_5381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5382, AgradDistributionTestFixture, AgradDistributionWiener_fv_5382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5383, AgradDistributionTestFixture, AgradDistributionWiener_fv_5383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5384, AgradDistributionTestFixture, AgradDistributionWiener_fv_5384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5385, AgradDistributionTestFixture, AgradDistributionWiener_fv_5385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5386, AgradDistributionTestFixture, AgradDistributionWiener_fv_5386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5387, AgradDistributionTestFixture, AgradDistributionWiener_fv_5387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5388, AgradDistributionTestFixture, AgradDistributionWiener_fv_5388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5389, AgradDistributionTestFixture, AgradDistributionWiener_fv_5389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5390, AgradDistributionTestFixture, AgradDistributionWiener_fv_5390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5391, AgradDistributionTestFixture, AgradDistributionWiener_fv_5391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5392, AgradDistributionTestFixture, AgradDistributionWiener_fv_5392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5393, AgradDistributionTestFixture, AgradDistributionWiener_fv_5393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5394, AgradDistributionTestFixture, AgradDistributionWiener_fv_5394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5395, AgradDistributionTestFixture, AgradDistributionWiener_fv_5395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5396, AgradDistributionTestFixture, AgradDistributionWiener_fv_5396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5397, AgradDistributionTestFixture, AgradDistributionWiener_fv_5397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5398, AgradDistributionTestFixture, AgradDistributionWiener_fv_5398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5399, AgradDistributionTestFixture, AgradDistributionWiener_fv_5399);
+
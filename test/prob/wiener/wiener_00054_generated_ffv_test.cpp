@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5400;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5401;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5402;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5403;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5404;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5405;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5406;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5407;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5408;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_ffv_5409;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_ffv_5410;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5411;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_5412;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5413;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5414;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_ffv_5415;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_5416;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5417;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5418;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5419;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5420;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5421;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5422;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5423;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5424;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5425;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5426;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_5427;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5428;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5429;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5430;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5431;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5432;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5433;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5434;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5435;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5436;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5437;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5438;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5439;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5440;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5441;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5442;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5443;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5444;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_5445;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_5446;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5447;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_5448;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5449;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5450;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_5451;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_5452;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5453;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5454;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5455;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5456;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5457;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5458;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5459;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5460;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5461;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5462;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_5463;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5464;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5465;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5466;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5467;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5468;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5469;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5470;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5471;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5472;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5473;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5474;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5475;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5476;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5477;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5478;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5479;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5480;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty> type_ffv_5481;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_5482;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5483;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_5484;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5485;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5486;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_5487;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_5488;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5489;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5490;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5491;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5492;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5493;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5494;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5495;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5496;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5497;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5498;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_5499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5400> AgradDistributionWiener_ffv_5400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5401> AgradDistributionWiener_ffv_5401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5402> AgradDistributionWiener_ffv_5402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5403> AgradDistributionWiener_ffv_5403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5404> AgradDistributionWiener_ffv_5404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5405> AgradDistributionWiener_ffv_5405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5406> AgradDistributionWiener_ffv_5406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5407> AgradDistributionWiener_ffv_5407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5408> AgradDistributionWiener_ffv_5408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5409> AgradDistributionWiener_ffv_5409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5410> AgradDistributionWiener_ffv_5410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5411> AgradDistributionWiener_ffv_5411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5412> AgradDistributionWiener_ffv_5412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5413> AgradDistributionWiener_ffv_5413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5414> AgradDistributionWiener_ffv_5414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5415> AgradDistributionWiener_ffv_5415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5416> AgradDistributionWiener_ffv_5416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5417> AgradDistributionWiener_ffv_5417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5418> AgradDistributionWiener_ffv_5418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5419> AgradDistributionWiener_ffv_5419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5420> AgradDistributionWiener_ffv_5420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5421> AgradDistributionWiener_ffv_5421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5422> AgradDistributionWiener_ffv_5422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5423> AgradDistributionWiener_ffv_5423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5424> AgradDistributionWiener_ffv_5424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5425> AgradDistributionWiener_ffv_5425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5426> AgradDistributionWiener_ffv_5426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5427> AgradDistributionWiener_ffv_5427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5428> AgradDistributionWiener_ffv_5428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5429> AgradDistributionWiener_ffv_5429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5430> AgradDistributionWiener_ffv_5430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5431> AgradDistributionWiener_ffv_5431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5432> AgradDistributionWiener_ffv_5432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5433> AgradDistributionWiener_ffv_5433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5434> AgradDistributionWiener_ffv_5434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5435> AgradDistributionWiener_ffv_5435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5436> AgradDistributionWiener_ffv_5436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5437> AgradDistributionWiener_ffv_5437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5438> AgradDistributionWiener_ffv_5438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5439> AgradDistributionWiener_ffv_5439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5440> AgradDistributionWiener_ffv_5440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5441> AgradDistributionWiener_ffv_5441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5442> AgradDistributionWiener_ffv_5442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5443> AgradDistributionWiener_ffv_5443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5444> AgradDistributionWiener_ffv_5444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5445> AgradDistributionWiener_ffv_5445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5446> AgradDistributionWiener_ffv_5446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5447> AgradDistributionWiener_ffv_5447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5448> AgradDistributionWiener_ffv_5448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5449> AgradDistributionWiener_ffv_5449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5450> AgradDistributionWiener_ffv_5450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5451> AgradDistributionWiener_ffv_5451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5452> AgradDistributionWiener_ffv_5452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5453> AgradDistributionWiener_ffv_5453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5454> AgradDistributionWiener_ffv_5454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5455> AgradDistributionWiener_ffv_5455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5456> AgradDistributionWiener_ffv_5456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5457> AgradDistributionWiener_ffv_5457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5458> AgradDistributionWiener_ffv_5458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5459> AgradDistributionWiener_ffv_5459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5460> AgradDistributionWiener_ffv_5460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5461> AgradDistributionWiener_ffv_5461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5462> AgradDistributionWiener_ffv_5462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5463> AgradDistributionWiener_ffv_5463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5464> AgradDistributionWiener_ffv_5464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5465> AgradDistributionWiener_ffv_5465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5466> AgradDistributionWiener_ffv_5466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5467> AgradDistributionWiener_ffv_5467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5468> AgradDistributionWiener_ffv_5468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5469> AgradDistributionWiener_ffv_5469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5470> AgradDistributionWiener_ffv_5470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5471> AgradDistributionWiener_ffv_5471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5472> AgradDistributionWiener_ffv_5472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5473> AgradDistributionWiener_ffv_5473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5474> AgradDistributionWiener_ffv_5474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5475> AgradDistributionWiener_ffv_5475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5476> AgradDistributionWiener_ffv_5476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5477> AgradDistributionWiener_ffv_5477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5478> AgradDistributionWiener_ffv_5478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5479> AgradDistributionWiener_ffv_5479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5480> AgradDistributionWiener_ffv_5480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5481> AgradDistributionWiener_ffv_5481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5482> AgradDistributionWiener_ffv_5482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5483> AgradDistributionWiener_ffv_5483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5484> AgradDistributionWiener_ffv_5484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5485> AgradDistributionWiener_ffv_5485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5486> AgradDistributionWiener_ffv_5486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5487> AgradDistributionWiener_ffv_5487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5488> AgradDistributionWiener_ffv_5488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5489> AgradDistributionWiener_ffv_5489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5490> AgradDistributionWiener_ffv_5490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5491> AgradDistributionWiener_ffv_5491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5492> AgradDistributionWiener_ffv_5492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5493> AgradDistributionWiener_ffv_5493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5494> AgradDistributionWiener_ffv_5494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5495> AgradDistributionWiener_ffv_5495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5496> AgradDistributionWiener_ffv_5496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5497> AgradDistributionWiener_ffv_5497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5498> AgradDistributionWiener_ffv_5498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5499> AgradDistributionWiener_ffv_5499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5400, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5401, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5402, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5403, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5404, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5405, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5406, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5407, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5408, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5409, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5410, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5411, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5412, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5413, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5414, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5415, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5416, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5417, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5418, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5419, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5420, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5421, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5422, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5423, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5424, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5425, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5426, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5427, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5428, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5429, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5430, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5431, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5432, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5433, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5434, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5435, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5436, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5437, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5438, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5439, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5440, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5441, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5442, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5443, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5444, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5445, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5446, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5447, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5448, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5449, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5450, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5451, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5452, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5453, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5454, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5455, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5456, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5457, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5458, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5459, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5460, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5461, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5462, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5463, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5464, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5465, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5466, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5467, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5468, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5469, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5470, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5471, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5472, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5473, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5474, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5475, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5476, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5477, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5478, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5479, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5480, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5481, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5482, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5483, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5484, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5485, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5486, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5487, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5488, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5489, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5490, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5491, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5492, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5493, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5494, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5495, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5496, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5497, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5498, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5499, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5499);
+
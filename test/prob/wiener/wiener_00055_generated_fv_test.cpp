@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_5500;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5501;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_5502;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5503;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5504;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_5505;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5506;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5507;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5508;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5509;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5510;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5511;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5512;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5513;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5514;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5515;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5516;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, empty> type_fv_5517;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_5518;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5519;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_5520;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_5521;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5522;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_5523;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_5524;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5525;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_5526;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5527;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5528;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5529;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5530;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5531;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5532;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5533;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5534;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_5535;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_5536;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5537;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_5538;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5539;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5540;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_5541;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5542;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5543;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5544;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5545;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5546;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5547;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5548;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5549;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5550;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5551;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5552;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_5553;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_5554;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5555;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_5556;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_5557;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5558;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_5559;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_5560;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5561;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_5562;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5563;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5564;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_5565;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5566;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5567;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5568;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5569;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5570;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_5571;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_5572;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5573;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_5574;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_5575;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5576;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_5577;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_5578;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5579;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_5580;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_5581;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5582;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_5583;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_5584;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5585;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_5586;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_5587;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5588;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, double, double, empty> type_fv_5589;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, double, std::vector<double>, empty> type_fv_5590;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5591;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, double, fvar<var>, empty> type_fv_5592;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, double, std::vector<fvar<var>>, empty> type_fv_5593;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_5594;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, double, empty> type_fv_5595;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, std::vector<double>, empty> type_fv_5596;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_5597;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, fvar<var>, empty> type_fv_5598;
+typedef boost::mpl::vector<std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_5599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5500> AgradDistributionWiener_fv_5500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5501> AgradDistributionWiener_fv_5501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5502> AgradDistributionWiener_fv_5502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5503> AgradDistributionWiener_fv_5503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5504> AgradDistributionWiener_fv_5504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5505> AgradDistributionWiener_fv_5505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5506> AgradDistributionWiener_fv_5506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5507> AgradDistributionWiener_fv_5507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5508> AgradDistributionWiener_fv_5508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5509> AgradDistributionWiener_fv_5509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5510> AgradDistributionWiener_fv_5510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5511> AgradDistributionWiener_fv_5511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5512> AgradDistributionWiener_fv_5512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5513> AgradDistributionWiener_fv_5513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5514> AgradDistributionWiener_fv_5514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5515> AgradDistributionWiener_fv_5515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5516> AgradDistributionWiener_fv_5516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5517> AgradDistributionWiener_fv_5517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5518> AgradDistributionWiener_fv_5518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5519> AgradDistributionWiener_fv_5519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5520> AgradDistributionWiener_fv_5520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5521> AgradDistributionWiener_fv_5521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5522> AgradDistributionWiener_fv_5522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5523> AgradDistributionWiener_fv_5523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5524> AgradDistributionWiener_fv_5524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5525> AgradDistributionWiener_fv_5525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5526> AgradDistributionWiener_fv_5526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5527> AgradDistributionWiener_fv_5527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5528> AgradDistributionWiener_fv_5528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5529> AgradDistributionWiener_fv_5529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5530> AgradDistributionWiener_fv_5530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5531> AgradDistributionWiener_fv_5531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5532> AgradDistributionWiener_fv_5532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5533> AgradDistributionWiener_fv_5533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5534> AgradDistributionWiener_fv_5534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5535> AgradDistributionWiener_fv_5535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5536> AgradDistributionWiener_fv_5536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5537> AgradDistributionWiener_fv_5537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5538> AgradDistributionWiener_fv_5538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5539> AgradDistributionWiener_fv_5539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5540> AgradDistributionWiener_fv_5540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5541> AgradDistributionWiener_fv_5541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5542> AgradDistributionWiener_fv_5542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5543> AgradDistributionWiener_fv_5543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5544> AgradDistributionWiener_fv_5544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5545> AgradDistributionWiener_fv_5545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5546> AgradDistributionWiener_fv_5546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5547> AgradDistributionWiener_fv_5547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5548> AgradDistributionWiener_fv_5548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5549> AgradDistributionWiener_fv_5549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5550> AgradDistributionWiener_fv_5550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5551> AgradDistributionWiener_fv_5551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5552> AgradDistributionWiener_fv_5552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5553> AgradDistributionWiener_fv_5553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5554> AgradDistributionWiener_fv_5554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5555> AgradDistributionWiener_fv_5555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5556> AgradDistributionWiener_fv_5556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5557> AgradDistributionWiener_fv_5557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5558> AgradDistributionWiener_fv_5558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5559> AgradDistributionWiener_fv_5559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5560> AgradDistributionWiener_fv_5560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5561> AgradDistributionWiener_fv_5561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5562> AgradDistributionWiener_fv_5562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5563> AgradDistributionWiener_fv_5563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5564> AgradDistributionWiener_fv_5564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5565> AgradDistributionWiener_fv_5565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5566> AgradDistributionWiener_fv_5566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5567> AgradDistributionWiener_fv_5567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5568> AgradDistributionWiener_fv_5568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5569> AgradDistributionWiener_fv_5569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5570> AgradDistributionWiener_fv_5570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5571> AgradDistributionWiener_fv_5571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5572> AgradDistributionWiener_fv_5572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5573> AgradDistributionWiener_fv_5573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5574> AgradDistributionWiener_fv_5574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5575> AgradDistributionWiener_fv_5575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5576> AgradDistributionWiener_fv_5576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5577> AgradDistributionWiener_fv_5577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5578> AgradDistributionWiener_fv_5578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5579> AgradDistributionWiener_fv_5579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5580> AgradDistributionWiener_fv_5580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5581> AgradDistributionWiener_fv_5581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5582> AgradDistributionWiener_fv_5582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5583> AgradDistributionWiener_fv_5583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5584> AgradDistributionWiener_fv_5584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5585> AgradDistributionWiener_fv_5585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5586> AgradDistributionWiener_fv_5586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5587> AgradDistributionWiener_fv_5587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5588> AgradDistributionWiener_fv_5588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5589> AgradDistributionWiener_fv_5589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5590> AgradDistributionWiener_fv_5590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5591> AgradDistributionWiener_fv_5591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5592> AgradDistributionWiener_fv_5592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5593> AgradDistributionWiener_fv_5593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5594> AgradDistributionWiener_fv_5594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5595> AgradDistributionWiener_fv_5595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5596> AgradDistributionWiener_fv_5596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5597> AgradDistributionWiener_fv_5597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5598> AgradDistributionWiener_fv_5598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_5599> AgradDistributionWiener_fv_5599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5500, AgradDistributionTestFixture, AgradDistributionWiener_fv_5500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5501, AgradDistributionTestFixture, AgradDistributionWiener_fv_5501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5502, AgradDistributionTestFixture, AgradDistributionWiener_fv_5502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5503, AgradDistributionTestFixture, AgradDistributionWiener_fv_5503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5504, AgradDistributionTestFixture, AgradDistributionWiener_fv_5504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5505, AgradDistributionTestFixture, AgradDistributionWiener_fv_5505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5506, AgradDistributionTestFixture, AgradDistributionWiener_fv_5506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5507, AgradDistributionTestFixture, AgradDistributionWiener_fv_5507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5508, AgradDistributionTestFixture, AgradDistributionWiener_fv_5508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5509, AgradDistributionTestFixture, AgradDistributionWiener_fv_5509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5510, AgradDistributionTestFixture, AgradDistributionWiener_fv_5510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5511, AgradDistributionTestFixture, AgradDistributionWiener_fv_5511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5512, AgradDistributionTestFixture, AgradDistributionWiener_fv_5512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5513, AgradDistributionTestFixture, AgradDistributionWiener_fv_5513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5514, AgradDistributionTestFixture, AgradDistributionWiener_fv_5514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5515, AgradDistributionTestFixture, AgradDistributionWiener_fv_5515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5516, AgradDistributionTestFixture, AgradDistributionWiener_fv_5516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5517, AgradDistributionTestFixture, AgradDistributionWiener_fv_5517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5518, AgradDistributionTestFixture, AgradDistributionWiener_fv_5518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5519, AgradDistributionTestFixture, AgradDistributionWiener_fv_5519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5520, AgradDistributionTestFixture, AgradDistributionWiener_fv_5520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5521, AgradDistributionTestFixture, AgradDistributionWiener_fv_5521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5522, AgradDistributionTestFixture, AgradDistributionWiener_fv_5522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5523, AgradDistributionTestFixture, AgradDistributionWiener_fv_5523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5524, AgradDistributionTestFixture, AgradDistributionWiener_fv_5524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5525, AgradDistributionTestFixture, AgradDistributionWiener_fv_5525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5526, AgradDistributionTestFixture, AgradDistributionWiener_fv_5526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5527, AgradDistributionTestFixture, AgradDistributionWiener_fv_5527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5528, AgradDistributionTestFixture, AgradDistributionWiener_fv_5528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5529, AgradDistributionTestFixture, AgradDistributionWiener_fv_5529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5530, AgradDistributionTestFixture, AgradDistributionWiener_fv_5530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5531, AgradDistributionTestFixture, AgradDistributionWiener_fv_5531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5532, AgradDistributionTestFixture, AgradDistributionWiener_fv_5532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5533, AgradDistributionTestFixture, AgradDistributionWiener_fv_5533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5534, AgradDistributionTestFixture, AgradDistributionWiener_fv_5534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5535, AgradDistributionTestFixture, AgradDistributionWiener_fv_5535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5536, AgradDistributionTestFixture, AgradDistributionWiener_fv_5536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5537, AgradDistributionTestFixture, AgradDistributionWiener_fv_5537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5538, AgradDistributionTestFixture, AgradDistributionWiener_fv_5538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5539, AgradDistributionTestFixture, AgradDistributionWiener_fv_5539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5540, AgradDistributionTestFixture, AgradDistributionWiener_fv_5540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5541, AgradDistributionTestFixture, AgradDistributionWiener_fv_5541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5542, AgradDistributionTestFixture, AgradDistributionWiener_fv_5542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5543, AgradDistributionTestFixture, AgradDistributionWiener_fv_5543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5544, AgradDistributionTestFixture, AgradDistributionWiener_fv_5544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5545, AgradDistributionTestFixture, AgradDistributionWiener_fv_5545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5546, AgradDistributionTestFixture, AgradDistributionWiener_fv_5546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5547, AgradDistributionTestFixture, AgradDistributionWiener_fv_5547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5548, AgradDistributionTestFixture, AgradDistributionWiener_fv_5548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5549, AgradDistributionTestFixture, AgradDistributionWiener_fv_5549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5550, AgradDistributionTestFixture, AgradDistributionWiener_fv_5550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5551, AgradDistributionTestFixture, AgradDistributionWiener_fv_5551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5552, AgradDistributionTestFixture, AgradDistributionWiener_fv_5552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5553, AgradDistributionTestFixture, AgradDistributionWiener_fv_5553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5554, AgradDistributionTestFixture, AgradDistributionWiener_fv_5554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5555, AgradDistributionTestFixture, AgradDistributionWiener_fv_5555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5556, AgradDistributionTestFixture, AgradDistributionWiener_fv_5556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5557, AgradDistributionTestFixture, AgradDistributionWiener_fv_5557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5558, AgradDistributionTestFixture, AgradDistributionWiener_fv_5558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5559, AgradDistributionTestFixture, AgradDistributionWiener_fv_5559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5560, AgradDistributionTestFixture, AgradDistributionWiener_fv_5560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5561, AgradDistributionTestFixture, AgradDistributionWiener_fv_5561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5562, AgradDistributionTestFixture, AgradDistributionWiener_fv_5562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5563, AgradDistributionTestFixture, AgradDistributionWiener_fv_5563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5564, AgradDistributionTestFixture, AgradDistributionWiener_fv_5564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5565, AgradDistributionTestFixture, AgradDistributionWiener_fv_5565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5566, AgradDistributionTestFixture, AgradDistributionWiener_fv_5566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5567, AgradDistributionTestFixture, AgradDistributionWiener_fv_5567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5568, AgradDistributionTestFixture, AgradDistributionWiener_fv_5568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5569, AgradDistributionTestFixture, AgradDistributionWiener_fv_5569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5570, AgradDistributionTestFixture, AgradDistributionWiener_fv_5570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5571, AgradDistributionTestFixture, AgradDistributionWiener_fv_5571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5572, AgradDistributionTestFixture, AgradDistributionWiener_fv_5572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5573, AgradDistributionTestFixture, AgradDistributionWiener_fv_5573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5574, AgradDistributionTestFixture, AgradDistributionWiener_fv_5574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5575, AgradDistributionTestFixture, AgradDistributionWiener_fv_5575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5576, AgradDistributionTestFixture, AgradDistributionWiener_fv_5576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5577, AgradDistributionTestFixture, AgradDistributionWiener_fv_5577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5578, AgradDistributionTestFixture, AgradDistributionWiener_fv_5578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5579, AgradDistributionTestFixture, AgradDistributionWiener_fv_5579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5580, AgradDistributionTestFixture, AgradDistributionWiener_fv_5580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5581, AgradDistributionTestFixture, AgradDistributionWiener_fv_5581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5582, AgradDistributionTestFixture, AgradDistributionWiener_fv_5582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5583, AgradDistributionTestFixture, AgradDistributionWiener_fv_5583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5584, AgradDistributionTestFixture, AgradDistributionWiener_fv_5584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5585, AgradDistributionTestFixture, AgradDistributionWiener_fv_5585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5586, AgradDistributionTestFixture, AgradDistributionWiener_fv_5586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5587, AgradDistributionTestFixture, AgradDistributionWiener_fv_5587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5588, AgradDistributionTestFixture, AgradDistributionWiener_fv_5588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5589, AgradDistributionTestFixture, AgradDistributionWiener_fv_5589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5590, AgradDistributionTestFixture, AgradDistributionWiener_fv_5590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5591, AgradDistributionTestFixture, AgradDistributionWiener_fv_5591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5592, AgradDistributionTestFixture, AgradDistributionWiener_fv_5592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5593, AgradDistributionTestFixture, AgradDistributionWiener_fv_5593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5594, AgradDistributionTestFixture, AgradDistributionWiener_fv_5594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5595, AgradDistributionTestFixture, AgradDistributionWiener_fv_5595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5596, AgradDistributionTestFixture, AgradDistributionWiener_fv_5596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5597, AgradDistributionTestFixture, AgradDistributionWiener_fv_5597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5598, AgradDistributionTestFixture, AgradDistributionWiener_fv_5598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_5599, AgradDistributionTestFixture, AgradDistributionWiener_fv_5599);
+
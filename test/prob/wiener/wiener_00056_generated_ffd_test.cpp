@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5600;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5601;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5602;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5603;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5604;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5605;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5606;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, double, empty> type_ffd_5607;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5608;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5609;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5610;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5611;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5612;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5613;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5614;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5615;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5616;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5617;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5618;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5619;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5620;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5621;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5622;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5623;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5624;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, double, empty> type_ffd_5625;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, std::vector<double>, empty> type_ffd_5626;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5627;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_5628;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5629;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5630;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, double, empty> type_ffd_5631;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_5632;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5633;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5634;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5635;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5636;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5637;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5638;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5639;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5640;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5641;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5642;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_5643;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5644;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5645;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5646;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5647;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5648;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5649;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5650;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5651;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5652;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5653;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5654;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5655;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5656;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5657;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5658;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5659;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5660;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_5661;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_5662;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5663;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_5664;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5665;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5666;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_5667;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_5668;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5669;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5670;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5671;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5672;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5673;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5674;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5675;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5676;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5677;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5678;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_5679;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5680;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5681;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5682;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5683;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5684;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5685;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5686;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5687;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5688;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5689;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5690;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5691;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5692;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5693;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5694;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5695;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5696;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, double, double, empty> type_ffd_5697;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_5698;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5600> AgradDistributionWiener_ffd_5600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5601> AgradDistributionWiener_ffd_5601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5602> AgradDistributionWiener_ffd_5602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5603> AgradDistributionWiener_ffd_5603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5604> AgradDistributionWiener_ffd_5604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5605> AgradDistributionWiener_ffd_5605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5606> AgradDistributionWiener_ffd_5606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5607> AgradDistributionWiener_ffd_5607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5608> AgradDistributionWiener_ffd_5608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5609> AgradDistributionWiener_ffd_5609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5610> AgradDistributionWiener_ffd_5610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5611> AgradDistributionWiener_ffd_5611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5612> AgradDistributionWiener_ffd_5612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5613> AgradDistributionWiener_ffd_5613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5614> AgradDistributionWiener_ffd_5614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5615> AgradDistributionWiener_ffd_5615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5616> AgradDistributionWiener_ffd_5616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5617> AgradDistributionWiener_ffd_5617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5618> AgradDistributionWiener_ffd_5618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5619> AgradDistributionWiener_ffd_5619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5620> AgradDistributionWiener_ffd_5620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5621> AgradDistributionWiener_ffd_5621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5622> AgradDistributionWiener_ffd_5622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5623> AgradDistributionWiener_ffd_5623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5624> AgradDistributionWiener_ffd_5624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5625> AgradDistributionWiener_ffd_5625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5626> AgradDistributionWiener_ffd_5626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5627> AgradDistributionWiener_ffd_5627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5628> AgradDistributionWiener_ffd_5628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5629> AgradDistributionWiener_ffd_5629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5630> AgradDistributionWiener_ffd_5630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5631> AgradDistributionWiener_ffd_5631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5632> AgradDistributionWiener_ffd_5632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5633> AgradDistributionWiener_ffd_5633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5634> AgradDistributionWiener_ffd_5634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5635> AgradDistributionWiener_ffd_5635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5636> AgradDistributionWiener_ffd_5636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5637> AgradDistributionWiener_ffd_5637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5638> AgradDistributionWiener_ffd_5638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5639> AgradDistributionWiener_ffd_5639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5640> AgradDistributionWiener_ffd_5640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5641> AgradDistributionWiener_ffd_5641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5642> AgradDistributionWiener_ffd_5642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5643> AgradDistributionWiener_ffd_5643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5644> AgradDistributionWiener_ffd_5644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5645> AgradDistributionWiener_ffd_5645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5646> AgradDistributionWiener_ffd_5646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5647> AgradDistributionWiener_ffd_5647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5648> AgradDistributionWiener_ffd_5648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5649> AgradDistributionWiener_ffd_5649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5650> AgradDistributionWiener_ffd_5650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5651> AgradDistributionWiener_ffd_5651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5652> AgradDistributionWiener_ffd_5652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5653> AgradDistributionWiener_ffd_5653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5654> AgradDistributionWiener_ffd_5654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5655> AgradDistributionWiener_ffd_5655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5656> AgradDistributionWiener_ffd_5656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5657> AgradDistributionWiener_ffd_5657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5658> AgradDistributionWiener_ffd_5658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5659> AgradDistributionWiener_ffd_5659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5660> AgradDistributionWiener_ffd_5660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5661> AgradDistributionWiener_ffd_5661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5662> AgradDistributionWiener_ffd_5662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5663> AgradDistributionWiener_ffd_5663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5664> AgradDistributionWiener_ffd_5664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5665> AgradDistributionWiener_ffd_5665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5666> AgradDistributionWiener_ffd_5666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5667> AgradDistributionWiener_ffd_5667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5668> AgradDistributionWiener_ffd_5668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5669> AgradDistributionWiener_ffd_5669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5670> AgradDistributionWiener_ffd_5670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5671> AgradDistributionWiener_ffd_5671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5672> AgradDistributionWiener_ffd_5672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5673> AgradDistributionWiener_ffd_5673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5674> AgradDistributionWiener_ffd_5674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5675> AgradDistributionWiener_ffd_5675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5676> AgradDistributionWiener_ffd_5676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5677> AgradDistributionWiener_ffd_5677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5678> AgradDistributionWiener_ffd_5678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5679> AgradDistributionWiener_ffd_5679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5680> AgradDistributionWiener_ffd_5680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5681> AgradDistributionWiener_ffd_5681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5682> AgradDistributionWiener_ffd_5682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5683> AgradDistributionWiener_ffd_5683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5684> AgradDistributionWiener_ffd_5684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5685> AgradDistributionWiener_ffd_5685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5686> AgradDistributionWiener_ffd_5686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5687> AgradDistributionWiener_ffd_5687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5688> AgradDistributionWiener_ffd_5688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5689> AgradDistributionWiener_ffd_5689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5690> AgradDistributionWiener_ffd_5690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5691> AgradDistributionWiener_ffd_5691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5692> AgradDistributionWiener_ffd_5692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5693> AgradDistributionWiener_ffd_5693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5694> AgradDistributionWiener_ffd_5694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5695> AgradDistributionWiener_ffd_5695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5696> AgradDistributionWiener_ffd_5696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5697> AgradDistributionWiener_ffd_5697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5698> AgradDistributionWiener_ffd_5698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5699> AgradDistributionWiener_ffd_5699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5600, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5601, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5602, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5603, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5604, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5605, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5606, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5607, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5608, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5609, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5610, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5611, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5612, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5613, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5614, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5615, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5616, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5617, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5618, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5619, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5620, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5621, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5622, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5623, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5624, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5625, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5626, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5627, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5628, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5629, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5630, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5631, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5632, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5633, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5634, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5635, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5636, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5637, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5638, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5639, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5640, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5641, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5642, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5643, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5644, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5645, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5646, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5647, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5648, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5649, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5650, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5651, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5652, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5653, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5654, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5655, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5656, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5657, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5658, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5659, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5660, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5661, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5662, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5663, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5664, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5665, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5666, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5667, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5668, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5669, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5670, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5671, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5672, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5673, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5674, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5675, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5676, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5677, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5678, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5679, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5680, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5681, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5682, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5683, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5684, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5685, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5686, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5687, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5688, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5689, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5690, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5691, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5692, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5693, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5694, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5695, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5696, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5697, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5698, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5699, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5699);
+
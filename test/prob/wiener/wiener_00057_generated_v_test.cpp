@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5700;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5701;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5702;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5703;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5704;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5705;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_5706;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_5707;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5708;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_5709;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_5710;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5711;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_5712;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_5713;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5714;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_5715;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_5716;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5717;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5718;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5719;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5720;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5721;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5722;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5723;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty> type_v_5724;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_5725;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5726;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty> type_v_5727;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_5728;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5729;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_5730;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_5731;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5732;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_5733;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_5734;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5735;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5736;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5737;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5738;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5739;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5740;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5741;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty> type_v_5742;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty> type_v_5743;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5744;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty> type_v_5745;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_5746;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5747;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_5748;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_5749;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5750;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_5751;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_5752;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5753;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5754;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5755;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5756;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5757;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5758;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5759;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_5760;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_5761;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5762;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_5763;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_5764;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5765;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_5766;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_5767;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5768;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_5769;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_5770;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5771;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5772;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5773;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5774;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5775;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5776;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5777;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_5778;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_5779;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5780;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_5781;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_5782;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5783;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_5784;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_5785;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5786;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_5787;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_5788;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5789;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5790;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5791;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5792;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5793;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5794;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5795;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_5796;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_5797;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5798;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_5799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5700> AgradDistributionWiener_v_5700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5701> AgradDistributionWiener_v_5701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5702> AgradDistributionWiener_v_5702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5703> AgradDistributionWiener_v_5703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5704> AgradDistributionWiener_v_5704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5705> AgradDistributionWiener_v_5705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5706> AgradDistributionWiener_v_5706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5707> AgradDistributionWiener_v_5707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5708> AgradDistributionWiener_v_5708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5709> AgradDistributionWiener_v_5709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5710> AgradDistributionWiener_v_5710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5711> AgradDistributionWiener_v_5711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5712> AgradDistributionWiener_v_5712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5713> AgradDistributionWiener_v_5713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5714> AgradDistributionWiener_v_5714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5715> AgradDistributionWiener_v_5715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5716> AgradDistributionWiener_v_5716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5717> AgradDistributionWiener_v_5717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5718> AgradDistributionWiener_v_5718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5719> AgradDistributionWiener_v_5719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5720> AgradDistributionWiener_v_5720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5721> AgradDistributionWiener_v_5721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5722> AgradDistributionWiener_v_5722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5723> AgradDistributionWiener_v_5723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5724> AgradDistributionWiener_v_5724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5725> AgradDistributionWiener_v_5725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5726> AgradDistributionWiener_v_5726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5727> AgradDistributionWiener_v_5727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5728> AgradDistributionWiener_v_5728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5729> AgradDistributionWiener_v_5729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5730> AgradDistributionWiener_v_5730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5731> AgradDistributionWiener_v_5731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5732> AgradDistributionWiener_v_5732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5733> AgradDistributionWiener_v_5733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5734> AgradDistributionWiener_v_5734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5735> AgradDistributionWiener_v_5735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5736> AgradDistributionWiener_v_5736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5737> AgradDistributionWiener_v_5737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5738> AgradDistributionWiener_v_5738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5739> AgradDistributionWiener_v_5739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5740> AgradDistributionWiener_v_5740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5741> AgradDistributionWiener_v_5741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5742> AgradDistributionWiener_v_5742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5743> AgradDistributionWiener_v_5743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5744> AgradDistributionWiener_v_5744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5745> AgradDistributionWiener_v_5745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5746> AgradDistributionWiener_v_5746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5747> AgradDistributionWiener_v_5747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5748> AgradDistributionWiener_v_5748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5749> AgradDistributionWiener_v_5749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5750> AgradDistributionWiener_v_5750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5751> AgradDistributionWiener_v_5751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5752> AgradDistributionWiener_v_5752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5753> AgradDistributionWiener_v_5753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5754> AgradDistributionWiener_v_5754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5755> AgradDistributionWiener_v_5755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5756> AgradDistributionWiener_v_5756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5757> AgradDistributionWiener_v_5757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5758> AgradDistributionWiener_v_5758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5759> AgradDistributionWiener_v_5759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5760> AgradDistributionWiener_v_5760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5761> AgradDistributionWiener_v_5761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5762> AgradDistributionWiener_v_5762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5763> AgradDistributionWiener_v_5763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5764> AgradDistributionWiener_v_5764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5765> AgradDistributionWiener_v_5765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5766> AgradDistributionWiener_v_5766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5767> AgradDistributionWiener_v_5767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5768> AgradDistributionWiener_v_5768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5769> AgradDistributionWiener_v_5769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5770> AgradDistributionWiener_v_5770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5771> AgradDistributionWiener_v_5771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5772> AgradDistributionWiener_v_5772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5773> AgradDistributionWiener_v_5773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5774> AgradDistributionWiener_v_5774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5775> AgradDistributionWiener_v_5775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5776> AgradDistributionWiener_v_5776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5777> AgradDistributionWiener_v_5777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5778> AgradDistributionWiener_v_5778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5779> AgradDistributionWiener_v_5779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5780> AgradDistributionWiener_v_5780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5781> AgradDistributionWiener_v_5781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5782> AgradDistributionWiener_v_5782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5783> AgradDistributionWiener_v_5783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5784> AgradDistributionWiener_v_5784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5785> AgradDistributionWiener_v_5785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5786> AgradDistributionWiener_v_5786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5787> AgradDistributionWiener_v_5787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5788> AgradDistributionWiener_v_5788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5789> AgradDistributionWiener_v_5789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5790> AgradDistributionWiener_v_5790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5791> AgradDistributionWiener_v_5791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5792> AgradDistributionWiener_v_5792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5793> AgradDistributionWiener_v_5793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5794> AgradDistributionWiener_v_5794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5795> AgradDistributionWiener_v_5795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5796> AgradDistributionWiener_v_5796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5797> AgradDistributionWiener_v_5797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5798> AgradDistributionWiener_v_5798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5799> AgradDistributionWiener_v_5799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5700, AgradDistributionTestFixture, AgradDistributionWiener_v_5700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5701, AgradDistributionTestFixture, AgradDistributionWiener_v_5701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5702, AgradDistributionTestFixture, AgradDistributionWiener_v_5702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5703, AgradDistributionTestFixture, AgradDistributionWiener_v_5703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5704, AgradDistributionTestFixture, AgradDistributionWiener_v_5704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5705, AgradDistributionTestFixture, AgradDistributionWiener_v_5705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5706, AgradDistributionTestFixture, AgradDistributionWiener_v_5706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5707, AgradDistributionTestFixture, AgradDistributionWiener_v_5707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5708, AgradDistributionTestFixture, AgradDistributionWiener_v_5708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5709, AgradDistributionTestFixture, AgradDistributionWiener_v_5709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5710, AgradDistributionTestFixture, AgradDistributionWiener_v_5710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5711, AgradDistributionTestFixture, AgradDistributionWiener_v_5711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5712, AgradDistributionTestFixture, AgradDistributionWiener_v_5712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5713, AgradDistributionTestFixture, AgradDistributionWiener_v_5713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5714, AgradDistributionTestFixture, AgradDistributionWiener_v_5714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5715, AgradDistributionTestFixture, AgradDistributionWiener_v_5715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5716, AgradDistributionTestFixture, AgradDistributionWiener_v_5716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5717, AgradDistributionTestFixture, AgradDistributionWiener_v_5717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5718, AgradDistributionTestFixture, AgradDistributionWiener_v_5718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5719, AgradDistributionTestFixture, AgradDistributionWiener_v_5719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5720, AgradDistributionTestFixture, AgradDistributionWiener_v_5720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5721, AgradDistributionTestFixture, AgradDistributionWiener_v_5721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5722, AgradDistributionTestFixture, AgradDistributionWiener_v_5722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5723, AgradDistributionTestFixture, AgradDistributionWiener_v_5723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5724, AgradDistributionTestFixture, AgradDistributionWiener_v_5724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5725, AgradDistributionTestFixture, AgradDistributionWiener_v_5725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5726, AgradDistributionTestFixture, AgradDistributionWiener_v_5726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5727, AgradDistributionTestFixture, AgradDistributionWiener_v_5727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5728, AgradDistributionTestFixture, AgradDistributionWiener_v_5728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5729, AgradDistributionTestFixture, AgradDistributionWiener_v_5729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5730, AgradDistributionTestFixture, AgradDistributionWiener_v_5730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5731, AgradDistributionTestFixture, AgradDistributionWiener_v_5731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5732, AgradDistributionTestFixture, AgradDistributionWiener_v_5732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5733, AgradDistributionTestFixture, AgradDistributionWiener_v_5733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5734, AgradDistributionTestFixture, AgradDistributionWiener_v_5734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5735, AgradDistributionTestFixture, AgradDistributionWiener_v_5735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5736, AgradDistributionTestFixture, AgradDistributionWiener_v_5736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5737, AgradDistributionTestFixture, AgradDistributionWiener_v_5737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5738, AgradDistributionTestFixture, AgradDistributionWiener_v_5738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5739, AgradDistributionTestFixture, AgradDistributionWiener_v_5739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5740, AgradDistributionTestFixture, AgradDistributionWiener_v_5740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5741, AgradDistributionTestFixture, AgradDistributionWiener_v_5741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5742, AgradDistributionTestFixture, AgradDistributionWiener_v_5742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5743, AgradDistributionTestFixture, AgradDistributionWiener_v_5743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5744, AgradDistributionTestFixture, AgradDistributionWiener_v_5744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5745, AgradDistributionTestFixture, AgradDistributionWiener_v_5745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5746, AgradDistributionTestFixture, AgradDistributionWiener_v_5746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5747, AgradDistributionTestFixture, AgradDistributionWiener_v_5747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5748, AgradDistributionTestFixture, AgradDistributionWiener_v_5748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5749, AgradDistributionTestFixture, AgradDistributionWiener_v_5749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5750, AgradDistributionTestFixture, AgradDistributionWiener_v_5750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5751, AgradDistributionTestFixture, AgradDistributionWiener_v_5751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5752, AgradDistributionTestFixture, AgradDistributionWiener_v_5752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5753, AgradDistributionTestFixture, AgradDistributionWiener_v_5753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5754, AgradDistributionTestFixture, AgradDistributionWiener_v_5754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5755, AgradDistributionTestFixture, AgradDistributionWiener_v_5755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5756, AgradDistributionTestFixture, AgradDistributionWiener_v_5756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5757, AgradDistributionTestFixture, AgradDistributionWiener_v_5757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5758, AgradDistributionTestFixture, AgradDistributionWiener_v_5758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5759, AgradDistributionTestFixture, AgradDistributionWiener_v_5759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5760, AgradDistributionTestFixture, AgradDistributionWiener_v_5760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5761, AgradDistributionTestFixture, AgradDistributionWiener_v_5761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5762, AgradDistributionTestFixture, AgradDistributionWiener_v_5762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5763, AgradDistributionTestFixture, AgradDistributionWiener_v_5763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5764, AgradDistributionTestFixture, AgradDistributionWiener_v_5764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5765, AgradDistributionTestFixture, AgradDistributionWiener_v_5765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5766, AgradDistributionTestFixture, AgradDistributionWiener_v_5766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5767, AgradDistributionTestFixture, AgradDistributionWiener_v_5767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5768, AgradDistributionTestFixture, AgradDistributionWiener_v_5768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5769, AgradDistributionTestFixture, AgradDistributionWiener_v_5769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5770, AgradDistributionTestFixture, AgradDistributionWiener_v_5770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5771, AgradDistributionTestFixture, AgradDistributionWiener_v_5771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5772, AgradDistributionTestFixture, AgradDistributionWiener_v_5772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5773, AgradDistributionTestFixture, AgradDistributionWiener_v_5773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5774, AgradDistributionTestFixture, AgradDistributionWiener_v_5774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5775, AgradDistributionTestFixture, AgradDistributionWiener_v_5775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5776, AgradDistributionTestFixture, AgradDistributionWiener_v_5776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5777, AgradDistributionTestFixture, AgradDistributionWiener_v_5777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5778, AgradDistributionTestFixture, AgradDistributionWiener_v_5778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5779, AgradDistributionTestFixture, AgradDistributionWiener_v_5779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5780, AgradDistributionTestFixture, AgradDistributionWiener_v_5780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5781, AgradDistributionTestFixture, AgradDistributionWiener_v_5781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5782, AgradDistributionTestFixture, AgradDistributionWiener_v_5782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5783, AgradDistributionTestFixture, AgradDistributionWiener_v_5783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5784, AgradDistributionTestFixture, AgradDistributionWiener_v_5784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5785, AgradDistributionTestFixture, AgradDistributionWiener_v_5785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5786, AgradDistributionTestFixture, AgradDistributionWiener_v_5786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5787, AgradDistributionTestFixture, AgradDistributionWiener_v_5787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5788, AgradDistributionTestFixture, AgradDistributionWiener_v_5788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5789, AgradDistributionTestFixture, AgradDistributionWiener_v_5789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5790, AgradDistributionTestFixture, AgradDistributionWiener_v_5790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5791, AgradDistributionTestFixture, AgradDistributionWiener_v_5791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5792, AgradDistributionTestFixture, AgradDistributionWiener_v_5792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5793, AgradDistributionTestFixture, AgradDistributionWiener_v_5793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5794, AgradDistributionTestFixture, AgradDistributionWiener_v_5794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5795, AgradDistributionTestFixture, AgradDistributionWiener_v_5795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5796, AgradDistributionTestFixture, AgradDistributionWiener_v_5796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5797, AgradDistributionTestFixture, AgradDistributionWiener_v_5797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5798, AgradDistributionTestFixture, AgradDistributionWiener_v_5798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5799, AgradDistributionTestFixture, AgradDistributionWiener_v_5799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5800;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5801;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5802;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5803;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5804;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, double, empty> type_ffv_5805;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty> type_ffv_5806;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5807;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty> type_ffv_5808;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5809;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5810;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty> type_ffv_5811;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty> type_ffv_5812;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5813;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5814;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5815;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5816;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5817;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5818;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5819;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5820;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5821;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5822;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty> type_ffv_5823;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5824;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5825;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5826;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5827;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5828;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5829;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5830;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5831;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5832;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5833;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5834;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5835;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5836;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5837;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5838;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5839;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5840;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty> type_ffv_5841;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty> type_ffv_5842;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5843;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_5844;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5845;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5846;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty> type_ffv_5847;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_5848;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5849;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5850;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5851;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5852;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5853;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5854;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5855;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5856;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5857;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5858;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_5859;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5860;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5861;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5862;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5863;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5864;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_5865;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_5866;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5867;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_5868;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5869;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5870;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_5871;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5872;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5873;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5874;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5875;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5876;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_5877;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_5878;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5879;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_5880;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_5881;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5882;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_5883;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_5884;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5885;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_5886;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5887;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5888;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_5889;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_5890;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5891;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_5892;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_5893;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5894;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_5895;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_5896;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_5897;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_5898;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_5899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5800> AgradDistributionWiener_ffv_5800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5801> AgradDistributionWiener_ffv_5801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5802> AgradDistributionWiener_ffv_5802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5803> AgradDistributionWiener_ffv_5803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5804> AgradDistributionWiener_ffv_5804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5805> AgradDistributionWiener_ffv_5805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5806> AgradDistributionWiener_ffv_5806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5807> AgradDistributionWiener_ffv_5807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5808> AgradDistributionWiener_ffv_5808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5809> AgradDistributionWiener_ffv_5809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5810> AgradDistributionWiener_ffv_5810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5811> AgradDistributionWiener_ffv_5811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5812> AgradDistributionWiener_ffv_5812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5813> AgradDistributionWiener_ffv_5813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5814> AgradDistributionWiener_ffv_5814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5815> AgradDistributionWiener_ffv_5815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5816> AgradDistributionWiener_ffv_5816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5817> AgradDistributionWiener_ffv_5817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5818> AgradDistributionWiener_ffv_5818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5819> AgradDistributionWiener_ffv_5819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5820> AgradDistributionWiener_ffv_5820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5821> AgradDistributionWiener_ffv_5821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5822> AgradDistributionWiener_ffv_5822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5823> AgradDistributionWiener_ffv_5823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5824> AgradDistributionWiener_ffv_5824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5825> AgradDistributionWiener_ffv_5825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5826> AgradDistributionWiener_ffv_5826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5827> AgradDistributionWiener_ffv_5827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5828> AgradDistributionWiener_ffv_5828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5829> AgradDistributionWiener_ffv_5829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5830> AgradDistributionWiener_ffv_5830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5831> AgradDistributionWiener_ffv_5831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5832> AgradDistributionWiener_ffv_5832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5833> AgradDistributionWiener_ffv_5833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5834> AgradDistributionWiener_ffv_5834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5835> AgradDistributionWiener_ffv_5835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5836> AgradDistributionWiener_ffv_5836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5837> AgradDistributionWiener_ffv_5837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5838> AgradDistributionWiener_ffv_5838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5839> AgradDistributionWiener_ffv_5839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5840> AgradDistributionWiener_ffv_5840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5841> AgradDistributionWiener_ffv_5841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5842> AgradDistributionWiener_ffv_5842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5843> AgradDistributionWiener_ffv_5843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5844> AgradDistributionWiener_ffv_5844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5845> AgradDistributionWiener_ffv_5845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5846> AgradDistributionWiener_ffv_5846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5847> AgradDistributionWiener_ffv_5847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5848> AgradDistributionWiener_ffv_5848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5849> AgradDistributionWiener_ffv_5849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5850> AgradDistributionWiener_ffv_5850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5851> AgradDistributionWiener_ffv_5851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5852> AgradDistributionWiener_ffv_5852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5853> AgradDistributionWiener_ffv_5853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5854> AgradDistributionWiener_ffv_5854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5855> AgradDistributionWiener_ffv_5855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5856> AgradDistributionWiener_ffv_5856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5857> AgradDistributionWiener_ffv_5857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5858> AgradDistributionWiener_ffv_5858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5859> AgradDistributionWiener_ffv_5859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5860> AgradDistributionWiener_ffv_5860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5861> AgradDistributionWiener_ffv_5861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5862> AgradDistributionWiener_ffv_5862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5863> AgradDistributionWiener_ffv_5863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5864> AgradDistributionWiener_ffv_5864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5865> AgradDistributionWiener_ffv_5865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5866> AgradDistributionWiener_ffv_5866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5867> AgradDistributionWiener_ffv_5867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5868> AgradDistributionWiener_ffv_5868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5869> AgradDistributionWiener_ffv_5869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5870> AgradDistributionWiener_ffv_5870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5871> AgradDistributionWiener_ffv_5871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5872> AgradDistributionWiener_ffv_5872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5873> AgradDistributionWiener_ffv_5873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5874> AgradDistributionWiener_ffv_5874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5875> AgradDistributionWiener_ffv_5875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5876> AgradDistributionWiener_ffv_5876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5877> AgradDistributionWiener_ffv_5877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5878> AgradDistributionWiener_ffv_5878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5879> AgradDistributionWiener_ffv_5879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5880> AgradDistributionWiener_ffv_5880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5881> AgradDistributionWiener_ffv_5881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5882> AgradDistributionWiener_ffv_5882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5883> AgradDistributionWiener_ffv_5883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5884> AgradDistributionWiener_ffv_5884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5885> AgradDistributionWiener_ffv_5885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5886> AgradDistributionWiener_ffv_5886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5887> AgradDistributionWiener_ffv_5887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5888> AgradDistributionWiener_ffv_5888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5889> AgradDistributionWiener_ffv_5889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5890> AgradDistributionWiener_ffv_5890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5891> AgradDistributionWiener_ffv_5891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5892> AgradDistributionWiener_ffv_5892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5893> AgradDistributionWiener_ffv_5893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5894> AgradDistributionWiener_ffv_5894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5895> AgradDistributionWiener_ffv_5895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5896> AgradDistributionWiener_ffv_5896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5897> AgradDistributionWiener_ffv_5897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5898> AgradDistributionWiener_ffv_5898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_5899> AgradDistributionWiener_ffv_5899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5800, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5801, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5802, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5803, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5804, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5805, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5806, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5807, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5808, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5809, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5810, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5811, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5812, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5813, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5814, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5815, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5816, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5817, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5818, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5819, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5820, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5821, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5822, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5823, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5824, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5825, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5826, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5827, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5828, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5829, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5830, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5831, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5832, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5833, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5834, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5835, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5836, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5837, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5838, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5839, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5840, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5841, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5842, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5843, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5844, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5845, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5846, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5847, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5848, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5849, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5850, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5851, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5852, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5853, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5854, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5855, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5856, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5857, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5858, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5859, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5860, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5861, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5862, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5863, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5864, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5865, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5866, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5867, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5868, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5869, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5870, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5871, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5872, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5873, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5874, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5875, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5876, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5877, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5878, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5879, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5880, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5881, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5882, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5883, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5884, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5885, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5886, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5887, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5888, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5889, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5890, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5891, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5892, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5893, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5894, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5895, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5896, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5897, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5898, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_5899, AgradDistributionTestFixture, AgradDistributionWiener_ffv_5899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_5800;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5801;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_5802;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_5803;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5804;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_5805;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_5806;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5807;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5808;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5809;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5810;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5811;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5812;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5813;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_5814;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_5815;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5816;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_5817;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_5818;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5819;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_5820;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_5821;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5822;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_5823;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_5824;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5825;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5826;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5827;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5828;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5829;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5830;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5831;
+typedef boost::mpl::vector<std::vector<var>, var, double, double, double, empty> type_v_5832;
+typedef boost::mpl::vector<std::vector<var>, var, double, double, std::vector<double>, empty> type_v_5833;
+typedef boost::mpl::vector<std::vector<var>, var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5834;
+typedef boost::mpl::vector<std::vector<var>, var, double, double, var, empty> type_v_5835;
+typedef boost::mpl::vector<std::vector<var>, var, double, double, std::vector<var>, empty> type_v_5836;
+typedef boost::mpl::vector<std::vector<var>, var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5837;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<double>, double, empty> type_v_5838;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<double>, std::vector<double>, empty> type_v_5839;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5840;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<double>, var, empty> type_v_5841;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<double>, std::vector<var>, empty> type_v_5842;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5843;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5844;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5845;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5846;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5847;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5848;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5849;
+typedef boost::mpl::vector<std::vector<var>, var, double, var, double, empty> type_v_5850;
+typedef boost::mpl::vector<std::vector<var>, var, double, var, std::vector<double>, empty> type_v_5851;
+typedef boost::mpl::vector<std::vector<var>, var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5852;
+typedef boost::mpl::vector<std::vector<var>, var, double, var, var, empty> type_v_5853;
+typedef boost::mpl::vector<std::vector<var>, var, double, var, std::vector<var>, empty> type_v_5854;
+typedef boost::mpl::vector<std::vector<var>, var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5855;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<var>, double, empty> type_v_5856;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<var>, std::vector<double>, empty> type_v_5857;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5858;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<var>, var, empty> type_v_5859;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<var>, std::vector<var>, empty> type_v_5860;
+typedef boost::mpl::vector<std::vector<var>, var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5861;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5862;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5863;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5864;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_5865;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5866;
+typedef boost::mpl::vector<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5867;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, double, double, empty> type_v_5868;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, double, std::vector<double>, empty> type_v_5869;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5870;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, double, var, empty> type_v_5871;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, double, std::vector<var>, empty> type_v_5872;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5873;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<double>, double, empty> type_v_5874;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_5875;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5876;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<double>, var, empty> type_v_5877;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_5878;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5879;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_5880;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5881;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5882;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_5883;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_5884;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5885;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, var, double, empty> type_v_5886;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, var, std::vector<double>, empty> type_v_5887;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5888;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, var, var, empty> type_v_5889;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, var, std::vector<var>, empty> type_v_5890;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5891;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<var>, double, empty> type_v_5892;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_5893;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_5894;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<var>, var, empty> type_v_5895;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_5896;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5897;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_5898;
+typedef boost::mpl::vector<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_5899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5800> AgradDistributionWiener_v_5800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5801> AgradDistributionWiener_v_5801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5802> AgradDistributionWiener_v_5802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5803> AgradDistributionWiener_v_5803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5804> AgradDistributionWiener_v_5804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5805> AgradDistributionWiener_v_5805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5806> AgradDistributionWiener_v_5806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5807> AgradDistributionWiener_v_5807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5808> AgradDistributionWiener_v_5808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5809> AgradDistributionWiener_v_5809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5810> AgradDistributionWiener_v_5810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5811> AgradDistributionWiener_v_5811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5812> AgradDistributionWiener_v_5812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5813> AgradDistributionWiener_v_5813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5814> AgradDistributionWiener_v_5814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5815> AgradDistributionWiener_v_5815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5816> AgradDistributionWiener_v_5816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5817> AgradDistributionWiener_v_5817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5818> AgradDistributionWiener_v_5818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5819> AgradDistributionWiener_v_5819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5820> AgradDistributionWiener_v_5820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5821> AgradDistributionWiener_v_5821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5822> AgradDistributionWiener_v_5822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5823> AgradDistributionWiener_v_5823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5824> AgradDistributionWiener_v_5824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5825> AgradDistributionWiener_v_5825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5826> AgradDistributionWiener_v_5826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5827> AgradDistributionWiener_v_5827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5828> AgradDistributionWiener_v_5828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5829> AgradDistributionWiener_v_5829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5830> AgradDistributionWiener_v_5830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5831> AgradDistributionWiener_v_5831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5832> AgradDistributionWiener_v_5832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5833> AgradDistributionWiener_v_5833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5834> AgradDistributionWiener_v_5834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5835> AgradDistributionWiener_v_5835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5836> AgradDistributionWiener_v_5836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5837> AgradDistributionWiener_v_5837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5838> AgradDistributionWiener_v_5838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5839> AgradDistributionWiener_v_5839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5840> AgradDistributionWiener_v_5840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5841> AgradDistributionWiener_v_5841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5842> AgradDistributionWiener_v_5842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5843> AgradDistributionWiener_v_5843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5844> AgradDistributionWiener_v_5844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5845> AgradDistributionWiener_v_5845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5846> AgradDistributionWiener_v_5846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5847> AgradDistributionWiener_v_5847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5848> AgradDistributionWiener_v_5848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5849> AgradDistributionWiener_v_5849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5850> AgradDistributionWiener_v_5850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5851> AgradDistributionWiener_v_5851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5852> AgradDistributionWiener_v_5852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5853> AgradDistributionWiener_v_5853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5854> AgradDistributionWiener_v_5854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5855> AgradDistributionWiener_v_5855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5856> AgradDistributionWiener_v_5856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5857> AgradDistributionWiener_v_5857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5858> AgradDistributionWiener_v_5858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5859> AgradDistributionWiener_v_5859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5860> AgradDistributionWiener_v_5860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5861> AgradDistributionWiener_v_5861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5862> AgradDistributionWiener_v_5862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5863> AgradDistributionWiener_v_5863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5864> AgradDistributionWiener_v_5864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5865> AgradDistributionWiener_v_5865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5866> AgradDistributionWiener_v_5866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5867> AgradDistributionWiener_v_5867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5868> AgradDistributionWiener_v_5868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5869> AgradDistributionWiener_v_5869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5870> AgradDistributionWiener_v_5870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5871> AgradDistributionWiener_v_5871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5872> AgradDistributionWiener_v_5872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5873> AgradDistributionWiener_v_5873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5874> AgradDistributionWiener_v_5874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5875> AgradDistributionWiener_v_5875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5876> AgradDistributionWiener_v_5876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5877> AgradDistributionWiener_v_5877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5878> AgradDistributionWiener_v_5878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5879> AgradDistributionWiener_v_5879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5880> AgradDistributionWiener_v_5880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5881> AgradDistributionWiener_v_5881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5882> AgradDistributionWiener_v_5882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5883> AgradDistributionWiener_v_5883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5884> AgradDistributionWiener_v_5884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5885> AgradDistributionWiener_v_5885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5886> AgradDistributionWiener_v_5886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5887> AgradDistributionWiener_v_5887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5888> AgradDistributionWiener_v_5888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5889> AgradDistributionWiener_v_5889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5890> AgradDistributionWiener_v_5890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5891> AgradDistributionWiener_v_5891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5892> AgradDistributionWiener_v_5892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5893> AgradDistributionWiener_v_5893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5894> AgradDistributionWiener_v_5894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5895> AgradDistributionWiener_v_5895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5896> AgradDistributionWiener_v_5896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5897> AgradDistributionWiener_v_5897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5898> AgradDistributionWiener_v_5898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_5899> AgradDistributionWiener_v_5899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5800, AgradDistributionTestFixture, AgradDistributionWiener_v_5800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5801, AgradDistributionTestFixture, AgradDistributionWiener_v_5801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5802, AgradDistributionTestFixture, AgradDistributionWiener_v_5802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5803, AgradDistributionTestFixture, AgradDistributionWiener_v_5803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5804, AgradDistributionTestFixture, AgradDistributionWiener_v_5804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5805, AgradDistributionTestFixture, AgradDistributionWiener_v_5805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5806, AgradDistributionTestFixture, AgradDistributionWiener_v_5806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5807, AgradDistributionTestFixture, AgradDistributionWiener_v_5807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5808, AgradDistributionTestFixture, AgradDistributionWiener_v_5808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5809, AgradDistributionTestFixture, AgradDistributionWiener_v_5809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5810, AgradDistributionTestFixture, AgradDistributionWiener_v_5810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5811, AgradDistributionTestFixture, AgradDistributionWiener_v_5811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5812, AgradDistributionTestFixture, AgradDistributionWiener_v_5812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5813, AgradDistributionTestFixture, AgradDistributionWiener_v_5813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5814, AgradDistributionTestFixture, AgradDistributionWiener_v_5814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5815, AgradDistributionTestFixture, AgradDistributionWiener_v_5815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5816, AgradDistributionTestFixture, AgradDistributionWiener_v_5816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5817, AgradDistributionTestFixture, AgradDistributionWiener_v_5817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5818, AgradDistributionTestFixture, AgradDistributionWiener_v_5818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5819, AgradDistributionTestFixture, AgradDistributionWiener_v_5819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5820, AgradDistributionTestFixture, AgradDistributionWiener_v_5820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5821, AgradDistributionTestFixture, AgradDistributionWiener_v_5821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5822, AgradDistributionTestFixture, AgradDistributionWiener_v_5822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5823, AgradDistributionTestFixture, AgradDistributionWiener_v_5823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5824, AgradDistributionTestFixture, AgradDistributionWiener_v_5824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5825, AgradDistributionTestFixture, AgradDistributionWiener_v_5825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5826, AgradDistributionTestFixture, AgradDistributionWiener_v_5826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5827, AgradDistributionTestFixture, AgradDistributionWiener_v_5827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5828, AgradDistributionTestFixture, AgradDistributionWiener_v_5828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5829, AgradDistributionTestFixture, AgradDistributionWiener_v_5829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5830, AgradDistributionTestFixture, AgradDistributionWiener_v_5830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5831, AgradDistributionTestFixture, AgradDistributionWiener_v_5831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5832, AgradDistributionTestFixture, AgradDistributionWiener_v_5832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5833, AgradDistributionTestFixture, AgradDistributionWiener_v_5833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5834, AgradDistributionTestFixture, AgradDistributionWiener_v_5834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5835, AgradDistributionTestFixture, AgradDistributionWiener_v_5835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5836, AgradDistributionTestFixture, AgradDistributionWiener_v_5836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5837, AgradDistributionTestFixture, AgradDistributionWiener_v_5837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5838, AgradDistributionTestFixture, AgradDistributionWiener_v_5838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5839, AgradDistributionTestFixture, AgradDistributionWiener_v_5839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5840, AgradDistributionTestFixture, AgradDistributionWiener_v_5840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5841, AgradDistributionTestFixture, AgradDistributionWiener_v_5841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5842, AgradDistributionTestFixture, AgradDistributionWiener_v_5842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5843, AgradDistributionTestFixture, AgradDistributionWiener_v_5843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5844, AgradDistributionTestFixture, AgradDistributionWiener_v_5844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5845, AgradDistributionTestFixture, AgradDistributionWiener_v_5845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5846, AgradDistributionTestFixture, AgradDistributionWiener_v_5846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5847, AgradDistributionTestFixture, AgradDistributionWiener_v_5847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5848, AgradDistributionTestFixture, AgradDistributionWiener_v_5848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5849, AgradDistributionTestFixture, AgradDistributionWiener_v_5849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5850, AgradDistributionTestFixture, AgradDistributionWiener_v_5850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5851, AgradDistributionTestFixture, AgradDistributionWiener_v_5851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5852, AgradDistributionTestFixture, AgradDistributionWiener_v_5852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5853, AgradDistributionTestFixture, AgradDistributionWiener_v_5853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5854, AgradDistributionTestFixture, AgradDistributionWiener_v_5854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5855, AgradDistributionTestFixture, AgradDistributionWiener_v_5855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5856, AgradDistributionTestFixture, AgradDistributionWiener_v_5856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5857, AgradDistributionTestFixture, AgradDistributionWiener_v_5857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5858, AgradDistributionTestFixture, AgradDistributionWiener_v_5858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5859, AgradDistributionTestFixture, AgradDistributionWiener_v_5859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5860, AgradDistributionTestFixture, AgradDistributionWiener_v_5860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5861, AgradDistributionTestFixture, AgradDistributionWiener_v_5861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5862, AgradDistributionTestFixture, AgradDistributionWiener_v_5862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5863, AgradDistributionTestFixture, AgradDistributionWiener_v_5863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5864, AgradDistributionTestFixture, AgradDistributionWiener_v_5864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5865, AgradDistributionTestFixture, AgradDistributionWiener_v_5865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5866, AgradDistributionTestFixture, AgradDistributionWiener_v_5866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5867, AgradDistributionTestFixture, AgradDistributionWiener_v_5867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5868, AgradDistributionTestFixture, AgradDistributionWiener_v_5868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5869, AgradDistributionTestFixture, AgradDistributionWiener_v_5869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5870, AgradDistributionTestFixture, AgradDistributionWiener_v_5870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5871, AgradDistributionTestFixture, AgradDistributionWiener_v_5871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5872, AgradDistributionTestFixture, AgradDistributionWiener_v_5872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5873, AgradDistributionTestFixture, AgradDistributionWiener_v_5873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5874, AgradDistributionTestFixture, AgradDistributionWiener_v_5874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5875, AgradDistributionTestFixture, AgradDistributionWiener_v_5875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5876, AgradDistributionTestFixture, AgradDistributionWiener_v_5876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5877, AgradDistributionTestFixture, AgradDistributionWiener_v_5877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5878, AgradDistributionTestFixture, AgradDistributionWiener_v_5878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5879, AgradDistributionTestFixture, AgradDistributionWiener_v_5879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5880, AgradDistributionTestFixture, AgradDistributionWiener_v_5880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5881, AgradDistributionTestFixture, AgradDistributionWiener_v_5881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5882, AgradDistributionTestFixture, AgradDistributionWiener_v_5882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5883, AgradDistributionTestFixture, AgradDistributionWiener_v_5883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5884, AgradDistributionTestFixture, AgradDistributionWiener_v_5884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5885, AgradDistributionTestFixture, AgradDistributionWiener_v_5885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5886, AgradDistributionTestFixture, AgradDistributionWiener_v_5886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5887, AgradDistributionTestFixture, AgradDistributionWiener_v_5887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5888, AgradDistributionTestFixture, AgradDistributionWiener_v_5888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5889, AgradDistributionTestFixture, AgradDistributionWiener_v_5889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5890, AgradDistributionTestFixture, AgradDistributionWiener_v_5890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5891, AgradDistributionTestFixture, AgradDistributionWiener_v_5891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5892, AgradDistributionTestFixture, AgradDistributionWiener_v_5892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5893, AgradDistributionTestFixture, AgradDistributionWiener_v_5893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5894, AgradDistributionTestFixture, AgradDistributionWiener_v_5894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5895, AgradDistributionTestFixture, AgradDistributionWiener_v_5895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5896, AgradDistributionTestFixture, AgradDistributionWiener_v_5896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5897, AgradDistributionTestFixture, AgradDistributionWiener_v_5897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5898, AgradDistributionTestFixture, AgradDistributionWiener_v_5898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_5899, AgradDistributionTestFixture, AgradDistributionWiener_v_5899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5900;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_5901;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5902;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5903;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5904;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5905;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5906;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5907;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5908;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5909;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5910;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5911;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5912;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, double, empty> type_fd_5913;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, std::vector<double>, empty> type_fd_5914;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5915;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, fvar<double>, empty> type_fd_5916;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_5917;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5918;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, double, empty> type_fd_5919;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_5920;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5921;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_5922;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5923;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5924;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5925;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5926;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5927;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5928;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5929;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5930;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, double, empty> type_fd_5931;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_5932;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5933;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_5934;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5935;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5936;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_5937;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5938;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5939;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5940;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5941;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5942;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5943;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5944;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5945;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5946;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5947;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5948;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, double, empty> type_fd_5949;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_5950;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5951;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_5952;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_5953;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5954;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_5955;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_5956;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5957;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_5958;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5959;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5960;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5961;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5962;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5963;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5964;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5965;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5966;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_5967;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_5968;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5969;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_5970;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_5971;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5972;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_5973;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_5974;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5975;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_5976;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_5977;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5978;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_5979;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5980;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5981;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_5982;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_5983;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5984;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_5985;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_5986;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5987;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_5988;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_5989;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5990;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_5991;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_5992;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5993;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_5994;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_5995;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_5996;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_5997;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_5998;
+typedef boost::mpl::vector<std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_5999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5900> AgradDistributionWiener_fd_5900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5901> AgradDistributionWiener_fd_5901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5902> AgradDistributionWiener_fd_5902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5903> AgradDistributionWiener_fd_5903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5904> AgradDistributionWiener_fd_5904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5905> AgradDistributionWiener_fd_5905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5906> AgradDistributionWiener_fd_5906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5907> AgradDistributionWiener_fd_5907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5908> AgradDistributionWiener_fd_5908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5909> AgradDistributionWiener_fd_5909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5910> AgradDistributionWiener_fd_5910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5911> AgradDistributionWiener_fd_5911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5912> AgradDistributionWiener_fd_5912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5913> AgradDistributionWiener_fd_5913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5914> AgradDistributionWiener_fd_5914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5915> AgradDistributionWiener_fd_5915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5916> AgradDistributionWiener_fd_5916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5917> AgradDistributionWiener_fd_5917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5918> AgradDistributionWiener_fd_5918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5919> AgradDistributionWiener_fd_5919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5920> AgradDistributionWiener_fd_5920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5921> AgradDistributionWiener_fd_5921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5922> AgradDistributionWiener_fd_5922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5923> AgradDistributionWiener_fd_5923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5924> AgradDistributionWiener_fd_5924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5925> AgradDistributionWiener_fd_5925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5926> AgradDistributionWiener_fd_5926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5927> AgradDistributionWiener_fd_5927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5928> AgradDistributionWiener_fd_5928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5929> AgradDistributionWiener_fd_5929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5930> AgradDistributionWiener_fd_5930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5931> AgradDistributionWiener_fd_5931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5932> AgradDistributionWiener_fd_5932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5933> AgradDistributionWiener_fd_5933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5934> AgradDistributionWiener_fd_5934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5935> AgradDistributionWiener_fd_5935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5936> AgradDistributionWiener_fd_5936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5937> AgradDistributionWiener_fd_5937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5938> AgradDistributionWiener_fd_5938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5939> AgradDistributionWiener_fd_5939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5940> AgradDistributionWiener_fd_5940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5941> AgradDistributionWiener_fd_5941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5942> AgradDistributionWiener_fd_5942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5943> AgradDistributionWiener_fd_5943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5944> AgradDistributionWiener_fd_5944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5945> AgradDistributionWiener_fd_5945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5946> AgradDistributionWiener_fd_5946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5947> AgradDistributionWiener_fd_5947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5948> AgradDistributionWiener_fd_5948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5949> AgradDistributionWiener_fd_5949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5950> AgradDistributionWiener_fd_5950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5951> AgradDistributionWiener_fd_5951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5952> AgradDistributionWiener_fd_5952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5953> AgradDistributionWiener_fd_5953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5954> AgradDistributionWiener_fd_5954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5955> AgradDistributionWiener_fd_5955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5956> AgradDistributionWiener_fd_5956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5957> AgradDistributionWiener_fd_5957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5958> AgradDistributionWiener_fd_5958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5959> AgradDistributionWiener_fd_5959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5960> AgradDistributionWiener_fd_5960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5961> AgradDistributionWiener_fd_5961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5962> AgradDistributionWiener_fd_5962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5963> AgradDistributionWiener_fd_5963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5964> AgradDistributionWiener_fd_5964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5965> AgradDistributionWiener_fd_5965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5966> AgradDistributionWiener_fd_5966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5967> AgradDistributionWiener_fd_5967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5968> AgradDistributionWiener_fd_5968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5969> AgradDistributionWiener_fd_5969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5970> AgradDistributionWiener_fd_5970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5971> AgradDistributionWiener_fd_5971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5972> AgradDistributionWiener_fd_5972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5973> AgradDistributionWiener_fd_5973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5974> AgradDistributionWiener_fd_5974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5975> AgradDistributionWiener_fd_5975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5976> AgradDistributionWiener_fd_5976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5977> AgradDistributionWiener_fd_5977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5978> AgradDistributionWiener_fd_5978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5979> AgradDistributionWiener_fd_5979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5980> AgradDistributionWiener_fd_5980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5981> AgradDistributionWiener_fd_5981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5982> AgradDistributionWiener_fd_5982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5983> AgradDistributionWiener_fd_5983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5984> AgradDistributionWiener_fd_5984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5985> AgradDistributionWiener_fd_5985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5986> AgradDistributionWiener_fd_5986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5987> AgradDistributionWiener_fd_5987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5988> AgradDistributionWiener_fd_5988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5989> AgradDistributionWiener_fd_5989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5990> AgradDistributionWiener_fd_5990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5991> AgradDistributionWiener_fd_5991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5992> AgradDistributionWiener_fd_5992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5993> AgradDistributionWiener_fd_5993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5994> AgradDistributionWiener_fd_5994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5995> AgradDistributionWiener_fd_5995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5996> AgradDistributionWiener_fd_5996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5997> AgradDistributionWiener_fd_5997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5998> AgradDistributionWiener_fd_5998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_5999> AgradDistributionWiener_fd_5999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5900, AgradDistributionTestFixture, AgradDistributionWiener_fd_5900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5901, AgradDistributionTestFixture, AgradDistributionWiener_fd_5901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5902, AgradDistributionTestFixture, AgradDistributionWiener_fd_5902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5903, AgradDistributionTestFixture, AgradDistributionWiener_fd_5903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5904, AgradDistributionTestFixture, AgradDistributionWiener_fd_5904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5905, AgradDistributionTestFixture, AgradDistributionWiener_fd_5905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5906, AgradDistributionTestFixture, AgradDistributionWiener_fd_5906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5907, AgradDistributionTestFixture, AgradDistributionWiener_fd_5907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5908, AgradDistributionTestFixture, AgradDistributionWiener_fd_5908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5909, AgradDistributionTestFixture, AgradDistributionWiener_fd_5909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5910, AgradDistributionTestFixture, AgradDistributionWiener_fd_5910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5911, AgradDistributionTestFixture, AgradDistributionWiener_fd_5911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5912, AgradDistributionTestFixture, AgradDistributionWiener_fd_5912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5913, AgradDistributionTestFixture, AgradDistributionWiener_fd_5913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5914, AgradDistributionTestFixture, AgradDistributionWiener_fd_5914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5915, AgradDistributionTestFixture, AgradDistributionWiener_fd_5915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5916, AgradDistributionTestFixture, AgradDistributionWiener_fd_5916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5917, AgradDistributionTestFixture, AgradDistributionWiener_fd_5917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5918, AgradDistributionTestFixture, AgradDistributionWiener_fd_5918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5919, AgradDistributionTestFixture, AgradDistributionWiener_fd_5919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5920, AgradDistributionTestFixture, AgradDistributionWiener_fd_5920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5921, AgradDistributionTestFixture, AgradDistributionWiener_fd_5921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5922, AgradDistributionTestFixture, AgradDistributionWiener_fd_5922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5923, AgradDistributionTestFixture, AgradDistributionWiener_fd_5923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5924, AgradDistributionTestFixture, AgradDistributionWiener_fd_5924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5925, AgradDistributionTestFixture, AgradDistributionWiener_fd_5925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5926, AgradDistributionTestFixture, AgradDistributionWiener_fd_5926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5927, AgradDistributionTestFixture, AgradDistributionWiener_fd_5927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5928, AgradDistributionTestFixture, AgradDistributionWiener_fd_5928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5929, AgradDistributionTestFixture, AgradDistributionWiener_fd_5929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5930, AgradDistributionTestFixture, AgradDistributionWiener_fd_5930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5931, AgradDistributionTestFixture, AgradDistributionWiener_fd_5931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5932, AgradDistributionTestFixture, AgradDistributionWiener_fd_5932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5933, AgradDistributionTestFixture, AgradDistributionWiener_fd_5933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5934, AgradDistributionTestFixture, AgradDistributionWiener_fd_5934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5935, AgradDistributionTestFixture, AgradDistributionWiener_fd_5935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5936, AgradDistributionTestFixture, AgradDistributionWiener_fd_5936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5937, AgradDistributionTestFixture, AgradDistributionWiener_fd_5937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5938, AgradDistributionTestFixture, AgradDistributionWiener_fd_5938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5939, AgradDistributionTestFixture, AgradDistributionWiener_fd_5939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5940, AgradDistributionTestFixture, AgradDistributionWiener_fd_5940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5941, AgradDistributionTestFixture, AgradDistributionWiener_fd_5941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5942, AgradDistributionTestFixture, AgradDistributionWiener_fd_5942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5943, AgradDistributionTestFixture, AgradDistributionWiener_fd_5943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5944, AgradDistributionTestFixture, AgradDistributionWiener_fd_5944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5945, AgradDistributionTestFixture, AgradDistributionWiener_fd_5945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5946, AgradDistributionTestFixture, AgradDistributionWiener_fd_5946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5947, AgradDistributionTestFixture, AgradDistributionWiener_fd_5947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5948, AgradDistributionTestFixture, AgradDistributionWiener_fd_5948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5949, AgradDistributionTestFixture, AgradDistributionWiener_fd_5949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5950, AgradDistributionTestFixture, AgradDistributionWiener_fd_5950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5951, AgradDistributionTestFixture, AgradDistributionWiener_fd_5951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5952, AgradDistributionTestFixture, AgradDistributionWiener_fd_5952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5953, AgradDistributionTestFixture, AgradDistributionWiener_fd_5953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5954, AgradDistributionTestFixture, AgradDistributionWiener_fd_5954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5955, AgradDistributionTestFixture, AgradDistributionWiener_fd_5955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5956, AgradDistributionTestFixture, AgradDistributionWiener_fd_5956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5957, AgradDistributionTestFixture, AgradDistributionWiener_fd_5957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5958, AgradDistributionTestFixture, AgradDistributionWiener_fd_5958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5959, AgradDistributionTestFixture, AgradDistributionWiener_fd_5959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5960, AgradDistributionTestFixture, AgradDistributionWiener_fd_5960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5961, AgradDistributionTestFixture, AgradDistributionWiener_fd_5961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5962, AgradDistributionTestFixture, AgradDistributionWiener_fd_5962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5963, AgradDistributionTestFixture, AgradDistributionWiener_fd_5963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5964, AgradDistributionTestFixture, AgradDistributionWiener_fd_5964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5965, AgradDistributionTestFixture, AgradDistributionWiener_fd_5965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5966, AgradDistributionTestFixture, AgradDistributionWiener_fd_5966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5967, AgradDistributionTestFixture, AgradDistributionWiener_fd_5967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5968, AgradDistributionTestFixture, AgradDistributionWiener_fd_5968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5969, AgradDistributionTestFixture, AgradDistributionWiener_fd_5969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5970, AgradDistributionTestFixture, AgradDistributionWiener_fd_5970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5971, AgradDistributionTestFixture, AgradDistributionWiener_fd_5971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5972, AgradDistributionTestFixture, AgradDistributionWiener_fd_5972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5973, AgradDistributionTestFixture, AgradDistributionWiener_fd_5973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5974, AgradDistributionTestFixture, AgradDistributionWiener_fd_5974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5975, AgradDistributionTestFixture, AgradDistributionWiener_fd_5975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5976, AgradDistributionTestFixture, AgradDistributionWiener_fd_5976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5977, AgradDistributionTestFixture, AgradDistributionWiener_fd_5977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5978, AgradDistributionTestFixture, AgradDistributionWiener_fd_5978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5979, AgradDistributionTestFixture, AgradDistributionWiener_fd_5979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5980, AgradDistributionTestFixture, AgradDistributionWiener_fd_5980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5981, AgradDistributionTestFixture, AgradDistributionWiener_fd_5981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5982, AgradDistributionTestFixture, AgradDistributionWiener_fd_5982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5983, AgradDistributionTestFixture, AgradDistributionWiener_fd_5983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5984, AgradDistributionTestFixture, AgradDistributionWiener_fd_5984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5985, AgradDistributionTestFixture, AgradDistributionWiener_fd_5985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5986, AgradDistributionTestFixture, AgradDistributionWiener_fd_5986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5987, AgradDistributionTestFixture, AgradDistributionWiener_fd_5987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5988, AgradDistributionTestFixture, AgradDistributionWiener_fd_5988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5989, AgradDistributionTestFixture, AgradDistributionWiener_fd_5989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5990, AgradDistributionTestFixture, AgradDistributionWiener_fd_5990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5991, AgradDistributionTestFixture, AgradDistributionWiener_fd_5991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5992, AgradDistributionTestFixture, AgradDistributionWiener_fd_5992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5993, AgradDistributionTestFixture, AgradDistributionWiener_fd_5993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5994, AgradDistributionTestFixture, AgradDistributionWiener_fd_5994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5995, AgradDistributionTestFixture, AgradDistributionWiener_fd_5995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5996, AgradDistributionTestFixture, AgradDistributionWiener_fd_5996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5997, AgradDistributionTestFixture, AgradDistributionWiener_fd_5997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5998, AgradDistributionTestFixture, AgradDistributionWiener_fd_5998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_5999, AgradDistributionTestFixture, AgradDistributionWiener_fd_5999);
+
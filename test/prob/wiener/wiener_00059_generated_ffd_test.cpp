@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5900;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5901;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5902;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5903;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5904;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5905;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5906;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5907;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5908;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5909;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5910;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5911;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5912;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, double, empty> type_ffd_5913;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<double>, empty> type_ffd_5914;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5915;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, fvar<fvar<double> >, empty> type_ffd_5916;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5917;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5918;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, double, empty> type_ffd_5919;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_5920;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5921;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5922;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5923;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5924;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5925;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5926;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5927;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5928;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5929;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5930;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_5931;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5932;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5933;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5934;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5935;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5936;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5937;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5938;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5939;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5940;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5941;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5942;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5943;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5944;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5945;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5946;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5947;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5948;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_5949;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_5950;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5951;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_5952;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5953;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5954;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_5955;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_5956;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5957;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5958;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5959;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5960;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5961;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5962;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5963;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5964;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5965;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5966;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_5967;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_5968;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5969;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_5970;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_5971;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5972;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_5973;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_5974;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5975;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_5976;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5977;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5978;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_5979;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5980;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5981;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_5982;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5983;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5984;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_5985;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_5986;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5987;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_5988;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_5989;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5990;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_5991;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_5992;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5993;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_5994;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_5995;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_5996;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_5997;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_5998;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_5999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5900> AgradDistributionWiener_ffd_5900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5901> AgradDistributionWiener_ffd_5901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5902> AgradDistributionWiener_ffd_5902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5903> AgradDistributionWiener_ffd_5903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5904> AgradDistributionWiener_ffd_5904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5905> AgradDistributionWiener_ffd_5905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5906> AgradDistributionWiener_ffd_5906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5907> AgradDistributionWiener_ffd_5907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5908> AgradDistributionWiener_ffd_5908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5909> AgradDistributionWiener_ffd_5909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5910> AgradDistributionWiener_ffd_5910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5911> AgradDistributionWiener_ffd_5911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5912> AgradDistributionWiener_ffd_5912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5913> AgradDistributionWiener_ffd_5913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5914> AgradDistributionWiener_ffd_5914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5915> AgradDistributionWiener_ffd_5915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5916> AgradDistributionWiener_ffd_5916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5917> AgradDistributionWiener_ffd_5917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5918> AgradDistributionWiener_ffd_5918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5919> AgradDistributionWiener_ffd_5919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5920> AgradDistributionWiener_ffd_5920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5921> AgradDistributionWiener_ffd_5921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5922> AgradDistributionWiener_ffd_5922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5923> AgradDistributionWiener_ffd_5923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5924> AgradDistributionWiener_ffd_5924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5925> AgradDistributionWiener_ffd_5925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5926> AgradDistributionWiener_ffd_5926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5927> AgradDistributionWiener_ffd_5927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5928> AgradDistributionWiener_ffd_5928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5929> AgradDistributionWiener_ffd_5929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5930> AgradDistributionWiener_ffd_5930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5931> AgradDistributionWiener_ffd_5931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5932> AgradDistributionWiener_ffd_5932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5933> AgradDistributionWiener_ffd_5933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5934> AgradDistributionWiener_ffd_5934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5935> AgradDistributionWiener_ffd_5935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5936> AgradDistributionWiener_ffd_5936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5937> AgradDistributionWiener_ffd_5937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5938> AgradDistributionWiener_ffd_5938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5939> AgradDistributionWiener_ffd_5939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5940> AgradDistributionWiener_ffd_5940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5941> AgradDistributionWiener_ffd_5941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5942> AgradDistributionWiener_ffd_5942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5943> AgradDistributionWiener_ffd_5943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5944> AgradDistributionWiener_ffd_5944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5945> AgradDistributionWiener_ffd_5945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5946> AgradDistributionWiener_ffd_5946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5947> AgradDistributionWiener_ffd_5947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5948> AgradDistributionWiener_ffd_5948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5949> AgradDistributionWiener_ffd_5949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5950> AgradDistributionWiener_ffd_5950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5951> AgradDistributionWiener_ffd_5951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5952> AgradDistributionWiener_ffd_5952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5953> AgradDistributionWiener_ffd_5953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5954> AgradDistributionWiener_ffd_5954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5955> AgradDistributionWiener_ffd_5955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5956> AgradDistributionWiener_ffd_5956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5957> AgradDistributionWiener_ffd_5957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5958> AgradDistributionWiener_ffd_5958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5959> AgradDistributionWiener_ffd_5959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5960> AgradDistributionWiener_ffd_5960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5961> AgradDistributionWiener_ffd_5961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5962> AgradDistributionWiener_ffd_5962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5963> AgradDistributionWiener_ffd_5963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5964> AgradDistributionWiener_ffd_5964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5965> AgradDistributionWiener_ffd_5965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5966> AgradDistributionWiener_ffd_5966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5967> AgradDistributionWiener_ffd_5967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5968> AgradDistributionWiener_ffd_5968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5969> AgradDistributionWiener_ffd_5969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5970> AgradDistributionWiener_ffd_5970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5971> AgradDistributionWiener_ffd_5971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5972> AgradDistributionWiener_ffd_5972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5973> AgradDistributionWiener_ffd_5973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5974> AgradDistributionWiener_ffd_5974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5975> AgradDistributionWiener_ffd_5975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5976> AgradDistributionWiener_ffd_5976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5977> AgradDistributionWiener_ffd_5977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5978> AgradDistributionWiener_ffd_5978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5979> AgradDistributionWiener_ffd_5979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5980> AgradDistributionWiener_ffd_5980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5981> AgradDistributionWiener_ffd_5981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5982> AgradDistributionWiener_ffd_5982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5983> AgradDistributionWiener_ffd_5983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5984> AgradDistributionWiener_ffd_5984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5985> AgradDistributionWiener_ffd_5985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5986> AgradDistributionWiener_ffd_5986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5987> AgradDistributionWiener_ffd_5987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5988> AgradDistributionWiener_ffd_5988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5989> AgradDistributionWiener_ffd_5989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5990> AgradDistributionWiener_ffd_5990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5991> AgradDistributionWiener_ffd_5991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5992> AgradDistributionWiener_ffd_5992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5993> AgradDistributionWiener_ffd_5993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5994> AgradDistributionWiener_ffd_5994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5995> AgradDistributionWiener_ffd_5995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5996> AgradDistributionWiener_ffd_5996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5997> AgradDistributionWiener_ffd_5997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5998> AgradDistributionWiener_ffd_5998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_5999> AgradDistributionWiener_ffd_5999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5900, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5901, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5902, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5903, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5904, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5905, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5906, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5907, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5908, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5909, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5910, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5911, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5912, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5913, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5914, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5915, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5916, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5917, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5918, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5919, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5920, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5921, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5922, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5923, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5924, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5925, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5926, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5927, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5928, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5929, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5930, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5931, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5932, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5933, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5934, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5935, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5936, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5937, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5938, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5939, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5940, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5941, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5942, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5943, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5944, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5945, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5946, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5947, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5948, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5949, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5950, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5951, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5952, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5953, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5954, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5955, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5956, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5957, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5958, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5959, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5960, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5961, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5962, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5963, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5964, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5965, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5966, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5967, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5968, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5969, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5970, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5971, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5972, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5973, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5974, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5975, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5976, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5977, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5978, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5979, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5980, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5981, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5982, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5983, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5984, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5985, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5986, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5987, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5988, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5989, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5990, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5991, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5992, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5993, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5994, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5995, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5996, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5997, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5998, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_5999, AgradDistributionTestFixture, AgradDistributionWiener_ffd_5999);
+
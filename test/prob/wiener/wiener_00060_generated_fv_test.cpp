@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6000;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6001;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6002;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6003;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6004;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6005;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6006;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6007;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6008;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6009;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6010;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6011;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6012;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6013;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6014;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6015;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6016;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6017;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6018;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6019;
+typedef boost::mpl::vector<std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6020;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, double, empty> type_fv_6021;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_fv_6022;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6023;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, fvar<var>, empty> type_fv_6024;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, std::vector<fvar<var>>, empty> type_fv_6025;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6026;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_fv_6027;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_fv_6028;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6029;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<var>, empty> type_fv_6030;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6031;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6032;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6033;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6034;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6035;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6036;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6037;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6038;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, empty> type_fv_6039;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, empty> type_fv_6040;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6041;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, empty> type_fv_6042;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6043;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6044;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, empty> type_fv_6045;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6046;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6047;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6048;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6049;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6050;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6051;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6052;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6053;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6054;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6055;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6056;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_fv_6057;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_fv_6058;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6059;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<var>, empty> type_fv_6060;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_6061;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6062;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_fv_6063;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_6064;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6065;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_6066;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6067;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6068;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6069;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6070;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6071;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6072;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6073;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6074;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, empty> type_fv_6075;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_6076;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6077;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_6078;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6079;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6080;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_6081;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6082;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6083;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6084;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6085;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6086;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6087;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6088;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6089;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6090;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6091;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6092;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_6093;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_6094;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6095;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_6096;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_6097;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6098;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_6099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6000> AgradDistributionWiener_fv_6000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6001> AgradDistributionWiener_fv_6001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6002> AgradDistributionWiener_fv_6002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6003> AgradDistributionWiener_fv_6003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6004> AgradDistributionWiener_fv_6004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6005> AgradDistributionWiener_fv_6005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6006> AgradDistributionWiener_fv_6006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6007> AgradDistributionWiener_fv_6007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6008> AgradDistributionWiener_fv_6008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6009> AgradDistributionWiener_fv_6009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6010> AgradDistributionWiener_fv_6010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6011> AgradDistributionWiener_fv_6011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6012> AgradDistributionWiener_fv_6012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6013> AgradDistributionWiener_fv_6013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6014> AgradDistributionWiener_fv_6014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6015> AgradDistributionWiener_fv_6015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6016> AgradDistributionWiener_fv_6016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6017> AgradDistributionWiener_fv_6017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6018> AgradDistributionWiener_fv_6018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6019> AgradDistributionWiener_fv_6019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6020> AgradDistributionWiener_fv_6020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6021> AgradDistributionWiener_fv_6021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6022> AgradDistributionWiener_fv_6022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6023> AgradDistributionWiener_fv_6023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6024> AgradDistributionWiener_fv_6024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6025> AgradDistributionWiener_fv_6025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6026> AgradDistributionWiener_fv_6026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6027> AgradDistributionWiener_fv_6027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6028> AgradDistributionWiener_fv_6028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6029> AgradDistributionWiener_fv_6029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6030> AgradDistributionWiener_fv_6030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6031> AgradDistributionWiener_fv_6031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6032> AgradDistributionWiener_fv_6032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6033> AgradDistributionWiener_fv_6033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6034> AgradDistributionWiener_fv_6034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6035> AgradDistributionWiener_fv_6035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6036> AgradDistributionWiener_fv_6036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6037> AgradDistributionWiener_fv_6037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6038> AgradDistributionWiener_fv_6038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6039> AgradDistributionWiener_fv_6039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6040> AgradDistributionWiener_fv_6040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6041> AgradDistributionWiener_fv_6041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6042> AgradDistributionWiener_fv_6042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6043> AgradDistributionWiener_fv_6043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6044> AgradDistributionWiener_fv_6044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6045> AgradDistributionWiener_fv_6045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6046> AgradDistributionWiener_fv_6046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6047> AgradDistributionWiener_fv_6047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6048> AgradDistributionWiener_fv_6048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6049> AgradDistributionWiener_fv_6049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6050> AgradDistributionWiener_fv_6050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6051> AgradDistributionWiener_fv_6051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6052> AgradDistributionWiener_fv_6052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6053> AgradDistributionWiener_fv_6053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6054> AgradDistributionWiener_fv_6054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6055> AgradDistributionWiener_fv_6055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6056> AgradDistributionWiener_fv_6056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6057> AgradDistributionWiener_fv_6057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6058> AgradDistributionWiener_fv_6058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6059> AgradDistributionWiener_fv_6059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6060> AgradDistributionWiener_fv_6060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6061> AgradDistributionWiener_fv_6061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6062> AgradDistributionWiener_fv_6062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6063> AgradDistributionWiener_fv_6063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6064> AgradDistributionWiener_fv_6064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6065> AgradDistributionWiener_fv_6065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6066> AgradDistributionWiener_fv_6066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6067> AgradDistributionWiener_fv_6067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6068> AgradDistributionWiener_fv_6068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6069> AgradDistributionWiener_fv_6069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6070> AgradDistributionWiener_fv_6070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6071> AgradDistributionWiener_fv_6071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6072> AgradDistributionWiener_fv_6072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6073> AgradDistributionWiener_fv_6073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6074> AgradDistributionWiener_fv_6074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6075> AgradDistributionWiener_fv_6075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6076> AgradDistributionWiener_fv_6076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6077> AgradDistributionWiener_fv_6077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6078> AgradDistributionWiener_fv_6078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6079> AgradDistributionWiener_fv_6079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6080> AgradDistributionWiener_fv_6080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6081> AgradDistributionWiener_fv_6081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6082> AgradDistributionWiener_fv_6082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6083> AgradDistributionWiener_fv_6083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6084> AgradDistributionWiener_fv_6084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6085> AgradDistributionWiener_fv_6085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6086> AgradDistributionWiener_fv_6086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6087> AgradDistributionWiener_fv_6087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6088> AgradDistributionWiener_fv_6088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6089> AgradDistributionWiener_fv_6089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6090> AgradDistributionWiener_fv_6090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6091> AgradDistributionWiener_fv_6091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6092> AgradDistributionWiener_fv_6092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6093> AgradDistributionWiener_fv_6093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6094> AgradDistributionWiener_fv_6094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6095> AgradDistributionWiener_fv_6095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6096> AgradDistributionWiener_fv_6096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6097> AgradDistributionWiener_fv_6097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6098> AgradDistributionWiener_fv_6098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6099> AgradDistributionWiener_fv_6099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6000, AgradDistributionTestFixture, AgradDistributionWiener_fv_6000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6001, AgradDistributionTestFixture, AgradDistributionWiener_fv_6001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6002, AgradDistributionTestFixture, AgradDistributionWiener_fv_6002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6003, AgradDistributionTestFixture, AgradDistributionWiener_fv_6003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6004, AgradDistributionTestFixture, AgradDistributionWiener_fv_6004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6005, AgradDistributionTestFixture, AgradDistributionWiener_fv_6005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6006, AgradDistributionTestFixture, AgradDistributionWiener_fv_6006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6007, AgradDistributionTestFixture, AgradDistributionWiener_fv_6007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6008, AgradDistributionTestFixture, AgradDistributionWiener_fv_6008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6009, AgradDistributionTestFixture, AgradDistributionWiener_fv_6009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6010, AgradDistributionTestFixture, AgradDistributionWiener_fv_6010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6011, AgradDistributionTestFixture, AgradDistributionWiener_fv_6011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6012, AgradDistributionTestFixture, AgradDistributionWiener_fv_6012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6013, AgradDistributionTestFixture, AgradDistributionWiener_fv_6013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6014, AgradDistributionTestFixture, AgradDistributionWiener_fv_6014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6015, AgradDistributionTestFixture, AgradDistributionWiener_fv_6015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6016, AgradDistributionTestFixture, AgradDistributionWiener_fv_6016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6017, AgradDistributionTestFixture, AgradDistributionWiener_fv_6017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6018, AgradDistributionTestFixture, AgradDistributionWiener_fv_6018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6019, AgradDistributionTestFixture, AgradDistributionWiener_fv_6019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6020, AgradDistributionTestFixture, AgradDistributionWiener_fv_6020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6021, AgradDistributionTestFixture, AgradDistributionWiener_fv_6021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6022, AgradDistributionTestFixture, AgradDistributionWiener_fv_6022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6023, AgradDistributionTestFixture, AgradDistributionWiener_fv_6023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6024, AgradDistributionTestFixture, AgradDistributionWiener_fv_6024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6025, AgradDistributionTestFixture, AgradDistributionWiener_fv_6025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6026, AgradDistributionTestFixture, AgradDistributionWiener_fv_6026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6027, AgradDistributionTestFixture, AgradDistributionWiener_fv_6027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6028, AgradDistributionTestFixture, AgradDistributionWiener_fv_6028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6029, AgradDistributionTestFixture, AgradDistributionWiener_fv_6029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6030, AgradDistributionTestFixture, AgradDistributionWiener_fv_6030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6031, AgradDistributionTestFixture, AgradDistributionWiener_fv_6031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6032, AgradDistributionTestFixture, AgradDistributionWiener_fv_6032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6033, AgradDistributionTestFixture, AgradDistributionWiener_fv_6033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6034, AgradDistributionTestFixture, AgradDistributionWiener_fv_6034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6035, AgradDistributionTestFixture, AgradDistributionWiener_fv_6035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6036, AgradDistributionTestFixture, AgradDistributionWiener_fv_6036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6037, AgradDistributionTestFixture, AgradDistributionWiener_fv_6037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6038, AgradDistributionTestFixture, AgradDistributionWiener_fv_6038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6039, AgradDistributionTestFixture, AgradDistributionWiener_fv_6039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6040, AgradDistributionTestFixture, AgradDistributionWiener_fv_6040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6041, AgradDistributionTestFixture, AgradDistributionWiener_fv_6041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6042, AgradDistributionTestFixture, AgradDistributionWiener_fv_6042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6043, AgradDistributionTestFixture, AgradDistributionWiener_fv_6043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6044, AgradDistributionTestFixture, AgradDistributionWiener_fv_6044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6045, AgradDistributionTestFixture, AgradDistributionWiener_fv_6045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6046, AgradDistributionTestFixture, AgradDistributionWiener_fv_6046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6047, AgradDistributionTestFixture, AgradDistributionWiener_fv_6047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6048, AgradDistributionTestFixture, AgradDistributionWiener_fv_6048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6049, AgradDistributionTestFixture, AgradDistributionWiener_fv_6049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6050, AgradDistributionTestFixture, AgradDistributionWiener_fv_6050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6051, AgradDistributionTestFixture, AgradDistributionWiener_fv_6051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6052, AgradDistributionTestFixture, AgradDistributionWiener_fv_6052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6053, AgradDistributionTestFixture, AgradDistributionWiener_fv_6053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6054, AgradDistributionTestFixture, AgradDistributionWiener_fv_6054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6055, AgradDistributionTestFixture, AgradDistributionWiener_fv_6055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6056, AgradDistributionTestFixture, AgradDistributionWiener_fv_6056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6057, AgradDistributionTestFixture, AgradDistributionWiener_fv_6057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6058, AgradDistributionTestFixture, AgradDistributionWiener_fv_6058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6059, AgradDistributionTestFixture, AgradDistributionWiener_fv_6059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6060, AgradDistributionTestFixture, AgradDistributionWiener_fv_6060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6061, AgradDistributionTestFixture, AgradDistributionWiener_fv_6061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6062, AgradDistributionTestFixture, AgradDistributionWiener_fv_6062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6063, AgradDistributionTestFixture, AgradDistributionWiener_fv_6063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6064, AgradDistributionTestFixture, AgradDistributionWiener_fv_6064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6065, AgradDistributionTestFixture, AgradDistributionWiener_fv_6065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6066, AgradDistributionTestFixture, AgradDistributionWiener_fv_6066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6067, AgradDistributionTestFixture, AgradDistributionWiener_fv_6067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6068, AgradDistributionTestFixture, AgradDistributionWiener_fv_6068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6069, AgradDistributionTestFixture, AgradDistributionWiener_fv_6069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6070, AgradDistributionTestFixture, AgradDistributionWiener_fv_6070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6071, AgradDistributionTestFixture, AgradDistributionWiener_fv_6071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6072, AgradDistributionTestFixture, AgradDistributionWiener_fv_6072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6073, AgradDistributionTestFixture, AgradDistributionWiener_fv_6073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6074, AgradDistributionTestFixture, AgradDistributionWiener_fv_6074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6075, AgradDistributionTestFixture, AgradDistributionWiener_fv_6075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6076, AgradDistributionTestFixture, AgradDistributionWiener_fv_6076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6077, AgradDistributionTestFixture, AgradDistributionWiener_fv_6077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6078, AgradDistributionTestFixture, AgradDistributionWiener_fv_6078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6079, AgradDistributionTestFixture, AgradDistributionWiener_fv_6079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6080, AgradDistributionTestFixture, AgradDistributionWiener_fv_6080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6081, AgradDistributionTestFixture, AgradDistributionWiener_fv_6081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6082, AgradDistributionTestFixture, AgradDistributionWiener_fv_6082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6083, AgradDistributionTestFixture, AgradDistributionWiener_fv_6083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6084, AgradDistributionTestFixture, AgradDistributionWiener_fv_6084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6085, AgradDistributionTestFixture, AgradDistributionWiener_fv_6085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6086, AgradDistributionTestFixture, AgradDistributionWiener_fv_6086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6087, AgradDistributionTestFixture, AgradDistributionWiener_fv_6087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6088, AgradDistributionTestFixture, AgradDistributionWiener_fv_6088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6089, AgradDistributionTestFixture, AgradDistributionWiener_fv_6089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6090, AgradDistributionTestFixture, AgradDistributionWiener_fv_6090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6091, AgradDistributionTestFixture, AgradDistributionWiener_fv_6091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6092, AgradDistributionTestFixture, AgradDistributionWiener_fv_6092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6093, AgradDistributionTestFixture, AgradDistributionWiener_fv_6093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6094, AgradDistributionTestFixture, AgradDistributionWiener_fv_6094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6095, AgradDistributionTestFixture, AgradDistributionWiener_fv_6095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6096, AgradDistributionTestFixture, AgradDistributionWiener_fv_6096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6097, AgradDistributionTestFixture, AgradDistributionWiener_fv_6097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6098, AgradDistributionTestFixture, AgradDistributionWiener_fv_6098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6099, AgradDistributionTestFixture, AgradDistributionWiener_fv_6099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_6100;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6101;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_6102;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6103;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6104;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_6105;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_6106;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6107;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6108;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6109;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6110;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_6111;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_6112;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6113;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_6114;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_6115;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6116;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_6117;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_6118;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6119;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_6120;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6121;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6122;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_6123;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_6124;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6125;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6126;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6127;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6128;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty> type_ffv_6129;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty> type_ffv_6130;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6131;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty> type_ffv_6132;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_6133;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6134;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty> type_ffv_6135;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty> type_ffv_6136;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6137;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_6138;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6139;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6140;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_6141;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_6142;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6143;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6144;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6145;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6146;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty> type_ffv_6147;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_6148;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6149;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_6150;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_6151;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6152;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_6153;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_6154;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6155;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_6156;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6157;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6158;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_6159;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_6160;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6161;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6162;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6163;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6164;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty> type_ffv_6165;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty> type_ffv_6166;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6167;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty> type_ffv_6168;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_6169;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6170;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty> type_ffv_6171;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty> type_ffv_6172;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6173;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_6174;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6175;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6176;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_6177;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_6178;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6179;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6180;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6181;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6182;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty> type_ffv_6183;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_6184;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6185;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_6186;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_6187;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6188;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_6189;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_6190;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6191;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_6192;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6193;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_6194;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_6195;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_6196;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_6197;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6198;
+typedef boost::mpl::vector<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_6199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6100> AgradDistributionWiener_ffv_6100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6101> AgradDistributionWiener_ffv_6101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6102> AgradDistributionWiener_ffv_6102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6103> AgradDistributionWiener_ffv_6103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6104> AgradDistributionWiener_ffv_6104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6105> AgradDistributionWiener_ffv_6105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6106> AgradDistributionWiener_ffv_6106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6107> AgradDistributionWiener_ffv_6107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6108> AgradDistributionWiener_ffv_6108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6109> AgradDistributionWiener_ffv_6109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6110> AgradDistributionWiener_ffv_6110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6111> AgradDistributionWiener_ffv_6111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6112> AgradDistributionWiener_ffv_6112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6113> AgradDistributionWiener_ffv_6113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6114> AgradDistributionWiener_ffv_6114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6115> AgradDistributionWiener_ffv_6115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6116> AgradDistributionWiener_ffv_6116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6117> AgradDistributionWiener_ffv_6117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6118> AgradDistributionWiener_ffv_6118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6119> AgradDistributionWiener_ffv_6119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6120> AgradDistributionWiener_ffv_6120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6121> AgradDistributionWiener_ffv_6121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6122> AgradDistributionWiener_ffv_6122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6123> AgradDistributionWiener_ffv_6123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6124> AgradDistributionWiener_ffv_6124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6125> AgradDistributionWiener_ffv_6125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6126> AgradDistributionWiener_ffv_6126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6127> AgradDistributionWiener_ffv_6127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6128> AgradDistributionWiener_ffv_6128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6129> AgradDistributionWiener_ffv_6129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6130> AgradDistributionWiener_ffv_6130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6131> AgradDistributionWiener_ffv_6131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6132> AgradDistributionWiener_ffv_6132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6133> AgradDistributionWiener_ffv_6133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6134> AgradDistributionWiener_ffv_6134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6135> AgradDistributionWiener_ffv_6135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6136> AgradDistributionWiener_ffv_6136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6137> AgradDistributionWiener_ffv_6137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6138> AgradDistributionWiener_ffv_6138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6139> AgradDistributionWiener_ffv_6139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6140> AgradDistributionWiener_ffv_6140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6141> AgradDistributionWiener_ffv_6141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6142> AgradDistributionWiener_ffv_6142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6143> AgradDistributionWiener_ffv_6143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6144> AgradDistributionWiener_ffv_6144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6145> AgradDistributionWiener_ffv_6145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6146> AgradDistributionWiener_ffv_6146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6147> AgradDistributionWiener_ffv_6147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6148> AgradDistributionWiener_ffv_6148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6149> AgradDistributionWiener_ffv_6149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6150> AgradDistributionWiener_ffv_6150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6151> AgradDistributionWiener_ffv_6151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6152> AgradDistributionWiener_ffv_6152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6153> AgradDistributionWiener_ffv_6153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6154> AgradDistributionWiener_ffv_6154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6155> AgradDistributionWiener_ffv_6155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6156> AgradDistributionWiener_ffv_6156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6157> AgradDistributionWiener_ffv_6157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6158> AgradDistributionWiener_ffv_6158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6159> AgradDistributionWiener_ffv_6159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6160> AgradDistributionWiener_ffv_6160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6161> AgradDistributionWiener_ffv_6161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6162> AgradDistributionWiener_ffv_6162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6163> AgradDistributionWiener_ffv_6163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6164> AgradDistributionWiener_ffv_6164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6165> AgradDistributionWiener_ffv_6165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6166> AgradDistributionWiener_ffv_6166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6167> AgradDistributionWiener_ffv_6167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6168> AgradDistributionWiener_ffv_6168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6169> AgradDistributionWiener_ffv_6169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6170> AgradDistributionWiener_ffv_6170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6171> AgradDistributionWiener_ffv_6171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6172> AgradDistributionWiener_ffv_6172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6173> AgradDistributionWiener_ffv_6173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6174> AgradDistributionWiener_ffv_6174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6175> AgradDistributionWiener_ffv_6175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6176> AgradDistributionWiener_ffv_6176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6177> AgradDistributionWiener_ffv_6177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6178> AgradDistributionWiener_ffv_6178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6179> AgradDistributionWiener_ffv_6179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6180> AgradDistributionWiener_ffv_6180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6181> AgradDistributionWiener_ffv_6181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6182> AgradDistributionWiener_ffv_6182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6183> AgradDistributionWiener_ffv_6183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6184> AgradDistributionWiener_ffv_6184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6185> AgradDistributionWiener_ffv_6185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6186> AgradDistributionWiener_ffv_6186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6187> AgradDistributionWiener_ffv_6187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6188> AgradDistributionWiener_ffv_6188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6189> AgradDistributionWiener_ffv_6189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6190> AgradDistributionWiener_ffv_6190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6191> AgradDistributionWiener_ffv_6191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6192> AgradDistributionWiener_ffv_6192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6193> AgradDistributionWiener_ffv_6193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6194> AgradDistributionWiener_ffv_6194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6195> AgradDistributionWiener_ffv_6195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6196> AgradDistributionWiener_ffv_6196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6197> AgradDistributionWiener_ffv_6197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6198> AgradDistributionWiener_ffv_6198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_6199> AgradDistributionWiener_ffv_6199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6100, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6101, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6102, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6103, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6104, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6105, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6106, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6107, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6108, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6109, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6110, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6111, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6112, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6113, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6114, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6115, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6116, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6117, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6118, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6119, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6120, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6121, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6122, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6123, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6124, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6125, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6126, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6127, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6128, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6129, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6130, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6131, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6132, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6133, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6134, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6135, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6136, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6137, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6138, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6139, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6140, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6141, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6142, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6143, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6144, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6145, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6146, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6147, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6148, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6149, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6150, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6151, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6152, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6153, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6154, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6155, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6156, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6157, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6158, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6159, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6160, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6161, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6162, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6163, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6164, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6165, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6166, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6167, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6168, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6169, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6170, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6171, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6172, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6173, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6174, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6175, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6176, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6177, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6178, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6179, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6180, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6181, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6182, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6183, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6184, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6185, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6186, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6187, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6188, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6189, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6190, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6191, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6192, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6193, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6194, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6195, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6196, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6197, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6198, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_6199, AgradDistributionTestFixture, AgradDistributionWiener_ffv_6199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_6100;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6101;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_6102;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6103;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6104;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6105;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6106;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6107;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6108;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6109;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6110;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6111;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6112;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6113;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6114;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6115;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6116;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6117;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6118;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6119;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6120;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6121;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6122;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6123;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6124;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6125;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6126;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6127;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6128;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, empty> type_fv_6129;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, empty> type_fv_6130;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6131;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, empty> type_fv_6132;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_6133;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6134;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, empty> type_fv_6135;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_6136;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6137;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_6138;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6139;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6140;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6141;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6142;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6143;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6144;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6145;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6146;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, empty> type_fv_6147;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_6148;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6149;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_6150;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6151;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6152;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_6153;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6154;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6155;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6156;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6157;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6158;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6159;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6160;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6161;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6162;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6163;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6164;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, empty> type_fv_6165;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_6166;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6167;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_6168;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_6169;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6170;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_6171;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_6172;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6173;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_6174;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6175;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6176;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6177;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6178;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6179;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6180;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6181;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6182;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_6183;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_6184;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6185;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_6186;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6187;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6188;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_6189;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6190;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6191;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6192;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6193;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6194;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6195;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6196;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6197;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6198;
+typedef boost::mpl::vector<std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6100> AgradDistributionWiener_fv_6100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6101> AgradDistributionWiener_fv_6101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6102> AgradDistributionWiener_fv_6102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6103> AgradDistributionWiener_fv_6103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6104> AgradDistributionWiener_fv_6104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6105> AgradDistributionWiener_fv_6105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6106> AgradDistributionWiener_fv_6106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6107> AgradDistributionWiener_fv_6107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6108> AgradDistributionWiener_fv_6108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6109> AgradDistributionWiener_fv_6109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6110> AgradDistributionWiener_fv_6110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6111> AgradDistributionWiener_fv_6111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6112> AgradDistributionWiener_fv_6112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6113> AgradDistributionWiener_fv_6113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6114> AgradDistributionWiener_fv_6114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6115> AgradDistributionWiener_fv_6115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6116> AgradDistributionWiener_fv_6116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6117> AgradDistributionWiener_fv_6117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6118> AgradDistributionWiener_fv_6118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6119> AgradDistributionWiener_fv_6119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6120> AgradDistributionWiener_fv_6120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6121> AgradDistributionWiener_fv_6121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6122> AgradDistributionWiener_fv_6122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6123> AgradDistributionWiener_fv_6123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6124> AgradDistributionWiener_fv_6124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6125> AgradDistributionWiener_fv_6125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6126> AgradDistributionWiener_fv_6126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6127> AgradDistributionWiener_fv_6127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6128> AgradDistributionWiener_fv_6128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6129> AgradDistributionWiener_fv_6129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6130> AgradDistributionWiener_fv_6130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6131> AgradDistributionWiener_fv_6131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6132> AgradDistributionWiener_fv_6132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6133> AgradDistributionWiener_fv_6133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6134> AgradDistributionWiener_fv_6134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6135> AgradDistributionWiener_fv_6135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6136> AgradDistributionWiener_fv_6136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6137> AgradDistributionWiener_fv_6137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6138> AgradDistributionWiener_fv_6138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6139> AgradDistributionWiener_fv_6139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6140> AgradDistributionWiener_fv_6140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6141> AgradDistributionWiener_fv_6141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6142> AgradDistributionWiener_fv_6142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6143> AgradDistributionWiener_fv_6143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6144> AgradDistributionWiener_fv_6144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6145> AgradDistributionWiener_fv_6145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6146> AgradDistributionWiener_fv_6146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6147> AgradDistributionWiener_fv_6147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6148> AgradDistributionWiener_fv_6148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6149> AgradDistributionWiener_fv_6149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6150> AgradDistributionWiener_fv_6150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6151> AgradDistributionWiener_fv_6151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6152> AgradDistributionWiener_fv_6152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6153> AgradDistributionWiener_fv_6153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6154> AgradDistributionWiener_fv_6154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6155> AgradDistributionWiener_fv_6155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6156> AgradDistributionWiener_fv_6156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6157> AgradDistributionWiener_fv_6157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6158> AgradDistributionWiener_fv_6158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6159> AgradDistributionWiener_fv_6159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6160> AgradDistributionWiener_fv_6160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6161> AgradDistributionWiener_fv_6161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6162> AgradDistributionWiener_fv_6162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6163> AgradDistributionWiener_fv_6163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6164> AgradDistributionWiener_fv_6164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6165> AgradDistributionWiener_fv_6165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6166> AgradDistributionWiener_fv_6166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6167> AgradDistributionWiener_fv_6167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6168> AgradDistributionWiener_fv_6168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6169> AgradDistributionWiener_fv_6169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6170> AgradDistributionWiener_fv_6170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6171> AgradDistributionWiener_fv_6171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6172> AgradDistributionWiener_fv_6172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6173> AgradDistributionWiener_fv_6173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6174> AgradDistributionWiener_fv_6174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6175> AgradDistributionWiener_fv_6175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6176> AgradDistributionWiener_fv_6176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6177> AgradDistributionWiener_fv_6177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6178> AgradDistributionWiener_fv_6178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6179> AgradDistributionWiener_fv_6179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6180> AgradDistributionWiener_fv_6180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6181> AgradDistributionWiener_fv_6181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6182> AgradDistributionWiener_fv_6182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6183> AgradDistributionWiener_fv_6183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6184> AgradDistributionWiener_fv_6184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6185> AgradDistributionWiener_fv_6185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6186> AgradDistributionWiener_fv_6186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6187> AgradDistributionWiener_fv_6187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6188> AgradDistributionWiener_fv_6188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6189> AgradDistributionWiener_fv_6189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6190> AgradDistributionWiener_fv_6190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6191> AgradDistributionWiener_fv_6191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6192> AgradDistributionWiener_fv_6192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6193> AgradDistributionWiener_fv_6193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6194> AgradDistributionWiener_fv_6194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6195> AgradDistributionWiener_fv_6195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6196> AgradDistributionWiener_fv_6196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6197> AgradDistributionWiener_fv_6197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6198> AgradDistributionWiener_fv_6198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6199> AgradDistributionWiener_fv_6199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6100, AgradDistributionTestFixture, AgradDistributionWiener_fv_6100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6101, AgradDistributionTestFixture, AgradDistributionWiener_fv_6101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6102, AgradDistributionTestFixture, AgradDistributionWiener_fv_6102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6103, AgradDistributionTestFixture, AgradDistributionWiener_fv_6103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6104, AgradDistributionTestFixture, AgradDistributionWiener_fv_6104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6105, AgradDistributionTestFixture, AgradDistributionWiener_fv_6105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6106, AgradDistributionTestFixture, AgradDistributionWiener_fv_6106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6107, AgradDistributionTestFixture, AgradDistributionWiener_fv_6107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6108, AgradDistributionTestFixture, AgradDistributionWiener_fv_6108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6109, AgradDistributionTestFixture, AgradDistributionWiener_fv_6109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6110, AgradDistributionTestFixture, AgradDistributionWiener_fv_6110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6111, AgradDistributionTestFixture, AgradDistributionWiener_fv_6111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6112, AgradDistributionTestFixture, AgradDistributionWiener_fv_6112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6113, AgradDistributionTestFixture, AgradDistributionWiener_fv_6113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6114, AgradDistributionTestFixture, AgradDistributionWiener_fv_6114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6115, AgradDistributionTestFixture, AgradDistributionWiener_fv_6115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6116, AgradDistributionTestFixture, AgradDistributionWiener_fv_6116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6117, AgradDistributionTestFixture, AgradDistributionWiener_fv_6117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6118, AgradDistributionTestFixture, AgradDistributionWiener_fv_6118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6119, AgradDistributionTestFixture, AgradDistributionWiener_fv_6119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6120, AgradDistributionTestFixture, AgradDistributionWiener_fv_6120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6121, AgradDistributionTestFixture, AgradDistributionWiener_fv_6121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6122, AgradDistributionTestFixture, AgradDistributionWiener_fv_6122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6123, AgradDistributionTestFixture, AgradDistributionWiener_fv_6123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6124, AgradDistributionTestFixture, AgradDistributionWiener_fv_6124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6125, AgradDistributionTestFixture, AgradDistributionWiener_fv_6125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6126, AgradDistributionTestFixture, AgradDistributionWiener_fv_6126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6127, AgradDistributionTestFixture, AgradDistributionWiener_fv_6127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6128, AgradDistributionTestFixture, AgradDistributionWiener_fv_6128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6129, AgradDistributionTestFixture, AgradDistributionWiener_fv_6129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6130, AgradDistributionTestFixture, AgradDistributionWiener_fv_6130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6131, AgradDistributionTestFixture, AgradDistributionWiener_fv_6131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6132, AgradDistributionTestFixture, AgradDistributionWiener_fv_6132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6133, AgradDistributionTestFixture, AgradDistributionWiener_fv_6133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6134, AgradDistributionTestFixture, AgradDistributionWiener_fv_6134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6135, AgradDistributionTestFixture, AgradDistributionWiener_fv_6135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6136, AgradDistributionTestFixture, AgradDistributionWiener_fv_6136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6137, AgradDistributionTestFixture, AgradDistributionWiener_fv_6137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6138, AgradDistributionTestFixture, AgradDistributionWiener_fv_6138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6139, AgradDistributionTestFixture, AgradDistributionWiener_fv_6139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6140, AgradDistributionTestFixture, AgradDistributionWiener_fv_6140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6141, AgradDistributionTestFixture, AgradDistributionWiener_fv_6141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6142, AgradDistributionTestFixture, AgradDistributionWiener_fv_6142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6143, AgradDistributionTestFixture, AgradDistributionWiener_fv_6143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6144, AgradDistributionTestFixture, AgradDistributionWiener_fv_6144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6145, AgradDistributionTestFixture, AgradDistributionWiener_fv_6145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6146, AgradDistributionTestFixture, AgradDistributionWiener_fv_6146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6147, AgradDistributionTestFixture, AgradDistributionWiener_fv_6147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6148, AgradDistributionTestFixture, AgradDistributionWiener_fv_6148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6149, AgradDistributionTestFixture, AgradDistributionWiener_fv_6149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6150, AgradDistributionTestFixture, AgradDistributionWiener_fv_6150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6151, AgradDistributionTestFixture, AgradDistributionWiener_fv_6151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6152, AgradDistributionTestFixture, AgradDistributionWiener_fv_6152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6153, AgradDistributionTestFixture, AgradDistributionWiener_fv_6153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6154, AgradDistributionTestFixture, AgradDistributionWiener_fv_6154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6155, AgradDistributionTestFixture, AgradDistributionWiener_fv_6155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6156, AgradDistributionTestFixture, AgradDistributionWiener_fv_6156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6157, AgradDistributionTestFixture, AgradDistributionWiener_fv_6157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6158, AgradDistributionTestFixture, AgradDistributionWiener_fv_6158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6159, AgradDistributionTestFixture, AgradDistributionWiener_fv_6159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6160, AgradDistributionTestFixture, AgradDistributionWiener_fv_6160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6161, AgradDistributionTestFixture, AgradDistributionWiener_fv_6161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6162, AgradDistributionTestFixture, AgradDistributionWiener_fv_6162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6163, AgradDistributionTestFixture, AgradDistributionWiener_fv_6163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6164, AgradDistributionTestFixture, AgradDistributionWiener_fv_6164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6165, AgradDistributionTestFixture, AgradDistributionWiener_fv_6165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6166, AgradDistributionTestFixture, AgradDistributionWiener_fv_6166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6167, AgradDistributionTestFixture, AgradDistributionWiener_fv_6167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6168, AgradDistributionTestFixture, AgradDistributionWiener_fv_6168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6169, AgradDistributionTestFixture, AgradDistributionWiener_fv_6169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6170, AgradDistributionTestFixture, AgradDistributionWiener_fv_6170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6171, AgradDistributionTestFixture, AgradDistributionWiener_fv_6171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6172, AgradDistributionTestFixture, AgradDistributionWiener_fv_6172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6173, AgradDistributionTestFixture, AgradDistributionWiener_fv_6173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6174, AgradDistributionTestFixture, AgradDistributionWiener_fv_6174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6175, AgradDistributionTestFixture, AgradDistributionWiener_fv_6175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6176, AgradDistributionTestFixture, AgradDistributionWiener_fv_6176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6177, AgradDistributionTestFixture, AgradDistributionWiener_fv_6177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6178, AgradDistributionTestFixture, AgradDistributionWiener_fv_6178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6179, AgradDistributionTestFixture, AgradDistributionWiener_fv_6179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6180, AgradDistributionTestFixture, AgradDistributionWiener_fv_6180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6181, AgradDistributionTestFixture, AgradDistributionWiener_fv_6181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6182, AgradDistributionTestFixture, AgradDistributionWiener_fv_6182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6183, AgradDistributionTestFixture, AgradDistributionWiener_fv_6183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6184, AgradDistributionTestFixture, AgradDistributionWiener_fv_6184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6185, AgradDistributionTestFixture, AgradDistributionWiener_fv_6185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6186, AgradDistributionTestFixture, AgradDistributionWiener_fv_6186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6187, AgradDistributionTestFixture, AgradDistributionWiener_fv_6187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6188, AgradDistributionTestFixture, AgradDistributionWiener_fv_6188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6189, AgradDistributionTestFixture, AgradDistributionWiener_fv_6189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6190, AgradDistributionTestFixture, AgradDistributionWiener_fv_6190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6191, AgradDistributionTestFixture, AgradDistributionWiener_fv_6191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6192, AgradDistributionTestFixture, AgradDistributionWiener_fv_6192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6193, AgradDistributionTestFixture, AgradDistributionWiener_fv_6193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6194, AgradDistributionTestFixture, AgradDistributionWiener_fv_6194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6195, AgradDistributionTestFixture, AgradDistributionWiener_fv_6195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6196, AgradDistributionTestFixture, AgradDistributionWiener_fv_6196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6197, AgradDistributionTestFixture, AgradDistributionWiener_fv_6197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6198, AgradDistributionTestFixture, AgradDistributionWiener_fv_6198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6199, AgradDistributionTestFixture, AgradDistributionWiener_fv_6199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6200;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_6201;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_6202;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6203;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_6204;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_6205;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6206;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_6207;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_6208;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6209;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_6210;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6211;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6212;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_6213;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_6214;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6215;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_6216;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6217;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6218;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_6219;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_6220;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6221;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_6222;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_6223;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6224;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_6225;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_6226;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6227;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_6228;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6229;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6230;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_6231;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_6232;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6233;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_6234;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6235;
+typedef boost::mpl::vector<std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6236;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, double, empty> type_ffd_6237;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, std::vector<double>, empty> type_ffd_6238;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6239;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, fvar<fvar<double> >, empty> type_ffd_6240;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_6241;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6242;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, double, empty> type_ffd_6243;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, std::vector<double>, empty> type_ffd_6244;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6245;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_6246;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6247;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6248;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_6249;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_6250;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6251;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_6252;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6253;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6254;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, double, empty> type_ffd_6255;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_6256;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6257;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_6258;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_6259;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6260;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_6261;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_6262;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6263;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_6264;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6265;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6266;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_6267;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_6268;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6269;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_6270;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6271;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6272;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, double, empty> type_ffd_6273;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, std::vector<double>, empty> type_ffd_6274;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6275;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_6276;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_6277;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6278;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, double, empty> type_ffd_6279;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_6280;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6281;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_6282;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6283;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6284;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_6285;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_6286;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6287;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_6288;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_6289;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6290;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_6291;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_6292;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6293;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_6294;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_6295;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_6296;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_6297;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_6298;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_6299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6200> AgradDistributionWiener_ffd_6200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6201> AgradDistributionWiener_ffd_6201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6202> AgradDistributionWiener_ffd_6202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6203> AgradDistributionWiener_ffd_6203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6204> AgradDistributionWiener_ffd_6204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6205> AgradDistributionWiener_ffd_6205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6206> AgradDistributionWiener_ffd_6206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6207> AgradDistributionWiener_ffd_6207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6208> AgradDistributionWiener_ffd_6208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6209> AgradDistributionWiener_ffd_6209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6210> AgradDistributionWiener_ffd_6210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6211> AgradDistributionWiener_ffd_6211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6212> AgradDistributionWiener_ffd_6212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6213> AgradDistributionWiener_ffd_6213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6214> AgradDistributionWiener_ffd_6214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6215> AgradDistributionWiener_ffd_6215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6216> AgradDistributionWiener_ffd_6216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6217> AgradDistributionWiener_ffd_6217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6218> AgradDistributionWiener_ffd_6218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6219> AgradDistributionWiener_ffd_6219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6220> AgradDistributionWiener_ffd_6220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6221> AgradDistributionWiener_ffd_6221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6222> AgradDistributionWiener_ffd_6222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6223> AgradDistributionWiener_ffd_6223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6224> AgradDistributionWiener_ffd_6224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6225> AgradDistributionWiener_ffd_6225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6226> AgradDistributionWiener_ffd_6226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6227> AgradDistributionWiener_ffd_6227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6228> AgradDistributionWiener_ffd_6228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6229> AgradDistributionWiener_ffd_6229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6230> AgradDistributionWiener_ffd_6230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6231> AgradDistributionWiener_ffd_6231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6232> AgradDistributionWiener_ffd_6232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6233> AgradDistributionWiener_ffd_6233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6234> AgradDistributionWiener_ffd_6234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6235> AgradDistributionWiener_ffd_6235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6236> AgradDistributionWiener_ffd_6236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6237> AgradDistributionWiener_ffd_6237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6238> AgradDistributionWiener_ffd_6238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6239> AgradDistributionWiener_ffd_6239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6240> AgradDistributionWiener_ffd_6240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6241> AgradDistributionWiener_ffd_6241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6242> AgradDistributionWiener_ffd_6242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6243> AgradDistributionWiener_ffd_6243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6244> AgradDistributionWiener_ffd_6244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6245> AgradDistributionWiener_ffd_6245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6246> AgradDistributionWiener_ffd_6246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6247> AgradDistributionWiener_ffd_6247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6248> AgradDistributionWiener_ffd_6248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6249> AgradDistributionWiener_ffd_6249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6250> AgradDistributionWiener_ffd_6250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6251> AgradDistributionWiener_ffd_6251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6252> AgradDistributionWiener_ffd_6252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6253> AgradDistributionWiener_ffd_6253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6254> AgradDistributionWiener_ffd_6254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6255> AgradDistributionWiener_ffd_6255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6256> AgradDistributionWiener_ffd_6256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6257> AgradDistributionWiener_ffd_6257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6258> AgradDistributionWiener_ffd_6258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6259> AgradDistributionWiener_ffd_6259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6260> AgradDistributionWiener_ffd_6260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6261> AgradDistributionWiener_ffd_6261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6262> AgradDistributionWiener_ffd_6262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6263> AgradDistributionWiener_ffd_6263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6264> AgradDistributionWiener_ffd_6264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6265> AgradDistributionWiener_ffd_6265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6266> AgradDistributionWiener_ffd_6266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6267> AgradDistributionWiener_ffd_6267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6268> AgradDistributionWiener_ffd_6268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6269> AgradDistributionWiener_ffd_6269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6270> AgradDistributionWiener_ffd_6270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6271> AgradDistributionWiener_ffd_6271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6272> AgradDistributionWiener_ffd_6272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6273> AgradDistributionWiener_ffd_6273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6274> AgradDistributionWiener_ffd_6274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6275> AgradDistributionWiener_ffd_6275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6276> AgradDistributionWiener_ffd_6276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6277> AgradDistributionWiener_ffd_6277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6278> AgradDistributionWiener_ffd_6278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6279> AgradDistributionWiener_ffd_6279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6280> AgradDistributionWiener_ffd_6280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6281> AgradDistributionWiener_ffd_6281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6282> AgradDistributionWiener_ffd_6282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6283> AgradDistributionWiener_ffd_6283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6284> AgradDistributionWiener_ffd_6284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6285> AgradDistributionWiener_ffd_6285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6286> AgradDistributionWiener_ffd_6286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6287> AgradDistributionWiener_ffd_6287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6288> AgradDistributionWiener_ffd_6288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6289> AgradDistributionWiener_ffd_6289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6290> AgradDistributionWiener_ffd_6290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6291> AgradDistributionWiener_ffd_6291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6292> AgradDistributionWiener_ffd_6292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6293> AgradDistributionWiener_ffd_6293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6294> AgradDistributionWiener_ffd_6294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6295> AgradDistributionWiener_ffd_6295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6296> AgradDistributionWiener_ffd_6296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6297> AgradDistributionWiener_ffd_6297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6298> AgradDistributionWiener_ffd_6298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_6299> AgradDistributionWiener_ffd_6299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6200, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6201, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6202, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6203, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6204, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6205, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6206, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6207, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6208, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6209, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6210, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6211, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6212, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6213, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6214, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6215, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6216, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6217, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6218, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6219, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6220, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6221, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6222, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6223, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6224, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6225, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6226, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6227, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6228, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6229, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6230, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6231, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6232, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6233, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6234, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6235, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6236, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6237, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6238, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6239, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6240, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6241, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6242, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6243, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6244, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6245, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6246, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6247, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6248, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6249, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6250, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6251, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6252, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6253, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6254, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6255, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6256, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6257, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6258, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6259, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6260, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6261, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6262, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6263, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6264, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6265, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6266, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6267, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6268, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6269, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6270, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6271, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6272, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6273, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6274, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6275, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6276, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6277, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6278, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6279, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6280, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6281, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6282, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6283, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6284, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6285, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6286, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6287, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6288, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6289, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6290, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6291, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6292, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6293, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6294, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6295, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6296, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6297, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6298, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_6299, AgradDistributionTestFixture, AgradDistributionWiener_ffd_6299);
+
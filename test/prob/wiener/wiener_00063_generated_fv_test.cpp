@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6300;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6301;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6302;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6303;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6304;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6305;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6306;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6307;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6308;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_6309;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_6310;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6311;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_6312;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_6313;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6314;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_6315;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_6316;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6317;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_6318;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6319;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6320;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6321;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6322;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6323;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6324;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6325;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6326;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6327;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6328;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6329;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6330;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6331;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6332;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6333;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6334;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6335;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6336;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6337;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6338;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6339;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6340;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6341;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6342;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6343;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6344;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, double, empty> type_fv_6345;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, std::vector<double>, empty> type_fv_6346;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6347;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, fvar<var>, empty> type_fv_6348;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_6349;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6350;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, double, empty> type_fv_6351;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_6352;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6353;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_6354;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6355;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6356;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6357;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6358;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6359;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6360;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6361;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6362;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, double, empty> type_fv_6363;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_6364;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6365;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_6366;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6367;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6368;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_6369;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6370;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6371;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6372;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6373;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6374;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6375;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6376;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6377;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6378;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6379;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6380;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, double, empty> type_fv_6381;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_6382;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6383;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_6384;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_6385;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6386;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_6387;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_6388;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6389;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_6390;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6391;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6392;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6393;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6394;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6395;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6396;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6397;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6398;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_6399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6300> AgradDistributionWiener_fv_6300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6301> AgradDistributionWiener_fv_6301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6302> AgradDistributionWiener_fv_6302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6303> AgradDistributionWiener_fv_6303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6304> AgradDistributionWiener_fv_6304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6305> AgradDistributionWiener_fv_6305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6306> AgradDistributionWiener_fv_6306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6307> AgradDistributionWiener_fv_6307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6308> AgradDistributionWiener_fv_6308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6309> AgradDistributionWiener_fv_6309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6310> AgradDistributionWiener_fv_6310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6311> AgradDistributionWiener_fv_6311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6312> AgradDistributionWiener_fv_6312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6313> AgradDistributionWiener_fv_6313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6314> AgradDistributionWiener_fv_6314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6315> AgradDistributionWiener_fv_6315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6316> AgradDistributionWiener_fv_6316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6317> AgradDistributionWiener_fv_6317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6318> AgradDistributionWiener_fv_6318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6319> AgradDistributionWiener_fv_6319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6320> AgradDistributionWiener_fv_6320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6321> AgradDistributionWiener_fv_6321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6322> AgradDistributionWiener_fv_6322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6323> AgradDistributionWiener_fv_6323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6324> AgradDistributionWiener_fv_6324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6325> AgradDistributionWiener_fv_6325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6326> AgradDistributionWiener_fv_6326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6327> AgradDistributionWiener_fv_6327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6328> AgradDistributionWiener_fv_6328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6329> AgradDistributionWiener_fv_6329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6330> AgradDistributionWiener_fv_6330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6331> AgradDistributionWiener_fv_6331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6332> AgradDistributionWiener_fv_6332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6333> AgradDistributionWiener_fv_6333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6334> AgradDistributionWiener_fv_6334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6335> AgradDistributionWiener_fv_6335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6336> AgradDistributionWiener_fv_6336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6337> AgradDistributionWiener_fv_6337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6338> AgradDistributionWiener_fv_6338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6339> AgradDistributionWiener_fv_6339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6340> AgradDistributionWiener_fv_6340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6341> AgradDistributionWiener_fv_6341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6342> AgradDistributionWiener_fv_6342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6343> AgradDistributionWiener_fv_6343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6344> AgradDistributionWiener_fv_6344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6345> AgradDistributionWiener_fv_6345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6346> AgradDistributionWiener_fv_6346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6347> AgradDistributionWiener_fv_6347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6348> AgradDistributionWiener_fv_6348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6349> AgradDistributionWiener_fv_6349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6350> AgradDistributionWiener_fv_6350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6351> AgradDistributionWiener_fv_6351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6352> AgradDistributionWiener_fv_6352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6353> AgradDistributionWiener_fv_6353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6354> AgradDistributionWiener_fv_6354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6355> AgradDistributionWiener_fv_6355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6356> AgradDistributionWiener_fv_6356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6357> AgradDistributionWiener_fv_6357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6358> AgradDistributionWiener_fv_6358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6359> AgradDistributionWiener_fv_6359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6360> AgradDistributionWiener_fv_6360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6361> AgradDistributionWiener_fv_6361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6362> AgradDistributionWiener_fv_6362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6363> AgradDistributionWiener_fv_6363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6364> AgradDistributionWiener_fv_6364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6365> AgradDistributionWiener_fv_6365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6366> AgradDistributionWiener_fv_6366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6367> AgradDistributionWiener_fv_6367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6368> AgradDistributionWiener_fv_6368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6369> AgradDistributionWiener_fv_6369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6370> AgradDistributionWiener_fv_6370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6371> AgradDistributionWiener_fv_6371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6372> AgradDistributionWiener_fv_6372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6373> AgradDistributionWiener_fv_6373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6374> AgradDistributionWiener_fv_6374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6375> AgradDistributionWiener_fv_6375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6376> AgradDistributionWiener_fv_6376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6377> AgradDistributionWiener_fv_6377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6378> AgradDistributionWiener_fv_6378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6379> AgradDistributionWiener_fv_6379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6380> AgradDistributionWiener_fv_6380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6381> AgradDistributionWiener_fv_6381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6382> AgradDistributionWiener_fv_6382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6383> AgradDistributionWiener_fv_6383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6384> AgradDistributionWiener_fv_6384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6385> AgradDistributionWiener_fv_6385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6386> AgradDistributionWiener_fv_6386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6387> AgradDistributionWiener_fv_6387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6388> AgradDistributionWiener_fv_6388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6389> AgradDistributionWiener_fv_6389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6390> AgradDistributionWiener_fv_6390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6391> AgradDistributionWiener_fv_6391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6392> AgradDistributionWiener_fv_6392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6393> AgradDistributionWiener_fv_6393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6394> AgradDistributionWiener_fv_6394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6395> AgradDistributionWiener_fv_6395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6396> AgradDistributionWiener_fv_6396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6397> AgradDistributionWiener_fv_6397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6398> AgradDistributionWiener_fv_6398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6399> AgradDistributionWiener_fv_6399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6300, AgradDistributionTestFixture, AgradDistributionWiener_fv_6300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6301, AgradDistributionTestFixture, AgradDistributionWiener_fv_6301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6302, AgradDistributionTestFixture, AgradDistributionWiener_fv_6302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6303, AgradDistributionTestFixture, AgradDistributionWiener_fv_6303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6304, AgradDistributionTestFixture, AgradDistributionWiener_fv_6304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6305, AgradDistributionTestFixture, AgradDistributionWiener_fv_6305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6306, AgradDistributionTestFixture, AgradDistributionWiener_fv_6306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6307, AgradDistributionTestFixture, AgradDistributionWiener_fv_6307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6308, AgradDistributionTestFixture, AgradDistributionWiener_fv_6308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6309, AgradDistributionTestFixture, AgradDistributionWiener_fv_6309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6310, AgradDistributionTestFixture, AgradDistributionWiener_fv_6310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6311, AgradDistributionTestFixture, AgradDistributionWiener_fv_6311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6312, AgradDistributionTestFixture, AgradDistributionWiener_fv_6312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6313, AgradDistributionTestFixture, AgradDistributionWiener_fv_6313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6314, AgradDistributionTestFixture, AgradDistributionWiener_fv_6314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6315, AgradDistributionTestFixture, AgradDistributionWiener_fv_6315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6316, AgradDistributionTestFixture, AgradDistributionWiener_fv_6316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6317, AgradDistributionTestFixture, AgradDistributionWiener_fv_6317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6318, AgradDistributionTestFixture, AgradDistributionWiener_fv_6318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6319, AgradDistributionTestFixture, AgradDistributionWiener_fv_6319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6320, AgradDistributionTestFixture, AgradDistributionWiener_fv_6320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6321, AgradDistributionTestFixture, AgradDistributionWiener_fv_6321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6322, AgradDistributionTestFixture, AgradDistributionWiener_fv_6322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6323, AgradDistributionTestFixture, AgradDistributionWiener_fv_6323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6324, AgradDistributionTestFixture, AgradDistributionWiener_fv_6324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6325, AgradDistributionTestFixture, AgradDistributionWiener_fv_6325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6326, AgradDistributionTestFixture, AgradDistributionWiener_fv_6326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6327, AgradDistributionTestFixture, AgradDistributionWiener_fv_6327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6328, AgradDistributionTestFixture, AgradDistributionWiener_fv_6328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6329, AgradDistributionTestFixture, AgradDistributionWiener_fv_6329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6330, AgradDistributionTestFixture, AgradDistributionWiener_fv_6330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6331, AgradDistributionTestFixture, AgradDistributionWiener_fv_6331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6332, AgradDistributionTestFixture, AgradDistributionWiener_fv_6332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6333, AgradDistributionTestFixture, AgradDistributionWiener_fv_6333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6334, AgradDistributionTestFixture, AgradDistributionWiener_fv_6334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6335, AgradDistributionTestFixture, AgradDistributionWiener_fv_6335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6336, AgradDistributionTestFixture, AgradDistributionWiener_fv_6336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6337, AgradDistributionTestFixture, AgradDistributionWiener_fv_6337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6338, AgradDistributionTestFixture, AgradDistributionWiener_fv_6338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6339, AgradDistributionTestFixture, AgradDistributionWiener_fv_6339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6340, AgradDistributionTestFixture, AgradDistributionWiener_fv_6340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6341, AgradDistributionTestFixture, AgradDistributionWiener_fv_6341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6342, AgradDistributionTestFixture, AgradDistributionWiener_fv_6342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6343, AgradDistributionTestFixture, AgradDistributionWiener_fv_6343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6344, AgradDistributionTestFixture, AgradDistributionWiener_fv_6344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6345, AgradDistributionTestFixture, AgradDistributionWiener_fv_6345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6346, AgradDistributionTestFixture, AgradDistributionWiener_fv_6346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6347, AgradDistributionTestFixture, AgradDistributionWiener_fv_6347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6348, AgradDistributionTestFixture, AgradDistributionWiener_fv_6348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6349, AgradDistributionTestFixture, AgradDistributionWiener_fv_6349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6350, AgradDistributionTestFixture, AgradDistributionWiener_fv_6350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6351, AgradDistributionTestFixture, AgradDistributionWiener_fv_6351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6352, AgradDistributionTestFixture, AgradDistributionWiener_fv_6352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6353, AgradDistributionTestFixture, AgradDistributionWiener_fv_6353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6354, AgradDistributionTestFixture, AgradDistributionWiener_fv_6354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6355, AgradDistributionTestFixture, AgradDistributionWiener_fv_6355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6356, AgradDistributionTestFixture, AgradDistributionWiener_fv_6356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6357, AgradDistributionTestFixture, AgradDistributionWiener_fv_6357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6358, AgradDistributionTestFixture, AgradDistributionWiener_fv_6358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6359, AgradDistributionTestFixture, AgradDistributionWiener_fv_6359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6360, AgradDistributionTestFixture, AgradDistributionWiener_fv_6360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6361, AgradDistributionTestFixture, AgradDistributionWiener_fv_6361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6362, AgradDistributionTestFixture, AgradDistributionWiener_fv_6362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6363, AgradDistributionTestFixture, AgradDistributionWiener_fv_6363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6364, AgradDistributionTestFixture, AgradDistributionWiener_fv_6364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6365, AgradDistributionTestFixture, AgradDistributionWiener_fv_6365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6366, AgradDistributionTestFixture, AgradDistributionWiener_fv_6366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6367, AgradDistributionTestFixture, AgradDistributionWiener_fv_6367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6368, AgradDistributionTestFixture, AgradDistributionWiener_fv_6368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6369, AgradDistributionTestFixture, AgradDistributionWiener_fv_6369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6370, AgradDistributionTestFixture, AgradDistributionWiener_fv_6370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6371, AgradDistributionTestFixture, AgradDistributionWiener_fv_6371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6372, AgradDistributionTestFixture, AgradDistributionWiener_fv_6372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6373, AgradDistributionTestFixture, AgradDistributionWiener_fv_6373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6374, AgradDistributionTestFixture, AgradDistributionWiener_fv_6374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6375, AgradDistributionTestFixture, AgradDistributionWiener_fv_6375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6376, AgradDistributionTestFixture, AgradDistributionWiener_fv_6376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6377, AgradDistributionTestFixture, AgradDistributionWiener_fv_6377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6378, AgradDistributionTestFixture, AgradDistributionWiener_fv_6378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6379, AgradDistributionTestFixture, AgradDistributionWiener_fv_6379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6380, AgradDistributionTestFixture, AgradDistributionWiener_fv_6380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6381, AgradDistributionTestFixture, AgradDistributionWiener_fv_6381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6382, AgradDistributionTestFixture, AgradDistributionWiener_fv_6382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6383, AgradDistributionTestFixture, AgradDistributionWiener_fv_6383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6384, AgradDistributionTestFixture, AgradDistributionWiener_fv_6384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6385, AgradDistributionTestFixture, AgradDistributionWiener_fv_6385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6386, AgradDistributionTestFixture, AgradDistributionWiener_fv_6386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6387, AgradDistributionTestFixture, AgradDistributionWiener_fv_6387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6388, AgradDistributionTestFixture, AgradDistributionWiener_fv_6388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6389, AgradDistributionTestFixture, AgradDistributionWiener_fv_6389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6390, AgradDistributionTestFixture, AgradDistributionWiener_fv_6390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6391, AgradDistributionTestFixture, AgradDistributionWiener_fv_6391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6392, AgradDistributionTestFixture, AgradDistributionWiener_fv_6392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6393, AgradDistributionTestFixture, AgradDistributionWiener_fv_6393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6394, AgradDistributionTestFixture, AgradDistributionWiener_fv_6394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6395, AgradDistributionTestFixture, AgradDistributionWiener_fv_6395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6396, AgradDistributionTestFixture, AgradDistributionWiener_fv_6396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6397, AgradDistributionTestFixture, AgradDistributionWiener_fv_6397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6398, AgradDistributionTestFixture, AgradDistributionWiener_fv_6398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6399, AgradDistributionTestFixture, AgradDistributionWiener_fv_6399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_6400;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6401;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_6402;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_6403;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6404;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_6405;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_6406;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6407;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_6408;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_6409;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6410;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_6411;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6412;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6413;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6414;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6415;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6416;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_6417;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_6418;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6419;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_6420;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_6421;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6422;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_6423;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_6424;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6425;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_6426;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_6427;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6428;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_6429;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6430;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6431;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6432;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6433;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6434;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_6435;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_6436;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6437;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_6438;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_6439;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6440;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_6441;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_6442;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6443;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_6444;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_6445;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6446;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_6447;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6448;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6449;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6450;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6451;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6452;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, double, empty> type_fd_6453;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, std::vector<double>, empty> type_fd_6454;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6455;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, fvar<double>, empty> type_fd_6456;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, std::vector<fvar<double>>, empty> type_fd_6457;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6458;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, double, empty> type_fd_6459;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, std::vector<double>, empty> type_fd_6460;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6461;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, fvar<double>, empty> type_fd_6462;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_6463;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6464;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_6465;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6466;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6467;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6468;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6469;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6470;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, double, empty> type_fd_6471;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, std::vector<double>, empty> type_fd_6472;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6473;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, fvar<double>, empty> type_fd_6474;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_6475;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6476;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, double, empty> type_fd_6477;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_6478;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6479;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_6480;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_6481;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6482;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_6483;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6484;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6485;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6486;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6487;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6488;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, double, empty> type_fd_6489;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, std::vector<double>, empty> type_fd_6490;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6491;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, fvar<double>, empty> type_fd_6492;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_6493;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6494;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, double, empty> type_fd_6495;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_6496;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6497;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_6498;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_6499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6400> AgradDistributionWiener_fd_6400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6401> AgradDistributionWiener_fd_6401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6402> AgradDistributionWiener_fd_6402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6403> AgradDistributionWiener_fd_6403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6404> AgradDistributionWiener_fd_6404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6405> AgradDistributionWiener_fd_6405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6406> AgradDistributionWiener_fd_6406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6407> AgradDistributionWiener_fd_6407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6408> AgradDistributionWiener_fd_6408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6409> AgradDistributionWiener_fd_6409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6410> AgradDistributionWiener_fd_6410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6411> AgradDistributionWiener_fd_6411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6412> AgradDistributionWiener_fd_6412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6413> AgradDistributionWiener_fd_6413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6414> AgradDistributionWiener_fd_6414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6415> AgradDistributionWiener_fd_6415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6416> AgradDistributionWiener_fd_6416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6417> AgradDistributionWiener_fd_6417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6418> AgradDistributionWiener_fd_6418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6419> AgradDistributionWiener_fd_6419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6420> AgradDistributionWiener_fd_6420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6421> AgradDistributionWiener_fd_6421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6422> AgradDistributionWiener_fd_6422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6423> AgradDistributionWiener_fd_6423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6424> AgradDistributionWiener_fd_6424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6425> AgradDistributionWiener_fd_6425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6426> AgradDistributionWiener_fd_6426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6427> AgradDistributionWiener_fd_6427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6428> AgradDistributionWiener_fd_6428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6429> AgradDistributionWiener_fd_6429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6430> AgradDistributionWiener_fd_6430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6431> AgradDistributionWiener_fd_6431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6432> AgradDistributionWiener_fd_6432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6433> AgradDistributionWiener_fd_6433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6434> AgradDistributionWiener_fd_6434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6435> AgradDistributionWiener_fd_6435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6436> AgradDistributionWiener_fd_6436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6437> AgradDistributionWiener_fd_6437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6438> AgradDistributionWiener_fd_6438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6439> AgradDistributionWiener_fd_6439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6440> AgradDistributionWiener_fd_6440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6441> AgradDistributionWiener_fd_6441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6442> AgradDistributionWiener_fd_6442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6443> AgradDistributionWiener_fd_6443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6444> AgradDistributionWiener_fd_6444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6445> AgradDistributionWiener_fd_6445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6446> AgradDistributionWiener_fd_6446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6447> AgradDistributionWiener_fd_6447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6448> AgradDistributionWiener_fd_6448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6449> AgradDistributionWiener_fd_6449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6450> AgradDistributionWiener_fd_6450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6451> AgradDistributionWiener_fd_6451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6452> AgradDistributionWiener_fd_6452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6453> AgradDistributionWiener_fd_6453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6454> AgradDistributionWiener_fd_6454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6455> AgradDistributionWiener_fd_6455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6456> AgradDistributionWiener_fd_6456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6457> AgradDistributionWiener_fd_6457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6458> AgradDistributionWiener_fd_6458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6459> AgradDistributionWiener_fd_6459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6460> AgradDistributionWiener_fd_6460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6461> AgradDistributionWiener_fd_6461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6462> AgradDistributionWiener_fd_6462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6463> AgradDistributionWiener_fd_6463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6464> AgradDistributionWiener_fd_6464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6465> AgradDistributionWiener_fd_6465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6466> AgradDistributionWiener_fd_6466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6467> AgradDistributionWiener_fd_6467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6468> AgradDistributionWiener_fd_6468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6469> AgradDistributionWiener_fd_6469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6470> AgradDistributionWiener_fd_6470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6471> AgradDistributionWiener_fd_6471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6472> AgradDistributionWiener_fd_6472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6473> AgradDistributionWiener_fd_6473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6474> AgradDistributionWiener_fd_6474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6475> AgradDistributionWiener_fd_6475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6476> AgradDistributionWiener_fd_6476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6477> AgradDistributionWiener_fd_6477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6478> AgradDistributionWiener_fd_6478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6479> AgradDistributionWiener_fd_6479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6480> AgradDistributionWiener_fd_6480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6481> AgradDistributionWiener_fd_6481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6482> AgradDistributionWiener_fd_6482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6483> AgradDistributionWiener_fd_6483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6484> AgradDistributionWiener_fd_6484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6485> AgradDistributionWiener_fd_6485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6486> AgradDistributionWiener_fd_6486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6487> AgradDistributionWiener_fd_6487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6488> AgradDistributionWiener_fd_6488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6489> AgradDistributionWiener_fd_6489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6490> AgradDistributionWiener_fd_6490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6491> AgradDistributionWiener_fd_6491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6492> AgradDistributionWiener_fd_6492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6493> AgradDistributionWiener_fd_6493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6494> AgradDistributionWiener_fd_6494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6495> AgradDistributionWiener_fd_6495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6496> AgradDistributionWiener_fd_6496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6497> AgradDistributionWiener_fd_6497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6498> AgradDistributionWiener_fd_6498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6499> AgradDistributionWiener_fd_6499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6400, AgradDistributionTestFixture, AgradDistributionWiener_fd_6400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6401, AgradDistributionTestFixture, AgradDistributionWiener_fd_6401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6402, AgradDistributionTestFixture, AgradDistributionWiener_fd_6402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6403, AgradDistributionTestFixture, AgradDistributionWiener_fd_6403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6404, AgradDistributionTestFixture, AgradDistributionWiener_fd_6404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6405, AgradDistributionTestFixture, AgradDistributionWiener_fd_6405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6406, AgradDistributionTestFixture, AgradDistributionWiener_fd_6406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6407, AgradDistributionTestFixture, AgradDistributionWiener_fd_6407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6408, AgradDistributionTestFixture, AgradDistributionWiener_fd_6408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6409, AgradDistributionTestFixture, AgradDistributionWiener_fd_6409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6410, AgradDistributionTestFixture, AgradDistributionWiener_fd_6410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6411, AgradDistributionTestFixture, AgradDistributionWiener_fd_6411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6412, AgradDistributionTestFixture, AgradDistributionWiener_fd_6412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6413, AgradDistributionTestFixture, AgradDistributionWiener_fd_6413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6414, AgradDistributionTestFixture, AgradDistributionWiener_fd_6414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6415, AgradDistributionTestFixture, AgradDistributionWiener_fd_6415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6416, AgradDistributionTestFixture, AgradDistributionWiener_fd_6416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6417, AgradDistributionTestFixture, AgradDistributionWiener_fd_6417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6418, AgradDistributionTestFixture, AgradDistributionWiener_fd_6418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6419, AgradDistributionTestFixture, AgradDistributionWiener_fd_6419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6420, AgradDistributionTestFixture, AgradDistributionWiener_fd_6420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6421, AgradDistributionTestFixture, AgradDistributionWiener_fd_6421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6422, AgradDistributionTestFixture, AgradDistributionWiener_fd_6422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6423, AgradDistributionTestFixture, AgradDistributionWiener_fd_6423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6424, AgradDistributionTestFixture, AgradDistributionWiener_fd_6424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6425, AgradDistributionTestFixture, AgradDistributionWiener_fd_6425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6426, AgradDistributionTestFixture, AgradDistributionWiener_fd_6426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6427, AgradDistributionTestFixture, AgradDistributionWiener_fd_6427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6428, AgradDistributionTestFixture, AgradDistributionWiener_fd_6428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6429, AgradDistributionTestFixture, AgradDistributionWiener_fd_6429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6430, AgradDistributionTestFixture, AgradDistributionWiener_fd_6430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6431, AgradDistributionTestFixture, AgradDistributionWiener_fd_6431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6432, AgradDistributionTestFixture, AgradDistributionWiener_fd_6432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6433, AgradDistributionTestFixture, AgradDistributionWiener_fd_6433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6434, AgradDistributionTestFixture, AgradDistributionWiener_fd_6434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6435, AgradDistributionTestFixture, AgradDistributionWiener_fd_6435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6436, AgradDistributionTestFixture, AgradDistributionWiener_fd_6436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6437, AgradDistributionTestFixture, AgradDistributionWiener_fd_6437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6438, AgradDistributionTestFixture, AgradDistributionWiener_fd_6438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6439, AgradDistributionTestFixture, AgradDistributionWiener_fd_6439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6440, AgradDistributionTestFixture, AgradDistributionWiener_fd_6440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6441, AgradDistributionTestFixture, AgradDistributionWiener_fd_6441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6442, AgradDistributionTestFixture, AgradDistributionWiener_fd_6442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6443, AgradDistributionTestFixture, AgradDistributionWiener_fd_6443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6444, AgradDistributionTestFixture, AgradDistributionWiener_fd_6444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6445, AgradDistributionTestFixture, AgradDistributionWiener_fd_6445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6446, AgradDistributionTestFixture, AgradDistributionWiener_fd_6446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6447, AgradDistributionTestFixture, AgradDistributionWiener_fd_6447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6448, AgradDistributionTestFixture, AgradDistributionWiener_fd_6448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6449, AgradDistributionTestFixture, AgradDistributionWiener_fd_6449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6450, AgradDistributionTestFixture, AgradDistributionWiener_fd_6450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6451, AgradDistributionTestFixture, AgradDistributionWiener_fd_6451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6452, AgradDistributionTestFixture, AgradDistributionWiener_fd_6452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6453, AgradDistributionTestFixture, AgradDistributionWiener_fd_6453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6454, AgradDistributionTestFixture, AgradDistributionWiener_fd_6454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6455, AgradDistributionTestFixture, AgradDistributionWiener_fd_6455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6456, AgradDistributionTestFixture, AgradDistributionWiener_fd_6456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6457, AgradDistributionTestFixture, AgradDistributionWiener_fd_6457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6458, AgradDistributionTestFixture, AgradDistributionWiener_fd_6458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6459, AgradDistributionTestFixture, AgradDistributionWiener_fd_6459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6460, AgradDistributionTestFixture, AgradDistributionWiener_fd_6460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6461, AgradDistributionTestFixture, AgradDistributionWiener_fd_6461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6462, AgradDistributionTestFixture, AgradDistributionWiener_fd_6462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6463, AgradDistributionTestFixture, AgradDistributionWiener_fd_6463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6464, AgradDistributionTestFixture, AgradDistributionWiener_fd_6464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6465, AgradDistributionTestFixture, AgradDistributionWiener_fd_6465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6466, AgradDistributionTestFixture, AgradDistributionWiener_fd_6466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6467, AgradDistributionTestFixture, AgradDistributionWiener_fd_6467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6468, AgradDistributionTestFixture, AgradDistributionWiener_fd_6468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6469, AgradDistributionTestFixture, AgradDistributionWiener_fd_6469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6470, AgradDistributionTestFixture, AgradDistributionWiener_fd_6470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6471, AgradDistributionTestFixture, AgradDistributionWiener_fd_6471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6472, AgradDistributionTestFixture, AgradDistributionWiener_fd_6472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6473, AgradDistributionTestFixture, AgradDistributionWiener_fd_6473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6474, AgradDistributionTestFixture, AgradDistributionWiener_fd_6474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6475, AgradDistributionTestFixture, AgradDistributionWiener_fd_6475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6476, AgradDistributionTestFixture, AgradDistributionWiener_fd_6476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6477, AgradDistributionTestFixture, AgradDistributionWiener_fd_6477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6478, AgradDistributionTestFixture, AgradDistributionWiener_fd_6478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6479, AgradDistributionTestFixture, AgradDistributionWiener_fd_6479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6480, AgradDistributionTestFixture, AgradDistributionWiener_fd_6480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6481, AgradDistributionTestFixture, AgradDistributionWiener_fd_6481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6482, AgradDistributionTestFixture, AgradDistributionWiener_fd_6482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6483, AgradDistributionTestFixture, AgradDistributionWiener_fd_6483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6484, AgradDistributionTestFixture, AgradDistributionWiener_fd_6484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6485, AgradDistributionTestFixture, AgradDistributionWiener_fd_6485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6486, AgradDistributionTestFixture, AgradDistributionWiener_fd_6486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6487, AgradDistributionTestFixture, AgradDistributionWiener_fd_6487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6488, AgradDistributionTestFixture, AgradDistributionWiener_fd_6488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6489, AgradDistributionTestFixture, AgradDistributionWiener_fd_6489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6490, AgradDistributionTestFixture, AgradDistributionWiener_fd_6490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6491, AgradDistributionTestFixture, AgradDistributionWiener_fd_6491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6492, AgradDistributionTestFixture, AgradDistributionWiener_fd_6492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6493, AgradDistributionTestFixture, AgradDistributionWiener_fd_6493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6494, AgradDistributionTestFixture, AgradDistributionWiener_fd_6494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6495, AgradDistributionTestFixture, AgradDistributionWiener_fd_6495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6496, AgradDistributionTestFixture, AgradDistributionWiener_fd_6496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6497, AgradDistributionTestFixture, AgradDistributionWiener_fd_6497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6498, AgradDistributionTestFixture, AgradDistributionWiener_fd_6498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6499, AgradDistributionTestFixture, AgradDistributionWiener_fd_6499);
+
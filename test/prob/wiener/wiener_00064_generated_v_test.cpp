@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_6400;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6401;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_6402;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_6403;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6404;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_6405;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_6406;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6407;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_6408;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_6409;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6410;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_6411;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_6412;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6413;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_6414;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_6415;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6416;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_6417;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_6418;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6419;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_6420;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_6421;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6422;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_6423;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_6424;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6425;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_6426;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_6427;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6428;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_6429;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_6430;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6431;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_6432;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_6433;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6434;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_6435;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_6436;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6437;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_6438;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_6439;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6440;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_6441;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_6442;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6443;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_6444;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_6445;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6446;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_6447;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_6448;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6449;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_6450;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_6451;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6452;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_6453;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_6454;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6455;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_6456;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_6457;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6458;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_6459;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_6460;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6461;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_6462;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_6463;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6464;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_6465;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_6466;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6467;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_6468;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_6469;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6470;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_6471;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_6472;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6473;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_6474;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_6475;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6476;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_6477;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_6478;
+typedef boost::mpl::vector<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6479;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, double, empty> type_v_6480;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, std::vector<double>, empty> type_v_6481;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6482;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, var, empty> type_v_6483;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, std::vector<var>, empty> type_v_6484;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6485;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, double, empty> type_v_6486;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, std::vector<double>, empty> type_v_6487;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6488;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, var, empty> type_v_6489;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, std::vector<var>, empty> type_v_6490;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6491;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_6492;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_6493;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_6494;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_6495;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_6496;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_6497;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, var, double, empty> type_v_6498;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, var, std::vector<double>, empty> type_v_6499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6400> AgradDistributionWiener_v_6400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6401> AgradDistributionWiener_v_6401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6402> AgradDistributionWiener_v_6402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6403> AgradDistributionWiener_v_6403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6404> AgradDistributionWiener_v_6404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6405> AgradDistributionWiener_v_6405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6406> AgradDistributionWiener_v_6406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6407> AgradDistributionWiener_v_6407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6408> AgradDistributionWiener_v_6408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6409> AgradDistributionWiener_v_6409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6410> AgradDistributionWiener_v_6410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6411> AgradDistributionWiener_v_6411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6412> AgradDistributionWiener_v_6412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6413> AgradDistributionWiener_v_6413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6414> AgradDistributionWiener_v_6414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6415> AgradDistributionWiener_v_6415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6416> AgradDistributionWiener_v_6416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6417> AgradDistributionWiener_v_6417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6418> AgradDistributionWiener_v_6418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6419> AgradDistributionWiener_v_6419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6420> AgradDistributionWiener_v_6420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6421> AgradDistributionWiener_v_6421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6422> AgradDistributionWiener_v_6422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6423> AgradDistributionWiener_v_6423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6424> AgradDistributionWiener_v_6424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6425> AgradDistributionWiener_v_6425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6426> AgradDistributionWiener_v_6426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6427> AgradDistributionWiener_v_6427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6428> AgradDistributionWiener_v_6428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6429> AgradDistributionWiener_v_6429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6430> AgradDistributionWiener_v_6430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6431> AgradDistributionWiener_v_6431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6432> AgradDistributionWiener_v_6432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6433> AgradDistributionWiener_v_6433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6434> AgradDistributionWiener_v_6434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6435> AgradDistributionWiener_v_6435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6436> AgradDistributionWiener_v_6436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6437> AgradDistributionWiener_v_6437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6438> AgradDistributionWiener_v_6438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6439> AgradDistributionWiener_v_6439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6440> AgradDistributionWiener_v_6440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6441> AgradDistributionWiener_v_6441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6442> AgradDistributionWiener_v_6442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6443> AgradDistributionWiener_v_6443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6444> AgradDistributionWiener_v_6444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6445> AgradDistributionWiener_v_6445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6446> AgradDistributionWiener_v_6446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6447> AgradDistributionWiener_v_6447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6448> AgradDistributionWiener_v_6448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6449> AgradDistributionWiener_v_6449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6450> AgradDistributionWiener_v_6450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6451> AgradDistributionWiener_v_6451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6452> AgradDistributionWiener_v_6452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6453> AgradDistributionWiener_v_6453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6454> AgradDistributionWiener_v_6454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6455> AgradDistributionWiener_v_6455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6456> AgradDistributionWiener_v_6456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6457> AgradDistributionWiener_v_6457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6458> AgradDistributionWiener_v_6458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6459> AgradDistributionWiener_v_6459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6460> AgradDistributionWiener_v_6460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6461> AgradDistributionWiener_v_6461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6462> AgradDistributionWiener_v_6462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6463> AgradDistributionWiener_v_6463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6464> AgradDistributionWiener_v_6464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6465> AgradDistributionWiener_v_6465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6466> AgradDistributionWiener_v_6466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6467> AgradDistributionWiener_v_6467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6468> AgradDistributionWiener_v_6468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6469> AgradDistributionWiener_v_6469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6470> AgradDistributionWiener_v_6470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6471> AgradDistributionWiener_v_6471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6472> AgradDistributionWiener_v_6472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6473> AgradDistributionWiener_v_6473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6474> AgradDistributionWiener_v_6474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6475> AgradDistributionWiener_v_6475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6476> AgradDistributionWiener_v_6476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6477> AgradDistributionWiener_v_6477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6478> AgradDistributionWiener_v_6478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6479> AgradDistributionWiener_v_6479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6480> AgradDistributionWiener_v_6480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6481> AgradDistributionWiener_v_6481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6482> AgradDistributionWiener_v_6482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6483> AgradDistributionWiener_v_6483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6484> AgradDistributionWiener_v_6484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6485> AgradDistributionWiener_v_6485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6486> AgradDistributionWiener_v_6486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6487> AgradDistributionWiener_v_6487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6488> AgradDistributionWiener_v_6488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6489> AgradDistributionWiener_v_6489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6490> AgradDistributionWiener_v_6490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6491> AgradDistributionWiener_v_6491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6492> AgradDistributionWiener_v_6492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6493> AgradDistributionWiener_v_6493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6494> AgradDistributionWiener_v_6494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6495> AgradDistributionWiener_v_6495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6496> AgradDistributionWiener_v_6496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6497> AgradDistributionWiener_v_6497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6498> AgradDistributionWiener_v_6498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_6499> AgradDistributionWiener_v_6499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6400, AgradDistributionTestFixture, AgradDistributionWiener_v_6400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6401, AgradDistributionTestFixture, AgradDistributionWiener_v_6401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6402, AgradDistributionTestFixture, AgradDistributionWiener_v_6402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6403, AgradDistributionTestFixture, AgradDistributionWiener_v_6403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6404, AgradDistributionTestFixture, AgradDistributionWiener_v_6404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6405, AgradDistributionTestFixture, AgradDistributionWiener_v_6405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6406, AgradDistributionTestFixture, AgradDistributionWiener_v_6406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6407, AgradDistributionTestFixture, AgradDistributionWiener_v_6407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6408, AgradDistributionTestFixture, AgradDistributionWiener_v_6408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6409, AgradDistributionTestFixture, AgradDistributionWiener_v_6409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6410, AgradDistributionTestFixture, AgradDistributionWiener_v_6410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6411, AgradDistributionTestFixture, AgradDistributionWiener_v_6411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6412, AgradDistributionTestFixture, AgradDistributionWiener_v_6412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6413, AgradDistributionTestFixture, AgradDistributionWiener_v_6413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6414, AgradDistributionTestFixture, AgradDistributionWiener_v_6414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6415, AgradDistributionTestFixture, AgradDistributionWiener_v_6415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6416, AgradDistributionTestFixture, AgradDistributionWiener_v_6416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6417, AgradDistributionTestFixture, AgradDistributionWiener_v_6417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6418, AgradDistributionTestFixture, AgradDistributionWiener_v_6418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6419, AgradDistributionTestFixture, AgradDistributionWiener_v_6419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6420, AgradDistributionTestFixture, AgradDistributionWiener_v_6420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6421, AgradDistributionTestFixture, AgradDistributionWiener_v_6421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6422, AgradDistributionTestFixture, AgradDistributionWiener_v_6422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6423, AgradDistributionTestFixture, AgradDistributionWiener_v_6423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6424, AgradDistributionTestFixture, AgradDistributionWiener_v_6424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6425, AgradDistributionTestFixture, AgradDistributionWiener_v_6425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6426, AgradDistributionTestFixture, AgradDistributionWiener_v_6426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6427, AgradDistributionTestFixture, AgradDistributionWiener_v_6427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6428, AgradDistributionTestFixture, AgradDistributionWiener_v_6428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6429, AgradDistributionTestFixture, AgradDistributionWiener_v_6429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6430, AgradDistributionTestFixture, AgradDistributionWiener_v_6430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6431, AgradDistributionTestFixture, AgradDistributionWiener_v_6431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6432, AgradDistributionTestFixture, AgradDistributionWiener_v_6432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6433, AgradDistributionTestFixture, AgradDistributionWiener_v_6433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6434, AgradDistributionTestFixture, AgradDistributionWiener_v_6434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6435, AgradDistributionTestFixture, AgradDistributionWiener_v_6435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6436, AgradDistributionTestFixture, AgradDistributionWiener_v_6436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6437, AgradDistributionTestFixture, AgradDistributionWiener_v_6437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6438, AgradDistributionTestFixture, AgradDistributionWiener_v_6438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6439, AgradDistributionTestFixture, AgradDistributionWiener_v_6439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6440, AgradDistributionTestFixture, AgradDistributionWiener_v_6440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6441, AgradDistributionTestFixture, AgradDistributionWiener_v_6441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6442, AgradDistributionTestFixture, AgradDistributionWiener_v_6442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6443, AgradDistributionTestFixture, AgradDistributionWiener_v_6443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6444, AgradDistributionTestFixture, AgradDistributionWiener_v_6444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6445, AgradDistributionTestFixture, AgradDistributionWiener_v_6445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6446, AgradDistributionTestFixture, AgradDistributionWiener_v_6446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6447, AgradDistributionTestFixture, AgradDistributionWiener_v_6447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6448, AgradDistributionTestFixture, AgradDistributionWiener_v_6448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6449, AgradDistributionTestFixture, AgradDistributionWiener_v_6449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6450, AgradDistributionTestFixture, AgradDistributionWiener_v_6450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6451, AgradDistributionTestFixture, AgradDistributionWiener_v_6451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6452, AgradDistributionTestFixture, AgradDistributionWiener_v_6452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6453, AgradDistributionTestFixture, AgradDistributionWiener_v_6453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6454, AgradDistributionTestFixture, AgradDistributionWiener_v_6454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6455, AgradDistributionTestFixture, AgradDistributionWiener_v_6455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6456, AgradDistributionTestFixture, AgradDistributionWiener_v_6456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6457, AgradDistributionTestFixture, AgradDistributionWiener_v_6457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6458, AgradDistributionTestFixture, AgradDistributionWiener_v_6458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6459, AgradDistributionTestFixture, AgradDistributionWiener_v_6459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6460, AgradDistributionTestFixture, AgradDistributionWiener_v_6460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6461, AgradDistributionTestFixture, AgradDistributionWiener_v_6461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6462, AgradDistributionTestFixture, AgradDistributionWiener_v_6462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6463, AgradDistributionTestFixture, AgradDistributionWiener_v_6463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6464, AgradDistributionTestFixture, AgradDistributionWiener_v_6464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6465, AgradDistributionTestFixture, AgradDistributionWiener_v_6465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6466, AgradDistributionTestFixture, AgradDistributionWiener_v_6466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6467, AgradDistributionTestFixture, AgradDistributionWiener_v_6467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6468, AgradDistributionTestFixture, AgradDistributionWiener_v_6468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6469, AgradDistributionTestFixture, AgradDistributionWiener_v_6469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6470, AgradDistributionTestFixture, AgradDistributionWiener_v_6470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6471, AgradDistributionTestFixture, AgradDistributionWiener_v_6471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6472, AgradDistributionTestFixture, AgradDistributionWiener_v_6472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6473, AgradDistributionTestFixture, AgradDistributionWiener_v_6473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6474, AgradDistributionTestFixture, AgradDistributionWiener_v_6474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6475, AgradDistributionTestFixture, AgradDistributionWiener_v_6475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6476, AgradDistributionTestFixture, AgradDistributionWiener_v_6476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6477, AgradDistributionTestFixture, AgradDistributionWiener_v_6477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6478, AgradDistributionTestFixture, AgradDistributionWiener_v_6478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6479, AgradDistributionTestFixture, AgradDistributionWiener_v_6479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6480, AgradDistributionTestFixture, AgradDistributionWiener_v_6480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6481, AgradDistributionTestFixture, AgradDistributionWiener_v_6481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6482, AgradDistributionTestFixture, AgradDistributionWiener_v_6482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6483, AgradDistributionTestFixture, AgradDistributionWiener_v_6483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6484, AgradDistributionTestFixture, AgradDistributionWiener_v_6484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6485, AgradDistributionTestFixture, AgradDistributionWiener_v_6485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6486, AgradDistributionTestFixture, AgradDistributionWiener_v_6486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6487, AgradDistributionTestFixture, AgradDistributionWiener_v_6487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6488, AgradDistributionTestFixture, AgradDistributionWiener_v_6488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6489, AgradDistributionTestFixture, AgradDistributionWiener_v_6489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6490, AgradDistributionTestFixture, AgradDistributionWiener_v_6490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6491, AgradDistributionTestFixture, AgradDistributionWiener_v_6491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6492, AgradDistributionTestFixture, AgradDistributionWiener_v_6492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6493, AgradDistributionTestFixture, AgradDistributionWiener_v_6493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6494, AgradDistributionTestFixture, AgradDistributionWiener_v_6494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6495, AgradDistributionTestFixture, AgradDistributionWiener_v_6495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6496, AgradDistributionTestFixture, AgradDistributionWiener_v_6496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6497, AgradDistributionTestFixture, AgradDistributionWiener_v_6497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6498, AgradDistributionTestFixture, AgradDistributionWiener_v_6498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_6499, AgradDistributionTestFixture, AgradDistributionWiener_v_6499);
+
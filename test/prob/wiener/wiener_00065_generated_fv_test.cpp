@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6500;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6501;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6502;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6503;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6504;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6505;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6506;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, double, empty> type_fv_6507;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_6508;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6509;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_6510;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6511;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6512;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_6513;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6514;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6515;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6516;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6517;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6518;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6519;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6520;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6521;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6522;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6523;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6524;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_6525;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_6526;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6527;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_6528;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_6529;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6530;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_6531;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_6532;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6533;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_6534;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6535;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6536;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6537;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6538;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6539;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6540;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6541;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6542;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6543;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6544;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6545;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6546;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6547;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6548;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6549;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6550;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6551;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6552;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6553;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6554;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6555;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6556;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6557;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6558;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6559;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6560;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, double, empty> type_fv_6561;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, std::vector<double>, empty> type_fv_6562;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6563;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, fvar<var>, empty> type_fv_6564;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_6565;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6566;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, double, empty> type_fv_6567;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_6568;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6569;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_6570;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6571;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6572;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6573;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6574;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6575;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6576;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6577;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6578;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, double, empty> type_fv_6579;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_6580;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6581;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_6582;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6583;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6584;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_6585;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6586;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6587;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6588;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6589;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6590;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6591;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6592;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6593;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6594;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6595;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6596;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, double, empty> type_fv_6597;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_6598;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6500> AgradDistributionWiener_fv_6500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6501> AgradDistributionWiener_fv_6501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6502> AgradDistributionWiener_fv_6502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6503> AgradDistributionWiener_fv_6503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6504> AgradDistributionWiener_fv_6504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6505> AgradDistributionWiener_fv_6505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6506> AgradDistributionWiener_fv_6506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6507> AgradDistributionWiener_fv_6507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6508> AgradDistributionWiener_fv_6508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6509> AgradDistributionWiener_fv_6509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6510> AgradDistributionWiener_fv_6510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6511> AgradDistributionWiener_fv_6511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6512> AgradDistributionWiener_fv_6512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6513> AgradDistributionWiener_fv_6513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6514> AgradDistributionWiener_fv_6514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6515> AgradDistributionWiener_fv_6515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6516> AgradDistributionWiener_fv_6516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6517> AgradDistributionWiener_fv_6517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6518> AgradDistributionWiener_fv_6518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6519> AgradDistributionWiener_fv_6519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6520> AgradDistributionWiener_fv_6520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6521> AgradDistributionWiener_fv_6521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6522> AgradDistributionWiener_fv_6522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6523> AgradDistributionWiener_fv_6523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6524> AgradDistributionWiener_fv_6524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6525> AgradDistributionWiener_fv_6525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6526> AgradDistributionWiener_fv_6526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6527> AgradDistributionWiener_fv_6527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6528> AgradDistributionWiener_fv_6528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6529> AgradDistributionWiener_fv_6529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6530> AgradDistributionWiener_fv_6530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6531> AgradDistributionWiener_fv_6531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6532> AgradDistributionWiener_fv_6532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6533> AgradDistributionWiener_fv_6533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6534> AgradDistributionWiener_fv_6534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6535> AgradDistributionWiener_fv_6535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6536> AgradDistributionWiener_fv_6536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6537> AgradDistributionWiener_fv_6537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6538> AgradDistributionWiener_fv_6538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6539> AgradDistributionWiener_fv_6539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6540> AgradDistributionWiener_fv_6540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6541> AgradDistributionWiener_fv_6541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6542> AgradDistributionWiener_fv_6542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6543> AgradDistributionWiener_fv_6543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6544> AgradDistributionWiener_fv_6544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6545> AgradDistributionWiener_fv_6545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6546> AgradDistributionWiener_fv_6546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6547> AgradDistributionWiener_fv_6547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6548> AgradDistributionWiener_fv_6548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6549> AgradDistributionWiener_fv_6549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6550> AgradDistributionWiener_fv_6550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6551> AgradDistributionWiener_fv_6551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6552> AgradDistributionWiener_fv_6552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6553> AgradDistributionWiener_fv_6553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6554> AgradDistributionWiener_fv_6554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6555> AgradDistributionWiener_fv_6555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6556> AgradDistributionWiener_fv_6556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6557> AgradDistributionWiener_fv_6557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6558> AgradDistributionWiener_fv_6558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6559> AgradDistributionWiener_fv_6559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6560> AgradDistributionWiener_fv_6560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6561> AgradDistributionWiener_fv_6561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6562> AgradDistributionWiener_fv_6562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6563> AgradDistributionWiener_fv_6563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6564> AgradDistributionWiener_fv_6564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6565> AgradDistributionWiener_fv_6565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6566> AgradDistributionWiener_fv_6566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6567> AgradDistributionWiener_fv_6567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6568> AgradDistributionWiener_fv_6568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6569> AgradDistributionWiener_fv_6569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6570> AgradDistributionWiener_fv_6570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6571> AgradDistributionWiener_fv_6571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6572> AgradDistributionWiener_fv_6572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6573> AgradDistributionWiener_fv_6573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6574> AgradDistributionWiener_fv_6574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6575> AgradDistributionWiener_fv_6575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6576> AgradDistributionWiener_fv_6576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6577> AgradDistributionWiener_fv_6577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6578> AgradDistributionWiener_fv_6578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6579> AgradDistributionWiener_fv_6579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6580> AgradDistributionWiener_fv_6580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6581> AgradDistributionWiener_fv_6581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6582> AgradDistributionWiener_fv_6582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6583> AgradDistributionWiener_fv_6583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6584> AgradDistributionWiener_fv_6584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6585> AgradDistributionWiener_fv_6585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6586> AgradDistributionWiener_fv_6586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6587> AgradDistributionWiener_fv_6587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6588> AgradDistributionWiener_fv_6588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6589> AgradDistributionWiener_fv_6589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6590> AgradDistributionWiener_fv_6590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6591> AgradDistributionWiener_fv_6591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6592> AgradDistributionWiener_fv_6592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6593> AgradDistributionWiener_fv_6593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6594> AgradDistributionWiener_fv_6594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6595> AgradDistributionWiener_fv_6595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6596> AgradDistributionWiener_fv_6596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6597> AgradDistributionWiener_fv_6597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6598> AgradDistributionWiener_fv_6598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6599> AgradDistributionWiener_fv_6599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6500, AgradDistributionTestFixture, AgradDistributionWiener_fv_6500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6501, AgradDistributionTestFixture, AgradDistributionWiener_fv_6501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6502, AgradDistributionTestFixture, AgradDistributionWiener_fv_6502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6503, AgradDistributionTestFixture, AgradDistributionWiener_fv_6503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6504, AgradDistributionTestFixture, AgradDistributionWiener_fv_6504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6505, AgradDistributionTestFixture, AgradDistributionWiener_fv_6505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6506, AgradDistributionTestFixture, AgradDistributionWiener_fv_6506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6507, AgradDistributionTestFixture, AgradDistributionWiener_fv_6507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6508, AgradDistributionTestFixture, AgradDistributionWiener_fv_6508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6509, AgradDistributionTestFixture, AgradDistributionWiener_fv_6509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6510, AgradDistributionTestFixture, AgradDistributionWiener_fv_6510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6511, AgradDistributionTestFixture, AgradDistributionWiener_fv_6511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6512, AgradDistributionTestFixture, AgradDistributionWiener_fv_6512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6513, AgradDistributionTestFixture, AgradDistributionWiener_fv_6513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6514, AgradDistributionTestFixture, AgradDistributionWiener_fv_6514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6515, AgradDistributionTestFixture, AgradDistributionWiener_fv_6515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6516, AgradDistributionTestFixture, AgradDistributionWiener_fv_6516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6517, AgradDistributionTestFixture, AgradDistributionWiener_fv_6517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6518, AgradDistributionTestFixture, AgradDistributionWiener_fv_6518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6519, AgradDistributionTestFixture, AgradDistributionWiener_fv_6519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6520, AgradDistributionTestFixture, AgradDistributionWiener_fv_6520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6521, AgradDistributionTestFixture, AgradDistributionWiener_fv_6521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6522, AgradDistributionTestFixture, AgradDistributionWiener_fv_6522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6523, AgradDistributionTestFixture, AgradDistributionWiener_fv_6523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6524, AgradDistributionTestFixture, AgradDistributionWiener_fv_6524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6525, AgradDistributionTestFixture, AgradDistributionWiener_fv_6525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6526, AgradDistributionTestFixture, AgradDistributionWiener_fv_6526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6527, AgradDistributionTestFixture, AgradDistributionWiener_fv_6527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6528, AgradDistributionTestFixture, AgradDistributionWiener_fv_6528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6529, AgradDistributionTestFixture, AgradDistributionWiener_fv_6529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6530, AgradDistributionTestFixture, AgradDistributionWiener_fv_6530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6531, AgradDistributionTestFixture, AgradDistributionWiener_fv_6531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6532, AgradDistributionTestFixture, AgradDistributionWiener_fv_6532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6533, AgradDistributionTestFixture, AgradDistributionWiener_fv_6533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6534, AgradDistributionTestFixture, AgradDistributionWiener_fv_6534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6535, AgradDistributionTestFixture, AgradDistributionWiener_fv_6535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6536, AgradDistributionTestFixture, AgradDistributionWiener_fv_6536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6537, AgradDistributionTestFixture, AgradDistributionWiener_fv_6537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6538, AgradDistributionTestFixture, AgradDistributionWiener_fv_6538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6539, AgradDistributionTestFixture, AgradDistributionWiener_fv_6539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6540, AgradDistributionTestFixture, AgradDistributionWiener_fv_6540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6541, AgradDistributionTestFixture, AgradDistributionWiener_fv_6541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6542, AgradDistributionTestFixture, AgradDistributionWiener_fv_6542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6543, AgradDistributionTestFixture, AgradDistributionWiener_fv_6543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6544, AgradDistributionTestFixture, AgradDistributionWiener_fv_6544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6545, AgradDistributionTestFixture, AgradDistributionWiener_fv_6545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6546, AgradDistributionTestFixture, AgradDistributionWiener_fv_6546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6547, AgradDistributionTestFixture, AgradDistributionWiener_fv_6547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6548, AgradDistributionTestFixture, AgradDistributionWiener_fv_6548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6549, AgradDistributionTestFixture, AgradDistributionWiener_fv_6549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6550, AgradDistributionTestFixture, AgradDistributionWiener_fv_6550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6551, AgradDistributionTestFixture, AgradDistributionWiener_fv_6551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6552, AgradDistributionTestFixture, AgradDistributionWiener_fv_6552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6553, AgradDistributionTestFixture, AgradDistributionWiener_fv_6553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6554, AgradDistributionTestFixture, AgradDistributionWiener_fv_6554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6555, AgradDistributionTestFixture, AgradDistributionWiener_fv_6555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6556, AgradDistributionTestFixture, AgradDistributionWiener_fv_6556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6557, AgradDistributionTestFixture, AgradDistributionWiener_fv_6557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6558, AgradDistributionTestFixture, AgradDistributionWiener_fv_6558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6559, AgradDistributionTestFixture, AgradDistributionWiener_fv_6559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6560, AgradDistributionTestFixture, AgradDistributionWiener_fv_6560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6561, AgradDistributionTestFixture, AgradDistributionWiener_fv_6561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6562, AgradDistributionTestFixture, AgradDistributionWiener_fv_6562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6563, AgradDistributionTestFixture, AgradDistributionWiener_fv_6563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6564, AgradDistributionTestFixture, AgradDistributionWiener_fv_6564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6565, AgradDistributionTestFixture, AgradDistributionWiener_fv_6565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6566, AgradDistributionTestFixture, AgradDistributionWiener_fv_6566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6567, AgradDistributionTestFixture, AgradDistributionWiener_fv_6567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6568, AgradDistributionTestFixture, AgradDistributionWiener_fv_6568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6569, AgradDistributionTestFixture, AgradDistributionWiener_fv_6569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6570, AgradDistributionTestFixture, AgradDistributionWiener_fv_6570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6571, AgradDistributionTestFixture, AgradDistributionWiener_fv_6571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6572, AgradDistributionTestFixture, AgradDistributionWiener_fv_6572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6573, AgradDistributionTestFixture, AgradDistributionWiener_fv_6573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6574, AgradDistributionTestFixture, AgradDistributionWiener_fv_6574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6575, AgradDistributionTestFixture, AgradDistributionWiener_fv_6575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6576, AgradDistributionTestFixture, AgradDistributionWiener_fv_6576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6577, AgradDistributionTestFixture, AgradDistributionWiener_fv_6577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6578, AgradDistributionTestFixture, AgradDistributionWiener_fv_6578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6579, AgradDistributionTestFixture, AgradDistributionWiener_fv_6579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6580, AgradDistributionTestFixture, AgradDistributionWiener_fv_6580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6581, AgradDistributionTestFixture, AgradDistributionWiener_fv_6581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6582, AgradDistributionTestFixture, AgradDistributionWiener_fv_6582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6583, AgradDistributionTestFixture, AgradDistributionWiener_fv_6583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6584, AgradDistributionTestFixture, AgradDistributionWiener_fv_6584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6585, AgradDistributionTestFixture, AgradDistributionWiener_fv_6585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6586, AgradDistributionTestFixture, AgradDistributionWiener_fv_6586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6587, AgradDistributionTestFixture, AgradDistributionWiener_fv_6587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6588, AgradDistributionTestFixture, AgradDistributionWiener_fv_6588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6589, AgradDistributionTestFixture, AgradDistributionWiener_fv_6589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6590, AgradDistributionTestFixture, AgradDistributionWiener_fv_6590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6591, AgradDistributionTestFixture, AgradDistributionWiener_fv_6591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6592, AgradDistributionTestFixture, AgradDistributionWiener_fv_6592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6593, AgradDistributionTestFixture, AgradDistributionWiener_fv_6593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6594, AgradDistributionTestFixture, AgradDistributionWiener_fv_6594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6595, AgradDistributionTestFixture, AgradDistributionWiener_fv_6595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6596, AgradDistributionTestFixture, AgradDistributionWiener_fv_6596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6597, AgradDistributionTestFixture, AgradDistributionWiener_fv_6597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6598, AgradDistributionTestFixture, AgradDistributionWiener_fv_6598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6599, AgradDistributionTestFixture, AgradDistributionWiener_fv_6599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_6600;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_6601;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6602;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_6603;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_6604;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6605;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_6606;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_6607;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6608;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_6609;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6610;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6611;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6612;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6613;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6614;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_6615;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_6616;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6617;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_6618;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_6619;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6620;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_6621;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_6622;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6623;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_6624;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_6625;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6626;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_6627;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6628;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6629;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6630;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6631;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6632;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_6633;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_6634;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6635;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_6636;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_6637;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6638;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_6639;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_6640;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6641;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_6642;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_6643;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6644;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_6645;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6646;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6647;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6648;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6649;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6650;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_6651;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_6652;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6653;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_6654;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_6655;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6656;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_6657;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_6658;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6659;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_6660;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_6661;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6662;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_6663;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6664;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6665;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6666;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6667;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6668;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty> type_fd_6669;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_fd_6670;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6671;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<double>, empty> type_fd_6672;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<double>>, empty> type_fd_6673;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6674;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_fd_6675;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_fd_6676;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6677;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<double>, empty> type_fd_6678;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_6679;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6680;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_6681;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_6682;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6683;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_6684;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_6685;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6686;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, double, empty> type_fd_6687;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<double>, empty> type_fd_6688;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6689;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, fvar<double>, empty> type_fd_6690;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_6691;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6692;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, double, empty> type_fd_6693;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_6694;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_6695;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_6696;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_6697;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_6698;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_6699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6600> AgradDistributionWiener_fd_6600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6601> AgradDistributionWiener_fd_6601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6602> AgradDistributionWiener_fd_6602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6603> AgradDistributionWiener_fd_6603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6604> AgradDistributionWiener_fd_6604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6605> AgradDistributionWiener_fd_6605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6606> AgradDistributionWiener_fd_6606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6607> AgradDistributionWiener_fd_6607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6608> AgradDistributionWiener_fd_6608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6609> AgradDistributionWiener_fd_6609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6610> AgradDistributionWiener_fd_6610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6611> AgradDistributionWiener_fd_6611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6612> AgradDistributionWiener_fd_6612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6613> AgradDistributionWiener_fd_6613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6614> AgradDistributionWiener_fd_6614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6615> AgradDistributionWiener_fd_6615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6616> AgradDistributionWiener_fd_6616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6617> AgradDistributionWiener_fd_6617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6618> AgradDistributionWiener_fd_6618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6619> AgradDistributionWiener_fd_6619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6620> AgradDistributionWiener_fd_6620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6621> AgradDistributionWiener_fd_6621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6622> AgradDistributionWiener_fd_6622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6623> AgradDistributionWiener_fd_6623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6624> AgradDistributionWiener_fd_6624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6625> AgradDistributionWiener_fd_6625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6626> AgradDistributionWiener_fd_6626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6627> AgradDistributionWiener_fd_6627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6628> AgradDistributionWiener_fd_6628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6629> AgradDistributionWiener_fd_6629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6630> AgradDistributionWiener_fd_6630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6631> AgradDistributionWiener_fd_6631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6632> AgradDistributionWiener_fd_6632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6633> AgradDistributionWiener_fd_6633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6634> AgradDistributionWiener_fd_6634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6635> AgradDistributionWiener_fd_6635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6636> AgradDistributionWiener_fd_6636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6637> AgradDistributionWiener_fd_6637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6638> AgradDistributionWiener_fd_6638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6639> AgradDistributionWiener_fd_6639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6640> AgradDistributionWiener_fd_6640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6641> AgradDistributionWiener_fd_6641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6642> AgradDistributionWiener_fd_6642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6643> AgradDistributionWiener_fd_6643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6644> AgradDistributionWiener_fd_6644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6645> AgradDistributionWiener_fd_6645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6646> AgradDistributionWiener_fd_6646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6647> AgradDistributionWiener_fd_6647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6648> AgradDistributionWiener_fd_6648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6649> AgradDistributionWiener_fd_6649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6650> AgradDistributionWiener_fd_6650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6651> AgradDistributionWiener_fd_6651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6652> AgradDistributionWiener_fd_6652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6653> AgradDistributionWiener_fd_6653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6654> AgradDistributionWiener_fd_6654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6655> AgradDistributionWiener_fd_6655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6656> AgradDistributionWiener_fd_6656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6657> AgradDistributionWiener_fd_6657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6658> AgradDistributionWiener_fd_6658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6659> AgradDistributionWiener_fd_6659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6660> AgradDistributionWiener_fd_6660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6661> AgradDistributionWiener_fd_6661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6662> AgradDistributionWiener_fd_6662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6663> AgradDistributionWiener_fd_6663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6664> AgradDistributionWiener_fd_6664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6665> AgradDistributionWiener_fd_6665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6666> AgradDistributionWiener_fd_6666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6667> AgradDistributionWiener_fd_6667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6668> AgradDistributionWiener_fd_6668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6669> AgradDistributionWiener_fd_6669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6670> AgradDistributionWiener_fd_6670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6671> AgradDistributionWiener_fd_6671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6672> AgradDistributionWiener_fd_6672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6673> AgradDistributionWiener_fd_6673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6674> AgradDistributionWiener_fd_6674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6675> AgradDistributionWiener_fd_6675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6676> AgradDistributionWiener_fd_6676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6677> AgradDistributionWiener_fd_6677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6678> AgradDistributionWiener_fd_6678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6679> AgradDistributionWiener_fd_6679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6680> AgradDistributionWiener_fd_6680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6681> AgradDistributionWiener_fd_6681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6682> AgradDistributionWiener_fd_6682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6683> AgradDistributionWiener_fd_6683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6684> AgradDistributionWiener_fd_6684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6685> AgradDistributionWiener_fd_6685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6686> AgradDistributionWiener_fd_6686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6687> AgradDistributionWiener_fd_6687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6688> AgradDistributionWiener_fd_6688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6689> AgradDistributionWiener_fd_6689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6690> AgradDistributionWiener_fd_6690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6691> AgradDistributionWiener_fd_6691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6692> AgradDistributionWiener_fd_6692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6693> AgradDistributionWiener_fd_6693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6694> AgradDistributionWiener_fd_6694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6695> AgradDistributionWiener_fd_6695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6696> AgradDistributionWiener_fd_6696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6697> AgradDistributionWiener_fd_6697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6698> AgradDistributionWiener_fd_6698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_6699> AgradDistributionWiener_fd_6699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6600, AgradDistributionTestFixture, AgradDistributionWiener_fd_6600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6601, AgradDistributionTestFixture, AgradDistributionWiener_fd_6601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6602, AgradDistributionTestFixture, AgradDistributionWiener_fd_6602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6603, AgradDistributionTestFixture, AgradDistributionWiener_fd_6603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6604, AgradDistributionTestFixture, AgradDistributionWiener_fd_6604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6605, AgradDistributionTestFixture, AgradDistributionWiener_fd_6605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6606, AgradDistributionTestFixture, AgradDistributionWiener_fd_6606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6607, AgradDistributionTestFixture, AgradDistributionWiener_fd_6607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6608, AgradDistributionTestFixture, AgradDistributionWiener_fd_6608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6609, AgradDistributionTestFixture, AgradDistributionWiener_fd_6609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6610, AgradDistributionTestFixture, AgradDistributionWiener_fd_6610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6611, AgradDistributionTestFixture, AgradDistributionWiener_fd_6611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6612, AgradDistributionTestFixture, AgradDistributionWiener_fd_6612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6613, AgradDistributionTestFixture, AgradDistributionWiener_fd_6613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6614, AgradDistributionTestFixture, AgradDistributionWiener_fd_6614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6615, AgradDistributionTestFixture, AgradDistributionWiener_fd_6615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6616, AgradDistributionTestFixture, AgradDistributionWiener_fd_6616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6617, AgradDistributionTestFixture, AgradDistributionWiener_fd_6617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6618, AgradDistributionTestFixture, AgradDistributionWiener_fd_6618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6619, AgradDistributionTestFixture, AgradDistributionWiener_fd_6619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6620, AgradDistributionTestFixture, AgradDistributionWiener_fd_6620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6621, AgradDistributionTestFixture, AgradDistributionWiener_fd_6621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6622, AgradDistributionTestFixture, AgradDistributionWiener_fd_6622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6623, AgradDistributionTestFixture, AgradDistributionWiener_fd_6623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6624, AgradDistributionTestFixture, AgradDistributionWiener_fd_6624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6625, AgradDistributionTestFixture, AgradDistributionWiener_fd_6625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6626, AgradDistributionTestFixture, AgradDistributionWiener_fd_6626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6627, AgradDistributionTestFixture, AgradDistributionWiener_fd_6627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6628, AgradDistributionTestFixture, AgradDistributionWiener_fd_6628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6629, AgradDistributionTestFixture, AgradDistributionWiener_fd_6629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6630, AgradDistributionTestFixture, AgradDistributionWiener_fd_6630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6631, AgradDistributionTestFixture, AgradDistributionWiener_fd_6631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6632, AgradDistributionTestFixture, AgradDistributionWiener_fd_6632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6633, AgradDistributionTestFixture, AgradDistributionWiener_fd_6633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6634, AgradDistributionTestFixture, AgradDistributionWiener_fd_6634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6635, AgradDistributionTestFixture, AgradDistributionWiener_fd_6635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6636, AgradDistributionTestFixture, AgradDistributionWiener_fd_6636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6637, AgradDistributionTestFixture, AgradDistributionWiener_fd_6637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6638, AgradDistributionTestFixture, AgradDistributionWiener_fd_6638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6639, AgradDistributionTestFixture, AgradDistributionWiener_fd_6639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6640, AgradDistributionTestFixture, AgradDistributionWiener_fd_6640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6641, AgradDistributionTestFixture, AgradDistributionWiener_fd_6641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6642, AgradDistributionTestFixture, AgradDistributionWiener_fd_6642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6643, AgradDistributionTestFixture, AgradDistributionWiener_fd_6643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6644, AgradDistributionTestFixture, AgradDistributionWiener_fd_6644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6645, AgradDistributionTestFixture, AgradDistributionWiener_fd_6645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6646, AgradDistributionTestFixture, AgradDistributionWiener_fd_6646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6647, AgradDistributionTestFixture, AgradDistributionWiener_fd_6647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6648, AgradDistributionTestFixture, AgradDistributionWiener_fd_6648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6649, AgradDistributionTestFixture, AgradDistributionWiener_fd_6649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6650, AgradDistributionTestFixture, AgradDistributionWiener_fd_6650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6651, AgradDistributionTestFixture, AgradDistributionWiener_fd_6651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6652, AgradDistributionTestFixture, AgradDistributionWiener_fd_6652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6653, AgradDistributionTestFixture, AgradDistributionWiener_fd_6653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6654, AgradDistributionTestFixture, AgradDistributionWiener_fd_6654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6655, AgradDistributionTestFixture, AgradDistributionWiener_fd_6655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6656, AgradDistributionTestFixture, AgradDistributionWiener_fd_6656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6657, AgradDistributionTestFixture, AgradDistributionWiener_fd_6657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6658, AgradDistributionTestFixture, AgradDistributionWiener_fd_6658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6659, AgradDistributionTestFixture, AgradDistributionWiener_fd_6659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6660, AgradDistributionTestFixture, AgradDistributionWiener_fd_6660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6661, AgradDistributionTestFixture, AgradDistributionWiener_fd_6661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6662, AgradDistributionTestFixture, AgradDistributionWiener_fd_6662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6663, AgradDistributionTestFixture, AgradDistributionWiener_fd_6663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6664, AgradDistributionTestFixture, AgradDistributionWiener_fd_6664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6665, AgradDistributionTestFixture, AgradDistributionWiener_fd_6665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6666, AgradDistributionTestFixture, AgradDistributionWiener_fd_6666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6667, AgradDistributionTestFixture, AgradDistributionWiener_fd_6667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6668, AgradDistributionTestFixture, AgradDistributionWiener_fd_6668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6669, AgradDistributionTestFixture, AgradDistributionWiener_fd_6669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6670, AgradDistributionTestFixture, AgradDistributionWiener_fd_6670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6671, AgradDistributionTestFixture, AgradDistributionWiener_fd_6671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6672, AgradDistributionTestFixture, AgradDistributionWiener_fd_6672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6673, AgradDistributionTestFixture, AgradDistributionWiener_fd_6673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6674, AgradDistributionTestFixture, AgradDistributionWiener_fd_6674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6675, AgradDistributionTestFixture, AgradDistributionWiener_fd_6675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6676, AgradDistributionTestFixture, AgradDistributionWiener_fd_6676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6677, AgradDistributionTestFixture, AgradDistributionWiener_fd_6677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6678, AgradDistributionTestFixture, AgradDistributionWiener_fd_6678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6679, AgradDistributionTestFixture, AgradDistributionWiener_fd_6679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6680, AgradDistributionTestFixture, AgradDistributionWiener_fd_6680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6681, AgradDistributionTestFixture, AgradDistributionWiener_fd_6681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6682, AgradDistributionTestFixture, AgradDistributionWiener_fd_6682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6683, AgradDistributionTestFixture, AgradDistributionWiener_fd_6683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6684, AgradDistributionTestFixture, AgradDistributionWiener_fd_6684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6685, AgradDistributionTestFixture, AgradDistributionWiener_fd_6685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6686, AgradDistributionTestFixture, AgradDistributionWiener_fd_6686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6687, AgradDistributionTestFixture, AgradDistributionWiener_fd_6687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6688, AgradDistributionTestFixture, AgradDistributionWiener_fd_6688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6689, AgradDistributionTestFixture, AgradDistributionWiener_fd_6689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6690, AgradDistributionTestFixture, AgradDistributionWiener_fd_6690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6691, AgradDistributionTestFixture, AgradDistributionWiener_fd_6691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6692, AgradDistributionTestFixture, AgradDistributionWiener_fd_6692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6693, AgradDistributionTestFixture, AgradDistributionWiener_fd_6693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6694, AgradDistributionTestFixture, AgradDistributionWiener_fd_6694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6695, AgradDistributionTestFixture, AgradDistributionWiener_fd_6695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6696, AgradDistributionTestFixture, AgradDistributionWiener_fd_6696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6697, AgradDistributionTestFixture, AgradDistributionWiener_fd_6697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6698, AgradDistributionTestFixture, AgradDistributionWiener_fd_6698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_6699, AgradDistributionTestFixture, AgradDistributionWiener_fd_6699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6700;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6701;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6702;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6703;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6704;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_fv_6705;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_fv_6706;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6707;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<var>, empty> type_fv_6708;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_6709;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6710;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_fv_6711;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_6712;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6713;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_6714;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6715;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6716;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6717;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6718;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6719;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6720;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6721;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6722;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, double, empty> type_fv_6723;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_6724;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6725;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_6726;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6727;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6728;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_6729;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6730;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6731;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6732;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6733;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6734;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6735;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6736;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6737;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6738;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6739;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6740;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_6741;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_6742;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6743;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_6744;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_6745;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6746;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_6747;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_6748;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6749;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_6750;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6751;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6752;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6753;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6754;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6755;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6756;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6757;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6758;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6759;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6760;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6761;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6762;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6763;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6764;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6765;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6766;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6767;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6768;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6769;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6770;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6771;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6772;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6773;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6774;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6775;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6776;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, double, empty> type_fv_6777;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, empty> type_fv_6778;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6779;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, empty> type_fv_6780;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_6781;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6782;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, empty> type_fv_6783;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_6784;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6785;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_6786;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6787;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6788;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6789;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6790;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6791;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6792;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6793;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6794;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, empty> type_fv_6795;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_6796;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6797;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_6798;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6799;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6700> AgradDistributionWiener_fv_6700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6701> AgradDistributionWiener_fv_6701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6702> AgradDistributionWiener_fv_6702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6703> AgradDistributionWiener_fv_6703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6704> AgradDistributionWiener_fv_6704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6705> AgradDistributionWiener_fv_6705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6706> AgradDistributionWiener_fv_6706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6707> AgradDistributionWiener_fv_6707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6708> AgradDistributionWiener_fv_6708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6709> AgradDistributionWiener_fv_6709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6710> AgradDistributionWiener_fv_6710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6711> AgradDistributionWiener_fv_6711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6712> AgradDistributionWiener_fv_6712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6713> AgradDistributionWiener_fv_6713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6714> AgradDistributionWiener_fv_6714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6715> AgradDistributionWiener_fv_6715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6716> AgradDistributionWiener_fv_6716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6717> AgradDistributionWiener_fv_6717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6718> AgradDistributionWiener_fv_6718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6719> AgradDistributionWiener_fv_6719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6720> AgradDistributionWiener_fv_6720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6721> AgradDistributionWiener_fv_6721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6722> AgradDistributionWiener_fv_6722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6723> AgradDistributionWiener_fv_6723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6724> AgradDistributionWiener_fv_6724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6725> AgradDistributionWiener_fv_6725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6726> AgradDistributionWiener_fv_6726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6727> AgradDistributionWiener_fv_6727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6728> AgradDistributionWiener_fv_6728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6729> AgradDistributionWiener_fv_6729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6730> AgradDistributionWiener_fv_6730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6731> AgradDistributionWiener_fv_6731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6732> AgradDistributionWiener_fv_6732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6733> AgradDistributionWiener_fv_6733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6734> AgradDistributionWiener_fv_6734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6735> AgradDistributionWiener_fv_6735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6736> AgradDistributionWiener_fv_6736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6737> AgradDistributionWiener_fv_6737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6738> AgradDistributionWiener_fv_6738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6739> AgradDistributionWiener_fv_6739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6740> AgradDistributionWiener_fv_6740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6741> AgradDistributionWiener_fv_6741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6742> AgradDistributionWiener_fv_6742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6743> AgradDistributionWiener_fv_6743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6744> AgradDistributionWiener_fv_6744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6745> AgradDistributionWiener_fv_6745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6746> AgradDistributionWiener_fv_6746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6747> AgradDistributionWiener_fv_6747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6748> AgradDistributionWiener_fv_6748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6749> AgradDistributionWiener_fv_6749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6750> AgradDistributionWiener_fv_6750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6751> AgradDistributionWiener_fv_6751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6752> AgradDistributionWiener_fv_6752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6753> AgradDistributionWiener_fv_6753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6754> AgradDistributionWiener_fv_6754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6755> AgradDistributionWiener_fv_6755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6756> AgradDistributionWiener_fv_6756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6757> AgradDistributionWiener_fv_6757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6758> AgradDistributionWiener_fv_6758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6759> AgradDistributionWiener_fv_6759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6760> AgradDistributionWiener_fv_6760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6761> AgradDistributionWiener_fv_6761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6762> AgradDistributionWiener_fv_6762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6763> AgradDistributionWiener_fv_6763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6764> AgradDistributionWiener_fv_6764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6765> AgradDistributionWiener_fv_6765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6766> AgradDistributionWiener_fv_6766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6767> AgradDistributionWiener_fv_6767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6768> AgradDistributionWiener_fv_6768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6769> AgradDistributionWiener_fv_6769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6770> AgradDistributionWiener_fv_6770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6771> AgradDistributionWiener_fv_6771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6772> AgradDistributionWiener_fv_6772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6773> AgradDistributionWiener_fv_6773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6774> AgradDistributionWiener_fv_6774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6775> AgradDistributionWiener_fv_6775;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6776> AgradDistributionWiener_fv_6776;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6777> AgradDistributionWiener_fv_6777;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6778> AgradDistributionWiener_fv_6778;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6779> AgradDistributionWiener_fv_6779;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6780> AgradDistributionWiener_fv_6780;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6781> AgradDistributionWiener_fv_6781;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6782> AgradDistributionWiener_fv_6782;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6783> AgradDistributionWiener_fv_6783;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6784> AgradDistributionWiener_fv_6784;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6785> AgradDistributionWiener_fv_6785;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6786> AgradDistributionWiener_fv_6786;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6787> AgradDistributionWiener_fv_6787;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6788> AgradDistributionWiener_fv_6788;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6789> AgradDistributionWiener_fv_6789;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6790> AgradDistributionWiener_fv_6790;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6791> AgradDistributionWiener_fv_6791;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6792> AgradDistributionWiener_fv_6792;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6793> AgradDistributionWiener_fv_6793;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6794> AgradDistributionWiener_fv_6794;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6795> AgradDistributionWiener_fv_6795;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6796> AgradDistributionWiener_fv_6796;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6797> AgradDistributionWiener_fv_6797;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6798> AgradDistributionWiener_fv_6798;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6799> AgradDistributionWiener_fv_6799;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6700, AgradDistributionTestFixture, AgradDistributionWiener_fv_6700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6701, AgradDistributionTestFixture, AgradDistributionWiener_fv_6701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6702, AgradDistributionTestFixture, AgradDistributionWiener_fv_6702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6703, AgradDistributionTestFixture, AgradDistributionWiener_fv_6703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6704, AgradDistributionTestFixture, AgradDistributionWiener_fv_6704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6705, AgradDistributionTestFixture, AgradDistributionWiener_fv_6705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6706, AgradDistributionTestFixture, AgradDistributionWiener_fv_6706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6707, AgradDistributionTestFixture, AgradDistributionWiener_fv_6707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6708, AgradDistributionTestFixture, AgradDistributionWiener_fv_6708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6709, AgradDistributionTestFixture, AgradDistributionWiener_fv_6709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6710, AgradDistributionTestFixture, AgradDistributionWiener_fv_6710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6711, AgradDistributionTestFixture, AgradDistributionWiener_fv_6711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6712, AgradDistributionTestFixture, AgradDistributionWiener_fv_6712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6713, AgradDistributionTestFixture, AgradDistributionWiener_fv_6713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6714, AgradDistributionTestFixture, AgradDistributionWiener_fv_6714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6715, AgradDistributionTestFixture, AgradDistributionWiener_fv_6715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6716, AgradDistributionTestFixture, AgradDistributionWiener_fv_6716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6717, AgradDistributionTestFixture, AgradDistributionWiener_fv_6717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6718, AgradDistributionTestFixture, AgradDistributionWiener_fv_6718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6719, AgradDistributionTestFixture, AgradDistributionWiener_fv_6719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6720, AgradDistributionTestFixture, AgradDistributionWiener_fv_6720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6721, AgradDistributionTestFixture, AgradDistributionWiener_fv_6721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6722, AgradDistributionTestFixture, AgradDistributionWiener_fv_6722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6723, AgradDistributionTestFixture, AgradDistributionWiener_fv_6723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6724, AgradDistributionTestFixture, AgradDistributionWiener_fv_6724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6725, AgradDistributionTestFixture, AgradDistributionWiener_fv_6725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6726, AgradDistributionTestFixture, AgradDistributionWiener_fv_6726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6727, AgradDistributionTestFixture, AgradDistributionWiener_fv_6727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6728, AgradDistributionTestFixture, AgradDistributionWiener_fv_6728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6729, AgradDistributionTestFixture, AgradDistributionWiener_fv_6729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6730, AgradDistributionTestFixture, AgradDistributionWiener_fv_6730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6731, AgradDistributionTestFixture, AgradDistributionWiener_fv_6731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6732, AgradDistributionTestFixture, AgradDistributionWiener_fv_6732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6733, AgradDistributionTestFixture, AgradDistributionWiener_fv_6733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6734, AgradDistributionTestFixture, AgradDistributionWiener_fv_6734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6735, AgradDistributionTestFixture, AgradDistributionWiener_fv_6735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6736, AgradDistributionTestFixture, AgradDistributionWiener_fv_6736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6737, AgradDistributionTestFixture, AgradDistributionWiener_fv_6737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6738, AgradDistributionTestFixture, AgradDistributionWiener_fv_6738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6739, AgradDistributionTestFixture, AgradDistributionWiener_fv_6739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6740, AgradDistributionTestFixture, AgradDistributionWiener_fv_6740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6741, AgradDistributionTestFixture, AgradDistributionWiener_fv_6741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6742, AgradDistributionTestFixture, AgradDistributionWiener_fv_6742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6743, AgradDistributionTestFixture, AgradDistributionWiener_fv_6743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6744, AgradDistributionTestFixture, AgradDistributionWiener_fv_6744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6745, AgradDistributionTestFixture, AgradDistributionWiener_fv_6745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6746, AgradDistributionTestFixture, AgradDistributionWiener_fv_6746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6747, AgradDistributionTestFixture, AgradDistributionWiener_fv_6747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6748, AgradDistributionTestFixture, AgradDistributionWiener_fv_6748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6749, AgradDistributionTestFixture, AgradDistributionWiener_fv_6749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6750, AgradDistributionTestFixture, AgradDistributionWiener_fv_6750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6751, AgradDistributionTestFixture, AgradDistributionWiener_fv_6751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6752, AgradDistributionTestFixture, AgradDistributionWiener_fv_6752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6753, AgradDistributionTestFixture, AgradDistributionWiener_fv_6753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6754, AgradDistributionTestFixture, AgradDistributionWiener_fv_6754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6755, AgradDistributionTestFixture, AgradDistributionWiener_fv_6755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6756, AgradDistributionTestFixture, AgradDistributionWiener_fv_6756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6757, AgradDistributionTestFixture, AgradDistributionWiener_fv_6757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6758, AgradDistributionTestFixture, AgradDistributionWiener_fv_6758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6759, AgradDistributionTestFixture, AgradDistributionWiener_fv_6759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6760, AgradDistributionTestFixture, AgradDistributionWiener_fv_6760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6761, AgradDistributionTestFixture, AgradDistributionWiener_fv_6761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6762, AgradDistributionTestFixture, AgradDistributionWiener_fv_6762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6763, AgradDistributionTestFixture, AgradDistributionWiener_fv_6763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6764, AgradDistributionTestFixture, AgradDistributionWiener_fv_6764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6765, AgradDistributionTestFixture, AgradDistributionWiener_fv_6765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6766, AgradDistributionTestFixture, AgradDistributionWiener_fv_6766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6767, AgradDistributionTestFixture, AgradDistributionWiener_fv_6767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6768, AgradDistributionTestFixture, AgradDistributionWiener_fv_6768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6769, AgradDistributionTestFixture, AgradDistributionWiener_fv_6769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6770, AgradDistributionTestFixture, AgradDistributionWiener_fv_6770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6771, AgradDistributionTestFixture, AgradDistributionWiener_fv_6771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6772, AgradDistributionTestFixture, AgradDistributionWiener_fv_6772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6773, AgradDistributionTestFixture, AgradDistributionWiener_fv_6773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6774, AgradDistributionTestFixture, AgradDistributionWiener_fv_6774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6775, AgradDistributionTestFixture, AgradDistributionWiener_fv_6775);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6776, AgradDistributionTestFixture, AgradDistributionWiener_fv_6776);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6777, AgradDistributionTestFixture, AgradDistributionWiener_fv_6777);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6778, AgradDistributionTestFixture, AgradDistributionWiener_fv_6778);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6779, AgradDistributionTestFixture, AgradDistributionWiener_fv_6779);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6780, AgradDistributionTestFixture, AgradDistributionWiener_fv_6780);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6781, AgradDistributionTestFixture, AgradDistributionWiener_fv_6781);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6782, AgradDistributionTestFixture, AgradDistributionWiener_fv_6782);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6783, AgradDistributionTestFixture, AgradDistributionWiener_fv_6783);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6784, AgradDistributionTestFixture, AgradDistributionWiener_fv_6784);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6785, AgradDistributionTestFixture, AgradDistributionWiener_fv_6785);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6786, AgradDistributionTestFixture, AgradDistributionWiener_fv_6786);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6787, AgradDistributionTestFixture, AgradDistributionWiener_fv_6787);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6788, AgradDistributionTestFixture, AgradDistributionWiener_fv_6788);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6789, AgradDistributionTestFixture, AgradDistributionWiener_fv_6789);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6790, AgradDistributionTestFixture, AgradDistributionWiener_fv_6790);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6791, AgradDistributionTestFixture, AgradDistributionWiener_fv_6791);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6792, AgradDistributionTestFixture, AgradDistributionWiener_fv_6792);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6793, AgradDistributionTestFixture, AgradDistributionWiener_fv_6793);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6794, AgradDistributionTestFixture, AgradDistributionWiener_fv_6794);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6795, AgradDistributionTestFixture, AgradDistributionWiener_fv_6795);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6796, AgradDistributionTestFixture, AgradDistributionWiener_fv_6796);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6797, AgradDistributionTestFixture, AgradDistributionWiener_fv_6797);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6798, AgradDistributionTestFixture, AgradDistributionWiener_fv_6798);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6799, AgradDistributionTestFixture, AgradDistributionWiener_fv_6799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6800;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_6801;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6802;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6803;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6804;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6805;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6806;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6807;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6808;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6809;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6810;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6811;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6812;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, empty> type_fv_6813;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_6814;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6815;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_6816;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_6817;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6818;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_6819;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_6820;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6821;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_6822;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6823;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6824;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6825;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6826;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6827;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6828;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6829;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6830;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_6831;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_6832;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6833;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_6834;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6835;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6836;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_6837;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6838;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6839;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6840;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6841;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6842;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6843;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6844;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6845;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6846;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6847;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6848;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_6849;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_6850;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6851;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_6852;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_6853;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6854;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_6855;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_6856;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6857;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_6858;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6859;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6860;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6861;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6862;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6863;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6864;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6865;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6866;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6867;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6868;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6869;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6870;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6871;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6872;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6873;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6874;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6875;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6876;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6877;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6878;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6879;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6880;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6881;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6882;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6883;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6884;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, double, empty> type_fv_6885;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, std::vector<double>, empty> type_fv_6886;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6887;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, fvar<var>, empty> type_fv_6888;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, std::vector<fvar<var>>, empty> type_fv_6889;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6890;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, double, empty> type_fv_6891;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, std::vector<double>, empty> type_fv_6892;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6893;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, fvar<var>, empty> type_fv_6894;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6895;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6896;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6897;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6898;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6899;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6800> AgradDistributionWiener_fv_6800;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6801> AgradDistributionWiener_fv_6801;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6802> AgradDistributionWiener_fv_6802;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6803> AgradDistributionWiener_fv_6803;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6804> AgradDistributionWiener_fv_6804;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6805> AgradDistributionWiener_fv_6805;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6806> AgradDistributionWiener_fv_6806;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6807> AgradDistributionWiener_fv_6807;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6808> AgradDistributionWiener_fv_6808;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6809> AgradDistributionWiener_fv_6809;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6810> AgradDistributionWiener_fv_6810;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6811> AgradDistributionWiener_fv_6811;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6812> AgradDistributionWiener_fv_6812;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6813> AgradDistributionWiener_fv_6813;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6814> AgradDistributionWiener_fv_6814;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6815> AgradDistributionWiener_fv_6815;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6816> AgradDistributionWiener_fv_6816;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6817> AgradDistributionWiener_fv_6817;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6818> AgradDistributionWiener_fv_6818;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6819> AgradDistributionWiener_fv_6819;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6820> AgradDistributionWiener_fv_6820;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6821> AgradDistributionWiener_fv_6821;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6822> AgradDistributionWiener_fv_6822;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6823> AgradDistributionWiener_fv_6823;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6824> AgradDistributionWiener_fv_6824;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6825> AgradDistributionWiener_fv_6825;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6826> AgradDistributionWiener_fv_6826;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6827> AgradDistributionWiener_fv_6827;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6828> AgradDistributionWiener_fv_6828;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6829> AgradDistributionWiener_fv_6829;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6830> AgradDistributionWiener_fv_6830;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6831> AgradDistributionWiener_fv_6831;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6832> AgradDistributionWiener_fv_6832;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6833> AgradDistributionWiener_fv_6833;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6834> AgradDistributionWiener_fv_6834;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6835> AgradDistributionWiener_fv_6835;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6836> AgradDistributionWiener_fv_6836;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6837> AgradDistributionWiener_fv_6837;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6838> AgradDistributionWiener_fv_6838;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6839> AgradDistributionWiener_fv_6839;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6840> AgradDistributionWiener_fv_6840;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6841> AgradDistributionWiener_fv_6841;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6842> AgradDistributionWiener_fv_6842;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6843> AgradDistributionWiener_fv_6843;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6844> AgradDistributionWiener_fv_6844;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6845> AgradDistributionWiener_fv_6845;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6846> AgradDistributionWiener_fv_6846;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6847> AgradDistributionWiener_fv_6847;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6848> AgradDistributionWiener_fv_6848;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6849> AgradDistributionWiener_fv_6849;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6850> AgradDistributionWiener_fv_6850;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6851> AgradDistributionWiener_fv_6851;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6852> AgradDistributionWiener_fv_6852;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6853> AgradDistributionWiener_fv_6853;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6854> AgradDistributionWiener_fv_6854;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6855> AgradDistributionWiener_fv_6855;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6856> AgradDistributionWiener_fv_6856;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6857> AgradDistributionWiener_fv_6857;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6858> AgradDistributionWiener_fv_6858;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6859> AgradDistributionWiener_fv_6859;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6860> AgradDistributionWiener_fv_6860;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6861> AgradDistributionWiener_fv_6861;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6862> AgradDistributionWiener_fv_6862;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6863> AgradDistributionWiener_fv_6863;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6864> AgradDistributionWiener_fv_6864;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6865> AgradDistributionWiener_fv_6865;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6866> AgradDistributionWiener_fv_6866;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6867> AgradDistributionWiener_fv_6867;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6868> AgradDistributionWiener_fv_6868;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6869> AgradDistributionWiener_fv_6869;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6870> AgradDistributionWiener_fv_6870;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6871> AgradDistributionWiener_fv_6871;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6872> AgradDistributionWiener_fv_6872;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6873> AgradDistributionWiener_fv_6873;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6874> AgradDistributionWiener_fv_6874;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6875> AgradDistributionWiener_fv_6875;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6876> AgradDistributionWiener_fv_6876;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6877> AgradDistributionWiener_fv_6877;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6878> AgradDistributionWiener_fv_6878;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6879> AgradDistributionWiener_fv_6879;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6880> AgradDistributionWiener_fv_6880;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6881> AgradDistributionWiener_fv_6881;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6882> AgradDistributionWiener_fv_6882;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6883> AgradDistributionWiener_fv_6883;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6884> AgradDistributionWiener_fv_6884;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6885> AgradDistributionWiener_fv_6885;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6886> AgradDistributionWiener_fv_6886;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6887> AgradDistributionWiener_fv_6887;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6888> AgradDistributionWiener_fv_6888;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6889> AgradDistributionWiener_fv_6889;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6890> AgradDistributionWiener_fv_6890;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6891> AgradDistributionWiener_fv_6891;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6892> AgradDistributionWiener_fv_6892;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6893> AgradDistributionWiener_fv_6893;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6894> AgradDistributionWiener_fv_6894;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6895> AgradDistributionWiener_fv_6895;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6896> AgradDistributionWiener_fv_6896;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6897> AgradDistributionWiener_fv_6897;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6898> AgradDistributionWiener_fv_6898;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6899> AgradDistributionWiener_fv_6899;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6800, AgradDistributionTestFixture, AgradDistributionWiener_fv_6800);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6801, AgradDistributionTestFixture, AgradDistributionWiener_fv_6801);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6802, AgradDistributionTestFixture, AgradDistributionWiener_fv_6802);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6803, AgradDistributionTestFixture, AgradDistributionWiener_fv_6803);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6804, AgradDistributionTestFixture, AgradDistributionWiener_fv_6804);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6805, AgradDistributionTestFixture, AgradDistributionWiener_fv_6805);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6806, AgradDistributionTestFixture, AgradDistributionWiener_fv_6806);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6807, AgradDistributionTestFixture, AgradDistributionWiener_fv_6807);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6808, AgradDistributionTestFixture, AgradDistributionWiener_fv_6808);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6809, AgradDistributionTestFixture, AgradDistributionWiener_fv_6809);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6810, AgradDistributionTestFixture, AgradDistributionWiener_fv_6810);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6811, AgradDistributionTestFixture, AgradDistributionWiener_fv_6811);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6812, AgradDistributionTestFixture, AgradDistributionWiener_fv_6812);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6813, AgradDistributionTestFixture, AgradDistributionWiener_fv_6813);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6814, AgradDistributionTestFixture, AgradDistributionWiener_fv_6814);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6815, AgradDistributionTestFixture, AgradDistributionWiener_fv_6815);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6816, AgradDistributionTestFixture, AgradDistributionWiener_fv_6816);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6817, AgradDistributionTestFixture, AgradDistributionWiener_fv_6817);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6818, AgradDistributionTestFixture, AgradDistributionWiener_fv_6818);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6819, AgradDistributionTestFixture, AgradDistributionWiener_fv_6819);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6820, AgradDistributionTestFixture, AgradDistributionWiener_fv_6820);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6821, AgradDistributionTestFixture, AgradDistributionWiener_fv_6821);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6822, AgradDistributionTestFixture, AgradDistributionWiener_fv_6822);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6823, AgradDistributionTestFixture, AgradDistributionWiener_fv_6823);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6824, AgradDistributionTestFixture, AgradDistributionWiener_fv_6824);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6825, AgradDistributionTestFixture, AgradDistributionWiener_fv_6825);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6826, AgradDistributionTestFixture, AgradDistributionWiener_fv_6826);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6827, AgradDistributionTestFixture, AgradDistributionWiener_fv_6827);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6828, AgradDistributionTestFixture, AgradDistributionWiener_fv_6828);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6829, AgradDistributionTestFixture, AgradDistributionWiener_fv_6829);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6830, AgradDistributionTestFixture, AgradDistributionWiener_fv_6830);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6831, AgradDistributionTestFixture, AgradDistributionWiener_fv_6831);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6832, AgradDistributionTestFixture, AgradDistributionWiener_fv_6832);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6833, AgradDistributionTestFixture, AgradDistributionWiener_fv_6833);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6834, AgradDistributionTestFixture, AgradDistributionWiener_fv_6834);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6835, AgradDistributionTestFixture, AgradDistributionWiener_fv_6835);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6836, AgradDistributionTestFixture, AgradDistributionWiener_fv_6836);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6837, AgradDistributionTestFixture, AgradDistributionWiener_fv_6837);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6838, AgradDistributionTestFixture, AgradDistributionWiener_fv_6838);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6839, AgradDistributionTestFixture, AgradDistributionWiener_fv_6839);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6840, AgradDistributionTestFixture, AgradDistributionWiener_fv_6840);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6841, AgradDistributionTestFixture, AgradDistributionWiener_fv_6841);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6842, AgradDistributionTestFixture, AgradDistributionWiener_fv_6842);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6843, AgradDistributionTestFixture, AgradDistributionWiener_fv_6843);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6844, AgradDistributionTestFixture, AgradDistributionWiener_fv_6844);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6845, AgradDistributionTestFixture, AgradDistributionWiener_fv_6845);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6846, AgradDistributionTestFixture, AgradDistributionWiener_fv_6846);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6847, AgradDistributionTestFixture, AgradDistributionWiener_fv_6847);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6848, AgradDistributionTestFixture, AgradDistributionWiener_fv_6848);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6849, AgradDistributionTestFixture, AgradDistributionWiener_fv_6849);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6850, AgradDistributionTestFixture, AgradDistributionWiener_fv_6850);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6851, AgradDistributionTestFixture, AgradDistributionWiener_fv_6851);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6852, AgradDistributionTestFixture, AgradDistributionWiener_fv_6852);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6853, AgradDistributionTestFixture, AgradDistributionWiener_fv_6853);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6854, AgradDistributionTestFixture, AgradDistributionWiener_fv_6854);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6855, AgradDistributionTestFixture, AgradDistributionWiener_fv_6855);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6856, AgradDistributionTestFixture, AgradDistributionWiener_fv_6856);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6857, AgradDistributionTestFixture, AgradDistributionWiener_fv_6857);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6858, AgradDistributionTestFixture, AgradDistributionWiener_fv_6858);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6859, AgradDistributionTestFixture, AgradDistributionWiener_fv_6859);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6860, AgradDistributionTestFixture, AgradDistributionWiener_fv_6860);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6861, AgradDistributionTestFixture, AgradDistributionWiener_fv_6861);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6862, AgradDistributionTestFixture, AgradDistributionWiener_fv_6862);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6863, AgradDistributionTestFixture, AgradDistributionWiener_fv_6863);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6864, AgradDistributionTestFixture, AgradDistributionWiener_fv_6864);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6865, AgradDistributionTestFixture, AgradDistributionWiener_fv_6865);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6866, AgradDistributionTestFixture, AgradDistributionWiener_fv_6866);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6867, AgradDistributionTestFixture, AgradDistributionWiener_fv_6867);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6868, AgradDistributionTestFixture, AgradDistributionWiener_fv_6868);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6869, AgradDistributionTestFixture, AgradDistributionWiener_fv_6869);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6870, AgradDistributionTestFixture, AgradDistributionWiener_fv_6870);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6871, AgradDistributionTestFixture, AgradDistributionWiener_fv_6871);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6872, AgradDistributionTestFixture, AgradDistributionWiener_fv_6872);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6873, AgradDistributionTestFixture, AgradDistributionWiener_fv_6873);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6874, AgradDistributionTestFixture, AgradDistributionWiener_fv_6874);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6875, AgradDistributionTestFixture, AgradDistributionWiener_fv_6875);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6876, AgradDistributionTestFixture, AgradDistributionWiener_fv_6876);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6877, AgradDistributionTestFixture, AgradDistributionWiener_fv_6877);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6878, AgradDistributionTestFixture, AgradDistributionWiener_fv_6878);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6879, AgradDistributionTestFixture, AgradDistributionWiener_fv_6879);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6880, AgradDistributionTestFixture, AgradDistributionWiener_fv_6880);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6881, AgradDistributionTestFixture, AgradDistributionWiener_fv_6881);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6882, AgradDistributionTestFixture, AgradDistributionWiener_fv_6882);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6883, AgradDistributionTestFixture, AgradDistributionWiener_fv_6883);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6884, AgradDistributionTestFixture, AgradDistributionWiener_fv_6884);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6885, AgradDistributionTestFixture, AgradDistributionWiener_fv_6885);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6886, AgradDistributionTestFixture, AgradDistributionWiener_fv_6886);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6887, AgradDistributionTestFixture, AgradDistributionWiener_fv_6887);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6888, AgradDistributionTestFixture, AgradDistributionWiener_fv_6888);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6889, AgradDistributionTestFixture, AgradDistributionWiener_fv_6889);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6890, AgradDistributionTestFixture, AgradDistributionWiener_fv_6890);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6891, AgradDistributionTestFixture, AgradDistributionWiener_fv_6891);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6892, AgradDistributionTestFixture, AgradDistributionWiener_fv_6892);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6893, AgradDistributionTestFixture, AgradDistributionWiener_fv_6893);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6894, AgradDistributionTestFixture, AgradDistributionWiener_fv_6894);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6895, AgradDistributionTestFixture, AgradDistributionWiener_fv_6895);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6896, AgradDistributionTestFixture, AgradDistributionWiener_fv_6896);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6897, AgradDistributionTestFixture, AgradDistributionWiener_fv_6897);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6898, AgradDistributionTestFixture, AgradDistributionWiener_fv_6898);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6899, AgradDistributionTestFixture, AgradDistributionWiener_fv_6899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6900;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6901;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6902;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, double, empty> type_fv_6903;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, std::vector<double>, empty> type_fv_6904;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6905;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, fvar<var>, empty> type_fv_6906;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6907;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6908;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, double, empty> type_fv_6909;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6910;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6911;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6912;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6913;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6914;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6915;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6916;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6917;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6918;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6919;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6920;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, double, empty> type_fv_6921;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, std::vector<double>, empty> type_fv_6922;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6923;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, fvar<var>, empty> type_fv_6924;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_6925;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6926;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, double, empty> type_fv_6927;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_6928;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6929;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_6930;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6931;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6932;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6933;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6934;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6935;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6936;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6937;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6938;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, double, empty> type_fv_6939;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_6940;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6941;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_6942;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6943;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6944;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_6945;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6946;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6947;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6948;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6949;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6950;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6951;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6952;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6953;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6954;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6955;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6956;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_6957;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_6958;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6959;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_6960;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_6961;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6962;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_6963;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_6964;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6965;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_6966;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_6967;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6968;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_6969;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6970;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6971;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6972;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6973;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6974;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_6975;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_6976;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6977;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_6978;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_6979;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6980;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_6981;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_6982;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6983;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_6984;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_6985;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6986;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_6987;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_6988;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6989;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_6990;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_6991;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6992;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, double, empty> type_fv_6993;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, std::vector<double>, empty> type_fv_6994;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_6995;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, fvar<var>, empty> type_fv_6996;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_6997;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_6998;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, std::vector<double>, double, empty> type_fv_6999;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6900> AgradDistributionWiener_fv_6900;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6901> AgradDistributionWiener_fv_6901;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6902> AgradDistributionWiener_fv_6902;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6903> AgradDistributionWiener_fv_6903;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6904> AgradDistributionWiener_fv_6904;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6905> AgradDistributionWiener_fv_6905;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6906> AgradDistributionWiener_fv_6906;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6907> AgradDistributionWiener_fv_6907;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6908> AgradDistributionWiener_fv_6908;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6909> AgradDistributionWiener_fv_6909;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6910> AgradDistributionWiener_fv_6910;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6911> AgradDistributionWiener_fv_6911;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6912> AgradDistributionWiener_fv_6912;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6913> AgradDistributionWiener_fv_6913;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6914> AgradDistributionWiener_fv_6914;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6915> AgradDistributionWiener_fv_6915;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6916> AgradDistributionWiener_fv_6916;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6917> AgradDistributionWiener_fv_6917;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6918> AgradDistributionWiener_fv_6918;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6919> AgradDistributionWiener_fv_6919;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6920> AgradDistributionWiener_fv_6920;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6921> AgradDistributionWiener_fv_6921;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6922> AgradDistributionWiener_fv_6922;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6923> AgradDistributionWiener_fv_6923;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6924> AgradDistributionWiener_fv_6924;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6925> AgradDistributionWiener_fv_6925;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6926> AgradDistributionWiener_fv_6926;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6927> AgradDistributionWiener_fv_6927;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6928> AgradDistributionWiener_fv_6928;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6929> AgradDistributionWiener_fv_6929;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6930> AgradDistributionWiener_fv_6930;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6931> AgradDistributionWiener_fv_6931;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6932> AgradDistributionWiener_fv_6932;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6933> AgradDistributionWiener_fv_6933;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6934> AgradDistributionWiener_fv_6934;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6935> AgradDistributionWiener_fv_6935;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6936> AgradDistributionWiener_fv_6936;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6937> AgradDistributionWiener_fv_6937;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6938> AgradDistributionWiener_fv_6938;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6939> AgradDistributionWiener_fv_6939;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6940> AgradDistributionWiener_fv_6940;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6941> AgradDistributionWiener_fv_6941;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6942> AgradDistributionWiener_fv_6942;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6943> AgradDistributionWiener_fv_6943;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6944> AgradDistributionWiener_fv_6944;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6945> AgradDistributionWiener_fv_6945;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6946> AgradDistributionWiener_fv_6946;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6947> AgradDistributionWiener_fv_6947;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6948> AgradDistributionWiener_fv_6948;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6949> AgradDistributionWiener_fv_6949;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6950> AgradDistributionWiener_fv_6950;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6951> AgradDistributionWiener_fv_6951;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6952> AgradDistributionWiener_fv_6952;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6953> AgradDistributionWiener_fv_6953;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6954> AgradDistributionWiener_fv_6954;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6955> AgradDistributionWiener_fv_6955;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6956> AgradDistributionWiener_fv_6956;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6957> AgradDistributionWiener_fv_6957;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6958> AgradDistributionWiener_fv_6958;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6959> AgradDistributionWiener_fv_6959;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6960> AgradDistributionWiener_fv_6960;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6961> AgradDistributionWiener_fv_6961;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6962> AgradDistributionWiener_fv_6962;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6963> AgradDistributionWiener_fv_6963;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6964> AgradDistributionWiener_fv_6964;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6965> AgradDistributionWiener_fv_6965;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6966> AgradDistributionWiener_fv_6966;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6967> AgradDistributionWiener_fv_6967;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6968> AgradDistributionWiener_fv_6968;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6969> AgradDistributionWiener_fv_6969;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6970> AgradDistributionWiener_fv_6970;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6971> AgradDistributionWiener_fv_6971;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6972> AgradDistributionWiener_fv_6972;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6973> AgradDistributionWiener_fv_6973;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6974> AgradDistributionWiener_fv_6974;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6975> AgradDistributionWiener_fv_6975;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6976> AgradDistributionWiener_fv_6976;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6977> AgradDistributionWiener_fv_6977;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6978> AgradDistributionWiener_fv_6978;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6979> AgradDistributionWiener_fv_6979;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6980> AgradDistributionWiener_fv_6980;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6981> AgradDistributionWiener_fv_6981;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6982> AgradDistributionWiener_fv_6982;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6983> AgradDistributionWiener_fv_6983;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6984> AgradDistributionWiener_fv_6984;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6985> AgradDistributionWiener_fv_6985;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6986> AgradDistributionWiener_fv_6986;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6987> AgradDistributionWiener_fv_6987;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6988> AgradDistributionWiener_fv_6988;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6989> AgradDistributionWiener_fv_6989;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6990> AgradDistributionWiener_fv_6990;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6991> AgradDistributionWiener_fv_6991;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6992> AgradDistributionWiener_fv_6992;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6993> AgradDistributionWiener_fv_6993;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6994> AgradDistributionWiener_fv_6994;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6995> AgradDistributionWiener_fv_6995;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6996> AgradDistributionWiener_fv_6996;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6997> AgradDistributionWiener_fv_6997;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6998> AgradDistributionWiener_fv_6998;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_6999> AgradDistributionWiener_fv_6999;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6900, AgradDistributionTestFixture, AgradDistributionWiener_fv_6900);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6901, AgradDistributionTestFixture, AgradDistributionWiener_fv_6901);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6902, AgradDistributionTestFixture, AgradDistributionWiener_fv_6902);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6903, AgradDistributionTestFixture, AgradDistributionWiener_fv_6903);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6904, AgradDistributionTestFixture, AgradDistributionWiener_fv_6904);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6905, AgradDistributionTestFixture, AgradDistributionWiener_fv_6905);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6906, AgradDistributionTestFixture, AgradDistributionWiener_fv_6906);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6907, AgradDistributionTestFixture, AgradDistributionWiener_fv_6907);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6908, AgradDistributionTestFixture, AgradDistributionWiener_fv_6908);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6909, AgradDistributionTestFixture, AgradDistributionWiener_fv_6909);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6910, AgradDistributionTestFixture, AgradDistributionWiener_fv_6910);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6911, AgradDistributionTestFixture, AgradDistributionWiener_fv_6911);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6912, AgradDistributionTestFixture, AgradDistributionWiener_fv_6912);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6913, AgradDistributionTestFixture, AgradDistributionWiener_fv_6913);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6914, AgradDistributionTestFixture, AgradDistributionWiener_fv_6914);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6915, AgradDistributionTestFixture, AgradDistributionWiener_fv_6915);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6916, AgradDistributionTestFixture, AgradDistributionWiener_fv_6916);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6917, AgradDistributionTestFixture, AgradDistributionWiener_fv_6917);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6918, AgradDistributionTestFixture, AgradDistributionWiener_fv_6918);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6919, AgradDistributionTestFixture, AgradDistributionWiener_fv_6919);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6920, AgradDistributionTestFixture, AgradDistributionWiener_fv_6920);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6921, AgradDistributionTestFixture, AgradDistributionWiener_fv_6921);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6922, AgradDistributionTestFixture, AgradDistributionWiener_fv_6922);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6923, AgradDistributionTestFixture, AgradDistributionWiener_fv_6923);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6924, AgradDistributionTestFixture, AgradDistributionWiener_fv_6924);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6925, AgradDistributionTestFixture, AgradDistributionWiener_fv_6925);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6926, AgradDistributionTestFixture, AgradDistributionWiener_fv_6926);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6927, AgradDistributionTestFixture, AgradDistributionWiener_fv_6927);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6928, AgradDistributionTestFixture, AgradDistributionWiener_fv_6928);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6929, AgradDistributionTestFixture, AgradDistributionWiener_fv_6929);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6930, AgradDistributionTestFixture, AgradDistributionWiener_fv_6930);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6931, AgradDistributionTestFixture, AgradDistributionWiener_fv_6931);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6932, AgradDistributionTestFixture, AgradDistributionWiener_fv_6932);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6933, AgradDistributionTestFixture, AgradDistributionWiener_fv_6933);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6934, AgradDistributionTestFixture, AgradDistributionWiener_fv_6934);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6935, AgradDistributionTestFixture, AgradDistributionWiener_fv_6935);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6936, AgradDistributionTestFixture, AgradDistributionWiener_fv_6936);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6937, AgradDistributionTestFixture, AgradDistributionWiener_fv_6937);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6938, AgradDistributionTestFixture, AgradDistributionWiener_fv_6938);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6939, AgradDistributionTestFixture, AgradDistributionWiener_fv_6939);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6940, AgradDistributionTestFixture, AgradDistributionWiener_fv_6940);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6941, AgradDistributionTestFixture, AgradDistributionWiener_fv_6941);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6942, AgradDistributionTestFixture, AgradDistributionWiener_fv_6942);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6943, AgradDistributionTestFixture, AgradDistributionWiener_fv_6943);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6944, AgradDistributionTestFixture, AgradDistributionWiener_fv_6944);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6945, AgradDistributionTestFixture, AgradDistributionWiener_fv_6945);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6946, AgradDistributionTestFixture, AgradDistributionWiener_fv_6946);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6947, AgradDistributionTestFixture, AgradDistributionWiener_fv_6947);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6948, AgradDistributionTestFixture, AgradDistributionWiener_fv_6948);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6949, AgradDistributionTestFixture, AgradDistributionWiener_fv_6949);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6950, AgradDistributionTestFixture, AgradDistributionWiener_fv_6950);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6951, AgradDistributionTestFixture, AgradDistributionWiener_fv_6951);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6952, AgradDistributionTestFixture, AgradDistributionWiener_fv_6952);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6953, AgradDistributionTestFixture, AgradDistributionWiener_fv_6953);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6954, AgradDistributionTestFixture, AgradDistributionWiener_fv_6954);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6955, AgradDistributionTestFixture, AgradDistributionWiener_fv_6955);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6956, AgradDistributionTestFixture, AgradDistributionWiener_fv_6956);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6957, AgradDistributionTestFixture, AgradDistributionWiener_fv_6957);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6958, AgradDistributionTestFixture, AgradDistributionWiener_fv_6958);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6959, AgradDistributionTestFixture, AgradDistributionWiener_fv_6959);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6960, AgradDistributionTestFixture, AgradDistributionWiener_fv_6960);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6961, AgradDistributionTestFixture, AgradDistributionWiener_fv_6961);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6962, AgradDistributionTestFixture, AgradDistributionWiener_fv_6962);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6963, AgradDistributionTestFixture, AgradDistributionWiener_fv_6963);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6964, AgradDistributionTestFixture, AgradDistributionWiener_fv_6964);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6965, AgradDistributionTestFixture, AgradDistributionWiener_fv_6965);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6966, AgradDistributionTestFixture, AgradDistributionWiener_fv_6966);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6967, AgradDistributionTestFixture, AgradDistributionWiener_fv_6967);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6968, AgradDistributionTestFixture, AgradDistributionWiener_fv_6968);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6969, AgradDistributionTestFixture, AgradDistributionWiener_fv_6969);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6970, AgradDistributionTestFixture, AgradDistributionWiener_fv_6970);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6971, AgradDistributionTestFixture, AgradDistributionWiener_fv_6971);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6972, AgradDistributionTestFixture, AgradDistributionWiener_fv_6972);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6973, AgradDistributionTestFixture, AgradDistributionWiener_fv_6973);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6974, AgradDistributionTestFixture, AgradDistributionWiener_fv_6974);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6975, AgradDistributionTestFixture, AgradDistributionWiener_fv_6975);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6976, AgradDistributionTestFixture, AgradDistributionWiener_fv_6976);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6977, AgradDistributionTestFixture, AgradDistributionWiener_fv_6977);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6978, AgradDistributionTestFixture, AgradDistributionWiener_fv_6978);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6979, AgradDistributionTestFixture, AgradDistributionWiener_fv_6979);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6980, AgradDistributionTestFixture, AgradDistributionWiener_fv_6980);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6981, AgradDistributionTestFixture, AgradDistributionWiener_fv_6981);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6982, AgradDistributionTestFixture, AgradDistributionWiener_fv_6982);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6983, AgradDistributionTestFixture, AgradDistributionWiener_fv_6983);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6984, AgradDistributionTestFixture, AgradDistributionWiener_fv_6984);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6985, AgradDistributionTestFixture, AgradDistributionWiener_fv_6985);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6986, AgradDistributionTestFixture, AgradDistributionWiener_fv_6986);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6987, AgradDistributionTestFixture, AgradDistributionWiener_fv_6987);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6988, AgradDistributionTestFixture, AgradDistributionWiener_fv_6988);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6989, AgradDistributionTestFixture, AgradDistributionWiener_fv_6989);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6990, AgradDistributionTestFixture, AgradDistributionWiener_fv_6990);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6991, AgradDistributionTestFixture, AgradDistributionWiener_fv_6991);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6992, AgradDistributionTestFixture, AgradDistributionWiener_fv_6992);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6993, AgradDistributionTestFixture, AgradDistributionWiener_fv_6993);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6994, AgradDistributionTestFixture, AgradDistributionWiener_fv_6994);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6995, AgradDistributionTestFixture, AgradDistributionWiener_fv_6995);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6996, AgradDistributionTestFixture, AgradDistributionWiener_fv_6996);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6997, AgradDistributionTestFixture, AgradDistributionWiener_fv_6997);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6998, AgradDistributionTestFixture, AgradDistributionWiener_fv_6998);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_6999, AgradDistributionTestFixture, AgradDistributionWiener_fv_6999);
+
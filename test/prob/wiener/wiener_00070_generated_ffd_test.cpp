@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, std::vector<double>, empty> type_ffd_7000;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7001;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_7002;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7003;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7004;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_7005;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7006;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7007;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7008;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7009;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7010;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, double, empty> type_ffd_7011;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_7012;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7013;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_7014;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_7015;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7016;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_7017;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_7018;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7019;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_7020;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7021;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7022;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_7023;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7024;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7025;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7026;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7027;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7028;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, double, empty> type_ffd_7029;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, std::vector<double>, empty> type_ffd_7030;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7031;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, fvar<fvar<double> >, empty> type_ffd_7032;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_7033;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7034;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, double, empty> type_ffd_7035;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<double>, empty> type_ffd_7036;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7037;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_7038;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7039;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7040;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_7041;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7042;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7043;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7044;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7045;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7046;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, double, empty> type_ffd_7047;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_7048;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7049;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_7050;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_7051;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7052;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_7053;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_7054;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7055;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_7056;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7057;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7058;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_7059;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7060;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7061;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7062;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7063;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7064;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, empty> type_ffd_7065;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_7066;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7067;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_7068;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_7069;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7070;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_7071;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_7072;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7073;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_7074;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7075;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7076;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_7077;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7078;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7079;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7080;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7081;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7082;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, double, empty> type_ffd_7083;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_7084;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7085;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_7086;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_7087;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7088;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_7089;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_7090;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7091;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_7092;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7093;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7094;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_7095;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7096;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7097;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7098;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7000> AgradDistributionWiener_ffd_7000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7001> AgradDistributionWiener_ffd_7001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7002> AgradDistributionWiener_ffd_7002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7003> AgradDistributionWiener_ffd_7003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7004> AgradDistributionWiener_ffd_7004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7005> AgradDistributionWiener_ffd_7005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7006> AgradDistributionWiener_ffd_7006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7007> AgradDistributionWiener_ffd_7007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7008> AgradDistributionWiener_ffd_7008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7009> AgradDistributionWiener_ffd_7009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7010> AgradDistributionWiener_ffd_7010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7011> AgradDistributionWiener_ffd_7011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7012> AgradDistributionWiener_ffd_7012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7013> AgradDistributionWiener_ffd_7013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7014> AgradDistributionWiener_ffd_7014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7015> AgradDistributionWiener_ffd_7015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7016> AgradDistributionWiener_ffd_7016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7017> AgradDistributionWiener_ffd_7017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7018> AgradDistributionWiener_ffd_7018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7019> AgradDistributionWiener_ffd_7019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7020> AgradDistributionWiener_ffd_7020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7021> AgradDistributionWiener_ffd_7021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7022> AgradDistributionWiener_ffd_7022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7023> AgradDistributionWiener_ffd_7023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7024> AgradDistributionWiener_ffd_7024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7025> AgradDistributionWiener_ffd_7025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7026> AgradDistributionWiener_ffd_7026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7027> AgradDistributionWiener_ffd_7027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7028> AgradDistributionWiener_ffd_7028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7029> AgradDistributionWiener_ffd_7029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7030> AgradDistributionWiener_ffd_7030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7031> AgradDistributionWiener_ffd_7031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7032> AgradDistributionWiener_ffd_7032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7033> AgradDistributionWiener_ffd_7033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7034> AgradDistributionWiener_ffd_7034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7035> AgradDistributionWiener_ffd_7035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7036> AgradDistributionWiener_ffd_7036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7037> AgradDistributionWiener_ffd_7037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7038> AgradDistributionWiener_ffd_7038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7039> AgradDistributionWiener_ffd_7039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7040> AgradDistributionWiener_ffd_7040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7041> AgradDistributionWiener_ffd_7041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7042> AgradDistributionWiener_ffd_7042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7043> AgradDistributionWiener_ffd_7043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7044> AgradDistributionWiener_ffd_7044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7045> AgradDistributionWiener_ffd_7045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7046> AgradDistributionWiener_ffd_7046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7047> AgradDistributionWiener_ffd_7047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7048> AgradDistributionWiener_ffd_7048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7049> AgradDistributionWiener_ffd_7049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7050> AgradDistributionWiener_ffd_7050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7051> AgradDistributionWiener_ffd_7051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7052> AgradDistributionWiener_ffd_7052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7053> AgradDistributionWiener_ffd_7053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7054> AgradDistributionWiener_ffd_7054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7055> AgradDistributionWiener_ffd_7055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7056> AgradDistributionWiener_ffd_7056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7057> AgradDistributionWiener_ffd_7057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7058> AgradDistributionWiener_ffd_7058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7059> AgradDistributionWiener_ffd_7059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7060> AgradDistributionWiener_ffd_7060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7061> AgradDistributionWiener_ffd_7061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7062> AgradDistributionWiener_ffd_7062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7063> AgradDistributionWiener_ffd_7063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7064> AgradDistributionWiener_ffd_7064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7065> AgradDistributionWiener_ffd_7065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7066> AgradDistributionWiener_ffd_7066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7067> AgradDistributionWiener_ffd_7067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7068> AgradDistributionWiener_ffd_7068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7069> AgradDistributionWiener_ffd_7069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7070> AgradDistributionWiener_ffd_7070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7071> AgradDistributionWiener_ffd_7071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7072> AgradDistributionWiener_ffd_7072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7073> AgradDistributionWiener_ffd_7073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7074> AgradDistributionWiener_ffd_7074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7075> AgradDistributionWiener_ffd_7075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7076> AgradDistributionWiener_ffd_7076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7077> AgradDistributionWiener_ffd_7077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7078> AgradDistributionWiener_ffd_7078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7079> AgradDistributionWiener_ffd_7079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7080> AgradDistributionWiener_ffd_7080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7081> AgradDistributionWiener_ffd_7081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7082> AgradDistributionWiener_ffd_7082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7083> AgradDistributionWiener_ffd_7083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7084> AgradDistributionWiener_ffd_7084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7085> AgradDistributionWiener_ffd_7085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7086> AgradDistributionWiener_ffd_7086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7087> AgradDistributionWiener_ffd_7087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7088> AgradDistributionWiener_ffd_7088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7089> AgradDistributionWiener_ffd_7089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7090> AgradDistributionWiener_ffd_7090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7091> AgradDistributionWiener_ffd_7091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7092> AgradDistributionWiener_ffd_7092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7093> AgradDistributionWiener_ffd_7093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7094> AgradDistributionWiener_ffd_7094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7095> AgradDistributionWiener_ffd_7095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7096> AgradDistributionWiener_ffd_7096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7097> AgradDistributionWiener_ffd_7097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7098> AgradDistributionWiener_ffd_7098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7099> AgradDistributionWiener_ffd_7099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7000, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7001, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7002, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7003, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7004, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7005, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7006, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7007, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7008, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7009, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7010, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7011, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7012, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7013, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7014, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7015, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7016, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7017, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7018, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7019, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7020, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7021, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7022, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7023, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7024, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7025, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7026, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7027, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7028, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7029, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7030, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7031, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7032, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7033, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7034, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7035, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7036, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7037, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7038, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7039, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7040, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7041, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7042, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7043, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7044, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7045, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7046, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7047, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7048, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7049, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7050, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7051, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7052, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7053, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7054, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7055, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7056, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7057, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7058, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7059, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7060, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7061, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7062, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7063, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7064, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7065, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7066, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7067, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7068, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7069, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7070, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7071, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7072, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7073, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7074, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7075, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7076, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7077, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7078, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7079, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7080, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7081, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7082, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7083, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7084, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7085, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7086, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7087, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7088, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7089, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7090, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7091, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7092, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7093, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7094, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7095, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7096, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7097, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7098, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7099, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7000;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7001;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_7002;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_7003;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7004;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_7005;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_7006;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7007;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_7008;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_7009;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7010;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_7011;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_7012;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7013;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7014;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7015;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7016;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7017;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7018;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7019;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty> type_v_7020;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_7021;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7022;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty> type_v_7023;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_7024;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7025;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_7026;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_7027;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7028;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_7029;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_7030;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7031;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7032;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7033;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7034;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7035;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7036;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7037;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty> type_v_7038;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty> type_v_7039;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7040;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty> type_v_7041;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_7042;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7043;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_7044;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_7045;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7046;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_7047;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_7048;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7049;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7050;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7051;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7052;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7053;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7054;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7055;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_7056;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_7057;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7058;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_7059;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_7060;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7061;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_7062;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_7063;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7064;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_7065;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_7066;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7067;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7068;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7069;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7070;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7071;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7072;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7073;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_7074;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_7075;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7076;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_7077;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_7078;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7079;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_7080;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_7081;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7082;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_7083;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_7084;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7085;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7086;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7087;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7088;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7089;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7090;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7091;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_7092;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_7093;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7094;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_7095;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_7096;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7097;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_7098;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_7099;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7000> AgradDistributionWiener_v_7000;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7001> AgradDistributionWiener_v_7001;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7002> AgradDistributionWiener_v_7002;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7003> AgradDistributionWiener_v_7003;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7004> AgradDistributionWiener_v_7004;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7005> AgradDistributionWiener_v_7005;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7006> AgradDistributionWiener_v_7006;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7007> AgradDistributionWiener_v_7007;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7008> AgradDistributionWiener_v_7008;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7009> AgradDistributionWiener_v_7009;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7010> AgradDistributionWiener_v_7010;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7011> AgradDistributionWiener_v_7011;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7012> AgradDistributionWiener_v_7012;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7013> AgradDistributionWiener_v_7013;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7014> AgradDistributionWiener_v_7014;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7015> AgradDistributionWiener_v_7015;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7016> AgradDistributionWiener_v_7016;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7017> AgradDistributionWiener_v_7017;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7018> AgradDistributionWiener_v_7018;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7019> AgradDistributionWiener_v_7019;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7020> AgradDistributionWiener_v_7020;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7021> AgradDistributionWiener_v_7021;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7022> AgradDistributionWiener_v_7022;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7023> AgradDistributionWiener_v_7023;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7024> AgradDistributionWiener_v_7024;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7025> AgradDistributionWiener_v_7025;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7026> AgradDistributionWiener_v_7026;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7027> AgradDistributionWiener_v_7027;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7028> AgradDistributionWiener_v_7028;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7029> AgradDistributionWiener_v_7029;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7030> AgradDistributionWiener_v_7030;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7031> AgradDistributionWiener_v_7031;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7032> AgradDistributionWiener_v_7032;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7033> AgradDistributionWiener_v_7033;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7034> AgradDistributionWiener_v_7034;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7035> AgradDistributionWiener_v_7035;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7036> AgradDistributionWiener_v_7036;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7037> AgradDistributionWiener_v_7037;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7038> AgradDistributionWiener_v_7038;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7039> AgradDistributionWiener_v_7039;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7040> AgradDistributionWiener_v_7040;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7041> AgradDistributionWiener_v_7041;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7042> AgradDistributionWiener_v_7042;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7043> AgradDistributionWiener_v_7043;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7044> AgradDistributionWiener_v_7044;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7045> AgradDistributionWiener_v_7045;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7046> AgradDistributionWiener_v_7046;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7047> AgradDistributionWiener_v_7047;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7048> AgradDistributionWiener_v_7048;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7049> AgradDistributionWiener_v_7049;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7050> AgradDistributionWiener_v_7050;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7051> AgradDistributionWiener_v_7051;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7052> AgradDistributionWiener_v_7052;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7053> AgradDistributionWiener_v_7053;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7054> AgradDistributionWiener_v_7054;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7055> AgradDistributionWiener_v_7055;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7056> AgradDistributionWiener_v_7056;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7057> AgradDistributionWiener_v_7057;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7058> AgradDistributionWiener_v_7058;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7059> AgradDistributionWiener_v_7059;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7060> AgradDistributionWiener_v_7060;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7061> AgradDistributionWiener_v_7061;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7062> AgradDistributionWiener_v_7062;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7063> AgradDistributionWiener_v_7063;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7064> AgradDistributionWiener_v_7064;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7065> AgradDistributionWiener_v_7065;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7066> AgradDistributionWiener_v_7066;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7067> AgradDistributionWiener_v_7067;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7068> AgradDistributionWiener_v_7068;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7069> AgradDistributionWiener_v_7069;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7070> AgradDistributionWiener_v_7070;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7071> AgradDistributionWiener_v_7071;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7072> AgradDistributionWiener_v_7072;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7073> AgradDistributionWiener_v_7073;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7074> AgradDistributionWiener_v_7074;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7075> AgradDistributionWiener_v_7075;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7076> AgradDistributionWiener_v_7076;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7077> AgradDistributionWiener_v_7077;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7078> AgradDistributionWiener_v_7078;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7079> AgradDistributionWiener_v_7079;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7080> AgradDistributionWiener_v_7080;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7081> AgradDistributionWiener_v_7081;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7082> AgradDistributionWiener_v_7082;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7083> AgradDistributionWiener_v_7083;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7084> AgradDistributionWiener_v_7084;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7085> AgradDistributionWiener_v_7085;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7086> AgradDistributionWiener_v_7086;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7087> AgradDistributionWiener_v_7087;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7088> AgradDistributionWiener_v_7088;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7089> AgradDistributionWiener_v_7089;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7090> AgradDistributionWiener_v_7090;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7091> AgradDistributionWiener_v_7091;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7092> AgradDistributionWiener_v_7092;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7093> AgradDistributionWiener_v_7093;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7094> AgradDistributionWiener_v_7094;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7095> AgradDistributionWiener_v_7095;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7096> AgradDistributionWiener_v_7096;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7097> AgradDistributionWiener_v_7097;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7098> AgradDistributionWiener_v_7098;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7099> AgradDistributionWiener_v_7099;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7000, AgradDistributionTestFixture, AgradDistributionWiener_v_7000);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7001, AgradDistributionTestFixture, AgradDistributionWiener_v_7001);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7002, AgradDistributionTestFixture, AgradDistributionWiener_v_7002);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7003, AgradDistributionTestFixture, AgradDistributionWiener_v_7003);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7004, AgradDistributionTestFixture, AgradDistributionWiener_v_7004);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7005, AgradDistributionTestFixture, AgradDistributionWiener_v_7005);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7006, AgradDistributionTestFixture, AgradDistributionWiener_v_7006);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7007, AgradDistributionTestFixture, AgradDistributionWiener_v_7007);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7008, AgradDistributionTestFixture, AgradDistributionWiener_v_7008);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7009, AgradDistributionTestFixture, AgradDistributionWiener_v_7009);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7010, AgradDistributionTestFixture, AgradDistributionWiener_v_7010);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7011, AgradDistributionTestFixture, AgradDistributionWiener_v_7011);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7012, AgradDistributionTestFixture, AgradDistributionWiener_v_7012);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7013, AgradDistributionTestFixture, AgradDistributionWiener_v_7013);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7014, AgradDistributionTestFixture, AgradDistributionWiener_v_7014);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7015, AgradDistributionTestFixture, AgradDistributionWiener_v_7015);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7016, AgradDistributionTestFixture, AgradDistributionWiener_v_7016);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7017, AgradDistributionTestFixture, AgradDistributionWiener_v_7017);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7018, AgradDistributionTestFixture, AgradDistributionWiener_v_7018);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7019, AgradDistributionTestFixture, AgradDistributionWiener_v_7019);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7020, AgradDistributionTestFixture, AgradDistributionWiener_v_7020);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7021, AgradDistributionTestFixture, AgradDistributionWiener_v_7021);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7022, AgradDistributionTestFixture, AgradDistributionWiener_v_7022);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7023, AgradDistributionTestFixture, AgradDistributionWiener_v_7023);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7024, AgradDistributionTestFixture, AgradDistributionWiener_v_7024);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7025, AgradDistributionTestFixture, AgradDistributionWiener_v_7025);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7026, AgradDistributionTestFixture, AgradDistributionWiener_v_7026);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7027, AgradDistributionTestFixture, AgradDistributionWiener_v_7027);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7028, AgradDistributionTestFixture, AgradDistributionWiener_v_7028);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7029, AgradDistributionTestFixture, AgradDistributionWiener_v_7029);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7030, AgradDistributionTestFixture, AgradDistributionWiener_v_7030);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7031, AgradDistributionTestFixture, AgradDistributionWiener_v_7031);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7032, AgradDistributionTestFixture, AgradDistributionWiener_v_7032);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7033, AgradDistributionTestFixture, AgradDistributionWiener_v_7033);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7034, AgradDistributionTestFixture, AgradDistributionWiener_v_7034);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7035, AgradDistributionTestFixture, AgradDistributionWiener_v_7035);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7036, AgradDistributionTestFixture, AgradDistributionWiener_v_7036);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7037, AgradDistributionTestFixture, AgradDistributionWiener_v_7037);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7038, AgradDistributionTestFixture, AgradDistributionWiener_v_7038);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7039, AgradDistributionTestFixture, AgradDistributionWiener_v_7039);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7040, AgradDistributionTestFixture, AgradDistributionWiener_v_7040);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7041, AgradDistributionTestFixture, AgradDistributionWiener_v_7041);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7042, AgradDistributionTestFixture, AgradDistributionWiener_v_7042);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7043, AgradDistributionTestFixture, AgradDistributionWiener_v_7043);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7044, AgradDistributionTestFixture, AgradDistributionWiener_v_7044);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7045, AgradDistributionTestFixture, AgradDistributionWiener_v_7045);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7046, AgradDistributionTestFixture, AgradDistributionWiener_v_7046);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7047, AgradDistributionTestFixture, AgradDistributionWiener_v_7047);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7048, AgradDistributionTestFixture, AgradDistributionWiener_v_7048);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7049, AgradDistributionTestFixture, AgradDistributionWiener_v_7049);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7050, AgradDistributionTestFixture, AgradDistributionWiener_v_7050);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7051, AgradDistributionTestFixture, AgradDistributionWiener_v_7051);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7052, AgradDistributionTestFixture, AgradDistributionWiener_v_7052);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7053, AgradDistributionTestFixture, AgradDistributionWiener_v_7053);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7054, AgradDistributionTestFixture, AgradDistributionWiener_v_7054);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7055, AgradDistributionTestFixture, AgradDistributionWiener_v_7055);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7056, AgradDistributionTestFixture, AgradDistributionWiener_v_7056);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7057, AgradDistributionTestFixture, AgradDistributionWiener_v_7057);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7058, AgradDistributionTestFixture, AgradDistributionWiener_v_7058);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7059, AgradDistributionTestFixture, AgradDistributionWiener_v_7059);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7060, AgradDistributionTestFixture, AgradDistributionWiener_v_7060);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7061, AgradDistributionTestFixture, AgradDistributionWiener_v_7061);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7062, AgradDistributionTestFixture, AgradDistributionWiener_v_7062);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7063, AgradDistributionTestFixture, AgradDistributionWiener_v_7063);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7064, AgradDistributionTestFixture, AgradDistributionWiener_v_7064);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7065, AgradDistributionTestFixture, AgradDistributionWiener_v_7065);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7066, AgradDistributionTestFixture, AgradDistributionWiener_v_7066);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7067, AgradDistributionTestFixture, AgradDistributionWiener_v_7067);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7068, AgradDistributionTestFixture, AgradDistributionWiener_v_7068);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7069, AgradDistributionTestFixture, AgradDistributionWiener_v_7069);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7070, AgradDistributionTestFixture, AgradDistributionWiener_v_7070);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7071, AgradDistributionTestFixture, AgradDistributionWiener_v_7071);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7072, AgradDistributionTestFixture, AgradDistributionWiener_v_7072);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7073, AgradDistributionTestFixture, AgradDistributionWiener_v_7073);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7074, AgradDistributionTestFixture, AgradDistributionWiener_v_7074);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7075, AgradDistributionTestFixture, AgradDistributionWiener_v_7075);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7076, AgradDistributionTestFixture, AgradDistributionWiener_v_7076);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7077, AgradDistributionTestFixture, AgradDistributionWiener_v_7077);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7078, AgradDistributionTestFixture, AgradDistributionWiener_v_7078);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7079, AgradDistributionTestFixture, AgradDistributionWiener_v_7079);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7080, AgradDistributionTestFixture, AgradDistributionWiener_v_7080);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7081, AgradDistributionTestFixture, AgradDistributionWiener_v_7081);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7082, AgradDistributionTestFixture, AgradDistributionWiener_v_7082);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7083, AgradDistributionTestFixture, AgradDistributionWiener_v_7083);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7084, AgradDistributionTestFixture, AgradDistributionWiener_v_7084);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7085, AgradDistributionTestFixture, AgradDistributionWiener_v_7085);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7086, AgradDistributionTestFixture, AgradDistributionWiener_v_7086);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7087, AgradDistributionTestFixture, AgradDistributionWiener_v_7087);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7088, AgradDistributionTestFixture, AgradDistributionWiener_v_7088);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7089, AgradDistributionTestFixture, AgradDistributionWiener_v_7089);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7090, AgradDistributionTestFixture, AgradDistributionWiener_v_7090);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7091, AgradDistributionTestFixture, AgradDistributionWiener_v_7091);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7092, AgradDistributionTestFixture, AgradDistributionWiener_v_7092);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7093, AgradDistributionTestFixture, AgradDistributionWiener_v_7093);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7094, AgradDistributionTestFixture, AgradDistributionWiener_v_7094);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7095, AgradDistributionTestFixture, AgradDistributionWiener_v_7095);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7096, AgradDistributionTestFixture, AgradDistributionWiener_v_7096);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7097, AgradDistributionTestFixture, AgradDistributionWiener_v_7097);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7098, AgradDistributionTestFixture, AgradDistributionWiener_v_7098);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7099, AgradDistributionTestFixture, AgradDistributionWiener_v_7099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7100;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, double, empty> type_fd_7101;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, std::vector<double>, empty> type_fd_7102;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7103;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, fvar<double>, empty> type_fd_7104;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, std::vector<fvar<double>>, empty> type_fd_7105;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7106;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, double, empty> type_fd_7107;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, std::vector<double>, empty> type_fd_7108;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7109;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, fvar<double>, empty> type_fd_7110;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_7111;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7112;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_7113;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7114;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7115;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7116;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7117;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7118;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, double, empty> type_fd_7119;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, std::vector<double>, empty> type_fd_7120;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7121;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, fvar<double>, empty> type_fd_7122;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, std::vector<fvar<double>>, empty> type_fd_7123;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7124;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, double, empty> type_fd_7125;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_7126;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7127;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, fvar<double>, empty> type_fd_7128;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_7129;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7130;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_7131;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7132;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7133;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7134;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7135;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7136;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, double, empty> type_fd_7137;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, std::vector<double>, empty> type_fd_7138;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7139;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, fvar<double>, empty> type_fd_7140;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, std::vector<fvar<double>>, empty> type_fd_7141;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7142;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, double, empty> type_fd_7143;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fd_7144;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7145;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, fvar<double>, empty> type_fd_7146;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_7147;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7148;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_7149;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7150;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7151;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, double, empty> type_fd_7155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<double>, empty> type_fd_7156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, fvar<double>, empty> type_fd_7158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_7159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, double, empty> type_fd_7161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_7162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_7164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_7165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_7167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fd_7173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_7174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<double>, empty> type_fd_7176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<double>>, empty> type_fd_7177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fd_7179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fd_7180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<double>, empty> type_fd_7182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_7183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_7185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7188;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7189;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7190;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_7191;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_7192;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7193;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_7194;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_7195;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7196;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_7197;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_7198;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7100> AgradDistributionWiener_fd_7100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7101> AgradDistributionWiener_fd_7101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7102> AgradDistributionWiener_fd_7102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7103> AgradDistributionWiener_fd_7103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7104> AgradDistributionWiener_fd_7104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7105> AgradDistributionWiener_fd_7105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7106> AgradDistributionWiener_fd_7106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7107> AgradDistributionWiener_fd_7107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7108> AgradDistributionWiener_fd_7108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7109> AgradDistributionWiener_fd_7109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7110> AgradDistributionWiener_fd_7110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7111> AgradDistributionWiener_fd_7111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7112> AgradDistributionWiener_fd_7112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7113> AgradDistributionWiener_fd_7113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7114> AgradDistributionWiener_fd_7114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7115> AgradDistributionWiener_fd_7115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7116> AgradDistributionWiener_fd_7116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7117> AgradDistributionWiener_fd_7117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7118> AgradDistributionWiener_fd_7118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7119> AgradDistributionWiener_fd_7119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7120> AgradDistributionWiener_fd_7120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7121> AgradDistributionWiener_fd_7121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7122> AgradDistributionWiener_fd_7122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7123> AgradDistributionWiener_fd_7123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7124> AgradDistributionWiener_fd_7124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7125> AgradDistributionWiener_fd_7125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7126> AgradDistributionWiener_fd_7126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7127> AgradDistributionWiener_fd_7127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7128> AgradDistributionWiener_fd_7128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7129> AgradDistributionWiener_fd_7129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7130> AgradDistributionWiener_fd_7130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7131> AgradDistributionWiener_fd_7131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7132> AgradDistributionWiener_fd_7132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7133> AgradDistributionWiener_fd_7133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7134> AgradDistributionWiener_fd_7134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7135> AgradDistributionWiener_fd_7135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7136> AgradDistributionWiener_fd_7136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7137> AgradDistributionWiener_fd_7137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7138> AgradDistributionWiener_fd_7138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7139> AgradDistributionWiener_fd_7139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7140> AgradDistributionWiener_fd_7140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7141> AgradDistributionWiener_fd_7141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7142> AgradDistributionWiener_fd_7142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7143> AgradDistributionWiener_fd_7143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7144> AgradDistributionWiener_fd_7144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7145> AgradDistributionWiener_fd_7145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7146> AgradDistributionWiener_fd_7146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7147> AgradDistributionWiener_fd_7147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7148> AgradDistributionWiener_fd_7148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7149> AgradDistributionWiener_fd_7149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7150> AgradDistributionWiener_fd_7150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7151> AgradDistributionWiener_fd_7151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7152> AgradDistributionWiener_fd_7152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7153> AgradDistributionWiener_fd_7153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7154> AgradDistributionWiener_fd_7154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7155> AgradDistributionWiener_fd_7155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7156> AgradDistributionWiener_fd_7156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7157> AgradDistributionWiener_fd_7157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7158> AgradDistributionWiener_fd_7158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7159> AgradDistributionWiener_fd_7159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7160> AgradDistributionWiener_fd_7160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7161> AgradDistributionWiener_fd_7161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7162> AgradDistributionWiener_fd_7162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7163> AgradDistributionWiener_fd_7163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7164> AgradDistributionWiener_fd_7164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7165> AgradDistributionWiener_fd_7165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7166> AgradDistributionWiener_fd_7166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7167> AgradDistributionWiener_fd_7167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7168> AgradDistributionWiener_fd_7168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7169> AgradDistributionWiener_fd_7169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7170> AgradDistributionWiener_fd_7170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7171> AgradDistributionWiener_fd_7171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7172> AgradDistributionWiener_fd_7172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7173> AgradDistributionWiener_fd_7173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7174> AgradDistributionWiener_fd_7174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7175> AgradDistributionWiener_fd_7175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7176> AgradDistributionWiener_fd_7176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7177> AgradDistributionWiener_fd_7177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7178> AgradDistributionWiener_fd_7178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7179> AgradDistributionWiener_fd_7179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7180> AgradDistributionWiener_fd_7180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7181> AgradDistributionWiener_fd_7181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7182> AgradDistributionWiener_fd_7182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7183> AgradDistributionWiener_fd_7183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7184> AgradDistributionWiener_fd_7184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7185> AgradDistributionWiener_fd_7185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7186> AgradDistributionWiener_fd_7186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7187> AgradDistributionWiener_fd_7187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7188> AgradDistributionWiener_fd_7188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7189> AgradDistributionWiener_fd_7189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7190> AgradDistributionWiener_fd_7190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7191> AgradDistributionWiener_fd_7191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7192> AgradDistributionWiener_fd_7192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7193> AgradDistributionWiener_fd_7193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7194> AgradDistributionWiener_fd_7194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7195> AgradDistributionWiener_fd_7195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7196> AgradDistributionWiener_fd_7196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7197> AgradDistributionWiener_fd_7197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7198> AgradDistributionWiener_fd_7198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7199> AgradDistributionWiener_fd_7199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7100, AgradDistributionTestFixture, AgradDistributionWiener_fd_7100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7101, AgradDistributionTestFixture, AgradDistributionWiener_fd_7101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7102, AgradDistributionTestFixture, AgradDistributionWiener_fd_7102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7103, AgradDistributionTestFixture, AgradDistributionWiener_fd_7103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7104, AgradDistributionTestFixture, AgradDistributionWiener_fd_7104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7105, AgradDistributionTestFixture, AgradDistributionWiener_fd_7105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7106, AgradDistributionTestFixture, AgradDistributionWiener_fd_7106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7107, AgradDistributionTestFixture, AgradDistributionWiener_fd_7107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7108, AgradDistributionTestFixture, AgradDistributionWiener_fd_7108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7109, AgradDistributionTestFixture, AgradDistributionWiener_fd_7109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7110, AgradDistributionTestFixture, AgradDistributionWiener_fd_7110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7111, AgradDistributionTestFixture, AgradDistributionWiener_fd_7111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7112, AgradDistributionTestFixture, AgradDistributionWiener_fd_7112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7113, AgradDistributionTestFixture, AgradDistributionWiener_fd_7113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7114, AgradDistributionTestFixture, AgradDistributionWiener_fd_7114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7115, AgradDistributionTestFixture, AgradDistributionWiener_fd_7115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7116, AgradDistributionTestFixture, AgradDistributionWiener_fd_7116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7117, AgradDistributionTestFixture, AgradDistributionWiener_fd_7117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7118, AgradDistributionTestFixture, AgradDistributionWiener_fd_7118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7119, AgradDistributionTestFixture, AgradDistributionWiener_fd_7119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7120, AgradDistributionTestFixture, AgradDistributionWiener_fd_7120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7121, AgradDistributionTestFixture, AgradDistributionWiener_fd_7121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7122, AgradDistributionTestFixture, AgradDistributionWiener_fd_7122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7123, AgradDistributionTestFixture, AgradDistributionWiener_fd_7123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7124, AgradDistributionTestFixture, AgradDistributionWiener_fd_7124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7125, AgradDistributionTestFixture, AgradDistributionWiener_fd_7125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7126, AgradDistributionTestFixture, AgradDistributionWiener_fd_7126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7127, AgradDistributionTestFixture, AgradDistributionWiener_fd_7127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7128, AgradDistributionTestFixture, AgradDistributionWiener_fd_7128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7129, AgradDistributionTestFixture, AgradDistributionWiener_fd_7129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7130, AgradDistributionTestFixture, AgradDistributionWiener_fd_7130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7131, AgradDistributionTestFixture, AgradDistributionWiener_fd_7131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7132, AgradDistributionTestFixture, AgradDistributionWiener_fd_7132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7133, AgradDistributionTestFixture, AgradDistributionWiener_fd_7133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7134, AgradDistributionTestFixture, AgradDistributionWiener_fd_7134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7135, AgradDistributionTestFixture, AgradDistributionWiener_fd_7135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7136, AgradDistributionTestFixture, AgradDistributionWiener_fd_7136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7137, AgradDistributionTestFixture, AgradDistributionWiener_fd_7137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7138, AgradDistributionTestFixture, AgradDistributionWiener_fd_7138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7139, AgradDistributionTestFixture, AgradDistributionWiener_fd_7139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7140, AgradDistributionTestFixture, AgradDistributionWiener_fd_7140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7141, AgradDistributionTestFixture, AgradDistributionWiener_fd_7141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7142, AgradDistributionTestFixture, AgradDistributionWiener_fd_7142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7143, AgradDistributionTestFixture, AgradDistributionWiener_fd_7143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7144, AgradDistributionTestFixture, AgradDistributionWiener_fd_7144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7145, AgradDistributionTestFixture, AgradDistributionWiener_fd_7145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7146, AgradDistributionTestFixture, AgradDistributionWiener_fd_7146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7147, AgradDistributionTestFixture, AgradDistributionWiener_fd_7147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7148, AgradDistributionTestFixture, AgradDistributionWiener_fd_7148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7149, AgradDistributionTestFixture, AgradDistributionWiener_fd_7149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7150, AgradDistributionTestFixture, AgradDistributionWiener_fd_7150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7151, AgradDistributionTestFixture, AgradDistributionWiener_fd_7151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7152, AgradDistributionTestFixture, AgradDistributionWiener_fd_7152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7153, AgradDistributionTestFixture, AgradDistributionWiener_fd_7153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7154, AgradDistributionTestFixture, AgradDistributionWiener_fd_7154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7155, AgradDistributionTestFixture, AgradDistributionWiener_fd_7155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7156, AgradDistributionTestFixture, AgradDistributionWiener_fd_7156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7157, AgradDistributionTestFixture, AgradDistributionWiener_fd_7157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7158, AgradDistributionTestFixture, AgradDistributionWiener_fd_7158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7159, AgradDistributionTestFixture, AgradDistributionWiener_fd_7159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7160, AgradDistributionTestFixture, AgradDistributionWiener_fd_7160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7161, AgradDistributionTestFixture, AgradDistributionWiener_fd_7161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7162, AgradDistributionTestFixture, AgradDistributionWiener_fd_7162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7163, AgradDistributionTestFixture, AgradDistributionWiener_fd_7163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7164, AgradDistributionTestFixture, AgradDistributionWiener_fd_7164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7165, AgradDistributionTestFixture, AgradDistributionWiener_fd_7165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7166, AgradDistributionTestFixture, AgradDistributionWiener_fd_7166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7167, AgradDistributionTestFixture, AgradDistributionWiener_fd_7167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7168, AgradDistributionTestFixture, AgradDistributionWiener_fd_7168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7169, AgradDistributionTestFixture, AgradDistributionWiener_fd_7169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7170, AgradDistributionTestFixture, AgradDistributionWiener_fd_7170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7171, AgradDistributionTestFixture, AgradDistributionWiener_fd_7171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7172, AgradDistributionTestFixture, AgradDistributionWiener_fd_7172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7173, AgradDistributionTestFixture, AgradDistributionWiener_fd_7173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7174, AgradDistributionTestFixture, AgradDistributionWiener_fd_7174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7175, AgradDistributionTestFixture, AgradDistributionWiener_fd_7175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7176, AgradDistributionTestFixture, AgradDistributionWiener_fd_7176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7177, AgradDistributionTestFixture, AgradDistributionWiener_fd_7177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7178, AgradDistributionTestFixture, AgradDistributionWiener_fd_7178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7179, AgradDistributionTestFixture, AgradDistributionWiener_fd_7179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7180, AgradDistributionTestFixture, AgradDistributionWiener_fd_7180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7181, AgradDistributionTestFixture, AgradDistributionWiener_fd_7181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7182, AgradDistributionTestFixture, AgradDistributionWiener_fd_7182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7183, AgradDistributionTestFixture, AgradDistributionWiener_fd_7183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7184, AgradDistributionTestFixture, AgradDistributionWiener_fd_7184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7185, AgradDistributionTestFixture, AgradDistributionWiener_fd_7185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7186, AgradDistributionTestFixture, AgradDistributionWiener_fd_7186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7187, AgradDistributionTestFixture, AgradDistributionWiener_fd_7187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7188, AgradDistributionTestFixture, AgradDistributionWiener_fd_7188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7189, AgradDistributionTestFixture, AgradDistributionWiener_fd_7189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7190, AgradDistributionTestFixture, AgradDistributionWiener_fd_7190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7191, AgradDistributionTestFixture, AgradDistributionWiener_fd_7191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7192, AgradDistributionTestFixture, AgradDistributionWiener_fd_7192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7193, AgradDistributionTestFixture, AgradDistributionWiener_fd_7193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7194, AgradDistributionTestFixture, AgradDistributionWiener_fd_7194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7195, AgradDistributionTestFixture, AgradDistributionWiener_fd_7195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7196, AgradDistributionTestFixture, AgradDistributionWiener_fd_7196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7197, AgradDistributionTestFixture, AgradDistributionWiener_fd_7197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7198, AgradDistributionTestFixture, AgradDistributionWiener_fd_7198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7199, AgradDistributionTestFixture, AgradDistributionWiener_fd_7199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7100;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, double, empty> type_ffv_7101;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty> type_ffv_7102;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7103;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty> type_ffv_7104;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_7105;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7106;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty> type_ffv_7107;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty> type_ffv_7108;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7109;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_7110;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7111;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7112;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_7113;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7114;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7115;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7116;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7117;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7118;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty> type_ffv_7119;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_7120;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7121;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_7122;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_7123;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7124;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_7125;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_7126;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7127;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_7128;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7129;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7130;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_7131;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7132;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7133;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7134;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7135;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7136;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty> type_ffv_7137;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty> type_ffv_7138;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7139;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty> type_ffv_7140;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_7141;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7142;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty> type_ffv_7143;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffv_7144;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7145;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_7146;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7147;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7148;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_7149;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7150;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7151;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty> type_ffv_7155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_7156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_7158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_7159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_7161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_7162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_7164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_7167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffv_7173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_7174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_7176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_7177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_7179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_7180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_7182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_7185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7188;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7189;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7190;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_7191;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_7192;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7193;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_7194;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_7195;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7196;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_7197;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_7198;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7100> AgradDistributionWiener_ffv_7100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7101> AgradDistributionWiener_ffv_7101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7102> AgradDistributionWiener_ffv_7102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7103> AgradDistributionWiener_ffv_7103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7104> AgradDistributionWiener_ffv_7104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7105> AgradDistributionWiener_ffv_7105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7106> AgradDistributionWiener_ffv_7106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7107> AgradDistributionWiener_ffv_7107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7108> AgradDistributionWiener_ffv_7108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7109> AgradDistributionWiener_ffv_7109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7110> AgradDistributionWiener_ffv_7110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7111> AgradDistributionWiener_ffv_7111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7112> AgradDistributionWiener_ffv_7112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7113> AgradDistributionWiener_ffv_7113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7114> AgradDistributionWiener_ffv_7114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7115> AgradDistributionWiener_ffv_7115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7116> AgradDistributionWiener_ffv_7116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7117> AgradDistributionWiener_ffv_7117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7118> AgradDistributionWiener_ffv_7118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7119> AgradDistributionWiener_ffv_7119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7120> AgradDistributionWiener_ffv_7120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7121> AgradDistributionWiener_ffv_7121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7122> AgradDistributionWiener_ffv_7122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7123> AgradDistributionWiener_ffv_7123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7124> AgradDistributionWiener_ffv_7124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7125> AgradDistributionWiener_ffv_7125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7126> AgradDistributionWiener_ffv_7126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7127> AgradDistributionWiener_ffv_7127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7128> AgradDistributionWiener_ffv_7128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7129> AgradDistributionWiener_ffv_7129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7130> AgradDistributionWiener_ffv_7130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7131> AgradDistributionWiener_ffv_7131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7132> AgradDistributionWiener_ffv_7132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7133> AgradDistributionWiener_ffv_7133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7134> AgradDistributionWiener_ffv_7134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7135> AgradDistributionWiener_ffv_7135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7136> AgradDistributionWiener_ffv_7136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7137> AgradDistributionWiener_ffv_7137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7138> AgradDistributionWiener_ffv_7138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7139> AgradDistributionWiener_ffv_7139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7140> AgradDistributionWiener_ffv_7140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7141> AgradDistributionWiener_ffv_7141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7142> AgradDistributionWiener_ffv_7142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7143> AgradDistributionWiener_ffv_7143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7144> AgradDistributionWiener_ffv_7144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7145> AgradDistributionWiener_ffv_7145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7146> AgradDistributionWiener_ffv_7146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7147> AgradDistributionWiener_ffv_7147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7148> AgradDistributionWiener_ffv_7148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7149> AgradDistributionWiener_ffv_7149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7150> AgradDistributionWiener_ffv_7150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7151> AgradDistributionWiener_ffv_7151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7152> AgradDistributionWiener_ffv_7152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7153> AgradDistributionWiener_ffv_7153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7154> AgradDistributionWiener_ffv_7154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7155> AgradDistributionWiener_ffv_7155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7156> AgradDistributionWiener_ffv_7156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7157> AgradDistributionWiener_ffv_7157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7158> AgradDistributionWiener_ffv_7158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7159> AgradDistributionWiener_ffv_7159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7160> AgradDistributionWiener_ffv_7160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7161> AgradDistributionWiener_ffv_7161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7162> AgradDistributionWiener_ffv_7162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7163> AgradDistributionWiener_ffv_7163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7164> AgradDistributionWiener_ffv_7164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7165> AgradDistributionWiener_ffv_7165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7166> AgradDistributionWiener_ffv_7166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7167> AgradDistributionWiener_ffv_7167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7168> AgradDistributionWiener_ffv_7168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7169> AgradDistributionWiener_ffv_7169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7170> AgradDistributionWiener_ffv_7170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7171> AgradDistributionWiener_ffv_7171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7172> AgradDistributionWiener_ffv_7172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7173> AgradDistributionWiener_ffv_7173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7174> AgradDistributionWiener_ffv_7174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7175> AgradDistributionWiener_ffv_7175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7176> AgradDistributionWiener_ffv_7176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7177> AgradDistributionWiener_ffv_7177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7178> AgradDistributionWiener_ffv_7178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7179> AgradDistributionWiener_ffv_7179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7180> AgradDistributionWiener_ffv_7180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7181> AgradDistributionWiener_ffv_7181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7182> AgradDistributionWiener_ffv_7182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7183> AgradDistributionWiener_ffv_7183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7184> AgradDistributionWiener_ffv_7184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7185> AgradDistributionWiener_ffv_7185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7186> AgradDistributionWiener_ffv_7186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7187> AgradDistributionWiener_ffv_7187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7188> AgradDistributionWiener_ffv_7188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7189> AgradDistributionWiener_ffv_7189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7190> AgradDistributionWiener_ffv_7190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7191> AgradDistributionWiener_ffv_7191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7192> AgradDistributionWiener_ffv_7192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7193> AgradDistributionWiener_ffv_7193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7194> AgradDistributionWiener_ffv_7194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7195> AgradDistributionWiener_ffv_7195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7196> AgradDistributionWiener_ffv_7196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7197> AgradDistributionWiener_ffv_7197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7198> AgradDistributionWiener_ffv_7198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7199> AgradDistributionWiener_ffv_7199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7100, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7101, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7102, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7103, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7104, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7105, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7106, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7107, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7108, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7109, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7110, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7111, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7112, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7113, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7114, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7115, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7116, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7117, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7118, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7119, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7120, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7121, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7122, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7123, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7124, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7125, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7126, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7127, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7128, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7129, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7130, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7131, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7132, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7133, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7134, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7135, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7136, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7137, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7138, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7139, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7140, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7141, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7142, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7143, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7144, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7145, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7146, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7147, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7148, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7149, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7150, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7151, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7152, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7153, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7154, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7155, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7156, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7157, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7158, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7159, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7160, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7161, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7162, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7163, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7164, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7165, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7166, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7167, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7168, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7169, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7170, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7171, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7172, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7173, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7174, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7175, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7176, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7177, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7178, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7179, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7180, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7181, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7182, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7183, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7184, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7185, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7186, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7187, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7188, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7189, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7190, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7191, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7192, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7193, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7194, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7195, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7196, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7197, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7198, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7199, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7100;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, double, empty> type_fv_7101;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, std::vector<double>, empty> type_fv_7102;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7103;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, fvar<var>, empty> type_fv_7104;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, std::vector<fvar<var>>, empty> type_fv_7105;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7106;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, double, empty> type_fv_7107;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, std::vector<double>, empty> type_fv_7108;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7109;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, fvar<var>, empty> type_fv_7110;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_7111;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7112;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_7113;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7114;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7115;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7116;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7117;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7118;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, double, empty> type_fv_7119;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, std::vector<double>, empty> type_fv_7120;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7121;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, fvar<var>, empty> type_fv_7122;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, std::vector<fvar<var>>, empty> type_fv_7123;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7124;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, double, empty> type_fv_7125;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_7126;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7127;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, fvar<var>, empty> type_fv_7128;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_7129;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7130;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_7131;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7132;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7133;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7134;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7135;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7136;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, double, empty> type_fv_7137;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, std::vector<double>, empty> type_fv_7138;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7139;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, fvar<var>, empty> type_fv_7140;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, std::vector<fvar<var>>, empty> type_fv_7141;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7142;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, double, empty> type_fv_7143;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_fv_7144;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7145;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, fvar<var>, empty> type_fv_7146;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_7147;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7148;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_7149;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7150;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7151;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7152;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7153;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7154;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, double, empty> type_fv_7155;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<double>, empty> type_fv_7156;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7157;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, fvar<var>, empty> type_fv_7158;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_7159;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7160;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, double, empty> type_fv_7161;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_7162;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7163;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_7164;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_7165;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7166;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_7167;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7168;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7169;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7170;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7171;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7172;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_fv_7173;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_7174;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7175;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_7176;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_7177;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7178;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_7179;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_7180;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7181;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_7182;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_7183;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7184;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_7185;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7186;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7187;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7188;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7189;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7190;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_7191;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<double>, empty> type_fv_7192;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7193;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, fvar<var>, empty> type_fv_7194;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_7195;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7196;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, double, empty> type_fv_7197;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_7198;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7100> AgradDistributionWiener_fv_7100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7101> AgradDistributionWiener_fv_7101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7102> AgradDistributionWiener_fv_7102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7103> AgradDistributionWiener_fv_7103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7104> AgradDistributionWiener_fv_7104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7105> AgradDistributionWiener_fv_7105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7106> AgradDistributionWiener_fv_7106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7107> AgradDistributionWiener_fv_7107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7108> AgradDistributionWiener_fv_7108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7109> AgradDistributionWiener_fv_7109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7110> AgradDistributionWiener_fv_7110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7111> AgradDistributionWiener_fv_7111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7112> AgradDistributionWiener_fv_7112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7113> AgradDistributionWiener_fv_7113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7114> AgradDistributionWiener_fv_7114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7115> AgradDistributionWiener_fv_7115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7116> AgradDistributionWiener_fv_7116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7117> AgradDistributionWiener_fv_7117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7118> AgradDistributionWiener_fv_7118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7119> AgradDistributionWiener_fv_7119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7120> AgradDistributionWiener_fv_7120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7121> AgradDistributionWiener_fv_7121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7122> AgradDistributionWiener_fv_7122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7123> AgradDistributionWiener_fv_7123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7124> AgradDistributionWiener_fv_7124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7125> AgradDistributionWiener_fv_7125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7126> AgradDistributionWiener_fv_7126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7127> AgradDistributionWiener_fv_7127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7128> AgradDistributionWiener_fv_7128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7129> AgradDistributionWiener_fv_7129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7130> AgradDistributionWiener_fv_7130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7131> AgradDistributionWiener_fv_7131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7132> AgradDistributionWiener_fv_7132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7133> AgradDistributionWiener_fv_7133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7134> AgradDistributionWiener_fv_7134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7135> AgradDistributionWiener_fv_7135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7136> AgradDistributionWiener_fv_7136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7137> AgradDistributionWiener_fv_7137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7138> AgradDistributionWiener_fv_7138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7139> AgradDistributionWiener_fv_7139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7140> AgradDistributionWiener_fv_7140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7141> AgradDistributionWiener_fv_7141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7142> AgradDistributionWiener_fv_7142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7143> AgradDistributionWiener_fv_7143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7144> AgradDistributionWiener_fv_7144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7145> AgradDistributionWiener_fv_7145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7146> AgradDistributionWiener_fv_7146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7147> AgradDistributionWiener_fv_7147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7148> AgradDistributionWiener_fv_7148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7149> AgradDistributionWiener_fv_7149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7150> AgradDistributionWiener_fv_7150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7151> AgradDistributionWiener_fv_7151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7152> AgradDistributionWiener_fv_7152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7153> AgradDistributionWiener_fv_7153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7154> AgradDistributionWiener_fv_7154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7155> AgradDistributionWiener_fv_7155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7156> AgradDistributionWiener_fv_7156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7157> AgradDistributionWiener_fv_7157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7158> AgradDistributionWiener_fv_7158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7159> AgradDistributionWiener_fv_7159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7160> AgradDistributionWiener_fv_7160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7161> AgradDistributionWiener_fv_7161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7162> AgradDistributionWiener_fv_7162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7163> AgradDistributionWiener_fv_7163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7164> AgradDistributionWiener_fv_7164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7165> AgradDistributionWiener_fv_7165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7166> AgradDistributionWiener_fv_7166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7167> AgradDistributionWiener_fv_7167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7168> AgradDistributionWiener_fv_7168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7169> AgradDistributionWiener_fv_7169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7170> AgradDistributionWiener_fv_7170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7171> AgradDistributionWiener_fv_7171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7172> AgradDistributionWiener_fv_7172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7173> AgradDistributionWiener_fv_7173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7174> AgradDistributionWiener_fv_7174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7175> AgradDistributionWiener_fv_7175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7176> AgradDistributionWiener_fv_7176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7177> AgradDistributionWiener_fv_7177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7178> AgradDistributionWiener_fv_7178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7179> AgradDistributionWiener_fv_7179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7180> AgradDistributionWiener_fv_7180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7181> AgradDistributionWiener_fv_7181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7182> AgradDistributionWiener_fv_7182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7183> AgradDistributionWiener_fv_7183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7184> AgradDistributionWiener_fv_7184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7185> AgradDistributionWiener_fv_7185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7186> AgradDistributionWiener_fv_7186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7187> AgradDistributionWiener_fv_7187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7188> AgradDistributionWiener_fv_7188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7189> AgradDistributionWiener_fv_7189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7190> AgradDistributionWiener_fv_7190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7191> AgradDistributionWiener_fv_7191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7192> AgradDistributionWiener_fv_7192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7193> AgradDistributionWiener_fv_7193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7194> AgradDistributionWiener_fv_7194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7195> AgradDistributionWiener_fv_7195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7196> AgradDistributionWiener_fv_7196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7197> AgradDistributionWiener_fv_7197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7198> AgradDistributionWiener_fv_7198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7199> AgradDistributionWiener_fv_7199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7100, AgradDistributionTestFixture, AgradDistributionWiener_fv_7100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7101, AgradDistributionTestFixture, AgradDistributionWiener_fv_7101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7102, AgradDistributionTestFixture, AgradDistributionWiener_fv_7102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7103, AgradDistributionTestFixture, AgradDistributionWiener_fv_7103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7104, AgradDistributionTestFixture, AgradDistributionWiener_fv_7104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7105, AgradDistributionTestFixture, AgradDistributionWiener_fv_7105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7106, AgradDistributionTestFixture, AgradDistributionWiener_fv_7106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7107, AgradDistributionTestFixture, AgradDistributionWiener_fv_7107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7108, AgradDistributionTestFixture, AgradDistributionWiener_fv_7108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7109, AgradDistributionTestFixture, AgradDistributionWiener_fv_7109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7110, AgradDistributionTestFixture, AgradDistributionWiener_fv_7110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7111, AgradDistributionTestFixture, AgradDistributionWiener_fv_7111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7112, AgradDistributionTestFixture, AgradDistributionWiener_fv_7112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7113, AgradDistributionTestFixture, AgradDistributionWiener_fv_7113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7114, AgradDistributionTestFixture, AgradDistributionWiener_fv_7114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7115, AgradDistributionTestFixture, AgradDistributionWiener_fv_7115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7116, AgradDistributionTestFixture, AgradDistributionWiener_fv_7116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7117, AgradDistributionTestFixture, AgradDistributionWiener_fv_7117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7118, AgradDistributionTestFixture, AgradDistributionWiener_fv_7118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7119, AgradDistributionTestFixture, AgradDistributionWiener_fv_7119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7120, AgradDistributionTestFixture, AgradDistributionWiener_fv_7120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7121, AgradDistributionTestFixture, AgradDistributionWiener_fv_7121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7122, AgradDistributionTestFixture, AgradDistributionWiener_fv_7122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7123, AgradDistributionTestFixture, AgradDistributionWiener_fv_7123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7124, AgradDistributionTestFixture, AgradDistributionWiener_fv_7124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7125, AgradDistributionTestFixture, AgradDistributionWiener_fv_7125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7126, AgradDistributionTestFixture, AgradDistributionWiener_fv_7126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7127, AgradDistributionTestFixture, AgradDistributionWiener_fv_7127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7128, AgradDistributionTestFixture, AgradDistributionWiener_fv_7128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7129, AgradDistributionTestFixture, AgradDistributionWiener_fv_7129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7130, AgradDistributionTestFixture, AgradDistributionWiener_fv_7130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7131, AgradDistributionTestFixture, AgradDistributionWiener_fv_7131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7132, AgradDistributionTestFixture, AgradDistributionWiener_fv_7132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7133, AgradDistributionTestFixture, AgradDistributionWiener_fv_7133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7134, AgradDistributionTestFixture, AgradDistributionWiener_fv_7134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7135, AgradDistributionTestFixture, AgradDistributionWiener_fv_7135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7136, AgradDistributionTestFixture, AgradDistributionWiener_fv_7136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7137, AgradDistributionTestFixture, AgradDistributionWiener_fv_7137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7138, AgradDistributionTestFixture, AgradDistributionWiener_fv_7138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7139, AgradDistributionTestFixture, AgradDistributionWiener_fv_7139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7140, AgradDistributionTestFixture, AgradDistributionWiener_fv_7140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7141, AgradDistributionTestFixture, AgradDistributionWiener_fv_7141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7142, AgradDistributionTestFixture, AgradDistributionWiener_fv_7142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7143, AgradDistributionTestFixture, AgradDistributionWiener_fv_7143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7144, AgradDistributionTestFixture, AgradDistributionWiener_fv_7144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7145, AgradDistributionTestFixture, AgradDistributionWiener_fv_7145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7146, AgradDistributionTestFixture, AgradDistributionWiener_fv_7146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7147, AgradDistributionTestFixture, AgradDistributionWiener_fv_7147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7148, AgradDistributionTestFixture, AgradDistributionWiener_fv_7148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7149, AgradDistributionTestFixture, AgradDistributionWiener_fv_7149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7150, AgradDistributionTestFixture, AgradDistributionWiener_fv_7150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7151, AgradDistributionTestFixture, AgradDistributionWiener_fv_7151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7152, AgradDistributionTestFixture, AgradDistributionWiener_fv_7152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7153, AgradDistributionTestFixture, AgradDistributionWiener_fv_7153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7154, AgradDistributionTestFixture, AgradDistributionWiener_fv_7154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7155, AgradDistributionTestFixture, AgradDistributionWiener_fv_7155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7156, AgradDistributionTestFixture, AgradDistributionWiener_fv_7156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7157, AgradDistributionTestFixture, AgradDistributionWiener_fv_7157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7158, AgradDistributionTestFixture, AgradDistributionWiener_fv_7158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7159, AgradDistributionTestFixture, AgradDistributionWiener_fv_7159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7160, AgradDistributionTestFixture, AgradDistributionWiener_fv_7160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7161, AgradDistributionTestFixture, AgradDistributionWiener_fv_7161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7162, AgradDistributionTestFixture, AgradDistributionWiener_fv_7162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7163, AgradDistributionTestFixture, AgradDistributionWiener_fv_7163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7164, AgradDistributionTestFixture, AgradDistributionWiener_fv_7164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7165, AgradDistributionTestFixture, AgradDistributionWiener_fv_7165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7166, AgradDistributionTestFixture, AgradDistributionWiener_fv_7166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7167, AgradDistributionTestFixture, AgradDistributionWiener_fv_7167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7168, AgradDistributionTestFixture, AgradDistributionWiener_fv_7168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7169, AgradDistributionTestFixture, AgradDistributionWiener_fv_7169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7170, AgradDistributionTestFixture, AgradDistributionWiener_fv_7170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7171, AgradDistributionTestFixture, AgradDistributionWiener_fv_7171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7172, AgradDistributionTestFixture, AgradDistributionWiener_fv_7172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7173, AgradDistributionTestFixture, AgradDistributionWiener_fv_7173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7174, AgradDistributionTestFixture, AgradDistributionWiener_fv_7174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7175, AgradDistributionTestFixture, AgradDistributionWiener_fv_7175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7176, AgradDistributionTestFixture, AgradDistributionWiener_fv_7176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7177, AgradDistributionTestFixture, AgradDistributionWiener_fv_7177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7178, AgradDistributionTestFixture, AgradDistributionWiener_fv_7178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7179, AgradDistributionTestFixture, AgradDistributionWiener_fv_7179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7180, AgradDistributionTestFixture, AgradDistributionWiener_fv_7180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7181, AgradDistributionTestFixture, AgradDistributionWiener_fv_7181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7182, AgradDistributionTestFixture, AgradDistributionWiener_fv_7182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7183, AgradDistributionTestFixture, AgradDistributionWiener_fv_7183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7184, AgradDistributionTestFixture, AgradDistributionWiener_fv_7184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7185, AgradDistributionTestFixture, AgradDistributionWiener_fv_7185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7186, AgradDistributionTestFixture, AgradDistributionWiener_fv_7186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7187, AgradDistributionTestFixture, AgradDistributionWiener_fv_7187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7188, AgradDistributionTestFixture, AgradDistributionWiener_fv_7188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7189, AgradDistributionTestFixture, AgradDistributionWiener_fv_7189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7190, AgradDistributionTestFixture, AgradDistributionWiener_fv_7190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7191, AgradDistributionTestFixture, AgradDistributionWiener_fv_7191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7192, AgradDistributionTestFixture, AgradDistributionWiener_fv_7192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7193, AgradDistributionTestFixture, AgradDistributionWiener_fv_7193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7194, AgradDistributionTestFixture, AgradDistributionWiener_fv_7194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7195, AgradDistributionTestFixture, AgradDistributionWiener_fv_7195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7196, AgradDistributionTestFixture, AgradDistributionWiener_fv_7196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7197, AgradDistributionTestFixture, AgradDistributionWiener_fv_7197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7198, AgradDistributionTestFixture, AgradDistributionWiener_fv_7198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7199, AgradDistributionTestFixture, AgradDistributionWiener_fv_7199);
+
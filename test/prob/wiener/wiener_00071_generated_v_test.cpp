@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7100;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_7101;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_7102;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7103;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7104;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7105;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7106;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7107;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7108;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7109;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_7110;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_7111;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7112;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_7113;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_7114;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7115;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_7116;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_7117;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7118;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_7119;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_7120;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7121;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7122;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7123;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7124;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7125;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7126;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7127;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, double, empty> type_v_7128;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, std::vector<double>, empty> type_v_7129;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7130;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, var, empty> type_v_7131;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, std::vector<var>, empty> type_v_7132;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7133;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, double, empty> type_v_7134;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, std::vector<double>, empty> type_v_7135;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7136;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, var, empty> type_v_7137;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, std::vector<var>, empty> type_v_7138;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7139;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7140;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7141;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7142;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7143;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7144;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7145;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, double, empty> type_v_7146;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, std::vector<double>, empty> type_v_7147;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7148;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, var, empty> type_v_7149;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, std::vector<var>, empty> type_v_7150;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7151;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, double, empty> type_v_7152;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, std::vector<double>, empty> type_v_7153;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7154;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, var, empty> type_v_7155;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, std::vector<var>, empty> type_v_7156;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7157;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7158;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7159;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7160;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7161;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7162;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7163;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, double, empty> type_v_7164;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, std::vector<double>, empty> type_v_7165;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7166;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, var, empty> type_v_7167;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, std::vector<var>, empty> type_v_7168;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7169;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, double, empty> type_v_7170;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_7171;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7172;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, var, empty> type_v_7173;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_7174;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7175;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7176;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7177;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7178;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7179;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7180;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7181;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, double, empty> type_v_7182;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, std::vector<double>, empty> type_v_7183;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7184;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, var, empty> type_v_7185;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, std::vector<var>, empty> type_v_7186;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7187;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, double, empty> type_v_7188;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_7189;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7190;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, var, empty> type_v_7191;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_7192;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7193;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7194;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7195;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7196;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7197;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7198;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7199;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7100> AgradDistributionWiener_v_7100;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7101> AgradDistributionWiener_v_7101;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7102> AgradDistributionWiener_v_7102;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7103> AgradDistributionWiener_v_7103;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7104> AgradDistributionWiener_v_7104;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7105> AgradDistributionWiener_v_7105;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7106> AgradDistributionWiener_v_7106;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7107> AgradDistributionWiener_v_7107;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7108> AgradDistributionWiener_v_7108;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7109> AgradDistributionWiener_v_7109;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7110> AgradDistributionWiener_v_7110;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7111> AgradDistributionWiener_v_7111;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7112> AgradDistributionWiener_v_7112;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7113> AgradDistributionWiener_v_7113;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7114> AgradDistributionWiener_v_7114;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7115> AgradDistributionWiener_v_7115;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7116> AgradDistributionWiener_v_7116;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7117> AgradDistributionWiener_v_7117;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7118> AgradDistributionWiener_v_7118;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7119> AgradDistributionWiener_v_7119;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7120> AgradDistributionWiener_v_7120;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7121> AgradDistributionWiener_v_7121;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7122> AgradDistributionWiener_v_7122;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7123> AgradDistributionWiener_v_7123;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7124> AgradDistributionWiener_v_7124;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7125> AgradDistributionWiener_v_7125;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7126> AgradDistributionWiener_v_7126;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7127> AgradDistributionWiener_v_7127;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7128> AgradDistributionWiener_v_7128;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7129> AgradDistributionWiener_v_7129;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7130> AgradDistributionWiener_v_7130;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7131> AgradDistributionWiener_v_7131;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7132> AgradDistributionWiener_v_7132;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7133> AgradDistributionWiener_v_7133;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7134> AgradDistributionWiener_v_7134;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7135> AgradDistributionWiener_v_7135;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7136> AgradDistributionWiener_v_7136;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7137> AgradDistributionWiener_v_7137;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7138> AgradDistributionWiener_v_7138;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7139> AgradDistributionWiener_v_7139;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7140> AgradDistributionWiener_v_7140;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7141> AgradDistributionWiener_v_7141;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7142> AgradDistributionWiener_v_7142;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7143> AgradDistributionWiener_v_7143;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7144> AgradDistributionWiener_v_7144;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7145> AgradDistributionWiener_v_7145;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7146> AgradDistributionWiener_v_7146;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7147> AgradDistributionWiener_v_7147;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7148> AgradDistributionWiener_v_7148;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7149> AgradDistributionWiener_v_7149;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7150> AgradDistributionWiener_v_7150;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7151> AgradDistributionWiener_v_7151;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7152> AgradDistributionWiener_v_7152;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7153> AgradDistributionWiener_v_7153;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7154> AgradDistributionWiener_v_7154;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7155> AgradDistributionWiener_v_7155;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7156> AgradDistributionWiener_v_7156;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7157> AgradDistributionWiener_v_7157;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7158> AgradDistributionWiener_v_7158;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7159> AgradDistributionWiener_v_7159;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7160> AgradDistributionWiener_v_7160;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7161> AgradDistributionWiener_v_7161;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7162> AgradDistributionWiener_v_7162;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7163> AgradDistributionWiener_v_7163;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7164> AgradDistributionWiener_v_7164;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7165> AgradDistributionWiener_v_7165;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7166> AgradDistributionWiener_v_7166;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7167> AgradDistributionWiener_v_7167;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7168> AgradDistributionWiener_v_7168;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7169> AgradDistributionWiener_v_7169;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7170> AgradDistributionWiener_v_7170;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7171> AgradDistributionWiener_v_7171;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7172> AgradDistributionWiener_v_7172;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7173> AgradDistributionWiener_v_7173;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7174> AgradDistributionWiener_v_7174;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7175> AgradDistributionWiener_v_7175;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7176> AgradDistributionWiener_v_7176;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7177> AgradDistributionWiener_v_7177;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7178> AgradDistributionWiener_v_7178;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7179> AgradDistributionWiener_v_7179;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7180> AgradDistributionWiener_v_7180;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7181> AgradDistributionWiener_v_7181;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7182> AgradDistributionWiener_v_7182;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7183> AgradDistributionWiener_v_7183;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7184> AgradDistributionWiener_v_7184;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7185> AgradDistributionWiener_v_7185;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7186> AgradDistributionWiener_v_7186;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7187> AgradDistributionWiener_v_7187;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7188> AgradDistributionWiener_v_7188;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7189> AgradDistributionWiener_v_7189;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7190> AgradDistributionWiener_v_7190;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7191> AgradDistributionWiener_v_7191;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7192> AgradDistributionWiener_v_7192;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7193> AgradDistributionWiener_v_7193;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7194> AgradDistributionWiener_v_7194;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7195> AgradDistributionWiener_v_7195;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7196> AgradDistributionWiener_v_7196;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7197> AgradDistributionWiener_v_7197;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7198> AgradDistributionWiener_v_7198;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7199> AgradDistributionWiener_v_7199;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7100, AgradDistributionTestFixture, AgradDistributionWiener_v_7100);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7101, AgradDistributionTestFixture, AgradDistributionWiener_v_7101);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7102, AgradDistributionTestFixture, AgradDistributionWiener_v_7102);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7103, AgradDistributionTestFixture, AgradDistributionWiener_v_7103);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7104, AgradDistributionTestFixture, AgradDistributionWiener_v_7104);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7105, AgradDistributionTestFixture, AgradDistributionWiener_v_7105);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7106, AgradDistributionTestFixture, AgradDistributionWiener_v_7106);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7107, AgradDistributionTestFixture, AgradDistributionWiener_v_7107);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7108, AgradDistributionTestFixture, AgradDistributionWiener_v_7108);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7109, AgradDistributionTestFixture, AgradDistributionWiener_v_7109);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7110, AgradDistributionTestFixture, AgradDistributionWiener_v_7110);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7111, AgradDistributionTestFixture, AgradDistributionWiener_v_7111);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7112, AgradDistributionTestFixture, AgradDistributionWiener_v_7112);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7113, AgradDistributionTestFixture, AgradDistributionWiener_v_7113);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7114, AgradDistributionTestFixture, AgradDistributionWiener_v_7114);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7115, AgradDistributionTestFixture, AgradDistributionWiener_v_7115);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7116, AgradDistributionTestFixture, AgradDistributionWiener_v_7116);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7117, AgradDistributionTestFixture, AgradDistributionWiener_v_7117);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7118, AgradDistributionTestFixture, AgradDistributionWiener_v_7118);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7119, AgradDistributionTestFixture, AgradDistributionWiener_v_7119);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7120, AgradDistributionTestFixture, AgradDistributionWiener_v_7120);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7121, AgradDistributionTestFixture, AgradDistributionWiener_v_7121);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7122, AgradDistributionTestFixture, AgradDistributionWiener_v_7122);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7123, AgradDistributionTestFixture, AgradDistributionWiener_v_7123);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7124, AgradDistributionTestFixture, AgradDistributionWiener_v_7124);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7125, AgradDistributionTestFixture, AgradDistributionWiener_v_7125);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7126, AgradDistributionTestFixture, AgradDistributionWiener_v_7126);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7127, AgradDistributionTestFixture, AgradDistributionWiener_v_7127);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7128, AgradDistributionTestFixture, AgradDistributionWiener_v_7128);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7129, AgradDistributionTestFixture, AgradDistributionWiener_v_7129);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7130, AgradDistributionTestFixture, AgradDistributionWiener_v_7130);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7131, AgradDistributionTestFixture, AgradDistributionWiener_v_7131);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7132, AgradDistributionTestFixture, AgradDistributionWiener_v_7132);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7133, AgradDistributionTestFixture, AgradDistributionWiener_v_7133);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7134, AgradDistributionTestFixture, AgradDistributionWiener_v_7134);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7135, AgradDistributionTestFixture, AgradDistributionWiener_v_7135);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7136, AgradDistributionTestFixture, AgradDistributionWiener_v_7136);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7137, AgradDistributionTestFixture, AgradDistributionWiener_v_7137);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7138, AgradDistributionTestFixture, AgradDistributionWiener_v_7138);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7139, AgradDistributionTestFixture, AgradDistributionWiener_v_7139);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7140, AgradDistributionTestFixture, AgradDistributionWiener_v_7140);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7141, AgradDistributionTestFixture, AgradDistributionWiener_v_7141);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7142, AgradDistributionTestFixture, AgradDistributionWiener_v_7142);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7143, AgradDistributionTestFixture, AgradDistributionWiener_v_7143);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7144, AgradDistributionTestFixture, AgradDistributionWiener_v_7144);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7145, AgradDistributionTestFixture, AgradDistributionWiener_v_7145);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7146, AgradDistributionTestFixture, AgradDistributionWiener_v_7146);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7147, AgradDistributionTestFixture, AgradDistributionWiener_v_7147);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7148, AgradDistributionTestFixture, AgradDistributionWiener_v_7148);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7149, AgradDistributionTestFixture, AgradDistributionWiener_v_7149);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7150, AgradDistributionTestFixture, AgradDistributionWiener_v_7150);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7151, AgradDistributionTestFixture, AgradDistributionWiener_v_7151);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7152, AgradDistributionTestFixture, AgradDistributionWiener_v_7152);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7153, AgradDistributionTestFixture, AgradDistributionWiener_v_7153);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7154, AgradDistributionTestFixture, AgradDistributionWiener_v_7154);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7155, AgradDistributionTestFixture, AgradDistributionWiener_v_7155);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7156, AgradDistributionTestFixture, AgradDistributionWiener_v_7156);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7157, AgradDistributionTestFixture, AgradDistributionWiener_v_7157);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7158, AgradDistributionTestFixture, AgradDistributionWiener_v_7158);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7159, AgradDistributionTestFixture, AgradDistributionWiener_v_7159);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7160, AgradDistributionTestFixture, AgradDistributionWiener_v_7160);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7161, AgradDistributionTestFixture, AgradDistributionWiener_v_7161);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7162, AgradDistributionTestFixture, AgradDistributionWiener_v_7162);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7163, AgradDistributionTestFixture, AgradDistributionWiener_v_7163);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7164, AgradDistributionTestFixture, AgradDistributionWiener_v_7164);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7165, AgradDistributionTestFixture, AgradDistributionWiener_v_7165);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7166, AgradDistributionTestFixture, AgradDistributionWiener_v_7166);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7167, AgradDistributionTestFixture, AgradDistributionWiener_v_7167);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7168, AgradDistributionTestFixture, AgradDistributionWiener_v_7168);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7169, AgradDistributionTestFixture, AgradDistributionWiener_v_7169);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7170, AgradDistributionTestFixture, AgradDistributionWiener_v_7170);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7171, AgradDistributionTestFixture, AgradDistributionWiener_v_7171);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7172, AgradDistributionTestFixture, AgradDistributionWiener_v_7172);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7173, AgradDistributionTestFixture, AgradDistributionWiener_v_7173);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7174, AgradDistributionTestFixture, AgradDistributionWiener_v_7174);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7175, AgradDistributionTestFixture, AgradDistributionWiener_v_7175);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7176, AgradDistributionTestFixture, AgradDistributionWiener_v_7176);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7177, AgradDistributionTestFixture, AgradDistributionWiener_v_7177);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7178, AgradDistributionTestFixture, AgradDistributionWiener_v_7178);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7179, AgradDistributionTestFixture, AgradDistributionWiener_v_7179);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7180, AgradDistributionTestFixture, AgradDistributionWiener_v_7180);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7181, AgradDistributionTestFixture, AgradDistributionWiener_v_7181);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7182, AgradDistributionTestFixture, AgradDistributionWiener_v_7182);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7183, AgradDistributionTestFixture, AgradDistributionWiener_v_7183);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7184, AgradDistributionTestFixture, AgradDistributionWiener_v_7184);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7185, AgradDistributionTestFixture, AgradDistributionWiener_v_7185);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7186, AgradDistributionTestFixture, AgradDistributionWiener_v_7186);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7187, AgradDistributionTestFixture, AgradDistributionWiener_v_7187);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7188, AgradDistributionTestFixture, AgradDistributionWiener_v_7188);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7189, AgradDistributionTestFixture, AgradDistributionWiener_v_7189);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7190, AgradDistributionTestFixture, AgradDistributionWiener_v_7190);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7191, AgradDistributionTestFixture, AgradDistributionWiener_v_7191);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7192, AgradDistributionTestFixture, AgradDistributionWiener_v_7192);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7193, AgradDistributionTestFixture, AgradDistributionWiener_v_7193);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7194, AgradDistributionTestFixture, AgradDistributionWiener_v_7194);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7195, AgradDistributionTestFixture, AgradDistributionWiener_v_7195);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7196, AgradDistributionTestFixture, AgradDistributionWiener_v_7196);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7197, AgradDistributionTestFixture, AgradDistributionWiener_v_7197);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7198, AgradDistributionTestFixture, AgradDistributionWiener_v_7198);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7199, AgradDistributionTestFixture, AgradDistributionWiener_v_7199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_7200;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_7201;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7202;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_7203;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7204;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7205;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7206;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7207;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7208;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, double, empty> type_fv_7209;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, std::vector<double>, empty> type_fv_7210;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7211;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, fvar<var>, empty> type_fv_7212;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, std::vector<fvar<var>>, empty> type_fv_7213;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7214;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, double, empty> type_fv_7215;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, std::vector<double>, empty> type_fv_7216;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7217;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, fvar<var>, empty> type_fv_7218;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_7219;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7220;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_7221;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7222;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7223;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7224;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7225;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7226;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, double, empty> type_fv_7227;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, std::vector<double>, empty> type_fv_7228;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7229;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, fvar<var>, empty> type_fv_7230;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_7231;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7232;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, double, empty> type_fv_7233;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_7234;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7235;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_7236;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_7237;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7238;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_7239;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7240;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7241;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7242;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7243;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7244;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, double, empty> type_fv_7245;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, std::vector<double>, empty> type_fv_7246;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7247;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, fvar<var>, empty> type_fv_7248;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, std::vector<fvar<var>>, empty> type_fv_7249;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7250;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, double, empty> type_fv_7251;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, std::vector<double>, empty> type_fv_7252;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7253;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, fvar<var>, empty> type_fv_7254;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_7255;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7256;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_7257;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7258;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7259;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7260;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7261;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7262;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, double, empty> type_fv_7263;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, std::vector<double>, empty> type_fv_7264;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7265;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, fvar<var>, empty> type_fv_7266;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, std::vector<fvar<var>>, empty> type_fv_7267;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7268;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, double, empty> type_fv_7269;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<double>, empty> type_fv_7270;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7271;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, fvar<var>, empty> type_fv_7272;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, empty> type_fv_7273;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7274;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, empty> type_fv_7275;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7276;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7277;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7278;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7279;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7280;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, double, empty> type_fv_7281;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fv_7282;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7283;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, fvar<var>, empty> type_fv_7284;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, std::vector<fvar<var>>, empty> type_fv_7285;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7286;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_fv_7287;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_fv_7288;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7289;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, fvar<var>, empty> type_fv_7290;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<var>>, empty> type_fv_7291;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7292;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fv_7293;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fv_7294;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fv_7295;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<var>, empty> type_fv_7296;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<var>>, empty> type_fv_7297;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, empty> type_fv_7298;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, std::vector<fvar<var>>, Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1>, fvar<var>, double, empty> type_fv_7299;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7200> AgradDistributionWiener_fv_7200;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7201> AgradDistributionWiener_fv_7201;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7202> AgradDistributionWiener_fv_7202;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7203> AgradDistributionWiener_fv_7203;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7204> AgradDistributionWiener_fv_7204;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7205> AgradDistributionWiener_fv_7205;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7206> AgradDistributionWiener_fv_7206;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7207> AgradDistributionWiener_fv_7207;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7208> AgradDistributionWiener_fv_7208;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7209> AgradDistributionWiener_fv_7209;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7210> AgradDistributionWiener_fv_7210;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7211> AgradDistributionWiener_fv_7211;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7212> AgradDistributionWiener_fv_7212;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7213> AgradDistributionWiener_fv_7213;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7214> AgradDistributionWiener_fv_7214;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7215> AgradDistributionWiener_fv_7215;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7216> AgradDistributionWiener_fv_7216;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7217> AgradDistributionWiener_fv_7217;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7218> AgradDistributionWiener_fv_7218;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7219> AgradDistributionWiener_fv_7219;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7220> AgradDistributionWiener_fv_7220;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7221> AgradDistributionWiener_fv_7221;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7222> AgradDistributionWiener_fv_7222;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7223> AgradDistributionWiener_fv_7223;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7224> AgradDistributionWiener_fv_7224;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7225> AgradDistributionWiener_fv_7225;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7226> AgradDistributionWiener_fv_7226;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7227> AgradDistributionWiener_fv_7227;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7228> AgradDistributionWiener_fv_7228;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7229> AgradDistributionWiener_fv_7229;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7230> AgradDistributionWiener_fv_7230;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7231> AgradDistributionWiener_fv_7231;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7232> AgradDistributionWiener_fv_7232;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7233> AgradDistributionWiener_fv_7233;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7234> AgradDistributionWiener_fv_7234;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7235> AgradDistributionWiener_fv_7235;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7236> AgradDistributionWiener_fv_7236;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7237> AgradDistributionWiener_fv_7237;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7238> AgradDistributionWiener_fv_7238;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7239> AgradDistributionWiener_fv_7239;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7240> AgradDistributionWiener_fv_7240;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7241> AgradDistributionWiener_fv_7241;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7242> AgradDistributionWiener_fv_7242;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7243> AgradDistributionWiener_fv_7243;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7244> AgradDistributionWiener_fv_7244;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7245> AgradDistributionWiener_fv_7245;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7246> AgradDistributionWiener_fv_7246;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7247> AgradDistributionWiener_fv_7247;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7248> AgradDistributionWiener_fv_7248;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7249> AgradDistributionWiener_fv_7249;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7250> AgradDistributionWiener_fv_7250;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7251> AgradDistributionWiener_fv_7251;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7252> AgradDistributionWiener_fv_7252;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7253> AgradDistributionWiener_fv_7253;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7254> AgradDistributionWiener_fv_7254;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7255> AgradDistributionWiener_fv_7255;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7256> AgradDistributionWiener_fv_7256;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7257> AgradDistributionWiener_fv_7257;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7258> AgradDistributionWiener_fv_7258;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7259> AgradDistributionWiener_fv_7259;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7260> AgradDistributionWiener_fv_7260;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7261> AgradDistributionWiener_fv_7261;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7262> AgradDistributionWiener_fv_7262;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7263> AgradDistributionWiener_fv_7263;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7264> AgradDistributionWiener_fv_7264;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7265> AgradDistributionWiener_fv_7265;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7266> AgradDistributionWiener_fv_7266;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7267> AgradDistributionWiener_fv_7267;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7268> AgradDistributionWiener_fv_7268;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7269> AgradDistributionWiener_fv_7269;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7270> AgradDistributionWiener_fv_7270;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7271> AgradDistributionWiener_fv_7271;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7272> AgradDistributionWiener_fv_7272;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7273> AgradDistributionWiener_fv_7273;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7274> AgradDistributionWiener_fv_7274;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7275> AgradDistributionWiener_fv_7275;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7276> AgradDistributionWiener_fv_7276;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7277> AgradDistributionWiener_fv_7277;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7278> AgradDistributionWiener_fv_7278;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7279> AgradDistributionWiener_fv_7279;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7280> AgradDistributionWiener_fv_7280;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7281> AgradDistributionWiener_fv_7281;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7282> AgradDistributionWiener_fv_7282;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7283> AgradDistributionWiener_fv_7283;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7284> AgradDistributionWiener_fv_7284;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7285> AgradDistributionWiener_fv_7285;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7286> AgradDistributionWiener_fv_7286;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7287> AgradDistributionWiener_fv_7287;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7288> AgradDistributionWiener_fv_7288;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7289> AgradDistributionWiener_fv_7289;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7290> AgradDistributionWiener_fv_7290;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7291> AgradDistributionWiener_fv_7291;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7292> AgradDistributionWiener_fv_7292;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7293> AgradDistributionWiener_fv_7293;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7294> AgradDistributionWiener_fv_7294;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7295> AgradDistributionWiener_fv_7295;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7296> AgradDistributionWiener_fv_7296;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7297> AgradDistributionWiener_fv_7297;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7298> AgradDistributionWiener_fv_7298;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fv_7299> AgradDistributionWiener_fv_7299;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7200, AgradDistributionTestFixture, AgradDistributionWiener_fv_7200);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7201, AgradDistributionTestFixture, AgradDistributionWiener_fv_7201);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7202, AgradDistributionTestFixture, AgradDistributionWiener_fv_7202);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7203, AgradDistributionTestFixture, AgradDistributionWiener_fv_7203);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7204, AgradDistributionTestFixture, AgradDistributionWiener_fv_7204);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7205, AgradDistributionTestFixture, AgradDistributionWiener_fv_7205);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7206, AgradDistributionTestFixture, AgradDistributionWiener_fv_7206);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7207, AgradDistributionTestFixture, AgradDistributionWiener_fv_7207);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7208, AgradDistributionTestFixture, AgradDistributionWiener_fv_7208);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7209, AgradDistributionTestFixture, AgradDistributionWiener_fv_7209);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7210, AgradDistributionTestFixture, AgradDistributionWiener_fv_7210);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7211, AgradDistributionTestFixture, AgradDistributionWiener_fv_7211);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7212, AgradDistributionTestFixture, AgradDistributionWiener_fv_7212);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7213, AgradDistributionTestFixture, AgradDistributionWiener_fv_7213);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7214, AgradDistributionTestFixture, AgradDistributionWiener_fv_7214);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7215, AgradDistributionTestFixture, AgradDistributionWiener_fv_7215);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7216, AgradDistributionTestFixture, AgradDistributionWiener_fv_7216);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7217, AgradDistributionTestFixture, AgradDistributionWiener_fv_7217);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7218, AgradDistributionTestFixture, AgradDistributionWiener_fv_7218);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7219, AgradDistributionTestFixture, AgradDistributionWiener_fv_7219);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7220, AgradDistributionTestFixture, AgradDistributionWiener_fv_7220);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7221, AgradDistributionTestFixture, AgradDistributionWiener_fv_7221);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7222, AgradDistributionTestFixture, AgradDistributionWiener_fv_7222);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7223, AgradDistributionTestFixture, AgradDistributionWiener_fv_7223);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7224, AgradDistributionTestFixture, AgradDistributionWiener_fv_7224);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7225, AgradDistributionTestFixture, AgradDistributionWiener_fv_7225);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7226, AgradDistributionTestFixture, AgradDistributionWiener_fv_7226);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7227, AgradDistributionTestFixture, AgradDistributionWiener_fv_7227);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7228, AgradDistributionTestFixture, AgradDistributionWiener_fv_7228);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7229, AgradDistributionTestFixture, AgradDistributionWiener_fv_7229);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7230, AgradDistributionTestFixture, AgradDistributionWiener_fv_7230);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7231, AgradDistributionTestFixture, AgradDistributionWiener_fv_7231);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7232, AgradDistributionTestFixture, AgradDistributionWiener_fv_7232);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7233, AgradDistributionTestFixture, AgradDistributionWiener_fv_7233);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7234, AgradDistributionTestFixture, AgradDistributionWiener_fv_7234);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7235, AgradDistributionTestFixture, AgradDistributionWiener_fv_7235);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7236, AgradDistributionTestFixture, AgradDistributionWiener_fv_7236);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7237, AgradDistributionTestFixture, AgradDistributionWiener_fv_7237);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7238, AgradDistributionTestFixture, AgradDistributionWiener_fv_7238);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7239, AgradDistributionTestFixture, AgradDistributionWiener_fv_7239);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7240, AgradDistributionTestFixture, AgradDistributionWiener_fv_7240);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7241, AgradDistributionTestFixture, AgradDistributionWiener_fv_7241);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7242, AgradDistributionTestFixture, AgradDistributionWiener_fv_7242);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7243, AgradDistributionTestFixture, AgradDistributionWiener_fv_7243);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7244, AgradDistributionTestFixture, AgradDistributionWiener_fv_7244);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7245, AgradDistributionTestFixture, AgradDistributionWiener_fv_7245);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7246, AgradDistributionTestFixture, AgradDistributionWiener_fv_7246);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7247, AgradDistributionTestFixture, AgradDistributionWiener_fv_7247);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7248, AgradDistributionTestFixture, AgradDistributionWiener_fv_7248);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7249, AgradDistributionTestFixture, AgradDistributionWiener_fv_7249);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7250, AgradDistributionTestFixture, AgradDistributionWiener_fv_7250);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7251, AgradDistributionTestFixture, AgradDistributionWiener_fv_7251);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7252, AgradDistributionTestFixture, AgradDistributionWiener_fv_7252);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7253, AgradDistributionTestFixture, AgradDistributionWiener_fv_7253);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7254, AgradDistributionTestFixture, AgradDistributionWiener_fv_7254);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7255, AgradDistributionTestFixture, AgradDistributionWiener_fv_7255);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7256, AgradDistributionTestFixture, AgradDistributionWiener_fv_7256);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7257, AgradDistributionTestFixture, AgradDistributionWiener_fv_7257);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7258, AgradDistributionTestFixture, AgradDistributionWiener_fv_7258);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7259, AgradDistributionTestFixture, AgradDistributionWiener_fv_7259);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7260, AgradDistributionTestFixture, AgradDistributionWiener_fv_7260);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7261, AgradDistributionTestFixture, AgradDistributionWiener_fv_7261);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7262, AgradDistributionTestFixture, AgradDistributionWiener_fv_7262);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7263, AgradDistributionTestFixture, AgradDistributionWiener_fv_7263);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7264, AgradDistributionTestFixture, AgradDistributionWiener_fv_7264);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7265, AgradDistributionTestFixture, AgradDistributionWiener_fv_7265);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7266, AgradDistributionTestFixture, AgradDistributionWiener_fv_7266);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7267, AgradDistributionTestFixture, AgradDistributionWiener_fv_7267);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7268, AgradDistributionTestFixture, AgradDistributionWiener_fv_7268);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7269, AgradDistributionTestFixture, AgradDistributionWiener_fv_7269);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7270, AgradDistributionTestFixture, AgradDistributionWiener_fv_7270);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7271, AgradDistributionTestFixture, AgradDistributionWiener_fv_7271);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7272, AgradDistributionTestFixture, AgradDistributionWiener_fv_7272);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7273, AgradDistributionTestFixture, AgradDistributionWiener_fv_7273);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7274, AgradDistributionTestFixture, AgradDistributionWiener_fv_7274);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7275, AgradDistributionTestFixture, AgradDistributionWiener_fv_7275);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7276, AgradDistributionTestFixture, AgradDistributionWiener_fv_7276);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7277, AgradDistributionTestFixture, AgradDistributionWiener_fv_7277);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7278, AgradDistributionTestFixture, AgradDistributionWiener_fv_7278);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7279, AgradDistributionTestFixture, AgradDistributionWiener_fv_7279);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7280, AgradDistributionTestFixture, AgradDistributionWiener_fv_7280);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7281, AgradDistributionTestFixture, AgradDistributionWiener_fv_7281);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7282, AgradDistributionTestFixture, AgradDistributionWiener_fv_7282);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7283, AgradDistributionTestFixture, AgradDistributionWiener_fv_7283);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7284, AgradDistributionTestFixture, AgradDistributionWiener_fv_7284);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7285, AgradDistributionTestFixture, AgradDistributionWiener_fv_7285);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7286, AgradDistributionTestFixture, AgradDistributionWiener_fv_7286);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7287, AgradDistributionTestFixture, AgradDistributionWiener_fv_7287);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7288, AgradDistributionTestFixture, AgradDistributionWiener_fv_7288);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7289, AgradDistributionTestFixture, AgradDistributionWiener_fv_7289);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7290, AgradDistributionTestFixture, AgradDistributionWiener_fv_7290);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7291, AgradDistributionTestFixture, AgradDistributionWiener_fv_7291);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7292, AgradDistributionTestFixture, AgradDistributionWiener_fv_7292);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7293, AgradDistributionTestFixture, AgradDistributionWiener_fv_7293);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7294, AgradDistributionTestFixture, AgradDistributionWiener_fv_7294);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7295, AgradDistributionTestFixture, AgradDistributionWiener_fv_7295);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7296, AgradDistributionTestFixture, AgradDistributionWiener_fv_7296);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7297, AgradDistributionTestFixture, AgradDistributionWiener_fv_7297);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7298, AgradDistributionTestFixture, AgradDistributionWiener_fv_7298);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fv_7299, AgradDistributionTestFixture, AgradDistributionWiener_fv_7299);
+
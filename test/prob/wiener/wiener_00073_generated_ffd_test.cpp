@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_7300;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7301;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_7302;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_7303;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7304;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_7305;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_7306;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7307;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_7308;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7309;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7310;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_7311;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7312;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7313;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7314;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7315;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7316;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, double, empty> type_ffd_7317;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_ffd_7318;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7319;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<double> >, empty> type_ffd_7320;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_7321;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7322;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_ffd_7323;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_ffd_7324;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7325;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_7326;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7327;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7328;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_7329;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7330;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7331;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7332;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7333;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7334;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, double, empty> type_ffd_7335;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_7336;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7337;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_7338;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_7339;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7340;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_7341;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_7342;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7343;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_7344;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7345;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7346;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_7347;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7348;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7349;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7350;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7351;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7352;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_ffd_7353;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_ffd_7354;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7355;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<double> >, empty> type_ffd_7356;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_7357;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7358;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_ffd_7359;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_ffd_7360;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7361;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_7362;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7363;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7364;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffd_7365;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7366;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7367;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7368;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7369;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7370;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, double, empty> type_ffd_7371;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, std::vector<double>, empty> type_ffd_7372;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7373;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, fvar<fvar<double> >, empty> type_ffd_7374;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, std::vector<fvar<fvar<double> >>, empty> type_ffd_7375;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7376;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, double, empty> type_ffd_7377;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<double>, empty> type_ffd_7378;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7379;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, fvar<fvar<double> >, empty> type_ffd_7380;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7381;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7382;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, double, empty> type_ffd_7383;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffd_7384;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7385;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, fvar<fvar<double> >, empty> type_ffd_7386;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7387;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7388;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_ffd_7389;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffd_7390;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7391;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<double> >, empty> type_ffd_7392;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<double> >>, empty> type_ffd_7393;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, empty> type_ffd_7394;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffd_7395;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffd_7396;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffd_7397;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<double> >, empty> type_ffd_7398;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<double> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<double> >>, empty> type_ffd_7399;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7300> AgradDistributionWiener_ffd_7300;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7301> AgradDistributionWiener_ffd_7301;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7302> AgradDistributionWiener_ffd_7302;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7303> AgradDistributionWiener_ffd_7303;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7304> AgradDistributionWiener_ffd_7304;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7305> AgradDistributionWiener_ffd_7305;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7306> AgradDistributionWiener_ffd_7306;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7307> AgradDistributionWiener_ffd_7307;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7308> AgradDistributionWiener_ffd_7308;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7309> AgradDistributionWiener_ffd_7309;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7310> AgradDistributionWiener_ffd_7310;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7311> AgradDistributionWiener_ffd_7311;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7312> AgradDistributionWiener_ffd_7312;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7313> AgradDistributionWiener_ffd_7313;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7314> AgradDistributionWiener_ffd_7314;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7315> AgradDistributionWiener_ffd_7315;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7316> AgradDistributionWiener_ffd_7316;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7317> AgradDistributionWiener_ffd_7317;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7318> AgradDistributionWiener_ffd_7318;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7319> AgradDistributionWiener_ffd_7319;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7320> AgradDistributionWiener_ffd_7320;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7321> AgradDistributionWiener_ffd_7321;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7322> AgradDistributionWiener_ffd_7322;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7323> AgradDistributionWiener_ffd_7323;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7324> AgradDistributionWiener_ffd_7324;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7325> AgradDistributionWiener_ffd_7325;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7326> AgradDistributionWiener_ffd_7326;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7327> AgradDistributionWiener_ffd_7327;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7328> AgradDistributionWiener_ffd_7328;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7329> AgradDistributionWiener_ffd_7329;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7330> AgradDistributionWiener_ffd_7330;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7331> AgradDistributionWiener_ffd_7331;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7332> AgradDistributionWiener_ffd_7332;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7333> AgradDistributionWiener_ffd_7333;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7334> AgradDistributionWiener_ffd_7334;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7335> AgradDistributionWiener_ffd_7335;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7336> AgradDistributionWiener_ffd_7336;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7337> AgradDistributionWiener_ffd_7337;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7338> AgradDistributionWiener_ffd_7338;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7339> AgradDistributionWiener_ffd_7339;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7340> AgradDistributionWiener_ffd_7340;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7341> AgradDistributionWiener_ffd_7341;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7342> AgradDistributionWiener_ffd_7342;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7343> AgradDistributionWiener_ffd_7343;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7344> AgradDistributionWiener_ffd_7344;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7345> AgradDistributionWiener_ffd_7345;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7346> AgradDistributionWiener_ffd_7346;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7347> AgradDistributionWiener_ffd_7347;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7348> AgradDistributionWiener_ffd_7348;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7349> AgradDistributionWiener_ffd_7349;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7350> AgradDistributionWiener_ffd_7350;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7351> AgradDistributionWiener_ffd_7351;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7352> AgradDistributionWiener_ffd_7352;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7353> AgradDistributionWiener_ffd_7353;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7354> AgradDistributionWiener_ffd_7354;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7355> AgradDistributionWiener_ffd_7355;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7356> AgradDistributionWiener_ffd_7356;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7357> AgradDistributionWiener_ffd_7357;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7358> AgradDistributionWiener_ffd_7358;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7359> AgradDistributionWiener_ffd_7359;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7360> AgradDistributionWiener_ffd_7360;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7361> AgradDistributionWiener_ffd_7361;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7362> AgradDistributionWiener_ffd_7362;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7363> AgradDistributionWiener_ffd_7363;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7364> AgradDistributionWiener_ffd_7364;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7365> AgradDistributionWiener_ffd_7365;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7366> AgradDistributionWiener_ffd_7366;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7367> AgradDistributionWiener_ffd_7367;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7368> AgradDistributionWiener_ffd_7368;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7369> AgradDistributionWiener_ffd_7369;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7370> AgradDistributionWiener_ffd_7370;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7371> AgradDistributionWiener_ffd_7371;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7372> AgradDistributionWiener_ffd_7372;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7373> AgradDistributionWiener_ffd_7373;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7374> AgradDistributionWiener_ffd_7374;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7375> AgradDistributionWiener_ffd_7375;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7376> AgradDistributionWiener_ffd_7376;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7377> AgradDistributionWiener_ffd_7377;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7378> AgradDistributionWiener_ffd_7378;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7379> AgradDistributionWiener_ffd_7379;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7380> AgradDistributionWiener_ffd_7380;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7381> AgradDistributionWiener_ffd_7381;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7382> AgradDistributionWiener_ffd_7382;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7383> AgradDistributionWiener_ffd_7383;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7384> AgradDistributionWiener_ffd_7384;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7385> AgradDistributionWiener_ffd_7385;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7386> AgradDistributionWiener_ffd_7386;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7387> AgradDistributionWiener_ffd_7387;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7388> AgradDistributionWiener_ffd_7388;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7389> AgradDistributionWiener_ffd_7389;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7390> AgradDistributionWiener_ffd_7390;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7391> AgradDistributionWiener_ffd_7391;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7392> AgradDistributionWiener_ffd_7392;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7393> AgradDistributionWiener_ffd_7393;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7394> AgradDistributionWiener_ffd_7394;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7395> AgradDistributionWiener_ffd_7395;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7396> AgradDistributionWiener_ffd_7396;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7397> AgradDistributionWiener_ffd_7397;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7398> AgradDistributionWiener_ffd_7398;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffd_7399> AgradDistributionWiener_ffd_7399;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7300, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7300);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7301, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7301);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7302, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7302);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7303, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7303);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7304, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7304);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7305, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7305);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7306, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7306);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7307, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7307);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7308, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7308);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7309, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7309);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7310, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7310);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7311, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7311);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7312, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7312);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7313, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7313);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7314, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7314);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7315, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7315);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7316, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7316);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7317, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7317);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7318, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7318);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7319, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7319);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7320, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7320);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7321, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7321);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7322, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7322);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7323, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7323);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7324, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7324);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7325, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7325);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7326, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7326);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7327, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7327);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7328, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7328);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7329, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7329);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7330, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7330);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7331, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7331);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7332, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7332);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7333, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7333);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7334, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7334);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7335, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7335);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7336, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7336);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7337, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7337);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7338, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7338);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7339, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7339);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7340, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7340);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7341, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7341);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7342, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7342);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7343, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7343);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7344, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7344);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7345, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7345);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7346, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7346);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7347, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7347);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7348, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7348);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7349, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7349);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7350, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7350);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7351, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7351);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7352, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7352);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7353, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7353);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7354, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7354);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7355, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7355);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7356, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7356);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7357, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7357);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7358, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7358);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7359, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7359);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7360, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7360);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7361, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7361);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7362, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7362);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7363, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7363);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7364, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7364);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7365, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7365);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7366, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7366);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7367, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7367);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7368, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7368);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7369, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7369);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7370, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7370);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7371, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7371);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7372, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7372);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7373, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7373);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7374, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7374);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7375, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7375);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7376, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7376);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7377, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7377);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7378, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7378);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7379, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7379);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7380, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7380);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7381, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7381);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7382, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7382);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7383, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7383);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7384, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7384);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7385, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7385);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7386, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7386);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7387, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7387);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7388, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7388);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7389, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7389);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7390, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7390);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7391, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7391);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7392, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7392);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7393, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7393);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7394, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7394);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7395, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7395);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7396, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7396);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7397, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7397);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7398, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7398);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffd_7399, AgradDistributionTestFixture, AgradDistributionWiener_ffd_7399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7400;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_7401;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7402;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7403;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7404;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7405;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7406;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, double, empty> type_fd_7407;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, empty> type_fd_7408;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7409;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, empty> type_fd_7410;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_7411;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7412;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, empty> type_fd_7413;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_7414;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7415;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_7416;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_7417;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7418;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_7419;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7420;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7421;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7422;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7423;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7424;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, double, empty> type_fd_7425;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, std::vector<double>, empty> type_fd_7426;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7427;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, fvar<double>, empty> type_fd_7428;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, std::vector<fvar<double>>, empty> type_fd_7429;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7430;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, double, empty> type_fd_7431;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, std::vector<double>, empty> type_fd_7432;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7433;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, fvar<double>, empty> type_fd_7434;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_7435;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7436;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_7437;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7438;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7439;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7440;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7441;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7442;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, double, empty> type_fd_7443;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, std::vector<double>, empty> type_fd_7444;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7445;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, fvar<double>, empty> type_fd_7446;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_7447;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7448;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, double, empty> type_fd_7449;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_7450;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7451;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_7452;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_7453;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7454;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_7455;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7456;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7457;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7458;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7459;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7460;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, double, empty> type_fd_7461;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<double>, empty> type_fd_7462;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7463;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, fvar<double>, empty> type_fd_7464;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, std::vector<fvar<double>>, empty> type_fd_7465;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, double, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7466;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, double, empty> type_fd_7467;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<double>, empty> type_fd_7468;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7469;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, fvar<double>, empty> type_fd_7470;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, std::vector<fvar<double>>, empty> type_fd_7471;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7472;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_fd_7473;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7474;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7475;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7476;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7477;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7478;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, double, empty> type_fd_7479;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, std::vector<double>, empty> type_fd_7480;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7481;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, fvar<double>, empty> type_fd_7482;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, std::vector<fvar<double>>, empty> type_fd_7483;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, fvar<double>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7484;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, double, empty> type_fd_7485;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<double>, empty> type_fd_7486;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7487;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, fvar<double>, empty> type_fd_7488;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, std::vector<fvar<double>>, empty> type_fd_7489;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7490;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, empty> type_fd_7491;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<double>, empty> type_fd_7492;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7493;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, fvar<double>, empty> type_fd_7494;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, empty> type_fd_7495;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, std::vector<fvar<double>>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, empty> type_fd_7496;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, double, empty> type_fd_7497;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_fd_7498;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<double>, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_fd_7499;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7400> AgradDistributionWiener_fd_7400;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7401> AgradDistributionWiener_fd_7401;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7402> AgradDistributionWiener_fd_7402;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7403> AgradDistributionWiener_fd_7403;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7404> AgradDistributionWiener_fd_7404;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7405> AgradDistributionWiener_fd_7405;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7406> AgradDistributionWiener_fd_7406;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7407> AgradDistributionWiener_fd_7407;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7408> AgradDistributionWiener_fd_7408;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7409> AgradDistributionWiener_fd_7409;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7410> AgradDistributionWiener_fd_7410;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7411> AgradDistributionWiener_fd_7411;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7412> AgradDistributionWiener_fd_7412;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7413> AgradDistributionWiener_fd_7413;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7414> AgradDistributionWiener_fd_7414;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7415> AgradDistributionWiener_fd_7415;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7416> AgradDistributionWiener_fd_7416;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7417> AgradDistributionWiener_fd_7417;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7418> AgradDistributionWiener_fd_7418;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7419> AgradDistributionWiener_fd_7419;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7420> AgradDistributionWiener_fd_7420;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7421> AgradDistributionWiener_fd_7421;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7422> AgradDistributionWiener_fd_7422;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7423> AgradDistributionWiener_fd_7423;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7424> AgradDistributionWiener_fd_7424;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7425> AgradDistributionWiener_fd_7425;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7426> AgradDistributionWiener_fd_7426;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7427> AgradDistributionWiener_fd_7427;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7428> AgradDistributionWiener_fd_7428;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7429> AgradDistributionWiener_fd_7429;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7430> AgradDistributionWiener_fd_7430;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7431> AgradDistributionWiener_fd_7431;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7432> AgradDistributionWiener_fd_7432;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7433> AgradDistributionWiener_fd_7433;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7434> AgradDistributionWiener_fd_7434;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7435> AgradDistributionWiener_fd_7435;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7436> AgradDistributionWiener_fd_7436;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7437> AgradDistributionWiener_fd_7437;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7438> AgradDistributionWiener_fd_7438;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7439> AgradDistributionWiener_fd_7439;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7440> AgradDistributionWiener_fd_7440;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7441> AgradDistributionWiener_fd_7441;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7442> AgradDistributionWiener_fd_7442;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7443> AgradDistributionWiener_fd_7443;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7444> AgradDistributionWiener_fd_7444;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7445> AgradDistributionWiener_fd_7445;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7446> AgradDistributionWiener_fd_7446;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7447> AgradDistributionWiener_fd_7447;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7448> AgradDistributionWiener_fd_7448;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7449> AgradDistributionWiener_fd_7449;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7450> AgradDistributionWiener_fd_7450;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7451> AgradDistributionWiener_fd_7451;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7452> AgradDistributionWiener_fd_7452;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7453> AgradDistributionWiener_fd_7453;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7454> AgradDistributionWiener_fd_7454;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7455> AgradDistributionWiener_fd_7455;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7456> AgradDistributionWiener_fd_7456;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7457> AgradDistributionWiener_fd_7457;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7458> AgradDistributionWiener_fd_7458;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7459> AgradDistributionWiener_fd_7459;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7460> AgradDistributionWiener_fd_7460;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7461> AgradDistributionWiener_fd_7461;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7462> AgradDistributionWiener_fd_7462;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7463> AgradDistributionWiener_fd_7463;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7464> AgradDistributionWiener_fd_7464;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7465> AgradDistributionWiener_fd_7465;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7466> AgradDistributionWiener_fd_7466;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7467> AgradDistributionWiener_fd_7467;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7468> AgradDistributionWiener_fd_7468;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7469> AgradDistributionWiener_fd_7469;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7470> AgradDistributionWiener_fd_7470;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7471> AgradDistributionWiener_fd_7471;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7472> AgradDistributionWiener_fd_7472;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7473> AgradDistributionWiener_fd_7473;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7474> AgradDistributionWiener_fd_7474;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7475> AgradDistributionWiener_fd_7475;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7476> AgradDistributionWiener_fd_7476;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7477> AgradDistributionWiener_fd_7477;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7478> AgradDistributionWiener_fd_7478;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7479> AgradDistributionWiener_fd_7479;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7480> AgradDistributionWiener_fd_7480;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7481> AgradDistributionWiener_fd_7481;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7482> AgradDistributionWiener_fd_7482;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7483> AgradDistributionWiener_fd_7483;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7484> AgradDistributionWiener_fd_7484;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7485> AgradDistributionWiener_fd_7485;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7486> AgradDistributionWiener_fd_7486;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7487> AgradDistributionWiener_fd_7487;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7488> AgradDistributionWiener_fd_7488;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7489> AgradDistributionWiener_fd_7489;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7490> AgradDistributionWiener_fd_7490;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7491> AgradDistributionWiener_fd_7491;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7492> AgradDistributionWiener_fd_7492;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7493> AgradDistributionWiener_fd_7493;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7494> AgradDistributionWiener_fd_7494;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7495> AgradDistributionWiener_fd_7495;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7496> AgradDistributionWiener_fd_7496;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7497> AgradDistributionWiener_fd_7497;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7498> AgradDistributionWiener_fd_7498;
+typedef boost::mpl::vector<AgradDistributionWiener, type_fd_7499> AgradDistributionWiener_fd_7499;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7400, AgradDistributionTestFixture, AgradDistributionWiener_fd_7400);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7401, AgradDistributionTestFixture, AgradDistributionWiener_fd_7401);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7402, AgradDistributionTestFixture, AgradDistributionWiener_fd_7402);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7403, AgradDistributionTestFixture, AgradDistributionWiener_fd_7403);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7404, AgradDistributionTestFixture, AgradDistributionWiener_fd_7404);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7405, AgradDistributionTestFixture, AgradDistributionWiener_fd_7405);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7406, AgradDistributionTestFixture, AgradDistributionWiener_fd_7406);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7407, AgradDistributionTestFixture, AgradDistributionWiener_fd_7407);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7408, AgradDistributionTestFixture, AgradDistributionWiener_fd_7408);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7409, AgradDistributionTestFixture, AgradDistributionWiener_fd_7409);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7410, AgradDistributionTestFixture, AgradDistributionWiener_fd_7410);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7411, AgradDistributionTestFixture, AgradDistributionWiener_fd_7411);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7412, AgradDistributionTestFixture, AgradDistributionWiener_fd_7412);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7413, AgradDistributionTestFixture, AgradDistributionWiener_fd_7413);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7414, AgradDistributionTestFixture, AgradDistributionWiener_fd_7414);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7415, AgradDistributionTestFixture, AgradDistributionWiener_fd_7415);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7416, AgradDistributionTestFixture, AgradDistributionWiener_fd_7416);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7417, AgradDistributionTestFixture, AgradDistributionWiener_fd_7417);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7418, AgradDistributionTestFixture, AgradDistributionWiener_fd_7418);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7419, AgradDistributionTestFixture, AgradDistributionWiener_fd_7419);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7420, AgradDistributionTestFixture, AgradDistributionWiener_fd_7420);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7421, AgradDistributionTestFixture, AgradDistributionWiener_fd_7421);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7422, AgradDistributionTestFixture, AgradDistributionWiener_fd_7422);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7423, AgradDistributionTestFixture, AgradDistributionWiener_fd_7423);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7424, AgradDistributionTestFixture, AgradDistributionWiener_fd_7424);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7425, AgradDistributionTestFixture, AgradDistributionWiener_fd_7425);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7426, AgradDistributionTestFixture, AgradDistributionWiener_fd_7426);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7427, AgradDistributionTestFixture, AgradDistributionWiener_fd_7427);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7428, AgradDistributionTestFixture, AgradDistributionWiener_fd_7428);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7429, AgradDistributionTestFixture, AgradDistributionWiener_fd_7429);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7430, AgradDistributionTestFixture, AgradDistributionWiener_fd_7430);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7431, AgradDistributionTestFixture, AgradDistributionWiener_fd_7431);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7432, AgradDistributionTestFixture, AgradDistributionWiener_fd_7432);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7433, AgradDistributionTestFixture, AgradDistributionWiener_fd_7433);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7434, AgradDistributionTestFixture, AgradDistributionWiener_fd_7434);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7435, AgradDistributionTestFixture, AgradDistributionWiener_fd_7435);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7436, AgradDistributionTestFixture, AgradDistributionWiener_fd_7436);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7437, AgradDistributionTestFixture, AgradDistributionWiener_fd_7437);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7438, AgradDistributionTestFixture, AgradDistributionWiener_fd_7438);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7439, AgradDistributionTestFixture, AgradDistributionWiener_fd_7439);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7440, AgradDistributionTestFixture, AgradDistributionWiener_fd_7440);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7441, AgradDistributionTestFixture, AgradDistributionWiener_fd_7441);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7442, AgradDistributionTestFixture, AgradDistributionWiener_fd_7442);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7443, AgradDistributionTestFixture, AgradDistributionWiener_fd_7443);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7444, AgradDistributionTestFixture, AgradDistributionWiener_fd_7444);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7445, AgradDistributionTestFixture, AgradDistributionWiener_fd_7445);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7446, AgradDistributionTestFixture, AgradDistributionWiener_fd_7446);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7447, AgradDistributionTestFixture, AgradDistributionWiener_fd_7447);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7448, AgradDistributionTestFixture, AgradDistributionWiener_fd_7448);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7449, AgradDistributionTestFixture, AgradDistributionWiener_fd_7449);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7450, AgradDistributionTestFixture, AgradDistributionWiener_fd_7450);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7451, AgradDistributionTestFixture, AgradDistributionWiener_fd_7451);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7452, AgradDistributionTestFixture, AgradDistributionWiener_fd_7452);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7453, AgradDistributionTestFixture, AgradDistributionWiener_fd_7453);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7454, AgradDistributionTestFixture, AgradDistributionWiener_fd_7454);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7455, AgradDistributionTestFixture, AgradDistributionWiener_fd_7455);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7456, AgradDistributionTestFixture, AgradDistributionWiener_fd_7456);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7457, AgradDistributionTestFixture, AgradDistributionWiener_fd_7457);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7458, AgradDistributionTestFixture, AgradDistributionWiener_fd_7458);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7459, AgradDistributionTestFixture, AgradDistributionWiener_fd_7459);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7460, AgradDistributionTestFixture, AgradDistributionWiener_fd_7460);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7461, AgradDistributionTestFixture, AgradDistributionWiener_fd_7461);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7462, AgradDistributionTestFixture, AgradDistributionWiener_fd_7462);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7463, AgradDistributionTestFixture, AgradDistributionWiener_fd_7463);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7464, AgradDistributionTestFixture, AgradDistributionWiener_fd_7464);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7465, AgradDistributionTestFixture, AgradDistributionWiener_fd_7465);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7466, AgradDistributionTestFixture, AgradDistributionWiener_fd_7466);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7467, AgradDistributionTestFixture, AgradDistributionWiener_fd_7467);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7468, AgradDistributionTestFixture, AgradDistributionWiener_fd_7468);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7469, AgradDistributionTestFixture, AgradDistributionWiener_fd_7469);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7470, AgradDistributionTestFixture, AgradDistributionWiener_fd_7470);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7471, AgradDistributionTestFixture, AgradDistributionWiener_fd_7471);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7472, AgradDistributionTestFixture, AgradDistributionWiener_fd_7472);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7473, AgradDistributionTestFixture, AgradDistributionWiener_fd_7473);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7474, AgradDistributionTestFixture, AgradDistributionWiener_fd_7474);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7475, AgradDistributionTestFixture, AgradDistributionWiener_fd_7475);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7476, AgradDistributionTestFixture, AgradDistributionWiener_fd_7476);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7477, AgradDistributionTestFixture, AgradDistributionWiener_fd_7477);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7478, AgradDistributionTestFixture, AgradDistributionWiener_fd_7478);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7479, AgradDistributionTestFixture, AgradDistributionWiener_fd_7479);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7480, AgradDistributionTestFixture, AgradDistributionWiener_fd_7480);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7481, AgradDistributionTestFixture, AgradDistributionWiener_fd_7481);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7482, AgradDistributionTestFixture, AgradDistributionWiener_fd_7482);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7483, AgradDistributionTestFixture, AgradDistributionWiener_fd_7483);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7484, AgradDistributionTestFixture, AgradDistributionWiener_fd_7484);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7485, AgradDistributionTestFixture, AgradDistributionWiener_fd_7485);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7486, AgradDistributionTestFixture, AgradDistributionWiener_fd_7486);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7487, AgradDistributionTestFixture, AgradDistributionWiener_fd_7487);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7488, AgradDistributionTestFixture, AgradDistributionWiener_fd_7488);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7489, AgradDistributionTestFixture, AgradDistributionWiener_fd_7489);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7490, AgradDistributionTestFixture, AgradDistributionWiener_fd_7490);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7491, AgradDistributionTestFixture, AgradDistributionWiener_fd_7491);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7492, AgradDistributionTestFixture, AgradDistributionWiener_fd_7492);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7493, AgradDistributionTestFixture, AgradDistributionWiener_fd_7493);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7494, AgradDistributionTestFixture, AgradDistributionWiener_fd_7494);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7495, AgradDistributionTestFixture, AgradDistributionWiener_fd_7495);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7496, AgradDistributionTestFixture, AgradDistributionWiener_fd_7496);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7497, AgradDistributionTestFixture, AgradDistributionWiener_fd_7497);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7498, AgradDistributionTestFixture, AgradDistributionWiener_fd_7498);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_fd_7499, AgradDistributionTestFixture, AgradDistributionWiener_fd_7499);
+
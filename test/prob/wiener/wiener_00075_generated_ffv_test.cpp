@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_7500;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_7501;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7502;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_7503;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_7504;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7505;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_7506;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7507;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7508;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_7509;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7510;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7511;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7512;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7513;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7514;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_7515;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_7516;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7517;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_7518;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_7519;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7520;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_7521;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_7522;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7523;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_7524;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7525;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7526;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_7527;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_7528;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_7529;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_7530;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7531;
+typedef boost::mpl::vector<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_7532;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7500> AgradDistributionWiener_ffv_7500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7501> AgradDistributionWiener_ffv_7501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7502> AgradDistributionWiener_ffv_7502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7503> AgradDistributionWiener_ffv_7503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7504> AgradDistributionWiener_ffv_7504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7505> AgradDistributionWiener_ffv_7505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7506> AgradDistributionWiener_ffv_7506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7507> AgradDistributionWiener_ffv_7507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7508> AgradDistributionWiener_ffv_7508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7509> AgradDistributionWiener_ffv_7509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7510> AgradDistributionWiener_ffv_7510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7511> AgradDistributionWiener_ffv_7511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7512> AgradDistributionWiener_ffv_7512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7513> AgradDistributionWiener_ffv_7513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7514> AgradDistributionWiener_ffv_7514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7515> AgradDistributionWiener_ffv_7515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7516> AgradDistributionWiener_ffv_7516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7517> AgradDistributionWiener_ffv_7517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7518> AgradDistributionWiener_ffv_7518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7519> AgradDistributionWiener_ffv_7519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7520> AgradDistributionWiener_ffv_7520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7521> AgradDistributionWiener_ffv_7521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7522> AgradDistributionWiener_ffv_7522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7523> AgradDistributionWiener_ffv_7523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7524> AgradDistributionWiener_ffv_7524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7525> AgradDistributionWiener_ffv_7525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7526> AgradDistributionWiener_ffv_7526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7527> AgradDistributionWiener_ffv_7527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7528> AgradDistributionWiener_ffv_7528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7529> AgradDistributionWiener_ffv_7529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7530> AgradDistributionWiener_ffv_7530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7531> AgradDistributionWiener_ffv_7531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_ffv_7532> AgradDistributionWiener_ffv_7532;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7500, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7501, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7502, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7503, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7504, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7505, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7506, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7507, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7508, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7509, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7510, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7511, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7512, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7513, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7514, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7515, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7516, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7517, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7518, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7519, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7520, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7521, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7522, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7523, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7524, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7525, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7526, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7527, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7528, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7529, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7530, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7531, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_ffv_7532, AgradDistributionTestFixture, AgradDistributionWiener_ffv_7532);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7500;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7501;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7502;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7503;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7504;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7505;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, double, empty> type_v_7506;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, std::vector<double>, empty> type_v_7507;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7508;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, var, empty> type_v_7509;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, std::vector<var>, empty> type_v_7510;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7511;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, double, empty> type_v_7512;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_7513;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7514;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, var, empty> type_v_7515;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_7516;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7517;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7518;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7519;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7520;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7521;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7522;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7523;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_7524;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_7525;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7526;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_7527;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_7528;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7529;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_7530;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_7531;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7532;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_7533;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_7534;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7535;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7536;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7537;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7538;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7539;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7540;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7541;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_7542;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_7543;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7544;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_7545;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_7546;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7547;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_7548;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_7549;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7550;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_7551;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_7552;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7553;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7554;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7555;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7556;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7557;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7558;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7559;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, empty> type_v_7560;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty> type_v_7561;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7562;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, var, empty> type_v_7563;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty> type_v_7564;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7565;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty> type_v_7566;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty> type_v_7567;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7568;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty> type_v_7569;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty> type_v_7570;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7571;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7572;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7573;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7574;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7575;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7576;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7577;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, double, empty> type_v_7578;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty> type_v_7579;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7580;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, var, empty> type_v_7581;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty> type_v_7582;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7583;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty> type_v_7584;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty> type_v_7585;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7586;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty> type_v_7587;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty> type_v_7588;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7589;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7590;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7591;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7592;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7593;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7594;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7595;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty> type_v_7596;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty> type_v_7597;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7598;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty> type_v_7599;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7500> AgradDistributionWiener_v_7500;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7501> AgradDistributionWiener_v_7501;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7502> AgradDistributionWiener_v_7502;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7503> AgradDistributionWiener_v_7503;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7504> AgradDistributionWiener_v_7504;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7505> AgradDistributionWiener_v_7505;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7506> AgradDistributionWiener_v_7506;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7507> AgradDistributionWiener_v_7507;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7508> AgradDistributionWiener_v_7508;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7509> AgradDistributionWiener_v_7509;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7510> AgradDistributionWiener_v_7510;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7511> AgradDistributionWiener_v_7511;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7512> AgradDistributionWiener_v_7512;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7513> AgradDistributionWiener_v_7513;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7514> AgradDistributionWiener_v_7514;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7515> AgradDistributionWiener_v_7515;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7516> AgradDistributionWiener_v_7516;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7517> AgradDistributionWiener_v_7517;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7518> AgradDistributionWiener_v_7518;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7519> AgradDistributionWiener_v_7519;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7520> AgradDistributionWiener_v_7520;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7521> AgradDistributionWiener_v_7521;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7522> AgradDistributionWiener_v_7522;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7523> AgradDistributionWiener_v_7523;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7524> AgradDistributionWiener_v_7524;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7525> AgradDistributionWiener_v_7525;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7526> AgradDistributionWiener_v_7526;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7527> AgradDistributionWiener_v_7527;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7528> AgradDistributionWiener_v_7528;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7529> AgradDistributionWiener_v_7529;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7530> AgradDistributionWiener_v_7530;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7531> AgradDistributionWiener_v_7531;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7532> AgradDistributionWiener_v_7532;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7533> AgradDistributionWiener_v_7533;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7534> AgradDistributionWiener_v_7534;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7535> AgradDistributionWiener_v_7535;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7536> AgradDistributionWiener_v_7536;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7537> AgradDistributionWiener_v_7537;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7538> AgradDistributionWiener_v_7538;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7539> AgradDistributionWiener_v_7539;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7540> AgradDistributionWiener_v_7540;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7541> AgradDistributionWiener_v_7541;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7542> AgradDistributionWiener_v_7542;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7543> AgradDistributionWiener_v_7543;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7544> AgradDistributionWiener_v_7544;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7545> AgradDistributionWiener_v_7545;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7546> AgradDistributionWiener_v_7546;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7547> AgradDistributionWiener_v_7547;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7548> AgradDistributionWiener_v_7548;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7549> AgradDistributionWiener_v_7549;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7550> AgradDistributionWiener_v_7550;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7551> AgradDistributionWiener_v_7551;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7552> AgradDistributionWiener_v_7552;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7553> AgradDistributionWiener_v_7553;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7554> AgradDistributionWiener_v_7554;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7555> AgradDistributionWiener_v_7555;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7556> AgradDistributionWiener_v_7556;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7557> AgradDistributionWiener_v_7557;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7558> AgradDistributionWiener_v_7558;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7559> AgradDistributionWiener_v_7559;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7560> AgradDistributionWiener_v_7560;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7561> AgradDistributionWiener_v_7561;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7562> AgradDistributionWiener_v_7562;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7563> AgradDistributionWiener_v_7563;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7564> AgradDistributionWiener_v_7564;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7565> AgradDistributionWiener_v_7565;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7566> AgradDistributionWiener_v_7566;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7567> AgradDistributionWiener_v_7567;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7568> AgradDistributionWiener_v_7568;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7569> AgradDistributionWiener_v_7569;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7570> AgradDistributionWiener_v_7570;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7571> AgradDistributionWiener_v_7571;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7572> AgradDistributionWiener_v_7572;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7573> AgradDistributionWiener_v_7573;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7574> AgradDistributionWiener_v_7574;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7575> AgradDistributionWiener_v_7575;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7576> AgradDistributionWiener_v_7576;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7577> AgradDistributionWiener_v_7577;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7578> AgradDistributionWiener_v_7578;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7579> AgradDistributionWiener_v_7579;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7580> AgradDistributionWiener_v_7580;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7581> AgradDistributionWiener_v_7581;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7582> AgradDistributionWiener_v_7582;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7583> AgradDistributionWiener_v_7583;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7584> AgradDistributionWiener_v_7584;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7585> AgradDistributionWiener_v_7585;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7586> AgradDistributionWiener_v_7586;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7587> AgradDistributionWiener_v_7587;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7588> AgradDistributionWiener_v_7588;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7589> AgradDistributionWiener_v_7589;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7590> AgradDistributionWiener_v_7590;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7591> AgradDistributionWiener_v_7591;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7592> AgradDistributionWiener_v_7592;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7593> AgradDistributionWiener_v_7593;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7594> AgradDistributionWiener_v_7594;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7595> AgradDistributionWiener_v_7595;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7596> AgradDistributionWiener_v_7596;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7597> AgradDistributionWiener_v_7597;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7598> AgradDistributionWiener_v_7598;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7599> AgradDistributionWiener_v_7599;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7500, AgradDistributionTestFixture, AgradDistributionWiener_v_7500);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7501, AgradDistributionTestFixture, AgradDistributionWiener_v_7501);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7502, AgradDistributionTestFixture, AgradDistributionWiener_v_7502);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7503, AgradDistributionTestFixture, AgradDistributionWiener_v_7503);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7504, AgradDistributionTestFixture, AgradDistributionWiener_v_7504);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7505, AgradDistributionTestFixture, AgradDistributionWiener_v_7505);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7506, AgradDistributionTestFixture, AgradDistributionWiener_v_7506);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7507, AgradDistributionTestFixture, AgradDistributionWiener_v_7507);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7508, AgradDistributionTestFixture, AgradDistributionWiener_v_7508);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7509, AgradDistributionTestFixture, AgradDistributionWiener_v_7509);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7510, AgradDistributionTestFixture, AgradDistributionWiener_v_7510);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7511, AgradDistributionTestFixture, AgradDistributionWiener_v_7511);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7512, AgradDistributionTestFixture, AgradDistributionWiener_v_7512);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7513, AgradDistributionTestFixture, AgradDistributionWiener_v_7513);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7514, AgradDistributionTestFixture, AgradDistributionWiener_v_7514);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7515, AgradDistributionTestFixture, AgradDistributionWiener_v_7515);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7516, AgradDistributionTestFixture, AgradDistributionWiener_v_7516);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7517, AgradDistributionTestFixture, AgradDistributionWiener_v_7517);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7518, AgradDistributionTestFixture, AgradDistributionWiener_v_7518);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7519, AgradDistributionTestFixture, AgradDistributionWiener_v_7519);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7520, AgradDistributionTestFixture, AgradDistributionWiener_v_7520);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7521, AgradDistributionTestFixture, AgradDistributionWiener_v_7521);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7522, AgradDistributionTestFixture, AgradDistributionWiener_v_7522);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7523, AgradDistributionTestFixture, AgradDistributionWiener_v_7523);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7524, AgradDistributionTestFixture, AgradDistributionWiener_v_7524);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7525, AgradDistributionTestFixture, AgradDistributionWiener_v_7525);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7526, AgradDistributionTestFixture, AgradDistributionWiener_v_7526);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7527, AgradDistributionTestFixture, AgradDistributionWiener_v_7527);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7528, AgradDistributionTestFixture, AgradDistributionWiener_v_7528);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7529, AgradDistributionTestFixture, AgradDistributionWiener_v_7529);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7530, AgradDistributionTestFixture, AgradDistributionWiener_v_7530);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7531, AgradDistributionTestFixture, AgradDistributionWiener_v_7531);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7532, AgradDistributionTestFixture, AgradDistributionWiener_v_7532);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7533, AgradDistributionTestFixture, AgradDistributionWiener_v_7533);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7534, AgradDistributionTestFixture, AgradDistributionWiener_v_7534);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7535, AgradDistributionTestFixture, AgradDistributionWiener_v_7535);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7536, AgradDistributionTestFixture, AgradDistributionWiener_v_7536);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7537, AgradDistributionTestFixture, AgradDistributionWiener_v_7537);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7538, AgradDistributionTestFixture, AgradDistributionWiener_v_7538);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7539, AgradDistributionTestFixture, AgradDistributionWiener_v_7539);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7540, AgradDistributionTestFixture, AgradDistributionWiener_v_7540);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7541, AgradDistributionTestFixture, AgradDistributionWiener_v_7541);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7542, AgradDistributionTestFixture, AgradDistributionWiener_v_7542);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7543, AgradDistributionTestFixture, AgradDistributionWiener_v_7543);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7544, AgradDistributionTestFixture, AgradDistributionWiener_v_7544);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7545, AgradDistributionTestFixture, AgradDistributionWiener_v_7545);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7546, AgradDistributionTestFixture, AgradDistributionWiener_v_7546);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7547, AgradDistributionTestFixture, AgradDistributionWiener_v_7547);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7548, AgradDistributionTestFixture, AgradDistributionWiener_v_7548);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7549, AgradDistributionTestFixture, AgradDistributionWiener_v_7549);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7550, AgradDistributionTestFixture, AgradDistributionWiener_v_7550);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7551, AgradDistributionTestFixture, AgradDistributionWiener_v_7551);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7552, AgradDistributionTestFixture, AgradDistributionWiener_v_7552);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7553, AgradDistributionTestFixture, AgradDistributionWiener_v_7553);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7554, AgradDistributionTestFixture, AgradDistributionWiener_v_7554);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7555, AgradDistributionTestFixture, AgradDistributionWiener_v_7555);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7556, AgradDistributionTestFixture, AgradDistributionWiener_v_7556);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7557, AgradDistributionTestFixture, AgradDistributionWiener_v_7557);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7558, AgradDistributionTestFixture, AgradDistributionWiener_v_7558);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7559, AgradDistributionTestFixture, AgradDistributionWiener_v_7559);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7560, AgradDistributionTestFixture, AgradDistributionWiener_v_7560);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7561, AgradDistributionTestFixture, AgradDistributionWiener_v_7561);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7562, AgradDistributionTestFixture, AgradDistributionWiener_v_7562);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7563, AgradDistributionTestFixture, AgradDistributionWiener_v_7563);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7564, AgradDistributionTestFixture, AgradDistributionWiener_v_7564);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7565, AgradDistributionTestFixture, AgradDistributionWiener_v_7565);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7566, AgradDistributionTestFixture, AgradDistributionWiener_v_7566);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7567, AgradDistributionTestFixture, AgradDistributionWiener_v_7567);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7568, AgradDistributionTestFixture, AgradDistributionWiener_v_7568);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7569, AgradDistributionTestFixture, AgradDistributionWiener_v_7569);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7570, AgradDistributionTestFixture, AgradDistributionWiener_v_7570);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7571, AgradDistributionTestFixture, AgradDistributionWiener_v_7571);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7572, AgradDistributionTestFixture, AgradDistributionWiener_v_7572);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7573, AgradDistributionTestFixture, AgradDistributionWiener_v_7573);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7574, AgradDistributionTestFixture, AgradDistributionWiener_v_7574);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7575, AgradDistributionTestFixture, AgradDistributionWiener_v_7575);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7576, AgradDistributionTestFixture, AgradDistributionWiener_v_7576);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7577, AgradDistributionTestFixture, AgradDistributionWiener_v_7577);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7578, AgradDistributionTestFixture, AgradDistributionWiener_v_7578);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7579, AgradDistributionTestFixture, AgradDistributionWiener_v_7579);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7580, AgradDistributionTestFixture, AgradDistributionWiener_v_7580);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7581, AgradDistributionTestFixture, AgradDistributionWiener_v_7581);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7582, AgradDistributionTestFixture, AgradDistributionWiener_v_7582);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7583, AgradDistributionTestFixture, AgradDistributionWiener_v_7583);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7584, AgradDistributionTestFixture, AgradDistributionWiener_v_7584);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7585, AgradDistributionTestFixture, AgradDistributionWiener_v_7585);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7586, AgradDistributionTestFixture, AgradDistributionWiener_v_7586);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7587, AgradDistributionTestFixture, AgradDistributionWiener_v_7587);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7588, AgradDistributionTestFixture, AgradDistributionWiener_v_7588);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7589, AgradDistributionTestFixture, AgradDistributionWiener_v_7589);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7590, AgradDistributionTestFixture, AgradDistributionWiener_v_7590);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7591, AgradDistributionTestFixture, AgradDistributionWiener_v_7591);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7592, AgradDistributionTestFixture, AgradDistributionWiener_v_7592);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7593, AgradDistributionTestFixture, AgradDistributionWiener_v_7593);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7594, AgradDistributionTestFixture, AgradDistributionWiener_v_7594);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7595, AgradDistributionTestFixture, AgradDistributionWiener_v_7595);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7596, AgradDistributionTestFixture, AgradDistributionWiener_v_7596);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7597, AgradDistributionTestFixture, AgradDistributionWiener_v_7597);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7598, AgradDistributionTestFixture, AgradDistributionWiener_v_7598);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7599, AgradDistributionTestFixture, AgradDistributionWiener_v_7599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty> type_v_7600;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7601;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty> type_v_7602;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty> type_v_7603;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7604;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty> type_v_7605;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty> type_v_7606;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7607;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7608;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7609;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7610;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7611;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7612;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7613;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty> type_v_7614;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty> type_v_7615;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7616;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty> type_v_7617;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty> type_v_7618;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7619;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty> type_v_7620;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty> type_v_7621;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7622;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty> type_v_7623;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty> type_v_7624;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7625;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7626;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7627;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7628;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7629;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7630;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7631;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty> type_v_7632;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_7633;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7634;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty> type_v_7635;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_7636;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7637;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_7638;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_7639;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7640;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_7641;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_7642;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7643;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7644;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7645;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7646;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7647;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7648;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7649;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty> type_v_7650;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_7651;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7652;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty> type_v_7653;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_7654;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7655;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_7656;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_7657;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7658;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_7659;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_7660;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7661;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7662;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7663;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7664;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7665;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7666;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7667;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, empty> type_v_7668;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty> type_v_7669;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7670;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, empty> type_v_7671;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty> type_v_7672;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7673;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty> type_v_7674;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty> type_v_7675;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7676;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty> type_v_7677;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty> type_v_7678;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7679;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7680;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7681;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7682;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7683;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7684;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7685;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty> type_v_7686;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty> type_v_7687;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7688;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty> type_v_7689;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty> type_v_7690;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7691;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty> type_v_7692;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty> type_v_7693;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7694;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty> type_v_7695;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty> type_v_7696;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7697;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7698;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7699;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7600> AgradDistributionWiener_v_7600;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7601> AgradDistributionWiener_v_7601;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7602> AgradDistributionWiener_v_7602;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7603> AgradDistributionWiener_v_7603;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7604> AgradDistributionWiener_v_7604;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7605> AgradDistributionWiener_v_7605;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7606> AgradDistributionWiener_v_7606;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7607> AgradDistributionWiener_v_7607;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7608> AgradDistributionWiener_v_7608;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7609> AgradDistributionWiener_v_7609;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7610> AgradDistributionWiener_v_7610;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7611> AgradDistributionWiener_v_7611;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7612> AgradDistributionWiener_v_7612;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7613> AgradDistributionWiener_v_7613;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7614> AgradDistributionWiener_v_7614;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7615> AgradDistributionWiener_v_7615;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7616> AgradDistributionWiener_v_7616;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7617> AgradDistributionWiener_v_7617;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7618> AgradDistributionWiener_v_7618;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7619> AgradDistributionWiener_v_7619;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7620> AgradDistributionWiener_v_7620;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7621> AgradDistributionWiener_v_7621;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7622> AgradDistributionWiener_v_7622;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7623> AgradDistributionWiener_v_7623;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7624> AgradDistributionWiener_v_7624;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7625> AgradDistributionWiener_v_7625;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7626> AgradDistributionWiener_v_7626;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7627> AgradDistributionWiener_v_7627;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7628> AgradDistributionWiener_v_7628;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7629> AgradDistributionWiener_v_7629;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7630> AgradDistributionWiener_v_7630;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7631> AgradDistributionWiener_v_7631;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7632> AgradDistributionWiener_v_7632;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7633> AgradDistributionWiener_v_7633;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7634> AgradDistributionWiener_v_7634;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7635> AgradDistributionWiener_v_7635;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7636> AgradDistributionWiener_v_7636;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7637> AgradDistributionWiener_v_7637;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7638> AgradDistributionWiener_v_7638;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7639> AgradDistributionWiener_v_7639;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7640> AgradDistributionWiener_v_7640;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7641> AgradDistributionWiener_v_7641;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7642> AgradDistributionWiener_v_7642;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7643> AgradDistributionWiener_v_7643;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7644> AgradDistributionWiener_v_7644;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7645> AgradDistributionWiener_v_7645;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7646> AgradDistributionWiener_v_7646;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7647> AgradDistributionWiener_v_7647;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7648> AgradDistributionWiener_v_7648;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7649> AgradDistributionWiener_v_7649;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7650> AgradDistributionWiener_v_7650;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7651> AgradDistributionWiener_v_7651;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7652> AgradDistributionWiener_v_7652;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7653> AgradDistributionWiener_v_7653;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7654> AgradDistributionWiener_v_7654;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7655> AgradDistributionWiener_v_7655;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7656> AgradDistributionWiener_v_7656;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7657> AgradDistributionWiener_v_7657;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7658> AgradDistributionWiener_v_7658;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7659> AgradDistributionWiener_v_7659;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7660> AgradDistributionWiener_v_7660;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7661> AgradDistributionWiener_v_7661;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7662> AgradDistributionWiener_v_7662;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7663> AgradDistributionWiener_v_7663;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7664> AgradDistributionWiener_v_7664;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7665> AgradDistributionWiener_v_7665;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7666> AgradDistributionWiener_v_7666;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7667> AgradDistributionWiener_v_7667;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7668> AgradDistributionWiener_v_7668;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7669> AgradDistributionWiener_v_7669;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7670> AgradDistributionWiener_v_7670;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7671> AgradDistributionWiener_v_7671;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7672> AgradDistributionWiener_v_7672;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7673> AgradDistributionWiener_v_7673;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7674> AgradDistributionWiener_v_7674;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7675> AgradDistributionWiener_v_7675;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7676> AgradDistributionWiener_v_7676;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7677> AgradDistributionWiener_v_7677;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7678> AgradDistributionWiener_v_7678;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7679> AgradDistributionWiener_v_7679;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7680> AgradDistributionWiener_v_7680;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7681> AgradDistributionWiener_v_7681;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7682> AgradDistributionWiener_v_7682;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7683> AgradDistributionWiener_v_7683;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7684> AgradDistributionWiener_v_7684;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7685> AgradDistributionWiener_v_7685;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7686> AgradDistributionWiener_v_7686;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7687> AgradDistributionWiener_v_7687;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7688> AgradDistributionWiener_v_7688;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7689> AgradDistributionWiener_v_7689;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7690> AgradDistributionWiener_v_7690;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7691> AgradDistributionWiener_v_7691;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7692> AgradDistributionWiener_v_7692;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7693> AgradDistributionWiener_v_7693;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7694> AgradDistributionWiener_v_7694;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7695> AgradDistributionWiener_v_7695;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7696> AgradDistributionWiener_v_7696;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7697> AgradDistributionWiener_v_7697;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7698> AgradDistributionWiener_v_7698;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7699> AgradDistributionWiener_v_7699;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7600, AgradDistributionTestFixture, AgradDistributionWiener_v_7600);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7601, AgradDistributionTestFixture, AgradDistributionWiener_v_7601);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7602, AgradDistributionTestFixture, AgradDistributionWiener_v_7602);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7603, AgradDistributionTestFixture, AgradDistributionWiener_v_7603);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7604, AgradDistributionTestFixture, AgradDistributionWiener_v_7604);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7605, AgradDistributionTestFixture, AgradDistributionWiener_v_7605);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7606, AgradDistributionTestFixture, AgradDistributionWiener_v_7606);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7607, AgradDistributionTestFixture, AgradDistributionWiener_v_7607);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7608, AgradDistributionTestFixture, AgradDistributionWiener_v_7608);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7609, AgradDistributionTestFixture, AgradDistributionWiener_v_7609);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7610, AgradDistributionTestFixture, AgradDistributionWiener_v_7610);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7611, AgradDistributionTestFixture, AgradDistributionWiener_v_7611);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7612, AgradDistributionTestFixture, AgradDistributionWiener_v_7612);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7613, AgradDistributionTestFixture, AgradDistributionWiener_v_7613);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7614, AgradDistributionTestFixture, AgradDistributionWiener_v_7614);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7615, AgradDistributionTestFixture, AgradDistributionWiener_v_7615);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7616, AgradDistributionTestFixture, AgradDistributionWiener_v_7616);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7617, AgradDistributionTestFixture, AgradDistributionWiener_v_7617);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7618, AgradDistributionTestFixture, AgradDistributionWiener_v_7618);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7619, AgradDistributionTestFixture, AgradDistributionWiener_v_7619);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7620, AgradDistributionTestFixture, AgradDistributionWiener_v_7620);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7621, AgradDistributionTestFixture, AgradDistributionWiener_v_7621);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7622, AgradDistributionTestFixture, AgradDistributionWiener_v_7622);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7623, AgradDistributionTestFixture, AgradDistributionWiener_v_7623);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7624, AgradDistributionTestFixture, AgradDistributionWiener_v_7624);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7625, AgradDistributionTestFixture, AgradDistributionWiener_v_7625);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7626, AgradDistributionTestFixture, AgradDistributionWiener_v_7626);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7627, AgradDistributionTestFixture, AgradDistributionWiener_v_7627);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7628, AgradDistributionTestFixture, AgradDistributionWiener_v_7628);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7629, AgradDistributionTestFixture, AgradDistributionWiener_v_7629);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7630, AgradDistributionTestFixture, AgradDistributionWiener_v_7630);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7631, AgradDistributionTestFixture, AgradDistributionWiener_v_7631);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7632, AgradDistributionTestFixture, AgradDistributionWiener_v_7632);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7633, AgradDistributionTestFixture, AgradDistributionWiener_v_7633);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7634, AgradDistributionTestFixture, AgradDistributionWiener_v_7634);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7635, AgradDistributionTestFixture, AgradDistributionWiener_v_7635);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7636, AgradDistributionTestFixture, AgradDistributionWiener_v_7636);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7637, AgradDistributionTestFixture, AgradDistributionWiener_v_7637);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7638, AgradDistributionTestFixture, AgradDistributionWiener_v_7638);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7639, AgradDistributionTestFixture, AgradDistributionWiener_v_7639);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7640, AgradDistributionTestFixture, AgradDistributionWiener_v_7640);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7641, AgradDistributionTestFixture, AgradDistributionWiener_v_7641);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7642, AgradDistributionTestFixture, AgradDistributionWiener_v_7642);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7643, AgradDistributionTestFixture, AgradDistributionWiener_v_7643);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7644, AgradDistributionTestFixture, AgradDistributionWiener_v_7644);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7645, AgradDistributionTestFixture, AgradDistributionWiener_v_7645);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7646, AgradDistributionTestFixture, AgradDistributionWiener_v_7646);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7647, AgradDistributionTestFixture, AgradDistributionWiener_v_7647);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7648, AgradDistributionTestFixture, AgradDistributionWiener_v_7648);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7649, AgradDistributionTestFixture, AgradDistributionWiener_v_7649);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7650, AgradDistributionTestFixture, AgradDistributionWiener_v_7650);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7651, AgradDistributionTestFixture, AgradDistributionWiener_v_7651);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7652, AgradDistributionTestFixture, AgradDistributionWiener_v_7652);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7653, AgradDistributionTestFixture, AgradDistributionWiener_v_7653);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7654, AgradDistributionTestFixture, AgradDistributionWiener_v_7654);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7655, AgradDistributionTestFixture, AgradDistributionWiener_v_7655);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7656, AgradDistributionTestFixture, AgradDistributionWiener_v_7656);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7657, AgradDistributionTestFixture, AgradDistributionWiener_v_7657);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7658, AgradDistributionTestFixture, AgradDistributionWiener_v_7658);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7659, AgradDistributionTestFixture, AgradDistributionWiener_v_7659);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7660, AgradDistributionTestFixture, AgradDistributionWiener_v_7660);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7661, AgradDistributionTestFixture, AgradDistributionWiener_v_7661);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7662, AgradDistributionTestFixture, AgradDistributionWiener_v_7662);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7663, AgradDistributionTestFixture, AgradDistributionWiener_v_7663);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7664, AgradDistributionTestFixture, AgradDistributionWiener_v_7664);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7665, AgradDistributionTestFixture, AgradDistributionWiener_v_7665);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7666, AgradDistributionTestFixture, AgradDistributionWiener_v_7666);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7667, AgradDistributionTestFixture, AgradDistributionWiener_v_7667);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7668, AgradDistributionTestFixture, AgradDistributionWiener_v_7668);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7669, AgradDistributionTestFixture, AgradDistributionWiener_v_7669);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7670, AgradDistributionTestFixture, AgradDistributionWiener_v_7670);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7671, AgradDistributionTestFixture, AgradDistributionWiener_v_7671);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7672, AgradDistributionTestFixture, AgradDistributionWiener_v_7672);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7673, AgradDistributionTestFixture, AgradDistributionWiener_v_7673);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7674, AgradDistributionTestFixture, AgradDistributionWiener_v_7674);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7675, AgradDistributionTestFixture, AgradDistributionWiener_v_7675);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7676, AgradDistributionTestFixture, AgradDistributionWiener_v_7676);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7677, AgradDistributionTestFixture, AgradDistributionWiener_v_7677);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7678, AgradDistributionTestFixture, AgradDistributionWiener_v_7678);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7679, AgradDistributionTestFixture, AgradDistributionWiener_v_7679);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7680, AgradDistributionTestFixture, AgradDistributionWiener_v_7680);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7681, AgradDistributionTestFixture, AgradDistributionWiener_v_7681);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7682, AgradDistributionTestFixture, AgradDistributionWiener_v_7682);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7683, AgradDistributionTestFixture, AgradDistributionWiener_v_7683);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7684, AgradDistributionTestFixture, AgradDistributionWiener_v_7684);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7685, AgradDistributionTestFixture, AgradDistributionWiener_v_7685);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7686, AgradDistributionTestFixture, AgradDistributionWiener_v_7686);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7687, AgradDistributionTestFixture, AgradDistributionWiener_v_7687);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7688, AgradDistributionTestFixture, AgradDistributionWiener_v_7688);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7689, AgradDistributionTestFixture, AgradDistributionWiener_v_7689);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7690, AgradDistributionTestFixture, AgradDistributionWiener_v_7690);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7691, AgradDistributionTestFixture, AgradDistributionWiener_v_7691);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7692, AgradDistributionTestFixture, AgradDistributionWiener_v_7692);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7693, AgradDistributionTestFixture, AgradDistributionWiener_v_7693);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7694, AgradDistributionTestFixture, AgradDistributionWiener_v_7694);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7695, AgradDistributionTestFixture, AgradDistributionWiener_v_7695);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7696, AgradDistributionTestFixture, AgradDistributionWiener_v_7696);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7697, AgradDistributionTestFixture, AgradDistributionWiener_v_7697);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7698, AgradDistributionTestFixture, AgradDistributionWiener_v_7698);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7699, AgradDistributionTestFixture, AgradDistributionWiener_v_7699);
+
@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+#include <boost/mpl/vector.hpp>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/wiener/wiener_test.hpp>
+
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7700;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7701;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7702;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7703;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty> type_v_7704;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty> type_v_7705;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7706;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty> type_v_7707;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty> type_v_7708;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7709;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty> type_v_7710;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty> type_v_7711;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7712;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty> type_v_7713;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty> type_v_7714;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7715;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7716;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7717;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7718;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7719;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7720;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7721;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty> type_v_7722;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty> type_v_7723;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7724;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty> type_v_7725;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty> type_v_7726;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7727;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty> type_v_7728;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty> type_v_7729;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7730;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty> type_v_7731;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty> type_v_7732;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7733;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7734;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7735;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7736;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7737;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7738;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7739;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty> type_v_7740;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_7741;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7742;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty> type_v_7743;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_7744;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7745;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_7746;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_7747;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7748;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_7749;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_7750;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7751;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_7752;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7753;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7754;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_7755;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7756;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7757;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty> type_v_7758;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_7759;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7760;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty> type_v_7761;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_7762;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7763;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_7764;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_7765;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7766;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_7767;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_7768;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7769;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_7770;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_7771;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_7772;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_7773;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_7774;
+typedef boost::mpl::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_7775;
+
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7700> AgradDistributionWiener_v_7700;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7701> AgradDistributionWiener_v_7701;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7702> AgradDistributionWiener_v_7702;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7703> AgradDistributionWiener_v_7703;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7704> AgradDistributionWiener_v_7704;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7705> AgradDistributionWiener_v_7705;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7706> AgradDistributionWiener_v_7706;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7707> AgradDistributionWiener_v_7707;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7708> AgradDistributionWiener_v_7708;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7709> AgradDistributionWiener_v_7709;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7710> AgradDistributionWiener_v_7710;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7711> AgradDistributionWiener_v_7711;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7712> AgradDistributionWiener_v_7712;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7713> AgradDistributionWiener_v_7713;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7714> AgradDistributionWiener_v_7714;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7715> AgradDistributionWiener_v_7715;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7716> AgradDistributionWiener_v_7716;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7717> AgradDistributionWiener_v_7717;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7718> AgradDistributionWiener_v_7718;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7719> AgradDistributionWiener_v_7719;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7720> AgradDistributionWiener_v_7720;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7721> AgradDistributionWiener_v_7721;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7722> AgradDistributionWiener_v_7722;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7723> AgradDistributionWiener_v_7723;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7724> AgradDistributionWiener_v_7724;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7725> AgradDistributionWiener_v_7725;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7726> AgradDistributionWiener_v_7726;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7727> AgradDistributionWiener_v_7727;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7728> AgradDistributionWiener_v_7728;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7729> AgradDistributionWiener_v_7729;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7730> AgradDistributionWiener_v_7730;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7731> AgradDistributionWiener_v_7731;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7732> AgradDistributionWiener_v_7732;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7733> AgradDistributionWiener_v_7733;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7734> AgradDistributionWiener_v_7734;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7735> AgradDistributionWiener_v_7735;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7736> AgradDistributionWiener_v_7736;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7737> AgradDistributionWiener_v_7737;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7738> AgradDistributionWiener_v_7738;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7739> AgradDistributionWiener_v_7739;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7740> AgradDistributionWiener_v_7740;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7741> AgradDistributionWiener_v_7741;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7742> AgradDistributionWiener_v_7742;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7743> AgradDistributionWiener_v_7743;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7744> AgradDistributionWiener_v_7744;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7745> AgradDistributionWiener_v_7745;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7746> AgradDistributionWiener_v_7746;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7747> AgradDistributionWiener_v_7747;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7748> AgradDistributionWiener_v_7748;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7749> AgradDistributionWiener_v_7749;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7750> AgradDistributionWiener_v_7750;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7751> AgradDistributionWiener_v_7751;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7752> AgradDistributionWiener_v_7752;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7753> AgradDistributionWiener_v_7753;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7754> AgradDistributionWiener_v_7754;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7755> AgradDistributionWiener_v_7755;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7756> AgradDistributionWiener_v_7756;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7757> AgradDistributionWiener_v_7757;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7758> AgradDistributionWiener_v_7758;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7759> AgradDistributionWiener_v_7759;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7760> AgradDistributionWiener_v_7760;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7761> AgradDistributionWiener_v_7761;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7762> AgradDistributionWiener_v_7762;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7763> AgradDistributionWiener_v_7763;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7764> AgradDistributionWiener_v_7764;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7765> AgradDistributionWiener_v_7765;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7766> AgradDistributionWiener_v_7766;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7767> AgradDistributionWiener_v_7767;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7768> AgradDistributionWiener_v_7768;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7769> AgradDistributionWiener_v_7769;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7770> AgradDistributionWiener_v_7770;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7771> AgradDistributionWiener_v_7771;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7772> AgradDistributionWiener_v_7772;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7773> AgradDistributionWiener_v_7773;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7774> AgradDistributionWiener_v_7774;
+typedef boost::mpl::vector<AgradDistributionWiener, type_v_7775> AgradDistributionWiener_v_7775;
+
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7700, AgradDistributionTestFixture, AgradDistributionWiener_v_7700);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7701, AgradDistributionTestFixture, AgradDistributionWiener_v_7701);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7702, AgradDistributionTestFixture, AgradDistributionWiener_v_7702);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7703, AgradDistributionTestFixture, AgradDistributionWiener_v_7703);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7704, AgradDistributionTestFixture, AgradDistributionWiener_v_7704);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7705, AgradDistributionTestFixture, AgradDistributionWiener_v_7705);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7706, AgradDistributionTestFixture, AgradDistributionWiener_v_7706);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7707, AgradDistributionTestFixture, AgradDistributionWiener_v_7707);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7708, AgradDistributionTestFixture, AgradDistributionWiener_v_7708);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7709, AgradDistributionTestFixture, AgradDistributionWiener_v_7709);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7710, AgradDistributionTestFixture, AgradDistributionWiener_v_7710);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7711, AgradDistributionTestFixture, AgradDistributionWiener_v_7711);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7712, AgradDistributionTestFixture, AgradDistributionWiener_v_7712);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7713, AgradDistributionTestFixture, AgradDistributionWiener_v_7713);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7714, AgradDistributionTestFixture, AgradDistributionWiener_v_7714);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7715, AgradDistributionTestFixture, AgradDistributionWiener_v_7715);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7716, AgradDistributionTestFixture, AgradDistributionWiener_v_7716);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7717, AgradDistributionTestFixture, AgradDistributionWiener_v_7717);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7718, AgradDistributionTestFixture, AgradDistributionWiener_v_7718);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7719, AgradDistributionTestFixture, AgradDistributionWiener_v_7719);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7720, AgradDistributionTestFixture, AgradDistributionWiener_v_7720);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7721, AgradDistributionTestFixture, AgradDistributionWiener_v_7721);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7722, AgradDistributionTestFixture, AgradDistributionWiener_v_7722);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7723, AgradDistributionTestFixture, AgradDistributionWiener_v_7723);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7724, AgradDistributionTestFixture, AgradDistributionWiener_v_7724);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7725, AgradDistributionTestFixture, AgradDistributionWiener_v_7725);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7726, AgradDistributionTestFixture, AgradDistributionWiener_v_7726);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7727, AgradDistributionTestFixture, AgradDistributionWiener_v_7727);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7728, AgradDistributionTestFixture, AgradDistributionWiener_v_7728);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7729, AgradDistributionTestFixture, AgradDistributionWiener_v_7729);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7730, AgradDistributionTestFixture, AgradDistributionWiener_v_7730);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7731, AgradDistributionTestFixture, AgradDistributionWiener_v_7731);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7732, AgradDistributionTestFixture, AgradDistributionWiener_v_7732);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7733, AgradDistributionTestFixture, AgradDistributionWiener_v_7733);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7734, AgradDistributionTestFixture, AgradDistributionWiener_v_7734);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7735, AgradDistributionTestFixture, AgradDistributionWiener_v_7735);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7736, AgradDistributionTestFixture, AgradDistributionWiener_v_7736);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7737, AgradDistributionTestFixture, AgradDistributionWiener_v_7737);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7738, AgradDistributionTestFixture, AgradDistributionWiener_v_7738);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7739, AgradDistributionTestFixture, AgradDistributionWiener_v_7739);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7740, AgradDistributionTestFixture, AgradDistributionWiener_v_7740);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7741, AgradDistributionTestFixture, AgradDistributionWiener_v_7741);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7742, AgradDistributionTestFixture, AgradDistributionWiener_v_7742);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7743, AgradDistributionTestFixture, AgradDistributionWiener_v_7743);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7744, AgradDistributionTestFixture, AgradDistributionWiener_v_7744);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7745, AgradDistributionTestFixture, AgradDistributionWiener_v_7745);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7746, AgradDistributionTestFixture, AgradDistributionWiener_v_7746);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7747, AgradDistributionTestFixture, AgradDistributionWiener_v_7747);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7748, AgradDistributionTestFixture, AgradDistributionWiener_v_7748);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7749, AgradDistributionTestFixture, AgradDistributionWiener_v_7749);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7750, AgradDistributionTestFixture, AgradDistributionWiener_v_7750);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7751, AgradDistributionTestFixture, AgradDistributionWiener_v_7751);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7752, AgradDistributionTestFixture, AgradDistributionWiener_v_7752);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7753, AgradDistributionTestFixture, AgradDistributionWiener_v_7753);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7754, AgradDistributionTestFixture, AgradDistributionWiener_v_7754);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7755, AgradDistributionTestFixture, AgradDistributionWiener_v_7755);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7756, AgradDistributionTestFixture, AgradDistributionWiener_v_7756);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7757, AgradDistributionTestFixture, AgradDistributionWiener_v_7757);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7758, AgradDistributionTestFixture, AgradDistributionWiener_v_7758);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7759, AgradDistributionTestFixture, AgradDistributionWiener_v_7759);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7760, AgradDistributionTestFixture, AgradDistributionWiener_v_7760);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7761, AgradDistributionTestFixture, AgradDistributionWiener_v_7761);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7762, AgradDistributionTestFixture, AgradDistributionWiener_v_7762);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7763, AgradDistributionTestFixture, AgradDistributionWiener_v_7763);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7764, AgradDistributionTestFixture, AgradDistributionWiener_v_7764);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7765, AgradDistributionTestFixture, AgradDistributionWiener_v_7765);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7766, AgradDistributionTestFixture, AgradDistributionWiener_v_7766);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7767, AgradDistributionTestFixture, AgradDistributionWiener_v_7767);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7768, AgradDistributionTestFixture, AgradDistributionWiener_v_7768);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7769, AgradDistributionTestFixture, AgradDistributionWiener_v_7769);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7770, AgradDistributionTestFixture, AgradDistributionWiener_v_7770);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7771, AgradDistributionTestFixture, AgradDistributionWiener_v_7771);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7772, AgradDistributionTestFixture, AgradDistributionWiener_v_7772);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7773, AgradDistributionTestFixture, AgradDistributionWiener_v_7773);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7774, AgradDistributionTestFixture, AgradDistributionWiener_v_7774);
+INSTANTIATE_TYPED_TEST_CASE_P(AgradDistributionWiener_v_7775, AgradDistributionTestFixture, AgradDistributionWiener_v_7775);
+
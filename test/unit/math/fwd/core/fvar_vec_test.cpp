@@ -0,0 +1,100 @@
+#include <stan/math/fwd.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+
+using stan::math::fvar;
+using stan::math::fvar_vec;
+
+// the tangents of fvar_vec<K> must match K separate fvar<double> passes
+template <typename F>
+void expect_lanes(const F& f, double x, double y) {
+  fvar_vec<2> x_vec(x, Eigen::Array2d(1, 0));
+  fvar_vec<2> y_vec(y, Eigen::Array2d(0.5, 1));
+  fvar_vec<2> z = f(x_vec, y_vec);
+
+  fvar<double> z0 = f(fvar<double>(x, 1), fvar<double>(y, 0.5));
+  fvar<double> z1 = f(fvar<double>(x, 0), fvar<double>(y, 1));
+  EXPECT_FLOAT_EQ(z0.val_, z.val_);
+  EXPECT_FLOAT_EQ(z0.d_, z.d_(0));
+  EXPECT_FLOAT_EQ(z1.d_, z.d_(1));
+}
+
+TEST(FwdCoreFvarVec, operators) {
+  auto f = [](const auto& x, const auto& y) {
+    auto z = x * y - y / x + 2.5 * x - y * 3.0 + 1.0 / y - (-x);
+    z += x;
+    z -= 0.5;
+    z *= y;
+    z /= x;
+    z *= 2.0;
+    z /= 4.0;
+    return z + 1.0;
+  };
+  expect_lanes(f, 1.5, -0.7);
+  expect_lanes(f, -3.0, 2.0);
+}
+
+TEST(FwdCoreFvarVec, functions) {
+  using stan::math::exp;
+  using stan::math::log;
+  using stan::math::pow;
+  auto f = [](const auto& x, const auto& y) {
+    return exp(x) * stan::math::expm1(y) + log(x * x) + stan::math::log1p(x)
+           + stan::math::sqrt(x) * stan::math::square(y) + stan::math::inv(y)
+           + pow(x, 2.5) + pow(2.0, y) + pow(x, y) + stan::math::sin(x)
+           + stan::math::cos(y) + stan::math::tanh(x * y)
+           + stan::math::fabs(y) + stan::math::inv_logit(x)
+           + stan::math::lgamma(x);
+  };
+  expect_lanes(f, 1.5, -0.7);
+  expect_lanes(f, 0.3, 2.0);
+}
+
+TEST(FwdCoreFvarVec, pow_at_zero) {
+  using stan::math::pow;
+  fvar_vec<2> x(0.0, Eigen::Array2d(1, 0));
+  fvar_vec<2> y(2.0, Eigen::Array2d(0, 1));
+  fvar_vec<2> z = pow(x, y);
+  EXPECT_FLOAT_EQ(0.0, z.val_);
+  EXPECT_FLOAT_EQ(0.0, z.d_(0));
+  EXPECT_FLOAT_EQ(0.0, z.d_(1));
+
+  z = pow(x, fvar_vec<2>(1.0, Eigen::Array2d(0, 1)));
+  EXPECT_FLOAT_EQ(0.0, z.val_);
+  EXPECT_FLOAT_EQ(1.0, z.d_(0));
+  EXPECT_FLOAT_EQ(0.0, z.d_(1));
+
+  z = pow(x, fvar_vec<2>(3.0));
+  EXPECT_FLOAT_EQ(0.0, z.d_(0));
+  EXPECT_FLOAT_EQ(0.0, z.d_(1));
+
+  z = pow(x, 0.5);
+  EXPECT_FLOAT_EQ(0.0, z.val_);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), z.d_(0));
+
+  z = pow(x, 0.0);
+  EXPECT_FLOAT_EQ(1.0, z.val_);
+  EXPECT_FLOAT_EQ(0.0, z.d_(0));
+  EXPECT_FLOAT_EQ(0.0, z.d_(1));
+
+  z = pow(x, 2.0);
+  EXPECT_FLOAT_EQ(0.0, z.val_);
+  EXPECT_FLOAT_EQ(0.0, z.d_(0));
+  EXPECT_FLOAT_EQ(0.0, z.d_(1));
+}
+
+TEST(FwdCoreFvarVec, comparisons) {
+  fvar_vec<4> x(1.0);
+  fvar_vec<4> y(2.0, Eigen::Array4d::Ones());
+  EXPECT_TRUE(x < y);
+  EXPECT_TRUE(x <= 1);
+  EXPECT_TRUE(3 > y);
+  EXPECT_TRUE(y >= x);
+  EXPECT_TRUE(x == 1.0);
+  EXPECT_TRUE(x != y);
+  EXPECT_TRUE((x.d_ == 0).all());
+  EXPECT_FLOAT_EQ(2.0, stan::math::value_of(y));
+  EXPECT_FLOAT_EQ(stan::math::trigamma(2.0),
+                  stan::math::digamma(y).d_(3));
+  EXPECT_TRUE(std::isnan(stan::math::log(fvar_vec<4>(-1.0)).val_));
+}
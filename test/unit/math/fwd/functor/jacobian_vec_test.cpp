@@ -0,0 +1,89 @@
+#include <stan/math/fwd.hpp>
+#include <gtest/gtest.h>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// fun(x) = [exp(x_0) * x_1, log(x_i) + sin(x_{i+1}) / x_{i+2}, ...]
+struct vector_fun {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    using stan::math::cos;
+    using stan::math::exp;
+    using stan::math::log;
+    using stan::math::pow;
+    using stan::math::sin;
+    using stan::math::sqrt;
+    Matrix<T, Dynamic, 1> y(x.size() - 1);
+    y(0) = exp(x(0)) * x(1) - pow(x(0), 3.0);
+    for (int i = 1; i + 1 < x.size(); ++i) {
+      y(i) = log(x(i)) + sin(x(i + 1)) / x(i - 1) + sqrt(x(i) * x(i + 1))
+             - 2.0 * cos(x(i - 1)) * pow(x(i), x(i + 1));
+    }
+    return y;
+  }
+};
+
+TEST(FwdFunctor, jacobian_vec) {
+  const int N = 11;
+  Matrix<double, Dynamic, 1> x(N);
+  for (int i = 0; i < N; ++i) {
+    x(i) = 0.5 + 0.1 * i;
+  }
+  // one forward pass per column
+  Matrix<double, Dynamic, 1> fx_ref;
+  Matrix<double, Dynamic, Dynamic> J_ref(N - 1, N);
+  for (int n = 0; n < N; ++n) {
+    Matrix<stan::math::fvar<double>, Dynamic, 1> x_fvar(N);
+    for (int k = 0; k < N; ++k) {
+      x_fvar(k) = stan::math::fvar<double>(x(k), n == k);
+    }
+    Matrix<stan::math::fvar<double>, Dynamic, 1> fx_fvar = vector_fun()(x_fvar);
+    fx_ref = fx_fvar.val();
+    J_ref.col(n) = fx_fvar.d();
+  }
+
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian_vec<4>(vector_fun(), x, fx, J);
+  ASSERT_EQ(N - 1, fx.size());
+  ASSERT_EQ(N - 1, J.rows());
+  ASSERT_EQ(N, J.cols());
+  for (int m = 0; m < N - 1; ++m) {
+    EXPECT_FLOAT_EQ(fx_ref(m), fx(m));
+    for (int n = 0; n < N; ++n) {
+      EXPECT_FLOAT_EQ(J_ref(m, n), J(m, n));
+    }
+  }
+
+  stan::math::jacobian_vec<1>(vector_fun(), x, fx, J);
+  for (int m = 0; m < N - 1; ++m) {
+    for (int n = 0; n < N; ++n) {
+      EXPECT_FLOAT_EQ(J_ref(m, n), J(m, n));
+    }
+  }
+}
+
+struct identity_fun {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    return x;
+  }
+};
+
+TEST(FwdFunctor, jacobian_vec_sizes) {
+  Matrix<double, Dynamic, 1> x(3);
+  x << 1, 2, 3;
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian_vec<8>(identity_fun(), x, fx, J);
+  EXPECT_FLOAT_EQ(2, fx(1));
+  EXPECT_TRUE(J.isIdentity());
+
+  Matrix<double, Dynamic, 1> x_empty(0);
+  stan::math::jacobian_vec<2>(identity_fun(), x_empty, fx, J);
+  EXPECT_EQ(0, fx.size());
+  EXPECT_EQ(0, J.size());
+}
@@ -0,0 +1,77 @@
+#include <stan/math/fwd.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// y_i = x_i^2 * x_{i+1} + exp(x_{i-1}), a tridiagonal Jacobian
+struct tridiagonal_fun {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    const int N = x.size();
+    Matrix<T, Dynamic, 1> y(N);
+    for (int i = 0; i < N; ++i) {
+      y(i) = x(i) * x(i);
+      if (i + 1 < N) {
+        y(i) *= x(i + 1);
+      }
+      if (i > 0) {
+        y(i) += stan::math::exp(x(i - 1));
+      }
+    }
+    return y;
+  }
+};
+
+Eigen::SparseMatrix<double> tridiagonal_pattern(int N) {
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int i = 0; i < N; ++i) {
+    for (int j = std::max(0, i - 1); j < std::min(N, i + 2); ++j) {
+      entries.emplace_back(i, j, 1.0);
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(N, N);
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  return pattern;
+}
+
+TEST(FwdFunctor, sparse_jacobian) {
+  const int N = 30;
+  Matrix<double, Dynamic, 1> x(N);
+  for (int i = 0; i < N; ++i) {
+    x(i) = 0.1 * i - 1;
+  }
+  Matrix<double, Dynamic, 1> fx_ref;
+  Matrix<double, Dynamic, Dynamic> J_ref;
+  stan::math::jacobian<double>(tridiagonal_fun(), x, fx_ref, J_ref);
+
+  Matrix<double, Dynamic, 1> fx;
+  Eigen::SparseMatrix<double> J;
+  stan::math::sparse_jacobian(tridiagonal_fun(), x, tridiagonal_pattern(N), fx,
+                              J);
+  EXPECT_EQ(3 * N - 2, J.nonZeros());
+  Matrix<double, Dynamic, Dynamic> J_dense(J);
+  for (int i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(fx_ref(i), fx(i));
+    for (int j = 0; j < N; ++j) {
+      EXPECT_FLOAT_EQ(J_ref(i, j), J_dense(i, j));
+    }
+  }
+}
+
+TEST(FwdFunctor, sparse_jacobian_errors) {
+  Matrix<double, Dynamic, 1> x(4);
+  x << 1, 2, 3, 4;
+  Matrix<double, Dynamic, 1> fx;
+  Eigen::SparseMatrix<double> J;
+  EXPECT_THROW(stan::math::sparse_jacobian(tridiagonal_fun(), x,
+                                           tridiagonal_pattern(3), fx, J),
+               std::invalid_argument);
+  Eigen::SparseMatrix<double> pattern(5, 4);
+  EXPECT_THROW(
+      stan::math::sparse_jacobian(tridiagonal_fun(), x, pattern, fx, J),
+      std::invalid_argument);
+}
@@ -8,7 +8,7 @@ TEST(ProbInternalMath, gradRegIncGamma_typical) {
   double g = 1.77245;
   double dig = -1.96351;
 
-  EXPECT_FLOAT_EQ(0.38984156, stan::math::grad_reg_inc_gamma(a, b, g, dig));
+  EXPECT_FLOAT_EQ(0.38983813, stan::math::grad_reg_inc_gamma(a, b, g, dig));
 }
 
 TEST(ProbInternalMath, gradRegIncGamma_infLoopInVersion2_0_1) {
@@ -38,7 +38,7 @@ TEST(ProbInternalMath, gradRegIncGamma_fd) {
   fvar<double> g = 1.77245;
   fvar<double> dig = -1.96351;
 
-  EXPECT_FLOAT_EQ(0.38984156,
+  EXPECT_FLOAT_EQ(0.38983813,
                   stan::math::grad_reg_inc_gamma(a, b, g, dig).val());
 }
 TEST(ProbInternalMath, gradRegIncGamma_ffd) {
@@ -49,7 +49,7 @@ TEST(ProbInternalMath, gradRegIncGamma_ffd) {
   fvar<fvar<double> > g = 1.77245;
   fvar<fvar<double> > dig = -1.96351;
 
-  EXPECT_FLOAT_EQ(0.38984156,
+  EXPECT_FLOAT_EQ(0.38983813,
                   stan::math::grad_reg_inc_gamma(a, b, g, dig).val_.val_);
 }
 
@@ -63,7 +63,7 @@ TEST(ProbInternalMath, gradRegIncGamma_fv) {
   fvar<var> g = 1.77245;
   fvar<var> dig = digamma(a);
 
-  EXPECT_FLOAT_EQ(0.38984156,
+  EXPECT_FLOAT_EQ(0.38983813,
                   stan::math::grad_reg_inc_gamma(a, b, g, dig).val_.val());
 }
 
@@ -0,0 +1,92 @@
+#include <stan/math/mix.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+#include <stdexcept>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// f(x) = sum_i x_i^2 * x_{i+1} + log_sum_exp(x) + exp(-x' x / N)
+struct coupled_fun {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    T lp = stan::math::log_sum_exp(x);
+    for (int i = 0; i + 1 < x.size(); ++i) {
+      lp += x(i) * x(i) * x(i + 1);
+    }
+    return lp + stan::math::exp(-stan::math::dot_self(x) / x.size());
+  }
+};
+
+struct throwing_fun {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    if (x(1) > 0) {
+      throw std::domain_error("x(1) must not be positive");
+    }
+    return x(0) * x(1);
+  }
+};
+
+TEST(MixFunctor, parallel_hessian) {
+  set_n_threads(4);
+  coupled_fun f;
+  const int N = 40;
+  Matrix<double, Dynamic, 1> x(N);
+  for (int i = 0; i < N; ++i) {
+    x(i) = 0.1 * i - 1.5;
+  }
+
+  double fx_ref;
+  Matrix<double, Dynamic, 1> grad_ref;
+  Matrix<double, Dynamic, Dynamic> H_ref;
+  stan::math::hessian(f, x, fx_ref, grad_ref, H_ref);
+
+  for (int grainsize : {1, 7, 100}) {
+    double fx;
+    Matrix<double, Dynamic, 1> grad;
+    Matrix<double, Dynamic, Dynamic> H;
+    stan::math::parallel_hessian(f, x, fx, grad, H, grainsize);
+
+    EXPECT_FLOAT_EQ(fx_ref, fx);
+    ASSERT_EQ(N, grad.size());
+    ASSERT_EQ(N, H.rows());
+    ASSERT_EQ(N, H.cols());
+    for (int i = 0; i < N; ++i) {
+      EXPECT_FLOAT_EQ(grad_ref(i), grad(i));
+      for (int j = 0; j < N; ++j) {
+        EXPECT_FLOAT_EQ(H_ref(i, j), H(i, j));
+      }
+    }
+  }
+  EXPECT_TRUE(stan::math::empty_nested());
+}
+
+TEST(MixFunctor, parallel_hessian_empty) {
+  coupled_fun f;
+  Matrix<double, Dynamic, 1> x(0);
+  double fx = 1;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::parallel_hessian(f, x, fx, grad, H);
+  EXPECT_EQ(0, grad.size());
+  EXPECT_EQ(0, H.size());
+}
+
+TEST(MixFunctor, parallel_hessian_errors) {
+  Matrix<double, Dynamic, 1> x(2);
+  x << 1, 2;
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  EXPECT_THROW(stan::math::parallel_hessian(throwing_fun(), x, fx, grad, H),
+               std::domain_error);
+  EXPECT_TRUE(stan::math::empty_nested());
+
+  x << 1, -2;
+  EXPECT_THROW(stan::math::parallel_hessian(throwing_fun(), x, fx, grad, H, 0),
+               std::domain_error);
+  EXPECT_NO_THROW(stan::math::parallel_hessian(throwing_fun(), x, fx, grad, H));
+  EXPECT_FLOAT_EQ(1, H(0, 1));
+  EXPECT_FLOAT_EQ(1, H(1, 0));
+}
@@ -0,0 +1,41 @@
+#include <stan/math/mix.hpp>
+#include <test/unit/math/test_ad.hpp>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+#include <vector>
+
+struct normal_slice_lpdf {
+  template <typename T, typename T_loc, typename T_scale>
+  auto operator()(const std::vector<T>& sub_slice, std::size_t start,
+                  std::size_t end, std::ostream* msgs, const T_loc& mu,
+                  const T_scale& sigma) const {
+    return stan::math::normal_lpdf(sub_slice, mu, sigma);
+  }
+};
+
+TEST(MathMixFunctor, reduce_sum) {
+  set_n_threads(4);
+  stan::math::init_threadpool_tbb();
+  auto f = [](const auto& y, const auto& mu, const auto& sigma) {
+    return stan::math::reduce_sum<normal_slice_lpdf>(y, 1, nullptr, mu,
+                                                     sigma);
+  };
+
+  std::vector<double> y{-2.3, 0.0, 1.7, 0.4, -0.9};
+  stan::test::expect_ad(f, y, 0.5, 1.3);
+  stan::test::expect_ad(f, y, -1.2, 0.7);
+}
+
+TEST(MathMixFunctor, reduce_sum_many_slices) {
+  set_n_threads(4);
+  stan::math::init_threadpool_tbb();
+  std::vector<double> y(1000);
+  for (std::size_t i = 0; i < y.size(); ++i) {
+    y[i] = 0.01 * i - 4.0;
+  }
+  auto f = [&y](const auto& mu, const auto& sigma) {
+    return stan::math::reduce_sum<normal_slice_lpdf>(y, 1, nullptr, mu,
+                                                     sigma);
+  };
+
+  stan::test::expect_ad(f, 0.5, 1.3);
+}
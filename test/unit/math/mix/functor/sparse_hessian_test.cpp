@@ -0,0 +1,77 @@
+#include <stan/math/mix.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// random effects blocks of size 3 coupled to their own group mean
+struct block_fun {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    T lp = 0;
+    for (int b = 0; b + 2 < x.size(); b += 3) {
+      lp += stan::math::normal_lpdf(x(b + 1), x(b), stan::math::exp(x(b + 2)));
+      lp += x(b) * x(b) * x(b + 2);
+    }
+    return lp;
+  }
+};
+
+Eigen::SparseMatrix<double> block_pattern(int num_blocks) {
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int b = 0; b < num_blocks; ++b) {
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        entries.emplace_back(3 * b + i, 3 * b + j, 1.0);
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(3 * num_blocks, 3 * num_blocks);
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  return pattern;
+}
+
+TEST(MixFunctor, sparse_hessian) {
+  const int N = 60;
+  Matrix<double, Dynamic, 1> x(N);
+  for (int i = 0; i < N; ++i) {
+    x(i) = 0.05 * i - 1;
+  }
+  double fx_ref;
+  Matrix<double, Dynamic, 1> grad_ref;
+  Matrix<double, Dynamic, Dynamic> H_ref;
+  stan::math::hessian(block_fun(), x, fx_ref, grad_ref, H_ref);
+
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Eigen::SparseMatrix<double> H;
+  stan::math::sparse_hessian(block_fun(), x, block_pattern(N / 3), fx, grad,
+                             H);
+  EXPECT_FLOAT_EQ(fx_ref, fx);
+  EXPECT_EQ(3 * N, H.nonZeros());
+  Matrix<double, Dynamic, Dynamic> H_dense(H);
+  for (int i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(grad_ref(i), grad(i));
+    for (int j = 0; j < N; ++j) {
+      EXPECT_FLOAT_EQ(H_ref(i, j), H_dense(i, j));
+    }
+  }
+  EXPECT_TRUE(stan::math::empty_nested());
+}
+
+TEST(MixFunctor, sparse_hessian_errors) {
+  Matrix<double, Dynamic, 1> x(6);
+  x << 1, 2, 3, 4, 5, 6;
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Eigen::SparseMatrix<double> H;
+  EXPECT_THROW(
+      stan::math::sparse_hessian(block_fun(), x, block_pattern(1), fx, grad, H),
+      std::invalid_argument);
+  Eigen::SparseMatrix<double> pattern(6, 3);
+  EXPECT_THROW(
+      stan::math::sparse_hessian(block_fun(), x, pattern, fx, grad, H),
+      std::invalid_argument);
+}
@@ -0,0 +1,24 @@
+#include <stan/math/mix.hpp>
+#include <test/unit/math/test_ad.hpp>
+#include <vector>
+
+TEST(mathMixScalFun, beta_lpdf) {
+  auto f = [](const auto& y, const auto& alpha, const auto& beta) {
+    return stan::math::beta_lpdf(y, alpha, beta);
+  };
+
+  stan::test::ad_tolerances tols;
+  tols.hessian_hessian_ = 1e-2;
+  tols.hessian_fvar_hessian_ = 1e-2;
+
+  std::vector<double> y{0.1, 0.5, 0.8};
+  Eigen::VectorXd alpha(3);
+  alpha << 0.5, 3.0, 20.0;
+  std::vector<double> beta{0.8, 1.0, 16.5};
+
+  stan::test::expect_ad(tols, f, 0.3, 2.4, 0.5);
+  stan::test::expect_ad(tols, f, y, alpha, beta);
+  stan::test::expect_ad(tols, f, y, 17.5, 1.2);
+  stan::test::expect_ad(tols, f, 0.7, alpha, 1.3);
+  stan::test::expect_ad(tols, f, 0.2, 1.5, beta);
+}
@@ -0,0 +1,24 @@
+#include <stan/math/mix.hpp>
+#include <test/unit/math/test_ad.hpp>
+#include <vector>
+
+TEST(mathMixScalFun, cauchy_lpdf) {
+  auto f = [](const auto& y, const auto& mu, const auto& sigma) {
+    return stan::math::cauchy_lpdf(y, mu, sigma);
+  };
+
+  stan::test::ad_tolerances tols;
+  tols.hessian_hessian_ = 1e-2;
+  tols.hessian_fvar_hessian_ = 1e-2;
+
+  std::vector<double> y{-2.3, 0.0, 1.7};
+  Eigen::VectorXd mu(3);
+  mu << 0.5, -1.0, 2.0;
+  std::vector<double> sigma{0.8, 1.0, 2.5};
+
+  stan::test::expect_ad(tols, f, -2.3, 0.5, 0.8);
+  stan::test::expect_ad(tols, f, y, mu, sigma);
+  stan::test::expect_ad(tols, f, y, 0.2, 1.3);
+  stan::test::expect_ad(tols, f, -0.7, mu, 1.3);
+  stan::test::expect_ad(tols, f, 0.4, -0.1, sigma);
+}
@@ -0,0 +1,20 @@
+#include <stan/math/mix.hpp>
+#include <test/unit/math/test_ad.hpp>
+#include <vector>
+
+TEST(mathMixScalFun, gamma_lpdf) {
+  auto f = [](const auto& y, const auto& alpha, const auto& beta) {
+    return stan::math::gamma_lpdf(y, alpha, beta);
+  };
+
+  std::vector<double> y{0.3, 1.7, 4.0};
+  Eigen::VectorXd alpha(3);
+  alpha << 0.5, 3.0, 20.0;
+  std::vector<double> beta{0.8, 1.0, 2.5};
+
+  stan::test::expect_ad(f, 1.3, 2.4, 0.5);
+  stan::test::expect_ad(f, y, alpha, beta);
+  stan::test::expect_ad(f, y, 17.5, 0.2);
+  stan::test::expect_ad(f, 0.7, alpha, 1.3);
+  stan::test::expect_ad(f, 2.1, 1.5, beta);
+}
@@ -10,3 +10,19 @@ TEST(mathMixScalFun, normal_lpdf) {
   stan::test::expect_ad(f(0, 1), 0.0);
   stan::test::expect_ad(f(0, 1), 1.7);
 }
+
+TEST(mathMixScalFun, normal_lpdf_vectorized) {
+  auto f = [](const auto& y, const auto& mu, const auto& sigma) {
+    return stan::math::normal_lpdf(y, mu, sigma);
+  };
+
+  std::vector<double> y{-2.3, 0.0, 1.7};
+  Eigen::VectorXd mu(3);
+  mu << 0.5, -1.0, 2.0;
+  std::vector<double> sigma{0.8, 1.0, 2.5};
+
+  stan::test::expect_ad(f, y, mu, sigma);
+  stan::test::expect_ad(f, y, 0.2, 1.3);
+  stan::test::expect_ad(f, -0.7, mu, 1.3);
+  stan::test::expect_ad(f, 0.4, -0.1, sigma);
+}
@@ -0,0 +1,29 @@
+#include <stan/math/mix.hpp>
+#include <test/unit/math/test_ad.hpp>
+#include <vector>
+
+TEST(mathMixScalFun, student_t_lpdf) {
+  auto f = [](const auto& y, const auto& nu, const auto& mu) {
+    return stan::math::student_t_lpdf(y, nu, mu, 1.3);
+  };
+  auto g = [](const auto& y, const auto& nu, const auto& sigma) {
+    return stan::math::student_t_lpdf(y, nu, 0.2, sigma);
+  };
+
+  stan::test::ad_tolerances tols;
+  tols.hessian_hessian_ = 1e-2;
+  tols.hessian_fvar_hessian_ = 1e-2;
+
+  std::vector<double> y{-2.3, 0.0, 1.7};
+  Eigen::VectorXd nu(3);
+  nu << 0.5, 3.0, 10.0;
+  std::vector<double> mu{0.5, -1.0, 2.0};
+  std::vector<double> sigma{0.8, 1.0, 2.5};
+
+  stan::test::expect_ad(tols, f, -2.3, 4.0, 0.5);
+  stan::test::expect_ad(tols, f, y, nu, mu);
+  stan::test::expect_ad(tols, f, y, 2.5, 0.2);
+  stan::test::expect_ad(tols, f, -0.7, nu, 1.3);
+  stan::test::expect_ad(tols, g, y, nu, sigma);
+  stan::test::expect_ad(tols, g, 0.4, 1.5, sigma);
+}
@@ -126,3 +126,31 @@ TEST(MathFunctions, Phi_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::Phi(b));
 }
+
+TEST(MathFunctions, Phi_array) {
+  using stan::math::Phi;
+  Eigen::ArrayXd x(11);
+  x << -40, -8, -3.5, -2, -0.7, 0, 0.3, 1.5, 3.5, 5, 9;
+  Eigen::ArrayXd res = Phi(x);
+  ASSERT_EQ(x.size(), res.size());
+  // With AVX the batch kernel and the scalar function both compute
+  // 0.5 * (1 + erf(x / sqrt(2))) for |x| < 2.5 * sqrt(2), but with
+  // different approximations of erf, so they agree to within a couple of
+  // ulp of 1 rather than relative to the result.
+  const double tol = 2 * std::numeric_limits<double>::epsilon();
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_NEAR(Phi(x(i)), res(i), tol) << "x = " << x(i);
+  }
+  x(3) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(Phi(x), std::domain_error);
+}
+
+TEST(MathFunctions, Phi_batch) {
+  // The kernel uses the same formula as Phi() on its range, with Boost's
+  // approximations of erf instead of the standard library's.
+  const double tol = 2 * std::numeric_limits<double>::epsilon();
+  for (double x = -3.53; x < 3.53; x += 0.01) {
+    EXPECT_NEAR(stan::math::Phi(x), stan::math::internal::Phi_batch(x), tol)
+        << "x = " << x;
+  }
+}
@@ -0,0 +1,30 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(MathFunctions, as_value_array_or_scalar_scalar) {
+  using stan::math::as_value_array_or_scalar;
+  EXPECT_FLOAT_EQ(2.5, as_value_array_or_scalar(2.5));
+  EXPECT_FLOAT_EQ(3.0, as_value_array_or_scalar(3));
+}
+
+TEST(MathFunctions, as_value_array_or_scalar_vector) {
+  using stan::math::as_value_array_or_scalar;
+  std::vector<double> a{1.5, -2.0, 3.25};
+  Eigen::VectorXd b(3);
+  b << 0.5, 1.5, 2.5;
+  std::vector<int> c{1, 2, 3};
+
+  Eigen::ArrayXd a_val = as_value_array_or_scalar(a);
+  Eigen::ArrayXd b_val = as_value_array_or_scalar(b);
+  Eigen::ArrayXd c_val = as_value_array_or_scalar(c);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FLOAT_EQ(a[i], a_val(i));
+    EXPECT_FLOAT_EQ(b(i), b_val(i));
+    EXPECT_FLOAT_EQ(c[i], c_val(i));
+  }
+
+  // doubles are mapped without a copy
+  EXPECT_EQ(a.data(), as_value_array_or_scalar(a).data());
+  EXPECT_EQ(b.data(), as_value_array_or_scalar(b).data());
+}
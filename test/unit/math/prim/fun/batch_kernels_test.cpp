@@ -0,0 +1,67 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST(MathFunctions, batch_if_less) {
+  using stan::math::internal::batch_if_less;
+  EXPECT_EQ(1.0, batch_if_less(-2.0, 3.0, 1.0, 2.0));
+  EXPECT_EQ(2.0, batch_if_less(3.0, 3.0, 1.0, 2.0));
+  EXPECT_EQ(2.0, batch_if_less(4.0, 3.0, 1.0, 2.0));
+  EXPECT_EQ(-0.5, batch_if_less(1e-300, 1.0, -0.5, 7.0));
+}
+
+TEST(MathFunctions, batch_log) {
+  using stan::math::internal::batch_log;
+  std::vector<double> xs{std::numeric_limits<double>::min(),
+                         1e-200,
+                         0.3,
+                         std::sqrt(0.5),
+                         1.0,
+                         1.0 + 1e-15,
+                         2.0,
+                         123.456,
+                         1e300,
+                         std::numeric_limits<double>::max()};
+  for (double x : xs) {
+    EXPECT_NEAR(std::log(x), batch_log(x),
+                2e-16 * std::fabs(std::log(x)) + 1e-300)
+        << "x = " << x;
+  }
+}
+
+TEST(MathFunctions, batch_log1p) {
+  using stan::math::internal::batch_log1p;
+  for (double x : {-0.999, -0.3, -1e-10, 0.0, 1e-20, 1e-8, 0.5, 7.0, 1e100}) {
+    EXPECT_NEAR(std::log1p(x), batch_log1p(x),
+                4e-16 * std::fabs(std::log1p(x)))
+        << "x = " << x;
+  }
+}
+
+TEST(MathFunctions, batch_exp) {
+  using stan::math::internal::batch_exp;
+  for (double x : {-700.0, -100.3, -1.0, -1e-12, 0.0, 1e-12, 0.5, 1.0, 88.0,
+                   709.5}) {
+    EXPECT_NEAR(std::exp(x), batch_exp(x), 4e-16 * std::exp(x))
+        << "x = " << x;
+  }
+  EXPECT_EQ(0.0, batch_exp(-750.0));
+  EXPECT_EQ(0.0, batch_exp(-std::numeric_limits<double>::infinity()));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), batch_exp(710.0));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(),
+            batch_exp(std::numeric_limits<double>::infinity()));
+}
+
+TEST(MathFunctions, batch_sin_cos_kernel) {
+  using stan::math::internal::batch_cos_kernel;
+  using stan::math::internal::batch_sin_kernel;
+  const double quarter_pi = 0.25 * stan::math::pi();
+  for (double x : {-quarter_pi, -0.6, -0.1, -1e-9, 0.0, 1e-300, 1e-5, 0.3,
+                   0.7, quarter_pi}) {
+    EXPECT_NEAR(std::sin(x), batch_sin_kernel(x), 2.3e-16 * std::fabs(x))
+        << "x = " << x;
+    EXPECT_NEAR(std::cos(x), batch_cos_kernel(x), 2.3e-16) << "x = " << x;
+  }
+}
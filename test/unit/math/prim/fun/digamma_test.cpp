@@ -26,3 +26,21 @@ TEST(MathFunctions, digamma_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::digamma(b));
 }
+
+TEST(MathFunctions, digamma_array) {
+  Eigen::ArrayXd x(9);
+  x << -1.5, 0.25, 1.0, 9.99, 10.0, 12.5, 1e3, 1e100, 1e300;
+  Eigen::ArrayXd res = stan::math::digamma(x);
+  ASSERT_EQ(x.size(), res.size());
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_NEAR(stan::math::digamma(x(i)), res(i),
+                4e-16 * std::fabs(stan::math::digamma(x(i))))
+        << "x = " << x(i);
+  }
+  Eigen::ArrayXd y(2);
+  y << std::numeric_limits<double>::quiet_NaN(),
+      std::numeric_limits<double>::infinity();
+  Eigen::ArrayXd res_y = stan::math::digamma(y);
+  EXPECT_TRUE(std::isnan(res_y(0)));
+  EXPECT_EQ(stan::math::digamma(y(1)), res_y(1));
+}
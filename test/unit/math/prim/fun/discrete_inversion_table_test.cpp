@@ -0,0 +1,28 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(MathFunctions, discrete_inversion_table) {
+  using stan::math::internal::discrete_inversion_table;
+  discrete_inversion_table table({0.1, 0.0, 0.6, 0.3});
+  EXPECT_EQ(0, table(0.0));
+  EXPECT_EQ(0, table(0.099));
+  EXPECT_EQ(2, table(0.1));
+  EXPECT_EQ(2, table(0.25));
+  EXPECT_EQ(2, table(0.699));
+  EXPECT_EQ(3, table(0.7));
+  EXPECT_EQ(3, table(0.99999));
+
+  discrete_inversion_table single({1.0});
+  EXPECT_EQ(0, single(0.0));
+  EXPECT_EQ(0, single(0.9));
+}
+
+TEST(MathFunctions, discrete_inversion_table_short_sum) {
+  using stan::math::internal::discrete_inversion_table;
+  // the mass missing from the probabilities goes to the last value
+  discrete_inversion_table table({0.5, 0.25});
+  EXPECT_EQ(0, table(0.3));
+  EXPECT_EQ(1, table(0.6));
+  EXPECT_EQ(1, table(0.9));
+}
@@ -0,0 +1,41 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(MathFunctions, glm_sufficient_stats) {
+  Eigen::MatrixXd x(3, 2);
+  x << 1, 2, 3, 4, 5, 6;
+  std::vector<double> y{1, -1, 2};
+  Eigen::VectorXd y_vec(3);
+  y_vec << 1, -1, 2;
+  stan::math::glm_sufficient_stats stats(y, x);
+
+  EXPECT_EQ(3, stats.instances());
+  EXPECT_EQ(2, stats.attributes());
+  Eigen::MatrixXd xtx = x.transpose() * x;
+  Eigen::VectorXd xty = x.transpose() * y_vec;
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_FLOAT_EQ(xty(i), stats.xty()(i));
+    EXPECT_FLOAT_EQ(x.col(i).sum(), stats.x_sum()(i));
+    for (int j = 0; j < 2; ++j) {
+      EXPECT_FLOAT_EQ(xtx(i, j), stats.xtx()(i, j));
+    }
+  }
+  EXPECT_FLOAT_EQ(6, stats.yty());
+  EXPECT_FLOAT_EQ(2, stats.y_sum());
+}
+
+TEST(MathFunctions, glm_sufficient_stats_error_checking) {
+  Eigen::MatrixXd x(3, 2);
+  x << 1, 2, 3, 4, 5, 6;
+  std::vector<double> y{1, -1, 2};
+  std::vector<double> yw1{1, -1};
+  std::vector<double> yw2{1, NAN, 2};
+  Eigen::MatrixXd xw = x;
+  xw(1, 1) = INFINITY;
+
+  EXPECT_THROW(stan::math::glm_sufficient_stats(yw1, x),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::glm_sufficient_stats(yw2, x), std::domain_error);
+  EXPECT_THROW(stan::math::glm_sufficient_stats(y, xw), std::domain_error);
+}
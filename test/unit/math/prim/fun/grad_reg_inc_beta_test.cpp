@@ -1,5 +1,6 @@
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <cmath>
 #include <limits>
 
 TEST(grad_reg_inc_beta, 1) {
@@ -16,7 +17,7 @@ TEST(grad_reg_inc_beta, 1) {
   stan::math::grad_reg_inc_beta(g1, g2, alpha, beta, y, digamma_alpha,
                                 digamma_beta, digamma_sum, betafunc);
   EXPECT_FLOAT_EQ(0, g1);
-  EXPECT_FLOAT_EQ(-std::numeric_limits<double>::infinity(), g2);
+  EXPECT_FLOAT_EQ(0, g2);
 }
 
 TEST(grad_reg_inc_beta, 2) {
@@ -35,3 +36,17 @@ TEST(grad_reg_inc_beta, 2) {
   EXPECT_NEAR(-0.36651629, g1, 1e-6);
   EXPECT_NEAR(0.30649537, g2, 1e-6);
 }
+
+TEST(grad_reg_inc_beta, nan) {
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  double g1 = 0;
+  double g2 = 0;
+  stan::math::grad_reg_inc_beta(g1, g2, nan, 1.0, 0.4, nan, 0.0, nan, nan);
+  EXPECT_TRUE(std::isnan(g1));
+  EXPECT_TRUE(std::isnan(g2));
+  g1 = 0;
+  g2 = 0;
+  stan::math::grad_reg_inc_beta(g1, g2, 1.0, 1.0, nan, 0.0, 0.0, 0.0, 1.0);
+  EXPECT_TRUE(std::isnan(g1));
+  EXPECT_TRUE(std::isnan(g2));
+}
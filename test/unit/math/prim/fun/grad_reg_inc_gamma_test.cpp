@@ -1,5 +1,8 @@
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 // converge
 TEST(MathPrimScalFun, grad_reg_inc_gamma_1) {
@@ -55,3 +58,35 @@ TEST(MathPrimScalFun, grad_reg_inc_gamma_6) {
   EXPECT_NEAR(0.1270365119242684,
               stan::math::grad_reg_inc_gamma(alpha, z, g, dig, 1e-12), 1e-8);
 }
+
+TEST(MathPrimScalFun, grad_reg_inc_gamma_large_a) {
+  using stan::math::digamma;
+  using stan::math::grad_reg_inc_gamma;
+  using stan::math::grad_reg_lower_inc_gamma;
+  using stan::math::tgamma;
+  // a, z, d/da gamma_q(a, z) computed with 60-digit arithmetic
+  std::vector<std::vector<double>> cases
+      = {{60, 60, 0.051574846776937158071},
+         {100, 90, 0.024611916843979909579},
+         {100, 120, 0.0062131859291406566996},
+         {500, 480, 0.012073629060036839675}};
+  for (const auto& c : cases) {
+    double a = c[0];
+    double z = c[1];
+    EXPECT_NEAR(c[2], grad_reg_inc_gamma(a, z, tgamma(a), digamma(a)),
+                1e-12 * c[2])
+        << "a = " << a << ", z = " << z;
+    EXPECT_NEAR(-c[2], grad_reg_lower_inc_gamma(a, z), 1e-12 * c[2])
+        << "a = " << a << ", z = " << z;
+  }
+}
+
+TEST(MathPrimScalFun, grad_reg_inc_gamma_nan) {
+  using stan::math::grad_reg_inc_gamma;
+  using stan::math::grad_reg_lower_inc_gamma;
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(grad_reg_inc_gamma(nan, 1.0, 1.0, 1.0)));
+  EXPECT_TRUE(std::isnan(grad_reg_inc_gamma(2.0, nan, 1.0, 1.0)));
+  EXPECT_TRUE(std::isnan(grad_reg_lower_inc_gamma(nan, 1.0)));
+  EXPECT_TRUE(std::isnan(grad_reg_lower_inc_gamma(2.0, nan)));
+}
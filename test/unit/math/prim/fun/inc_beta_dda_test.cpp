@@ -1,5 +1,7 @@
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
 
 TEST(MathFunctions, inc_beta_dda) {
   using stan::math::digamma;
@@ -34,12 +36,12 @@ TEST(MathFunctions, inc_beta_dda) {
   EXPECT_FLOAT_EQ(0.0, inc_beta_dda(large_a, small_b, mid_z, digamma(large_a),
                                     digamma(large_a + small_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.00091716705,
+  EXPECT_FLOAT_EQ(-6.5954323e-10,
                   inc_beta_dda(large_a, small_b, large_z, digamma(large_a),
                                digamma(large_a + small_b)))
       << "reasonable values for a, b, x";
 
-  EXPECT_FLOAT_EQ(1.8226241,
+  EXPECT_FLOAT_EQ(-3.9375637e-05,
                   inc_beta_dda(small_a, large_b, small_z, digamma(small_a),
                                digamma(small_a + large_b)))
       << "reasonable values for a, b, x";
@@ -53,7 +55,7 @@ TEST(MathFunctions, inc_beta_dda) {
   EXPECT_FLOAT_EQ(0.0, inc_beta_dda(large_a, large_b, small_z, digamma(large_a),
                                     digamma(large_a + large_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(-4.2743586e-14,
+  EXPECT_FLOAT_EQ(0.0,
                   inc_beta_dda(large_a, large_b, mid_z, digamma(large_a),
                                digamma(large_a + large_b)))
       << "reasonable values for a, b, x";
@@ -61,3 +63,11 @@ TEST(MathFunctions, inc_beta_dda) {
                                     digamma(large_a + large_b)))
       << "reasonable values for a, b, x";
 }
+
+TEST(MathFunctions, inc_beta_dda_nan) {
+  using stan::math::inc_beta_dda;
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(inc_beta_dda(nan, 1.0, 0.4, 0.0, 0.0)));
+  EXPECT_TRUE(std::isnan(inc_beta_dda(1.0, nan, 0.4, 0.0, 0.0)));
+  EXPECT_TRUE(std::isnan(inc_beta_dda(1.0, 1.0, nan, 0.0, 0.0)));
+}
@@ -1,5 +1,7 @@
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
 
 TEST(MathFunctions, inc_beta_ddb) {
   using stan::math::digamma;
@@ -15,48 +17,56 @@ TEST(MathFunctions, inc_beta_ddb) {
   double mid_z = 0.5;
   double large_z = 0.999;
 
-  EXPECT_FLOAT_EQ(3.2996082e-05,
-                  inc_beta_ddb(small_a, small_b, small_z, digamma(small_a),
+  EXPECT_FLOAT_EQ(4.4135733e-05,
+                  inc_beta_ddb(small_a, small_b, small_z, digamma(small_b),
                                digamma(small_a + small_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.17945045,
-                  inc_beta_ddb(small_a, small_b, mid_z, digamma(small_a),
+  EXPECT_FLOAT_EQ(0.29301795,
+                  inc_beta_ddb(small_a, small_b, mid_z, digamma(small_b),
                                digamma(small_a + small_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.0019721228,
-                  inc_beta_ddb(small_a, small_b, large_z, digamma(small_a),
+  EXPECT_FLOAT_EQ(0.001896961,
+                  inc_beta_ddb(small_a, small_b, large_z, digamma(small_b),
                                digamma(small_a + small_b)))
       << "reasonable values for a, b, x";
 
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, small_b, small_z, digamma(large_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, small_b, small_z, digamma(small_b),
                                     digamma(large_a + small_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, small_b, mid_z, digamma(large_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, small_b, mid_z, digamma(small_b),
                                     digamma(large_a + small_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(7.7076669,
-                  inc_beta_ddb(large_a, small_b, large_z, digamma(large_a),
+  EXPECT_FLOAT_EQ(2.0084979e-06,
+                  inc_beta_ddb(large_a, small_b, large_z, digamma(small_b),
                                digamma(large_a + small_b)))
       << "reasonable values for a, b, x";
 
-  EXPECT_FLOAT_EQ(9.3959293,
-                  inc_beta_ddb(small_a, large_b, small_z, digamma(small_a),
+  EXPECT_FLOAT_EQ(1.4782043e-08,
+                  inc_beta_ddb(small_a, large_b, small_z, digamma(large_b),
                                digamma(small_a + large_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(small_a, large_b, mid_z, digamma(small_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(small_a, large_b, mid_z, digamma(large_b),
                                     digamma(small_a + large_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(small_a, large_b, large_z, digamma(small_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(small_a, large_b, large_z, digamma(large_b),
                                     digamma(small_a + large_b)))
       << "reasonable values for a, b, x";
 
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, large_b, small_z, digamma(large_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, large_b, small_z, digamma(large_b),
                                     digamma(large_a + large_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, large_b, mid_z, digamma(large_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, large_b, mid_z, digamma(large_b),
                                     digamma(large_a + large_b)))
       << "reasonable values for a, b, x";
-  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, large_b, large_z, digamma(large_a),
+  EXPECT_FLOAT_EQ(0.0, inc_beta_ddb(large_a, large_b, large_z, digamma(large_b),
                                     digamma(large_a + large_b)))
       << "reasonable values for a, b, x";
 }
+
+TEST(MathFunctions, inc_beta_ddb_nan) {
+  using stan::math::inc_beta_ddb;
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(inc_beta_ddb(nan, 1.0, 0.4, 0.0, 0.0)));
+  EXPECT_TRUE(std::isnan(inc_beta_ddb(1.0, nan, 0.4, 0.0, 0.0)));
+  EXPECT_TRUE(std::isnan(inc_beta_ddb(1.0, 1.0, nan, 0.0, 0.0)));
+}
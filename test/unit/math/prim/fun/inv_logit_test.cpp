@@ -22,3 +22,19 @@ TEST(MathFunctions, inv_logit_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::inv_logit(b));
 }
+
+TEST(MathFunctions, inv_logit_array) {
+  Eigen::ArrayXd x(10);
+  x << -800, -700, -40, -1, -1e-20, 0, 0.5, 36, 750,
+      std::numeric_limits<double>::infinity();
+  Eigen::ArrayXd res = stan::math::inv_logit(x);
+  ASSERT_EQ(x.size(), res.size());
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_NEAR(stan::math::inv_logit(x(i)), res(i),
+                4e-16 * stan::math::inv_logit(x(i)))
+        << "x = " << x(i);
+  }
+  Eigen::ArrayXd y(1);
+  y << std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isnan(stan::math::inv_logit(y)(0)));
+}
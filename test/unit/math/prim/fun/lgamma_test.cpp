@@ -34,3 +34,25 @@ TEST(MathFunctions, lgamma_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::lgamma(b));
 }
+
+TEST(MathFunctions, lgamma_array) {
+  Eigen::ArrayXd x(9);
+  x << 1e-300, 0.5, 1.0, 2.0, 14.9, 15.0, 15.5, 1e3, 1e300;
+  Eigen::ArrayXd res = stan::math::lgamma(x);
+  ASSERT_EQ(x.size(), res.size());
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_NEAR(stan::math::lgamma(x(i)), res(i),
+                1e-15 * std::fabs(stan::math::lgamma(x(i))))
+        << "x = " << x(i);
+  }
+  Eigen::ArrayXd y(4);
+  y << 0.0, -2.0, std::numeric_limits<double>::infinity(),
+      std::numeric_limits<double>::quiet_NaN();
+  Eigen::ArrayXd res_y = stan::math::lgamma(y);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), res_y(0));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), res_y(1));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), res_y(2));
+  EXPECT_TRUE(std::isnan(res_y(3)));
+  Eigen::VectorXd v = stan::math::lgamma(x.head(8).matrix());
+  EXPECT_TRUE(v.array().isApprox(res.head(8)));
+}
@@ -24,3 +24,21 @@ TEST(MathFunctions, log1p_exp_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::log1p_exp(b));
 }
+
+TEST(MathFunctions, log1p_exp_array) {
+  Eigen::ArrayXd x(9);
+  x << -800, -700, -40, -1, -1e-20, 0, 0.5, 36, 750;
+  Eigen::ArrayXd res = stan::math::log1p_exp(x);
+  ASSERT_EQ(x.size(), res.size());
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_NEAR(stan::math::log1p_exp(x(i)), res(i),
+                4e-16 * stan::math::log1p_exp(x(i)))
+        << "x = " << x(i);
+  }
+  Eigen::ArrayXd y(2);
+  y << std::numeric_limits<double>::infinity(),
+      std::numeric_limits<double>::quiet_NaN();
+  Eigen::ArrayXd res_y = stan::math::log1p_exp(y);
+  EXPECT_EQ(std::numeric_limits<double>::infinity(), res_y(0));
+  EXPECT_TRUE(std::isnan(res_y(1)));
+}
@@ -15,3 +15,13 @@ TEST(MathFunctions, log_works_with_other_functions) {
   b << 1.1, 1.2, 1.3, 1.4, 1.5;
   stan::math::multiply(a, stan::math::log(b));
 }
+
+TEST(MathFunctions, log_array) {
+  Eigen::ArrayXd a(3);
+  a << 0.5, 1.2, 3.0;
+  Eigen::ArrayXd res = stan::math::log(a * 2.0);
+  ASSERT_EQ(3, res.size());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FLOAT_EQ(std::log(a(i) * 2.0), res(i));
+  }
+}
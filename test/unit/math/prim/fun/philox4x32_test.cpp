@@ -0,0 +1,121 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/math/prim/prob/util.hpp>
+#include <gtest/gtest.h>
+#include <boost/math/distributions.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+TEST(MathFunctions, philox4x32_known_answers) {
+  using stan::math::internal::philox4x32_10;
+  // Known answer tests of the Random123 library
+  std::array<std::uint32_t, 4> x = philox4x32_10(0, 0, 0, 0, 0, 0);
+  EXPECT_EQ(0x6627e8d5u, x[0]);
+  EXPECT_EQ(0xe169c58du, x[1]);
+  EXPECT_EQ(0xbc57ac4cu, x[2]);
+  EXPECT_EQ(0x9b00dbd8u, x[3]);
+
+  x = philox4x32_10(0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                    0xffffffff, 0xffffffff);
+  EXPECT_EQ(0x408f276du, x[0]);
+  EXPECT_EQ(0x41c83b0eu, x[1]);
+  EXPECT_EQ(0xa20bc7c6u, x[2]);
+  EXPECT_EQ(0x6d5451fdu, x[3]);
+
+  x = philox4x32_10(0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,
+                    0xa4093822, 0x299f31d0);
+  EXPECT_EQ(0xd16cfe09u, x[0]);
+  EXPECT_EQ(0x94fdccebu, x[1]);
+  EXPECT_EQ(0x5001e420u, x[2]);
+  EXPECT_EQ(0x24126ea1u, x[3]);
+}
+
+TEST(MathFunctions, philox4x32_sequence) {
+  stan::math::philox4x32 rng(0, 0);
+  std::array<std::uint32_t, 4> block0 = rng.block(0);
+  std::array<std::uint32_t, 4> block1 = rng.block(1);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(block0[i], rng());
+  }
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(block1[i], rng());
+  }
+}
+
+TEST(MathFunctions, philox4x32_seed_and_streams) {
+  stan::math::philox4x32 rng1(1234, 1);
+  stan::math::philox4x32 rng2(1234, 1);
+  stan::math::philox4x32 rng3(1234, 2);
+  stan::math::philox4x32 rng4(1235, 1);
+  EXPECT_TRUE(rng1 == rng2);
+  EXPECT_TRUE(rng1 != rng3);
+  int n_same_stream = 0;
+  int n_same_seed = 0;
+  for (int i = 0; i < 100; ++i) {
+    std::uint32_t x1 = rng1();
+    EXPECT_EQ(x1, rng2());
+    n_same_stream += x1 == rng3();
+    n_same_seed += x1 == rng4();
+  }
+  EXPECT_LT(n_same_stream, 2);
+  EXPECT_LT(n_same_seed, 2);
+
+  rng1.seed(1234, 2);
+  EXPECT_TRUE(rng1 == stan::math::philox4x32(1234, 2));
+  EXPECT_EQ(stan::math::philox4x32(1234, 2)(), rng1());
+
+  stan::math::philox4x32 sub = rng2.substream(1);
+  EXPECT_TRUE(sub != rng2.substream(2));
+  EXPECT_NE(sub(), rng2.substream(2)());
+}
+
+TEST(MathFunctions, philox4x32_discard) {
+  for (unsigned long long skip : {0, 1, 3, 4, 5, 17, 1000}) {
+    for (int start = 0; start < 4; ++start) {
+      stan::math::philox4x32 rng1(42, 7);
+      stan::math::philox4x32 rng2(42, 7);
+      for (int i = 0; i < start; ++i) {
+        rng1();
+        rng2();
+      }
+      for (unsigned long long i = 0; i < skip; ++i) {
+        rng1();
+      }
+      rng2.discard(skip);
+      EXPECT_TRUE(rng1 == rng2);
+      for (int i = 0; i < 9; ++i) {
+        EXPECT_EQ(rng1(), rng2());
+      }
+    }
+  }
+}
+
+TEST(MathFunctions, philox4x32_reserve_blocks) {
+  stan::math::philox4x32 rng(3, 0);
+  rng();
+  std::array<std::uint32_t, 4> block2 = rng.block(2);
+  EXPECT_EQ(1u, rng.reserve_blocks(1));
+  EXPECT_EQ(block2[0], rng());
+}
+
+TEST(MathFunctions, philox4x32_with_rng_functions) {
+  stan::math::philox4x32 rng(2020, 3);
+  int N = 10000;
+  int K = stan::math::round(2 * std::pow(N, 0.4));
+
+  std::vector<double> samples;
+  for (int i = 0; i < N; ++i) {
+    samples.push_back(stan::math::normal_rng(2.0, 1.0, rng));
+  }
+
+  boost::math::normal_distribution<> dist(2.0, 1.0);
+  std::vector<double> quantiles;
+  for (int i = 1; i < K; ++i) {
+    double frac = static_cast<double>(i) / K;
+    quantiles.push_back(quantile(dist, frac));
+  }
+  quantiles.push_back(std::numeric_limits<double>::max());
+
+  assert_matches_quantiles(samples, quantiles, 1e-6);
+}
@@ -28,6 +28,22 @@ struct harm_osc_ode_fun {
   }
 };
 
+struct harm_osc_ode_inplace_fun : public harm_osc_ode_fun {
+  using harm_osc_ode_fun::operator();
+  mutable int inplace_calls = 0;
+
+  inline void operator()(double t_in,
+                         const Eigen::Map<const Eigen::VectorXd>& y_in,
+                         const std::vector<double>& theta,
+                         const std::vector<double>& x,
+                         const std::vector<int>& x_int, std::ostream* msgs,
+                         Eigen::Map<Eigen::VectorXd>& dy_dt) const {
+    ++inplace_calls;
+    dy_dt(0) = y_in(1);
+    dy_dt(1) = -y_in(0) - theta[0] * y_in(1);
+  }
+};
+
 struct harm_osc_ode_data_fun {
   template <typename T0, typename T1, typename T2>
   inline std::vector<stan::return_type_t<T1, T2>>
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <thread>
+#include <utility>
 #include <vector>
 
 std::ostringstream *msgs = nullptr;
@@ -362,3 +364,69 @@ TEST(StanMath_integrate_1d_prim, test1) {
   test_integration(f16{}, 0.0, stan::math::pi(), {}, {}, {},
                    stan::math::square(stan::math::pi()) / 4);
 }
+
+TEST(StanMath_integrate_1d_prim, vector_integrand) {
+  using stan::math::internal::integrand_vector;
+  double inf = std::numeric_limits<double>::infinity();
+  double tol = 1e-8;
+
+  // moments of the standard normal density
+  auto moments = [](double x, double xc) {
+    Eigen::VectorXd v(3);
+    double p = std::exp(-0.5 * x * x) / std::sqrt(2.0 * stan::math::pi());
+    v << p, x * p, x * x * p;
+    return integrand_vector(v);
+  };
+  std::vector<std::pair<double, double>> limits
+      = {{-inf, inf}, {-inf, 0.0}, {0.0, inf}, {-inf, 1.0}, {-1.0, inf}};
+  for (const auto &ab : limits) {
+    integrand_vector Q
+        = stan::math::integrate(moments, ab.first, ab.second, tol);
+    ASSERT_EQ(3, Q.v_.size());
+    for (int i = 0; i < 3; ++i) {
+      double Q_i = stan::math::integrate(
+          [&](double x, double xc) { return moments(x, xc).v_(i); }, ab.first,
+          ab.second, tol);
+      EXPECT_NEAR(Q_i, Q.v_(i), 1e-7);
+    }
+  }
+
+  // finite limits crossing zero
+  auto powers = [](double x, double xc) {
+    Eigen::VectorXd v(3);
+    v << 1.0, x, x * x;
+    return integrand_vector(v);
+  };
+  integrand_vector Q = stan::math::integrate(powers, -1.0, 2.0, tol);
+  EXPECT_NEAR(3.0, Q.v_(0), 1e-8);
+  EXPECT_NEAR(1.5, Q.v_(1), 1e-8);
+  EXPECT_NEAR(3.0, Q.v_(2), 1e-8);
+}
+
+TEST(StanMath_integrate_1d_prim, shared_integrators_threads) {
+  // the integrators and their tables are shared between calls and threads
+  double inf = std::numeric_limits<double>::infinity();
+  auto f = [](double x, double xc) { return std::exp(-x * x); };
+  std::vector<std::pair<double, double>> limits
+      = {{-inf, inf}, {0.0, inf}, {-inf, 0.5}, {-1.0, 2.0}};
+  std::vector<double> expected;
+  for (const auto &ab : limits)
+    expected.push_back(stan::math::integrate(f, ab.first, ab.second, 1e-10));
+
+  std::vector<std::vector<double>> results(4);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < results.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (int rep = 0; rep < 20; ++rep)
+        for (const auto &ab : limits)
+          results[t].push_back(
+              stan::math::integrate(f, ab.first, ab.second, 1e-10));
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &result : results)
+    for (size_t i = 0; i < result.size(); ++i)
+      EXPECT_EQ(expected[i % limits.size()], result[i]);
+}
@@ -0,0 +1,23 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(map_rect_concurrent, cost_chunks) {
+  using stan::math::internal::map_rect_cost_chunks;
+
+  std::vector<double> costs(10, 1.0);
+  EXPECT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}),
+            map_rect_cost_chunks(costs, 1));
+  EXPECT_EQ(std::vector<std::size_t>({0, 3, 6, 9, 10}),
+            map_rect_cost_chunks(costs, 3));
+
+  // an expensive job gets a chunk of its own
+  costs[4] = 91.0;
+  EXPECT_EQ(std::vector<std::size_t>({0, 5, 10}),
+            map_rect_cost_chunks(costs, 1));
+  EXPECT_EQ(std::vector<std::size_t>({0, 10}), map_rect_cost_chunks(costs, 10));
+
+  std::vector<double> zero_costs(3, 0.0);
+  EXPECT_EQ(std::vector<std::size_t>({0, 1, 2, 3}),
+            map_rect_cost_chunks(zero_costs, 2));
+}
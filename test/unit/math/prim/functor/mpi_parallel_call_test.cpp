@@ -29,6 +29,24 @@ struct mock_reduce {
   }
 };
 
+struct ragged_reduce {
+  matrix_d operator()(const vector_d& shared_params,
+                      const vector_d& job_specific_params,
+                      const std::vector<double>& x_r,
+                      const std::vector<int>& x_i,
+                      std::ostream* msgs = nullptr) const {
+    if (job_specific_params(0) < 0) {
+      throw std::domain_error("Illegal parameter!");
+    }
+    matrix_d out(2, 1 + x_i[0] % 3);
+    for (int j = 0; j < out.cols(); ++j) {
+      out(0, j) = shared_params(0) * job_specific_params(0) + j;
+      out(1, j) = job_specific_params(1) - x_r[0] * j;
+    }
+    return out;
+  }
+};
+
 template <typename F, typename T_shared_param, typename T_job_param>
 struct mock_combine {
  public:
@@ -60,6 +78,16 @@ typedef stan::math::mpi_parallel_call<2, mock_reduce, mock_combine_dd>
     mock_call_t;
 STAN_REGISTER_MPI_DISTRIBUTED_APPLY(mock_call_t)
 
+typedef stan::math::mpi_parallel_call<3, ragged_reduce, mock_combine_dd>
+    pipelined_call_t;
+STAN_REGISTER_MPI_DISTRIBUTED_APPLY(pipelined_call_t)
+
+static const int pipeline_rounds_init = []() {
+  stan::math::map_rect_mpi_call_settings<3, ragged_reduce>().pipeline_rounds_
+      = 3;
+  return 0;
+}();
+
 struct MpiJob : public ::testing::Test {
   Eigen::VectorXd shared_params_d;
   std::vector<Eigen::VectorXd> job_params_d;
@@ -201,6 +229,52 @@ TEST_F(MpiJob, size_mismatch_cached_jobs_dd) {
                std::invalid_argument);
 }
 
+void expect_near_matrix(const matrix_d& a, const matrix_d& b) {
+  ASSERT_EQ(a.rows(), b.rows());
+  ASSERT_EQ(a.cols(), b.cols());
+  for (int k = 0; k < a.size(); ++k) {
+    EXPECT_FLOAT_EQ(a(k), b(k));
+  }
+}
+
+TEST_F(MpiJob, pipelined_rounds_dd) {
+  auto expected = [&]() {
+    std::vector<matrix_d> outputs;
+    int cols = 0;
+    for (std::size_t n = 0; n != N; ++n) {
+      outputs.push_back(
+          ragged_reduce()(shared_params_d, job_params_d[n], x_r[n], x_i[n]));
+      cols += outputs.back().cols();
+    }
+    matrix_d res(2, cols);
+    for (std::size_t n = 0, offset = 0; n != N;
+         offset += outputs[n].cols(), ++n) {
+      res.middleCols(offset, outputs[n].cols()) = outputs[n];
+    }
+    return res;
+  };
+
+  // the first evaluation uses blocking collectives, all further ones
+  // are pipelined over 3 rounds
+  for (int i = 0; i < 3; ++i) {
+    shared_params_d(0) = i + 1.0;
+    job_params_d[N - 1](1) = -i;
+    pipelined_call_t call(shared_params_d, job_params_d, x_r, x_i);
+    expect_near_matrix(expected(), call.reduce_combine());
+  }
+
+  // a failing job is flagged on the root and leaves the cluster
+  // usable
+  job_params_d[N / 2](0) = -1.0;
+  {
+    pipelined_call_t call(shared_params_d, job_params_d, x_r, x_i);
+    EXPECT_THROW(call.reduce_combine(), std::domain_error);
+  }
+  job_params_d[N / 2](0) = 1.0;
+  pipelined_call_t call(shared_params_d, job_params_d, x_r, x_i);
+  expect_near_matrix(expected(), call.reduce_combine());
+}
+
 TEST_F(MpiJob, root_not_confused_dd) {
   // the root must not call the distributed_apply ever
   EXPECT_THROW_MSG(mock_call_t::distributed_apply(), std::runtime_error,
@@ -0,0 +1,44 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(MathFunctions, parallel_chunks_covers_all_elements_once) {
+  using stan::math::internal::parallel_chunks;
+  for (size_t N : {0, 1, 7, 100, 1001}) {
+    for (size_t num_chunks : {1, 2, 3, 8}) {
+      std::vector<int> visits(N, 0);
+      std::vector<size_t> chunk_sizes(num_chunks, 0);
+      parallel_chunks(N, num_chunks,
+                      [&](size_t chunk, size_t start, size_t end) {
+                        EXPECT_LE(start, end);
+                        EXPECT_LE(end, N);
+                        chunk_sizes[chunk] = end - start;
+                        for (size_t n = start; n < end; ++n) {
+                          ++visits[n];
+                        }
+                      });
+      for (size_t n = 0; n < N; ++n) {
+        EXPECT_EQ(1, visits[n]);
+      }
+      for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        EXPECT_LE(chunk_sizes[chunk], N / num_chunks + 1);
+        EXPECT_GE(chunk_sizes[chunk], N / num_chunks);
+      }
+    }
+  }
+}
+
+TEST(MathFunctions, num_parallel_chunks) {
+  using stan::math::internal::num_parallel_chunks;
+  EXPECT_EQ(1, num_parallel_chunks(0));
+  EXPECT_EQ(1, num_parallel_chunks(STAN_MATH_PARALLEL_DENSITY_MIN_SIZE - 1));
+#ifdef STAN_THREADS
+  const size_t N = STAN_MATH_PARALLEL_DENSITY_MIN_SIZE
+                   + STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE / 2;
+  EXPECT_EQ((N + STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE - 1)
+                / STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE,
+            num_parallel_chunks(N));
+#else
+  EXPECT_EQ(1, num_parallel_chunks(10 * STAN_MATH_PARALLEL_DENSITY_MIN_SIZE));
+#endif
+}
@@ -0,0 +1,66 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+#include <stdexcept>
+#include <vector>
+
+struct count_lpdf {
+  template <typename T>
+  T operator()(const std::vector<int>& sub_slice, std::size_t start,
+               std::size_t end, std::ostream* msgs, const T& lambda,
+               const std::vector<int>& idata) const {
+    return stan::math::poisson_lpmf(sub_slice, lambda);
+  }
+};
+
+struct index_sum {
+  double operator()(const std::vector<int>& sub_slice, std::size_t start,
+                    std::size_t end, std::ostream* msgs) const {
+    double sum = 0;
+    for (std::size_t i = start; i < end; ++i) {
+      if (sub_slice[i - start] != static_cast<int>(i)) {
+        throw std::domain_error("slice does not match its range");
+      }
+      sum += i;
+    }
+    return sum;
+  }
+};
+
+TEST(StanMathPrim_reduce_sum, value) {
+  set_n_threads(4);
+  const double lambda = 10.0;
+  std::vector<int> data(10000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = i % 17;
+  }
+  std::vector<int> idata;
+
+  for (int grainsize : {1, 13, 10000, 20000}) {
+    EXPECT_FLOAT_EQ(stan::math::poisson_lpmf(data, lambda),
+                    stan::math::reduce_sum<count_lpdf>(data, grainsize,
+                                                       nullptr, lambda, idata));
+  }
+}
+
+TEST(StanMathPrim_reduce_sum, slices) {
+  std::vector<int> data(1000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = i;
+  }
+  EXPECT_FLOAT_EQ(999.0 * 1000.0 / 2.0,
+                  stan::math::reduce_sum<index_sum>(data, 7, nullptr));
+
+  std::vector<int> empty;
+  EXPECT_FLOAT_EQ(0.0, stan::math::reduce_sum<index_sum>(empty, 1, nullptr));
+}
+
+TEST(StanMathPrim_reduce_sum, errors) {
+  std::vector<int> data(10, 1);
+  std::vector<int> idata;
+  EXPECT_THROW(stan::math::reduce_sum<count_lpdf>(data, 0, nullptr, 1.0, idata),
+               std::domain_error);
+  EXPECT_THROW(
+      stan::math::reduce_sum<count_lpdf>(data, 1, nullptr, -1.0, idata),
+      std::domain_error);
+}
@@ -0,0 +1,52 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+namespace {
+Eigen::SparseMatrix<double> block_tridiagonal(int num_blocks, int block) {
+  const int N = num_blocks * block;
+  std::vector<Eigen::Triplet<double>> entries;
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      if (std::abs(i / block - j / block) <= 1) {
+        entries.emplace_back(i, j, 1.0);
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(N, N);
+  pattern.setFromTriplets(entries.begin(), entries.end());
+  return pattern;
+}
+}  // namespace
+
+TEST(StanMathPrim_sparse_column_coloring, block_tridiagonal) {
+  Eigen::SparseMatrix<double> pattern = block_tridiagonal(20, 3);
+  std::vector<int> colors
+      = stan::math::internal::sparse_column_coloring(pattern);
+  ASSERT_EQ(60, colors.size());
+
+  // columns sharing a row have different colors
+  Eigen::MatrixXd dense(pattern);
+  for (int i = 0; i < dense.rows(); ++i) {
+    for (int j = 0; j < dense.cols(); ++j) {
+      for (int k = j + 1; k < dense.cols(); ++k) {
+        if (dense(i, j) != 0 && dense(i, k) != 0) {
+          EXPECT_NE(colors[j], colors[k]);
+        }
+      }
+    }
+  }
+  // the number of colors is independent of the number of blocks
+  EXPECT_EQ(3 * 3 - 1, *std::max_element(colors.begin(), colors.end()));
+}
+
+TEST(StanMathPrim_sparse_column_coloring, diagonal) {
+  Eigen::SparseMatrix<double> pattern(5, 5);
+  pattern.setIdentity();
+  for (int color : stan::math::internal::sparse_column_coloring(pattern)) {
+    EXPECT_EQ(0, color);
+  }
+  Eigen::SparseMatrix<double> empty(0, 0);
+  EXPECT_TRUE(stan::math::internal::sparse_column_coloring(empty).empty());
+}
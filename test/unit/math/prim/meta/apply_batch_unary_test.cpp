@@ -0,0 +1,43 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+
+TEST(MathMetaPrim, apply_batch_unary) {
+  Eigen::ArrayXd x = Eigen::ArrayXd::LinSpaced(200, -2.0, 3.0);
+  x(7) = -10.0;
+  x(150) = -20.0;
+  auto kernel = [](double x) { return 2.0 * x; };
+  auto in_domain = [](double x) { return x > -5.0; };
+  auto fallback = [](double x) { return -x; };
+  Eigen::ArrayXd result
+      = stan::math::apply_batch_unary(x, kernel, in_domain, fallback);
+  ASSERT_EQ(x.size(), result.size());
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_EQ(in_domain(x(i)) ? kernel(x(i)) : fallback(x(i)), result(i));
+  }
+}
+
+TEST(MathMetaPrim, apply_batch_unary_no_values_in_domain) {
+  Eigen::ArrayXd x = Eigen::ArrayXd::LinSpaced(100, -20.0, -10.0);
+  int kernel_calls = 0;
+  auto kernel = [&](double x) {
+    ++kernel_calls;
+    return 2.0 * x;
+  };
+  Eigen::ArrayXd result = stan::math::apply_batch_unary(
+      x, kernel, [](double x) { return x > -5.0; },
+      [](double x) { return -x; });
+  EXPECT_EQ(0, kernel_calls);
+  EXPECT_TRUE(result.isApprox(-x));
+}
+
+TEST(MathMetaPrim, apply_batch_unary_expression) {
+  Eigen::Array<int, 2, 3> x;
+  x << 1, 2, 3, 4, 5, 6;
+  Eigen::Array<double, 2, 3> result = stan::math::apply_batch_unary(
+      x * 2, [](double x) { return x + 0.5; }, [](double) { return true; },
+      [](double x) { return x; });
+  for (int i = 0; i < x.size(); ++i) {
+    EXPECT_EQ(2 * x(i) + 0.5, result(i));
+  }
+}
@@ -0,0 +1,58 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/math/prim/prob/util.hpp>
+#include <gtest/gtest.h>
+#include <boost/math/distributions.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+TEST(ProbDistributionsBinomialBulkRng, error_check) {
+  using stan::math::binomial_bulk_rng;
+  stan::math::philox4x32 rng;
+  std::vector<double> theta(3, 0.3);
+  EXPECT_NO_THROW(binomial_bulk_rng(20, 0.3, 5, rng));
+  EXPECT_NO_THROW(binomial_bulk_rng(20, theta, 3, rng));
+  EXPECT_THROW(binomial_bulk_rng(-1, 0.3, 5, rng), std::domain_error);
+  EXPECT_THROW(binomial_bulk_rng(20, 1.3, 5, rng), std::domain_error);
+  EXPECT_THROW(binomial_bulk_rng(20, theta, 4, rng), std::invalid_argument);
+}
+
+TEST(ProbDistributionsBinomialBulkRng, reproducible) {
+  using stan::math::binomial_bulk_rng;
+  stan::math::philox4x32 rng1(8, 2);
+  stan::math::philox4x32 rng2(8, 2);
+  std::vector<int> x1 = binomial_bulk_rng(1000, 0.4, 5, rng1);
+  std::vector<int> x2 = binomial_bulk_rng(1000, 0.4, 5, rng2);
+  EXPECT_EQ(x1, x2);
+  EXPECT_TRUE(rng1 == rng2);
+}
+
+TEST(ProbDistributionsBinomialBulkRng, chiSquareGoodnessFitTest) {
+  std::vector<std::pair<int, double>> params{
+      {10, 0.3}, {20, 0.9}, {200, 0.3}, {2000, 0.3}};
+  for (const auto& param : params) {
+    const int N_trials = param.first;
+    const double theta = param.second;
+    stan::math::philox4x32 rng(42, 0);
+    int N = 10000;
+    boost::math::binomial_distribution<> dist(N_trials, theta);
+    // bins [0, lo], lo + 1, ..., hi - 1, [hi, N_trials]
+    int lo = static_cast<int>(quantile(dist, 0.01));
+    int hi = static_cast<int>(quantile(dist, 0.99));
+
+    std::vector<int> draws
+        = stan::math::binomial_bulk_rng(N_trials, theta, N, rng);
+    std::vector<int> counts(hi - lo + 1, 0);
+    for (int x : draws) {
+      ++counts[std::min(std::max(x, lo), hi) - lo];
+    }
+    std::vector<double> expected;
+    expected.push_back(N * cdf(dist, lo));
+    for (int x = lo + 1; x < hi; ++x) {
+      expected.push_back(N * pdf(dist, x));
+    }
+    expected.push_back(N * cdf(complement(dist, hi - 1)));
+
+    assert_chi_squared(counts, expected, 1e-6);
+  }
+}
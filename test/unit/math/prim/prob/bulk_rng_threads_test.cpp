@@ -0,0 +1,74 @@
+// the tests here check that the bulk random number generators give the
+// same draws with one and with several threads for vectors large enough
+// to be drawn in parallel chunks, as such these tests only run if
+// STAN_THREADS is defined.
+
+#ifdef STAN_THREADS
+
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+#include <tbb/task_arena.h>
+#include <vector>
+
+namespace {
+
+const std::size_t N = 100001;
+
+template <typename F>
+void expect_thread_independent(const F& draw) {
+  ASSERT_GT(stan::math::internal::num_parallel_chunks(N), 1);
+  set_n_threads(4);
+  stan::math::init_threadpool_tbb();
+  stan::math::philox4x32 rng1(17, 3);
+  stan::math::philox4x32 rng4(17, 3);
+  decltype(draw(rng1)) draws1;
+  decltype(draw(rng4)) draws4;
+  tbb::task_arena arena1(1);
+  arena1.execute([&] { draws1 = draw(rng1); });
+  tbb::task_arena arena4(4);
+  arena4.execute([&] { draws4 = draw(rng4); });
+  ASSERT_EQ(draws1.size(), draws4.size());
+  for (std::size_t n = 0; n < N; ++n) {
+    EXPECT_EQ(draws1[n], draws4[n]) << "n = " << n;
+  }
+  EXPECT_TRUE(rng1 == rng4);
+}
+
+}  // namespace
+
+TEST(ProbDistributionsBulkRng, uniform_threads) {
+  expect_thread_independent([](stan::math::philox4x32& rng) {
+    return stan::math::uniform_bulk_rng(-1.0, 2.0, N, rng);
+  });
+}
+
+TEST(ProbDistributionsBulkRng, normal_threads) {
+  expect_thread_independent([](stan::math::philox4x32& rng) {
+    return stan::math::normal_bulk_rng(1.0, 3.0, N, rng);
+  });
+}
+
+TEST(ProbDistributionsBulkRng, gamma_threads) {
+  std::vector<double> alpha(N);
+  for (std::size_t n = 0; n < N; ++n) {
+    alpha[n] = 0.25 + (n % 7);
+  }
+  expect_thread_independent([&](stan::math::philox4x32& rng) {
+    return stan::math::gamma_bulk_rng(alpha, 2.0, N, rng);
+  });
+}
+
+TEST(ProbDistributionsBulkRng, poisson_threads) {
+  expect_thread_independent([](stan::math::philox4x32& rng) {
+    return stan::math::poisson_bulk_rng(4.5, N, rng);
+  });
+}
+
+TEST(ProbDistributionsBulkRng, binomial_threads) {
+  expect_thread_independent([](stan::math::philox4x32& rng) {
+    return stan::math::binomial_bulk_rng(30, 0.2, N, rng);
+  });
+}
+
+#endif
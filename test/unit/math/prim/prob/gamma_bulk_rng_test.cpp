@@ -0,0 +1,51 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/math/prim/prob/util.hpp>
+#include <gtest/gtest.h>
+#include <boost/math/distributions.hpp>
+#include <limits>
+#include <vector>
+
+TEST(ProbDistributionsGammaBulkRng, error_check) {
+  using stan::math::gamma_bulk_rng;
+  stan::math::philox4x32 rng;
+  std::vector<double> alpha(3, 2.0);
+  EXPECT_NO_THROW(gamma_bulk_rng(2.0, 3.0, 5, rng));
+  EXPECT_NO_THROW(gamma_bulk_rng(alpha, 3.0, 3, rng));
+  EXPECT_THROW(gamma_bulk_rng(-2.0, 3.0, 5, rng), std::domain_error);
+  EXPECT_THROW(gamma_bulk_rng(2.0, 0.0, 5, rng), std::domain_error);
+  EXPECT_THROW(gamma_bulk_rng(alpha, 3.0, 4, rng), std::invalid_argument);
+}
+
+TEST(ProbDistributionsGammaBulkRng, reproducible) {
+  using stan::math::gamma_bulk_rng;
+  stan::math::philox4x32 rng1(8, 2);
+  stan::math::philox4x32 rng2(8, 2);
+  Eigen::VectorXd x1 = gamma_bulk_rng(0.5, 2.0, 5, rng1);
+  Eigen::VectorXd x2 = gamma_bulk_rng(0.5, 2.0, 5, rng2);
+  for (int n = 0; n < 5; ++n) {
+    EXPECT_EQ(x1(n), x2(n));
+  }
+  EXPECT_TRUE(rng1 == rng2);
+  EXPECT_NE(x1(0), gamma_bulk_rng(0.5, 2.0, 5, rng1)(0));
+}
+
+TEST(ProbDistributionsGammaBulkRng, chiSquareGoodnessFitTest) {
+  for (double alpha : {0.5, 3.0}) {
+    stan::math::philox4x32 rng(42, 0);
+    int N = 10000;
+    int K = stan::math::round(2 * std::pow(N, 0.4));
+
+    Eigen::VectorXd draws = stan::math::gamma_bulk_rng(alpha, 2.0, N, rng);
+    std::vector<double> samples(draws.data(), draws.data() + N);
+
+    boost::math::gamma_distribution<> dist(alpha, 0.5);
+    std::vector<double> quantiles;
+    for (int i = 1; i < K; ++i) {
+      double frac = static_cast<double>(i) / K;
+      quantiles.push_back(quantile(dist, frac));
+    }
+    quantiles.push_back(std::numeric_limits<double>::max());
+
+    assert_matches_quantiles(samples, quantiles, 1e-6);
+  }
+}
@@ -0,0 +1,59 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/math/prim/prob/util.hpp>
+#include <gtest/gtest.h>
+#include <boost/math/distributions.hpp>
+#include <limits>
+#include <vector>
+
+TEST(ProbDistributionsNormalBulkRng, error_check) {
+  using stan::math::normal_bulk_rng;
+  stan::math::philox4x32 rng;
+  std::vector<double> mu(3, 1.0);
+  EXPECT_NO_THROW(normal_bulk_rng(10.0, 2.0, 5, rng));
+  EXPECT_NO_THROW(normal_bulk_rng(mu, 2.0, 3, rng));
+  EXPECT_THROW(normal_bulk_rng(10.0, -2.0, 5, rng), std::domain_error);
+  EXPECT_THROW(normal_bulk_rng(stan::math::INFTY, 2.0, 5, rng),
+               std::domain_error);
+  EXPECT_THROW(normal_bulk_rng(mu, 2.0, 4, rng), std::invalid_argument);
+}
+
+TEST(ProbDistributionsNormalBulkRng, reproducible) {
+  using stan::math::normal_bulk_rng;
+  stan::math::philox4x32 rng1(123, 4);
+  stan::math::philox4x32 rng2(123, 4);
+  Eigen::VectorXd x1 = normal_bulk_rng(0.0, 1.0, 7, rng1);
+  Eigen::VectorXd x2 = normal_bulk_rng(0.0, 1.0, 8, rng2);
+  for (int n = 0; n < 7; ++n) {
+    EXPECT_EQ(x1(n), x2(n));
+  }
+  EXPECT_TRUE(rng1 == rng2);
+  Eigen::VectorXd y = normal_bulk_rng(0.0, 1.0, 7, rng1);
+  EXPECT_NE(x1(0), y(0));
+
+  std::vector<double> mu = {-1, 0, 1};
+  std::vector<double> sigma = {1, 2, 3};
+  stan::math::philox4x32 rng3(123, 4);
+  Eigen::VectorXd z = normal_bulk_rng(mu, sigma, 3, rng3);
+  for (int n = 0; n < 3; ++n) {
+    EXPECT_FLOAT_EQ(mu[n] + sigma[n] * x1(n), z(n));
+  }
+}
+
+TEST(ProbDistributionsNormalBulkRng, chiSquareGoodnessFitTest) {
+  stan::math::philox4x32 rng(42, 0);
+  int N = 10001;
+  int K = stan::math::round(2 * std::pow(N, 0.4));
+
+  Eigen::VectorXd draws = stan::math::normal_bulk_rng(2.0, 1.5, N, rng);
+  std::vector<double> samples(draws.data(), draws.data() + N);
+
+  boost::math::normal_distribution<> dist(2.0, 1.5);
+  std::vector<double> quantiles;
+  for (int i = 1; i < K; ++i) {
+    double frac = static_cast<double>(i) / K;
+    quantiles.push_back(quantile(dist, frac));
+  }
+  quantiles.push_back(std::numeric_limits<double>::max());
+
+  assert_matches_quantiles(samples, quantiles, 1e-6);
+}
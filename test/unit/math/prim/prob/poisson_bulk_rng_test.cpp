@@ -0,0 +1,53 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/math/prim/prob/util.hpp>
+#include <gtest/gtest.h>
+#include <boost/math/distributions.hpp>
+#include <algorithm>
+#include <vector>
+
+TEST(ProbDistributionsPoissonBulkRng, error_check) {
+  using stan::math::poisson_bulk_rng;
+  stan::math::philox4x32 rng;
+  std::vector<double> lambda(3, 2.0);
+  EXPECT_NO_THROW(poisson_bulk_rng(2.0, 5, rng));
+  EXPECT_NO_THROW(poisson_bulk_rng(lambda, 3, rng));
+  EXPECT_THROW(poisson_bulk_rng(-2.0, 5, rng), std::domain_error);
+  EXPECT_THROW(poisson_bulk_rng(stan::math::POISSON_MAX_RATE, 5, rng),
+               std::domain_error);
+  EXPECT_THROW(poisson_bulk_rng(lambda, 4, rng), std::invalid_argument);
+}
+
+TEST(ProbDistributionsPoissonBulkRng, reproducible) {
+  using stan::math::poisson_bulk_rng;
+  stan::math::philox4x32 rng1(8, 2);
+  stan::math::philox4x32 rng2(8, 2);
+  std::vector<int> x1 = poisson_bulk_rng(100.0, 5, rng1);
+  std::vector<int> x2 = poisson_bulk_rng(100.0, 5, rng2);
+  EXPECT_EQ(x1, x2);
+  EXPECT_TRUE(rng1 == rng2);
+}
+
+TEST(ProbDistributionsPoissonBulkRng, chiSquareGoodnessFitTest) {
+  for (double lambda : {0.7, 5.0, 50.0, 150.0}) {
+    stan::math::philox4x32 rng(42, 0);
+    int N = 10000;
+    boost::math::poisson_distribution<> dist(lambda);
+    // bins [0, lo], lo + 1, ..., hi - 1, [hi, infinity)
+    int lo = static_cast<int>(quantile(dist, 0.01));
+    int hi = static_cast<int>(quantile(dist, 0.99));
+
+    std::vector<int> draws = stan::math::poisson_bulk_rng(lambda, N, rng);
+    std::vector<int> counts(hi - lo + 1, 0);
+    for (int x : draws) {
+      ++counts[std::min(std::max(x, lo), hi) - lo];
+    }
+    std::vector<double> expected;
+    expected.push_back(N * cdf(dist, lo));
+    for (int x = lo + 1; x < hi; ++x) {
+      expected.push_back(N * pdf(dist, x));
+    }
+    expected.push_back(N * cdf(complement(dist, hi - 1)));
+
+    assert_chi_squared(counts, expected, 1e-6);
+  }
+}
@@ -0,0 +1,51 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/math/prim/prob/util.hpp>
+#include <gtest/gtest.h>
+#include <boost/math/distributions.hpp>
+#include <limits>
+#include <vector>
+
+TEST(ProbDistributionsUniformBulkRng, error_check) {
+  using stan::math::uniform_bulk_rng;
+  stan::math::philox4x32 rng;
+  std::vector<double> beta(3, 4.0);
+  EXPECT_NO_THROW(uniform_bulk_rng(1.0, 2.0, 5, rng));
+  EXPECT_NO_THROW(uniform_bulk_rng(1.0, beta, 3, rng));
+  EXPECT_THROW(uniform_bulk_rng(2.0, 1.0, 5, rng), std::domain_error);
+  EXPECT_THROW(uniform_bulk_rng(1.0, stan::math::INFTY, 5, rng),
+               std::domain_error);
+  EXPECT_THROW(uniform_bulk_rng(1.0, beta, 2, rng), std::invalid_argument);
+}
+
+TEST(ProbDistributionsUniformBulkRng, reproducible) {
+  using stan::math::uniform_bulk_rng;
+  stan::math::philox4x32 rng1(5, 1);
+  stan::math::philox4x32 rng2(5, 1);
+  Eigen::VectorXd x1 = uniform_bulk_rng(-1.0, 1.0, 5, rng1);
+  Eigen::VectorXd x2 = uniform_bulk_rng(-1.0, 1.0, 6, rng2);
+  for (int n = 0; n < 5; ++n) {
+    EXPECT_EQ(x1(n), x2(n));
+    EXPECT_GE(x1(n), -1.0);
+    EXPECT_LT(x1(n), 1.0);
+  }
+  EXPECT_TRUE(rng1 == rng2);
+}
+
+TEST(ProbDistributionsUniformBulkRng, chiSquareGoodnessFitTest) {
+  stan::math::philox4x32 rng(42, 0);
+  int N = 10000;
+  int K = stan::math::round(2 * std::pow(N, 0.4));
+
+  Eigen::VectorXd draws = stan::math::uniform_bulk_rng(1.0, 3.5, N, rng);
+  std::vector<double> samples(draws.data(), draws.data() + N);
+
+  boost::math::uniform_distribution<> dist(1.0, 3.5);
+  std::vector<double> quantiles;
+  for (int i = 1; i < K; ++i) {
+    double frac = static_cast<double>(i) / K;
+    quantiles.push_back(quantile(dist, frac));
+  }
+  quantiles.push_back(std::numeric_limits<double>::max());
+
+  assert_matches_quantiles(samples, quantiles, 1e-6);
+}
@@ -0,0 +1,40 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/fun/corr_constrain_test_util.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+auto cholesky_corr = [](const auto& y, int K, auto&... lp) {
+  return stan::math::cholesky_corr_constrain(y, K, lp...);
+};
+
+}  // namespace
+
+TEST(AgradRevMatrix, cholesky_corr_constrain_nodes) {
+  corr_constrain_test::expect_nodes(cholesky_corr);
+}
+
+TEST(AgradRevMatrix, cholesky_corr_constrain_values) {
+  corr_constrain_test::expect_values(cholesky_corr);
+}
+
+TEST(AgradRevMatrix, cholesky_corr_constrain_gradient) {
+  corr_constrain_test::expect_gradient(cholesky_corr);
+}
+
+TEST(AgradRevMatrix, cholesky_corr_constrain_structure) {
+  using stan::math::var;
+  for (int K : {1, 2, 4}) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y
+        = corr_constrain_test::free_vector(K);
+    Eigen::MatrixXd L = stan::math::value_of(cholesky_corr(y, K));
+    for (int i = 0; i < K; ++i) {
+      EXPECT_GT(L(i, i), 0) << "K = " << K;
+      EXPECT_FLOAT_EQ(1, L.row(i).squaredNorm()) << "K = " << K;
+      for (int j = i + 1; j < K; ++j) {
+        EXPECT_EQ(0, L(i, j)) << "K = " << K;
+      }
+    }
+  }
+  stan::math::recover_memory();
+}
@@ -0,0 +1,107 @@
+#ifndef TEST_UNIT_MATH_REV_FUN_CORR_CONSTRAIN_TEST_UTIL_HPP
+#define TEST_UNIT_MATH_REV_FUN_CORR_CONSTRAIN_TEST_UTIL_HPP
+
+#include <stan/math/rev.hpp>
+#include <test/unit/math/expect_near_rel.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+// Shared checks of the reverse mode transforms from K * (K - 1) / 2 free
+// parameters to a K x K matrix. f(y, K) and f(y, K, lp) call the
+// transform without and with the log Jacobian determinant.
+namespace corr_constrain_test {
+
+inline std::size_t stack_size() {
+  return stan::math::ChainableStack::instance_->var_stack_.size();
+}
+
+inline Eigen::VectorXd free_vector(int K) {
+  Eigen::VectorXd y(K * (K - 1) / 2);
+  for (int i = 0; i < y.size(); ++i) {
+    y(i) = 0.3 * (i % 5) - 0.7;
+  }
+  return y;
+}
+
+// weighted sum of the entries of the transformed matrix plus the log
+// Jacobian determinant, so that all partials of the transform are used
+template <typename F, typename T>
+T weighted_constrain(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& y,
+                     int K) {
+  T lp(0);
+  Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> x = f(y, K, lp);
+  T sum(lp);
+  for (int j = 0; j < K; ++j) {
+    for (int i = 0; i < K; ++i) {
+      sum += (1.0 + 0.1 * i - 0.2 * j) * x(i, j);
+    }
+  }
+  return sum;
+}
+
+// the transform is a single node on the stack, with the log Jacobian it
+// adds the transform, the log Jacobian and the increment of lp
+template <typename F>
+void expect_nodes(const F& f) {
+  using stan::math::var;
+  for (int K : {1, 2, 4}) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y = free_vector(K);
+    std::size_t before = stack_size();
+    f(y, K);
+    EXPECT_EQ(before + 1, stack_size()) << "K = " << K;
+
+    var lp(0);
+    before = stack_size();
+    f(y, K, lp);
+    EXPECT_EQ(before + 3, stack_size()) << "K = " << K;
+  }
+  stan::math::recover_memory();
+}
+
+// the values match those of the prim transform
+template <typename F>
+void expect_values(const F& f) {
+  using stan::math::var;
+  for (int K : {1, 2, 4}) {
+    Eigen::VectorXd y = free_vector(K);
+    double lp_d = 0;
+    Eigen::MatrixXd x_d = f(y, K, lp_d);
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y_v = y;
+    var lp = 0;
+    Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> x = f(y_v, K, lp);
+    std::string msg = "K = " + std::to_string(K);
+    stan::test::expect_near_rel(msg, x_d, stan::math::value_of(x));
+    stan::test::expect_near_rel(msg, lp_d, lp.val());
+    x = f(y_v, K);
+    stan::test::expect_near_rel(msg, x_d, stan::math::value_of(x));
+  }
+  stan::math::recover_memory();
+}
+
+// the gradient matches finite differences
+template <typename F>
+void expect_gradient(const F& f) {
+  using stan::math::var;
+  for (int K : {1, 2, 4}) {
+    Eigen::VectorXd y = free_vector(K);
+    double fx_fd;
+    Eigen::VectorXd grad_fd;
+    stan::math::finite_diff_gradient_auto(
+        [&f, K](const Eigen::VectorXd& y) {
+          return weighted_constrain(f, y, K);
+        },
+        y, fx_fd, grad_fd);
+
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y_v = y;
+    var fx = weighted_constrain(f, y_v, K);
+    fx.grad();
+    std::string msg = "K = " + std::to_string(K);
+    stan::test::expect_near_rel(msg, fx_fd, fx.val());
+    stan::test::expect_near_rel(msg, grad_fd, y_v.adj().eval());
+    stan::math::recover_memory();
+  }
+}
+
+}  // namespace corr_constrain_test
+
+#endif
@@ -0,0 +1,40 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/fun/corr_constrain_test_util.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+auto corr_matrix = [](const auto& y, int K, auto&... lp) {
+  return stan::math::corr_matrix_constrain(y, K, lp...);
+};
+
+}  // namespace
+
+TEST(AgradRevMatrix, corr_matrix_constrain_nodes) {
+  corr_constrain_test::expect_nodes(corr_matrix);
+}
+
+TEST(AgradRevMatrix, corr_matrix_constrain_values) {
+  corr_constrain_test::expect_values(corr_matrix);
+}
+
+TEST(AgradRevMatrix, corr_matrix_constrain_gradient) {
+  corr_constrain_test::expect_gradient(corr_matrix);
+}
+
+TEST(AgradRevMatrix, corr_matrix_constrain_structure) {
+  using stan::math::var;
+  for (int K : {1, 2, 4}) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y
+        = corr_constrain_test::free_vector(K);
+    Eigen::MatrixXd Sigma = stan::math::value_of(corr_matrix(y, K));
+    for (int i = 0; i < K; ++i) {
+      EXPECT_FLOAT_EQ(1, Sigma(i, i)) << "K = " << K;
+      for (int j = i + 1; j < K; ++j) {
+        EXPECT_FLOAT_EQ(Sigma(i, j), Sigma(j, i)) << "K = " << K;
+        EXPECT_LT(std::fabs(Sigma(i, j)), 1) << "K = " << K;
+      }
+    }
+  }
+  stan::math::recover_memory();
+}
@@ -212,6 +212,28 @@ TEST_F(algebra_solver_non_linear_eq_test, powell) {
   }
 }
 
+TEST_F(algebra_solver_non_linear_eq_test, powell_combined_adjoint) {
+  using stan::math::var;
+  bool is_newton = false;
+  Eigen::VectorXd w(n_x);
+  w << 0.5, -2, 3;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> y = y_dbl;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> theta
+      = non_linear_eq_test(non_linear_eq_functor(), y, is_newton);
+
+  var lp = 0;
+  for (int k = 0; k < n_x; k++)
+    lp += w(k) * theta(k);
+
+  AVEC y_vec = createAVEC(y(0), y(1), y(2));
+  VEC g;
+  lp.grad(y_vec, g);
+
+  Eigen::VectorXd g_expected = J.transpose() * w;
+  for (int i = 0; i < n_y; i++)
+    EXPECT_NEAR(g_expected(i), g[i], err);
+}
+
 TEST_F(algebra_solver_non_linear_eq_test, powell_dbl) {
   bool is_newton = false;
   Eigen::VectorXd theta
@@ -589,3 +611,92 @@ TEST_F(degenerate_eq_test, newton_guess_saddle_point_dbl) {
                                          y_scale, dat, dat_int),
                    std::runtime_error, msg);
 }
+
+//////////////////////////////////////////////////////////////////////////
+// Tests for warm starts.
+
+template <typename Solve>
+void warm_start_test(const Solve& solve) {
+  using stan::math::algebra_solver_warm_start;
+  using stan::math::var;
+  using F = counting_non_linear_eq_functor;
+  algebra_solver_warm_start<F>::clear();
+
+  Eigen::VectorXd x(3);
+  x << -3, -3, -3;
+  Eigen::VectorXd y(3);
+  y << 4, 6, 3;
+  Eigen::VectorXd y_near(3);
+  y_near << 4.01, 6.02, 2.99;
+
+  // a negative id does not touch the cache
+  solve(x, y, -1);
+  F::n_eval() = 0;
+  Eigen::VectorXd theta_cold = solve(x, y_near, -1);
+  int n_eval_cold = F::n_eval();
+
+  solve(x, y, 0);
+  F::n_eval() = 0;
+  Eigen::VectorXd theta_warm = solve(x, y_near, 0);
+  int n_eval_warm = F::n_eval();
+
+  EXPECT_LT(n_eval_warm, n_eval_cold);
+  for (int i = 0; i < 3; ++i)
+    EXPECT_NEAR(theta_cold(i), theta_warm(i), 1e-5);
+  EXPECT_NEAR(-y_near(0), theta_warm(0), 1e-5);
+  EXPECT_NEAR(-y_near(1), theta_warm(1), 1e-5);
+  EXPECT_NEAR(y_near(2), theta_warm(2), 1e-5);
+
+  // the cache is keyed by id
+  EXPECT_EQ(0, algebra_solver_warm_start<F>::get(1).x_.size());
+  EXPECT_EQ(3, algebra_solver_warm_start<F>::get(0).x_.size());
+  algebra_solver_warm_start<F>::clear();
+}
+
+TEST(algebra_solver_warm_start, newton) {
+  std::vector<double> dat;
+  std::vector<int> dat_int;
+  warm_start_test([&](const Eigen::VectorXd& x, const Eigen::VectorXd& y,
+                      int id) {
+    return stan::math::algebra_solver_newton(counting_non_linear_eq_functor(),
+                                             x, y, dat, dat_int, nullptr,
+                                             1e-3, 1e-6, 200, id);
+  });
+}
+
+TEST(algebra_solver_warm_start, powell) {
+  std::vector<double> dat;
+  std::vector<int> dat_int;
+  warm_start_test([&](const Eigen::VectorXd& x, const Eigen::VectorXd& y,
+                      int id) {
+    return stan::math::algebra_solver_powell(counting_non_linear_eq_functor(),
+                                             x, y, dat, dat_int, nullptr,
+                                             1e-10, 1e-6, 1000, id);
+  });
+}
+
+TEST(algebra_solver_warm_start, newton_gradient) {
+  using stan::math::var;
+  using F = counting_non_linear_eq_functor;
+  stan::math::algebra_solver_warm_start<F>::clear();
+  std::vector<double> dat;
+  std::vector<int> dat_int;
+  Eigen::VectorXd x(3);
+  x << -3, -3, -3;
+
+  for (int n = 0; n < 2; ++n) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y(3);
+    y << 4 + 0.01 * n, 6, 3;
+    Eigen::Matrix<var, Eigen::Dynamic, 1> theta
+        = stan::math::algebra_solver_newton(F(), x, y, dat, dat_int, nullptr,
+                                            1e-10, 1e-12, 200, 0);
+    AVEC y_vec = createAVEC(y(0), y(1), y(2));
+    VEC g;
+    theta(0).grad(y_vec, g);
+    EXPECT_NEAR(-1, g[0], 1e-8);
+    EXPECT_NEAR(0, g[1], 1e-8);
+    EXPECT_NEAR(0, g[2], 1e-8);
+    stan::math::recover_memory();
+  }
+  stan::math::algebra_solver_warm_start<F>::clear();
+}
@@ -893,3 +893,21 @@ TEST(StanMath_integrate_1d_rev, TestWeibull) {
   EXPECT_FLOAT_EQ(1, 1 + g[0]);
   EXPECT_FLOAT_EQ(1, 1 + g[1]);
 }
+
+TEST(StanMath_integrate_1d_rev, gradient_of_f) {
+  std::vector<double> theta = {0.5, 1.75, 3.9};
+  std::vector<double> x_r = {2.5, 3.0};
+  Eigen::VectorXd fx_grad = stan::math::value_and_gradient_of_f(
+      f3{}, 0.7, 0.0, theta, x_r, {}, msgs);
+  EXPECT_FLOAT_EQ(std::exp(0.7) + std::pow(0.5, 2.5) + 2 * std::pow(1.75, 3.0)
+                      + 2 * 3.9,
+                  fx_grad(0));
+  EXPECT_FLOAT_EQ(2.5 * std::pow(0.5, 1.5), fx_grad(1));
+  EXPECT_FLOAT_EQ(2 * 3.0 * std::pow(1.75, 2.0), fx_grad(2));
+  EXPECT_FLOAT_EQ(2, fx_grad(3));
+  for (size_t n = 0; n < theta.size(); ++n) {
+    double gradient
+        = stan::math::gradient_of_f(f3{}, 0.7, 0.0, theta, x_r, {}, n, msgs);
+    EXPECT_FLOAT_EQ(fx_grad(n + 1), gradient);
+  }
+}
@@ -73,6 +73,34 @@ TEST(StanMathOde_integrate_ode_bdf, harmonic_oscillator) {
   sho_data_test(-1.0);
 }
 
+TEST(StanMathOde_integrate_ode_bdf, harmonic_oscillator_inplace) {
+  harm_osc_ode_inplace_fun harm_osc;
+  EXPECT_TRUE(
+      stan::math::has_ode_rhs_inplace<harm_osc_ode_inplace_fun>::value);
+  EXPECT_FALSE(stan::math::has_ode_rhs_inplace<harm_osc_ode_fun>::value);
+
+  std::vector<double> theta{0.15};
+  std::vector<double> y0{1.0, 0.0};
+  double t0 = 0.0;
+
+  std::vector<double> ts;
+  for (int i = 0; i < 100; i++)
+    ts.push_back(t0 + 0.1 * (i + 1));
+
+  std::vector<double> x;
+  std::vector<int> x_int;
+
+  std::vector<std::vector<double> > ode_res_vd = stan::math::integrate_ode_bdf(
+      harm_osc, y0, t0, ts, theta, x, x_int, 0, 1e-8, 1e-10, 1e6);
+  EXPECT_GT(harm_osc.inplace_calls, 0);
+
+  EXPECT_NEAR(0.995029, ode_res_vd[0][0], 1e-5);
+  EXPECT_NEAR(-0.0990884, ode_res_vd[0][1], 1e-5);
+
+  EXPECT_NEAR(-0.421907, ode_res_vd[99][0], 1e-5);
+  EXPECT_NEAR(0.246407, ode_res_vd[99][1], 1e-5);
+}
+
 TEST(StanMathOde_integrate_ode_bdf, error_conditions) {
   using stan::math::integrate_ode_bdf;
   harm_osc_ode_data_fun harm_osc;
@@ -163,3 +163,118 @@ TEST_F(map_rect, concurrent_eval_ok_vv) {
     }
   }
 }
+
+TEST_F(map_rect, concurrent_partitioners_vv) {
+  using stan::math::map_rect_partitioner;
+  stan::math::map_rect_concurrent_settings& settings
+      = stan::math::map_rect_settings<1, hard_work>();
+
+  std::vector<double> job_costs(N);
+  for (std::size_t i = 0; i < N; i++)
+    job_costs[i] = i % 10 == 0 ? 100.0 : 1.0;
+
+  for (auto partitioner :
+       {map_rect_partitioner::automatic, map_rect_partitioner::simple,
+        map_rect_partitioner::static_split, map_rect_partitioner::affinity}) {
+    for (int grainsize : {1, 7}) {
+      for (bool use_costs : {false, true}) {
+        settings.partitioner_ = partitioner;
+        settings.grainsize_ = grainsize;
+        settings.job_costs_ = use_costs ? job_costs : std::vector<double>();
+
+        stan::math::vector_v shared_params_v
+            = stan::math::to_var(shared_params_d);
+        std::vector<stan::math::vector_v> job_params_v;
+        for (std::size_t i = 0; i < N; i++)
+          job_params_v.push_back(stan::math::to_var(job_params_d[i]));
+
+        stan::math::vector_v res = stan::math::map_rect<1, hard_work>(
+            shared_params_v, job_params_v, x_r, x_i);
+        ASSERT_EQ(2 * N, res.size());
+
+        stan::math::var sum = stan::math::sum(res);
+        sum.grad();
+        EXPECT_FLOAT_EQ(shared_params_v(0).adj(), 3.0 * N);
+        EXPECT_FLOAT_EQ(shared_params_v(1).adj(), N);
+        for (std::size_t i = 0; i < N; i++) {
+          EXPECT_FLOAT_EQ(
+              res(2 * i).val(),
+              job_params_d[i](0) * job_params_d[i](0) + shared_params_d(0));
+          EXPECT_FLOAT_EQ(job_params_v[i](0).adj(),
+                          2.0 * job_params_d[i](0)
+                              + x_r[i][0] * job_params_d[i](1));
+          EXPECT_FLOAT_EQ(job_params_v[i](1).adj(),
+                          x_r[i][0] * job_params_d[i](0));
+        }
+        stan::math::recover_memory();
+      }
+    }
+  }
+  settings = stan::math::map_rect_concurrent_settings();
+}
+
+TEST_F(map_rect, concurrent_settings_errors) {
+  stan::math::map_rect_concurrent_settings& settings
+      = stan::math::map_rect_settings<2, hard_work>();
+
+  settings.grainsize_ = 0;
+  EXPECT_THROW((stan::math::map_rect<2, hard_work>(shared_params_d,
+                                                   job_params_d, x_r, x_i)),
+               std::domain_error);
+
+  settings.grainsize_ = 1;
+  settings.job_costs_ = std::vector<double>(N, 1.0);
+  settings.job_costs_[3] = -1.0;
+  EXPECT_THROW((stan::math::map_rect<2, hard_work>(shared_params_d,
+                                                   job_params_d, x_r, x_i)),
+               std::domain_error);
+
+  // costs which do not match the number of jobs are ignored
+  settings.job_costs_ = std::vector<double>(N + 1, -1.0);
+  EXPECT_NO_THROW((stan::math::map_rect<2, hard_work>(shared_params_d,
+                                                      job_params_d, x_r, x_i)));
+  settings = stan::math::map_rect_concurrent_settings();
+}
+
+TEST_F(map_rect, concurrent_ragged_outputs_vv) {
+  // hard_work appends x_i[0] zero outputs to the two outputs of a job
+  for (std::size_t i = 0; i < N; i++)
+    x_i[i][0] = i % 3;
+
+  stan::math::vector_v shared_params_v = stan::math::to_var(shared_params_d);
+  std::vector<stan::math::vector_v> job_params_v;
+  for (std::size_t i = 0; i < N; i++)
+    job_params_v.push_back(stan::math::to_var(job_params_d[i]));
+
+  const std::size_t stack_size
+      = stan::math::ChainableStack::instance_->var_stack_.size();
+  stan::math::vector_v res = stan::math::map_rect<3, hard_work>(
+      shared_params_v, job_params_v, x_r, x_i);
+  // all outputs are chained by a single vari
+  EXPECT_EQ(stack_size + 1,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+
+  for (std::size_t i = 0, j = 0; i < N; i++) {
+    EXPECT_FLOAT_EQ(
+        res(j).val(),
+        job_params_d[i](0) * job_params_d[i](0) + shared_params_d(0));
+
+    stan::math::set_zero_all_adjoints();
+    res(j + 1).grad();
+    EXPECT_FLOAT_EQ(shared_params_v(0).adj(), 2.0);
+    EXPECT_FLOAT_EQ(shared_params_v(1).adj(), 1.0);
+    EXPECT_FLOAT_EQ(job_params_v[i](0).adj(), x_r[i][0] * job_params_d[i](1));
+    EXPECT_FLOAT_EQ(job_params_v[i](1).adj(), x_r[i][0] * job_params_d[i](0));
+
+    for (int k = 0; k < x_i[i][0]; k++) {
+      EXPECT_FLOAT_EQ(res(j + 2 + k).val(), 0.0);
+      stan::math::set_zero_all_adjoints();
+      res(j + 2 + k).grad();
+      EXPECT_FLOAT_EQ(shared_params_v(0).adj(), 0.0);
+      EXPECT_FLOAT_EQ(job_params_v[i](0).adj(), 0.0);
+    }
+    j += 2 + x_i[i][0];
+  }
+  EXPECT_EQ(res.size(), 2 * N + N / 3 * 3);
+  stan::math::recover_memory();
+}
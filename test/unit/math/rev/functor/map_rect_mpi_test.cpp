@@ -15,6 +15,21 @@
 STAN_REGISTER_MAP_RECT(0, hard_work)
 STAN_REGISTER_MAP_RECT(1, faulty_functor)
 STAN_REGISTER_MAP_RECT(2, faulty_functor)
+STAN_REGISTER_MAP_RECT(3, hard_work)
+STAN_REGISTER_MAP_RECT_SUM(4, hard_work)
+
+// the settings of a call site apply to the local jobs of each process
+// and must hence be set up in all processes
+static const bool hard_work_3_settings = []() {
+  stan::math::map_rect_concurrent_settings& settings
+      = stan::math::map_rect_settings<3, hard_work>();
+  settings.partitioner_ = stan::math::map_rect_partitioner::affinity;
+  settings.grainsize_ = 2;
+  settings.job_costs_ = std::vector<double>(10, 1.0);
+  settings.job_costs_[7] = 20.0;
+  stan::math::map_rect_mpi_call_settings<3, hard_work>().pipeline_rounds_ = 2;
+  return true;
+}();
 
 struct MpiJob : public ::testing::Test {
   stan::math::vector_d shared_params_d;
@@ -173,4 +188,76 @@ TEST_F(MpiJob, always_faulty_functor_dv) {
                    std::domain_error, "MPI error on first evaluation.");
 }
 
+TEST_F(MpiJob, hard_work_settings_vv) {
+  // the second run is pipelined over two rounds
+  for (int run = 0; run < 2; ++run) {
+    stan::math::set_zero_all_adjoints();
+    stan::math::vector_v result_mpi = stan::math::map_rect<3, hard_work>(
+        shared_params_v, job_params_v, x_r, x_i, 0);
+    stan::math::vector_v result_concurrent
+        = stan::math::internal::map_rect_concurrent<3, hard_work>(
+            shared_params_v2, job_params_v2, x_r, x_i, 0);
+
+    ASSERT_EQ(result_mpi.rows(), result_concurrent.rows());
+    for (int ij = 0; ij < result_mpi.rows(); ++ij) {
+      EXPECT_DOUBLE_EQ(result_mpi(ij).val(), result_concurrent(ij).val());
+    }
+
+    stan::math::var sum_mpi = stan::math::sum(result_mpi);
+    stan::math::var sum_concurrent = stan::math::sum(result_concurrent);
+    sum_mpi.grad();
+    std::vector<double> grad_mpi;
+    for (int k = 0; k < 2; ++k) {
+      grad_mpi.push_back(shared_params_v(k).adj());
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+      for (int k = 0; k < 2; ++k) {
+        grad_mpi.push_back(job_params_v[i](k).adj());
+      }
+    }
+
+    stan::math::set_zero_all_adjoints();
+    sum_concurrent.grad();
+    for (int k = 0; k < 2; ++k) {
+      EXPECT_DOUBLE_EQ(grad_mpi[k], shared_params_v2(k).adj());
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+      for (int k = 0; k < 2; ++k) {
+        EXPECT_DOUBLE_EQ(grad_mpi[2 + 2 * i + k], job_params_v2[i](k).adj());
+      }
+    }
+  }
+  stan::math::recover_memory();
+}
+
+TEST_F(MpiJob, hard_work_sum_vv) {
+  stan::math::vector_v result_mpi = stan::math::map_rect_sum<4, hard_work>(
+      shared_params_v, job_params_v, x_r, x_i, 0);
+  stan::math::vector_v result_concurrent
+      = stan::math::internal::map_rect_concurrent<4, hard_work>(
+          shared_params_v2, job_params_v2, x_r, x_i, 0);
+  ASSERT_EQ(N, result_mpi.rows());
+
+  for (std::size_t i = 0, offset = 0; i < N; offset += 2 + x_i[i][0], ++i) {
+    stan::math::var sum_concurrent = stan::math::sum(
+        result_concurrent.segment(offset, 2 + x_i[i][0]));
+    EXPECT_DOUBLE_EQ(sum_concurrent.val(), result_mpi(i).val());
+
+    stan::math::set_zero_all_adjoints();
+    result_mpi(i).grad();
+    std::vector<double> grad_mpi;
+    for (int k = 0; k < 2; ++k) {
+      grad_mpi.push_back(shared_params_v(k).adj());
+      grad_mpi.push_back(job_params_v[i](k).adj());
+    }
+    stan::math::set_zero_all_adjoints();
+    sum_concurrent.grad();
+    for (int k = 0; k < 2; ++k) {
+      EXPECT_DOUBLE_EQ(shared_params_v2(k).adj(), grad_mpi[2 * k]);
+      EXPECT_DOUBLE_EQ(job_params_v2[i](k).adj(), grad_mpi[2 * k + 1]);
+    }
+  }
+  stan::math::recover_memory();
+}
+
 #endif
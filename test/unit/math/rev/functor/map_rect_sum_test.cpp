@@ -0,0 +1,115 @@
+// the tests here check map_rect_sum with the concurrent map_rect, we
+// enforce that STAN_MPI is NOT defined
+
+#ifdef STAN_MPI
+#undef STAN_MPI
+#endif
+
+#include <gtest/gtest.h>
+#include <stan/math/rev.hpp>
+
+#include <test/unit/math/prim/functor/hard_work.hpp>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+
+#include <vector>
+
+STAN_REGISTER_MAP_RECT_SUM(0, hard_work)
+STAN_REGISTER_MAP_RECT(1, hard_work)
+
+struct map_rect_sum : public ::testing::Test {
+  Eigen::VectorXd shared_params_d;
+  std::vector<Eigen::VectorXd> job_params_d;
+  std::vector<std::vector<double>> x_r;
+  std::vector<std::vector<int>> x_i;
+  const std::size_t N = 50;
+
+  virtual void SetUp() {
+    set_n_threads(4);
+    shared_params_d.resize(2);
+    shared_params_d << 2, -1.5;
+
+    for (std::size_t n = 0; n != N; ++n) {
+      Eigen::VectorXd job_d(2);
+      job_d << 0.5 * n, n * n;
+      job_params_d.push_back(job_d);
+      x_r.push_back(std::vector<double>(1, 0.1 * n));
+      // ragged outputs
+      x_i.push_back(std::vector<int>(1, n % 3));
+    }
+  }
+};
+
+TEST_F(map_rect_sum, sums_dd) {
+  Eigen::VectorXd res = stan::math::map_rect_sum<0, hard_work>(
+      shared_params_d, job_params_d, x_r, x_i);
+  ASSERT_EQ(N, res.size());
+  for (std::size_t i = 0; i < N; ++i) {
+    EXPECT_FLOAT_EQ(
+        stan::math::sum(
+            hard_work()(shared_params_d, job_params_d[i], x_r[i], x_i[i])),
+        res(i));
+  }
+}
+
+TEST_F(map_rect_sum, sums_vv) {
+  using stan::math::var;
+  using stan::math::vector_v;
+
+  vector_v shared_params_v = stan::math::to_var(shared_params_d);
+  std::vector<vector_v> job_params_v;
+  for (std::size_t i = 0; i < N; ++i) {
+    job_params_v.push_back(stan::math::to_var(job_params_d[i]));
+  }
+  const std::size_t num_varis
+      = stan::math::ChainableStack::instance_->var_stack_.size();
+
+  vector_v res = stan::math::map_rect_sum<0, hard_work>(
+      shared_params_v, job_params_v, x_r, x_i);
+  ASSERT_EQ(N, res.size());
+
+  // a single chaining vari and one output per job
+  EXPECT_EQ(num_varis + 1,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  EXPECT_EQ(N - 1,
+            stan::math::ChainableStack::instance_->var_nochain_stack_.size());
+
+  vector_v shared_params_ref = stan::math::to_var(shared_params_d);
+  std::vector<vector_v> job_params_ref;
+  for (std::size_t i = 0; i < N; ++i) {
+    job_params_ref.push_back(stan::math::to_var(job_params_d[i]));
+  }
+  vector_v res_ref = stan::math::map_rect<1, hard_work>(
+      shared_params_ref, job_params_ref, x_r, x_i);
+
+  for (std::size_t i = 0, offset = 0; i < N; offset += 2 + x_i[i][0], ++i) {
+    var sum_ref = stan::math::sum(res_ref.segment(offset, 2 + x_i[i][0]));
+    EXPECT_FLOAT_EQ(sum_ref.val(), res(i).val());
+
+    stan::math::set_zero_all_adjoints();
+    res(i).grad();
+    std::vector<double> g;
+    for (int k = 0; k < 2; ++k) {
+      g.push_back(shared_params_v(k).adj());
+      g.push_back(job_params_v[i](k).adj());
+    }
+    stan::math::set_zero_all_adjoints();
+    sum_ref.grad();
+    for (int k = 0; k < 2; ++k) {
+      EXPECT_FLOAT_EQ(shared_params_ref(k).adj(), g[2 * k]);
+      EXPECT_FLOAT_EQ(job_params_ref[i](k).adj(), g[2 * k + 1]);
+    }
+  }
+  stan::math::recover_memory();
+}
+
+TEST_F(map_rect_sum, settings_of_user_functor) {
+  stan::math::map_rect_concurrent_settings& settings
+      = stan::math::map_rect_settings<0, hard_work>();
+  settings.grainsize_ = 0;
+  stan::math::vector_v shared_params_v = stan::math::to_var(shared_params_d);
+  EXPECT_THROW((stan::math::map_rect_sum<0, hard_work>(
+                   shared_params_v, job_params_d, x_r, x_i)),
+               std::domain_error);
+  settings.grainsize_ = 1;
+  stan::math::recover_memory();
+}
@@ -0,0 +1,180 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+#include <stdexcept>
+#include <vector>
+
+struct count_lpdf {
+  template <typename T>
+  T operator()(const std::vector<int>& sub_slice, std::size_t start,
+               std::size_t end, std::ostream* msgs, const T& lambda,
+               const std::vector<int>& idata) const {
+    return stan::math::poisson_lpmf(sub_slice, lambda);
+  }
+};
+
+struct grouped_normal_lpdf {
+  template <typename T1, typename T2, typename T3>
+  stan::return_type_t<T1, T2, T3> operator()(
+      const std::vector<std::vector<T1>>& sub_slice, std::size_t start,
+      std::size_t end, std::ostream* msgs,
+      const Eigen::Matrix<T2, Eigen::Dynamic, 1>& mu, const T3& sigma,
+      const std::vector<int>& group) const {
+    stan::return_type_t<T1, T2, T3> lp = 0;
+    for (std::size_t i = start; i < end; ++i) {
+      lp += stan::math::normal_lpdf(sub_slice[i - start], mu(group[i]), sigma);
+    }
+    return lp;
+  }
+};
+
+template <typename T1, typename T2, typename T3>
+stan::return_type_t<T1, T2, T3> grouped_normal_serial(
+    const std::vector<std::vector<T1>>& y,
+    const Eigen::Matrix<T2, Eigen::Dynamic, 1>& mu, const T3& sigma,
+    const std::vector<int>& group) {
+  return grouped_normal_lpdf()(y, 0, y.size(), nullptr, mu, sigma, group);
+}
+
+TEST(StanMathRev_reduce_sum, shared_var) {
+  using stan::math::var;
+  set_n_threads(4);
+  std::vector<int> data(10000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = i % 17;
+  }
+  std::vector<int> idata;
+
+  for (int grainsize : {1, 13, 10000}) {
+    var lambda = 10.0;
+    var lp = stan::math::reduce_sum<count_lpdf>(data, grainsize, nullptr,
+                                                lambda, idata);
+    std::vector<var> x{lambda};
+    std::vector<double> g;
+    lp.grad(x, g);
+    stan::math::set_zero_all_adjoints();
+
+    var lambda_ref = 10.0;
+    var lp_ref = stan::math::poisson_lpmf(data, lambda_ref);
+    std::vector<var> x_ref{lambda_ref};
+    std::vector<double> g_ref;
+    lp_ref.grad(x_ref, g_ref);
+
+    EXPECT_FLOAT_EQ(lp_ref.val(), lp.val());
+    EXPECT_FLOAT_EQ(g_ref[0], g[0]);
+    stan::math::recover_memory();
+  }
+}
+
+TEST(StanMathRev_reduce_sum, sliced_and_shared_vars) {
+  using stan::math::var;
+  const int num_groups = 3;
+  const int N = 500;
+  std::vector<std::vector<double>> y_d(N);
+  std::vector<int> group(N);
+  for (int i = 0; i < N; ++i) {
+    group[i] = i % num_groups;
+    // ragged slices
+    for (int j = 0; j <= i % 4; ++j) {
+      y_d[i].push_back(0.1 * i - 0.3 * j);
+    }
+  }
+  Eigen::VectorXd mu_d(num_groups);
+  mu_d << -1.0, 0.5, 20.0;
+  const double sigma_d = 15.0;
+
+  auto make_vars = [&](std::vector<std::vector<var>>& y,
+                       Eigen::Matrix<var, Eigen::Dynamic, 1>& mu, var& sigma,
+                       std::vector<var>& x) {
+    y.clear();
+    x.clear();
+    for (const auto& y_i : y_d) {
+      y.emplace_back(y_i.begin(), y_i.end());
+      x.insert(x.end(), y.back().begin(), y.back().end());
+    }
+    mu = mu_d;
+    sigma = sigma_d;
+    for (int k = 0; k < num_groups; ++k) {
+      x.push_back(mu(k));
+    }
+    x.push_back(sigma);
+  };
+
+  std::vector<std::vector<var>> y_ref;
+  Eigen::Matrix<var, Eigen::Dynamic, 1> mu_ref;
+  var sigma_ref;
+  std::vector<var> x_ref;
+  make_vars(y_ref, mu_ref, sigma_ref, x_ref);
+  var lp_ref = grouped_normal_serial(y_ref, mu_ref, sigma_ref, group);
+  std::vector<double> g_ref;
+  lp_ref.grad(x_ref, g_ref);
+  const double lp_ref_val = lp_ref.val();
+  stan::math::recover_memory();
+
+  for (int grainsize : {1, 7, 1000}) {
+    std::vector<std::vector<var>> y;
+    Eigen::Matrix<var, Eigen::Dynamic, 1> mu;
+    var sigma;
+    std::vector<var> x;
+    make_vars(y, mu, sigma, x);
+    var lp = stan::math::reduce_sum<grouped_normal_lpdf>(y, grainsize, nullptr,
+                                                         mu, sigma, group);
+    // the sum enters the outer tape as a single vari
+    EXPECT_EQ(x.size() + 1, stan::math::ChainableStack::instance_->var_stack_
+                                    .size()
+                                + stan::math::ChainableStack::instance_
+                                      ->var_nochain_stack_.size());
+
+    std::vector<double> g;
+    lp.grad(x, g);
+    EXPECT_FLOAT_EQ(lp_ref_val, lp.val());
+    ASSERT_EQ(g_ref.size(), g.size());
+    for (std::size_t i = 0; i < g.size(); ++i) {
+      EXPECT_FLOAT_EQ(g_ref[i], g[i]);
+    }
+    stan::math::recover_memory();
+  }
+}
+
+TEST(StanMathRev_reduce_sum, double_sliced_var_shared_mixed) {
+  using stan::math::var;
+  std::vector<std::vector<double>> y(100, std::vector<double>(2, 1.5));
+  std::vector<int> group(100, 0);
+  Eigen::VectorXd mu(1);
+  mu << 0.25;
+  var sigma = 2.0;
+
+  var lp = stan::math::reduce_sum<grouped_normal_lpdf>(y, 3, nullptr, mu,
+                                                       sigma, group);
+  std::vector<var> x{sigma};
+  std::vector<double> g;
+  lp.grad(x, g);
+  stan::math::set_zero_all_adjoints();
+
+  var sigma_ref = 2.0;
+  var lp_ref = grouped_normal_serial(y, mu, sigma_ref, group);
+  std::vector<var> x_ref{sigma_ref};
+  std::vector<double> g_ref;
+  lp_ref.grad(x_ref, g_ref);
+
+  EXPECT_FLOAT_EQ(lp_ref.val(), lp.val());
+  EXPECT_FLOAT_EQ(g_ref[0], g[0]);
+  stan::math::recover_memory();
+}
+
+TEST(StanMathRev_reduce_sum, errors) {
+  using stan::math::var;
+  std::vector<int> data(100, 1);
+  std::vector<int> idata;
+  var lambda = -1.0;
+  EXPECT_THROW(
+      stan::math::reduce_sum<count_lpdf>(data, 5, nullptr, lambda, idata),
+      std::domain_error);
+  EXPECT_TRUE(stan::math::empty_nested());
+
+  var lambda_ok = 1.0;
+  EXPECT_THROW(
+      stan::math::reduce_sum<count_lpdf>(data, 0, nullptr, lambda_ok, idata),
+      std::domain_error);
+  stan::math::recover_memory();
+}
@@ -75,6 +75,24 @@ struct non_linear_eq_functor {
   }
 };
 
+/* non_linear_eq_functor counting its evaluations. */
+struct counting_non_linear_eq_functor {
+  static int& n_eval() {
+    static int n = 0;
+    return n;
+  }
+
+  template <typename T0, typename T1>
+  inline Eigen::Matrix<stan::return_type_t<T0, T1>, Eigen::Dynamic, 1>
+  operator()(const Eigen::Matrix<T0, Eigen::Dynamic, 1>& x,
+             const Eigen::Matrix<T1, Eigen::Dynamic, 1>& y,
+             const std::vector<double>& dat, const std::vector<int>& dat_int,
+             std::ostream* pstream__) const {
+    ++n_eval();
+    return non_linear_eq_functor()(x, y, dat, dat_int, pstream__);
+  }
+};
+
 struct non_square_eq_functor {
   template <typename T0, typename T1>
   inline Eigen::Matrix<stan::return_type_t<T0, T1>, Eigen::Dynamic, 1>
@@ -0,0 +1,224 @@
+#include <stan/math/rev.hpp>
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using stan::math::var;
+
+//  We check that the values of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsBetaProportionLogitGLM,
+     glm_matches_beta_proportion_doubles) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 0.51, 0.032, 0.92;
+  Matrix<double, Dynamic, Dynamic> x(3, 2);
+  x << -1.2, 0.46, -0.42, 2.4, 2.5, 0.27;
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, -0.2;
+  double alpha = 0.3;
+  Matrix<double, Dynamic, 1> theta = x * beta;
+  theta.array() += alpha;
+  Matrix<double, Dynamic, 1> mu = stan::math::inv_logit(theta);
+  double kappa = 4.5;
+  EXPECT_FLOAT_EQ(
+      (stan::math::beta_proportion_lpdf(y, mu, kappa)),
+      (stan::math::beta_proportion_logit_glm_lpdf(y, x, alpha, beta, kappa)));
+  EXPECT_FLOAT_EQ((stan::math::beta_proportion_lpdf<true>(y, mu, kappa)),
+                  (stan::math::beta_proportion_logit_glm_lpdf<true>(
+                      y, x, alpha, beta, kappa)));
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsBetaProportionLogitGLM,
+     glm_matches_beta_proportion_vars_rand) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> yreal
+        = (Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.1) / 2.2;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    double alphareal = Matrix<double, 1, 1>::Random(1, 1)[0];
+    double kappareal = Matrix<double, 1, 1>::Random(1, 1)[0] + 3;
+    Matrix<var, Dynamic, 1> y = yreal;
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    var alpha = alphareal;
+    var kappa = kappareal;
+    Matrix<var, Dynamic, 1> theta = x * beta;
+    for (size_t i = 0; i < 3; i++) {
+      theta[i] += alpha;
+    }
+    var lp = stan::math::beta_proportion_lpdf(y, stan::math::inv_logit(theta),
+                                              kappa);
+    lp.grad();
+
+    double lp_val = lp.val();
+    double alpha_adj = alpha.adj();
+    double kappa_adj = kappa.adj();
+    Matrix<double, Dynamic, 1> y_adj = y.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> y2 = yreal;
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    var alpha2 = alphareal;
+    var kappa2 = kappareal;
+    var lp2 = stan::math::beta_proportion_logit_glm_lpdf(y2, x2, alpha2, beta2,
+                                                         kappa2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    EXPECT_FLOAT_EQ(alpha_adj, alpha2.adj());
+    EXPECT_FLOAT_EQ(kappa_adj, kappa2.adj());
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(y_adj[j], y2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives, with varying intercept and precision.
+TEST(ProbDistributionsBetaProportionLogitGLM,
+     glm_matches_beta_proportion_varying_intercept_and_precision) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> yreal
+        = (Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.1) / 2.2;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    Matrix<double, Dynamic, 1> alphareal
+        = Matrix<double, Dynamic, 1>::Random(3, 1);
+    Matrix<double, Dynamic, 1> kappareal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 3;
+    Matrix<var, Dynamic, 1> y = yreal;
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    Matrix<var, Dynamic, 1> alpha = alphareal;
+    Matrix<var, Dynamic, 1> kappa = kappareal;
+    Matrix<var, Dynamic, 1> theta = x * beta + alpha;
+    var lp = stan::math::beta_proportion_lpdf(y, stan::math::inv_logit(theta),
+                                              kappa);
+    lp.grad();
+
+    double lp_val = lp.val();
+    Matrix<double, Dynamic, 1> alpha_adj = alpha.adj();
+    Matrix<double, Dynamic, 1> kappa_adj = kappa.adj();
+    Matrix<double, Dynamic, 1> y_adj = y.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> y2 = yreal;
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    Matrix<var, Dynamic, 1> alpha2 = alphareal;
+    Matrix<var, Dynamic, 1> kappa2 = kappareal;
+    var lp2 = stan::math::beta_proportion_logit_glm_lpdf(y2, x2, alpha2, beta2,
+                                                         kappa2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(alpha_adj[j], alpha2[j].adj());
+      EXPECT_FLOAT_EQ(kappa_adj[j], kappa2[j].adj());
+      EXPECT_FLOAT_EQ(y_adj[j], y2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+TEST(ProbDistributionsBetaProportionLogitGLM, broadcast_x) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 0.14, 0.32, 0.821;
+  Matrix<var, Dynamic, 1> y1 = y;
+  Matrix<var, Dynamic, 1> y2 = y;
+  Matrix<double, 1, Dynamic> x(1, 2);
+  x << -1.2, 0.46;
+  Matrix<var, 1, Dynamic> x1 = x;
+  Matrix<var, Dynamic, Dynamic> x_mat = x.replicate(3, 1);
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, 2;
+  Matrix<var, Dynamic, 1> beta1 = beta;
+  Matrix<var, Dynamic, 1> beta2 = beta;
+  var alpha1 = 0.3;
+  var alpha2 = 0.3;
+  var kappa1 = 5;
+  var kappa2 = 5;
+
+  var lp1 = stan::math::beta_proportion_logit_glm_lpdf(y1, x1, alpha1, beta1,
+                                                       kappa1);
+  var lp2 = stan::math::beta_proportion_logit_glm_lpdf(y2, x_mat, alpha2,
+                                                       beta2, kappa2);
+
+  EXPECT_DOUBLE_EQ(lp1.val(), lp2.val());
+
+  (lp1 + lp2).grad();
+
+  for (int i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(y1[i].adj(), y2[i].adj());
+  }
+  for (int i = 0; i < 2; i++) {
+    EXPECT_DOUBLE_EQ(x1[i].adj(), x_mat.col(i).adj().sum());
+    EXPECT_DOUBLE_EQ(beta1[i].adj(), beta2[i].adj());
+  }
+  EXPECT_DOUBLE_EQ(alpha1.adj(), alpha2.adj());
+  EXPECT_DOUBLE_EQ(kappa1.adj(), kappa2.adj());
+}
+
+//  We check that the right errors are thrown.
+TEST(ProbDistributionsBetaProportionLogitGLM, glm_error_checking) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 0.14, 0.32, 0.821;
+  Matrix<double, Dynamic, 1> yw1(4, 1);
+  yw1 << 0.14, 0.32, 0.821, 0.5;
+  Matrix<double, Dynamic, 1> yw2(3, 1);
+  yw2 << 0.14, 1.32, 0.821;
+  Matrix<double, Dynamic, Dynamic> x
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+  Matrix<double, Dynamic, Dynamic> xw1
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2) * NAN;
+  Matrix<double, Dynamic, 1> beta = Matrix<double, Dynamic, 1>::Random(2, 1);
+  Matrix<double, Dynamic, 1> betaw1 = Matrix<double, Dynamic, 1>::Random(3, 1);
+  double alpha = 0.2;
+  double kappa = 1.2;
+
+  EXPECT_THROW(
+      stan::math::beta_proportion_logit_glm_lpdf(yw1, x, alpha, beta, kappa),
+      std::invalid_argument);
+  EXPECT_THROW(
+      stan::math::beta_proportion_logit_glm_lpdf(yw2, x, alpha, beta, kappa),
+      std::domain_error);
+  EXPECT_THROW(
+      stan::math::beta_proportion_logit_glm_lpdf(y, xw1, alpha, beta, kappa),
+      std::domain_error);
+  EXPECT_THROW(
+      stan::math::beta_proportion_logit_glm_lpdf(y, x, alpha, betaw1, kappa),
+      std::invalid_argument);
+  EXPECT_THROW(
+      stan::math::beta_proportion_logit_glm_lpdf(y, x, NAN, beta, kappa),
+      std::domain_error);
+  EXPECT_THROW(
+      stan::math::beta_proportion_logit_glm_lpdf(y, x, alpha, beta, -kappa),
+      std::domain_error);
+}
@@ -0,0 +1,220 @@
+#include <stan/math/rev.hpp>
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using stan::math::var;
+using std::vector;
+
+//  We check that the values of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsBinomialLogitGLM, glm_matches_binomial_logit_doubles) {
+  vector<int> n{1, 0, 7};
+  vector<int> N{3, 2, 10};
+  Matrix<double, Dynamic, Dynamic> x(3, 2);
+  x << -1.2, 0.46, -0.42, 2.4, 2.5, 0.27;
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, -0.8;
+  double alpha = 0.3;
+  Matrix<double, Dynamic, 1> theta = x * beta;
+  theta.array() += alpha;
+  EXPECT_FLOAT_EQ((stan::math::binomial_logit_lpmf(n, N, theta)),
+                  (stan::math::binomial_logit_glm_lpmf(n, N, x, alpha, beta)));
+  EXPECT_FLOAT_EQ(
+      (stan::math::binomial_logit_lpmf<true>(n, N, theta)),
+      (stan::math::binomial_logit_glm_lpmf<true>(n, N, x, alpha, beta)));
+}
+
+//  We check that the values of the new regression stay finite where the
+//  linear predictor is large.
+TEST(ProbDistributionsBinomialLogitGLM, glm_large_linear_predictor) {
+  vector<int> n{0, 5};
+  vector<int> N{5, 5};
+  Matrix<double, Dynamic, Dynamic> x(2, 1);
+  x << 400, -400;
+  Matrix<double, Dynamic, 1> beta(1, 1);
+  beta << 2;
+  double lp = stan::math::binomial_logit_glm_lpmf(n, N, x, 0.0, beta);
+  EXPECT_FLOAT_EQ(-8000, lp);
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsBinomialLogitGLM, glm_matches_binomial_logit_vars_rand) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    vector<int> N(3);
+    vector<int> n(3);
+    for (size_t i = 0; i < 3; i++) {
+      N[i] = Matrix<unsigned int, 1, 1>::Random(1, 1)[0] % 20;
+      n[i] = N[i] == 0 ? 0
+                       : Matrix<unsigned int, 1, 1>::Random(1, 1)[0] % N[i];
+    }
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    double alphareal = Matrix<double, 1, 1>::Random(1, 1)[0];
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    var alpha = alphareal;
+    Matrix<var, Dynamic, 1> theta = x * beta;
+    for (size_t i = 0; i < 3; i++) {
+      theta[i] += alpha;
+    }
+    var lp = stan::math::binomial_logit_lpmf(n, N, theta);
+    lp.grad();
+
+    double lp_val = lp.val();
+    double alpha_adj = alpha.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    var alpha2 = alphareal;
+    var lp2 = stan::math::binomial_logit_glm_lpmf(n, N, x2, alpha2, beta2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    EXPECT_FLOAT_EQ(alpha_adj, alpha2.adj());
+    for (size_t j = 0; j < 3; j++) {
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives, with a varying intercept.
+TEST(ProbDistributionsBinomialLogitGLM,
+     glm_matches_binomial_logit_varying_intercept) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    vector<int> n{2, 0, 4};
+    int N = 4;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    Matrix<double, Dynamic, 1> alphareal
+        = Matrix<double, Dynamic, 1>::Random(3, 1);
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    Matrix<var, Dynamic, 1> alpha = alphareal;
+    Matrix<var, Dynamic, 1> theta = x * beta + alpha;
+    var lp = stan::math::binomial_logit_lpmf(n, N, theta);
+    lp.grad();
+
+    double lp_val = lp.val();
+    Matrix<double, Dynamic, 1> alpha_adj = alpha.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    Matrix<var, Dynamic, 1> alpha2 = alphareal;
+    var lp2 = stan::math::binomial_logit_glm_lpmf(n, N, x2, alpha2, beta2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(alpha_adj[j], alpha2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+TEST(ProbDistributionsBinomialLogitGLM, broadcast_x) {
+  vector<int> n{1, 0, 3};
+  vector<int> N{2, 2, 5};
+  Matrix<double, 1, Dynamic> x(1, 2);
+  x << -1.2, 0.46;
+  Matrix<var, 1, Dynamic> x1 = x;
+  Matrix<var, Dynamic, Dynamic> x_mat = x.replicate(3, 1);
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, 2;
+  Matrix<var, Dynamic, 1> beta1 = beta;
+  Matrix<var, Dynamic, 1> beta2 = beta;
+  var alpha1 = 0.3;
+  var alpha2 = 0.3;
+
+  var lp1 = stan::math::binomial_logit_glm_lpmf(n, N, x1, alpha1, beta1);
+  var lp2 = stan::math::binomial_logit_glm_lpmf(n, N, x_mat, alpha2, beta2);
+
+  EXPECT_DOUBLE_EQ(lp1.val(), lp2.val());
+
+  (lp1 + lp2).grad();
+
+  for (int i = 0; i < 2; i++) {
+    EXPECT_DOUBLE_EQ(x1[i].adj(), x_mat.col(i).adj().sum());
+    EXPECT_DOUBLE_EQ(beta1[i].adj(), beta2[i].adj());
+  }
+  EXPECT_DOUBLE_EQ(alpha1.adj(), alpha2.adj());
+}
+
+TEST(ProbDistributionsBinomialLogitGLM, glm_matches_binomial_zero_instances) {
+  vector<int> n;
+  vector<int> N;
+  Matrix<var, Dynamic, Dynamic> x(0, 2);
+  Matrix<var, Dynamic, 1> beta(2, 1);
+  beta << 0.3, 2;
+  var alpha = 0.3;
+  var lp = stan::math::binomial_logit_glm_lpmf(n, N, x, alpha, beta);
+  lp.grad();
+  EXPECT_FLOAT_EQ(0, lp.val());
+  EXPECT_FLOAT_EQ(0, alpha.adj());
+}
+
+//  We check that the right errors are thrown.
+TEST(ProbDistributionsBinomialLogitGLM, glm_error_checking) {
+  vector<int> n{1, 0, 3};
+  vector<int> N{2, 2, 5};
+  vector<int> nw1{1, 0, 3, 1};
+  vector<int> nw2{1, 3, 3};
+  vector<int> Nw{2, -2, 5};
+  Matrix<double, Dynamic, Dynamic> x
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+  Matrix<double, Dynamic, Dynamic> xw1
+      = Matrix<double, Dynamic, Dynamic>::Random(4, 2);
+  Matrix<double, Dynamic, Dynamic> xw2
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2) * NAN;
+  Matrix<double, Dynamic, 1> alpha = Matrix<double, Dynamic, 1>::Random(3, 1);
+  Matrix<double, Dynamic, 1> alphaw1
+      = Matrix<double, Dynamic, 1>::Random(4, 1);
+  Matrix<double, Dynamic, 1> beta = Matrix<double, Dynamic, 1>::Random(2, 1);
+  Matrix<double, Dynamic, 1> betaw1 = Matrix<double, Dynamic, 1>::Random(3, 1);
+  Matrix<double, Dynamic, 1> betaw2
+      = Matrix<double, Dynamic, 1>::Random(2, 1) * NAN;
+
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(nw1, N, x, alpha, beta),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(nw2, N, x, alpha, beta),
+               std::domain_error);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(n, Nw, x, alpha, beta),
+               std::domain_error);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(n, N, xw1, alpha, beta),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(n, N, xw2, alpha, beta),
+               std::domain_error);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(n, N, x, alphaw1, beta),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(n, N, x, alpha, betaw1),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::binomial_logit_glm_lpmf(n, N, x, alpha, betaw2),
+               std::domain_error);
+}
@@ -0,0 +1,214 @@
+#include <stan/math/rev.hpp>
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using stan::math::var;
+
+//  We check that the values of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsGammaLogGLM, glm_matches_gamma_doubles) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 5.1, 0.32, 1.2;
+  Matrix<double, Dynamic, Dynamic> x(3, 2);
+  x << -1.2, 0.46, -0.42, 2.4, 2.5, 0.27;
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, -0.2;
+  double alpha = 0.3;
+  Matrix<double, Dynamic, 1> theta = x * beta;
+  theta.array() += alpha;
+  double shape = 1.5;
+  Matrix<double, Dynamic, 1> rate = shape * exp(-theta.array());
+  EXPECT_FLOAT_EQ((stan::math::gamma_lpdf(y, shape, rate)),
+                  (stan::math::gamma_log_glm_lpdf(y, x, alpha, beta, shape)));
+  EXPECT_FLOAT_EQ(
+      (stan::math::gamma_lpdf<true>(y, shape, rate)),
+      (stan::math::gamma_log_glm_lpdf<true>(y, x, alpha, beta, shape)));
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsGammaLogGLM, glm_matches_gamma_vars_rand) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> yreal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.5;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    double alphareal = Matrix<double, 1, 1>::Random(1, 1)[0];
+    double shapereal = Matrix<double, 1, 1>::Random(1, 1)[0] + 1.1;
+    Matrix<var, Dynamic, 1> y = yreal;
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    var alpha = alphareal;
+    var shape = shapereal;
+    Matrix<var, Dynamic, 1> rate(3, 1);
+    Matrix<var, Dynamic, 1> theta = x * beta;
+    for (size_t i = 0; i < 3; i++) {
+      rate[i] = shape * exp(-(theta[i] + alpha));
+    }
+    var lp = stan::math::gamma_lpdf(y, shape, rate);
+    lp.grad();
+
+    double lp_val = lp.val();
+    double alpha_adj = alpha.adj();
+    double shape_adj = shape.adj();
+    Matrix<double, Dynamic, 1> y_adj = y.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> y2 = yreal;
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    var alpha2 = alphareal;
+    var shape2 = shapereal;
+    var lp2 = stan::math::gamma_log_glm_lpdf(y2, x2, alpha2, beta2, shape2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    EXPECT_FLOAT_EQ(alpha_adj, alpha2.adj());
+    EXPECT_FLOAT_EQ(shape_adj, shape2.adj());
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(y_adj[j], y2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives, with varying intercept and shape.
+TEST(ProbDistributionsGammaLogGLM,
+     glm_matches_gamma_varying_intercept_and_shape) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> yreal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.5;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    Matrix<double, Dynamic, 1> alphareal
+        = Matrix<double, Dynamic, 1>::Random(3, 1);
+    Matrix<double, Dynamic, 1> shapereal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.1;
+    Matrix<var, Dynamic, 1> y = yreal;
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    Matrix<var, Dynamic, 1> alpha = alphareal;
+    Matrix<var, Dynamic, 1> shape = shapereal;
+    Matrix<var, Dynamic, 1> rate(3, 1);
+    Matrix<var, Dynamic, 1> theta = x * beta + alpha;
+    for (size_t i = 0; i < 3; i++) {
+      rate[i] = shape[i] * exp(-theta[i]);
+    }
+    var lp = stan::math::gamma_lpdf(y, shape, rate);
+    lp.grad();
+
+    double lp_val = lp.val();
+    Matrix<double, Dynamic, 1> alpha_adj = alpha.adj();
+    Matrix<double, Dynamic, 1> shape_adj = shape.adj();
+    Matrix<double, Dynamic, 1> y_adj = y.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> y2 = yreal;
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    Matrix<var, Dynamic, 1> alpha2 = alphareal;
+    Matrix<var, Dynamic, 1> shape2 = shapereal;
+    var lp2 = stan::math::gamma_log_glm_lpdf(y2, x2, alpha2, beta2, shape2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(alpha_adj[j], alpha2[j].adj());
+      EXPECT_FLOAT_EQ(shape_adj[j], shape2[j].adj());
+      EXPECT_FLOAT_EQ(y_adj[j], y2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+TEST(ProbDistributionsGammaLogGLM, broadcast_x) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 1.4, 3.2, 0.21;
+  Matrix<var, Dynamic, 1> y1 = y;
+  Matrix<var, Dynamic, 1> y2 = y;
+  Matrix<double, 1, Dynamic> x(1, 2);
+  x << -1.2, 0.46;
+  Matrix<var, 1, Dynamic> x1 = x;
+  Matrix<var, Dynamic, Dynamic> x_mat = x.replicate(3, 1);
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, 2;
+  Matrix<var, Dynamic, 1> beta1 = beta;
+  Matrix<var, Dynamic, 1> beta2 = beta;
+  var alpha1 = 0.3;
+  var alpha2 = 0.3;
+  var shape1 = 2;
+  var shape2 = 2;
+
+  var lp1 = stan::math::gamma_log_glm_lpdf(y1, x1, alpha1, beta1, shape1);
+  var lp2 = stan::math::gamma_log_glm_lpdf(y2, x_mat, alpha2, beta2, shape2);
+
+  EXPECT_DOUBLE_EQ(lp1.val(), lp2.val());
+
+  (lp1 + lp2).grad();
+
+  for (int i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(y1[i].adj(), y2[i].adj());
+  }
+  for (int i = 0; i < 2; i++) {
+    EXPECT_DOUBLE_EQ(x1[i].adj(), x_mat.col(i).adj().sum());
+    EXPECT_DOUBLE_EQ(beta1[i].adj(), beta2[i].adj());
+  }
+  EXPECT_DOUBLE_EQ(alpha1.adj(), alpha2.adj());
+  EXPECT_DOUBLE_EQ(shape1.adj(), shape2.adj());
+}
+
+//  We check that the right errors are thrown.
+TEST(ProbDistributionsGammaLogGLM, glm_error_checking) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 1.4, 3.2, 0.21;
+  Matrix<double, Dynamic, 1> yw1(4, 1);
+  yw1 << 1.4, 3.2, 0.21, 1;
+  Matrix<double, Dynamic, 1> yw2(3, 1);
+  yw2 << 1.4, -3.2, 0.21;
+  Matrix<double, Dynamic, Dynamic> x
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+  Matrix<double, Dynamic, Dynamic> xw1
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2) * NAN;
+  Matrix<double, Dynamic, 1> beta = Matrix<double, Dynamic, 1>::Random(2, 1);
+  Matrix<double, Dynamic, 1> betaw1 = Matrix<double, Dynamic, 1>::Random(3, 1);
+  double alpha = 0.2;
+  double shape = 1.2;
+
+  EXPECT_THROW(stan::math::gamma_log_glm_lpdf(yw1, x, alpha, beta, shape),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::gamma_log_glm_lpdf(yw2, x, alpha, beta, shape),
+               std::domain_error);
+  EXPECT_THROW(stan::math::gamma_log_glm_lpdf(y, xw1, alpha, beta, shape),
+               std::domain_error);
+  EXPECT_THROW(stan::math::gamma_log_glm_lpdf(y, x, alpha, betaw1, shape),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::gamma_log_glm_lpdf(y, x, NAN, beta, shape),
+               std::domain_error);
+  EXPECT_THROW(stan::math::gamma_log_glm_lpdf(y, x, alpha, beta, -shape),
+               std::domain_error);
+}
@@ -0,0 +1,222 @@
+// the tests here check that the GLMs give the same results when large data
+// sets are split into chunks evaluated in parallel, as such these tests
+// only run if STAN_THREADS is defined. The size thresholds are lowered so
+// that small data sets are split.
+
+#ifdef STAN_THREADS
+
+#define STAN_MATH_PARALLEL_DENSITY_MIN_SIZE 64
+#define STAN_MATH_PARALLEL_DENSITY_CHUNK_SIZE 16
+
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <test/unit/math/prim/functor/utils_threads.hpp>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using stan::math::var;
+
+namespace {
+
+const int N = 200;
+
+Matrix<double, Dynamic, Dynamic> glm_threads_x() {
+  Matrix<double, Dynamic, Dynamic> x(N, 2);
+  for (int n = 0; n < N; ++n) {
+    x(n, 0) = 0.01 * n - 1.0;
+    x(n, 1) = 0.5 * ((n * 7) % 11) / 11.0;
+  }
+  return x;
+}
+
+std::vector<int> glm_threads_ints(int mod) {
+  std::vector<int> y(N);
+  for (int n = 0; n < N; ++n) {
+    y[n] = (n * 7) % mod;
+  }
+  return y;
+}
+
+Matrix<double, Dynamic, 1> glm_threads_reals(double offset, double scale) {
+  Matrix<double, Dynamic, 1> y(N);
+  for (int n = 0; n < N; ++n) {
+    y(n) = offset + scale * ((n * 5) % 13) / 13.0;
+  }
+  return y;
+}
+
+std::vector<int> rows(const std::vector<int>& y, int start, int n) {
+  return std::vector<int>(y.begin() + start, y.begin() + start + n);
+}
+
+Matrix<double, Dynamic, 1> rows(const Matrix<double, Dynamic, 1>& y,
+                                int start, int n) {
+  return y.segment(start, n);
+}
+
+Matrix<var, Dynamic, 1> vector_of(const std::vector<var>& theta, int start,
+                                  int size) {
+  Matrix<var, Dynamic, 1> v(size);
+  for (int i = 0; i < size; ++i) {
+    v(i) = theta[start + i];
+  }
+  return v;
+}
+
+// compares the value and gradients of f(start, n, x, theta) evaluated with
+// all N rows of x, which are split into chunks, with the sum of f
+// evaluated with the individual rows
+template <typename F>
+void expect_chunks_match_rows(const F& f, const std::vector<double>& theta) {
+  set_n_threads(4);
+  stan::math::init_threadpool_tbb();
+  ASSERT_GT(stan::math::internal::num_parallel_chunks(N), 1);
+  const Matrix<double, Dynamic, Dynamic> x_val = glm_threads_x();
+
+  Matrix<var, Dynamic, Dynamic> x = stan::math::to_var(x_val);
+  std::vector<var> theta_chunks(theta.begin(), theta.end());
+  var lp = f(0, N, x, theta_chunks);
+  lp.grad();
+  const double lp_val = lp.val();
+  const Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+  std::vector<double> theta_adj(theta.size());
+  for (size_t i = 0; i < theta.size(); ++i) {
+    theta_adj[i] = theta_chunks[i].adj();
+  }
+  stan::math::recover_memory();
+
+  Matrix<var, Dynamic, Dynamic> x_rows = stan::math::to_var(x_val);
+  std::vector<var> theta_rows(theta.begin(), theta.end());
+  var lp_rows = 0;
+  for (int n = 0; n < N; ++n) {
+    Matrix<var, Dynamic, Dynamic> x_row = x_rows.middleRows(n, 1);
+    lp_rows += f(n, 1, x_row, theta_rows);
+  }
+  lp_rows.grad();
+  EXPECT_FLOAT_EQ(lp_rows.val(), lp_val);
+  for (size_t i = 0; i < theta.size(); ++i) {
+    EXPECT_FLOAT_EQ(theta_rows[i].adj(), theta_adj[i]);
+  }
+  for (int n = 0; n < N; ++n) {
+    for (int k = 0; k < x_val.cols(); ++k) {
+      EXPECT_FLOAT_EQ(x_rows(n, k).adj(), x_adj(n, k));
+    }
+  }
+  stan::math::recover_memory();
+}
+
+}  // namespace
+
+TEST(ProbDistributionsGLMThreads, bernoulli_logit) {
+  const std::vector<int> y = glm_threads_ints(2);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::bernoulli_logit_glm_lpmf(
+        rows(y, start, n), x, theta[0], vector_of(theta, 1, 2));
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2});
+}
+
+TEST(ProbDistributionsGLMThreads, binomial_logit) {
+  const std::vector<int> successes = glm_threads_ints(4);
+  const std::vector<int> trials(N, 5);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::binomial_logit_glm_lpmf(
+        rows(successes, start, n), rows(trials, start, n), x, theta[0],
+        vector_of(theta, 1, 2));
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2});
+}
+
+TEST(ProbDistributionsGLMThreads, neg_binomial_2_log) {
+  const std::vector<int> y = glm_threads_ints(5);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::neg_binomial_2_log_glm_lpmf(
+        rows(y, start, n), x, theta[0], vector_of(theta, 1, 2), theta[3]);
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2, 2.5});
+}
+
+TEST(ProbDistributionsGLMThreads, normal_id) {
+  const Matrix<double, Dynamic, 1> y = glm_threads_reals(-1, 3);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::normal_id_glm_lpdf(
+        rows(y, start, n), x, theta[0], vector_of(theta, 1, 2), theta[3]);
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2, 1.5});
+}
+
+TEST(ProbDistributionsGLMThreads, student_t_id) {
+  const Matrix<double, Dynamic, 1> y = glm_threads_reals(-1, 3);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::student_t_id_glm_lpdf(rows(y, start, n), x, theta[0],
+                                             vector_of(theta, 1, 2), theta[3],
+                                             theta[4]);
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2, 4.5, 1.5});
+}
+
+TEST(ProbDistributionsGLMThreads, lognormal_id) {
+  const Matrix<double, Dynamic, 1> y = glm_threads_reals(0.2, 3);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::lognormal_id_glm_lpdf(
+        rows(y, start, n), x, theta[0], vector_of(theta, 1, 2), theta[3]);
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2, 1.5});
+}
+
+TEST(ProbDistributionsGLMThreads, gamma_log) {
+  const Matrix<double, Dynamic, 1> y = glm_threads_reals(0.2, 3);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::gamma_log_glm_lpdf(
+        rows(y, start, n), x, theta[0], vector_of(theta, 1, 2), theta[3]);
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2, 2.5});
+}
+
+TEST(ProbDistributionsGLMThreads, beta_proportion_logit) {
+  const Matrix<double, Dynamic, 1> y = glm_threads_reals(0.05, 0.9);
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::beta_proportion_logit_glm_lpdf(
+        rows(y, start, n), x, theta[0], vector_of(theta, 1, 2), theta[3]);
+  };
+  expect_chunks_match_rows(f, {0.4, 0.3, -0.2, 5.5});
+}
+
+TEST(ProbDistributionsGLMThreads, ordered_logistic) {
+  std::vector<int> y = glm_threads_ints(3);
+  for (int& y_n : y) {
+    ++y_n;
+  }
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    return stan::math::ordered_logistic_glm_lpmf(
+        rows(y, start, n), x, vector_of(theta, 0, 2), vector_of(theta, 2, 2));
+  };
+  expect_chunks_match_rows(f, {0.3, -0.2, -0.5, 0.6});
+}
+
+TEST(ProbDistributionsGLMThreads, categorical_logit) {
+  std::vector<int> y = glm_threads_ints(3);
+  for (int& y_n : y) {
+    ++y_n;
+  }
+  auto f = [&](int start, int n, const Matrix<var, Dynamic, Dynamic>& x,
+               const std::vector<var>& theta) {
+    Matrix<var, Dynamic, Dynamic> beta(2, 3);
+    beta << theta[3], theta[4], theta[5], theta[6], theta[7], theta[8];
+    return stan::math::categorical_logit_glm_lpmf(
+        rows(y, start, n), x, vector_of(theta, 0, 3), beta);
+  };
+  expect_chunks_match_rows(f, {0.4, -0.1, 0.2, 0.3, -0.2, 0.1, 0.5, 0.2, -0.4});
+}
+
+#endif
@@ -98,3 +98,39 @@ TEST(ProbDistributionsLkjCorrCholesky, gradients) {
   test_grad_eq(grad_1, grad_ad_1);
   EXPECT_FLOAT_EQ(fx, fx_ad);
 }
+
+TEST(ProbDistributionsLkjCorrCholesky, gradients_eta) {
+  using stan::math::finite_diff_gradient;
+  using stan::math::gradient;
+  // unconstrained eta of 0 is eta == 1, where the density is constant
+  // in L but its derivative with respect to eta is not
+  for (int K : {1, 2, 4}) {
+    for (double eta_uc : {0.0, 0.5, -0.7}) {
+      Eigen::Matrix<double, Eigen::Dynamic, 1> x(1 + K * (K - 1) / 2);
+      x(0) = eta_uc;
+      for (int i = 1; i < x.size(); ++i) {
+        x(i) = 0.3 * i - 0.8;
+      }
+      Eigen::Matrix<double, Eigen::Dynamic, 1> eta(1);
+      eta(0) = eta_uc;
+
+      stan::math::lkj_corr_cholesky_cd test_func_cd(K);
+      stan::math::lkj_corr_cholesky_dd test_func_dd(K);
+
+      Eigen::Matrix<double, Eigen::Dynamic, 1> grad;
+      double fx;
+      Eigen::Matrix<double, Eigen::Dynamic, 1> grad_ad;
+      double fx_ad;
+
+      finite_diff_gradient(test_func_cd, eta, fx, grad);
+      gradient(test_func_cd, eta, fx_ad, grad_ad);
+      test_grad_eq(grad, grad_ad);
+      EXPECT_FLOAT_EQ(fx, fx_ad);
+
+      finite_diff_gradient(test_func_dd, x, fx, grad);
+      gradient(test_func_dd, x, fx_ad, grad_ad);
+      test_grad_eq(grad, grad_ad);
+      EXPECT_FLOAT_EQ(fx, fx_ad);
+    }
+  }
+}
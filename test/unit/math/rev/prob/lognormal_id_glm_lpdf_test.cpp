@@ -0,0 +1,234 @@
+#include <stan/math/rev.hpp>
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+using stan::math::var;
+
+//  We check that the values of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsLognormalIdGLM, glm_matches_lognormal_doubles) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 5.1, 0.32, 1.2;
+  Matrix<double, Dynamic, Dynamic> x(3, 2);
+  x << -1.2, 0.46, -0.42, 2.4, 2.5, 0.27;
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, -0.2;
+  double alpha = 0.3;
+  Matrix<double, Dynamic, 1> theta = x * beta;
+  theta.array() += alpha;
+  double sigma = 1.5;
+  EXPECT_FLOAT_EQ(
+      (stan::math::lognormal_lpdf(y, theta, sigma)),
+      (stan::math::lognormal_id_glm_lpdf(y, x, alpha, beta, sigma)));
+  EXPECT_FLOAT_EQ(
+      (stan::math::lognormal_lpdf<true>(y, theta, sigma)),
+      (stan::math::lognormal_id_glm_lpdf<true>(y, x, alpha, beta, sigma)));
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives.
+TEST(ProbDistributionsLognormalIdGLM, glm_matches_lognormal_vars_rand) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> yreal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.5;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    double alphareal = Matrix<double, 1, 1>::Random(1, 1)[0];
+    double sigmareal = Matrix<double, 1, 1>::Random(1, 1)[0] + 1.1;
+    Matrix<var, Dynamic, 1> y = yreal;
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    var alpha = alphareal;
+    var sigma = sigmareal;
+    Matrix<var, Dynamic, 1> theta = x * beta;
+    for (size_t i = 0; i < 3; i++) {
+      theta[i] += alpha;
+    }
+    var lp = stan::math::lognormal_lpdf(y, theta, sigma);
+    lp.grad();
+
+    double lp_val = lp.val();
+    double alpha_adj = alpha.adj();
+    double sigma_adj = sigma.adj();
+    Matrix<double, Dynamic, 1> y_adj = y.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> y2 = yreal;
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    var alpha2 = alphareal;
+    var sigma2 = sigmareal;
+    var lp2 = stan::math::lognormal_id_glm_lpdf(y2, x2, alpha2, beta2, sigma2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    EXPECT_FLOAT_EQ(alpha_adj, alpha2.adj());
+    EXPECT_FLOAT_EQ(sigma_adj, sigma2.adj());
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(y_adj[j], y2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+//  We check that the gradients of the new regression match those of one built
+//  from existing primitives, with varying intercept and scale.
+TEST(ProbDistributionsLognormalIdGLM,
+     glm_matches_lognormal_varying_intercept_and_scale) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> yreal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.5;
+    Matrix<double, Dynamic, Dynamic> xreal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(2, 1);
+    Matrix<double, Dynamic, 1> alphareal
+        = Matrix<double, Dynamic, 1>::Random(3, 1);
+    Matrix<double, Dynamic, 1> sigmareal
+        = Matrix<double, Dynamic, 1>::Random(3, 1).array() + 1.1;
+    Matrix<var, Dynamic, 1> y = yreal;
+    Matrix<var, Dynamic, 1> beta = betareal;
+    Matrix<var, Dynamic, Dynamic> x = xreal;
+    Matrix<var, Dynamic, 1> alpha = alphareal;
+    Matrix<var, Dynamic, 1> sigma = sigmareal;
+    Matrix<var, Dynamic, 1> theta = x * beta + alpha;
+    var lp = stan::math::lognormal_lpdf(y, theta, sigma);
+    lp.grad();
+
+    double lp_val = lp.val();
+    Matrix<double, Dynamic, 1> alpha_adj = alpha.adj();
+    Matrix<double, Dynamic, 1> sigma_adj = sigma.adj();
+    Matrix<double, Dynamic, 1> y_adj = y.adj();
+    Matrix<double, Dynamic, Dynamic> x_adj = x.adj();
+    Matrix<double, Dynamic, 1> beta_adj = beta.adj();
+
+    stan::math::recover_memory();
+
+    Matrix<var, Dynamic, 1> y2 = yreal;
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    Matrix<var, Dynamic, Dynamic> x2 = xreal;
+    Matrix<var, Dynamic, 1> alpha2 = alphareal;
+    Matrix<var, Dynamic, 1> sigma2 = sigmareal;
+    var lp2 = stan::math::lognormal_id_glm_lpdf(y2, x2, alpha2, beta2, sigma2);
+    lp2.grad();
+    EXPECT_FLOAT_EQ(lp_val, lp2.val());
+    for (size_t i = 0; i < 2; i++) {
+      EXPECT_FLOAT_EQ(beta_adj[i], beta2[i].adj());
+    }
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_FLOAT_EQ(alpha_adj[j], alpha2[j].adj());
+      EXPECT_FLOAT_EQ(sigma_adj[j], sigma2[j].adj());
+      EXPECT_FLOAT_EQ(y_adj[j], y2[j].adj());
+      for (size_t i = 0; i < 2; i++) {
+        EXPECT_FLOAT_EQ(x_adj(j, i), x2(j, i).adj());
+      }
+    }
+    stan::math::recover_memory();
+  }
+}
+
+TEST(ProbDistributionsLognormalIdGLM, broadcast_x) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 1.4, 3.2, 0.21;
+  Matrix<var, Dynamic, 1> y1 = y;
+  Matrix<var, Dynamic, 1> y2 = y;
+  Matrix<double, 1, Dynamic> x(1, 2);
+  x << -1.2, 0.46;
+  Matrix<var, 1, Dynamic> x1 = x;
+  Matrix<var, Dynamic, Dynamic> x_mat = x.replicate(3, 1);
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, 2;
+  Matrix<var, Dynamic, 1> beta1 = beta;
+  Matrix<var, Dynamic, 1> beta2 = beta;
+  var alpha1 = 0.3;
+  var alpha2 = 0.3;
+  var sigma1 = 2;
+  var sigma2 = 2;
+
+  var lp1 = stan::math::lognormal_id_glm_lpdf(y1, x1, alpha1, beta1, sigma1);
+  var lp2 = stan::math::lognormal_id_glm_lpdf(y2, x_mat, alpha2, beta2, sigma2);
+
+  EXPECT_DOUBLE_EQ(lp1.val(), lp2.val());
+
+  (lp1 + lp2).grad();
+
+  for (int i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(y1[i].adj(), y2[i].adj());
+  }
+  for (int i = 0; i < 2; i++) {
+    EXPECT_DOUBLE_EQ(x1[i].adj(), x_mat.col(i).adj().sum());
+    EXPECT_DOUBLE_EQ(beta1[i].adj(), beta2[i].adj());
+  }
+  EXPECT_DOUBLE_EQ(alpha1.adj(), alpha2.adj());
+  EXPECT_DOUBLE_EQ(sigma1.adj(), sigma2.adj());
+}
+
+TEST(ProbDistributionsLognormalIdGLM, broadcast_y) {
+  double y = 1.3;
+  var y1 = y;
+  Matrix<var, Dynamic, 1> y_vec = Matrix<double, Dynamic, 1>::Constant(3, 1, y);
+  Matrix<double, Dynamic, Dynamic> x(3, 2);
+  x << -1.2, 0.46, -0.42, 2.4, 2.5, 0.27;
+  Matrix<double, Dynamic, 1> beta(2, 1);
+  beta << 0.3, 2;
+  var alpha1 = 0.3;
+  var alpha2 = 0.3;
+  var sigma1 = 2;
+  var sigma2 = 2;
+
+  var lp1 = stan::math::lognormal_id_glm_lpdf(y1, x, alpha1, beta, sigma1);
+  var lp2 = stan::math::lognormal_id_glm_lpdf(y_vec, x, alpha2, beta, sigma2);
+
+  EXPECT_DOUBLE_EQ(lp1.val(), lp2.val());
+
+  (lp1 + lp2).grad();
+
+  EXPECT_DOUBLE_EQ(y1.adj(), y_vec.adj().sum());
+  EXPECT_DOUBLE_EQ(alpha1.adj(), alpha2.adj());
+  EXPECT_DOUBLE_EQ(sigma1.adj(), sigma2.adj());
+}
+
+//  We check that the right errors are thrown.
+TEST(ProbDistributionsLognormalIdGLM, glm_error_checking) {
+  Matrix<double, Dynamic, 1> y(3, 1);
+  y << 1.4, 3.2, 0.21;
+  Matrix<double, Dynamic, 1> yw1(4, 1);
+  yw1 << 1.4, 3.2, 0.21, 1;
+  Matrix<double, Dynamic, 1> yw2(3, 1);
+  yw2 << 1.4, -3.2, 0.21;
+  Matrix<double, Dynamic, Dynamic> x
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2);
+  Matrix<double, Dynamic, Dynamic> xw1
+      = Matrix<double, Dynamic, Dynamic>::Random(3, 2) * NAN;
+  Matrix<double, Dynamic, 1> beta = Matrix<double, Dynamic, 1>::Random(2, 1);
+  Matrix<double, Dynamic, 1> betaw1 = Matrix<double, Dynamic, 1>::Random(3, 1);
+  double alpha = 0.2;
+  double sigma = 1.2;
+
+  EXPECT_THROW(stan::math::lognormal_id_glm_lpdf(yw1, x, alpha, beta, sigma),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::lognormal_id_glm_lpdf(yw2, x, alpha, beta, sigma),
+               std::domain_error);
+  EXPECT_THROW(stan::math::lognormal_id_glm_lpdf(y, xw1, alpha, beta, sigma),
+               std::domain_error);
+  EXPECT_THROW(stan::math::lognormal_id_glm_lpdf(y, x, alpha, betaw1, sigma),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::lognormal_id_glm_lpdf(y, x, NAN, beta, sigma),
+               std::domain_error);
+  EXPECT_THROW(stan::math::lognormal_id_glm_lpdf(y, x, alpha, beta, -sigma),
+               std::domain_error);
+}
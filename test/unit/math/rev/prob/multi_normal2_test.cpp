@@ -417,3 +417,65 @@ TEST(ProbDistributionsMultiNormal, TestGradFunctionalVectorized) {
   test_all<-1, 1>();
   test_all<-1, -1>();
 }
+
+TEST(ProbDistributionsMultiNormal, gradientsMatchAutodiffReference) {
+  using stan::math::dot_product;
+  using stan::math::log_determinant;
+  using stan::math::mdivide_left;
+  using stan::math::multi_normal_lpdf;
+  vector<Matrix<double, Dynamic, 1>> y_dbl(4, Matrix<double, Dynamic, 1>(3));
+  y_dbl[0] << 2.0, -2.0, 11.0;
+  y_dbl[1] << 0.5, 1.0, -3.0;
+  y_dbl[2] << -1.0, 0.0, 2.5;
+  y_dbl[3] << 3.0, -4.0, 1.0;
+  Matrix<double, Dynamic, 1> mu_dbl(3);
+  mu_dbl << 1.0, -1.0, 3.0;
+  Matrix<double, Dynamic, Dynamic> Sigma_dbl(3, 3);
+  Sigma_dbl << 9.0, -3.0, 1.0, -3.0, 4.0, 0.5, 1.0, 0.5, 5.0;
+
+  vector<Matrix<var, Dynamic, 1>> y1(y_dbl.begin(), y_dbl.end());
+  Matrix<var, Dynamic, 1> mu1 = mu_dbl;
+  Matrix<var, Dynamic, Dynamic> Sigma1 = Sigma_dbl;
+  var lp1 = multi_normal_lpdf(y1, mu1, Sigma1);
+  lp1.grad();
+  const double lp1_val = lp1.val();
+  vector<double> grad1;
+  for (size_t n = 0; n < y1.size(); ++n) {
+    for (int i = 0; i < 3; ++i) {
+      grad1.push_back(y1[n](i).adj());
+    }
+  }
+  for (int i = 0; i < 3; ++i) {
+    grad1.push_back(mu1(i).adj());
+    for (int j = 0; j < 3; ++j) {
+      grad1.push_back(Sigma1(i, j).adj());
+    }
+  }
+  stan::math::set_zero_all_adjoints();
+
+  vector<Matrix<var, Dynamic, 1>> y2(y_dbl.begin(), y_dbl.end());
+  Matrix<var, Dynamic, 1> mu2 = mu_dbl;
+  Matrix<var, Dynamic, Dynamic> Sigma2 = Sigma_dbl;
+  var lp2 = -0.5 * y2.size() * log_determinant(Sigma2)
+            + y2.size() * 3 * stan::math::NEG_LOG_SQRT_TWO_PI;
+  for (size_t n = 0; n < y2.size(); ++n) {
+    Matrix<var, Dynamic, 1> diff = y2[n] - mu2;
+    lp2 -= 0.5 * dot_product(diff, mdivide_left(Sigma2, diff));
+  }
+  lp2.grad();
+
+  EXPECT_FLOAT_EQ(lp2.val(), lp1_val);
+  size_t k = 0;
+  for (size_t n = 0; n < y1.size(); ++n) {
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_FLOAT_EQ(y2[n](i).adj(), grad1[k++]);
+    }
+  }
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_FLOAT_EQ(mu2(i).adj(), grad1[k++]);
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_FLOAT_EQ(Sigma2(i, j).adj(), grad1[k++]);
+    }
+  }
+  stan::math::recover_memory();
+}
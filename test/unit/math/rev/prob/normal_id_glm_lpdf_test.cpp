@@ -618,3 +618,59 @@ TEST(ProbDistributionsNormalIdGLM, glm_matches_normal_id_error_checking) {
   EXPECT_THROW(stan::math::normal_id_glm_lpdf(y, x, alpha, beta, sigmaw3),
                std::domain_error);
 }
+
+//  We check that the version using sufficient statistics matches the one
+//  using the full data.
+TEST(ProbDistributionsNormalIdGLM, glm_sufficient_stats_matches_full_data) {
+  for (size_t ii = 0; ii < 42; ii++) {
+    Matrix<double, Dynamic, 1> y = Matrix<double, Dynamic, 1>::Random(5, 1);
+    Matrix<double, Dynamic, Dynamic> x
+        = Matrix<double, Dynamic, Dynamic>::Random(5, 3);
+    Matrix<double, Dynamic, 1> betareal
+        = Matrix<double, Dynamic, Dynamic>::Random(3, 1);
+    double alphareal = Matrix<double, 1, 1>::Random(1, 1)[0];
+    double sigmareal = Matrix<double, 1, 1>::Random(1, 1)[0] + 1.1;
+    stan::math::glm_sufficient_stats stats(y, x);
+
+    EXPECT_FLOAT_EQ(
+        stan::math::normal_id_glm_lpdf(y, x, alphareal, betareal, sigmareal),
+        stan::math::normal_id_glm_lpdf(stats, alphareal, betareal, sigmareal));
+
+    Matrix<var, Dynamic, 1> beta1 = betareal;
+    var alpha1 = alphareal;
+    var sigma1 = sigmareal;
+    var lp1 = stan::math::normal_id_glm_lpdf<true>(y, x, alpha1, beta1, sigma1);
+    Matrix<var, Dynamic, 1> beta2 = betareal;
+    var alpha2 = alphareal;
+    var sigma2 = sigmareal;
+    var lp2
+        = stan::math::normal_id_glm_lpdf<true>(stats, alpha2, beta2, sigma2);
+    EXPECT_FLOAT_EQ(lp1.val(), lp2.val());
+    (lp1 + lp2).grad();
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_FLOAT_EQ(beta1[i].adj(), beta2[i].adj());
+    }
+    EXPECT_FLOAT_EQ(alpha1.adj(), alpha2.adj());
+    EXPECT_FLOAT_EQ(sigma1.adj(), sigma2.adj());
+    stan::math::recover_memory();
+  }
+}
+
+TEST(ProbDistributionsNormalIdGLM, glm_sufficient_stats_error_checking) {
+  Matrix<double, Dynamic, 1> y = Matrix<double, Dynamic, 1>::Random(5, 1);
+  Matrix<double, Dynamic, Dynamic> x
+      = Matrix<double, Dynamic, Dynamic>::Random(5, 3);
+  Matrix<double, Dynamic, 1> beta = Matrix<double, Dynamic, 1>::Random(3, 1);
+  Matrix<double, Dynamic, 1> betaw1 = Matrix<double, Dynamic, 1>::Random(2, 1);
+  Matrix<double, Dynamic, 1> betaw2 = beta * NAN;
+  stan::math::glm_sufficient_stats stats(y, x);
+
+  EXPECT_THROW(stan::math::normal_id_glm_lpdf(stats, 0.5, betaw1, 1.0),
+               std::invalid_argument);
+  EXPECT_THROW(stan::math::normal_id_glm_lpdf(stats, 0.5, betaw2, 1.0),
+               std::domain_error);
+  EXPECT_THROW(stan::math::normal_id_glm_lpdf(stats, NAN, beta, 1.0),
+               std::domain_error);
+  EXPECT_THROW(stan::math::normal_id_glm_lpdf(stats, 0.5, beta, -1.0),
+               std::domain_error);
+}